@@ -0,0 +1,48 @@
+/*
+ * Handset equalizer biquad cascades generated by tools/eq_design.py - do not edit
+ */
+#include <stdint.h>
+
+#define EQ_PROFILE_NUM    3
+#define EQ_PROFILE_STAGES 3
+
+// Sections in each cascade [profile][mic, speaker]
+static const uint8_t eq_profile_stages[EQ_PROFILE_NUM][2] = {
+	{0, 0},    // Flat
+	{3, 2},    // Carbon
+	{2, 1},    // Electret
+};
+
+// Q28 b0, b1, b2, a1, a2 [profile][mic, speaker][8 kHz, 16 kHz][section]
+static const int32_t eq_profile_coeffs[EQ_PROFILE_NUM][2][2][EQ_PROFILE_STAGES][5] = {
+	{   // Flat
+		{
+			{{0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+			{{0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+		},
+		{
+			{{0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+			{{0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+		},
+	},
+	{   // Carbon
+		{
+			{{280629093, -440448760, 181559845, -444460287, 189741955}, {222845842, -101523457, 105690967, -101523457, 60101354}, {287842267, 313096873, 154943577, 313096873, 174350389}},
+			{{274507439, -489365597, 220730702, -490449207, 225719075}, {235356462, -312043905, 150351016, -312043905, 117272022}, {292498887, -160807539, 127711464, -160807539, 151774895}},
+		},
+		{
+			{{281402579, -396189616, 153886869, -401899251, 161144357}, {248102992, -281169213, 149530322, -281169213, 129197858}, {0, 0, 0, 0, 0}},
+			{{274923305, -467170905, 203145393, -468762278, 208041869}, {255945403, -416982390, 195393083, -416982390, 182903031}, {0, 0, 0, 0, 0}},
+		},
+	},
+	{   // Electret
+		{
+			{{263346569, -473167552, 214778709, -472144928, 210712447}, {245001674, 249300614, 88421250, 231948808, 82339273}, {0, 0, 0, 0, 0}},
+			{{265872207, -504672188, 240112695, -504401416, 237820219}, {217018111, -79551550, 42396094, -149469601, 60896799}, {0, 0, 0, 0, 0}},
+		},
+		{
+			{{288705570, 145534451, 91594279, 145534451, 111864392}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+			{{287226213, -217631716, 104500526, -217631716, 123291283}, {0, 0, 0, 0, 0}, {0, 0, 0, 0, 0}},
+		},
+	},
+};
@@ -30,6 +30,7 @@
 #include <string.h>
 #include "driver/gpio.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/semphr.h"
 
 #include "es8388.h"
@@ -54,11 +55,16 @@ struct audio_hal {
     esp_err_t (*audio_codec_get_volume)(int *volume);
     esp_err_t (*audio_codec_set_mic_volume)(int volume);
     esp_err_t (*audio_codec_get_mic_volume)(int *volume);
+    esp_err_t (*audio_codec_idle)(bool idle);
+    esp_err_t (*audio_codec_set_adc_dsp)(audio_hal_adc_dsp_t dsp);
+    int start_settle_msec;
+    int resume_settle_msec;
     xSemaphoreHandle audio_hal_lock;
     void *handle;
 };
 
 static audio_hal_handle_t audio_hal;
+static StaticSemaphore_t audio_hal_lock_buf;
 
 // Add codecs here (match AUDIO_CODEC_XXXXX defines)
 static struct audio_hal audio_hal_codecs_default[] = {
@@ -70,10 +76,19 @@ static struct audio_hal audio_hal_codecs_default[] = {
         .audio_codec_set_volume = es8388_set_voice_volume,
         .audio_codec_get_volume = es8388_get_voice_volume,
         .audio_codec_set_mic_volume = es8388_set_mic_volume,
-        .audio_codec_get_mic_volume = es8388_get_mic_volume
+        .audio_codec_get_mic_volume = es8388_get_mic_volume,
+        .audio_codec_idle = es8388_idle,
+        .audio_codec_set_adc_dsp = es8388_set_adc_dsp,
+        .start_settle_msec = ES8388_START_SETTLE_MSEC,
+        .resume_settle_msec = ES8388_RESUME_SETTLE_MSEC
     }
 };
 
+// Power state (the first use runs the full start sequence)
+static audio_hal_power_stats_t audio_hal_power_stats = {
+    .state = AUDIO_HAL_POWER_OFF
+};
+
 
 
 //
@@ -91,7 +106,7 @@ bool audio_hal_init(audio_hal_codec_config_t *audio_hal_conf, int index)
     	return false;
     }
     memcpy(audio_hal, &audio_hal_codecs_default[index], sizeof(struct audio_hal));
-    audio_hal->audio_hal_lock = xSemaphoreCreateMutex();
+    audio_hal->audio_hal_lock = xSemaphoreCreateMutexStatic(&audio_hal_lock_buf);
     if (audio_hal->audio_hal_lock == NULL) {
     	ESP_LOGE(TAG, "Could not create audio_hal_lock semaphore");
     	return false;
@@ -131,6 +146,71 @@ esp_err_t audio_hal_ctrl_codec(audio_hal_codec_mode_t mode, audio_hal_ctrl_t aud
     return ret;
 }
 
+esp_err_t audio_hal_set_power(audio_hal_power_t state)
+{
+    esp_err_t ret = ESP_OK;
+    audio_hal_power_t cur;
+    int64_t t;
+    uint32_t usec;
+    AUDIO_HAL_CHECK_NULL(audio_hal, "audio_hal handle is null", -1);
+    mutex_lock(audio_hal->audio_hal_lock);
+    cur = audio_hal_power_stats.state;
+    if (state != cur) {
+        t = esp_timer_get_time();
+        if (state == AUDIO_HAL_POWER_OFF) {
+            ret = audio_hal->audio_codec_ctrl(AUDIO_HAL_CODEC_MODE_BOTH, AUDIO_HAL_CTRL_STOP);
+            audio_hal_power_stats.stops++;
+        } else if (cur == AUDIO_HAL_POWER_OFF) {
+            // A start is needed before the codec can idle
+            ret = audio_hal->audio_codec_ctrl(AUDIO_HAL_CODEC_MODE_BOTH, AUDIO_HAL_CTRL_START);
+            if (state == AUDIO_HAL_POWER_IDLE) {
+                ret |= audio_hal->audio_codec_idle(true);
+                audio_hal_power_stats.idles++;
+            } else {
+                audio_hal_power_stats.starts++;
+            }
+        } else {
+            ret = audio_hal->audio_codec_idle(state == AUDIO_HAL_POWER_IDLE);
+            if (state == AUDIO_HAL_POWER_IDLE) {
+                audio_hal_power_stats.idles++;
+            } else {
+                audio_hal_power_stats.resumes++;
+            }
+        }
+        usec = (uint32_t) (esp_timer_get_time() - t);
+        if (state == AUDIO_HAL_POWER_ON) {
+            if (cur == AUDIO_HAL_POWER_OFF) {
+                if (usec > audio_hal_power_stats.max_start_usec) audio_hal_power_stats.max_start_usec = usec;
+            } else {
+                if (usec > audio_hal_power_stats.max_resume_usec) audio_hal_power_stats.max_resume_usec = usec;
+            }
+        }
+        audio_hal_power_stats.state = state;
+        ESP_LOGI(TAG, "Codec power %d -> %d (%u uSec)", cur, state, usec);
+    }
+    mutex_unlock(audio_hal->audio_hal_lock);
+    return ret;
+}
+
+audio_hal_power_t audio_hal_get_power()
+{
+    return audio_hal_power_stats.state;
+}
+
+audio_hal_power_t audio_hal_select_power(int expected_msec)
+{
+    return (expected_msec < AUDIO_HAL_IDLE_MAX_MSEC) ? AUDIO_HAL_POWER_IDLE : AUDIO_HAL_POWER_OFF;
+}
+
+void audio_hal_get_power_stats(audio_hal_power_stats_t* stats)
+{
+    memcpy(stats, &audio_hal_power_stats, sizeof(audio_hal_power_stats_t));
+    if (audio_hal != NULL) {
+        stats->start_settle_msec = audio_hal->start_settle_msec;
+        stats->resume_settle_msec = audio_hal->resume_settle_msec;
+    }
+}
+
 esp_err_t audio_hal_config_iface(audio_hal_codec_mode_t mode, audio_hal_codec_i2s_iface_t *iface)
 {
     esp_err_t ret = 0;
@@ -156,6 +236,16 @@ esp_err_t audio_hal_set_volume(audio_hal_volume_item_t type, int volume)
     return ret;
 }
 
+esp_err_t audio_hal_set_adc_dsp(audio_hal_adc_dsp_t dsp)
+{
+    esp_err_t ret;
+    AUDIO_HAL_CHECK_NULL(audio_hal, "audio_hal handle is null", -1);
+    mutex_lock(audio_hal->audio_hal_lock);
+    ret = audio_hal->audio_codec_set_adc_dsp(dsp);
+    mutex_unlock(audio_hal->audio_hal_lock);
+    return ret;
+}
+
 esp_err_t audio_hal_get_volume(audio_hal_volume_item_t type, int *volume)
 {
     esp_err_t ret;
@@ -41,6 +41,11 @@ extern "C" {
 // Constants
 //
 
+// Longest expected time until the next use for which the codec is idled instead of stopped
+// (and how long it is left idle before being stopped).  Idle draws a little more current
+// but resuming avoids the start sequence, reference settling and output pops.
+#define AUDIO_HAL_IDLE_MAX_MSEC 30000
+
 // Board (codec) types (index for audio_hal_init and indexes audio_hal_codecs_default[])
 #define AUDIO_CODEC_ES8388  0
 
@@ -52,6 +57,7 @@ typedef struct audio_hal* audio_hal_handle_t;
         .adc_input  = AUDIO_HAL_ADC_INPUT_LINE1,        \
         .dac_output = AUDIO_HAL_DAC_OUTPUT_LINE1,       \
         .codec_mode = AUDIO_HAL_CODEC_MODE_BOTH,        \
+        .dac_mono = false,                              \
         .i2s_iface = {                                  \
             .mode = AUDIO_HAL_MODE_SLAVE,               \
             .fmt = AUDIO_HAL_I2S_NORMAL,                \
@@ -79,6 +85,7 @@ typedef enum {
     AUDIO_HAL_ADC_INPUT_LINE2,         /*!< mic input to adc channel 2 */
     AUDIO_HAL_ADC_INPUT_ALL,           /*!< mic input to both channels of adc */
     AUDIO_HAL_ADC_INPUT_DIFFERENCE,    /*!< mic input to adc difference channel */
+    AUDIO_HAL_ADC_INPUT_LINE1_REF2,    /*!< line input to right adc (RIN1), echo reference tap to left adc (LIN2) */
 } audio_hal_adc_input_t;
 
 /**
@@ -98,6 +105,38 @@ typedef enum {
     AUDIO_HAL_CTRL_START = 0x01,  /*!< set start mode */
 } audio_hal_ctrl_t;
 
+/**
+ * @brief Codec power states managed by audio_hal_set_power
+ */
+typedef enum {
+    AUDIO_HAL_POWER_OFF = 0,   /*!< stopped, references discharged (slow start) */
+    AUDIO_HAL_POWER_IDLE,      /*!< ADC/DAC powered down, references kept charged (fast resume) */
+    AUDIO_HAL_POWER_ON,        /*!< running */
+} audio_hal_power_t;
+
+/**
+ * @brief Codec power transition statistics
+ */
+typedef struct {
+    audio_hal_power_t state;        /*!< current power state */
+    uint32_t starts;                /*!< OFF -> ON transitions */
+    uint32_t resumes;               /*!< IDLE -> ON transitions */
+    uint32_t idles;                 /*!< ON -> IDLE transitions */
+    uint32_t stops;                 /*!< transitions to OFF */
+    uint32_t max_start_usec;        /*!< longest OFF -> ON register sequence */
+    uint32_t max_resume_usec;       /*!< longest IDLE -> ON register sequence */
+    int start_settle_msec;          /*!< analog settling after a start */
+    int resume_settle_msec;         /*!< analog settling after a resume */
+} audio_hal_power_stats_t;
+
+/**
+ * @brief Codec ADC signal processing profiles (on-chip blocks used in place of software stages)
+ */
+typedef enum {
+    AUDIO_HAL_ADC_DSP_HPF = 0,   /*!< ADC high-pass (DC) filter only, fixed PGA gain */
+    AUDIO_HAL_ADC_DSP_ALC,       /*!< ADC high-pass filter, ALC and noise gate */
+} audio_hal_adc_dsp_t;
+
 /**
  * @brief Select I2S interface operating mode i.e. master or slave for audio codec chip
  */
@@ -166,6 +205,7 @@ typedef struct {
     audio_hal_adc_input_t adc_input;    /*!< set adc channel */
     audio_hal_dac_output_t dac_output;  /*!< set dac channel */
     audio_hal_codec_mode_t codec_mode;  /*!< select codec mode: adc, dac or both */
+    bool dac_mono;                      /*!< mix both DAC channels to both outputs (mono I2S data) */
     audio_hal_codec_i2s_iface_t i2s_iface; /*!< set I2S interface configuration */
 } audio_hal_codec_config_t;
 
@@ -200,6 +240,42 @@ esp_err_t audio_hal_deinit(int index);
  */
 esp_err_t audio_hal_ctrl_codec(audio_hal_codec_mode_t mode, audio_hal_ctrl_t audio_hal_ctrl);
 
+/**
+ * @brief Move the codec (both ADC and DAC) to a power state, using the fast idle/resume
+ *        sequence between IDLE and ON
+ *
+ * @note Don't mix with audio_hal_ctrl_codec which doesn't track the power state.
+ *
+ * @param state new power state
+ *
+ * @return     int, 0--success, others--fail
+ */
+esp_err_t audio_hal_set_power(audio_hal_power_t state);
+
+/**
+ * @brief Get the current codec power state
+ *
+ * @return     current power state
+ */
+audio_hal_power_t audio_hal_get_power();
+
+/**
+ * @brief Select the power state for a codec that's expected to be needed again in
+ *        expected_msec mSec
+ *
+ * @param expected_msec expected time until the next use
+ *
+ * @return     AUDIO_HAL_POWER_IDLE or AUDIO_HAL_POWER_OFF
+ */
+audio_hal_power_t audio_hal_select_power(int expected_msec);
+
+/**
+ * @brief Get the power transition statistics
+ *
+ * @param stats filled in with the statistics
+ */
+void audio_hal_get_power_stats(audio_hal_power_stats_t* stats);
+
 /**
  * @brief Set codec I2S interface samples rate & bit width and format either I2S or PCM/DSP.
  *
@@ -223,6 +299,17 @@ esp_err_t audio_hal_codec_iface_config(audio_hal_codec_mode_t mode, audio_hal_co
  */
 esp_err_t audio_hal_set_volume(audio_hal_volume_item_t type, int volume);
 
+/**
+ * @brief Select the codec ADC signal processing profile
+ *
+ * @note Unchanged registers aren't rewritten so this is cheap to call at the start of each stream.
+ *
+ * @param dsp profile
+ *
+ * @return     int, 0--success, others--fail
+ */
+esp_err_t audio_hal_set_adc_dsp(audio_hal_adc_dsp_t dsp);
+
 /**
  * @brief get voice volume.
  *        @note if volume is 0, mute is enabled, range is 0-100.
@@ -33,6 +33,22 @@
 
 static const char *ES_TAG = "ES8388";
 
+// Shadow copy of the codec registers so reads come from RAM and unchanged writes are skipped
+#define ES_NUM_REGS   0x3A
+static uint8_t es_shadow[ES_NUM_REGS];
+static uint64_t es_shadow_valid = 0;   // Bit per register
+
+// Writes collected while batching and sent together as one I2C job
+#define ES_BATCH_MAX  48
+static bool es_batching = false;
+static int es_batch_depth = 0;         // Batches nest, the outermost one sends
+static int es_batch_len = 0;
+static uint8_t es_batch_buf[ES_BATCH_MAX][2];
+static i2c_xfer_t es_batch_xfer[ES_BATCH_MAX];
+
+// Set when the left ADC samples an echo reference tap instead of the line
+static bool es_adc_ref = false;
+
 
 
 //
@@ -41,6 +57,10 @@ static const char *ES_TAG = "ES8388";
 static int es8388_set_adc_dac_volume(int mode, int volume, int dot);
 static int es_write_reg(uint8_t slave_add, uint8_t reg_add, uint8_t data);
 static int es_read_reg(uint8_t slave_add, uint8_t reg_add, uint8_t *pData);
+static int es_read_reg_direct(uint8_t slave_add, uint8_t reg_add, uint8_t *pData);
+static void es_batch_begin();
+static int es_batch_end();
+static int es_batch_flush();
 
 
 
@@ -51,7 +71,7 @@ void es8388_read_all()
 {
     for (int i = 0; i < 50; i++) {
         uint8_t reg = 0;
-        es_read_reg(ES8388_ADDR, i, &reg);
+        es_read_reg_direct(ES8388_ADDR, i, &reg);
         ets_printf("%x: %x\n", i, reg);
     }
 }
@@ -75,6 +95,8 @@ int es8388_start(es_module_t mode)
 {
     int res = 0;
     
+    es_batch_begin();
+    
     if (mode == ES_MODULE_LINE) {
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL16, 0x09); // 0x00 audio on LIN1&RIN1,  0x09 LIN2&RIN2 by pass enable
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL17, 0x50); // left DAC to left mixer enable  and  LIN signal to left mixer enable 0db  : bypass enable
@@ -97,6 +119,8 @@ int es8388_start(es_module_t mode)
         res |= es8388_set_voice_mute(false);
     }
     
+    res |= es_batch_end();
+    
     ESP_LOGD(ES_TAG, "es8388_start default is mode:%d", mode);
 
     return res;
@@ -115,11 +139,15 @@ int es8388_start(es_module_t mode)
 int es8388_stop(es_module_t mode)
 {
     int res = 0;
+    
+    es_batch_begin();
+    
     if (mode == ES_MODULE_LINE) {
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL16, 0x00); // 0x00 audio on LIN1&RIN1,  0x09 LIN2&RIN2
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL17, 0x90); // only left DAC to left mixer enable 0db
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL20, 0x90); // only right DAC to right mixer enable 0db
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL21, 0x80); // enable dac, use DAC LRCK
+        res |= es_batch_end();
         return res;
     }
     if (mode == ES_MODULE_DAC || mode == ES_MODULE_ADC_DAC) {
@@ -135,7 +163,88 @@ int es8388_stop(es_module_t mode)
         res |= es_write_reg(ES8388_ADDR, ES8388_CONTROL2, 0x58);
         res |= es_write_reg(ES8388_ADDR, ES8388_CHIPPOWER, 0xF3);  //stop state machine
     }
+    
+    res |= es_batch_end();
+
+    return res;
+}
+
+/**
+ * @brief Fast power down/up between uses
+ *
+ * Idle mutes the DAC and powers down the ADC, DAC and their analog paths but leaves the
+ * state machine running and the references charged so resuming is a few register writes
+ * without the reference settling (and pops) of es8388_start.
+ *
+ * @param idle:   true to enter idle, false to resume
+ *
+ * @return
+ *     - (-1)  Error
+ *     - (0)   Success
+ */
+int es8388_idle(bool idle)
+{
+    int res = 0;
+    
+    es_batch_begin();
+    
+    if (idle) {
+        res |= es8388_set_voice_mute(true);
+        res |= es_write_reg(ES8388_ADDR, ES8388_DACPOWER, 0xC0);   // power down dac, line out disabled
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCPOWER, 0xFF);   // power down adc and line in
+    } else {
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCPOWER, 0x00);   // power up adc and line in
+        res |= es_write_reg(ES8388_ADDR, ES8388_DACPOWER, 0x3c);   // power up dac and line out
+        res |= es8388_set_voice_mute(false);
+    }
+    
+    res |= es_batch_end();
+    
+    return res;
+}
+
 
+/**
+ * @brief Configure the ADC signal processing blocks
+ *
+ * The high-pass (DC) filter is always on.  The ALC holds the PGA between 0 and +17.5 dB
+ * (around the fixed +9 dB) for a -12 dBFS peak level with a fast attack and slow decay and
+ * the noise gate mutes the ADC below -63 dBFS.  Both only work while the ALC is on.  The ALC
+ * is kept off an echo reference channel so its level tracks the DAC output.
+ *
+ * @param dsp:  profile
+ *
+ * @return
+ *     - (-1)  Error
+ *     - (0)   Success
+ */
+int es8388_set_adc_dsp(audio_hal_adc_dsp_t dsp)
+{
+    int res = 0;
+    
+    es_batch_begin();
+    
+    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL6, 0x30);      // default (left and right HPF on)
+    if (dsp == AUDIO_HAL_ADC_DSP_ALC) {
+        if (es_adc_ref) {
+            res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL10, 0x62); // ALC right only, max PGA +17.5 dB, min 0 dB
+        } else {
+            res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL10, 0xE2); // ALC stereo, max PGA +17.5 dB, min 0 dB
+        }
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL11, 0x36); // Target -12 dBFS, hold 85 mSec
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL12, 0x62); // Decay 26 mSec, attack 416 uSec per step
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL13, 0x46); // ALC (not limiter) mode, zero cross, default window
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL14, 0x4B); // Noise gate mute ADC < -63 dB
+    } else {
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL10, 0x38); // default (ALC off)
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL11, 0xB0); // default (ALC off)
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL12, 0x32); // default (ALC off)
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL13, 0x06); // default (ALC off)
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL14, 0xDB); // Noise gate mute ADC < -36 dB (inactive)
+    }
+    
+    res |= es_batch_end();
+    
     return res;
 }
 
@@ -153,9 +262,11 @@ int es8388_stop(es_module_t mode)
 int es8388_i2s_config_clock(es_i2s_clock_t cfg)
 {
     int res = 0;
+    es_batch_begin();
     res |= es_write_reg(ES8388_ADDR, ES8388_MASTERMODE, cfg.sclk_div);
     res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL5, cfg.lclk_div);  //ADCFsMode,singel SPEED,RATIO=256
     res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL2, cfg.lclk_div);  //ADCFsMode,singel SPEED,RATIO=256
+    res |= es_batch_end();
     return res;
 }
 
@@ -178,6 +289,10 @@ esp_err_t es8388_init(audio_hal_codec_config_t *cfg)
     if (!(res = i2c_master_init()) == ESP_OK) {
     	return res;
     }
+    
+    // Nothing is known about the register contents until they're written
+    es_shadow_valid = 0;
+    es_batch_begin();
 
     /* Chip Control and Power Management */
     res |= es_write_reg(ES8388_ADDR, ES8388_CONTROL1, 0x12);    //Enref=0,Play&Record Mode,(0x17-both of mic&paly)
@@ -205,7 +320,11 @@ esp_err_t es8388_init(audio_hal_codec_config_t *cfg)
     res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL2, 0x02);  //DACFsMode,SINGLE SPEED; DACFsRatio,256
     res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL3, 0x64);  // mute analog outputs, enable volume ramp 0.5dB/32 LRCK
     res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL6, 0x08);  // default
-    res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL7, 0x00);  // default (Vpp set at 3.5V)
+    if (cfg->dac_mono) {
+        res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL7, 0x20);  // Mono: (L+R)/2 to both DACs (Vpp set at 3.5V)
+    } else {
+        res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL7, 0x00);  // default (Vpp set at 3.5V)
+    }
     res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL16, 0x00); // 0x00 audio on LIN1&RIN1,  0x09 LIN2&RIN2
     res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL17, 0x90); // only left DAC to left mixer enable 0db
     res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL20, 0x90); // only right DAC to right mixer enable 0db
@@ -228,12 +347,19 @@ esp_err_t es8388_init(audio_hal_codec_config_t *cfg)
     
     /* adc */
     res |= es_write_reg(ES8388_ADDR, ES8388_ADCPOWER, 0xFF);    // power down
-    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL1, 0x33); // MIC Left and Right channel PGA gain +9 dB
+    es_adc_ref = (AUDIO_HAL_ADC_INPUT_LINE1_REF2 == cfg->adc_input);
+    if (es_adc_ref) {
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL1, 0x03); // Reference (left) PGA gain 0 dB, line (right) +9 dB
+    } else {
+        res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL1, 0x33); // MIC Left and Right channel PGA gain +9 dB
+    }
     tmp = 0;
     if (AUDIO_HAL_ADC_INPUT_LINE1 == cfg->adc_input) {
         tmp = ADC_INPUT_LINPUT1_RINPUT1;
     } else if (AUDIO_HAL_ADC_INPUT_LINE2 == cfg->adc_input) {
         tmp = ADC_INPUT_LINPUT2_RINPUT2;
+    } else if (AUDIO_HAL_ADC_INPUT_LINE1_REF2 == cfg->adc_input) {
+        tmp = ADC_INPUT_LINPUT2_RINPUT1;
     } else {
         tmp = ADC_INPUT_DIFFERENCE;
     }
@@ -241,17 +367,13 @@ esp_err_t es8388_init(audio_hal_codec_config_t *cfg)
     res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL3, 0x02);
     res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL4, 0x0c);  // 16 Bits length and I2S serial audio data format
     res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL5, 0x02);  //ADCFsMode=single, SPEED,RATIO=256
-    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL6, 0x30);  // default
     res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL7, 0x60);  // ADCRampRate = 0.5dB/8 clk, enable soft ramp
-    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL10, 0x38); // default (ALC off)
-    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL11, 0xB0); // default (ALC off)
-    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL12, 0x32); // default (ALC off)
-    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL13, 0x06); // default (ALC off)
-    res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL14, 0xDB); // Noise gate mute ADC < -36 dB
+    res |= es8388_set_adc_dsp(AUDIO_HAL_ADC_DSP_HPF);
     
     // ALC for Microphone
     res |= es8388_set_adc_dac_volume(ES_MODULE_ADC, 0, 0);      // 0db
     res |= es_write_reg(ES8388_ADDR, ES8388_ADCPOWER, 0x09); //Power up ADC, Enable LIN&RIN, Power down MICBIAS, set int1lp to low power mode
+    res |= es_batch_end();
 
 	if (res == ESP_OK) {
     	ESP_LOGI(ES_TAG, "initialized: out:%02x, in:%02x", cfg->dac_output, cfg->adc_input);
@@ -558,6 +680,7 @@ static int es8388_set_adc_dac_volume(int mode, int volume, int dot)
     }
     dot = (dot >= 5 ? 1 : 0);
     volume = (-volume << 1) + dot;
+    es_batch_begin();
     if (mode == ES_MODULE_ADC || mode == ES_MODULE_ADC_DAC) {
         res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL8, volume);
         res |= es_write_reg(ES8388_ADDR, ES8388_ADCCONTROL9, volume);  //ADC Right Volume=0db
@@ -566,32 +689,79 @@ static int es8388_set_adc_dac_volume(int mode, int volume, int dot)
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL5, volume);
         res |= es_write_reg(ES8388_ADDR, ES8388_DACCONTROL4, volume);
     }
+    res |= es_batch_end();
     return res;
 }
 
 
+// Skipped if the register already holds data, queued while batching
 static int es_write_reg(uint8_t slave_add, uint8_t reg_add, uint8_t data)
 {
 	esp_err_t ret;
     uint8_t write_data[2];
+    
+    if (reg_add < ES_NUM_REGS) {
+    	if ((es_shadow_valid & (1ULL << reg_add)) && (es_shadow[reg_add] == data)) {
+    		return 0;
+    	}
+    	
+    	if (es_batching && (slave_add == ES8388_ADDR)) {
+    		if (es_batch_len == ES_BATCH_MAX) {
+    			// Send what we have and carry on collecting
+    			if (es_batch_flush() != 0) {
+    				return -1;
+    			}
+    		}
+    		es_batch_buf[es_batch_len][0] = reg_add;
+    		es_batch_buf[es_batch_len][1] = data;
+    		es_batch_len++;
+    		es_shadow[reg_add] = data;
+    		es_shadow_valid |= 1ULL << reg_add;
+    		return 0;
+    	}
+    }
 
     write_data[0] = reg_add;
     write_data[1] = data;
     
-    i2c_lock();
-    ret = i2c_master_write_slave(slave_add >> 1, write_data, 2);
-    i2c_unlock();
+    ret = i2c_write_read(I2C_CLIENT_CODEC, slave_add >> 1, write_data, 2, NULL, 0);
     
     if (ret != ESP_OK) {
+    	if (reg_add < ES_NUM_REGS) es_shadow_valid &= ~(1ULL << reg_add);
     	ESP_LOGE(ES_TAG, "es_write_reg 0x%x error - %s", reg_add, esp_err_to_name(ret));
     	return -1;
     }
     
+    if (reg_add < ES_NUM_REGS) {
+    	es_shadow[reg_add] = data;
+    	es_shadow_valid |= 1ULL << reg_add;
+    }
+    
     return 0;
 }
 
 
+// Served from the shadow copy when it holds the register
 static int es_read_reg(uint8_t slave_add, uint8_t reg_add, uint8_t *pData)
+{
+	int ret;
+	
+	if ((reg_add < ES_NUM_REGS) && (es_shadow_valid & (1ULL << reg_add))) {
+		*pData = es_shadow[reg_add];
+		return 0;
+	}
+	
+	ret = es_read_reg_direct(slave_add, reg_add, pData);
+	if ((ret == 0) && (reg_add < ES_NUM_REGS)) {
+		es_shadow[reg_add] = *pData;
+		es_shadow_valid |= 1ULL << reg_add;
+	}
+	
+	return ret;
+}
+
+
+static int es_read_reg_direct(uint8_t slave_add, uint8_t reg_add, uint8_t *pData)
 {
 	esp_err_t ret;
     uint8_t reg_addr;
@@ -599,14 +769,7 @@ static int es_read_reg(uint8_t slave_add, uint8_t reg_add, uint8_t *pData)
 
     reg_addr = reg_add;
     
-    i2c_lock();
-    
-    ret = i2c_master_write_slave(slave_add >> 1, &reg_addr, 1);
-    if (ret == ESP_OK) {
-    	ret = i2c_master_read_slave(slave_add >> 1, &read_data, 1);
-    }
-    
-    i2c_unlock();
+    ret = i2c_write_read(I2C_CLIENT_CODEC, slave_add >> 1, &reg_addr, 1, &read_data, 1);
     
     if (ret == ESP_OK) {
     	*pData = read_data;
@@ -617,3 +780,52 @@ static int es_read_reg(uint8_t slave_add, uint8_t reg_add, uint8_t *pData)
     
     return 0;
 }
+
+
+// Collect register writes until the matching es_batch_end
+static void es_batch_begin()
+{
+	if (es_batch_depth++ == 0) {
+		es_batching = true;
+		es_batch_len = 0;
+	}
+}
+
+
+static int es_batch_end()
+{
+	if (es_batch_depth == 0) return 0;
+	if (--es_batch_depth != 0) return 0;
+	
+	es_batching = false;
+	return es_batch_flush();
+}
+
+
+// Send the collected writes as one I2C job
+static int es_batch_flush()
+{
+	int i;
+	esp_err_t ret;
+	
+	if (es_batch_len == 0) return 0;
+	
+	for (i=0; i<es_batch_len; i++) {
+		es_batch_xfer[i].wr = es_batch_buf[i];
+		es_batch_xfer[i].wr_len = 2;
+		es_batch_xfer[i].rd = NULL;
+		es_batch_xfer[i].rd_len = 0;
+	}
+	
+	ret = i2c_transfer(I2C_CLIENT_CODEC, ES8388_ADDR >> 1, es_batch_xfer, es_batch_len);
+	es_batch_len = 0;
+	
+	if (ret != ESP_OK) {
+		// Unknown how far the batch got
+		es_shadow_valid = 0;
+		ESP_LOGE(ES_TAG, "register batch error - %s", esp_err_to_name(ret));
+		return -1;
+	}
+	
+	return 0;
+}
@@ -37,6 +37,12 @@
 /* ES8388 address */
 #define ES8388_ADDR 0x20  /*!< 0x22:CE=1;0x20:CE=0*/
 
+/* Analog settling after power transitions (mSec).  A start from stop has to charge the
+   references through the 500k divider set by es8388_start while a resume from idle only
+   waits for the ADC/DAC filters and output ramps. */
+#define ES8388_START_SETTLE_MSEC   250
+#define ES8388_RESUME_SETTLE_MSEC  10
+
 
 /* ES8388 register */
 #define ES8388_CONTROL1         0x00
@@ -189,6 +195,7 @@ typedef enum {
 typedef enum {
     ADC_INPUT_MIN = -1,
     ADC_INPUT_LINPUT1_RINPUT1 = 0x00,
+    ADC_INPUT_LINPUT2_RINPUT1 = 0x40,
     ADC_INPUT_MIC1  = 0x05,
     ADC_INPUT_MIC2  = 0x06,
     ADC_INPUT_LINPUT2_RINPUT2 = 0x50,
@@ -331,6 +338,28 @@ esp_err_t es8388_start(es_module_t mode);
  */
 esp_err_t es8388_stop(es_module_t mode);
 
+/**
+ * @brief  Idle (fast power down) or resume a started ES8388 codec chip
+ *
+ * @param idle:  true to idle, false to resume
+ *
+ * @return
+ *     - ESP_OK
+ *     - ESP_FAIL
+ */
+esp_err_t es8388_idle(bool idle);
+
+/**
+ * @brief  Configure the ADC high-pass filter, ALC and noise gate
+ *
+ * @param dsp:  profile
+ *
+ * @return
+ *     - ESP_OK
+ *     - ESP_FAIL
+ */
+esp_err_t es8388_set_adc_dsp(audio_hal_adc_dsp_t dsp);
+
 /**
  * @brief  Set voice volume
  *
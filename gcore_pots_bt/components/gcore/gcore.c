@@ -37,6 +37,37 @@ static const char* TAG = "gCore";
 //
 // gCore API
 //
+
+// Reads the status, power and control registers in one transaction
+bool gcore_get_snapshot(gcore_snapshot_t* s)
+{
+	esp_err_t ret;
+	uint8_t buf[GCORE_SNAP_LEN];
+	uint16_t reg_addr;
+	
+	reg_addr = GCORE_REG_BASE + GCORE_SNAP_FIRST;
+	buf[0] = reg_addr >> 8;
+	buf[1] = reg_addr & 0xFF;
+	
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, buf, GCORE_SNAP_LEN)) != ESP_OK) {
+		ESP_LOGE(TAG, "failed to read register snapshot (%d)", ret);
+		return false;
+	}
+	
+	s->status = buf[GCORE_REG_STATUS - GCORE_SNAP_FIRST];
+	s->gpio = buf[GCORE_REG_GPIO - GCORE_SNAP_FIRST];
+	s->vu = (buf[GCORE_REG_VU - GCORE_SNAP_FIRST] << 8) | buf[GCORE_REG_VU - GCORE_SNAP_FIRST + 1];
+	s->iu = (buf[GCORE_REG_IU - GCORE_SNAP_FIRST] << 8) | buf[GCORE_REG_IU - GCORE_SNAP_FIRST + 1];
+	s->vb = (buf[GCORE_REG_VB - GCORE_SNAP_FIRST] << 8) | buf[GCORE_REG_VB - GCORE_SNAP_FIRST + 1];
+	s->il = (buf[GCORE_REG_IL - GCORE_SNAP_FIRST] << 8) | buf[GCORE_REG_IL - GCORE_SNAP_FIRST + 1];
+	s->temp = (buf[GCORE_REG_TEMP - GCORE_SNAP_FIRST] << 8) | buf[GCORE_REG_TEMP - GCORE_SNAP_FIRST + 1];
+	s->bl = buf[GCORE_REG_BL - GCORE_SNAP_FIRST];
+	s->wk_ctrl = buf[GCORE_REG_WK_CTRL - GCORE_SNAP_FIRST];
+	
+	return true;
+}
+
+
 bool gcore_get_reg8(uint8_t offset, uint8_t* dat)
 {
 	esp_err_t ret;
@@ -52,23 +83,11 @@ bool gcore_get_reg8(uint8_t offset, uint8_t* dat)
 	buf[0] = reg_addr >> 8;
 	buf[1] = reg_addr & 0xFF;
 	
-	i2c_lock();
-	
-	// Write the register address
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
-		ESP_LOGE(TAG, "failed to write byte register address %02x (%d)", offset, ret);
-		return false;
-	}
-
-	// Read the register
-	if ((ret = i2c_master_read_slave(GCORE_I2C_ADDR, buf, 1)) != ESP_OK) {
-		i2c_unlock();
+	// Write the register address and read the register
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, buf, 1)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to read from byte register %02x (%d)", offset, ret);
 		return false;
 	}
-	
-	i2c_unlock();
 
 	*dat = buf[0];
 	return true;
@@ -91,17 +110,12 @@ bool gcore_set_reg8(uint8_t offset, uint8_t dat)
 	buf[1] = reg_addr & 0xFF;
 	buf[2] = dat;
 	
-	i2c_lock();
-	
 	// Write the address + data
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 3)) != ESP_OK) {
-		i2c_unlock();
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 3, NULL, 0)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to write byte register %02x = %2x (%d)", offset, dat, ret);
 		return false;
 	}
 
-	i2c_unlock();
-
 	return true;
 }
 
@@ -121,23 +135,11 @@ bool gcore_get_reg16(uint8_t offset, uint16_t* dat)
 	buf[0] = reg_addr >> 8;
 	buf[1] = reg_addr & 0xFF;
 	
-	i2c_lock();
-	
-	// Write the register address
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
-		ESP_LOGE(TAG, "failed to write word register address %02x (%d)", offset, ret);
-		return false;
-	}
-
-	// Read the register
-	if ((ret = i2c_master_read_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
+	// Write the register address and read the register
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, buf, 2)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to read from word register %02x (%d)", offset, ret);
 		return false;
 	}
-	
-	i2c_unlock();
 
 	*dat = (buf[0] << 8) | buf[1];
 	return true;
@@ -161,17 +163,12 @@ bool gcore_set_reg16(uint8_t offset, uint16_t dat)
 	buf[2] = dat >> 8;
 	buf[3] = dat & 0xFF;
 	
-	i2c_lock();
-	
 	// Write the address + data
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 4)) != ESP_OK) {
-		i2c_unlock();
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 4, NULL, 0)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to write word register %02x = %04x (%d)", offset, dat, ret);
 		return false;
 	}
 
-	i2c_unlock();
-
 	return true;
 }
 
@@ -187,7 +184,8 @@ bool gcore_set_wakeup_bit(uint8_t mask, bool en)
 	buf[1] = reg_addr & 0xFF;
 	buf[2] = 0;
 	
-	// Perform a read-modify-write
+	// Perform a read-modify-write (holding the bus lock keeps the I2C service task from
+	// running another job between the read and the write)
 	i2c_lock();
 	
 	// Write the register address
@@ -239,23 +237,11 @@ bool gcore_get_nvram_byte(uint16_t offset, uint8_t* dat)
 	buf[0] = reg_addr >> 8;
 	buf[1] = reg_addr & 0xFF;
 	
-	i2c_lock();
-	
-	// Write the register address
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
-		ESP_LOGE(TAG, "failed to write byte register address %02x (%d)", offset, ret);
-		return false;
-	}
-
-	// Read the register
-	if ((ret = i2c_master_read_slave(GCORE_I2C_ADDR, buf, 1)) != ESP_OK) {
-		i2c_unlock();
+	// Write the register address and read the register
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, buf, 1)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to read from byte register %02x (%d)", offset, ret);
 		return false;
 	}
-	
-	i2c_unlock();
 
 	*dat = buf[0];
 	return true;
@@ -278,17 +264,12 @@ bool gcore_set_nvram_byte(uint16_t offset, uint8_t dat)
 	buf[1] = reg_addr & 0xFF;
 	buf[2] = dat;
 	
-	i2c_lock();
-	
 	// Write the address + data
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 3)) != ESP_OK) {
-		i2c_unlock();
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 3, NULL, 0)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to write NVRAM %02x = %2x (%d)", offset, dat, ret);
 		return false;
 	}
 
-	i2c_unlock();
-
 	return true;
 }
 
@@ -308,23 +289,11 @@ bool gcore_get_nvram_bytes(uint16_t offset, uint8_t* dat, uint16_t len)
 	buf[0] = reg_addr >> 8;
 	buf[1] = reg_addr & 0xFF;
 	
-	i2c_lock();
-	
-	// Write the register address
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
-		ESP_LOGE(TAG, "failed to write NVRAM register address %04x (%d)", offset, ret);
-		return false;
-	}
-
-	// Read the bytes
-	if ((ret = i2c_master_read_slave(GCORE_I2C_ADDR, dat, len)) != ESP_OK) {
-		i2c_unlock();
+	// Write the register address and read the bytes
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, dat, len)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to read %d bytes from NVRAM %04x (%d)", len, offset, ret);
 		return false;
 	}
-	
-	i2c_unlock();
 
 	return true;
 }
@@ -355,17 +324,12 @@ bool gcore_set_nvram_bytes(uint16_t offset, uint8_t* dat, uint16_t len)
 		buf[i+2] = dat[i];
 	}
 	
-	i2c_lock();
-	
 	// Write the address + data
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, len+2)) != ESP_OK) {
-		i2c_unlock();
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, len+2, NULL, 0)) != ESP_OK) {
 		free(buf);
 		ESP_LOGE(TAG, "failed to write %d bytes to NVRAM %04x (%d)", len, offset, ret);
 		return false;
 	}
-
-	i2c_unlock();
 	
 	free(buf);
 
@@ -383,23 +347,11 @@ bool gcore_get_time_secs(uint32_t* s)
 	buf[0] = reg_addr >> 8;
 	buf[1] = reg_addr & 0xFF;
 	
-	i2c_lock();
-	
-	// Write the register address
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
-		ESP_LOGE(TAG, "failed to write TIME address (%d)", ret);
-		return false;
-	}
-
-	// Read the register
-	if ((ret = i2c_master_read_slave(GCORE_I2C_ADDR, buf, 4)) != ESP_OK) {
-		i2c_unlock();
+	// Write the register address and read the register
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, buf, 4)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to read TIME register (%d)", ret);
 		return false;
 	}
-	
-	i2c_unlock();
 
 	*s = (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
 	
@@ -421,16 +373,11 @@ bool gcore_set_time_secs(uint32_t s)
 	buf[4] = (s >> 8) & 0xFF;
 	buf[5] = s & 0xFF;
 		
-	i2c_lock();
-	
 	// Write the address + data
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 6)) != ESP_OK) {
-		i2c_unlock();
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 6, NULL, 0)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to write TIME register (%d)", ret);
 		return false;
 	}
-
-	i2c_unlock();
 	
 	return true;
 }
@@ -446,23 +393,11 @@ bool gcore_get_alarm_secs(uint32_t* s)
 	buf[0] = reg_addr >> 8;
 	buf[1] = reg_addr & 0xFF;
 	
-	i2c_lock();
-	
-	// Write the register address
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
-		ESP_LOGE(TAG, "failed to write ALARM address (%d)", ret);
-		return false;
-	}
-
-	// Read the register
-	if ((ret = i2c_master_read_slave(GCORE_I2C_ADDR, buf, 4)) != ESP_OK) {
-		i2c_unlock();
+	// Write the register address and read the register
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, buf, 4)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to read ALARM register (%d)", ret);
 		return false;
 	}
-	
-	i2c_unlock();
 
 	*s = (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
 	return true;
@@ -483,17 +418,12 @@ bool gcore_set_alarm_secs(uint32_t s)
 	buf[4] = (s >> 8) & 0xFF;
 	buf[5] = s & 0xFF;
 	
-	i2c_lock();
-	
 	// Write the address + data
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 6)) != ESP_OK) {
-		i2c_unlock();
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 6, NULL, 0)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to write ALARM register (%d)", ret);
 		return false;
 	}
 
-	i2c_unlock();
-
 	return true;
 }
 
@@ -507,23 +437,11 @@ bool gcore_get_corr_secs(uint32_t* s)
 	buf[0] = reg_addr >> 8;
 	buf[1] = reg_addr & 0xFF;
 	
-	i2c_lock();
-	
-	// Write the register address
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 2)) != ESP_OK) {
-		i2c_unlock();
-		ESP_LOGE(TAG, "failed to write TIME_CORRECT address (%d)", ret);
-		return false;
-	}
-
-	// Read the register
-	if ((ret = i2c_master_read_slave(GCORE_I2C_ADDR, buf, 4)) != ESP_OK) {
-		i2c_unlock();
+	// Write the register address and read the register
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 2, buf, 4)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to read TIME_CORRECT register (%d)", ret);
 		return false;
 	}
-	
-	i2c_unlock();
 
 	*s = (buf[0] << 24) | (buf[1] << 16) | (buf[2] << 8) | buf[3];
 	return true;
@@ -544,16 +462,11 @@ bool gcore_set_corr_secs(uint32_t s)
 	buf[4] = (s >> 8) & 0xFF;
 	buf[5] = s & 0xFF;
 	
-	i2c_lock();
-	
 	// Write the address + data
-	if ((ret = i2c_master_write_slave(GCORE_I2C_ADDR, buf, 6)) != ESP_OK) {
-		i2c_unlock();
+	if ((ret = i2c_write_read(I2C_CLIENT_GCORE, GCORE_I2C_ADDR, buf, 6, NULL, 0)) != ESP_OK) {
 		ESP_LOGE(TAG, "failed to write TIME_CORRECT register (%d)", ret);
 		return false;
 	}
 
-	i2c_unlock();
-
 	return true;
 }
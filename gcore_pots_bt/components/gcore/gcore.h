@@ -61,6 +61,10 @@
 #define GCORE_REG_ALARM   0x17
 #define GCORE_REG_CORR    0x1B
 
+// Contiguous register block read by gcore_get_snapshot (STATUS through WK_CTRL)
+#define GCORE_SNAP_FIRST  GCORE_REG_STATUS
+#define GCORE_SNAP_LEN    (GCORE_REG_WK_CTRL - GCORE_REG_STATUS + 1)
+
 
 //
 // gCore FW ID
@@ -120,9 +124,28 @@
 #define GCORE_CHG_FAULT           3
 
 
+//
+// gCore typedefs
+//
+typedef struct {
+	uint8_t status;                       // Reading STATUS clears the button press bit
+	uint8_t gpio;
+	uint16_t vu;                          // mV
+	uint16_t iu;                          // mA
+	uint16_t vb;                          // mV
+	uint16_t il;                          // mA
+	uint16_t temp;
+	uint8_t bl;
+	uint8_t wk_ctrl;
+} gcore_snapshot_t;
+
+
+
 //
 // gCore API
 //
+bool gcore_get_snapshot(gcore_snapshot_t* s);
+
 bool gcore_get_reg8(uint8_t offset, uint8_t* dat);
 bool gcore_set_reg8(uint8_t offset, uint8_t dat);
 bool gcore_get_reg16(uint8_t offset, uint16_t* dat);
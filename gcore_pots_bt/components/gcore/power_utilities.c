@@ -28,6 +28,7 @@
 #include "rom/ets_sys.h"   // DEBUG I2C
 #include "gcore.h"
 #include "power_utilities.h"
+#include "ps.h"
 
 
 // DEBUG I2C
@@ -50,15 +51,24 @@ static batt_status_t batt_status;
 static bool power_btn_pressed;
 static bool sdcard_present;
 static SemaphoreHandle_t status_mutex;
+static StaticSemaphore_t status_mutex_buf;
 
-// Averaging arrays
+// Averaging arrays and their running sums (updated incrementally as each sample replaces
+// the oldest)
 static uint16_t batt_average_array[BATT_NUM_AVG_SAMPLES];
 static uint16_t load_average_array[POWER_AUX_AVG_SAMPLES];
 static uint16_t vusb_average_array[POWER_AUX_AVG_SAMPLES];
 static uint16_t lusb_average_array[POWER_AUX_AVG_SAMPLES];
+static uint32_t batt_average_sum;
+static uint32_t load_average_sum;
+static uint32_t vusb_average_sum;
+static uint32_t lusb_average_sum;
 static int batt_average_index;
 static int aux_average_index;
 
+// Backlight register value from the last snapshot or write (-1 if unknown)
+static int bl_reg_val = -1;
+
 
 
 //
@@ -66,6 +76,8 @@ static int aux_average_index;
 //
 static enum CHARGE_STATE_t gpio_to_charge_state(uint8_t reg);
 static enum BATT_STATE_t batt_mv_to_level(uint16_t mv);
+static enum BATT_STATE_t batt_mv_to_level_hyst(uint16_t mv, enum BATT_STATE_t prev);
+static uint16_t average_push(uint16_t* array, uint32_t* sum, int index, int len, uint16_t val);
 static bool validate_status(uint8_t s);
 
 
@@ -77,9 +89,10 @@ bool power_init()
 {
 	uint8_t t8;
 	uint16_t t16;
+	gcore_snapshot_t snap;
 	
 	// Create our mutex
-	status_mutex = xSemaphoreCreateMutex();
+	status_mutex = xSemaphoreCreateMutexStatic(&status_mutex_buf);
 	
 	// Verify communications with the gCore EFM8
 	if (!gcore_get_reg8(GCORE_REG_ID, &t8)) {
@@ -97,56 +110,48 @@ bool power_init()
 		return false;
 	}
 	
-	// Get initial charge and battery voltage
-	if (!gcore_get_reg8(GCORE_REG_GPIO, &t8)) {
-		ESP_LOGE(TAG, "Could not read GPIO register");
+	// Get initial charge, power and control state (reading STATUS also clears the power-on
+	// button press)
+	if (!gcore_get_snapshot(&snap)) {
+		ESP_LOGE(TAG, "Could not read power registers");
 		return false;
 	}
-	batt_status.charge_state = gpio_to_charge_state(t8);
-	sdcard_present = (t8 & GCORE_GPIO_SD_CARD_MASK) == GCORE_GPIO_SD_CARD_MASK;
+	batt_status.charge_state = gpio_to_charge_state(snap.gpio);
+	sdcard_present = (snap.gpio & GCORE_GPIO_SD_CARD_MASK) == GCORE_GPIO_SD_CARD_MASK;
+	bl_reg_val = snap.bl;
 	
-	if (!gcore_get_reg16(GCORE_REG_VB, &t16)) {
-		ESP_LOGE(TAG, "Could not read battery voltage");
-		return false;
-	}
+	t16 = snap.vb;
 	for (t8=0; t8<BATT_NUM_AVG_SAMPLES; t8++) {
 		batt_average_array[t8] = t16;
 	}
+	batt_average_sum = (uint32_t) t16 * BATT_NUM_AVG_SAMPLES;
 	batt_average_index = 0;
 	batt_status.batt_voltage = (float) t16 / 1000.0;
 	batt_status.batt_state = batt_mv_to_level(t16);
 	
 	// Get auxiliary power information
-	if (!gcore_get_reg16(GCORE_REG_IL, &t16)) {
-		ESP_LOGE(TAG, "Could not read system load");
-		return false;
-	}
+	t16 = snap.il;
 	for (t8=0; t8<POWER_AUX_AVG_SAMPLES; t8++) {
 		load_average_array[t8] = t16;
 	}
+	load_average_sum = (uint32_t) t16 * POWER_AUX_AVG_SAMPLES;
 	batt_status.load_ma = t16;
 	
-	if (!gcore_get_reg16(GCORE_REG_VU, &t16)) {
-		ESP_LOGE(TAG, "Could not read VUSB");
-		return false;
-	}
+	t16 = snap.vu;
 	for (t8=0; t8<POWER_AUX_AVG_SAMPLES; t8++) {
 		vusb_average_array[t8] = t16;
 	}
+	vusb_average_sum = (uint32_t) t16 * POWER_AUX_AVG_SAMPLES;
 	batt_status.usb_voltage = (float) t16 / 1000.0;
 	
-	if (!gcore_get_reg16(GCORE_REG_IU, &t16)) {
-		ESP_LOGE(TAG, "Could not read IUSB");
-		return false;
-	}
+	t16 = snap.iu;
 	for (t8=0; t8<POWER_AUX_AVG_SAMPLES; t8++) {
 		lusb_average_array[t8] = t16;
 	}
+	lusb_average_sum = (uint32_t) t16 * POWER_AUX_AVG_SAMPLES;
 	batt_status.usb_ma = t16;
 	aux_average_index = 0;
 	
-	// Read STATUS register to clear power-on button press
-	(void) gcore_get_reg8(GCORE_REG_STATUS, &t8);
 	power_btn_pressed = false;
 	
 #ifdef DEBUG_I2C
@@ -168,88 +173,103 @@ void power_set_brightness(int percent)
 	
 	pwm_val = percent * 255 / 255;
 	
-	(void) gcore_set_reg8(GCORE_REG_BL, pwm_val);
+	if (pwm_val != bl_reg_val) {
+		bl_reg_val = gcore_set_reg8(GCORE_REG_BL, pwm_val) ? pwm_val : -1;
+	}
 }
 
 
-void power_batt_update()
+bool power_batt_update()
 {
 	bool btn = false;
+	bool changed;
 	bool sdcard = false;
+	enum BATT_STATE_t bs;
 	enum CHARGE_STATE_t cs = CHARGE_OFF;
-	int i;
-	uint8_t t8;
 	uint16_t mv[2] = {0, 0};
 	uint16_t ma[2] = {0, 0};
-	uint32_t sum = 0;
+	gcore_snapshot_t snap;
 	
-	// Update charge state and sd card present - assume, at this point, gCore accesses are working
-	if (gcore_get_reg8(GCORE_REG_GPIO, &t8)) {
-		cs = gpio_to_charge_state(t8);
-		sdcard = (t8 & GCORE_GPIO_SD_CARD_MASK) == GCORE_GPIO_SD_CARD_MASK;
-	}
-	
-	// Update voltages and currents
-	if (gcore_get_reg16(GCORE_REG_VB, &mv[0])) {
-		batt_average_array[batt_average_index] = mv[0];
-		if (++batt_average_index == BATT_NUM_AVG_SAMPLES) batt_average_index = 0;
-		
-		// Compute the battery voltage average mV
-		for (i=0; i<BATT_NUM_AVG_SAMPLES; i++) {
-			sum += batt_average_array[i];
-		}
-		mv[0] = sum / BATT_NUM_AVG_SAMPLES;
+	// Everything comes from one read of the register block - assume, at this point, gCore
+	// accesses are working (the previous values are kept if not)
+	if (!gcore_get_snapshot(&snap)) {
+		return false;
 	}
+	bl_reg_val = snap.bl;
 	
-	(void) gcore_get_reg16(GCORE_REG_IL, &ma[0]);
-	load_average_array[aux_average_index] = ma[0];
-	sum = 0;
-	for (i=0; i<POWER_AUX_AVG_SAMPLES; i++) {
-		sum += load_average_array[i];
-	}
-	ma[0] = sum / POWER_AUX_AVG_SAMPLES;
+	// Update charge state and sd card present
+	cs = gpio_to_charge_state(snap.gpio);
+	sdcard = (snap.gpio & GCORE_GPIO_SD_CARD_MASK) == GCORE_GPIO_SD_CARD_MASK;
 	
-	(void) gcore_get_reg16(GCORE_REG_VU, &mv[1]);
-	vusb_average_array[aux_average_index] = mv[1];
-	sum = 0;
-	for (i=0; i<POWER_AUX_AVG_SAMPLES; i++) {
-		sum += vusb_average_array[i];
-	}
-	mv[1] = sum / POWER_AUX_AVG_SAMPLES;
+	// Update the voltage and current averages
+	mv[0] = average_push(batt_average_array, &batt_average_sum, batt_average_index, BATT_NUM_AVG_SAMPLES, snap.vb);
+	if (++batt_average_index == BATT_NUM_AVG_SAMPLES) batt_average_index = 0;
 	
-	(void) gcore_get_reg16(GCORE_REG_IU, &ma[1]);
-	lusb_average_array[aux_average_index] = ma[1];
-	sum = 0;
-	for (i=0; i<POWER_AUX_AVG_SAMPLES; i++) {
-		sum += lusb_average_array[i];
-	}
-	ma[1] = sum / POWER_AUX_AVG_SAMPLES;
+	ma[0] = average_push(load_average_array, &load_average_sum, aux_average_index, POWER_AUX_AVG_SAMPLES, snap.il);
+	mv[1] = average_push(vusb_average_array, &vusb_average_sum, aux_average_index, POWER_AUX_AVG_SAMPLES, snap.vu);
+	ma[1] = average_push(lusb_average_array, &lusb_average_sum, aux_average_index, POWER_AUX_AVG_SAMPLES, snap.iu);
 	if (++aux_average_index == POWER_AUX_AVG_SAMPLES) aux_average_index = 0;
 	
 	// Update button press state
-	if (gcore_get_reg8(GCORE_REG_STATUS, &t8)) {
-		if (validate_status(t8)) {
-			btn = (t8 & GCORE_ST_PB_PRESS_MASK);
-		} else {
+	if (validate_status(snap.status)) {
+		btn = (snap.status & GCORE_ST_PB_PRESS_MASK);
+	} else {
 #ifdef DEBUG_I2C
-			gpio_set_level(PIN_TRIG, 1);
-			ets_delay_us(20);
-			gpio_set_level(PIN_TRIG, 0);
+		gpio_set_level(PIN_TRIG, 1);
+		ets_delay_us(20);
+		gpio_set_level(PIN_TRIG, 0);
 #endif
-			ESP_LOGE(TAG, "Illegal STATUS = 0x%x", t8);
-		}
+		ESP_LOGE(TAG, "Illegal STATUS = 0x%x", snap.status);
 	}
 	
 	xSemaphoreTake(status_mutex, portMAX_DELAY);
+	bs = batt_mv_to_level_hyst(mv[0], batt_status.batt_state);
+	changed = (bs != batt_status.batt_state) || (cs != batt_status.charge_state);
 	batt_status.batt_voltage = (float) mv[0] / 1000.0;
 	batt_status.load_ma = ma[0];
 	batt_status.usb_voltage = (float) mv[1] / 1000.0;
 	batt_status.usb_ma = ma[1];
-	batt_status.batt_state = batt_mv_to_level(mv[0]);
+	batt_status.batt_state = bs;
 	batt_status.charge_state = cs;
-	power_btn_pressed = btn;
+	if (btn) power_btn_pressed = true;
 	sdcard_present = sdcard;
 	xSemaphoreGive(status_mutex);
+	
+	return changed;
+}
+
+
+// Reads only the STATUS and GPIO registers to see if the full update is necessary
+bool power_event_update()
+{
+	bool btn = false;
+	bool changed;
+	bool sdcard;
+	uint8_t status;
+	uint8_t gpio;
+	uint16_t t16;
+	
+	// The registers are adjacent so one word read gets both
+	if (!gcore_get_reg16(GCORE_REG_STATUS, &t16)) {
+		return false;
+	}
+	status = t16 >> 8;
+	gpio = t16 & 0xFF;
+	sdcard = (gpio & GCORE_GPIO_SD_CARD_MASK) == GCORE_GPIO_SD_CARD_MASK;
+	
+	// Reading STATUS cleared gCore's button press so it is latched here
+	if (validate_status(status)) {
+		btn = (status & GCORE_ST_PB_PRESS_MASK);
+	} else {
+		ESP_LOGE(TAG, "Illegal STATUS = 0x%x", status);
+	}
+	
+	xSemaphoreTake(status_mutex, portMAX_DELAY);
+	changed = btn || (gpio_to_charge_state(gpio) != batt_status.charge_state) || (sdcard != sdcard_present);
+	if (btn) power_btn_pressed = true;
+	xSemaphoreGive(status_mutex);
+	
+	return changed;
 }
 
 
@@ -272,6 +292,7 @@ bool power_button_pressed()
 	
 	xSemaphoreTake(status_mutex, portMAX_DELAY);
 	btn = power_btn_pressed;
+	power_btn_pressed = false;
 	xSemaphoreGive(status_mutex);
 	
 	return btn;
@@ -292,6 +313,9 @@ bool power_get_sdcard_present()
 
 void power_off()
 {
+	// Don't lose a deferred settings update
+	(void) ps_commit();
+	
 	(void) gcore_set_reg8(GCORE_REG_SHDOWN, GCORE_SHUTDOWN_TRIG);
 }
 
@@ -341,6 +365,35 @@ static enum BATT_STATE_t batt_mv_to_level(uint16_t mv)
 }
 
 
+// Only change the level once the voltage is BATT_HYST_THRESHOLD past the threshold
+// separating it from the previous level
+static enum BATT_STATE_t batt_mv_to_level_hyst(uint16_t mv, enum BATT_STATE_t prev)
+{
+	enum BATT_STATE_t bs = batt_mv_to_level(mv);
+	uint16_t hyst_mv = (uint16_t) (BATT_HYST_THRESHOLD * 1000);
+	
+	if (bs > prev) {
+		// Falling (higher states are emptier)
+		if (batt_mv_to_level(mv + hyst_mv) <= prev) bs = prev;
+	} else if (bs < prev) {
+		// Rising
+		if ((mv < hyst_mv) || (batt_mv_to_level(mv - hyst_mv) >= prev)) bs = prev;
+	}
+	
+	return bs;
+}
+
+
+// Replace the oldest sample at index with val and return the new average
+static uint16_t average_push(uint16_t* array, uint32_t* sum, int index, int len, uint16_t val)
+{
+	*sum = *sum - array[index] + val;
+	array[index] = val;
+	
+	return (uint16_t) (*sum / len);
+}
+
+
 // Return false for any illegal status value.  Occasional bad reads were seen
 // during extended testing (e.g. 1 in 2 million reads) and since we use the 
 // STATUS to determine when to shut off, we want to try to validate the read data.
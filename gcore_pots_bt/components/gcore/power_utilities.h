@@ -47,6 +47,13 @@
 #define BATT_0_THRESHOLD      3.6
 #define BATT_CRIT_THRESHOLD   3.5
 
+// The averaged voltage must pass a threshold by this much to change the battery level so
+// noise around a threshold (e.g. load changes at the start of a call) doesn't flip it
+#define BATT_HYST_THRESHOLD   0.02
+
+// USB voltage above which the unit is considered on external power
+#define POWER_USB_PRESENT_THRESHOLD 4.0
+
 
 //
 // Battery status data structures
@@ -83,9 +90,10 @@ typedef struct {
 //
 bool power_init();
 void power_set_brightness(int percent);
-void power_batt_update();
+bool power_batt_update();                  // True when the battery level or charge state changed
+bool power_event_update();                 // True when the button was pressed or the charge or SD card state changed
 void power_get_batt(batt_status_t* bs);
-bool power_button_pressed();
+bool power_button_pressed();               // Returns and clears a latched button press
 bool power_get_sdcard_present();
 void power_off();
 
@@ -6,9 +6,21 @@
  *
  * Persistent storage RAM layout:
  *   ps_header_t
- *   ps_v1_data_t
+ *   ps_v8_data_t
  *   uint16_t checksum
  *
+ * Setters only mark the bytes they change dirty and adjust a running checksum.  Commits
+ * write just the dirty range and the checksum and are deferred by a timer so a burst of
+ * updates (e.g. dragging a slider) results in a single write.
+ *
+ * When CONFIG_PS_JOURNAL_ENABLE is set ps_header and ps_data are kept in a journal in flash
+ * instead (see ps_journal.h): boot reads them from flash and commits append the dirty range
+ * to the journal, so there is no I2C traffic for the settings.  gCore RAM is still read if
+ * the journal doesn't hold them (the first boot with the journal) and is only written if
+ * CONFIG_PS_NVRAM_MIRROR is set or the journal partition can't be used.  An older layout in the
+ * journal is migrated from the journal since RAM may be long out of date.  The owner of the
+ * commit timer holds flash commits off while audio runs (see ps_commit_to_flash).
+ *
  * Copyright 2023 Dan Julio
  *
  * This is free software: you can redistribute it and/or modify
@@ -26,14 +38,19 @@
  *
  */
 #include <stdbool.h>
+#include <stddef.h>
 #include <string.h>
 #include "esp_system.h"
 #include "esp_log.h"
 #include "esp_gap_bt_api.h"
+#include "freertos/FreeRTOS.h"
+#include "soc/soc_memory_layout.h"
 #include "gain.h"
 #include "gcore.h"
 #include "international.h"
+#include "soft_timer.h"
 #include "ps.h"
+#include "ps_journal.h"
 
 //
 // Constants
@@ -42,6 +59,22 @@
 // Allows us to determine if the contents of RAM are valid
 #define PS_MAGIC_BYTES 0x47434254   /* "GCBT" */
 
+// Echo canceller coefficients live in the battery backed NVRAM above the region gCore backs
+// up to flash so they can be saved after every call without wearing the flash
+#define PS_LEC_MAGIC_BYTES 0x47434543   /* "GCEC" */
+#define PS_LEC_START       GCORE_NVRAM_BCKD_LEN
+
+// Echo canceller high-pass filters for new and migrated installs
+#if (CONFIG_LEC_RX_HPF == true) && (CONFIG_LEC_TX_HPF == true)
+#define PS_LEC_HPF_DEFAULT (PS_LEC_HPF_RX | PS_LEC_HPF_TX)
+#elif (CONFIG_LEC_RX_HPF == true)
+#define PS_LEC_HPF_DEFAULT PS_LEC_HPF_RX
+#elif (CONFIG_LEC_TX_HPF == true)
+#define PS_LEC_HPF_DEFAULT PS_LEC_HPF_TX
+#else
+#define PS_LEC_HPF_DEFAULT 0
+#endif
+
 
 
 //
@@ -64,6 +97,115 @@ typedef struct {
 	uint8_t auto_dim;
 } ps_v1_data_t;
 
+// Version 2 persistent storage data fields
+typedef struct {
+	char peer_name[ESP_BT_GAP_MAX_BDNAME_LEN+1];
+	uint8_t paired;
+	uint8_t peer_addr[6];
+	uint8_t country_code;
+	float mic_gain;             // +/- dB
+	float spk_gain;             // +/- dB
+	uint8_t brightness;         // Percentage 
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;      // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+} ps_v2_data_t;
+
+// Version 3 persistent storage data fields
+typedef struct {
+	char name[ESP_BT_GAP_MAX_BDNAME_LEN+1];
+	uint8_t paired;
+	uint8_t addr[6];
+} ps_pair_t;
+
+typedef struct {
+	ps_pair_t pair[PS_BT_MAX_PAIRS];    // Most recently paired first
+	uint8_t country_code;
+	float mic_gain;             // +/- dB
+	float spk_gain;             // +/- dB
+	uint8_t brightness;         // Percentage 
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;      // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+} ps_v3_data_t;
+
+// Version 4 persistent storage data fields
+typedef struct {
+	ps_pair_t pair[PS_BT_MAX_PAIRS];    // Most recently paired first
+	uint8_t country_code;
+	float mic_gain;             // +/- dB
+	float spk_gain;             // +/- dB
+	uint8_t brightness;         // Percentage 
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;      // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+	char speed_dial[PS_SPEED_DIAL_ENTRIES][PS_SPEED_DIAL_LEN+1];  // Empty string when unused
+} ps_v4_data_t;
+
+// Version 5 persistent storage data fields
+typedef struct {
+	ps_pair_t pair[PS_BT_MAX_PAIRS];    // Most recently paired first
+	uint8_t country_code;
+	float mic_gain;             // +/- dB
+	float spk_gain;             // +/- dB
+	uint8_t brightness;         // Percentage 
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;      // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+	char speed_dial[PS_SPEED_DIAL_ENTRIES][PS_SPEED_DIAL_LEN+1];  // Empty string when unused
+	uint8_t lec_hpf;            // PS_LEC_HPF_* bits
+} ps_v5_data_t;
+
+// Version 6 persistent storage data fields
+typedef struct {
+	ps_pair_t pair[PS_BT_MAX_PAIRS];    // Most recently paired first
+	uint8_t country_code;
+	float mic_gain;             // +/- dB
+	float spk_gain;             // +/- dB
+	uint8_t brightness;         // Percentage 
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;      // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+	char speed_dial[PS_SPEED_DIAL_ENTRIES][PS_SPEED_DIAL_LEN+1];  // Empty string when unused
+	uint8_t lec_hpf;            // PS_LEC_HPF_* bits
+	uint8_t ns_level;           // PS_NS_LEVEL_*
+} ps_v6_data_t;
+
+// Version 7 persistent storage data fields
+typedef struct {
+	ps_pair_t pair[PS_BT_MAX_PAIRS];    // Most recently paired first
+	uint8_t country_code;
+	float mic_gain;             // +/- dB
+	float spk_gain;             // +/- dB
+	uint8_t brightness;         // Percentage 
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;      // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+	char speed_dial[PS_SPEED_DIAL_ENTRIES][PS_SPEED_DIAL_LEN+1];  // Empty string when unused
+	uint8_t lec_hpf;            // PS_LEC_HPF_* bits
+	uint8_t ns_level;           // PS_NS_LEVEL_*
+	uint8_t eq_profile;         // PS_EQ_PROFILE_*
+} ps_v7_data_t;
+
+// Version 8 persistent storage data fields
+typedef struct {
+	ps_pair_t pair[PS_BT_MAX_PAIRS];    // Most recently paired first
+	uint8_t country_code;
+	float mic_gain;             // +/- dB
+	float spk_gain;             // +/- dB
+	uint8_t brightness;         // Percentage 
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;      // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+	char speed_dial[PS_SPEED_DIAL_ENTRIES][PS_SPEED_DIAL_LEN+1];  // Empty string when unused
+	uint8_t lec_hpf;            // PS_LEC_HPF_* bits
+	uint8_t ns_level;           // PS_NS_LEVEL_*
+	uint8_t eq_profile;         // PS_EQ_PROFILE_*
+	uint8_t codec_dsp;          // PS_CODEC_DSP_*
+} ps_v8_data_t;
+
+
+// Echo canceller coefficient header (followed by num_taps int16_t coefficients)
+typedef struct {
+	uint32_t magic_bytes;
+	uint16_t num_taps;
+	uint16_t rate;
+	uint16_t checksum;          // Sum of the coefficient bytes
+} ps_lec_header_t;
+
 
 //
 // Global variables
@@ -71,7 +213,29 @@ typedef struct {
 static const char* TAG = "ps";
 
 static ps_header_t ps_header;
-static ps_v1_data_t ps_data;
+static ps_v8_data_t ps_data;
+
+// Running checksum of ps_header and ps_data
+static uint16_t ps_checksum;
+
+// Byte range of ps_data not yet written to RAM (dirty_lo == dirty_hi when clean)
+static uint16_t dirty_lo = 0;
+static uint16_t dirty_hi = 0;
+
+// Protects ps_data, the checksum and the dirty range (setters and commits run in different tasks)
+static portMUX_TYPE ps_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Deferred commit timer (commits are immediate until one is set)
+static int commit_timer = SOFT_TIMER_INVALID;
+
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+// Backing stores written
+static bool ps_use_journal = false;
+static bool ps_use_nvram = true;
+#endif
+
+// Migrating an older layout held in the journal instead of NVRAM
+static bool ps_old_journal = false;
 
 
 
@@ -81,8 +245,24 @@ static ps_v1_data_t ps_data;
 static bool _ps_read_header();
 static bool _ps_read_data();
 static bool _ps_read_checksum(uint16_t* cs);
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+static bool _ps_read_journal();
+#endif
+static bool _ps_read_old_data(uint8_t* data, uint16_t len);
+static bool _ps_migrate_v1();
+static bool _ps_migrate_v2();
+static bool _ps_migrate_v3();
+static bool _ps_migrate_v4();
+static bool _ps_migrate_v5();
+static bool _ps_migrate_v6();
+static bool _ps_migrate_v7();
 static bool _ps_write_array();
+static bool _ps_write_nvram_array();
+static bool _ps_write_nvram_range(uint16_t lo, uint16_t hi, uint8_t* buf, uint16_t cs);
+static void _ps_set_bytes(size_t offset, const void* src, size_t len);
+static void _ps_mark_dirty(uint16_t lo, uint16_t hi);
 static uint16_t _ps_compute_checksum();
+static uint16_t _ps_sum_bytes(uint8_t* sP, size_t len);
 static bool _ps_validate_checksum(uint16_t cs);
 
 
@@ -96,13 +276,68 @@ bool ps_init()
 	bool is_valid;
 	uint16_t cs;
 	
-	// Check to see if RAM has valid information
-	if (!_ps_read_header()) {
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	ps_use_journal = ps_journal_init((uint16_t) (sizeof(ps_header) + sizeof(ps_data)));
+#if (CONFIG_PS_NVRAM_MIRROR == true)
+	ps_use_nvram = true;
+#else
+	ps_use_nvram = !ps_use_journal;
+#endif
+	if (ps_use_journal && _ps_read_journal()) {
+		ESP_LOGI(TAG, "Read persistent storage from flash");
+		return true;
+	}
+#endif
+	
+	// Check to see if RAM has valid information (unless the journal holds an older layout to migrate)
+	if (!ps_old_journal && !_ps_read_header()) {
 		return false;
 	}
 	is_valid = (ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == PS_VERSION);
 	
-	if (!is_valid) {
+	if ((ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == 1)) {
+		ESP_LOGI(TAG, "Migrate persistent storage from version 1");
+		if (!_ps_migrate_v1()) {
+			ESP_LOGE(TAG, "Migration failed : Re-initialize persistent storage");
+			success = ps_set_factory_default();
+		}
+	} else if ((ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == 2)) {
+		ESP_LOGI(TAG, "Migrate persistent storage from version 2");
+		if (!_ps_migrate_v2()) {
+			ESP_LOGE(TAG, "Migration failed : Re-initialize persistent storage");
+			success = ps_set_factory_default();
+		}
+	} else if ((ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == 3)) {
+		ESP_LOGI(TAG, "Migrate persistent storage from version 3");
+		if (!_ps_migrate_v3()) {
+			ESP_LOGE(TAG, "Migration failed : Re-initialize persistent storage");
+			success = ps_set_factory_default();
+		}
+	} else if ((ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == 4)) {
+		ESP_LOGI(TAG, "Migrate persistent storage from version 4");
+		if (!_ps_migrate_v4()) {
+			ESP_LOGE(TAG, "Migration failed : Re-initialize persistent storage");
+			success = ps_set_factory_default();
+		}
+	} else if ((ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == 5)) {
+		ESP_LOGI(TAG, "Migrate persistent storage from version 5");
+		if (!_ps_migrate_v5()) {
+			ESP_LOGE(TAG, "Migration failed : Re-initialize persistent storage");
+			success = ps_set_factory_default();
+		}
+	} else if ((ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == 6)) {
+		ESP_LOGI(TAG, "Migrate persistent storage from version 6");
+		if (!_ps_migrate_v6()) {
+			ESP_LOGE(TAG, "Migration failed : Re-initialize persistent storage");
+			success = ps_set_factory_default();
+		}
+	} else if ((ps_header.magic_bytes == PS_MAGIC_BYTES) && (ps_header.version == 7)) {
+		ESP_LOGI(TAG, "Migrate persistent storage from version 7");
+		if (!_ps_migrate_v7()) {
+			ESP_LOGE(TAG, "Migration failed : Re-initialize persistent storage");
+			success = ps_set_factory_default();
+		}
+	} else if (!is_valid) {
 		ESP_LOGI(TAG, "Initialize persistent storage");
 		success = ps_set_factory_default();
 	} else {
@@ -112,7 +347,14 @@ bool ps_init()
 			success = _ps_read_checksum(&cs);
 			if (success) {
 				if (_ps_validate_checksum(cs)) {
+					ps_checksum = cs;
 					ESP_LOGI(TAG, "Read persistent storage");
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+					if (ps_use_journal) {
+						// Start the journal off with it
+						success = _ps_write_array();
+					}
+#endif
 				} else {
 					ESP_LOGE(TAG, "Invalid checksum : Re-initialize persistent storage");
 					success = ps_set_factory_default();
@@ -127,20 +369,22 @@ bool ps_init()
 
 bool ps_set_factory_default()
 {
-	int i;
-	
 	// Setup default values
 	ps_header.magic_bytes = PS_MAGIC_BYTES;
 	ps_header.version = PS_VERSION;
 	
-	ps_data.paired = 0;
-	for (i=0; i<ESP_BT_GAP_MAX_BDNAME_LEN+1; i++) ps_data.peer_name[i] = 0;
-	for (i=0; i<6; i++) ps_data.peer_addr[i] = 0;
+	memset(ps_data.pair, 0, sizeof(ps_data.pair));
 	ps_data.country_code = INT_DEFAULT_COUNTRY;
 	ps_data.mic_gain = GAIN_APP_MIC_NOM_DB;
 	ps_data.spk_gain = GAIN_APP_SPK_NOM_DB;
 	ps_data.brightness = 80;
 	ps_data.auto_dim = 0;
+	ps_data.lec_tail_msec = PS_LEC_TAIL_COUNTRY_DEFAULT;
+	memset(ps_data.speed_dial, 0, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = PS_LEC_HPF_DEFAULT;
+	ps_data.ns_level = PS_NS_LEVEL_OFF;
+	ps_data.eq_profile = PS_EQ_PROFILE_FLAT;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
 	
 	// Store to RAM
 	return (_ps_write_array());
@@ -149,53 +393,150 @@ bool ps_set_factory_default()
 
 bool ps_update_backing_store()
 {
-	return (_ps_write_array());
+	if (commit_timer == SOFT_TIMER_INVALID) {
+		return ps_commit();
+	}
+	
+	// Restarting the timer coalesces successive updates
+	soft_timer_start(commit_timer, PS_COMMIT_DELAY_MSEC);
+	return true;
+}
+
+
+void ps_set_commit_timer(int t)
+{
+	commit_timer = t;
+	
+	// Pick up updates made before there was a timer that couldn't be committed then
+	if ((t != SOFT_TIMER_INVALID) && (dirty_lo != dirty_hi)) {
+		soft_timer_start(commit_timer, PS_COMMIT_DELAY_MSEC);
+	}
+}
+
+
+bool ps_commit()
+{
+	uint8_t buf[sizeof(ps_data)];
+	uint16_t cs;
+	uint16_t lo;
+	uint16_t hi;
+	
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	// Writing the journal disables the flash cache, which a task whose stack is in PSRAM
+	// can't survive, so such a caller leaves the bytes dirty for the commit timer's owner
+	if (ps_use_journal && !esp_ptr_internal(&cs)) {
+		ESP_LOGW(TAG, "Commit deferred from a PSRAM stack");
+		return false;
+	}
+#endif
+	
+	// Take a consistent copy of the dirty bytes
+	portENTER_CRITICAL(&ps_mux);
+	lo = dirty_lo;
+	hi = dirty_hi;
+	memcpy(buf, (uint8_t*) &ps_data + lo, hi - lo);
+	cs = ps_checksum;
+	dirty_lo = 0;
+	dirty_hi = 0;
+	portEXIT_CRITICAL(&ps_mux);
+	
+	if (lo == hi) return true;
+	
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	if (ps_use_journal) {
+		if (!ps_journal_write((uint16_t) sizeof(ps_header) + lo, buf, hi - lo)) {
+			ESP_LOGE(TAG, "Failed to write data to flash");
+			_ps_mark_dirty(lo, hi);
+			return false;
+		}
+		
+		// A failed mirror write leaves its checksum invalid so it isn't retried
+		if (ps_use_nvram) (void) _ps_write_nvram_range(lo, hi, buf, cs);
+		return true;
+	}
+#endif
+	
+	if (!_ps_write_nvram_range(lo, hi, buf, cs)) {
+		_ps_mark_dirty(lo, hi);
+		return false;
+	}
+	
+	return true;
+}
+
+
+bool ps_commit_to_flash()
+{
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	return ps_use_journal;
+#else
+	return false;
+#endif
 }
 
 
 bool ps_get_bt_is_paired()
 {
-	return (ps_data.paired != 0);
+	// Pairings are kept packed so the first is set if any are
+	return (ps_data.pair[0].paired != 0);
 }
 
 
 void ps_get_bt_pair_addr(uint8_t* addr)
 {
-	for (int i=0; i<6; i++) {
-		*(addr+i) = ps_data.peer_addr[i];
-	}
+	(void) ps_get_bt_pair(0, addr, NULL);
 }
 
 
 void ps_get_bt_pair_name(char* name)
 {
-	strncpy(name, ps_data.peer_name, ESP_BT_GAP_MAX_BDNAME_LEN+1);
-	*(name + ESP_BT_GAP_MAX_BDNAME_LEN) = 0;
+	(void) ps_get_bt_pair(0, NULL, name);
 }
 
 
-void ps_set_bt_pair_info(uint8_t* addr, char* name)
+bool ps_get_bt_pair(int n, uint8_t* addr, char* name)
 {
-	ps_data.paired = 1;
+	if ((n < 0) || (n >= PS_BT_MAX_PAIRS)) return false;
 	
-	for (int i=0; i<6; i++) {
-		ps_data.peer_addr[i] = *(addr+i);
+	if (addr != NULL) {
+		memcpy(addr, ps_data.pair[n].addr, 6);
+	}
+	if (name != NULL) {
+		strncpy(name, ps_data.pair[n].name, ESP_BT_GAP_MAX_BDNAME_LEN+1);
+		*(name + ESP_BT_GAP_MAX_BDNAME_LEN) = 0;
 	}
 	
-	strncpy(ps_data.peer_name, name, ESP_BT_GAP_MAX_BDNAME_LEN);
-	*(name + ESP_BT_GAP_MAX_BDNAME_LEN) = 0;
+	return (ps_data.pair[n].paired != 0);
 }
 
 
-void ps_set_bt_clear_pair_info()
+void ps_set_bt_pair_info(uint8_t* addr, char* name)
 {
-	ps_data.paired = 0;
+	ps_pair_t list[PS_BT_MAX_PAIRS];
+	int i;
+	int n = 1;
 	
-	for (int i=0; i<6; i++) {
-		ps_data.peer_addr[i] = 0;
+	// New pairing first followed by the other phones (dropping the oldest when full)
+	memset(list, 0, sizeof(list));
+	list[0].paired = 1;
+	memcpy(list[0].addr, addr, 6);
+	strncpy(list[0].name, name, ESP_BT_GAP_MAX_BDNAME_LEN);
+	for (i=0; (i<PS_BT_MAX_PAIRS) && (n<PS_BT_MAX_PAIRS); i++) {
+		if ((ps_data.pair[i].paired != 0) && (memcmp(ps_data.pair[i].addr, addr, 6) != 0)) {
+			list[n++] = ps_data.pair[i];
+		}
 	}
 	
-	ps_data.peer_name[0] = 0;
+	_ps_set_bytes(offsetof(ps_v8_data_t, pair), list, sizeof(list));
+}
+
+
+void ps_set_bt_clear_pair_info()
+{
+	ps_pair_t list[PS_BT_MAX_PAIRS];
+	
+	memset(list, 0, sizeof(list));
+	_ps_set_bytes(offsetof(ps_v8_data_t, pair), list, sizeof(list));
 }
 
 
@@ -207,7 +548,7 @@ uint8_t ps_get_country_code()
 
 void ps_set_country_code(uint8_t code)
 {
-	ps_data.country_code = code;
+	_ps_set_bytes(offsetof(ps_v8_data_t, country_code), &code, 1);
 }
 
 
@@ -224,9 +565,9 @@ float ps_get_gain(int gain_type)
 void ps_set_gain(int gain_type, float g)
 {
 	if (gain_type == PS_GAIN_MIC) {
-		ps_data.mic_gain = g;
+		_ps_set_bytes(offsetof(ps_v8_data_t, mic_gain), &g, sizeof(float));
 	} else {
-		ps_data.spk_gain = g;
+		_ps_set_bytes(offsetof(ps_v8_data_t, spk_gain), &g, sizeof(float));
 	}
 }
 
@@ -240,9 +581,161 @@ void ps_get_brightness_info(uint8_t* br, bool* auto_dim_en)
 
 void ps_set_brightness_info(uint8_t br, bool auto_dim_en)
 {
+	uint8_t auto_dim = auto_dim_en ? 1 : 0;
+	
 	if (br > 100) br = 100;
-	ps_data.brightness = br;
-	ps_data.auto_dim = auto_dim_en ? 1 : 0;
+	_ps_set_bytes(offsetof(ps_v8_data_t, brightness), &br, 1);
+	_ps_set_bytes(offsetof(ps_v8_data_t, auto_dim), &auto_dim, 1);
+}
+
+
+uint8_t ps_get_lec_tail_msec()
+{
+	return ps_data.lec_tail_msec;
+}
+
+
+void ps_set_lec_tail_msec(uint8_t msec)
+{
+	_ps_set_bytes(offsetof(ps_v8_data_t, lec_tail_msec), &msec, 1);
+}
+
+
+uint8_t ps_get_lec_hpf()
+{
+	return ps_data.lec_hpf;
+}
+
+
+void ps_set_lec_hpf(uint8_t hpf)
+{
+	hpf &= PS_LEC_HPF_RX | PS_LEC_HPF_TX;
+	_ps_set_bytes(offsetof(ps_v8_data_t, lec_hpf), &hpf, 1);
+}
+
+
+uint8_t ps_get_ns_level()
+{
+	return ps_data.ns_level;
+}
+
+
+void ps_set_ns_level(uint8_t level)
+{
+	if (level > PS_NS_LEVEL_MAX) level = PS_NS_LEVEL_MAX;
+	_ps_set_bytes(offsetof(ps_v8_data_t, ns_level), &level, 1);
+}
+
+
+uint8_t ps_get_eq_profile()
+{
+	return ps_data.eq_profile;
+}
+
+
+void ps_set_eq_profile(uint8_t profile)
+{
+	if (profile > PS_EQ_PROFILE_MAX) profile = PS_EQ_PROFILE_FLAT;
+	_ps_set_bytes(offsetof(ps_v8_data_t, eq_profile), &profile, 1);
+}
+
+
+uint8_t ps_get_codec_dsp()
+{
+	return ps_data.codec_dsp;
+}
+
+
+void ps_set_codec_dsp(uint8_t profile)
+{
+	if (profile > PS_CODEC_DSP_MAX) profile = PS_CODEC_DSP_OFF;
+	_ps_set_bytes(offsetof(ps_v8_data_t, codec_dsp), &profile, 1);
+}
+
+
+bool ps_get_speed_dial(int n, char* num)
+{
+	if ((n < 0) || (n >= PS_SPEED_DIAL_ENTRIES)) return false;
+	
+	if (num != NULL) {
+		strncpy(num, ps_data.speed_dial[n], PS_SPEED_DIAL_LEN+1);
+		*(num + PS_SPEED_DIAL_LEN) = 0;
+	}
+	
+	return (ps_data.speed_dial[n][0] != 0);
+}
+
+
+bool ps_set_speed_dial(int n, const char* num)
+{
+	char buf[PS_SPEED_DIAL_LEN+1];
+	
+	if ((n < 0) || (n >= PS_SPEED_DIAL_ENTRIES) || (strlen(num) > PS_SPEED_DIAL_LEN)) return false;
+	
+	// Whole entry so the unused end is always zeroed
+	memset(buf, 0, sizeof(buf));
+	strcpy(buf, num);
+	_ps_set_bytes(offsetof(ps_v8_data_t, speed_dial) + n * sizeof(buf), buf, sizeof(buf));
+	return true;
+}
+
+
+bool ps_get_lec_coeffs(int16_t* coeffs, int max_taps, int* num_taps, int* rate)
+{
+	ps_lec_header_t hdr;
+	uint16_t start = PS_LEC_START;
+	
+	if (!gcore_get_nvram_bytes(start, (uint8_t*) &hdr, (uint16_t) sizeof(hdr))) {
+		ESP_LOGE(TAG, "Failed to read LEC header from RAM");
+		return false;
+	}
+	if ((hdr.magic_bytes != PS_LEC_MAGIC_BYTES) || (hdr.num_taps == 0) || (hdr.num_taps > max_taps)) {
+		return false;
+	}
+	
+	start += (uint16_t) sizeof(hdr);
+	if (!gcore_get_nvram_bytes(start, (uint8_t*) coeffs, hdr.num_taps * sizeof(int16_t))) {
+		ESP_LOGE(TAG, "Failed to read LEC coefficients from RAM");
+		return false;
+	}
+	if (hdr.checksum != _ps_sum_bytes((uint8_t*) coeffs, hdr.num_taps * sizeof(int16_t))) {
+		ESP_LOGE(TAG, "Invalid LEC coefficient checksum");
+		return false;
+	}
+	
+	*num_taps = (int) hdr.num_taps;
+	*rate = (int) hdr.rate;
+	return true;
+}
+
+
+bool ps_set_lec_coeffs(const int16_t* coeffs, int num_taps, int rate)
+{
+	ps_lec_header_t hdr;
+	uint16_t len;
+	
+	len = (uint16_t) (num_taps * sizeof(int16_t));
+	if ((num_taps <= 0) || ((PS_LEC_START + sizeof(hdr) + len) > GCORE_NVRAM_FULL_LEN)) {
+		ESP_LOGE(TAG, "Illegal LEC coefficient length %d", num_taps);
+		return false;
+	}
+	
+	hdr.magic_bytes = PS_LEC_MAGIC_BYTES;
+	hdr.num_taps = (uint16_t) num_taps;
+	hdr.rate = (uint16_t) rate;
+	hdr.checksum = _ps_sum_bytes((uint8_t*) coeffs, len);
+	
+	// Write the coefficients first so an interrupted update fails the checksum
+	if (!gcore_set_nvram_bytes(PS_LEC_START + sizeof(hdr), (uint8_t*) coeffs, len)) {
+		ESP_LOGE(TAG, "Failed to write LEC coefficients to RAM");
+		return false;
+	}
+	if (!gcore_set_nvram_bytes(PS_LEC_START, (uint8_t*) &hdr, (uint16_t) sizeof(hdr))) {
+		ESP_LOGE(TAG, "Failed to write LEC header to RAM");
+		return false;
+	}
+	
+	return true;
 }
 
 
@@ -297,7 +790,315 @@ static bool _ps_read_checksum(uint16_t* cs)
 }
 
 
+// Reads an older layout's data following ps_header, from the journal or from NVRAM (validating
+// its checksum)
+static bool _ps_read_old_data(uint8_t* data, uint16_t len)
+{
+	uint16_t start;
+	uint16_t cs;
+	
+	start = (uint16_t) sizeof(ps_header);
+	
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	if (ps_old_journal) {
+		// The journal records carry their own CRC
+		if ((ps_journal_stored_len() < (start + len)) || !ps_journal_read(start, data, len)) {
+			ESP_LOGE(TAG, "Failed to read v%d data from flash", ps_header.version);
+			return false;
+		}
+		return true;
+	}
+#endif
+	
+	if (!gcore_get_nvram_bytes(start, data, len)) {
+		ESP_LOGE(TAG, "Failed to read v%d data from RAM", ps_header.version);
+		return false;
+	}
+	
+	start += len;
+	if (!gcore_get_nvram_bytes(start, (uint8_t*) &cs, 2)) {
+		ESP_LOGE(TAG, "Failed to read v%d checksum from RAM", ps_header.version);
+		return false;
+	}
+	
+	if (cs != (_ps_sum_bytes((uint8_t*) &ps_header, sizeof(ps_header)) + _ps_sum_bytes(data, len))) {
+		ESP_LOGE(TAG, "Invalid v%d checksum", ps_header.version);
+		return false;
+	}
+	
+	return true;
+}
+
+
+static bool _ps_migrate_v1()
+{
+	ps_v1_data_t v1_data;
+	
+	if (!_ps_read_old_data((uint8_t*) &v1_data, (uint16_t) sizeof(v1_data))) {
+		return false;
+	}
+	
+	// Copy existing fields and default the new ones
+	memset(ps_data.pair, 0, sizeof(ps_data.pair));
+	memcpy(ps_data.pair[0].name, v1_data.peer_name, sizeof(ps_data.pair[0].name));
+	ps_data.pair[0].paired = v1_data.paired;
+	memcpy(ps_data.pair[0].addr, v1_data.peer_addr, sizeof(ps_data.pair[0].addr));
+	ps_data.country_code = v1_data.country_code;
+	ps_data.mic_gain = v1_data.mic_gain;
+	ps_data.spk_gain = v1_data.spk_gain;
+	ps_data.brightness = v1_data.brightness;
+	ps_data.auto_dim = v1_data.auto_dim;
+	ps_data.lec_tail_msec = PS_LEC_TAIL_COUNTRY_DEFAULT;
+	memset(ps_data.speed_dial, 0, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = PS_LEC_HPF_DEFAULT;
+	ps_data.ns_level = PS_NS_LEVEL_OFF;
+	ps_data.eq_profile = PS_EQ_PROFILE_FLAT;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
+	
+	ps_header.version = PS_VERSION;
+	
+	return (_ps_write_array());
+}
+
+
+static bool _ps_migrate_v2()
+{
+	ps_v2_data_t v2_data;
+	
+	if (!_ps_read_old_data((uint8_t*) &v2_data, (uint16_t) sizeof(v2_data))) {
+		return false;
+	}
+	
+	// The single pairing becomes the first
+	memset(ps_data.pair, 0, sizeof(ps_data.pair));
+	memcpy(ps_data.pair[0].name, v2_data.peer_name, sizeof(ps_data.pair[0].name));
+	ps_data.pair[0].paired = v2_data.paired;
+	memcpy(ps_data.pair[0].addr, v2_data.peer_addr, sizeof(ps_data.pair[0].addr));
+	ps_data.country_code = v2_data.country_code;
+	ps_data.mic_gain = v2_data.mic_gain;
+	ps_data.spk_gain = v2_data.spk_gain;
+	ps_data.brightness = v2_data.brightness;
+	ps_data.auto_dim = v2_data.auto_dim;
+	ps_data.lec_tail_msec = v2_data.lec_tail_msec;
+	memset(ps_data.speed_dial, 0, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = PS_LEC_HPF_DEFAULT;
+	ps_data.ns_level = PS_NS_LEVEL_OFF;
+	ps_data.eq_profile = PS_EQ_PROFILE_FLAT;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
+	
+	ps_header.version = PS_VERSION;
+	
+	return (_ps_write_array());
+}
+
+
+static bool _ps_migrate_v3()
+{
+	ps_v3_data_t v3_data;
+	
+	if (!_ps_read_old_data((uint8_t*) &v3_data, (uint16_t) sizeof(v3_data))) {
+		return false;
+	}
+	
+	// Copy existing fields and start with an empty speed dial table
+	memcpy(ps_data.pair, v3_data.pair, sizeof(ps_data.pair));
+	ps_data.country_code = v3_data.country_code;
+	ps_data.mic_gain = v3_data.mic_gain;
+	ps_data.spk_gain = v3_data.spk_gain;
+	ps_data.brightness = v3_data.brightness;
+	ps_data.auto_dim = v3_data.auto_dim;
+	ps_data.lec_tail_msec = v3_data.lec_tail_msec;
+	memset(ps_data.speed_dial, 0, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = PS_LEC_HPF_DEFAULT;
+	ps_data.ns_level = PS_NS_LEVEL_OFF;
+	ps_data.eq_profile = PS_EQ_PROFILE_FLAT;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
+	
+	ps_header.version = PS_VERSION;
+	
+	return (_ps_write_array());
+}
+
+
+static bool _ps_migrate_v4()
+{
+	ps_v4_data_t v4_data;
+	
+	if (!_ps_read_old_data((uint8_t*) &v4_data, (uint16_t) sizeof(v4_data))) {
+		return false;
+	}
+	
+	// Copy existing fields and default the echo canceller filters
+	memcpy(ps_data.pair, v4_data.pair, sizeof(ps_data.pair));
+	ps_data.country_code = v4_data.country_code;
+	ps_data.mic_gain = v4_data.mic_gain;
+	ps_data.spk_gain = v4_data.spk_gain;
+	ps_data.brightness = v4_data.brightness;
+	ps_data.auto_dim = v4_data.auto_dim;
+	ps_data.lec_tail_msec = v4_data.lec_tail_msec;
+	memcpy(ps_data.speed_dial, v4_data.speed_dial, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = PS_LEC_HPF_DEFAULT;
+	ps_data.ns_level = PS_NS_LEVEL_OFF;
+	ps_data.eq_profile = PS_EQ_PROFILE_FLAT;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
+	
+	ps_header.version = PS_VERSION;
+	
+	return (_ps_write_array());
+}
+
+
+static bool _ps_migrate_v5()
+{
+	ps_v5_data_t v5_data;
+	
+	if (!_ps_read_old_data((uint8_t*) &v5_data, (uint16_t) sizeof(v5_data))) {
+		return false;
+	}
+	
+	// Copy existing fields and start with the noise suppressor off
+	memcpy(ps_data.pair, v5_data.pair, sizeof(ps_data.pair));
+	ps_data.country_code = v5_data.country_code;
+	ps_data.mic_gain = v5_data.mic_gain;
+	ps_data.spk_gain = v5_data.spk_gain;
+	ps_data.brightness = v5_data.brightness;
+	ps_data.auto_dim = v5_data.auto_dim;
+	ps_data.lec_tail_msec = v5_data.lec_tail_msec;
+	memcpy(ps_data.speed_dial, v5_data.speed_dial, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = v5_data.lec_hpf;
+	ps_data.ns_level = PS_NS_LEVEL_OFF;
+	ps_data.eq_profile = PS_EQ_PROFILE_FLAT;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
+	
+	ps_header.version = PS_VERSION;
+	
+	return (_ps_write_array());
+}
+
+
+static bool _ps_migrate_v6()
+{
+	ps_v6_data_t v6_data;
+	
+	if (!_ps_read_old_data((uint8_t*) &v6_data, (uint16_t) sizeof(v6_data))) {
+		return false;
+	}
+	
+	// Copy existing fields and start with the equalizer flat
+	memcpy(ps_data.pair, v6_data.pair, sizeof(ps_data.pair));
+	ps_data.country_code = v6_data.country_code;
+	ps_data.mic_gain = v6_data.mic_gain;
+	ps_data.spk_gain = v6_data.spk_gain;
+	ps_data.brightness = v6_data.brightness;
+	ps_data.auto_dim = v6_data.auto_dim;
+	ps_data.lec_tail_msec = v6_data.lec_tail_msec;
+	memcpy(ps_data.speed_dial, v6_data.speed_dial, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = v6_data.lec_hpf;
+	ps_data.ns_level = v6_data.ns_level;
+	ps_data.eq_profile = PS_EQ_PROFILE_FLAT;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
+	
+	ps_header.version = PS_VERSION;
+	
+	return (_ps_write_array());
+}
+
+
+static bool _ps_migrate_v7()
+{
+	ps_v7_data_t v7_data;
+	
+	if (!_ps_read_old_data((uint8_t*) &v7_data, (uint16_t) sizeof(v7_data))) {
+		return false;
+	}
+	
+	// Copy existing fields and start with the codec DSP blocks off
+	memcpy(ps_data.pair, v7_data.pair, sizeof(ps_data.pair));
+	ps_data.country_code = v7_data.country_code;
+	ps_data.mic_gain = v7_data.mic_gain;
+	ps_data.spk_gain = v7_data.spk_gain;
+	ps_data.brightness = v7_data.brightness;
+	ps_data.auto_dim = v7_data.auto_dim;
+	ps_data.lec_tail_msec = v7_data.lec_tail_msec;
+	memcpy(ps_data.speed_dial, v7_data.speed_dial, sizeof(ps_data.speed_dial));
+	ps_data.lec_hpf = v7_data.lec_hpf;
+	ps_data.ns_level = v7_data.ns_level;
+	ps_data.eq_profile = v7_data.eq_profile;
+	ps_data.codec_dsp = PS_CODEC_DSP_OFF;
+	
+	ps_header.version = PS_VERSION;
+	
+	return (_ps_write_array());
+}
+
+
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+// Loads ps_header and ps_data from the journal if it holds the current layout.  An older
+// layout leaves ps_header loaded and sets ps_old_journal so ps_init migrates it from the journal
+// (NVRAM hasn't been written since the journal took over unless it is mirrored).
+static bool _ps_read_journal()
+{
+	if (!ps_journal_read(0, &ps_header, (uint16_t) sizeof(ps_header))) {
+		return false;
+	}
+	
+	if (ps_header.magic_bytes != PS_MAGIC_BYTES) {
+		ESP_LOGW(TAG, "Journal doesn't hold persistent storage");
+		return false;
+	}
+	
+	if ((ps_header.version >= 1) && (ps_header.version < PS_VERSION)) {
+		ps_old_journal = true;
+		return false;
+	}
+	
+	if ((ps_header.version != PS_VERSION) ||
+	    (ps_journal_stored_len() != (uint16_t) (sizeof(ps_header) + sizeof(ps_data)))) {
+		ESP_LOGW(TAG, "Journal doesn't hold version %d", PS_VERSION);
+		return false;
+	}
+	
+	(void) ps_journal_read((uint16_t) sizeof(ps_header), &ps_data, (uint16_t) sizeof(ps_data));
+	ps_checksum = _ps_compute_checksum();
+	
+	return true;
+}
+#endif
+
+
+// Writes everything, used when the layout is (re)initialized
 static bool _ps_write_array()
+{
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	bool success = true;
+	
+#endif
+	portENTER_CRITICAL(&ps_mux);
+	ps_checksum = _ps_compute_checksum();
+	dirty_lo = 0;
+	dirty_hi = 0;
+	portEXIT_CRITICAL(&ps_mux);
+	
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	if (ps_use_journal) {
+		ps_journal_set(0, &ps_header, (uint16_t) sizeof(ps_header));
+		ps_journal_set((uint16_t) sizeof(ps_header), &ps_data, (uint16_t) sizeof(ps_data));
+		if (!ps_journal_snapshot()) {
+			ESP_LOGE(TAG, "Failed to write persistent storage to flash");
+			success = false;
+		}
+		
+		// The mirror is best effort
+		if (ps_use_nvram) (void) _ps_write_nvram_array();
+		return success;
+	}
+#endif
+	
+	return _ps_write_nvram_array();
+}
+
+
+static bool _ps_write_nvram_array()
 {
 	bool success = true;
 	uint16_t cs;
@@ -315,7 +1116,7 @@ static bool _ps_write_array()
 			ESP_LOGE(TAG, "Failed to write data to RAM");
 			success = false;
 		} else {
-			cs = _ps_compute_checksum();			
+			cs = ps_checksum;
 			if (!gcore_set_nvram_bytes(start+len, (uint8_t*) &cs, 2)) {
 				ESP_LOGE(TAG, "Failed to write checksum to RAM");
 				success = false;
@@ -327,24 +1128,82 @@ static bool _ps_write_array()
 }
 
 
-static uint16_t _ps_compute_checksum()
+// Writes a range of ps_data and the checksum
+static bool _ps_write_nvram_range(uint16_t lo, uint16_t hi, uint8_t* buf, uint16_t cs)
 {
-	int i;
-	size_t header_len;
-	size_t data_len;
-	uint8_t* sP;
-	uint16_t cs = 0;
+	uint16_t start;
 	
-	header_len = sizeof(ps_header);
-	data_len = sizeof(ps_data);
+	// Data before checksum so an interrupted update fails validation
+	start = (uint16_t) sizeof(ps_header);
+	if (!gcore_set_nvram_bytes(start + lo, buf, hi - lo)) {
+		ESP_LOGE(TAG, "Failed to write data to RAM");
+		return false;
+	}
+	if (!gcore_set_nvram_bytes(start + (uint16_t) sizeof(ps_data), (uint8_t*) &cs, 2)) {
+		ESP_LOGE(TAG, "Failed to write checksum to RAM");
+		return false;
+	}
 	
-	sP = (uint8_t*) &ps_header;
-	for (i=0; i<header_len; i++) {
-		cs += *sP++;
+	return true;
+}
+
+
+// Updates a field, tracking the changed bytes and their effect on the checksum
+static void _ps_set_bytes(size_t offset, const void* src, size_t len)
+{
+	uint8_t* dP = (uint8_t*) &ps_data + offset;
+	const uint8_t* sP = (const uint8_t*) src;
+	size_t i;
+	
+	portENTER_CRITICAL(&ps_mux);
+	for (i=0; i<len; i++) {
+		if (dP[i] != sP[i]) {
+			ps_checksum += (uint16_t) sP[i] - (uint16_t) dP[i];
+			dP[i] = sP[i];
+			if (dirty_lo == dirty_hi) {
+				dirty_lo = offset + i;
+				dirty_hi = offset + i + 1;
+			} else {
+				if ((offset + i) < dirty_lo) dirty_lo = offset + i;
+				if ((offset + i + 1) > dirty_hi) dirty_hi = offset + i + 1;
+			}
+		}
+	}
+	portEXIT_CRITICAL(&ps_mux);
+}
+
+
+// Merges a range back in after a failed commit
+static void _ps_mark_dirty(uint16_t lo, uint16_t hi)
+{
+	portENTER_CRITICAL(&ps_mux);
+	if (dirty_lo == dirty_hi) {
+		dirty_lo = lo;
+		dirty_hi = hi;
+	} else {
+		if (lo < dirty_lo) dirty_lo = lo;
+		if (hi > dirty_hi) dirty_hi = hi;
 	}
+	portEXIT_CRITICAL(&ps_mux);
+}
+
+
+static uint16_t _ps_compute_checksum()
+{
+	uint16_t cs;
+	
+	cs = _ps_sum_bytes((uint8_t*) &ps_header, sizeof(ps_header));
+	cs += _ps_sum_bytes((uint8_t*) &ps_data, sizeof(ps_data));
+	
+	return cs;
+}
+
+
+static uint16_t _ps_sum_bytes(uint8_t* sP, size_t len)
+{
+	uint16_t cs = 0;
 	
-	sP = (uint8_t*) &ps_data;
-	for (i=0; i<data_len; i++) {
+	while (len--) {
 		cs += *sP++;
 	}
 	
@@ -32,12 +32,49 @@
 
 // PS_VERSION increments when the layout changes.  This allows us to automatically
 // migrate when we add new features.
-#define PS_VERSION 1
+#define PS_VERSION 8
+
+// Phones remembered (only one can be connected at a time)
+#define PS_BT_MAX_PAIRS 2
+
+// Speed dial table (entry 0 holds the last number dialed for redial)
+#define PS_SPEED_DIAL_ENTRIES 10
+#define PS_SPEED_DIAL_REDIAL  0
+#define PS_SPEED_DIAL_LEN     24
 
 // Gain types
 #define PS_GAIN_MIC 0
 #define PS_GAIN_SPK 1
 
+// Echo canceller tail length value that selects the country default
+#define PS_LEC_TAIL_COUNTRY_DEFAULT 0
+
+// Echo canceller high-pass filter bits
+#define PS_LEC_HPF_RX 0x01          // Line (hybrid) signal before the canceller
+#define PS_LEC_HPF_TX 0x02          // Voice played to the line (the canceller reference)
+
+// Noise suppressor levels (maximum attenuation of line noise in the voice sent to the cellphone)
+#define PS_NS_LEVEL_OFF  0
+#define PS_NS_LEVEL_LOW  1
+#define PS_NS_LEVEL_MED  2
+#define PS_NS_LEVEL_HIGH 3
+#define PS_NS_LEVEL_MAX  PS_NS_LEVEL_HIGH
+
+// Handset equalizer profiles (the handset's microphone type)
+#define PS_EQ_PROFILE_FLAT     0
+#define PS_EQ_PROFILE_CARBON   1
+#define PS_EQ_PROFILE_ELECTRET 2
+#define PS_EQ_PROFILE_MAX      PS_EQ_PROFILE_ELECTRET
+
+// Codec DSP offload profiles (ES8388 blocks replacing software stages on the line signal)
+#define PS_CODEC_DSP_OFF  0         // Software filters and AGC only
+#define PS_CODEC_DSP_HPF  1         // Codec ADC high-pass filter
+#define PS_CODEC_DSP_ALC  2         // Codec ADC high-pass filter, ALC and noise gate
+#define PS_CODEC_DSP_MAX  PS_CODEC_DSP_ALC
+
+// Delay from the last ps_update_backing_store to the write to RAM when a commit timer is set
+#define PS_COMMIT_DELAY_MSEC 1000
+
 
 //
 // PS Utilities API
@@ -45,12 +82,16 @@
 bool ps_init();
 bool ps_set_factory_default();
 bool ps_update_backing_store();    // Call after making changes vis ps_set_* routines
+void ps_set_commit_timer(int t);   // soft_timer whose expiration the owning task handles with ps_commit
+bool ps_commit();                  // Write any changed bytes now (from an internal RAM stack for the journal)
+bool ps_commit_to_flash();         // Commits program flash (the journal), stalling the flash cache
 
 bool ps_get_bt_is_paired();
-void ps_get_bt_pair_addr(uint8_t* addr);
+void ps_get_bt_pair_addr(uint8_t* addr);   // Most recent pairing
 void ps_get_bt_pair_name(char* name);   // name must be ESP_BT_GAP_MAX_BDNAME_LEN+1 long
-void ps_set_bt_pair_info(uint8_t* addr, char* name);
-void ps_set_bt_clear_pair_info();
+bool ps_get_bt_pair(int n, uint8_t* addr, char* name);  // Pairing n (0 most recent), false if unused; addr/name may be NULL
+void ps_set_bt_pair_info(uint8_t* addr, char* name);    // Becomes pairing 0, pushing down the others
+void ps_set_bt_clear_pair_info();          // Forgets all pairings
 
 uint8_t ps_get_country_code();
 void ps_set_country_code(uint8_t code);
@@ -61,4 +102,27 @@ void ps_set_gain(int gain_type, float g);
 void ps_get_brightness_info(uint8_t* br, bool* auto_dim_en);
 void ps_set_brightness_info(uint8_t br, bool auto_dim_en);
 
+uint8_t ps_get_lec_tail_msec();              // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+void ps_set_lec_tail_msec(uint8_t msec);
+
+uint8_t ps_get_lec_hpf();                    // PS_LEC_HPF_* bits, used starting with the next call
+void ps_set_lec_hpf(uint8_t hpf);
+
+uint8_t ps_get_ns_level();                   // PS_NS_LEVEL_*, used starting with the next call
+void ps_set_ns_level(uint8_t level);
+
+uint8_t ps_get_eq_profile();                 // PS_EQ_PROFILE_*, used starting with the next call
+void ps_set_eq_profile(uint8_t profile);
+
+uint8_t ps_get_codec_dsp();                  // PS_CODEC_DSP_*, used starting with the next call
+void ps_set_codec_dsp(uint8_t profile);
+
+bool ps_get_speed_dial(int n, char* num);         // num must be PS_SPEED_DIAL_LEN+1 long (or NULL); false if unused
+bool ps_set_speed_dial(int n, const char* num);   // Empty string clears the entry; false if num is too long
+
+// Converged echo canceller coefficients are stored separately, outside the flash backed
+// NVRAM region, and written immediately (no ps_update_backing_store necessary)
+bool ps_get_lec_coeffs(int16_t* coeffs, int max_taps, int* num_taps, int* rate); // False if none valid
+bool ps_set_lec_coeffs(const int16_t* coeffs, int num_taps, int rate);
+
 #endif /* PS_UTILITIES_H */
\ No newline at end of file
@@ -0,0 +1,429 @@
+/*
+ * Persistent Storage Journal Module
+ *
+ * Keep the persistent storage image in an append-only log in the "ps" flash partition.  See
+ * ps_journal.h.
+ *
+ * Sector layout:
+ *   ps_jrnl_sector_t
+ *   snapshot record (offset 0, the whole image)
+ *   update records
+ *   erased flash
+ *
+ * Record layout:
+ *   ps_jrnl_rec_t
+ *   data padded with 0xFF to a multiple of 4 bytes
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "ps_journal.h"
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+#include <stddef.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_spi_flash.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+
+//
+// Constants
+//
+#define PS_JRNL_PART_NAME    "ps"
+#define PS_JRNL_PART_SUBTYPE 0x42
+#define PS_JRNL_MAGIC_BYTES  0x4C4A5350   /* "PSJL" */
+
+#define PS_JRNL_SECTOR_LEN   SPI_FLASH_SEC_SIZE
+
+// Offset and length of the erased flash following the last record
+#define PS_JRNL_ERASED       0xFFFF
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t magic_bytes;
+	uint32_t seq;               // Increments with each compaction
+	uint16_t image_len;
+	uint16_t reserved;
+	uint32_t crc;               // Of the fields above
+} ps_jrnl_sector_t;
+
+typedef struct {
+	uint16_t offset;            // In the image
+	uint16_t len;
+	uint32_t crc;               // Of offset, len and the data
+} ps_jrnl_rec_t;
+
+
+
+//
+// Global variables
+//
+static const char* TAG = "ps_journal";
+
+static const esp_partition_t* jrnl_part;
+static int jrnl_num_sectors;
+
+// PSRAM copy of the image, always holding the latest changes
+static uint8_t* jrnl_image;
+static uint16_t jrnl_image_len;
+
+// Length of the image replayed at boot (an older layout's may differ)
+static uint16_t jrnl_stored_len = 0;
+
+// A record being written (in PSRAM)
+static uint8_t* jrnl_buf;
+
+// Current sector (jrnl_used set to PS_JRNL_SECTOR_LEN forces a compaction on the next write)
+static int jrnl_sector = -1;
+static uint32_t jrnl_seq = 0;
+static uint32_t jrnl_used;
+
+static ps_journal_stats_t jrnl_stats;
+
+// Serializes writes (commits come from several tasks)
+static SemaphoreHandle_t jrnl_mutex;
+static StaticSemaphore_t jrnl_mutex_buf;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static bool _ps_jrnl_valid_sector(const uint8_t* sP, uint32_t* seq);
+static uint32_t _ps_jrnl_replay(const uint8_t* sP);
+static bool _ps_jrnl_append(uint16_t offset, uint16_t len);
+static bool _ps_jrnl_compact();
+static uint32_t _ps_jrnl_build_rec(uint16_t offset, uint16_t len);
+static uint32_t _ps_jrnl_rec_len(uint16_t len);
+static uint32_t _ps_jrnl_rec_crc(const ps_jrnl_rec_t* rP, const uint8_t* data);
+
+
+
+//
+// API
+//
+bool ps_journal_init(uint16_t image_len)
+{
+	const void* p;
+	spi_flash_mmap_handle_t handle;
+	int i;
+	uint32_t seq;
+	
+	memset(&jrnl_stats, 0, sizeof(ps_journal_stats_t));
+	jrnl_stats.sector = -1;
+	jrnl_stats.sector_len = PS_JRNL_SECTOR_LEN;
+	
+	if (image_len > PS_JOURNAL_MAX_LEN) {
+		ESP_LOGE(TAG, "Image too large (%d bytes)", image_len);
+		return false;
+	}
+	jrnl_image_len = image_len;
+	
+	jrnl_image = (uint8_t*) heap_caps_calloc(1, image_len, MALLOC_CAP_SPIRAM);
+	jrnl_buf = (uint8_t*) heap_caps_malloc(sizeof(ps_jrnl_rec_t) + image_len + 3, MALLOC_CAP_SPIRAM);
+	if ((jrnl_image == NULL) || (jrnl_buf == NULL)) {
+		ESP_LOGE(TAG, "Could not allocate buffers");
+		return false;
+	}
+	
+	jrnl_part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, PS_JRNL_PART_SUBTYPE, PS_JRNL_PART_NAME);
+	if (jrnl_part == NULL) {
+		ESP_LOGE(TAG, "No persistent storage partition");
+		return false;
+	}
+	jrnl_num_sectors = jrnl_part->size / PS_JRNL_SECTOR_LEN;
+	if (jrnl_num_sectors < 2) {
+		ESP_LOGE(TAG, "Persistent storage partition too small");
+		return false;
+	}
+	
+	jrnl_mutex = xSemaphoreCreateMutexStatic(&jrnl_mutex_buf);
+	
+	// Find the current sector and replay it in one pass over the mapped partition
+	if (esp_partition_mmap(jrnl_part, 0, jrnl_part->size, SPI_FLASH_MMAP_DATA, &p, &handle) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not map the persistent storage partition");
+		return false;
+	}
+	
+	for (i=0; i<jrnl_num_sectors; i++) {
+		if (_ps_jrnl_valid_sector((const uint8_t*) p + i * PS_JRNL_SECTOR_LEN, &seq)) {
+			if ((jrnl_sector < 0) || (seq > jrnl_seq)) {
+				jrnl_sector = i;
+				jrnl_seq = seq;
+			}
+		}
+	}
+	
+	if (jrnl_sector >= 0) {
+		jrnl_used = _ps_jrnl_replay((const uint8_t*) p + jrnl_sector * PS_JRNL_SECTOR_LEN);
+	}
+	
+	spi_flash_munmap(handle);
+	
+	if (jrnl_stats.loaded) {
+		ESP_LOGI(TAG, "Loaded from sector %d (%u bytes used)", jrnl_sector, jrnl_used);
+	} else {
+		ESP_LOGI(TAG, "No image");
+	}
+	
+	return true;
+}
+
+
+bool ps_journal_read(uint16_t offset, void* data, uint16_t len)
+{
+	if (!jrnl_stats.loaded || ((offset + len) > jrnl_image_len)) return false;
+	
+	memcpy(data, jrnl_image + offset, len);
+	return true;
+}
+
+
+uint16_t ps_journal_stored_len()
+{
+	return jrnl_stats.loaded ? jrnl_stored_len : 0;
+}
+
+
+void ps_journal_set(uint16_t offset, const void* data, uint16_t len)
+{
+	if ((offset + len) > jrnl_image_len) return;
+	
+	xSemaphoreTake(jrnl_mutex, portMAX_DELAY);
+	memcpy(jrnl_image + offset, data, len);
+	xSemaphoreGive(jrnl_mutex);
+}
+
+
+bool ps_journal_write(uint16_t offset, const void* data, uint16_t len)
+{
+	bool success;
+	
+	if ((offset + len) > jrnl_image_len) return false;
+	if (len == 0) return true;
+	
+	xSemaphoreTake(jrnl_mutex, portMAX_DELAY);
+	memcpy(jrnl_image + offset, data, len);
+	if ((jrnl_sector >= 0) && ((jrnl_used + _ps_jrnl_rec_len(len)) <= PS_JRNL_SECTOR_LEN)) {
+		success = _ps_jrnl_append(offset, len);
+	} else {
+		// The snapshot in the next sector includes this change
+		success = _ps_jrnl_compact();
+	}
+	xSemaphoreGive(jrnl_mutex);
+	
+	return success;
+}
+
+
+bool ps_journal_snapshot()
+{
+	bool success;
+	
+	xSemaphoreTake(jrnl_mutex, portMAX_DELAY);
+	success = _ps_jrnl_compact();
+	xSemaphoreGive(jrnl_mutex);
+	
+	return success;
+}
+
+
+void ps_journal_get_stats(ps_journal_stats_t* stats)
+{
+	if (jrnl_mutex == NULL) {
+		*stats = jrnl_stats;
+		return;
+	}
+	
+	xSemaphoreTake(jrnl_mutex, portMAX_DELAY);
+	jrnl_stats.sector = jrnl_sector;
+	jrnl_stats.seq = jrnl_seq;
+	jrnl_stats.used = (jrnl_sector < 0) ? 0 : jrnl_used;
+	*stats = jrnl_stats;
+	xSemaphoreGive(jrnl_mutex);
+}
+
+
+
+//
+// Internal Functions
+//
+static bool _ps_jrnl_valid_sector(const uint8_t* sP, uint32_t* seq)
+{
+	ps_jrnl_sector_t hdr;
+	
+	memcpy(&hdr, sP, sizeof(hdr));
+	if (hdr.magic_bytes != PS_JRNL_MAGIC_BYTES) return false;
+	if (hdr.crc != esp_rom_crc32_le(0, (const uint8_t*) &hdr, offsetof(ps_jrnl_sector_t, crc))) return false;
+	
+	*seq = hdr.seq;
+	return true;
+}
+
+
+// Applies a sector's records to the image, returning the bytes of it used.  An image written
+// by an older layout of a different length is replayed as far as it fits for ps to migrate.
+static uint32_t _ps_jrnl_replay(const uint8_t* sP)
+{
+	ps_jrnl_sector_t hdr;
+	ps_jrnl_rec_t rec;
+	uint32_t pos = sizeof(ps_jrnl_sector_t);
+	uint16_t n;
+	
+	memcpy(&hdr, sP, sizeof(hdr));
+	jrnl_stored_len = hdr.image_len;
+	
+	while ((pos + sizeof(ps_jrnl_rec_t)) <= PS_JRNL_SECTOR_LEN) {
+		memcpy(&rec, sP + pos, sizeof(rec));
+		if ((rec.offset == PS_JRNL_ERASED) && (rec.len == PS_JRNL_ERASED)) {
+			// End of the records
+			break;
+		}
+		
+		if (((rec.offset + rec.len) > hdr.image_len) ||
+		    ((pos + _ps_jrnl_rec_len(rec.len)) > PS_JRNL_SECTOR_LEN) ||
+		    (rec.crc != _ps_jrnl_rec_crc(&rec, sP + pos + sizeof(rec))) ||
+		    (!jrnl_stats.loaded && ((rec.offset != 0) || (rec.len != hdr.image_len)))) {
+			// A write cut short: the flash after it isn't erased so the next write compacts
+			ESP_LOGW(TAG, "Bad record at %u", pos);
+			return PS_JRNL_SECTOR_LEN;
+		}
+		
+		if (rec.offset < jrnl_image_len) {
+			n = rec.len;
+			if ((rec.offset + n) > jrnl_image_len) n = jrnl_image_len - rec.offset;
+			memcpy(jrnl_image + rec.offset, sP + pos + sizeof(rec), n);
+		}
+		jrnl_stats.loaded = true;
+		pos += _ps_jrnl_rec_len(rec.len);
+	}
+	
+	if (hdr.image_len != jrnl_image_len) {
+		// Records of the new length can't follow, the next write starts a new sector
+		ESP_LOGW(TAG, "Image length changed from %d to %d bytes", hdr.image_len, jrnl_image_len);
+		return PS_JRNL_SECTOR_LEN;
+	}
+	
+	return pos;
+}
+
+
+static bool _ps_jrnl_append(uint16_t offset, uint16_t len)
+{
+	uint32_t rec_len;
+	
+	rec_len = _ps_jrnl_build_rec(offset, len);
+	if (esp_partition_write(jrnl_part, jrnl_sector * PS_JRNL_SECTOR_LEN + jrnl_used, jrnl_buf, rec_len) != ESP_OK) {
+		// Part of the record may have been written so don't write after it
+		ESP_LOGE(TAG, "Failed to append record");
+		jrnl_stats.failures++;
+		jrnl_used = PS_JRNL_SECTOR_LEN;
+		return false;
+	}
+	
+	jrnl_used += rec_len;
+	jrnl_stats.records++;
+	return true;
+}
+
+
+// Writes the image to the next sector, making it current once it is all there.  The erase
+// yields (CONFIG_SPI_FLASH_YIELD_DURING_ERASE) and is needed once per sector's worth of records.
+static bool _ps_jrnl_compact()
+{
+	ps_jrnl_sector_t hdr;
+	int next;
+	uint32_t addr;
+	uint32_t rec_len;
+	
+	next = (jrnl_sector < 0) ? 0 : ((jrnl_sector + 1) % jrnl_num_sectors);
+	addr = next * PS_JRNL_SECTOR_LEN;
+	
+	if (esp_partition_erase_range(jrnl_part, addr, PS_JRNL_SECTOR_LEN) != ESP_OK) {
+		ESP_LOGE(TAG, "Failed to erase sector %d", next);
+		jrnl_stats.failures++;
+		return false;
+	}
+	
+	rec_len = _ps_jrnl_build_rec(0, jrnl_image_len);
+	if (esp_partition_write(jrnl_part, addr + sizeof(hdr), jrnl_buf, rec_len) != ESP_OK) {
+		ESP_LOGE(TAG, "Failed to write snapshot");
+		jrnl_stats.failures++;
+		return false;
+	}
+	
+	// The header goes last so a compaction cut short leaves the previous sector current
+	hdr.magic_bytes = PS_JRNL_MAGIC_BYTES;
+	hdr.seq = jrnl_seq + 1;
+	hdr.image_len = jrnl_image_len;
+	hdr.reserved = 0xFFFF;
+	hdr.crc = esp_rom_crc32_le(0, (const uint8_t*) &hdr, offsetof(ps_jrnl_sector_t, crc));
+	if (esp_partition_write(jrnl_part, addr, &hdr, sizeof(hdr)) != ESP_OK) {
+		ESP_LOGE(TAG, "Failed to write sector header");
+		jrnl_stats.failures++;
+		return false;
+	}
+	
+	jrnl_sector = next;
+	jrnl_seq = hdr.seq;
+	jrnl_used = sizeof(hdr) + rec_len;
+	jrnl_stats.compactions++;
+	
+	return true;
+}
+
+
+// Builds a record of an image range in jrnl_buf, returning its length
+static uint32_t _ps_jrnl_build_rec(uint16_t offset, uint16_t len)
+{
+	ps_jrnl_rec_t rec;
+	uint32_t rec_len = _ps_jrnl_rec_len(len);
+	
+	rec.offset = offset;
+	rec.len = len;
+	rec.crc = _ps_jrnl_rec_crc(&rec, jrnl_image + offset);
+	
+	memset(jrnl_buf, 0xFF, rec_len);
+	memcpy(jrnl_buf, &rec, sizeof(rec));
+	memcpy(jrnl_buf + sizeof(rec), jrnl_image + offset, len);
+	
+	return rec_len;
+}
+
+
+static uint32_t _ps_jrnl_rec_len(uint16_t len)
+{
+	return sizeof(ps_jrnl_rec_t) + (((uint32_t) len + 3) & ~0x3);
+}
+
+
+static uint32_t _ps_jrnl_rec_crc(const ps_jrnl_rec_t* rP, const uint8_t* data)
+{
+	uint32_t crc;
+	
+	crc = esp_rom_crc32_le(0, (const uint8_t*) rP, offsetof(ps_jrnl_rec_t, crc));
+	return esp_rom_crc32_le(crc, data, rP->len);
+}
+
+#endif /* CONFIG_PS_JOURNAL_ENABLE */
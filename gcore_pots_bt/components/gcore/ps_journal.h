@@ -0,0 +1,75 @@
+/*
+ * Persistent Storage Journal Module
+ *
+ * Keep the persistent storage image in the "ps" flash partition as an append-only log so
+ * boot reads it from flash in one pass and a change is a small append instead of a rewrite.
+ *
+ * Each flash sector of the partition holds a header followed by records.  The first record in
+ * a sector is a snapshot of the whole image, the following records each update a range of
+ * it.  Records carry a CRC so a write cut short by a reset is ignored (along with anything
+ * after it).  When the current sector is full, the journal is compacted: the next sector is
+ * erased, a snapshot of the image written to it and only then its header, with a higher
+ * sequence number, making it current.  The sector with the highest sequence number and a
+ * valid header is replayed at boot.  An image of another length (written by an older layout) is
+ * replayed as far as it fits so the caller can migrate it.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef PS_JOURNAL_H
+#define PS_JOURNAL_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+//
+// Constants
+//
+
+// Largest image the journal holds
+#define PS_JOURNAL_MAX_LEN 1024
+
+
+//
+// Typedefs
+//
+typedef struct {
+	bool loaded;                // Image replayed from flash at boot
+	int sector;                 // Current sector (-1 before the first write)
+	uint32_t seq;               // Its sequence number
+	uint32_t used;              // Bytes of it used
+	uint32_t sector_len;
+	uint32_t records;           // Records appended since boot
+	uint32_t compactions;       // Compactions since boot
+	uint32_t failures;          // Failed flash operations since boot
+} ps_journal_stats_t;
+
+
+//
+// PS Journal API
+//
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+bool ps_journal_init(uint16_t image_len);     // False if there is no usable partition
+bool ps_journal_read(uint16_t offset, void* data, uint16_t len);    // False if the journal held no image at boot
+uint16_t ps_journal_stored_len();             // Length of the image held at boot (0 if none)
+void ps_journal_set(uint16_t offset, const void* data, uint16_t len);   // Change the image without writing it
+bool ps_journal_write(uint16_t offset, const void* data, uint16_t len); // Change the image and append the change
+bool ps_journal_snapshot();                   // Write the whole image to a fresh sector
+void ps_journal_get_stats(ps_journal_stats_t* stats);
+#endif
+
+#endif /* PS_JOURNAL_H */
@@ -258,6 +258,27 @@ void time_get_disp_string(tmElements_t te, char* buf)
 }
 
 
+/**
+ * Load buf with the date part of the display string.
+ *
+ *   "DOW MON DAY, YEAR"
+ *
+ * buf must be at least 17 bytes long (to include null termination).
+ */
+void time_get_disp_date_string(tmElements_t te, char* buf)
+{
+	// Validate te to prevent illegal accesses to the constant string buffers
+	if (te.Wday > 7) te.Wday = 0;
+	if (te.Month > 12) te.Month = 0;
+	
+	sprintf(buf,"%s %s %2d, %4d", 
+		day_strings[te.Wday],
+		mon_strings[te.Month],
+		te.Day,
+		te.Year + 1970);
+}
+
+
 /**
  * Load buf with a time & date string for Caller ID
  *
@@ -36,6 +36,7 @@ void time_get(tmElements_t* te);
 bool time_changed(tmElements_t* te, time_t* prev_time);
 int time_delta();
 void time_get_disp_string(tmElements_t te, char* buf);
+void time_get_disp_date_string(tmElements_t te, char* buf);
 void time_get_cid_string(tmElements_t te, char* buf);
 
 #endif /* TIME_UTILITIES_H */
\ No newline at end of file
@@ -0,0 +1,200 @@
+/*
+ * Segmented clock for the main screen idle time display.
+ *
+ * The glyphs for '0' - '9', ':' and ' ' are drawn once with a canvas, on the screen's
+ * background color, into true color images kept in PSRAM.  Digit cells are all as wide
+ * as the widest digit so the clock doesn't shift as the time changes.  Each cell is an
+ * LVGL image object whose source is only changed when its character changes so most
+ * seconds redraw and flush a single digit cell.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "gui_clock.h"
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+
+
+//
+// Constants
+//
+
+// Glyph indices
+#define GLYPH_COLON           10
+#define GLYPH_SPACE           11
+#define NUM_GLYPHS            12
+
+// Cells holding a colon
+#define CELL_IS_COLON(n)      (((n) == 2) || ((n) == 5))
+
+
+
+//
+// Variables
+//
+static const char* TAG = "gui_clock";
+
+static const char* glyph_text[NUM_GLYPHS] = {"0", "1", "2", "3", "4", "5", "6", "7", "8", "9", ":", " "};
+
+static uint8_t* glyph_buf = NULL;
+static lv_img_dsc_t glyph_dsc[NUM_GLYPHS];
+
+static lv_obj_t* cell_img[GUI_CLOCK_NUM_CELLS];
+static lv_coord_t cell_x[GUI_CLOCK_NUM_CELLS];
+static int cell_glyph[GUI_CLOCK_NUM_CELLS];      // Glyph displayed by each cell
+
+static lv_coord_t clock_w = 0;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _gui_clock_set_cell(int n, int glyph);
+
+
+
+//
+// API
+//
+bool gui_clock_create(lv_obj_t* parent, const lv_font_t* font, lv_color_t fg, lv_color_t bg)
+{
+	lv_obj_t* canvas;
+	lv_draw_label_dsc_t label_dsc;
+	lv_coord_t digit_w = 0;
+	lv_coord_t colon_w;
+	lv_coord_t w;
+	lv_coord_t h;
+	size_t len;
+	size_t offset;
+	int i;
+	
+	// Cell dimensions
+	for (i=0; i<10; i++) {
+		w = lv_font_get_glyph_width(font, '0' + i, 0);
+		if (w > digit_w) digit_w = w;
+	}
+	colon_w = lv_font_get_glyph_width(font, ':', 0);
+	h = lv_font_get_line_height(font);
+	
+	len = 0;
+	for (i=0; i<NUM_GLYPHS; i++) {
+		w = (i == GLYPH_COLON) ? colon_w : digit_w;
+		len += LV_CANVAS_BUF_SIZE_TRUE_COLOR(w, h);
+	}
+	glyph_buf = heap_caps_malloc(len, MALLOC_CAP_SPIRAM);
+	if (glyph_buf == NULL) {
+		ESP_LOGE(TAG, "Could not allocate %d bytes for glyphs", (int) len);
+		return false;
+	}
+	
+	// Render the glyphs
+	canvas = lv_canvas_create(parent, NULL);
+	lv_obj_set_hidden(canvas, true);
+	lv_draw_label_dsc_init(&label_dsc);
+	label_dsc.color = fg;
+	label_dsc.font = font;
+	offset = 0;
+	for (i=0; i<NUM_GLYPHS; i++) {
+		w = (i == GLYPH_COLON) ? colon_w : digit_w;
+		memset(&glyph_dsc[i], 0, sizeof(lv_img_dsc_t));
+		glyph_dsc[i].header.always_zero = 0;
+		glyph_dsc[i].header.cf = LV_IMG_CF_TRUE_COLOR;
+		glyph_dsc[i].header.w = w;
+		glyph_dsc[i].header.h = h;
+		glyph_dsc[i].data_size = LV_CANVAS_BUF_SIZE_TRUE_COLOR(w, h);
+		glyph_dsc[i].data = &glyph_buf[offset];
+	
+		lv_canvas_set_buffer(canvas, &glyph_buf[offset], w, h, LV_IMG_CF_TRUE_COLOR);
+		lv_canvas_fill_bg(canvas, bg, LV_OPA_COVER);
+		lv_canvas_draw_text(canvas, 0, 0, w, &label_dsc, glyph_text[i], LV_LABEL_ALIGN_CENTER);
+	
+		offset += glyph_dsc[i].data_size;
+	}
+	lv_obj_del(canvas);
+	
+	// Create the cells, initially blank
+	clock_w = 0;
+	for (i=0; i<GUI_CLOCK_NUM_CELLS; i++) {
+		cell_x[i] = clock_w;
+		clock_w += CELL_IS_COLON(i) ? colon_w : digit_w;
+	
+		cell_img[i] = lv_img_create(parent, NULL);
+		lv_obj_set_hidden(cell_img[i], true);
+		cell_glyph[i] = -1;
+		_gui_clock_set_cell(i, CELL_IS_COLON(i) ? GLYPH_COLON : GLYPH_SPACE);
+	}
+	
+	return true;
+}
+
+
+lv_coord_t gui_clock_get_width()
+{
+	return clock_w;
+}
+
+
+void gui_clock_set_pos(lv_coord_t x, lv_coord_t y)
+{
+	int i;
+	
+	if (glyph_buf == NULL) return;
+	
+	for (i=0; i<GUI_CLOCK_NUM_CELLS; i++) {
+		lv_obj_set_pos(cell_img[i], x + cell_x[i], y);
+	}
+}
+
+
+void gui_clock_set_hidden(bool hidden)
+{
+	int i;
+	
+	if (glyph_buf == NULL) return;
+	
+	for (i=0; i<GUI_CLOCK_NUM_CELLS; i++) {
+		lv_obj_set_hidden(cell_img[i], hidden);
+	}
+}
+
+
+void gui_clock_set_time(int hour, int min, int sec)
+{
+	if (glyph_buf == NULL) return;
+	
+	_gui_clock_set_cell(0, (hour < 10) ? GLYPH_SPACE : hour / 10);
+	_gui_clock_set_cell(1, hour % 10);
+	_gui_clock_set_cell(3, min / 10);
+	_gui_clock_set_cell(4, min % 10);
+	_gui_clock_set_cell(6, sec / 10);
+	_gui_clock_set_cell(7, sec % 10);
+}
+
+
+
+//
+// Internal functions
+//
+static void _gui_clock_set_cell(int n, int glyph)
+{
+	if (cell_glyph[n] != glyph) {
+		lv_img_set_src(cell_img[n], &glyph_dsc[glyph]);
+		cell_glyph[n] = glyph;
+	}
+}
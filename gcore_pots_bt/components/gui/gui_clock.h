@@ -0,0 +1,46 @@
+/*
+ * Segmented clock for the main screen idle time display.  The "HH:MM:SS" time is drawn
+ * as a row of image cells showing glyphs pre-rendered once into RAM so each second only
+ * the cells whose character changed are invalidated and flushed.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef GUI_CLOCK_H_
+#define GUI_CLOCK_H_
+
+#include <stdbool.h>
+#include "lvgl.h"
+
+//
+// Constants
+//
+
+// Cells - "HH:MM:SS" with a leading space for single digit hours
+#define GUI_CLOCK_NUM_CELLS   8
+
+
+
+//
+// API
+//
+bool gui_clock_create(lv_obj_t* parent, const lv_font_t* font, lv_color_t fg, lv_color_t bg);
+lv_coord_t gui_clock_get_width();
+void gui_clock_set_pos(lv_coord_t x, lv_coord_t y);
+void gui_clock_set_hidden(bool hidden);
+void gui_clock_set_time(int hour, int min, int sec);
+
+#endif /* GUI_CLOCK_H_ */
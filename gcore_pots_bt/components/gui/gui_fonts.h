@@ -0,0 +1,48 @@
+/*
+ * GUI fonts.  The screens use the built-in LVGL Montserrat fonts or, when built with
+ * CONFIG_GUI_SUBSET_FONTS, the versions generated by tools/font_subset.py that contain
+ * only the glyphs the GUI draws at each size.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef GUI_FONTS_H_
+#define GUI_FONTS_H_
+
+#include "lvgl.h"
+#include "sdkconfig.h"
+
+//
+// Fonts
+//
+#if (CONFIG_GUI_SUBSET_FONTS == true)
+LV_FONT_DECLARE(gui_font_14)
+LV_FONT_DECLARE(gui_font_20)
+LV_FONT_DECLARE(gui_font_34)
+LV_FONT_DECLARE(gui_font_38)
+
+#define GUI_FONT_14 (&gui_font_14)
+#define GUI_FONT_20 (&gui_font_20)
+#define GUI_FONT_34 (&gui_font_34)
+#define GUI_FONT_38 (&gui_font_38)
+#else
+#define GUI_FONT_14 (&lv_font_montserrat_14)
+#define GUI_FONT_20 (&lv_font_montserrat_20)
+#define GUI_FONT_34 (&lv_font_montserrat_34)
+#define GUI_FONT_38 (&lv_font_montserrat_38)
+#endif
+
+#endif /* GUI_FONTS_H_ */
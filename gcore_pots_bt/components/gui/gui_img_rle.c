@@ -0,0 +1,196 @@
+/*
+ * LVGL image decoder for the run-length encoded true color with alpha images made by
+ * tools/img_rle.py.  Images are identified by LV_IMG_CF_USER_ENCODED_0 in their variable
+ * descriptor.  Each is decoded once into a PSRAM buffer that is kept for the life of the
+ * program (up to GUI_IMG_RLE_CACHE_LEN images, the oldest is replaced after that) and
+ * handed to LVGL as a plain LV_IMG_CF_TRUE_COLOR_ALPHA image.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "gui_img_rle.h"
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const lv_img_dsc_t* src;
+	uint8_t* buf;
+} gui_img_rle_entry_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "gui_img_rle";
+
+static gui_img_rle_entry_t cache[GUI_IMG_RLE_CACHE_LEN];
+static int cache_next = 0;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static lv_res_t _gui_img_rle_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header);
+static lv_res_t _gui_img_rle_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+static void _gui_img_rle_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc);
+static bool _gui_img_rle_decode(const lv_img_dsc_t* img, uint8_t* buf);
+static bool _gui_img_rle_is_ours(const void* src);
+
+
+
+//
+// API
+//
+bool gui_img_rle_init()
+{
+	lv_img_decoder_t* dec;
+	
+	// Our decoder goes ahead of the built-in one
+	dec = lv_img_decoder_create();
+	if (dec == NULL) {
+		ESP_LOGE(TAG, "Could not create decoder");
+		return false;
+	}
+	lv_img_decoder_set_info_cb(dec, _gui_img_rle_info);
+	lv_img_decoder_set_open_cb(dec, _gui_img_rle_open);
+	lv_img_decoder_set_close_cb(dec, _gui_img_rle_close);
+	
+	return true;
+}
+
+
+
+//
+// Internal functions
+//
+static lv_res_t _gui_img_rle_info(lv_img_decoder_t* decoder, const void* src, lv_img_header_t* header)
+{
+	const lv_img_dsc_t* img = (const lv_img_dsc_t*) src;
+	
+	if (!_gui_img_rle_is_ours(src)) return LV_RES_INV;
+	
+	header->w = img->header.w;
+	header->h = img->header.h;
+	header->cf = LV_IMG_CF_TRUE_COLOR_ALPHA;
+	
+	return LV_RES_OK;
+}
+
+
+static lv_res_t _gui_img_rle_open(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	const lv_img_dsc_t* img = (const lv_img_dsc_t*) dsc->src;
+	gui_img_rle_entry_t* e;
+	int i;
+	
+	if (!_gui_img_rle_is_ours(dsc->src)) return LV_RES_INV;
+	
+	// Already decoded
+	for (i=0; i<GUI_IMG_RLE_CACHE_LEN; i++) {
+		if (cache[i].src == img) {
+			dsc->img_data = cache[i].buf;
+			return LV_RES_OK;
+		}
+	}
+	
+	// Take the next slot (its buffer is reused if the new image fits)
+	e = &cache[cache_next];
+	if (++cache_next == GUI_IMG_RLE_CACHE_LEN) cache_next = 0;
+	
+	if (e->src != NULL) {
+		// LVGL's cache may still point to the evicted image's buffer
+		lv_img_cache_invalidate_src(e->src);
+		if ((e->src->header.w * e->src->header.h) < (img->header.w * img->header.h)) {
+			heap_caps_free(e->buf);
+			e->buf = NULL;
+		}
+	}
+	if (e->buf == NULL) {
+		e->buf = heap_caps_malloc(img->header.w * img->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE, MALLOC_CAP_SPIRAM);
+		if (e->buf == NULL) {
+			ESP_LOGE(TAG, "Could not allocate %dx%d image", img->header.w, img->header.h);
+			e->src = NULL;
+			return LV_RES_INV;
+		}
+	}
+	
+	if (!_gui_img_rle_decode(img, e->buf)) {
+		ESP_LOGE(TAG, "Corrupt image data");
+		heap_caps_free(e->buf);
+		e->buf = NULL;
+		e->src = NULL;
+		return LV_RES_INV;
+	}
+	e->src = img;
+	
+	dsc->img_data = e->buf;
+	return LV_RES_OK;
+}
+
+
+static void _gui_img_rle_close(lv_img_decoder_t* decoder, lv_img_decoder_dsc_t* dsc)
+{
+	// Decoded images stay cached
+}
+
+
+static bool _gui_img_rle_decode(const lv_img_dsc_t* img, uint8_t* buf)
+{
+	const uint8_t* sP = img->data;
+	const uint8_t* endP = img->data + img->data_size;
+	uint8_t* dP = buf;
+	uint8_t* dEndP = buf + img->header.w * img->header.h * LV_IMG_PX_SIZE_ALPHA_BYTE;
+	int n;
+	
+	while ((sP < endP) && (dP < dEndP)) {
+		n = (*sP & 0x7F) + 1;
+		if ((dP + n * LV_IMG_PX_SIZE_ALPHA_BYTE) > dEndP) return false;
+		
+		if (*sP++ & 0x80) {
+			// Repeated pixel
+			if ((sP + LV_IMG_PX_SIZE_ALPHA_BYTE) > endP) return false;
+			while (n--) {
+				memcpy(dP, sP, LV_IMG_PX_SIZE_ALPHA_BYTE);
+				dP += LV_IMG_PX_SIZE_ALPHA_BYTE;
+			}
+			sP += LV_IMG_PX_SIZE_ALPHA_BYTE;
+		} else {
+			// Literal pixels
+			n *= LV_IMG_PX_SIZE_ALPHA_BYTE;
+			if ((sP + n) > endP) return false;
+			memcpy(dP, sP, n);
+			dP += n;
+			sP += n;
+		}
+	}
+	
+	return (dP == dEndP);
+}
+
+
+static bool _gui_img_rle_is_ours(const void* src)
+{
+	return ((lv_img_src_get_type(src) == LV_IMG_SRC_VARIABLE) &&
+	        (((const lv_img_dsc_t*) src)->header.cf == LV_IMG_CF_USER_ENCODED_0));
+}
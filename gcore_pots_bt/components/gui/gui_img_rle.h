@@ -0,0 +1,42 @@
+/*
+ * LVGL image decoder for the run-length encoded true color with alpha images made by
+ * tools/img_rle.py.  Decoded images are kept in PSRAM so redraws (e.g. button press
+ * feedback) don't decode again.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef GUI_IMG_RLE_H_
+#define GUI_IMG_RLE_H_
+
+#include <stdbool.h>
+#include "lvgl.h"
+
+//
+// Constants
+//
+
+// Decoded images held (the dial and hangup buttons, pressed and released)
+#define GUI_IMG_RLE_CACHE_LEN 4
+
+
+
+//
+// API
+//
+bool gui_img_rle_init();           // Call after lv_init
+
+#endif /* GUI_IMG_RLE_H_ */
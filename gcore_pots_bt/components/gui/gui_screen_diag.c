@@ -0,0 +1,523 @@
+/*
+ * Diagnostics GUI screen related functions, callbacks and event handlers
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "gui_screen_diag.h"
+#include "gui_fonts.h"
+#include "gui_task.h"
+#include "gui_utilities.h"
+#include "audio_task.h"
+#include "bench.h"
+#include "bt_task.h"
+#include "evt_bus.h"
+#include "gui_mem.h"
+#include "ps.h"
+#include "pwr_mgmt.h"
+#include "pwr_profile.h"
+#include "rot_dial.h"
+#include "sys_common.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include <stdio.h>
+#include <string.h>
+
+
+
+//
+// Diagnostics GUI Screen constants
+//
+
+// Short stage names for display (must match AUDIO_STAGE_* order)
+static const char* stage_names[AUDIO_NUM_STAGES] = {
+	"I2S rd",
+	"DC rst",
+	"LEC",
+	"Resmpl",
+	"RX put",
+	"TX get",
+	"BT cb",
+	"DTMF",
+	"CPD",
+	"Frame",
+	"NS"
+};
+
+// Codec DSP offload profile names (indexed by PS_CODEC_DSP_*)
+static const char* codec_dsp_names[PS_CODEC_DSP_MAX+1] = {"off", "HPF", "HPF+ALC"};
+
+
+
+//
+// Diagnostics GUI Screen variables
+//
+
+// LVGL objects
+static lv_obj_t* screen = NULL;
+static lv_obj_t* btn_bck;
+static lv_obj_t* btn_bck_lbl;
+static lv_obj_t* lbl_screen;
+static lv_obj_t* lbl_stats;
+static lv_obj_t* btn_rst;
+static lv_obj_t* btn_rst_lbl;
+static lv_obj_t* btn_lat;
+static lv_obj_t* btn_lat_lbl;
+static lv_obj_t* btn_log;
+static lv_obj_t* btn_log_lbl;
+static lv_obj_t* btn_bch;
+static lv_obj_t* btn_bch_lbl;
+static lv_obj_t* btn_hpf;
+static lv_obj_t* btn_hpf_lbl;
+static lv_obj_t* btn_dsp;
+static lv_obj_t* btn_dsp_lbl;
+
+// Flattened style of the back button
+static lv_style_t flat_btn_style;
+
+// LVGL timers
+static lv_task_t* update_task = NULL;
+
+// Statistics display string
+static COLD_ATTR char stats_buf[3072];
+
+// Set when a latency measurement couldn't be started
+static bool lat_start_failed = false;
+
+// Benchmark results (valid once bench_run has been run) and set when it couldn't be run
+static bench_result_t bench_result;
+static bool bench_valid = false;
+static bool bench_start_failed = false;
+
+
+
+//
+// Diagnostics GUI Screen internal function forward declarations
+//
+static void _update_stats();
+static void _cb_update_task(lv_task_t* task);
+static void _cb_bck_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_rst_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_lat_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_log_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_bch_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_hpf_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_dsp_btn(lv_obj_t* btn, lv_event_t event);
+
+
+
+//
+// Diagnostics GUI Screen API
+//
+
+/**
+ * Create the diagnostics screen, its graphical objects and link necessary callbacks
+ */
+lv_obj_t* gui_screen_diag_create()
+{
+	// Create screen object
+	screen = lv_obj_create(NULL, NULL);
+	
+	// Create the widgets for this screen
+	//
+	
+	// Back control button
+	btn_bck = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_bck, DIAG_BCK_BTN_LEFT_X, DIAG_BCK_BTN_TOP_Y);
+	lv_obj_set_size(btn_bck, DIAG_BCK_BTN_W, DIAG_BCK_BTN_H);
+	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_bck, LV_BTN_PART_MAIN, &flat_btn_style);
+	lv_obj_set_event_cb(btn_bck, _cb_bck_btn);
+	
+	btn_bck_lbl = lv_label_create(btn_bck, NULL);
+	lv_obj_set_style_local_text_font(btn_bck_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
+	lv_label_set_static_text(btn_bck_lbl, LV_SYMBOL_LEFT);
+	
+	// Screen label
+	lbl_screen = lv_label_create(screen, NULL);
+	lv_label_set_long_mode(lbl_screen, LV_LABEL_LONG_BREAK);
+	lv_label_set_align(lbl_screen, LV_LABEL_ALIGN_CENTER);
+	lv_obj_set_pos(lbl_screen, DIAG_SCR_LBL_LEFT_X, DIAG_SCR_LBL_TOP_Y);
+	lv_obj_set_width(lbl_screen, DIAG_SCR_LBL_W);
+	lv_obj_set_style_local_text_font(lbl_screen, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_20);
+	lv_label_set_static_text(lbl_screen, "Diagnostics");
+	
+	// Statistics text
+	lbl_stats = lv_label_create(screen, NULL);
+	lv_label_set_long_mode(lbl_stats, LV_LABEL_LONG_BREAK);
+	lv_obj_set_pos(lbl_stats, DIAG_STAT_LBL_LEFT_X, DIAG_STAT_LBL_TOP_Y);
+	lv_obj_set_width(lbl_stats, DIAG_STAT_LBL_W);
+	lv_obj_set_style_local_text_font(lbl_stats, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_14);
+	stats_buf[0] = 0;
+	lv_label_set_static_text(lbl_stats, stats_buf);
+	
+	// Reset button
+	btn_rst = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_rst, DIAG_RST_BTN_LEFT_X, DIAG_RST_BTN_TOP_Y);
+	lv_obj_set_size(btn_rst, DIAG_RST_BTN_W, DIAG_RST_BTN_H);
+	lv_obj_set_event_cb(btn_rst, _cb_rst_btn);
+	
+	btn_rst_lbl = lv_label_create(btn_rst, NULL);
+	lv_label_set_static_text(btn_rst_lbl, "Reset");
+	
+	// Echo path button
+	btn_lat = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_lat, DIAG_LAT_BTN_LEFT_X, DIAG_LAT_BTN_TOP_Y);
+	lv_obj_set_size(btn_lat, DIAG_LAT_BTN_W, DIAG_LAT_BTN_H);
+	lv_obj_set_event_cb(btn_lat, _cb_lat_btn);
+	
+	btn_lat_lbl = lv_label_create(btn_lat, NULL);
+	lv_label_set_static_text(btn_lat_lbl, "Echo");
+	
+	// Log button
+	btn_log = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_log, DIAG_LOG_BTN_LEFT_X, DIAG_LOG_BTN_TOP_Y);
+	lv_obj_set_size(btn_log, DIAG_LOG_BTN_W, DIAG_LOG_BTN_H);
+	lv_obj_set_event_cb(btn_log, _cb_log_btn);
+	
+	btn_log_lbl = lv_label_create(btn_log, NULL);
+	lv_label_set_static_text(btn_log_lbl, "Log");
+	
+	// Benchmark button
+	btn_bch = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_bch, DIAG_BCH_BTN_LEFT_X, DIAG_BCH_BTN_TOP_Y);
+	lv_obj_set_size(btn_bch, DIAG_BCH_BTN_W, DIAG_BCH_BTN_H);
+	lv_obj_set_event_cb(btn_bch, _cb_bch_btn);
+	
+	btn_bch_lbl = lv_label_create(btn_bch, NULL);
+	lv_label_set_static_text(btn_bch_lbl, "Bench");
+	
+	// Echo canceller high-pass filter selection button
+	btn_hpf = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_hpf, DIAG_HPF_BTN_LEFT_X, DIAG_HPF_BTN_TOP_Y);
+	lv_obj_set_size(btn_hpf, DIAG_HPF_BTN_W, DIAG_HPF_BTN_H);
+	lv_obj_set_event_cb(btn_hpf, _cb_hpf_btn);
+	
+	btn_hpf_lbl = lv_label_create(btn_hpf, NULL);
+	lv_label_set_static_text(btn_hpf_lbl, "HPF");
+	
+	// Codec DSP button
+	btn_dsp = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_dsp, DIAG_DSP_BTN_LEFT_X, DIAG_DSP_BTN_TOP_Y);
+	lv_obj_set_size(btn_dsp, DIAG_DSP_BTN_W, DIAG_DSP_BTN_H);
+	lv_obj_set_event_cb(btn_dsp, _cb_dsp_btn);
+	
+	btn_dsp_lbl = lv_label_create(btn_dsp, NULL);
+	lv_label_set_static_text(btn_dsp_lbl, "DSP");
+	
+	return screen;
+}
+
+
+/**
+ * Initialize the diagnostics screen's dynamic values when it's being activated
+ */
+void gui_screen_diag_set_active(bool en)
+{
+	if (en) {
+		_update_stats();
+		if (update_task == NULL) {
+			update_task = lv_task_create(_cb_update_task, DIAG_UPDATE_MSEC, LV_TASK_PRIO_LOW, NULL);
+		}
+	} else {
+		if (update_task != NULL) {
+			lv_task_del(update_task);
+			update_task = NULL;
+		}
+	}
+	
+	lv_obj_set_hidden(screen, !en);
+}
+
+
+/**
+ * Delete the screen while it's not displayed to give its objects back to LVGL
+ */
+bool gui_screen_diag_destroy()
+{
+	if (update_task != NULL) {
+		lv_task_del(update_task);
+		update_task = NULL;
+	}
+	if (screen != NULL) {
+		lv_obj_del(screen);
+		screen = NULL;
+	}
+	
+	return true;
+}
+
+
+
+//
+// Diagnostics GUI Screen internal functions
+//
+static void _update_stats()
+{
+	int i;
+	uint32_t avg;
+	audio_stats_t s;
+	bt_at_stats_t as;
+	bt_link_stats_t ls;
+	bt_power_stats_t bps;
+	evt_bus_stats_t es;
+	gui_mem_info_t gm;
+	gui_render_stats_t rs;
+	pwr_mgmt_stats_t ps;
+	pwr_profile_stats_t pp;
+	rot_dial_stats_t ds;
+	uint64_t pm_usec;
+	uint8_t hpf;
+	uint32_t at_sent, at_err, at_to, at_max;
+	char* cP = stats_buf;
+	
+	audio_get_stats(&s);
+	bt_get_link_stats(&ls);
+	bt_get_power_stats(&bps);
+	bt_get_at_stats(&as);
+	pwr_mgmt_get_stats(&ps);
+	pwr_profile_get_stats(&pp);
+	gui_mem_get_info(&gm);
+	gui_get_render_stats(&rs);
+	rot_dial_get_stats(&ds);
+	
+	// Stage times in uSec
+	cP += sprintf(cP, "Stage     n      avg   max  (uSec)\n");
+	for (i=0; i<AUDIO_NUM_STAGES; i++) {
+		avg = (s.stage[i].count == 0) ? 0 : (uint32_t) (s.stage[i].total_cycles / s.stage[i].count);
+		cP += sprintf(cP, "%-7s %7u %5u %5u\n", stage_names[i], s.stage[i].count,
+		              avg / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ,
+		              s.stage[i].max_cycles / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ);
+	}
+	
+	// Buffer statistics
+	cP += sprintf(cP, "\nRX ring  hw %d  ovf %u  unr %u  dfr %u\n", s.rx_high_water, s.rx_overflows, s.rx_underruns, s.rx_deferred_frames);
+	cP += sprintf(cP, "TX ring  hw %d  ovf %u  unr %u\n", s.tx_high_water, s.tx_overflows, s.tx_underruns);
+	cP += sprintf(cP, "TX align hw %d\n", s.tx_align_high_water);
+	cP += sprintf(cP, "Frame %d mS  DMA bufs %d  need %d  batch %u\n", s.frame_msec, s.dma_buf_count,
+	              s.dma_bufs_needed, s.rx_batch_reads);
+	cP += sprintf(cP, "I2S  rx ovf %u  tx unf %u  dma %u\n", s.i2s_rx_overflows, s.i2s_tx_underflows, s.i2s_dma_errors);
+	cP += sprintf(cP, "Deadline miss %u  max gap %u uS\n", s.deadline_misses,
+	              s.max_rx_gap_cycles / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ);
+	cP += sprintf(cP, "JB  tx %d/%u  rx %d/%u  conceal %u\n", s.tx_jb_target, s.tx_jb_adjusts,
+	              s.rx_jb_target, s.rx_jb_adjusts, s.jb_concealments);
+	cP += sprintf(cP, "PLC  gaps %u  samples %u\n", s.plc_events, s.plc_samples);
+	cP += sprintf(cP, "Clip  in %u  out %u  limited %u  shift %d/%u\n", s.rx_clips, s.tx_clips, s.lim_frames,
+	              s.lec_in_shift, s.lec_scale_changes);
+	cP += sprintf(cP, "AGC  %.1f dB  %s  adapted %u\n", s.agc_gain_db10 / 10.0f,
+	              s.agc_speech ? "speech" : "quiet", s.agc_speech_blocks);
+	cP += sprintf(cP, "Answer  %d mS  %s\n", s.answer_msec, s.answer_standby ? "standby" : "stream start");
+	cP += sprintf(cP, "BT   %s %s  pkt %u B  int %u/%u uS  late %u\n",
+	              (ls.profile == BT_LINK_PROFILE_ROBUST) ? "robust" : "low lat", ls.msbc ? "mSBC" : "CVSD",
+	              ls.packet_bytes, ls.avg_interval_usec, ls.max_interval_usec, ls.late_packets);
+	cP += sprintf(cP, "BT   quality %d  rssi %d  missed %u  jitter %u uS\n", ls.quality, ls.rssi_delta,
+	              ls.missed_packets, ls.jitter_usec);
+	cP += sprintf(cP, "BT   sniff %u%% (%u)  wake %u  ans %u/%u mS\n",
+	              ((bps.sniff_msec + bps.active_msec) == 0) ? 0 :
+	              (uint32_t) ((uint64_t) bps.sniff_msec * 100 / (bps.sniff_msec + bps.active_msec)),
+	              bps.sniff_entries, bps.wakes, bps.max_answer_msec, bps.max_sniff_answer_msec);
+	cP += sprintf(cP, "BT   sco req %u  race %u  setup %u/%u mS\n", bps.sco_requests, bps.sco_races,
+	              bps.sco_setup_msec, bps.max_sco_setup_msec);
+	at_sent = at_err = at_to = at_max = 0;
+	for (i=0; i<BT_AT_NUM_CMDS; i++) {
+		at_sent += as.cmd[i].sent;
+		at_err += as.cmd[i].errors;
+		at_to += as.cmd[i].timeouts;
+		if (as.cmd[i].max_msec > at_max) at_max = as.cmd[i].max_msec;
+	}
+	cP += sprintf(cP, "BT   AT %u  err %u  to %u  max %u mS  ovf %u\n", at_sent, at_err, at_to, at_max,
+	              as.overflows);
+	pm_usec = ps.max_usec + ps.low_usec;
+	cP += sprintf(cP, "PM   %d-%d MHz%s  max %u%%  load %u/%u mA\n", ps.min_freq_mhz, ps.max_freq_mhz,
+	              ps.light_sleep ? " sleep" : "", (pm_usec == 0) ? 0 : (uint32_t) (ps.max_usec * 100 / pm_usec),
+	              ps.max_load_ma, ps.low_load_ma);
+	cP += sprintf(cP, "Prof %s  mA/dsp%%  F %u/%d  B %u/%d  S %u/%d\n", pwr_profile_name(pp.profile),
+	              pp.use[PWR_PROFILE_FULL].load_ma, pp.use[PWR_PROFILE_FULL].dsp_load_pct10 / 10,
+	              pp.use[PWR_PROFILE_BALANCED].load_ma, pp.use[PWR_PROFILE_BALANCED].dsp_load_pct10 / 10,
+	              pp.use[PWR_PROFILE_SAVER].load_ma, pp.use[PWR_PROFILE_SAVER].dsp_load_pct10 / 10);
+	cP += sprintf(cP, "GUI  hot %u/%u B  hw %u  fb %u\n", gm.hot_used, gm.hot_len, gm.hot_high_water,
+	              gm.hot_fallbacks);
+	cP += sprintf(cP, "GUI  psram %u/%u B  hw %u  frag %u%%  heap %u\n", gm.psram_used, gm.psram_len,
+	              gm.psram_high_water, gm.psram_frag_pct, gm.heap_allocs);
+	cP += sprintf(cP, "GUI  frame %d mS  render %u/%u/%u mS  defer %u  snap %u\n", rs.frame_msec, rs.last_msec,
+	              rs.avg_msec, rs.max_msec, rs.defer_evals, rs.snapshot_shows);
+	cP += sprintf(cP, "LEC  %s%s  taps %d  bulk delay %d\n", (s.lec_engine == AUDIO_LEC_ENGINE_FDAF) ? "FDAF" : "OSLEC",
+	              s.lec_subband ? " subband" : "", s.lec_taps, s.lec_bulk_delay);
+	cP += sprintf(cP, "LEC  gated %u of %u\n", s.lec_gated_samples, s.lec_samples);
+	hpf = ps_get_lec_hpf();
+	cP += sprintf(cP, "LEC  HPF rx %s tx %s  conv %d mS", (hpf & PS_LEC_HPF_RX) ? "on" : "off",
+	              (hpf & PS_LEC_HPF_TX) ? "on" : "off", s.lec_converge_msec);
+	if (s.lec_converge_calls[hpf] != 0) {
+		cP += sprintf(cP, "  avg %u/%u", s.lec_converge_total_msec[hpf] / s.lec_converge_calls[hpf],
+		              s.lec_converge_calls[hpf]);
+	}
+	cP += sprintf(cP, "\n");
+	if (s.lec_split) {
+		cP += sprintf(cP, "LEC  core 0 bg  ovr %u  max %u uS\n", s.lec_bg_overruns,
+		              s.lec_bg_max_cycles / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ);
+	}
+	cP += sprintf(cP, "LEC  budget %d/%d  shed %u  restored %u  load %d%%\n", s.lec_budget_level,
+	              s.lec_budget_max_level, s.lec_budget_degrades, s.lec_budget_restores, s.frame_load_peak_pct);
+	cP += sprintf(cP, "NS   level %d (%d next call)  EQ %d (%d)\n", s.ns_level, ps_get_ns_level(),
+	              s.eq_profile, ps_get_eq_profile());
+	cP += sprintf(cP, "DSP  codec %s (%s next call)\n", codec_dsp_names[s.codec_dsp],
+	              codec_dsp_names[ps_get_codec_dsp()]);
+	
+	// Rotary dial measurement and the decode thresholds it set
+	cP += sprintf(cP, "Dial %d.%d pps  break %d%%  last %d.%d/%d%%  n %u/%u\n", ds.avg_pps10 / 10, ds.avg_pps10 % 10,
+	              ds.avg_break_pct, ds.last_pps10 / 10, ds.last_pps10 % 10, ds.last_break_pct, ds.measured, ds.digits);
+	cP += sprintf(cP, "Dial thr %d/%d mS %s  max %d/%d mS  rej %u\n", ds.break_msec, ds.make_msec,
+	              ds.tuned ? "tuned" : "default", ds.max_break_msec, ds.max_make_msec, ds.rejected);
+	
+	// Event queues
+	for (i=0; i<EVT_BUS_MAX_QUEUES; i++) {
+		if (evt_bus_get_stats(i, &es)) {
+			cP += sprintf(cP, "EVT %-4s hw %d/%d  drop %u  lat %u/%u uS\n", es.name, es.high_water, es.depth,
+			              es.dropped, es.avg_latency_usec, es.max_latency_usec);
+		}
+	}
+	
+	// Echo path measurement
+	if (lat_start_failed) {
+		cP += sprintf(cP, "Echo  lift handset (no call) first");
+	} else {
+		switch (s.lat_status) {
+			case AUDIO_LAT_RUNNING:
+				cP += sprintf(cP, "Echo  measuring...");
+				break;
+			case AUDIO_LAT_DONE:
+				cP += sprintf(cP, "Echo  delay %d uS  onset %d  ERL %d dB", s.lat_delay_usec, s.lat_onset, s.lat_erl_db);
+				break;
+			case AUDIO_LAT_NO_ECHO:
+				cP += sprintf(cP, "Echo  no clear echo");
+				break;
+			case AUDIO_LAT_ABORTED:
+				cP += sprintf(cP, "Echo  aborted");
+				break;
+			default:
+				cP += sprintf(cP, "Echo  not measured");
+		}
+	}
+	
+	// Benchmark
+	if (bench_start_failed) {
+		cP += sprintf(cP, "\nBench  hang up first");
+	} else if (bench_valid) {
+		cP += sprintf(cP, "\nBench  LEC %u nS  DTMF %u uS  rs %u/%u nS  LCD %u mS", bench_result.lec_ns,
+		              bench_result.dtmf_ns / 1000, bench_result.down2_ns, bench_result.up2_ns,
+		              bench_result.lcd_us / 1000);
+		cP += sprintf(cP, "\nBench  PSRAM %u  flash %u KB/S  I2C %u/%u uS  err %02x", bench_result.psram_kbps,
+		              bench_result.flash_kbps, bench_result.codec_i2c_us, bench_result.gcore_i2c_us,
+		              bench_result.errors);
+	}
+	
+	lv_label_set_static_text(lbl_stats, stats_buf);
+}
+
+
+static void _cb_update_task(lv_task_t* task)
+{
+	_update_stats();
+}
+
+
+static void _cb_bck_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		gui_set_screen(GUI_SCREEN_SETTINGS);
+	}
+}
+
+
+static void _cb_rst_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		audio_reset_stats();
+		evt_bus_reset_stats();
+		lat_start_failed = false;
+		_update_stats();
+	}
+}
+
+
+static void _cb_lat_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		lat_start_failed = !audioStartLatencyTest();
+		_update_stats();
+	}
+}
+
+
+static void _cb_log_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		audio_print_stats();
+	}
+}
+
+
+static void _cb_bch_btn(lv_obj_t* btn, lv_event_t event)
+{
+	audio_load_t load;
+	int64_t t;
+	
+	if (event == LV_EVENT_CLICKED) {
+		// Only run while audio is idle so neither the benchmark nor a call are disturbed
+		audio_get_load(&load);
+		bench_start_failed = load.enabled;
+		if (!bench_start_failed) {
+			bench_run(&bench_result);
+			
+			// Full screen redraw and flush to the display
+			t = esp_timer_get_time();
+			lv_obj_invalidate(screen);
+			lv_refr_now(NULL);
+			bench_result.lcd_us = (uint32_t) (esp_timer_get_time() - t);
+			
+			bench_log(&bench_result);
+			bench_valid = true;
+		}
+		_update_stats();
+	}
+}
+
+
+// Step through the high-pass filter combinations (off, RX, TX, both).  The canceller picks the
+// new setting up at the start of the next call.
+static void _cb_hpf_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		ps_set_lec_hpf((ps_get_lec_hpf() + 1) & (PS_LEC_HPF_RX | PS_LEC_HPF_TX));
+		ps_update_backing_store();
+		_update_stats();
+	}
+}
+
+
+// Step through the codec DSP offload profiles.  Also picked up at the start of the next call.
+static void _cb_dsp_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		ps_set_codec_dsp((ps_get_codec_dsp() + 1) % (PS_CODEC_DSP_MAX + 1));
+		ps_update_backing_store();
+		_update_stats();
+	}
+}
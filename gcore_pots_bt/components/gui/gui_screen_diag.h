@@ -0,0 +1,95 @@
+/*
+ * Diagnostics GUI screen related functions, callbacks and event handlers
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef GUI_SCREEN_DIAG_H_
+#define GUI_SCREEN_DIAG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+
+//
+// Diagnostics GUI Screen Constants
+//
+
+// Statistics update rate
+#define DIAG_UPDATE_MSEC       1000
+
+// Back control
+#define DIAG_BCK_BTN_LEFT_X    10
+#define DIAG_BCK_BTN_TOP_Y     5
+#define DIAG_BCK_BTN_W         50
+#define DIAG_BCK_BTN_H         50
+
+// Screen label (centered)
+#define DIAG_SCR_LBL_LEFT_X    60
+#define DIAG_SCR_LBL_TOP_Y     20
+#define DIAG_SCR_LBL_W         200
+
+// Statistics text
+#define DIAG_STAT_LBL_LEFT_X   10
+#define DIAG_STAT_LBL_TOP_Y    60
+#define DIAG_STAT_LBL_W        300
+
+// Reset Button
+#define DIAG_RST_BTN_LEFT_X    8
+#define DIAG_RST_BTN_TOP_Y     425
+#define DIAG_RST_BTN_W         48
+#define DIAG_RST_BTN_H         40
+
+// Echo path (latency measurement) Button
+#define DIAG_LAT_BTN_LEFT_X    60
+#define DIAG_LAT_BTN_TOP_Y     425
+#define DIAG_LAT_BTN_W         48
+#define DIAG_LAT_BTN_H         40
+
+// Log (console dump) Button
+#define DIAG_LOG_BTN_LEFT_X    112
+#define DIAG_LOG_BTN_TOP_Y     425
+#define DIAG_LOG_BTN_W         48
+#define DIAG_LOG_BTN_H         40
+
+// Benchmark Button
+#define DIAG_BCH_BTN_LEFT_X    164
+#define DIAG_BCH_BTN_TOP_Y     425
+#define DIAG_BCH_BTN_W         48
+#define DIAG_BCH_BTN_H         40
+
+// Echo canceller high-pass filter selection Button
+#define DIAG_HPF_BTN_LEFT_X    216
+#define DIAG_HPF_BTN_TOP_Y     425
+#define DIAG_HPF_BTN_W         48
+#define DIAG_HPF_BTN_H         40
+
+// Codec DSP offload profile selection Button
+#define DIAG_DSP_BTN_LEFT_X    268
+#define DIAG_DSP_BTN_TOP_Y     425
+#define DIAG_DSP_BTN_W         48
+#define DIAG_DSP_BTN_H         40
+
+
+//
+// Diagnostics GUI Screen API
+//
+lv_obj_t* gui_screen_diag_create();
+void gui_screen_diag_set_active(bool en);
+bool gui_screen_diag_destroy();
+
+#endif /* GUI_SCREEN_DIAG_H_ */
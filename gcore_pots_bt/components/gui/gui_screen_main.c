@@ -23,12 +23,17 @@
 #include "gui_screen_main.h"
 #include "app_task.h"
 #include "audio_task.h"
-#include "gcore_task.h"
+#include "bt_task.h"
+#include "evt_bus.h"
+#include "gui_clock.h"
+#include "gui_fonts.h"
 #include "gui_task.h"
+#include "gui_utilities.h"
 #include "pots_task.h"
 #include "power_utilities.h"
 #include "time_utilities.h"
 #include "sys_common.h"
+#include "sys_status.h"
 #include <stdio.h>
 
 
@@ -40,6 +45,11 @@
 // Mute / DND active color
 #define BTN_ACTIVE_COLOR LV_COLOR_RED
 
+// Bluetooth icon colors showing the link quality
+#define BT_GOOD_COLOR    LV_COLOR_BLUE
+#define BT_FAIR_COLOR    LV_COLOR_YELLOW
+#define BT_POOR_COLOR    LV_COLOR_RED
+
 
 
 //
@@ -58,12 +68,17 @@ LV_IMG_DECLARE(phone_hangup_60_60_pressed);
 static lv_obj_t* screen;
 static lv_obj_t* lbl_batt_info;
 static lv_obj_t* lbl_status;
+static lv_obj_t* lbl_date;
 static lv_obj_t* lbl_bt_info;
 static lv_obj_t* lbl_phone_num;
 static lv_obj_t* btn_mute;
 static lv_obj_t* lbl_btn_mute;
 static lv_obj_t* btn_dnd;
 static lv_obj_t* lbl_btn_dnd;
+#if (CONFIG_ANS_MACH_ENABLE == true)
+static lv_obj_t* btn_msgs;
+static lv_obj_t* lbl_btn_msgs;
+#endif
 static lv_obj_t* kbd_dial;
 static lv_obj_t* btn_settings;
 static lv_obj_t* lbl_btn_settings;
@@ -74,6 +89,19 @@ static lv_obj_t* lbl_btn_backspace;
 // Time update task
 static lv_task_t* task_time_update;
 
+// Flattened styles of static widgets, each shared by widgets styled the same way
+static lv_style_t flat_btn_style;         // Mute, DND and messages buttons
+static lv_style_t flat_icon_btn_style;    // Settings and backspace buttons
+static lv_style_t flat_keyp_bg_style;
+static lv_style_t flat_keyp_btn_style;
+
+// Displayed state of the labels updated by other tasks
+static gui_label_view_t vw_batt_info;
+static gui_label_view_t vw_status;
+static gui_label_view_t vw_bt_info;
+static gui_label_view_t vw_phone_num;
+static gui_label_view_t vw_date;
+
 // Dial keypad array
 static const char* keyp_map[] = {"1", "2", "3", "\n",
                                  "4", "5", "6", "\n",
@@ -89,7 +117,7 @@ static const char keyp_vals[] = {'1', '2', '3',
 static bool enable_mute = false;
 static bool enable_dnd = false;
 
-static char phone_num[APP_MAX_DIALED_DIGITS+1];   // Statically allocated phone number buffer
+static COLD_ATTR char phone_num[APP_MAX_DIALED_DIGITS+1];   // Statically allocated phone number buffer
 
 
 //
@@ -97,6 +125,9 @@ static char phone_num[APP_MAX_DIALED_DIGITS+1];   // Statically allocated phone
 //
 static void _cb_mute_btn(lv_obj_t* obj, lv_event_t event);
 static void _cb_dnd_btn(lv_obj_t* obj, lv_event_t event);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+static void _cb_msgs_btn(lv_obj_t* obj, lv_event_t event);
+#endif
 static void _cb_keyp(lv_obj_t* obj, lv_event_t event);
 static void _cb_settings_btn(lv_obj_t* obj, lv_event_t event);
 static void _cb_dial_btn(lv_obj_t* obj, lv_event_t event);
@@ -121,6 +152,7 @@ lv_obj_t* gui_screen_main_create()
 	lbl_batt_info = lv_label_create(screen, NULL);
 	lv_obj_set_pos(lbl_batt_info, MAIN_BATT_LEFT_X, MAIN_BATT_TOP_Y);
 	lv_label_set_static_text(lbl_batt_info, LV_SYMBOL_BATTERY_EMPTY);
+	gui_label_view_init(&vw_batt_info, lbl_batt_info, LV_SYMBOL_BATTERY_EMPTY);
 	
 	// Status label
 	lbl_status = lv_label_create(screen, NULL);
@@ -129,12 +161,26 @@ lv_obj_t* gui_screen_main_create()
 	lv_obj_set_pos(lbl_status, MAIN_STAT_LEFT_X, MAIN_STAT_TOP_Y);
 	lv_obj_set_width(lbl_status, MAIN_STAT_W);
 	lv_label_set_static_text(lbl_status, "No Service");
+	gui_label_view_init(&vw_status, lbl_status, "No Service");
+	
+	// Idle time display - date label and segmented clock replacing the status label,
+	// drawn in the same font and color
+	lbl_date = lv_label_create(screen, NULL);
+	lv_label_set_long_mode(lbl_date, LV_LABEL_LONG_EXPAND);
+	lv_label_set_static_text(lbl_date, "");
+	lv_obj_set_hidden(lbl_date, true);
+	gui_label_view_init(&vw_date, lbl_date, "");
+	(void) gui_clock_create(screen, lv_obj_get_style_text_font(lbl_status, LV_LABEL_PART_MAIN),
+	                        lv_obj_get_style_text_color(lbl_status, LV_LABEL_PART_MAIN),
+	                        lv_obj_get_style_bg_color(screen, LV_OBJ_PART_MAIN));
 	
 	// Bluetooth connection status label
 	lbl_bt_info = lv_label_create(screen, NULL);
 	lv_obj_set_pos(lbl_bt_info, MAIN_BT_LEFT_X, MAIN_BT_TOP_Y);
-	lv_obj_set_style_local_text_color(lbl_bt_info, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_BLUE);
 	lv_label_set_static_text(lbl_bt_info, "");
+	gui_label_view_init(&vw_bt_info, lbl_bt_info, "");
+	gui_label_view_set_color(&vw_bt_info, BT_GOOD_COLOR);
+	(void) gui_label_view_commit(&vw_bt_info);
 	
 	// Phone number display label
 	lbl_phone_num = lv_label_create(screen, NULL);
@@ -142,9 +188,11 @@ lv_obj_t* gui_screen_main_create()
 	lv_label_set_align(lbl_phone_num, LV_LABEL_ALIGN_CENTER);
 	lv_obj_set_pos(lbl_phone_num, MAIN_PH_NUM_LEFT_X, MAIN_PH_NUM_TOP_Y);
 	lv_obj_set_size(lbl_phone_num, MAIN_PH_NUM_W, MAIN_PH_NUM_H);
-	lv_obj_set_style_local_text_font(lbl_phone_num, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_38);
-	lv_obj_set_style_local_text_color(lbl_phone_num, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_CYAN);
+	lv_obj_set_style_local_text_font(lbl_phone_num, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_38);
 	lv_label_set_static_text(lbl_phone_num, "");
+	gui_label_view_init(&vw_phone_num, lbl_phone_num, "");
+	gui_label_view_set_color(&vw_phone_num, LV_COLOR_CYAN);
+	(void) gui_label_view_commit(&vw_phone_num);
 	
 	// Mute button
 	btn_mute = lv_btn_create(screen, NULL);
@@ -154,6 +202,7 @@ lv_obj_t* gui_screen_main_create()
 	lv_obj_set_style_local_border_color(btn_mute, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_mute, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_mute, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_mute, LV_BTN_PART_MAIN, &flat_btn_style);
 	lv_obj_set_event_cb(btn_mute, _cb_mute_btn);
 	
 	lbl_btn_mute = lv_label_create(btn_mute, NULL);
@@ -167,33 +216,53 @@ lv_obj_t* gui_screen_main_create()
 	lv_obj_set_style_local_border_color(btn_dnd, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_dnd, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_dnd, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_dnd, LV_BTN_PART_MAIN, &flat_btn_style);
 	lv_obj_set_event_cb(btn_dnd, _cb_dnd_btn);
 	
 	lbl_btn_dnd = lv_label_create(btn_dnd, NULL);
 	lv_label_set_static_text(lbl_btn_dnd, "Do Not Disturb");
 	
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	// Answering machine messages button
+	btn_msgs = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_msgs, MAIN_MSGS_LEFT_X, MAIN_MSGS_TOP_Y);
+	lv_obj_set_size(btn_msgs, MAIN_MSGS_W, MAIN_MSGS_H);
+	lv_obj_set_style_local_bg_color(btn_msgs, LV_BTN_PART_MAIN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_msgs, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_bg_color(btn_msgs, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_msgs, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_msgs, LV_BTN_PART_MAIN, &flat_btn_style);
+	lv_obj_set_event_cb(btn_msgs, _cb_msgs_btn);
+	
+	lbl_btn_msgs = lv_label_create(btn_msgs, NULL);
+	lv_label_set_static_text(lbl_btn_msgs, LV_SYMBOL_AUDIO);
+#endif
+	
 	// Dialing keypad
 	kbd_dial = lv_btnmatrix_create(screen, NULL);
 	lv_obj_set_pos(kbd_dial, MAIN_KEYP_LEFT_X, MAIN_KEYP_TOP_Y);
 	lv_obj_set_size(kbd_dial, MAIN_KEYP_W, MAIN_KEYP_H);
 	lv_btnmatrix_set_map(kbd_dial, keyp_map);
-	lv_obj_set_style_local_text_font(kbd_dial, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(kbd_dial, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_obj_set_style_local_border_color(kbd_dial, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(kbd_dial, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(kbd_dial, LV_BTNMATRIX_PART_BTN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(kbd_dial, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(kbd_dial, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	gui_style_flatten(kbd_dial, LV_BTNMATRIX_PART_BG, &flat_keyp_bg_style);
+	gui_style_flatten(kbd_dial, LV_BTNMATRIX_PART_BTN, &flat_keyp_btn_style);
 	lv_obj_set_event_cb(kbd_dial, _cb_keyp);
 	
 	// Settings button
 	btn_settings = lv_btn_create(screen, NULL);
 	lv_obj_set_pos(btn_settings, MAIN_SETTINGS_LEFT_X, MAIN_SETTINGS_TOP_Y);
 	lv_obj_set_size(btn_settings, MAIN_SETTINGS_W, MAIN_SETTINGS_H);
-	lv_obj_set_style_local_text_font(btn_settings, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(btn_settings, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_obj_set_style_local_bg_color(btn_settings, LV_BTN_PART_MAIN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_settings, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_settings, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_settings, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_settings, LV_BTN_PART_MAIN, &flat_icon_btn_style);
 	lv_obj_set_event_cb(btn_settings, _cb_settings_btn);
 	
 	lbl_btn_settings = lv_label_create(btn_settings, NULL);
@@ -211,11 +280,12 @@ lv_obj_t* gui_screen_main_create()
 	btn_backspace = lv_btn_create(screen, NULL);
 	lv_obj_set_pos(btn_backspace, MAIN_BCKSP_LEFT_X, MAIN_BCKSP_TOP_Y);
 	lv_obj_set_size(btn_backspace, MAIN_BCKSP_W, MAIN_BCKSP_H);
-	lv_obj_set_style_local_text_font(btn_backspace, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(btn_backspace, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_obj_set_style_local_bg_color(btn_backspace, LV_BTN_PART_MAIN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_backspace, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_backspace, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_backspace, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_backspace, LV_BTN_PART_MAIN, &flat_icon_btn_style);
 	lv_obj_set_event_cb(btn_backspace, _cb_bcksp_btn);
 	
 	lbl_btn_backspace = lv_label_create(btn_backspace, NULL);
@@ -235,17 +305,16 @@ void gui_screen_main_set_active(bool en)
 void gui_screen_main_update_power_state()
 {
 	static char batt_buf[8];    // batt icon (3) + ' ' + charge icon (3) + null
-	enum BATT_STATE_t batt_state;
-	enum CHARGE_STATE_t charge_state;
+	sys_status_power_t ps;
 	static enum BATT_STATE_t prev_batt_state = BATT_0;
 	static enum CHARGE_STATE_t prev_charge_state = CHARGE_OFF;
 	
-	gcore_get_power_state(&batt_state, &charge_state);
+	sys_status_get_power(&ps);
 		
-	if ((batt_state != prev_batt_state) || (charge_state != prev_charge_state)) {
+	if ((ps.batt_state != prev_batt_state) || (ps.charge_state != prev_charge_state)) {
 		memset(batt_buf, 0, sizeof(batt_buf));
 		
-		switch (batt_state) {
+		switch (ps.batt_state) {
 			case BATT_100:
 				strcpy(&batt_buf[0], LV_SYMBOL_BATTERY_FULL);
 				break;
@@ -264,16 +333,16 @@ void gui_screen_main_update_power_state()
 		
 		batt_buf[3] = ' ';
 		
-		if (charge_state == CHARGE_ON) {
+		if (ps.charge_state == CHARGE_ON) {
 			strcpy(&batt_buf[4], LV_SYMBOL_CHARGE);
-		} else if (charge_state == CHARGE_FAULT) {
+		} else if (ps.charge_state == CHARGE_FAULT) {
 			strcpy(&batt_buf[4], LV_SYMBOL_WARNING);
 		}
 		
-		lv_label_set_static_text(lbl_batt_info, batt_buf);
+		gui_label_view_set_text(&vw_batt_info, batt_buf);
 		
-		prev_batt_state = batt_state;
-		prev_charge_state = charge_state;
+		prev_batt_state = (enum BATT_STATE_t) ps.batt_state;
+		prev_charge_state = (enum CHARGE_STATE_t) ps.charge_state;
 	}
 }
 
@@ -288,11 +357,11 @@ void gui_screen_main_update_status()
 	static bool prev_disp_hu_icon = false;
 	static bool prev_disp_time = false;
 	
-	cur_state = app_get_state();
+	cur_state = sys_status_get_app_state();
 	
 	switch (cur_state) {
 		case DISCONNECTED:
-			lv_label_set_static_text(lbl_status, "No Service");
+			gui_label_view_set_text(&vw_status, "No Service");
 			break;
 		case CONNECTED_IDLE:
 			// Display time via LVGL task
@@ -302,42 +371,47 @@ void gui_screen_main_update_status()
 		case CALL_RECEIVED:
 			disp_bt_icon = true;
 			disp_hu_icon = true;
-			lv_label_set_static_text(lbl_status, "Incoming Call");
+			gui_label_view_set_text(&vw_status, "Incoming Call");
 			break;
 		case CALL_WAIT_ACTIVE:
 			disp_bt_icon = true;
 			disp_hu_icon = true;
-			lv_label_set_static_text(lbl_status, "Incoming Call");
+			gui_label_view_set_text(&vw_status, "Incoming Call");
 			break;
 		case DIALING:
 			disp_bt_icon = true;
-			lv_label_set_static_text(lbl_status, "Dial Number");
+			gui_label_view_set_text(&vw_status, "Dial Number");
 			break;
 		case CALL_INITIATED:
 			disp_bt_icon = true;
 			disp_hu_icon = true;
-			lv_label_set_static_text(lbl_status, "Calling...");
+			gui_label_view_set_text(&vw_status, "Calling...");
 			break;
 		case CALL_ACTIVE:
 		case CALL_ACTIVE_VOICE:
 			disp_bt_icon = true;
 			disp_hu_icon = true;
-			lv_label_set_static_text(lbl_status, "Call in Progress");
+			gui_label_view_set_text(&vw_status, "Call in Progress");
 			break;
 		case CALL_WAIT_END:
 			disp_bt_icon = true;
 			disp_hu_icon = true;
-			lv_label_set_static_text(lbl_status, "Call Ending...");
+			gui_label_view_set_text(&vw_status, "Call Ending...");
 			break;
 		case CALL_WAIT_ONHOOK:
 			disp_bt_icon = true;
 			disp_hu_icon = true;
-			lv_label_set_static_text(lbl_status, "Call Ended");
+			gui_label_view_set_text(&vw_status, "Call Ended");
+			break;
+		case CALL_ANS_MACH:
+			disp_bt_icon = true;
+			disp_hu_icon = true;
+			gui_label_view_set_text(&vw_status, "Taking Message");
 			break;
 	}
 	
 	if (disp_bt_icon != prev_disp_bt_icon) {
-		lv_label_set_static_text(lbl_bt_info, disp_bt_icon ? LV_SYMBOL_BLUETOOTH : "");
+		gui_label_view_set_text(&vw_bt_info, disp_bt_icon ? LV_SYMBOL_BLUETOOTH : "");
 		prev_disp_bt_icon = disp_bt_icon;
 	}
 	
@@ -363,14 +437,10 @@ void gui_screen_main_update_ph_num()
 {
 	int n;
 	
-	n = app_get_dial_number(phone_num);
+	n = sys_status_get_dial_num(phone_num);
 	
-	lv_obj_set_style_local_text_color(lbl_phone_num, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_CYAN);
-	if (n == 0) {
-		lv_label_set_static_text(lbl_phone_num, "");
-	} else {
-		lv_label_set_static_text(lbl_phone_num, phone_num);
-	}
+	gui_label_view_set_color(&vw_phone_num, LV_COLOR_CYAN);
+	gui_label_view_set_text(&vw_phone_num, (n == 0) ? "" : phone_num);
 }
 
 
@@ -378,17 +448,55 @@ void gui_screen_main_update_cid_num()
 {
 	int n;
 	
-	n = app_get_cid_number(phone_num);
+	n = sys_status_get_cid_num(phone_num, false);
 	
-	lv_obj_set_style_local_text_color(lbl_phone_num, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_YELLOW);
-	if (n == 0) {
-		lv_label_set_static_text(lbl_phone_num, UNKNOWN_CID_STRING);
-	} else {
-		lv_label_set_static_text(lbl_phone_num, phone_num);
+	gui_label_view_set_color(&vw_phone_num, LV_COLOR_YELLOW);
+	gui_label_view_set_text(&vw_phone_num, (n == 0) ? UNKNOWN_CID_STRING : phone_num);
+}
+
+
+
+void gui_screen_main_update_link_quality()
+{
+	bt_link_stats_t ls;
+	lv_color_t c;
+	
+	bt_get_link_stats(&ls);
+	
+	switch (ls.quality) {
+		case BT_LINK_QUALITY_POOR:
+			c = BT_POOR_COLOR;
+			break;
+		case BT_LINK_QUALITY_FAIR:
+			c = BT_FAIR_COLOR;
+			break;
+		default:
+			c = BT_GOOD_COLOR;
 	}
+	gui_label_view_set_color(&vw_bt_info, c);
+}
+
+
+void gui_screen_main_commit()
+{
+	// Apply the changes staged by this pass of notifications in one go
+	(void) gui_label_view_commit(&vw_batt_info);
+	(void) gui_label_view_commit(&vw_status);
+	(void) gui_label_view_commit(&vw_bt_info);
+	(void) gui_label_view_commit(&vw_phone_num);
 }
 
 
+bool gui_screen_main_get_clock_rows(lv_coord_t* y1, lv_coord_t* y2)
+{
+	if (task_time_update == NULL) return false;
+	
+	// The date and clock are drawn on the status label's line
+	*y1 = MAIN_STAT_TOP_Y;
+	*y2 = MAIN_STAT_TOP_Y + lv_obj_get_height(lbl_status) - 1;
+	return true;
+}
+
 
 //
 // Internal functions
@@ -423,6 +531,16 @@ static void _cb_dnd_btn(lv_obj_t* obj, lv_event_t event)
 }
 
 
+#if (CONFIG_ANS_MACH_ENABLE == true)
+static void _cb_msgs_btn(lv_obj_t* obj, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		gui_set_screen(GUI_SCREEN_MSGS);
+	}
+}
+#endif
+
+
 static void _cb_keyp(lv_obj_t* obj, lv_event_t event)
 {
 	uint16_t n;
@@ -431,8 +549,7 @@ static void _cb_keyp(lv_obj_t* obj, lv_event_t event)
 		n = lv_btnmatrix_get_active_btn(obj);
 		
 		if (n != LV_BTNMATRIX_BTN_NONE) {
-			app_set_gui_digit(keyp_vals[n]);
-			xTaskNotify(task_handle_app, APP_NOTIFY_GUI_DIGIT_DIALED_MASK, eSetBits);
+			evt_bus_send_digit(EVT_QUEUE_APP, APP_EVT_GUI_DIGIT_DIALED, keyp_vals[n]);
 		}
 	}
 }
@@ -449,7 +566,7 @@ static void _cb_settings_btn(lv_obj_t* obj, lv_event_t event)
 static void _cb_dial_btn(lv_obj_t* obj, lv_event_t event)
 {
 	if (event == LV_EVENT_CLICKED) {
-		xTaskNotify(task_handle_app, APP_NOTIFY_GUI_DIAL_BTN_PRESSED_MASK, eSetBits);
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_GUI_DIAL_BTN_PRESSED);
 	}
 }
 
@@ -457,7 +574,7 @@ static void _cb_dial_btn(lv_obj_t* obj, lv_event_t event)
 static void _cb_bcksp_btn(lv_obj_t* obj, lv_event_t event)
 {
 	if (event == LV_EVENT_CLICKED) {
-		xTaskNotify(task_handle_app, APP_NOTIFY_GUI_DIGIT_DELETED_MASK, eSetBits);
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_GUI_DIGIT_DELETED);
 	}
 }
 
@@ -467,6 +584,7 @@ static void _set_time_display(bool en)
 	if (en) {
 		if (task_time_update == NULL) {
 			task_time_update = lv_task_create(_update_time_display, 1000, LV_TASK_PRIO_LOW, NULL);
+			_update_time_display(NULL);
 		}
 	} else {
 		if (task_time_update != NULL) {
@@ -474,16 +592,33 @@ static void _set_time_display(bool en)
 			task_time_update = NULL;
 		}
 	}
+	
+	lv_obj_set_hidden(lbl_status, en);
+	lv_obj_set_hidden(lbl_date, !en);
+	gui_clock_set_hidden(!en);
 }
 
 
 static void _update_time_display(lv_task_t* task)
 {
-	static char time_buf[26];    // Statically allocated for lv_label_set_static_text
-	                             //  and big enough for time from time_get_disp_string
+	static char date_buf[17];    // Statically allocated for lv_label_set_static_text
+	                             //  and big enough for time_get_disp_date_string
 	tmElements_t tm;
+	lv_coord_t date_w;
+	lv_coord_t x;
 	
 	time_get(&tm);
-	time_get_disp_string(tm, time_buf);
-	lv_label_set_static_text(lbl_status, time_buf);
+	time_get_disp_date_string(tm, date_buf);
+	
+	// The date changes once a day, re-centering the date and clock
+	gui_label_view_set_text(&vw_date, date_buf);
+	if (gui_label_view_commit(&vw_date)) {
+		date_w = lv_obj_get_width(lbl_date);
+		x = MAIN_STAT_LEFT_X + (MAIN_STAT_W - date_w - MAIN_CLOCK_GAP - gui_clock_get_width()) / 2;
+		lv_obj_set_pos(lbl_date, x, MAIN_STAT_TOP_Y);
+		gui_clock_set_pos(x + date_w + MAIN_CLOCK_GAP, MAIN_STAT_TOP_Y);
+	}
+	
+	// Only changed digit cells are redrawn
+	gui_clock_set_time(tm.Hour, tm.Minute, tm.Second);
 }
@@ -38,6 +38,9 @@
 #define MAIN_STAT_TOP_Y      10
 #define MAIN_STAT_W          260
 
+// Gap between the date and clock in the idle time display
+#define MAIN_CLOCK_GAP       6
+
 // Bluetooth connection status label
 #define MAIN_BT_LEFT_X       285
 #define MAIN_BT_TOP_Y        10
@@ -54,6 +57,12 @@
 #define MAIN_MUTE_W          80
 #define MAIN_MUTE_H          40
 
+// Answering machine messages button (CONFIG_ANS_MACH_ENABLE)
+#define MAIN_MSGS_LEFT_X     100
+#define MAIN_MSGS_TOP_Y      90
+#define MAIN_MSGS_W          50
+#define MAIN_MSGS_H          40
+
 // Do Not Disturb button
 #define MAIN_DND_LEFT_X      160
 #define MAIN_DND_TOP_Y       90
@@ -96,5 +105,8 @@ void gui_screen_main_update_power_state();
 void gui_screen_main_update_status();
 void gui_screen_main_update_ph_num();
 void gui_screen_main_update_cid_num();
+void gui_screen_main_update_link_quality();
+void gui_screen_main_commit();
+bool gui_screen_main_get_clock_rows(lv_coord_t* y1, lv_coord_t* y2);   // False if the clock isn't shown
 
 #endif /* GUI_SCREEN_MAIN_H_ */
\ No newline at end of file
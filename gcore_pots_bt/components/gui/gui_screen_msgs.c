@@ -0,0 +1,310 @@
+/*
+ * Answering machine messages GUI screen related functions, callbacks and event handlers
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "gui_screen_msgs.h"
+#include "ans_mach.h"
+#include "app_task.h"
+#include "gui_fonts.h"
+#include "gui_task.h"
+#include "gui_utilities.h"
+#include "pots_task.h"
+#include "rtc.h"
+#include "sys_common.h"
+#include "sys_status.h"
+#include <stdio.h>
+#include <string.h>
+
+
+
+//
+// Messages GUI Screen variables
+//
+
+// LVGL objects
+static lv_obj_t* screen = NULL;
+static lv_obj_t* btn_bck;
+static lv_obj_t* btn_bck_lbl;
+static lv_obj_t* lbl_screen;
+static lv_obj_t* roller_msgs;
+static lv_obj_t* btn_play;
+static lv_obj_t* btn_play_lbl;
+static lv_obj_t* btn_stop;
+static lv_obj_t* btn_stop_lbl;
+static lv_obj_t* btn_del;
+static lv_obj_t* btn_del_lbl;
+
+// Flattened style of the back button
+static lv_style_t flat_btn_style;
+
+// LVGL timers
+static lv_task_t* update_task = NULL;
+
+#if (CONFIG_ANS_MACH_ENABLE == true)
+// Displayed messages (newest first) and the list version they came from
+static int msg_count;
+static uint32_t msg_id[ANS_MACH_MAX_MSGS];
+static uint32_t msg_list_seq;
+
+// Roller options - one line per message: number, date and length
+static COLD_ATTR char list_buf[ANS_MACH_MAX_MSGS * (ANS_MACH_NUMBER_LEN + 24)];
+#endif
+
+
+
+//
+// Messages GUI Screen internal function forward declarations
+//
+static void _update_list(bool force);
+static void _cb_update_task(lv_task_t* task);
+static void _cb_bck_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_play_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_stop_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_del_btn(lv_obj_t* btn, lv_event_t event);
+
+
+
+//
+// Messages GUI Screen API
+//
+
+/**
+ * Create the messages screen, its graphical objects and link necessary callbacks
+ */
+lv_obj_t* gui_screen_msgs_create()
+{
+	// Create screen object
+	screen = lv_obj_create(NULL, NULL);
+	
+	// Create the widgets for this screen
+	//
+	
+	// Back control button
+	btn_bck = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_bck, MSGS_BCK_BTN_LEFT_X, MSGS_BCK_BTN_TOP_Y);
+	lv_obj_set_size(btn_bck, MSGS_BCK_BTN_W, MSGS_BCK_BTN_H);
+	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_bck, LV_BTN_PART_MAIN, &flat_btn_style);
+	lv_obj_set_event_cb(btn_bck, _cb_bck_btn);
+	
+	btn_bck_lbl = lv_label_create(btn_bck, NULL);
+	lv_obj_set_style_local_text_font(btn_bck_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
+	lv_label_set_static_text(btn_bck_lbl, LV_SYMBOL_LEFT);
+	
+	// Screen label
+	lbl_screen = lv_label_create(screen, NULL);
+	lv_label_set_long_mode(lbl_screen, LV_LABEL_LONG_BREAK);
+	lv_label_set_align(lbl_screen, LV_LABEL_ALIGN_CENTER);
+	lv_obj_set_pos(lbl_screen, MSGS_SCR_LBL_LEFT_X, MSGS_SCR_LBL_TOP_Y);
+	lv_obj_set_width(lbl_screen, MSGS_SCR_LBL_W);
+	lv_obj_set_style_local_text_font(lbl_screen, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_20);
+	lv_label_set_static_text(lbl_screen, "Messages");
+	
+	// Message list
+	roller_msgs = lv_roller_create(screen, NULL);
+	lv_roller_set_options(roller_msgs, "No Messages", LV_ROLLER_MODE_NORMAL);
+	lv_roller_set_visible_row_count(roller_msgs, MSGS_LIST_ROWS);
+	lv_roller_set_auto_fit(roller_msgs, false);
+	lv_obj_set_width(roller_msgs, MSGS_LIST_W);
+	lv_obj_set_pos(roller_msgs, MSGS_LIST_LEFT_X, MSGS_LIST_TOP_Y);
+	lv_obj_set_style_local_text_font(roller_msgs, LV_ROLLER_PART_BG, LV_STATE_DEFAULT, GUI_FONT_14);
+	lv_obj_set_style_local_text_font(roller_msgs, LV_ROLLER_PART_SELECTED, LV_STATE_DEFAULT, GUI_FONT_14);
+	
+	// Play button
+	btn_play = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_play, MSGS_PLAY_BTN_LEFT_X, MSGS_BTN_TOP_Y);
+	lv_obj_set_size(btn_play, MSGS_BTN_W, MSGS_BTN_H);
+	lv_obj_set_event_cb(btn_play, _cb_play_btn);
+	
+	btn_play_lbl = lv_label_create(btn_play, NULL);
+	lv_label_set_static_text(btn_play_lbl, LV_SYMBOL_PLAY);
+	
+	// Stop button
+	btn_stop = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_stop, MSGS_STOP_BTN_LEFT_X, MSGS_BTN_TOP_Y);
+	lv_obj_set_size(btn_stop, MSGS_BTN_W, MSGS_BTN_H);
+	lv_obj_set_event_cb(btn_stop, _cb_stop_btn);
+	
+	btn_stop_lbl = lv_label_create(btn_stop, NULL);
+	lv_label_set_static_text(btn_stop_lbl, LV_SYMBOL_STOP);
+	
+	// Delete button
+	btn_del = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_del, MSGS_DEL_BTN_LEFT_X, MSGS_BTN_TOP_Y);
+	lv_obj_set_size(btn_del, MSGS_BTN_W, MSGS_BTN_H);
+	lv_obj_set_event_cb(btn_del, _cb_del_btn);
+	
+	btn_del_lbl = lv_label_create(btn_del, NULL);
+	lv_label_set_static_text(btn_del_lbl, LV_SYMBOL_TRASH);
+	
+	return screen;
+}
+
+
+/**
+ * Initialize the messages screen's dynamic values when it's being activated
+ */
+void gui_screen_msgs_set_active(bool en)
+{
+	if (en) {
+		_update_list(true);
+		if (update_task == NULL) {
+			update_task = lv_task_create(_cb_update_task, MSGS_UPDATE_MSEC, LV_TASK_PRIO_LOW, NULL);
+		}
+	} else {
+		if (update_task != NULL) {
+			lv_task_del(update_task);
+			update_task = NULL;
+		}
+	}
+	
+	lv_obj_set_hidden(screen, !en);
+}
+
+
+/**
+ * Delete the screen while it's not displayed to give its objects back to LVGL
+ */
+bool gui_screen_msgs_destroy()
+{
+	if (update_task != NULL) {
+		lv_task_del(update_task);
+		update_task = NULL;
+	}
+	if (screen != NULL) {
+		lv_obj_del(screen);
+		screen = NULL;
+	}
+	
+	return true;
+}
+
+
+
+//
+// Messages GUI Screen internal functions
+//
+
+// Rebuild the roller when the message list has changed, keeping the selected message if
+// it is still there
+static void _update_list(bool force)
+{
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	int i;
+	uint16_t sel;
+	uint32_t sel_id;
+	uint32_t seq;
+	char* cP = list_buf;
+	ans_mach_msg_t msg;
+	tmElements_t te;
+	
+	seq = ans_mach_get_list_seq();
+	if (!force && (seq == msg_list_seq)) return;
+	msg_list_seq = seq;
+	
+	sel = lv_roller_get_selected(roller_msgs);
+	sel_id = (sel < msg_count) ? msg_id[sel] : 0;
+	
+	msg_count = 0;
+	list_buf[0] = 0;
+	for (i=0; i<ans_mach_get_msg_count(); i++) {
+		if (!ans_mach_get_msg(i, &msg)) break;
+		
+		rtc_breakTime((time_t) msg.start, &te);
+		if (msg_count != 0) *cP++ = '\n';
+		cP += sprintf(cP, "%-16s %2d/%02d %2d:%02d %3u s", (msg.number[0] != 0) ? msg.number : "Unknown",
+		              te.Month, te.Day, te.Hour, te.Minute, msg.samples / 8000);
+		msg_id[msg_count++] = msg.id;
+	}
+	
+	if (msg_count == 0) {
+		lv_roller_set_options(roller_msgs, "No Messages", LV_ROLLER_MODE_NORMAL);
+	} else {
+		lv_roller_set_options(roller_msgs, list_buf, LV_ROLLER_MODE_NORMAL);
+		for (i=0; i<msg_count; i++) {
+			if (msg_id[i] == sel_id) {
+				lv_roller_set_selected(roller_msgs, (uint16_t) i, LV_ANIM_OFF);
+				break;
+			}
+		}
+	}
+#endif
+}
+
+
+static void _cb_update_task(lv_task_t* task)
+{
+	_update_list(false);
+}
+
+
+static void _cb_bck_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		gui_set_screen(GUI_SCREEN_MAIN);
+	}
+}
+
+
+static void _cb_play_btn(lv_obj_t* btn, lv_event_t event)
+{
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	uint16_t sel;
+	
+	if (event == LV_EVENT_CLICKED) {
+		sel = lv_roller_get_selected(roller_msgs);
+		if (sel >= msg_count) return;
+	
+		// Messages play through the handset while it's waiting for a number to be dialed
+		if (sys_status_get_app_state() != DIALING) {
+			gui_preset_message_box_string("Lift the handset to play a message", false, GUI_MSGBOX_MSG_PLAY);
+			xTaskNotify(task_handle_gui, GUI_NOTIFY_MESSAGEBOX_MASK, eSetBits);
+		} else if (ans_mach_play_msg(msg_id[sel])) {
+			xTaskNotify(task_handle_pots, POTS_NOTIFY_MSG_PLAY_MASK, eSetBits);
+		}
+	}
+#endif
+}
+
+
+static void _cb_stop_btn(lv_obj_t* btn, lv_event_t event)
+{
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	if (event == LV_EVENT_CLICKED) {
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_MSG_STOP_MASK, eSetBits);
+	}
+#endif
+}
+
+
+static void _cb_del_btn(lv_obj_t* btn, lv_event_t event)
+{
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	uint16_t sel;
+	
+	if (event == LV_EVENT_CLICKED) {
+		sel = lv_roller_get_selected(roller_msgs);
+		if (sel < msg_count) {
+			ans_mach_delete_msg(msg_id[sel]);
+		}
+	}
+#endif
+}
@@ -0,0 +1,68 @@
+/*
+ * Answering machine messages GUI screen related functions, callbacks and event handlers
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef GUI_SCREEN_MSGS_H_
+#define GUI_SCREEN_MSGS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+
+//
+// Messages GUI Screen Constants
+//
+
+// Message list check rate (it is only rebuilt when the answering machine says it changed)
+#define MSGS_UPDATE_MSEC       1000
+
+// Back control
+#define MSGS_BCK_BTN_LEFT_X    10
+#define MSGS_BCK_BTN_TOP_Y     5
+#define MSGS_BCK_BTN_W         50
+#define MSGS_BCK_BTN_H         50
+
+// Screen label (centered)
+#define MSGS_SCR_LBL_LEFT_X    60
+#define MSGS_SCR_LBL_TOP_Y     20
+#define MSGS_SCR_LBL_W         200
+
+// Message list
+#define MSGS_LIST_LEFT_X       10
+#define MSGS_LIST_TOP_Y        70
+#define MSGS_LIST_W            300
+#define MSGS_LIST_ROWS         8
+
+// Play, Stop and Delete Buttons
+#define MSGS_PLAY_BTN_LEFT_X   10
+#define MSGS_STOP_BTN_LEFT_X   115
+#define MSGS_DEL_BTN_LEFT_X    220
+#define MSGS_BTN_TOP_Y         425
+#define MSGS_BTN_W             90
+#define MSGS_BTN_H             40
+
+
+//
+// Messages GUI Screen API
+//
+lv_obj_t* gui_screen_msgs_create();
+void gui_screen_msgs_set_active(bool en);
+bool gui_screen_msgs_destroy();
+
+#endif /* GUI_SCREEN_MSGS_H_ */
@@ -28,6 +28,8 @@
 #include "app_task.h"
 #include "bt_task.h"
 #include "gcore_task.h"
+#include "evt_bus.h"
+#include "gui_fonts.h"
 #include "gui_task.h"
 #include "pots_task.h"
 #include "gain.h"
@@ -38,6 +40,7 @@
 #include "sys_common.h"
 #include <math.h>
 #include <stdio.h>
+#include <string.h>
 
 
 
@@ -53,7 +56,7 @@
 static const char* TAG = "gui_screen_settings";
 
 // LVGL widget objects
-static lv_obj_t* screen;
+static lv_obj_t* screen = NULL;         // NULL until first displayed and after teardown
 static lv_obj_t* btn_bck;
 static lv_obj_t* btn_bck_lbl;
 static lv_obj_t* lbl_screen;
@@ -62,12 +65,18 @@ static lv_obj_t* lbl_bt;
 static lv_obj_t* btn_bt;
 static lv_obj_t* btn_bt_lbl;
 static lv_obj_t* lbl_bt_status;
+
+// Displayed state of the pairing labels
+static gui_label_view_t vw_btn_bt;
+static gui_label_view_t vw_bt_status;
 static lv_obj_t* lbl_bl;
 static lv_obj_t* sld_bl;
 static lv_obj_t* lbl_ad;
 static lv_obj_t* sw_ad;
 static lv_obj_t* lbl_cn;
 static lv_obj_t* dd_cn;
+static lv_obj_t* lbl_eq;
+static lv_obj_t* dd_eq;
 static lv_obj_t* lbl_mic;
 static lv_obj_t* sld_mic;
 static lv_obj_t* lbl_spk;
@@ -76,6 +85,9 @@ static lv_obj_t* lbl_time;
 static lv_obj_t* btn_time;
 static lv_obj_t* btn_time_lbl;
 
+// Flattened style of the back, pair and set time buttons
+static lv_style_t flat_btn_style;
+
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
 static lv_obj_t* btn_smpl;
 static lv_obj_t* btn_smpl_lbl;
@@ -85,13 +97,14 @@ static lv_obj_t* btn_smpl_lbl;
 static lv_task_t* pair_timer_task;
 
 // Screen state
-static bool screen_is_active;
+static bool screen_is_active = false;
 static bool cur_is_paired;
 static bool cur_auto_dim;
 static bool pairing_in_process = false;
-static char cur_paired_name[ESP_BT_GAP_MAX_BDNAME_LEN+1];
+static COLD_ATTR char cur_paired_name[PS_BT_MAX_PAIRS*(ESP_BT_GAP_MAX_BDNAME_LEN+3)];   // "name1 + name2"
 static uint8_t cur_brightness;
 static uint8_t cur_country_code;
+static uint8_t cur_eq_profile;
 static float cur_mic_gain;
 static float cur_spk_gain;
 // Note about gain and gain sliders: Since gain is a floating point number but with a fairly restricted range,
@@ -104,6 +117,9 @@ static bool update_ps_ram = false;    // Set when any PS value is changed so we
 // Country List array for drop down
 static char* country_list = NULL;
 
+// Handset equalizer profiles in PS_EQ_PROFILE_* order
+static const char* eq_profile_list = "Flat\nCarbon Mic\nElectret Mic";
+
 
 //
 // Forward declarations for internal functions
@@ -111,15 +127,19 @@ static char* country_list = NULL;
 static void _get_country_list();
 static int16_t _gain_to_sld_int(int gain_type, float g);
 static void _cb_bck_btn(lv_obj_t* obj, lv_event_t event);
+static void _cb_ver_lbl(lv_obj_t* obj, lv_event_t event);
+static void _cb_scr_lbl(lv_obj_t* obj, lv_event_t event);
 static void _cb_bt_btn(lv_obj_t* obj, lv_event_t event);
 static void _cb_bl_sld(lv_obj_t* obj, lv_event_t event);
 static void _sw_ad_cb(lv_obj_t* obj, lv_event_t event);
 static void _cb_cn_dd(lv_obj_t* obj, lv_event_t event);
+static void _cb_eq_dd(lv_obj_t* obj, lv_event_t event);
 static void _cb_gain_sld(lv_obj_t* obj, lv_event_t event);
 static void _cb_set_time(lv_obj_t* obj, lv_event_t event);
 static void _cb_pair_timer_task(lv_task_t* task);
 static void _start_pairing();
 static void _stop_pairing();
+static void _update_pair_status();
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
 static void _cb_smpl_btn(lv_obj_t* obj, lv_event_t event);
 #endif
@@ -146,10 +166,11 @@ lv_obj_t* gui_screen_settings_create()
 	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_bck, LV_BTN_PART_MAIN, &flat_btn_style);
 	lv_obj_set_event_cb(btn_bck, _cb_bck_btn);
 	
 	btn_bck_lbl = lv_label_create(btn_bck, NULL);
-	lv_obj_set_style_local_text_font(btn_bck_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(btn_bck_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_label_set_static_text(btn_bck_lbl, LV_SYMBOL_LEFT);
 	
 	// Screen label
@@ -158,8 +179,10 @@ lv_obj_t* gui_screen_settings_create()
 	lv_label_set_align(lbl_screen, LV_LABEL_ALIGN_CENTER);
 	lv_obj_set_pos(lbl_screen, SETTINGS_SCR_LBL_LEFT_X, SETTINGS_SCR_LBL_TOP_Y);
 	lv_obj_set_width(lbl_screen, SETTINGS_SCR_LBL_W);
-	lv_obj_set_style_local_text_font(lbl_screen, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_20);
+	lv_obj_set_style_local_text_font(lbl_screen, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_20);
 	lv_label_set_static_text(lbl_screen, "Settings");
+	lv_obj_set_click(lbl_screen, true);
+	lv_obj_set_event_cb(lbl_screen, _cb_scr_lbl);
 		
 	// Version label
 	lbl_ver = lv_label_create(screen, NULL);
@@ -170,6 +193,8 @@ lv_obj_t* gui_screen_settings_create()
 	app_desc = esp_ota_get_app_description();
 	sprintf(ver_buf, "v%s", app_desc->version);
 	lv_label_set_static_text(lbl_ver, ver_buf);
+	lv_obj_set_click(lbl_ver, true);
+	lv_obj_set_event_cb(lbl_ver, _cb_ver_lbl);
 	
 	// Bluetooth controls label
 	lbl_bt = lv_label_create(screen, NULL);
@@ -184,16 +209,19 @@ lv_obj_t* gui_screen_settings_create()
 	lv_obj_set_style_local_border_color(btn_bt, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_bt, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_bt, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_bt, LV_BTN_PART_MAIN, &flat_btn_style);
 	lv_obj_set_event_cb(btn_bt, _cb_bt_btn);
 	
 	btn_bt_lbl = lv_label_create(btn_bt, NULL);
 	lv_label_set_static_text(btn_bt_lbl, "Pair");
+	gui_label_view_init(&vw_btn_bt, btn_bt_lbl, "Pair");
 	
 	// Bluetooth pair status
 	lbl_bt_status = lv_label_create(screen, NULL);
 	lv_obj_set_pos(lbl_bt_status, SETTINGS_BT_STAT_LEFT_X, SETTINGS_BT_STAT_TOP_Y);
-	lv_obj_set_style_local_text_font(lbl_bt_status, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_14);
+	lv_obj_set_style_local_text_font(lbl_bt_status, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_14);
 	lv_label_set_static_text(lbl_bt_status, "");
+	gui_label_view_init(&vw_bt_status, lbl_bt_status, "");
 	
 	// Backlight dimmer control label
 	lbl_bl = lv_label_create(screen, NULL);
@@ -237,6 +265,19 @@ lv_obj_t* gui_screen_settings_create()
 	lv_obj_set_style_local_bg_color(dd_cn, LV_DROPDOWN_PART_SELECTED, LV_STATE_DEFAULT, GUI_THEME_SLD_BG_COLOR);
 	lv_obj_set_event_cb(dd_cn, _cb_cn_dd);
 	
+	// Handset equalizer control label
+	lbl_eq = lv_label_create(screen, NULL);
+	lv_obj_set_pos(lbl_eq, SETTINGS_EQ_LBL_LEFT_X, SETTINGS_EQ_LBL_TOP_Y);
+	lv_label_set_static_text(lbl_eq, "Handset");
+	
+	// Handset equalizer control dropdown
+	dd_eq = lv_dropdown_create(screen, NULL);
+	lv_dropdown_set_options_static(dd_eq, eq_profile_list);
+	lv_obj_set_pos(dd_eq, SETTINGS_EQ_DD_LEFT_X, SETTINGS_EQ_DD_TOP_Y);
+	lv_obj_set_size(dd_eq, SETTINGS_EQ_DD_W, SETTINGS_EQ_DD_H);
+	lv_obj_set_style_local_bg_color(dd_eq, LV_DROPDOWN_PART_SELECTED, LV_STATE_DEFAULT, GUI_THEME_SLD_BG_COLOR);
+	lv_obj_set_event_cb(dd_eq, _cb_eq_dd);
+	
 	// Mic gain slider control label
 	lbl_mic = lv_label_create(screen, NULL);
 	lv_obj_set_pos(lbl_mic, SETTINGS_MIC_LBL_LEFT_X, SETTINGS_MIC_LBL_TOP_Y);
@@ -278,14 +319,15 @@ lv_obj_t* gui_screen_settings_create()
 	lv_obj_set_style_local_border_color(btn_time, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_time, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_time, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_time, LV_BTN_PART_MAIN, &flat_btn_style);
 	lv_obj_set_event_cb(btn_time, _cb_set_time);
 	
 	btn_time_lbl = lv_label_create(btn_time, NULL);
-	lv_obj_set_style_local_text_font(btn_time_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(btn_time_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_label_set_static_text(btn_time_lbl, LV_SYMBOL_RIGHT);
 
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
-	// Button to trigger audio sample acquisition
+	// Button to start and stop audio sample acquisition
 	btn_smpl = lv_btn_create(screen, NULL);
 	lv_obj_set_pos(btn_smpl, SETTINGS_SMPL_BTN_LEFT_X, SETTINGS_SMPL_BTN_TOP_Y);
 	lv_obj_set_size(btn_smpl, SETTINGS_SMPL_BTN_W, SETTINGS_SMPL_BTN_H);
@@ -303,15 +345,7 @@ void gui_screen_settings_set_active(bool en)
 {
 	if (en) {
 		// Update state from persistent storage
-		cur_is_paired = ps_get_bt_is_paired();
-		ps_get_bt_pair_name(cur_paired_name);
-		if (cur_is_paired) {
-			lv_label_set_static_text(btn_bt_lbl, "Forget");
-			lv_label_set_static_text(lbl_bt_status, cur_paired_name);
-		} else {
-			lv_label_set_static_text(btn_bt_lbl, "Pair");
-			lv_label_set_static_text(lbl_bt_status, "Not paired");
-		}
+		_update_pair_status();
 		
 		ps_get_brightness_info(&cur_brightness, &cur_auto_dim);
 		lv_slider_set_value(sld_bl, cur_brightness, false);
@@ -324,6 +358,9 @@ void gui_screen_settings_set_active(bool en)
 		cur_country_code = ps_get_country_code();
 		lv_dropdown_set_selected(dd_cn, (uint16_t) cur_country_code);
 		
+		cur_eq_profile = ps_get_eq_profile();
+		lv_dropdown_set_selected(dd_eq, (uint16_t) cur_eq_profile);
+		
 		cur_mic_gain = ps_get_gain(PS_GAIN_MIC);
 		lv_slider_set_value(sld_mic, _gain_to_sld_int(GAIN_TYPE_MIC, cur_mic_gain), false);
 		
@@ -339,11 +376,31 @@ void gui_screen_settings_set_active(bool en)
 }
 
 
+bool gui_screen_settings_destroy()
+{
+	// Pairing reports its result through our status label
+	if (screen_is_active || pairing_in_process) return false;
+	
+	if (screen != NULL) {
+		lv_obj_del(screen);
+		screen = NULL;
+	}
+	if (country_list != NULL) {
+		free(country_list);
+		country_list = NULL;
+	}
+	
+	return true;
+}
+
+
 void gui_screen_settings_update_mic_gain(float g)
 {
-	// Update the control
+	// Update the control (it's loaded from persistent storage if the screen is created later)
 	cur_mic_gain = g;
-	lv_slider_set_value(sld_mic, _gain_to_sld_int(GAIN_TYPE_MIC, g), false);
+	if (screen != NULL) {
+		lv_slider_set_value(sld_mic, _gain_to_sld_int(GAIN_TYPE_MIC, g), false);
+	}
 	
 	// Update persistent storage
 	ps_set_gain(PS_GAIN_MIC, g);
@@ -361,9 +418,11 @@ void gui_screen_settings_update_mic_gain(float g)
 
 void gui_screen_settings_update_spk_gain(float g)
 {
-	// Update the control
+	// Update the control (it's loaded from persistent storage if the screen is created later)
 	cur_spk_gain = g;
-	lv_slider_set_value(sld_spk, _gain_to_sld_int(GAIN_TYPE_SPK, g), false);
+	if (screen != NULL) {
+		lv_slider_set_value(sld_spk, _gain_to_sld_int(GAIN_TYPE_SPK, g), false);
+	}
 	
 	// Update persistent storage
 	ps_set_gain(PS_GAIN_SPK, g);
@@ -398,8 +457,10 @@ void gui_screen_settings_forget_peer_info()
 	ps_update_backing_store();
 	
 	cur_is_paired = false;
-	lv_label_set_static_text(btn_bt_lbl, "Pair");
-	lv_label_set_static_text(lbl_bt_status, "Not paired");
+	if (screen != NULL) {
+		gui_label_view_show(&vw_btn_bt, "Pair");
+		gui_label_view_show(&vw_bt_status, "Not paired");
+	}
 }
 
 
@@ -486,20 +547,48 @@ static void _cb_bck_btn(lv_obj_t* obj, lv_event_t event)
 }
 
 
+static void _cb_ver_lbl(lv_obj_t* obj, lv_event_t event)
+{
+	// Hidden access to the audio diagnostics screen
+	if (event == LV_EVENT_LONG_PRESSED) {
+		if (update_ps_ram) {
+			ps_update_backing_store();
+			update_ps_ram = false;
+		}
+		gui_set_screen(GUI_SCREEN_DIAG);
+	}
+}
+
+
+static void _cb_scr_lbl(lv_obj_t* obj, lv_event_t event)
+{
+	// Hidden access to the system monitor screen
+	if (event == LV_EVENT_LONG_PRESSED) {
+		if (update_ps_ram) {
+			ps_update_backing_store();
+			update_ps_ram = false;
+		}
+		gui_set_screen(GUI_SCREEN_SYS);
+	}
+}
+
+
 static void _cb_bt_btn(lv_obj_t* obj, lv_event_t event)
 {
 	if (event == LV_EVENT_CLICKED) {
-		if (cur_is_paired) {
+		if (pairing_in_process) {
+			_stop_pairing();
+		} else if (cur_is_paired) {
 			// Confirm deleting pairing with user
 			gui_preset_message_box_string("Clear Bluetooth pairing?", true, GUI_MSGBOX_CLR_PAIRING);
 			xTaskNotify(task_handle_gui, GUI_NOTIFY_MESSAGEBOX_MASK, eSetBits);
 		} else {
-			// Managing the pairing process
-			if (pairing_in_process) {
-				_stop_pairing();
-			} else {
-				_start_pairing();
-			}
+			_start_pairing();
+		}
+	} else if (event == LV_EVENT_LONG_PRESSED) {
+		// Long press pairs another phone (up to PS_BT_MAX_PAIRS are remembered)
+		if (!pairing_in_process) {
+			_start_pairing();
 		}
 	}
 }
@@ -544,6 +633,20 @@ static void _cb_cn_dd(lv_obj_t* obj, lv_event_t event)
 }
 
 
+static void _cb_eq_dd(lv_obj_t* obj, lv_event_t event)
+{
+	uint16_t new_val;
+	
+	if (event == LV_EVENT_VALUE_CHANGED) {
+		// audio_task loads the profile when the next call starts
+		new_val = lv_dropdown_get_selected(obj);
+		cur_eq_profile = (uint8_t) new_val;
+		ps_set_eq_profile(cur_eq_profile);
+		update_ps_ram = true;
+	}
+}
+
+
 static void _cb_gain_sld(lv_obj_t* obj, lv_event_t event)
 {
 	int16_t new_val;
@@ -558,7 +661,7 @@ static void _cb_gain_sld(lv_obj_t* obj, lv_event_t event)
 				cur_mic_gain = GAIN_APP_MIC_MAX_DB;
 			}
 			ps_set_gain(PS_GAIN_MIC, cur_mic_gain);
-			xTaskNotify(task_handle_app, APP_NOTIFY_NEW_GUI_MIC_GAIN_MASK, eSetBits);
+			evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_NEW_GUI_MIC_GAIN);
 		} else {
 			cur_spk_gain = (float) new_val;
 			if (cur_spk_gain < GAIN_APP_SPK_MIN_DB) {
@@ -567,7 +670,7 @@ static void _cb_gain_sld(lv_obj_t* obj, lv_event_t event)
 				cur_spk_gain = GAIN_APP_SPK_MAX_DB;
 			}
 			ps_set_gain(PS_GAIN_SPK, cur_spk_gain);
-			xTaskNotify(task_handle_app, APP_NOTIFY_NEW_GUI_SPK_GAIN_MASK, eSetBits);
+			evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_NEW_GUI_SPK_GAIN);
 		}
 		update_ps_ram = true;
 	}
@@ -605,8 +708,8 @@ static void _start_pairing()
 #else
 	sprintf(status_buf, "Pairing (pin " BLUETOOTH_PIN_STRING ")...");
 #endif
-	lv_label_set_static_text(lbl_bt_status, status_buf);
-	lv_label_set_static_text(btn_bt_lbl, "Cancel");
+	gui_label_view_show(&vw_bt_status, status_buf);
+	gui_label_view_show(&vw_btn_bt, "Cancel");
 	
 	// Start timer
 	if (pair_timer_task != NULL) {
@@ -616,7 +719,7 @@ static void _start_pairing()
 	pair_timer_task = lv_task_create(_cb_pair_timer_task, GUI_MAX_PAIR_MSEC, LV_TASK_PRIO_LOW, NULL);
 	
 	// Notify bt_task to allow pairing
-	xTaskNotify(task_handle_bt, BT_NOTIFY_ENABLE_PAIR_MASK, eSetBits);
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_ENABLE_PAIR);
 }
 
 
@@ -631,17 +734,32 @@ static void _stop_pairing()
 	}
 	
 	// Notify bt_task to end pairing
-	xTaskNotify(task_handle_bt, BT_NOTIFY_DISABLE_PAIR_MASK, eSetBits);
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_DISABLE_PAIR);
 	
 	// Update pair info
+	_update_pair_status();
+}
+
+
+static void _update_pair_status()
+{
+	char name[ESP_BT_GAP_MAX_BDNAME_LEN+1];
+	
 	cur_is_paired = ps_get_bt_is_paired();
-	ps_get_bt_pair_name(cur_paired_name);
+	cur_paired_name[0] = 0;
+	for (int i=0; i<PS_BT_MAX_PAIRS; i++) {
+		if (ps_get_bt_pair(i, NULL, name)) {
+			if (i != 0) strcat(cur_paired_name, " + ");
+			strcat(cur_paired_name, name);
+		}
+	}
+	
 	if (cur_is_paired) {
-		lv_label_set_static_text(btn_bt_lbl, "Forget");
-		lv_label_set_static_text(lbl_bt_status, cur_paired_name);
+		gui_label_view_show(&vw_btn_bt, "Forget");
+		gui_label_view_show(&vw_bt_status, cur_paired_name);
 	} else {
-		lv_label_set_static_text(btn_bt_lbl, "Pair");
-		lv_label_set_static_text(lbl_bt_status, "Not paired");
+		gui_label_view_show(&vw_btn_bt, "Pair");
+		gui_label_view_show(&vw_bt_status, "Not paired");
 	}
 }
 
@@ -650,7 +768,7 @@ static void _stop_pairing()
 static void _cb_smpl_btn(lv_obj_t* obj, lv_event_t event)
 {
 	if (event == LV_EVENT_CLICKED) {
-		xTaskNotify(task_handle_app, APP_NOTIFY_START_AUDIO_SMPL_MASK, eSetBits);
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_START_AUDIO_SMPL);
 	}
 }
 #endif
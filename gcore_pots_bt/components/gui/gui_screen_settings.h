@@ -76,19 +76,28 @@
 
 // Country selection control
 #define SETTINGS_CN_LBL_LEFT_X  20
-#define SETTINGS_CN_LBL_TOP_Y   240
+#define SETTINGS_CN_LBL_TOP_Y   215
 
 #define SETTINGS_CN_DD_LEFT_X   120
-#define SETTINGS_CN_DD_TOP_Y    230
+#define SETTINGS_CN_DD_TOP_Y    205
 #define SETTINGS_CN_DD_W        180
 #define SETTINGS_CN_DD_H        40
 
+// Handset equalizer selection control
+#define SETTINGS_EQ_LBL_LEFT_X  20
+#define SETTINGS_EQ_LBL_TOP_Y   265
+
+#define SETTINGS_EQ_DD_LEFT_X   120
+#define SETTINGS_EQ_DD_TOP_Y    255
+#define SETTINGS_EQ_DD_W        180
+#define SETTINGS_EQ_DD_H        40
+
 // Audio gain controls
 #define SETTINGS_MIC_LBL_LEFT_X 20
-#define SETTINGS_MIC_LBL_TOP_Y  310
+#define SETTINGS_MIC_LBL_TOP_Y  320
 
 #define SETTINGS_MIC_SLD_LEFT_X 120
-#define SETTINGS_MIC_SLD_TOP_Y  310
+#define SETTINGS_MIC_SLD_TOP_Y  320
 #define SETTINGS_MIC_SLD_W      180
 #define SETTINGS_MIC_SLD_H      20
 
@@ -128,6 +137,7 @@
 //
 lv_obj_t* gui_screen_settings_create();
 void gui_screen_settings_set_active(bool en);
+bool gui_screen_settings_destroy();      // False while it must be kept (displayed or pairing)
 void gui_screen_settings_update_mic_gain(float g);
 void gui_screen_settings_update_spk_gain(float g);
 void gui_screen_settings_update_peer_info(uint8_t* addr, char* name);
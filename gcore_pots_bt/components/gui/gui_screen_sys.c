@@ -0,0 +1,237 @@
+/*
+ * System monitor GUI screen related functions, callbacks and event handlers
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "gui_screen_sys.h"
+#include "gui_fonts.h"
+#include "gui_task.h"
+#include "gui_utilities.h"
+#include "sys_mon.h"
+#include <stdio.h>
+#include <string.h>
+
+
+
+//
+// System monitor GUI Screen variables
+//
+
+// LVGL objects
+static lv_obj_t* screen = NULL;
+static lv_obj_t* btn_bck;
+static lv_obj_t* btn_bck_lbl;
+static lv_obj_t* lbl_screen;
+static lv_obj_t* lbl_stats;
+static lv_obj_t* btn_log;
+static lv_obj_t* btn_log_lbl;
+
+// Flattened style of the back button
+static lv_style_t flat_btn_style;
+
+// LVGL timers
+static lv_task_t* update_task = NULL;
+
+// Last sample (too big for the stack)
+static sys_mon_snapshot_t snapshot;
+
+// Statistics display string
+static char stats_buf[1024];
+
+
+
+//
+// System monitor GUI Screen internal function forward declarations
+//
+static void _update_stats();
+static char* _pct_str(char* cP, int16_t pct_x10);
+static void _cb_update_task(lv_task_t* task);
+static void _cb_bck_btn(lv_obj_t* btn, lv_event_t event);
+static void _cb_log_btn(lv_obj_t* btn, lv_event_t event);
+
+
+
+//
+// System monitor GUI Screen API
+//
+
+/**
+ * Create the system monitor screen, its graphical objects and link necessary callbacks
+ */
+lv_obj_t* gui_screen_sys_create()
+{
+	// Create screen object
+	screen = lv_obj_create(NULL, NULL);
+	
+	// Create the widgets for this screen
+	//
+	
+	// Back control button
+	btn_bck = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_bck, SYS_BCK_BTN_LEFT_X, SYS_BCK_BTN_TOP_Y);
+	lv_obj_set_size(btn_bck, SYS_BCK_BTN_W, SYS_BCK_BTN_H);
+	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_bck, LV_BTN_PART_MAIN, &flat_btn_style);
+	lv_obj_set_event_cb(btn_bck, _cb_bck_btn);
+	
+	btn_bck_lbl = lv_label_create(btn_bck, NULL);
+	lv_obj_set_style_local_text_font(btn_bck_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
+	lv_label_set_static_text(btn_bck_lbl, LV_SYMBOL_LEFT);
+	
+	// Screen label
+	lbl_screen = lv_label_create(screen, NULL);
+	lv_label_set_long_mode(lbl_screen, LV_LABEL_LONG_BREAK);
+	lv_label_set_align(lbl_screen, LV_LABEL_ALIGN_CENTER);
+	lv_obj_set_pos(lbl_screen, SYS_SCR_LBL_LEFT_X, SYS_SCR_LBL_TOP_Y);
+	lv_obj_set_width(lbl_screen, SYS_SCR_LBL_W);
+	lv_obj_set_style_local_text_font(lbl_screen, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_20);
+	lv_label_set_static_text(lbl_screen, "System");
+	
+	// Statistics text
+	lbl_stats = lv_label_create(screen, NULL);
+	lv_label_set_long_mode(lbl_stats, LV_LABEL_LONG_BREAK);
+	lv_obj_set_pos(lbl_stats, SYS_STAT_LBL_LEFT_X, SYS_STAT_LBL_TOP_Y);
+	lv_obj_set_width(lbl_stats, SYS_STAT_LBL_W);
+	lv_obj_set_style_local_text_font(lbl_stats, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_14);
+	stats_buf[0] = 0;
+	lv_label_set_static_text(lbl_stats, stats_buf);
+	
+	// Log button
+	btn_log = lv_btn_create(screen, NULL);
+	lv_obj_set_pos(btn_log, SYS_LOG_BTN_LEFT_X, SYS_LOG_BTN_TOP_Y);
+	lv_obj_set_size(btn_log, SYS_LOG_BTN_W, SYS_LOG_BTN_H);
+	lv_obj_set_event_cb(btn_log, _cb_log_btn);
+	
+	btn_log_lbl = lv_label_create(btn_log, NULL);
+	lv_label_set_static_text(btn_log_lbl, "Log");
+	
+	return screen;
+}
+
+
+/**
+ * Initialize the system monitor screen's dynamic values when it's being activated
+ */
+void gui_screen_sys_set_active(bool en)
+{
+	if (en) {
+		_update_stats();
+		if (update_task == NULL) {
+			update_task = lv_task_create(_cb_update_task, SYS_UPDATE_MSEC, LV_TASK_PRIO_LOW, NULL);
+		}
+	} else {
+		if (update_task != NULL) {
+			lv_task_del(update_task);
+			update_task = NULL;
+		}
+	}
+	
+	lv_obj_set_hidden(screen, !en);
+}
+
+
+/**
+ * Delete the screen while it's not displayed to give its objects back to LVGL
+ */
+bool gui_screen_sys_destroy()
+{
+	if (update_task != NULL) {
+		lv_task_del(update_task);
+		update_task = NULL;
+	}
+	if (screen != NULL) {
+		lv_obj_del(screen);
+		screen = NULL;
+	}
+	
+	return true;
+}
+
+
+
+//
+// System monitor GUI Screen internal functions
+//
+static void _update_stats()
+{
+	int i;
+	char* cP = stats_buf;
+	
+	sys_mon_get_snapshot(&snapshot);
+	
+	cP += sprintf(cP, "Up %u sec  idle ", snapshot.uptime_sec);
+	for (i=0; i<portNUM_PROCESSORS; i++) {
+		if (i != 0) cP += sprintf(cP, " / ");
+		cP = _pct_str(cP, snapshot.idle_pct_x10[i]);
+	}
+	
+	// Heap levels in kB
+	cP += sprintf(cP, "\nINT    free %u  min %u  blk %u kB\n", snapshot.int_free / 1024,
+	              snapshot.int_min_free / 1024, snapshot.int_largest / 1024);
+	cP += sprintf(cP, "PSRAM  free %u  min %u  blk %u kB\n", snapshot.spiram_free / 1024,
+	              snapshot.spiram_min_free / 1024, snapshot.spiram_largest / 1024);
+	
+	// Tasks with the least stack headroom first
+	cP += sprintf(cP, "\nTask           core pri  cpu  stack free\n");
+	for (i=0; (i<snapshot.num_tasks) && (i<SYS_MAX_TASK_LINES); i++) {
+		cP += sprintf(cP, "%-14s %2d %3u  ", snapshot.task[i].name, snapshot.task[i].core,
+		              snapshot.task[i].priority);
+		cP = _pct_str(cP, snapshot.task[i].cpu_pct_x10);
+		cP += sprintf(cP, "  %u\n", snapshot.task[i].stack_free);
+	}
+	if (snapshot.num_tasks == 0) {
+		cP += sprintf(cP, "Not available\n");
+	}
+	
+	lv_label_set_static_text(lbl_stats, stats_buf);
+}
+
+
+static char* _pct_str(char* cP, int16_t pct_x10)
+{
+	if (pct_x10 < 0) {
+		cP += sprintf(cP, "-");
+	} else {
+		cP += sprintf(cP, "%d.%d%%", pct_x10 / 10, pct_x10 % 10);
+	}
+	return cP;
+}
+
+
+static void _cb_update_task(lv_task_t* task)
+{
+	_update_stats();
+}
+
+
+static void _cb_bck_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		gui_set_screen(GUI_SCREEN_SETTINGS);
+	}
+}
+
+
+static void _cb_log_btn(lv_obj_t* btn, lv_event_t event)
+{
+	if (event == LV_EVENT_CLICKED) {
+		sys_mon_print(&snapshot);
+	}
+}
@@ -0,0 +1,68 @@
+/*
+ * System monitor GUI screen related functions, callbacks and event handlers
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef GUI_SCREEN_SYS_H_
+#define GUI_SCREEN_SYS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+
+//
+// System monitor GUI Screen Constants
+//
+
+// Statistics update rate (new samples are taken every GCORE_SYS_MON_MSEC)
+#define SYS_UPDATE_MSEC        2000
+
+// Most task lines displayed (those with the least stack headroom)
+#define SYS_MAX_TASK_LINES     17
+
+// Back control
+#define SYS_BCK_BTN_LEFT_X     10
+#define SYS_BCK_BTN_TOP_Y      5
+#define SYS_BCK_BTN_W          50
+#define SYS_BCK_BTN_H          50
+
+// Screen label (centered)
+#define SYS_SCR_LBL_LEFT_X     60
+#define SYS_SCR_LBL_TOP_Y      20
+#define SYS_SCR_LBL_W          200
+
+// Statistics text
+#define SYS_STAT_LBL_LEFT_X    10
+#define SYS_STAT_LBL_TOP_Y     60
+#define SYS_STAT_LBL_W         300
+
+// Log (console dump) Button
+#define SYS_LOG_BTN_LEFT_X     115
+#define SYS_LOG_BTN_TOP_Y      425
+#define SYS_LOG_BTN_W          90
+#define SYS_LOG_BTN_H          40
+
+
+//
+// System monitor GUI Screen API
+//
+lv_obj_t* gui_screen_sys_create();
+void gui_screen_sys_set_active(bool en);
+bool gui_screen_sys_destroy();
+
+#endif /* GUI_SCREEN_SYS_H_ */
@@ -18,7 +18,9 @@
  *
  */
 #include "gui_screen_time.h"
+#include "gui_fonts.h"
 #include "gui_task.h"
+#include "gui_utilities.h"
 #include "esp_system.h"
 #include "time_utilities.h"
 #include <time.h>
@@ -53,15 +55,21 @@
 //
 
 // LVGL objects
-static lv_obj_t* screen;
+static lv_obj_t* screen = NULL;
 static lv_obj_t* btn_bck;
 static lv_obj_t* btn_bck_lbl;
 static lv_obj_t* lbl_screen;
 static lv_obj_t* lbl_time_set;
+static gui_label_view_t vw_time_set;    // Displayed state of lbl_time_set
 static lv_obj_t* btn_set_time_keypad;
 static lv_obj_t* btn_save;
 static lv_obj_t* btn_save_lbl;
 
+// Flattened styles of static widgets
+static lv_style_t flat_btn_style;         // Back and save buttons
+static lv_style_t flat_keyp_bg_style;
+static lv_style_t flat_keyp_btn_style;
+
 // Time set state
 static tmElements_t timeset_value;
 static int timeset_index;
@@ -122,10 +130,11 @@ lv_obj_t* gui_screen_time_create()
 	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_bck, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_bck, LV_BTN_PART_MAIN, &flat_btn_style);
 	lv_obj_set_event_cb(btn_bck, _cb_bck_btn);
 	
 	btn_bck_lbl = lv_label_create(btn_bck, NULL);
-	lv_obj_set_style_local_text_font(btn_bck_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(btn_bck_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_label_set_static_text(btn_bck_lbl, LV_SYMBOL_LEFT);
 	
 	// Screen label
@@ -134,7 +143,7 @@ lv_obj_t* gui_screen_time_create()
 	lv_label_set_align(lbl_screen, LV_LABEL_ALIGN_CENTER);
 	lv_obj_set_pos(lbl_screen, TIME_SCR_LBL_LEFT_X, TIME_SCR_LBL_TOP_Y);
 	lv_obj_set_width(lbl_screen, TIME_SCR_LBL_W);
-	lv_obj_set_style_local_text_font(lbl_screen, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_20);
+	lv_obj_set_style_local_text_font(lbl_screen, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_20);
 	lv_label_set_static_text(lbl_screen, "Set Time/Date");
 	
 	// Set Time/Date String (centered)
@@ -143,21 +152,25 @@ lv_obj_t* gui_screen_time_create()
 	lv_label_set_align(lbl_time_set, LV_LABEL_ALIGN_CENTER);
 	lv_obj_set_pos(lbl_time_set, TIME_TD_LEFT_X, TIME_TD_TOP_Y);
 	lv_obj_set_width(lbl_time_set, TIME_TD_W);
-	lv_obj_set_style_local_text_font(lbl_time_set, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(lbl_time_set, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_label_set_recolor(lbl_time_set, true);
 	lv_obj_set_style_local_text_color(lbl_time_set, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, LV_COLOR_MAKE(0xB0, 0xB0, 0xB0));
+	lv_label_set_static_text(lbl_time_set, "");
+	gui_label_view_init(&vw_time_set, lbl_time_set, "");
 	
 	// Time set button matrix
 	btn_set_time_keypad = lv_btnmatrix_create(screen, NULL);
 	lv_obj_set_pos(btn_set_time_keypad, TIME_BTN_MATRIX_LEFT_X, TIME_BTN_MATRIX_TOP_Y);
 	lv_obj_set_size(btn_set_time_keypad, TIME_BTN_MATRIX_W, TIME_BTN_MATRIX_H);
 	lv_btnmatrix_set_map(btn_set_time_keypad, keyp_map);
-	lv_obj_set_style_local_text_font(btn_set_time_keypad, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, &lv_font_montserrat_34);
+	lv_obj_set_style_local_text_font(btn_set_time_keypad, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, GUI_FONT_34);
 	lv_obj_set_style_local_border_color(btn_set_time_keypad, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_set_time_keypad, LV_BTNMATRIX_PART_BTN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_set_time_keypad, LV_BTNMATRIX_PART_BTN, LV_STATE_PRESSED, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_set_time_keypad, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_set_time_keypad, LV_BTNMATRIX_PART_BG, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
+	gui_style_flatten(btn_set_time_keypad, LV_BTNMATRIX_PART_BG, &flat_keyp_bg_style);
+	gui_style_flatten(btn_set_time_keypad, LV_BTNMATRIX_PART_BTN, &flat_keyp_btn_style);
 	lv_btnmatrix_set_btn_ctrl_all(btn_set_time_keypad, LV_BTNMATRIX_CTRL_NO_REPEAT);
 	lv_btnmatrix_set_btn_ctrl_all(btn_set_time_keypad, LV_BTNMATRIX_CTRL_CLICK_TRIG);
 	lv_obj_set_event_cb(btn_set_time_keypad, _cb_btn_set_time_keypad);
@@ -170,10 +183,11 @@ lv_obj_t* gui_screen_time_create()
 	lv_obj_set_style_local_border_color(btn_save, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_bg_color(btn_save, LV_BTN_PART_MAIN, LV_STATE_DEFAULT, GUI_THEME_BG_COLOR);
 	lv_obj_set_style_local_border_color(btn_save, LV_BTN_PART_MAIN, LV_STATE_PRESSED, lv_theme_get_color_secondary());
+	gui_style_flatten(btn_save, LV_BTN_PART_MAIN, &flat_btn_style);
 	lv_obj_set_event_cb(btn_save, _cb_save_btn);
 	
 	btn_save_lbl = lv_label_create(btn_save, NULL);
-	lv_obj_set_style_local_text_font(btn_save_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, &lv_font_montserrat_20);
+	lv_obj_set_style_local_text_font(btn_save_lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, GUI_FONT_20);
 	lv_label_set_static_text(btn_save_lbl, "SAVE");
 
 	return screen;
@@ -198,6 +212,20 @@ void gui_screen_time_set_active(bool en)
 }
 
 
+/**
+ * Delete the screen while it's not displayed to give its objects back to LVGL
+ */
+bool gui_screen_time_destroy()
+{
+	if (screen != NULL) {
+		lv_obj_del(screen);
+		screen = NULL;
+	}
+	
+	return true;
+}
+
+
 //
 // Set Time GUI Screen internal functions
 //
@@ -350,7 +378,8 @@ static void _display_timeset_value()
 	// Make sure the string is terminated
 	timeset_string[timeset_string_index] = 0;
 	
-	lv_label_set_static_text(lbl_time_set, timeset_string);
+	// Keypad presses that don't change a digit leave the label untouched
+	gui_label_view_show(&vw_time_set, timeset_string);
 }
 
 
@@ -62,5 +62,6 @@
 //
 lv_obj_t* gui_screen_time_create();
 void gui_screen_time_set_active(bool en);
+bool gui_screen_time_destroy();
 
 #endif /* GUI_SCREEN_TIME_H_ */
\ No newline at end of file
@@ -49,6 +49,7 @@ static const char* msg_box_buttons2[] = {"Cancel", "Confirm", ""};
 static void _display_message_box(lv_obj_t* parent, const char* msg, bool dual_btn);
 static void _cb_messagebox_event(lv_obj_t *obj, lv_event_t evt);
 static void _cb_messagebox_opa_anim(void* bg, lv_anim_value_t v);
+static uint32_t _label_view_hash(const char* text);
 
 
 
@@ -108,6 +109,119 @@ bool gui_message_box_displayed()
 }
 
 
+/**
+ * Attach a label view to a newly created label already displaying static text
+ */
+void gui_label_view_init(gui_label_view_t* v, lv_obj_t* lbl, const char* text)
+{
+	v->lbl = lbl;
+	v->text = text;
+	v->shown_text = text;
+	v->shown_hash = _label_view_hash(text);
+	v->text_staged = false;
+	v->color_staged = false;
+	v->color_valid = false;
+}
+
+
+/**
+ * Stage static text for the label.  Text is held by pointer so it must remain valid
+ * until committed (and after, as the label uses it directly).
+ */
+void gui_label_view_set_text(gui_label_view_t* v, const char* text)
+{
+	v->text = text;
+	v->text_staged = true;
+}
+
+
+/**
+ * Stage a text color for the label
+ */
+void gui_label_view_set_color(gui_label_view_t* v, lv_color_t c)
+{
+	v->color = c;
+	v->color_staged = true;
+}
+
+
+/**
+ * Apply staged changes that differ from what is displayed.  Text is unchanged when it
+ * is the same buffer holding the same contents - a different buffer is always set so
+ * the label never points to a buffer that may be reused for something else.  Returns
+ * true if the label was changed.
+ */
+bool gui_label_view_commit(gui_label_view_t* v)
+{
+	bool changed = false;
+	uint32_t h;
+	
+	if (v->text_staged) {
+		v->text_staged = false;
+		h = _label_view_hash(v->text);
+		if ((v->text != v->shown_text) || (h != v->shown_hash)) {
+			lv_label_set_static_text(v->lbl, v->text);
+			v->shown_text = v->text;
+			v->shown_hash = h;
+			changed = true;
+		}
+	}
+	
+	if (v->color_staged) {
+		v->color_staged = false;
+		if (!v->color_valid || (v->color.full != v->shown_color.full)) {
+			lv_obj_set_style_local_text_color(v->lbl, LV_LABEL_PART_MAIN, LV_STATE_DEFAULT, v->color);
+			v->shown_color = v->color;
+			v->color_valid = true;
+			changed = true;
+		}
+	}
+	
+	return changed;
+}
+
+
+/**
+ * Stage and immediately commit static text for a label updated outside the event handler
+ */
+void gui_label_view_show(gui_label_view_t* v, const char* text)
+{
+	gui_label_view_set_text(v, text);
+	(void) gui_label_view_commit(v);
+}
+
+
+/**
+ * Replace the theme and local styles of a static widget's part with a single flattened
+ * style so drawing it finds each property in one style instead of walking the whole list.
+ * The flattened style is built from the first object passed in and then shared with later
+ * objects using the same flat style, so they must have been created and styled the same
+ * way.  flat must be static and is kept when a screen is destroyed so it is only built
+ * once.  Call once the widget's local styles are set.  A later local style still takes priority over the flattened one
+ * but a theme change is not seen.
+ */
+void gui_style_flatten(lv_obj_t* obj, uint8_t part, lv_style_t* flat)
+{
+	lv_style_list_t* list;
+	int i;
+	
+	list = lv_obj_get_style_list(obj, part);
+	if ((list == NULL) || list->has_trans) return;
+	
+	if (flat->map == NULL) {
+		lv_style_init(flat);
+		
+		// Merge from the lowest priority style up so higher priority properties replace them
+		for (i=list->style_cnt-1; i>=0; i--) {
+			lv_style_merge(flat, lv_style_list_get_style(list, i));
+		}
+	}
+	
+	lv_obj_reset_style_list(obj, part);
+	lv_obj_add_style(obj, part, flat);
+}
+
+
 
 //
 // Internal functions
@@ -190,3 +304,19 @@ static void _cb_messagebox_opa_anim(void* bg, lv_anim_value_t v)
 {
 	lv_obj_set_style_local_bg_opa(bg, LV_OBJ_PART_MAIN, LV_STATE_DEFAULT, v);
 }
+
+
+/**
+ * FNV-1a hash of a label's text used to detect a change in contents of a reused buffer
+ */
+static uint32_t _label_view_hash(const char* text)
+{
+	uint32_t h = 2166136261UL;
+	
+	while (*text != 0) {
+		h ^= (uint8_t) *text++;
+		h *= 16777619UL;
+	}
+	
+	return h;
+}
@@ -41,6 +41,28 @@
 
 
 
+//
+// GUI Utilities Typedefs
+//
+
+// Label view - the displayed state of a label so it is only changed, invalidated and
+// flushed when what it shows actually changes.  Text and color are staged by the set
+// functions and applied together by gui_label_view_commit so several updates in one
+// pass of the GUI event handler result in at most one change to the label.
+typedef struct {
+	lv_obj_t* lbl;
+	const char* text;          // Staged static text
+	const char* shown_text;    // Static text the label points to
+	uint32_t shown_hash;       // Hash of the contents of shown_text when it was set
+	lv_color_t color;          // Staged text color
+	lv_color_t shown_color;
+	bool text_staged;
+	bool color_staged;
+	bool color_valid;          // Set once the label has been given a color through the view
+} gui_label_view_t;
+
+
+
 //
 // GUI Utilities API
 //
@@ -49,4 +71,12 @@ void gui_preset_message_box(lv_obj_t* parent);
 void gui_close_message_box();
 bool gui_message_box_displayed();
 
+void gui_label_view_init(gui_label_view_t* v, lv_obj_t* lbl, const char* text);
+void gui_label_view_set_text(gui_label_view_t* v, const char* text);
+void gui_label_view_set_color(gui_label_view_t* v, lv_color_t c);
+bool gui_label_view_commit(gui_label_view_t* v);
+void gui_label_view_show(gui_label_view_t* v, const char* text);
+
+void gui_style_flatten(lv_obj_t* obj, uint8_t part, lv_style_t* flat);
+
 #endif /* GUI_UTILITIES_H */
\ No newline at end of file
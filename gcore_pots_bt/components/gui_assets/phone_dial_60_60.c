@@ -21,266 +21,381 @@
 #define LV_ATTRIBUTE_IMG_PHONE_DIAL_60_60
 #endif
 
+/* Run-length encoded by tools/img_rle.py for the gui_img_rle decoder */
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PHONE_DIAL_60_60 uint8_t phone_dial_60_60_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
   /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0xff, 0x34, 0xdf, 0x51, 0xbe, 0x6a, 0x9e, 0x8f, 0x5d, 0xed, 0x5d, 0xed, 0x9e, 0x8f, 0xbe, 0x6a, 0xdf, 0x51, 0xff, 0x34, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x11, 0xdf, 0x4a, 0x9e, 0x8d, 0x7d, 0xc6, 0x5c, 0xeb, 0x3c, 0xfe, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfe, 0x5c, 0xeb, 0x7d, 0xc6, 0x9e, 0x8d, 0xdf, 0x4a, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x39, 0x9e, 0x96, 0x5d, 0xe1, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xe1, 0x9e, 0x96, 0xdf, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x47, 0x7d, 0xb8, 0x3c, 0xfc, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfc, 0x7d, 0xb8, 0xdf, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x30, 0x7d, 0xb0, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xb0, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0xbe, 0x7a, 0x3c, 0xf2, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xf2, 0xbe, 0x7a, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x7d, 0xb9, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xb9, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3b, 0x5d, 0xde, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xde, 0xdf, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x3c, 0xef, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xef, 0xdf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x3c, 0xf3, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xf3, 0xdf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3a, 0x3c, 0xef, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xef, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x5d, 0xe0, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5c, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xe0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x7d, 0xbb, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xbb, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x7a, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x3c, 0xf3, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xf3, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x7d, 0xb3, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xb3, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x45, 0x3c, 0xfe, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfe, 0xdf, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x7d, 0xbb, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xbb, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x37, 0x3c, 0xfc, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfc, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9e, 0x97, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0x97, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x0f, 0x5d, 0xe4, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xe4, 0xff, 0x0f, 0x00, 0x00, 
-  0x00, 0x00, 0xdf, 0x49, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0x49, 0x00, 0x00, 
-  0x00, 0x00, 0x9e, 0x8e, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0x8e, 0x00, 0x00, 
-  0xff, 0x02, 0x7d, 0xc7, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xc7, 0xff, 0x02, 
-  0xff, 0x16, 0x5c, 0xec, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5c, 0xec, 0xff, 0x16, 
-  0xff, 0x34, 0x3c, 0xfd, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfd, 0xff, 0x34, 
-  0xdf, 0x52, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0x51, 
-  0xbe, 0x68, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0x68, 
-  0x9e, 0x90, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0x90, 
-  0x5d, 0xed, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xed, 
-  0x5d, 0xed, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xed, 
-  0x9e, 0x8f, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0x8f, 
-  0xbe, 0x68, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0x68, 
-  0xdf, 0x51, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xff, 0x7d, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0x51, 
-  0xff, 0x34, 0x3c, 0xfd, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfd, 0xff, 0x34, 
-  0xff, 0x16, 0x5c, 0xec, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x5c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5c, 0xec, 0xff, 0x16, 
-  0xff, 0x02, 0x7d, 0xc7, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xc7, 0xff, 0x02, 
-  0x00, 0x00, 0x9e, 0x8e, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0x8e, 0x00, 0x00, 
-  0x00, 0x00, 0xdf, 0x49, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0x49, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x0f, 0x5d, 0xe4, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xe4, 0xff, 0x0f, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9e, 0x97, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0x97, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x37, 0x3c, 0xfc, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfc, 0xff, 0x37, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x7d, 0xbb, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xbb, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x45, 0x3c, 0xfe, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfe, 0xdf, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x7d, 0xb3, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x9e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xb3, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x3c, 0xf3, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xf3, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0x7a, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0xbe, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x7d, 0xbb, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xbb, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x5d, 0xe0, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xe0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3a, 0x3c, 0xef, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xff, 0x7d, 0xff, 0x9e, 0xff, 0xbe, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0x5d, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xef, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x3c, 0xf3, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xf3, 0xdf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x3c, 0xef, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xef, 0xdf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3b, 0x5d, 0xde, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xde, 0xdf, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x20, 0x7d, 0xb9, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xb9, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0xbe, 0x7a, 0x3c, 0xf2, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xf2, 0xbe, 0x7a, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x30, 0x7d, 0xb0, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x7d, 0xb0, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x47, 0x7d, 0xb8, 0x3c, 0xfc, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfc, 0x7d, 0xb8, 0xdf, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x39, 0x9e, 0x96, 0x5d, 0xe1, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x5d, 0xe1, 0x9e, 0x96, 0xdf, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x11, 0xdf, 0x4a, 0x9e, 0x8d, 0x7d, 0xc6, 0x5c, 0xeb, 0x3c, 0xfe, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xff, 0x3c, 0xfe, 0x5c, 0xeb, 0x7d, 0xc6, 0x9e, 0x8d, 0xdf, 0x4a, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0xff, 0x34, 0xdf, 0x51, 0xbe, 0x6a, 0x9e, 0x8f, 0x5d, 0xed, 0x5d, 0xed, 0x9e, 0x8f, 0xbe, 0x6a, 0xdf, 0x51, 0xff, 0x34, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x04, 0xff, 0x16, 0xff, 0x34, 0xdf, 0x51, 0xbe, 0x6a, 0x9e, 0x8f, 0x81, 0x5d, 0xed, 0x04, 0x9e, 0x8f, 0xbe, 0x6a, 0xdf, 0x51, 0xff, 0x34, 0xff, 0x16, 0xab, 0x00, 0x00, 0x05, 
+  0xff, 0x11, 0xdf, 0x4a, 0x9e, 0x8d, 0x7d, 0xc6, 0x5c, 0xeb, 0x3c, 0xfe, 0x87, 0x3c, 0xff, 0x05, 0x3c, 0xfe, 0x5c, 0xeb, 0x7d, 0xc6, 0x9e, 0x8d, 0xdf, 0x4a, 0xff, 0x11, 0xa5, 0x00, 0x00, 0x02, 
+  0xdf, 0x39, 0x9e, 0x96, 0x5d, 0xe1, 0x91, 0x3c, 0xff, 0x02, 0x5d, 0xe1, 0x9e, 0x96, 0xdf, 0x39, 0xa1, 0x00, 0x00, 0x02, 0xdf, 0x47, 0x7d, 0xb8, 0x3c, 0xfc, 0x95, 0x3c, 0xff, 0x02, 0x3c, 0xfc, 
+  0x7d, 0xb8, 0xdf, 0x47, 0x9d, 0x00, 0x00, 0x01, 0xff, 0x30, 0x7d, 0xb0, 0x9b, 0x3c, 0xff, 0x01, 0x7d, 0xb0, 0xff, 0x30, 0x99, 0x00, 0x00, 0x02, 0xff, 0x06, 0xbe, 0x7a, 0x3c, 0xf2, 0x9d, 0x3c, 
+  0xff, 0x02, 0x3c, 0xf2, 0xbe, 0x7a, 0xff, 0x06, 0x96, 0x00, 0x00, 0x01, 0xff, 0x20, 0x7d, 0xb9, 0xa1, 0x3c, 0xff, 0x01, 0x7d, 0xb9, 0xff, 0x20, 0x94, 0x00, 0x00, 0x01, 0xdf, 0x3b, 0x5d, 0xde, 
+  0xa3, 0x3c, 0xff, 0x01, 0x5d, 0xde, 0xdf, 0x3b, 0x92, 0x00, 0x00, 0x01, 0xdf, 0x4b, 0x3c, 0xef, 0xa5, 0x3c, 0xff, 0x01, 0x3c, 0xef, 0xdf, 0x4b, 0x90, 0x00, 0x00, 0x01, 0xdf, 0x4b, 0x3c, 0xf3, 
+  0xa7, 0x3c, 0xff, 0x01, 0x3c, 0xf3, 0xdf, 0x4b, 0x8e, 0x00, 0x00, 0x01, 0xdf, 0x3a, 0x3c, 0xef, 0x87, 0x3c, 0xff, 0x04, 0x5d, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0x9e, 0xff, 0x9c, 0x3c, 
+  0xff, 0x01, 0x3c, 0xef, 0xdf, 0x3a, 0x8c, 0x00, 0x00, 0x01, 0xff, 0x1f, 0x5d, 0xe0, 0x84, 0x3c, 0xff, 0x03, 0x5c, 0xff, 0x7d, 0xff, 0xbe, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x00, 0xbe, 0xff, 
+  0x9c, 0x3c, 0xff, 0x01, 0x5d, 0xe0, 0xff, 0x1f, 0x8a, 0x00, 0x00, 0x01, 0xff, 0x06, 0x7d, 0xbb, 0x83, 0x3c, 0xff, 0x01, 0x7d, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 0x00, 0x5d, 0xff, 0x9c, 0x3c, 
+  0xff, 0x01, 0x7d, 0xbb, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0xbe, 0x7a, 0x83, 0x3c, 0xff, 0x00, 0x5d, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x9d, 0x3c, 0xff, 0x00, 0xbe, 0x7a, 0x88, 0x00, 
+  0x00, 0x01, 0xff, 0x2d, 0x3c, 0xf3, 0x83, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x8c, 0xff, 0xff, 0x9d, 0x3c, 0xff, 0x01, 0x3c, 0xf3, 0xff, 0x2d, 0x86, 0x00, 0x00, 0x01, 0xff, 0x01, 0x7d, 0xb3, 0x84, 
+  0x3c, 0xff, 0x00, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0x00, 0x9e, 0xff, 0x9d, 0x3c, 0xff, 0x01, 0x7d, 0xb3, 0xff, 0x01, 0x85, 0x00, 0x00, 0x01, 0xdf, 0x45, 0x3c, 0xfe, 0x84, 0x3c, 0xff, 0x00, 0xdf, 
+  0xff, 0x8c, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x9d, 0x3c, 0xff, 0x01, 0x3c, 0xfe, 0xdf, 0x45, 0x84, 0x00, 0x00, 0x01, 0xff, 0x02, 0x7d, 0xbb, 0x85, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x8d, 0xff, 0xff, 
+  0x00, 0x7d, 0xff, 0x9d, 0x3c, 0xff, 0x01, 0x7d, 0xbb, 0xff, 0x02, 0x83, 0x00, 0x00, 0x01, 0xff, 0x37, 0x3c, 0xfc, 0x85, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xbf, 0xff, 0x9d, 
+  0x3c, 0xff, 0x01, 0x3c, 0xfc, 0xff, 0x37, 0x83, 0x00, 0x00, 0x00, 0x9e, 0x97, 0x86, 0x3c, 0xff, 0x00, 0x9e, 0xff, 0x8e, 0xff, 0xff, 0x00, 0x5d, 0xff, 0x9d, 0x3c, 0xff, 0x00, 0x9e, 0x97, 0x82, 
+  0x00, 0x00, 0x01, 0xff, 0x0f, 0x5d, 0xe4, 0x86, 0x3c, 0xff, 0x00, 0x7d, 0xff, 0x8e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0x9d, 0x3c, 0xff, 0x01, 0x5d, 0xe4, 0xff, 0x0f, 0x81, 0x00, 0x00, 0x00, 0xdf, 
+  0x49, 0x87, 0x3c, 0xff, 0x00, 0x5d, 0xff, 0x8e, 0xff, 0xff, 0x00, 0x7d, 0xff, 0x9e, 0x3c, 0xff, 0x00, 0xdf, 0x49, 0x81, 0x00, 0x00, 0x00, 0x9e, 0x8e, 0x88, 0x3c, 0xff, 0x8d, 0xff, 0xff, 0x00, 
+  0xdf, 0xff, 0x9f, 0x3c, 0xff, 0x03, 0x9e, 0x8e, 0x00, 0x00, 0xff, 0x02, 0x7d, 0xc7, 0x88, 0x3c, 0xff, 0x00, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xa0, 0x3c, 0xff, 0x03, 0x7d, 0xc7, 
+  0xff, 0x02, 0xff, 0x16, 0x5c, 0xec, 0x88, 0x3c, 0xff, 0x00, 0x9e, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xa1, 0x3c, 0xff, 0x03, 0x5c, 0xec, 0xff, 0x16, 0xff, 0x34, 0x3c, 0xfd, 0x88, 0x3c, 
+  0xff, 0x00, 0x5d, 0xff, 0x89, 0xff, 0xff, 0x00, 0x9e, 0xff, 0xa2, 0x3c, 0xff, 0x02, 0x3c, 0xfd, 0xff, 0x34, 0xdf, 0x52, 0x8a, 0x3c, 0xff, 0x00, 0xdf, 0xff, 0x87, 0xff, 0xff, 0x00, 0xbe, 0xff, 
+  0xa4, 0x3c, 0xff, 0x01, 0xdf, 0x51, 0xbe, 0x68, 0x8a, 0x3c, 0xff, 0x00, 0x9e, 0xff, 0x88, 0xff, 0xff, 0x00, 0x5d, 0xff, 0xa3, 0x3c, 0xff, 0x01, 0xbe, 0x68, 0x9e, 0x90, 0x8a, 0x3c, 0xff, 0x00, 
+  0x5d, 0xff, 0x88, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xa3, 0x3c, 0xff, 0x01, 0x9e, 0x90, 0x5d, 0xed, 0x8b, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x88, 0xff, 0xff, 0x00, 0x7d, 0xff, 0xa2, 0x3c, 0xff, 0x81, 
+  0x5d, 0xed, 0x8b, 0x3c, 0xff, 0x00, 0x5d, 0xff, 0x89, 0xff, 0xff, 0x00, 0x5c, 0xff, 0xa1, 0x3c, 0xff, 0x01, 0x5d, 0xed, 0x9e, 0x8f, 0x8c, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x88, 0xff, 0xff, 0x00, 
+  0xdf, 0xff, 0xa1, 0x3c, 0xff, 0x01, 0x9e, 0x8f, 0xbe, 0x68, 0x8c, 0x3c, 0xff, 0x00, 0x5d, 0xff, 0x89, 0xff, 0xff, 0x00, 0xbe, 0xff, 0xa0, 0x3c, 0xff, 0x01, 0xbe, 0x68, 0xdf, 0x51, 0x8d, 0x3c, 
+  0xff, 0x00, 0x9e, 0xff, 0x89, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x8a, 0x3c, 0xff, 0x81, 0x7d, 0xff, 0x00, 0x5d, 0xff, 0x91, 0x3c, 0xff, 0x02, 0xdf, 0x51, 0xff, 0x34, 0x3c, 0xfd, 0x8d, 0x3c, 0xff, 
+  0x00, 0xdf, 0xff, 0x89, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x88, 0x3c, 0xff, 0x00, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x01, 0xbe, 0xff, 0x7d, 0xff, 0x8e, 0x3c, 0xff, 0x03, 0x3c, 0xfd, 0xff, 0x34, 0xff, 
+  0x16, 0x5c, 0xec, 0x8d, 0x3c, 0xff, 0x00, 0x5d, 0xff, 0x8a, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x5c, 0xff, 0x85, 0x3c, 0xff, 0x00, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x9e, 0xff, 0x8c, 
+  0x3c, 0xff, 0x03, 0x5c, 0xec, 0xff, 0x16, 0xff, 0x02, 0x7d, 0xc7, 0x8e, 0x3c, 0xff, 0x00, 0x9d, 0xff, 0x8b, 0xff, 0xff, 0x00, 0x7d, 0xff, 0x83, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x89, 0xff, 0xff, 
+  0x01, 0xbe, 0xff, 0x5d, 0xff, 0x89, 0x3c, 0xff, 0x03, 0x7d, 0xc7, 0xff, 0x02, 0x00, 0x00, 0x9e, 0x8e, 0x8f, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x8b, 0xff, 0xff, 0x03, 0xbe, 0xff, 0x5d, 0xff, 0x3c, 
+  0xff, 0x9e, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x88, 0x3c, 0xff, 0x00, 0x9e, 0x8e, 0x81, 0x00, 0x00, 0x00, 0xdf, 0x49, 0x90, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xbe, 
+  0xff, 0x8e, 0xff, 0xff, 0x00, 0x9d, 0xff, 0x87, 0x3c, 0xff, 0x00, 0xdf, 0x49, 0x81, 0x00, 0x00, 0x01, 0xff, 0x0f, 0x5d, 0xe4, 0x90, 0x3c, 0xff, 0x00, 0xdf, 0xff, 0x9b, 0xff, 0xff, 0x00, 0xdf, 
+  0xff, 0x86, 0x3c, 0xff, 0x01, 0x5d, 0xe4, 0xff, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x9e, 0x97, 0x91, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x9a, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x86, 0x3c, 0xff, 0x00, 0x9e, 
+  0x97, 0x83, 0x00, 0x00, 0x01, 0xff, 0x37, 0x3c, 0xfc, 0x91, 0x3c, 0xff, 0x00, 0xbe, 0xff, 0x99, 0xff, 0xff, 0x00, 0x7d, 0xff, 0x85, 0x3c, 0xff, 0x01, 0x3c, 0xfc, 0xff, 0x37, 0x83, 0x00, 0x00, 
+  0x01, 0xff, 0x02, 0x7d, 0xbb, 0x92, 0x3c, 0xff, 0x00, 0x9d, 0xff, 0x98, 0xff, 0xff, 0x00, 0x5d, 0xff, 0x85, 0x3c, 0xff, 0x01, 0x7d, 0xbb, 0xff, 0x02, 0x84, 0x00, 0x00, 0x01, 0xdf, 0x45, 0x3c, 
+  0xfe, 0x92, 0x3c, 0xff, 0x01, 0x5d, 0xff, 0xdf, 0xff, 0x95, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x85, 0x3c, 0xff, 0x01, 0x3c, 0xfe, 0xdf, 0x45, 0x85, 0x00, 0x00, 0x01, 0xff, 0x01, 0x7d, 0xb3, 0x94, 
+  0x3c, 0xff, 0x00, 0x9e, 0xff, 0x94, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x85, 0x3c, 0xff, 0x01, 0x7d, 0xb3, 0xff, 0x01, 0x86, 0x00, 0x00, 0x01, 0xff, 0x2d, 0x3c, 0xf3, 0x94, 0x3c, 0xff, 0x01, 0x5d, 
+  0xff, 0xbe, 0xff, 0x92, 0xff, 0xff, 0x00, 0x7d, 0xff, 0x84, 0x3c, 0xff, 0x01, 0x3c, 0xf3, 0xff, 0x2d, 0x88, 0x00, 0x00, 0x00, 0xbe, 0x7a, 0x96, 0x3c, 0xff, 0x01, 0x5d, 0xff, 0xbe, 0xff, 0x90, 
+  0xff, 0xff, 0x00, 0x5c, 0xff, 0x84, 0x3c, 0xff, 0x00, 0xbe, 0x7a, 0x89, 0x00, 0x00, 0x01, 0xff, 0x06, 0x7d, 0xbb, 0x97, 0x3c, 0xff, 0x02, 0x5d, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0x8c, 0xff, 0xff, 
+  0x00, 0xdf, 0xff, 0x84, 0x3c, 0xff, 0x01, 0x7d, 0xbb, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x01, 0xff, 0x1f, 0x5d, 0xe0, 0x99, 0x3c, 0xff, 0x02, 0x5d, 0xff, 0x9e, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 
+  0x00, 0x7d, 0xff, 0x83, 0x3c, 0xff, 0x01, 0x5d, 0xe0, 0xff, 0x1f, 0x8c, 0x00, 0x00, 0x01, 0xdf, 0x3a, 0x3c, 0xef, 0x9c, 0x3c, 0xff, 0x02, 0x5d, 0xff, 0x7d, 0xff, 0x9e, 0xff, 0x81, 0xbe, 0xff, 
+  0x81, 0xdf, 0xff, 0x01, 0xbe, 0xff, 0x5d, 0xff, 0x83, 0x3c, 0xff, 0x01, 0x3c, 0xef, 0xdf, 0x3a, 0x8e, 0x00, 0x00, 0x01, 0xdf, 0x4b, 0x3c, 0xf3, 0xa7, 0x3c, 0xff, 0x01, 0x3c, 0xf3, 0xdf, 0x4b, 
+  0x90, 0x00, 0x00, 0x01, 0xdf, 0x4b, 0x3c, 0xef, 0xa5, 0x3c, 0xff, 0x01, 0x3c, 0xef, 0xdf, 0x4b, 0x92, 0x00, 0x00, 0x01, 0xdf, 0x3b, 0x5d, 0xde, 0xa3, 0x3c, 0xff, 0x01, 0x5d, 0xde, 0xdf, 0x3b, 
+  0x94, 0x00, 0x00, 0x01, 0xff, 0x20, 0x7d, 0xb9, 0xa1, 0x3c, 0xff, 0x01, 0x7d, 0xb9, 0xff, 0x20, 0x96, 0x00, 0x00, 0x02, 0xff, 0x06, 0xbe, 0x7a, 0x3c, 0xf2, 0x9d, 0x3c, 0xff, 0x02, 0x3c, 0xf2, 
+  0xbe, 0x7a, 0xff, 0x06, 0x99, 0x00, 0x00, 0x01, 0xff, 0x30, 0x7d, 0xb0, 0x9b, 0x3c, 0xff, 0x01, 0x7d, 0xb0, 0xff, 0x30, 0x9d, 0x00, 0x00, 0x02, 0xdf, 0x47, 0x7d, 0xb8, 0x3c, 0xfc, 0x95, 0x3c, 
+  0xff, 0x02, 0x3c, 0xfc, 0x7d, 0xb8, 0xdf, 0x47, 0xa1, 0x00, 0x00, 0x02, 0xdf, 0x39, 0x9e, 0x96, 0x5d, 0xe1, 0x91, 0x3c, 0xff, 0x02, 0x5d, 0xe1, 0x9e, 0x96, 0xdf, 0x39, 0xa5, 0x00, 0x00, 0x05, 
+  0xff, 0x11, 0xdf, 0x4a, 0x9e, 0x8d, 0x7d, 0xc6, 0x5c, 0xeb, 0x3c, 0xfe, 0x87, 0x3c, 0xff, 0x05, 0x3c, 0xfe, 0x5c, 0xeb, 0x7d, 0xc6, 0x9e, 0x8d, 0xdf, 0x4a, 0xff, 0x11, 0xab, 0x00, 0x00, 0x04, 
+  0xff, 0x16, 0xff, 0x34, 0xdf, 0x51, 0xbe, 0x6a, 0x9e, 0x8f, 0x81, 0x5d, 0xed, 0x04, 0x9e, 0x8f, 0xbe, 0x6a, 0xdf, 0x51, 0xff, 0x34, 0xff, 0x16, 0x97, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
   /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xef, 0x16, 0xfa, 0xd7, 0x34, 0xf6, 0xbf, 0x51, 0xf3, 0xaf, 0x6a, 0xf0, 0x97, 0x8f, 0xe5, 0x47, 0xed, 0xe5, 0x47, 0xed, 0xf0, 0x97, 0x8f, 0xf3, 0xaf, 0x6a, 0xf6, 0xbf, 0x51, 0xfa, 0xd7, 0x34, 0xfd, 0xef, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf7, 0x11, 0xf7, 0xc7, 0x4a, 0xef, 0x8f, 0x8d, 0xe8, 0x57, 0xc6, 0xe3, 0x37, 0xeb, 0xe1, 0x27, 0xfe, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xfe, 0xe3, 0x37, 0xeb, 0xe8, 0x57, 0xc6, 0xef, 0x8f, 0x8d, 0xf7, 0xc7, 0x4a, 0xfe, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xd7, 0x39, 0xee, 0x87, 0x96, 0xe4, 0x3f, 0xe1, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xe1, 0xee, 0x87, 0x96, 0xf9, 0xd7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc7, 0x47, 0xe9, 0x67, 0xb8, 0xe1, 0x27, 0xfc, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xfc, 0xe9, 0x67, 0xb8, 0xf7, 0xc7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xdf, 0x30, 0xea, 0x6f, 0xb0, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xea, 0x6f, 0xb0, 0xfb, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0xf1, 0x9f, 0x7a, 0xe2, 0x2f, 0xf2, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe2, 0x2f, 0xf2, 0xf1, 0x9f, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xef, 0x20, 0xe9, 0x67, 0xb9, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xb9, 0xfc, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xcf, 0x3b, 0xe5, 0x3f, 0xde, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe5, 0x3f, 0xde, 0xf9, 0xcf, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc7, 0x4b, 0xe3, 0x37, 0xef, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe3, 0x37, 0xef, 0xf7, 0xc7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc7, 0x4b, 0xe2, 0x2f, 0xf3, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe2, 0x2f, 0xf3, 0xf7, 0xc7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xd7, 0x3a, 0xe2, 0x37, 0xef, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe5, 0x47, 0xff, 0xec, 0x77, 0xff, 0xf3, 0xaf, 0xff, 0xf5, 0xb7, 0xff, 0xec, 0x77, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe2, 0x37, 0xef, 0xf9, 0xd7, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xef, 0x1f, 0xe5, 0x3f, 0xe0, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe3, 0x37, 0xff, 0xe9, 0x5f, 0xff, 0xf1, 0x9f, 0xff, 0xf9, 0xd7, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe5, 0x3f, 0xe0, 0xfc, 0xef, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0xe9, 0x67, 0xbb, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe8, 0x57, 0xff, 0xf6, 0xbf, 0xff, 0xfd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe6, 0x4f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x9f, 0x7a, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe7, 0x4f, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xdf, 0x2d, 0xe2, 0x2f, 0xf3, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf3, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe2, 0x2f, 0xf3, 0xfb, 0xdf, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xea, 0x6f, 0xb3, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0x7f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xea, 0x6f, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xcf, 0x45, 0xe1, 0x27, 0xfe, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf5, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xd7, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xfe, 0xf8, 0xcf, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xe9, 0x67, 0xbb, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xd7, 0x37, 0xe1, 0x27, 0xfc, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xaf, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xfc, 0xfa, 0xd7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x87, 0x97, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xe4, 0x3f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0xf7, 0x0f, 0xe4, 0x3f, 0xe4, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xea, 0x67, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0x6f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xe4, 0xfe, 0xf7, 0x0f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf7, 0xc7, 0x49, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xf7, 0xc7, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xef, 0x8f, 0x8e, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe2, 0x2f, 0xff, 0xfc, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xc7, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xef, 0x8f, 0x8e, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x02, 0xe8, 0x57, 0xc7, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe8, 0x57, 0xc7, 0xff, 0xff, 0x02, 
-  0xfd, 0xef, 0x16, 0xe3, 0x37, 0xec, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9f, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe3, 0x37, 0xec, 0xfd, 0xef, 0x16, 
-  0xfa, 0xd7, 0x34, 0xe1, 0x27, 0xfd, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xec, 0x77, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xfd, 0xfa, 0xd7, 0x34, 
-  0xf6, 0xbf, 0x52, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf9, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xe0, 0x17, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0x51, 
-  0xf3, 0xaf, 0x68, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xe4, 0x3f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf3, 0xaf, 0x68, 
-  0xf0, 0x97, 0x90, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0x97, 0x90, 
-  0xe5, 0x47, 0xed, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe5, 0x47, 0xed, 
-  0xe5, 0x47, 0xed, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe7, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe5, 0x47, 0xed, 
-  0xf0, 0x97, 0x8f, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf0, 0x97, 0x8f, 
-  0xf3, 0xaf, 0x68, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe5, 0x47, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf3, 0xaf, 0x68, 
-  0xf6, 0xbf, 0x51, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xef, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x97, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe8, 0x5f, 0xff, 0xea, 0x67, 0xff, 0xe4, 0x3f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0x51, 
-  0xfa, 0xd7, 0x34, 0xe1, 0x27, 0xfd, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf9, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe3, 0x37, 0xff, 0xf7, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xf4, 0xaf, 0xff, 0xe8, 0x57, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xfd, 0xfa, 0xd7, 0x34, 
-  0xfd, 0xef, 0x16, 0xe3, 0x37, 0xec, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe6, 0x4f, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf6, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xcf, 0xff, 0xec, 0x77, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe3, 0x37, 0xec, 0xfd, 0xef, 0x16, 
-  0xff, 0xff, 0x02, 0xe8, 0x57, 0xc7, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xec, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xe7, 0xff, 0xe9, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xef, 0xff, 0xf1, 0x9f, 0xff, 0xe6, 0x4f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe8, 0x57, 0xc7, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0xef, 0x8f, 0x8e, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xa7, 0xff, 0xe4, 0x3f, 0xff, 0xe0, 0x17, 0xff, 0xec, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0x9f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xef, 0x8f, 0x8e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf7, 0xc7, 0x49, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xf7, 0xff, 0xf3, 0xa7, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x77, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xf7, 0xc7, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0xf7, 0x0f, 0xe4, 0x3f, 0xe4, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf5, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xb7, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xe4, 0xfe, 0xf7, 0x0f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xee, 0x87, 0x97, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf4, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xaf, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfa, 0xd7, 0x37, 0xe1, 0x27, 0xfc, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf1, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x77, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xfc, 0xfa, 0xd7, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xe9, 0x67, 0xbb, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xec, 0x77, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xe5, 0x47, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf8, 0xcf, 0x45, 0xe1, 0x27, 0xfe, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe6, 0x4f, 0xff, 0xf8, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xd7, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xfe, 0xf8, 0xcf, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xea, 0x6f, 0xb3, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xef, 0x8f, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1, 0x9f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xea, 0x6f, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xdf, 0x2d, 0xe2, 0x2f, 0xf3, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe5, 0x47, 0xff, 0xf3, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe2, 0x2f, 0xf3, 0xfb, 0xdf, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf1, 0x9f, 0x7a, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe6, 0x4f, 0xff, 0xf3, 0xaf, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0xe9, 0x67, 0xbb, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe4, 0x3f, 0xff, 0xee, 0x87, 0xff, 0xf9, 0xd7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xbf, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xef, 0x1f, 0xe5, 0x3f, 0xe0, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0xee, 0x87, 0xff, 0xf6, 0xbf, 0xff, 0xfc, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xf7, 0xff, 0xe7, 0x57, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe5, 0x3f, 0xe0, 0xfc, 0xef, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xd7, 0x3a, 0xe2, 0x37, 0xef, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe2, 0x2f, 0xff, 0xe6, 0x47, 0xff, 0xea, 0x67, 0xff, 0xee, 0x87, 0xff, 0xf1, 0x9f, 0xff, 0xf4, 0xaf, 0xff, 0xf5, 0xb7, 0xff, 0xf6, 0xbf, 0xff, 0xf3, 0xa7, 0xff, 0xe7, 0x4f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe2, 0x37, 0xef, 0xf9, 0xd7, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc7, 0x4b, 0xe2, 0x2f, 0xf3, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe2, 0x2f, 0xf3, 0xf7, 0xc7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc7, 0x4b, 0xe3, 0x37, 0xef, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe3, 0x37, 0xef, 0xf7, 0xc7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xcf, 0x3b, 0xe5, 0x3f, 0xde, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe5, 0x3f, 0xde, 0xf9, 0xcf, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xef, 0x20, 0xe9, 0x67, 0xb9, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xb9, 0xfc, 0xef, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0xf1, 0x9f, 0x7a, 0xe2, 0x2f, 0xf2, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe2, 0x2f, 0xf2, 0xf1, 0x9f, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xdf, 0x30, 0xea, 0x6f, 0xb0, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xea, 0x6f, 0xb0, 0xfb, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xc7, 0x47, 0xe9, 0x67, 0xb8, 0xe1, 0x27, 0xfc, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xfc, 0xe9, 0x67, 0xb8, 0xf7, 0xc7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf9, 0xd7, 0x39, 0xee, 0x87, 0x96, 0xe4, 0x3f, 0xe1, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xe1, 0xee, 0x87, 0x96, 0xf9, 0xd7, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf7, 0x11, 0xf7, 0xc7, 0x4a, 0xef, 0x8f, 0x8d, 0xe8, 0x57, 0xc6, 0xe3, 0x37, 0xeb, 0xe1, 0x27, 0xfe, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xfe, 0xe3, 0x37, 0xeb, 0xe8, 0x57, 0xc6, 0xef, 0x8f, 0x8d, 0xf7, 0xc7, 0x4a, 0xfe, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xef, 0x16, 0xfa, 0xd7, 0x34, 0xf6, 0xbf, 0x51, 0xf3, 0xaf, 0x6a, 0xf0, 0x97, 0x8f, 0xe5, 0x47, 0xed, 0xe5, 0x47, 0xed, 0xf0, 0x97, 0x8f, 0xf3, 0xaf, 0x6a, 0xf6, 0xbf, 0x51, 0xfa, 0xd7, 0x34, 0xfd, 0xef, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x00, 0x04, 0xfd, 0xef, 0x16, 0xfa, 0xd7, 0x34, 0xf6, 0xbf, 0x51, 0xf3, 0xaf, 0x6a, 0xf0, 0x97, 0x8f, 0x81, 0xe5, 0x47, 0xed, 0x04, 0xf0, 0x97, 0x8f, 0xf3, 0xaf, 0x6a, 0xf6, 
+  0xbf, 0x51, 0xfa, 0xd7, 0x34, 0xfd, 0xef, 0x16, 0xab, 0x00, 0x00, 0x00, 0x05, 0xfe, 0xf7, 0x11, 0xf7, 0xc7, 0x4a, 0xef, 0x8f, 0x8d, 0xe8, 0x57, 0xc6, 0xe3, 0x37, 0xeb, 0xe1, 0x27, 0xfe, 0x82, 
+  0xe0, 0x1f, 0xff, 0x81, 0xe0, 0x27, 0xff, 0x82, 0xe0, 0x1f, 0xff, 0x05, 0xe1, 0x27, 0xfe, 0xe3, 0x37, 0xeb, 0xe8, 0x57, 0xc6, 0xef, 0x8f, 0x8d, 0xf7, 0xc7, 0x4a, 0xfe, 0xf7, 0x11, 0xa5, 0x00, 
+  0x00, 0x00, 0x03, 0xf9, 0xd7, 0x39, 0xee, 0x87, 0x96, 0xe4, 0x3f, 0xe1, 0xe0, 0x27, 0xff, 0x81, 0xe0, 0x1f, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x89, 0xe1, 0x27, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x81, 
+  0xe0, 0x1f, 0xff, 0x03, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xe1, 0xee, 0x87, 0x96, 0xf9, 0xd7, 0x39, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xf7, 0xc7, 0x47, 0xe9, 0x67, 0xb8, 0xe1, 0x27, 0xfc, 0xe0, 0x1f, 
+  0xff, 0xe0, 0x27, 0xff, 0x91, 0xe1, 0x27, 0xff, 0x04, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xfc, 0xe9, 0x67, 0xb8, 0xf7, 0xc7, 0x47, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xfb, 0xdf, 0x30, 
+  0xea, 0x6f, 0xb0, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0x97, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xea, 0x6f, 0xb0, 0xfb, 0xdf, 0x30, 0x99, 0x00, 0x00, 0x00, 0x03, 0xff, 
+  0xff, 0x06, 0xf1, 0x9f, 0x7a, 0xe2, 0x2f, 0xf2, 0xe0, 0x1f, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xe2, 0x2f, 0xf2, 0xf1, 0x9f, 0x7a, 0xff, 0xff, 0x06, 0x96, 0x00, 0x00, 0x00, 
+  0x03, 0xfc, 0xef, 0x20, 0xe9, 0x67, 0xb9, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0x9d, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xb9, 0xfc, 0xef, 0x20, 0x94, 0x00, 
+  0x00, 0x00, 0x02, 0xf9, 0xcf, 0x3b, 0xe5, 0x3f, 0xde, 0xe0, 0x1f, 0xff, 0xa1, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe5, 0x3f, 0xde, 0xf9, 0xcf, 0x3b, 0x92, 0x00, 0x00, 0x00, 0x02, 0xf7, 
+  0xc7, 0x4b, 0xe3, 0x37, 0xef, 0xe0, 0x1f, 0xff, 0xa3, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe3, 0x37, 0xef, 0xf7, 0xc7, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xc7, 0x4b, 0xe2, 0x2f, 
+  0xf3, 0xe0, 0x27, 0xff, 0x85, 0xe1, 0x27, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x83, 0xe0, 0x1f, 0xff, 0x9a, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe2, 0x2f, 0xf3, 0xf7, 0xc7, 0x4b, 0x8e, 0x00, 
+  0x00, 0x00, 0x02, 0xf9, 0xd7, 0x3a, 0xe2, 0x37, 0xef, 0xe0, 0x27, 0xff, 0x82, 0xe1, 0x27, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x81, 0xe0, 0x1f, 0xff, 0x05, 0xe1, 0x27, 0xff, 0xe5, 0x47, 0xff, 0xec, 
+  0x77, 0xff, 0xf3, 0xaf, 0xff, 0xf5, 0xb7, 0xff, 0xec, 0x77, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe2, 0x37, 0xef, 0xf9, 0xd7, 0x3a, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xef, 
+  0x1f, 0xe5, 0x3f, 0xe0, 0xe0, 0x1f, 0xff, 0x81, 0xe1, 0x27, 0xff, 0x81, 0xe0, 0x1f, 0xff, 0x04, 0xe3, 0x37, 0xff, 0xe9, 0x5f, 0xff, 0xf1, 0x9f, 0xff, 0xf9, 0xd7, 0xff, 0xfe, 0xff, 0xff, 0x83, 
+  0xff, 0xff, 0xff, 0x01, 0xf2, 0x9f, 0xff, 0xe0, 0x1f, 0xff, 0x9a, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe5, 0x3f, 0xe0, 0xfc, 0xef, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 
+  0xe9, 0x67, 0xbb, 0xe0, 0x1f, 0xff, 0x81, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xe8, 0x57, 0xff, 0xf6, 0xbf, 0xff, 0xfd, 0xef, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xe6, 0x4f, 0xff, 0xe0, 
+  0x27, 0xff, 0x9a, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x01, 0xf1, 0x9f, 0x7a, 0xe0, 0x1f, 0xff, 0x81, 0xe1, 0x27, 0xff, 0x02, 
+  0xe0, 0x27, 0xff, 0xe7, 0x4f, 0xff, 0xfe, 0xf7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xf2, 0x9f, 0xff, 0xe0, 0x1f, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0x7a, 0x88, 
+  0x00, 0x00, 0x00, 0x01, 0xfb, 0xdf, 0x2d, 0xe2, 0x2f, 0xf3, 0x82, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf3, 0xa7, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xfd, 0xef, 0xff, 0xe3, 0x37, 0xff, 
+  0xe0, 0x27, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x01, 0xe2, 0x2f, 0xf3, 0xfb, 0xdf, 0x2d, 0x86, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x01, 0xea, 0x6f, 0xb3, 0xe0, 0x1f, 0xff, 0x82, 0xe1, 0x27, 0xff, 
+  0x01, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xed, 0x7f, 0xff, 0xe0, 0x1f, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xea, 0x6f, 0xb3, 0xff, 0xff, 0x01, 
+  0x85, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xcf, 0x45, 0xe1, 0x27, 0xfe, 0x83, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf5, 0xb7, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xd7, 0xff, 0x9d, 0xe1, 
+  0x27, 0xff, 0x01, 0xe1, 0x27, 0xfe, 0xf8, 0xcf, 0x45, 0x84, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0xe9, 0x67, 0xbb, 0xe0, 0x1f, 0xff, 0x83, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf4, 
+  0xaf, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xe8, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x02, 0x83, 0x00, 0x00, 0x00, 0x01, 
+  0xfa, 0xd7, 0x37, 0xe1, 0x27, 0xfc, 0x84, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xf4, 0xaf, 0xff, 0xe0, 0x1f, 0xff, 0x9c, 0xe1, 0x27, 0xff, 
+  0x01, 0xe1, 0x27, 0xfc, 0xfa, 0xd7, 0x37, 0x83, 0x00, 0x00, 0x00, 0x01, 0xee, 0x87, 0x97, 0xe0, 0x1f, 0xff, 0x84, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0xff, 0x8d, 0xff, 0xff, 
+  0xff, 0x02, 0xfe, 0xf7, 0xff, 0xe4, 0x3f, 0xff, 0xe0, 0x27, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0x97, 0x82, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xf7, 0x0f, 0xe4, 0x3f, 
+  0xe4, 0xe0, 0x27, 0xff, 0x84, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xea, 0x67, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xea, 0x6f, 0xff, 0xe0, 0x1f, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x02, 0xe0, 
+  0x27, 0xff, 0xe4, 0x3f, 0xe4, 0xfe, 0xf7, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xc7, 0x49, 0xe0, 0x27, 0xff, 0x85, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0x8e, 0xff, 
+  0xff, 0xff, 0x01, 0xe8, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0x9c, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x27, 0xff, 0xf7, 0xc7, 0x49, 0x81, 0x00, 0x00, 0x00, 0x01, 0xef, 0x8f, 0x8e, 0xe0, 0x1f, 0xff, 0x86, 
+  0xe1, 0x27, 0xff, 0x01, 0xe2, 0x2f, 0xff, 0xfc, 0xe7, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xf7, 0xc7, 0xff, 0x9e, 0xe1, 0x27, 0xff, 0x05, 0xe0, 0x1f, 0xff, 0xef, 0x8f, 0x8e, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0x02, 0xe8, 0x57, 0xc7, 0xe0, 0x1f, 0xff, 0x86, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xf6, 0xbf, 0xff, 0xe3, 0x37, 0xff, 0xe0, 
+  0x27, 0xff, 0x9d, 0xe1, 0x27, 0xff, 0x05, 0xe0, 0x1f, 0xff, 0xe8, 0x57, 0xc7, 0xff, 0xff, 0x02, 0xfd, 0xef, 0x16, 0xe3, 0x37, 0xec, 0xe0, 0x27, 0xff, 0x86, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 
+  0xff, 0xee, 0x87, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xf1, 0x9f, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0x9e, 0xe1, 0x27, 0xff, 0x04, 0xe0, 0x27, 0xff, 0xe3, 0x37, 0xec, 0xfd, 0xef, 0x16, 
+  0xfa, 0xd7, 0x34, 0xe1, 0x27, 0xfd, 0x87, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xf7, 0xff, 0xec, 0x77, 0xff, 0xe0, 0x1f, 0xff, 0xa1, 
+  0xe1, 0x27, 0xff, 0x03, 0xe1, 0x27, 0xfd, 0xfa, 0xd7, 0x34, 0xf6, 0xbf, 0x52, 0xe0, 0x1f, 0xff, 0x89, 0xe1, 0x27, 0xff, 0x00, 0xf9, 0xd7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xf3, 0xaf, 0xff, 
+  0xe0, 0x17, 0xff, 0xa2, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0x51, 0xf3, 0xaf, 0x68, 0xe0, 0x1f, 0xff, 0x88, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xee, 0x87, 0xff, 0x87, 
+  0xff, 0xff, 0xff, 0x02, 0xfd, 0xef, 0xff, 0xe4, 0x3f, 0xff, 0xe0, 0x27, 0xff, 0xa1, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xf3, 0xaf, 0x68, 0xf0, 0x97, 0x90, 0xe0, 0x1f, 0xff, 0x88, 0xe1, 
+  0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xff, 0xfe, 0xf7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xf3, 0xaf, 0xff, 0xe0, 0x1f, 0xff, 0xa1, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xf0, 
+  0x97, 0x90, 0xe5, 0x47, 0xed, 0xe0, 0x27, 0xff, 0x89, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf3, 0xaf, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xe9, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0xa0, 0xe1, 
+  0x27, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x81, 0xe5, 0x47, 0xed, 0x00, 0xe0, 0x27, 0xff, 0x89, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xfb, 0xe7, 
+  0xff, 0xe3, 0x37, 0xff, 0xe0, 0x27, 0xff, 0x9f, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x27, 0xff, 0xe5, 0x47, 0xed, 0xf0, 0x97, 0x8f, 0xe0, 0x1f, 0xff, 0x8a, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 
+  0xf4, 0xaf, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xf6, 0xbf, 0xff, 0xa0, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xf0, 0x97, 0x8f, 0xf3, 0xaf, 0x68, 0xe0, 0x1f, 0xff, 0x8a, 0xe1, 0x27, 0xff, 
+  0x02, 0xe0, 0x27, 0xff, 0xe5, 0x47, 0xff, 0xfe, 0xf7, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xf2, 0x9f, 0xff, 0xe0, 0x1f, 0xff, 0x8a, 0xe1, 0x27, 0xff, 0x81, 0xe0, 0x1f, 0xff, 0x00, 0xe0, 0x27, 
+  0xff, 0x90, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xf3, 0xaf, 0x68, 0xf6, 0xbf, 0x51, 0xe0, 0x1f, 0xff, 0x8b, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xef, 0x8f, 0xff, 0x89, 0xff, 0xff, 
+  0xff, 0x01, 0xf1, 0x97, 0xff, 0xe0, 0x1f, 0xff, 0x87, 0xe1, 0x27, 0xff, 0x04, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe8, 0x5f, 0xff, 0xea, 0x67, 0xff, 0xe4, 0x3f, 0xff, 0x81, 0xe0, 0x1f, 0xff, 
+  0x8e, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xf6, 0xbf, 0x51, 0xfa, 0xd7, 0x34, 0xe1, 0x27, 0xfd, 0x8d, 0xe1, 0x27, 0xff, 0x00, 0xf9, 0xcf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xf2, 0x9f, 
+  0xff, 0xe1, 0x27, 0xff, 0xe0, 0x27, 0xff, 0x84, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe3, 0x37, 0xff, 0xf7, 0xc7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xf7, 0xff, 0xf4, 0xaf, 0xff, 
+  0xe8, 0x57, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0x8b, 0xe1, 0x27, 0xff, 0x04, 0xe1, 0x27, 0xfd, 0xfa, 0xd7, 0x34, 0xfd, 0xef, 0x16, 0xe3, 0x37, 0xec, 0xe0, 0x27, 0xff, 
+  0x8b, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe6, 0x4f, 0xff, 0xfe, 0xf7, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xf6, 0xbf, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x1f, 0xff, 0x84, 0xe1, 0x27, 0xff, 
+  0x00, 0xf6, 0xbf, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 0xf8, 0xcf, 0xff, 0xec, 0x77, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0x88, 0xe1, 0x27, 0xff, 0x05, 0xe0, 0x27, 0xff, 
+  0xe3, 0x37, 0xec, 0xfd, 0xef, 0x16, 0xff, 0xff, 0x02, 0xe8, 0x57, 0xc7, 0xe0, 0x1f, 0xff, 0x8c, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xec, 0x77, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x06, 0xfb, 
+  0xe7, 0xff, 0xe9, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0xff, 0x88, 0xff, 0xff, 0xff, 0x03, 0xfc, 0xef, 0xff, 0xf1, 0x9f, 0xff, 0xe6, 
+  0x4f, 0xff, 0xe0, 0x1f, 0xff, 0x87, 0xe1, 0x27, 0xff, 0x05, 0xe0, 0x1f, 0xff, 0xe8, 0x57, 0xc7, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0xef, 0x8f, 0x8e, 0xe0, 0x1f, 0xff, 0x8d, 0xe1, 0x27, 0xff, 
+  0x01, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0xf3, 0xa7, 0xff, 0xe4, 0x3f, 0xff, 0xe0, 0x17, 0xff, 0xec, 0x7f, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xf2, 0x9f, 0xff, 
+  0x87, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xef, 0x8f, 0x8e, 0x81, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xc7, 0x49, 0xe0, 0x27, 0xff, 0x8f, 0xe1, 0x27, 0xff, 0x00, 0xf4, 0xaf, 0xff, 0x8b, 0xff, 
+  0xff, 0xff, 0x02, 0xfd, 0xf7, 0xff, 0xf3, 0xa7, 0xff, 0xfe, 0xf7, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xec, 0x77, 0xff, 0xe0, 0x1f, 0xff, 0x85, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x27, 0xff, 0xf7, 
+  0xc7, 0x49, 0x81, 0x00, 0x00, 0x00, 0x02, 0xfe, 0xf7, 0x0f, 0xe4, 0x3f, 0xe4, 0xe0, 0x27, 0xff, 0x8d, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf5, 0xb7, 0xff, 0x9b, 0xff, 
+  0xff, 0xff, 0x01, 0xf5, 0xb7, 0xff, 0xe0, 0x1f, 0xff, 0x84, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xe4, 0xfe, 0xf7, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0xee, 0x87, 0x97, 0xe0, 
+  0x1f, 0xff, 0x8e, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf4, 0xaf, 0xff, 0x9a, 0xff, 0xff, 0xff, 0x01, 0xf3, 0xaf, 0xff, 0xe0, 0x1f, 0xff, 0x84, 0xe1, 0x27, 0xff, 0x01, 
+  0xe0, 0x1f, 0xff, 0xee, 0x87, 0x97, 0x83, 0x00, 0x00, 0x00, 0x01, 0xfa, 0xd7, 0x37, 0xe1, 0x27, 0xfc, 0x8f, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe1, 0x27, 0xff, 0xf1, 0x97, 0xff, 0x99, 
+  0xff, 0xff, 0xff, 0x01, 0xec, 0x77, 0xff, 0xe0, 0x1f, 0xff, 0x84, 0xe1, 0x27, 0xff, 0x01, 0xe1, 0x27, 0xfc, 0xfa, 0xd7, 0x37, 0x83, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0xe9, 0x67, 0xbb, 
+  0xe0, 0x1f, 0xff, 0x90, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xec, 0x77, 0xff, 0xfe, 0xf7, 0xff, 0x96, 0xff, 0xff, 0xff, 0x02, 0xfe, 0xff, 0xff, 0xe5, 0x47, 0xff, 0xe0, 0x27, 0xff, 0x83, 
+  0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x02, 0x84, 0x00, 0x00, 0x00, 0x01, 0xf8, 0xcf, 0x45, 0xe1, 0x27, 0xfe, 0x91, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 
+  0xe6, 0x4f, 0xff, 0xf8, 0xcf, 0xff, 0x95, 0xff, 0xff, 0xff, 0x00, 0xf9, 0xd7, 0xff, 0x85, 0xe1, 0x27, 0xff, 0x01, 0xe1, 0x27, 0xfe, 0xf8, 0xcf, 0x45, 0x85, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0x01, 0xea, 0x6f, 0xb3, 0xe0, 0x1f, 0xff, 0x91, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xef, 0x8f, 0xff, 0xfd, 0xf7, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0xf1, 0x9f, 0xff, 
+  0xe0, 0x1f, 0xff, 0x83, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xea, 0x6f, 0xb3, 0xff, 0xff, 0x01, 0x86, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xdf, 0x2d, 0xe2, 0x2f, 0xf3, 0x93, 0xe1, 0x27, 0xff, 
+  0x02, 0xe0, 0x1f, 0xff, 0xe5, 0x47, 0xff, 0xf3, 0xaf, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0xe9, 0x5f, 0xff, 0xe0, 0x1f, 0xff, 0x83, 0xe1, 0x27, 0xff, 0x01, 0xe2, 0x2f, 0xf3, 0xfb, 0xdf, 0x2d, 
+  0x88, 0x00, 0x00, 0x00, 0x01, 0xf1, 0x9f, 0x7a, 0xe0, 0x1f, 0xff, 0x93, 0xe1, 0x27, 0xff, 0x04, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe6, 0x4f, 0xff, 0xf3, 0xaf, 0xff, 0xfe, 0xf7, 0xff, 0x8e, 
+  0xff, 0xff, 0xff, 0x02, 0xfd, 0xef, 0xff, 0xe3, 0x37, 0xff, 0xe0, 0x27, 0xff, 0x82, 0xe1, 0x27, 0xff, 0x01, 0xe0, 0x1f, 0xff, 0xf1, 0x9f, 0x7a, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 
+  0xe9, 0x67, 0xbb, 0xe0, 0x1f, 0xff, 0x94, 0xe1, 0x27, 0xff, 0x04, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe4, 0x3f, 0xff, 0xee, 0x87, 0xff, 0xf9, 0xd7, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xf6, 
+  0xbf, 0xff, 0xe0, 0x1f, 0xff, 0x82, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe9, 0x67, 0xbb, 0xff, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xfc, 0xef, 0x1f, 0xe5, 0x3f, 0xe0, 0xe0, 0x1f, 
+  0xff, 0x95, 0xe1, 0x27, 0xff, 0x06, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xff, 0xe6, 0x4f, 0xff, 0xee, 0x87, 0xff, 0xf6, 0xbf, 0xff, 0xfc, 0xe7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 
+  0xfe, 0xf7, 0xff, 0xe7, 0x57, 0xff, 0xe0, 0x1f, 0xff, 0x81, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe5, 0x3f, 0xe0, 0xfc, 0xef, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xf9, 0xd7, 0x3a, 0xe2, 
+  0x37, 0xef, 0xe0, 0x27, 0xff, 0x97, 0xe1, 0x27, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x81, 0xe0, 0x1f, 0xff, 0x0a, 0xe2, 0x2f, 0xff, 0xe6, 0x47, 0xff, 0xea, 0x67, 0xff, 0xee, 0x87, 0xff, 0xf1, 0x9f, 
+  0xff, 0xf4, 0xaf, 0xff, 0xf5, 0xb7, 0xff, 0xf6, 0xbf, 0xff, 0xf3, 0xa7, 0xff, 0xe7, 0x4f, 0xff, 0xe0, 0x1f, 0xff, 0x81, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe2, 0x37, 0xef, 0xf9, 0xd7, 
+  0x3a, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xc7, 0x4b, 0xe2, 0x2f, 0xf3, 0xe0, 0x27, 0xff, 0x9a, 0xe1, 0x27, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x86, 0xe0, 0x1f, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x81, 
+  0xe1, 0x27, 0xff, 0x02, 0xe0, 0x27, 0xff, 0xe2, 0x2f, 0xf3, 0xf7, 0xc7, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xc7, 0x4b, 0xe3, 0x37, 0xef, 0xe0, 0x1f, 0xff, 0xa3, 0xe1, 0x27, 0xff, 0x02, 
+  0xe0, 0x1f, 0xff, 0xe3, 0x37, 0xef, 0xf7, 0xc7, 0x4b, 0x92, 0x00, 0x00, 0x00, 0x02, 0xf9, 0xcf, 0x3b, 0xe5, 0x3f, 0xde, 0xe0, 0x1f, 0xff, 0xa1, 0xe1, 0x27, 0xff, 0x02, 0xe0, 0x1f, 0xff, 0xe5, 
+  0x3f, 0xde, 0xf9, 0xcf, 0x3b, 0x94, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xef, 0x20, 0xe9, 0x67, 0xb9, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0x9d, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 
+  0xff, 0xe9, 0x67, 0xb9, 0xfc, 0xef, 0x20, 0x96, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x06, 0xf1, 0x9f, 0x7a, 0xe2, 0x2f, 0xf2, 0xe0, 0x1f, 0xff, 0x9b, 0xe1, 0x27, 0xff, 0x03, 0xe0, 0x1f, 0xff, 
+  0xe2, 0x2f, 0xf2, 0xf1, 0x9f, 0x7a, 0xff, 0xff, 0x06, 0x99, 0x00, 0x00, 0x00, 0x03, 0xfb, 0xdf, 0x30, 0xea, 0x6f, 0xb0, 0xe1, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0x97, 0xe1, 0x27, 0xff, 0x03, 0xe0, 
+  0x1f, 0xff, 0xe1, 0x27, 0xff, 0xea, 0x6f, 0xb0, 0xfb, 0xdf, 0x30, 0x9d, 0x00, 0x00, 0x00, 0x04, 0xf7, 0xc7, 0x47, 0xe9, 0x67, 0xb8, 0xe1, 0x27, 0xfc, 0xe0, 0x1f, 0xff, 0xe0, 0x27, 0xff, 0x91, 
+  0xe1, 0x27, 0xff, 0x04, 0xe0, 0x27, 0xff, 0xe0, 0x1f, 0xff, 0xe1, 0x27, 0xfc, 0xe9, 0x67, 0xb8, 0xf7, 0xc7, 0x47, 0xa1, 0x00, 0x00, 0x00, 0x03, 0xf9, 0xd7, 0x39, 0xee, 0x87, 0x96, 0xe4, 0x3f, 
+  0xe1, 0xe0, 0x27, 0xff, 0x81, 0xe0, 0x1f, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x89, 0xe1, 0x27, 0xff, 0x00, 0xe0, 0x27, 0xff, 0x81, 0xe0, 0x1f, 0xff, 0x03, 0xe0, 0x27, 0xff, 0xe4, 0x3f, 0xe1, 0xee, 
+  0x87, 0x96, 0xf9, 0xd7, 0x39, 0xa5, 0x00, 0x00, 0x00, 0x05, 0xfe, 0xf7, 0x11, 0xf7, 0xc7, 0x4a, 0xef, 0x8f, 0x8d, 0xe8, 0x57, 0xc6, 0xe3, 0x37, 0xeb, 0xe1, 0x27, 0xfe, 0x82, 0xe0, 0x1f, 0xff, 
+  0x81, 0xe0, 0x27, 0xff, 0x82, 0xe0, 0x1f, 0xff, 0x05, 0xe1, 0x27, 0xfe, 0xe3, 0x37, 0xeb, 0xe8, 0x57, 0xc6, 0xef, 0x8f, 0x8d, 0xf7, 0xc7, 0x4a, 0xfe, 0xf7, 0x11, 0xab, 0x00, 0x00, 0x00, 0x04, 
+  0xfd, 0xef, 0x16, 0xfa, 0xd7, 0x34, 0xf6, 0xbf, 0x51, 0xf3, 0xaf, 0x6a, 0xf0, 0x97, 0x8f, 0x81, 0xe5, 0x47, 0xed, 0x04, 0xf0, 0x97, 0x8f, 0xf3, 0xaf, 0x6a, 0xf6, 0xbf, 0x51, 0xfa, 0xd7, 0x34, 
+  0xfd, 0xef, 0x16, 0x97, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
   /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xfd, 0x16, 0xd7, 0xfa, 0x34, 0xbf, 0xf6, 0x51, 0xaf, 0xf3, 0x6a, 0x97, 0xf0, 0x8f, 0x47, 0xe5, 0xed, 0x47, 0xe5, 0xed, 0x97, 0xf0, 0x8f, 0xaf, 0xf3, 0x6a, 0xbf, 0xf6, 0x51, 0xd7, 0xfa, 0x34, 0xef, 0xfd, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xfe, 0x11, 0xc7, 0xf7, 0x4a, 0x8f, 0xef, 0x8d, 0x57, 0xe8, 0xc6, 0x37, 0xe3, 0xeb, 0x27, 0xe1, 0xfe, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xfe, 0x37, 0xe3, 0xeb, 0x57, 0xe8, 0xc6, 0x8f, 0xef, 0x8d, 0xc7, 0xf7, 0x4a, 0xf7, 0xfe, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xf9, 0x39, 0x87, 0xee, 0x96, 0x3f, 0xe4, 0xe1, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xe1, 0x87, 0xee, 0x96, 0xd7, 0xf9, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf7, 0x47, 0x67, 0xe9, 0xb8, 0x27, 0xe1, 0xfc, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xfc, 0x67, 0xe9, 0xb8, 0xc7, 0xf7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfb, 0x30, 0x6f, 0xea, 0xb0, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x6f, 0xea, 0xb0, 0xdf, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x9f, 0xf1, 0x7a, 0x2f, 0xe2, 0xf2, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x2f, 0xe2, 0xf2, 0x9f, 0xf1, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xfc, 0x20, 0x67, 0xe9, 0xb9, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xb9, 0xef, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf9, 0x3b, 0x3f, 0xe5, 0xde, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x3f, 0xe5, 0xde, 0xcf, 0xf9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf7, 0x4b, 0x37, 0xe3, 0xef, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x37, 0xe3, 0xef, 0xc7, 0xf7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf7, 0x4b, 0x2f, 0xe2, 0xf3, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x2f, 0xe2, 0xf3, 0xc7, 0xf7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xf9, 0x3a, 0x37, 0xe2, 0xef, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x47, 0xe5, 0xff, 0x77, 0xec, 0xff, 0xaf, 0xf3, 0xff, 0xb7, 0xf5, 0xff, 0x77, 0xec, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x37, 0xe2, 0xef, 0xd7, 0xf9, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xfc, 0x1f, 0x3f, 0xe5, 0xe0, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x37, 0xe3, 0xff, 0x5f, 0xe9, 0xff, 0x9f, 0xf1, 0xff, 0xd7, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf2, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x3f, 0xe5, 0xe0, 0xef, 0xfc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x67, 0xe9, 0xbb, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x57, 0xe8, 0xff, 0xbf, 0xf6, 0xff, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4f, 0xe6, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf1, 0x7a, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x4f, 0xe7, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf2, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfb, 0x2d, 0x2f, 0xe2, 0xf3, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xa7, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0x37, 0xe3, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x2f, 0xe2, 0xf3, 0xdf, 0xfb, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x6f, 0xea, 0xb3, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xed, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x6f, 0xea, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf8, 0x45, 0x27, 0xe1, 0xfe, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xb7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xf9, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xfe, 0xcf, 0xf8, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x67, 0xe9, 0xbb, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xaf, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xe8, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfa, 0x37, 0x27, 0xe1, 0xfc, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xf4, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xfc, 0xd7, 0xfa, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xee, 0x97, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0x3f, 0xe4, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf7, 0xfe, 0x0f, 0x3f, 0xe4, 0xe4, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xea, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6f, 0xea, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xe4, 0xf7, 0xfe, 0x0f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xc7, 0xf7, 0x49, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xe8, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0xc7, 0xf7, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x8f, 0xef, 0x8e, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x2f, 0xe2, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0xf7, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x8f, 0xef, 0x8e, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x02, 0x57, 0xe8, 0xc7, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf6, 0xff, 0x37, 0xe3, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x57, 0xe8, 0xc7, 0xff, 0xff, 0x02, 
-  0xef, 0xfd, 0x16, 0x37, 0xe3, 0xec, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x37, 0xe3, 0xec, 0xef, 0xfd, 0x16, 
-  0xd7, 0xfa, 0x34, 0x27, 0xe1, 0xfd, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0x77, 0xec, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xfd, 0xd7, 0xfa, 0x34, 
-  0xbf, 0xf6, 0x52, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0xd7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xf3, 0xff, 0x17, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0x51, 
-  0xaf, 0xf3, 0x68, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0x3f, 0xe4, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xaf, 0xf3, 0x68, 
-  0x97, 0xf0, 0x90, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xf3, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x97, 0xf0, 0x90, 
-  0x47, 0xe5, 0xed, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xaf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xe9, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x47, 0xe5, 0xed, 
-  0x47, 0xe5, 0xed, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfb, 0xff, 0x37, 0xe3, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x47, 0xe5, 0xed, 
-  0x97, 0xf0, 0x8f, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xaf, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf6, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x97, 0xf0, 0x8f, 
-  0xaf, 0xf3, 0x68, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x47, 0xe5, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf2, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xaf, 0xf3, 0x68, 
-  0xbf, 0xf6, 0x51, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x8f, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xf1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x5f, 0xe8, 0xff, 0x67, 0xea, 0xff, 0x3f, 0xe4, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0x51, 
-  0xd7, 0xfa, 0x34, 0x27, 0xe1, 0xfd, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0xcf, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf2, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x37, 0xe3, 0xff, 0xc7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0xaf, 0xf4, 0xff, 0x57, 0xe8, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xfd, 0xd7, 0xfa, 0x34, 
-  0xef, 0xfd, 0x16, 0x37, 0xe3, 0xec, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf6, 0xff, 0x37, 0xe3, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0xbf, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xf8, 0xff, 0x77, 0xec, 0xff, 0x37, 0xe3, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x37, 0xe3, 0xec, 0xef, 0xfd, 0x16, 
-  0xff, 0xff, 0x02, 0x57, 0xe8, 0xc7, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x77, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xfb, 0xff, 0x5f, 0xe9, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfc, 0xff, 0x9f, 0xf1, 0xff, 0x4f, 0xe6, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x57, 0xe8, 0xc7, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0x8f, 0xef, 0x8e, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa7, 0xf3, 0xff, 0x3f, 0xe4, 0xff, 0x17, 0xe0, 0xff, 0x7f, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf2, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x8f, 0xef, 0x8e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xc7, 0xf7, 0x49, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0xaf, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfd, 0xff, 0xa7, 0xf3, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xec, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0xc7, 0xf7, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf7, 0xfe, 0x0f, 0x3f, 0xe4, 0xe4, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0xb7, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xf5, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xe4, 0xf7, 0xfe, 0x0f, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x87, 0xee, 0x97, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0xaf, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xf3, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfa, 0x37, 0x27, 0xe1, 0xfc, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x97, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xec, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xfc, 0xd7, 0xfa, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x67, 0xe9, 0xbb, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x77, 0xec, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x47, 0xe5, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf8, 0x45, 0x27, 0xe1, 0xfe, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xcf, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xf9, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xfe, 0xcf, 0xf8, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x6f, 0xea, 0xb3, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x8f, 0xef, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xf1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x6f, 0xea, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfb, 0x2d, 0x2f, 0xe2, 0xf3, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x47, 0xe5, 0xff, 0xaf, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xe9, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x2f, 0xe2, 0xf3, 0xdf, 0xfb, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf1, 0x7a, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xaf, 0xf3, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0x37, 0xe3, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x67, 0xe9, 0xbb, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x3f, 0xe4, 0xff, 0x87, 0xee, 0xff, 0xd7, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xf6, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xfc, 0x1f, 0x3f, 0xe5, 0xe0, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x4f, 0xe6, 0xff, 0x87, 0xee, 0xff, 0xbf, 0xf6, 0xff, 0xe7, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xfe, 0xff, 0x57, 0xe7, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x3f, 0xe5, 0xe0, 0xef, 0xfc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xf9, 0x3a, 0x37, 0xe2, 0xef, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x2f, 0xe2, 0xff, 0x47, 0xe6, 0xff, 0x67, 0xea, 0xff, 0x87, 0xee, 0xff, 0x9f, 0xf1, 0xff, 0xaf, 0xf4, 0xff, 0xb7, 0xf5, 0xff, 0xbf, 0xf6, 0xff, 0xa7, 0xf3, 0xff, 0x4f, 0xe7, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x37, 0xe2, 0xef, 0xd7, 0xf9, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf7, 0x4b, 0x2f, 0xe2, 0xf3, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x2f, 0xe2, 0xf3, 0xc7, 0xf7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf7, 0x4b, 0x37, 0xe3, 0xef, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x37, 0xe3, 0xef, 0xc7, 0xf7, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xf9, 0x3b, 0x3f, 0xe5, 0xde, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x3f, 0xe5, 0xde, 0xcf, 0xf9, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xfc, 0x20, 0x67, 0xe9, 0xb9, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xb9, 0xef, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x9f, 0xf1, 0x7a, 0x2f, 0xe2, 0xf2, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x2f, 0xe2, 0xf2, 0x9f, 0xf1, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xfb, 0x30, 0x6f, 0xea, 0xb0, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x6f, 0xea, 0xb0, 0xdf, 0xfb, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xf7, 0x47, 0x67, 0xe9, 0xb8, 0x27, 0xe1, 0xfc, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xfc, 0x67, 0xe9, 0xb8, 0xc7, 0xf7, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xf9, 0x39, 0x87, 0xee, 0x96, 0x3f, 0xe4, 0xe1, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xe1, 0x87, 0xee, 0x96, 0xd7, 0xf9, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xfe, 0x11, 0xc7, 0xf7, 0x4a, 0x8f, 0xef, 0x8d, 0x57, 0xe8, 0xc6, 0x37, 0xe3, 0xeb, 0x27, 0xe1, 0xfe, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xfe, 0x37, 0xe3, 0xeb, 0x57, 0xe8, 0xc6, 0x8f, 0xef, 0x8d, 0xc7, 0xf7, 0x4a, 0xf7, 0xfe, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xfd, 0x16, 0xd7, 0xfa, 0x34, 0xbf, 0xf6, 0x51, 0xaf, 0xf3, 0x6a, 0x97, 0xf0, 0x8f, 0x47, 0xe5, 0xed, 0x47, 0xe5, 0xed, 0x97, 0xf0, 0x8f, 0xaf, 0xf3, 0x6a, 0xbf, 0xf6, 0x51, 0xd7, 0xfa, 0x34, 0xef, 0xfd, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x00, 0x04, 0xef, 0xfd, 0x16, 0xd7, 0xfa, 0x34, 0xbf, 0xf6, 0x51, 0xaf, 0xf3, 0x6a, 0x97, 0xf0, 0x8f, 0x81, 0x47, 0xe5, 0xed, 0x04, 0x97, 0xf0, 0x8f, 0xaf, 0xf3, 0x6a, 0xbf, 
+  0xf6, 0x51, 0xd7, 0xfa, 0x34, 0xef, 0xfd, 0x16, 0xab, 0x00, 0x00, 0x00, 0x05, 0xf7, 0xfe, 0x11, 0xc7, 0xf7, 0x4a, 0x8f, 0xef, 0x8d, 0x57, 0xe8, 0xc6, 0x37, 0xe3, 0xeb, 0x27, 0xe1, 0xfe, 0x82, 
+  0x1f, 0xe0, 0xff, 0x81, 0x27, 0xe0, 0xff, 0x82, 0x1f, 0xe0, 0xff, 0x05, 0x27, 0xe1, 0xfe, 0x37, 0xe3, 0xeb, 0x57, 0xe8, 0xc6, 0x8f, 0xef, 0x8d, 0xc7, 0xf7, 0x4a, 0xf7, 0xfe, 0x11, 0xa5, 0x00, 
+  0x00, 0x00, 0x03, 0xd7, 0xf9, 0x39, 0x87, 0xee, 0x96, 0x3f, 0xe4, 0xe1, 0x27, 0xe0, 0xff, 0x81, 0x1f, 0xe0, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x89, 0x27, 0xe1, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x81, 
+  0x1f, 0xe0, 0xff, 0x03, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xe1, 0x87, 0xee, 0x96, 0xd7, 0xf9, 0x39, 0xa1, 0x00, 0x00, 0x00, 0x04, 0xc7, 0xf7, 0x47, 0x67, 0xe9, 0xb8, 0x27, 0xe1, 0xfc, 0x1f, 0xe0, 
+  0xff, 0x27, 0xe0, 0xff, 0x91, 0x27, 0xe1, 0xff, 0x04, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xfc, 0x67, 0xe9, 0xb8, 0xc7, 0xf7, 0x47, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xfb, 0x30, 
+  0x6f, 0xea, 0xb0, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x97, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x6f, 0xea, 0xb0, 0xdf, 0xfb, 0x30, 0x99, 0x00, 0x00, 0x00, 0x03, 0xff, 
+  0xff, 0x06, 0x9f, 0xf1, 0x7a, 0x2f, 0xe2, 0xf2, 0x1f, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0x2f, 0xe2, 0xf2, 0x9f, 0xf1, 0x7a, 0xff, 0xff, 0x06, 0x96, 0x00, 0x00, 0x00, 
+  0x03, 0xef, 0xfc, 0x20, 0x67, 0xe9, 0xb9, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x9d, 0x27, 0xe1, 0xff, 0x03, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xb9, 0xef, 0xfc, 0x20, 0x94, 0x00, 
+  0x00, 0x00, 0x02, 0xcf, 0xf9, 0x3b, 0x3f, 0xe5, 0xde, 0x1f, 0xe0, 0xff, 0xa1, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x3f, 0xe5, 0xde, 0xcf, 0xf9, 0x3b, 0x92, 0x00, 0x00, 0x00, 0x02, 0xc7, 
+  0xf7, 0x4b, 0x37, 0xe3, 0xef, 0x1f, 0xe0, 0xff, 0xa3, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x37, 0xe3, 0xef, 0xc7, 0xf7, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xf7, 0x4b, 0x2f, 0xe2, 
+  0xf3, 0x27, 0xe0, 0xff, 0x85, 0x27, 0xe1, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x83, 0x1f, 0xe0, 0xff, 0x9a, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x2f, 0xe2, 0xf3, 0xc7, 0xf7, 0x4b, 0x8e, 0x00, 
+  0x00, 0x00, 0x02, 0xd7, 0xf9, 0x3a, 0x37, 0xe2, 0xef, 0x27, 0xe0, 0xff, 0x82, 0x27, 0xe1, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x81, 0x1f, 0xe0, 0xff, 0x05, 0x27, 0xe1, 0xff, 0x47, 0xe5, 0xff, 0x77, 
+  0xec, 0xff, 0xaf, 0xf3, 0xff, 0xb7, 0xf5, 0xff, 0x77, 0xec, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x37, 0xe2, 0xef, 0xd7, 0xf9, 0x3a, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xef, 0xfc, 
+  0x1f, 0x3f, 0xe5, 0xe0, 0x1f, 0xe0, 0xff, 0x81, 0x27, 0xe1, 0xff, 0x81, 0x1f, 0xe0, 0xff, 0x04, 0x37, 0xe3, 0xff, 0x5f, 0xe9, 0xff, 0x9f, 0xf1, 0xff, 0xd7, 0xf9, 0xff, 0xff, 0xfe, 0xff, 0x83, 
+  0xff, 0xff, 0xff, 0x01, 0x9f, 0xf2, 0xff, 0x1f, 0xe0, 0xff, 0x9a, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x3f, 0xe5, 0xe0, 0xef, 0xfc, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 
+  0x67, 0xe9, 0xbb, 0x1f, 0xe0, 0xff, 0x81, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0x57, 0xe8, 0xff, 0xbf, 0xf6, 0xff, 0xef, 0xfd, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x4f, 0xe6, 0xff, 0x27, 
+  0xe0, 0xff, 0x9a, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xf1, 0x7a, 0x1f, 0xe0, 0xff, 0x81, 0x27, 0xe1, 0xff, 0x02, 
+  0x27, 0xe0, 0xff, 0x4f, 0xe7, 0xff, 0xf7, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xf2, 0xff, 0x1f, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0x7a, 0x88, 
+  0x00, 0x00, 0x00, 0x01, 0xdf, 0xfb, 0x2d, 0x2f, 0xe2, 0xf3, 0x82, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0xa7, 0xf3, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xef, 0xfd, 0xff, 0x37, 0xe3, 0xff, 
+  0x27, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x01, 0x2f, 0xe2, 0xf3, 0xdf, 0xfb, 0x2d, 0x86, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x01, 0x6f, 0xea, 0xb3, 0x1f, 0xe0, 0xff, 0x82, 0x27, 0xe1, 0xff, 
+  0x01, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x7f, 0xed, 0xff, 0x1f, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x6f, 0xea, 0xb3, 0xff, 0xff, 0x01, 
+  0x85, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xf8, 0x45, 0x27, 0xe1, 0xfe, 0x83, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0xb7, 0xf5, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xf9, 0xff, 0x9d, 0x27, 
+  0xe1, 0xff, 0x01, 0x27, 0xe1, 0xfe, 0xcf, 0xf8, 0x45, 0x84, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0x67, 0xe9, 0xbb, 0x1f, 0xe0, 0xff, 0x83, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0xaf, 
+  0xf4, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x5f, 0xe8, 0xff, 0x1f, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x02, 0x83, 0x00, 0x00, 0x00, 0x01, 
+  0xd7, 0xfa, 0x37, 0x27, 0xe1, 0xfc, 0x84, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xaf, 0xf4, 0xff, 0x1f, 0xe0, 0xff, 0x9c, 0x27, 0xe1, 0xff, 
+  0x01, 0x27, 0xe1, 0xfc, 0xd7, 0xfa, 0x37, 0x83, 0x00, 0x00, 0x00, 0x01, 0x87, 0xee, 0x97, 0x1f, 0xe0, 0xff, 0x84, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0xff, 0x8d, 0xff, 0xff, 
+  0xff, 0x02, 0xf7, 0xfe, 0xff, 0x3f, 0xe4, 0xff, 0x27, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0x97, 0x82, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xfe, 0x0f, 0x3f, 0xe4, 
+  0xe4, 0x27, 0xe0, 0xff, 0x84, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x67, 0xea, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0x6f, 0xea, 0xff, 0x1f, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x02, 0x27, 
+  0xe0, 0xff, 0x3f, 0xe4, 0xe4, 0xf7, 0xfe, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x01, 0xc7, 0xf7, 0x49, 0x27, 0xe0, 0xff, 0x85, 0x27, 0xe1, 0xff, 0x01, 0x27, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0x8e, 0xff, 
+  0xff, 0xff, 0x01, 0x5f, 0xe8, 0xff, 0x1f, 0xe0, 0xff, 0x9c, 0x27, 0xe1, 0xff, 0x01, 0x27, 0xe0, 0xff, 0xc7, 0xf7, 0x49, 0x81, 0x00, 0x00, 0x00, 0x01, 0x8f, 0xef, 0x8e, 0x1f, 0xe0, 0xff, 0x86, 
+  0x27, 0xe1, 0xff, 0x01, 0x2f, 0xe2, 0xff, 0xe7, 0xfc, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0xc7, 0xf7, 0xff, 0x9e, 0x27, 0xe1, 0xff, 0x05, 0x1f, 0xe0, 0xff, 0x8f, 0xef, 0x8e, 0x00, 0x00, 0x00, 
+  0xff, 0xff, 0x02, 0x57, 0xe8, 0xc7, 0x1f, 0xe0, 0xff, 0x86, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xbf, 0xf6, 0xff, 0x37, 0xe3, 0xff, 0x27, 
+  0xe0, 0xff, 0x9d, 0x27, 0xe1, 0xff, 0x05, 0x1f, 0xe0, 0xff, 0x57, 0xe8, 0xc7, 0xff, 0xff, 0x02, 0xef, 0xfd, 0x16, 0x37, 0xe3, 0xec, 0x27, 0xe0, 0xff, 0x86, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 
+  0xff, 0x87, 0xee, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0x9f, 0xf1, 0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x9e, 0x27, 0xe1, 0xff, 0x04, 0x27, 0xe0, 0xff, 0x37, 0xe3, 0xec, 0xef, 0xfd, 0x16, 
+  0xd7, 0xfa, 0x34, 0x27, 0xe1, 0xfd, 0x87, 0x27, 0xe1, 0xff, 0x01, 0x27, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xfe, 0xff, 0x77, 0xec, 0xff, 0x1f, 0xe0, 0xff, 0xa1, 
+  0x27, 0xe1, 0xff, 0x03, 0x27, 0xe1, 0xfd, 0xd7, 0xfa, 0x34, 0xbf, 0xf6, 0x52, 0x1f, 0xe0, 0xff, 0x89, 0x27, 0xe1, 0xff, 0x00, 0xd7, 0xf9, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xaf, 0xf3, 0xff, 
+  0x17, 0xe0, 0xff, 0xa2, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0x51, 0xaf, 0xf3, 0x68, 0x1f, 0xe0, 0xff, 0x88, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x87, 0xee, 0xff, 0x87, 
+  0xff, 0xff, 0xff, 0x02, 0xef, 0xfd, 0xff, 0x3f, 0xe4, 0xff, 0x27, 0xe0, 0xff, 0xa1, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0xaf, 0xf3, 0x68, 0x97, 0xf0, 0x90, 0x1f, 0xe0, 0xff, 0x88, 0x27, 
+  0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xff, 0xf7, 0xfe, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xaf, 0xf3, 0xff, 0x1f, 0xe0, 0xff, 0xa1, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0x97, 
+  0xf0, 0x90, 0x47, 0xe5, 0xed, 0x27, 0xe0, 0xff, 0x89, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0xaf, 0xf3, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x5f, 0xe9, 0xff, 0x1f, 0xe0, 0xff, 0xa0, 0x27, 
+  0xe1, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x81, 0x47, 0xe5, 0xed, 0x00, 0x27, 0xe0, 0xff, 0x89, 0x27, 0xe1, 0xff, 0x01, 0x27, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xe7, 0xfb, 
+  0xff, 0x37, 0xe3, 0xff, 0x27, 0xe0, 0xff, 0x9f, 0x27, 0xe1, 0xff, 0x03, 0x27, 0xe0, 0xff, 0x47, 0xe5, 0xed, 0x97, 0xf0, 0x8f, 0x1f, 0xe0, 0xff, 0x8a, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 
+  0xaf, 0xf4, 0xff, 0x88, 0xff, 0xff, 0xff, 0x00, 0xbf, 0xf6, 0xff, 0xa0, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0x97, 0xf0, 0x8f, 0xaf, 0xf3, 0x68, 0x1f, 0xe0, 0xff, 0x8a, 0x27, 0xe1, 0xff, 
+  0x02, 0x27, 0xe0, 0xff, 0x47, 0xe5, 0xff, 0xf7, 0xfe, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xf2, 0xff, 0x1f, 0xe0, 0xff, 0x8a, 0x27, 0xe1, 0xff, 0x81, 0x1f, 0xe0, 0xff, 0x00, 0x27, 0xe0, 
+  0xff, 0x90, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0xaf, 0xf3, 0x68, 0xbf, 0xf6, 0x51, 0x1f, 0xe0, 0xff, 0x8b, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x8f, 0xef, 0xff, 0x89, 0xff, 0xff, 
+  0xff, 0x01, 0x97, 0xf1, 0xff, 0x1f, 0xe0, 0xff, 0x87, 0x27, 0xe1, 0xff, 0x04, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x5f, 0xe8, 0xff, 0x67, 0xea, 0xff, 0x3f, 0xe4, 0xff, 0x81, 0x1f, 0xe0, 0xff, 
+  0x8e, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0xbf, 0xf6, 0x51, 0xd7, 0xfa, 0x34, 0x27, 0xe1, 0xfd, 0x8d, 0x27, 0xe1, 0xff, 0x00, 0xcf, 0xf9, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0x9f, 0xf2, 
+  0xff, 0x27, 0xe1, 0xff, 0x27, 0xe0, 0xff, 0x84, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x37, 0xe3, 0xff, 0xc7, 0xf7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x05, 0xf7, 0xfe, 0xff, 0xaf, 0xf4, 0xff, 
+  0x57, 0xe8, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x8b, 0x27, 0xe1, 0xff, 0x04, 0x27, 0xe1, 0xfd, 0xd7, 0xfa, 0x34, 0xef, 0xfd, 0x16, 0x37, 0xe3, 0xec, 0x27, 0xe0, 0xff, 
+  0x8b, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xf7, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xbf, 0xf6, 0xff, 0x37, 0xe3, 0xff, 0x1f, 0xe0, 0xff, 0x84, 0x27, 0xe1, 0xff, 
+  0x00, 0xbf, 0xf6, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 0xcf, 0xf8, 0xff, 0x77, 0xec, 0xff, 0x37, 0xe3, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x88, 0x27, 0xe1, 0xff, 0x05, 0x27, 0xe0, 0xff, 
+  0x37, 0xe3, 0xec, 0xef, 0xfd, 0x16, 0xff, 0xff, 0x02, 0x57, 0xe8, 0xc7, 0x1f, 0xe0, 0xff, 0x8c, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x77, 0xec, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x06, 0xe7, 
+  0xfb, 0xff, 0x5f, 0xe9, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0xff, 0x88, 0xff, 0xff, 0xff, 0x03, 0xef, 0xfc, 0xff, 0x9f, 0xf1, 0xff, 0x4f, 
+  0xe6, 0xff, 0x1f, 0xe0, 0xff, 0x87, 0x27, 0xe1, 0xff, 0x05, 0x1f, 0xe0, 0xff, 0x57, 0xe8, 0xc7, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x8f, 0xef, 0x8e, 0x1f, 0xe0, 0xff, 0x8d, 0x27, 0xe1, 0xff, 
+  0x01, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0xa7, 0xf3, 0xff, 0x3f, 0xe4, 0xff, 0x17, 0xe0, 0xff, 0x7f, 0xec, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x00, 0x9f, 0xf2, 0xff, 
+  0x87, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x8f, 0xef, 0x8e, 0x81, 0x00, 0x00, 0x00, 0x01, 0xc7, 0xf7, 0x49, 0x27, 0xe0, 0xff, 0x8f, 0x27, 0xe1, 0xff, 0x00, 0xaf, 0xf4, 0xff, 0x8b, 0xff, 
+  0xff, 0xff, 0x02, 0xf7, 0xfd, 0xff, 0xa7, 0xf3, 0xff, 0xf7, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x77, 0xec, 0xff, 0x1f, 0xe0, 0xff, 0x85, 0x27, 0xe1, 0xff, 0x01, 0x27, 0xe0, 0xff, 0xc7, 
+  0xf7, 0x49, 0x81, 0x00, 0x00, 0x00, 0x02, 0xf7, 0xfe, 0x0f, 0x3f, 0xe4, 0xe4, 0x27, 0xe0, 0xff, 0x8d, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0xb7, 0xf5, 0xff, 0x9b, 0xff, 
+  0xff, 0xff, 0x01, 0xb7, 0xf5, 0xff, 0x1f, 0xe0, 0xff, 0x84, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xe4, 0xf7, 0xfe, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x01, 0x87, 0xee, 0x97, 0x1f, 
+  0xe0, 0xff, 0x8e, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0xaf, 0xf4, 0xff, 0x9a, 0xff, 0xff, 0xff, 0x01, 0xaf, 0xf3, 0xff, 0x1f, 0xe0, 0xff, 0x84, 0x27, 0xe1, 0xff, 0x01, 
+  0x1f, 0xe0, 0xff, 0x87, 0xee, 0x97, 0x83, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xfa, 0x37, 0x27, 0xe1, 0xfc, 0x8f, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x97, 0xf1, 0xff, 0x99, 
+  0xff, 0xff, 0xff, 0x01, 0x77, 0xec, 0xff, 0x1f, 0xe0, 0xff, 0x84, 0x27, 0xe1, 0xff, 0x01, 0x27, 0xe1, 0xfc, 0xd7, 0xfa, 0x37, 0x83, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0x67, 0xe9, 0xbb, 
+  0x1f, 0xe0, 0xff, 0x90, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x77, 0xec, 0xff, 0xf7, 0xfe, 0xff, 0x96, 0xff, 0xff, 0xff, 0x02, 0xff, 0xfe, 0xff, 0x47, 0xe5, 0xff, 0x27, 0xe0, 0xff, 0x83, 
+  0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x02, 0x84, 0x00, 0x00, 0x00, 0x01, 0xcf, 0xf8, 0x45, 0x27, 0xe1, 0xfe, 0x91, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 
+  0x4f, 0xe6, 0xff, 0xcf, 0xf8, 0xff, 0x95, 0xff, 0xff, 0xff, 0x00, 0xd7, 0xf9, 0xff, 0x85, 0x27, 0xe1, 0xff, 0x01, 0x27, 0xe1, 0xfe, 0xcf, 0xf8, 0x45, 0x85, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0x01, 0x6f, 0xea, 0xb3, 0x1f, 0xe0, 0xff, 0x91, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x8f, 0xef, 0xff, 0xf7, 0xfd, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xf1, 0xff, 
+  0x1f, 0xe0, 0xff, 0x83, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x6f, 0xea, 0xb3, 0xff, 0xff, 0x01, 0x86, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xfb, 0x2d, 0x2f, 0xe2, 0xf3, 0x93, 0x27, 0xe1, 0xff, 
+  0x02, 0x1f, 0xe0, 0xff, 0x47, 0xe5, 0xff, 0xaf, 0xf3, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0x5f, 0xe9, 0xff, 0x1f, 0xe0, 0xff, 0x83, 0x27, 0xe1, 0xff, 0x01, 0x2f, 0xe2, 0xf3, 0xdf, 0xfb, 0x2d, 
+  0x88, 0x00, 0x00, 0x00, 0x01, 0x9f, 0xf1, 0x7a, 0x1f, 0xe0, 0xff, 0x93, 0x27, 0xe1, 0xff, 0x04, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x4f, 0xe6, 0xff, 0xaf, 0xf3, 0xff, 0xf7, 0xfe, 0xff, 0x8e, 
+  0xff, 0xff, 0xff, 0x02, 0xef, 0xfd, 0xff, 0x37, 0xe3, 0xff, 0x27, 0xe0, 0xff, 0x82, 0x27, 0xe1, 0xff, 0x01, 0x1f, 0xe0, 0xff, 0x9f, 0xf1, 0x7a, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 
+  0x67, 0xe9, 0xbb, 0x1f, 0xe0, 0xff, 0x94, 0x27, 0xe1, 0xff, 0x04, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x3f, 0xe4, 0xff, 0x87, 0xee, 0xff, 0xd7, 0xf9, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xbf, 
+  0xf6, 0xff, 0x1f, 0xe0, 0xff, 0x82, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x67, 0xe9, 0xbb, 0xff, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xef, 0xfc, 0x1f, 0x3f, 0xe5, 0xe0, 0x1f, 0xe0, 
+  0xff, 0x95, 0x27, 0xe1, 0xff, 0x06, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xff, 0x4f, 0xe6, 0xff, 0x87, 0xee, 0xff, 0xbf, 0xf6, 0xff, 0xe7, 0xfc, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 
+  0xf7, 0xfe, 0xff, 0x57, 0xe7, 0xff, 0x1f, 0xe0, 0xff, 0x81, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x3f, 0xe5, 0xe0, 0xef, 0xfc, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xf9, 0x3a, 0x37, 
+  0xe2, 0xef, 0x27, 0xe0, 0xff, 0x97, 0x27, 0xe1, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x81, 0x1f, 0xe0, 0xff, 0x0a, 0x2f, 0xe2, 0xff, 0x47, 0xe6, 0xff, 0x67, 0xea, 0xff, 0x87, 0xee, 0xff, 0x9f, 0xf1, 
+  0xff, 0xaf, 0xf4, 0xff, 0xb7, 0xf5, 0xff, 0xbf, 0xf6, 0xff, 0xa7, 0xf3, 0xff, 0x4f, 0xe7, 0xff, 0x1f, 0xe0, 0xff, 0x81, 0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x37, 0xe2, 0xef, 0xd7, 0xf9, 
+  0x3a, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xf7, 0x4b, 0x2f, 0xe2, 0xf3, 0x27, 0xe0, 0xff, 0x9a, 0x27, 0xe1, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x86, 0x1f, 0xe0, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x81, 
+  0x27, 0xe1, 0xff, 0x02, 0x27, 0xe0, 0xff, 0x2f, 0xe2, 0xf3, 0xc7, 0xf7, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xf7, 0x4b, 0x37, 0xe3, 0xef, 0x1f, 0xe0, 0xff, 0xa3, 0x27, 0xe1, 0xff, 0x02, 
+  0x1f, 0xe0, 0xff, 0x37, 0xe3, 0xef, 0xc7, 0xf7, 0x4b, 0x92, 0x00, 0x00, 0x00, 0x02, 0xcf, 0xf9, 0x3b, 0x3f, 0xe5, 0xde, 0x1f, 0xe0, 0xff, 0xa1, 0x27, 0xe1, 0xff, 0x02, 0x1f, 0xe0, 0xff, 0x3f, 
+  0xe5, 0xde, 0xcf, 0xf9, 0x3b, 0x94, 0x00, 0x00, 0x00, 0x03, 0xef, 0xfc, 0x20, 0x67, 0xe9, 0xb9, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x9d, 0x27, 0xe1, 0xff, 0x03, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 
+  0xff, 0x67, 0xe9, 0xb9, 0xef, 0xfc, 0x20, 0x96, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x06, 0x9f, 0xf1, 0x7a, 0x2f, 0xe2, 0xf2, 0x1f, 0xe0, 0xff, 0x9b, 0x27, 0xe1, 0xff, 0x03, 0x1f, 0xe0, 0xff, 
+  0x2f, 0xe2, 0xf2, 0x9f, 0xf1, 0x7a, 0xff, 0xff, 0x06, 0x99, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xfb, 0x30, 0x6f, 0xea, 0xb0, 0x27, 0xe1, 0xff, 0x1f, 0xe0, 0xff, 0x97, 0x27, 0xe1, 0xff, 0x03, 0x1f, 
+  0xe0, 0xff, 0x27, 0xe1, 0xff, 0x6f, 0xea, 0xb0, 0xdf, 0xfb, 0x30, 0x9d, 0x00, 0x00, 0x00, 0x04, 0xc7, 0xf7, 0x47, 0x67, 0xe9, 0xb8, 0x27, 0xe1, 0xfc, 0x1f, 0xe0, 0xff, 0x27, 0xe0, 0xff, 0x91, 
+  0x27, 0xe1, 0xff, 0x04, 0x27, 0xe0, 0xff, 0x1f, 0xe0, 0xff, 0x27, 0xe1, 0xfc, 0x67, 0xe9, 0xb8, 0xc7, 0xf7, 0x47, 0xa1, 0x00, 0x00, 0x00, 0x03, 0xd7, 0xf9, 0x39, 0x87, 0xee, 0x96, 0x3f, 0xe4, 
+  0xe1, 0x27, 0xe0, 0xff, 0x81, 0x1f, 0xe0, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x89, 0x27, 0xe1, 0xff, 0x00, 0x27, 0xe0, 0xff, 0x81, 0x1f, 0xe0, 0xff, 0x03, 0x27, 0xe0, 0xff, 0x3f, 0xe4, 0xe1, 0x87, 
+  0xee, 0x96, 0xd7, 0xf9, 0x39, 0xa5, 0x00, 0x00, 0x00, 0x05, 0xf7, 0xfe, 0x11, 0xc7, 0xf7, 0x4a, 0x8f, 0xef, 0x8d, 0x57, 0xe8, 0xc6, 0x37, 0xe3, 0xeb, 0x27, 0xe1, 0xfe, 0x82, 0x1f, 0xe0, 0xff, 
+  0x81, 0x27, 0xe0, 0xff, 0x82, 0x1f, 0xe0, 0xff, 0x05, 0x27, 0xe1, 0xfe, 0x37, 0xe3, 0xeb, 0x57, 0xe8, 0xc6, 0x8f, 0xef, 0x8d, 0xc7, 0xf7, 0x4a, 0xf7, 0xfe, 0x11, 0xab, 0x00, 0x00, 0x00, 0x04, 
+  0xef, 0xfd, 0x16, 0xd7, 0xfa, 0x34, 0xbf, 0xf6, 0x51, 0xaf, 0xf3, 0x6a, 0x97, 0xf0, 0x8f, 0x81, 0x47, 0xe5, 0xed, 0x04, 0x97, 0xf0, 0x8f, 0xaf, 0xf3, 0x6a, 0xbf, 0xf6, 0x51, 0xd7, 0xfa, 0x34, 
+  0xef, 0xfd, 0x16, 0x97, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xe8, 0x16, 0xce, 0xff, 0xd3, 0x34, 0xb0, 0xff, 0xba, 0x51, 0x9a, 0xff, 0xa4, 0x6a, 0x80, 0xff, 0x8f, 0x8f, 0x27, 0xff, 0x3e, 0xed, 0x27, 0xff, 0x3e, 0xed, 0x80, 0xff, 0x8f, 0x8f, 0x9a, 0xff, 0xa4, 0x6a, 0xb0, 0xff, 0xba, 0x51, 0xce, 0xff, 0xd3, 0x34, 0xe8, 0xff, 0xe8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xff, 0xbe, 0x4a, 0x76, 0xff, 0x84, 0x8d, 0x3e, 0xff, 0x52, 0xc6, 0x1a, 0xff, 0x33, 0xeb, 0x07, 0xff, 0x22, 0xfe, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1e, 0xff, 0x03, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x07, 0xff, 0x22, 0xfe, 0x1a, 0xff, 0x33, 0xeb, 0x3e, 0xff, 0x52, 0xc6, 0x76, 0xff, 0x84, 0x8d, 0xb7, 0xff, 0xbe, 0x4a, 0xf0, 0xff, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xff, 0xce, 0x39, 0x6d, 0xff, 0x7c, 0x96, 0x22, 0xff, 0x3a, 0xe1, 0x01, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x17, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x22, 0xff, 0x3a, 0xe1, 0x6d, 0xff, 0x7c, 0x96, 0xc9, 0xff, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xff, 0xc2, 0x47, 0x4b, 0xff, 0x5d, 0xb8, 0x07, 0xff, 0x21, 0xfc, 0x00, 0xff, 0x17, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x17, 0xff, 0x07, 0xff, 0x21, 0xfc, 0x4b, 0xff, 0x5d, 0xb8, 0xbb, 0xff, 0xc2, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0xd5, 0x30, 0x53, 0xff, 0x65, 0xb0, 0x04, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x19, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x19, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x53, 0xff, 0x65, 0xb0, 0xd5, 0xff, 0xd5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x8a, 0xff, 0x94, 0x7a, 0x10, 0xff, 0x29, 0xf2, 0x00, 0xff, 0x18, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x18, 0xff, 0x10, 0xff, 0x29, 0xf2, 0x8a, 0xff, 0x94, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xe7, 0x20, 0x4a, 0xff, 0x5c, 0xb9, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5c, 0xb9, 0xdf, 0xff, 0xe7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0xcb, 0x3b, 0x25, 0xff, 0x3b, 0xde, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x25, 0xff, 0x3b, 0xde, 0xc7, 0xff, 0xcb, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xbe, 0x4b, 0x14, 0xff, 0x2c, 0xef, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x14, 0xff, 0x2c, 0xef, 0xb8, 0xff, 0xbe, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xbe, 0x4b, 0x0f, 0xff, 0x28, 0xf3, 0x01, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x19, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x0f, 0xff, 0x28, 0xf3, 0xb8, 0xff, 0xbe, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xcf, 0x3a, 0x13, 0xff, 0x2c, 0xef, 0x02, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x17, 0xff, 0x05, 0xff, 0x20, 0xff, 0x25, 0xff, 0x3d, 0xff, 0x5d, 0xff, 0x6e, 0xff, 0x9b, 0xff, 0xa6, 0xff, 0xa8, 0xff, 0xb1, 0xff, 0x61, 0xff, 0x72, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1c, 0xff, 0x13, 0xff, 0x2c, 0xef, 0xc6, 0xff, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0xe6, 0x1f, 0x24, 0xff, 0x3b, 0xe0, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x18, 0xff, 0x31, 0xff, 0x48, 0xff, 0x5b, 0xff, 0x88, 0xff, 0x94, 0xff, 0xc6, 0xff, 0xcc, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xff, 0x9a, 0xff, 0x01, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x24, 0xff, 0x3b, 0xe0, 0xde, 0xff, 0xe6, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x4a, 0xff, 0x5d, 0xbb, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x3c, 0xff, 0x51, 0xff, 0xaf, 0xff, 0xb7, 0xff, 0xe6, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0x2e, 0xff, 0x45, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5d, 0xbb, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x96, 0x7a, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1c, 0xff, 0x34, 0xff, 0x49, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xff, 0x99, 0xff, 0x00, 0xff, 0x17, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x8a, 0xff, 0x96, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xd7, 0x2d, 0x10, 0xff, 0x29, 0xf3, 0x04, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x97, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xe7, 0xff, 0x15, 0xff, 0x2e, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x10, 0xff, 0x29, 0xf3, 0xd7, 0xff, 0xd7, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x53, 0xff, 0x65, 0xb3, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1a, 0xff, 0xb0, 0xff, 0xb9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x64, 0xff, 0x75, 0xff, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x53, 0xff, 0x65, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xc4, 0x45, 0x04, 0xff, 0x1e, 0xfe, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1a, 0xff, 0xaa, 0xff, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xcc, 0xff, 0x06, 0xff, 0x20, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x04, 0xff, 0x1e, 0xfe, 0xbc, 0xff, 0xc4, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x4b, 0xff, 0x5e, 0xbb, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xa8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x3f, 0xff, 0x54, 0xff, 0x01, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x19, 0xff, 0x4b, 0xff, 0x5e, 0xbb, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xd1, 0x37, 0x07, 0xff, 0x21, 0xfc, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x8b, 0xff, 0x97, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0xff, 0xab, 0xff, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x21, 0xfc, 0xcc, 0xff, 0xd1, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x7d, 0x97, 0x00, 0xff, 0x17, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x70, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf0, 0xff, 0x22, 0xff, 0x3a, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x6e, 0xff, 0x7d, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0xee, 0x0f, 0x22, 0xff, 0x3a, 0xe4, 0x02, 0xff, 0x1d, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x19, 0xff, 0x4f, 0xff, 0x62, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x51, 0xff, 0x64, 0xff, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x22, 0xff, 0x3a, 0xe4, 0xee, 0xff, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xc0, 0x49, 0x02, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1d, 0xff, 0x2d, 0xff, 0x44, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x41, 0xff, 0x55, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1c, 0xff, 0xb9, 0xff, 0xc0, 0x49, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0x85, 0x8e, 0x00, 0xff, 0x17, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x10, 0xff, 0x2a, 0xff, 0xde, 0xff, 0xe2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xfe, 0xc1, 0xff, 0x09, 0xff, 0x23, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x77, 0xff, 0x85, 0x8e, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0xff, 0x02, 0x3e, 0xff, 0x53, 0xc7, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1a, 0xff, 0xaf, 0xff, 0xb8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xff, 0xb7, 0xff, 0x16, 0xff, 0x2e, 0xff, 0x03, 0xff, 0x1e, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x3e, 0xff, 0x53, 0xc7, 0xff, 0xff, 0xff, 0x02, 
-  0xe8, 0xff, 0xe8, 0x16, 0x1a, 0xff, 0x33, 0xec, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x70, 0xff, 0x80, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0xff, 0x96, 0xff, 0x06, 0xff, 0x20, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x1a, 0xff, 0x33, 0xec, 0xe8, 0xff, 0xe8, 0x16, 
-  0xce, 0xff, 0xd3, 0x34, 0x07, 0xff, 0x22, 0xfd, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x30, 0xff, 0x46, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xee, 0xff, 0x63, 0xff, 0x73, 0xff, 0x00, 0xff, 0x19, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x22, 0xfd, 0xce, 0xff, 0xd3, 0x34, 
-  0xb1, 0xff, 0xb7, 0x52, 0x00, 0xff, 0x1a, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x20, 0xff, 0xc8, 0xff, 0xce, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xfe, 0xa4, 0xff, 0x00, 0xff, 0x12, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1a, 0xff, 0xb0, 0xff, 0xba, 0x51, 
-  0x9a, 0xff, 0xa4, 0x68, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x73, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xeb, 0xff, 0x20, 0xff, 0x38, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x9a, 0xff, 0xa4, 0x68, 
-  0x81, 0xff, 0x8f, 0x90, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x20, 0xff, 0x39, 0xff, 0xef, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xa5, 0xff, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x81, 0xff, 0x8f, 0x90, 
-  0x26, 0xff, 0x3e, 0xed, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x9b, 0xff, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xff, 0xfb, 0xff, 0x47, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x26, 0xff, 0x3e, 0xed, 
-  0x27, 0xff, 0x3e, 0xed, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x2f, 0xff, 0x46, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xff, 0xdd, 0xff, 0x18, 0xff, 0x30, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1e, 0xff, 0x27, 0xff, 0x3e, 0xed, 
-  0x80, 0xff, 0x8f, 0x8f, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x19, 0xff, 0x9d, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xff, 0xb7, 0xff, 0x06, 0xff, 0x1f, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x80, 0xff, 0x8f, 0x8f, 
-  0x9a, 0xff, 0xa4, 0x68, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x25, 0xff, 0x3c, 0xff, 0xed, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8f, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x04, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x9a, 0xff, 0xa4, 0x68, 
-  0xb0, 0xff, 0xba, 0x51, 0x00, 0xff, 0x1a, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x76, 0xff, 0x85, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xff, 0x92, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x09, 0xff, 0x23, 0xff, 0x40, 0xff, 0x55, 0xff, 0x4f, 0xff, 0x62, 0xff, 0x21, 0xff, 0x39, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1a, 0xff, 0xb0, 0xff, 0xba, 0x51, 
-  0xce, 0xff, 0xd3, 0x34, 0x07, 0xff, 0x22, 0xfd, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x20, 0xff, 0x0a, 0xff, 0x23, 0xff, 0xc4, 0xff, 0xca, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0xff, 0x9b, 0xff, 0x05, 0xff, 0x1f, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x16, 0xff, 0x2e, 0xff, 0xb9, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xff, 0xee, 0xff, 0x9e, 0xff, 0xa8, 0xff, 0x3e, 0xff, 0x52, 0xff, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x22, 0xfd, 0xce, 0xff, 0xd3, 0x34, 
-  0xe8, 0xff, 0xe8, 0x16, 0x1a, 0xff, 0x33, 0xec, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1b, 0xff, 0x2f, 0xff, 0x45, 0xff, 0xee, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xff, 0xb6, 0xff, 0x18, 0xff, 0x30, 0xff, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x07, 0xff, 0x20, 0xff, 0xb1, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfe, 0xff, 0xc2, 0xff, 0xc9, 0xff, 0x62, 0xff, 0x73, 0xff, 0x15, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x17, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x1a, 0xff, 0x33, 0xec, 0xe8, 0xff, 0xe8, 0x16, 
-  0xff, 0xff, 0xff, 0x02, 0x3e, 0xff, 0x53, 0xc7, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x5f, 0xff, 0x70, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xff, 0xdc, 0xff, 0x48, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x19, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x05, 0xff, 0x21, 0xff, 0x00, 0xff, 0x19, 0xff, 0x8b, 0xff, 0x98, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0x8a, 0xff, 0x96, 0xff, 0x2e, 0xff, 0x44, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x3e, 0xff, 0x53, 0xc7, 0xff, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0x00, 0x77, 0xff, 0x85, 0x8e, 0x00, 0xff, 0x17, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x19, 0xff, 0x87, 0xff, 0x94, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xfc, 0xff, 0x99, 0xff, 0xa3, 0xff, 0x21, 0xff, 0x38, 0xff, 0x00, 0xff, 0x12, 0xff, 0x63, 0xff, 0x74, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0x8d, 0xfe, 0x99, 0xff, 0x06, 0xff, 0x20, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x77, 0xff, 0x85, 0x8e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb9, 0xff, 0xc0, 0x49, 0x02, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x20, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x9f, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xec, 0xff, 0x9a, 0xfe, 0xa3, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5f, 0xff, 0x71, 0xff, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1c, 0xff, 0xb9, 0xff, 0xc0, 0x49, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xee, 0xff, 0xee, 0x0f, 0x22, 0xff, 0x3a, 0xe4, 0x02, 0xff, 0x1d, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1e, 0xff, 0x09, 0xff, 0x22, 0xff, 0xa7, 0xff, 0xb1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xff, 0xb3, 0xff, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x22, 0xff, 0x3a, 0xe4, 0xee, 0xff, 0xee, 0x0f, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6e, 0xff, 0x7d, 0x97, 0x00, 0xff, 0x17, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1e, 0xff, 0x09, 0xff, 0x22, 0xff, 0x9f, 0xff, 0xa9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xff, 0xa6, 0xff, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x17, 0xff, 0x6e, 0xff, 0x7d, 0x97, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xff, 0xd1, 0x37, 0x07, 0xff, 0x21, 0xfc, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1e, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x86, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5c, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x21, 0xfc, 0xcc, 0xff, 0xd1, 0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x4b, 0xff, 0x5e, 0xbb, 0x00, 0xff, 0x19, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x20, 0xff, 0x00, 0xff, 0x19, 0xff, 0x5f, 0xff, 0x70, 0xff, 0xed, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0x24, 0xff, 0x3c, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x19, 0xff, 0x4b, 0xff, 0x5e, 0xbb, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xff, 0xc4, 0x45, 0x04, 0xff, 0x1e, 0xfe, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x30, 0xff, 0x45, 0xff, 0xc1, 0xff, 0xc8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc6, 0xff, 0xcd, 0xff, 0x05, 0xff, 0x1f, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x04, 0xff, 0x1e, 0xfe, 0xbc, 0xff, 0xc4, 0x45, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x53, 0xff, 0x65, 0xb3, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x0a, 0xff, 0x23, 0xff, 0x76, 0xff, 0x84, 0xff, 0xeb, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x87, 0xff, 0x94, 0xff, 0x00, 0xff, 0x17, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x53, 0xff, 0x65, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xff, 0xd7, 0x2d, 0x10, 0xff, 0x29, 0xf3, 0x04, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x17, 0xff, 0x26, 0xff, 0x3d, 0xff, 0x9b, 0xff, 0xa5, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x47, 0xff, 0x5b, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x10, 0xff, 0x29, 0xf3, 0xd7, 0xff, 0xd7, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8a, 0xff, 0x96, 0x7a, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x19, 0xff, 0x30, 0xff, 0x46, 0xff, 0x99, 0xff, 0xa4, 0xff, 0xec, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xff, 0xea, 0xff, 0x17, 0xff, 0x30, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x8a, 0xff, 0x96, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x4a, 0xff, 0x5d, 0xbb, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x19, 0xff, 0x21, 0xff, 0x38, 0xff, 0x72, 0xfe, 0x81, 0xff, 0xc6, 0xfe, 0xcc, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xff, 0xb9, 0xff, 0x01, 0xff, 0x1a, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5d, 0xbb, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xff, 0xe6, 0x1f, 0x24, 0xff, 0x3b, 0xe0, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x30, 0xff, 0x46, 0xff, 0x6f, 0xfe, 0x7f, 0xff, 0xae, 0xff, 0xb6, 0xff, 0xdd, 0xff, 0xe0, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xf0, 0xff, 0x3b, 0xff, 0x50, 0xff, 0x02, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x24, 0xff, 0x3b, 0xe0, 0xde, 0xff, 0xe6, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xff, 0xcf, 0x3a, 0x13, 0xff, 0x2c, 0xef, 0x02, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x10, 0xff, 0x2a, 0xff, 0x2d, 0xff, 0x43, 0xff, 0x4f, 0xff, 0x62, 0xff, 0x6f, 0xfe, 0x7e, 0xff, 0x8a, 0xff, 0x96, 0xff, 0x9d, 0xff, 0xa8, 0xff, 0xaa, 0xfe, 0xb3, 0xff, 0xae, 0xff, 0xb7, 0xff, 0x95, 0xfe, 0xa0, 0xff, 0x34, 0xff, 0x49, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1c, 0xff, 0x13, 0xff, 0x2c, 0xef, 0xc6, 0xff, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xbe, 0x4b, 0x0f, 0xff, 0x28, 0xf3, 0x01, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x01, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x0f, 0xff, 0x28, 0xf3, 0xb8, 0xff, 0xbe, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xff, 0xbe, 0x4b, 0x14, 0xff, 0x2c, 0xef, 0x00, 0xff, 0x1b, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x14, 0xff, 0x2c, 0xef, 0xb8, 0xff, 0xbe, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xff, 0xcb, 0x3b, 0x25, 0xff, 0x3b, 0xde, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x00, 0xff, 0x18, 0xff, 0x25, 0xff, 0x3b, 0xde, 0xc7, 0xff, 0xcb, 0x3b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xff, 0xe7, 0x20, 0x4a, 0xff, 0x5c, 0xb9, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5c, 0xb9, 0xdf, 0xff, 0xe7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x8a, 0xff, 0x94, 0x7a, 0x10, 0xff, 0x29, 0xf2, 0x00, 0xff, 0x18, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x18, 0xff, 0x10, 0xff, 0x29, 0xf2, 0x8a, 0xff, 0x94, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd5, 0xff, 0xd5, 0x30, 0x53, 0xff, 0x65, 0xb0, 0x04, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x19, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x19, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x53, 0xff, 0x65, 0xb0, 0xd5, 0xff, 0xd5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbb, 0xff, 0xc2, 0x47, 0x4b, 0xff, 0x5d, 0xb8, 0x07, 0xff, 0x21, 0xfc, 0x00, 0xff, 0x17, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x17, 0xff, 0x07, 0xff, 0x21, 0xfc, 0x4b, 0xff, 0x5d, 0xb8, 0xbb, 0xff, 0xc2, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xff, 0xce, 0x39, 0x6d, 0xff, 0x7c, 0x96, 0x22, 0xff, 0x3a, 0xe1, 0x01, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x06, 0xff, 0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x17, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x22, 0xff, 0x3a, 0xe1, 0x6d, 0xff, 0x7c, 0x96, 0xc9, 0xff, 0xce, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xff, 0xbe, 0x4a, 0x76, 0xff, 0x84, 0x8d, 0x3e, 0xff, 0x52, 0xc6, 0x1a, 0xff, 0x33, 0xeb, 0x07, 0xff, 0x22, 0xfe, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x07, 0xff, 0x22, 0xfe, 0x1a, 0xff, 0x33, 0xeb, 0x3e, 0xff, 0x52, 0xc6, 0x76, 0xff, 0x84, 0x8d, 0xb7, 0xff, 0xbe, 0x4a, 0xf0, 0xff, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xff, 0xe8, 0x16, 0xce, 0xff, 0xd3, 0x34, 0xb0, 0xff, 0xba, 0x51, 0x9a, 0xff, 0xa4, 0x6a, 0x80, 0xff, 0x8f, 0x8f, 0x26, 0xff, 0x3e, 0xed, 0x26, 0xff, 0x3e, 0xed, 0x80, 0xff, 0x8f, 0x8f, 0x9a, 0xff, 0xa4, 0x6a, 0xb0, 0xff, 0xba, 0x51, 0xce, 0xff, 0xd3, 0x34, 0xe8, 0xff, 0xe8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe8, 0xff, 0xe8, 0x16, 0xce, 0xff, 0xd3, 0x34, 0xb0, 0xff, 0xba, 0x51, 0x9a, 0xff, 0xa4, 0x6a, 0x80, 0xff, 0x8f, 0x8f, 0x81, 0x27, 0xff, 0x3e, 0xed, 0x04, 
+  0x80, 0xff, 0x8f, 0x8f, 0x9a, 0xff, 0xa4, 0x6a, 0xb0, 0xff, 0xba, 0x51, 0xce, 0xff, 0xd3, 0x34, 0xe8, 0xff, 0xe8, 0x16, 0xab, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xff, 
+  0xbe, 0x4a, 0x76, 0xff, 0x84, 0x8d, 0x3e, 0xff, 0x52, 0xc6, 0x1a, 0xff, 0x33, 0xeb, 0x07, 0xff, 0x22, 0xfe, 0x00, 0xff, 0x1a, 0xff, 0x81, 0x00, 0xff, 0x18, 0xff, 0x81, 0x03, 0xff, 0x1e, 0xff, 
+  0x81, 0x00, 0xff, 0x18, 0xff, 0x06, 0x00, 0xff, 0x1a, 0xff, 0x07, 0xff, 0x22, 0xfe, 0x1a, 0xff, 0x33, 0xeb, 0x3e, 0xff, 0x52, 0xc6, 0x76, 0xff, 0x84, 0x8d, 0xb7, 0xff, 0xbe, 0x4a, 0xf0, 0xff, 
+  0xf0, 0x11, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc9, 0xff, 0xce, 0x39, 0x6d, 0xff, 0x7c, 0x96, 0x22, 0xff, 0x3a, 0xe1, 0x01, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1b, 0xff, 
+  0x03, 0xff, 0x1f, 0xff, 0x05, 0xff, 0x20, 0xff, 0x87, 0x06, 0xff, 0x21, 0xff, 0x07, 0x05, 0xff, 0x20, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x17, 0xff, 0x01, 0xff, 
+  0x1c, 0xff, 0x22, 0xff, 0x3a, 0xe1, 0x6d, 0xff, 0x7c, 0x96, 0xc9, 0xff, 0xce, 0x39, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbb, 0xff, 0xc2, 0x47, 0x4b, 0xff, 0x5d, 0xb8, 0x07, 0xff, 0x21, 0xfc, 
+  0x00, 0xff, 0x17, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x91, 0x06, 0xff, 0x21, 0xff, 0x04, 0x02, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x17, 0xff, 0x07, 0xff, 0x21, 0xfc, 0x4b, 0xff, 0x5d, 0xb8, 0xbb, 0xff, 
+  0xc2, 0x47, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd5, 0xff, 0xd5, 0x30, 0x53, 0xff, 0x65, 0xb0, 0x04, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x19, 0xff, 0x05, 0xff, 0x20, 0xff, 0x95, 0x06, 0xff, 0x21, 
+  0xff, 0x04, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x19, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x53, 0xff, 0x65, 0xb0, 0xd5, 0xff, 0xd5, 0x30, 0x99, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x06, 
+  0x8a, 0xff, 0x94, 0x7a, 0x10, 0xff, 0x29, 0xf2, 0x00, 0xff, 0x18, 0xff, 0x05, 0xff, 0x20, 0xff, 0x99, 0x06, 0xff, 0x21, 0xff, 0x04, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x18, 0xff, 0x10, 0xff, 
+  0x29, 0xf2, 0x8a, 0xff, 0x94, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xff, 0xe7, 0x20, 0x4a, 0xff, 0x5c, 0xb9, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1f, 0xff, 
+  0x9d, 0x06, 0xff, 0x21, 0xff, 0x03, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5c, 0xb9, 0xdf, 0xff, 0xe7, 0x20, 0x94, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xff, 0xcb, 0x3b, 
+  0x25, 0xff, 0x3b, 0xde, 0x00, 0xff, 0x18, 0xff, 0xa1, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x18, 0xff, 0x25, 0xff, 0x3b, 0xde, 0xc7, 0xff, 0xcb, 0x3b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xb8, 0xff, 0xbe, 0x4b, 0x14, 0xff, 0x2c, 0xef, 0x00, 0xff, 0x1b, 0xff, 0xa3, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x1b, 0xff, 0x14, 0xff, 0x2c, 0xef, 0xb8, 0xff, 0xbe, 0x4b, 0x90, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0xb8, 0xff, 0xbe, 0x4b, 0x0f, 0xff, 0x28, 0xf3, 0x01, 0xff, 0x1c, 0xff, 0x84, 0x06, 0xff, 0x21, 0xff, 0x03, 0x05, 0xff, 0x20, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x00, 0xff, 
+  0x19, 0xff, 0x00, 0xff, 0x18, 0xff, 0x81, 0x00, 0xff, 0x19, 0xff, 0x00, 0x05, 0xff, 0x20, 0xff, 0x99, 0x06, 0xff, 0x21, 0xff, 0x02, 0x01, 0xff, 0x1c, 0xff, 0x0f, 0xff, 0x28, 0xf3, 0xb8, 0xff, 
+  0xbe, 0x4b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0xff, 0xcf, 0x3a, 0x13, 0xff, 0x2c, 0xef, 0x02, 0xff, 0x1c, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 0x0a, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 
+  0x1a, 0xff, 0x00, 0xff, 0x17, 0xff, 0x05, 0xff, 0x20, 0xff, 0x25, 0xff, 0x3d, 0xff, 0x5d, 0xff, 0x6e, 0xff, 0x9b, 0xff, 0xa6, 0xff, 0xa8, 0xff, 0xb1, 0xff, 0x61, 0xff, 0x72, 0xff, 0x06, 0xff, 
+  0x21, 0xff, 0x05, 0xff, 0x20, 0xff, 0x99, 0x06, 0xff, 0x21, 0xff, 0x02, 0x02, 0xff, 0x1c, 0xff, 0x13, 0xff, 0x2c, 0xef, 0xc6, 0xff, 0xcf, 0x3a, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xde, 0xff, 
+  0xe6, 0x1f, 0x24, 0xff, 0x3b, 0xe0, 0x00, 0xff, 0x1b, 0xff, 0x81, 0x06, 0xff, 0x21, 0xff, 0x81, 0x00, 0xff, 0x1b, 0xff, 0x04, 0x18, 0xff, 0x31, 0xff, 0x48, 0xff, 0x5b, 0xff, 0x88, 0xff, 0x94, 
+  0xff, 0xc6, 0xff, 0xcc, 0xff, 0xf3, 0xff, 0xf4, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0x8e, 0xff, 0x9a, 0xff, 0x01, 0xff, 0x1b, 0xff, 0x9a, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x1b, 
+  0xff, 0x24, 0xff, 0x3b, 0xe0, 0xde, 0xff, 0xe6, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x06, 0x4a, 0xff, 0x5d, 0xbb, 0x00, 0xff, 0x18, 0xff, 0x81, 0x06, 0xff, 0x21, 0xff, 
+  0x03, 0x00, 0xff, 0x1b, 0xff, 0x3c, 0xff, 0x51, 0xff, 0xaf, 0xff, 0xb7, 0xff, 0xe6, 0xff, 0xe9, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf9, 0xff, 0xfa, 0xff, 0x2e, 0xff, 0x45, 0xff, 0x01, 
+  0xff, 0x1c, 0xff, 0x9a, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5d, 0xbb, 0xff, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8a, 0xff, 0x96, 0x7a, 0x00, 
+  0xff, 0x18, 0xff, 0x81, 0x06, 0xff, 0x21, 0xff, 0x02, 0x02, 0xff, 0x1c, 0xff, 0x34, 0xff, 0x49, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x01, 0x8c, 0xff, 0x99, 0xff, 0x00, 
+  0xff, 0x17, 0xff, 0x9b, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x18, 0xff, 0x8a, 0xff, 0x96, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xff, 0xd7, 0x2d, 0x10, 0xff, 0x29, 0xf3, 0x04, 
+  0xff, 0x1f, 0xff, 0x81, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x18, 0xff, 0x97, 0xff, 0xa3, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe4, 0xff, 0xe7, 0xff, 0x15, 0xff, 0x2e, 0xff, 0x03, 
+  0xff, 0x1f, 0xff, 0x9a, 0x06, 0xff, 0x21, 0xff, 0x02, 0x04, 0xff, 0x1f, 0xff, 0x10, 0xff, 0x29, 0xf3, 0xd7, 0xff, 0xd7, 0x2d, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x01, 0x53, 
+  0xff, 0x65, 0xb3, 0x00, 0xff, 0x18, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x1a, 0xff, 0xb0, 0xff, 0xb9, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x01, 0x64, 0xff, 0x75, 0xff, 0x00, 
+  0xff, 0x18, 0xff, 0x9b, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x18, 0xff, 0x53, 0xff, 0x65, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0xff, 0xc4, 0x45, 0x04, 
+  0xff, 0x1e, 0xfe, 0x05, 0xff, 0x20, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x1a, 0xff, 0xaa, 0xff, 0xb3, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x02, 0xc6, 0xff, 0xcc, 0xff, 0x06, 
+  0xff, 0x20, 0xff, 0x05, 0xff, 0x20, 0xff, 0x9a, 0x06, 0xff, 0x21, 0xff, 0x02, 0x05, 0xff, 0x20, 0xff, 0x04, 0xff, 0x1e, 0xfe, 0xbc, 0xff, 0xc4, 0x45, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0xff, 0xff, 0x02, 0x4b, 0xff, 0x5e, 0xbb, 0x00, 0xff, 0x19, 0xff, 0x83, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x18, 0xff, 0x9e, 0xff, 0xa8, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfc, 
+  0xff, 0xfc, 0xff, 0x3f, 0xff, 0x54, 0xff, 0x01, 0xff, 0x1b, 0xff, 0x9b, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x19, 0xff, 0x4b, 0xff, 0x5e, 0xbb, 0xff, 0xff, 0xff, 0x02, 0x83, 0x00, 0x00, 
+  0x00, 0x00, 0x02, 0xcc, 0xff, 0xd1, 0x37, 0x07, 0xff, 0x21, 0xfc, 0x05, 0xff, 0x20, 0xff, 0x83, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x17, 0xff, 0x8b, 0xff, 0x97, 0xff, 0x8d, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0xa0, 0xff, 0xab, 0xff, 0x00, 0xff, 0x19, 0xff, 0x9b, 0x06, 0xff, 0x21, 0xff, 0x02, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x21, 0xfc, 0xcc, 0xff, 0xd1, 0x37, 0x83, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x6e, 0xff, 0x7d, 0x97, 0x00, 0xff, 0x17, 0xff, 0x84, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x17, 0xff, 0x70, 0xff, 0x80, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x02, 0xef, 
+  0xff, 0xf0, 0xff, 0x22, 0xff, 0x3a, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x9b, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x17, 0xff, 0x6e, 0xff, 0x7d, 0x97, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0xee, 
+  0xff, 0xee, 0x0f, 0x22, 0xff, 0x3a, 0xe4, 0x02, 0xff, 0x1d, 0xff, 0x84, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x19, 0xff, 0x4f, 0xff, 0x62, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x01, 0x51, 
+  0xff, 0x64, 0xff, 0x00, 0xff, 0x19, 0xff, 0x9b, 0x06, 0xff, 0x21, 0xff, 0x02, 0x02, 0xff, 0x1d, 0xff, 0x22, 0xff, 0x3a, 0xe4, 0xee, 0xff, 0xee, 0x0f, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9, 
+  0xff, 0xc0, 0x49, 0x02, 0xff, 0x1c, 0xff, 0x85, 0x06, 0xff, 0x21, 0xff, 0x02, 0x01, 0xff, 0x1d, 0xff, 0x2d, 0xff, 0x44, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0x41, 
+  0xff, 0x55, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x9c, 0x06, 0xff, 0x21, 0xff, 0x01, 0x02, 0xff, 0x1c, 0xff, 0xb9, 0xff, 0xc0, 0x49, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x77, 0xff, 0x85, 0x8e, 0x00, 
+  0xff, 0x17, 0xff, 0x85, 0x06, 0xff, 0x21, 0xff, 0x02, 0x04, 0xff, 0x1f, 0xff, 0x10, 0xff, 0x2a, 0xff, 0xde, 0xff, 0xe2, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 0x02, 0xba, 0xfe, 0xc1, 0xff, 0x09, 
+  0xff, 0x23, 0xff, 0x05, 0xff, 0x20, 0xff, 0x9c, 0x06, 0xff, 0x21, 0xff, 0x05, 0x00, 0xff, 0x17, 0xff, 0x77, 0xff, 0x85, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x3e, 0xff, 0x53, 
+  0xc7, 0x00, 0xff, 0x1b, 0xff, 0x86, 0x06, 0xff, 0x21, 0xff, 0x01, 0x01, 0xff, 0x1a, 0xff, 0xaf, 0xff, 0xb8, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x02, 0xaf, 0xff, 0xb7, 0xff, 0x16, 0xff, 0x2e, 
+  0xff, 0x03, 0xff, 0x1e, 0xff, 0x9d, 0x06, 0xff, 0x21, 0xff, 0x05, 0x00, 0xff, 0x1b, 0xff, 0x3e, 0xff, 0x53, 0xc7, 0xff, 0xff, 0xff, 0x02, 0xe8, 0xff, 0xe8, 0x16, 0x1a, 0xff, 0x33, 0xec, 0x03, 
+  0xff, 0x1f, 0xff, 0x86, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x18, 0xff, 0x70, 0xff, 0x80, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x02, 0x89, 0xff, 0x96, 0xff, 0x06, 0xff, 0x20, 0xff, 0x02, 
+  0xff, 0x1d, 0xff, 0x9e, 0x06, 0xff, 0x21, 0xff, 0x05, 0x03, 0xff, 0x1f, 0xff, 0x1a, 0xff, 0x33, 0xec, 0xe8, 0xff, 0xe8, 0x16, 0xce, 0xff, 0xd3, 0x34, 0x07, 0xff, 0x22, 0xfd, 0x05, 0xff, 0x20, 
+  0xff, 0x86, 0x06, 0xff, 0x21, 0xff, 0x02, 0x01, 0xff, 0x1c, 0xff, 0x30, 0xff, 0x46, 0xff, 0xf9, 0xff, 0xfa, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x03, 0xec, 0xff, 0xee, 0xff, 0x63, 0xff, 0x73, 
+  0xff, 0x00, 0xff, 0x19, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x9f, 0x06, 0xff, 0x21, 0xff, 0x04, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x22, 0xfd, 0xce, 0xff, 0xd3, 0x34, 0xb1, 0xff, 0xb7, 0x52, 0x00, 
+  0xff, 0x1a, 0xff, 0x87, 0x06, 0xff, 0x21, 0xff, 0x02, 0x05, 0xff, 0x20, 0xff, 0x06, 0xff, 0x20, 0xff, 0xc8, 0xff, 0xce, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0x99, 0xfe, 0xa4, 0xff, 0x00, 
+  0xff, 0x12, 0xff, 0xa2, 0x06, 0xff, 0x21, 0xff, 0x03, 0x00, 0xff, 0x1a, 0xff, 0xb0, 0xff, 0xba, 0x51, 0x9a, 0xff, 0xa4, 0x68, 0x00, 0xff, 0x18, 0xff, 0x88, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 
+  0xff, 0x17, 0xff, 0x73, 0xff, 0x82, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe9, 0xff, 0xeb, 0xff, 0x20, 0xff, 0x38, 0xff, 0x02, 0xff, 0x1d, 0xff, 0xa1, 0x06, 0xff, 0x21, 0xff, 0x03, 0x00, 
+  0xff, 0x18, 0xff, 0x9a, 0xff, 0xa4, 0x68, 0x81, 0xff, 0x8f, 0x90, 0x00, 0xff, 0x18, 0xff, 0x88, 0x06, 0xff, 0x21, 0xff, 0x02, 0x02, 0xff, 0x1e, 0xff, 0x20, 0xff, 0x39, 0xff, 0xef, 0xff, 0xf0, 
+  0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0x9b, 0xff, 0xa5, 0xff, 0x00, 0xff, 0x18, 0xff, 0xa1, 0x06, 0xff, 0x21, 0xff, 0x03, 0x00, 0xff, 0x18, 0xff, 0x81, 0xff, 0x8f, 0x90, 0x26, 0xff, 0x3e, 
+  0xed, 0x03, 0xff, 0x1f, 0xff, 0x89, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x18, 0xff, 0x9b, 0xff, 0xa6, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xfa, 0xff, 0xfb, 0xff, 0x47, 0xff, 0x5b, 
+  0xff, 0x00, 0xff, 0x18, 0xff, 0xa0, 0x06, 0xff, 0x21, 0xff, 0x03, 0x03, 0xff, 0x1f, 0xff, 0x26, 0xff, 0x3e, 0xed, 0x27, 0xff, 0x3e, 0xed, 0x03, 0xff, 0x1f, 0xff, 0x89, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x01, 0xff, 0x1c, 0xff, 0x2f, 0xff, 0x46, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xd9, 0xff, 0xdd, 0xff, 0x18, 0xff, 0x30, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x9f, 
+  0x06, 0xff, 0x21, 0xff, 0x03, 0x03, 0xff, 0x1e, 0xff, 0x27, 0xff, 0x3e, 0xed, 0x80, 0xff, 0x8f, 0x8f, 0x00, 0xff, 0x18, 0xff, 0x8a, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x19, 0xff, 0x9d, 
+  0xff, 0xa7, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x02, 0xae, 0xff, 0xb7, 0xff, 0x06, 0xff, 0x1f, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x9e, 0x06, 0xff, 0x21, 0xff, 0x03, 0x00, 0xff, 0x18, 0xff, 0x80, 
+  0xff, 0x8f, 0x8f, 0x9a, 0xff, 0xa4, 0x68, 0x00, 0xff, 0x18, 0xff, 0x8a, 0x06, 0xff, 0x21, 0xff, 0x02, 0x02, 0xff, 0x1d, 0xff, 0x25, 0xff, 0x3c, 0xff, 0xed, 0xff, 0xef, 0xff, 0x88, 0xff, 0xff, 
+  0xff, 0xff, 0x02, 0x8f, 0xff, 0x9b, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x04, 0xff, 0x20, 0xff, 0x88, 0x06, 0xff, 0x21, 0xff, 0x03, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x1a, 
+  0xff, 0x02, 0xff, 0x1e, 0xff, 0x90, 0x06, 0xff, 0x21, 0xff, 0x03, 0x00, 0xff, 0x18, 0xff, 0x9a, 0xff, 0xa4, 0x68, 0xb0, 0xff, 0xba, 0x51, 0x00, 0xff, 0x1a, 0xff, 0x8b, 0x06, 0xff, 0x21, 0xff, 
+  0x01, 0x00, 0xff, 0x17, 0xff, 0x76, 0xff, 0x85, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0x85, 0xff, 0x92, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x04, 0xff, 0x1f, 0xff, 0x86, 0x06, 0xff, 0x21, 0xff, 
+  0x07, 0x02, 0xff, 0x1d, 0xff, 0x09, 0xff, 0x23, 0xff, 0x40, 0xff, 0x55, 0xff, 0x4f, 0xff, 0x62, 0xff, 0x21, 0xff, 0x39, 0xff, 0x00, 0xff, 0x19, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x05, 0xff, 0x20, 
+  0xff, 0x8d, 0x06, 0xff, 0x21, 0xff, 0x04, 0x00, 0xff, 0x1a, 0xff, 0xb0, 0xff, 0xba, 0x51, 0xce, 0xff, 0xd3, 0x34, 0x07, 0xff, 0x22, 0xfd, 0x05, 0xff, 0x20, 0xff, 0x8a, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x04, 0xff, 0x20, 0xff, 0x0a, 0xff, 0x23, 0xff, 0xc4, 0xff, 0xca, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0x8e, 0xff, 0x9b, 0xff, 0x05, 0xff, 0x1f, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x84, 
+  0x06, 0xff, 0x21, 0xff, 0x02, 0x02, 0xff, 0x1d, 0xff, 0x16, 0xff, 0x2e, 0xff, 0xb9, 0xff, 0xc0, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xec, 0xff, 0xee, 0xff, 0x9e, 0xff, 0xa8, 0xff, 0x3e, 
+  0xff, 0x52, 0xff, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x8a, 0x06, 0xff, 0x21, 0xff, 0x05, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x22, 0xfd, 0xce, 0xff, 0xd3, 
+  0x34, 0xe8, 0xff, 0xe8, 0x16, 0x1a, 0xff, 0x33, 0xec, 0x03, 0xff, 0x1f, 0xff, 0x8b, 0x06, 0xff, 0x21, 0xff, 0x02, 0x01, 0xff, 0x1b, 0xff, 0x2f, 0xff, 0x45, 0xff, 0xee, 0xff, 0xf0, 0xff, 0x89, 
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xad, 0xff, 0xb6, 0xff, 0x18, 0xff, 0x30, 0xff, 0x00, 0xff, 0x19, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 0x02, 0x04, 0xff, 0x1f, 0xff, 0x07, 0xff, 0x20, 0xff, 0xb1, 
+  0xff, 0xba, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfd, 0xff, 0xfe, 0xff, 0xc2, 0xff, 0xc9, 0xff, 0x62, 0xff, 0x73, 0xff, 0x15, 0xff, 0x2e, 0xff, 0x00, 0xff, 0x17, 0xff, 0x01, 0xff, 0x1c, 
+  0xff, 0x88, 0x06, 0xff, 0x21, 0xff, 0x05, 0x03, 0xff, 0x1f, 0xff, 0x1a, 0xff, 0x33, 0xec, 0xe8, 0xff, 0xe8, 0x16, 0xff, 0xff, 0xff, 0x02, 0x3e, 0xff, 0x53, 0xc7, 0x00, 0xff, 0x1b, 0xff, 0x8c, 
+  0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x18, 0xff, 0x5f, 0xff, 0x70, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x06, 0xd7, 0xff, 0xdc, 0xff, 0x48, 0xff, 0x5b, 0xff, 0x00, 
+  0xff, 0x19, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x05, 0xff, 0x21, 0xff, 0x00, 0xff, 0x19, 0xff, 0x8b, 0xff, 0x98, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x04, 0xe0, 0xff, 0xe4, 0xff, 0x8a, 0xff, 0x96, 
+  0xff, 0x2e, 0xff, 0x44, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x05, 0xff, 0x20, 0xff, 0x86, 0x06, 0xff, 0x21, 0xff, 0x05, 0x00, 0xff, 0x1b, 0xff, 0x3e, 0xff, 0x53, 0xc7, 0xff, 0xff, 0xff, 0x02, 0x00, 
+  0x00, 0x00, 0x00, 0x77, 0xff, 0x85, 0x8e, 0x00, 0xff, 0x17, 0xff, 0x8d, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x19, 0xff, 0x87, 0xff, 0x94, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfb, 
+  0xff, 0xfc, 0xff, 0x99, 0xff, 0xa3, 0xff, 0x21, 0xff, 0x38, 0xff, 0x00, 0xff, 0x12, 0xff, 0x63, 0xff, 0x74, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf6, 0xff, 0xf7, 
+  0xff, 0x8d, 0xfe, 0x99, 0xff, 0x06, 0xff, 0x20, 0xff, 0x05, 0xff, 0x20, 0xff, 0x85, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x17, 0xff, 0x77, 0xff, 0x85, 0x8e, 0x81, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0xb9, 0xff, 0xc0, 0x49, 0x02, 0xff, 0x1c, 0xff, 0x8d, 0x06, 0xff, 0x21, 0xff, 0x02, 0x04, 0xff, 0x20, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x9f, 0xff, 0xa9, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 
+  0x02, 0xe9, 0xff, 0xec, 0xff, 0x9a, 0xfe, 0xa3, 0xff, 0xf0, 0xff, 0xf2, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0x5f, 0xff, 0x71, 0xff, 0x00, 0xff, 0x19, 0xff, 0x85, 0x06, 0xff, 0x21, 0xff, 
+  0x01, 0x02, 0xff, 0x1c, 0xff, 0xb9, 0xff, 0xc0, 0x49, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0xee, 0xff, 0xee, 0x0f, 0x22, 0xff, 0x3a, 0xe4, 0x02, 0xff, 0x1d, 0xff, 0x8d, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x03, 0xff, 0x1e, 0xff, 0x09, 0xff, 0x22, 0xff, 0xa7, 0xff, 0xb1, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x01, 0xaa, 0xff, 0xb3, 0xff, 0x00, 0xff, 0x19, 0xff, 0x84, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x02, 0xff, 0x1d, 0xff, 0x22, 0xff, 0x3a, 0xe4, 0xee, 0xff, 0xee, 0x0f, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6e, 0xff, 0x7d, 0x97, 0x00, 0xff, 0x17, 0xff, 0x8e, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x03, 0xff, 0x1e, 0xff, 0x09, 0xff, 0x22, 0xff, 0x9f, 0xff, 0xa9, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x01, 0x9b, 0xff, 0xa6, 0xff, 0x00, 0xff, 0x18, 0xff, 0x84, 0x06, 0xff, 0x21, 0xff, 
+  0x01, 0x00, 0xff, 0x17, 0xff, 0x6e, 0xff, 0x7d, 0x97, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xcc, 0xff, 0xd1, 0x37, 0x07, 0xff, 0x21, 0xfc, 0x05, 0xff, 0x20, 0xff, 0x8e, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x03, 0xff, 0x1e, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x86, 0xff, 0x93, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0x01, 0x5c, 0xff, 0x6e, 0xff, 0x00, 0xff, 0x19, 0xff, 0x83, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x05, 0xff, 0x20, 0xff, 0x07, 0xff, 0x21, 0xfc, 0xcc, 0xff, 0xd1, 0x37, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x02, 0x4b, 0xff, 0x5e, 0xbb, 0x00, 0xff, 0x19, 0xff, 0x8f, 
+  0x06, 0xff, 0x21, 0xff, 0x03, 0x04, 0xff, 0x20, 0xff, 0x00, 0xff, 0x19, 0xff, 0x5f, 0xff, 0x70, 0xff, 0xed, 0xff, 0xef, 0xff, 0x96, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf3, 0xff, 0xf4, 0xff, 0x24, 
+  0xff, 0x3c, 0xff, 0x02, 0xff, 0x1d, 0xff, 0x83, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x19, 0xff, 0x4b, 0xff, 0x5e, 0xbb, 0xff, 0xff, 0xff, 0x02, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 
+  0xff, 0xc4, 0x45, 0x04, 0xff, 0x1e, 0xfe, 0x05, 0xff, 0x20, 0xff, 0x90, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x18, 0xff, 0x30, 0xff, 0x45, 0xff, 0xc1, 0xff, 0xc8, 0xff, 0x95, 0xff, 0xff, 
+  0xff, 0xff, 0x02, 0xc6, 0xff, 0xcd, 0xff, 0x05, 0xff, 0x1f, 0xff, 0x05, 0xff, 0x20, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 0x02, 0x05, 0xff, 0x20, 0xff, 0x04, 0xff, 0x1e, 0xfe, 0xbc, 0xff, 0xc4, 
+  0x45, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x01, 0x53, 0xff, 0x65, 0xb3, 0x00, 0xff, 0x18, 0xff, 0x91, 0x06, 0xff, 0x21, 0xff, 0x03, 0x00, 0xff, 0x1b, 0xff, 0x0a, 0xff, 0x23, 
+  0xff, 0x76, 0xff, 0x84, 0xff, 0xeb, 0xff, 0xee, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x01, 0x87, 0xff, 0x94, 0xff, 0x00, 0xff, 0x17, 0xff, 0x83, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x18, 
+  0xff, 0x53, 0xff, 0x65, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xff, 0xd7, 0x2d, 0x10, 0xff, 0x29, 0xf3, 0x04, 0xff, 0x1f, 0xff, 0x91, 0x06, 0xff, 0x21, 0xff, 
+  0x04, 0x04, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x17, 0xff, 0x26, 0xff, 0x3d, 0xff, 0x9b, 0xff, 0xa5, 0xff, 0xf5, 0xff, 0xf6, 0xff, 0x91, 0xff, 0xff, 0xff, 0xff, 0x01, 0x47, 0xff, 0x5b, 0xff, 0x00, 
+  0xff, 0x1a, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 0x02, 0x04, 0xff, 0x1f, 0xff, 0x10, 0xff, 0x29, 0xf3, 0xd7, 0xff, 0xd7, 0x2d, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x8a, 0xff, 0x96, 0x7a, 0x00, 
+  0xff, 0x18, 0xff, 0x93, 0x06, 0xff, 0x21, 0xff, 0x04, 0x01, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x19, 0xff, 0x30, 0xff, 0x46, 0xff, 0x99, 0xff, 0xa4, 0xff, 0xec, 0xff, 0xee, 0xff, 0x8e, 0xff, 0xff, 
+  0xff, 0xff, 0x02, 0xe8, 0xff, 0xea, 0xff, 0x17, 0xff, 0x30, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 0x01, 0x00, 0xff, 0x18, 0xff, 0x8a, 0xff, 0x96, 0x7a, 0x89, 0x00, 0x00, 
+  0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x06, 0x4a, 0xff, 0x5d, 0xbb, 0x00, 0xff, 0x18, 0xff, 0x94, 0x06, 0xff, 0x21, 0xff, 0x05, 0x00, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x19, 0xff, 0x21, 0xff, 0x38, 
+  0xff, 0x72, 0xfe, 0x81, 0xff, 0xc6, 0xfe, 0xcc, 0xff, 0xf8, 0xff, 0xf9, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x01, 0xb0, 0xff, 0xb9, 0xff, 0x01, 0xff, 0x1a, 0xff, 0x82, 0x06, 0xff, 0x21, 0xff, 
+  0x02, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5d, 0xbb, 0xff, 0xff, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xde, 0xff, 0xe6, 0x1f, 0x24, 0xff, 0x3b, 0xe0, 0x00, 0xff, 0x1b, 0xff, 0x95, 
+  0x06, 0xff, 0x21, 0xff, 0x07, 0x02, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x18, 0xff, 0x06, 0xff, 0x21, 0xff, 0x30, 0xff, 0x46, 0xff, 0x6f, 0xfe, 0x7f, 0xff, 0xae, 0xff, 0xb6, 0xff, 0xdd, 0xff, 0xe0, 
+  0xff, 0xf8, 0xff, 0xf9, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xef, 0xff, 0xf0, 0xff, 0x3b, 0xff, 0x50, 0xff, 0x02, 0xff, 0x1b, 0xff, 0x81, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x1b, 
+  0xff, 0x24, 0xff, 0x3b, 0xe0, 0xde, 0xff, 0xe6, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0xff, 0xcf, 0x3a, 0x13, 0xff, 0x2c, 0xef, 0x02, 0xff, 0x1c, 0xff, 0x96, 0x06, 0xff, 0x21, 0xff, 
+  0x0e, 0x05, 0xff, 0x20, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x10, 0xff, 0x2a, 0xff, 0x2d, 0xff, 0x43, 0xff, 0x4f, 0xff, 0x62, 0xff, 0x6f, 0xfe, 0x7e, 
+  0xff, 0x8a, 0xff, 0x96, 0xff, 0x9d, 0xff, 0xa8, 0xff, 0xaa, 0xfe, 0xb3, 0xff, 0xae, 0xff, 0xb7, 0xff, 0x95, 0xfe, 0xa0, 0xff, 0x34, 0xff, 0x49, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x81, 0x06, 0xff, 
+  0x21, 0xff, 0x02, 0x02, 0xff, 0x1c, 0xff, 0x13, 0xff, 0x2c, 0xef, 0xc6, 0xff, 0xcf, 0x3a, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb8, 0xff, 0xbe, 0x4b, 0x0f, 0xff, 0x28, 0xf3, 0x01, 0xff, 0x1c, 
+  0xff, 0x99, 0x06, 0xff, 0x21, 0xff, 0x09, 0x04, 0xff, 0x1f, 0xff, 0x01, 0xff, 0x1d, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 
+  0xff, 0x19, 0xff, 0x00, 0xff, 0x1a, 0xff, 0x00, 0xff, 0x18, 0xff, 0x00, 0xff, 0x1c, 0xff, 0x81, 0x06, 0xff, 0x21, 0xff, 0x02, 0x01, 0xff, 0x1c, 0xff, 0x0f, 0xff, 0x28, 0xf3, 0xb8, 0xff, 0xbe, 
+  0x4b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb8, 0xff, 0xbe, 0x4b, 0x14, 0xff, 0x2c, 0xef, 0x00, 0xff, 0x1b, 0xff, 0xa3, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x1b, 0xff, 0x14, 0xff, 0x2c, 
+  0xef, 0xb8, 0xff, 0xbe, 0x4b, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xff, 0xcb, 0x3b, 0x25, 0xff, 0x3b, 0xde, 0x00, 0xff, 0x18, 0xff, 0xa1, 0x06, 0xff, 0x21, 0xff, 0x02, 0x00, 0xff, 0x18, 
+  0xff, 0x25, 0xff, 0x3b, 0xde, 0xc7, 0xff, 0xcb, 0x3b, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0xdf, 0xff, 0xe7, 0x20, 0x4a, 0xff, 0x5c, 0xb9, 0x00, 0xff, 0x18, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x9d, 
+  0x06, 0xff, 0x21, 0xff, 0x03, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x18, 0xff, 0x4a, 0xff, 0x5c, 0xb9, 0xdf, 0xff, 0xe7, 0x20, 0x96, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x06, 0x8a, 
+  0xff, 0x94, 0x7a, 0x10, 0xff, 0x29, 0xf2, 0x00, 0xff, 0x18, 0xff, 0x05, 0xff, 0x20, 0xff, 0x99, 0x06, 0xff, 0x21, 0xff, 0x04, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x18, 0xff, 0x10, 0xff, 0x29, 
+  0xf2, 0x8a, 0xff, 0x94, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x99, 0x00, 0x00, 0x00, 0x00, 0x04, 0xd5, 0xff, 0xd5, 0x30, 0x53, 0xff, 0x65, 0xb0, 0x04, 0xff, 0x1e, 0xff, 0x00, 0xff, 0x19, 0xff, 0x05, 
+  0xff, 0x20, 0xff, 0x95, 0x06, 0xff, 0x21, 0xff, 0x04, 0x05, 0xff, 0x20, 0xff, 0x00, 0xff, 0x19, 0xff, 0x04, 0xff, 0x1e, 0xff, 0x53, 0xff, 0x65, 0xb0, 0xd5, 0xff, 0xd5, 0x30, 0x9d, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0xbb, 0xff, 0xc2, 0x47, 0x4b, 0xff, 0x5d, 0xb8, 0x07, 0xff, 0x21, 0xfc, 0x00, 0xff, 0x17, 0xff, 0x02, 0xff, 0x1e, 0xff, 0x91, 0x06, 0xff, 0x21, 0xff, 0x04, 0x02, 0xff, 0x1e, 
+  0xff, 0x00, 0xff, 0x17, 0xff, 0x07, 0xff, 0x21, 0xfc, 0x4b, 0xff, 0x5d, 0xb8, 0xbb, 0xff, 0xc2, 0x47, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc9, 0xff, 0xce, 0x39, 0x6d, 0xff, 0x7c, 0x96, 0x22, 
+  0xff, 0x3a, 0xe1, 0x01, 0xff, 0x1c, 0xff, 0x00, 0xff, 0x17, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x03, 0xff, 0x1f, 0xff, 0x05, 0xff, 0x20, 0xff, 0x87, 0x06, 0xff, 0x21, 0xff, 0x07, 0x05, 0xff, 0x20, 
+  0xff, 0x03, 0xff, 0x1f, 0xff, 0x00, 0xff, 0x1b, 0xff, 0x00, 0xff, 0x17, 0xff, 0x01, 0xff, 0x1c, 0xff, 0x22, 0xff, 0x3a, 0xe1, 0x6d, 0xff, 0x7c, 0x96, 0xc9, 0xff, 0xce, 0x39, 0xa5, 0x00, 0x00, 
+  0x00, 0x00, 0x06, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xff, 0xbe, 0x4a, 0x76, 0xff, 0x84, 0x8d, 0x3e, 0xff, 0x52, 0xc6, 0x1a, 0xff, 0x33, 0xeb, 0x07, 0xff, 0x22, 0xfe, 0x00, 0xff, 0x1a, 0xff, 0x81, 
+  0x00, 0xff, 0x18, 0xff, 0x81, 0x03, 0xff, 0x1f, 0xff, 0x81, 0x00, 0xff, 0x18, 0xff, 0x06, 0x00, 0xff, 0x1a, 0xff, 0x07, 0xff, 0x22, 0xfe, 0x1a, 0xff, 0x33, 0xeb, 0x3e, 0xff, 0x52, 0xc6, 0x76, 
+  0xff, 0x84, 0x8d, 0xb7, 0xff, 0xbe, 0x4a, 0xf0, 0xff, 0xf0, 0x11, 0xab, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe8, 0xff, 0xe8, 0x16, 0xce, 0xff, 0xd3, 0x34, 0xb0, 0xff, 0xba, 0x51, 0x9a, 0xff, 0xa4, 
+  0x6a, 0x80, 0xff, 0x8f, 0x8f, 0x81, 0x26, 0xff, 0x3e, 0xed, 0x04, 0x80, 0xff, 0x8f, 0x8f, 0x9a, 0xff, 0xa4, 0x6a, 0xb0, 0xff, 0xba, 0x51, 0xce, 0xff, 0xd3, 0x34, 0xe8, 0xff, 0xe8, 0x16, 0x97, 
+  0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
 const lv_img_dsc_t phone_dial_60_60 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 60,
   .header.h = 60,
-  .data_size = 3600 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = sizeof(phone_dial_60_60_map),
   .data = phone_dial_60_60_map,
 };
@@ -21,266 +21,391 @@
 #define LV_ATTRIBUTE_IMG_PHONE_DIAL_60_60_PRESSED
 #endif
 
+/* Run-length encoded by tools/img_rle.py for the gui_img_rle decoder */
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PHONE_DIAL_60_60_PRESSED uint8_t phone_dial_60_60_pressed_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
   /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0xdf, 0x34, 0xdf, 0x52, 0xbe, 0x6a, 0x9a, 0x8f, 0x34, 0xf4, 0x34, 0xf4, 0x9a, 0x8f, 0xbe, 0x6a, 0xdf, 0x52, 0xdf, 0x34, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x11, 0xdf, 0x4a, 0x9a, 0x8e, 0x55, 0xc6, 0x34, 0xeb, 0x34, 0xfe, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xfe, 0x34, 0xeb, 0x55, 0xc6, 0x9a, 0x8e, 0xdf, 0x4a, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3a, 0x9a, 0x97, 0x35, 0xe1, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x35, 0xe1, 0x9a, 0x97, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x48, 0x79, 0xb9, 0x34, 0xfc, 0x10, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x10, 0xff, 0x34, 0xfc, 0x79, 0xb9, 0xdf, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x30, 0x79, 0xb1, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x79, 0xb1, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x9a, 0x7a, 0x34, 0xf2, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xf2, 0x9a, 0x7a, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x21, 0x79, 0xba, 0x10, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x10, 0xff, 0x79, 0xba, 0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3c, 0x35, 0xde, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x35, 0xde, 0xdf, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4c, 0x34, 0xef, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xef, 0xdf, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x34, 0xf4, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xf4, 0xdf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3a, 0x34, 0xef, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x35, 0xff, 0x79, 0xff, 0xbe, 0xff, 0xbf, 0xff, 0x79, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xef, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x35, 0xe0, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x59, 0xff, 0x9a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x35, 0xe0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x79, 0xbc, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x79, 0xbc, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x7a, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x34, 0xf3, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xf3, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x79, 0xb3, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x79, 0xb3, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x46, 0x14, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xfe, 0xdf, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x79, 0xbb, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x79, 0xbb, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xdf, 0x38, 0x34, 0xfc, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xfc, 0xdf, 0x38, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9a, 0x98, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x98, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x10, 0x34, 0xe4, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xe4, 0xff, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0xdf, 0x49, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xdf, 0x49, 0x00, 0x00, 
-  0x00, 0x00, 0x9a, 0x8e, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x8e, 0x00, 0x00, 
-  0xff, 0x02, 0x55, 0xc7, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xc7, 0xff, 0x02, 
-  0xff, 0x16, 0x34, 0xec, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xec, 0xff, 0x16, 
-  0xdf, 0x34, 0x34, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xfe, 0xdf, 0x34, 
-  0xdf, 0x52, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xdf, 0x52, 
-  0xbe, 0x68, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xbe, 0x68, 
-  0x9a, 0x90, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x90, 
-  0x34, 0xf4, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xf4, 
-  0x34, 0xf4, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xf4, 
-  0x9a, 0x90, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x90, 
-  0xbe, 0x68, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x35, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xbe, 0x68, 
-  0xdf, 0x52, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x55, 0xff, 0x79, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xdf, 0x52, 
-  0xdf, 0x34, 0x34, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x55, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xfe, 0xdf, 0x34, 
-  0xff, 0x16, 0x34, 0xec, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7a, 0xff, 0x34, 0xff, 0x10, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xec, 0xff, 0x16, 
-  0xff, 0x02, 0x55, 0xc7, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x14, 0xff, 0xba, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0x55, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xc7, 0xff, 0x02, 
-  0x00, 0x00, 0x9a, 0x8e, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x34, 0xff, 0x10, 0xff, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xba, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x8e, 0x00, 0x00, 
-  0x00, 0x00, 0xdf, 0x49, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0xdf, 0x49, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x10, 0x34, 0xe4, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xe4, 0xff, 0x10, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x9a, 0x98, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbe, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x98, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xdf, 0x38, 0x34, 0xfc, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xfc, 0xdf, 0x38, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0x79, 0xbb, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x35, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x79, 0xbb, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x46, 0x14, 0xfe, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x55, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xfe, 0xdf, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0x79, 0xb3, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xff, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x79, 0xb3, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x2d, 0x34, 0xf3, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x10, 0xff, 0x35, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xf3, 0xff, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0x7a, 0x10, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x55, 0xff, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x10, 0xff, 0x9a, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x79, 0xbc, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x9a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x79, 0xbc, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x1f, 0x35, 0xe0, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x10, 0xff, 0x34, 0xff, 0x55, 0xff, 0x9a, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x35, 0xe0, 0xff, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3a, 0x34, 0xef, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x55, 0xff, 0x79, 0xff, 0x9a, 0xff, 0x9a, 0xff, 0xbe, 0xff, 0xbf, 0xff, 0xdf, 0xff, 0xbe, 0xff, 0x55, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xef, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4b, 0x34, 0xf4, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xf4, 0xdf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x4c, 0x34, 0xef, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x34, 0xef, 0xdf, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3c, 0x35, 0xde, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x35, 0xde, 0xdf, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x21, 0x79, 0xba, 0x10, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x10, 0xff, 0x79, 0xba, 0xff, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x06, 0x9a, 0x7a, 0x34, 0xf2, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xf2, 0x9a, 0x7a, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x30, 0x79, 0xb1, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x79, 0xb1, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x48, 0x79, 0xb9, 0x34, 0xfc, 0x10, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x10, 0xff, 0x34, 0xfc, 0x79, 0xb9, 0xdf, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x3a, 0x9a, 0x97, 0x35, 0xe1, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x34, 0xff, 0x14, 0xff, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x35, 0xe1, 0x9a, 0x97, 0xdf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x11, 0xdf, 0x4a, 0x9a, 0x8e, 0x55, 0xc6, 0x34, 0xeb, 0x34, 0xfe, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0x10, 0xff, 0x14, 0xff, 0x14, 0xff, 0x34, 0xfe, 0x34, 0xeb, 0x55, 0xc6, 0x9a, 0x8e, 0xdf, 0x4a, 0xff, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x16, 0xdf, 0x34, 0xdf, 0x52, 0xbe, 0x6a, 0x9a, 0x8f, 0x34, 0xf4, 0x34, 0xf4, 0x9a, 0x8f, 0xbe, 0x6a, 0xdf, 0x52, 0xdf, 0x34, 0xff, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x04, 0xff, 0x16, 0xdf, 0x34, 0xdf, 0x52, 0xbe, 0x6a, 0x9a, 0x8f, 0x81, 0x34, 0xf4, 0x04, 0x9a, 0x8f, 0xbe, 0x6a, 0xdf, 0x52, 0xdf, 0x34, 0xff, 0x16, 0xab, 0x00, 0x00, 0x05, 
+  0xff, 0x11, 0xdf, 0x4a, 0x9a, 0x8e, 0x55, 0xc6, 0x34, 0xeb, 0x34, 0xfe, 0x81, 0x14, 0xff, 0x00, 0x10, 0xff, 0x81, 0x14, 0xff, 0x00, 0x10, 0xff, 0x81, 0x14, 0xff, 0x05, 0x34, 0xfe, 0x34, 0xeb, 
+  0x55, 0xc6, 0x9a, 0x8e, 0xdf, 0x4a, 0xff, 0x11, 0xa5, 0x00, 0x00, 0x04, 0xdf, 0x3a, 0x9a, 0x97, 0x35, 0xe1, 0x14, 0xff, 0x10, 0xff, 0x82, 0x14, 0xff, 0x87, 0x34, 0xff, 0x82, 0x14, 0xff, 0x04, 
+  0x10, 0xff, 0x14, 0xff, 0x35, 0xe1, 0x9a, 0x97, 0xdf, 0x3a, 0xa1, 0x00, 0x00, 0x04, 0xdf, 0x48, 0x79, 0xb9, 0x34, 0xfc, 0x10, 0xff, 0x14, 0xff, 0x91, 0x34, 0xff, 0x04, 0x14, 0xff, 0x10, 0xff, 
+  0x34, 0xfc, 0x79, 0xb9, 0xdf, 0x48, 0x9d, 0x00, 0x00, 0x01, 0xff, 0x30, 0x79, 0xb1, 0x82, 0x14, 0xff, 0x95, 0x34, 0xff, 0x82, 0x14, 0xff, 0x01, 0x79, 0xb1, 0xff, 0x30, 0x99, 0x00, 0x00, 0x02, 
+  0xff, 0x06, 0x9a, 0x7a, 0x34, 0xf2, 0x81, 0x14, 0xff, 0x99, 0x34, 0xff, 0x81, 0x14, 0xff, 0x02, 0x34, 0xf2, 0x9a, 0x7a, 0xff, 0x06, 0x96, 0x00, 0x00, 0x03, 0xff, 0x21, 0x79, 0xba, 0x10, 0xff, 
+  0x14, 0xff, 0x9d, 0x34, 0xff, 0x03, 0x14, 0xff, 0x10, 0xff, 0x79, 0xba, 0xff, 0x21, 0x94, 0x00, 0x00, 0x02, 0xdf, 0x3c, 0x35, 0xde, 0x14, 0xff, 0xa1, 0x34, 0xff, 0x02, 0x14, 0xff, 0x35, 0xde, 
+  0xdf, 0x3c, 0x92, 0x00, 0x00, 0x02, 0xdf, 0x4c, 0x34, 0xef, 0x14, 0xff, 0xa3, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xef, 0xdf, 0x4c, 0x90, 0x00, 0x00, 0x02, 0xdf, 0x4b, 0x34, 0xf4, 0x14, 0xff, 
+  0x84, 0x34, 0xff, 0x86, 0x14, 0xff, 0x99, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xf4, 0xdf, 0x4b, 0x8e, 0x00, 0x00, 0x02, 0xdf, 0x3a, 0x34, 0xef, 0x14, 0xff, 0x82, 0x34, 0xff, 0x81, 0x14, 0xff, 
+  0x08, 0x10, 0xff, 0x14, 0xff, 0x35, 0xff, 0x79, 0xff, 0xbe, 0xff, 0xbf, 0xff, 0x79, 0xff, 0x34, 0xff, 0x14, 0xff, 0x99, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xef, 0xdf, 0x3a, 0x8c, 0x00, 0x00, 
+  0x02, 0xff, 0x1f, 0x35, 0xe0, 0x14, 0xff, 0x81, 0x34, 0xff, 0x81, 0x14, 0xff, 0x03, 0x34, 0xff, 0x59, 0xff, 0x9a, 0xff, 0xdf, 0xff, 0x84, 0xff, 0xff, 0x01, 0xba, 0xff, 0x14, 0xff, 0x9a, 0x34, 
+  0xff, 0x02, 0x14, 0xff, 0x35, 0xe0, 0xff, 0x1f, 0x8a, 0x00, 0x00, 0x02, 0xff, 0x06, 0x79, 0xbc, 0x14, 0xff, 0x81, 0x34, 0xff, 0x02, 0x14, 0xff, 0x55, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 0x01, 
+  0x55, 0xff, 0x14, 0xff, 0x9a, 0x34, 0xff, 0x02, 0x14, 0xff, 0x79, 0xbc, 0xff, 0x06, 0x89, 0x00, 0x00, 0x01, 0x9a, 0x7a, 0x10, 0xff, 0x81, 0x34, 0xff, 0x01, 0x14, 0xff, 0x55, 0xff, 0x8b, 0xff, 
+  0xff, 0x01, 0xba, 0xff, 0x10, 0xff, 0x9b, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0x7a, 0x88, 0x00, 0x00, 0x02, 0xff, 0x2d, 0x34, 0xf3, 0x14, 0xff, 0x81, 0x34, 0xff, 0x01, 0x14, 0xff, 0xbe, 0xff, 
+  0x8c, 0xff, 0xff, 0x01, 0x34, 0xff, 0x14, 0xff, 0x9a, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xf3, 0xff, 0x2d, 0x86, 0x00, 0x00, 0x02, 0xff, 0x01, 0x79, 0xb3, 0x14, 0xff, 0x82, 0x34, 0xff, 0x01, 
+  0x14, 0xff, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0x01, 0x7a, 0xff, 0x10, 0xff, 0x9b, 0x34, 0xff, 0x02, 0x14, 0xff, 0x79, 0xb3, 0xff, 0x01, 0x85, 0x00, 0x00, 0x02, 0xdf, 0x46, 0x14, 0xfe, 0x14, 0xff, 
+  0x82, 0x34, 0xff, 0x01, 0x14, 0xff, 0xbf, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0x14, 0xff, 0x9a, 0x34, 0xff, 0x02, 0x14, 0xff, 0x14, 0xfe, 0xdf, 0x46, 0x84, 0x00, 0x00, 0x02, 0xff, 
+  0x02, 0x79, 0xbb, 0x14, 0xff, 0x83, 0x34, 0xff, 0x01, 0x14, 0xff, 0xbe, 0xff, 0x8d, 0xff, 0xff, 0x01, 0x55, 0xff, 0x14, 0xff, 0x9b, 0x34, 0xff, 0x02, 0x14, 0xff, 0x79, 0xbb, 0xff, 0x02, 0x83, 
+  0x00, 0x00, 0x02, 0xdf, 0x38, 0x34, 0xfc, 0x14, 0xff, 0x83, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0xff, 0x8d, 0xff, 0xff, 0x01, 0xbe, 0xff, 0x14, 0xff, 0x9b, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 
+  0xfc, 0xdf, 0x38, 0x83, 0x00, 0x00, 0x01, 0x9a, 0x98, 0x10, 0xff, 0x84, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0xff, 0x8e, 0xff, 0xff, 0x01, 0x34, 0xff, 0x14, 0xff, 0x9b, 0x34, 0xff, 0x01, 0x10, 
+  0xff, 0x9a, 0x98, 0x82, 0x00, 0x00, 0x02, 0xff, 0x10, 0x34, 0xe4, 0x14, 0xff, 0x84, 0x34, 0xff, 0x01, 0x14, 0xff, 0x79, 0xff, 0x8e, 0xff, 0xff, 0x01, 0x79, 0xff, 0x14, 0xff, 0x9b, 0x34, 0xff, 
+  0x02, 0x14, 0xff, 0x34, 0xe4, 0xff, 0x10, 0x81, 0x00, 0x00, 0x01, 0xdf, 0x49, 0x14, 0xff, 0x85, 0x34, 0xff, 0x01, 0x14, 0xff, 0x55, 0xff, 0x8e, 0xff, 0xff, 0x01, 0x55, 0xff, 0x14, 0xff, 0x9c, 
+  0x34, 0xff, 0x01, 0x14, 0xff, 0xdf, 0x49, 0x81, 0x00, 0x00, 0x01, 0x9a, 0x8e, 0x10, 0xff, 0x85, 0x34, 0xff, 0x01, 0x14, 0xff, 0x34, 0xff, 0x8d, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x34, 0xff, 0x14, 
+  0xff, 0x9c, 0x34, 0xff, 0x05, 0x10, 0xff, 0x9a, 0x8e, 0x00, 0x00, 0xff, 0x02, 0x55, 0xc7, 0x14, 0xff, 0x86, 0x34, 0xff, 0x01, 0x14, 0xff, 0xdf, 0xff, 0x8b, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x34, 
+  0xff, 0x14, 0xff, 0x9d, 0x34, 0xff, 0x05, 0x14, 0xff, 0x55, 0xc7, 0xff, 0x02, 0xff, 0x16, 0x34, 0xec, 0x14, 0xff, 0x86, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0xff, 0x8a, 0xff, 0xff, 0x00, 0x9a, 
+  0xff, 0x81, 0x14, 0xff, 0x9e, 0x34, 0xff, 0x05, 0x14, 0xff, 0x34, 0xec, 0xff, 0x16, 0xdf, 0x34, 0x34, 0xfe, 0x14, 0xff, 0x86, 0x34, 0xff, 0x01, 0x14, 0xff, 0x55, 0xff, 0x89, 0xff, 0xff, 0x00, 
+  0x7a, 0xff, 0x81, 0x14, 0xff, 0x9f, 0x34, 0xff, 0x04, 0x14, 0xff, 0x34, 0xfe, 0xdf, 0x34, 0xdf, 0x52, 0x14, 0xff, 0x87, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xff, 0xdf, 0xff, 0x87, 0xff, 0xff, 
+  0x01, 0xbe, 0xff, 0x10, 0xff, 0xa2, 0x34, 0xff, 0x03, 0x14, 0xff, 0xdf, 0x52, 0xbe, 0x68, 0x14, 0xff, 0x88, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0xff, 0x88, 0xff, 0xff, 0x01, 0x34, 0xff, 0x14, 
+  0xff, 0xa1, 0x34, 0xff, 0x03, 0x14, 0xff, 0xbe, 0x68, 0x9a, 0x90, 0x10, 0xff, 0x88, 0x34, 0xff, 0x01, 0x14, 0xff, 0x34, 0xff, 0x88, 0xff, 0xff, 0x01, 0xbe, 0xff, 0x14, 0xff, 0xa1, 0x34, 0xff, 
+  0x03, 0x10, 0xff, 0x9a, 0x90, 0x34, 0xf4, 0x14, 0xff, 0x89, 0x34, 0xff, 0x01, 0x14, 0xff, 0xbe, 0xff, 0x88, 0xff, 0xff, 0x01, 0x59, 0xff, 0x14, 0xff, 0xa0, 0x34, 0xff, 0x00, 0x14, 0xff, 0x81, 
+  0x34, 0xf4, 0x00, 0x14, 0xff, 0x89, 0x34, 0xff, 0x01, 0x14, 0xff, 0x55, 0xff, 0x89, 0xff, 0xff, 0x01, 0x34, 0xff, 0x14, 0xff, 0x9f, 0x34, 0xff, 0x03, 0x14, 0xff, 0x34, 0xf4, 0x9a, 0x90, 0x10, 
+  0xff, 0x8a, 0x34, 0xff, 0x01, 0x14, 0xff, 0xbe, 0xff, 0x88, 0xff, 0xff, 0x00, 0xdf, 0xff, 0x81, 0x14, 0xff, 0x9e, 0x34, 0xff, 0x03, 0x10, 0xff, 0x9a, 0x90, 0xbe, 0x68, 0x14, 0xff, 0x8a, 0x34, 
+  0xff, 0x01, 0x14, 0xff, 0x35, 0xff, 0x89, 0xff, 0xff, 0x00, 0xba, 0xff, 0x81, 0x14, 0xff, 0x88, 0x34, 0xff, 0x83, 0x14, 0xff, 0x90, 0x34, 0xff, 0x03, 0x14, 0xff, 0xbe, 0x68, 0xdf, 0x52, 0x14, 
+  0xff, 0x8b, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0xff, 0x89, 0xff, 0xff, 0x00, 0x9a, 0xff, 0x81, 0x14, 0xff, 0x86, 0x34, 0xff, 0x04, 0x14, 0xff, 0x34, 0xff, 0x55, 0xff, 0x79, 0xff, 0x34, 0xff, 
+  0x82, 0x14, 0xff, 0x8d, 0x34, 0xff, 0x04, 0x14, 0xff, 0xdf, 0x52, 0xdf, 0x34, 0x34, 0xfe, 0x14, 0xff, 0x8a, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 0x00, 0xba, 
+  0xff, 0x81, 0x14, 0xff, 0x84, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xff, 0xdf, 0xff, 0x82, 0xff, 0xff, 0x01, 0xbe, 0xff, 0x55, 0xff, 0x82, 0x14, 0xff, 0x8a, 0x34, 0xff, 0x05, 0x14, 0xff, 0x34, 
+  0xfe, 0xdf, 0x34, 0xff, 0x16, 0x34, 0xec, 0x14, 0xff, 0x8b, 0x34, 0xff, 0x01, 0x14, 0xff, 0x55, 0xff, 0x8a, 0xff, 0xff, 0x02, 0xdf, 0xff, 0x34, 0xff, 0x14, 0xff, 0x82, 0x34, 0xff, 0x81, 0x14, 
+  0xff, 0x00, 0xdf, 0xff, 0x85, 0xff, 0xff, 0x04, 0xdf, 0xff, 0x7a, 0xff, 0x34, 0xff, 0x10, 0xff, 0x14, 0xff, 0x88, 0x34, 0xff, 0x05, 0x14, 0xff, 0x34, 0xec, 0xff, 0x16, 0xff, 0x02, 0x55, 0xc7, 
+  0x14, 0xff, 0x8c, 0x34, 0xff, 0x01, 0x10, 0xff, 0x79, 0xff, 0x8b, 0xff, 0xff, 0x00, 0x59, 0xff, 0x81, 0x14, 0xff, 0x02, 0x34, 0xff, 0x14, 0xff, 0xba, 0xff, 0x89, 0xff, 0xff, 0x01, 0x9a, 0xff, 
+  0x55, 0xff, 0x81, 0x14, 0xff, 0x86, 0x34, 0xff, 0x05, 0x14, 0xff, 0x55, 0xc7, 0xff, 0x02, 0x00, 0x00, 0x9a, 0x8e, 0x10, 0xff, 0x8d, 0x34, 0xff, 0x01, 0x14, 0xff, 0x9a, 0xff, 0x8b, 0xff, 0xff, 
+  0x03, 0xbe, 0xff, 0x34, 0xff, 0x10, 0xff, 0x7a, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xba, 0xff, 0x81, 0x14, 0xff, 0x85, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0x8e, 0x81, 0x00, 0x00, 0x01, 0xdf, 0x49, 
+  0x14, 0xff, 0x8d, 0x34, 0xff, 0x81, 0x14, 0xff, 0x00, 0xbe, 0xff, 0x8c, 0xff, 0xff, 0x00, 0xbe, 0xff, 0x8e, 0xff, 0xff, 0x01, 0x79, 0xff, 0x14, 0xff, 0x85, 0x34, 0xff, 0x01, 0x14, 0xff, 0xdf, 
+  0x49, 0x81, 0x00, 0x00, 0x02, 0xff, 0x10, 0x34, 0xe4, 0x14, 0xff, 0x8d, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xff, 0xbf, 0xff, 0x9b, 0xff, 0xff, 0x01, 0xbf, 0xff, 0x14, 0xff, 0x84, 0x34, 0xff, 
+  0x02, 0x14, 0xff, 0x34, 0xe4, 0xff, 0x10, 0x82, 0x00, 0x00, 0x01, 0x9a, 0x98, 0x10, 0xff, 0x8e, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xff, 0xbe, 0xff, 0x9a, 0xff, 0xff, 0x01, 0xbe, 0xff, 0x14, 
+  0xff, 0x84, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0x98, 0x83, 0x00, 0x00, 0x02, 0xdf, 0x38, 0x34, 0xfc, 0x14, 0xff, 0x8e, 0x34, 0xff, 0x81, 0x14, 0xff, 0x00, 0x9a, 0xff, 0x99, 0xff, 0xff, 0x01, 
+  0x79, 0xff, 0x14, 0xff, 0x83, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xfc, 0xdf, 0x38, 0x83, 0x00, 0x00, 0x02, 0xff, 0x02, 0x79, 0xbb, 0x14, 0xff, 0x8f, 0x34, 0xff, 0x81, 0x14, 0xff, 0x00, 0x79, 
+  0xff, 0x98, 0xff, 0xff, 0x01, 0x35, 0xff, 0x14, 0xff, 0x83, 0x34, 0xff, 0x02, 0x14, 0xff, 0x79, 0xbb, 0xff, 0x02, 0x84, 0x00, 0x00, 0x02, 0xdf, 0x46, 0x14, 0xfe, 0x14, 0xff, 0x90, 0x34, 0xff, 
+  0x02, 0x14, 0xff, 0x55, 0xff, 0xdf, 0xff, 0x95, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x14, 0xff, 0x83, 0x34, 0xff, 0x02, 0x14, 0xff, 0x14, 0xfe, 0xdf, 0x46, 0x85, 0x00, 0x00, 0x02, 0xff, 0x01, 0x79, 
+  0xb3, 0x14, 0xff, 0x91, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xff, 0x9a, 0xff, 0x94, 0xff, 0xff, 0x01, 0x9a, 0xff, 0x10, 0xff, 0x83, 0x34, 0xff, 0x02, 0x14, 0xff, 0x79, 0xb3, 0xff, 0x01, 0x86, 
+  0x00, 0x00, 0x02, 0xff, 0x2d, 0x34, 0xf3, 0x14, 0xff, 0x91, 0x34, 0xff, 0x03, 0x14, 0xff, 0x10, 0xff, 0x35, 0xff, 0xbe, 0xff, 0x92, 0xff, 0xff, 0x01, 0x59, 0xff, 0x14, 0xff, 0x82, 0x34, 0xff, 
+  0x02, 0x14, 0xff, 0x34, 0xf3, 0xff, 0x2d, 0x88, 0x00, 0x00, 0x01, 0x9a, 0x7a, 0x10, 0xff, 0x93, 0x34, 0xff, 0x81, 0x14, 0xff, 0x01, 0x55, 0xff, 0xbe, 0xff, 0x90, 0xff, 0xff, 0x01, 0x34, 0xff, 
+  0x14, 0xff, 0x82, 0x34, 0xff, 0x01, 0x10, 0xff, 0x9a, 0x7a, 0x89, 0x00, 0x00, 0x02, 0xff, 0x06, 0x79, 0xbc, 0x14, 0xff, 0x94, 0x34, 0xff, 0x81, 0x14, 0xff, 0x02, 0x34, 0xff, 0x9a, 0xff, 0xdf, 
+  0xff, 0x8c, 0xff, 0xff, 0x01, 0xdf, 0xff, 0x14, 0xff, 0x82, 0x34, 0xff, 0x02, 0x14, 0xff, 0x79, 0xbc, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x02, 0xff, 0x1f, 0x35, 0xe0, 0x14, 0xff, 0x95, 0x34, 0xff, 
+  0x05, 0x14, 0xff, 0x10, 0xff, 0x34, 0xff, 0x55, 0xff, 0x9a, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 0x01, 0x55, 0xff, 0x14, 0xff, 0x81, 0x34, 0xff, 0x02, 0x14, 0xff, 0x35, 0xe0, 0xff, 0x1f, 0x8c, 
+  0x00, 0x00, 0x02, 0xdf, 0x3a, 0x34, 0xef, 0x14, 0xff, 0x96, 0x34, 0xff, 0x83, 0x14, 0xff, 0x02, 0x34, 0xff, 0x55, 0xff, 0x79, 0xff, 0x81, 0x9a, 0xff, 0x05, 0xbe, 0xff, 0xbf, 0xff, 0xdf, 0xff, 
+  0xbe, 0xff, 0x55, 0xff, 0x14, 0xff, 0x81, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xef, 0xdf, 0x3a, 0x8e, 0x00, 0x00, 0x02, 0xdf, 0x4b, 0x34, 0xf4, 0x14, 0xff, 0x99, 0x34, 0xff, 0x82, 0x14, 0xff, 
+  0x81, 0x10, 0xff, 0x84, 0x14, 0xff, 0x81, 0x34, 0xff, 0x02, 0x14, 0xff, 0x34, 0xf4, 0xdf, 0x4b, 0x90, 0x00, 0x00, 0x02, 0xdf, 0x4c, 0x34, 0xef, 0x14, 0xff, 0xa3, 0x34, 0xff, 0x02, 0x14, 0xff, 
+  0x34, 0xef, 0xdf, 0x4c, 0x92, 0x00, 0x00, 0x02, 0xdf, 0x3c, 0x35, 0xde, 0x14, 0xff, 0xa1, 0x34, 0xff, 0x02, 0x14, 0xff, 0x35, 0xde, 0xdf, 0x3c, 0x94, 0x00, 0x00, 0x03, 0xff, 0x21, 0x79, 0xba, 
+  0x10, 0xff, 0x14, 0xff, 0x9d, 0x34, 0xff, 0x03, 0x14, 0xff, 0x10, 0xff, 0x79, 0xba, 0xff, 0x21, 0x96, 0x00, 0x00, 0x02, 0xff, 0x06, 0x9a, 0x7a, 0x34, 0xf2, 0x81, 0x14, 0xff, 0x99, 0x34, 0xff, 
+  0x81, 0x14, 0xff, 0x02, 0x34, 0xf2, 0x9a, 0x7a, 0xff, 0x06, 0x99, 0x00, 0x00, 0x01, 0xff, 0x30, 0x79, 0xb1, 0x82, 0x14, 0xff, 0x95, 0x34, 0xff, 0x82, 0x14, 0xff, 0x01, 0x79, 0xb1, 0xff, 0x30, 
+  0x9d, 0x00, 0x00, 0x04, 0xdf, 0x48, 0x79, 0xb9, 0x34, 0xfc, 0x10, 0xff, 0x14, 0xff, 0x91, 0x34, 0xff, 0x04, 0x14, 0xff, 0x10, 0xff, 0x34, 0xfc, 0x79, 0xb9, 0xdf, 0x48, 0xa1, 0x00, 0x00, 0x04, 
+  0xdf, 0x3a, 0x9a, 0x97, 0x35, 0xe1, 0x14, 0xff, 0x10, 0xff, 0x82, 0x14, 0xff, 0x87, 0x34, 0xff, 0x82, 0x14, 0xff, 0x04, 0x10, 0xff, 0x14, 0xff, 0x35, 0xe1, 0x9a, 0x97, 0xdf, 0x3a, 0xa5, 0x00, 
+  0x00, 0x05, 0xff, 0x11, 0xdf, 0x4a, 0x9a, 0x8e, 0x55, 0xc6, 0x34, 0xeb, 0x34, 0xfe, 0x81, 0x14, 0xff, 0x00, 0x10, 0xff, 0x81, 0x14, 0xff, 0x00, 0x10, 0xff, 0x81, 0x14, 0xff, 0x05, 0x34, 0xfe, 
+  0x34, 0xeb, 0x55, 0xc6, 0x9a, 0x8e, 0xdf, 0x4a, 0xff, 0x11, 0xab, 0x00, 0x00, 0x04, 0xff, 0x16, 0xdf, 0x34, 0xdf, 0x52, 0xbe, 0x6a, 0x9a, 0x8f, 0x81, 0x34, 0xf4, 0x04, 0x9a, 0x8f, 0xbe, 0x6a, 
+  0xdf, 0x52, 0xdf, 0x34, 0xff, 0x16, 0x97, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
   /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xef, 0x16, 0x7a, 0xd7, 0x34, 0xf6, 0xbe, 0x52, 0xb3, 0xa6, 0x6a, 0x70, 0x8e, 0x8f, 0x23, 0x25, 0xf4, 0x23, 0x25, 0xf4, 0x70, 0x8e, 0x8f, 0xb3, 0xa6, 0x6a, 0xf6, 0xbe, 0x52, 0x7a, 0xd7, 0x34, 0xbd, 0xef, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf7, 0x11, 0x17, 0xbf, 0x4a, 0x2e, 0x7e, 0x8e, 0x67, 0x4d, 0xc6, 0xe3, 0x24, 0xeb, 0xa0, 0x14, 0xfe, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xfe, 0xe3, 0x24, 0xeb, 0x67, 0x4d, 0xc6, 0x2e, 0x7e, 0x8e, 0x17, 0xbf, 0x4a, 0xfe, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xcf, 0x3a, 0x0d, 0x76, 0x97, 0x04, 0x2d, 0xe1, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x0c, 0xff, 0x04, 0x2d, 0xe1, 0x0d, 0x76, 0x97, 0x59, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xc7, 0x48, 0x89, 0x55, 0xb9, 0xa1, 0x14, 0xfc, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa1, 0x14, 0xfc, 0x89, 0x55, 0xb9, 0x37, 0xc7, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xdf, 0x30, 0xca, 0x5d, 0xb1, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xca, 0x5d, 0xb1, 0x7a, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x71, 0x96, 0x7a, 0xc2, 0x1c, 0xf2, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xf2, 0x71, 0x96, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xe7, 0x21, 0x89, 0x55, 0xba, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xba, 0x9c, 0xe7, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xcf, 0x3c, 0x04, 0x35, 0xde, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x04, 0x35, 0xde, 0x59, 0xcf, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbf, 0x4c, 0xc2, 0x1c, 0xef, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xef, 0x17, 0xbf, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbf, 0x4b, 0xc1, 0x1c, 0xf4, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0xc1, 0x1c, 0xf4, 0x17, 0xbf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xcf, 0x3a, 0xc2, 0x1c, 0xef, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0x04, 0x35, 0xff, 0xcb, 0x65, 0xff, 0xb3, 0xa6, 0xff, 0xd5, 0xae, 0xff, 0xec, 0x6d, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0xc2, 0x1c, 0xef, 0x59, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xef, 0x1f, 0x04, 0x35, 0xe0, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xe3, 0x24, 0xff, 0x89, 0x55, 0xff, 0x71, 0x96, 0xff, 0x59, 0xcf, 0xff, 0xfe, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x96, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x04, 0x35, 0xe0, 0xdc, 0xef, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x89, 0x55, 0xbc, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x67, 0x45, 0xff, 0xf6, 0xb6, 0xff, 0xbd, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x25, 0x3d, 0xff, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xbc, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x96, 0x7a, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x46, 0x3d, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x96, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x91, 0x96, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xdf, 0x2d, 0xc2, 0x1c, 0xf3, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xef, 0xff, 0xe2, 0x24, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xc2, 0x1c, 0xf3, 0x9a, 0xdf, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xaa, 0x5d, 0xb3, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xf6, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x6d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xaa, 0x5d, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xc7, 0x46, 0xa0, 0x14, 0xfe, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xf5, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xcf, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xfe, 0x37, 0xc7, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xa9, 0x55, 0xbb, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xb4, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x67, 0x4d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa9, 0x55, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xd7, 0x38, 0xa1, 0x14, 0xfc, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x71, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xae, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xfc, 0x59, 0xd7, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x7e, 0x98, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x0e, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xff, 0x04, 0x2d, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x0d, 0x7e, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0xf7, 0x10, 0x04, 0x2d, 0xe4, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xaa, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x5d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x04, 0x2d, 0xe4, 0xfe, 0xf7, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x17, 0xc7, 0x49, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x25, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x68, 0x4d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x17, 0xc7, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x4e, 0x7e, 0x8e, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xc2, 0x1c, 0xff, 0x9c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x17, 0xc7, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x4e, 0x7e, 0x8e, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x02, 0x67, 0x4d, 0xc7, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xf6, 0xb6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xb6, 0xff, 0xe3, 0x24, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x67, 0x4d, 0xc7, 0xff, 0xff, 0x02, 
-  0xbd, 0xef, 0x16, 0xe3, 0x24, 0xec, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x0e, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x96, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xe3, 0x24, 0xec, 0xbd, 0xef, 0x16, 
-  0x7a, 0xd7, 0x34, 0xa0, 0x14, 0xfe, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x46, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xf7, 0xff, 0xec, 0x6d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xfe, 0x7a, 0xd7, 0x34, 
-  0xf6, 0xbe, 0x52, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xff, 0x59, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xa6, 0xff, 0x60, 0x04, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xf6, 0xbe, 0x52, 
-  0xb3, 0xa6, 0x68, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x2e, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xef, 0xff, 0x04, 0x2d, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0x68, 
-  0x90, 0x8e, 0x90, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x04, 0x2d, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xa6, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x90, 0x8e, 0x90, 
-  0x23, 0x25, 0xf4, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0x55, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x23, 0x25, 0xf4, 
-  0x23, 0x25, 0xf4, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x46, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xdf, 0xff, 0xe3, 0x24, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x23, 0x25, 0xf4, 
-  0x90, 0x8e, 0x90, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xb6, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x90, 0x8e, 0x90, 
-  0xb3, 0xa6, 0x68, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x04, 0x35, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x9e, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0x68, 
-  0xf6, 0xbe, 0x52, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x2f, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x8e, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xff, 0x68, 0x4d, 0xff, 0xaa, 0x5d, 0xff, 0x04, 0x2d, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xf6, 0xbe, 0x52, 
-  0x7a, 0xd7, 0x34, 0xa0, 0x14, 0xfe, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xff, 0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x96, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xe3, 0x24, 0xff, 0x17, 0xc7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xff, 0xb4, 0xa6, 0xff, 0x68, 0x4d, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xfe, 0x7a, 0xd7, 0x34, 
-  0xbd, 0xef, 0x16, 0xe3, 0x24, 0xec, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x26, 0x3d, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xb6, 0xff, 0xe3, 0x24, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xff, 0xf6, 0xbe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x38, 0xcf, 0xff, 0xec, 0x6d, 0xff, 0xe2, 0x24, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xe3, 0x24, 0xec, 0xbd, 0xef, 0x16, 
-  0xff, 0xff, 0x02, 0x67, 0x4d, 0xc7, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xec, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0xdf, 0xff, 0x89, 0x55, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x71, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe7, 0xff, 0x71, 0x96, 0xff, 0x26, 0x3d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x67, 0x4d, 0xc7, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0x4e, 0x7e, 0x8e, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x71, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xa6, 0xff, 0x04, 0x2d, 0xff, 0x60, 0x04, 0xff, 0xec, 0x6d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x96, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x4e, 0x7e, 0x8e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x17, 0xc7, 0x49, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xd4, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xef, 0xff, 0xb3, 0xa6, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0x6d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x17, 0xc7, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfe, 0xf7, 0x10, 0x04, 0x2d, 0xe4, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xff, 0xd5, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0xb6, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x04, 0x2d, 0xe4, 0xfe, 0xf7, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0x7e, 0x98, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xff, 0xb4, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb3, 0xa6, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x0d, 0x7e, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xd7, 0x38, 0xa1, 0x14, 0xfc, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x71, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0x65, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa1, 0x14, 0xfc, 0x59, 0xd7, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xa9, 0x55, 0xbb, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xec, 0x6d, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x04, 0x35, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa9, 0x55, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xc7, 0x46, 0xa0, 0x14, 0xfe, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x26, 0x3d, 0xff, 0x38, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xcf, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xfe, 0x37, 0xc7, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xaa, 0x5d, 0xb3, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa1, 0x14, 0xff, 0x2f, 0x7e, 0xff, 0xdd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x71, 0x96, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xaa, 0x5d, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xdf, 0x2d, 0xc2, 0x1c, 0xf3, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x05, 0x35, 0xff, 0xb3, 0xa6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x89, 0x55, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xc2, 0x1c, 0xf3, 0x9a, 0xdf, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0x96, 0x7a, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x46, 0x3d, 0xff, 0xb3, 0xa6, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbd, 0xef, 0xff, 0xe2, 0x24, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x91, 0x96, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x89, 0x55, 0xbc, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x04, 0x2d, 0xff, 0x2e, 0x7e, 0xff, 0x59, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xb6, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xbc, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0xef, 0x1f, 0x04, 0x35, 0xe0, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0x46, 0x3d, 0xff, 0x0e, 0x7e, 0xff, 0xf6, 0xb6, 0xff, 0x9c, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xf7, 0xff, 0x67, 0x45, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x04, 0x35, 0xe0, 0xdc, 0xef, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xcf, 0x3a, 0xc2, 0x1c, 0xef, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xff, 0x25, 0x3d, 0xff, 0xaa, 0x5d, 0xff, 0x0e, 0x7e, 0xff, 0x71, 0x96, 0xff, 0xb4, 0xa6, 0xff, 0xf5, 0xb6, 0xff, 0xf6, 0xb6, 0xff, 0x92, 0x9e, 0xff, 0x46, 0x3d, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0xc2, 0x1c, 0xef, 0x59, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbf, 0x4b, 0xc1, 0x1c, 0xf4, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x0c, 0xff, 0xc1, 0x1c, 0xf4, 0x17, 0xbf, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x17, 0xbf, 0x4c, 0xc2, 0x1c, 0xef, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xef, 0x17, 0xbf, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xcf, 0x3c, 0x04, 0x35, 0xde, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x04, 0x35, 0xde, 0x59, 0xcf, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9c, 0xe7, 0x21, 0x89, 0x55, 0xba, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xba, 0x9c, 0xe7, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x71, 0x96, 0x7a, 0xc2, 0x1c, 0xf2, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xf2, 0x71, 0x96, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7a, 0xdf, 0x30, 0xca, 0x5d, 0xb1, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xca, 0x5d, 0xb1, 0x7a, 0xdf, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0xc7, 0x48, 0x89, 0x55, 0xb9, 0xa1, 0x14, 0xfc, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0xa1, 0x14, 0xfc, 0x89, 0x55, 0xb9, 0x37, 0xc7, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xcf, 0x3a, 0x0d, 0x76, 0x97, 0x04, 0x2d, 0xe1, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x0c, 0xff, 0x04, 0x2d, 0xe1, 0x0d, 0x76, 0x97, 0x59, 0xcf, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xf7, 0x11, 0x17, 0xbf, 0x4a, 0x2e, 0x7e, 0x8e, 0x67, 0x4d, 0xc6, 0xe3, 0x24, 0xeb, 0xa0, 0x14, 0xfe, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xfe, 0xe3, 0x24, 0xeb, 0x67, 0x4d, 0xc6, 0x2e, 0x7e, 0x8e, 0x17, 0xbf, 0x4a, 0xfe, 0xf7, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbd, 0xef, 0x16, 0x7a, 0xd7, 0x34, 0xf6, 0xbe, 0x52, 0xb3, 0xa6, 0x6a, 0x70, 0x8e, 0x8f, 0x23, 0x25, 0xf4, 0x23, 0x25, 0xf4, 0x70, 0x8e, 0x8f, 0xb3, 0xa6, 0x6a, 0xf6, 0xbe, 0x52, 0x7a, 0xd7, 0x34, 0xbd, 0xef, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x00, 0x04, 0xbd, 0xef, 0x16, 0x7a, 0xd7, 0x34, 0xf6, 0xbe, 0x52, 0xb3, 0xa6, 0x6a, 0x70, 0x8e, 0x8f, 0x81, 0x23, 0x25, 0xf4, 0x04, 0x70, 0x8e, 0x8f, 0xb3, 0xa6, 0x6a, 0xf6, 
+  0xbe, 0x52, 0x7a, 0xd7, 0x34, 0xbd, 0xef, 0x16, 0xab, 0x00, 0x00, 0x00, 0x05, 0xfe, 0xf7, 0x11, 0x17, 0xbf, 0x4a, 0x2e, 0x7e, 0x8e, 0x67, 0x4d, 0xc6, 0xe3, 0x24, 0xeb, 0xa0, 0x14, 0xfe, 0x82, 
+  0x80, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x82, 0x80, 0x0c, 0xff, 0x05, 0xa0, 0x14, 0xfe, 0xe3, 0x24, 0xeb, 0x67, 0x4d, 0xc6, 0x2e, 0x7e, 0x8e, 0x17, 0xbf, 0x4a, 0xfe, 0xf7, 0x11, 0xa5, 0x00, 
+  0x00, 0x00, 0x03, 0x59, 0xcf, 0x3a, 0x0d, 0x76, 0x97, 0x04, 0x2d, 0xe1, 0xa0, 0x0c, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x8b, 0xa0, 0x14, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x03, 0xa0, 0x0c, 0xff, 0x04, 
+  0x2d, 0xe1, 0x0d, 0x76, 0x97, 0x59, 0xcf, 0x3a, 0xa1, 0x00, 0x00, 0x00, 0x03, 0x37, 0xc7, 0x48, 0x89, 0x55, 0xb9, 0xa1, 0x14, 0xfc, 0x80, 0x0c, 0xff, 0x93, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 
+  0xff, 0xa1, 0x14, 0xfc, 0x89, 0x55, 0xb9, 0x37, 0xc7, 0x48, 0x9d, 0x00, 0x00, 0x00, 0x03, 0x7a, 0xdf, 0x30, 0xca, 0x5d, 0xb1, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x97, 0xa0, 0x14, 0xff, 0x03, 
+  0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xca, 0x5d, 0xb1, 0x7a, 0xdf, 0x30, 0x99, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x06, 0x71, 0x96, 0x7a, 0xc2, 0x1c, 0xf2, 0x80, 0x0c, 0xff, 0x9b, 0xa0, 0x14, 
+  0xff, 0x03, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xf2, 0x71, 0x96, 0x7a, 0xff, 0xff, 0x06, 0x96, 0x00, 0x00, 0x00, 0x02, 0x9c, 0xe7, 0x21, 0x89, 0x55, 0xba, 0x80, 0x0c, 0xff, 0x9f, 0xa0, 0x14, 0xff, 
+  0x02, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xba, 0x9c, 0xe7, 0x21, 0x94, 0x00, 0x00, 0x00, 0x02, 0x59, 0xcf, 0x3c, 0x04, 0x35, 0xde, 0x80, 0x0c, 0xff, 0xa1, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 
+  0x04, 0x35, 0xde, 0x59, 0xcf, 0x3c, 0x92, 0x00, 0x00, 0x00, 0x02, 0x17, 0xbf, 0x4c, 0xc2, 0x1c, 0xef, 0x80, 0x0c, 0xff, 0xa3, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xef, 0x17, 
+  0xbf, 0x4c, 0x90, 0x00, 0x00, 0x00, 0x02, 0x17, 0xbf, 0x4b, 0xc1, 0x1c, 0xf4, 0xa0, 0x0c, 0xff, 0x86, 0xa0, 0x14, 0xff, 0x83, 0x80, 0x0c, 0xff, 0x9a, 0xa0, 0x14, 0xff, 0x02, 0xa0, 0x0c, 0xff, 
+  0xc1, 0x1c, 0xf4, 0x17, 0xbf, 0x4b, 0x8e, 0x00, 0x00, 0x00, 0x02, 0x59, 0xcf, 0x3a, 0xc2, 0x1c, 0xef, 0xa0, 0x0c, 0xff, 0x83, 0xa0, 0x14, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x06, 0xa0, 0x14, 0xff, 
+  0x04, 0x35, 0xff, 0xcb, 0x65, 0xff, 0xb3, 0xa6, 0xff, 0xd5, 0xae, 0xff, 0xec, 0x6d, 0xff, 0xa1, 0x14, 0xff, 0x9a, 0xa0, 0x14, 0xff, 0x02, 0xa0, 0x0c, 0xff, 0xc2, 0x1c, 0xef, 0x59, 0xcf, 0x3a, 
+  0x8c, 0x00, 0x00, 0x00, 0x02, 0xdc, 0xef, 0x1f, 0x04, 0x35, 0xe0, 0x80, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x04, 0xe3, 0x24, 0xff, 0x89, 0x55, 0xff, 0x71, 0x96, 0xff, 
+  0x59, 0xcf, 0xff, 0xfe, 0xf7, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x92, 0x96, 0xff, 0x80, 0x0c, 0xff, 0x9a, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x04, 0x35, 0xe0, 0xdc, 0xef, 0x1f, 0x8a, 
+  0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 0x89, 0x55, 0xbc, 0x80, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0x67, 0x45, 0xff, 0xf6, 0xb6, 0xff, 0xbd, 0xef, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0x01, 0x25, 0x3d, 0xff, 0xa0, 0x0c, 0xff, 0x9a, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xbc, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x01, 0x91, 0x96, 0x7a, 0x80, 
+  0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x02, 0xa0, 0x0c, 0xff, 0x46, 0x3d, 0xff, 0xde, 0xf7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x71, 0x96, 0xff, 0x80, 0x0c, 0xff, 0x9b, 0xa0, 0x14, 0xff, 0x01, 
+  0x80, 0x0c, 0xff, 0x91, 0x96, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x01, 0x9a, 0xdf, 0x2d, 0xc2, 0x1c, 0xf3, 0x82, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0xff, 0x8b, 0xff, 0xff, 0xff, 
+  0x01, 0xbc, 0xef, 0xff, 0xe2, 0x24, 0xff, 0x9c, 0xa0, 0x14, 0xff, 0x01, 0xc2, 0x1c, 0xf3, 0x9a, 0xdf, 0x2d, 0x86, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x01, 0xaa, 0x5d, 0xb3, 0x80, 0x0c, 0xff, 
+  0x82, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xf6, 0xb6, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xec, 0x6d, 0xff, 0x80, 0x0c, 0xff, 0x9b, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0xaa, 0x5d, 
+  0xb3, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00, 0x01, 0x37, 0xc7, 0x46, 0xa0, 0x14, 0xfe, 0x83, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xf5, 0xb6, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x59, 
+  0xcf, 0xff, 0xa1, 0x14, 0xff, 0x9c, 0xa0, 0x14, 0xff, 0x01, 0xa0, 0x14, 0xfe, 0x37, 0xc7, 0x46, 0x84, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0xa9, 0x55, 0xbb, 0x80, 0x0c, 0xff, 0x83, 0xa0, 
+  0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xb4, 0xa6, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x67, 0x4d, 0xff, 0x80, 0x0c, 0xff, 0x9b, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0xa9, 0x55, 0xbb, 0xff, 
+  0xff, 0x02, 0x83, 0x00, 0x00, 0x00, 0x01, 0x59, 0xd7, 0x38, 0xa1, 0x14, 0xfc, 0x84, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x71, 0x96, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xd4, 0xae, 0xff, 
+  0x80, 0x0c, 0xff, 0x9c, 0xa0, 0x14, 0xff, 0x01, 0xa1, 0x14, 0xfc, 0x59, 0xd7, 0x38, 0x83, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x7e, 0x98, 0x80, 0x0c, 0xff, 0x84, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 
+  0xff, 0x0e, 0x7e, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xde, 0xf7, 0xff, 0x04, 0x2d, 0xff, 0x9c, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x0d, 0x7e, 0x98, 0x82, 0x00, 0x00, 0x00, 0x01, 0xfe, 
+  0xf7, 0x10, 0x04, 0x2d, 0xe4, 0x85, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xaa, 0x5d, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xaa, 0x5d, 0xff, 0x80, 0x0c, 0xff, 0x9c, 0xa0, 0x14, 0xff, 0x01, 
+  0x04, 0x2d, 0xe4, 0xfe, 0xf7, 0x10, 0x81, 0x00, 0x00, 0x00, 0x01, 0x17, 0xc7, 0x49, 0xa0, 0x0c, 0xff, 0x85, 0xa0, 0x14, 0xff, 0x01, 0xa0, 0x0c, 0xff, 0x25, 0x3d, 0xff, 0x8e, 0xff, 0xff, 0xff, 
+  0x01, 0x68, 0x4d, 0xff, 0x80, 0x0c, 0xff, 0x9c, 0xa0, 0x14, 0xff, 0x01, 0xa0, 0x0c, 0xff, 0x17, 0xc7, 0x49, 0x81, 0x00, 0x00, 0x00, 0x01, 0x4e, 0x7e, 0x8e, 0x80, 0x0c, 0xff, 0x86, 0xa0, 0x14, 
+  0xff, 0x01, 0xc2, 0x1c, 0xff, 0x9c, 0xe7, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x17, 0xc7, 0xff, 0xa1, 0x14, 0xff, 0x9d, 0xa0, 0x14, 0xff, 0x05, 0x80, 0x0c, 0xff, 0x4e, 0x7e, 0x8e, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0x02, 0x67, 0x4d, 0xc7, 0x80, 0x0c, 0xff, 0x86, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xf6, 0xb6, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xb6, 0xff, 0xe3, 0x24, 0xff, 
+  0x9e, 0xa0, 0x14, 0xff, 0x04, 0x80, 0x0c, 0xff, 0x67, 0x4d, 0xc7, 0xff, 0xff, 0x02, 0xbd, 0xef, 0x16, 0xe3, 0x24, 0xec, 0x87, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x0e, 0x7e, 0xff, 0x8a, 
+  0xff, 0xff, 0xff, 0x01, 0x71, 0x96, 0xff, 0xa1, 0x14, 0xff, 0xa0, 0xa0, 0x14, 0xff, 0x03, 0xe3, 0x24, 0xec, 0xbd, 0xef, 0x16, 0x7a, 0xd7, 0x34, 0xa0, 0x14, 0xfe, 0x87, 0xa0, 0x14, 0xff, 0x01, 
+  0xa0, 0x0c, 0xff, 0x46, 0x3d, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xdd, 0xf7, 0xff, 0xec, 0x6d, 0xff, 0x80, 0x0c, 0xff, 0xa1, 0xa0, 0x14, 0xff, 0x03, 0xa0, 0x14, 0xfe, 0x7a, 0xd7, 0x34, 0xf6, 
+  0xbe, 0x52, 0x80, 0x0c, 0xff, 0x88, 0xa0, 0x14, 0xff, 0x01, 0xa1, 0x14, 0xff, 0x59, 0xcf, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xb3, 0xa6, 0xff, 0x60, 0x04, 0xff, 0xa2, 0xa0, 0x14, 0xff, 0x03, 
+  0x80, 0x0c, 0xff, 0xf6, 0xbe, 0x52, 0xb3, 0xa6, 0x68, 0x80, 0x0c, 0xff, 0x88, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x2e, 0x7e, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xef, 0xff, 0x04, 
+  0x2d, 0xff, 0xa2, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0x68, 0x90, 0x8e, 0x90, 0x80, 0x0c, 0xff, 0x89, 0xa0, 0x14, 0xff, 0x01, 0x04, 0x2d, 0xff, 0xde, 0xf7, 0xff, 0x87, 0xff, 
+  0xff, 0xff, 0x01, 0xb3, 0xa6, 0xff, 0x80, 0x0c, 0xff, 0xa1, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x90, 0x8e, 0x90, 0x23, 0x25, 0xf4, 0x8a, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xb3, 
+  0xa6, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x89, 0x55, 0xff, 0x80, 0x0c, 0xff, 0xa1, 0xa0, 0x14, 0xff, 0x81, 0x23, 0x25, 0xf4, 0x8a, 0xa0, 0x14, 0xff, 0x01, 0xa0, 0x0c, 0xff, 0x46, 0x3d, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0x01, 0x9b, 0xdf, 0xff, 0xe3, 0x24, 0xff, 0xa1, 0xa0, 0x14, 0xff, 0x02, 0x23, 0x25, 0xf4, 0x90, 0x8e, 0x90, 0x80, 0x0c, 0xff, 0x8a, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 
+  0xff, 0xb3, 0xa6, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xb6, 0xff, 0xa1, 0x14, 0xff, 0x9f, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0x90, 0x8e, 0x90, 0xb3, 0xa6, 0x68, 0x80, 0x0c, 0xff, 
+  0x8a, 0xa0, 0x14, 0xff, 0x02, 0xa0, 0x0c, 0xff, 0x04, 0x35, 0xff, 0xde, 0xf7, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x92, 0x9e, 0xff, 0x80, 0x0c, 0xff, 0x8a, 0xa0, 0x14, 0xff, 0x81, 0x80, 0x0c, 
+  0xff, 0x91, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0xb3, 0xa6, 0x68, 0xf6, 0xbe, 0x52, 0x80, 0x0c, 0xff, 0x8b, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x2f, 0x86, 0xff, 0x89, 0xff, 0xff, 
+  0xff, 0x01, 0x70, 0x8e, 0xff, 0x80, 0x0c, 0xff, 0x88, 0xa0, 0x14, 0xff, 0x03, 0xa1, 0x14, 0xff, 0x68, 0x4d, 0xff, 0xaa, 0x5d, 0xff, 0x04, 0x2d, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x8e, 0xa0, 0x14, 
+  0xff, 0x03, 0x80, 0x0c, 0xff, 0xf6, 0xbe, 0x52, 0x7a, 0xd7, 0x34, 0xa0, 0x14, 0xfe, 0x8c, 0xa0, 0x14, 0xff, 0x01, 0xa1, 0x14, 0xff, 0x38, 0xcf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x92, 0x96, 
+  0xff, 0xa1, 0x14, 0xff, 0x86, 0xa0, 0x14, 0xff, 0x01, 0xe3, 0x24, 0xff, 0x17, 0xc7, 0xff, 0x81, 0xff, 0xff, 0xff, 0x04, 0xde, 0xf7, 0xff, 0xb4, 0xa6, 0xff, 0x68, 0x4d, 0xff, 0xa0, 0x14, 0xff, 
+  0x80, 0x0c, 0xff, 0x8c, 0xa0, 0x14, 0xff, 0x03, 0xa0, 0x14, 0xfe, 0x7a, 0xd7, 0x34, 0xbd, 0xef, 0x16, 0xe3, 0x24, 0xec, 0x8c, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x26, 0x3d, 0xff, 0xde, 
+  0xf7, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xf5, 0xb6, 0xff, 0xe3, 0x24, 0xff, 0x80, 0x0c, 0xff, 0x83, 0xa0, 0x14, 0xff, 0x01, 0xa1, 0x14, 0xff, 0xf6, 0xbe, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 
+  0x38, 0xcf, 0xff, 0xec, 0x6d, 0xff, 0xe2, 0x24, 0xff, 0x80, 0x0c, 0xff, 0xa0, 0x0c, 0xff, 0x89, 0xa0, 0x14, 0xff, 0x04, 0xe3, 0x24, 0xec, 0xbd, 0xef, 0x16, 0xff, 0xff, 0x02, 0x67, 0x4d, 0xc7, 
+  0x80, 0x0c, 0xff, 0x8c, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0xec, 0x6d, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0x9b, 0xdf, 0xff, 0x89, 0x55, 0xff, 0x80, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 
+  0x01, 0x80, 0x0c, 0xff, 0x71, 0x96, 0xff, 0x88, 0xff, 0xff, 0xff, 0x03, 0xbc, 0xe7, 0xff, 0x71, 0x96, 0xff, 0x26, 0x3d, 0xff, 0x80, 0x0c, 0xff, 0x87, 0xa0, 0x14, 0xff, 0x05, 0x80, 0x0c, 0xff, 
+  0x67, 0x4d, 0xc7, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x4e, 0x7e, 0x8e, 0x80, 0x0c, 0xff, 0x8d, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x71, 0x96, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0xb3, 
+  0xa6, 0xff, 0x04, 0x2d, 0xff, 0x60, 0x04, 0xff, 0xec, 0x6d, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x71, 0x96, 0xff, 0xa1, 0x14, 0xff, 0x86, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x4e, 0x7e, 
+  0x8e, 0x81, 0x00, 0x00, 0x00, 0x01, 0x17, 0xc7, 0x49, 0xa0, 0x0c, 0xff, 0x8f, 0xa0, 0x14, 0xff, 0x00, 0xd4, 0xa6, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xbd, 0xef, 0xff, 0xb3, 0xa6, 0xff, 0xde, 
+  0xf7, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xec, 0x6d, 0xff, 0x80, 0x0c, 0xff, 0x85, 0xa0, 0x14, 0xff, 0x01, 0xa0, 0x0c, 0xff, 0x17, 0xc7, 0x49, 0x81, 0x00, 0x00, 0x00, 0x01, 0xfe, 0xf7, 0x10, 
+  0x04, 0x2d, 0xe4, 0x8f, 0xa0, 0x14, 0xff, 0x01, 0xa1, 0x14, 0xff, 0xd5, 0xae, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x01, 0xf5, 0xb6, 0xff, 0x80, 0x0c, 0xff, 0x85, 0xa0, 0x14, 0xff, 0x01, 0x04, 0x2d, 
+  0xe4, 0xfe, 0xf7, 0x10, 0x82, 0x00, 0x00, 0x00, 0x01, 0x0d, 0x7e, 0x98, 0x80, 0x0c, 0xff, 0x8f, 0xa0, 0x14, 0xff, 0x01, 0xa1, 0x14, 0xff, 0xb4, 0xa6, 0xff, 0x9a, 0xff, 0xff, 0xff, 0x01, 0xb3, 
+  0xa6, 0xff, 0x80, 0x0c, 0xff, 0x84, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x0d, 0x7e, 0x98, 0x83, 0x00, 0x00, 0x00, 0x01, 0x59, 0xd7, 0x38, 0xa1, 0x14, 0xfc, 0x91, 0xa0, 0x14, 0xff, 0x00, 
+  0x71, 0x8e, 0xff, 0x99, 0xff, 0xff, 0xff, 0x01, 0xcb, 0x65, 0xff, 0x80, 0x0c, 0xff, 0x84, 0xa0, 0x14, 0xff, 0x01, 0xa1, 0x14, 0xfc, 0x59, 0xd7, 0x38, 0x83, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0x02, 0xa9, 0x55, 0xbb, 0x80, 0x0c, 0xff, 0x90, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0xec, 0x6d, 0xff, 0xde, 0xf7, 0xff, 0x96, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xff, 0xff, 0x04, 0x35, 0xff, 
+  0x84, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0xa9, 0x55, 0xbb, 0xff, 0xff, 0x02, 0x84, 0x00, 0x00, 0x00, 0x01, 0x37, 0xc7, 0x46, 0xa0, 0x14, 0xfe, 0x91, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 
+  0xff, 0x26, 0x3d, 0xff, 0x38, 0xcf, 0xff, 0x95, 0xff, 0xff, 0xff, 0x00, 0x59, 0xcf, 0xff, 0x85, 0xa0, 0x14, 0xff, 0x01, 0xa0, 0x14, 0xfe, 0x37, 0xc7, 0x46, 0x85, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0xff, 0x01, 0xaa, 0x5d, 0xb3, 0x80, 0x0c, 0xff, 0x91, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0xa1, 0x14, 0xff, 0x2f, 0x7e, 0xff, 0xdd, 0xf7, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0x71, 0x96, 
+  0xff, 0x80, 0x0c, 0xff, 0x83, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0xaa, 0x5d, 0xb3, 0xff, 0xff, 0x01, 0x86, 0x00, 0x00, 0x00, 0x01, 0x9a, 0xdf, 0x2d, 0xc2, 0x1c, 0xf3, 0x93, 0xa0, 0x14, 
+  0xff, 0x02, 0x80, 0x0c, 0xff, 0x05, 0x35, 0xff, 0xb3, 0xa6, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0x89, 0x55, 0xff, 0x80, 0x0c, 0xff, 0x83, 0xa0, 0x14, 0xff, 0x01, 0xc2, 0x1c, 0xf3, 0x9a, 0xdf, 
+  0x2d, 0x88, 0x00, 0x00, 0x00, 0x01, 0x91, 0x96, 0x7a, 0x80, 0x0c, 0xff, 0x93, 0xa0, 0x14, 0xff, 0x04, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x46, 0x3d, 0xff, 0xb3, 0xa6, 0xff, 0xde, 0xf7, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0x01, 0xbd, 0xef, 0xff, 0xe2, 0x24, 0xff, 0x83, 0xa0, 0x14, 0xff, 0x01, 0x80, 0x0c, 0xff, 0x91, 0x96, 0x7a, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 0x89, 0x55, 
+  0xbc, 0x80, 0x0c, 0xff, 0x94, 0xa0, 0x14, 0xff, 0x04, 0xa0, 0x0c, 0xff, 0x80, 0x0c, 0xff, 0x04, 0x2d, 0xff, 0x2e, 0x7e, 0xff, 0x59, 0xcf, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xf6, 0xb6, 0xff, 
+  0x80, 0x0c, 0xff, 0x82, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xbc, 0xff, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xdc, 0xef, 0x1f, 0x04, 0x35, 0xe0, 0x80, 0x0c, 0xff, 0x96, 
+  0xa0, 0x14, 0xff, 0x05, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0x46, 0x3d, 0xff, 0x0e, 0x7e, 0xff, 0xf6, 0xb6, 0xff, 0x9c, 0xe7, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0xde, 0xf7, 0xff, 0x67, 0x45, 
+  0xff, 0x80, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x04, 0x35, 0xe0, 0xdc, 0xef, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x02, 0x59, 0xcf, 0x3a, 0xc2, 0x1c, 0xef, 0xa0, 0x0c, 0xff, 
+  0x97, 0xa0, 0x14, 0xff, 0x00, 0xa0, 0x0c, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x0a, 0xc2, 0x1c, 0xff, 0x25, 0x3d, 0xff, 0xaa, 0x5d, 0xff, 0x0e, 0x7e, 0xff, 0x71, 0x96, 0xff, 0xb4, 0xa6, 0xff, 0xf5, 
+  0xb6, 0xff, 0xf6, 0xb6, 0xff, 0x92, 0x9e, 0xff, 0x46, 0x3d, 0xff, 0x80, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x02, 0xa0, 0x0c, 0xff, 0xc2, 0x1c, 0xef, 0x59, 0xcf, 0x3a, 0x8e, 0x00, 0x00, 0x00, 
+  0x02, 0x17, 0xbf, 0x4b, 0xc1, 0x1c, 0xf4, 0xa0, 0x0c, 0xff, 0x9a, 0xa0, 0x14, 0xff, 0x00, 0xa0, 0x0c, 0xff, 0x86, 0x80, 0x0c, 0xff, 0x00, 0xa0, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x02, 0xa0, 
+  0x0c, 0xff, 0xc1, 0x1c, 0xf4, 0x17, 0xbf, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x02, 0x17, 0xbf, 0x4c, 0xc2, 0x1c, 0xef, 0x80, 0x0c, 0xff, 0xa3, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 
+  0xef, 0x17, 0xbf, 0x4c, 0x92, 0x00, 0x00, 0x00, 0x02, 0x59, 0xcf, 0x3c, 0x04, 0x35, 0xde, 0x80, 0x0c, 0xff, 0xa1, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x04, 0x35, 0xde, 0x59, 0xcf, 0x3c, 
+  0x94, 0x00, 0x00, 0x00, 0x02, 0x9c, 0xe7, 0x21, 0x89, 0x55, 0xba, 0x80, 0x0c, 0xff, 0x9f, 0xa0, 0x14, 0xff, 0x02, 0x80, 0x0c, 0xff, 0x89, 0x55, 0xba, 0x9c, 0xe7, 0x21, 0x96, 0x00, 0x00, 0x00, 
+  0x03, 0xff, 0xff, 0x06, 0x71, 0x96, 0x7a, 0xc2, 0x1c, 0xf2, 0x80, 0x0c, 0xff, 0x9b, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0xc2, 0x1c, 0xf2, 0x71, 0x96, 0x7a, 0xff, 0xff, 0x06, 0x99, 0x00, 
+  0x00, 0x00, 0x03, 0x7a, 0xdf, 0x30, 0xca, 0x5d, 0xb1, 0xa0, 0x14, 0xff, 0x80, 0x0c, 0xff, 0x97, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0xa0, 0x14, 0xff, 0xca, 0x5d, 0xb1, 0x7a, 0xdf, 0x30, 
+  0x9d, 0x00, 0x00, 0x00, 0x03, 0x37, 0xc7, 0x48, 0x89, 0x55, 0xb9, 0xa1, 0x14, 0xfc, 0x80, 0x0c, 0xff, 0x93, 0xa0, 0x14, 0xff, 0x03, 0x80, 0x0c, 0xff, 0xa1, 0x14, 0xfc, 0x89, 0x55, 0xb9, 0x37, 
+  0xc7, 0x48, 0xa1, 0x00, 0x00, 0x00, 0x03, 0x59, 0xcf, 0x3a, 0x0d, 0x76, 0x97, 0x04, 0x2d, 0xe1, 0xa0, 0x0c, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x8b, 0xa0, 0x14, 0xff, 0x81, 0x80, 0x0c, 0xff, 0x03, 
+  0xa0, 0x0c, 0xff, 0x04, 0x2d, 0xe1, 0x0d, 0x76, 0x97, 0x59, 0xcf, 0x3a, 0xa5, 0x00, 0x00, 0x00, 0x05, 0xfe, 0xf7, 0x11, 0x17, 0xbf, 0x4a, 0x2e, 0x7e, 0x8e, 0x67, 0x4d, 0xc6, 0xe3, 0x24, 0xeb, 
+  0xa0, 0x14, 0xfe, 0x82, 0x80, 0x0c, 0xff, 0x81, 0xa0, 0x14, 0xff, 0x82, 0x80, 0x0c, 0xff, 0x05, 0xa0, 0x14, 0xfe, 0xe3, 0x24, 0xeb, 0x67, 0x4d, 0xc6, 0x2e, 0x7e, 0x8e, 0x17, 0xbf, 0x4a, 0xfe, 
+  0xf7, 0x11, 0xab, 0x00, 0x00, 0x00, 0x04, 0xbd, 0xef, 0x16, 0x7a, 0xd7, 0x34, 0xf6, 0xbe, 0x52, 0xb3, 0xa6, 0x6a, 0x70, 0x8e, 0x8f, 0x81, 0x23, 0x25, 0xf4, 0x04, 0x70, 0x8e, 0x8f, 0xb3, 0xa6, 
+  0x6a, 0xf6, 0xbe, 0x52, 0x7a, 0xd7, 0x34, 0xbd, 0xef, 0x16, 0x97, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
   /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xbd, 0x16, 0xd7, 0x7a, 0x34, 0xbe, 0xf6, 0x52, 0xa6, 0xb3, 0x6a, 0x8e, 0x70, 0x8f, 0x25, 0x23, 0xf4, 0x25, 0x23, 0xf4, 0x8e, 0x70, 0x8f, 0xa6, 0xb3, 0x6a, 0xbe, 0xf6, 0x52, 0xd7, 0x7a, 0x34, 0xef, 0xbd, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xfe, 0x11, 0xbf, 0x17, 0x4a, 0x7e, 0x2e, 0x8e, 0x4d, 0x67, 0xc6, 0x24, 0xe3, 0xeb, 0x14, 0xa0, 0xfe, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xfe, 0x24, 0xe3, 0xeb, 0x4d, 0x67, 0xc6, 0x7e, 0x2e, 0x8e, 0xbf, 0x17, 0x4a, 0xf7, 0xfe, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x59, 0x3a, 0x76, 0x0d, 0x97, 0x2d, 0x04, 0xe1, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0xa0, 0xff, 0x2d, 0x04, 0xe1, 0x76, 0x0d, 0x97, 0xcf, 0x59, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x37, 0x48, 0x55, 0x89, 0xb9, 0x14, 0xa1, 0xfc, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa1, 0xfc, 0x55, 0x89, 0xb9, 0xc7, 0x37, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7a, 0x30, 0x5d, 0xca, 0xb1, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x5d, 0xca, 0xb1, 0xdf, 0x7a, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x96, 0x71, 0x7a, 0x1c, 0xc2, 0xf2, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xf2, 0x96, 0x71, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x9c, 0x21, 0x55, 0x89, 0xba, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xba, 0xe7, 0x9c, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x59, 0x3c, 0x35, 0x04, 0xde, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x35, 0x04, 0xde, 0xcf, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x17, 0x4c, 0x1c, 0xc2, 0xef, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xef, 0xbf, 0x17, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x17, 0x4b, 0x1c, 0xc1, 0xf4, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x1c, 0xc1, 0xf4, 0xbf, 0x17, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x59, 0x3a, 0x1c, 0xc2, 0xef, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x35, 0x04, 0xff, 0x65, 0xcb, 0xff, 0xa6, 0xb3, 0xff, 0xae, 0xd5, 0xff, 0x6d, 0xec, 0xff, 0x14, 0xa1, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x1c, 0xc2, 0xef, 0xcf, 0x59, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xdc, 0x1f, 0x35, 0x04, 0xe0, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x24, 0xe3, 0xff, 0x55, 0x89, 0xff, 0x96, 0x71, 0xff, 0xcf, 0x59, 0xff, 0xf7, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x92, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x35, 0x04, 0xe0, 0xef, 0xdc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x55, 0x89, 0xbc, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x45, 0x67, 0xff, 0xb6, 0xf6, 0xff, 0xef, 0xbd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0x25, 0xff, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xbc, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x91, 0x7a, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x3d, 0x46, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x71, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x96, 0x91, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9a, 0x2d, 0x1c, 0xc2, 0xf3, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbc, 0xff, 0x24, 0xe2, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x1c, 0xc2, 0xf3, 0xdf, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x5d, 0xaa, 0xb3, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xb6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xec, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x5d, 0xaa, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x37, 0x46, 0x14, 0xa0, 0xfe, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xb6, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x59, 0xff, 0x14, 0xa1, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xfe, 0xc7, 0x37, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x55, 0xa9, 0xbb, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xa6, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x67, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x55, 0xa9, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x59, 0x38, 0x14, 0xa1, 0xfc, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x96, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xd4, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xfc, 0xd7, 0x59, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x0d, 0x98, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x7e, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xff, 0x2d, 0x04, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x7e, 0x0d, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf7, 0xfe, 0x10, 0x2d, 0x04, 0xe4, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x5d, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xaa, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x2d, 0x04, 0xe4, 0xf7, 0xfe, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xc7, 0x17, 0x49, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x3d, 0x25, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4d, 0x68, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0xc7, 0x17, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x7e, 0x4e, 0x8e, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x1c, 0xc2, 0xff, 0xe7, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc7, 0x17, 0xff, 0x14, 0xa1, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x7e, 0x4e, 0x8e, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x02, 0x4d, 0x67, 0xc7, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xb6, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0xff, 0x24, 0xe3, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x4d, 0x67, 0xc7, 0xff, 0xff, 0x02, 
-  0xef, 0xbd, 0x16, 0x24, 0xe3, 0xec, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x7e, 0x0e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x71, 0xff, 0x14, 0xa1, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x24, 0xe3, 0xec, 0xef, 0xbd, 0x16, 
-  0xd7, 0x7a, 0x34, 0x14, 0xa0, 0xfe, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x3d, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xdd, 0xff, 0x6d, 0xec, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xfe, 0xd7, 0x7a, 0x34, 
-  0xbe, 0xf6, 0x52, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xff, 0xcf, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xb3, 0xff, 0x04, 0x60, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xbe, 0xf6, 0x52, 
-  0xa6, 0xb3, 0x68, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x7e, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbd, 0xff, 0x2d, 0x04, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0x68, 
-  0x8e, 0x90, 0x90, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x2d, 0x04, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xb3, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x8e, 0x90, 0x90, 
-  0x25, 0x23, 0xf4, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x89, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x25, 0x23, 0xf4, 
-  0x25, 0x23, 0xf4, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x3d, 0x46, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9b, 0xff, 0x24, 0xe3, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x25, 0x23, 0xf4, 
-  0x8e, 0x90, 0x90, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0xff, 0x14, 0xa1, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x8e, 0x90, 0x90, 
-  0xa6, 0xb3, 0x68, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x35, 0x04, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9e, 0x92, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0x68, 
-  0xbe, 0xf6, 0x52, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x86, 0x2f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8e, 0x70, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xff, 0x4d, 0x68, 0xff, 0x5d, 0xaa, 0xff, 0x2d, 0x04, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0xbe, 0xf6, 0x52, 
-  0xd7, 0x7a, 0x34, 0x14, 0xa0, 0xfe, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xff, 0xcf, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x92, 0xff, 0x14, 0xa1, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x24, 0xe3, 0xff, 0xc7, 0x17, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xff, 0xa6, 0xb4, 0xff, 0x4d, 0x68, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xfe, 0xd7, 0x7a, 0x34, 
-  0xef, 0xbd, 0x16, 0x24, 0xe3, 0xec, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x3d, 0x26, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xf5, 0xff, 0x24, 0xe3, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xff, 0xbe, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x38, 0xff, 0x6d, 0xec, 0xff, 0x24, 0xe2, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x24, 0xe3, 0xec, 0xef, 0xbd, 0x16, 
-  0xff, 0xff, 0x02, 0x4d, 0x67, 0xc7, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x6d, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0x9b, 0xff, 0x55, 0x89, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x96, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xbc, 0xff, 0x96, 0x71, 0xff, 0x3d, 0x26, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x4d, 0x67, 0xc7, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0x7e, 0x4e, 0x8e, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x96, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xb3, 0xff, 0x2d, 0x04, 0xff, 0x04, 0x60, 0xff, 0x6d, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x71, 0xff, 0x14, 0xa1, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x7e, 0x4e, 0x8e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xc7, 0x17, 0x49, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0xa6, 0xd4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbd, 0xff, 0xa6, 0xb3, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0xec, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0xc7, 0x17, 0x49, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xf7, 0xfe, 0x10, 0x2d, 0x04, 0xe4, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xff, 0xae, 0xd5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xf5, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x2d, 0x04, 0xe4, 0xf7, 0xfe, 0x10, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7e, 0x0d, 0x98, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xff, 0xa6, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa6, 0xb3, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x7e, 0x0d, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0x59, 0x38, 0x14, 0xa1, 0xfc, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x8e, 0x71, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x65, 0xcb, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa1, 0xfc, 0xd7, 0x59, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x55, 0xa9, 0xbb, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x6d, 0xec, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0x35, 0x04, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x55, 0xa9, 0xbb, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x37, 0x46, 0x14, 0xa0, 0xfe, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x3d, 0x26, 0xff, 0xcf, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0x59, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xfe, 0xc7, 0x37, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x5d, 0xaa, 0xb3, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa1, 0xff, 0x7e, 0x2f, 0xff, 0xf7, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0x71, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x5d, 0xaa, 0xb3, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x9a, 0x2d, 0x1c, 0xc2, 0xf3, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x35, 0x05, 0xff, 0xa6, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x89, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x1c, 0xc2, 0xf3, 0xdf, 0x9a, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x96, 0x91, 0x7a, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x3d, 0x46, 0xff, 0xa6, 0xb3, 0xff, 0xf7, 0xde, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xbd, 0xff, 0x24, 0xe2, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x96, 0x91, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x55, 0x89, 0xbc, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x2d, 0x04, 0xff, 0x7e, 0x2e, 0xff, 0xcf, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xf6, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xbc, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xdc, 0x1f, 0x35, 0x04, 0xe0, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x3d, 0x46, 0xff, 0x7e, 0x0e, 0xff, 0xb6, 0xf6, 0xff, 0xe7, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xff, 0x45, 0x67, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x35, 0x04, 0xe0, 0xef, 0xdc, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x59, 0x3a, 0x1c, 0xc2, 0xef, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xff, 0x3d, 0x25, 0xff, 0x5d, 0xaa, 0xff, 0x7e, 0x0e, 0xff, 0x96, 0x71, 0xff, 0xa6, 0xb4, 0xff, 0xb6, 0xf5, 0xff, 0xb6, 0xf6, 0xff, 0x9e, 0x92, 0xff, 0x3d, 0x46, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x1c, 0xc2, 0xef, 0xcf, 0x59, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x17, 0x4b, 0x1c, 0xc1, 0xf4, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0xa0, 0xff, 0x1c, 0xc1, 0xf4, 0xbf, 0x17, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0x17, 0x4c, 0x1c, 0xc2, 0xef, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xef, 0xbf, 0x17, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x59, 0x3c, 0x35, 0x04, 0xde, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x35, 0x04, 0xde, 0xcf, 0x59, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe7, 0x9c, 0x21, 0x55, 0x89, 0xba, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xba, 0xe7, 0x9c, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x06, 0x96, 0x71, 0x7a, 0x1c, 0xc2, 0xf2, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xf2, 0x96, 0x71, 0x7a, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0x7a, 0x30, 0x5d, 0xca, 0xb1, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x5d, 0xca, 0xb1, 0xdf, 0x7a, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0x37, 0x48, 0x55, 0x89, 0xb9, 0x14, 0xa1, 0xfc, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa1, 0xfc, 0x55, 0x89, 0xb9, 0xc7, 0x37, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0x59, 0x3a, 0x76, 0x0d, 0x97, 0x2d, 0x04, 0xe1, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0xa0, 0xff, 0x2d, 0x04, 0xe1, 0x76, 0x0d, 0x97, 0xcf, 0x59, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0xfe, 0x11, 0xbf, 0x17, 0x4a, 0x7e, 0x2e, 0x8e, 0x4d, 0x67, 0xc6, 0x24, 0xe3, 0xeb, 0x14, 0xa0, 0xfe, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xfe, 0x24, 0xe3, 0xeb, 0x4d, 0x67, 0xc6, 0x7e, 0x2e, 0x8e, 0xbf, 0x17, 0x4a, 0xf7, 0xfe, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xbd, 0x16, 0xd7, 0x7a, 0x34, 0xbe, 0xf6, 0x52, 0xa6, 0xb3, 0x6a, 0x8e, 0x70, 0x8f, 0x25, 0x23, 0xf4, 0x25, 0x23, 0xf4, 0x8e, 0x70, 0x8f, 0xa6, 0xb3, 0x6a, 0xbe, 0xf6, 0x52, 0xd7, 0x7a, 0x34, 0xef, 0xbd, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x00, 0x04, 0xef, 0xbd, 0x16, 0xd7, 0x7a, 0x34, 0xbe, 0xf6, 0x52, 0xa6, 0xb3, 0x6a, 0x8e, 0x70, 0x8f, 0x81, 0x25, 0x23, 0xf4, 0x04, 0x8e, 0x70, 0x8f, 0xa6, 0xb3, 0x6a, 0xbe, 
+  0xf6, 0x52, 0xd7, 0x7a, 0x34, 0xef, 0xbd, 0x16, 0xab, 0x00, 0x00, 0x00, 0x05, 0xf7, 0xfe, 0x11, 0xbf, 0x17, 0x4a, 0x7e, 0x2e, 0x8e, 0x4d, 0x67, 0xc6, 0x24, 0xe3, 0xeb, 0x14, 0xa0, 0xfe, 0x82, 
+  0x0c, 0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x82, 0x0c, 0x80, 0xff, 0x05, 0x14, 0xa0, 0xfe, 0x24, 0xe3, 0xeb, 0x4d, 0x67, 0xc6, 0x7e, 0x2e, 0x8e, 0xbf, 0x17, 0x4a, 0xf7, 0xfe, 0x11, 0xa5, 0x00, 
+  0x00, 0x00, 0x03, 0xcf, 0x59, 0x3a, 0x76, 0x0d, 0x97, 0x2d, 0x04, 0xe1, 0x0c, 0xa0, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x8b, 0x14, 0xa0, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x03, 0x0c, 0xa0, 0xff, 0x2d, 
+  0x04, 0xe1, 0x76, 0x0d, 0x97, 0xcf, 0x59, 0x3a, 0xa1, 0x00, 0x00, 0x00, 0x03, 0xc7, 0x37, 0x48, 0x55, 0x89, 0xb9, 0x14, 0xa1, 0xfc, 0x0c, 0x80, 0xff, 0x93, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 
+  0xff, 0x14, 0xa1, 0xfc, 0x55, 0x89, 0xb9, 0xc7, 0x37, 0x48, 0x9d, 0x00, 0x00, 0x00, 0x03, 0xdf, 0x7a, 0x30, 0x5d, 0xca, 0xb1, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x97, 0x14, 0xa0, 0xff, 0x03, 
+  0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x5d, 0xca, 0xb1, 0xdf, 0x7a, 0x30, 0x99, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x06, 0x96, 0x71, 0x7a, 0x1c, 0xc2, 0xf2, 0x0c, 0x80, 0xff, 0x9b, 0x14, 0xa0, 
+  0xff, 0x03, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xf2, 0x96, 0x71, 0x7a, 0xff, 0xff, 0x06, 0x96, 0x00, 0x00, 0x00, 0x02, 0xe7, 0x9c, 0x21, 0x55, 0x89, 0xba, 0x0c, 0x80, 0xff, 0x9f, 0x14, 0xa0, 0xff, 
+  0x02, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xba, 0xe7, 0x9c, 0x21, 0x94, 0x00, 0x00, 0x00, 0x02, 0xcf, 0x59, 0x3c, 0x35, 0x04, 0xde, 0x0c, 0x80, 0xff, 0xa1, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 
+  0x35, 0x04, 0xde, 0xcf, 0x59, 0x3c, 0x92, 0x00, 0x00, 0x00, 0x02, 0xbf, 0x17, 0x4c, 0x1c, 0xc2, 0xef, 0x0c, 0x80, 0xff, 0xa3, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xef, 0xbf, 
+  0x17, 0x4c, 0x90, 0x00, 0x00, 0x00, 0x02, 0xbf, 0x17, 0x4b, 0x1c, 0xc1, 0xf4, 0x0c, 0xa0, 0xff, 0x86, 0x14, 0xa0, 0xff, 0x83, 0x0c, 0x80, 0xff, 0x9a, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0xa0, 0xff, 
+  0x1c, 0xc1, 0xf4, 0xbf, 0x17, 0x4b, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xcf, 0x59, 0x3a, 0x1c, 0xc2, 0xef, 0x0c, 0xa0, 0xff, 0x83, 0x14, 0xa0, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x06, 0x14, 0xa0, 0xff, 
+  0x35, 0x04, 0xff, 0x65, 0xcb, 0xff, 0xa6, 0xb3, 0xff, 0xae, 0xd5, 0xff, 0x6d, 0xec, 0xff, 0x14, 0xa1, 0xff, 0x9a, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0xa0, 0xff, 0x1c, 0xc2, 0xef, 0xcf, 0x59, 0x3a, 
+  0x8c, 0x00, 0x00, 0x00, 0x02, 0xef, 0xdc, 0x1f, 0x35, 0x04, 0xe0, 0x0c, 0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x04, 0x24, 0xe3, 0xff, 0x55, 0x89, 0xff, 0x96, 0x71, 0xff, 
+  0xcf, 0x59, 0xff, 0xf7, 0xfe, 0xff, 0x83, 0xff, 0xff, 0xff, 0x01, 0x96, 0x92, 0xff, 0x0c, 0x80, 0xff, 0x9a, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x35, 0x04, 0xe0, 0xef, 0xdc, 0x1f, 0x8a, 
+  0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 0x55, 0x89, 0xbc, 0x0c, 0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0x45, 0x67, 0xff, 0xb6, 0xf6, 0xff, 0xef, 0xbd, 0xff, 0x88, 0xff, 
+  0xff, 0xff, 0x01, 0x3d, 0x25, 0xff, 0x0c, 0xa0, 0xff, 0x9a, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xbc, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x01, 0x96, 0x91, 0x7a, 0x0c, 
+  0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0xa0, 0xff, 0x3d, 0x46, 0xff, 0xf7, 0xde, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x96, 0x71, 0xff, 0x0c, 0x80, 0xff, 0x9b, 0x14, 0xa0, 0xff, 0x01, 
+  0x0c, 0x80, 0xff, 0x96, 0x91, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x9a, 0x2d, 0x1c, 0xc2, 0xf3, 0x82, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0xff, 0x8b, 0xff, 0xff, 0xff, 
+  0x01, 0xef, 0xbc, 0xff, 0x24, 0xe2, 0xff, 0x9c, 0x14, 0xa0, 0xff, 0x01, 0x1c, 0xc2, 0xf3, 0xdf, 0x9a, 0x2d, 0x86, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x01, 0x5d, 0xaa, 0xb3, 0x0c, 0x80, 0xff, 
+  0x82, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0xb6, 0xf6, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x6d, 0xec, 0xff, 0x0c, 0x80, 0xff, 0x9b, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x5d, 0xaa, 
+  0xb3, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00, 0x01, 0xc7, 0x37, 0x46, 0x14, 0xa0, 0xfe, 0x83, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0xb6, 0xf5, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xcf, 
+  0x59, 0xff, 0x14, 0xa1, 0xff, 0x9c, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa0, 0xfe, 0xc7, 0x37, 0x46, 0x84, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0x55, 0xa9, 0xbb, 0x0c, 0x80, 0xff, 0x83, 0x14, 
+  0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0xa6, 0xb4, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x4d, 0x67, 0xff, 0x0c, 0x80, 0xff, 0x9b, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x55, 0xa9, 0xbb, 0xff, 
+  0xff, 0x02, 0x83, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x59, 0x38, 0x14, 0xa1, 0xfc, 0x84, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x96, 0x71, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xae, 0xd4, 0xff, 
+  0x0c, 0x80, 0xff, 0x9c, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa1, 0xfc, 0xd7, 0x59, 0x38, 0x83, 0x00, 0x00, 0x00, 0x01, 0x7e, 0x0d, 0x98, 0x0c, 0x80, 0xff, 0x84, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 
+  0xff, 0x7e, 0x0e, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xf7, 0xde, 0xff, 0x2d, 0x04, 0xff, 0x9c, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x7e, 0x0d, 0x98, 0x82, 0x00, 0x00, 0x00, 0x01, 0xf7, 
+  0xfe, 0x10, 0x2d, 0x04, 0xe4, 0x85, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x5d, 0xaa, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0x5d, 0xaa, 0xff, 0x0c, 0x80, 0xff, 0x9c, 0x14, 0xa0, 0xff, 0x01, 
+  0x2d, 0x04, 0xe4, 0xf7, 0xfe, 0x10, 0x81, 0x00, 0x00, 0x00, 0x01, 0xc7, 0x17, 0x49, 0x0c, 0xa0, 0xff, 0x85, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0xa0, 0xff, 0x3d, 0x25, 0xff, 0x8e, 0xff, 0xff, 0xff, 
+  0x01, 0x4d, 0x68, 0xff, 0x0c, 0x80, 0xff, 0x9c, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0xa0, 0xff, 0xc7, 0x17, 0x49, 0x81, 0x00, 0x00, 0x00, 0x01, 0x7e, 0x4e, 0x8e, 0x0c, 0x80, 0xff, 0x86, 0x14, 0xa0, 
+  0xff, 0x01, 0x1c, 0xc2, 0xff, 0xe7, 0x9c, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xc7, 0x17, 0xff, 0x14, 0xa1, 0xff, 0x9d, 0x14, 0xa0, 0xff, 0x05, 0x0c, 0x80, 0xff, 0x7e, 0x4e, 0x8e, 0x00, 0x00, 
+  0x00, 0xff, 0xff, 0x02, 0x4d, 0x67, 0xc7, 0x0c, 0x80, 0xff, 0x86, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0xb6, 0xf6, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x01, 0xb6, 0xf6, 0xff, 0x24, 0xe3, 0xff, 
+  0x9e, 0x14, 0xa0, 0xff, 0x04, 0x0c, 0x80, 0xff, 0x4d, 0x67, 0xc7, 0xff, 0xff, 0x02, 0xef, 0xbd, 0x16, 0x24, 0xe3, 0xec, 0x87, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x7e, 0x0e, 0xff, 0x8a, 
+  0xff, 0xff, 0xff, 0x01, 0x96, 0x71, 0xff, 0x14, 0xa1, 0xff, 0xa0, 0x14, 0xa0, 0xff, 0x03, 0x24, 0xe3, 0xec, 0xef, 0xbd, 0x16, 0xd7, 0x7a, 0x34, 0x14, 0xa0, 0xfe, 0x87, 0x14, 0xa0, 0xff, 0x01, 
+  0x0c, 0xa0, 0xff, 0x3d, 0x46, 0xff, 0x88, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xdd, 0xff, 0x6d, 0xec, 0xff, 0x0c, 0x80, 0xff, 0xa1, 0x14, 0xa0, 0xff, 0x03, 0x14, 0xa0, 0xfe, 0xd7, 0x7a, 0x34, 0xbe, 
+  0xf6, 0x52, 0x0c, 0x80, 0xff, 0x88, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa1, 0xff, 0xcf, 0x59, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xa6, 0xb3, 0xff, 0x04, 0x60, 0xff, 0xa2, 0x14, 0xa0, 0xff, 0x03, 
+  0x0c, 0x80, 0xff, 0xbe, 0xf6, 0x52, 0xa6, 0xb3, 0x68, 0x0c, 0x80, 0xff, 0x88, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x7e, 0x2e, 0xff, 0x87, 0xff, 0xff, 0xff, 0x01, 0xef, 0xbd, 0xff, 0x2d, 
+  0x04, 0xff, 0xa2, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0x68, 0x8e, 0x90, 0x90, 0x0c, 0x80, 0xff, 0x89, 0x14, 0xa0, 0xff, 0x01, 0x2d, 0x04, 0xff, 0xf7, 0xde, 0xff, 0x87, 0xff, 
+  0xff, 0xff, 0x01, 0xa6, 0xb3, 0xff, 0x0c, 0x80, 0xff, 0xa1, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x8e, 0x90, 0x90, 0x25, 0x23, 0xf4, 0x8a, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0xa6, 
+  0xb3, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x55, 0x89, 0xff, 0x0c, 0x80, 0xff, 0xa1, 0x14, 0xa0, 0xff, 0x81, 0x25, 0x23, 0xf4, 0x8a, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0xa0, 0xff, 0x3d, 0x46, 0xff, 
+  0x88, 0xff, 0xff, 0xff, 0x01, 0xdf, 0x9b, 0xff, 0x24, 0xe3, 0xff, 0xa1, 0x14, 0xa0, 0xff, 0x02, 0x25, 0x23, 0xf4, 0x8e, 0x90, 0x90, 0x0c, 0x80, 0xff, 0x8a, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 
+  0xff, 0xa6, 0xb3, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0xb6, 0xf6, 0xff, 0x14, 0xa1, 0xff, 0x9f, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0x8e, 0x90, 0x90, 0xa6, 0xb3, 0x68, 0x0c, 0x80, 0xff, 
+  0x8a, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0xa0, 0xff, 0x35, 0x04, 0xff, 0xf7, 0xde, 0xff, 0x88, 0xff, 0xff, 0xff, 0x01, 0x9e, 0x92, 0xff, 0x0c, 0x80, 0xff, 0x8a, 0x14, 0xa0, 0xff, 0x81, 0x0c, 0x80, 
+  0xff, 0x91, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0xa6, 0xb3, 0x68, 0xbe, 0xf6, 0x52, 0x0c, 0x80, 0xff, 0x8b, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x86, 0x2f, 0xff, 0x89, 0xff, 0xff, 
+  0xff, 0x01, 0x8e, 0x70, 0xff, 0x0c, 0x80, 0xff, 0x88, 0x14, 0xa0, 0xff, 0x03, 0x14, 0xa1, 0xff, 0x4d, 0x68, 0xff, 0x5d, 0xaa, 0xff, 0x2d, 0x04, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x8e, 0x14, 0xa0, 
+  0xff, 0x03, 0x0c, 0x80, 0xff, 0xbe, 0xf6, 0x52, 0xd7, 0x7a, 0x34, 0x14, 0xa0, 0xfe, 0x8c, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa1, 0xff, 0xcf, 0x38, 0xff, 0x89, 0xff, 0xff, 0xff, 0x01, 0x96, 0x92, 
+  0xff, 0x14, 0xa1, 0xff, 0x86, 0x14, 0xa0, 0xff, 0x01, 0x24, 0xe3, 0xff, 0xc7, 0x17, 0xff, 0x81, 0xff, 0xff, 0xff, 0x04, 0xf7, 0xde, 0xff, 0xa6, 0xb4, 0xff, 0x4d, 0x68, 0xff, 0x14, 0xa0, 0xff, 
+  0x0c, 0x80, 0xff, 0x8c, 0x14, 0xa0, 0xff, 0x03, 0x14, 0xa0, 0xfe, 0xd7, 0x7a, 0x34, 0xef, 0xbd, 0x16, 0x24, 0xe3, 0xec, 0x8c, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x3d, 0x26, 0xff, 0xf7, 
+  0xde, 0xff, 0x89, 0xff, 0xff, 0xff, 0x02, 0xb6, 0xf5, 0xff, 0x24, 0xe3, 0xff, 0x0c, 0x80, 0xff, 0x83, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa1, 0xff, 0xbe, 0xf6, 0xff, 0x85, 0xff, 0xff, 0xff, 0x04, 
+  0xcf, 0x38, 0xff, 0x6d, 0xec, 0xff, 0x24, 0xe2, 0xff, 0x0c, 0x80, 0xff, 0x0c, 0xa0, 0xff, 0x89, 0x14, 0xa0, 0xff, 0x04, 0x24, 0xe3, 0xec, 0xef, 0xbd, 0x16, 0xff, 0xff, 0x02, 0x4d, 0x67, 0xc7, 
+  0x0c, 0x80, 0xff, 0x8c, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x6d, 0xec, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x02, 0xdf, 0x9b, 0xff, 0x55, 0x89, 0xff, 0x0c, 0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 
+  0x01, 0x0c, 0x80, 0xff, 0x96, 0x71, 0xff, 0x88, 0xff, 0xff, 0xff, 0x03, 0xe7, 0xbc, 0xff, 0x96, 0x71, 0xff, 0x3d, 0x26, 0xff, 0x0c, 0x80, 0xff, 0x87, 0x14, 0xa0, 0xff, 0x05, 0x0c, 0x80, 0xff, 
+  0x4d, 0x67, 0xc7, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x7e, 0x4e, 0x8e, 0x0c, 0x80, 0xff, 0x8d, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x96, 0x71, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x03, 0xa6, 
+  0xb3, 0xff, 0x2d, 0x04, 0xff, 0x04, 0x60, 0xff, 0x6d, 0xec, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0x96, 0x71, 0xff, 0x14, 0xa1, 0xff, 0x86, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x7e, 0x4e, 
+  0x8e, 0x81, 0x00, 0x00, 0x00, 0x01, 0xc7, 0x17, 0x49, 0x0c, 0xa0, 0xff, 0x8f, 0x14, 0xa0, 0xff, 0x00, 0xa6, 0xd4, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xef, 0xbd, 0xff, 0xa6, 0xb3, 0xff, 0xf7, 
+  0xde, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x6d, 0xec, 0xff, 0x0c, 0x80, 0xff, 0x85, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0xa0, 0xff, 0xc7, 0x17, 0x49, 0x81, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xfe, 0x10, 
+  0x2d, 0x04, 0xe4, 0x8f, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa1, 0xff, 0xae, 0xd5, 0xff, 0x9b, 0xff, 0xff, 0xff, 0x01, 0xb6, 0xf5, 0xff, 0x0c, 0x80, 0xff, 0x85, 0x14, 0xa0, 0xff, 0x01, 0x2d, 0x04, 
+  0xe4, 0xf7, 0xfe, 0x10, 0x82, 0x00, 0x00, 0x00, 0x01, 0x7e, 0x0d, 0x98, 0x0c, 0x80, 0xff, 0x8f, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa1, 0xff, 0xa6, 0xb4, 0xff, 0x9a, 0xff, 0xff, 0xff, 0x01, 0xa6, 
+  0xb3, 0xff, 0x0c, 0x80, 0xff, 0x84, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x7e, 0x0d, 0x98, 0x83, 0x00, 0x00, 0x00, 0x01, 0xd7, 0x59, 0x38, 0x14, 0xa1, 0xfc, 0x91, 0x14, 0xa0, 0xff, 0x00, 
+  0x8e, 0x71, 0xff, 0x99, 0xff, 0xff, 0xff, 0x01, 0x65, 0xcb, 0xff, 0x0c, 0x80, 0xff, 0x84, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa1, 0xfc, 0xd7, 0x59, 0x38, 0x83, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0x02, 0x55, 0xa9, 0xbb, 0x0c, 0x80, 0xff, 0x90, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x6d, 0xec, 0xff, 0xf7, 0xde, 0xff, 0x96, 0xff, 0xff, 0xff, 0x01, 0xff, 0xfe, 0xff, 0x35, 0x04, 0xff, 
+  0x84, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x55, 0xa9, 0xbb, 0xff, 0xff, 0x02, 0x84, 0x00, 0x00, 0x00, 0x01, 0xc7, 0x37, 0x46, 0x14, 0xa0, 0xfe, 0x91, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 
+  0xff, 0x3d, 0x26, 0xff, 0xcf, 0x38, 0xff, 0x95, 0xff, 0xff, 0xff, 0x00, 0xcf, 0x59, 0xff, 0x85, 0x14, 0xa0, 0xff, 0x01, 0x14, 0xa0, 0xfe, 0xc7, 0x37, 0x46, 0x85, 0x00, 0x00, 0x00, 0x02, 0xff, 
+  0xff, 0x01, 0x5d, 0xaa, 0xb3, 0x0c, 0x80, 0xff, 0x91, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0x14, 0xa1, 0xff, 0x7e, 0x2f, 0xff, 0xf7, 0xdd, 0xff, 0x93, 0xff, 0xff, 0xff, 0x01, 0x96, 0x71, 
+  0xff, 0x0c, 0x80, 0xff, 0x83, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x5d, 0xaa, 0xb3, 0xff, 0xff, 0x01, 0x86, 0x00, 0x00, 0x00, 0x01, 0xdf, 0x9a, 0x2d, 0x1c, 0xc2, 0xf3, 0x93, 0x14, 0xa0, 
+  0xff, 0x02, 0x0c, 0x80, 0xff, 0x35, 0x05, 0xff, 0xa6, 0xb3, 0xff, 0x92, 0xff, 0xff, 0xff, 0x01, 0x55, 0x89, 0xff, 0x0c, 0x80, 0xff, 0x83, 0x14, 0xa0, 0xff, 0x01, 0x1c, 0xc2, 0xf3, 0xdf, 0x9a, 
+  0x2d, 0x88, 0x00, 0x00, 0x00, 0x01, 0x96, 0x91, 0x7a, 0x0c, 0x80, 0xff, 0x93, 0x14, 0xa0, 0xff, 0x04, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x3d, 0x46, 0xff, 0xa6, 0xb3, 0xff, 0xf7, 0xde, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0x01, 0xef, 0xbd, 0xff, 0x24, 0xe2, 0xff, 0x83, 0x14, 0xa0, 0xff, 0x01, 0x0c, 0x80, 0xff, 0x96, 0x91, 0x7a, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x06, 0x55, 0x89, 
+  0xbc, 0x0c, 0x80, 0xff, 0x94, 0x14, 0xa0, 0xff, 0x04, 0x0c, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x2d, 0x04, 0xff, 0x7e, 0x2e, 0xff, 0xcf, 0x59, 0xff, 0x8c, 0xff, 0xff, 0xff, 0x01, 0xb6, 0xf6, 0xff, 
+  0x0c, 0x80, 0xff, 0x82, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xbc, 0xff, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xef, 0xdc, 0x1f, 0x35, 0x04, 0xe0, 0x0c, 0x80, 0xff, 0x96, 
+  0x14, 0xa0, 0xff, 0x05, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x3d, 0x46, 0xff, 0x7e, 0x0e, 0xff, 0xb6, 0xf6, 0xff, 0xe7, 0x9c, 0xff, 0x87, 0xff, 0xff, 0xff, 0x02, 0xf7, 0xde, 0xff, 0x45, 0x67, 
+  0xff, 0x0c, 0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x35, 0x04, 0xe0, 0xef, 0xdc, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xcf, 0x59, 0x3a, 0x1c, 0xc2, 0xef, 0x0c, 0xa0, 0xff, 
+  0x97, 0x14, 0xa0, 0xff, 0x00, 0x0c, 0xa0, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x0a, 0x1c, 0xc2, 0xff, 0x3d, 0x25, 0xff, 0x5d, 0xaa, 0xff, 0x7e, 0x0e, 0xff, 0x96, 0x71, 0xff, 0xa6, 0xb4, 0xff, 0xb6, 
+  0xf5, 0xff, 0xb6, 0xf6, 0xff, 0x9e, 0x92, 0xff, 0x3d, 0x46, 0xff, 0x0c, 0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0xa0, 0xff, 0x1c, 0xc2, 0xef, 0xcf, 0x59, 0x3a, 0x8e, 0x00, 0x00, 0x00, 
+  0x02, 0xbf, 0x17, 0x4b, 0x1c, 0xc1, 0xf4, 0x0c, 0xa0, 0xff, 0x9a, 0x14, 0xa0, 0xff, 0x00, 0x0c, 0xa0, 0xff, 0x86, 0x0c, 0x80, 0xff, 0x00, 0x0c, 0xa0, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x02, 0x0c, 
+  0xa0, 0xff, 0x1c, 0xc1, 0xf4, 0xbf, 0x17, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x02, 0xbf, 0x17, 0x4c, 0x1c, 0xc2, 0xef, 0x0c, 0x80, 0xff, 0xa3, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 
+  0xef, 0xbf, 0x17, 0x4c, 0x92, 0x00, 0x00, 0x00, 0x02, 0xcf, 0x59, 0x3c, 0x35, 0x04, 0xde, 0x0c, 0x80, 0xff, 0xa1, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x35, 0x04, 0xde, 0xcf, 0x59, 0x3c, 
+  0x94, 0x00, 0x00, 0x00, 0x02, 0xe7, 0x9c, 0x21, 0x55, 0x89, 0xba, 0x0c, 0x80, 0xff, 0x9f, 0x14, 0xa0, 0xff, 0x02, 0x0c, 0x80, 0xff, 0x55, 0x89, 0xba, 0xe7, 0x9c, 0x21, 0x96, 0x00, 0x00, 0x00, 
+  0x03, 0xff, 0xff, 0x06, 0x96, 0x71, 0x7a, 0x1c, 0xc2, 0xf2, 0x0c, 0x80, 0xff, 0x9b, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0x1c, 0xc2, 0xf2, 0x96, 0x71, 0x7a, 0xff, 0xff, 0x06, 0x99, 0x00, 
+  0x00, 0x00, 0x03, 0xdf, 0x7a, 0x30, 0x5d, 0xca, 0xb1, 0x14, 0xa0, 0xff, 0x0c, 0x80, 0xff, 0x97, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0x14, 0xa0, 0xff, 0x5d, 0xca, 0xb1, 0xdf, 0x7a, 0x30, 
+  0x9d, 0x00, 0x00, 0x00, 0x03, 0xc7, 0x37, 0x48, 0x55, 0x89, 0xb9, 0x14, 0xa1, 0xfc, 0x0c, 0x80, 0xff, 0x93, 0x14, 0xa0, 0xff, 0x03, 0x0c, 0x80, 0xff, 0x14, 0xa1, 0xfc, 0x55, 0x89, 0xb9, 0xc7, 
+  0x37, 0x48, 0xa1, 0x00, 0x00, 0x00, 0x03, 0xcf, 0x59, 0x3a, 0x76, 0x0d, 0x97, 0x2d, 0x04, 0xe1, 0x0c, 0xa0, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x8b, 0x14, 0xa0, 0xff, 0x81, 0x0c, 0x80, 0xff, 0x03, 
+  0x0c, 0xa0, 0xff, 0x2d, 0x04, 0xe1, 0x76, 0x0d, 0x97, 0xcf, 0x59, 0x3a, 0xa5, 0x00, 0x00, 0x00, 0x05, 0xf7, 0xfe, 0x11, 0xbf, 0x17, 0x4a, 0x7e, 0x2e, 0x8e, 0x4d, 0x67, 0xc6, 0x24, 0xe3, 0xeb, 
+  0x14, 0xa0, 0xfe, 0x82, 0x0c, 0x80, 0xff, 0x81, 0x14, 0xa0, 0xff, 0x82, 0x0c, 0x80, 0xff, 0x05, 0x14, 0xa0, 0xfe, 0x24, 0xe3, 0xeb, 0x4d, 0x67, 0xc6, 0x7e, 0x2e, 0x8e, 0xbf, 0x17, 0x4a, 0xf7, 
+  0xfe, 0x11, 0xab, 0x00, 0x00, 0x00, 0x04, 0xef, 0xbd, 0x16, 0xd7, 0x7a, 0x34, 0xbe, 0xf6, 0x52, 0xa6, 0xb3, 0x6a, 0x8e, 0x70, 0x8f, 0x81, 0x25, 0x23, 0xf4, 0x04, 0x8e, 0x70, 0x8f, 0xa6, 0xb3, 
+  0x6a, 0xbe, 0xf6, 0x52, 0xd7, 0x7a, 0x34, 0xef, 0xbd, 0x16, 0x97, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xf3, 0xe8, 0x16, 0xce, 0xeb, 0xce, 0x34, 0xae, 0xdd, 0xb4, 0x52, 0x98, 0xd4, 0x9c, 0x6a, 0x7f, 0xcd, 0x88, 0x8f, 0x16, 0xa2, 0x22, 0xf4, 0x16, 0xa2, 0x22, 0xf4, 0x7f, 0xcd, 0x88, 0x8f, 0x98, 0xd4, 0x9c, 0x6a, 0xae, 0xdd, 0xb4, 0x52, 0xce, 0xeb, 0xce, 0x34, 0xe8, 0xf3, 0xe8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xe0, 0xba, 0x4a, 0x73, 0xc4, 0x7a, 0x8e, 0x3b, 0xad, 0x46, 0xc6, 0x17, 0x9d, 0x23, 0xeb, 0x03, 0x95, 0x11, 0xfe, 0x00, 0x91, 0x09, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x91, 0x09, 0xff, 0x03, 0x95, 0x11, 0xfe, 0x17, 0x9d, 0x23, 0xeb, 0x3b, 0xad, 0x46, 0xc6, 0x73, 0xc4, 0x7a, 0x8e, 0xb7, 0xe0, 0xba, 0x4a, 0xf0, 0xff, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0xca, 0x3a, 0x6a, 0xc1, 0x71, 0x97, 0x20, 0xa0, 0x2a, 0xe1, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x20, 0xa0, 0x2a, 0xe1, 0x6a, 0xc1, 0x71, 0x97, 0xc6, 0xe9, 0xca, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xe3, 0xbc, 0x48, 0x48, 0xb0, 0x51, 0xb9, 0x04, 0x94, 0x10, 0xfc, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x04, 0x94, 0x10, 0xfc, 0x48, 0xb0, 0x51, 0xb9, 0xb8, 0xe3, 0xbc, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xea, 0xd5, 0x30, 0x51, 0xb6, 0x58, 0xb1, 0x01, 0x93, 0x0d, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x93, 0x0d, 0xff, 0x51, 0xb6, 0x58, 0xb1, 0xcf, 0xea, 0xd5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x88, 0xcd, 0x8c, 0x7a, 0x0e, 0x98, 0x19, 0xf2, 0x00, 0x90, 0x07, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x90, 0x07, 0xff, 0x0e, 0x98, 0x19, 0xf2, 0x88, 0xcd, 0x8c, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xe0, 0x21, 0x47, 0xb1, 0x50, 0xba, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x47, 0xb1, 0x50, 0xba, 0xe0, 0xf0, 0xe0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xe6, 0xc8, 0x3c, 0x22, 0xa1, 0x2c, 0xde, 0x00, 0x90, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x22, 0xa1, 0x2c, 0xde, 0xc4, 0xe6, 0xc8, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xe1, 0xb9, 0x4c, 0x11, 0x99, 0x1b, 0xef, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x11, 0x99, 0x1b, 0xef, 0xb5, 0xe1, 0xb9, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xe0, 0xbb, 0x4b, 0x0b, 0x96, 0x16, 0xf4, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x90, 0x08, 0xff, 0x00, 0x90, 0x07, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x0b, 0x96, 0x16, 0xf4, 0xb8, 0xe0, 0xbb, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0xca, 0x3a, 0x11, 0x99, 0x1b, 0xef, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x91, 0x09, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x93, 0x0f, 0xff, 0x23, 0xa1, 0x2e, 0xff, 0x5b, 0xb9, 0x63, 0xff, 0x9a, 0xd4, 0x9f, 0xff, 0xa6, 0xd9, 0xab, 0xff, 0x5f, 0xbb, 0x68, 0xff, 0x04, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x11, 0x99, 0x1b, 0xef, 0xc6, 0xe9, 0xca, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xf7, 0xe6, 0x1f, 0x21, 0xa1, 0x2c, 0xe0, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x15, 0x9b, 0x21, 0xff, 0x46, 0xb0, 0x4f, 0xff, 0x87, 0xcb, 0x8c, 0xff, 0xc6, 0xe6, 0xc8, 0xff, 0xf2, 0xfa, 0xf3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8c, 0xce, 0x92, 0xff, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x21, 0xa1, 0x2c, 0xe0, 0xde, 0xf7, 0xe6, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x47, 0xb0, 0x50, 0xbc, 0x00, 0x90, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x3a, 0xab, 0x43, 0xff, 0xae, 0xdc, 0xb2, 0xff, 0xe6, 0xf4, 0xe7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xfc, 0xf9, 0xff, 0x2b, 0xa5, 0x37, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x47, 0xb0, 0x50, 0xbc, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xcf, 0x8e, 0x7a, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x31, 0xa7, 0x3b, 0xff, 0xf0, 0xf8, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8a, 0xcd, 0x91, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x88, 0xcf, 0x8e, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xee, 0xd7, 0x2d, 0x0d, 0x98, 0x18, 0xf3, 0x01, 0x93, 0x0d, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x96, 0xd2, 0x9c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xf3, 0xe5, 0xff, 0x12, 0x9a, 0x1e, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0d, 0xff, 0x0d, 0x98, 0x18, 0xf3, 0xd2, 0xee, 0xd7, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x4e, 0xb5, 0x58, 0xb3, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x08, 0xff, 0xaf, 0xdd, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x61, 0xbc, 0x6a, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x07, 0xff, 0x4e, 0xb5, 0x58, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xe2, 0xbd, 0x46, 0x02, 0x93, 0x0c, 0xfe, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x08, 0xff, 0xa9, 0xda, 0xae, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xe6, 0xc8, 0xff, 0x04, 0x93, 0x0f, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x93, 0x0c, 0xfe, 0xba, 0xe2, 0xbd, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x47, 0xb3, 0x50, 0xbb, 0x00, 0x90, 0x08, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x9c, 0xd5, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfe, 0xfc, 0xff, 0x3b, 0xac, 0x47, 0xff, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x08, 0xff, 0x47, 0xb3, 0x50, 0xbb, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0xcd, 0x38, 0x05, 0x94, 0x10, 0xfc, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x05, 0xff, 0x89, 0xcd, 0x8f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9f, 0xd6, 0xa4, 0xff, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x05, 0x94, 0x10, 0xfc, 0xc8, 0xe8, 0xcd, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xc1, 0x74, 0x98, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x6e, 0xc1, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf8, 0xef, 0xff, 0x1e, 0xa0, 0x2b, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x6a, 0xc1, 0x74, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xef, 0x10, 0x1e, 0xa0, 0x2a, 0xe4, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x08, 0xff, 0x4d, 0xb3, 0x56, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4e, 0xb4, 0x58, 0xff, 0x00, 0x90, 0x08, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x1e, 0xa0, 0x2a, 0xe4, 0xef, 0xff, 0xef, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb9, 0xe0, 0xbd, 0x49, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x2a, 0xa5, 0x35, 0xff, 0xf9, 0xfc, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xad, 0x48, 0xff, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0xb9, 0xe0, 0xbd, 0x49, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x73, 0xc6, 0x7a, 0x8e, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x0c, 0x98, 0x1a, 0xff, 0xde, 0xf1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb8, 0xe1, 0xbd, 0xff, 0x07, 0x95, 0x12, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x73, 0xc6, 0x7a, 0x8e, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0xff, 0x02, 0x3a, 0xac, 0x45, 0xc7, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0xae, 0xdd, 0xb3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xae, 0xdc, 0xb2, 0xff, 0x14, 0x9a, 0x1e, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x3a, 0xac, 0x45, 0xc7, 0xff, 0xff, 0xff, 0x02, 
-  0xe8, 0xf3, 0xe8, 0x16, 0x16, 0x9d, 0x23, 0xec, 0x00, 0x93, 0x0d, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x6e, 0xc1, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0xcc, 0x8e, 0xff, 0x05, 0x93, 0x0f, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x16, 0x9d, 0x23, 0xec, 0xe8, 0xf3, 0xe8, 0x16, 
-  0xce, 0xeb, 0xce, 0x34, 0x03, 0x95, 0x11, 0xfe, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x2c, 0xa6, 0x38, 0xff, 0xf9, 0xfc, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xeb, 0xf7, 0xec, 0xff, 0x61, 0xbb, 0x69, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x03, 0x95, 0x11, 0xfe, 0xce, 0xeb, 0xce, 0x34, 
-  0xae, 0xdd, 0xb4, 0x52, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x04, 0x94, 0x10, 0xff, 0xc8, 0xe7, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x97, 0xd3, 0x9d, 0xff, 0x00, 0x8c, 0x00, 0xff, 0x01, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0xae, 0xdd, 0xb4, 0x52, 
-  0x98, 0xd3, 0x9d, 0x68, 0x00, 0x90, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x71, 0xc3, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe8, 0xf5, 0xea, 0xff, 0x1d, 0x9f, 0x29, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x98, 0xd3, 0x9d, 0x68, 
-  0x80, 0xcf, 0x87, 0x90, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x1d, 0x9f, 0x2a, 0xff, 0xee, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0xd4, 0x9f, 0xff, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x80, 0xcf, 0x87, 0x90, 
-  0x16, 0xa3, 0x22, 0xf4, 0x01, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x07, 0xff, 0x99, 0xd4, 0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfd, 0xfa, 0xff, 0x44, 0xb0, 0x4f, 0xff, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x16, 0xa3, 0x22, 0xf4, 
-  0x16, 0xa3, 0x22, 0xf4, 0x01, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x2c, 0xa6, 0x38, 0xff, 0xf6, 0xfb, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd9, 0xee, 0xdb, 0xff, 0x15, 0x9b, 0x20, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x16, 0xa3, 0x22, 0xf4, 
-  0x80, 0xcf, 0x87, 0x90, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x07, 0xff, 0x9b, 0xd5, 0xa1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xad, 0xdc, 0xb2, 0xff, 0x04, 0x93, 0x0e, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x80, 0xcf, 0x87, 0x90, 
-  0x98, 0xd3, 0x9d, 0x68, 0x00, 0x90, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x22, 0xa1, 0x2d, 0xff, 0xed, 0xf7, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xcf, 0x94, 0xff, 0x00, 0x91, 0x09, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x91, 0x09, 0xff, 0x00, 0x90, 0x08, 0xff, 0x00, 0x92, 0x0d, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x98, 0xd3, 0x9d, 0x68, 
-  0xae, 0xdd, 0xb4, 0x52, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x74, 0xc4, 0x7c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x83, 0xca, 0x8a, 0xff, 0x00, 0x91, 0x09, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x05, 0x95, 0x12, 0xff, 0x3d, 0xad, 0x48, 0xff, 0x4c, 0xb3, 0x56, 0xff, 0x1e, 0x9f, 0x2a, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x91, 0x09, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0xae, 0xdd, 0xb4, 0x52, 
-  0xce, 0xeb, 0xce, 0x34, 0x03, 0x95, 0x11, 0xfe, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x08, 0x95, 0x12, 0xff, 0xc3, 0xe5, 0xc6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x8d, 0xce, 0x93, 0xff, 0x04, 0x93, 0x0e, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x14, 0x9a, 0x1f, 0xff, 0xb8, 0xe1, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xec, 0xf7, 0xed, 0xff, 0x9d, 0xd5, 0xa1, 0xff, 0x3c, 0xac, 0x45, 0xff, 0x02, 0x93, 0x0f, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x03, 0x95, 0x11, 0xfe, 0xce, 0xeb, 0xce, 0x34, 
-  0xe8, 0xf3, 0xe8, 0x16, 0x16, 0x9d, 0x23, 0xec, 0x00, 0x93, 0x0d, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x2c, 0xa5, 0x37, 0xff, 0xee, 0xf8, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xab, 0xdc, 0xb0, 0xff, 0x17, 0x9b, 0x20, 0xff, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x05, 0x93, 0x0f, 0xff, 0xb0, 0xdd, 0xb4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xfe, 0xfe, 0xff, 0xc2, 0xe5, 0xc5, 0xff, 0x61, 0xbb, 0x68, 0xff, 0x13, 0x9a, 0x1e, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x16, 0x9d, 0x23, 0xec, 0xe8, 0xf3, 0xe8, 0x16, 
-  0xff, 0xff, 0xff, 0x02, 0x3b, 0xad, 0x46, 0xc7, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x5c, 0xba, 0x65, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd7, 0xee, 0xd9, 0xff, 0x46, 0xb0, 0x4e, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x01, 0x94, 0x10, 0xff, 0x00, 0x90, 0x07, 0xff, 0x89, 0xcd, 0x90, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xf2, 0xe2, 0xff, 0x89, 0xcc, 0x8e, 0xff, 0x2c, 0xa5, 0x36, 0xff, 0x00, 0x91, 0x09, 0xff, 0x01, 0x93, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x3b, 0xad, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x02, 
-  0x00, 0x00, 0x00, 0x00, 0x73, 0xc6, 0x7a, 0x8e, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x07, 0xff, 0x85, 0xcb, 0x8c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfd, 0xfc, 0xff, 0x97, 0xd3, 0x9c, 0xff, 0x1f, 0x9f, 0x29, 0xff, 0x00, 0x8d, 0x00, 0xff, 0x60, 0xbc, 0x69, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfb, 0xf6, 0xff, 0x8b, 0xcd, 0x91, 0xff, 0x04, 0x94, 0x0f, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x73, 0xc6, 0x7a, 0x8e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb9, 0xe0, 0xbd, 0x49, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x03, 0x92, 0x0d, 0xff, 0x9e, 0xd6, 0xa3, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xf5, 0xea, 0xff, 0x99, 0xd2, 0x9c, 0xff, 0xf0, 0xf9, 0xf1, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xba, 0x66, 0xff, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0xb9, 0xe0, 0xbd, 0x49, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xef, 0xff, 0xef, 0x10, 0x1e, 0xa0, 0x2a, 0xe4, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x07, 0x94, 0x11, 0xff, 0xa5, 0xd9, 0xab, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa8, 0xda, 0xad, 0xff, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x1e, 0xa0, 0x2a, 0xe4, 0xef, 0xff, 0xef, 0x10, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xc1, 0x74, 0x98, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x07, 0x94, 0x11, 0xff, 0x9d, 0xd5, 0xa2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9a, 0xd4, 0x9f, 0xff, 0x00, 0x90, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x6a, 0xc1, 0x74, 0x98, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc8, 0xe8, 0xcd, 0x38, 0x05, 0x94, 0x10, 0xfc, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x02, 0x93, 0x0d, 0xff, 0x85, 0xcb, 0x8b, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xb9, 0x62, 0xff, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x05, 0x94, 0x10, 0xfc, 0xc8, 0xe8, 0xcd, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x47, 0xb3, 0x50, 0xbb, 0x00, 0x90, 0x08, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x00, 0x90, 0x08, 0xff, 0x5d, 0xba, 0x65, 0xff, 0xed, 0xf7, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3, 0xfa, 0xf4, 0xff, 0x20, 0xa1, 0x2d, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x08, 0xff, 0x47, 0xb3, 0x50, 0xbb, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xe2, 0xbd, 0x46, 0x02, 0x93, 0x0c, 0xfe, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x2e, 0xa5, 0x37, 0xff, 0xc0, 0xe4, 0xc4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc5, 0xe6, 0xc9, 0xff, 0x02, 0x93, 0x0f, 0xff, 0x01, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x93, 0x0c, 0xfe, 0xba, 0xe2, 0xbd, 0x46, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0x4e, 0xb5, 0x58, 0xb3, 0x00, 0x90, 0x07, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x08, 0x95, 0x13, 0xff, 0x74, 0xc3, 0x7b, 0xff, 0xeb, 0xf6, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x85, 0xcb, 0x8c, 0xff, 0x00, 0x8f, 0x05, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x07, 0xff, 0x4e, 0xb5, 0x58, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd2, 0xee, 0xd7, 0x2d, 0x0d, 0x98, 0x18, 0xf3, 0x01, 0x93, 0x0d, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x24, 0xa1, 0x2e, 0xff, 0x9a, 0xd4, 0x9e, 0xff, 0xf5, 0xfb, 0xf5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0xb0, 0x4e, 0xff, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0d, 0xff, 0x0d, 0x98, 0x18, 0xf3, 0xd2, 0xee, 0xd7, 0x2d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0xcf, 0x8e, 0x7a, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x90, 0x08, 0xff, 0x2e, 0xa6, 0x38, 0xff, 0x98, 0xd3, 0x9d, 0xff, 0xec, 0xf7, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe7, 0xf5, 0xe9, 0xff, 0x13, 0x9b, 0x20, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x88, 0xcf, 0x8e, 0x7a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x47, 0xb0, 0x50, 0xbc, 0x00, 0x90, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x90, 0x07, 0xff, 0x1f, 0x9f, 0x29, 0xff, 0x71, 0xc2, 0x77, 0xff, 0xc5, 0xe6, 0xc8, 0xff, 0xf8, 0xfc, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaf, 0xdd, 0xb3, 0xff, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x47, 0xb0, 0x50, 0xbc, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xde, 0xf7, 0xe6, 0x1f, 0x21, 0xa1, 0x2c, 0xe0, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x03, 0x94, 0x10, 0xff, 0x2d, 0xa6, 0x38, 0xff, 0x6e, 0xc1, 0x75, 0xff, 0xad, 0xdc, 0xb1, 0xff, 0xdc, 0xf0, 0xde, 0xff, 0xf8, 0xfc, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xf8, 0xef, 0xff, 0x38, 0xaa, 0x42, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x21, 0xa1, 0x2c, 0xe0, 0xde, 0xf7, 0xe6, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0xca, 0x3a, 0x11, 0x99, 0x1b, 0xef, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x91, 0x09, 0xff, 0x0c, 0x98, 0x19, 0xff, 0x2a, 0xa4, 0x35, 0xff, 0x4c, 0xb3, 0x55, 0xff, 0x6d, 0xc1, 0x75, 0xff, 0x88, 0xcc, 0x8f, 0xff, 0x9c, 0xd5, 0xa1, 0xff, 0xa8, 0xda, 0xad, 0xff, 0xad, 0xdc, 0xb1, 0xff, 0x93, 0xd1, 0x99, 0xff, 0x31, 0xa7, 0x3b, 0xff, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x11, 0x99, 0x1b, 0xef, 0xc6, 0xe9, 0xca, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xe0, 0xbb, 0x4b, 0x0b, 0x96, 0x16, 0xf4, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x90, 0x08, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x8f, 0x05, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x90, 0x08, 0xff, 0x00, 0x91, 0x08, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x0b, 0x96, 0x16, 0xf4, 0xb8, 0xe0, 0xbb, 0x4b, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb5, 0xe1, 0xb9, 0x4c, 0x11, 0x99, 0x1b, 0xef, 0x00, 0x91, 0x09, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x91, 0x09, 0xff, 0x11, 0x99, 0x1b, 0xef, 0xb5, 0xe1, 0xb9, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xe6, 0xc8, 0x3c, 0x22, 0xa1, 0x2c, 0xde, 0x00, 0x90, 0x06, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x90, 0x06, 0xff, 0x22, 0xa1, 0x2c, 0xde, 0xc4, 0xe6, 0xc8, 0x3c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe0, 0xf0, 0xe0, 0x21, 0x47, 0xb1, 0x50, 0xba, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x47, 0xb1, 0x50, 0xba, 0xe0, 0xf0, 0xe0, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x06, 0x88, 0xcd, 0x8c, 0x7a, 0x0e, 0x98, 0x19, 0xf2, 0x00, 0x90, 0x07, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x90, 0x07, 0xff, 0x0e, 0x98, 0x19, 0xf2, 0x88, 0xcd, 0x8c, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xea, 0xd5, 0x30, 0x51, 0xb6, 0x58, 0xb1, 0x01, 0x93, 0x0d, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x93, 0x0d, 0xff, 0x51, 0xb6, 0x58, 0xb1, 0xcf, 0xea, 0xd5, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb8, 0xe3, 0xbc, 0x48, 0x48, 0xb0, 0x51, 0xb9, 0x04, 0x94, 0x10, 0xfc, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x04, 0x94, 0x10, 0xfc, 0x48, 0xb0, 0x51, 0xb9, 0xb8, 0xe3, 0xbc, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xe9, 0xca, 0x3a, 0x6a, 0xc1, 0x71, 0x97, 0x20, 0xa0, 0x2a, 0xe1, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x02, 0x94, 0x10, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x20, 0xa0, 0x2a, 0xe1, 0x6a, 0xc1, 0x71, 0x97, 0xc6, 0xe9, 0xca, 0x3a, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xe0, 0xba, 0x4a, 0x73, 0xc4, 0x7a, 0x8e, 0x3b, 0xad, 0x46, 0xc6, 0x17, 0x9d, 0x23, 0xeb, 0x03, 0x95, 0x11, 0xfe, 0x00, 0x91, 0x09, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x91, 0x09, 0xff, 0x03, 0x95, 0x11, 0xfe, 0x17, 0x9d, 0x23, 0xeb, 0x3b, 0xad, 0x46, 0xc6, 0x73, 0xc4, 0x7a, 0x8e, 0xb7, 0xe0, 0xba, 0x4a, 0xf0, 0xff, 0xf0, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe8, 0xf3, 0xe8, 0x16, 0xce, 0xeb, 0xce, 0x34, 0xae, 0xdd, 0xb4, 0x52, 0x98, 0xd4, 0x9c, 0x6a, 0x7f, 0xcd, 0x88, 0x8f, 0x16, 0xa2, 0x22, 0xf4, 0x16, 0xa2, 0x22, 0xf4, 0x7f, 0xcd, 0x88, 0x8f, 0x98, 0xd4, 0x9c, 0x6a, 0xae, 0xdd, 0xb4, 0x52, 0xce, 0xeb, 0xce, 0x34, 0xe8, 0xf3, 0xe8, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x97, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe8, 0xf3, 0xe8, 0x16, 0xce, 0xeb, 0xce, 0x34, 0xae, 0xdd, 0xb4, 0x52, 0x98, 0xd4, 0x9c, 0x6a, 0x7f, 0xcd, 0x88, 0x8f, 0x81, 0x16, 0xa2, 0x22, 0xf4, 0x04, 
+  0x7f, 0xcd, 0x88, 0x8f, 0x98, 0xd4, 0x9c, 0x6a, 0xae, 0xdd, 0xb4, 0x52, 0xce, 0xeb, 0xce, 0x34, 0xe8, 0xf3, 0xe8, 0x16, 0xab, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xe0, 
+  0xba, 0x4a, 0x73, 0xc4, 0x7a, 0x8e, 0x3b, 0xad, 0x46, 0xc6, 0x17, 0x9d, 0x23, 0xeb, 0x03, 0x95, 0x11, 0xfe, 0x00, 0x91, 0x09, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x81, 0x00, 
+  0x93, 0x0e, 0xff, 0x08, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x91, 0x09, 0xff, 0x03, 0x95, 0x11, 0xfe, 0x17, 0x9d, 0x23, 0xeb, 0x3b, 0xad, 0x46, 0xc6, 0x73, 0xc4, 0x7a, 0x8e, 
+  0xb7, 0xe0, 0xba, 0x4a, 0xf0, 0xff, 0xf0, 0x11, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc6, 0xe9, 0xca, 0x3a, 0x6a, 0xc1, 0x71, 0x97, 0x20, 0xa0, 0x2a, 0xe1, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x8f, 
+  0x06, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x87, 0x02, 0x94, 0x10, 0xff, 0x07, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x91, 0x0a, 0xff, 
+  0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x20, 0xa0, 0x2a, 0xe1, 0x6a, 0xc1, 0x71, 0x97, 0xc6, 0xe9, 0xca, 0x3a, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb8, 0xe3, 0xbc, 0x48, 0x48, 0xb0, 
+  0x51, 0xb9, 0x04, 0x94, 0x10, 0xfc, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x91, 0x02, 0x94, 0x10, 0xff, 0x04, 0x00, 0x92, 0x0c, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x04, 0x94, 0x10, 0xfc, 
+  0x48, 0xb0, 0x51, 0xb9, 0xb8, 0xe3, 0xbc, 0x48, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xea, 0xd5, 0x30, 0x51, 0xb6, 0x58, 0xb1, 0x01, 0x93, 0x0d, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x94, 
+  0x0f, 0xff, 0x95, 0x02, 0x94, 0x10, 0xff, 0x04, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x93, 0x0d, 0xff, 0x51, 0xb6, 0x58, 0xb1, 0xcf, 0xea, 0xd5, 0x30, 0x99, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xff, 0xff, 0xff, 0x06, 0x88, 0xcd, 0x8c, 0x7a, 0x0e, 0x98, 0x19, 0xf2, 0x00, 0x90, 0x07, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x99, 0x02, 0x94, 0x10, 0xff, 0x04, 0x01, 0x94, 0x0f, 0xff, 
+  0x00, 0x90, 0x07, 0xff, 0x0e, 0x98, 0x19, 0xf2, 0x88, 0xcd, 0x8c, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xf0, 0xe0, 0x21, 0x47, 0xb1, 0x50, 0xba, 0x00, 0x8f, 
+  0x06, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x9d, 0x02, 0x94, 0x10, 0xff, 0x03, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x47, 0xb1, 0x50, 0xba, 0xe0, 0xf0, 0xe0, 0x21, 0x94, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xc4, 0xe6, 0xc8, 0x3c, 0x22, 0xa1, 0x2c, 0xde, 0x00, 0x90, 0x06, 0xff, 0xa1, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x06, 0xff, 0x22, 0xa1, 0x2c, 0xde, 0xc4, 0xe6, 0xc8, 0x3c, 
+  0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb5, 0xe1, 0xb9, 0x4c, 0x11, 0x99, 0x1b, 0xef, 0x00, 0x91, 0x09, 0xff, 0xa3, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x91, 0x09, 0xff, 0x11, 0x99, 0x1b, 0xef, 
+  0xb5, 0xe1, 0xb9, 0x4c, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb8, 0xe0, 0xbb, 0x4b, 0x0b, 0x96, 0x16, 0xf4, 0x00, 0x92, 0x0b, 0xff, 0x84, 0x02, 0x94, 0x10, 0xff, 0x01, 0x01, 0x94, 0x0f, 0xff, 
+  0x00, 0x92, 0x0c, 0xff, 0x81, 0x00, 0x90, 0x07, 0xff, 0x02, 0x00, 0x90, 0x08, 0xff, 0x00, 0x90, 0x07, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x99, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 
+  0x0b, 0x96, 0x16, 0xf4, 0xb8, 0xe0, 0xbb, 0x4b, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0xe9, 0xca, 0x3a, 0x11, 0x99, 0x1b, 0xef, 0x00, 0x92, 0x0b, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x0a, 
+  0x00, 0x93, 0x0e, 0xff, 0x00, 0x91, 0x09, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x02, 0x93, 0x0f, 0xff, 0x23, 0xa1, 0x2e, 0xff, 0x5b, 0xb9, 0x63, 0xff, 0x9a, 0xd4, 0x9f, 0xff, 0xa6, 0xd9, 0xab, 0xff, 
+  0x5f, 0xbb, 0x68, 0xff, 0x04, 0x94, 0x10, 0xff, 0x01, 0x93, 0x0f, 0xff, 0x99, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 0x11, 0x99, 0x1b, 0xef, 0xc6, 0xe9, 0xca, 0x3a, 0x8c, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0xde, 0xf7, 0xe6, 0x1f, 0x21, 0xa1, 0x2c, 0xe0, 0x00, 0x91, 0x09, 0xff, 0x81, 0x02, 0x94, 0x10, 0xff, 0x81, 0x00, 0x91, 0x0a, 0xff, 0x04, 0x15, 0x9b, 0x21, 0xff, 0x46, 
+  0xb0, 0x4f, 0xff, 0x87, 0xcb, 0x8c, 0xff, 0xc6, 0xe6, 0xc8, 0xff, 0xf2, 0xfa, 0xf3, 0xff, 0x83, 0xff, 0xff, 0xff, 0xff, 0x01, 0x8c, 0xce, 0x92, 0xff, 0x00, 0x91, 0x09, 0xff, 0x9a, 0x02, 0x94, 
+  0x10, 0xff, 0x02, 0x00, 0x91, 0x09, 0xff, 0x21, 0xa1, 0x2c, 0xe0, 0xde, 0xf7, 0xe6, 0x1f, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x06, 0x47, 0xb0, 0x50, 0xbc, 0x00, 0x90, 0x06, 
+  0xff, 0x81, 0x02, 0x94, 0x10, 0xff, 0x03, 0x00, 0x91, 0x09, 0xff, 0x3a, 0xab, 0x43, 0xff, 0xae, 0xdc, 0xb2, 0xff, 0xe6, 0xf4, 0xe7, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf9, 0xfc, 0xf9, 
+  0xff, 0x2b, 0xa5, 0x37, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x9a, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x06, 0xff, 0x47, 0xb0, 0x50, 0xbc, 0xff, 0xff, 0xff, 0x06, 0x89, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x88, 0xcf, 0x8e, 0x7a, 0x00, 0x8f, 0x06, 0xff, 0x81, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 0x31, 0xa7, 0x3b, 0xff, 0xf0, 0xf8, 0xf0, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x8a, 0xcd, 0x91, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x9b, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x88, 0xcf, 0x8e, 0x7a, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0xee, 0xd7, 
+  0x2d, 0x0d, 0x98, 0x18, 0xf3, 0x01, 0x93, 0x0d, 0xff, 0x81, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x90, 0x06, 0xff, 0x96, 0xd2, 0x9c, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe3, 0xf3, 0xe5, 
+  0xff, 0x12, 0x9a, 0x1e, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x9a, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x93, 0x0d, 0xff, 0x0d, 0x98, 0x18, 0xf3, 0xd2, 0xee, 0xd7, 0x2d, 0x86, 0x00, 0x00, 0x00, 0x00, 
+  0x02, 0xff, 0xff, 0xff, 0x01, 0x4e, 0xb5, 0x58, 0xb3, 0x00, 0x90, 0x07, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x91, 0x08, 0xff, 0xaf, 0xdd, 0xb3, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 
+  0x01, 0x61, 0xbc, 0x6a, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x9b, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x07, 0xff, 0x4e, 0xb5, 0x58, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x85, 0x00, 0x00, 0x00, 0x00, 
+  0x02, 0xba, 0xe2, 0xbd, 0x46, 0x02, 0x93, 0x0c, 0xfe, 0x01, 0x94, 0x0f, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x90, 0x08, 0xff, 0xa9, 0xda, 0xae, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 
+  0x02, 0xc5, 0xe6, 0xc8, 0xff, 0x04, 0x93, 0x0f, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x9a, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x94, 0x0f, 0xff, 0x02, 0x93, 0x0c, 0xfe, 0xba, 0xe2, 0xbd, 0x46, 0x84, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x02, 0x47, 0xb3, 0x50, 0xbb, 0x00, 0x90, 0x08, 0xff, 0x83, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x90, 0x06, 0xff, 0x9c, 0xd5, 0xa2, 0xff, 0x8c, 
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xfe, 0xfc, 0xff, 0x3b, 0xac, 0x47, 0xff, 0x00, 0x91, 0x09, 0xff, 0x9b, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x08, 0xff, 0x47, 0xb3, 0x50, 0xbb, 0xff, 
+  0xff, 0xff, 0x02, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0xe8, 0xcd, 0x38, 0x05, 0x94, 0x10, 0xfc, 0x01, 0x94, 0x0f, 0xff, 0x83, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x05, 0xff, 0x89, 
+  0xcd, 0x8f, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0x9f, 0xd6, 0xa4, 0xff, 0x00, 0x90, 0x07, 0xff, 0x9b, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x94, 0x0f, 0xff, 0x05, 0x94, 0x10, 0xfc, 0xc8, 
+  0xe8, 0xcd, 0x38, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0xc1, 0x74, 0x98, 0x00, 0x8f, 0x06, 0xff, 0x84, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x6e, 0xc1, 0x76, 0xff, 0x8d, 
+  0xff, 0xff, 0xff, 0xff, 0x02, 0xee, 0xf8, 0xef, 0xff, 0x1e, 0xa0, 0x2b, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x9b, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x6a, 0xc1, 0x74, 0x98, 0x82, 
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xef, 0xff, 0xef, 0x10, 0x1e, 0xa0, 0x2a, 0xe4, 0x00, 0x92, 0x0c, 0xff, 0x84, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x90, 0x08, 0xff, 0x4d, 0xb3, 0x56, 0xff, 0x8e, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x4e, 0xb4, 0x58, 0xff, 0x00, 0x90, 0x08, 0xff, 0x9b, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0c, 0xff, 0x1e, 0xa0, 0x2a, 0xe4, 0xef, 0xff, 0xef, 0x10, 0x81, 
+  0x00, 0x00, 0x00, 0x00, 0x01, 0xb9, 0xe0, 0xbd, 0x49, 0x00, 0x92, 0x0b, 0xff, 0x85, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 0x2a, 0xa5, 0x35, 0xff, 0xf9, 0xfc, 0xf9, 0xff, 0x8d, 
+  0xff, 0xff, 0xff, 0xff, 0x01, 0x3d, 0xad, 0x48, 0xff, 0x00, 0x91, 0x09, 0xff, 0x9c, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x92, 0x0b, 0xff, 0xb9, 0xe0, 0xbd, 0x49, 0x81, 0x00, 0x00, 0x00, 0x00, 
+  0x01, 0x73, 0xc6, 0x7a, 0x8e, 0x00, 0x8f, 0x06, 0xff, 0x85, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x93, 0x0e, 0xff, 0x0c, 0x98, 0x1a, 0xff, 0xde, 0xf1, 0xdf, 0xff, 0x8c, 0xff, 0xff, 0xff, 0xff, 
+  0x02, 0xb8, 0xe1, 0xbd, 0xff, 0x07, 0x95, 0x12, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x9c, 0x02, 0x94, 0x10, 0xff, 0x05, 0x00, 0x8f, 0x06, 0xff, 0x73, 0xc6, 0x7a, 0x8e, 0x00, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0xff, 0x02, 0x3a, 0xac, 0x45, 0xc7, 0x00, 0x91, 0x09, 0xff, 0x86, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x91, 0x09, 0xff, 0xae, 0xdd, 0xb3, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x02, 0xae, 
+  0xdc, 0xb2, 0xff, 0x14, 0x9a, 0x1e, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x9d, 0x02, 0x94, 0x10, 0xff, 0x05, 0x00, 0x91, 0x09, 0xff, 0x3a, 0xac, 0x45, 0xc7, 0xff, 0xff, 0xff, 0x02, 0xe8, 0xf3, 0xe8, 
+  0x16, 0x16, 0x9d, 0x23, 0xec, 0x00, 0x93, 0x0d, 0xff, 0x86, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x6e, 0xc1, 0x76, 0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x02, 0x88, 0xcc, 0x8e, 
+  0xff, 0x05, 0x93, 0x0f, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x9e, 0x02, 0x94, 0x10, 0xff, 0x05, 0x00, 0x93, 0x0d, 0xff, 0x16, 0x9d, 0x23, 0xec, 0xe8, 0xf3, 0xe8, 0x16, 0xce, 0xeb, 0xce, 0x34, 0x03, 
+  0x95, 0x11, 0xfe, 0x01, 0x94, 0x0f, 0xff, 0x86, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 0x2c, 0xa6, 0x38, 0xff, 0xf9, 0xfc, 0xf9, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x03, 0xeb, 
+  0xf7, 0xec, 0xff, 0x61, 0xbb, 0x69, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x9f, 0x02, 0x94, 0x10, 0xff, 0x04, 0x01, 0x94, 0x0f, 0xff, 0x03, 0x95, 0x11, 0xfe, 0xce, 0xeb, 0xce, 
+  0x34, 0xae, 0xdd, 0xb4, 0x52, 0x00, 0x91, 0x09, 0xff, 0x87, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x94, 0x0f, 0xff, 0x04, 0x94, 0x10, 0xff, 0xc8, 0xe7, 0xcb, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 
+  0x02, 0x97, 0xd3, 0x9d, 0xff, 0x00, 0x8c, 0x00, 0xff, 0x01, 0x94, 0x10, 0xff, 0xa1, 0x02, 0x94, 0x10, 0xff, 0x03, 0x00, 0x91, 0x09, 0xff, 0xae, 0xdd, 0xb4, 0x52, 0x98, 0xd3, 0x9d, 0x68, 0x00, 
+  0x90, 0x06, 0xff, 0x88, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x71, 0xc3, 0x79, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe8, 0xf5, 0xea, 0xff, 0x1d, 0x9f, 0x29, 0xff, 0x00, 
+  0x92, 0x0c, 0xff, 0xa1, 0x02, 0x94, 0x10, 0xff, 0x03, 0x00, 0x90, 0x06, 0xff, 0x98, 0xd3, 0x9d, 0x68, 0x80, 0xcf, 0x87, 0x90, 0x00, 0x8f, 0x06, 0xff, 0x88, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 
+  0x92, 0x0c, 0xff, 0x1d, 0x9f, 0x2a, 0xff, 0xee, 0xf8, 0xef, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x01, 0x99, 0xd4, 0x9f, 0xff, 0x00, 0x90, 0x07, 0xff, 0xa1, 0x02, 0x94, 0x10, 0xff, 0x03, 0x00, 
+  0x8f, 0x06, 0xff, 0x80, 0xcf, 0x87, 0x90, 0x16, 0xa3, 0x22, 0xf4, 0x01, 0x93, 0x0e, 0xff, 0x89, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x90, 0x07, 0xff, 0x99, 0xd4, 0x9f, 0xff, 0x87, 0xff, 0xff, 
+  0xff, 0xff, 0x02, 0xfa, 0xfd, 0xfa, 0xff, 0x44, 0xb0, 0x4f, 0xff, 0x00, 0x90, 0x07, 0xff, 0xa0, 0x02, 0x94, 0x10, 0xff, 0x00, 0x01, 0x93, 0x0e, 0xff, 0x81, 0x16, 0xa3, 0x22, 0xf4, 0x00, 0x01, 
+  0x93, 0x0e, 0xff, 0x89, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 0x2c, 0xa6, 0x38, 0xff, 0xf6, 0xfb, 0xf6, 0xff, 0x87, 0xff, 0xff, 0xff, 0xff, 0x02, 0xd9, 0xee, 0xdb, 0xff, 0x15, 
+  0x9b, 0x20, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x9f, 0x02, 0x94, 0x10, 0xff, 0x03, 0x01, 0x93, 0x0e, 0xff, 0x16, 0xa3, 0x22, 0xf4, 0x80, 0xcf, 0x87, 0x90, 0x00, 0x8f, 0x06, 0xff, 0x8a, 0x02, 0x94, 
+  0x10, 0xff, 0x01, 0x00, 0x90, 0x07, 0xff, 0x9b, 0xd5, 0xa1, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x02, 0xad, 0xdc, 0xb2, 0xff, 0x04, 0x93, 0x0e, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x9e, 0x02, 0x94, 
+  0x10, 0xff, 0x03, 0x00, 0x8f, 0x06, 0xff, 0x80, 0xcf, 0x87, 0x90, 0x98, 0xd3, 0x9d, 0x68, 0x00, 0x90, 0x06, 0xff, 0x8a, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 0x22, 0xa1, 0x2d, 
+  0xff, 0xed, 0xf7, 0xee, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 0x02, 0x8d, 0xcf, 0x94, 0xff, 0x00, 0x91, 0x09, 0xff, 0x01, 0x93, 0x0e, 0xff, 0x88, 0x02, 0x94, 0x10, 0xff, 0x03, 0x01, 0x94, 0x0f, 
+  0xff, 0x00, 0x91, 0x09, 0xff, 0x00, 0x90, 0x08, 0xff, 0x00, 0x92, 0x0d, 0xff, 0x90, 0x02, 0x94, 0x10, 0xff, 0x03, 0x00, 0x90, 0x06, 0xff, 0x98, 0xd3, 0x9d, 0x68, 0xae, 0xdd, 0xb4, 0x52, 0x00, 
+  0x91, 0x09, 0xff, 0x8b, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x74, 0xc4, 0x7c, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0x83, 0xca, 0x8a, 0xff, 0x00, 0x91, 0x09, 0xff, 0x00, 
+  0x93, 0x0e, 0xff, 0x86, 0x02, 0x94, 0x10, 0xff, 0x07, 0x00, 0x92, 0x0c, 0xff, 0x05, 0x95, 0x12, 0xff, 0x3d, 0xad, 0x48, 0xff, 0x4c, 0xb3, 0x56, 0xff, 0x1e, 0x9f, 0x2a, 0xff, 0x00, 0x90, 0x07, 
+  0xff, 0x00, 0x91, 0x09, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x8d, 0x02, 0x94, 0x10, 0xff, 0x04, 0x00, 0x91, 0x09, 0xff, 0xae, 0xdd, 0xb4, 0x52, 0xce, 0xeb, 0xce, 0x34, 0x03, 0x95, 0x11, 0xfe, 0x01, 
+  0x94, 0x0f, 0xff, 0x8a, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x93, 0x0e, 0xff, 0x08, 0x95, 0x12, 0xff, 0xc3, 0xe5, 0xc6, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0x8d, 0xce, 0x93, 0xff, 0x04, 
+  0x93, 0x0e, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x84, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0c, 0xff, 0x14, 0x9a, 0x1f, 0xff, 0xb8, 0xe1, 0xbc, 0xff, 0x81, 0xff, 0xff, 0xff, 0xff, 0x05, 0xec, 
+  0xf7, 0xed, 0xff, 0x9d, 0xd5, 0xa1, 0xff, 0x3c, 0xac, 0x45, 0xff, 0x02, 0x93, 0x0f, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x8a, 0x02, 0x94, 0x10, 0xff, 0x05, 0x01, 0x94, 0x0f, 
+  0xff, 0x03, 0x95, 0x11, 0xfe, 0xce, 0xeb, 0xce, 0x34, 0xe8, 0xf3, 0xe8, 0x16, 0x16, 0x9d, 0x23, 0xec, 0x00, 0x93, 0x0d, 0xff, 0x8b, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x91, 0x09, 0xff, 0x2c, 
+  0xa5, 0x37, 0xff, 0xee, 0xf8, 0xef, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x02, 0xab, 0xdc, 0xb0, 0xff, 0x17, 0x9b, 0x20, 0xff, 0x00, 0x90, 0x07, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 
+  0x93, 0x0e, 0xff, 0x05, 0x93, 0x0f, 0xff, 0xb0, 0xdd, 0xb4, 0xff, 0x84, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfd, 0xfe, 0xfe, 0xff, 0xc2, 0xe5, 0xc5, 0xff, 0x61, 0xbb, 0x68, 0xff, 0x13, 0x9a, 0x1e, 
+  0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x88, 0x02, 0x94, 0x10, 0xff, 0x05, 0x00, 0x93, 0x0d, 0xff, 0x16, 0x9d, 0x23, 0xec, 0xe8, 0xf3, 0xe8, 0x16, 0xff, 0xff, 0xff, 0x02, 0x3b, 
+  0xad, 0x46, 0xc7, 0x00, 0x91, 0x09, 0xff, 0x8c, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x8f, 0x06, 0xff, 0x5c, 0xba, 0x65, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x06, 0xd7, 
+  0xee, 0xd9, 0xff, 0x46, 0xb0, 0x4e, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x01, 0x94, 0x10, 0xff, 0x00, 0x90, 0x07, 0xff, 0x89, 0xcd, 0x90, 0xff, 0x88, 0xff, 0xff, 0xff, 0xff, 
+  0x04, 0xe0, 0xf2, 0xe2, 0xff, 0x89, 0xcc, 0x8e, 0xff, 0x2c, 0xa5, 0x36, 0xff, 0x00, 0x91, 0x09, 0xff, 0x01, 0x93, 0x0f, 0xff, 0x86, 0x02, 0x94, 0x10, 0xff, 0x05, 0x00, 0x91, 0x09, 0xff, 0x3b, 
+  0xad, 0x46, 0xc7, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x73, 0xc6, 0x7a, 0x8e, 0x00, 0x8f, 0x06, 0xff, 0x8d, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x90, 0x07, 0xff, 0x85, 0xcb, 0x8c, 
+  0xff, 0x8a, 0xff, 0xff, 0xff, 0xff, 0x05, 0xfb, 0xfd, 0xfc, 0xff, 0x97, 0xd3, 0x9c, 0xff, 0x1f, 0x9f, 0x29, 0xff, 0x00, 0x8d, 0x00, 0xff, 0x60, 0xbc, 0x69, 0xff, 0xfe, 0xff, 0xfe, 0xff, 0x8a, 
+  0xff, 0xff, 0xff, 0xff, 0x03, 0xf6, 0xfb, 0xf6, 0xff, 0x8b, 0xcd, 0x91, 0xff, 0x04, 0x94, 0x0f, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x85, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x73, 
+  0xc6, 0x7a, 0x8e, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb9, 0xe0, 0xbd, 0x49, 0x00, 0x92, 0x0b, 0xff, 0x8d, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x93, 0x0e, 0xff, 0x03, 0x92, 0x0d, 0xff, 0x9e, 
+  0xd6, 0xa3, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe9, 0xf5, 0xea, 0xff, 0x99, 0xd2, 0x9c, 0xff, 0xf0, 0xf9, 0xf1, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0x5d, 0xba, 0x66, 0xff, 0x00, 
+  0x90, 0x07, 0xff, 0x85, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x92, 0x0b, 0xff, 0xb9, 0xe0, 0xbd, 0x49, 0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0xef, 0xff, 0xef, 0x10, 0x1e, 0xa0, 0x2a, 0xe4, 0x00, 
+  0x92, 0x0c, 0xff, 0x8d, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x93, 0x0d, 0xff, 0x07, 0x94, 0x11, 0xff, 0xa5, 0xd9, 0xab, 0xff, 0x9b, 0xff, 0xff, 0xff, 0xff, 0x01, 0xa8, 0xda, 0xad, 0xff, 0x00, 
+  0x90, 0x07, 0xff, 0x84, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0c, 0xff, 0x1e, 0xa0, 0x2a, 0xe4, 0xef, 0xff, 0xef, 0x10, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0xc1, 0x74, 0x98, 0x00, 
+  0x8f, 0x06, 0xff, 0x8e, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x93, 0x0d, 0xff, 0x07, 0x94, 0x11, 0xff, 0x9d, 0xd5, 0xa2, 0xff, 0x9a, 0xff, 0xff, 0xff, 0xff, 0x01, 0x9a, 0xd4, 0x9f, 0xff, 0x00, 
+  0x90, 0x06, 0xff, 0x84, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 0xff, 0x6a, 0xc1, 0x74, 0x98, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc8, 0xe8, 0xcd, 0x38, 0x05, 0x94, 0x10, 0xfc, 0x01, 
+  0x94, 0x0f, 0xff, 0x8e, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x93, 0x0d, 0xff, 0x02, 0x93, 0x0d, 0xff, 0x85, 0xcb, 0x8b, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0x01, 0x59, 0xb9, 0x62, 0xff, 0x00, 
+  0x90, 0x07, 0xff, 0x83, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x94, 0x0f, 0xff, 0x05, 0x94, 0x10, 0xfc, 0xc8, 0xe8, 0xcd, 0x38, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x02, 0x47, 
+  0xb3, 0x50, 0xbb, 0x00, 0x90, 0x08, 0xff, 0x8f, 0x02, 0x94, 0x10, 0xff, 0x03, 0x01, 0x93, 0x0e, 0xff, 0x00, 0x90, 0x08, 0xff, 0x5d, 0xba, 0x65, 0xff, 0xed, 0xf7, 0xee, 0xff, 0x96, 0xff, 0xff, 
+  0xff, 0xff, 0x02, 0xf3, 0xfa, 0xf4, 0xff, 0x20, 0xa1, 0x2d, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x83, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x08, 0xff, 0x47, 0xb3, 0x50, 0xbb, 0xff, 0xff, 0xff, 
+  0x02, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xba, 0xe2, 0xbd, 0x46, 0x02, 0x93, 0x0c, 0xfe, 0x01, 0x94, 0x0f, 0xff, 0x90, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x06, 0xff, 0x2e, 0xa5, 0x37, 
+  0xff, 0xc0, 0xe4, 0xc4, 0xff, 0x95, 0xff, 0xff, 0xff, 0xff, 0x02, 0xc5, 0xe6, 0xc9, 0xff, 0x02, 0x93, 0x0f, 0xff, 0x01, 0x94, 0x10, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x94, 0x0f, 
+  0xff, 0x02, 0x93, 0x0c, 0xfe, 0xba, 0xe2, 0xbd, 0x46, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x01, 0x4e, 0xb5, 0x58, 0xb3, 0x00, 0x90, 0x07, 0xff, 0x91, 0x02, 0x94, 0x10, 0xff, 
+  0x03, 0x00, 0x91, 0x0a, 0xff, 0x08, 0x95, 0x13, 0xff, 0x74, 0xc3, 0x7b, 0xff, 0xeb, 0xf6, 0xec, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x01, 0x85, 0xcb, 0x8c, 0xff, 0x00, 0x8f, 0x05, 0xff, 0x83, 
+  0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x07, 0xff, 0x4e, 0xb5, 0x58, 0xb3, 0xff, 0xff, 0xff, 0x01, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd2, 0xee, 0xd7, 0x2d, 0x0d, 0x98, 0x18, 0xf3, 0x01, 
+  0x93, 0x0d, 0xff, 0x91, 0x02, 0x94, 0x10, 0xff, 0x04, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x24, 0xa1, 0x2e, 0xff, 0x9a, 0xd4, 0x9e, 0xff, 0xf5, 0xfb, 0xf5, 0xff, 0x91, 0xff, 0xff, 
+  0xff, 0xff, 0x01, 0x44, 0xb0, 0x4e, 0xff, 0x00, 0x91, 0x09, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x02, 0x01, 0x93, 0x0d, 0xff, 0x0d, 0x98, 0x18, 0xf3, 0xd2, 0xee, 0xd7, 0x2d, 0x88, 0x00, 0x00, 
+  0x00, 0x00, 0x01, 0x88, 0xcf, 0x8e, 0x7a, 0x00, 0x8f, 0x06, 0xff, 0x93, 0x02, 0x94, 0x10, 0xff, 0x04, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x90, 0x08, 0xff, 0x2e, 0xa6, 0x38, 0xff, 0x98, 0xd3, 0x9d, 
+  0xff, 0xec, 0xf7, 0xed, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe7, 0xf5, 0xe9, 0xff, 0x13, 0x9b, 0x20, 0xff, 0x00, 0x93, 0x0e, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x01, 0x00, 0x8f, 0x06, 
+  0xff, 0x88, 0xcf, 0x8e, 0x7a, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x06, 0x47, 0xb0, 0x50, 0xbc, 0x00, 0x90, 0x06, 0xff, 0x94, 0x02, 0x94, 0x10, 0xff, 0x05, 0x00, 0x92, 0x0b, 
+  0xff, 0x00, 0x90, 0x07, 0xff, 0x1f, 0x9f, 0x29, 0xff, 0x71, 0xc2, 0x77, 0xff, 0xc5, 0xe6, 0xc8, 0xff, 0xf8, 0xfc, 0xf9, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x01, 0xaf, 0xdd, 0xb3, 0xff, 0x00, 
+  0x91, 0x09, 0xff, 0x82, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x06, 0xff, 0x47, 0xb0, 0x50, 0xbc, 0xff, 0xff, 0xff, 0x06, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xde, 0xf7, 0xe6, 0x1f, 0x21, 
+  0xa1, 0x2c, 0xe0, 0x00, 0x91, 0x09, 0xff, 0x95, 0x02, 0x94, 0x10, 0xff, 0x07, 0x00, 0x92, 0x0c, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x03, 0x94, 0x10, 0xff, 0x2d, 0xa6, 0x38, 0xff, 0x6e, 0xc1, 0x75, 
+  0xff, 0xad, 0xdc, 0xb1, 0xff, 0xdc, 0xf0, 0xde, 0xff, 0xf8, 0xfc, 0xf8, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xee, 0xf8, 0xef, 0xff, 0x38, 0xaa, 0x42, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x81, 
+  0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x91, 0x09, 0xff, 0x21, 0xa1, 0x2c, 0xe0, 0xde, 0xf7, 0xe6, 0x1f, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc6, 0xe9, 0xca, 0x3a, 0x11, 0x99, 0x1b, 0xef, 0x00, 
+  0x92, 0x0b, 0xff, 0x96, 0x02, 0x94, 0x10, 0xff, 0x0e, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x91, 0x09, 0xff, 0x0c, 0x98, 0x19, 0xff, 0x2a, 0xa4, 0x35, 
+  0xff, 0x4c, 0xb3, 0x55, 0xff, 0x6d, 0xc1, 0x75, 0xff, 0x88, 0xcc, 0x8f, 0xff, 0x9c, 0xd5, 0xa1, 0xff, 0xa8, 0xda, 0xad, 0xff, 0xad, 0xdc, 0xb1, 0xff, 0x93, 0xd1, 0x99, 0xff, 0x31, 0xa7, 0x3b, 
+  0xff, 0x00, 0x91, 0x09, 0xff, 0x81, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 0xff, 0x11, 0x99, 0x1b, 0xef, 0xc6, 0xe9, 0xca, 0x3a, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb8, 0xe0, 0xbb, 
+  0x4b, 0x0b, 0x96, 0x16, 0xf4, 0x00, 0x92, 0x0b, 0xff, 0x99, 0x02, 0x94, 0x10, 0xff, 0x09, 0x00, 0x93, 0x0e, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x90, 0x08, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 
+  0x8f, 0x05, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x90, 0x08, 0xff, 0x00, 0x91, 0x08, 0xff, 0x00, 0x90, 0x07, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x81, 0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x92, 0x0b, 
+  0xff, 0x0b, 0x96, 0x16, 0xf4, 0xb8, 0xe0, 0xbb, 0x4b, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb5, 0xe1, 0xb9, 0x4c, 0x11, 0x99, 0x1b, 0xef, 0x00, 0x91, 0x09, 0xff, 0xa3, 0x02, 0x94, 0x10, 0xff, 
+  0x02, 0x00, 0x91, 0x09, 0xff, 0x11, 0x99, 0x1b, 0xef, 0xb5, 0xe1, 0xb9, 0x4c, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc4, 0xe6, 0xc8, 0x3c, 0x22, 0xa1, 0x2c, 0xde, 0x00, 0x90, 0x06, 0xff, 0xa1, 
+  0x02, 0x94, 0x10, 0xff, 0x02, 0x00, 0x90, 0x06, 0xff, 0x22, 0xa1, 0x2c, 0xde, 0xc4, 0xe6, 0xc8, 0x3c, 0x94, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe0, 0xf0, 0xe0, 0x21, 0x47, 0xb1, 0x50, 0xba, 0x00, 
+  0x8f, 0x06, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x9d, 0x02, 0x94, 0x10, 0xff, 0x03, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x47, 0xb1, 0x50, 0xba, 0xe0, 0xf0, 0xe0, 0x21, 0x96, 0x00, 0x00, 
+  0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x06, 0x88, 0xcd, 0x8c, 0x7a, 0x0e, 0x98, 0x19, 0xf2, 0x00, 0x90, 0x07, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x99, 0x02, 0x94, 0x10, 0xff, 0x04, 0x01, 0x94, 0x0f, 
+  0xff, 0x00, 0x90, 0x07, 0xff, 0x0e, 0x98, 0x19, 0xf2, 0x88, 0xcd, 0x8c, 0x7a, 0xff, 0xff, 0xff, 0x06, 0x99, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xea, 0xd5, 0x30, 0x51, 0xb6, 0x58, 0xb1, 0x01, 
+  0x93, 0x0d, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x95, 0x02, 0x94, 0x10, 0xff, 0x04, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x90, 0x08, 0xff, 0x01, 0x93, 0x0d, 0xff, 0x51, 0xb6, 0x58, 
+  0xb1, 0xcf, 0xea, 0xd5, 0x30, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xb8, 0xe3, 0xbc, 0x48, 0x48, 0xb0, 0x51, 0xb9, 0x04, 0x94, 0x10, 0xfc, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0c, 0xff, 0x91, 
+  0x02, 0x94, 0x10, 0xff, 0x04, 0x00, 0x92, 0x0c, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x04, 0x94, 0x10, 0xfc, 0x48, 0xb0, 0x51, 0xb9, 0xb8, 0xe3, 0xbc, 0x48, 0xa1, 0x00, 0x00, 0x00, 0x00, 0x07, 0xc6, 
+  0xe9, 0xca, 0x3a, 0x6a, 0xc1, 0x71, 0x97, 0x20, 0xa0, 0x2a, 0xe1, 0x00, 0x92, 0x0b, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x01, 0x94, 0x0f, 0xff, 0x87, 
+  0x02, 0x94, 0x10, 0xff, 0x07, 0x01, 0x94, 0x0f, 0xff, 0x00, 0x93, 0x0d, 0xff, 0x00, 0x91, 0x0a, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x92, 0x0b, 0xff, 0x20, 0xa0, 0x2a, 0xe1, 0x6a, 0xc1, 0x71, 
+  0x97, 0xc6, 0xe9, 0xca, 0x3a, 0xa5, 0x00, 0x00, 0x00, 0x00, 0x08, 0xf0, 0xff, 0xf0, 0x11, 0xb7, 0xe0, 0xba, 0x4a, 0x73, 0xc4, 0x7a, 0x8e, 0x3b, 0xad, 0x46, 0xc6, 0x17, 0x9d, 0x23, 0xeb, 0x03, 
+  0x95, 0x11, 0xfe, 0x00, 0x91, 0x09, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x8f, 0x06, 0xff, 0x81, 0x00, 0x93, 0x0e, 0xff, 0x08, 0x00, 0x8f, 0x06, 0xff, 0x00, 0x90, 0x06, 0xff, 0x00, 0x91, 0x09, 
+  0xff, 0x03, 0x95, 0x11, 0xfe, 0x17, 0x9d, 0x23, 0xeb, 0x3b, 0xad, 0x46, 0xc6, 0x73, 0xc4, 0x7a, 0x8e, 0xb7, 0xe0, 0xba, 0x4a, 0xf0, 0xff, 0xf0, 0x11, 0xab, 0x00, 0x00, 0x00, 0x00, 0x04, 0xe8, 
+  0xf3, 0xe8, 0x16, 0xce, 0xeb, 0xce, 0x34, 0xae, 0xdd, 0xb4, 0x52, 0x98, 0xd4, 0x9c, 0x6a, 0x7f, 0xcd, 0x88, 0x8f, 0x81, 0x16, 0xa2, 0x22, 0xf4, 0x04, 0x7f, 0xcd, 0x88, 0x8f, 0x98, 0xd4, 0x9c, 
+  0x6a, 0xae, 0xdd, 0xb4, 0x52, 0xce, 0xeb, 0xce, 0x34, 0xe8, 0xf3, 0xe8, 0x16, 0x97, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
 const lv_img_dsc_t phone_dial_60_60_pressed = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 60,
   .header.h = 60,
-  .data_size = 3600 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = sizeof(phone_dial_60_60_pressed_map),
   .data = phone_dial_60_60_pressed_map,
 };
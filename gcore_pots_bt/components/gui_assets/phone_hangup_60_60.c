@@ -21,266 +21,375 @@
 #define LV_ATTRIBUTE_IMG_PHONE_HANGUP_60_60
 #endif
 
+/* Run-length encoded by tools/img_rle.py for the gui_img_rle decoder */
 const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_PHONE_HANGUP_60_60 uint8_t phone_hangup_60_60_map[] = {
 #if LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8
   /*Pixel format: Alpha 8 bit, Red: 3 bit, Green: 3 bit, Blue: 2 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x19, 0xfb, 0x38, 0xf7, 0x56, 0xf6, 0x6f, 0xf2, 0xc1, 0xe4, 0xff, 0xe4, 0xff, 0xf2, 0xc1, 0xf6, 0x6f, 0xf7, 0x56, 0xfb, 0x38, 0xff, 0x19, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x14, 0xfb, 0x4f, 0xf2, 0x93, 0xe9, 0xca, 0xe4, 0xee, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xee, 0xe9, 0xca, 0xf2, 0x93, 0xfb, 0x4f, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xfb, 0x3f, 0xee, 0x9c, 0xe5, 0xe5, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe5, 0xee, 0x9c, 0xfb, 0x3f, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x4e, 0xe9, 0xbe, 0xe0, 0xfe, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfe, 0xe9, 0xbe, 0xfb, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x35, 0xe9, 0xb6, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xb6, 0xfb, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0xf2, 0x81, 0xe0, 0xf5, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xf5, 0xf2, 0x81, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x25, 0xe9, 0xbf, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xbf, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x41, 0xe5, 0xe2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe2, 0xfb, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x52, 0xe4, 0xf2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xf2, 0xfb, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x51, 0xe0, 0xf6, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xf6, 0xfb, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x40, 0xe4, 0xf2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xf2, 0xfb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x23, 0xe5, 0xe4, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe4, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0xe9, 0xc1, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xc1, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x81, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x32, 0xe0, 0xf6, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xf6, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xe9, 0xb9, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xb9, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x4c, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xee, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xf6, 0xff, 0xf6, 0xff, 0xf2, 0xff, 0xf2, 0xff, 0xee, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xfb, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xe9, 0xc1, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xf2, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xc1, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfb, 0x3d, 0xe0, 0xfd, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfd, 0xfb, 0x3d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xee, 0x9d, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0x9d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x12, 0xe5, 0xe7, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe7, 0xff, 0x12, 0x00, 0x00, 
-  0x00, 0x00, 0xfb, 0x4e, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xfb, 0x4e, 0x00, 0x00, 
-  0x00, 0x00, 0xf2, 0x93, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0x93, 0x00, 0x00, 
-  0xff, 0x03, 0xe9, 0xcb, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe5, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xcb, 0xff, 0x03, 
-  0xff, 0x19, 0xe4, 0xef, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xef, 0xff, 0x19, 
-  0xfb, 0x38, 0xe0, 0xfe, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfe, 0xfb, 0x38, 
-  0xf7, 0x56, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf7, 0x56, 
-  0xf6, 0x6a, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf6, 0x6a, 
-  0xf2, 0xc2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xc2, 
-  0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 
-  0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 
-  0xf2, 0xc2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe5, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xc2, 
-  0xf6, 0x6a, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf6, 0x6a, 
-  0xf7, 0x56, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf7, 0x56, 
-  0xfb, 0x38, 0xe0, 0xfe, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfe, 0xfb, 0x38, 
-  0xff, 0x19, 0xe4, 0xef, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xef, 0xff, 0x19, 
-  0xff, 0x03, 0xe9, 0xcb, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xee, 0xff, 0xe4, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xff, 0xee, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xcb, 0xff, 0x03, 
-  0x00, 0x00, 0xf2, 0x93, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xe9, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0x93, 0x00, 0x00, 
-  0x00, 0x00, 0xfb, 0x4e, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xfb, 0x4e, 0x00, 0x00, 
-  0x00, 0x00, 0xff, 0x12, 0xe5, 0xe7, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe7, 0xff, 0x12, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xee, 0x9d, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xee, 0x9d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xfb, 0x3d, 0xe0, 0xfd, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfd, 0xfb, 0x3d, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xff, 0x03, 0xe9, 0xc1, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xc1, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x4c, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xfb, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x02, 0xe9, 0xb9, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xb9, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x32, 0xe0, 0xf6, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xf6, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0x81, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xf2, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0xe9, 0xc1, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xc1, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x23, 0xe5, 0xe4, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe4, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x40, 0xe4, 0xf2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xf2, 0xfb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x51, 0xe0, 0xf6, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xf6, 0xfb, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x52, 0xe4, 0xf2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xf2, 0xfb, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x41, 0xe5, 0xe2, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe2, 0xfb, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x25, 0xe9, 0xbf, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xbf, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x08, 0xf2, 0x81, 0xe0, 0xf5, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xf5, 0xf2, 0x81, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x35, 0xe9, 0xb6, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe9, 0xb6, 0xfb, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x4e, 0xe9, 0xbe, 0xe0, 0xfe, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xfe, 0xe9, 0xbe, 0xfb, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xfb, 0x3f, 0xee, 0x9c, 0xe5, 0xe5, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe5, 0xe5, 0xee, 0x9c, 0xfb, 0x3f, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x14, 0xfb, 0x4f, 0xf2, 0x93, 0xe9, 0xca, 0xe4, 0xee, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe0, 0xff, 0xe4, 0xee, 0xe9, 0xca, 0xf2, 0x93, 0xfb, 0x4f, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x01, 0xff, 0x19, 0xfb, 0x38, 0xf7, 0x56, 0xf6, 0x6f, 0xf2, 0xc1, 0xe4, 0xff, 0xe4, 0xff, 0xf2, 0xc1, 0xf6, 0x6f, 0xf7, 0x56, 0xfb, 0x38, 0xff, 0x19, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x96, 0x00, 0x00, 0x05, 0xff, 0x01, 0xff, 0x19, 0xfb, 0x38, 0xf7, 0x56, 0xf6, 0x6f, 0xf2, 0xc1, 0x81, 0xe4, 0xff, 0x05, 0xf2, 0xc1, 0xf6, 0x6f, 0xf7, 0x56, 0xfb, 0x38, 0xff, 0x19, 0xff, 0x01, 
+  0xaa, 0x00, 0x00, 0x04, 0xff, 0x14, 0xfb, 0x4f, 0xf2, 0x93, 0xe9, 0xca, 0xe4, 0xee, 0x89, 0xe0, 0xff, 0x04, 0xe4, 0xee, 0xe9, 0xca, 0xf2, 0x93, 0xfb, 0x4f, 0xff, 0x14, 0xa4, 0x00, 0x00, 0x03, 
+  0xff, 0x01, 0xfb, 0x3f, 0xee, 0x9c, 0xe5, 0xe5, 0x91, 0xe0, 0xff, 0x03, 0xe5, 0xe5, 0xee, 0x9c, 0xfb, 0x3f, 0xff, 0x01, 0xa0, 0x00, 0x00, 0x02, 0xfb, 0x4e, 0xe9, 0xbe, 0xe0, 0xfe, 0x95, 0xe0, 
+  0xff, 0x02, 0xe0, 0xfe, 0xe9, 0xbe, 0xfb, 0x4e, 0x9d, 0x00, 0x00, 0x01, 0xfb, 0x35, 0xe9, 0xb6, 0x9b, 0xe0, 0xff, 0x01, 0xe9, 0xb6, 0xfb, 0x35, 0x99, 0x00, 0x00, 0x02, 0xff, 0x08, 0xf2, 0x81, 
+  0xe0, 0xf5, 0x9d, 0xe0, 0xff, 0x02, 0xe0, 0xf5, 0xf2, 0x81, 0xff, 0x08, 0x96, 0x00, 0x00, 0x01, 0xff, 0x25, 0xe9, 0xbf, 0xa1, 0xe0, 0xff, 0x01, 0xe9, 0xbf, 0xff, 0x25, 0x94, 0x00, 0x00, 0x01, 
+  0xfb, 0x41, 0xe5, 0xe2, 0xa3, 0xe0, 0xff, 0x01, 0xe5, 0xe2, 0xfb, 0x41, 0x92, 0x00, 0x00, 0x01, 0xfb, 0x52, 0xe4, 0xf2, 0xa5, 0xe0, 0xff, 0x01, 0xe4, 0xf2, 0xfb, 0x52, 0x90, 0x00, 0x00, 0x01, 
+  0xfb, 0x51, 0xe0, 0xf6, 0xa7, 0xe0, 0xff, 0x01, 0xe0, 0xf6, 0xfb, 0x51, 0x8e, 0x00, 0x00, 0x01, 0xfb, 0x40, 0xe4, 0xf2, 0xa9, 0xe0, 0xff, 0x01, 0xe4, 0xf2, 0xfb, 0x40, 0x8c, 0x00, 0x00, 0x01, 
+  0xff, 0x23, 0xe5, 0xe4, 0xab, 0xe0, 0xff, 0x01, 0xe5, 0xe4, 0xff, 0x23, 0x8a, 0x00, 0x00, 0x01, 0xff, 0x08, 0xe9, 0xc1, 0xad, 0xe0, 0xff, 0x01, 0xe9, 0xc1, 0xff, 0x08, 0x89, 0x00, 0x00, 0x00, 
+  0xf2, 0x81, 0xaf, 0xe0, 0xff, 0x00, 0xf2, 0x81, 0x88, 0x00, 0x00, 0x01, 0xff, 0x32, 0xe0, 0xf6, 0xaf, 0xe0, 0xff, 0x01, 0xe0, 0xf6, 0xff, 0x32, 0x86, 0x00, 0x00, 0x01, 0xff, 0x02, 0xe9, 0xb9, 
+  0xb1, 0xe0, 0xff, 0x01, 0xe9, 0xb9, 0xff, 0x02, 0x85, 0x00, 0x00, 0x00, 0xfb, 0x4c, 0x92, 0xe0, 0xff, 0x03, 0xe4, 0xff, 0xe5, 0xff, 0xe9, 0xff, 0xee, 0xff, 0x81, 0xf2, 0xff, 0x81, 0xf6, 0xff, 
+  0x81, 0xf2, 0xff, 0x03, 0xee, 0xff, 0xe9, 0xff, 0xe5, 0xff, 0xe4, 0xff, 0x92, 0xe0, 0xff, 0x00, 0xfb, 0x4c, 0x84, 0x00, 0x00, 0x01, 0xff, 0x03, 0xe9, 0xc1, 0x8f, 0xe0, 0xff, 0x02, 0xe9, 0xff, 
+  0xf2, 0xff, 0xfb, 0xff, 0x8d, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xf2, 0xff, 0xe9, 0xff, 0x8f, 0xe0, 0xff, 0x01, 0xe9, 0xc1, 0xff, 0x03, 0x83, 0x00, 0x00, 0x01, 0xfb, 0x3d, 0xe0, 0xfd, 0x8c, 0xe0, 
+  0xff, 0x01, 0xe9, 0xff, 0xf6, 0xff, 0x95, 0xff, 0xff, 0x01, 0xf6, 0xff, 0xe9, 0xff, 0x8c, 0xe0, 0xff, 0x01, 0xe0, 0xfd, 0xfb, 0x3d, 0x83, 0x00, 0x00, 0x00, 0xee, 0x9d, 0x8b, 0xe0, 0xff, 0x01, 
+  0xee, 0xff, 0xfb, 0xff, 0x99, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xee, 0xff, 0x8b, 0xe0, 0xff, 0x00, 0xee, 0x9d, 0x82, 0x00, 0x00, 0x01, 0xff, 0x12, 0xe5, 0xe7, 0x89, 0xe0, 0xff, 0x00, 0xee, 0xff, 
+  0x9f, 0xff, 0xff, 0x00, 0xee, 0xff, 0x89, 0xe0, 0xff, 0x01, 0xe5, 0xe7, 0xff, 0x12, 0x81, 0x00, 0x00, 0x00, 0xfb, 0x4e, 0x88, 0xe0, 0xff, 0x01, 0xe9, 0xff, 0xfb, 0xff, 0xa1, 0xff, 0xff, 0x01, 
+  0xfb, 0xff, 0xe9, 0xff, 0x88, 0xe0, 0xff, 0x00, 0xfb, 0x4e, 0x81, 0x00, 0x00, 0x00, 0xf2, 0x93, 0x87, 0xe0, 0xff, 0x00, 0xf2, 0xff, 0xa5, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x87, 0xe0, 0xff, 0x03, 
+  0xf2, 0x93, 0x00, 0x00, 0xff, 0x03, 0xe9, 0xcb, 0x85, 0xe0, 0xff, 0x01, 0xe5, 0xff, 0xfb, 0xff, 0xa7, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xe5, 0xff, 0x85, 0xe0, 0xff, 0x03, 0xe9, 0xcb, 0xff, 0x03, 
+  0xff, 0x19, 0xe4, 0xef, 0x84, 0xe0, 0xff, 0x00, 0xe9, 0xff, 0xab, 0xff, 0xff, 0x00, 0xe9, 0xff, 0x84, 0xe0, 0xff, 0x03, 0xe4, 0xef, 0xff, 0x19, 0xfb, 0x38, 0xe0, 0xfe, 0x83, 0xe0, 0xff, 0x00, 
+  0xed, 0xff, 0x90, 0xff, 0xff, 0x01, 0xf7, 0xff, 0xf2, 0xff, 0x81, 0xe9, 0xff, 0x83, 0xe5, 0xff, 0x03, 0xe9, 0xff, 0xed, 0xff, 0xf2, 0xff, 0xf7, 0xff, 0x90, 0xff, 0xff, 0x00, 0xed, 0xff, 0x83, 
+  0xe0, 0xff, 0x02, 0xe0, 0xfe, 0xfb, 0x38, 0xf7, 0x56, 0x83, 0xe0, 0xff, 0x00, 0xed, 0xff, 0x8e, 0xff, 0xff, 0x01, 0xf6, 0xff, 0xe9, 0xff, 0x8d, 0xe0, 0xff, 0x01, 0xe9, 0xff, 0xf6, 0xff, 0x8e, 
+  0xff, 0xff, 0x00, 0xed, 0xff, 0x83, 0xe0, 0xff, 0x01, 0xf7, 0x56, 0xf6, 0x6a, 0x82, 0xe0, 0xff, 0x00, 0xe4, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xed, 0xff, 0x8f, 0xe0, 0xff, 0x00, 0xed, 0xff, 0x8f, 
+  0xff, 0xff, 0x00, 0xe4, 0xff, 0x82, 0xe0, 0xff, 0x01, 0xf6, 0x6a, 0xf2, 0xc2, 0x82, 0xe0, 0xff, 0x00, 0xe9, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xf2, 0xff, 0x8f, 0xe0, 0xff, 0x00, 0xf2, 0xff, 0x8f, 
+  0xff, 0xff, 0x00, 0xe9, 0xff, 0x82, 0xe0, 0xff, 0x01, 0xf2, 0xc2, 0xe4, 0xff, 0x82, 0xe0, 0xff, 0x00, 0xe5, 0xff, 0x8f, 0xff, 0xff, 0x00, 0xf6, 0xff, 0x8f, 0xe0, 0xff, 0x00, 0xf6, 0xff, 0x8f, 
+  0xff, 0xff, 0x00, 0xe5, 0xff, 0x82, 0xe0, 0xff, 0x81, 0xe4, 0xff, 0x83, 0xe0, 0xff, 0x00, 0xf7, 0xff, 0x8e, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x8f, 0xe0, 0xff, 0x00, 0xf7, 0xff, 0x8e, 0xff, 0xff, 
+  0x00, 0xf7, 0xff, 0x83, 0xe0, 0xff, 0x01, 0xe4, 0xff, 0xf2, 0xc2, 0x83, 0xe0, 0xff, 0x00, 0xe5, 0xff, 0x8e, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x8f, 0xe0, 0xff, 0x00, 0xfb, 0xff, 0x8e, 0xff, 0xff, 
+  0x00, 0xe5, 0xff, 0x83, 0xe0, 0xff, 0x01, 0xf2, 0xc2, 0xf6, 0x6a, 0x84, 0xe0, 0xff, 0x00, 0xf2, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xf7, 0xff, 0x8f, 0xe0, 0xff, 0x00, 0xf7, 0xff, 0x8d, 0xff, 0xff, 
+  0x00, 0xf2, 0xff, 0x84, 0xe0, 0xff, 0x01, 0xf6, 0x6a, 0xf7, 0x56, 0x84, 0xe0, 0xff, 0x00, 0xe4, 0xff, 0x8d, 0xff, 0xff, 0x00, 0xe9, 0xff, 0x8f, 0xe0, 0xff, 0x00, 0xe9, 0xff, 0x8d, 0xff, 0xff, 
+  0x00, 0xe4, 0xff, 0x84, 0xe0, 0xff, 0x02, 0xf7, 0x56, 0xfb, 0x38, 0xe0, 0xfe, 0x84, 0xe0, 0xff, 0x00, 0xee, 0xff, 0x8a, 0xff, 0xff, 0x01, 0xfb, 0xff, 0xe9, 0xff, 0x91, 0xe0, 0xff, 0x01, 0xe9, 
+  0xff, 0xfb, 0xff, 0x8a, 0xff, 0xff, 0x00, 0xee, 0xff, 0x84, 0xe0, 0xff, 0x03, 0xe0, 0xfe, 0xfb, 0x38, 0xff, 0x19, 0xe4, 0xef, 0x85, 0xe0, 0xff, 0x00, 0xfb, 0xff, 0x87, 0xff, 0xff, 0x01, 0xf2, 
+  0xff, 0xe9, 0xff, 0x95, 0xe0, 0xff, 0x01, 0xe9, 0xff, 0xf6, 0xff, 0x87, 0xff, 0xff, 0x00, 0xfb, 0xff, 0x85, 0xe0, 0xff, 0x03, 0xe4, 0xef, 0xff, 0x19, 0xff, 0x03, 0xe9, 0xcb, 0x85, 0xe0, 0xff, 
+  0x00, 0xe9, 0xff, 0x84, 0xff, 0xff, 0x02, 0xfb, 0xff, 0xee, 0xff, 0xe4, 0xff, 0x99, 0xe0, 0xff, 0x02, 0xe4, 0xff, 0xee, 0xff, 0xfb, 0xff, 0x84, 0xff, 0xff, 0x00, 0xe9, 0xff, 0x85, 0xe0, 0xff, 
+  0x03, 0xe9, 0xcb, 0xff, 0x03, 0x00, 0x00, 0xf2, 0x93, 0x86, 0xe0, 0xff, 0x04, 0xe9, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xe9, 0xff, 0x9f, 0xe0, 0xff, 0x04, 0xe9, 0xff, 0xf6, 0xff, 0xff, 
+  0xff, 0xfb, 0xff, 0xe9, 0xff, 0x86, 0xe0, 0xff, 0x00, 0xf2, 0x93, 0x81, 0x00, 0x00, 0x00, 0xfb, 0x4e, 0xb7, 0xe0, 0xff, 0x00, 0xfb, 0x4e, 0x81, 0x00, 0x00, 0x01, 0xff, 0x12, 0xe5, 0xe7, 0xb5, 
+  0xe0, 0xff, 0x01, 0xe5, 0xe7, 0xff, 0x12, 0x82, 0x00, 0x00, 0x00, 0xee, 0x9d, 0xb5, 0xe0, 0xff, 0x00, 0xee, 0x9d, 0x83, 0x00, 0x00, 0x01, 0xfb, 0x3d, 0xe0, 0xfd, 0xb3, 0xe0, 0xff, 0x01, 0xe0, 
+  0xfd, 0xfb, 0x3d, 0x83, 0x00, 0x00, 0x01, 0xff, 0x03, 0xe9, 0xc1, 0xb3, 0xe0, 0xff, 0x01, 0xe9, 0xc1, 0xff, 0x03, 0x84, 0x00, 0x00, 0x00, 0xfb, 0x4c, 0xb3, 0xe0, 0xff, 0x00, 0xfb, 0x4c, 0x85, 
+  0x00, 0x00, 0x01, 0xff, 0x02, 0xe9, 0xb9, 0xb1, 0xe0, 0xff, 0x01, 0xe9, 0xb9, 0xff, 0x02, 0x86, 0x00, 0x00, 0x01, 0xff, 0x32, 0xe0, 0xf6, 0xaf, 0xe0, 0xff, 0x01, 0xe0, 0xf6, 0xff, 0x32, 0x88, 
+  0x00, 0x00, 0x00, 0xf2, 0x81, 0xaf, 0xe0, 0xff, 0x00, 0xf2, 0x81, 0x89, 0x00, 0x00, 0x01, 0xff, 0x08, 0xe9, 0xc1, 0xad, 0xe0, 0xff, 0x01, 0xe9, 0xc1, 0xff, 0x08, 0x8a, 0x00, 0x00, 0x01, 0xff, 
+  0x23, 0xe5, 0xe4, 0xab, 0xe0, 0xff, 0x01, 0xe5, 0xe4, 0xff, 0x23, 0x8c, 0x00, 0x00, 0x01, 0xfb, 0x40, 0xe4, 0xf2, 0xa9, 0xe0, 0xff, 0x01, 0xe4, 0xf2, 0xfb, 0x40, 0x8e, 0x00, 0x00, 0x01, 0xfb, 
+  0x51, 0xe0, 0xf6, 0xa7, 0xe0, 0xff, 0x01, 0xe0, 0xf6, 0xfb, 0x51, 0x90, 0x00, 0x00, 0x01, 0xfb, 0x52, 0xe4, 0xf2, 0xa5, 0xe0, 0xff, 0x01, 0xe4, 0xf2, 0xfb, 0x52, 0x92, 0x00, 0x00, 0x01, 0xfb, 
+  0x41, 0xe5, 0xe2, 0xa3, 0xe0, 0xff, 0x01, 0xe5, 0xe2, 0xfb, 0x41, 0x94, 0x00, 0x00, 0x01, 0xff, 0x25, 0xe9, 0xbf, 0xa1, 0xe0, 0xff, 0x01, 0xe9, 0xbf, 0xff, 0x25, 0x96, 0x00, 0x00, 0x02, 0xff, 
+  0x08, 0xf2, 0x81, 0xe0, 0xf5, 0x9d, 0xe0, 0xff, 0x02, 0xe0, 0xf5, 0xf2, 0x81, 0xff, 0x08, 0x99, 0x00, 0x00, 0x01, 0xfb, 0x35, 0xe9, 0xb6, 0x9b, 0xe0, 0xff, 0x01, 0xe9, 0xb6, 0xfb, 0x35, 0x9d, 
+  0x00, 0x00, 0x02, 0xfb, 0x4e, 0xe9, 0xbe, 0xe0, 0xfe, 0x95, 0xe0, 0xff, 0x02, 0xe0, 0xfe, 0xe9, 0xbe, 0xfb, 0x4e, 0xa0, 0x00, 0x00, 0x03, 0xff, 0x01, 0xfb, 0x3f, 0xee, 0x9c, 0xe5, 0xe5, 0x91, 
+  0xe0, 0xff, 0x03, 0xe5, 0xe5, 0xee, 0x9c, 0xfb, 0x3f, 0xff, 0x01, 0xa4, 0x00, 0x00, 0x04, 0xff, 0x14, 0xfb, 0x4f, 0xf2, 0x93, 0xe9, 0xca, 0xe4, 0xee, 0x89, 0xe0, 0xff, 0x04, 0xe4, 0xee, 0xe9, 
+  0xca, 0xf2, 0x93, 0xfb, 0x4f, 0xff, 0x14, 0xaa, 0x00, 0x00, 0x05, 0xff, 0x01, 0xff, 0x19, 0xfb, 0x38, 0xf7, 0x56, 0xf6, 0x6f, 0xf2, 0xc1, 0x81, 0xe4, 0xff, 0x05, 0xf2, 0xc1, 0xf6, 0x6f, 0xf7, 
+  0x56, 0xfb, 0x38, 0xff, 0x19, 0xff, 0x01, 0x96, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0
   /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7d, 0xff, 0x19, 0x7a, 0xfe, 0x38, 0x96, 0xfd, 0x56, 0xb3, 0xfc, 0x6f, 0xaf, 0xfb, 0xc1, 0xa3, 0xf8, 0xff, 0xa3, 0xf8, 0xff, 0xaf, 0xfb, 0xc1, 0xb3, 0xfc, 0x6f, 0x96, 0xfd, 0x56, 0x7a, 0xfe, 0x38, 0x7d, 0xff, 0x19, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0x14, 0xb7, 0xfd, 0x4f, 0xaf, 0xfb, 0x93, 0xe8, 0xf9, 0xca, 0xc3, 0xf8, 0xee, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0xc3, 0xf8, 0xee, 0xe8, 0xf9, 0xca, 0xaf, 0xfb, 0x93, 0xb7, 0xfd, 0x4f, 0xbe, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x59, 0xfe, 0x3f, 0x4d, 0xfb, 0x9c, 0x04, 0xf9, 0xe5, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x04, 0xf9, 0xe5, 0x4d, 0xfb, 0x9c, 0x59, 0xfe, 0x3f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfd, 0x4e, 0x49, 0xfa, 0xbe, 0x21, 0xf8, 0xfe, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xfe, 0x49, 0xfa, 0xbe, 0xd7, 0xfd, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfe, 0x35, 0x8a, 0xfa, 0xb6, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x8a, 0xfa, 0xb6, 0x9a, 0xfe, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0x51, 0xfc, 0x81, 0x82, 0xf8, 0xf5, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf5, 0x51, 0xfc, 0x81, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfe, 0x25, 0x49, 0xfa, 0xbf, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x49, 0xfa, 0xbf, 0xfc, 0xfe, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xfe, 0x41, 0x25, 0xf9, 0xe2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x25, 0xf9, 0xe2, 0x39, 0xfe, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xfd, 0x52, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf2, 0xb7, 0xfd, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xfd, 0x51, 0x62, 0xf8, 0xf6, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xf6, 0xb7, 0xfd, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfe, 0x40, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf2, 0x59, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x23, 0x05, 0xf9, 0xe4, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x05, 0xf9, 0xe4, 0x3c, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0x29, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xfc, 0x81, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x51, 0xfc, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfe, 0x32, 0x62, 0xf8, 0xf6, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x62, 0xf8, 0xf6, 0x9a, 0xfe, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x8a, 0xfa, 0xb9, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x8a, 0xfa, 0xb9, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xfd, 0x4c, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x83, 0xf8, 0xff, 0x66, 0xf9, 0xff, 0x4a, 0xfa, 0xff, 0x2d, 0xfb, 0xff, 0xf0, 0xfb, 0xff, 0x51, 0xfc, 0xff, 0x92, 0xfc, 0xff, 0x92, 0xfc, 0xff, 0x51, 0xfc, 0xff, 0xf0, 0xfb, 0xff, 0x2d, 0xfb, 0xff, 0x4a, 0xfa, 0xff, 0x66, 0xf9, 0xff, 0x83, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0xd8, 0xfd, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x49, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xf7, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xd7, 0xfd, 0xff, 0x10, 0xfc, 0xff, 0x29, 0xfa, 0xff, 0x82, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x49, 0xfa, 0xc1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfe, 0x3d, 0x21, 0xf8, 0xfd, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x09, 0xfa, 0xff, 0xd3, 0xfc, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xd3, 0xfc, 0xff, 0x08, 0xfa, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xfd, 0x59, 0xfe, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xfb, 0x9d, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xff, 0x2d, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0xfe, 0xff, 0x2d, 0xfb, 0xff, 0x62, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x6d, 0xfb, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0xff, 0x12, 0xe4, 0xf8, 0xe7, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x41, 0xf8, 0xff, 0x2d, 0xfb, 0xff, 0xbb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0xfe, 0xff, 0x0c, 0xfb, 0xff, 0x41, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xe4, 0xf8, 0xe7, 0x9e, 0xff, 0x12, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd7, 0xfd, 0x4e, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xe8, 0xf9, 0xff, 0x38, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xfe, 0xff, 0xe8, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xd7, 0xfd, 0x4e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xaf, 0xfb, 0x93, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xff, 0x31, 0xfc, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x31, 0xfc, 0xff, 0x42, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xaf, 0xfb, 0x93, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x03, 0xe8, 0xf9, 0xcb, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x45, 0xf9, 0xff, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xfe, 0xff, 0x45, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xe8, 0xf9, 0xcb, 0xff, 0xff, 0x03, 
-  0x7d, 0xff, 0x19, 0xa3, 0xf8, 0xef, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0x29, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xa3, 0xf8, 0xef, 0x7d, 0xff, 0x19, 
-  0x7a, 0xfe, 0x38, 0x21, 0xf8, 0xfe, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xcc, 0xfa, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xff, 0x35, 0xfd, 0xff, 0xaf, 0xfb, 0xff, 0x8a, 0xfa, 0xff, 0xc7, 0xf9, 0xff, 0x45, 0xf9, 0xff, 0x05, 0xf9, 0xff, 0x05, 0xf9, 0xff, 0x45, 0xf9, 0xff, 0xc7, 0xf9, 0xff, 0x8a, 0xfa, 0xff, 0xaf, 0xfb, 0xff, 0x35, 0xfd, 0xff, 0xdb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xcb, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xfe, 0x7a, 0xfe, 0x38, 
-  0x96, 0xfd, 0x56, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xec, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd3, 0xfc, 0xff, 0xa7, 0xf9, 0xff, 0x42, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x42, 0xf8, 0xff, 0xa7, 0xf9, 0xff, 0xf4, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xcb, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x96, 0xfd, 0x56, 
-  0xd3, 0xfc, 0x6a, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xe4, 0xf8, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcb, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xcb, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xc4, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xd3, 0xfc, 0x6a, 
-  0x8f, 0xfb, 0xc2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcf, 0xfb, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xcf, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x8f, 0xfb, 0xc2, 
-  0xa3, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x86, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0xfc, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x93, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xa3, 0xf8, 0xff, 
-  0xa3, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x96, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0xfd, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x75, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x96, 0xfd, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xa3, 0xf8, 0xff, 
-  0x8f, 0xfb, 0xc2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x66, 0xf9, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x18, 0xfe, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x18, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0x66, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x8f, 0xfb, 0xc2, 
-  0xd3, 0xfc, 0x6a, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x72, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x76, 0xfd, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x76, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x72, 0xfc, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xd3, 0xfc, 0x6a, 
-  0x96, 0xfd, 0x56, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xc3, 0xf8, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x08, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x08, 0xfa, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xc3, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x96, 0xfd, 0x56, 
-  0x7a, 0xfe, 0x38, 0x21, 0xf8, 0xfe, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x6e, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xd7, 0xfd, 0xff, 0x08, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0xf7, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6e, 0xfb, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xfe, 0x7a, 0xfe, 0x38, 
-  0x7d, 0xff, 0x19, 0xa3, 0xf8, 0xef, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x42, 0xf8, 0xff, 0x7a, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xff, 0x92, 0xfc, 0xff, 0x86, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xa7, 0xf9, 0xff, 0x92, 0xfc, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xfe, 0xff, 0x42, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xa3, 0xf8, 0xef, 0x7d, 0xff, 0x19, 
-  0xff, 0xff, 0x03, 0xe8, 0xf9, 0xcb, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x39, 0xfe, 0xff, 0x2d, 0xfb, 0xff, 0xa3, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xa3, 0xf8, 0xff, 0x4d, 0xfb, 0xff, 0x39, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x29, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xe8, 0xf9, 0xcb, 0xff, 0xff, 0x03, 
-  0x00, 0x00, 0x00, 0xaf, 0xfb, 0x93, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x6a, 0xfa, 0xff, 0xd7, 0xfd, 0xff, 0x9a, 0xfe, 0xff, 0xf4, 0xfc, 0xff, 0x08, 0xfa, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x08, 0xfa, 0xff, 0xf4, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0xf8, 0xfd, 0xff, 0x6a, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xaf, 0xfb, 0x93, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xd7, 0xfd, 0x4e, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xd7, 0xfd, 0x4e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x9e, 0xff, 0x12, 0xe4, 0xf8, 0xe7, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xe4, 0xf8, 0xe7, 0x9e, 0xff, 0x12, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6d, 0xfb, 0x9d, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x6d, 0xfb, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfe, 0x3d, 0x21, 0xf8, 0xfd, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xfd, 0x59, 0xfe, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0x49, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x49, 0xfa, 0xc1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd8, 0xfd, 0x4c, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0xd8, 0xfd, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0x8a, 0xfa, 0xb9, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x8a, 0xfa, 0xb9, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfe, 0x32, 0x62, 0xf8, 0xf6, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x62, 0xf8, 0xf6, 0x9a, 0xfe, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0xfc, 0x81, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x51, 0xfc, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0x29, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3c, 0xff, 0x23, 0x05, 0xf9, 0xe4, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x05, 0xf9, 0xe4, 0x3c, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x59, 0xfe, 0x40, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf2, 0x59, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xfd, 0x51, 0x62, 0xf8, 0xf6, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xf6, 0xb7, 0xfd, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xfd, 0x52, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf2, 0xb7, 0xfd, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xfe, 0x41, 0x25, 0xf9, 0xe2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x25, 0xf9, 0xe2, 0x39, 0xfe, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0xfe, 0x25, 0x49, 0xfa, 0xbf, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x49, 0xfa, 0xbf, 0xfc, 0xfe, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0x51, 0xfc, 0x81, 0x82, 0xf8, 0xf5, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf5, 0x51, 0xfc, 0x81, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9a, 0xfe, 0x35, 0x8a, 0xfa, 0xb6, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x8a, 0xfa, 0xb6, 0x9a, 0xfe, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd7, 0xfd, 0x4e, 0x49, 0xfa, 0xbe, 0x21, 0xf8, 0xfe, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xfe, 0x49, 0xfa, 0xbe, 0xd7, 0xfd, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x59, 0xfe, 0x3f, 0x4d, 0xfb, 0x9c, 0x04, 0xf9, 0xe5, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x04, 0xf9, 0xe5, 0x4d, 0xfb, 0x9c, 0x59, 0xfe, 0x3f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbe, 0xff, 0x14, 0xb7, 0xfd, 0x4f, 0xaf, 0xfb, 0x93, 0xe8, 0xf9, 0xca, 0xc3, 0xf8, 0xee, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0xc3, 0xf8, 0xee, 0xe8, 0xf9, 0xca, 0xaf, 0xfb, 0x93, 0xb7, 0xfd, 0x4f, 0xbe, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0x7d, 0xff, 0x19, 0x7a, 0xfe, 0x38, 0x96, 0xfd, 0x56, 0xb3, 0xfc, 0x6f, 0xaf, 0xfb, 0xc1, 0xa3, 0xf8, 0xff, 0xa3, 0xf8, 0xff, 0xaf, 0xfb, 0xc1, 0xb3, 0xfc, 0x6f, 0x96, 0xfd, 0x56, 0x7a, 0xfe, 0x38, 0x7d, 0xff, 0x19, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x96, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0x01, 0x7d, 0xff, 0x19, 0x7a, 0xfe, 0x38, 0x96, 0xfd, 0x56, 0xb3, 0xfc, 0x6f, 0xaf, 0xfb, 0xc1, 0x81, 0xa3, 0xf8, 0xff, 0x05, 0xaf, 0xfb, 0xc1, 0xb3, 
+  0xfc, 0x6f, 0x96, 0xfd, 0x56, 0x7a, 0xfe, 0x38, 0x7d, 0xff, 0x19, 0xff, 0xff, 0x01, 0xaa, 0x00, 0x00, 0x00, 0x05, 0xbe, 0xff, 0x14, 0xb7, 0xfd, 0x4f, 0xaf, 0xfb, 0x93, 0xe8, 0xf9, 0xca, 0xc3, 
+  0xf8, 0xee, 0x21, 0xf8, 0xff, 0x82, 0x00, 0xf8, 0xff, 0x81, 0x01, 0xf8, 0xff, 0x82, 0x00, 0xf8, 0xff, 0x05, 0x21, 0xf8, 0xff, 0xc3, 0xf8, 0xee, 0xe8, 0xf9, 0xca, 0xaf, 0xfb, 0x93, 0xb7, 0xfd, 
+  0x4f, 0xbe, 0xff, 0x14, 0xa4, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x01, 0x59, 0xfe, 0x3f, 0x4d, 0xfb, 0x9c, 0x04, 0xf9, 0xe5, 0x82, 0x00, 0xf8, 0xff, 0x81, 0x01, 0xf8, 0xff, 0x87, 0x21, 0xf8, 
+  0xff, 0x81, 0x01, 0xf8, 0xff, 0x82, 0x00, 0xf8, 0xff, 0x03, 0x04, 0xf9, 0xe5, 0x4d, 0xfb, 0x9c, 0x59, 0xfe, 0x3f, 0xff, 0xff, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xfd, 0x4e, 0x49, 0xfa, 
+  0xbe, 0x21, 0xf8, 0xfe, 0x81, 0x00, 0xf8, 0xff, 0x91, 0x21, 0xf8, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x02, 0x21, 0xf8, 0xfe, 0x49, 0xfa, 0xbe, 0xd7, 0xfd, 0x4e, 0x9d, 0x00, 0x00, 0x00, 0x04, 0x9a, 
+  0xfe, 0x35, 0x8a, 0xfa, 0xb6, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x95, 0x21, 0xf8, 0xff, 0x04, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x8a, 0xfa, 0xb6, 0x9a, 
+  0xfe, 0x35, 0x99, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x08, 0x51, 0xfc, 0x81, 0x82, 0xf8, 0xf5, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x99, 0x21, 0xf8, 0xff, 0x04, 0x01, 0xf8, 0xff, 0x00, 0xf8, 
+  0xff, 0x82, 0xf8, 0xf5, 0x51, 0xfc, 0x81, 0xff, 0xff, 0x08, 0x96, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xfe, 0x25, 0x49, 0xfa, 0xbf, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x9d, 0x21, 0xf8, 0xff, 0x03, 
+  0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x49, 0xfa, 0xbf, 0xfc, 0xfe, 0x25, 0x94, 0x00, 0x00, 0x00, 0x02, 0x39, 0xfe, 0x41, 0x25, 0xf9, 0xe2, 0x00, 0xf8, 0xff, 0xa1, 0x21, 0xf8, 0xff, 0x02, 0x00, 
+  0xf8, 0xff, 0x25, 0xf9, 0xe2, 0x39, 0xfe, 0x41, 0x92, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xfd, 0x52, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0xa3, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x82, 0xf8, 
+  0xf2, 0xb7, 0xfd, 0x52, 0x90, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xfd, 0x51, 0x62, 0xf8, 0xf6, 0x00, 0xf8, 0xff, 0xa5, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xf6, 0xb7, 0xfd, 0x51, 
+  0x8e, 0x00, 0x00, 0x00, 0x02, 0x59, 0xfe, 0x40, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0xa7, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf2, 0x59, 0xfe, 0x40, 0x8c, 0x00, 0x00, 0x00, 
+  0x02, 0x3c, 0xff, 0x23, 0x05, 0xf9, 0xe4, 0x00, 0xf8, 0xff, 0xa9, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x05, 0xf9, 0xe4, 0x3c, 0xff, 0x23, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x08, 
+  0x29, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0xab, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xc1, 0xff, 0xff, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0x51, 0xfc, 0x81, 0x00, 0xf8, 0xff, 0xad, 
+  0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x51, 0xfc, 0x81, 0x88, 0x00, 0x00, 0x00, 0x02, 0x9a, 0xfe, 0x32, 0x62, 0xf8, 0xf6, 0x01, 0xf8, 0xff, 0xad, 0x21, 0xf8, 0xff, 0x02, 0x01, 0xf8, 0xff, 
+  0x62, 0xf8, 0xf6, 0x9a, 0xfe, 0x32, 0x86, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0x8a, 0xfa, 0xb9, 0x00, 0xf8, 0xff, 0x90, 0x21, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x8b, 0x00, 0xf8, 0xff, 
+  0x00, 0x01, 0xf8, 0xff, 0x90, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x8a, 0xfa, 0xb9, 0xff, 0xff, 0x02, 0x85, 0x00, 0x00, 0x00, 0x02, 0xd8, 0xfd, 0x4c, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 
+  0x8c, 0x21, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x82, 0x00, 0xf8, 0xff, 0x05, 0x83, 0xf8, 0xff, 0x66, 0xf9, 0xff, 0x4a, 0xfa, 0xff, 0x2d, 0xfb, 0xff, 0xf0, 0xfb, 0xff, 0x51, 0xfc, 0xff, 0x81, 
+  0x92, 0xfc, 0xff, 0x05, 0x51, 0xfc, 0xff, 0xf0, 0xfb, 0xff, 0x2d, 0xfb, 0xff, 0x4a, 0xfa, 0xff, 0x66, 0xf9, 0xff, 0x83, 0xf8, 0xff, 0x82, 0x00, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x8c, 0x21, 
+  0xf8, 0xff, 0x02, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0xd8, 0xfd, 0x4c, 0x84, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x03, 0x49, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0x8a, 0x21, 0xf8, 0xff, 0x00, 0x01, 
+  0xf8, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x05, 0x82, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0x10, 0xfc, 0xff, 0xf7, 0xfd, 0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0x05, 0xdf, 0xff, 
+  0xff, 0x3c, 0xff, 0xff, 0xd7, 0xfd, 0xff, 0x10, 0xfc, 0xff, 0x29, 0xfa, 0xff, 0x82, 0xf8, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x8a, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 
+  0x49, 0xfa, 0xc1, 0xff, 0xff, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0x59, 0xfe, 0x3d, 0x21, 0xf8, 0xfd, 0x01, 0xf8, 0xff, 0x88, 0x21, 0xf8, 0xff, 0x05, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 
+  0xf8, 0xff, 0x09, 0xfa, 0xff, 0xd3, 0xfc, 0xff, 0x1c, 0xff, 0xff, 0x93, 0xff, 0xff, 0xff, 0x05, 0x1c, 0xff, 0xff, 0xd3, 0xfc, 0xff, 0x08, 0xfa, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 
+  0xf8, 0xff, 0x88, 0x21, 0xf8, 0xff, 0x02, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xfd, 0x59, 0xfe, 0x3d, 0x83, 0x00, 0x00, 0x00, 0x01, 0x6d, 0xfb, 0x9d, 0x00, 0xf8, 0xff, 0x87, 0x21, 0xf8, 0xff, 0x04, 
+  0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xff, 0x2d, 0xfb, 0xff, 0x59, 0xfe, 0xff, 0x99, 0xff, 0xff, 0xff, 0x04, 0x59, 0xfe, 0xff, 0x2d, 0xfb, 0xff, 0x62, 0xf8, 0xff, 0x00, 0xf8, 0xff, 
+  0x01, 0xf8, 0xff, 0x87, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x6d, 0xfb, 0x9d, 0x82, 0x00, 0x00, 0x00, 0x02, 0x9e, 0xff, 0x12, 0xe4, 0xf8, 0xe7, 0x00, 0xf8, 0xff, 0x86, 0x21, 0xf8, 0xff, 
+  0x03, 0x00, 0xf8, 0xff, 0x41, 0xf8, 0xff, 0x2d, 0xfb, 0xff, 0xbb, 0xfe, 0xff, 0x9d, 0xff, 0xff, 0xff, 0x03, 0xbb, 0xfe, 0xff, 0x0c, 0xfb, 0xff, 0x41, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x86, 0x21, 
+  0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0xe4, 0xf8, 0xe7, 0x9e, 0xff, 0x12, 0x81, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xfd, 0x4e, 0x00, 0xf8, 0xff, 0x85, 0x21, 0xf8, 0xff, 0x03, 0x01, 0xf8, 0xff, 0x00, 
+  0xf8, 0xff, 0xe8, 0xf9, 0xff, 0x38, 0xfe, 0xff, 0xa1, 0xff, 0xff, 0xff, 0x03, 0x18, 0xfe, 0xff, 0xe8, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x85, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 
+  0xff, 0xd7, 0xfd, 0x4e, 0x81, 0x00, 0x00, 0x00, 0x01, 0xaf, 0xfb, 0x93, 0x00, 0xf8, 0xff, 0x84, 0x21, 0xf8, 0xff, 0x03, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xff, 0x31, 0xfc, 0xff, 0xdf, 0xff, 0xff, 
+  0xa3, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0x31, 0xfc, 0xff, 0x42, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x84, 0x21, 0xf8, 0xff, 0x05, 0x00, 0xf8, 0xff, 0xaf, 0xfb, 0x93, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x03, 0xe8, 0xf9, 0xcb, 0x00, 0xf8, 0xff, 0x83, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x45, 0xf9, 0xff, 0x18, 0xfe, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x02, 0x18, 0xfe, 0xff, 0x45, 0xf9, 
+  0xff, 0x00, 0xf8, 0xff, 0x83, 0x21, 0xf8, 0xff, 0x05, 0x00, 0xf8, 0xff, 0xe8, 0xf9, 0xcb, 0xff, 0xff, 0x03, 0x7d, 0xff, 0x19, 0xa3, 0xf8, 0xef, 0x01, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x02, 
+  0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0x3d, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x81, 0xbf, 0xff, 0xff, 0x00, 0xdf, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0x02, 0x3d, 0xff, 
+  0xff, 0x29, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x05, 0x01, 0xf8, 0xff, 0xa3, 0xf8, 0xef, 0x7d, 0xff, 0x19, 0x7a, 0xfe, 0x38, 0x21, 0xf8, 0xfe, 0x01, 0xf8, 0xff, 0x81, 0x21, 
+  0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0xcc, 0xfa, 0xff, 0xbf, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x05, 0xdb, 0xfe, 0xff, 0x35, 0xfd, 0xff, 0xaf, 0xfb, 0xff, 0x8a, 0xfa, 0xff, 0xc7, 0xf9, 0xff, 
+  0x45, 0xf9, 0xff, 0x81, 0x05, 0xf9, 0xff, 0x05, 0x45, 0xf9, 0xff, 0xc7, 0xf9, 0xff, 0x8a, 0xfa, 0xff, 0xaf, 0xfb, 0xff, 0x35, 0xfd, 0xff, 0xdb, 0xfe, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xbf, 
+  0xff, 0xff, 0xcb, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x81, 0x21, 0xf8, 0xff, 0x04, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xfe, 0x7a, 0xfe, 0x38, 0x96, 0xfd, 0x56, 0x00, 0xf8, 0xff, 0x81, 0x21, 0xf8, 0xff, 
+  0x01, 0x00, 0xf8, 0xff, 0xec, 0xfa, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xd3, 0xfc, 0xff, 0xa7, 0xf9, 0xff, 0x42, 0xf8, 0xff, 0x8b, 0x00, 0xf8, 0xff, 0x02, 0x42, 0xf8, 0xff, 0xa7, 0xf9, 0xff, 
+  0xf4, 0xfc, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0xcb, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x81, 0x21, 0xf8, 0xff, 0x07, 0x00, 0xf8, 0xff, 0x96, 0xfd, 0x56, 0xd3, 0xfc, 0x6a, 0x00, 
+  0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xe4, 0xf8, 0xff, 0x7d, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xcb, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x8b, 0x21, 0xf8, 0xff, 
+  0x02, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xcb, 0xfa, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x0a, 0x5d, 0xff, 0xff, 0xc4, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0xd3, 0xfc, 
+  0x6a, 0x8f, 0xfb, 0xc2, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xcf, 0xfb, 0xff, 0x00, 0xf8, 0xff, 0x8d, 0x21, 0xf8, 0xff, 0x01, 
+  0x00, 0xf8, 0xff, 0xcf, 0xfb, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x09, 0x29, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x8f, 0xfb, 0xc2, 0xa3, 0xf8, 0xff, 0x01, 0xf8, 0xff, 
+  0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x86, 0xf9, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0x92, 0xfc, 0xff, 0x00, 0xf8, 0xff, 0x8d, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x93, 0xfc, 0xff, 0x8f, 
+  0xff, 0xff, 0xff, 0x03, 0x66, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x81, 0xa3, 0xf8, 0xff, 0x04, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 
+  0xff, 0x96, 0xfd, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0x55, 0xfd, 0xff, 0x00, 0xf8, 0xff, 0x8d, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x75, 0xfd, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x07, 0x96, 
+  0xfd, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xa3, 0xf8, 0xff, 0x8f, 0xfb, 0xc2, 0x00, 0xf8, 0xff, 0x81, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x66, 
+  0xf9, 0xff, 0xbf, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x18, 0xfe, 0xff, 0x00, 0xf8, 0xff, 0x8d, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x18, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 
+  0xbf, 0xff, 0xff, 0x66, 0xf9, 0xff, 0x00, 0xf8, 0xff, 0x81, 0x21, 0xf8, 0xff, 0x03, 0x00, 0xf8, 0xff, 0x8f, 0xfb, 0xc2, 0xd3, 0xfc, 0x6a, 0x00, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x01, 0x00, 
+  0xf8, 0xff, 0x72, 0xfc, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0x76, 0xfd, 0xff, 0x00, 0xf8, 0xff, 0x8d, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x76, 0xfd, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 
+  0x72, 0xfc, 0xff, 0x00, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x03, 0x00, 0xf8, 0xff, 0xd3, 0xfc, 0x6a, 0x96, 0xfd, 0x56, 0x00, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x02, 0x01, 0xf8, 0xff, 0xc3, 
+  0xf8, 0xff, 0x3d, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xdf, 0xff, 0xff, 0x08, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x8d, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x08, 0xfa, 0xff, 0xdf, 0xff, 
+  0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0x3d, 0xff, 0xff, 0xc3, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x04, 0x00, 0xf8, 0xff, 0x96, 0xfd, 0x56, 0x7a, 0xfe, 0x38, 0x21, 0xf8, 0xfe, 
+  0x01, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x6e, 0xfb, 0xff, 0x89, 0xff, 0xff, 0xff, 0x03, 0xdf, 0xff, 0xff, 0xd7, 0xfd, 0xff, 0x08, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x8f, 
+  0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0xf7, 0xfd, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0x6e, 0xfb, 0xff, 0x00, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x05, 0x01, 0xf8, 0xff, 
+  0x21, 0xf8, 0xfe, 0x7a, 0xfe, 0x38, 0x7d, 0xff, 0x19, 0xa3, 0xf8, 0xef, 0x01, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x02, 0x01, 0xf8, 0xff, 0x42, 0xf8, 0xff, 0x7a, 0xfe, 0xff, 0x86, 0xff, 0xff, 
+  0xff, 0x02, 0x3c, 0xff, 0xff, 0x92, 0xfc, 0xff, 0x86, 0xf9, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x91, 0x21, 0xf8, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x02, 0xa7, 0xf9, 0xff, 0x92, 0xfc, 0xff, 0x3d, 0xff, 
+  0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0x7a, 0xfe, 0xff, 0x42, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x82, 0x21, 0xf8, 0xff, 0x05, 0x01, 0xf8, 0xff, 0xa3, 0xf8, 0xef, 0x7d, 0xff, 0x19, 0xff, 0xff, 0x03, 
+  0xe8, 0xf9, 0xcb, 0x00, 0xf8, 0xff, 0x83, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 0x39, 0xfe, 0xff, 0x2d, 0xfb, 0xff, 0xa3, 0xf8, 0xff, 0x81, 
+  0x00, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x93, 0x21, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x02, 0xa3, 0xf8, 0xff, 0x4d, 0xfb, 0xff, 0x39, 0xfe, 0xff, 0x84, 0xff, 0xff, 
+  0xff, 0x01, 0x29, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x83, 0x21, 0xf8, 0xff, 0x05, 0x00, 0xf8, 0xff, 0xe8, 0xf9, 0xcb, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xaf, 0xfb, 0x93, 0x00, 0xf8, 0xff, 0x84, 
+  0x21, 0xf8, 0xff, 0x08, 0x00, 0xf8, 0xff, 0x6a, 0xfa, 0xff, 0xd7, 0xfd, 0xff, 0x9a, 0xfe, 0xff, 0xf4, 0xfc, 0xff, 0x08, 0xfa, 0xff, 0x21, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x99, 
+  0x21, 0xf8, 0xff, 0x08, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0x08, 0xfa, 0xff, 0xf4, 0xfc, 0xff, 0x9a, 0xfe, 0xff, 0xf8, 0xfd, 0xff, 0x6a, 0xfa, 0xff, 0x00, 0xf8, 0xff, 0x84, 
+  0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0xaf, 0xfb, 0x93, 0x81, 0x00, 0x00, 0x00, 0x01, 0xd7, 0xfd, 0x4e, 0x00, 0xf8, 0xff, 0x85, 0x21, 0xf8, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x00, 0x21, 0xf8, 
+  0xff, 0x81, 0x00, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x9d, 0x21, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x81, 0x00, 0xf8, 0xff, 0x02, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x85, 
+  0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0xd7, 0xfd, 0x4e, 0x81, 0x00, 0x00, 0x00, 0x02, 0x9e, 0xff, 0x12, 0xe4, 0xf8, 0xe7, 0x00, 0xf8, 0xff, 0x86, 0x21, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 
+  0xa3, 0x21, 0xf8, 0xff, 0x00, 0x01, 0xf8, 0xff, 0x86, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0xe4, 0xf8, 0xe7, 0x9e, 0xff, 0x12, 0x82, 0x00, 0x00, 0x00, 0x01, 0x6d, 0xfb, 0x9d, 0x00, 0xf8, 
+  0xff, 0xb3, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x6d, 0xfb, 0x9d, 0x83, 0x00, 0x00, 0x00, 0x02, 0x59, 0xfe, 0x3d, 0x21, 0xf8, 0xfd, 0x01, 0xf8, 0xff, 0xb1, 0x21, 0xf8, 0xff, 0x02, 0x01, 
+  0xf8, 0xff, 0x21, 0xf8, 0xfd, 0x59, 0xfe, 0x3d, 0x83, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x03, 0x49, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0xb1, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x49, 0xfa, 
+  0xc1, 0xff, 0xff, 0x03, 0x84, 0x00, 0x00, 0x00, 0x02, 0xd8, 0xfd, 0x4c, 0x21, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0xaf, 0x21, 0xf8, 0xff, 0x02, 0x01, 0xf8, 0xff, 0x21, 0xf8, 0xff, 0xd8, 0xfd, 0x4c, 
+  0x85, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0x8a, 0xfa, 0xb9, 0x00, 0xf8, 0xff, 0xaf, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x8a, 0xfa, 0xb9, 0xff, 0xff, 0x02, 0x86, 0x00, 0x00, 0x00, 
+  0x02, 0x9a, 0xfe, 0x32, 0x62, 0xf8, 0xf6, 0x01, 0xf8, 0xff, 0xad, 0x21, 0xf8, 0xff, 0x02, 0x01, 0xf8, 0xff, 0x62, 0xf8, 0xf6, 0x9a, 0xfe, 0x32, 0x88, 0x00, 0x00, 0x00, 0x01, 0x51, 0xfc, 0x81, 
+  0x00, 0xf8, 0xff, 0xad, 0x21, 0xf8, 0xff, 0x01, 0x00, 0xf8, 0xff, 0x51, 0xfc, 0x81, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x08, 0x29, 0xfa, 0xc1, 0x00, 0xf8, 0xff, 0xab, 0x21, 0xf8, 0xff, 
+  0x02, 0x00, 0xf8, 0xff, 0x29, 0xfa, 0xc1, 0xff, 0xff, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x02, 0x3c, 0xff, 0x23, 0x05, 0xf9, 0xe4, 0x00, 0xf8, 0xff, 0xa9, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 
+  0x05, 0xf9, 0xe4, 0x3c, 0xff, 0x23, 0x8c, 0x00, 0x00, 0x00, 0x02, 0x59, 0xfe, 0x40, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0xa7, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf2, 0x59, 
+  0xfe, 0x40, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xfd, 0x51, 0x62, 0xf8, 0xf6, 0x00, 0xf8, 0xff, 0xa5, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x62, 0xf8, 0xf6, 0xb7, 0xfd, 0x51, 0x90, 0x00, 
+  0x00, 0x00, 0x02, 0xb7, 0xfd, 0x52, 0x82, 0xf8, 0xf2, 0x00, 0xf8, 0xff, 0xa3, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf2, 0xb7, 0xfd, 0x52, 0x92, 0x00, 0x00, 0x00, 0x02, 0x39, 
+  0xfe, 0x41, 0x25, 0xf9, 0xe2, 0x00, 0xf8, 0xff, 0xa1, 0x21, 0xf8, 0xff, 0x02, 0x00, 0xf8, 0xff, 0x25, 0xf9, 0xe2, 0x39, 0xfe, 0x41, 0x94, 0x00, 0x00, 0x00, 0x03, 0xfc, 0xfe, 0x25, 0x49, 0xfa, 
+  0xbf, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x9d, 0x21, 0xf8, 0xff, 0x03, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x49, 0xfa, 0xbf, 0xfc, 0xfe, 0x25, 0x96, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x08, 
+  0x51, 0xfc, 0x81, 0x82, 0xf8, 0xf5, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x99, 0x21, 0xf8, 0xff, 0x04, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x82, 0xf8, 0xf5, 0x51, 0xfc, 0x81, 0xff, 0xff, 0x08, 
+  0x99, 0x00, 0x00, 0x00, 0x04, 0x9a, 0xfe, 0x35, 0x8a, 0xfa, 0xb6, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 0xf8, 0xff, 0x95, 0x21, 0xf8, 0xff, 0x04, 0x01, 0xf8, 0xff, 0x00, 0xf8, 0xff, 0x01, 
+  0xf8, 0xff, 0x8a, 0xfa, 0xb6, 0x9a, 0xfe, 0x35, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xd7, 0xfd, 0x4e, 0x49, 0xfa, 0xbe, 0x21, 0xf8, 0xfe, 0x81, 0x00, 0xf8, 0xff, 0x91, 0x21, 0xf8, 0xff, 0x81, 0x00, 
+  0xf8, 0xff, 0x02, 0x21, 0xf8, 0xfe, 0x49, 0xfa, 0xbe, 0xd7, 0xfd, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x01, 0x59, 0xfe, 0x3f, 0x4d, 0xfb, 0x9c, 0x04, 0xf9, 0xe5, 0x82, 0x00, 0xf8, 
+  0xff, 0x81, 0x01, 0xf8, 0xff, 0x87, 0x21, 0xf8, 0xff, 0x81, 0x01, 0xf8, 0xff, 0x82, 0x00, 0xf8, 0xff, 0x03, 0x04, 0xf9, 0xe5, 0x4d, 0xfb, 0x9c, 0x59, 0xfe, 0x3f, 0xff, 0xff, 0x01, 0xa4, 0x00, 
+  0x00, 0x00, 0x05, 0xbe, 0xff, 0x14, 0xb7, 0xfd, 0x4f, 0xaf, 0xfb, 0x93, 0xe8, 0xf9, 0xca, 0xc3, 0xf8, 0xee, 0x21, 0xf8, 0xff, 0x82, 0x00, 0xf8, 0xff, 0x81, 0x01, 0xf8, 0xff, 0x82, 0x00, 0xf8, 
+  0xff, 0x05, 0x21, 0xf8, 0xff, 0xc3, 0xf8, 0xee, 0xe8, 0xf9, 0xca, 0xaf, 0xfb, 0x93, 0xb7, 0xfd, 0x4f, 0xbe, 0xff, 0x14, 0xaa, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0x01, 0x7d, 0xff, 0x19, 0x7a, 
+  0xfe, 0x38, 0x96, 0xfd, 0x56, 0xb3, 0xfc, 0x6f, 0xaf, 0xfb, 0xc1, 0x81, 0xa3, 0xf8, 0xff, 0x05, 0xaf, 0xfb, 0xc1, 0xb3, 0xfc, 0x6f, 0x96, 0xfd, 0x56, 0x7a, 0xfe, 0x38, 0x7d, 0xff, 0x19, 0xff, 
+  0xff, 0x01, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0
   /*Pixel format: Alpha 8 bit, Red: 5 bit, Green: 6 bit, Blue: 5 bit  BUT the 2  color bytes are swapped*/
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0x7d, 0x19, 0xfe, 0x7a, 0x38, 0xfd, 0x96, 0x56, 0xfc, 0xb3, 0x6f, 0xfb, 0xaf, 0xc1, 0xf8, 0xa3, 0xff, 0xf8, 0xa3, 0xff, 0xfb, 0xaf, 0xc1, 0xfc, 0xb3, 0x6f, 0xfd, 0x96, 0x56, 0xfe, 0x7a, 0x38, 0xff, 0x7d, 0x19, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbe, 0x14, 0xfd, 0xb7, 0x4f, 0xfb, 0xaf, 0x93, 0xf9, 0xe8, 0xca, 0xf8, 0xc3, 0xee, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0xc3, 0xee, 0xf9, 0xe8, 0xca, 0xfb, 0xaf, 0x93, 0xfd, 0xb7, 0x4f, 0xff, 0xbe, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xfe, 0x59, 0x3f, 0xfb, 0x4d, 0x9c, 0xf9, 0x04, 0xe5, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x04, 0xe5, 0xfb, 0x4d, 0x9c, 0xfe, 0x59, 0x3f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0x4e, 0xfa, 0x49, 0xbe, 0xf8, 0x21, 0xfe, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xfe, 0xfa, 0x49, 0xbe, 0xfd, 0xd7, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x9a, 0x35, 0xfa, 0x8a, 0xb6, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xfa, 0x8a, 0xb6, 0xfe, 0x9a, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0xfc, 0x51, 0x81, 0xf8, 0x82, 0xf5, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf5, 0xfc, 0x51, 0x81, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfc, 0x25, 0xfa, 0x49, 0xbf, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x49, 0xbf, 0xfe, 0xfc, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x39, 0x41, 0xf9, 0x25, 0xe2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x25, 0xe2, 0xfe, 0x39, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xb7, 0x52, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf2, 0xfd, 0xb7, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xb7, 0x51, 0xf8, 0x62, 0xf6, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xf6, 0xfd, 0xb7, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x59, 0x40, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf2, 0xfe, 0x59, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3c, 0x23, 0xf9, 0x05, 0xe4, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x05, 0xe4, 0xff, 0x3c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0xfa, 0x29, 0xc1, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x51, 0x81, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0x51, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x9a, 0x32, 0xf8, 0x62, 0xf6, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x62, 0xf6, 0xfe, 0x9a, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xfa, 0x8a, 0xb9, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x8a, 0xb9, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd8, 0x4c, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x83, 0xff, 0xf9, 0x66, 0xff, 0xfa, 0x4a, 0xff, 0xfb, 0x2d, 0xff, 0xfb, 0xf0, 0xff, 0xfc, 0x51, 0xff, 0xfc, 0x92, 0xff, 0xfc, 0x92, 0xff, 0xfc, 0x51, 0xff, 0xfb, 0xf0, 0xff, 0xfb, 0x2d, 0xff, 0xfa, 0x4a, 0xff, 0xf9, 0x66, 0xff, 0xf8, 0x83, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xfd, 0xd8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xfa, 0x49, 0xc1, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xff, 0xfa, 0x29, 0xff, 0xfc, 0x10, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0x3c, 0xff, 0xfd, 0xd7, 0xff, 0xfc, 0x10, 0xff, 0xfa, 0x29, 0xff, 0xf8, 0x82, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x49, 0xc1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x59, 0x3d, 0xf8, 0x21, 0xfd, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xfa, 0x09, 0xff, 0xfc, 0xd3, 0xff, 0xff, 0x1c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x1c, 0xff, 0xfc, 0xd3, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xfd, 0xfe, 0x59, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x6d, 0x9d, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xff, 0xfb, 0x2d, 0xff, 0xfe, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x59, 0xff, 0xfb, 0x2d, 0xff, 0xf8, 0x62, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0x6d, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x9e, 0x12, 0xf8, 0xe4, 0xe7, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x41, 0xff, 0xfb, 0x2d, 0xff, 0xfe, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xbb, 0xff, 0xfb, 0x0c, 0xff, 0xf8, 0x41, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0xe4, 0xe7, 0xff, 0x9e, 0x12, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xd7, 0x4e, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0xe8, 0xff, 0xfe, 0x38, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x18, 0xff, 0xf9, 0xe8, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfd, 0xd7, 0x4e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfb, 0xaf, 0x93, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xff, 0xfc, 0x31, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfc, 0x31, 0xff, 0xf8, 0x42, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0xaf, 0x93, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0x03, 0xf9, 0xe8, 0xcb, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x45, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x18, 0xff, 0xf9, 0x45, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0xe8, 0xcb, 0xff, 0xff, 0x03, 
-  0xff, 0x7d, 0x19, 0xf8, 0xa3, 0xef, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xfa, 0x29, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xa3, 0xef, 0xff, 0x7d, 0x19, 
-  0xfe, 0x7a, 0x38, 0xf8, 0x21, 0xfe, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0xcc, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdb, 0xff, 0xfd, 0x35, 0xff, 0xfb, 0xaf, 0xff, 0xfa, 0x8a, 0xff, 0xf9, 0xc7, 0xff, 0xf9, 0x45, 0xff, 0xf9, 0x05, 0xff, 0xf9, 0x05, 0xff, 0xf9, 0x45, 0xff, 0xf9, 0xc7, 0xff, 0xfa, 0x8a, 0xff, 0xfb, 0xaf, 0xff, 0xfd, 0x35, 0xff, 0xfe, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xfa, 0xcb, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xfe, 0xfe, 0x7a, 0x38, 
-  0xfd, 0x96, 0x56, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0xec, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xd3, 0xff, 0xf9, 0xa7, 0xff, 0xf8, 0x42, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x42, 0xff, 0xf9, 0xa7, 0xff, 0xfc, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfa, 0xcb, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfd, 0x96, 0x56, 
-  0xfc, 0xd3, 0x6a, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xe4, 0xff, 0xff, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xcb, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0xcb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xf8, 0xc4, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0xd3, 0x6a, 
-  0xfb, 0x8f, 0xc2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xcf, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0xcf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x29, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0x8f, 0xc2, 
-  0xf8, 0xa3, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x86, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x92, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0x93, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0x66, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xa3, 0xff, 
-  0xf8, 0xa3, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xfd, 0x96, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x55, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfd, 0x75, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x96, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xa3, 0xff, 
-  0xfb, 0x8f, 0xc2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x66, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x18, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfe, 0x18, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xf9, 0x66, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0x8f, 0xc2, 
-  0xfc, 0xd3, 0x6a, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0x72, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x76, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfd, 0x76, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x72, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0xd3, 0x6a, 
-  0xfd, 0x96, 0x56, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xc3, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x08, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3d, 0xff, 0xf8, 0xc3, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfd, 0x96, 0x56, 
-  0xfe, 0x7a, 0x38, 0xf8, 0x21, 0xfe, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0x6e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xfd, 0xd7, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x6e, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xfe, 0xfe, 0x7a, 0x38, 
-  0xff, 0x7d, 0x19, 0xf8, 0xa3, 0xef, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x42, 0xff, 0xfe, 0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3c, 0xff, 0xfc, 0x92, 0xff, 0xf9, 0x86, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0xa7, 0xff, 0xfc, 0x92, 0xff, 0xff, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x7a, 0xff, 0xf8, 0x42, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xa3, 0xef, 0xff, 0x7d, 0x19, 
-  0xff, 0xff, 0x03, 0xf9, 0xe8, 0xcb, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x39, 0xff, 0xfb, 0x2d, 0xff, 0xf8, 0xa3, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0xa3, 0xff, 0xfb, 0x4d, 0xff, 0xfe, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x29, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0xe8, 0xcb, 0xff, 0xff, 0x03, 
-  0x00, 0x00, 0x00, 0xfb, 0xaf, 0x93, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x6a, 0xff, 0xfd, 0xd7, 0xff, 0xfe, 0x9a, 0xff, 0xfc, 0xf4, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xfa, 0x08, 0xff, 0xfc, 0xf4, 0xff, 0xfe, 0x9a, 0xff, 0xfd, 0xf8, 0xff, 0xfa, 0x6a, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0xaf, 0x93, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xfd, 0xd7, 0x4e, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfd, 0xd7, 0x4e, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0xff, 0x9e, 0x12, 0xf8, 0xe4, 0xe7, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0xe4, 0xe7, 0xff, 0x9e, 0x12, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfb, 0x6d, 0x9d, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0x6d, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x59, 0x3d, 0xf8, 0x21, 0xfd, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xfd, 0xfe, 0x59, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x03, 0xfa, 0x49, 0xc1, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x49, 0xc1, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd8, 0x4c, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xfd, 0xd8, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x02, 0xfa, 0x8a, 0xb9, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x8a, 0xb9, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x9a, 0x32, 0xf8, 0x62, 0xf6, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x62, 0xf6, 0xfe, 0x9a, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfc, 0x51, 0x81, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0x51, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0xfa, 0x29, 0xc1, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xc1, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0x3c, 0x23, 0xf9, 0x05, 0xe4, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x05, 0xe4, 0xff, 0x3c, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x59, 0x40, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf2, 0xfe, 0x59, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xb7, 0x51, 0xf8, 0x62, 0xf6, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xf6, 0xfd, 0xb7, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xb7, 0x52, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf2, 0xfd, 0xb7, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x39, 0x41, 0xf9, 0x25, 0xe2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x25, 0xe2, 0xfe, 0x39, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0xfc, 0x25, 0xfa, 0x49, 0xbf, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x49, 0xbf, 0xfe, 0xfc, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x08, 0xfc, 0x51, 0x81, 0xf8, 0x82, 0xf5, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf5, 0xfc, 0x51, 0x81, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfe, 0x9a, 0x35, 0xfa, 0x8a, 0xb6, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xfa, 0x8a, 0xb6, 0xfe, 0x9a, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xfd, 0xd7, 0x4e, 0xfa, 0x49, 0xbe, 0xf8, 0x21, 0xfe, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xfe, 0xfa, 0x49, 0xbe, 0xfd, 0xd7, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xfe, 0x59, 0x3f, 0xfb, 0x4d, 0x9c, 0xf9, 0x04, 0xe5, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x04, 0xe5, 0xfb, 0x4d, 0x9c, 0xfe, 0x59, 0x3f, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xbe, 0x14, 0xfd, 0xb7, 0x4f, 0xfb, 0xaf, 0x93, 0xf9, 0xe8, 0xca, 0xf8, 0xc3, 0xee, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0xc3, 0xee, 0xf9, 0xe8, 0xca, 0xfb, 0xaf, 0x93, 0xfd, 0xb7, 0x4f, 0xff, 0xbe, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0x01, 0xff, 0x7d, 0x19, 0xfe, 0x7a, 0x38, 0xfd, 0x96, 0x56, 0xfc, 0xb3, 0x6f, 0xfb, 0xaf, 0xc1, 0xf8, 0xa3, 0xff, 0xf8, 0xa3, 0xff, 0xfb, 0xaf, 0xc1, 0xfc, 0xb3, 0x6f, 0xfd, 0x96, 0x56, 0xfe, 0x7a, 0x38, 0xff, 0x7d, 0x19, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x96, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0x01, 0xff, 0x7d, 0x19, 0xfe, 0x7a, 0x38, 0xfd, 0x96, 0x56, 0xfc, 0xb3, 0x6f, 0xfb, 0xaf, 0xc1, 0x81, 0xf8, 0xa3, 0xff, 0x05, 0xfb, 0xaf, 0xc1, 0xfc, 
+  0xb3, 0x6f, 0xfd, 0x96, 0x56, 0xfe, 0x7a, 0x38, 0xff, 0x7d, 0x19, 0xff, 0xff, 0x01, 0xaa, 0x00, 0x00, 0x00, 0x05, 0xff, 0xbe, 0x14, 0xfd, 0xb7, 0x4f, 0xfb, 0xaf, 0x93, 0xf9, 0xe8, 0xca, 0xf8, 
+  0xc3, 0xee, 0xf8, 0x21, 0xff, 0x82, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x00, 0xff, 0x05, 0xf8, 0x21, 0xff, 0xf8, 0xc3, 0xee, 0xf9, 0xe8, 0xca, 0xfb, 0xaf, 0x93, 0xfd, 0xb7, 
+  0x4f, 0xff, 0xbe, 0x14, 0xa4, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x01, 0xfe, 0x59, 0x3f, 0xfb, 0x4d, 0x9c, 0xf9, 0x04, 0xe5, 0x82, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x01, 0xff, 0x87, 0xf8, 0x21, 
+  0xff, 0x81, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x00, 0xff, 0x03, 0xf9, 0x04, 0xe5, 0xfb, 0x4d, 0x9c, 0xfe, 0x59, 0x3f, 0xff, 0xff, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xd7, 0x4e, 0xfa, 0x49, 
+  0xbe, 0xf8, 0x21, 0xfe, 0x81, 0xf8, 0x00, 0xff, 0x91, 0xf8, 0x21, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0x21, 0xfe, 0xfa, 0x49, 0xbe, 0xfd, 0xd7, 0x4e, 0x9d, 0x00, 0x00, 0x00, 0x04, 0xfe, 
+  0x9a, 0x35, 0xfa, 0x8a, 0xb6, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x95, 0xf8, 0x21, 0xff, 0x04, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0xfa, 0x8a, 0xb6, 0xfe, 
+  0x9a, 0x35, 0x99, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x08, 0xfc, 0x51, 0x81, 0xf8, 0x82, 0xf5, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x99, 0xf8, 0x21, 0xff, 0x04, 0xf8, 0x01, 0xff, 0xf8, 0x00, 
+  0xff, 0xf8, 0x82, 0xf5, 0xfc, 0x51, 0x81, 0xff, 0xff, 0x08, 0x96, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xfc, 0x25, 0xfa, 0x49, 0xbf, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x9d, 0xf8, 0x21, 0xff, 0x03, 
+  0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x49, 0xbf, 0xfe, 0xfc, 0x25, 0x94, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x39, 0x41, 0xf9, 0x25, 0xe2, 0xf8, 0x00, 0xff, 0xa1, 0xf8, 0x21, 0xff, 0x02, 0xf8, 
+  0x00, 0xff, 0xf9, 0x25, 0xe2, 0xfe, 0x39, 0x41, 0x92, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xb7, 0x52, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xa3, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0x82, 
+  0xf2, 0xfd, 0xb7, 0x52, 0x90, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xb7, 0x51, 0xf8, 0x62, 0xf6, 0xf8, 0x00, 0xff, 0xa5, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xf6, 0xfd, 0xb7, 0x51, 
+  0x8e, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x59, 0x40, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xa7, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf2, 0xfe, 0x59, 0x40, 0x8c, 0x00, 0x00, 0x00, 
+  0x02, 0xff, 0x3c, 0x23, 0xf9, 0x05, 0xe4, 0xf8, 0x00, 0xff, 0xa9, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf9, 0x05, 0xe4, 0xff, 0x3c, 0x23, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x08, 
+  0xfa, 0x29, 0xc1, 0xf8, 0x00, 0xff, 0xab, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xc1, 0xff, 0xff, 0x08, 0x89, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x51, 0x81, 0xf8, 0x00, 0xff, 0xad, 
+  0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfc, 0x51, 0x81, 0x88, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x9a, 0x32, 0xf8, 0x62, 0xf6, 0xf8, 0x01, 0xff, 0xad, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x01, 0xff, 
+  0xf8, 0x62, 0xf6, 0xfe, 0x9a, 0x32, 0x86, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0xfa, 0x8a, 0xb9, 0xf8, 0x00, 0xff, 0x90, 0xf8, 0x21, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x8b, 0xf8, 0x00, 0xff, 
+  0x00, 0xf8, 0x01, 0xff, 0x90, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xfa, 0x8a, 0xb9, 0xff, 0xff, 0x02, 0x85, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xd8, 0x4c, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 
+  0x8c, 0xf8, 0x21, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x00, 0xff, 0x05, 0xf8, 0x83, 0xff, 0xf9, 0x66, 0xff, 0xfa, 0x4a, 0xff, 0xfb, 0x2d, 0xff, 0xfb, 0xf0, 0xff, 0xfc, 0x51, 0xff, 0x81, 
+  0xfc, 0x92, 0xff, 0x05, 0xfc, 0x51, 0xff, 0xfb, 0xf0, 0xff, 0xfb, 0x2d, 0xff, 0xfa, 0x4a, 0xff, 0xf9, 0x66, 0xff, 0xf8, 0x83, 0xff, 0x82, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x8c, 0xf8, 
+  0x21, 0xff, 0x02, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xfd, 0xd8, 0x4c, 0x84, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x03, 0xfa, 0x49, 0xc1, 0xf8, 0x00, 0xff, 0x8a, 0xf8, 0x21, 0xff, 0x00, 0xf8, 
+  0x01, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x05, 0xf8, 0x82, 0xff, 0xfa, 0x29, 0xff, 0xfc, 0x10, 0xff, 0xfd, 0xf7, 0xff, 0xff, 0x3c, 0xff, 0xff, 0xdf, 0xff, 0x89, 0xff, 0xff, 0xff, 0x05, 0xff, 0xdf, 
+  0xff, 0xff, 0x3c, 0xff, 0xfd, 0xd7, 0xff, 0xfc, 0x10, 0xff, 0xfa, 0x29, 0xff, 0xf8, 0x82, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x8a, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 
+  0xfa, 0x49, 0xc1, 0xff, 0xff, 0x03, 0x83, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x59, 0x3d, 0xf8, 0x21, 0xfd, 0xf8, 0x01, 0xff, 0x88, 0xf8, 0x21, 0xff, 0x05, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 
+  0x21, 0xff, 0xfa, 0x09, 0xff, 0xfc, 0xd3, 0xff, 0xff, 0x1c, 0xff, 0x93, 0xff, 0xff, 0xff, 0x05, 0xff, 0x1c, 0xff, 0xfc, 0xd3, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 
+  0x01, 0xff, 0x88, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xfd, 0xfe, 0x59, 0x3d, 0x83, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x6d, 0x9d, 0xf8, 0x00, 0xff, 0x87, 0xf8, 0x21, 0xff, 0x04, 
+  0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xff, 0xfb, 0x2d, 0xff, 0xfe, 0x59, 0xff, 0x99, 0xff, 0xff, 0xff, 0x04, 0xfe, 0x59, 0xff, 0xfb, 0x2d, 0xff, 0xf8, 0x62, 0xff, 0xf8, 0x00, 0xff, 
+  0xf8, 0x01, 0xff, 0x87, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfb, 0x6d, 0x9d, 0x82, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9e, 0x12, 0xf8, 0xe4, 0xe7, 0xf8, 0x00, 0xff, 0x86, 0xf8, 0x21, 0xff, 
+  0x03, 0xf8, 0x00, 0xff, 0xf8, 0x41, 0xff, 0xfb, 0x2d, 0xff, 0xfe, 0xbb, 0xff, 0x9d, 0xff, 0xff, 0xff, 0x03, 0xfe, 0xbb, 0xff, 0xfb, 0x0c, 0xff, 0xf8, 0x41, 0xff, 0xf8, 0x00, 0xff, 0x86, 0xf8, 
+  0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0xe4, 0xe7, 0xff, 0x9e, 0x12, 0x81, 0x00, 0x00, 0x00, 0x01, 0xfd, 0xd7, 0x4e, 0xf8, 0x00, 0xff, 0x85, 0xf8, 0x21, 0xff, 0x03, 0xf8, 0x01, 0xff, 0xf8, 
+  0x00, 0xff, 0xf9, 0xe8, 0xff, 0xfe, 0x38, 0xff, 0xa1, 0xff, 0xff, 0xff, 0x03, 0xfe, 0x18, 0xff, 0xf9, 0xe8, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x85, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 
+  0xff, 0xfd, 0xd7, 0x4e, 0x81, 0x00, 0x00, 0x00, 0x01, 0xfb, 0xaf, 0x93, 0xf8, 0x00, 0xff, 0x84, 0xf8, 0x21, 0xff, 0x03, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xff, 0xfc, 0x31, 0xff, 0xff, 0xdf, 0xff, 
+  0xa3, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xfc, 0x31, 0xff, 0xf8, 0x42, 0xff, 0xf8, 0x00, 0xff, 0x84, 0xf8, 0x21, 0xff, 0x05, 0xf8, 0x00, 0xff, 0xfb, 0xaf, 0x93, 0x00, 0x00, 0x00, 0xff, 
+  0xff, 0x03, 0xf9, 0xe8, 0xcb, 0xf8, 0x00, 0xff, 0x83, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf9, 0x45, 0xff, 0xfe, 0x18, 0xff, 0xa7, 0xff, 0xff, 0xff, 0x02, 0xfe, 0x18, 0xff, 0xf9, 0x45, 
+  0xff, 0xf8, 0x00, 0xff, 0x83, 0xf8, 0x21, 0xff, 0x05, 0xf8, 0x00, 0xff, 0xf9, 0xe8, 0xcb, 0xff, 0xff, 0x03, 0xff, 0x7d, 0x19, 0xf8, 0xa3, 0xef, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x02, 
+  0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0xff, 0x3d, 0xff, 0x92, 0xff, 0xff, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x81, 0xff, 0xbf, 0xff, 0x00, 0xff, 0xdf, 0xff, 0x92, 0xff, 0xff, 0xff, 0x02, 0xff, 0x3d, 
+  0xff, 0xfa, 0x29, 0xff, 0xf8, 0x00, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x05, 0xf8, 0x01, 0xff, 0xf8, 0xa3, 0xef, 0xff, 0x7d, 0x19, 0xfe, 0x7a, 0x38, 0xf8, 0x21, 0xfe, 0xf8, 0x01, 0xff, 0x81, 0xf8, 
+  0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xfa, 0xcc, 0xff, 0xff, 0xbf, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x05, 0xfe, 0xdb, 0xff, 0xfd, 0x35, 0xff, 0xfb, 0xaf, 0xff, 0xfa, 0x8a, 0xff, 0xf9, 0xc7, 0xff, 
+  0xf9, 0x45, 0xff, 0x81, 0xf9, 0x05, 0xff, 0x05, 0xf9, 0x45, 0xff, 0xf9, 0xc7, 0xff, 0xfa, 0x8a, 0xff, 0xfb, 0xaf, 0xff, 0xfd, 0x35, 0xff, 0xfe, 0xdb, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xff, 
+  0xbf, 0xff, 0xfa, 0xcb, 0xff, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x21, 0xff, 0x04, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xfe, 0xfe, 0x7a, 0x38, 0xfd, 0x96, 0x56, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x21, 0xff, 
+  0x01, 0xf8, 0x00, 0xff, 0xfa, 0xec, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xfc, 0xd3, 0xff, 0xf9, 0xa7, 0xff, 0xf8, 0x42, 0xff, 0x8b, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0x42, 0xff, 0xf9, 0xa7, 0xff, 
+  0xfc, 0xf4, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xff, 0xfa, 0xcb, 0xff, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x21, 0xff, 0x07, 0xf8, 0x00, 0xff, 0xfd, 0x96, 0x56, 0xfc, 0xd3, 0x6a, 0xf8, 
+  0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xe4, 0xff, 0xff, 0x7d, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x02, 0xfa, 0xcb, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x8b, 0xf8, 0x21, 0xff, 
+  0x02, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0xcb, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x0a, 0xff, 0x5d, 0xff, 0xf8, 0xc4, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfc, 0xd3, 
+  0x6a, 0xfb, 0x8f, 0xc2, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xfb, 0xcf, 0xff, 0xf8, 0x00, 0xff, 0x8d, 0xf8, 0x21, 0xff, 0x01, 
+  0xf8, 0x00, 0xff, 0xfb, 0xcf, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x09, 0xfa, 0x29, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xfb, 0x8f, 0xc2, 0xf8, 0xa3, 0xff, 0xf8, 0x01, 0xff, 
+  0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf9, 0x86, 0xff, 0x8f, 0xff, 0xff, 0xff, 0x01, 0xfc, 0x92, 0xff, 0xf8, 0x00, 0xff, 0x8d, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfc, 0x93, 0xff, 0x8f, 
+  0xff, 0xff, 0xff, 0x03, 0xf9, 0x66, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0x81, 0xf8, 0xa3, 0xff, 0x04, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 
+  0xff, 0xfd, 0x96, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x01, 0xfd, 0x55, 0xff, 0xf8, 0x00, 0xff, 0x8d, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfd, 0x75, 0xff, 0x8e, 0xff, 0xff, 0xff, 0x07, 0xfd, 
+  0x96, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0xa3, 0xff, 0xfb, 0x8f, 0xc2, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf9, 
+  0x66, 0xff, 0xff, 0xbf, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xfe, 0x18, 0xff, 0xf8, 0x00, 0xff, 0x8d, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfe, 0x18, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x02, 
+  0xff, 0xbf, 0xff, 0xf9, 0x66, 0xff, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x21, 0xff, 0x03, 0xf8, 0x00, 0xff, 0xfb, 0x8f, 0xc2, 0xfc, 0xd3, 0x6a, 0xf8, 0x00, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x01, 0xf8, 
+  0x00, 0xff, 0xfc, 0x72, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 0xfd, 0x76, 0xff, 0xf8, 0x00, 0xff, 0x8d, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfd, 0x76, 0xff, 0x8d, 0xff, 0xff, 0xff, 0x01, 
+  0xfc, 0x72, 0xff, 0xf8, 0x00, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x03, 0xf8, 0x00, 0xff, 0xfc, 0xd3, 0x6a, 0xfd, 0x96, 0x56, 0xf8, 0x00, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x01, 0xff, 0xf8, 
+  0xc3, 0xff, 0xff, 0x3d, 0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xff, 0xdf, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x00, 0xff, 0x8d, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xfa, 0x08, 0xff, 0xff, 0xdf, 
+  0xff, 0x8b, 0xff, 0xff, 0xff, 0x02, 0xff, 0x3d, 0xff, 0xf8, 0xc3, 0xff, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x04, 0xf8, 0x00, 0xff, 0xfd, 0x96, 0x56, 0xfe, 0x7a, 0x38, 0xf8, 0x21, 0xfe, 
+  0xf8, 0x01, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfb, 0x6e, 0xff, 0x89, 0xff, 0xff, 0xff, 0x03, 0xff, 0xdf, 0xff, 0xfd, 0xd7, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x00, 0xff, 0x8f, 
+  0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0xfd, 0xf7, 0xff, 0x8a, 0xff, 0xff, 0xff, 0x01, 0xfb, 0x6e, 0xff, 0xf8, 0x00, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x05, 0xf8, 0x01, 0xff, 
+  0xf8, 0x21, 0xfe, 0xfe, 0x7a, 0x38, 0xff, 0x7d, 0x19, 0xf8, 0xa3, 0xef, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x01, 0xff, 0xf8, 0x42, 0xff, 0xfe, 0x7a, 0xff, 0x86, 0xff, 0xff, 
+  0xff, 0x02, 0xff, 0x3c, 0xff, 0xfc, 0x92, 0xff, 0xf9, 0x86, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x91, 0xf8, 0x21, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x02, 0xf9, 0xa7, 0xff, 0xfc, 0x92, 0xff, 0xff, 0x3d, 
+  0xff, 0x86, 0xff, 0xff, 0xff, 0x02, 0xfe, 0x7a, 0xff, 0xf8, 0x42, 0xff, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x21, 0xff, 0x05, 0xf8, 0x01, 0xff, 0xf8, 0xa3, 0xef, 0xff, 0x7d, 0x19, 0xff, 0xff, 0x03, 
+  0xf9, 0xe8, 0xcb, 0xf8, 0x00, 0xff, 0x83, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xff, 0x84, 0xff, 0xff, 0xff, 0x02, 0xfe, 0x39, 0xff, 0xfb, 0x2d, 0xff, 0xf8, 0xa3, 0xff, 0x81, 
+  0xf8, 0x00, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x93, 0xf8, 0x21, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0xa3, 0xff, 0xfb, 0x4d, 0xff, 0xfe, 0x39, 0xff, 0x84, 0xff, 0xff, 
+  0xff, 0x01, 0xfa, 0x29, 0xff, 0xf8, 0x00, 0xff, 0x83, 0xf8, 0x21, 0xff, 0x05, 0xf8, 0x00, 0xff, 0xf9, 0xe8, 0xcb, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0xfb, 0xaf, 0x93, 0xf8, 0x00, 0xff, 0x84, 
+  0xf8, 0x21, 0xff, 0x08, 0xf8, 0x00, 0xff, 0xfa, 0x6a, 0xff, 0xfd, 0xd7, 0xff, 0xfe, 0x9a, 0xff, 0xfc, 0xf4, 0xff, 0xfa, 0x08, 0xff, 0xf8, 0x21, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x99, 
+  0xf8, 0x21, 0xff, 0x08, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x21, 0xff, 0xfa, 0x08, 0xff, 0xfc, 0xf4, 0xff, 0xfe, 0x9a, 0xff, 0xfd, 0xf8, 0xff, 0xfa, 0x6a, 0xff, 0xf8, 0x00, 0xff, 0x84, 
+  0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfb, 0xaf, 0x93, 0x81, 0x00, 0x00, 0x00, 0x01, 0xfd, 0xd7, 0x4e, 0xf8, 0x00, 0xff, 0x85, 0xf8, 0x21, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x21, 
+  0xff, 0x81, 0xf8, 0x00, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x9d, 0xf8, 0x21, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x81, 0xf8, 0x00, 0xff, 0x02, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0x85, 
+  0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfd, 0xd7, 0x4e, 0x81, 0x00, 0x00, 0x00, 0x02, 0xff, 0x9e, 0x12, 0xf8, 0xe4, 0xe7, 0xf8, 0x00, 0xff, 0x86, 0xf8, 0x21, 0xff, 0x00, 0xf8, 0x01, 0xff, 
+  0xa3, 0xf8, 0x21, 0xff, 0x00, 0xf8, 0x01, 0xff, 0x86, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0xe4, 0xe7, 0xff, 0x9e, 0x12, 0x82, 0x00, 0x00, 0x00, 0x01, 0xfb, 0x6d, 0x9d, 0xf8, 0x00, 
+  0xff, 0xb3, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfb, 0x6d, 0x9d, 0x83, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x59, 0x3d, 0xf8, 0x21, 0xfd, 0xf8, 0x01, 0xff, 0xb1, 0xf8, 0x21, 0xff, 0x02, 0xf8, 
+  0x01, 0xff, 0xf8, 0x21, 0xfd, 0xfe, 0x59, 0x3d, 0x83, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x03, 0xfa, 0x49, 0xc1, 0xf8, 0x00, 0xff, 0xb1, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xfa, 0x49, 
+  0xc1, 0xff, 0xff, 0x03, 0x84, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xd8, 0x4c, 0xf8, 0x21, 0xff, 0xf8, 0x01, 0xff, 0xaf, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x01, 0xff, 0xf8, 0x21, 0xff, 0xfd, 0xd8, 0x4c, 
+  0x85, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x02, 0xfa, 0x8a, 0xb9, 0xf8, 0x00, 0xff, 0xaf, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xfa, 0x8a, 0xb9, 0xff, 0xff, 0x02, 0x86, 0x00, 0x00, 0x00, 
+  0x02, 0xfe, 0x9a, 0x32, 0xf8, 0x62, 0xf6, 0xf8, 0x01, 0xff, 0xad, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x01, 0xff, 0xf8, 0x62, 0xf6, 0xfe, 0x9a, 0x32, 0x88, 0x00, 0x00, 0x00, 0x01, 0xfc, 0x51, 0x81, 
+  0xf8, 0x00, 0xff, 0xad, 0xf8, 0x21, 0xff, 0x01, 0xf8, 0x00, 0xff, 0xfc, 0x51, 0x81, 0x89, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0x08, 0xfa, 0x29, 0xc1, 0xf8, 0x00, 0xff, 0xab, 0xf8, 0x21, 0xff, 
+  0x02, 0xf8, 0x00, 0xff, 0xfa, 0x29, 0xc1, 0xff, 0xff, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x02, 0xff, 0x3c, 0x23, 0xf9, 0x05, 0xe4, 0xf8, 0x00, 0xff, 0xa9, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 
+  0xf9, 0x05, 0xe4, 0xff, 0x3c, 0x23, 0x8c, 0x00, 0x00, 0x00, 0x02, 0xfe, 0x59, 0x40, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xa7, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf2, 0xfe, 
+  0x59, 0x40, 0x8e, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xb7, 0x51, 0xf8, 0x62, 0xf6, 0xf8, 0x00, 0xff, 0xa5, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0x62, 0xf6, 0xfd, 0xb7, 0x51, 0x90, 0x00, 
+  0x00, 0x00, 0x02, 0xfd, 0xb7, 0x52, 0xf8, 0x82, 0xf2, 0xf8, 0x00, 0xff, 0xa3, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf2, 0xfd, 0xb7, 0x52, 0x92, 0x00, 0x00, 0x00, 0x02, 0xfe, 
+  0x39, 0x41, 0xf9, 0x25, 0xe2, 0xf8, 0x00, 0xff, 0xa1, 0xf8, 0x21, 0xff, 0x02, 0xf8, 0x00, 0xff, 0xf9, 0x25, 0xe2, 0xfe, 0x39, 0x41, 0x94, 0x00, 0x00, 0x00, 0x03, 0xfe, 0xfc, 0x25, 0xfa, 0x49, 
+  0xbf, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x9d, 0xf8, 0x21, 0xff, 0x03, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xfa, 0x49, 0xbf, 0xfe, 0xfc, 0x25, 0x96, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0x08, 
+  0xfc, 0x51, 0x81, 0xf8, 0x82, 0xf5, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x99, 0xf8, 0x21, 0xff, 0x04, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x82, 0xf5, 0xfc, 0x51, 0x81, 0xff, 0xff, 0x08, 
+  0x99, 0x00, 0x00, 0x00, 0x04, 0xfe, 0x9a, 0x35, 0xfa, 0x8a, 0xb6, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 0x01, 0xff, 0x95, 0xf8, 0x21, 0xff, 0x04, 0xf8, 0x01, 0xff, 0xf8, 0x00, 0xff, 0xf8, 
+  0x01, 0xff, 0xfa, 0x8a, 0xb6, 0xfe, 0x9a, 0x35, 0x9d, 0x00, 0x00, 0x00, 0x02, 0xfd, 0xd7, 0x4e, 0xfa, 0x49, 0xbe, 0xf8, 0x21, 0xfe, 0x81, 0xf8, 0x00, 0xff, 0x91, 0xf8, 0x21, 0xff, 0x81, 0xf8, 
+  0x00, 0xff, 0x02, 0xf8, 0x21, 0xfe, 0xfa, 0x49, 0xbe, 0xfd, 0xd7, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0x01, 0xfe, 0x59, 0x3f, 0xfb, 0x4d, 0x9c, 0xf9, 0x04, 0xe5, 0x82, 0xf8, 0x00, 
+  0xff, 0x81, 0xf8, 0x01, 0xff, 0x87, 0xf8, 0x21, 0xff, 0x81, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x00, 0xff, 0x03, 0xf9, 0x04, 0xe5, 0xfb, 0x4d, 0x9c, 0xfe, 0x59, 0x3f, 0xff, 0xff, 0x01, 0xa4, 0x00, 
+  0x00, 0x00, 0x05, 0xff, 0xbe, 0x14, 0xfd, 0xb7, 0x4f, 0xfb, 0xaf, 0x93, 0xf9, 0xe8, 0xca, 0xf8, 0xc3, 0xee, 0xf8, 0x21, 0xff, 0x82, 0xf8, 0x00, 0xff, 0x81, 0xf8, 0x01, 0xff, 0x82, 0xf8, 0x00, 
+  0xff, 0x05, 0xf8, 0x21, 0xff, 0xf8, 0xc3, 0xee, 0xf9, 0xe8, 0xca, 0xfb, 0xaf, 0x93, 0xfd, 0xb7, 0x4f, 0xff, 0xbe, 0x14, 0xaa, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0x01, 0xff, 0x7d, 0x19, 0xfe, 
+  0x7a, 0x38, 0xfd, 0x96, 0x56, 0xfc, 0xb3, 0x6f, 0xfb, 0xaf, 0xc1, 0x81, 0xf8, 0xa3, 0xff, 0x05, 0xfb, 0xaf, 0xc1, 0xfc, 0xb3, 0x6f, 0xfd, 0x96, 0x56, 0xfe, 0x7a, 0x38, 0xff, 0x7d, 0x19, 0xff, 
+  0xff, 0x01, 0x96, 0x00, 0x00, 0x00, 
 #endif
 #if LV_COLOR_DEPTH == 32
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xeb, 0xeb, 0xff, 0x19, 0xcd, 0xcd, 0xff, 0x38, 0xaf, 0xaf, 0xff, 0x56, 0x98, 0x95, 0xfd, 0x6f, 0x74, 0x72, 0xfc, 0xc1, 0x19, 0x14, 0xfc, 0xff, 0x19, 0x14, 0xfc, 0xff, 0x74, 0x72, 0xfc, 0xc1, 0x98, 0x95, 0xfd, 0x6f, 0xaf, 0xaf, 0xff, 0x56, 0xcd, 0xcd, 0xff, 0x38, 0xeb, 0xeb, 0xff, 0x19, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xf2, 0xff, 0x14, 0xb8, 0xb5, 0xff, 0x4f, 0x74, 0x72, 0xfd, 0x93, 0x3d, 0x3a, 0xfc, 0xca, 0x1a, 0x17, 0xfb, 0xee, 0x07, 0x03, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xff, 0x1a, 0x17, 0xfb, 0xee, 0x3d, 0x3a, 0xfc, 0xca, 0x74, 0x72, 0xfd, 0x93, 0xb8, 0xb5, 0xff, 0x4f, 0xf2, 0xf2, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xc6, 0xc6, 0xff, 0x3f, 0x6a, 0x69, 0xfd, 0x9c, 0x23, 0x1f, 0xfb, 0xe5, 0x01, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x23, 0x1f, 0xfb, 0xe5, 0x6a, 0x69, 0xfd, 0x9c, 0xc6, 0xc6, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb7, 0xff, 0x4e, 0x4a, 0x47, 0xfc, 0xbe, 0x07, 0x04, 0xfb, 0xfe, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfe, 0x4a, 0x47, 0xfc, 0xbe, 0xba, 0xb7, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xff, 0x35, 0x51, 0x4e, 0xfc, 0xb6, 0x04, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x01, 0xfb, 0xff, 0x51, 0x4e, 0xfc, 0xb6, 0xcf, 0xcf, 0xff, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x08, 0x86, 0x86, 0xfd, 0x81, 0x10, 0x0e, 0xfb, 0xf5, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x10, 0x0e, 0xfb, 0xf5, 0x86, 0x86, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xdd, 0xff, 0x25, 0x49, 0x47, 0xfc, 0xbf, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x49, 0x47, 0xfc, 0xbf, 0xe3, 0xdd, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xff, 0x41, 0x24, 0x22, 0xfc, 0xe2, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x24, 0x22, 0xfc, 0xe2, 0xc4, 0xc4, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb4, 0xff, 0x52, 0x13, 0x11, 0xfb, 0xf2, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xb7, 0xb4, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb3, 0xff, 0x51, 0x0f, 0x0c, 0xfb, 0xf6, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x0f, 0x0c, 0xfb, 0xf6, 0xb7, 0xb3, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xff, 0x40, 0x13, 0x11, 0xfb, 0xf2, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xc7, 0xc7, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe2, 0xff, 0x23, 0x24, 0x20, 0xfb, 0xe4, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x24, 0x20, 0xfb, 0xe4, 0xe2, 0xe2, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x08, 0x49, 0x45, 0xfc, 0xc1, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x49, 0x45, 0xfc, 0xc1, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x86, 0xfd, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x88, 0x86, 0xfd, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xff, 0x32, 0x10, 0x0d, 0xfb, 0xf6, 0x05, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x10, 0x0d, 0xfb, 0xf6, 0xd1, 0xd1, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x51, 0x4f, 0xfc, 0xb9, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x51, 0x4f, 0xfc, 0xb9, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb9, 0xff, 0x4c, 0x04, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x14, 0x10, 0xfb, 0xff, 0x2f, 0x2b, 0xfb, 0xff, 0x4c, 0x49, 0xfc, 0xff, 0x67, 0x64, 0xfc, 0xff, 0x7d, 0x7a, 0xfc, 0xff, 0x8b, 0x88, 0xfd, 0xff, 0x93, 0x91, 0xfc, 0xff, 0x93, 0x90, 0xfc, 0xff, 0x8a, 0x88, 0xfd, 0xff, 0x7c, 0x7a, 0xfc, 0xff, 0x67, 0x64, 0xfc, 0xff, 0x4c, 0x49, 0xfc, 0xff, 0x2f, 0x2b, 0xfb, 0xff, 0x14, 0x10, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x02, 0xfb, 0xff, 0xbc, 0xb9, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x4a, 0x46, 0xfc, 0xc1, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x13, 0x0f, 0xfb, 0xff, 0x45, 0x42, 0xfb, 0xff, 0x83, 0x81, 0xfc, 0xff, 0xbb, 0xba, 0xfd, 0xff, 0xe2, 0xe2, 0xfe, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0xe2, 0xe2, 0xfe, 0xff, 0xba, 0xb9, 0xfe, 0xff, 0x83, 0x81, 0xfd, 0xff, 0x45, 0x42, 0xfc, 0xff, 0x13, 0x0f, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x4a, 0x46, 0xfc, 0xc1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xc9, 0xff, 0x3d, 0x07, 0x04, 0xfb, 0xfd, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x09, 0x05, 0xfb, 0xff, 0x44, 0x41, 0xfb, 0xff, 0x99, 0x98, 0xfd, 0xff, 0xdf, 0xde, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xde, 0xfe, 0xff, 0x98, 0x97, 0xfd, 0xff, 0x43, 0x40, 0xfc, 0xff, 0x08, 0x05, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfd, 0xc9, 0xc9, 0xff, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6a, 0xfd, 0x9d, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x10, 0x0d, 0xfb, 0xff, 0x65, 0x63, 0xfc, 0xff, 0xc9, 0xc8, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc8, 0xc7, 0xfe, 0xff, 0x64, 0x62, 0xfc, 0xff, 0x10, 0x0d, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x6b, 0x6a, 0xfd, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf1, 0xf1, 0xff, 0x12, 0x22, 0x1d, 0xfb, 0xe7, 0x03, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x09, 0x06, 0xfb, 0xff, 0x64, 0x62, 0xfc, 0xff, 0xd5, 0xd5, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd4, 0xd4, 0xfe, 0xff, 0x62, 0x60, 0xfc, 0xff, 0x09, 0x06, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x22, 0x1d, 0xfb, 0xe7, 0xf1, 0xf1, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb7, 0xb7, 0xff, 0x4e, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x3e, 0x3c, 0xfb, 0xff, 0xc3, 0xc2, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc2, 0xc1, 0xfd, 0xff, 0x3e, 0x3b, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0xb7, 0xb7, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0xfd, 0x93, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x0d, 0x0a, 0xfb, 0xff, 0x87, 0x85, 0xfd, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf7, 0xff, 0xff, 0x86, 0x84, 0xfc, 0xff, 0x0c, 0x09, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x72, 0xfd, 0x93, 0x00, 0x00, 0x00, 0x00, 
-  0xff, 0xff, 0xff, 0x03, 0x3e, 0x3a, 0xfc, 0xcb, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x29, 0x27, 0xfb, 0xff, 0xc2, 0xc1, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc1, 0xc0, 0xfe, 0xff, 0x28, 0x26, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x3e, 0x3a, 0xfc, 0xcb, 0xff, 0xff, 0xff, 0x03, 
-  0xeb, 0xeb, 0xff, 0x19, 0x1a, 0x15, 0xfb, 0xef, 0x04, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x47, 0x44, 0xfc, 0xff, 0xe5, 0xe4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xf4, 0xf4, 0xfe, 0xff, 0xf4, 0xf4, 0xfe, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe3, 0xfe, 0xff, 0x45, 0x43, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x1a, 0x15, 0xfb, 0xef, 0xeb, 0xeb, 0xff, 0x19, 
-  0xcd, 0xcd, 0xff, 0x38, 0x07, 0x03, 0xfb, 0xfe, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x5c, 0x59, 0xfc, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xd7, 0xd6, 0xfe, 0xff, 0xa5, 0xa4, 0xfd, 0xff, 0x76, 0x74, 0xfc, 0xff, 0x52, 0x4f, 0xfc, 0xff, 0x39, 0x36, 0xfb, 0xff, 0x2b, 0x27, 0xfb, 0xff, 0x25, 0x21, 0xfb, 0xff, 0x25, 0x21, 0xfb, 0xff, 0x2b, 0x27, 0xfb, 0xff, 0x3a, 0x36, 0xfb, 0xff, 0x52, 0x50, 0xfc, 0xff, 0x77, 0x75, 0xfc, 0xff, 0xa6, 0xa5, 0xfd, 0xff, 0xd7, 0xd7, 0xfe, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf3, 0xff, 0xff, 0x59, 0x57, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xfe, 0xcd, 0xcd, 0xff, 0x38, 
-  0xaf, 0xaf, 0xff, 0x56, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x5e, 0x5b, 0xfc, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x9b, 0x99, 0xfd, 0xff, 0x34, 0x33, 0xfb, 0xff, 0x0d, 0x09, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x0d, 0x09, 0xfb, 0xff, 0x35, 0x33, 0xfb, 0xff, 0x9d, 0x9b, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0x5a, 0x57, 0xfc, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0xaf, 0xaf, 0xff, 0x56, 
-  0x9a, 0x98, 0xfd, 0x6a, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x1e, 0x1a, 0xfb, 0xff, 0xeb, 0xeb, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x59, 0x56, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x5b, 0x58, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xea, 0xe9, 0xfe, 0xff, 0x1c, 0x18, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x9a, 0x98, 0xfd, 0x6a, 
-  0x74, 0x71, 0xfc, 0xc2, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x48, 0x44, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x79, 0x76, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x7b, 0x78, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x42, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x71, 0xfc, 0xc2, 
-  0x19, 0x14, 0xfc, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x33, 0x2e, 0xfb, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x92, 0x90, 0xfd, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x94, 0x91, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0x31, 0x2d, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x19, 0x14, 0xfc, 0xff, 
-  0x19, 0x14, 0xfc, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x02, 0xfb, 0xff, 0xb0, 0xae, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xa9, 0xfd, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0xab, 0xaa, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb0, 0xae, 0xfd, 0xff, 0x04, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x19, 0x14, 0xfc, 0xff, 
-  0x74, 0x71, 0xfc, 0xc2, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x31, 0x2d, 0xfb, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xbf, 0xfe, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0xc1, 0xc0, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0x31, 0x2d, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x71, 0xfc, 0xc2, 
-  0x9a, 0x98, 0xfd, 0x6a, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x8f, 0x8d, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xac, 0xaa, 0xfd, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0xad, 0xac, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x8d, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x9a, 0x98, 0xfd, 0x6a, 
-  0xaf, 0xaf, 0xff, 0x56, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x1b, 0x18, 0xfb, 0xff, 0xe4, 0xe4, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xf6, 0xff, 0xff, 0x41, 0x3e, 0xfc, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x42, 0x3f, 0xfb, 0xff, 0xf7, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0xe4, 0xfe, 0xff, 0x1b, 0x17, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0xaf, 0xaf, 0xff, 0x56, 
-  0xcd, 0xcd, 0xff, 0x38, 0x07, 0x03, 0xfb, 0xfe, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x6d, 0x6a, 0xfc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xb7, 0xb6, 0xfe, 0xff, 0x43, 0x41, 0xfc, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x45, 0x43, 0xfc, 0xff, 0xbb, 0xba, 0xfd, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x6d, 0x6a, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xfe, 0xcd, 0xcd, 0xff, 0x38, 
-  0xeb, 0xeb, 0xff, 0x19, 0x1a, 0x15, 0xfb, 0xef, 0x04, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x0c, 0x09, 0xfb, 0xff, 0xce, 0xcd, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe3, 0xe3, 0xfe, 0xff, 0x8f, 0x8e, 0xfd, 0xff, 0x33, 0x31, 0xfc, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x36, 0x33, 0xfb, 0xff, 0x91, 0x90, 0xfd, 0xff, 0xe4, 0xe3, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xce, 0xcd, 0xfe, 0xff, 0x0c, 0x09, 0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x1a, 0x15, 0xfb, 0xef, 0xeb, 0xeb, 0xff, 0x19, 
-  0xff, 0xff, 0xff, 0x03, 0x3e, 0x3a, 0xfc, 0xcb, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x48, 0x45, 0xfb, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xc5, 0xc4, 0xfe, 0xff, 0x66, 0x64, 0xfc, 0xff, 0x18, 0x15, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x19, 0x15, 0xfb, 0xff, 0x68, 0x66, 0xfc, 0xff, 0xc6, 0xc5, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0x48, 0x44, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x3e, 0x3a, 0xfc, 0xcb, 0xff, 0xff, 0xff, 0x03, 
-  0x00, 0x00, 0x00, 0x00, 0x74, 0x72, 0xfd, 0x93, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x4f, 0x4c, 0xfc, 0xff, 0xbb, 0xb9, 0xfd, 0xff, 0xd1, 0xd0, 0xfe, 0xff, 0x9e, 0x9c, 0xfd, 0xff, 0x41, 0x3e, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xff, 0x42, 0x3f, 0xfc, 0xff, 0x9f, 0x9d, 0xfd, 0xff, 0xd2, 0xd1, 0xfe, 0xff, 0xbc, 0xbb, 0xfd, 0xff, 0x4f, 0x4c, 0xfc, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x72, 0xfd, 0x93, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xb7, 0xb7, 0xff, 0x4e, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x09, 0x05, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x0a, 0x05, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0xb7, 0xb7, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0xf1, 0xf1, 0xff, 0x12, 0x22, 0x1d, 0xfb, 0xe7, 0x03, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x22, 0x1d, 0xfb, 0xe7, 0xf1, 0xf1, 0xff, 0x12, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6b, 0x6a, 0xfd, 0x9d, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x6b, 0x6a, 0xfd, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc9, 0xc9, 0xff, 0x3d, 0x07, 0x04, 0xfb, 0xfd, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfd, 0xc9, 0xc9, 0xff, 0x3d, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x4a, 0x46, 0xfc, 0xc1, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x4a, 0x46, 0xfc, 0xc1, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbc, 0xb9, 0xff, 0x4c, 0x04, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x02, 0xfb, 0xff, 0xbc, 0xb9, 0xff, 0x4c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x02, 0x51, 0x4f, 0xfc, 0xb9, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x51, 0x4f, 0xfc, 0xb9, 0xff, 0xff, 0xff, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xd1, 0xd1, 0xff, 0x32, 0x10, 0x0d, 0xfb, 0xf6, 0x05, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x10, 0x0d, 0xfb, 0xf6, 0xd1, 0xd1, 0xff, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x86, 0xfd, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x88, 0x86, 0xfd, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x08, 0x49, 0x45, 0xfc, 0xc1, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x49, 0x45, 0xfc, 0xc1, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe2, 0xe2, 0xff, 0x23, 0x24, 0x20, 0xfb, 0xe4, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x24, 0x20, 0xfb, 0xe4, 0xe2, 0xe2, 0xff, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc7, 0xc7, 0xff, 0x40, 0x13, 0x11, 0xfb, 0xf2, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xc7, 0xc7, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb3, 0xff, 0x51, 0x0f, 0x0c, 0xfb, 0xf6, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x0f, 0x0c, 0xfb, 0xf6, 0xb7, 0xb3, 0xff, 0x51, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xb7, 0xb4, 0xff, 0x52, 0x13, 0x11, 0xfb, 0xf2, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xb7, 0xb4, 0xff, 0x52, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc4, 0xc4, 0xff, 0x41, 0x24, 0x22, 0xfc, 0xe2, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x24, 0x22, 0xfc, 0xe2, 0xc4, 0xc4, 0xff, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xe3, 0xdd, 0xff, 0x25, 0x49, 0x47, 0xfc, 0xbf, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x49, 0x47, 0xfc, 0xbf, 0xe3, 0xdd, 0xff, 0x25, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x08, 0x86, 0x86, 0xfd, 0x81, 0x10, 0x0e, 0xfb, 0xf5, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x10, 0x0e, 0xfb, 0xf5, 0x86, 0x86, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xcf, 0xff, 0x35, 0x51, 0x4e, 0xfc, 0xb6, 0x04, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x01, 0xfb, 0xff, 0x51, 0x4e, 0xfc, 0xb6, 0xcf, 0xcf, 0xff, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xba, 0xb7, 0xff, 0x4e, 0x4a, 0x47, 0xfc, 0xbe, 0x07, 0x04, 0xfb, 0xfe, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfe, 0x4a, 0x47, 0xfc, 0xbe, 0xba, 0xb7, 0xff, 0x4e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xc6, 0xc6, 0xff, 0x3f, 0x6a, 0x69, 0xfd, 0x9c, 0x23, 0x1f, 0xfb, 0xe5, 0x01, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x23, 0x1f, 0xfb, 0xe5, 0x6a, 0x69, 0xfd, 0x9c, 0xc6, 0xc6, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf2, 0xf2, 0xff, 0x14, 0xb5, 0xb5, 0xff, 0x4f, 0x74, 0x72, 0xfd, 0x93, 0x3d, 0x3a, 0xfc, 0xca, 0x1a, 0x17, 0xfb, 0xee, 0x07, 0x03, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xff, 0x1a, 0x17, 0xfb, 0xee, 0x3d, 0x3a, 0xfc, 0xca, 0x74, 0x72, 0xfd, 0x93, 0xb5, 0xb5, 0xff, 0x4f, 0xf2, 0xf2, 0xff, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x01, 0xeb, 0xeb, 0xff, 0x19, 0xcd, 0xcd, 0xff, 0x38, 0xaf, 0xaf, 0xff, 0x56, 0x98, 0x95, 0xfd, 0x6f, 0x74, 0x72, 0xfc, 0xc1, 0x18, 0x14, 0xfc, 0xff, 0x18, 0x14, 0xfc, 0xff, 0x74, 0x72, 0xfc, 0xc1, 0x98, 0x95, 0xfd, 0x6f, 0xaf, 0xaf, 0xff, 0x56, 0xcd, 0xcd, 0xff, 0x38, 0xeb, 0xeb, 0xff, 0x19, 0xff, 0xff, 0xff, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
+  0x96, 0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xff, 0xff, 0x01, 0xeb, 0xeb, 0xff, 0x19, 0xcd, 0xcd, 0xff, 0x38, 0xaf, 0xaf, 0xff, 0x56, 0x98, 0x95, 0xfd, 0x6f, 0x74, 0x72, 0xfc, 0xc1, 0x81, 0x19, 
+  0x14, 0xfc, 0xff, 0x05, 0x74, 0x72, 0xfc, 0xc1, 0x98, 0x95, 0xfd, 0x6f, 0xaf, 0xaf, 0xff, 0x56, 0xcd, 0xcd, 0xff, 0x38, 0xeb, 0xeb, 0xff, 0x19, 0xff, 0xff, 0xff, 0x01, 0xaa, 0x00, 0x00, 0x00, 
+  0x00, 0x05, 0xf2, 0xf2, 0xff, 0x14, 0xb8, 0xb5, 0xff, 0x4f, 0x74, 0x72, 0xfd, 0x93, 0x3d, 0x3a, 0xfc, 0xca, 0x1a, 0x17, 0xfb, 0xee, 0x07, 0x03, 0xfb, 0xff, 0x82, 0x00, 0x00, 0xfb, 0xff, 0x81, 
+  0x05, 0x00, 0xfb, 0xff, 0x82, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x07, 0x03, 0xfb, 0xff, 0x1a, 0x17, 0xfb, 0xee, 0x3d, 0x3a, 0xfc, 0xca, 0x74, 0x72, 0xfd, 0x93, 0xb8, 0xb5, 0xff, 0x4f, 0xf2, 0xf2, 
+  0xff, 0x14, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01, 0xc6, 0xc6, 0xff, 0x3f, 0x6a, 0x69, 0xfd, 0x9c, 0x23, 0x1f, 0xfb, 0xe5, 0x01, 0x00, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 
+  0xff, 0x01, 0x04, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x87, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x01, 0x00, 
+  0xfb, 0xff, 0x23, 0x1f, 0xfb, 0xe5, 0x6a, 0x69, 0xfd, 0x9c, 0xc6, 0xc6, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x01, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xba, 0xb7, 0xff, 0x4e, 0x4a, 0x47, 0xfc, 0xbe, 
+  0x07, 0x04, 0xfb, 0xfe, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x91, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfe, 0x4a, 0x47, 
+  0xfc, 0xbe, 0xba, 0xb7, 0xff, 0x4e, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xcf, 0xcf, 0xff, 0x35, 0x51, 0x4e, 0xfc, 0xb6, 0x04, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 
+  0x95, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x01, 0xfb, 0xff, 0x51, 0x4e, 0xfc, 0xb6, 0xcf, 0xcf, 0xff, 0x35, 0x99, 0x00, 0x00, 0x00, 0x00, 0x04, 
+  0xff, 0xff, 0xff, 0x08, 0x86, 0x86, 0xfd, 0x81, 0x10, 0x0e, 0xfb, 0xf5, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x99, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 
+  0xfb, 0xff, 0x10, 0x0e, 0xfb, 0xf5, 0x86, 0x86, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x08, 0x96, 0x00, 0x00, 0x00, 0x00, 0x03, 0xe3, 0xdd, 0xff, 0x25, 0x49, 0x47, 0xfc, 0xbf, 0x00, 0x00, 0xfb, 0xff, 
+  0x04, 0x00, 0xfb, 0xff, 0x9d, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x49, 0x47, 0xfc, 0xbf, 0xe3, 0xdd, 0xff, 0x25, 0x94, 0x00, 0x00, 0x00, 0x00, 0x02, 
+  0xc4, 0xc4, 0xff, 0x41, 0x24, 0x22, 0xfc, 0xe2, 0x00, 0x00, 0xfb, 0xff, 0xa1, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x24, 0x22, 0xfc, 0xe2, 0xc4, 0xc4, 0xff, 0x41, 0x92, 0x00, 
+  0x00, 0x00, 0x00, 0x02, 0xb7, 0xb4, 0xff, 0x52, 0x13, 0x11, 0xfb, 0xf2, 0x01, 0x00, 0xfb, 0xff, 0xa3, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x01, 0x00, 0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xb7, 0xb4, 
+  0xff, 0x52, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xb3, 0xff, 0x51, 0x0f, 0x0c, 0xfb, 0xf6, 0x02, 0x00, 0xfb, 0xff, 0xa5, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x02, 0x00, 0xfb, 0xff, 0x0f, 0x0c, 
+  0xfb, 0xf6, 0xb7, 0xb3, 0xff, 0x51, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xc7, 0xff, 0x40, 0x13, 0x11, 0xfb, 0xf2, 0x02, 0x00, 0xfb, 0xff, 0xa7, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x02, 0x00, 
+  0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xc7, 0xc7, 0xff, 0x40, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe2, 0xe2, 0xff, 0x23, 0x24, 0x20, 0xfb, 0xe4, 0x01, 0x00, 0xfb, 0xff, 0xa9, 0x07, 0x02, 0xfb, 
+  0xff, 0x02, 0x01, 0x00, 0xfb, 0xff, 0x24, 0x20, 0xfb, 0xe4, 0xe2, 0xe2, 0xff, 0x23, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x08, 0x49, 0x45, 0xfc, 0xc1, 0x00, 0x00, 0xfb, 0xff, 
+  0xab, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x49, 0x45, 0xfc, 0xc1, 0xff, 0xff, 0xff, 0x08, 0x89, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x86, 0xfd, 0x81, 0x00, 0x00, 0xfb, 0xff, 
+  0xad, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x88, 0x86, 0xfd, 0x81, 0x88, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd1, 0xd1, 0xff, 0x32, 0x10, 0x0d, 0xfb, 0xf6, 0x05, 0x01, 0xfb, 0xff, 
+  0xad, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x05, 0x01, 0xfb, 0xff, 0x10, 0x0d, 0xfb, 0xf6, 0xd1, 0xd1, 0xff, 0x32, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x02, 0x51, 0x4f, 0xfc, 0xb9, 
+  0x00, 0x00, 0xfb, 0xff, 0x90, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x05, 0x00, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x89, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x02, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 
+  0x90, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x51, 0x4f, 0xfc, 0xb9, 0xff, 0xff, 0xff, 0x02, 0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbc, 0xb9, 0xff, 0x4c, 0x04, 0x02, 0xfb, 0xff, 
+  0x06, 0x01, 0xfb, 0xff, 0x8c, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x05, 0x00, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x0f, 0x02, 0x00, 0xfb, 0xff, 0x14, 0x10, 0xfb, 0xff, 0x2f, 0x2b, 0xfb, 0xff, 
+  0x4c, 0x49, 0xfc, 0xff, 0x67, 0x64, 0xfc, 0xff, 0x7d, 0x7a, 0xfc, 0xff, 0x8b, 0x88, 0xfd, 0xff, 0x93, 0x91, 0xfc, 0xff, 0x93, 0x90, 0xfc, 0xff, 0x8a, 0x88, 0xfd, 0xff, 0x7c, 0x7a, 0xfc, 0xff, 
+  0x67, 0x64, 0xfc, 0xff, 0x4c, 0x49, 0xfc, 0xff, 0x2f, 0x2b, 0xfb, 0xff, 0x14, 0x10, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x05, 0x00, 0xfb, 0xff, 0x8c, 0x07, 
+  0x02, 0xfb, 0xff, 0x02, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x02, 0xfb, 0xff, 0xbc, 0xb9, 0xff, 0x4c, 0x84, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x03, 0x4a, 0x46, 0xfc, 0xc1, 0x00, 0x00, 
+  0xfb, 0xff, 0x8a, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x06, 0x01, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x13, 0x0f, 0xfb, 0xff, 0x45, 0x42, 0xfb, 0xff, 0x83, 0x81, 0xfc, 0xff, 0xbb, 0xba, 
+  0xfd, 0xff, 0xe2, 0xe2, 0xfe, 0xff, 0xf9, 0xf9, 0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x05, 0xf9, 0xf9, 0xff, 0xff, 0xe2, 0xe2, 0xfe, 0xff, 0xba, 0xb9, 0xfe, 0xff, 0x83, 0x81, 0xfd, 0xff, 
+  0x45, 0x42, 0xfc, 0xff, 0x13, 0x0f, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x06, 0x01, 0xfb, 0xff, 0x8a, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x4a, 0x46, 0xfc, 0xc1, 
+  0xff, 0xff, 0xff, 0x03, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc9, 0xc9, 0xff, 0x3d, 0x07, 0x04, 0xfb, 0xfd, 0x06, 0x01, 0xfb, 0xff, 0x88, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x05, 0x00, 0xfb, 0xff, 
+  0x00, 0x00, 0xfb, 0xff, 0x09, 0x05, 0xfb, 0xff, 0x44, 0x41, 0xfb, 0xff, 0x99, 0x98, 0xfd, 0xff, 0xdf, 0xde, 0xfe, 0xff, 0x93, 0xff, 0xff, 0xff, 0xff, 0x05, 0xde, 0xde, 0xfe, 0xff, 0x98, 0x97, 
+  0xfd, 0xff, 0x43, 0x40, 0xfc, 0xff, 0x08, 0x05, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x88, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfd, 
+  0xc9, 0xc9, 0xff, 0x3d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6b, 0x6a, 0xfd, 0x9d, 0x00, 0x00, 0xfb, 0xff, 0x87, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 
+  0x10, 0x0d, 0xfb, 0xff, 0x65, 0x63, 0xfc, 0xff, 0xc9, 0xc8, 0xfd, 0xff, 0x99, 0xff, 0xff, 0xff, 0xff, 0x04, 0xc8, 0xc7, 0xfe, 0xff, 0x64, 0x62, 0xfc, 0xff, 0x10, 0x0d, 0xfb, 0xff, 0x00, 0x00, 
+  0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x87, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x6b, 0x6a, 0xfd, 0x9d, 0x82, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xf1, 0xff, 0x12, 0x22, 0x1d, 
+  0xfb, 0xe7, 0x03, 0x00, 0xfb, 0xff, 0x86, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0x00, 0xfb, 0xff, 0x09, 0x06, 0xfb, 0xff, 0x64, 0x62, 0xfc, 0xff, 0xd5, 0xd5, 0xfe, 0xff, 0x9d, 0xff, 0xff, 0xff, 
+  0xff, 0x03, 0xd4, 0xd4, 0xfe, 0xff, 0x62, 0x60, 0xfc, 0xff, 0x09, 0x06, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x86, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x03, 0x00, 0xfb, 0xff, 0x22, 0x1d, 0xfb, 0xe7, 
+  0xf1, 0xf1, 0xff, 0x12, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb7, 0xb7, 0xff, 0x4e, 0x02, 0x00, 0xfb, 0xff, 0x85, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x05, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 
+  0x3e, 0x3c, 0xfb, 0xff, 0xc3, 0xc2, 0xfe, 0xff, 0xa1, 0xff, 0xff, 0xff, 0xff, 0x03, 0xc2, 0xc1, 0xfd, 0xff, 0x3e, 0x3b, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x05, 0x00, 0xfb, 0xff, 0x85, 0x07, 
+  0x02, 0xfb, 0xff, 0x01, 0x02, 0x00, 0xfb, 0xff, 0xb7, 0xb7, 0xff, 0x4e, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0x74, 0x72, 0xfd, 0x93, 0x00, 0x00, 0xfb, 0xff, 0x84, 0x07, 0x02, 0xfb, 0xff, 0x03, 
+  0x01, 0x00, 0xfb, 0xff, 0x0d, 0x0a, 0xfb, 0xff, 0x87, 0x85, 0xfd, 0xff, 0xf8, 0xf8, 0xff, 0xff, 0xa3, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf8, 0xf7, 0xff, 0xff, 0x86, 0x84, 0xfc, 0xff, 0x0c, 0x09, 
+  0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x84, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x72, 0xfd, 0x93, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0x03, 0x3e, 0x3a, 0xfc, 0xcb, 
+  0x01, 0x00, 0xfb, 0xff, 0x83, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x29, 0x27, 0xfb, 0xff, 0xc2, 0xc1, 0xfd, 0xff, 0xa7, 0xff, 0xff, 0xff, 0xff, 0x02, 0xc1, 0xc0, 0xfe, 0xff, 
+  0x28, 0x26, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x83, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0x00, 0xfb, 0xff, 0x3e, 0x3a, 0xfc, 0xcb, 0xff, 0xff, 0xff, 0x03, 0xeb, 0xeb, 0xff, 0x19, 0x1a, 0x15, 
+  0xfb, 0xef, 0x04, 0x00, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x47, 0x44, 0xfc, 0xff, 0xe5, 0xe4, 0xfe, 0xff, 0x91, 0xff, 0xff, 0xff, 0xff, 0x01, 0xfe, 0xfe, 
+  0xff, 0xff, 0xf7, 0xf7, 0xff, 0xff, 0x81, 0xf4, 0xf4, 0xfe, 0xff, 0x00, 0xf7, 0xf7, 0xff, 0xff, 0x92, 0xff, 0xff, 0xff, 0xff, 0x02, 0xe4, 0xe3, 0xfe, 0xff, 0x45, 0x43, 0xfb, 0xff, 0x00, 0x00, 
+  0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x04, 0x00, 0xfb, 0xff, 0x1a, 0x15, 0xfb, 0xef, 0xeb, 0xeb, 0xff, 0x19, 0xcd, 0xcd, 0xff, 0x38, 0x07, 0x03, 0xfb, 0xfe, 0x06, 0x01, 0xfb, 0xff, 
+  0x81, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x5c, 0x59, 0xfc, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfc, 0xfc, 0xff, 0xff, 0xd7, 0xd6, 0xfe, 0xff, 
+  0xa5, 0xa4, 0xfd, 0xff, 0x76, 0x74, 0xfc, 0xff, 0x52, 0x4f, 0xfc, 0xff, 0x39, 0x36, 0xfb, 0xff, 0x2b, 0x27, 0xfb, 0xff, 0x81, 0x25, 0x21, 0xfb, 0xff, 0x06, 0x2b, 0x27, 0xfb, 0xff, 0x3a, 0x36, 
+  0xfb, 0xff, 0x52, 0x50, 0xfc, 0xff, 0x77, 0x75, 0xfc, 0xff, 0xa6, 0xa5, 0xfd, 0xff, 0xd7, 0xd7, 0xfe, 0xff, 0xfc, 0xfc, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf4, 0xf3, 0xff, 0xff, 
+  0x59, 0x57, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x81, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xfe, 0xcd, 0xcd, 0xff, 0x38, 0xaf, 0xaf, 0xff, 0x56, 0x00, 0x00, 
+  0xfb, 0xff, 0x81, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x01, 0x00, 0xfb, 0xff, 0x5e, 0x5b, 0xfc, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x02, 0x9b, 0x99, 0xfd, 0xff, 0x34, 0x33, 
+  0xfb, 0xff, 0x0d, 0x09, 0xfb, 0xff, 0x82, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x01, 0x00, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x81, 0x03, 0x00, 0xfb, 0xff, 0x01, 0x02, 0x00, 0xfb, 0xff, 0x01, 0x00, 
+  0xfb, 0xff, 0x82, 0x00, 0x00, 0xfb, 0xff, 0x02, 0x0d, 0x09, 0xfb, 0xff, 0x35, 0x33, 0xfb, 0xff, 0x9d, 0x9b, 0xfd, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf8, 0xf8, 0xff, 0xff, 0x5a, 0x57, 
+  0xfc, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x81, 0x07, 0x02, 0xfb, 0xff, 0x07, 0x00, 0x00, 0xfb, 0xff, 0xaf, 0xaf, 0xff, 0x56, 0x9a, 0x98, 0xfd, 0x6a, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 
+  0x04, 0x00, 0xfb, 0xff, 0x1e, 0x1a, 0xfb, 0xff, 0xeb, 0xeb, 0xfe, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x02, 0x59, 0x56, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x8b, 0x07, 
+  0x02, 0xfb, 0xff, 0x02, 0x06, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x5b, 0x58, 0xfc, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x0a, 0xea, 0xe9, 0xfe, 0xff, 0x1c, 0x18, 0xfb, 0xff, 0x04, 0x00, 
+  0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x9a, 0x98, 0xfd, 0x6a, 0x74, 0x71, 0xfc, 0xc2, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x48, 0x44, 
+  0xfc, 0xff, 0x8f, 0xff, 0xff, 0xff, 0xff, 0x01, 0x79, 0x76, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x8d, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x7b, 0x78, 0xfc, 0xff, 0x8f, 0xff, 
+  0xff, 0xff, 0xff, 0x0a, 0x46, 0x42, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x71, 0xfc, 0xc2, 0x19, 0x14, 0xfc, 0xff, 0x05, 0x01, 0xfb, 0xff, 
+  0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x33, 0x2e, 0xfb, 0xff, 0xfb, 0xfb, 0xff, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x01, 0x92, 0x90, 0xfd, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x8d, 0x07, 
+  0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x94, 0x91, 0xfd, 0xff, 0x8e, 0xff, 0xff, 0xff, 0xff, 0x04, 0xfb, 0xfb, 0xff, 0xff, 0x31, 0x2d, 0xfb, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x07, 0x02, 
+  0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x81, 0x19, 0x14, 0xfc, 0xff, 0x04, 0x05, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x02, 0xfb, 0xff, 0xb0, 0xae, 0xfd, 0xff, 
+  0x8e, 0xff, 0xff, 0xff, 0xff, 0x01, 0xaa, 0xa9, 0xfd, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x8d, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0xab, 0xaa, 0xfd, 0xff, 0x8e, 0xff, 0xff, 0xff, 
+  0xff, 0x07, 0xb0, 0xae, 0xfd, 0xff, 0x04, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x19, 0x14, 0xfc, 0xff, 0x74, 0x71, 0xfc, 0xc2, 0x00, 0x00, 
+  0xfb, 0xff, 0x81, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x02, 0x00, 0xfb, 0xff, 0x31, 0x2d, 0xfb, 0xff, 0xf4, 0xf4, 0xff, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xc0, 0xbf, 0xfe, 0xff, 0x03, 0x00, 
+  0xfb, 0xff, 0x8d, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x03, 0x00, 0xfb, 0xff, 0xc1, 0xc0, 0xfe, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf4, 0xf4, 0xff, 0xff, 0x31, 0x2d, 0xfb, 0xff, 0x02, 0x00, 
+  0xfb, 0xff, 0x81, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x71, 0xfc, 0xc2, 0x9a, 0x98, 0xfd, 0x6a, 0x00, 0x00, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 
+  0xfb, 0xff, 0x8f, 0x8d, 0xfd, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0xac, 0xaa, 0xfd, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x8d, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x01, 0x00, 0xfb, 0xff, 0xad, 0xac, 
+  0xfd, 0xff, 0x8d, 0xff, 0xff, 0xff, 0xff, 0x01, 0x90, 0x8d, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x00, 0x00, 0xfb, 0xff, 0x9a, 0x98, 0xfd, 0x6a, 0xaf, 0xaf, 
+  0xff, 0x56, 0x00, 0x00, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x04, 0x00, 0xfb, 0xff, 0x1b, 0x18, 0xfb, 0xff, 0xe4, 0xe4, 0xfe, 0xff, 0x8b, 0xff, 0xff, 0xff, 0xff, 0x02, 0xf6, 0xf6, 
+  0xff, 0xff, 0x41, 0x3e, 0xfc, 0xff, 0x02, 0x00, 0xfb, 0xff, 0x8d, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x02, 0x00, 0xfb, 0xff, 0x42, 0x3f, 0xfb, 0xff, 0xf7, 0xf6, 0xff, 0xff, 0x8b, 0xff, 0xff, 0xff, 
+  0xff, 0x02, 0xe4, 0xe4, 0xfe, 0xff, 0x1b, 0x17, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x00, 0x00, 0xfb, 0xff, 0xaf, 0xaf, 0xff, 0x56, 0xcd, 0xcd, 0xff, 0x38, 
+  0x07, 0x03, 0xfb, 0xfe, 0x06, 0x01, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x6d, 0x6a, 0xfc, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x03, 0xf8, 0xf8, 0xff, 0xff, 
+  0xb7, 0xb6, 0xfe, 0xff, 0x43, 0x41, 0xfc, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x8f, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x01, 0x00, 0xfb, 0xff, 0x45, 0x43, 0xfc, 0xff, 0xbb, 0xba, 0xfd, 0xff, 0xfa, 0xfa, 
+  0xff, 0xff, 0x89, 0xff, 0xff, 0xff, 0xff, 0x01, 0x6d, 0x6a, 0xfc, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xfe, 0xcd, 0xcd, 
+  0xff, 0x38, 0xeb, 0xeb, 0xff, 0x19, 0x1a, 0x15, 0xfb, 0xef, 0x04, 0x00, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x05, 0x01, 0xfb, 0xff, 0x0c, 0x09, 0xfb, 0xff, 0xce, 0xcd, 0xfe, 0xff, 
+  0x86, 0xff, 0xff, 0xff, 0xff, 0x04, 0xe3, 0xe3, 0xfe, 0xff, 0x8f, 0x8e, 0xfd, 0xff, 0x33, 0x31, 0xfc, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x91, 0x07, 0x02, 0xfb, 0xff, 0x04, 
+  0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x36, 0x33, 0xfb, 0xff, 0x91, 0x90, 0xfd, 0xff, 0xe4, 0xe3, 0xfe, 0xff, 0x86, 0xff, 0xff, 0xff, 0xff, 0x02, 0xce, 0xcd, 0xfe, 0xff, 0x0c, 0x09, 
+  0xfb, 0xff, 0x05, 0x01, 0xfb, 0xff, 0x82, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x04, 0x00, 0xfb, 0xff, 0x1a, 0x15, 0xfb, 0xef, 0xeb, 0xeb, 0xff, 0x19, 0xff, 0xff, 0xff, 0x03, 0x3e, 0x3a, 0xfc, 0xcb, 
+  0x01, 0x00, 0xfb, 0xff, 0x83, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x48, 0x45, 0xfb, 0xff, 0xfa, 0xfa, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x06, 0xfe, 0xfe, 0xff, 0xff, 
+  0xc5, 0xc4, 0xfe, 0xff, 0x66, 0x64, 0xfc, 0xff, 0x18, 0x15, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x07, 0x01, 0xfb, 0xff, 0x93, 0x07, 0x02, 0xfb, 0xff, 0x06, 0x06, 0x01, 
+  0xfb, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x19, 0x15, 0xfb, 0xff, 0x68, 0x66, 0xfc, 0xff, 0xc6, 0xc5, 0xfe, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0x82, 0xff, 0xff, 0xff, 0xff, 0x02, 
+  0xfa, 0xfa, 0xff, 0xff, 0x48, 0x44, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x83, 0x07, 0x02, 0xfb, 0xff, 0x05, 0x01, 0x00, 0xfb, 0xff, 0x3e, 0x3a, 0xfc, 0xcb, 0xff, 0xff, 0xff, 0x03, 0x00, 0x00, 
+  0x00, 0x00, 0x74, 0x72, 0xfd, 0x93, 0x00, 0x00, 0xfb, 0xff, 0x84, 0x07, 0x02, 0xfb, 0xff, 0x08, 0x01, 0x00, 0xfb, 0xff, 0x4f, 0x4c, 0xfc, 0xff, 0xbb, 0xb9, 0xfd, 0xff, 0xd1, 0xd0, 0xfe, 0xff, 
+  0x9e, 0x9c, 0xfd, 0xff, 0x41, 0x3e, 0xfb, 0xff, 0x07, 0x03, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x99, 0x07, 0x02, 0xfb, 0xff, 0x08, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 
+  0xfb, 0xff, 0x07, 0x03, 0xfb, 0xff, 0x42, 0x3f, 0xfc, 0xff, 0x9f, 0x9d, 0xfd, 0xff, 0xd2, 0xd1, 0xfe, 0xff, 0xbc, 0xbb, 0xfd, 0xff, 0x4f, 0x4c, 0xfc, 0xff, 0x01, 0x00, 0xfb, 0xff, 0x84, 0x07, 
+  0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x74, 0x72, 0xfd, 0x93, 0x81, 0x00, 0x00, 0x00, 0x00, 0x01, 0xb7, 0xb7, 0xff, 0x4e, 0x02, 0x00, 0xfb, 0xff, 0x85, 0x07, 0x02, 0xfb, 0xff, 0x02, 
+  0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x09, 0x05, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x00, 0x06, 0x01, 0xfb, 0xff, 0x9d, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x06, 0x01, 0xfb, 0xff, 
+  0x81, 0x00, 0x00, 0xfb, 0xff, 0x02, 0x0a, 0x05, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x85, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x02, 0x00, 0xfb, 0xff, 0xb7, 0xb7, 0xff, 0x4e, 
+  0x81, 0x00, 0x00, 0x00, 0x00, 0x02, 0xf1, 0xf1, 0xff, 0x12, 0x22, 0x1d, 0xfb, 0xe7, 0x03, 0x00, 0xfb, 0xff, 0x86, 0x07, 0x02, 0xfb, 0xff, 0x00, 0x06, 0x01, 0xfb, 0xff, 0xa3, 0x07, 0x02, 0xfb, 
+  0xff, 0x00, 0x06, 0x01, 0xfb, 0xff, 0x86, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x03, 0x00, 0xfb, 0xff, 0x22, 0x1d, 0xfb, 0xe7, 0xf1, 0xf1, 0xff, 0x12, 0x82, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6b, 0x6a, 
+  0xfd, 0x9d, 0x00, 0x00, 0xfb, 0xff, 0xb3, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 0x6b, 0x6a, 0xfd, 0x9d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc9, 0xc9, 0xff, 0x3d, 0x07, 0x04, 
+  0xfb, 0xfd, 0x06, 0x01, 0xfb, 0xff, 0xb1, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x06, 0x01, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfd, 0xc9, 0xc9, 0xff, 0x3d, 0x83, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 
+  0xff, 0x03, 0x4a, 0x46, 0xfc, 0xc1, 0x00, 0x00, 0xfb, 0xff, 0xb1, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x4a, 0x46, 0xfc, 0xc1, 0xff, 0xff, 0xff, 0x03, 0x84, 0x00, 0x00, 0x00, 
+  0x00, 0x02, 0xbc, 0xb9, 0xff, 0x4c, 0x04, 0x02, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0xaf, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x02, 0xfb, 0xff, 0xbc, 0xb9, 0xff, 0x4c, 
+  0x85, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x02, 0x51, 0x4f, 0xfc, 0xb9, 0x00, 0x00, 0xfb, 0xff, 0xaf, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x51, 0x4f, 0xfc, 0xb9, 
+  0xff, 0xff, 0xff, 0x02, 0x86, 0x00, 0x00, 0x00, 0x00, 0x02, 0xd1, 0xd1, 0xff, 0x32, 0x10, 0x0d, 0xfb, 0xf6, 0x05, 0x01, 0xfb, 0xff, 0xad, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x05, 0x01, 0xfb, 0xff, 
+  0x10, 0x0d, 0xfb, 0xf6, 0xd1, 0xd1, 0xff, 0x32, 0x88, 0x00, 0x00, 0x00, 0x00, 0x01, 0x88, 0x86, 0xfd, 0x81, 0x00, 0x00, 0xfb, 0xff, 0xad, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x00, 0x00, 0xfb, 0xff, 
+  0x88, 0x86, 0xfd, 0x81, 0x89, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xff, 0xff, 0x08, 0x49, 0x45, 0xfc, 0xc1, 0x00, 0x00, 0xfb, 0xff, 0xab, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 
+  0x49, 0x45, 0xfc, 0xc1, 0xff, 0xff, 0xff, 0x08, 0x8a, 0x00, 0x00, 0x00, 0x00, 0x02, 0xe2, 0xe2, 0xff, 0x23, 0x24, 0x20, 0xfb, 0xe4, 0x01, 0x00, 0xfb, 0xff, 0xa9, 0x07, 0x02, 0xfb, 0xff, 0x02, 
+  0x01, 0x00, 0xfb, 0xff, 0x24, 0x20, 0xfb, 0xe4, 0xe2, 0xe2, 0xff, 0x23, 0x8c, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc7, 0xc7, 0xff, 0x40, 0x13, 0x11, 0xfb, 0xf2, 0x02, 0x00, 0xfb, 0xff, 0xa7, 0x07, 
+  0x02, 0xfb, 0xff, 0x02, 0x02, 0x00, 0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xc7, 0xc7, 0xff, 0x40, 0x8e, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xb3, 0xff, 0x51, 0x0f, 0x0c, 0xfb, 0xf6, 0x02, 0x00, 
+  0xfb, 0xff, 0xa5, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x02, 0x00, 0xfb, 0xff, 0x0f, 0x0c, 0xfb, 0xf6, 0xb7, 0xb3, 0xff, 0x51, 0x90, 0x00, 0x00, 0x00, 0x00, 0x02, 0xb7, 0xb4, 0xff, 0x52, 0x13, 0x11, 
+  0xfb, 0xf2, 0x01, 0x00, 0xfb, 0xff, 0xa3, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x01, 0x00, 0xfb, 0xff, 0x13, 0x11, 0xfb, 0xf2, 0xb7, 0xb4, 0xff, 0x52, 0x92, 0x00, 0x00, 0x00, 0x00, 0x02, 0xc4, 0xc4, 
+  0xff, 0x41, 0x24, 0x22, 0xfc, 0xe2, 0x00, 0x00, 0xfb, 0xff, 0xa1, 0x07, 0x02, 0xfb, 0xff, 0x02, 0x00, 0x00, 0xfb, 0xff, 0x24, 0x22, 0xfc, 0xe2, 0xc4, 0xc4, 0xff, 0x41, 0x94, 0x00, 0x00, 0x00, 
+  0x00, 0x03, 0xe3, 0xdd, 0xff, 0x25, 0x49, 0x47, 0xfc, 0xbf, 0x00, 0x00, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x9d, 0x07, 0x02, 0xfb, 0xff, 0x03, 0x04, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 
+  0x49, 0x47, 0xfc, 0xbf, 0xe3, 0xdd, 0xff, 0x25, 0x96, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x08, 0x86, 0x86, 0xfd, 0x81, 0x10, 0x0e, 0xfb, 0xf5, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 
+  0xfb, 0xff, 0x99, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x06, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x10, 0x0e, 0xfb, 0xf5, 0x86, 0x86, 0xfd, 0x81, 0xff, 0xff, 0xff, 0x08, 0x99, 0x00, 0x00, 0x00, 
+  0x00, 0x04, 0xcf, 0xcf, 0xff, 0x35, 0x51, 0x4e, 0xfc, 0xb6, 0x04, 0x01, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x95, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x06, 0x01, 0xfb, 0xff, 
+  0x00, 0x00, 0xfb, 0xff, 0x04, 0x01, 0xfb, 0xff, 0x51, 0x4e, 0xfc, 0xb6, 0xcf, 0xcf, 0xff, 0x35, 0x9d, 0x00, 0x00, 0x00, 0x00, 0x04, 0xba, 0xb7, 0xff, 0x4e, 0x4a, 0x47, 0xfc, 0xbe, 0x07, 0x04, 
+  0xfb, 0xfe, 0x00, 0x00, 0xfb, 0xff, 0x03, 0x00, 0xfb, 0xff, 0x91, 0x07, 0x02, 0xfb, 0xff, 0x04, 0x03, 0x00, 0xfb, 0xff, 0x00, 0x00, 0xfb, 0xff, 0x07, 0x04, 0xfb, 0xfe, 0x4a, 0x47, 0xfc, 0xbe, 
+  0xba, 0xb7, 0xff, 0x4e, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xff, 0xff, 0x01, 0xc6, 0xc6, 0xff, 0x3f, 0x6a, 0x69, 0xfd, 0x9c, 0x23, 0x1f, 0xfb, 0xe5, 0x01, 0x00, 0xfb, 0xff, 0x81, 0x00, 
+  0x00, 0xfb, 0xff, 0x01, 0x04, 0x00, 0xfb, 0xff, 0x06, 0x01, 0xfb, 0xff, 0x87, 0x07, 0x02, 0xfb, 0xff, 0x01, 0x06, 0x01, 0xfb, 0xff, 0x04, 0x00, 0xfb, 0xff, 0x81, 0x00, 0x00, 0xfb, 0xff, 0x04, 
+  0x01, 0x00, 0xfb, 0xff, 0x23, 0x1f, 0xfb, 0xe5, 0x6a, 0x69, 0xfd, 0x9c, 0xc6, 0xc6, 0xff, 0x3f, 0xff, 0xff, 0xff, 0x01, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x05, 0xf2, 0xf2, 0xff, 0x14, 0xb5, 0xb5, 
+  0xff, 0x4f, 0x74, 0x72, 0xfd, 0x93, 0x3d, 0x3a, 0xfc, 0xca, 0x1a, 0x17, 0xfb, 0xee, 0x07, 0x03, 0xfb, 0xff, 0x82, 0x00, 0x00, 0xfb, 0xff, 0x81, 0x05, 0x00, 0xfb, 0xff, 0x82, 0x00, 0x00, 0xfb, 
+  0xff, 0x05, 0x07, 0x03, 0xfb, 0xff, 0x1a, 0x17, 0xfb, 0xee, 0x3d, 0x3a, 0xfc, 0xca, 0x74, 0x72, 0xfd, 0x93, 0xb5, 0xb5, 0xff, 0x4f, 0xf2, 0xf2, 0xff, 0x14, 0xaa, 0x00, 0x00, 0x00, 0x00, 0x05, 
+  0xff, 0xff, 0xff, 0x01, 0xeb, 0xeb, 0xff, 0x19, 0xcd, 0xcd, 0xff, 0x38, 0xaf, 0xaf, 0xff, 0x56, 0x98, 0x95, 0xfd, 0x6f, 0x74, 0x72, 0xfc, 0xc1, 0x81, 0x18, 0x14, 0xfc, 0xff, 0x05, 0x74, 0x72, 
+  0xfc, 0xc1, 0x98, 0x95, 0xfd, 0x6f, 0xaf, 0xaf, 0xff, 0x56, 0xcd, 0xcd, 0xff, 0x38, 0xeb, 0xeb, 0xff, 0x19, 0xff, 0xff, 0xff, 0x01, 0x96, 0x00, 0x00, 0x00, 0x00, 
 #endif
 };
 
 const lv_img_dsc_t phone_hangup_60_60 = {
-  .header.cf = LV_IMG_CF_TRUE_COLOR_ALPHA,
+  .header.cf = LV_IMG_CF_USER_ENCODED_0,
   .header.always_zero = 0,
   .header.reserved = 0,
   .header.w = 60,
   .header.h = 60,
-  .data_size = 3600 * LV_IMG_PX_SIZE_ALPHA_BYTE,
+  .data_size = sizeof(phone_hangup_60_60_map),
   .data = phone_hangup_60_60_map,
 };
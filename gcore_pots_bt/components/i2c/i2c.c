@@ -2,9 +2,10 @@
  * I2C Module
  *
  * Provides I2C Access routines for other modules/tasks.  Provides a locking mechanism
- * since the underlying ESP IDF routines are not thread safe.
+ * since the underlying ESP IDF routines are not thread safe and a service task running
+ * queued transfer jobs in client priority order.
  *
- * Copyright 2020-2021 Dan Julio
+ * Copyright 2020-2023 Dan Julio
  *
  * This is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -21,9 +22,15 @@
  *
  */
 #include "i2c.h"
+#include <string.h>
 #include "driver/i2c.h"
+#include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
 #include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "systrace.h"
 
 //
 // Constants
@@ -35,8 +42,40 @@ static const int i2c_master_port = 1;
 //
 // I2C variables
 //
+static const char* TAG = "i2c";
+
 static bool is_initialized = false;
 static SemaphoreHandle_t i2c_mutex;
+static StaticSemaphore_t i2c_mutex_buf;
+
+// Service task state
+static TaskHandle_t i2c_task_handle = NULL;
+static StackType_t i2c_task_stack[I2C_TASK_STACK];
+static StaticTask_t i2c_task_tcb;
+static QueueHandle_t job_queue[I2C_NUM_CLIENTS];
+static StaticQueue_t job_queue_buf[I2C_NUM_CLIENTS];
+static uint8_t job_queue_storage[I2C_NUM_CLIENTS][I2C_JOB_QUEUE_LEN * sizeof(i2c_job_t*)];
+static SemaphoreHandle_t job_count_sem;               // Given once for each queued job
+static StaticSemaphore_t job_count_sem_buf;
+
+// Blocking transfers for each client take turns waiting on one completion semaphore
+static SemaphoreHandle_t client_mutex[I2C_NUM_CLIENTS];
+static SemaphoreHandle_t client_done_sem[I2C_NUM_CLIENTS];
+static StaticSemaphore_t client_mutex_buf[I2C_NUM_CLIENTS];
+static StaticSemaphore_t client_done_sem_buf[I2C_NUM_CLIENTS];
+
+static i2c_client_stats_t client_stats[I2C_NUM_CLIENTS];
+static portMUX_TYPE stats_mux = portMUX_INITIALIZER_UNLOCKED;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static bool _i2cServiceInit();
+static void _i2cTask(void* arg);
+static esp_err_t _i2cRunXfers(uint8_t addr7, const i2c_xfer_t* xfers, int num_xfers);
+static void _i2cSyncDone(i2c_job_t* job);
 
 
 //
@@ -56,7 +95,7 @@ esp_err_t i2c_master_init()
     }
     
     if (i2c_mutex == NULL) {
-    	i2c_mutex = xSemaphoreCreateMutex();
+    	i2c_mutex = xSemaphoreCreateMutexStatic(&i2c_mutex_buf);
     }
     
     conf.mode = I2C_MODE_MASTER;
@@ -76,6 +115,12 @@ esp_err_t i2c_master_init()
     
     is_initialized = (ret == ESP_OK);
     
+    if (is_initialized && (i2c_task_handle == NULL)) {
+    	if (!_i2cServiceInit()) {
+    		ESP_LOGE(TAG, "Service task start failed - transfers will be made directly");
+    	}
+    }
+    
     return ret;
 }
 
@@ -182,3 +227,189 @@ esp_err_t i2c_master_write_slave(uint8_t addr7, uint8_t *data_wr, size_t size)
     
     return ret;
 }
+
+
+/**
+ * Queue a job for the service task (returns immediately)
+ */
+esp_err_t i2c_submit(i2c_job_t* job)
+{
+	UBaseType_t waiting;
+	
+	if ((job->client < 0) || (job->client >= I2C_NUM_CLIENTS)) {
+		return ESP_ERR_INVALID_ARG;
+	}
+	if (i2c_task_handle == NULL) {
+		return ESP_ERR_INVALID_STATE;
+	}
+	
+	job->queued_usec = esp_timer_get_time();
+	waiting = uxQueueMessagesWaiting(job_queue[job->client]);
+	if (xQueueSend(job_queue[job->client], &job, portMAX_DELAY) != pdTRUE) {
+		return ESP_FAIL;
+	}
+	xSemaphoreGive(job_count_sem);
+	
+	portENTER_CRITICAL(&stats_mux);
+	if (waiting > client_stats[job->client].max_queued) {
+		client_stats[job->client].max_queued = waiting;
+	}
+	portEXIT_CRITICAL(&stats_mux);
+	
+	return ESP_OK;
+}
+
+
+/**
+ * Run a batch of transfers at the client's priority and wait for them to complete
+ */
+esp_err_t i2c_transfer(int client, uint8_t addr7, const i2c_xfer_t* xfers, int num_xfers)
+{
+	esp_err_t ret;
+	i2c_job_t job;
+	
+	if ((client < 0) || (client >= I2C_NUM_CLIENTS)) {
+		return ESP_ERR_INVALID_ARG;
+	}
+	
+	// Before the service task is running, make the transfers here
+	if (i2c_task_handle == NULL) {
+		i2c_lock();
+		ret = _i2cRunXfers(addr7, xfers, num_xfers);
+		i2c_unlock();
+		return ret;
+	}
+	
+	xSemaphoreTake(client_mutex[client], portMAX_DELAY);
+	
+	job.client = client;
+	job.addr7 = addr7;
+	job.xfers = xfers;
+	job.num_xfers = num_xfers;
+	job.done_cb = _i2cSyncDone;
+	job.cb_arg = (void*) client_done_sem[client];
+	
+	if ((ret = i2c_submit(&job)) == ESP_OK) {
+		xSemaphoreTake(client_done_sem[client], portMAX_DELAY);
+		ret = job.result;
+	}
+	
+	xSemaphoreGive(client_mutex[client]);
+	
+	return ret;
+}
+
+
+/**
+ * Single transfer (typically a register address write followed by a read)
+ */
+esp_err_t i2c_write_read(int client, uint8_t addr7, const uint8_t* wr, size_t wr_len, uint8_t* rd, size_t rd_len)
+{
+	i2c_xfer_t xfer;
+	
+	xfer.wr = wr;
+	xfer.wr_len = wr_len;
+	xfer.rd = rd;
+	xfer.rd_len = rd_len;
+	
+	return i2c_transfer(client, addr7, &xfer, 1);
+}
+
+
+void i2c_get_client_stats(int client, i2c_client_stats_t* stats)
+{
+	if ((client < 0) || (client >= I2C_NUM_CLIENTS)) {
+		memset(stats, 0, sizeof(i2c_client_stats_t));
+		return;
+	}
+	
+	portENTER_CRITICAL(&stats_mux);
+	*stats = client_stats[client];
+	portEXIT_CRITICAL(&stats_mux);
+}
+
+
+
+//
+// I2C Internal functions
+//
+static bool _i2cServiceInit()
+{
+	int i;
+	
+	job_count_sem = xSemaphoreCreateCountingStatic(I2C_NUM_CLIENTS * I2C_JOB_QUEUE_LEN, 0, &job_count_sem_buf);
+	
+	for (i=0; i<I2C_NUM_CLIENTS; i++) {
+		job_queue[i] = xQueueCreateStatic(I2C_JOB_QUEUE_LEN, sizeof(i2c_job_t*), job_queue_storage[i], &job_queue_buf[i]);
+		client_mutex[i] = xSemaphoreCreateMutexStatic(&client_mutex_buf[i]);
+		client_done_sem[i] = xSemaphoreCreateBinaryStatic(&client_done_sem_buf[i]);
+	}
+	
+	i2c_task_handle = xTaskCreateStaticPinnedToCore(&_i2cTask, "i2c_task", I2C_TASK_STACK, NULL, I2C_TASK_PRIORITY, i2c_task_stack, &i2c_task_tcb, 0);
+	return (i2c_task_handle != NULL);
+}
+
+
+static void _i2cTask(void* arg)
+{
+	int i;
+	uint32_t latency;
+	i2c_job_t* job;
+	i2c_client_stats_t* s;
+	
+	ESP_LOGI(TAG, "Start task");
+	
+	while (1) {
+		xSemaphoreTake(job_count_sem, portMAX_DELAY);
+		
+		// Highest priority client with a job waiting
+		for (i=0; i<I2C_NUM_CLIENTS; i++) {
+			if (xQueueReceive(job_queue[i], &job, 0) == pdTRUE) break;
+		}
+		if (i == I2C_NUM_CLIENTS) continue;
+		
+		i2c_lock();
+		job->result = _i2cRunXfers(job->addr7, job->xfers, job->num_xfers);
+		i2c_unlock();
+		
+		latency = (uint32_t) (esp_timer_get_time() - job->queued_usec);
+		s = &client_stats[i];
+		portENTER_CRITICAL(&stats_mux);
+		s->jobs++;
+		if (job->result != ESP_OK) s->errors++;
+		if (latency > s->max_latency_usec) s->max_latency_usec = latency;
+		s->total_latency_usec += latency;
+		portEXIT_CRITICAL(&stats_mux);
+		
+		if (job->done_cb != NULL) {
+			job->done_cb(job);
+		}
+	}
+}
+
+
+// Must be called with the bus locked
+static esp_err_t _i2cRunXfers(uint8_t addr7, const i2c_xfer_t* xfers, int num_xfers)
+{
+	int i;
+	esp_err_t ret = ESP_OK;
+	
+	SYSTRACE_START(SYSTRACE_ID_I2C);
+	for (i=0; (i<num_xfers) && (ret == ESP_OK); i++) {
+		if (xfers[i].wr_len != 0) {
+			ret = i2c_master_write_slave(addr7, (uint8_t*) xfers[i].wr, xfers[i].wr_len);
+		}
+		if ((ret == ESP_OK) && (xfers[i].rd_len != 0)) {
+			ret = i2c_master_read_slave(addr7, xfers[i].rd, xfers[i].rd_len);
+		}
+	}
+	SYSTRACE_STOP(SYSTRACE_ID_I2C);
+	
+	return ret;
+}
+
+
+static void _i2cSyncDone(i2c_job_t* job)
+{
+	xSemaphoreGive((SemaphoreHandle_t) job->cb_arg);
+}
@@ -4,7 +4,13 @@
  * Provides I2C Access routines for other modules/tasks.  Provides a locking mechanism
  * since the underlying ESP IDF routines are not thread safe.
  *
- * Copyright 2020-2021 Dan Julio
+ * Transfers are normally made through a service task that runs queued jobs in client
+ * priority order (codec, then touch, then gCore/power) so a burst of lower priority
+ * traffic can only delay a codec access by the job in progress.  Each job holds a batch
+ * of transfers made back-to-back.  i2c_lock() still excludes the service task for
+ * sequences that must compute between transfers (e.g. read-modify-write).
+ *
+ * Copyright 2020-2023 Dan Julio
  *
  * This is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -23,6 +29,7 @@
 #ifndef I2C_H
 #define I2C_H
 
+#include <stdbool.h>
 #include <stdint.h>
 #include "esp_system.h"
 
@@ -46,6 +53,58 @@
 #define ACK_VAL       0x0
 #define NACK_VAL      0x1 
 
+// Clients in priority order
+#define I2C_CLIENT_CODEC  0
+#define I2C_CLIENT_TOUCH  1
+#define I2C_CLIENT_GCORE  2
+#define I2C_NUM_CLIENTS   3
+
+// Jobs each client may have queued
+#define I2C_JOB_QUEUE_LEN 8
+
+// Service task
+#define I2C_TASK_STACK    2560
+#define I2C_TASK_PRIORITY 4
+
+
+
+//
+// I2C typedefs
+//
+
+// One transfer: wr_len bytes written then rd_len bytes read, each its own transaction
+// (either length may be 0)
+typedef struct {
+	const uint8_t* wr;
+	size_t wr_len;
+	uint8_t* rd;
+	size_t rd_len;
+} i2c_xfer_t;
+
+struct i2c_job_t;
+typedef void (*i2c_done_cb_t)(struct i2c_job_t* job);
+
+// The job and its transfer buffers must stay valid until done_cb is called (from the service
+// task so it must not block or start a blocking transfer)
+typedef struct i2c_job_t {
+	int client;
+	uint8_t addr7;
+	const i2c_xfer_t* xfers;
+	int num_xfers;                        // Stops at the first failure
+	i2c_done_cb_t done_cb;                // May be NULL
+	void* cb_arg;
+	esp_err_t result;                     // Set before done_cb
+	int64_t queued_usec;                  // Internal
+} i2c_job_t;
+
+typedef struct {
+	uint32_t jobs;
+	uint32_t errors;
+	uint32_t max_latency_usec;            // Submit to completion
+	uint64_t total_latency_usec;
+	uint32_t max_queued;                  // Jobs waiting when one was submitted
+} i2c_client_stats_t;
+
 
 //
 // I2C API
@@ -57,6 +116,10 @@ void i2c_lock();
 void i2c_unlock();
 esp_err_t i2c_master_read_slave(uint8_t addr7, uint8_t *data_rd, size_t size);
 esp_err_t i2c_master_write_slave(uint8_t addr7, uint8_t *data_wr, size_t size);
+esp_err_t i2c_submit(i2c_job_t* job);
+esp_err_t i2c_transfer(int client, uint8_t addr7, const i2c_xfer_t* xfers, int num_xfers);  // Blocks until done
+esp_err_t i2c_write_read(int client, uint8_t addr7, const uint8_t* wr, size_t wr_len, uint8_t* rd, size_t rd_len);
+void i2c_get_client_stats(int client, i2c_client_stats_t* stats);
 
 
 #endif /* I2C_H */
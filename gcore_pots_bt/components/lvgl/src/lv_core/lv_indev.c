@@ -16,6 +16,8 @@
 #include "../lv_misc/lv_task.h"
 #include "../lv_misc/lv_math.h"
 
+#include "touch_lat.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -948,6 +950,7 @@ static void indev_proc_press(lv_indev_proc_t * proc)
             }
 
             /*Send a signal about the press*/
+            TOUCH_LAT_DISPATCH_OBJ(indev_obj_act);
             indev_obj_act->signal_cb(indev_obj_act, LV_SIGNAL_PRESSED, indev_act);
             if(indev_reset_check(proc)) return;
 
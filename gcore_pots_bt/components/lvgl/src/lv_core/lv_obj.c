@@ -24,6 +24,7 @@
 #include "../lv_hal/lv_hal.h"
 #include <stdint.h>
 #include <string.h>
+#include "touch_lat.h"
 
 #if LV_USE_GPU_NXP_PXP && LV_USE_GPU_NXP_PXP_AUTO_INIT
     #include "../lv_gpu/lv_gpu_nxp_pxp.h"
@@ -548,7 +549,10 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
     lv_area_copy(&area_tmp, area);
     bool visible = lv_obj_area_is_visible(obj, &area_tmp);
 
-    if(visible) _lv_inv_area(lv_obj_get_disp(obj), &area_tmp);
+    if(visible) {
+        TOUCH_LAT_INVALIDATE_OBJ(obj);
+        _lv_inv_area(lv_obj_get_disp(obj), &area_tmp);
+    }
 }
 
 /**
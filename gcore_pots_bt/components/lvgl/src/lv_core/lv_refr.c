@@ -23,6 +23,9 @@
     #include "../lv_widgets/lv_label.h"
 #endif
 
+#include "render_prof.h"
+#include "touch_lat.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -43,6 +46,7 @@ static void lv_refr_area_part(const lv_area_t * area_p);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p);
 static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p);
+static void lv_refr_obj_design(lv_obj_t * obj, const lv_area_t * mask_p, lv_design_mode_t mode);
 static void lv_refr_vdb_flush(void);
 
 /**********************
@@ -196,6 +200,7 @@ void _lv_disp_refr_task(lv_task_t * task)
 
     lv_refr_join_area();
 
+    TOUCH_LAT_REFR_START();
     lv_refr_areas();
 
     /*If refresh happened ...*/
@@ -397,7 +402,10 @@ static void lv_refr_areas(void)
 
             if(i == last_i) disp_refr->driver.buffer->last_area = 1;
             disp_refr->driver.buffer->last_part = 0;
+            RENDER_PROF_AREA_START(disp_refr->inv_areas[i].x1, disp_refr->inv_areas[i].y1,
+                                   disp_refr->inv_areas[i].x2, disp_refr->inv_areas[i].y2);
             lv_refr_area(&disp_refr->inv_areas[i]);
+            RENDER_PROF_AREA_END();
 
             px_num += lv_area_get_size(&disp_refr->inv_areas[i]);
         }
@@ -653,7 +661,7 @@ static void lv_refr_obj_and_children(lv_obj_t * top_p, const lv_area_t * mask_p)
         }
 
         /*Call the post draw design function of the parents of the to object*/
-        if(par->design_cb) par->design_cb(par, mask_p, LV_DESIGN_DRAW_POST);
+        if(par->design_cb) lv_refr_obj_design(par, mask_p, LV_DESIGN_DRAW_POST);
 
         /*The new border will be there last parents,
          *so the 'younger' brothers of parent will be refreshed*/
@@ -691,7 +699,7 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
     if(union_ok != false) {
 
         /* Redraw the object */
-        if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
+        if(obj->design_cb) lv_refr_obj_design(obj, &obj_ext_mask, LV_DESIGN_DRAW_MAIN);
 
 #if MASK_AREA_DEBUG
         static lv_color_t debug_color = LV_COLOR_RED;
@@ -737,10 +745,33 @@ static void lv_refr_obj(lv_obj_t * obj, const lv_area_t * mask_ori_p)
         }
 
         /* If all the children are redrawn make 'post draw' design */
-        if(obj->design_cb) obj->design_cb(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
+        if(obj->design_cb) lv_refr_obj_design(obj, &obj_ext_mask, LV_DESIGN_DRAW_POST);
     }
 }
 
+/**
+ * Draw an object with its design callback, charging the time to the object's type when
+ * the render profiler is enabled
+ * @param obj pointer to an object with a design callback
+ * @param mask_p the object will be drawn only here
+ * @param mode LV_DESIGN_DRAW_MAIN or LV_DESIGN_DRAW_POST
+ */
+static void lv_refr_obj_design(lv_obj_t * obj, const lv_area_t * mask_p, lv_design_mode_t mode)
+{
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+    RENDER_PROF_OBJ_START();
+    obj->design_cb(obj, mask_p, mode);
+    if(render_prof_obj_end((const void *)obj->design_cb)) {
+        /*Name the type after the first object seen drawn by this design callback*/
+        lv_obj_type_t type;
+        lv_obj_get_type(obj, &type);
+        render_prof_obj_name((const void *)obj->design_cb, type.type[0]);
+    }
+#else
+    obj->design_cb(obj, mask_p, mode);
+#endif
+}
+
 static void lv_refr_vdb_rotate_180(lv_disp_drv_t *drv, lv_area_t *area, lv_color_t *color_p) {
     lv_coord_t area_w = lv_area_get_width(area);
     lv_coord_t area_h = lv_area_get_height(area);
@@ -909,15 +940,18 @@ static void lv_refr_vdb_flush(void)
     /*In double buffered mode wait until the other buffer is flushed before flushing the current
      * one*/
     if(lv_disp_is_double_buf(disp_refr)) {
+        RENDER_PROF_WAIT_START();
         while(vdb->flushing) {
             if(disp_refr->driver.wait_cb) disp_refr->driver.wait_cb(&disp_refr->driver);
         }
+        RENDER_PROF_WAIT_END();
     }
 
     vdb->flushing = 1;
 
     if(disp_refr->driver.buffer->last_area && disp_refr->driver.buffer->last_part) vdb->flushing_last = 1;
     else vdb->flushing_last = 0;
+    TOUCH_LAT_FLUSH_START(vdb->flushing_last);
 
     /*Flush the rendered content to the display*/
     lv_disp_t * disp = _lv_refr_get_disp_refreshing();
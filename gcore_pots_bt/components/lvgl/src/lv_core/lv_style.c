@@ -74,6 +74,50 @@ void lv_style_copy(lv_style_t * style_dest, const lv_style_t * style_src)
         _lv_memcpy(style_dest->map, style_src->map, size);
 }
 
+/**
+ * Merge the properties of a style into an other. Properties already in the destination
+ * with the same state are overwritten, others are added.
+ * @param style_dest pointer to the destination style. (Should be initialized with `lv_style_init()`)
+ * @param style_src pointer to the source style
+ */
+void lv_style_merge(lv_style_t * style_dest, const lv_style_t * style_src)
+{
+    LV_ASSERT_STYLE(style_dest);
+
+    if(style_src == NULL || style_src->map == NULL) return;
+
+    size_t i = 0;
+    uint8_t prop_id;
+    while((prop_id = get_style_prop_id(style_src, i)) != _LV_STYLE_CLOSING_PROP) {
+        lv_style_property_t prop = get_style_prop(style_src, i);
+        const uint8_t * value = style_src->map + i + sizeof(lv_style_property_t);
+        uint8_t type = prop_id & 0xF;
+
+        if(type < LV_STYLE_ID_COLOR) {
+            lv_style_int_t v;
+            _lv_memcpy_small(&v, value, sizeof(v));
+            _lv_style_set_int(style_dest, prop, v);
+        }
+        else if(type < LV_STYLE_ID_OPA) {
+            lv_color_t v;
+            _lv_memcpy_small(&v, value, sizeof(v));
+            _lv_style_set_color(style_dest, prop, v);
+        }
+        else if(type < LV_STYLE_ID_PTR) {
+            lv_opa_t v;
+            _lv_memcpy_small(&v, value, sizeof(v));
+            _lv_style_set_opa(style_dest, prop, v);
+        }
+        else {
+            const void * v;
+            _lv_memcpy_small(&v, value, sizeof(v));
+            _lv_style_set_ptr(style_dest, prop, v);
+        }
+
+        i = get_next_prop_index(prop_id, i);
+    }
+}
+
 /**
  * Remove a property from a style
  * @param style pointer to a style
@@ -272,6 +272,14 @@ void lv_style_init(lv_style_t * style);
  */
 void lv_style_copy(lv_style_t * style_dest, const lv_style_t * style_src);
 
+/**
+ * Merge the properties of a style into an other. Properties already in the destination
+ * with the same state are overwritten, others are added.
+ * @param style_dest pointer to the destination style. (Should be initialized with `lv_style_init()`)
+ * @param style_src pointer to the source style
+ */
+void lv_style_merge(lv_style_t * style_dest, const lv_style_t * style_src);
+
 /**
  * Initialize a style list
  * @param list a style list to initialize
@@ -11,6 +11,7 @@
 #include "../lv_misc/lv_math.h"
 #include "../lv_hal/lv_hal_disp.h"
 #include "../lv_core/lv_refr.h"
+#include "render_prof.h"
 
 #if LV_USE_GPU_NXP_PXP
     #include "../lv_gpu/lv_gpu_nxp_pxp.h"
@@ -168,6 +169,7 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
 
+    RENDER_PROF_BLEND_START();
     if(disp->driver.set_px_cb) {
         fill_set_px(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res);
     }
@@ -179,6 +181,7 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_fill(const lv_area_t * clip_area, const lv_
         fill_blended(disp_area, disp_buf, &draw_area, color, opa, mask, mask_res, mode);
     }
 #endif
+    RENDER_PROF_BLEND_END(RENDER_PROF_BLEND_FILL, lv_area_get_size(&draw_area));
 }
 
 /**
@@ -235,6 +238,7 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
         int32_t i;
         for(i = 0; i < mask_w; i++)  mask[i] = mask[i] > 128 ? LV_OPA_COVER : LV_OPA_TRANSP;
     }
+    RENDER_PROF_BLEND_START();
     if(disp->driver.set_px_cb) {
         map_set_px(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res);
     }
@@ -246,6 +250,7 @@ LV_ATTRIBUTE_FAST_MEM void _lv_blend_map(const lv_area_t * clip_area, const lv_a
         map_blended(disp_area, disp_buf, &draw_area, map_area, map_buf, opa, mask, mask_res, mode);
     }
 #endif
+    RENDER_PROF_BLEND_END(RENDER_PROF_BLEND_MAP, lv_area_get_size(&draw_area));
 }
 
 /**********************
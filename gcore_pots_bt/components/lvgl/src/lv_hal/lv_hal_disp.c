@@ -19,6 +19,8 @@
 #include "../lv_core/lv_refr.h"
 #include "../lv_themes/lv_theme.h"
 
+#include "touch_lat.h"
+
 /*********************
  *      DEFINES
  *********************/
@@ -353,6 +355,7 @@ LV_ATTRIBUTE_FLUSH_READY void lv_disp_flush_ready(lv_disp_drv_t * disp_drv)
     }
 #endif
 
+    TOUCH_LAT_FLUSH_READY();
     disp_drv->buffer->flushing = 0;
     disp_drv->buffer->flushing_last = 0;
 }
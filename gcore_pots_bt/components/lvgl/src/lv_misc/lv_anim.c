@@ -181,6 +181,15 @@ uint16_t lv_anim_count_running(void)
     return cnt;
 }
 
+/**
+ * Get the task running the animations (e.g. to change its period)
+ * @return pointer to the animation task
+ */
+lv_task_t * _lv_anim_get_task(void)
+{
+    return _lv_anim_task;
+}
+
 /**
  * Calculate the time of an animation with a given speed and the start and end values
  * @param speed speed of animation in unit/sec
@@ -19,6 +19,7 @@ extern "C" {
 #include <stdbool.h>
 #include <string.h>
 #include "lv_mem.h"
+#include "lv_task.h"
 
 /*********************
  *      DEFINES
@@ -343,6 +344,12 @@ static inline bool lv_anim_custom_del(lv_anim_t * a, lv_anim_custom_exec_cb_t ex
  */
 uint16_t lv_anim_count_running(void);
 
+/**
+ * Get the task running the animations (e.g. to change its period)
+ * @return pointer to the animation task
+ */
+lv_task_t * _lv_anim_get_task(void);
+
 /**
  * Calculate the time of an animation with a given speed and the start and end values
  * @param speed speed of animation in unit/sec
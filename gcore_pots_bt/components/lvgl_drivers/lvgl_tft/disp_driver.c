@@ -2,14 +2,25 @@
  * @file disp_driver.c
  */
 
+#include <string.h>
 #include "disp_driver.h"
 #include "disp_spi.h"
 #include "ili9488.h"
 #include "mem_fb.h"
+#include "render_prof.h"
+#include "sdkconfig.h"
 
 
 static bool enable_dump;
 
+// Power state, the rows shown in DISP_POWER_PARTIAL and if LVGL drew anything that wasn't sent
+static disp_power_t disp_power = DISP_POWER_NORMAL;
+static int16_t disp_rows_y1;
+static int16_t disp_rows_y2;
+static bool disp_dropped = false;
+
+
+static bool disp_driver_clip(lv_area_t * area, lv_color_t ** color_map);
 
 
 void disp_driver_init(bool init_spi)
@@ -25,14 +36,147 @@ void disp_driver_init(bool init_spi)
 
 void disp_driver_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map)
 {
+	lv_area_t shown = *area;
+	
 	if (enable_dump) {
 		mem_fb_flush(drv, area, color_map);
 	} else {
-		ili9488_flush(drv, area, color_map);
+		RENDER_PROF_FLUSH_START();
+		if (!disp_driver_clip(&shown, &color_map)) {
+			// Nothing of it is on the display
+			RENDER_PROF_FLUSH_SKIPPED();
+			lv_disp_flush_ready(drv);
+		} else {
+#if (CONFIG_GUI_DISP_DIFF_FLUSH == true)
+			// Only send the tiles that differ from what the display already shows
+			lv_area_t dirty;
+			
+			if (mem_fb_diff(&shown, color_map, &dirty)) {
+				ili9488_flush(drv, &dirty, color_map);
+			} else {
+				RENDER_PROF_FLUSH_SKIPPED();
+				lv_disp_flush_ready(drv);
+			}
+#else
+			ili9488_flush(drv, &shown, color_map);
+#endif
+		}
+		RENDER_PROF_FLUSH_END();
 	}
 }
 
+// Move the display to a power state, rows y1-y2 being shown in DISP_POWER_PARTIAL.  Flushes
+// are cut to those rows (and dropped in DISP_POWER_SLEEP) so the frame buffer diff still
+// matches the display.  Returns true if LVGL must redraw the screen because some were.
+bool disp_driver_set_power(disp_power_t state, int16_t y1, int16_t y2)
+{
+	bool redraw;
+	
+	if ((state == disp_power) &&
+	    ((state != DISP_POWER_PARTIAL) || ((y1 == disp_rows_y1) && (y2 == disp_rows_y2)))) {
+		return false;
+	}
+	
+	// Anything still being sent finishes in the old state
+	disp_spi_wait_idle();
+	switch (state) {
+		case DISP_POWER_IDLE:
+			ili9488_set_power(ILI9488_PWR_IDLE, 0, 0);
+			break;
+		case DISP_POWER_PARTIAL:
+			ili9488_set_power(ILI9488_PWR_PARTIAL, y1, y2);
+			break;
+		case DISP_POWER_SLEEP:
+			ili9488_set_power(ILI9488_PWR_SLEEP, 0, 0);
+			break;
+		default:
+			ili9488_set_power(ILI9488_PWR_NORMAL, 0, 0);
+	}
+	disp_power = state;
+	disp_rows_y1 = y1;
+	disp_rows_y2 = y2;
+	
+	redraw = disp_dropped;
+	disp_dropped = false;
+	return redraw;
+}
+
 void disp_driver_en_dump(bool en_dump)
 {
 	enable_dump = en_dump;
+	
+	// The dump may render content the display never received
+	mem_fb_diff_invalidate();
+}
+
+#if (CONFIG_GUI_DISP_DIFF_FLUSH == true)
+// Copy the image on the display (LV_HOR_RES_MAX * LV_VER_RES_MAX pixels) into frame.  Returns
+// false if it isn't known.
+bool disp_driver_save_frame(lv_color_t * frame)
+{
+	return !enable_dump && mem_fb_save(frame);
+}
+
+// Send a complete frame to the display between LVGL refreshes.  The frame is usually in PSRAM,
+// which the SPI DMA can't read, so it is copied a strip at a time into LVGL's draw buffers, the
+// next strip while the previous one is being sent.  Following flushes only send what differs
+// from it.
+void disp_driver_show_frame(const lv_color_t * frame)
+{
+	lv_disp_buf_t * disp_buf = lv_disp_get_buf(lv_disp_get_default());
+	lv_color_t * bufs[2] = {disp_buf->buf1, disp_buf->buf2};
+	int16_t rows = disp_buf->size / LV_HOR_RES_MAX;
+	lv_area_t area;
+	int i = 0;
+	
+	if (enable_dump || (bufs[1] == NULL)) return;
+	
+	// Any flush still being sent is using a draw buffer
+	disp_spi_wait_idle();
+	
+	area.x1 = 0;
+	area.x2 = LV_HOR_RES_MAX - 1;
+	area.y1 = 0;
+	area.y2 = rows - 1;
+	memcpy(bufs[0], frame, lv_area_get_size(&area) * sizeof(lv_color_t));
+	while (area.y1 < LV_VER_RES_MAX) {
+		ili9488_write(&area, bufs[i]);
+		
+		// Fill the other buffer with the next strip while this one is sent
+		i ^= 1;
+		area.y1 += rows;
+		area.y2 += rows;
+		if (area.y2 >= LV_VER_RES_MAX) area.y2 = LV_VER_RES_MAX - 1;
+		if (area.y1 < LV_VER_RES_MAX) {
+			memcpy(bufs[i], frame + (area.y1 * LV_HOR_RES_MAX), lv_area_get_size(&area) * sizeof(lv_color_t));
+		}
+		disp_spi_wait_idle();
+	}
+	
+	mem_fb_restore(frame);
+}
+#endif
+
+
+// Cut area (and color_map with it) to the rows on the display.  Returns false if none are.
+static bool disp_driver_clip(lv_area_t * area, lv_color_t ** color_map)
+{
+	if (disp_power < DISP_POWER_PARTIAL) return true;
+	
+	if ((disp_power == DISP_POWER_SLEEP) || (area->y2 < disp_rows_y1) || (area->y1 > disp_rows_y2)) {
+		disp_dropped = true;
+		return false;
+	}
+	
+	if (area->y1 < disp_rows_y1) {
+		*color_map += (disp_rows_y1 - area->y1) * lv_area_get_width(area);
+		area->y1 = disp_rows_y1;
+		disp_dropped = true;
+	}
+	if (area->y2 > disp_rows_y2) {
+		area->y2 = disp_rows_y2;
+		disp_dropped = true;
+	}
+	
+	return true;
 }
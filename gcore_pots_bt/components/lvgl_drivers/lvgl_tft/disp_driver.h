@@ -24,6 +24,12 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
+typedef enum {
+    DISP_POWER_NORMAL = 0,    /* Full color */
+    DISP_POWER_IDLE,          /* 8-color */
+    DISP_POWER_PARTIAL,       /* 8-color, only a band of rows shown (and sent) */
+    DISP_POWER_SLEEP,         /* Off, nothing sent */
+} disp_power_t;
  
 
 /**********************
@@ -32,6 +38,9 @@ extern "C" {
 void disp_driver_init(bool init_spi);
 void disp_driver_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map);
 void disp_driver_en_dump(bool en_dump);
+bool disp_driver_save_frame(lv_color_t * frame);
+void disp_driver_show_frame(const lv_color_t * frame);
+bool disp_driver_set_power(disp_power_t state, int16_t y1, int16_t y2);
 
 
 /**********************
@@ -1,6 +1,13 @@
 /**
  * @file disp_spi.c
  *
+ * Queues each display command, its parameters and the pixel data as separate
+ * transactions (up to DISP_SPI_QUEUE_LEN at once) so a complete flush is handed to the
+ * SPI driver in one go.  The DC line is driven from the pre-transaction callback.
+ * Commands and parameters of up to 4 bytes are copied into the transaction itself.
+ * Longer parameters and the pixel data must stay valid until the transaction is done.
+ * Callers block on a semaphore given from the post-transaction callback instead of
+ * spinning while the bus is busy.
  */
 
 /*********************
@@ -10,6 +17,7 @@
 #include "driver/gpio.h"
 #include "driver/spi_master.h"
 
+#include <stdatomic.h>
 #include <string.h>
 
 #include <freertos/FreeRTOS.h>
@@ -20,12 +28,17 @@
 
 #include "disp_spi.h"
 #include "disp_driver.h"
+#include "render_prof.h"
 
 
 /*********************
  *      DEFINES
  *********************/
 
+// Flags carried in each transaction's user field
+#define DISP_SPI_DC_DATA    0x01      // DC high (parameters or pixels) instead of low (command)
+#define DISP_SPI_FLUSH_END  0x02      // Last transaction of an LVGL flush
+
 
 /**********************
  *      TYPEDEFS
@@ -35,6 +48,8 @@
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void disp_spi_queue(const uint8_t * data, uint32_t length, uint32_t flags);
+static void IRAM_ATTR spi_pre (spi_transaction_t *trans);
 static void IRAM_ATTR spi_ready (spi_transaction_t *trans);
 
 
@@ -42,9 +57,19 @@ static void IRAM_ATTR spi_ready (spi_transaction_t *trans);
  *  STATIC VARIABLES
  **********************/
 static spi_device_handle_t spi;
-static volatile bool spi_trans_in_progress = false;
-static volatile bool spi_color_sent;
+static transaction_cb_t chained_pre_cb;
 static transaction_cb_t chained_post_cb;
+static int dc_gpio = -1;
+
+// Transactions are used in order so the oldest is done whenever fewer than
+// DISP_SPI_QUEUE_LEN are in flight
+static spi_transaction_t trans_pool[DISP_SPI_QUEUE_LEN];
+static int trans_next = 0;
+static atomic_int trans_in_flight = 0;
+
+// Given each time a transaction completes
+static SemaphoreHandle_t trans_done_sem;
+static StaticSemaphore_t trans_done_sem_buf;
 
 
 /**********************
@@ -57,7 +82,12 @@ static transaction_cb_t chained_post_cb;
  **********************/
 void disp_spi_add_device_config(spi_host_device_t host, spi_device_interface_config_t *devcfg)
 {
+    trans_done_sem = xSemaphoreCreateBinaryStatic(&trans_done_sem_buf);
+    assert(trans_done_sem != NULL);
+
+    chained_pre_cb=devcfg->pre_cb;
     chained_post_cb=devcfg->post_cb;
+    devcfg->pre_cb=spi_pre;
     devcfg->post_cb=spi_ready;
     esp_err_t ret=spi_bus_add_device(host, devcfg, &spi);
     assert(ret==ESP_OK);
@@ -70,7 +100,7 @@ void disp_spi_add_device(spi_host_device_t host)
             .clock_speed_hz=DISP_SPI_HZ,
             .mode=0,
             .spics_io_num=DISP_SPI_CS,
-            .queue_size=1,
+            .queue_size=DISP_SPI_QUEUE_LEN,
             .pre_cb=NULL,
             .post_cb=NULL,
             .cs_ena_pretrans = 12,            // Make sure CS brackets transaction with enough
@@ -104,45 +134,55 @@ void disp_spi_init(void)
 }
 
 
-void disp_spi_send_data(uint8_t * data, uint16_t length)
+// DC is driven low for commands and high for everything else (-1 if there is no DC line)
+void disp_spi_set_dc_gpio(int gpio)
 {
-    if (length == 0) return;           //no need to send anything
-
-    while (spi_trans_in_progress);
+    dc_gpio = gpio;
+}
 
-    spi_transaction_t t = {
-        .length = length * 8, // transaction length is in bits
-        .tx_buffer = data
-    };
 
-    spi_trans_in_progress = true;
-    spi_color_sent = false;             //Mark the "lv_flush_ready" NOT needs to be called in "spi_ready"
-    spi_device_queue_trans(spi, &t, portMAX_DELAY);
+// A command followed (if length > 0) by its parameters
+void disp_spi_queue_cmd(uint8_t cmd, const uint8_t * data, uint16_t length)
+{
+    disp_spi_queue(&cmd, 1, 0);
+    if (length != 0) {
+        disp_spi_queue(data, length, DISP_SPI_DC_DATA);
+    }
 }
 
 
-void disp_spi_send_colors(uint8_t * data, uint16_t length)
+// Pixel data ending a flush (lv_disp_flush_ready is called once it has been sent)
+void disp_spi_queue_colors(uint8_t * data, uint32_t length)
 {
     if (length == 0) {
-	return;
+        lv_disp_flush_ready(&_lv_refr_get_disp_refreshing()->driver);
+        return;
     }
 
-    while(spi_trans_in_progress);
+    disp_spi_queue(data, length, DISP_SPI_DC_DATA | DISP_SPI_FLUSH_END);
+}
 
-    spi_transaction_t t = {
-        .length = length * 8, // transaction length is in bits
-        .tx_buffer = data
-    };
-    
-    spi_trans_in_progress = true;
-    spi_color_sent = true;              //Mark the "lv_flush_ready" needs to be called in "spi_ready"
-    spi_device_queue_trans(spi, &t, portMAX_DELAY);
+
+// Pixel data sent outside of an LVGL flush
+void disp_spi_queue_data(const uint8_t * data, uint32_t length)
+{
+    if (length != 0) {
+        disp_spi_queue(data, length, DISP_SPI_DC_DATA);
+    }
+}
+
+
+void disp_spi_wait_idle(void)
+{
+    while (atomic_load(&trans_in_flight) != 0) {
+        xSemaphoreTake(trans_done_sem, portMAX_DELAY);
+    }
 }
 
 
 bool disp_spi_is_busy(void)
 {
-    return spi_trans_in_progress;
+    return (atomic_load(&trans_in_flight) != 0);
 }
 
 
@@ -151,11 +191,63 @@ bool disp_spi_is_busy(void)
  *   STATIC FUNCTIONS
  **********************/
 
+static void disp_spi_queue(const uint8_t * data, uint32_t length, uint32_t flags)
+{
+    spi_transaction_t * t;
+    spi_transaction_t * r;
+
+    // Wait for the oldest transaction (the one about to be reused) to complete
+    while (atomic_load(&trans_in_flight) >= DISP_SPI_QUEUE_LEN) {
+        xSemaphoreTake(trans_done_sem, portMAX_DELAY);
+    }
+
+    // Collect finished results so the driver's result queue never fills
+    while (spi_device_get_trans_result(spi, &r, 0) == ESP_OK) {}
+
+    t = &trans_pool[trans_next];
+    if (++trans_next == DISP_SPI_QUEUE_LEN) trans_next = 0;
+
+    memset(t, 0, sizeof(spi_transaction_t));
+    t->length = length * 8;          // transaction length is in bits
+    t->user = (void *) flags;
+    if (length <= 4) {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, data, length);
+    } else {
+        t->tx_buffer = data;
+    }
+
+    atomic_fetch_add(&trans_in_flight, 1);
+    if (spi_device_queue_trans(spi, t, portMAX_DELAY) != ESP_OK) {
+        atomic_fetch_sub(&trans_in_flight, 1);
+        if (flags & DISP_SPI_FLUSH_END) {
+            lv_disp_flush_ready(&_lv_refr_get_disp_refreshing()->driver);
+        }
+    }
+}
+
+
+static void IRAM_ATTR spi_pre (spi_transaction_t *trans)
+{
+    if (dc_gpio >= 0) {
+        gpio_set_level(dc_gpio, ((uint32_t) trans->user & DISP_SPI_DC_DATA) ? 1 : 0);
+    }
+    if (chained_pre_cb) chained_pre_cb(trans);
+}
+
+
 static void IRAM_ATTR spi_ready (spi_transaction_t *trans)
 {
-    spi_trans_in_progress = false;
+    BaseType_t higher_woken = pdFALSE;
 
-    lv_disp_t * disp = _lv_refr_get_disp_refreshing();
-    if (spi_color_sent) lv_disp_flush_ready(&disp->driver);
+    if ((uint32_t) trans->user & DISP_SPI_FLUSH_END) {
+        lv_disp_t * disp = _lv_refr_get_disp_refreshing();
+        RENDER_PROF_SPI_DONE();
+        lv_disp_flush_ready(&disp->driver);
+    }
     if (chained_post_cb) chained_post_cb(trans);
+
+    atomic_fetch_sub(&trans_in_flight, 1);
+    xSemaphoreGiveFromISR(trans_done_sem, &higher_woken);
+    if (higher_woken == pdTRUE) portYIELD_FROM_ISR();
 }
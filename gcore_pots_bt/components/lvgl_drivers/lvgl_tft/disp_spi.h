@@ -38,6 +38,9 @@ extern "C" {
 // Display SPI frequency
 #define DISP_SPI_HZ   80000000
 
+// Transactions that may be queued at once (enough for one complete flush)
+#define DISP_SPI_QUEUE_LEN 8
+
 
 /**********************
  *      TYPEDEFS
@@ -49,8 +52,11 @@ extern "C" {
 void disp_spi_init(void);
 void disp_spi_add_device(spi_host_device_t host);
 void disp_spi_add_device_config(spi_host_device_t host, spi_device_interface_config_t *devcfg);
-void disp_spi_send_data(uint8_t * data, uint16_t length);
-void disp_spi_send_colors(uint8_t * data, uint16_t length);
+void disp_spi_set_dc_gpio(int gpio);
+void disp_spi_queue_cmd(uint8_t cmd, const uint8_t * data, uint16_t length);
+void disp_spi_queue_colors(uint8_t * data, uint32_t length);
+void disp_spi_queue_data(const uint8_t * data, uint32_t length);
+void disp_spi_wait_idle(void);
 bool disp_spi_is_busy(void);
 
 /**********************
@@ -37,15 +37,15 @@ typedef struct {
 /**********************
  *  STATIC PROTOTYPES
  **********************/
-static void ili9488_send_cmd(uint8_t cmd);
-static void ili9488_send_data(void * data, uint16_t length);
-static void ili9488_send_color(void * data, uint16_t length);
+static void ili9488_send_cmd(uint8_t cmd, const void * data, uint16_t length);
+static void ili9488_set_window(const lv_area_t * area);
 
 
 
 /**********************
  *  STATIC VARIABLES
  **********************/
+static ili9488_power_t ili_power = ILI9488_PWR_NORMAL;
 
 /**********************
  *      MACROS
@@ -83,19 +83,19 @@ void ili9488_init(void)
 	//Initialize non-SPI GPIOs
 	gpio_reset_pin(ILI9488_DC);
 	gpio_set_direction(ILI9488_DC, GPIO_MODE_OUTPUT);
+	disp_spi_set_dc_gpio(ILI9488_DC);
 
 	ESP_LOGI(TAG, "ILI9488 initialization.");
 
 	// Exit sleep
-	ili9488_send_cmd(0x01);	/* Software reset */
+	ili9488_send_cmd(0x01, NULL, 0);	/* Software reset */
 	vTaskDelay(100 / portTICK_RATE_MS);
 	
 
 	//Send all the commands
 	uint16_t cmd = 0;
 	while (ili_init_cmds[cmd].databytes!=0xff) {
-		ili9488_send_cmd(ili_init_cmds[cmd].cmd);
-		ili9488_send_data(ili_init_cmds[cmd].data, ili_init_cmds[cmd].databytes&0x1F);
+		ili9488_send_cmd(ili_init_cmds[cmd].cmd, ili_init_cmds[cmd].data, ili_init_cmds[cmd].databytes&0x1F);
 		if (ili_init_cmds[cmd].databytes & 0x80) {
 			vTaskDelay(100 / portTICK_RATE_MS);
 		}
@@ -106,8 +106,7 @@ void ili9488_init(void)
 	uint8_t data[] = {0x68};
 	// this same command also sets rotation (portrait/landscape) and inverts colors.
 	// https://gist.github.com/motters/38a26a66020f674b6389063932048e4c#file-ili9844_defines-h-L24
-	ili9488_send_cmd(0x36);
-	ili9488_send_data(&data, 1);
+	ili9488_send_cmd(0x36, data, 1);
 #endif
 }
 
@@ -116,6 +115,82 @@ void ili9488_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * col
 {
     uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
 
+	/* The whole flush is queued at once; color_map stays valid until lv_disp_flush_ready */
+	ili9488_set_window(area);
+	disp_spi_queue_colors((uint8_t *) color_map, size * 2);
+}
+
+// Write pixels outside of an LVGL flush (color_map must stay valid until the SPI is idle)
+void ili9488_write(const lv_area_t * area, const lv_color_t * color_map)
+{
+    uint32_t size = lv_area_get_width(area) * lv_area_get_height(area);
+
+	ili9488_set_window(area);
+	disp_spi_queue_data((const uint8_t *) color_map, size * 2);
+}
+
+
+// Move the panel to a power state.  Idle mode only shows 8 colors (the MSB of each component)
+// and partial mode only scans rows y1-y2 (ignored in the other states), the rest of the panel
+// being driven to the non-display level set by DISPLAY_FUNCTION_CONTROL.  Both cut the panel's
+// power.  The frame memory is kept in sleep mode so the image is back as soon as it's left.
+void ili9488_set_power(ili9488_power_t state, int16_t y1, int16_t y2)
+{
+	uint8_t rows[] = {
+	    (uint8_t) (y1 >> 8) & 0xFF,
+	    (uint8_t) (y1) & 0xFF,
+	    (uint8_t) (y2 >> 8) & 0xFF,
+	    (uint8_t) (y2) & 0xFF,
+	};
+
+	if (ili_power == ILI9488_PWR_SLEEP) {
+		if (state == ILI9488_PWR_SLEEP) return;
+		ili9488_send_cmd(ILI9488_CMD_SLEEP_OUT, NULL, 0);
+		vTaskDelay(ILI9488_SLEEP_DELAY_MSEC / portTICK_RATE_MS);
+		ili9488_send_cmd(ILI9488_CMD_DISPLAY_ON, NULL, 0);
+	}
+
+	switch (state) {
+		case ILI9488_PWR_NORMAL:
+			ili9488_send_cmd(ILI9488_CMD_NORMAL_DISP_MODE_ON, NULL, 0);
+			ili9488_send_cmd(ILI9488_CMD_IDLE_MODE_OFF, NULL, 0);
+			break;
+		case ILI9488_PWR_IDLE:
+			ili9488_send_cmd(ILI9488_CMD_NORMAL_DISP_MODE_ON, NULL, 0);
+			ili9488_send_cmd(ILI9488_CMD_IDLE_MODE_ON, NULL, 0);
+			break;
+		case ILI9488_PWR_PARTIAL:
+			ili9488_send_cmd(ILI9488_CMD_PARTIAL_AREA, rows, 4);
+			ili9488_send_cmd(ILI9488_CMD_PARTIAL_MODE_ON, NULL, 0);
+			ili9488_send_cmd(ILI9488_CMD_IDLE_MODE_ON, NULL, 0);
+			break;
+		case ILI9488_PWR_SLEEP:
+			ili9488_send_cmd(ILI9488_CMD_DISPLAY_OFF, NULL, 0);
+			ili9488_send_cmd(ILI9488_CMD_ENTER_SLEEP_MODE, NULL, 0);
+			vTaskDelay(ILI9488_SLEEP_DELAY_MSEC / portTICK_RATE_MS);
+			break;
+	}
+
+	ili_power = state;
+}
+
+
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+// Init commands are sent one at a time since their parameters live on the caller's stack
+static void ili9488_send_cmd(uint8_t cmd, const void * data, uint16_t length)
+{
+    disp_spi_queue_cmd(cmd, data, length);
+    disp_spi_wait_idle();
+}
+
+// Queue the commands starting a memory write to area (the addresses are copied into their
+// transactions)
+static void ili9488_set_window(const lv_area_t * area)
+{
 	/* Column addresses  */
 	uint8_t xb[] = {
 	    (uint8_t) (area->x1 >> 8) & 0xFF,
@@ -133,43 +208,11 @@ void ili9488_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * col
 	};
 
 	/*Column addresses*/
-	ili9488_send_cmd(ILI9488_CMD_COLUMN_ADDRESS_SET);
-	ili9488_send_data(xb, 4);
+	disp_spi_queue_cmd(ILI9488_CMD_COLUMN_ADDRESS_SET, xb, 4);
 
 	/*Page addresses*/
-	ili9488_send_cmd(ILI9488_CMD_PAGE_ADDRESS_SET);
-	ili9488_send_data(yb, 4);
+	disp_spi_queue_cmd(ILI9488_CMD_PAGE_ADDRESS_SET, yb, 4);
 
 	/*Memory write*/
-	ili9488_send_cmd(ILI9488_CMD_MEMORY_WRITE);
-	ili9488_send_color((void *) color_map, size * 2);
-}
-
-
-
-/**********************
- *   STATIC FUNCTIONS
- **********************/
-
-
-static void ili9488_send_cmd(uint8_t cmd)
-{
-	  while(disp_spi_is_busy()) {}
-	  gpio_set_level(ILI9488_DC, 0);	 /*Command mode*/
-	  disp_spi_send_data(&cmd, 1);
+	disp_spi_queue_cmd(ILI9488_CMD_MEMORY_WRITE, NULL, 0);
 }
-
-static void ili9488_send_data(void * data, uint16_t length)
-{
-	  while(disp_spi_is_busy()) {}
-	  gpio_set_level(ILI9488_DC, 1);	 /*Data mode*/
-	  disp_spi_send_data(data, length);
-}
-
-static void ili9488_send_color(void * data, uint16_t length)
-{
-		while(disp_spi_is_busy()) {}
-    gpio_set_level(ILI9488_DC, 1);   /*Data mode*/
-    disp_spi_send_colors(data, length);
-}
-
@@ -26,6 +26,9 @@ extern "C" {
 // if text/images are backwards, try setting this to 1
 #define ILI9488_INVERT_DISPLAY 0
 
+// Wait after entering or leaving sleep mode before the next sleep command
+#define ILI9488_SLEEP_DELAY_MSEC 120
+
 /*******************
  * ILI9488 REGS
 *********************/
@@ -131,7 +134,12 @@ extern "C" {
 /**********************
  *      TYPEDEFS
  **********************/
-
+typedef enum {
+    ILI9488_PWR_NORMAL = 0,   /* Full color, whole panel */
+    ILI9488_PWR_IDLE,         /* 8-color idle mode, whole panel */
+    ILI9488_PWR_PARTIAL,      /* 8-color idle mode, only the partial rows */
+    ILI9488_PWR_SLEEP,        /* Display off and sleep mode (frame memory kept) */
+} ili9488_power_t;
 
 
 /**********************
@@ -139,6 +147,8 @@ extern "C" {
  **********************/
 void ili9488_init(void);
 void ili9488_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map);
+void ili9488_write(const lv_area_t * area, const lv_color_t * color_map);
+void ili9488_set_power(ili9488_power_t state, int16_t y1, int16_t y2);
 
 
 
@@ -17,6 +17,7 @@
  * along with this software.  If not, see <https://www.gnu.org/licenses/>.
  */
 #include <esp_log.h>
+#include <string.h>
 #include "esp_heap_caps.h"
 #include "mem_fb.h"
 
@@ -24,6 +25,11 @@
 static const char* TAG = "mem_fb";
 static lv_color_t* fb;
 
+// Pixels written since the buffer stopped matching the display.  It is trusted again
+// once a full frame's worth has been flushed (LVGL redraws the whole screen after an
+// invalidate).
+static uint32_t diff_fill_count;
+
 
 
 // API
@@ -46,6 +52,9 @@ void mem_fb_init()
 	if (fb == NULL) {
 		ESP_LOGE(TAG, "malloc %d mem_fb bytes failed", (MEM_FB_W*MEM_FB_H)*mult);
 	}
+	
+	// Neither the buffer nor the display hold a known image yet
+	diff_fill_count = 0;
 }
 
 
@@ -91,4 +100,107 @@ void mem_fb_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * colo
 uint8_t* mem_fb_get_buffer()
 {
 	return (uint8_t*) fb;
-}
\ No newline at end of file
+}
+
+
+// Call when the display may no longer match the buffer
+void mem_fb_diff_invalidate()
+{
+	diff_fill_count = 0;
+}
+
+
+// Updates the buffer, holding the image on the display, with an area about to be flushed
+// and finds the changed part.  Returns false if nothing changed.  Otherwise dirty is set to
+// the bounding rectangle of the changed tiles and, if smaller than area, color_map is
+// compacted in place to hold just that rectangle.
+bool mem_fb_diff(const lv_area_t * area, lv_color_t * color_map, lv_area_t * dirty)
+{
+	int16_t x, y, xe;
+	int16_t w = lv_area_get_width(area);
+	int16_t dw;
+	uint32_t n;
+	lv_color_t* cmP;
+	lv_color_t* fbP;
+	
+	*dirty = *area;
+	if (fb == NULL) {
+		return true;
+	}
+	
+	// Copy the whole area until the buffer is known to match the display
+	if (diff_fill_count < (MEM_FB_W*MEM_FB_H)) {
+		for (y=area->y1; y<=area->y2; y++) {
+			memcpy(fb + (y * MEM_FB_W) + area->x1, color_map + ((y - area->y1) * w), w * sizeof(lv_color_t));
+		}
+		diff_fill_count += lv_area_get_size(area);
+		return true;
+	}
+	
+	// Compare each line a tile at a time, copying the changed tiles
+	dirty->x1 = area->x2 + 1;
+	dirty->x2 = area->x1 - 1;
+	dirty->y1 = area->y2 + 1;
+	dirty->y2 = area->y1 - 1;
+	for (y=area->y1; y<=area->y2; y++) {
+		cmP = color_map + ((y - area->y1) * w);
+		fbP = fb + (y * MEM_FB_W) + area->x1;
+		x = area->x1;
+		while (x <= area->x2) {
+			xe = x | (MEM_FB_TILE_W - 1);
+			if (xe > area->x2) xe = area->x2;
+			n = (xe - x + 1) * sizeof(lv_color_t);
+			if (memcmp(fbP, cmP, n) != 0) {
+				memcpy(fbP, cmP, n);
+				if (x < dirty->x1) dirty->x1 = x;
+				if (xe > dirty->x2) dirty->x2 = xe;
+				if (y < dirty->y1) dirty->y1 = y;
+				dirty->y2 = y;
+			}
+			cmP += xe - x + 1;
+			fbP += xe - x + 1;
+			x = xe + 1;
+		}
+	}
+	
+	if (dirty->y2 < dirty->y1) {
+		return false;
+	}
+	
+	// Move the changed rectangle to the start of color_map (destination never passes source)
+	dw = lv_area_get_width(dirty);
+	if (dw != w) {
+		cmP = color_map;
+		for (y=dirty->y1; y<=dirty->y2; y++) {
+			memmove(cmP, color_map + ((y - area->y1) * w) + (dirty->x1 - area->x1), dw * sizeof(lv_color_t));
+			cmP += dw;
+		}
+	} else if (dirty->y1 != area->y1) {
+		memmove(color_map, color_map + ((dirty->y1 - area->y1) * w), lv_area_get_size(dirty) * sizeof(lv_color_t));
+	}
+	
+	return true;
+}
+
+
+// Copies the image on the display into frame (MEM_FB_W*MEM_FB_H pixels).  Returns false if
+// the buffer isn't known to match the display.
+bool mem_fb_save(lv_color_t * frame)
+{
+	if ((fb == NULL) || (diff_fill_count < (MEM_FB_W*MEM_FB_H))) {
+		return false;
+	}
+	
+	memcpy(frame, fb, (MEM_FB_W*MEM_FB_H) * sizeof(lv_color_t));
+	return true;
+}
+
+
+// Call once frame has been sent to the display so following flushes are diffed against it
+void mem_fb_restore(const lv_color_t * frame)
+{
+	if (fb != NULL) {
+		memcpy(fb, frame, (MEM_FB_W*MEM_FB_H) * sizeof(lv_color_t));
+		diff_fill_count = MEM_FB_W*MEM_FB_H;
+	}
+}
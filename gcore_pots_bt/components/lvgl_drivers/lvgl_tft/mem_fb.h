@@ -28,11 +28,19 @@
 // Bits per pixel (supports 8, 16 or 32)
 #define MEM_FB_BPP 16
 
+// Width of the tiles compared on each line when diffing against the previous frame
+// (pixels, power of 2)
+#define MEM_FB_TILE_W 16
+
 
 // API
 void mem_fb_init();
 void mem_fb_flush(lv_disp_drv_t * drv, const lv_area_t * area, lv_color_t * color_map);
 uint8_t* mem_fb_get_buffer();
+void mem_fb_diff_invalidate();
+bool mem_fb_diff(const lv_area_t * area, lv_color_t * color_map, lv_area_t * dirty);
+bool mem_fb_save(lv_color_t * frame);
+void mem_fb_restore(const lv_color_t * frame);
 
 
 #endif // MEM_FB_H_
\ No newline at end of file
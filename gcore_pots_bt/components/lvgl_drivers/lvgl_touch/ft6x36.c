@@ -18,11 +18,17 @@
 * SOFTWARE.
 */
 
+#include <esp_attr.h>
 #include <esp_log.h>
+#include <driver/gpio.h>
 #include <driver/i2c.h>
 #include "lvgl.h"
 #include "ft6x36.h"
 #include "i2c.h"
+#include "touch_lat.h"
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+#include "esp_timer.h"
+#endif
 
 #define TAG "FT6X36"
 
@@ -32,6 +38,13 @@
 //#define CONFIG_FT6X36_INVERT_X
 //#define CONFIG_FT6X36_INVERT_Y
 
+// GPIO connected to the INT output (-1 to poll the controller over I2C)
+#ifdef CONFIG_FT6X36_INT_GPIO
+#define FT6X36_INT_GPIO CONFIG_FT6X36_INT_GPIO
+#else
+#define FT6X36_INT_GPIO -1
+#endif
+
 
 
 // Global variables
@@ -39,12 +52,22 @@ ft6x36_status_t ft6x36_status;
 uint8_t current_dev_addr;       // set during init
 bool saw_touch = false;
 
+// Set by the INT falling edge so a touch shorter than the read interval isn't lost
+static volatile bool int_seen = false;
+static bool last_pressed = false;
+
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+// Time of the last INT falling edge (when a touch started)
+static volatile int64_t int_usec = 0;
+#endif
+
 
 
 // Forward Declarations
 static esp_err_t ft6x36_i2c_read8(uint8_t slave_addr, uint8_t register_addr, uint8_t *data_buf);
-static esp_err_t ft6x36_i2c_read16(uint8_t slave_addr, uint8_t register_addr, uint16_t *data_buf);
 static esp_err_t ft6x36_i2c_write8(uint8_t slave_addr, uint8_t register_addr, uint8_t data_buf);
+static void ft6x36_int_init();
+static void IRAM_ATTR ft6x36_int_isr(void* arg);
 
 
 
@@ -100,6 +123,10 @@ void ft6x36_init(uint16_t dev_addr) {
         ESP_LOGI(TAG, "\tRelease code: 0x%02x", data_buf);
         
         ft6x36_i2c_write8(dev_addr, FT6X36_TH_GROUP_REG, FT62X36_DEFAULT_THRESHOLD);
+        
+        if (FT6X36_INT_GPIO >= 0) {
+            ft6x36_int_init();
+        }
     }
 }
 
@@ -111,13 +138,31 @@ void ft6x36_init(uint16_t dev_addr) {
   */
 bool ft6x36_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
 	esp_err_t ret;
+	uint8_t reg_addr = FT6X36_TD_STAT_REG;
+	uint8_t buf[5];               // TD_STAT through P1_YL in one burst
     uint8_t touch_pnt_cnt;        // Number of detected touch points
     uint16_t cur_x;
     uint16_t cur_y;
     static int16_t last_x = 0;  // 12bit pixel value
     static int16_t last_y = 0;  // 12bit pixel value
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+    bool was_pressed = last_pressed;
+#endif
+
+    // With an INT line the bus is only read while the controller reports a touch (or just
+    // after one), otherwise the cached release is returned
+    if (FT6X36_INT_GPIO >= 0) {
+        if (!int_seen && !last_pressed && (gpio_get_level(FT6X36_INT_GPIO) == 1)) {
+            data->point.x = last_x;
+            data->point.y = last_y;
+            data->state = LV_INDEV_STATE_REL;
+            return false;
+        }
+        int_seen = false;
+    }
+    last_pressed = false;
 
-    ret = ft6x36_i2c_read8(current_dev_addr, FT6X36_TD_STAT_REG, &touch_pnt_cnt);
+    ret = i2c_write_read(I2C_CLIENT_TOUCH, current_dev_addr, &reg_addr, 1, buf, sizeof(buf));
     if (ret != ESP_OK) {
     	// There is an occasional failure of this read (perhaps from the FT6236 clock
     	// stretching) so we ignore failures (otherwise touch_pnt_cnt seems corrupted and
@@ -128,6 +173,7 @@ bool ft6x36_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
         data->state = LV_INDEV_STATE_REL;   // no touch detected
         return false;
     }
+    touch_pnt_cnt = buf[0];
     if (touch_pnt_cnt != 1) {    // ignore no touch & multi touch
         data->point.x = last_x;
         data->point.y = last_y;
@@ -135,25 +181,8 @@ bool ft6x36_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
         return false;
     }
 	
-    // Read X value
-    ret = ft6x36_i2c_read16(current_dev_addr, FT6X36_P1_XH_REG, &cur_x);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Error getting X coordinates: %s", esp_err_to_name(ret));
-        data->point.x = last_x;
-        data->point.y = last_y;
-        data->state = LV_INDEV_STATE_REL;   // no touch detected
-        return false;
-    }
-
-    // Read Y value
-    ret = ft6x36_i2c_read16(current_dev_addr, FT6X36_P1_YH_REG, &cur_y);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Error getting Y coordinates: %s", esp_err_to_name(ret));
-        data->point.x = last_x;
-        data->point.y = last_y;
-        data->state = LV_INDEV_STATE_REL;   // no touch detected
-        return false;
-    }
+    cur_x = (buf[FT6X36_P1_XH_REG - FT6X36_TD_STAT_REG] << 8) | buf[FT6X36_P1_XL_REG - FT6X36_TD_STAT_REG];
+    cur_y = (buf[FT6X36_P1_YH_REG - FT6X36_TD_STAT_REG] << 8) | buf[FT6X36_P1_YL_REG - FT6X36_TD_STAT_REG];
 
 	last_x = cur_x & ((FT6X36_MSB_MASK << 8) | FT6X36_LSB_MASK);
 	last_y = cur_y & ((FT6X36_MSB_MASK << 8) | FT6X36_LSB_MASK);
@@ -173,6 +202,13 @@ bool ft6x36_read(lv_indev_drv_t *drv, lv_indev_data_t *data) {
     data->point.y = last_y;
     data->state = LV_INDEV_STATE_PR;
     saw_touch = true;
+    last_pressed = true;
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+    if (!was_pressed) {
+        // A new touch, timed from when the controller signaled it if possible
+        touch_lat_touch(((FT6X36_INT_GPIO >= 0) && (int_usec != 0)) ? int_usec : esp_timer_get_time());
+    }
+#endif
     //ESP_LOGV(TAG, "  X=%d Y=%d", data->point.x, data->point.y);
     //ESP_LOGI(TAG, "  X=%d Y=%d", data->point.x, data->point.y);
     return false;
@@ -198,79 +234,50 @@ bool ft6x36_saw_touch()
 
 // Internal Routines
 /**
- * Read/write register routines for use below
+ * Configure the controller to hold INT low while touched and watch for it going low
  */
-static esp_err_t ft6x36_i2c_read8(uint8_t slave_addr, uint8_t register_addr, uint8_t *data_buf) {
-	uint8_t buf;
-	esp_err_t ret;
-	
-	i2c_lock();
-	
-   // Write the register address
-   	ret = i2c_master_write_slave(slave_addr, &register_addr, 1);
-   	if (ret != ESP_OK) {
-   		i2c_unlock();
-   		return ret;
-   	}
-
-	// Read the register
-	ret = i2c_master_read_slave(slave_addr, &buf, 1);
-	if (ret != ESP_OK) {
-		i2c_unlock();
-		return ret;
-	}
-	
-	i2c_unlock();
+static void ft6x36_int_init() {
+    esp_err_t ret;
+
+    ft6x36_i2c_write8(current_dev_addr, FT6X36_G_MODE_REG, FT6X36_G_MODE_POLLING);
 
-	*data_buf = buf;
-    return ret;
+    gpio_reset_pin(FT6X36_INT_GPIO);
+    gpio_set_direction(FT6X36_INT_GPIO, GPIO_MODE_INPUT);
+    gpio_set_pull_mode(FT6X36_INT_GPIO, GPIO_PULLUP_ONLY);
+    gpio_set_intr_type(FT6X36_INT_GPIO, GPIO_INTR_NEGEDGE);
+    ret = gpio_install_isr_service(0);
+    if ((ret != ESP_OK) && (ret != ESP_ERR_INVALID_STATE)) {
+        // ESP_ERR_INVALID_STATE means another module already installed it
+        ESP_LOGE(TAG, "Install GPIO ISR service failed - %d", ret);
+    }
+    ret = gpio_isr_handler_add(FT6X36_INT_GPIO, ft6x36_int_isr, NULL);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Add INT ISR failed - %d", ret);
+    }
 }
 
 
-static esp_err_t ft6x36_i2c_read16(uint8_t slave_addr, uint8_t register_addr, uint16_t *data_buf) {
-	uint8_t buf[2];
-	esp_err_t ret;
-	
-	i2c_lock();
-	
-   // Write the register address
-   	ret = i2c_master_write_slave(slave_addr, &register_addr, 1);
-   	if (ret != ESP_OK) {
-   		i2c_unlock();
-   		return ret;
-   	}
-
-	// Read the register
-	ret = i2c_master_read_slave(slave_addr, buf, 2);
-	if (ret != ESP_OK) {
-		i2c_unlock();
-		return ret;
-	}
-	
-	i2c_unlock();
+static void IRAM_ATTR ft6x36_int_isr(void* arg) {
+    int_seen = true;
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+    int_usec = esp_timer_get_time();
+#endif
+}
 
-	*data_buf = (buf[0] << 8) | buf[1];
-    return ret;
+
+/**
+ * Read/write register routines for use below
+ */
+static esp_err_t ft6x36_i2c_read8(uint8_t slave_addr, uint8_t register_addr, uint8_t *data_buf) {
+    return i2c_write_read(I2C_CLIENT_TOUCH, slave_addr, &register_addr, 1, data_buf, 1);
 }
 
 
 static esp_err_t ft6x36_i2c_write8(uint8_t slave_addr, uint8_t register_addr, uint8_t data_buf) {
 	uint8_t buf[2];
-	esp_err_t ret;
 	
 	buf[0] = register_addr;
 	buf[1] = data_buf;
 	
-	i2c_lock();
-	
-   // Write the register
-   	ret = i2c_master_write_slave(slave_addr, buf, 2);
-   	if (ret != ESP_OK) {
-   		i2c_unlock();
-   		return ret;
-   	}
-	
-	i2c_unlock();
-
-    return ret;
+    return i2c_write_read(I2C_CLIENT_TOUCH, slave_addr, buf, 2, NULL, 0);
 }
@@ -132,6 +132,10 @@ extern "C" {
 
 #define FT6X36_CHIPSELECT_REG            0xA3       /* 0x36 for ft6236; 0x06 for ft6206 */
 
+#define FT6X36_G_MODE_REG                0xA4       /* Interrupt mode */
+#define FT6X36_G_MODE_POLLING            0x00       /* INT held low while touched */
+#define FT6X36_G_MODE_TRIGGER            0x01       /* INT pulsed for each report */
+
 #define FT6X36_POWER_MODE_REG            0xA5
 #define FT6X36_FIRMWARE_ID_REG           0xA6
 #define FT6X36_RELEASECODE_REG           0xAF
@@ -34,6 +34,7 @@
 #include <math.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "fast_convert.h"
 #include "logging.h"
 #include "queue.h"
@@ -410,7 +411,7 @@ SPAN_DECLARE(adsi_rx_state_t *) adsi_rx_init(adsi_rx_state_t *s,
 {
     if (s == NULL)
     {
-        if ((s = (adsi_rx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (adsi_rx_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -449,7 +450,7 @@ SPAN_DECLARE(int) adsi_rx_release(adsi_rx_state_t *s)
 
 SPAN_DECLARE(int) adsi_rx_free(adsi_rx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -640,7 +641,7 @@ SPAN_DECLARE(adsi_tx_state_t *) adsi_tx_init(adsi_tx_state_t *s, int standard)
 {
     if (s == NULL)
     {
-        if ((s = (adsi_tx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (adsi_tx_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -670,7 +671,7 @@ SPAN_DECLARE(int) adsi_tx_release(adsi_tx_state_t *s)
 
 SPAN_DECLARE(int) adsi_tx_free(adsi_tx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -0,0 +1,66 @@
+/*
+ * SpanDSP - a series of DSP components for telephony
+ *
+ * alloc.c - memory allocation handling.
+ *
+ * Written by Steve Underwood <steveu@coppice.org>
+ *
+ * Copyright (C) 2013 Steve Underwood
+ *
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License version 2.1,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*! \file */
+
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "telephony.h"
+#include "alloc.h"
+
+static span_alloc_t __span_alloc = malloc;
+static span_realloc_t __span_realloc = realloc;
+static span_free_t __span_free = free;
+
+SPAN_DECLARE(void *) span_alloc(size_t size)
+{
+    return __span_alloc(size);
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(void *) span_realloc(void *ptr, size_t size)
+{
+    return __span_realloc(ptr, size);
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(void) span_free(void *ptr)
+{
+    __span_free(ptr);
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(int) span_mem_allocators(span_alloc_t custom_alloc,
+                                      span_realloc_t custom_realloc,
+                                      span_free_t custom_free)
+{
+    __span_alloc = (custom_alloc)  ?  custom_alloc  :  malloc;
+    __span_realloc = (custom_realloc)  ?  custom_realloc  :  realloc;
+    __span_free = (custom_free)  ?  custom_free  :  free;
+    return 0;
+}
+/*- End of function --------------------------------------------------------*/
+/*- End of file ------------------------------------------------------------*/
@@ -0,0 +1,84 @@
+/*
+ * SpanDSP - a series of DSP components for telephony
+ *
+ * alloc.h - memory allocation handling.
+ *
+ * Written by Steve Underwood <steveu@coppice.org>
+ *
+ * Copyright (C) 2013 Steve Underwood
+ *
+ * All rights reserved.
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License version 2.1,
+ * as published by the Free Software Foundation.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with this program; if not, write to the Free Software
+ * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
+ */
+
+/*! \file */
+
+/*! \page alloc_page Memory allocation
+\section alloc_page_sec_1 What does it do?
+All memory spandsp allocates for itself goes through span_alloc(), span_realloc()
+and span_free(). These default to the C library's malloc(), realloc() and free(),
+but an application can install its own allocators with span_mem_allocators()
+(for example to take the memory from a pool sized when the system starts).
+
+Custom allocators must be installed before any spandsp object is created, and
+must be safe to call from every thread that creates or frees spandsp objects.
+*/
+
+#if !defined(_SPANDSP_ALLOC_H_)
+#define _SPANDSP_ALLOC_H_
+
+#include <stddef.h>
+
+#include "telephony.h"
+
+typedef void *(*span_alloc_t)(size_t size);
+typedef void *(*span_realloc_t)(void *ptr, size_t size);
+typedef void (*span_free_t)(void *ptr);
+
+#if defined(__cplusplus)
+extern "C"
+{
+#endif
+
+/*! \brief Allocate memory for a spandsp object.
+    \param size The number of bytes required.
+    \return A pointer to the memory, or NULL if none is available. */
+SPAN_DECLARE(void *) span_alloc(size_t size);
+
+/*! \brief Resize memory allocated by span_alloc().
+    \param ptr The current allocation, or NULL.
+    \param size The number of bytes required.
+    \return A pointer to the resized memory, or NULL if none is available (ptr is untouched). */
+SPAN_DECLARE(void *) span_realloc(void *ptr, size_t size);
+
+/*! \brief Free memory allocated by span_alloc() or span_realloc().
+    \param ptr The memory to be freed. NULL is ignored. */
+SPAN_DECLARE(void) span_free(void *ptr);
+
+/*! \brief Replace the memory allocators used by spandsp.
+    \param custom_alloc The replacement for malloc(), or NULL for malloc().
+    \param custom_realloc The replacement for realloc(), or NULL for realloc().
+    \param custom_free The replacement for free(), or NULL for free().
+    \return 0. */
+SPAN_DECLARE(int) span_mem_allocators(span_alloc_t custom_alloc,
+                                      span_realloc_t custom_realloc,
+                                      span_free_t custom_free);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif
+/*- End of file ------------------------------------------------------------*/
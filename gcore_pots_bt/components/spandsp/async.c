@@ -31,6 +31,7 @@
 #include <assert.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "async.h"
 
 
@@ -85,7 +86,7 @@ SPAN_DECLARE(async_rx_state_t *) async_rx_init(async_rx_state_t *s,
 {
     if (s == NULL)
     {
-        if ((s = (async_rx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (async_rx_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     s->data_bits = data_bits;
@@ -114,7 +115,7 @@ SPAN_DECLARE(int) async_rx_release(async_rx_state_t *s)
 
 SPAN_DECLARE(int) async_rx_free(async_rx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -210,7 +211,7 @@ SPAN_DECLARE(async_tx_state_t *) async_tx_init(async_tx_state_t *s,
 {
     if (s == NULL)
     {
-        if ((s = (async_tx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (async_tx_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     /* We have a use_v14 parameter for completeness, but right now V.14 only
@@ -240,7 +241,7 @@ SPAN_DECLARE(int) async_tx_release(async_tx_state_t *s)
 
 SPAN_DECLARE(int) async_tx_free(async_tx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
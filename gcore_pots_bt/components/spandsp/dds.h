@@ -31,16 +31,25 @@
 #define DDS_PHASE_RATE(frequency) (int32_t) ((frequency)*65536.0f*65536.0f/SAMPLE_RATE)
 #define DDS_PHASE(angle) (int32_t) ((uint32_t) (((angle < 0.0f)  ?  (360.0f + angle)  :  angle)*65536.0f*65536.0f/360.0f))
 
+/* The tone, DTMF and FSK generators can use the integer DDS only, with their gains
+   scaled to Q15 once at setup, independently of SPANDSP_USE_FIXED_POINT.  The
+   floating point DDS (dds_float.c) is then not built. */
+#if defined(SPANDSP_USE_FIXED_POINT)  &&  !defined(SPANDSP_DDS_FIXED_POINT)
+#define SPANDSP_DDS_FIXED_POINT
+#endif
+
 #if defined(__cplusplus)
 extern "C"
 {
 #endif
 
+#if !defined(SPANDSP_DDS_FIXED_POINT)
 /*! \brief Convert a 32 bit phase angle to an angle in radians, between 0 and 2*PI
     \param phase The angle to convert.
     \return The angle in radians.
 */
 SPAN_DECLARE(float) dds_phase_to_radians(uint32_t phase);
+#endif
 
 /*! \brief Find the phase rate value to achieve a particular frequency.
     \param frequency The desired frequency, in Hz.
@@ -184,6 +193,7 @@ SPAN_DECLARE(complexi32_t) dds_complexi32(uint32_t *phase_acc, int32_t phase_rat
 */
 SPAN_DECLARE(complexi32_t) dds_complexi32_mod(uint32_t *phase_acc, int32_t phase_rate, int16_t scale, int32_t phase);
 
+#if !defined(SPANDSP_DDS_FIXED_POINT)
 /*! \brief Find the phase rate equivalent to a frequency, in Hz.
     \param frequency The frequency, in Hz.
     \return The equivalent phase rate.
@@ -257,6 +267,7 @@ SPAN_DECLARE(complexf_t) dds_lookup_complexf(uint32_t phase_acc);
     \return The complex signal amplitude, between (-1.0, -1.0) and (1.0, 1.0).
 */
 SPAN_DECLARE(complexf_t) dds_complex_modf(uint32_t *phase_acc, int32_t phase_rate, float scale, int32_t phase);
+#endif
 
 #if defined(__cplusplus)
 }
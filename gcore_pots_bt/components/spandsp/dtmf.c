@@ -33,6 +33,7 @@
 #include <limits.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "logging.h"
 #include "fast_convert.h"
 #include "queue.h"
@@ -48,15 +49,32 @@
 #define DEFAULT_DTMF_TX_ON_TIME     50
 #define DEFAULT_DTMF_TX_OFF_TIME    55
 
-#if defined(SPANDSP_USE_FIXED_POINT)
-#define DTMF_THRESHOLD              10438           /* -42dBm0 */
-#define DTMF_NORMAL_TWIST           6.309f          /* 8dB */
-#define DTMF_REVERSE_TWIST          2.512f          /* 4dB */
-#define DTMF_RELATIVE_PEAK_ROW      6.309f          /* 8dB */
-#define DTMF_RELATIVE_PEAK_COL      6.309f          /* 8dB */
-#define DTMF_TO_TOTAL_ENERGY        83.868f         /* -0.85dB */
-#define DTMF_POWER_OFFSET           68.251f         /* 10*log(256.0*256.0*DTMF_SAMPLES_PER_BLOCK) */
-#define DTMF_SAMPLES_PER_BLOCK      102
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+/* Input samples are scaled down by DTMF_AMP_SHIFT bits before entering the Goertzels. This is
+   the most resolution that keeps the 32 bit Goertzel states from overflowing with a full scale
+   (even a clipped, square) input. A Goertzel result here is 2^(2*DTMF_AMP_SHIFT + 1)
+   times smaller than in the floating point build (the result is not doubled, to keep it
+   within 31 bits), and the total energy is 2^(2*DTMF_AMP_SHIFT) times smaller. The ratios used in the tests
+   are in Q8. */
+#define DTMF_AMP_SHIFT              DTMF_RX_BANK_AMP_SHIFT
+#define DTMF_THRESHOLD              20878           /* -42dBm0 [171032462.0/2^13] */
+#define DTMF_NORMAL_TWIST           1615            /* 8dB [6.309*256] */
+#define DTMF_REVERSE_TWIST          643             /* 4dB [2.512*256] */
+#define DTMF_RELATIVE_PEAK_ROW      1615            /* 8dB */
+#define DTMF_RELATIVE_PEAK_COL      1615            /* 8dB */
+#define DTMF_TO_TOTAL_ENERGY        10735           /* -0.85dB [83.868*256/2] */
+#define DTMF_POWER_OFFSET           74.271f         /* 10*log(512.0*512.0*DTMF_SAMPLES_PER_BLOCK) */
+#define DTMF_SAMPLES_PER_BLOCK      DTMF_RX_BANK_BLOCK_LEN
+/* Samples run through the dial tone filter at a time */
+#define DTMF_FILTER_CHUNK           64
+
+typedef int32_t dtmf_energy_t;
+/* a*ratio > b, with a Q8 ratio */
+#define DTMF_RATIO_GREATER(a, ratio, b)     ((int64_t) (a)*(ratio) > ((int64_t) (b) << 8))
+/* row + col > DTMF_TO_TOTAL_ENERGY*energy */
+#define DTMF_TOTAL_ENERGY_TEST(row, col, energy) \
+    ((((int64_t) (row) + (col)) << 8) > (int64_t) DTMF_TO_TOTAL_ENERGY*(energy))
+#define DTMF_TO_TOTAL_ENERGY_RATIO          (DTMF_TO_TOTAL_ENERGY/256.0f)
 #else
 #define DTMF_THRESHOLD              171032462.0f    /* -42dBm0 [((DTMF_SAMPLES_PER_BLOCK*32768.0/1.4142)*10^((-42 - DBM0_MAX_SINE_POWER)/20.0))^2 => 171032462.0] */
 #define DTMF_NORMAL_TWIST           6.309f          /* 8dB [10^(8/10) => 6.309] */
@@ -66,6 +84,12 @@
 #define DTMF_TO_TOTAL_ENERGY        83.868f         /* -0.85dB [DTMF_SAMPLES_PER_BLOCK*10^(-0.85/10.0)] */
 #define DTMF_POWER_OFFSET           110.395f        /* 10*log(32768.0*32768.0*DTMF_SAMPLES_PER_BLOCK) */
 #define DTMF_SAMPLES_PER_BLOCK      102
+
+typedef float dtmf_energy_t;
+#define DTMF_RATIO_GREATER(a, ratio, b)     ((a)*(ratio) > (b))
+#define DTMF_TOTAL_ENERGY_TEST(row, col, energy) \
+    (((row) + (col)) > DTMF_TO_TOTAL_ENERGY*(energy))
+#define DTMF_TO_TOTAL_ENERGY_RATIO          DTMF_TO_TOTAL_ENERGY
 #endif
 
 static const float dtmf_row[] =
@@ -79,35 +103,323 @@ static const float dtmf_col[] =
 
 static const char dtmf_positions[] = "123A" "456B" "789C" "*0#D";
 
+#if !defined(SPANDSP_DTMF_RX_FIXED_POINT)
 static goertzel_descriptor_t dtmf_detect_row[4];
 static goertzel_descriptor_t dtmf_detect_col[4];
+#endif
 
 static int dtmf_tx_inited = FALSE;
 static tone_gen_descriptor_t dtmf_digit_tones[16];
 
+/* Work out the quality report of a digit that just ended from its weakest block. This only
+   runs once per digit so floating point is used, even in the fixed point receiver. */
+static void dtmf_rx_quality_report(dtmf_rx_state_t *s, uint8_t digit)
+{
+    dtmf_rx_quality_t q;
+    float row;
+    float col;
+    float energy;
+
+    row = s->quality_weak[0];
+    col = s->quality_weak[1];
+    energy = s->quality_weak[2];
+    q.digit = (char) digit;
+    q.duration = s->quality_blocks*DTMF_SAMPLES_PER_BLOCK;
+    q.blocks = s->quality_blocks;
+    q.hit_blocks = s->quality_hit_blocks;
+    q.row_level = lfastrintf(100.0f*log10f(row/DTMF_TO_TOTAL_ENERGY_RATIO) - 10.0f*(DTMF_POWER_OFFSET - DBM0_MAX_POWER));
+    q.col_level = lfastrintf(100.0f*log10f(col/DTMF_TO_TOTAL_ENERGY_RATIO) - 10.0f*(DTMF_POWER_OFFSET - DBM0_MAX_POWER));
+    q.twist = lfastrintf(100.0f*log10f(row/col));
+    q.level_margin = lfastrintf(100.0f*log10f(((row < col)  ?  row  :  col)/(float) s->threshold));
+    q.snr_margin = (energy > 0)  ?  lfastrintf(100.0f*log10f((row + col)/(DTMF_TO_TOTAL_ENERGY_RATIO*energy)))  :  999;
+    s->quality_callback(s->quality_callback_data, &q);
+}
+/*- End of function --------------------------------------------------------*/
+
+/* Follow the blocks of the digit being received, given the block's unconfirmed hit and the
+   digit being received before it. Only a few compares per block. */
+static void dtmf_rx_quality_track(dtmf_rx_state_t *s, uint8_t hit, uint8_t prev_digit, dtmf_energy_t row, dtmf_energy_t col)
+{
+    dtmf_energy_t weakest;
+
+    if (prev_digit  &&  s->in_digit != prev_digit)
+        dtmf_rx_quality_report(s, prev_digit);
+    if (s->in_digit  &&  s->in_digit != prev_digit)
+    {
+        /* Confirmed by this block and the last, start from the weaker of the two */
+        if (((row < col)  ?  row  :  col) < ((s->quality_last[0] < s->quality_last[1])  ?  s->quality_last[0]  :  s->quality_last[1]))
+        {
+            s->quality_weak[0] = row;
+            s->quality_weak[1] = col;
+            s->quality_weak[2] = s->energy;
+        }
+        else
+        {
+            memcpy(s->quality_weak, s->quality_last, sizeof(s->quality_weak));
+        }
+        s->quality_blocks = 2;
+        s->quality_hit_blocks = 2;
+    }
+    else if (s->in_digit)
+    {
+        s->quality_blocks++;
+        if (hit == s->in_digit)
+        {
+            s->quality_hit_blocks++;
+            weakest = (s->quality_weak[0] < s->quality_weak[1])  ?  s->quality_weak[0]  :  s->quality_weak[1];
+            if (row < weakest  ||  col < weakest)
+            {
+                s->quality_weak[0] = row;
+                s->quality_weak[1] = col;
+                s->quality_weak[2] = s->energy;
+            }
+        }
+    }
+    if (hit)
+    {
+        s->quality_last[0] = row;
+        s->quality_last[1] = col;
+        s->quality_last[2] = s->energy;
+    }
+}
+/*- End of function --------------------------------------------------------*/
+
+/* The decision logic run with the filter results at the end of each detection block */
+static void dtmf_rx_decide(dtmf_rx_state_t *s, const dtmf_energy_t row_energy[], const dtmf_energy_t col_energy[])
+{
+    int i;
+    int best_row;
+    int best_col;
+    uint8_t hit;
+    uint8_t raw_hit;
+    uint8_t prev_digit;
+
+    /* Find the peak row and the peak column */
+    best_row = 0;
+    best_col = 0;
+    for (i = 1;  i < 4;  i++)
+    {
+        if (row_energy[i] > row_energy[best_row])
+            best_row = i;
+        if (col_energy[i] > col_energy[best_col])
+            best_col = i;
+    }
+    hit = 0;
+    /* Basic signal level test and the twist test */
+    if (row_energy[best_row] >= s->threshold
+        &&
+        col_energy[best_col] >= s->threshold)
+    {
+        if (DTMF_RATIO_GREATER(row_energy[best_row], s->reverse_twist, col_energy[best_col])
+            &&
+            DTMF_RATIO_GREATER(col_energy[best_col], s->normal_twist, row_energy[best_row]))
+        {
+            /* Relative peak test ... */
+            for (i = 0;  i < 4;  i++)
+            {
+                if ((i != best_col  &&  DTMF_RATIO_GREATER(col_energy[i], DTMF_RELATIVE_PEAK_COL, col_energy[best_col]))
+                    ||
+                    (i != best_row  &&  DTMF_RATIO_GREATER(row_energy[i], DTMF_RELATIVE_PEAK_ROW, row_energy[best_row])))
+                {
+                    break;
+                }
+            }
+            /* ... and fraction of total energy test */
+            if (i >= 4
+                &&
+                DTMF_TOTAL_ENERGY_TEST(row_energy[best_row], col_energy[best_col], s->energy))
+            {
+                /* Got a hit */
+                hit = dtmf_positions[(best_row << 2) + best_col];
+            }
+        }
+        if (span_log_test(&s->logging, SPAN_LOG_FLOW))
+        {
+            /* Log information about the quality of the signal, to aid analysis of detection problems */
+            /* Logging at this point filters the total no-hoper frames out of the log, and leaves
+               anything which might feasibly be a DTMF digit. The log will then contain a list of the
+               total, row and coloumn power levels for detailed analysis of detection problems. */
+            span_log(&s->logging,
+                     SPAN_LOG_FLOW,
+                     "Potentially '%c' - total %.2fdB, row %.2fdB, col %.2fdB, duration %d - %s\n",
+                     dtmf_positions[(best_row << 2) + best_col],
+                     log10f(s->energy)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER,
+                     log10f(row_energy[best_row]/DTMF_TO_TOTAL_ENERGY_RATIO)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER,
+                     log10f(col_energy[best_col]/DTMF_TO_TOTAL_ENERGY_RATIO)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER,
+                     s->duration,
+                     (hit)  ?  "hit"  :  "miss");
+        }
+    }
+    /* The logic in the next test should ensure the following for different successive hit patterns:
+            -----ABB = start of digit B.
+            ----B-BB = start of digit B
+            ----A-BB = start of digit B
+            BBBBBABB = still in digit B.
+            BBBBBB-- = end of digit B
+            BBBBBBC- = end of digit B
+            BBBBACBB = B ends, then B starts again.
+            BBBBBBCC = B ends, then C starts.
+            BBBBBCDD = B ends, then D starts.
+       This can work with:
+            - Back to back differing digits. Back-to-back digits should
+              not happen. The spec. says there should be a gap between digits.
+              However, many real phones do not impose a gap, and rolling across
+              the keypad can produce little or no gap.
+            - It tolerates nasty phones that give a very wobbly start to a digit.
+            - VoIP can give sample slips. The phase jumps that produces will cause
+              the block it is in to give no detection. This logic will ride over a
+              single missed block, and not falsely declare a second digit. If the
+              hiccup happens in the wrong place on a minimum length digit, however
+              we would still fail to detect that digit. Could anything be done to
+              deal with that? Packet loss is clearly a no-go zone.
+              Note this is only relevant to VoIP using A-law, u-law or similar.
+              Low bit rate codecs scramble DTMF too much for it to be recognised,
+              and often slip in units larger than a sample. */
+    raw_hit = hit;
+    prev_digit = s->in_digit;
+    if (hit != s->in_digit  &&  s->last_hit != s->in_digit)
+    {
+        /* We have two successive indications that something has changed. */
+        /* To declare digit on, the hits must agree. Otherwise we declare tone off. */
+        hit = (hit  &&  hit == s->last_hit)  ?  hit   :  0;
+        if (s->realtime_callback)
+        {
+            /* Avoid reporting multiple no digit conditions on flaky hits */
+            if (s->in_digit  ||  hit)
+            {
+                i = (s->in_digit  &&  !hit)  ?  -99  :  lfastrintf(log10f(s->energy)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER);
+                s->realtime_callback(s->realtime_callback_data, hit, i, s->duration);
+                s->duration = 0;
+            }
+        }
+        else
+        {
+            if (hit)
+            {
+                if (s->current_digits < MAX_DTMF_DIGITS)
+                {
+                    s->digits[s->current_digits++] = (char) hit;
+                    s->digits[s->current_digits] = '\0';
+                    if (s->digits_callback)
+                    {
+                        s->digits_callback(s->digits_callback_data, s->digits, s->current_digits);
+                        s->current_digits = 0;
+                    }
+                }
+                else
+                {
+                    s->lost_digits++;
+                }
+            }
+        }
+        s->in_digit = hit;
+    }
+    s->last_hit = hit;
+    if (s->quality_callback)
+        dtmf_rx_quality_track(s, raw_hit, prev_digit, row_energy[best_row], col_energy[best_col]);
+}
+/*- End of function --------------------------------------------------------*/
+
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+static void dtmf_rx_bank_block(void *user_data, const int32_t energy[], int32_t total_energy);
+
+/* Register the row then the column tones with a filter bank */
+static int dtmf_rx_add_client(dtmf_rx_state_t *s, goertzel_bank_t *bank)
+{
+    float freqs[8];
+    int i;
+
+    for (i = 0;  i < 4;  i++)
+    {
+        freqs[i] = dtmf_row[i];
+        freqs[i + 4] = dtmf_col[i];
+    }
+    return (goertzel_bank_add_client(bank, freqs, 8, dtmf_rx_bank_block, s) < 0)  ?  -1  :  0;
+}
+/*- End of function --------------------------------------------------------*/
+
+/* Filter bank handler with the row then column tone energies of each block */
+static void dtmf_rx_bank_block(void *user_data, const int32_t energy[], int32_t total_energy)
+{
+    dtmf_rx_state_t *s;
+
+    s = (dtmf_rx_state_t *) user_data;
+    if (s->duration < INT_MAX - DTMF_SAMPLES_PER_BLOCK)
+        s->duration += DTMF_SAMPLES_PER_BLOCK;
+    s->energy = total_energy;
+    dtmf_rx_decide(s, &energy[0], &energy[4]);
+    s->energy = 0;
+    /* Report digits here, since a shared bank's blocks don't pass through dtmf_rx() */
+    if (s->current_digits  &&  s->digits_callback)
+    {
+        s->digits_callback(s->digits_callback_data, s->digits, s->current_digits);
+        s->digits[0] = '\0';
+        s->current_digits = 0;
+    }
+}
+/*- End of function --------------------------------------------------------*/
+
 SPAN_DECLARE(int) dtmf_rx(dtmf_rx_state_t *s, const int16_t amp[], int samples)
 {
-#if defined(SPANDSP_USE_FIXED_POINT)
-    int32_t row_energy[4];
-    int32_t col_energy[4];
-    int16_t xamp;
-    float famp;
+    int32_t xamp[DTMF_FILTER_CHUNK];
+    int32_t v1;
+    int sample;
+    int n;
+    int j;
+
+    if (s->filter_dialtone)
+    {
+        for (sample = 0;  sample < samples;  sample += n)
+        {
+            n = samples - sample;
+            if (n > DTMF_FILTER_CHUNK)
+                n = DTMF_FILTER_CHUNK;
+            for (j = 0;  j < n;  j++)
+            {
+                xamp[j] = (amp[sample + j] + (1 << (DTMF_AMP_SHIFT - 1))) >> DTMF_AMP_SHIFT;
+                /* The same 350Hz and 440Hz notches as the floating point build, with Q13
+                   coefficients. Q13 leaves enough headroom for the high Q recursive states. */
+                v1 = (8057*xamp[j] + 15527*s->z350[0] - 7939*s->z350[1]) >> 13;
+                xamp[j] = v1 - ((15771*s->z350[0]) >> 13) + s->z350[1];
+                s->z350[1] = s->z350[0];
+                s->z350[0] = v1;
+
+                v1 = (8066*xamp[j] + 15179*s->z440[0] - 7939*s->z440[1]) >> 13;
+                xamp[j] = v1 - ((15417*s->z440[0]) >> 13) + s->z440[1];
+                s->z440[1] = s->z440[0];
+                s->z440[0] = v1;
+            }
+            goertzel_bank_rx_scaled(&s->bank, xamp, n);
+        }
+    }
+    else
+    {
+        goertzel_bank_rx(&s->bank, amp, samples);
+    }
+    return 0;
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(int) dtmf_rx_attach_bank(dtmf_rx_state_t *s, goertzel_bank_t *bank)
+{
+    if (bank->block_len != DTMF_SAMPLES_PER_BLOCK  ||  bank->amp_shift != DTMF_AMP_SHIFT)
+        return -1;
+    return dtmf_rx_add_client(s, bank);
+}
+/*- End of function --------------------------------------------------------*/
 #else
+SPAN_DECLARE(int) dtmf_rx(dtmf_rx_state_t *s, const int16_t amp[], int samples)
+{
     float row_energy[4];
     float col_energy[4];
     float xamp;
     float famp;
-#endif
     float v1;
     int i;
     int j;
     int sample;
-    int best_row;
-    int best_col;
     int limit;
-    uint8_t hit;
 
-    hit = 0;
     for (sample = 0;  sample < samples;  sample = limit)
     {
         /* The block length is optimised to meet the DTMF specs. */
@@ -138,11 +450,7 @@ SPAN_DECLARE(int) dtmf_rx(dtmf_rx_state_t *s, const int16_t amp[], int samples)
                 xamp = famp;
             }
             xamp = goertzel_preadjust_amp(xamp);
-#if defined(SPANDSP_USE_FIXED_POINT)
-            s->energy += ((int32_t) xamp*xamp);
-#else
             s->energy += xamp*xamp;
-#endif
             goertzel_samplex(&s->row_out[0], xamp);
             goertzel_samplex(&s->col_out[0], xamp);
             goertzel_samplex(&s->row_out[1], xamp);
@@ -159,134 +467,13 @@ SPAN_DECLARE(int) dtmf_rx(dtmf_rx_state_t *s, const int16_t amp[], int samples)
             continue;
 
         /* We are at the end of a DTMF detection block */
-        /* Find the peak row and the peak column */
-        row_energy[0] = goertzel_result(&s->row_out[0]);
-        best_row = 0;
-        col_energy[0] = goertzel_result(&s->col_out[0]);
-        best_col = 0;
-        for (i = 1;  i < 4;  i++)
+        for (i = 0;  i < 4;  i++)
         {
             row_energy[i] = goertzel_result(&s->row_out[i]);
-            if (row_energy[i] > row_energy[best_row])
-                best_row = i;
             col_energy[i] = goertzel_result(&s->col_out[i]);
-            if (col_energy[i] > col_energy[best_col])
-                best_col = i;
-        }
-        hit = 0;
-        /* Basic signal level test and the twist test */
-        if (row_energy[best_row] >= s->threshold
-            &&
-            col_energy[best_col] >= s->threshold)
-        {
-            if (col_energy[best_col] < row_energy[best_row]*s->reverse_twist
-                &&
-                col_energy[best_col]*s->normal_twist > row_energy[best_row])
-            {
-                /* Relative peak test ... */
-                for (i = 0;  i < 4;  i++)
-                {
-                    if ((i != best_col  &&  col_energy[i]*DTMF_RELATIVE_PEAK_COL > col_energy[best_col])
-                        ||
-                        (i != best_row  &&  row_energy[i]*DTMF_RELATIVE_PEAK_ROW > row_energy[best_row]))
-                    {
-                        break;
-                    }
-                }
-                /* ... and fraction of total energy test */
-                if (i >= 4
-                    &&
-                    (row_energy[best_row] + col_energy[best_col]) > DTMF_TO_TOTAL_ENERGY*s->energy)
-                {
-                    /* Got a hit */
-                    hit = dtmf_positions[(best_row << 2) + best_col];
-                }
-            }
-            if (span_log_test(&s->logging, SPAN_LOG_FLOW))
-            {
-                /* Log information about the quality of the signal, to aid analysis of detection problems */
-                /* Logging at this point filters the total no-hoper frames out of the log, and leaves
-                   anything which might feasibly be a DTMF digit. The log will then contain a list of the
-                   total, row and coloumn power levels for detailed analysis of detection problems. */
-                span_log(&s->logging,
-                         SPAN_LOG_FLOW,
-                         "Potentially '%c' - total %.2fdB, row %.2fdB, col %.2fdB, duration %d - %s\n",
-                         dtmf_positions[(best_row << 2) + best_col],
-                         log10f(s->energy)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER,
-                         log10f(row_energy[best_row]/DTMF_TO_TOTAL_ENERGY)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER,
-                         log10f(col_energy[best_col]/DTMF_TO_TOTAL_ENERGY)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER,
-                         s->duration,
-                         (hit)  ?  "hit"  :  "miss");
-            }
         }
-        /* The logic in the next test should ensure the following for different successive hit patterns:
-                -----ABB = start of digit B.
-                ----B-BB = start of digit B
-                ----A-BB = start of digit B
-                BBBBBABB = still in digit B.
-                BBBBBB-- = end of digit B
-                BBBBBBC- = end of digit B
-                BBBBACBB = B ends, then B starts again.
-                BBBBBBCC = B ends, then C starts.
-                BBBBBCDD = B ends, then D starts.
-           This can work with:
-                - Back to back differing digits. Back-to-back digits should
-                  not happen. The spec. says there should be a gap between digits.
-                  However, many real phones do not impose a gap, and rolling across
-                  the keypad can produce little or no gap.
-                - It tolerates nasty phones that give a very wobbly start to a digit.
-                - VoIP can give sample slips. The phase jumps that produces will cause
-                  the block it is in to give no detection. This logic will ride over a
-                  single missed block, and not falsely declare a second digit. If the
-                  hiccup happens in the wrong place on a minimum length digit, however
-                  we would still fail to detect that digit. Could anything be done to
-                  deal with that? Packet loss is clearly a no-go zone.
-                  Note this is only relevant to VoIP using A-law, u-law or similar.
-                  Low bit rate codecs scramble DTMF too much for it to be recognised,
-                  and often slip in units larger than a sample. */
-        if (hit != s->in_digit  &&  s->last_hit != s->in_digit)
-        {
-            /* We have two successive indications that something has changed. */
-            /* To declare digit on, the hits must agree. Otherwise we declare tone off. */
-            hit = (hit  &&  hit == s->last_hit)  ?  hit   :  0;
-            if (s->realtime_callback)
-            {
-                /* Avoid reporting multiple no digit conditions on flaky hits */
-                if (s->in_digit  ||  hit)
-                {
-                    i = (s->in_digit  &&  !hit)  ?  -99  :  lfastrintf(log10f(s->energy)*10.0f - DTMF_POWER_OFFSET + DBM0_MAX_POWER);
-                    s->realtime_callback(s->realtime_callback_data, hit, i, s->duration);
-                    s->duration = 0;
-                }
-            }
-            else
-            {
-                if (hit)
-                {
-                    if (s->current_digits < MAX_DTMF_DIGITS)
-                    {
-                        s->digits[s->current_digits++] = (char) hit;
-                        s->digits[s->current_digits] = '\0';
-                        if (s->digits_callback)
-                        {
-                            s->digits_callback(s->digits_callback_data, s->digits, s->current_digits);
-                            s->current_digits = 0;
-                        }
-                    }
-                    else
-                    {
-                        s->lost_digits++;
-                    }
-                }
-            }
-            s->in_digit = hit;
-        }
-        s->last_hit = hit;
-#if defined(SPANDSP_USE_FIXED_POINT)
-        s->energy = 0;
-#else
+        dtmf_rx_decide(s, row_energy, col_energy);
         s->energy = 0.0f;
-#endif
         s->current_sample = 0;
     }
     if (s->current_digits  &&  s->digits_callback)
@@ -298,20 +485,24 @@ SPAN_DECLARE(int) dtmf_rx(dtmf_rx_state_t *s, const int16_t amp[], int samples)
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
+#endif
 
 SPAN_DECLARE(int) dtmf_rx_fillin(dtmf_rx_state_t *s, int samples)
 {
+#if !defined(SPANDSP_DTMF_RX_FIXED_POINT)
     int i;
+#endif
 
     /* Restart any Goertzel and energy gathering operation we might be in the middle of. */
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+    goertzel_bank_reset(&s->bank);
+    s->energy = 0;
+#else
     for (i = 0;  i < 4;  i++)
     {
         goertzel_reset(&s->row_out[i]);
         goertzel_reset(&s->col_out[i]);
     }
-#if defined(SPANDSP_USE_FIXED_POINT)
-    s->energy = 0;
-#else
     s->energy = 0.0f;
 #endif
     s->current_sample = 0;
@@ -356,6 +547,15 @@ SPAN_DECLARE(void) dtmf_rx_set_realtime_callback(dtmf_rx_state_t *s,
 }
 /*- End of function --------------------------------------------------------*/
 
+SPAN_DECLARE(void) dtmf_rx_set_quality_callback(dtmf_rx_state_t *s,
+                                                dtmf_rx_quality_func_t callback,
+                                                void *user_data)
+{
+    s->quality_callback = callback;
+    s->quality_callback_data = user_data;
+}
+/*- End of function --------------------------------------------------------*/
+
 SPAN_DECLARE(void) dtmf_rx_parms(dtmf_rx_state_t *s,
                                  int filter_dialtone,
                                  int twist,
@@ -366,12 +566,24 @@ SPAN_DECLARE(void) dtmf_rx_parms(dtmf_rx_state_t *s,
 
     if (filter_dialtone >= 0)
     {
-        s->z350[0] = 0.0f;
-        s->z350[1] = 0.0f;
-        s->z440[0] = 0.0f;
-        s->z440[1] = 0.0f;
+        s->z350[0] = 0;
+        s->z350[1] = 0;
+        s->z440[0] = 0;
+        s->z440[1] = 0;
         s->filter_dialtone = filter_dialtone;
     }
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+    /* Only the parameters are worked out in floating point. The receiver itself is integer only. */
+    if (twist >= 0)
+        s->normal_twist = lfastrintf(256.0f*powf(10.0f, twist/10.0f));
+    if (reverse_twist >= 0)
+        s->reverse_twist = lfastrintf(256.0f*powf(10.0f, reverse_twist/10.0f));
+    if (threshold > -99)
+    {
+        x = (DTMF_SAMPLES_PER_BLOCK*32768.0f/1.4142f)*powf(10.0f, (threshold - DBM0_MAX_SINE_POWER)/20.0f);
+        s->threshold = lfastrintf(x*x/(float) (2 << (2*DTMF_AMP_SHIFT)));
+    }
+#else
     if (twist >= 0)
         s->normal_twist = powf(10.0f, twist/10.0f);
     if (reverse_twist >= 0)
@@ -381,6 +593,7 @@ SPAN_DECLARE(void) dtmf_rx_parms(dtmf_rx_state_t *s,
         x = (DTMF_SAMPLES_PER_BLOCK*32768.0f/1.4142f)*powf(10.0f, (threshold - DBM0_MAX_SINE_POWER)/20.0f);
         s->threshold = x*x;
     }
+#endif
 }
 /*- End of function --------------------------------------------------------*/
 
@@ -394,12 +607,14 @@ SPAN_DECLARE(dtmf_rx_state_t *) dtmf_rx_init(dtmf_rx_state_t *s,
                                              digits_rx_callback_t callback,
                                              void *user_data)
 {
+#if !defined(SPANDSP_DTMF_RX_FIXED_POINT)
     int i;
     static int initialised = FALSE;
+#endif
 
     if (s == NULL)
     {
-        if ((s = (dtmf_rx_state_t *) malloc(sizeof (*s))) == NULL)
+        if ((s = (dtmf_rx_state_t *) span_alloc(sizeof (*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -409,6 +624,8 @@ SPAN_DECLARE(dtmf_rx_state_t *) dtmf_rx_init(dtmf_rx_state_t *s,
     s->digits_callback_data = user_data;
     s->realtime_callback = NULL;
     s->realtime_callback_data = NULL;
+    s->quality_callback = NULL;
+    s->quality_callback_data = NULL;
     s->filter_dialtone = FALSE;
     s->normal_twist = DTMF_NORMAL_TWIST;
     s->reverse_twist = DTMF_REVERSE_TWIST;
@@ -417,6 +634,11 @@ SPAN_DECLARE(dtmf_rx_state_t *) dtmf_rx_init(dtmf_rx_state_t *s,
     s->in_digit = 0;
     s->last_hit = 0;
 
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+    goertzel_bank_init(&s->bank, DTMF_SAMPLES_PER_BLOCK, DTMF_AMP_SHIFT);
+    (void) dtmf_rx_add_client(s, &s->bank);
+    s->energy = 0;
+#else
     if (!initialised)
     {
         for (i = 0;  i < 4;  i++)
@@ -431,9 +653,6 @@ SPAN_DECLARE(dtmf_rx_state_t *) dtmf_rx_init(dtmf_rx_state_t *s,
         goertzel_init(&s->row_out[i], &dtmf_detect_row[i]);
         goertzel_init(&s->col_out[i], &dtmf_detect_col[i]);
     }
-#if defined(SPANDSP_USE_FIXED_POINT)
-    s->energy = 0;
-#else
     s->energy = 0.0f;
 #endif
     s->current_sample = 0;
@@ -452,7 +671,7 @@ SPAN_DECLARE(int) dtmf_rx_release(dtmf_rx_state_t *s)
 
 SPAN_DECLARE(int) dtmf_rx_free(dtmf_rx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -536,8 +755,13 @@ SPAN_DECLARE(int) dtmf_tx_put(dtmf_tx_state_t *s, const char *digits, int len)
 
 SPAN_DECLARE(void) dtmf_tx_set_level(dtmf_tx_state_t *s, int level, int twist)
 {
+#if defined(SPANDSP_DDS_FIXED_POINT)
+    s->low_level = dds_scaling_dbm0((float) level);
+    s->high_level = dds_scaling_dbm0((float) (level + twist));
+#else
     s->low_level = dds_scaling_dbm0f((float) level);
     s->high_level = dds_scaling_dbm0f((float) (level + twist));
+#endif
 }
 /*- End of function --------------------------------------------------------*/
 
@@ -552,7 +776,7 @@ SPAN_DECLARE(dtmf_tx_state_t *) dtmf_tx_init(dtmf_tx_state_t *s)
 {
     if (s == NULL)
     {
-        if ((s = (dtmf_tx_state_t *) malloc(sizeof (*s))) == NULL)
+        if ((s = (dtmf_tx_state_t *) span_alloc(sizeof (*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -575,7 +799,7 @@ SPAN_DECLARE(int) dtmf_tx_release(dtmf_tx_state_t *s)
 
 SPAN_DECLARE(int) dtmf_tx_free(dtmf_tx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
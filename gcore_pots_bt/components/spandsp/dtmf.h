@@ -36,7 +36,9 @@ ITU-T Q.23, ITU-T Q.24, and the local DTMF specifications of most administration
 Its passes the test suites. It also scores *very* well on the standard
 talk-off tests. 
 
-The current design uses floating point extensively. It is not tolerant of DC.
+The original design uses floating point extensively. An integer only build, with
+32 bit Goertzel states and accumulators, is selected with SPANDSP_DTMF_RX_FIXED_POINT
+(see below). Neither is tolerant of DC.
 It is expected that a DC restore stage will be placed before the DTMF detector.
 Unless the dial tone filter is switched on, the detector has poor tolerance
 of dial tone. Whether this matter depends on your application. If you are using
@@ -76,8 +78,45 @@ repertoire of 16 DTMF dual tones.
 
 #define MAX_DTMF_DIGITS 128
 
+/* The DTMF receiver can use integer arithmetic only (Goertzels, energies and the
+   level, twist and relative peak tests), independently of SPANDSP_USE_FIXED_POINT.
+   This is the default on the ESP32 (Xtensa), where it keeps the receiver off the FPU.
+   Define SPANDSP_DTMF_RX_FLOAT to force the floating point receiver. */
+#if !defined(SPANDSP_DTMF_RX_FIXED_POINT)  &&  !defined(SPANDSP_DTMF_RX_FLOAT)
+#if defined(SPANDSP_USE_FIXED_POINT)  ||  defined(__XTENSA__)
+#define SPANDSP_DTMF_RX_FIXED_POINT
+#endif
+#endif
+
 typedef void (*digits_rx_callback_t)(void *user_data, const char *digits, int len);
 
+/*!
+    The signal quality of one received DTMF digit, taken from the weakest block (the one
+    with the lowest row or column tone energy) of those the digit passed every test in.
+    Levels and margins are in tenths of a dB.
+*/
+typedef struct
+{
+    /*! The digit. */
+    char digit;
+    /*! Samples from the digit's first hit until it was declared over (in whole blocks). */
+    int duration;
+    /*! Detection blocks while the digit was on, and those that passed every test. */
+    int blocks;
+    int hit_blocks;
+    /*! Row and column tone levels, in dBm0 x10. */
+    int row_level;
+    int col_level;
+    /*! Row level less column level (positive is normal twist). */
+    int twist;
+    /*! The weaker tone's margin over the detection threshold. */
+    int level_margin;
+    /*! The margin of the tones over the fraction of total energy test. */
+    int snr_margin;
+} dtmf_rx_quality_t;
+
+typedef void (*dtmf_rx_quality_func_t)(void *user_data, const dtmf_rx_quality_t *q);
+
 /*!
     DTMF generator state descriptor. This defines the state of a single
     working instance of a DTMF generator.
@@ -85,8 +124,13 @@ typedef void (*digits_rx_callback_t)(void *user_data, const char *digits, int le
 typedef struct dtmf_tx_state_s
 {
     tone_gen_state_t tones;
+#if defined(SPANDSP_DDS_FIXED_POINT)
+    int16_t low_level;
+    int16_t high_level;
+#else
     float low_level;
     float high_level;
+#endif
     int on_time;
     int off_time;
     union
@@ -96,6 +140,13 @@ typedef struct dtmf_tx_state_s
     } queue;
 } dtmf_tx_state_t;
 
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+/*! The block length and input scaling of a shared Goertzel filter bank (see
+    goertzel_bank_init()) a fixed point DTMF receiver can be attached to. */
+#define DTMF_RX_BANK_BLOCK_LEN      102
+#define DTMF_RX_BANK_AMP_SHIFT      6
+#endif
+
 /*!
     DTMF digit detector descriptor.
 */
@@ -109,21 +160,29 @@ typedef struct dtmf_rx_state_s
     tone_report_func_t realtime_callback;
     /*! An opaque pointer passed to the real time callback function. */
     void *realtime_callback_data;
+    /*! Optional callback funcion to deliver the signal quality of each digit as it ends. */
+    dtmf_rx_quality_func_t quality_callback;
+    /*! An opaque pointer passed to the quality callback function. */
+    void *quality_callback_data;
     /*! TRUE if dialtone should be filtered before processing */
     int filter_dialtone;
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
     /*! 350Hz filter state for the optional dialtone filter. */
-    float z350[2];
+    int32_t z350[2];
     /*! 440Hz filter state for the optional dialtone filter. */
-    float z440[2];
-    /*! Maximum acceptable "normal" (lower bigger than higher) twist ratio. */
-    float normal_twist;
-    /*! Maximum acceptable "reverse" (higher bigger than lower) twist ratio. */
-    float reverse_twist;
+    int32_t z440[2];
+    /*! Maximum acceptable "normal" (lower bigger than higher) twist ratio, in Q8. */
+    int32_t normal_twist;
+    /*! Maximum acceptable "reverse" (higher bigger than lower) twist ratio, in Q8. */
+    int32_t reverse_twist;
     /*! Minimum acceptable tone level for detection. */
     int32_t threshold;
     /*! The accumlating total energy on the same period over which the Goertzels work. */
     int32_t energy;
+    /*! Peak row, peak column and total energy of the last block with a hit, and of the
+        weakest block of the digit being received. */
+    int32_t quality_last[3];
+    int32_t quality_weak[3];
 #else
     /*! 350Hz filter state for the optional dialtone filter. */
     float z350[2];
@@ -137,11 +196,20 @@ typedef struct dtmf_rx_state_s
     float threshold;
     /*! The accumlating total energy on the same period over which the Goertzels work. */
     float energy;
+    /*! Peak row, peak column and total energy of the last block with a hit, and of the
+        weakest block of the digit being received. */
+    float quality_last[3];
+    float quality_weak[3];
 #endif
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+    /*! The receiver's own filter bank, with the row tones followed by the column tones. */
+    goertzel_bank_t bank;
+#else
     /*! Tone detector working states for the row tones. */
     goertzel_state_t row_out[4];
     /*! Tone detector working states for the column tones. */
     goertzel_state_t col_out[4];
+#endif
     /*! The result of the last tone analysis. */
     uint8_t last_hit;
     /*! The confirmed digit we are currently receiving */
@@ -151,6 +219,9 @@ typedef struct dtmf_rx_state_s
 
     /*! Tone state duration */
     int duration;
+    /*! Blocks in the digit being received, and those that passed every test. */
+    int quality_blocks;
+    int quality_hit_blocks;
 
     /*! The number of digits which have been lost due to buffer overflows. */
     int lost_digits;
@@ -225,6 +296,17 @@ SPAN_DECLARE(void) dtmf_rx_set_realtime_callback(dtmf_rx_state_t *s,
                                                  tone_report_func_t callback,
                                                  void *user_data);
 
+/*! Set an optional callback for a DTMF receiver context. It is called as each digit
+    ends with the signal quality (levels, twist and margins) the digit was received with.
+    \brief Set a signal quality callback for a DTMF receiver context.
+    \param s The DTMF receiver context.
+    \param callback Callback routine used to report the quality of each digit.
+    \param user_data An opaque pointer which is associated with the context,
+           and supplied in callbacks. */
+SPAN_DECLARE(void) dtmf_rx_set_quality_callback(dtmf_rx_state_t *s,
+                                                dtmf_rx_quality_func_t callback,
+                                                void *user_data);
+
 /*! \brief Adjust a DTMF receiver context.
     \param s The DTMF receiver context.
     \param filter_dialtone TRUE to enable filtering of dialtone, FALSE
@@ -247,6 +329,17 @@ SPAN_DECLARE(void) dtmf_rx_parms(dtmf_rx_state_t *s,
     \return The number of samples unprocessed. */
 SPAN_DECLARE(int) dtmf_rx(dtmf_rx_state_t *s, const int16_t amp[], int samples);
 
+#if defined(SPANDSP_DTMF_RX_FIXED_POINT)
+/*! Register the receiver's tones with a filter bank shared with other detectors. The
+    bank's samples are then delivered with goertzel_bank_rx() instead of dtmf_rx(), and
+    the dial tone filter is not applied.
+    \brief Attach a DTMF receiver to a shared Goertzel filter bank.
+    \param s The DTMF receiver context.
+    \param bank A filter bank initialised with DTMF_RX_BANK_BLOCK_LEN and DTMF_RX_BANK_AMP_SHIFT.
+    \return 0 for OK, else -1. */
+SPAN_DECLARE(int) dtmf_rx_attach_bank(dtmf_rx_state_t *s, goertzel_bank_t *bank);
+#endif
+
 /*! Fake processing of a missing block of received DTMF audio samples.
     (e.g due to packet loss).
     \brief Fake processing of a missing block of received DTMF audio samples.
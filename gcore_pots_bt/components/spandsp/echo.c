@@ -111,6 +111,7 @@
 #include <inttypes.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "bit_operations.h"
 #include "echo.h"
 
@@ -210,6 +211,37 @@ static void __inline__ lms_adapt_bg(echo_can_state_t *ec, int clean, int shift)
    by sample.  Processing a few samples every ms is inefficient.
 */
 
+#elif defined(USE_XTENSA_FIR)
+static __inline__ void lms_adapt_bg(echo_can_state_t *ec, int clean, int shift)
+{
+    int i;
+    int factor;
+    const int16_t *phist;
+    int16_t *ptaps;
+
+    if (shift > 0)
+	factor = clean << shift;
+    else
+	factor = clean >> -shift;
+
+    /* Update the FIR taps.  The Xtensa fir16() keeps a doubled history buffer
+       so the window starting at curr_pos is contiguous. */
+
+    phist = &ec->fir_state_bg.history[ec->curr_pos];
+    ptaps = ec->fir_taps16[1];
+
+    /* 4 taps per iteration, so the filter must be a multiple of 4 long. */
+    for (i = ec->taps;  i > 0;  i -= 4)
+    {
+       ptaps[0] += (int16_t) ((phist[0]*factor + (1<<14)) >> 15);
+       ptaps[1] += (int16_t) ((phist[1]*factor + (1<<14)) >> 15);
+       ptaps[2] += (int16_t) ((phist[2]*factor + (1<<14)) >> 15);
+       ptaps[3] += (int16_t) ((phist[3]*factor + (1<<14)) >> 15);
+       phist += 4;
+       ptaps += 4;
+    }
+}
+
 #else
 static __inline__ void lms_adapt_bg(echo_can_state_t *ec, int clean, int shift)
 {
@@ -245,13 +277,159 @@ static __inline__ void lms_adapt_bg(echo_can_state_t *ec, int clean, int shift)
 
 /*- End of function --------------------------------------------------------*/
 
+/* Proportionate (block IPNLMS style) adaption.  Hybrid echo paths are sparse, just a
+   few significant taps after the bulk delay, so rather than stepping every tap the same
+   the taps are split into ECHO_CAN_PNLMS_BLOCK blocks and each block's step is raised
+   by its share of the filter magnitude:
+
+       g[b] = 1 + nb * |h[b]| / (2 * sum(|h|)),  at most PNLMS_MAX_GAIN
+
+   The 1 keeps every active block adapting at least at the NLMS rate.  On a sparse path
+   it reaches in 250 mSec the ERLE NLMS takes about 500 mSec for, at the cost of a
+   couple of dB of steady state ERLE (which the NLP covers).  Only blocks within
+   PNLMS_ACTIVE_RATIO of the largest are updated, plus one of the others each sample (at
+   the NLMS step) so a new echo region can still grow.  A typical hybrid leaves 3 or 4
+   of 16 blocks active, cutting the multiply-accumulates of the update by 75%. */
+
+#define PNLMS_UPDATE_SAMPLES        64     /* Block gains are recomputed this often */
+#define PNLMS_ACTIVE_RATIO          256    /* 48 dB below the largest block */
+#define PNLMS_MIN_MAG               4      /* Per block average magnitude below which the
+                                              filter is treated as unconverged */
+#define PNLMS_MAX_GAIN              768    /* 3x the NLMS step (Q8) */
+#define PNLMS_MAX_FACTOR            65535  /* Keeps the Q30 products in 32 bits */
+
+static void pnlms_update_gains(echo_can_state_t *ec)
+{
+    int b, i, n;
+    int32_t mag;
+    int32_t max_mag = 0;
+    int32_t total = 0;
+    int32_t g;
+    int16_t *ptaps = ec->fir_taps16[1];
+
+    /* Reuse the gain array to hold each block's magnitude */
+    for (b = 0;  b < ec->pnlms_blocks;  b++)
+    {
+        n = ec->taps - b*ECHO_CAN_PNLMS_BLOCK;
+        if (n > ECHO_CAN_PNLMS_BLOCK)
+            n = ECHO_CAN_PNLMS_BLOCK;
+        mag = 0;
+        for (i = 0;  i < n;  i++)
+            mag += abs(*ptaps++);
+        total += mag;
+        if (mag > max_mag)
+            max_mag = mag;
+        ec->pnlms_gain[b] = (mag > 0xFFFF) ? 0xFFFF : (uint16_t) mag;
+    }
+
+    ec->pnlms_num_active = 0;
+    for (b = 0;  b < ec->pnlms_blocks;  b++)
+    {
+        if (total < PNLMS_MIN_MAG*ECHO_CAN_PNLMS_BLOCK*ec->pnlms_blocks)
+        {
+            /* Not converged yet so adapt everything like NLMS */
+            g = 256;
+        }
+        else if (ec->pnlms_gain[b]*PNLMS_ACTIVE_RATIO >= max_mag)
+        {
+            g = 256 + (int32_t) (((int64_t) 128*ec->pnlms_blocks*ec->pnlms_gain[b])/total);
+            if (g > PNLMS_MAX_GAIN)
+                g = PNLMS_MAX_GAIN;
+        }
+        else
+        {
+            g = 0;
+        }
+        ec->pnlms_gain[b] = (uint16_t) g;
+        if (g)
+            ec->pnlms_active[ec->pnlms_num_active++] = (uint8_t) b;
+    }
+    ec->pnlms_count = PNLMS_UPDATE_SAMPLES;
+}
+
+static __inline__ void pnlms_adapt_block(echo_can_state_t *ec, int b, int factor)
+{
+    int i, j, n;
+    int16_t *ptaps;
+#if defined(USE_XTENSA_FIR)
+    const int16_t *phist;
+#endif
+
+    i = b*ECHO_CAN_PNLMS_BLOCK;
+    n = ec->taps - i;
+    if (n > ECHO_CAN_PNLMS_BLOCK)
+        n = ECHO_CAN_PNLMS_BLOCK;
+    ptaps = &ec->fir_taps16[1][i];
+
+#if defined(USE_XTENSA_FIR)
+    /* The doubled history buffer keeps the window starting at curr_pos contiguous.
+       Blocks, like the filter, are a multiple of 4 taps long. */
+    (void) j;
+    phist = &ec->fir_state_bg.history[ec->curr_pos + i];
+    for (  ;  n > 0;  n -= 4)
+    {
+       ptaps[0] += (int16_t) ((phist[0]*factor + (1<<14)) >> 15);
+       ptaps[1] += (int16_t) ((phist[1]*factor + (1<<14)) >> 15);
+       ptaps[2] += (int16_t) ((phist[2]*factor + (1<<14)) >> 15);
+       ptaps[3] += (int16_t) ((phist[3]*factor + (1<<14)) >> 15);
+       phist += 4;
+       ptaps += 4;
+    }
+#else
+    /* Tap i pairs with history[(curr_pos + i) % taps] */
+    j = ec->curr_pos + i;
+    if (j >= ec->taps)
+        j -= ec->taps;
+    for (  ;  n > 0;  n--)
+    {
+       *ptaps++ += (int16_t) ((ec->fir_state_bg.history[j]*factor + (1<<14)) >> 15);
+       if (++j >= ec->taps)
+           j = 0;
+    }
+#endif
+}
+
+static void lms_adapt_bg_pnlms(echo_can_state_t *ec, int clean, int shift)
+{
+    int i, b;
+    int factor;
+    int32_t f;
+
+    if (shift > 0)
+	factor = clean << shift;
+    else
+	factor = clean >> -shift;
+
+    if (--ec->pnlms_count <= 0)
+        pnlms_update_gains(ec);
+
+    for (i = 0;  i < ec->pnlms_num_active;  i++)
+    {
+        b = ec->pnlms_active[i];
+        f = (int32_t) (((int64_t) factor*ec->pnlms_gain[b]) >> 8);
+        if (f > PNLMS_MAX_FACTOR)
+            f = PNLMS_MAX_FACTOR;
+        else if (f < -PNLMS_MAX_FACTOR)
+            f = -PNLMS_MAX_FACTOR;
+        pnlms_adapt_block(ec, b, f);
+    }
+
+    /* Probe one of the inactive blocks */
+    if (++ec->pnlms_probe >= ec->pnlms_blocks)
+        ec->pnlms_probe = 0;
+    if (ec->pnlms_gain[ec->pnlms_probe] == 0)
+        pnlms_adapt_block(ec, ec->pnlms_probe, factor);
+}
+
+/*- End of function --------------------------------------------------------*/
+
 echo_can_state_t *echo_can_create(int len, int adaption_mode)
 {
     echo_can_state_t *ec;
     int i;
     int j;
 
-    ec = (echo_can_state_t *) malloc(sizeof(*ec));
+    ec = (echo_can_state_t *) span_alloc(sizeof(*ec));
     if (ec == NULL)
         return  NULL;
     memset(ec, 0, sizeof(*ec));
@@ -259,14 +437,15 @@ echo_can_state_t *echo_can_create(int len, int adaption_mode)
     ec->taps = len;
     ec->log2taps = top_bit(len);
     ec->curr_pos = ec->taps - 1;
+    ec->in_shift = 1;
     
     for (i = 0;  i < 2;  i++)
     {
-        if ((ec->fir_taps16[i] = (int16_t *) malloc((ec->taps)*sizeof(int16_t))) == NULL)
+        if ((ec->fir_taps16[i] = (int16_t *) span_alloc((ec->taps)*sizeof(int16_t))) == NULL)
         {
             for (j = 0;  j < i;  j++)
-                free(ec->fir_taps16[j]);
-            free(ec);
+                span_free(ec->fir_taps16[j]);
+            span_free(ec);
             return  NULL;
         }
         memset(ec->fir_taps16[i], 0, (ec->taps)*sizeof(int16_t));
@@ -283,10 +462,23 @@ echo_can_state_t *echo_can_create(int len, int adaption_mode)
       ec->xvtx[i] = ec->yvtx[i] = ec->xvrx[i] = ec->yvrx[i] = 0;
     }
 
+    ec->pnlms_blocks = (len + ECHO_CAN_PNLMS_BLOCK - 1)/ECHO_CAN_PNLMS_BLOCK;
+    ec->pnlms_gain = (uint16_t *) span_alloc(ec->pnlms_blocks*sizeof(uint16_t));
+    ec->pnlms_active = (uint8_t *) span_alloc(ec->pnlms_blocks*sizeof(uint8_t));
+    if ((ec->pnlms_gain == NULL)  ||  (ec->pnlms_active == NULL)  ||  (ec->pnlms_blocks > 256))
+    {
+        /* Fall back to adapting every tap */
+        span_free(ec->pnlms_gain);
+        span_free(ec->pnlms_active);
+        ec->pnlms_gain = NULL;
+        ec->pnlms_active = NULL;
+    }
+    ec->pnlms_count = 0;
+
     ec->cng_level = 1000;
     echo_can_adaption_mode(ec, adaption_mode);
 
-    ec->snapshot = (int16_t*)malloc(ec->taps*sizeof(int16_t));
+    ec->snapshot = (int16_t*)span_alloc(ec->taps*sizeof(int16_t));
     memset(ec->snapshot, 0, sizeof(int16_t)*ec->taps);
 
     ec->cond_met = 0;
@@ -297,6 +489,7 @@ echo_can_state_t *echo_can_create(int len, int adaption_mode)
     ec->Lbgn = ec->Lbgn_acc = 0;
     ec->Lbgn_upper = 200;
     ec->Lbgn_upper_acc = ec->Lbgn_upper << 13;
+    ec->nlp_samples = 0;
 
     return  ec;
 }
@@ -309,9 +502,16 @@ void echo_can_free(echo_can_state_t *ec)
     fir16_free(&ec->fir_state);
     fir16_free(&ec->fir_state_bg);
     for (i = 0;  i < 2;  i++)
-        free(ec->fir_taps16[i]);
-    free(ec->snapshot);
-    free(ec);
+        span_free(ec->fir_taps16[i]);
+    if (ec->bg_frames)
+    {
+        span_free(ec->bg_frame[0].tx);
+        span_free(ec->bg_xfer_taps);
+    }
+    span_free(ec->pnlms_gain);
+    span_free(ec->pnlms_active);
+    span_free(ec->snapshot);
+    span_free(ec);
 }
 /*- End of function --------------------------------------------------------*/
 
@@ -321,6 +521,18 @@ void echo_can_adaption_mode(echo_can_state_t *ec, int adaption_mode)
 }
 /*- End of function --------------------------------------------------------*/
 
+void echo_can_bg_gate(echo_can_state_t *ec, int gated)
+{
+    ec->bg_gated = gated;
+}
+/*- End of function --------------------------------------------------------*/
+
+void echo_can_input_shift(echo_can_state_t *ec, int shift)
+{
+    ec->in_shift = (shift == 0) ? 0 : 1;
+}
+/*- End of function --------------------------------------------------------*/
+
 void echo_can_flush(echo_can_state_t *ec)
 {
     int i;
@@ -332,6 +544,7 @@ void echo_can_flush(echo_can_state_t *ec)
     ec->Lbgn = ec->Lbgn_acc = 0;
     ec->Lbgn_upper = 200;
     ec->Lbgn_upper_acc = ec->Lbgn_upper << 13;
+    ec->nlp_samples = 0;
 
     ec->nonupdate_dwell = 0;
 
@@ -344,6 +557,18 @@ void echo_can_flush(echo_can_state_t *ec)
 
     ec->curr_pos = ec->taps - 1;
     ec->Pstates = 0;
+    ec->cond_met = 0;
+    ec->pnlms_count = 0;
+
+    if (ec->bg_frames)
+    {
+        memset(ec->bg_xfer_taps, 0, ec->taps*sizeof(int16_t));
+        atomic_store(&ec->bg_wr, 0);
+        atomic_store(&ec->bg_rd, 0);
+        atomic_store(&ec->bg_xfer_ready, 0);
+        ec->bg_resync = 0;
+        ec->bg_warmup = 0;
+    }
 }
 /*- End of function --------------------------------------------------------*/
 
@@ -352,21 +577,45 @@ void echo_can_snapshot(echo_can_state_t *ec) {
 }
 /*- End of function --------------------------------------------------------*/
 
+void echo_can_get_coeffs(echo_can_state_t *ec, int16_t *coeffs)
+{
+    memcpy(coeffs, ec->fir_taps16[0], ec->taps*sizeof(int16_t));
+}
+/*- End of function --------------------------------------------------------*/
+
+void echo_can_set_coeffs(echo_can_state_t *ec, const int16_t *coeffs)
+{
+    int i;
+
+    for (i = 0;  i < 2;  i++)
+        memcpy(ec->fir_taps16[i], coeffs, ec->taps*sizeof(int16_t));
+    if (ec->bg_frames)
+        atomic_store(&ec->bg_xfer_ready, 0);
+    ec->pnlms_count = 0;
+}
+/*- End of function --------------------------------------------------------*/
+
 /* Dual Path Echo Canceller ------------------------------------------------*/
 
-int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
+/* The per-sample processing is inlined into both the sample and block based
+   entry points so the block version runs a single tight loop per frame without
+   a function call per sample.  It is split into stages so the pipelined mode
+   (see echo_can_split) can run the background ones separately. */
+
+static __inline__ void echo_can_input(echo_can_state_t *ec, int16_t *ptx, int16_t *prx)
 {
-    int32_t echo_value;
-    int clean_bg;
+    int16_t tx = *ptx;
+    int16_t rx = *prx;
     int tmp, tmp1;
 
     /* Input scaling was found be required to prevent problems when tx
        starts clipping.  Another possible way to handle this would be the
-       filter coefficent scaling. */
+       filter coefficent scaling.  The caller may turn it off while the
+       inputs have headroom (see echo_can_input_shift). */
 
     ec->tx = tx; ec->rx = rx;
-    tx >>=1;
-    rx >>=1;
+    tx >>= ec->in_shift;
+    rx >>= ec->in_shift;
 
     /* 
        Filter DC, 3dB point is 160Hz (I think), note 32 bit precision required
@@ -403,22 +652,6 @@ int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
       ec->rx_2 = tmp;
     }
 
-    /* Block average of power in the filter states.  Used for
-       adaption power calculation. */
-
-    {
-	int new, old;
-
-	/* efficient "out with the old and in with the new" algorithm so
-	   we don't have to recalculate over the whole block of
-	   samples. */
-	new = (int)tx * (int)tx;
-	old = (int)ec->fir_state.history[ec->fir_state.curr_pos] * 
-              (int)ec->fir_state.history[ec->fir_state.curr_pos];
-	ec->Pstates += ((new - old) + (1<<(ec->log2taps-1))) >> ec->log2taps;
-	if (ec->Pstates < 0) ec->Pstates = 0;
-    }
-
     /* Calculate short term average levels using simple single pole IIRs */
     
     ec->Ltxacc += abs(tx) - ec->Ltx;
@@ -426,20 +659,65 @@ int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
     ec->Lrxacc += abs(rx) - ec->Lrx;
     ec->Lrx = (ec->Lrxacc + (1<<4)) >> 5;
 
-    /* Foreground filter ---------------------------------------------------*/
+    *ptx = tx;
+    *prx = rx;
+}
+
+/*- End of function --------------------------------------------------------*/
+
+static __inline__ void echo_can_fg_filter(echo_can_state_t *ec, int16_t tx, int16_t rx)
+{
+    int32_t echo_value;
+    int32_t clean;
 
     ec->fir_state.coeffs = ec->fir_taps16[0];
     echo_value = fir16(&ec->fir_state, tx);
-    ec->clean = rx - echo_value;
+    clean = rx - echo_value;
+    if (clean > INT16_MAX)
+        clean = INT16_MAX;
+    else if (clean < INT16_MIN)
+        clean = INT16_MIN;
+    ec->clean = (int16_t) clean;
     ec->Lcleanacc += abs(ec->clean) - ec->Lclean;
     ec->Lclean = (ec->Lcleanacc + (1<<4)) >> 5;
+}
 
-    /* Background filter ---------------------------------------------------*/
+/*- End of function --------------------------------------------------------*/
 
-    echo_value = fir16(&ec->fir_state_bg, tx);
-    clean_bg = rx - echo_value;
-    ec->Lclean_bgacc += abs(clean_bg) - ec->Lclean_bg;
-    ec->Lclean_bg = (ec->Lclean_bgacc + (1<<4)) >> 5;
+/* Run (and if adapt is set adapt) the background filter unless it is gated */
+
+static __inline__ void echo_can_bg_filter(echo_can_state_t *ec, int16_t tx, int16_t rx, int gated, int adapt)
+{
+    int32_t echo_value;
+    int clean_bg;
+
+    /* Block average of power in the filter states.  Used for
+       adaption power calculation.  The background history is the
+       same as the foreground history before tx is added to it. */
+
+    {
+	int new, old;
+
+	/* efficient "out with the old and in with the new" algorithm so
+	   we don't have to recalculate over the whole block of
+	   samples. */
+	new = (int)tx * (int)tx;
+	old = (int)ec->fir_state_bg.history[ec->fir_state_bg.curr_pos] * 
+              (int)ec->fir_state_bg.history[ec->fir_state_bg.curr_pos];
+	ec->Pstates += ((new - old) + (1<<(ec->log2taps-1))) >> ec->log2taps;
+	if (ec->Pstates < 0) ec->Pstates = 0;
+    }
+
+    if (gated) {
+        /* Nothing to adapt to, so only keep the history in step */
+        fir16_push(&ec->fir_state_bg, tx);
+        clean_bg = 0;
+    } else {
+        echo_value = fir16(&ec->fir_state_bg, tx);
+        clean_bg = rx - echo_value;
+        ec->Lclean_bgacc += abs(clean_bg) - ec->Lclean_bg;
+        ec->Lclean_bg = (ec->Lclean_bgacc + (1<<4)) >> 5;
+    }
 
     /* Background Filter adaption -----------------------------------------*/
 
@@ -449,7 +727,7 @@ int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
     */
     ec->factor = 0;
     ec->shift = 0;
-    if ((ec->nonupdate_dwell == 0)) {
+    if (adapt && !gated) {
 	int   P, logP, shift;
 
 	/* Determine:
@@ -490,32 +768,44 @@ int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
 	shift = 30 - 2 - logP;
 	ec->shift = shift;
 
-	lms_adapt_bg(ec, clean_bg, shift);
+	if ((ec->adaption_mode & ECHO_CAN_USE_PNLMS)  &&  ec->pnlms_gain)
+	    lms_adapt_bg_pnlms(ec, clean_bg, shift);
+	else
+	    lms_adapt_bg(ec, clean_bg, shift);
     }
+}
+
+/*- End of function --------------------------------------------------------*/
 
+static __inline__ void echo_can_dtd(echo_can_state_t *ec)
+{
     /* very simple DTD to make sure we dont try and adapt with strong
        near end speech */
 
-    ec->adapt = 0;
     if ((ec->Lrx > MIN_RX_POWER_FOR_ADAPTION) && (ec->Lrx > ec->Ltx)) 
 	ec->nonupdate_dwell = DTD_HANGOVER;
     if (ec->nonupdate_dwell)
 	ec->nonupdate_dwell--;
+}
 
-    /* Transfer logic ------------------------------------------------------*/
+/*- End of function --------------------------------------------------------*/
+
+/* Returns non-zero when the background filter should be copied to the foreground */
 
+static __inline__ int echo_can_transfer(echo_can_state_t *ec, int lclean, int ltx, int mode, int gated, int dwell_done)
+{
     /* These conditions are from the dual path paper [1], I messed with
        them a bit to improve performance. */
 
-    if ((ec->adaption_mode & ECHO_CAN_USE_ADAPTION) &&
-	(ec->nonupdate_dwell == 0) && 
-	(8*ec->Lclean_bg < 7*ec->Lclean) /* (ec->Lclean_bg < 0.875*ec->Lclean) */ && 
-	(8*ec->Lclean_bg < ec->Ltx)      /* (ec->Lclean_bg < 0.125*ec->Ltx)    */ )       
+    if ((mode & ECHO_CAN_USE_ADAPTION) &&
+	!gated &&
+	dwell_done && 
+	(8*ec->Lclean_bg < 7*lclean) /* (ec->Lclean_bg < 0.875*ec->Lclean) */ && 
+	(8*ec->Lclean_bg < ltx)      /* (ec->Lclean_bg < 0.125*ec->Ltx)    */ )       
     {
 	if (ec->cond_met == 6) {
 	    /* BG filter has had better results for 6 consecutive samples */
-	    ec->adapt = 1;
-	    memcpy(ec->fir_taps16[0], ec->fir_taps16[1], ec->taps*sizeof(int16_t));
+	    return 1;
 	}
 	else
 	    ec->cond_met++;
@@ -523,6 +813,15 @@ int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
     else
 	ec->cond_met = 0;
 
+    return 0;
+}
+
+/*- End of function --------------------------------------------------------*/
+
+static __inline__ int16_t echo_can_output(echo_can_state_t *ec, int16_t rx)
+{
+    int32_t out;
+
     /* Non-Linear Processing ---------------------------------------------------*/
 
     ec->clean_nlp = ec->clean;
@@ -535,6 +834,7 @@ int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
       {
 	/* Our e/c has improved echo by at least 24 dB (each factor of 2 is 6dB,
 	   so 2*2*2*2=16 is the same as 6+6+6+6=24dB) */
+        ec->nlp_samples++;
         if (ec->adaption_mode & ECHO_CAN_USE_CNG)
 	{
 	    ec->cng_level = ec->Lbgn;
@@ -583,17 +883,243 @@ int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
        }
     }
 
+    if (ec->adaption_mode & ECHO_CAN_DISABLE)
+      ec->clean_nlp = rx;
+
+    /* Output scaled back up again to match input scaling */
+
+    out = (int32_t) ec->clean_nlp << ec->in_shift;
+    if (out > INT16_MAX)
+        out = INT16_MAX;
+    else if (out < INT16_MIN)
+        out = INT16_MIN;
+    return (int16_t) out;
+}
+
+/*- End of function --------------------------------------------------------*/
+
+static __inline__ int16_t echo_can_process(echo_can_state_t *ec, int16_t tx, int16_t rx)
+{
+    int dwell_done;
+
+    echo_can_input(ec, &tx, &rx);
+
+    /* Foreground filter ---------------------------------------------------*/
+
+    echo_can_fg_filter(ec, tx, rx);
+
+    /* Background filter ---------------------------------------------------*/
+
+    echo_can_bg_filter(ec, tx, rx, ec->bg_gated, ec->nonupdate_dwell == 0);
+
+    echo_can_dtd(ec);
+
+    /* Transfer logic ------------------------------------------------------*/
+
+    ec->adapt = 0;
+    dwell_done = (ec->nonupdate_dwell == 0);
+    if (echo_can_transfer(ec, ec->Lclean, ec->Ltx, ec->adaption_mode, ec->bg_gated, dwell_done))
+    {
+	ec->adapt = 1;
+	memcpy(ec->fir_taps16[0], ec->fir_taps16[1], ec->taps*sizeof(int16_t));
+    }
+
     /* Roll around the taps buffer */
     if (ec->curr_pos <= 0)
         ec->curr_pos = ec->taps;
     ec->curr_pos--;
 
-    if (ec->adaption_mode & ECHO_CAN_DISABLE)
-      ec->clean_nlp = rx;
+    return echo_can_output(ec, rx);
+}
 
-    /* Output scaled back up again to match input scaling */
+/*- End of function --------------------------------------------------------*/
+
+int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx)
+{
+    return echo_can_process(ec, tx, rx);
+}
+
+/*- End of function --------------------------------------------------------*/
+
+/* Foreground half of the pipelined mode.  The scaled input, levels and double
+   talk state for each sample are recorded for echo_can_bg_update, and
+   background coefficients it has published are swapped in at the start of the
+   block. */
+
+static void echo_can_update_block_split(echo_can_state_t *ec, const int16_t *tx, const int16_t *rx, int16_t *out, int n)
+{
+    int i;
+    int wr;
+    int16_t t, r;
+    int16_t *taps;
+    echo_can_bg_frame_t *f = NULL;
 
-    return (int16_t) ec->clean_nlp << 1;
+    ec->adapt = 0;
+    if (atomic_load(&ec->bg_xfer_ready))
+    {
+        taps = ec->fir_taps16[0];
+        ec->fir_taps16[0] = ec->bg_xfer_taps;
+        ec->bg_xfer_taps = taps;
+        ec->adapt = 1;
+        atomic_store(&ec->bg_xfer_ready, 0);
+    }
+
+    wr = atomic_load(&ec->bg_wr);
+    if ((n <= ec->bg_max_block)  &&  ((wr - atomic_load(&ec->bg_rd)) < ECHO_CAN_BG_FRAMES))
+    {
+        f = &ec->bg_frames[wr % ECHO_CAN_BG_FRAMES];
+        f->n = n;
+        f->resync = ec->bg_resync;
+        f->adaption_mode = ec->adaption_mode;
+        f->gated = ec->bg_gated;
+        ec->bg_resync = 0;
+    }
+    else
+    {
+        /* The background filter is behind so it misses this block and has to
+           start its history over */
+        ec->bg_resync = 1;
+        ec->bg_overruns++;
+    }
+
+    for (i = 0;  i < n;  i++)
+    {
+        t = tx[i];
+        r = rx[i];
+        echo_can_input(ec, &t, &r);
+        echo_can_fg_filter(ec, t, r);
+        if (f)
+        {
+            f->tx[i] = t;
+            f->rx[i] = r;
+            f->dwell[i] = (ec->nonupdate_dwell == 0) ? ECHO_CAN_BG_ADAPT : 0;
+        }
+        echo_can_dtd(ec);
+        if (f)
+        {
+            f->lclean[i] = (int16_t) ec->Lclean;
+            f->ltx[i] = (int16_t) ec->Ltx;
+            if (ec->nonupdate_dwell == 0)
+                f->dwell[i] |= ECHO_CAN_BG_XFER;
+        }
+        out[i] = echo_can_output(ec, r);
+    }
+
+    if (f)
+        atomic_store(&ec->bg_wr, wr + 1);
+}
+
+/*- End of function --------------------------------------------------------*/
+
+void echo_can_update_block(echo_can_state_t *ec, const int16_t *tx, const int16_t *rx, int16_t *out, int n)
+{
+    int i;
+
+    if (ec->bg_frames)
+    {
+        echo_can_update_block_split(ec, tx, rx, out, n);
+        return;
+    }
+
+    for (i = 0;  i < n;  i++)
+        out[i] = echo_can_process(ec, tx[i], rx[i]);
+}
+
+/*- End of function --------------------------------------------------------*/
+
+int echo_can_split(echo_can_state_t *ec, int max_block)
+{
+    int i;
+    uint8_t *p;
+
+    if (ec->bg_frames)
+        return  0;
+    if ((ec->bg_xfer_taps = (int16_t *) span_alloc(ec->taps*sizeof(int16_t))) == NULL)
+        return  -1;
+    /* Each frame holds 4 int16_t and 1 uint8_t per sample */
+    if ((p = (uint8_t *) span_alloc(ECHO_CAN_BG_FRAMES*max_block*9)) == NULL)
+    {
+        span_free(ec->bg_xfer_taps);
+        ec->bg_xfer_taps = NULL;
+        return  -1;
+    }
+    for (i = 0;  i < ECHO_CAN_BG_FRAMES;  i++)
+    {
+        ec->bg_frame[i].tx = (int16_t *) p;
+        ec->bg_frame[i].rx = ec->bg_frame[i].tx + max_block;
+        ec->bg_frame[i].lclean = ec->bg_frame[i].rx + max_block;
+        ec->bg_frame[i].ltx = ec->bg_frame[i].lclean + max_block;
+        ec->bg_frame[i].dwell = (uint8_t *) (ec->bg_frame[i].ltx + max_block);
+        p += max_block*9;
+    }
+    memcpy(ec->bg_xfer_taps, ec->fir_taps16[0], ec->taps*sizeof(int16_t));
+    ec->bg_max_block = max_block;
+    atomic_store(&ec->bg_wr, 0);
+    atomic_store(&ec->bg_rd, 0);
+    atomic_store(&ec->bg_xfer_ready, 0);
+    ec->bg_resync = 0;
+    ec->bg_warmup = 0;
+    ec->bg_frames = ec->bg_frame;
+    return  0;
+}
+
+/*- End of function --------------------------------------------------------*/
+
+int echo_can_bg_update(echo_can_state_t *ec)
+{
+    int i;
+    int rd;
+    int frames = 0;
+    int gated;
+    int xfer;
+    echo_can_bg_frame_t *f;
+
+    if (ec->bg_frames == NULL)
+        return  0;
+
+    rd = atomic_load(&ec->bg_rd);
+    while (rd != atomic_load(&ec->bg_wr))
+    {
+        f = &ec->bg_frames[rd % ECHO_CAN_BG_FRAMES];
+        if (f->resync)
+        {
+            /* Blocks were missed so the history no longer matches the foreground.  Don't
+               adapt until it has filled again. */
+            fir16_flush(&ec->fir_state_bg);
+            ec->fir_state_bg.curr_pos = ec->taps - 1;
+            ec->curr_pos = ec->taps - 1;
+            ec->Pstates = 0;
+            ec->cond_met = 0;
+            ec->bg_warmup = ec->taps;
+        }
+
+        xfer = 0;
+        for (i = 0;  i < f->n;  i++)
+        {
+            gated = f->gated  ||  (ec->bg_warmup > 0);
+            if (ec->bg_warmup > 0)
+                ec->bg_warmup--;
+            echo_can_bg_filter(ec, f->tx[i], f->rx[i], gated, f->dwell[i] & ECHO_CAN_BG_ADAPT);
+            if (echo_can_transfer(ec, f->lclean[i], f->ltx[i], f->adaption_mode, gated, f->dwell[i] & ECHO_CAN_BG_XFER))
+            {
+                /* Only while the foreground isn't still to pick up the last copy */
+                if (!atomic_load(&ec->bg_xfer_ready))
+                {
+                    memcpy(ec->bg_xfer_taps, ec->fir_taps16[1], ec->taps*sizeof(int16_t));
+                    xfer = 1;
+                }
+            }
+            if (ec->curr_pos <= 0)
+                ec->curr_pos = ec->taps;
+            ec->curr_pos--;
+        }
+        if (xfer)
+            atomic_store(&ec->bg_xfer_ready, 1);
+
+        atomic_store(&ec->bg_rd, ++rd);
+        frames++;
+    }
+    return  frames;
 }
 
 /*- End of function --------------------------------------------------------*/
@@ -111,9 +111,11 @@ produces a fairly accurate result from a very short burst of far end energy.
 The echo cancellor processes both the transmit and receive streams sample by
 sample. The processing function is not declared inline. Unfortunately,
 cancellation requires many operations per sample, so the call overhead is only a
-minor burden. 
+minor burden. echo_can_update_block() may be used to process a whole frame of
+samples in one call.
 */
 
+#include <stdatomic.h>
 #include "fir.h"
 
 /* Mask bits for the adaption mode */
@@ -125,6 +127,32 @@ minor burden.
 #define ECHO_CAN_USE_TX_HPF         0x10
 #define ECHO_CAN_USE_RX_HPF         0x20
 #define ECHO_CAN_DISABLE            0x40
+#define ECHO_CAN_USE_PNLMS          0x80
+
+/* Proportionate adaption (ECHO_CAN_USE_PNLMS) works on blocks of this many taps */
+#define ECHO_CAN_PNLMS_BLOCK        16
+
+/* Number of foreground blocks the background filter may be behind in the pipelined mode */
+#define ECHO_CAN_BG_FRAMES          2
+
+/* Double talk state recorded per sample for the background filter */
+#define ECHO_CAN_BG_ADAPT           0x01
+#define ECHO_CAN_BG_XFER            0x02
+
+/*!
+    One block of foreground processing recorded for the background filter in the
+    pipelined mode.
+*/
+typedef struct
+{
+    int n;
+    int resync;
+    int adaption_mode;
+    int gated;
+    int16_t *tx, *rx;
+    int16_t *lclean, *ltx;
+    uint8_t *dwell;
+} echo_can_bg_frame_t;
 
 /*!
     G.168 echo canceller descriptor. This defines the working state for a line
@@ -172,9 +200,38 @@ typedef struct
     int cng_rndnum;
     int cng_filter;
     
+    /* set while there is no speech to adapt to (see echo_can_bg_gate) */
+    int bg_gated;
+
+    /* right shift applied to the inputs (see echo_can_input_shift) */
+    int in_shift;
+
+    /* samples the NLP suppressed the residual echo of since the last flush */
+    uint32_t nlp_samples;
+
     /* snapshot sample of coeffs used for development */
     int16_t *snapshot;       
 
+    /* proportionate adaption state (ECHO_CAN_USE_PNLMS) */
+    int pnlms_blocks;
+    int pnlms_count;           /* samples until the block gains are recomputed */
+    int pnlms_probe;           /* next block checked for an inactive one to adapt */
+    int pnlms_num_active;
+    uint16_t *pnlms_gain;      /* Q8 step gain for each block, 0 while inactive */
+    uint8_t *pnlms_active;     /* indices of the active blocks */
+
+    /* pipelined mode state (see echo_can_split), bg_frames is NULL when not split */
+    echo_can_bg_frame_t *bg_frames;
+    echo_can_bg_frame_t bg_frame[ECHO_CAN_BG_FRAMES];
+    int bg_max_block;
+    atomic_int bg_wr;          /* blocks recorded by the foreground */
+    atomic_int bg_rd;          /* blocks processed by the background */
+    atomic_int bg_xfer_ready;  /* set while bg_xfer_taps holds coefficients to transfer */
+    int16_t *bg_xfer_taps;
+    int bg_resync;
+    int bg_warmup;
+    int bg_overruns;           /* blocks the background filter missed */
+
 } echo_can_state_t;
 
 /*! Create a voice echo canceller context.
@@ -201,6 +258,39 @@ void echo_can_adaption_mode(echo_can_state_t *ec, int adaption_mode);
 
 void echo_can_snapshot(echo_can_state_t *ec);
 
+/*! Gate the background filter of a voice echo canceller context.  While gated (e.g. during
+    far end silence, when there is no echo to adapt to) the background filter is neither
+    run nor adapted and no transfer to the foreground filter takes place.
+    \param ec The echo canceller context.
+    \param gated Non-zero to gate the background filter.
+*/
+void echo_can_bg_gate(echo_can_state_t *ec, int gated);
+
+/*! Set the scaling of the inputs of a voice echo canceller context.  The transmitted
+    and received samples are shifted right by this amount (1 by default) before they
+    are processed and the output is shifted back up (saturating).  The shift leaves
+    headroom for the difference between the received signal and the echo estimate
+    when the inputs are near full scale.  A shift of 0 keeps the full resolution of
+    quieter signals.  Both inputs scale the same, so the coefficients stay valid when
+    it changes.
+    \param ec The echo canceller context.
+    \param shift 0 or 1.
+*/
+void echo_can_input_shift(echo_can_state_t *ec, int shift);
+
+/*! Copy the foreground filter coefficients out of a voice echo canceller context.
+    \param ec The echo canceller context.
+    \param coeffs The destination, which must hold the length of the canceller.
+*/
+void echo_can_get_coeffs(echo_can_state_t *ec, int16_t *coeffs);
+
+/*! Seed the foreground and background filters of a voice echo canceller context (e.g.
+    with coefficients it converged to previously) so it starts out adapted.
+    \param ec The echo canceller context.
+    \param coeffs The coefficients, which must hold the length of the canceller.
+*/
+void echo_can_set_coeffs(echo_can_state_t *ec, const int16_t *coeffs);
+
 /*! Process a sample through a voice echo canceller.
     \param ec The echo canceller context.
     \param tx The transmitted audio sample.
@@ -209,6 +299,38 @@ void echo_can_snapshot(echo_can_state_t *ec);
 */
 int16_t echo_can_update(echo_can_state_t *ec, int16_t tx, int16_t rx);
 
+/*! Process a block of samples through a voice echo canceller.  This produces
+    exactly the same result as calling echo_can_update() for each sample but
+    without the per-sample call overhead.
+    \param ec The echo canceller context.
+    \param tx The transmitted audio samples.
+    \param rx The received audio samples.
+    \param out The clean (echo cancelled) received samples (may be the same as rx).
+    \param n The number of samples to process.
+*/
+void echo_can_update_block(echo_can_state_t *ec, const int16_t *tx, const int16_t *rx, int16_t *out, int n);
+
+/*! Split a voice echo canceller context so the background filter, its adaption
+    and the transfer decision run separately (e.g. on another core) one block behind
+    the foreground filter.  After this echo_can_update_block() only runs the
+    foreground filter and the NLP and records each block for echo_can_bg_update().
+    Coefficients are handed back through a second buffer swapped in at the start of
+    the next block.  echo_can_update() must not be used on a split context and the
+    caller must make sure echo_can_bg_update() isn't running while flushing,
+    setting the coefficients of or freeing it.
+    \param ec The echo canceller context.
+    \param max_block The largest block that will be passed to echo_can_update_block().
+    \return 0 for OK, -1 if the block records could not be allocated.
+*/
+int echo_can_split(echo_can_state_t *ec, int max_block);
+
+/*! Run the background filter of a split voice echo canceller context over the
+    blocks recorded since the last call.
+    \param ec The echo canceller context.
+    \return The number of blocks processed.
+*/
+int echo_can_bg_update(echo_can_state_t *ec);
+
 /*! Process to high pass filter the tx signal.
     \param ec The echo canceller context.
     \param tx The transmitted auio sample.
@@ -38,6 +38,16 @@
 #include "mmx.h"
 #endif
 
+#include "alloc.h"
+
+/* On the ESP32 (Xtensa LX6) use a kernel with a doubled history buffer so each
+   filter pass is a single contiguous, unrolled multiply-accumulate loop without
+   the wrap-around split of the generic C version.  Define USE_GENERIC_FIR to
+   force the generic code. */
+#if defined(__XTENSA__)  &&  !defined(USE_MMX)  &&  !defined(USE_SSE2)  &&  !defined(USE_GENERIC_FIR)
+#define USE_XTENSA_FIR
+#endif
+
 /*!
     16 bit integer FIR descriptor. This defines the working state for a single
     instance of an FIR filter using 16 bit integer coefficients.
@@ -87,11 +97,11 @@ static __inline__ const int16_t *fir16_create(fir16_state_t *fir,
     fir->taps = taps;
     fir->curr_pos = taps - 1;
     fir->coeffs = coeffs;
-#if defined(USE_MMX)  ||  defined(USE_SSE2)
-    if ((fir->history = malloc(2*taps*sizeof(int16_t))))
+#if defined(USE_MMX)  ||  defined(USE_SSE2)  ||  defined(USE_XTENSA_FIR)
+    if ((fir->history = span_alloc(2*taps*sizeof(int16_t))))
         memset(fir->history, 0, 2*taps*sizeof(int16_t));
 #else
-    if ((fir->history = (int16_t *) malloc(taps*sizeof(int16_t))))
+    if ((fir->history = (int16_t *) span_alloc(taps*sizeof(int16_t))))
         memset(fir->history, 0, taps*sizeof(int16_t));
 #endif
     return fir->history;
@@ -100,7 +110,7 @@ static __inline__ const int16_t *fir16_create(fir16_state_t *fir,
 
 static __inline__ void fir16_flush(fir16_state_t *fir)
 {
-#if defined(USE_MMX)  ||  defined(USE_SSE2)
+#if defined(USE_MMX)  ||  defined(USE_SSE2)  ||  defined(USE_XTENSA_FIR)
     memset(fir->history, 0, 2*fir->taps*sizeof(int16_t));
 #else
     memset(fir->history, 0, fir->taps*sizeof(int16_t));
@@ -110,7 +120,7 @@ static __inline__ void fir16_flush(fir16_state_t *fir)
 
 static __inline__ void fir16_free(fir16_state_t *fir)
 {
-    free(fir->history);
+    span_free(fir->history);
 }
 /*- End of function --------------------------------------------------------*/
 
@@ -182,6 +192,30 @@ static __inline__ int16_t fir16(fir16_state_t *fir, int16_t sample)
     psrldq_i2r(4, xmm0);
     paddd_r2r(xmm0, xmm4);
     movd_r2m(xmm4, y);
+#elif defined(USE_XTENSA_FIR)
+    const int16_t *coeffs;
+    const int16_t *hist;
+    int32_t y0;
+    int32_t y1;
+    int32_t y2;
+    int32_t y3;
+
+    fir->history[fir->curr_pos] = sample;
+    fir->history[fir->curr_pos + fir->taps] = sample;
+    coeffs = fir->coeffs;
+    hist = &fir->history[fir->curr_pos];
+    y0 = y1 = y2 = y3 = 0;
+    /* 4 samples per iteration, so the filter must be a multiple of 4 long. */
+    for (i = fir->taps;  i > 0;  i -= 4)
+    {
+        y0 += (int32_t) coeffs[0]*hist[0];
+        y1 += (int32_t) coeffs[1]*hist[1];
+        y2 += (int32_t) coeffs[2]*hist[2];
+        y3 += (int32_t) coeffs[3]*hist[3];
+        coeffs += 4;
+        hist += 4;
+    }
+    y = y0 + y1 + y2 + y3;
 #else
     int offset1;
     int offset2;
@@ -203,6 +237,20 @@ static __inline__ int16_t fir16(fir16_state_t *fir, int16_t sample)
 }
 /*- End of function --------------------------------------------------------*/
 
+/* Add a sample to the history of a filter without computing its output, so an
+   unused filter stays in step with the signal. */
+static __inline__ void fir16_push(fir16_state_t *fir, int16_t sample)
+{
+    fir->history[fir->curr_pos] = sample;
+#if defined(USE_MMX)  ||  defined(USE_SSE2)  ||  defined(USE_XTENSA_FIR)
+    fir->history[fir->curr_pos + fir->taps] = sample;
+#endif
+    if (fir->curr_pos <= 0)
+    	fir->curr_pos = fir->taps;
+    fir->curr_pos--;
+}
+/*- End of function --------------------------------------------------------*/
+
 static __inline__ const int16_t *fir32_create(fir32_state_t *fir,
                                               const int32_t *coeffs,
                                               int taps)
@@ -210,7 +258,7 @@ static __inline__ const int16_t *fir32_create(fir32_state_t *fir,
     fir->taps = taps;
     fir->curr_pos = taps - 1;
     fir->coeffs = coeffs;
-    fir->history = (int16_t *) malloc(taps*sizeof(int16_t));
+    fir->history = (int16_t *) span_alloc(taps*sizeof(int16_t));
     if (fir->history)
     	memset(fir->history, '\0', taps*sizeof(int16_t));
     return fir->history;
@@ -225,7 +273,7 @@ static __inline__ void fir32_flush(fir32_state_t *fir)
 
 static __inline__ void fir32_free(fir32_state_t *fir)
 {
-    free(fir->history);
+    span_free(fir->history);
 }
 /*- End of function --------------------------------------------------------*/
 
@@ -258,7 +306,7 @@ static __inline__ const float *fir_float_create(fir_float_state_t *fir,
     fir->taps = taps;
     fir->curr_pos = taps - 1;
     fir->coeffs = coeffs;
-    fir->history = (float *) malloc(taps*sizeof(float));
+    fir->history = (float *) span_alloc(taps*sizeof(float));
     if (fir->history)
         memset(fir->history, '\0', taps*sizeof(float));
     return fir->history;
@@ -267,7 +315,7 @@ static __inline__ const float *fir_float_create(fir_float_state_t *fir,
     
 static __inline__ void fir_float_free(fir_float_state_t *fir)
 {
-    free(fir->history);
+    span_free(fir->history);
 }
 /*- End of function --------------------------------------------------------*/
 
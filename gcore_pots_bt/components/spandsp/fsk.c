@@ -31,6 +31,7 @@
 #include <math.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "complex.h"
 #include "dds.h"
 #include "power_meter.h"
@@ -145,7 +146,7 @@ SPAN_DECLARE(fsk_tx_state_t *) fsk_tx_init(fsk_tx_state_t *s,
 {
     if (s == NULL)
     {
-        if ((s = (fsk_tx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (fsk_tx_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -165,7 +166,7 @@ SPAN_DECLARE(int) fsk_tx_release(fsk_tx_state_t *s)
 
 SPAN_DECLARE(int) fsk_tx_free(fsk_tx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -307,7 +308,7 @@ SPAN_DECLARE(fsk_rx_state_t *) fsk_rx_init(fsk_rx_state_t *s,
 {
     if (s == NULL)
     {
-        if ((s = (fsk_rx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (fsk_rx_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -327,7 +328,7 @@ SPAN_DECLARE(int) fsk_rx_release(fsk_rx_state_t *s)
 
 SPAN_DECLARE(int) fsk_rx_free(fsk_rx_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -38,6 +38,7 @@
 #include <time.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "logging.h"
 
 
@@ -238,7 +239,7 @@ SPAN_DECLARE(logging_state_t *) span_log_init(logging_state_t *s, int level, con
 {
     if (s == NULL)
     {
-        if ((s = (logging_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (logging_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     s->span_error = __span_error;
@@ -262,7 +263,7 @@ SPAN_DECLARE(int) span_log_release(logging_state_t *s)
 SPAN_DECLARE(int) span_log_free(logging_state_t *s)
 {
     if (s)
-        free(s);
+        span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
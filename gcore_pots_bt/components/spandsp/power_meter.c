@@ -35,13 +35,14 @@
 
 
 #include "telephony.h"
+#include "alloc.h"
 #include "power_meter.h"
 
 SPAN_DECLARE(power_meter_t *) power_meter_init(power_meter_t *s, int shift)
 {
     if (s == NULL)
     {
-        if ((s = (power_meter_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (power_meter_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     s->shift = shift;
@@ -59,7 +60,7 @@ SPAN_DECLARE(int) power_meter_release(power_meter_t *s)
 SPAN_DECLARE(int) power_meter_free(power_meter_t *s)
 {
     if (s)
-        free(s);
+        span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -171,7 +172,7 @@ SPAN_DECLARE(power_surge_detector_state_t *) power_surge_detector_init(power_sur
 
     if (s == NULL)
     {
-        if ((s = (power_surge_detector_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (power_surge_detector_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -195,7 +196,7 @@ SPAN_DECLARE(int) power_surge_detector_release(power_surge_detector_state_t *s)
 SPAN_DECLARE(int) power_surge_detector_free(power_surge_detector_state_t *s)
 {
     if (s)
-        free(s);
+        span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
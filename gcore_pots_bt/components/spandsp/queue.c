@@ -35,6 +35,7 @@
 
 #define SPANDSP_FULLY_DEFINE_QUEUE_STATE_T
 #include "telephony.h"
+#include "alloc.h"
 #include "queue.h"
 
 
@@ -390,7 +391,7 @@ SPAN_DECLARE(queue_state_t *) queue_init(queue_state_t *s, int len, int flags)
 {
     if (s == NULL)
     {
-        if ((s = (queue_state_t *) malloc(sizeof(*s) + len + 1)) == NULL)
+        if ((s = (queue_state_t *) span_alloc(sizeof(*s) + len + 1)) == NULL)
             return NULL;
     }
     s->iptr =
@@ -409,7 +410,7 @@ SPAN_DECLARE(int) queue_release(queue_state_t *s)
 
 SPAN_DECLARE(int) queue_free(queue_state_t *s)
 {
-    free(s);
+    span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
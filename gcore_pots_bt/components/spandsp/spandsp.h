@@ -36,6 +36,7 @@
 #include <time.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "fast_convert.h"
 #include "logging.h"
 #include "complex.h"
@@ -46,6 +47,7 @@
 #include "fir.h"
 #include "power_meter.h"
 #include "dc_restore.h"
+#include "plc.h"
 #include "dds.h"
 #include "echo.h"
 #include "crc.h"
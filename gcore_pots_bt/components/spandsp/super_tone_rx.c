@@ -35,6 +35,7 @@
 #include <math.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "fast_convert.h"
 #include "complex.h"
 #include "vector_float.h"
@@ -84,7 +85,7 @@ static int add_super_tone_freq(super_tone_rx_descriptor_t *desc, int freq)
     desc->pitches[i][1] = desc->monitored_frequencies;
     if (desc->monitored_frequencies%5 == 0)
     {
-        desc->desc = (goertzel_descriptor_t *) realloc(desc->desc, (desc->monitored_frequencies + 5)*sizeof(goertzel_descriptor_t));
+        desc->desc = (goertzel_descriptor_t *) span_realloc(desc->desc, (desc->monitored_frequencies + 5)*sizeof(goertzel_descriptor_t));
     }
     make_goertzel_descriptor(&desc->desc[desc->monitored_frequencies++], (float) freq, SUPER_TONE_BINS);
     desc->used_frequencies++;
@@ -96,8 +97,8 @@ SPAN_DECLARE(int) super_tone_rx_add_tone(super_tone_rx_descriptor_t *desc)
 {
     if (desc->tones%5 == 0)
     {
-        desc->tone_list = (super_tone_rx_segment_t **) realloc(desc->tone_list, (desc->tones + 5)*sizeof(super_tone_rx_segment_t *));
-        desc->tone_segs = (int *) realloc(desc->tone_segs, (desc->tones + 5)*sizeof(int));
+        desc->tone_list = (super_tone_rx_segment_t **) span_realloc(desc->tone_list, (desc->tones + 5)*sizeof(super_tone_rx_segment_t *));
+        desc->tone_segs = (int *) span_realloc(desc->tone_segs, (desc->tones + 5)*sizeof(int));
     }
     desc->tone_list[desc->tones] = NULL;
     desc->tone_segs[desc->tones] = 0;
@@ -118,7 +119,7 @@ SPAN_DECLARE(int) super_tone_rx_add_element(super_tone_rx_descriptor_t *desc,
     step = desc->tone_segs[tone];
     if (step%5 == 0)
     {
-        desc->tone_list[tone] = (super_tone_rx_segment_t *) realloc(desc->tone_list[tone], (step + 5)*sizeof(super_tone_rx_segment_t));
+        desc->tone_list[tone] = (super_tone_rx_segment_t *) span_realloc(desc->tone_list[tone], (step + 5)*sizeof(super_tone_rx_segment_t));
     }
     desc->tone_list[tone][step].f1 = add_super_tone_freq(desc, f1);
     desc->tone_list[tone][step].f2 = add_super_tone_freq(desc, f2);
@@ -188,7 +189,7 @@ SPAN_DECLARE(super_tone_rx_descriptor_t *) super_tone_rx_make_descriptor(super_t
 {
     if (desc == NULL)
     {
-        if ((desc = (super_tone_rx_descriptor_t *) malloc(sizeof(*desc))) == NULL)
+        if ((desc = (super_tone_rx_descriptor_t *) span_alloc(sizeof(*desc))) == NULL)
             return NULL;
     }
     desc->tone_list = NULL;
@@ -211,15 +212,15 @@ SPAN_DECLARE(int) super_tone_rx_free_descriptor(super_tone_rx_descriptor_t *desc
         for (i = 0; i < desc->tones; i++)
         {
             if (desc->tone_list[i])
-                free(desc->tone_list[i]);
+                span_free(desc->tone_list[i]);
         }
         if (desc->tone_list)
-            free(desc->tone_list);
+            span_free(desc->tone_list);
         if (desc->tone_segs)
-            free(desc->tone_segs);
+            span_free(desc->tone_segs);
         if (desc->desc)
-            free(desc->desc);
-        free(desc);
+            span_free(desc->desc);
+        span_free(desc);
     }
     return 0;
 }
@@ -254,7 +255,7 @@ SPAN_DECLARE(super_tone_rx_state_t *) super_tone_rx_init(super_tone_rx_state_t *
         return NULL;
     if (s == NULL)
     {
-        if ((s = (super_tone_rx_state_t *) malloc(sizeof(*s) + desc->monitored_frequencies*sizeof(goertzel_state_t))) == NULL)
+        if ((s = (super_tone_rx_state_t *) span_alloc(sizeof(*s) + desc->monitored_frequencies*sizeof(goertzel_state_t))) == NULL)
             return NULL;
     }
 
@@ -290,7 +291,7 @@ SPAN_DECLARE(int) super_tone_rx_release(super_tone_rx_state_t *s)
 SPAN_DECLARE(int) super_tone_rx_free(super_tone_rx_state_t *s)
 {
     if (s)
-        free(s);
+        span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -474,8 +475,35 @@ SPAN_DECLARE(int) super_tone_rx(super_tone_rx_state_t *s, const int16_t amp[], i
 
 SPAN_DECLARE(int) super_tone_rx_fillin(super_tone_rx_state_t *s, int samples)
 {
-    /* TODO: Roll the detector forward without a state change */
-    return 0;
+    static const int16_t silence[SUPER_TONE_BINS] = {0};
+    int len;
+    int remaining;
+
+    /* Treat the missing samples as silence, so cadences keep their timing. Finish any
+       partially filled Goertzel block with real zeros, then step the cadence tracker
+       through whole blocks without running the filters. */
+    remaining = samples;
+    if (s->state[0].current_sample > 0)
+    {
+        len = SUPER_TONE_BINS - s->state[0].current_sample;
+        if (len > remaining)
+            len = remaining;
+        super_tone_rx(s, silence, len);
+        remaining -= len;
+    }
+    while (remaining >= SUPER_TONE_BINS)
+    {
+#if defined(SPANDSP_USE_FIXED_POINT)
+        s->energy = 0;
+#else
+        s->energy = 0.0f;
+#endif
+        super_tone_chunk(s);
+        remaining -= SUPER_TONE_BINS;
+    }
+    if (remaining > 0)
+        super_tone_rx(s, silence, remaining);
+    return samples;
 }
 /*- End of function --------------------------------------------------------*/
 /*- End of file ------------------------------------------------------------*/
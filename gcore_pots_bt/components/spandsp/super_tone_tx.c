@@ -35,6 +35,7 @@
 #include <math.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "fast_convert.h"
 #include "complex.h"
 #include "dds.h"
@@ -67,48 +68,68 @@ SPAN_DECLARE(super_tone_tx_step_t *) super_tone_tx_make_step_4(super_tone_tx_ste
 {
 	if (s == NULL)
     {
-        if ((s = (super_tone_tx_step_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (super_tone_tx_step_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     if (f1 >= 1.0f)
     {    
+#if defined(SPANDSP_DDS_FIXED_POINT)
+        s->tone[0].phase_rate = dds_phase_rate(f1);
+        s->tone[0].gain = dds_scaling_dbm0(level);
+#else
         s->tone[0].phase_rate = dds_phase_ratef(f1);
         s->tone[0].gain = dds_scaling_dbm0f(level);
+#endif
     }
     else
     {
         s->tone[0].phase_rate = 0;
-        s->tone[0].gain = 0.0f;
+        s->tone[0].gain = 0;
     }
     if (f2 >= 1.0f)
     {
+#if defined(SPANDSP_DDS_FIXED_POINT)
+        s->tone[1].phase_rate = dds_phase_rate(f2);
+        s->tone[1].gain = dds_scaling_dbm0(level);
+#else
         s->tone[1].phase_rate = dds_phase_ratef(f2);
         s->tone[1].gain = dds_scaling_dbm0f(level);
+#endif
     }
     else
     {
         s->tone[1].phase_rate = 0;
-        s->tone[1].gain = 0.0f;
+        s->tone[1].gain = 0;
     }
 	if (f3 >= 1.0f)
     {    
+#if defined(SPANDSP_DDS_FIXED_POINT)
+        s->tone[2].phase_rate = dds_phase_rate(f3);
+        s->tone[2].gain = dds_scaling_dbm0(level);
+#else
         s->tone[2].phase_rate = dds_phase_ratef(f3);
         s->tone[2].gain = dds_scaling_dbm0f(level);
+#endif
     }
     else
     {
         s->tone[2].phase_rate = 0;
-        s->tone[2].gain = 0.0f;
+        s->tone[2].gain = 0;
     }
     if (f4 >= 1.0f)
     {
+#if defined(SPANDSP_DDS_FIXED_POINT)
+        s->tone[3].phase_rate = dds_phase_rate(f4);
+        s->tone[3].gain = dds_scaling_dbm0(level);
+#else
         s->tone[3].phase_rate = dds_phase_ratef(f4);
         s->tone[3].gain = dds_scaling_dbm0f(level);
+#endif
     }
     else
     {
         s->tone[3].phase_rate = 0;
-        s->tone[3].gain = 0.0f;
+        s->tone[3].gain = 0;
     }
     s->tone_on = (f1 > 0.0f);
     s->length = length*SAMPLE_RATE/1000;
@@ -129,33 +150,43 @@ SPAN_DECLARE(super_tone_tx_step_t *) super_tone_tx_make_step(super_tone_tx_step_
 {
     if (s == NULL)
     {
-        if ((s = (super_tone_tx_step_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (super_tone_tx_step_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     if (f1 >= 1.0f)
     {    
+#if defined(SPANDSP_DDS_FIXED_POINT)
+        s->tone[0].phase_rate = dds_phase_rate(f1);
+        s->tone[0].gain = dds_scaling_dbm0(l1);
+#else
         s->tone[0].phase_rate = dds_phase_ratef(f1);
         s->tone[0].gain = dds_scaling_dbm0f(l1);
+#endif
     }
     else
     {
         s->tone[0].phase_rate = 0;
-        s->tone[0].gain = 0.0f;
+        s->tone[0].gain = 0;
     }
     if (f2 >= 1.0f)
     {
+#if defined(SPANDSP_DDS_FIXED_POINT)
+        s->tone[1].phase_rate = dds_phase_rate(f2);
+        s->tone[1].gain = dds_scaling_dbm0(l2);
+#else
         s->tone[1].phase_rate = dds_phase_ratef(f2);
         s->tone[1].gain = dds_scaling_dbm0f(l2);
+#endif
     }
     else
     {
         s->tone[1].phase_rate = 0;
-        s->tone[1].gain = 0.0f;
+        s->tone[1].gain = 0;
     }
     s->tone[2].phase_rate = 0;
-    s->tone[2].gain = 0.0f;
+    s->tone[2].gain = 0;
     s->tone[3].phase_rate = 0;
-    s->tone[3].gain = 0.0f;
+    s->tone[3].gain = 0;
     s->tone_on = (f1 > 0.0f);
     s->length = length*SAMPLE_RATE/1000;
     s->cycles = cycles;
@@ -176,7 +207,7 @@ SPAN_DECLARE(int) super_tone_tx_free_tone(super_tone_tx_step_t *s)
             super_tone_tx_free_tone(s->nest);
         t = s;
         s = s->next;
-        free(t);
+        span_free(t);
     }
     return 0;
 }
@@ -188,7 +219,7 @@ SPAN_DECLARE(super_tone_tx_state_t *) super_tone_tx_init(super_tone_tx_state_t *
         return NULL;
     if (s == NULL)
     {
-        if ((s = (super_tone_tx_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (super_tone_tx_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
     memset(s, 0, sizeof(*s));
@@ -210,7 +241,7 @@ SPAN_DECLARE(int) super_tone_tx_release(super_tone_tx_state_t *s)
 SPAN_DECLARE(int) super_tone_tx_free(super_tone_tx_state_t *s)
 {
     if (s)
-        free(s);
+        span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -221,7 +252,11 @@ SPAN_DECLARE(int) super_tone_tx(super_tone_tx_state_t *s, int16_t amp[], int max
     int limit;
     int len;
     int i;
+#if defined(SPANDSP_DDS_FIXED_POINT)
+    int32_t xamp;
+#else
     float xamp;
+#endif
     super_tone_tx_step_t *tree;
 
     if (s->level < 0  ||  s->level > 3)
@@ -260,15 +295,31 @@ SPAN_DECLARE(int) super_tone_tx(super_tone_tx_state_t *s, int16_t amp[], int max
                 for (limit = len + samples;  samples < limit;  samples++)
                 {
                     /* There must be two, and only two tones */
+#if defined(SPANDSP_DDS_FIXED_POINT)
+                    xamp = ((int32_t) dds_mod(&s->phase[0], -s->tone[0].phase_rate, s->tone[0].gain, 0)
+                            *(32767 + (int32_t) dds_mod(&s->phase[1], s->tone[1].phase_rate, s->tone[1].gain, 0))) >> 15;
+                    amp[samples] = (int16_t) xamp;
+#else
                     xamp = dds_modf(&s->phase[0], -s->tone[0].phase_rate, s->tone[0].gain, 0)
                          *(1.0f + dds_modf(&s->phase[1], s->tone[1].phase_rate, s->tone[1].gain, 0));
                     amp[samples] = (int16_t) lfastrintf(xamp);
+#endif
                 }
             }
             else
             {
                 for (limit = len + samples;  samples < limit;  samples++)
                 {
+#if defined(SPANDSP_DDS_FIXED_POINT)
+                    xamp = 0;
+                    for (i = 0;  i < 4;  i++)
+                    {
+                        if (s->tone[i].phase_rate == 0)
+                            break;
+                        xamp += dds_mod(&s->phase[i], s->tone[i].phase_rate, s->tone[i].gain, 0);
+                    }
+                    amp[samples] = (int16_t) xamp;
+#else
                     xamp = 0.0f;
                     for (i = 0;  i < 4;  i++)
                     {
@@ -277,6 +328,7 @@ SPAN_DECLARE(int) super_tone_tx(super_tone_tx_state_t *s, int16_t amp[], int max
                         xamp += dds_modf(&s->phase[i], s->tone[i].phase_rate, s->tone[i].gain, 0);
                     }
                     amp[samples] = (int16_t) lfastrintf(xamp);
+#endif
                 }
             }
             if (s->current_position)
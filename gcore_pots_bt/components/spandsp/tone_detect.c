@@ -34,6 +34,7 @@
 #include <fcntl.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "complex.h"
 #include "complex_vector_float.h"
 #include "tone_detect.h"
@@ -61,7 +62,7 @@ SPAN_DECLARE(goertzel_state_t *) goertzel_init(goertzel_state_t *s,
 {
     if (s == NULL)
     {
-        if ((s = (goertzel_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (goertzel_state_t *) span_alloc(sizeof(*s))) == NULL)
             return NULL;
     }
 #if defined(SPANDSP_USE_FIXED_POINT)
@@ -87,7 +88,7 @@ SPAN_DECLARE(int) goertzel_release(goertzel_state_t *s)
 SPAN_DECLARE(int) goertzel_free(goertzel_state_t *s)
 {
     if (s)
-        free(s);
+        span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
@@ -187,6 +188,158 @@ SPAN_DECLARE(float) goertzel_result(goertzel_state_t *s)
 }
 /*- End of function --------------------------------------------------------*/
 
+/* Samples scaled at a time by goertzel_bank_rx() */
+#define GOERTZEL_BANK_CHUNK     64
+
+static void goertzel_bank_block_end(goertzel_bank_t *s)
+{
+    int32_t v1;
+    int32_t v2;
+    int32_t v3;
+    int64_t x;
+    int i;
+
+    for (i = 0;  i < s->num_freqs;  i++)
+    {
+        /* Push a zero through the process to finish things off. */
+        v1 = s->v2[i];
+        v2 = s->v3[i];
+        v3 = ((s->fac[i]*v2) >> 14) - v1;
+        /* Now calculate the non-recursive side of the filter. The squares of the 32 bit
+           states need more than 32 bits, but this is only done once per block. */
+        x = (int64_t) v3*v3 + (int64_t) v2*v2 - ((((int64_t) v3*s->fac[i]) >> 14)*v2);
+        s->result[i] = (x > INT32_MAX)  ?  INT32_MAX  :  (int32_t) x;
+        s->v2[i] =
+        s->v3[i] = 0;
+    }
+    for (i = 0;  i < s->num_clients;  i++)
+        s->client[i].handler(s->client[i].user_data, &s->result[s->client[i].first], s->energy);
+    s->energy = 0;
+    s->current_sample = 0;
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(goertzel_bank_t *) goertzel_bank_init(goertzel_bank_t *s, int block_len, int amp_shift)
+{
+    if (s == NULL)
+    {
+        if ((s = (goertzel_bank_t *) span_alloc(sizeof(*s))) == NULL)
+            return NULL;
+    }
+    memset(s, 0, sizeof(*s));
+    s->block_len = block_len;
+    s->amp_shift = amp_shift;
+    return s;
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(int) goertzel_bank_add_client(goertzel_bank_t *s,
+                                           const float freqs[],
+                                           int num,
+                                           goertzel_bank_handler_t handler,
+                                           void *user_data)
+{
+    goertzel_bank_client_t *c;
+    int i;
+
+    if (s->num_clients >= GOERTZEL_BANK_MAX_CLIENTS  ||  s->num_freqs + num > GOERTZEL_BANK_MAX_FREQS)
+        return -1;
+    c = &s->client[s->num_clients];
+    c->handler = handler;
+    c->user_data = user_data;
+    c->first = s->num_freqs;
+    c->num = num;
+    for (i = 0;  i < num;  i++)
+    {
+        s->fac[s->num_freqs] = lrintf(16384.0f*2.0f*cosf(2.0f*M_PI*(freqs[i]/(float) SAMPLE_RATE)));
+        s->v2[s->num_freqs] =
+        s->v3[s->num_freqs] = 0;
+        s->num_freqs++;
+    }
+    return s->num_clients++;
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(void) goertzel_bank_reset(goertzel_bank_t *s)
+{
+    int i;
+
+    for (i = 0;  i < s->num_freqs;  i++)
+    {
+        s->v2[i] =
+        s->v3[i] = 0;
+    }
+    s->energy = 0;
+    s->current_sample = 0;
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(int) goertzel_bank_rx_scaled(goertzel_bank_t *s, const int32_t xamp[], int samples)
+{
+    int32_t fac;
+    int32_t v1;
+    int32_t v2;
+    int32_t v3;
+    int32_t energy;
+    int sample;
+    int limit;
+    int i;
+    int j;
+
+    for (sample = 0;  sample < samples;  sample = limit)
+    {
+        limit = sample + s->block_len - s->current_sample;
+        if (limit > samples)
+            limit = samples;
+        /* Run each filter over the whole piece of the block with its state in registers */
+        energy = s->energy;
+        for (j = sample;  j < limit;  j++)
+            energy += xamp[j]*xamp[j];
+        s->energy = energy;
+        for (i = 0;  i < s->num_freqs;  i++)
+        {
+            fac = s->fac[i];
+            v2 = s->v2[i];
+            v3 = s->v3[i];
+            for (j = sample;  j < limit;  j++)
+            {
+                v1 = v2;
+                v2 = v3;
+                v3 = ((fac*v2) >> 14) - v1 + xamp[j];
+            }
+            s->v2[i] = v2;
+            s->v3[i] = v3;
+        }
+        s->current_sample += (limit - sample);
+        if (s->current_sample >= s->block_len)
+            goertzel_bank_block_end(s);
+    }
+    return 0;
+}
+/*- End of function --------------------------------------------------------*/
+
+SPAN_DECLARE(int) goertzel_bank_rx(goertzel_bank_t *s, const int16_t amp[], int samples)
+{
+    int32_t xamp[GOERTZEL_BANK_CHUNK];
+    int32_t round;
+    int sample;
+    int n;
+    int j;
+
+    round = (s->amp_shift > 0)  ?  (1 << (s->amp_shift - 1))  :  0;
+    for (sample = 0;  sample < samples;  sample += n)
+    {
+        n = samples - sample;
+        if (n > GOERTZEL_BANK_CHUNK)
+            n = GOERTZEL_BANK_CHUNK;
+        for (j = 0;  j < n;  j++)
+            xamp[j] = (amp[sample + j] + round) >> s->amp_shift;
+        goertzel_bank_rx_scaled(s, xamp, n);
+    }
+    return 0;
+}
+/*- End of function --------------------------------------------------------*/
+
 SPAN_DECLARE(complexf_t) periodogram(const complexf_t coeffs[], const complexf_t amp[], int len)
 {
     complexf_t sum;
@@ -57,6 +57,53 @@ typedef struct goertzel_state_s
     int current_sample;
 } goertzel_state_t;
 
+/*! Most frequencies a shared Goertzel filter bank evaluates. */
+#define GOERTZEL_BANK_MAX_FREQS     16
+/*! Most detectors sharing a Goertzel filter bank. */
+#define GOERTZEL_BANK_MAX_CLIENTS   4
+
+/*! Called at the end of each filter bank block with the energies of a detector's
+    frequencies, in the order they were registered, and the energy of the whole block. */
+typedef void (*goertzel_bank_handler_t)(void *user_data, const int32_t energy[], int32_t total_energy);
+
+/*!
+    A detector sharing a Goertzel filter bank.
+*/
+typedef struct goertzel_bank_client_s
+{
+    goertzel_bank_handler_t handler;
+    void *user_data;
+    /*! Index of the detector's first frequency in the bank. */
+    int first;
+    int num;
+} goertzel_bank_client_t;
+
+/*!
+    Integer Goertzel filter bank state. Every registered frequency is evaluated over the
+    same blocks in a single pass through the samples, and each detector's decision logic
+    is called with its results when a block ends. So detectors watching the same signal
+    (e.g. DTMF and CAS) cost little more than the filters they add.
+*/
+typedef struct goertzel_bank_s
+{
+    /*! Samples per block. */
+    int block_len;
+    /*! Input samples are scaled down by this many bits before entering the filters. */
+    int amp_shift;
+    int current_sample;
+    int num_freqs;
+    int num_clients;
+    /*! 2*cos(2*pi*f/SAMPLE_RATE) in Q14 */
+    int32_t fac[GOERTZEL_BANK_MAX_FREQS];
+    int32_t v2[GOERTZEL_BANK_MAX_FREQS];
+    int32_t v3[GOERTZEL_BANK_MAX_FREQS];
+    /*! The accumulating total energy of the (scaled) samples in the block. */
+    int32_t energy;
+    /*! Filter results of the last block. */
+    int32_t result[GOERTZEL_BANK_MAX_FREQS];
+    goertzel_bank_client_t client[GOERTZEL_BANK_MAX_CLIENTS];
+} goertzel_bank_t;
+
 
 #if defined(__cplusplus)
 extern "C"
@@ -173,6 +220,47 @@ static __inline__ void goertzel_samplex(goertzel_state_t *s, float amp)
 }
 /*- End of function --------------------------------------------------------*/
 
+/*! \brief Initialise a shared Goertzel filter bank with no frequencies registered.
+    \param s The filter bank context. If NULL, a context is allocated with malloc.
+    \param block_len The number of samples in each block.
+    \param amp_shift The number of bits input samples are scaled down by. The 32 bit filter
+           states don't overflow with a full scale input for block lengths up to about
+           128 samples with a shift of 6.
+    \return A pointer to the filter bank context. */
+SPAN_DECLARE(goertzel_bank_t *) goertzel_bank_init(goertzel_bank_t *s, int block_len, int amp_shift);
+
+/*! \brief Register a detector's frequencies and the decision logic called with their results.
+    \param s The filter bank context.
+    \param freqs The frequencies, in Hz.
+    \param num The number of frequencies.
+    \param handler The routine called at the end of each block.
+    \param user_data An opaque pointer passed to the handler.
+    \return The index of the detector, or -1 if the bank is full. */
+SPAN_DECLARE(int) goertzel_bank_add_client(goertzel_bank_t *s,
+                                           const float freqs[],
+                                           int num,
+                                           goertzel_bank_handler_t handler,
+                                           void *user_data);
+
+/*! \brief Restart the block being gathered, keeping the registered frequencies.
+    \param s The filter bank context. */
+SPAN_DECLARE(void) goertzel_bank_reset(goertzel_bank_t *s);
+
+/*! \brief Run samples through every filter in the bank.
+    \param s The filter bank context.
+    \param amp The signal samples.
+    \param samples The number of samples.
+    \return 0. */
+SPAN_DECLARE(int) goertzel_bank_rx(goertzel_bank_t *s, const int16_t amp[], int samples);
+
+/*! \brief Run samples already scaled down by amp_shift (e.g. after a detector's own
+           pre-filter) through every filter in the bank.
+    \param s The filter bank context.
+    \param xamp The scaled signal samples.
+    \param samples The number of samples.
+    \return 0. */
+SPAN_DECLARE(int) goertzel_bank_rx_scaled(goertzel_bank_t *s, const int32_t xamp[], int samples);
+
 /*! Generate a Hamming weighted coefficient set, to be used for a periodogram analysis.
     \param coeffs The generated coefficients.
     \param freq The frequency to be matched by the periodogram, in Hz.
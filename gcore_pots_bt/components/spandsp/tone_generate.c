@@ -34,6 +34,7 @@
 #include <math.h>
 
 #include "telephony.h"
+#include "alloc.h"
 #include "fast_convert.h"
 #include "dc_restore.h"
 #include "complex.h"
@@ -59,7 +60,7 @@ SPAN_DECLARE(tone_gen_descriptor_t *) tone_gen_descriptor_init(tone_gen_descript
 {
     if (s == NULL)
     {
-        if ((s = (tone_gen_descriptor_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (tone_gen_descriptor_t *) span_alloc(sizeof(*s))) == NULL)
         {
             return NULL;
         }
@@ -68,7 +69,7 @@ SPAN_DECLARE(tone_gen_descriptor_t *) tone_gen_descriptor_init(tone_gen_descript
 
     if (f1)
     {
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
         s->tone[0].phase_rate = dds_phase_rate((float) f1);
         if (f2 < 0)
             s->tone[0].phase_rate = -s->tone[0].phase_rate;
@@ -82,7 +83,7 @@ SPAN_DECLARE(tone_gen_descriptor_t *) tone_gen_descriptor_init(tone_gen_descript
     }
     if (f2)
     {
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
         s->tone[1].phase_rate = dds_phase_rate((float) abs(f2));
         s->tone[1].gain = (f2 < 0)  ?  (float) 32767.0f*l2/100.0f  :  dds_scaling_dbm0((float) l2);
 #else
@@ -104,7 +105,7 @@ SPAN_DECLARE(tone_gen_descriptor_t *) tone_gen_descriptor_init(tone_gen_descript
 
 SPAN_DECLARE(void) tone_gen_descriptor_free(tone_gen_descriptor_t *s)
 {
-    free(s);
+    span_free(s);
 }
 /*- End of function --------------------------------------------------------*/
 
@@ -112,7 +113,7 @@ SPAN_DECLARE_NONSTD(int) tone_gen(tone_gen_state_t *s, int16_t amp[], int max_sa
 {
     int samples;
     int limit;
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
     int16_t xamp;
 #else
     float xamp;
@@ -143,7 +144,7 @@ SPAN_DECLARE_NONSTD(int) tone_gen(tone_gen_state_t *s, int16_t amp[], int max_sa
                 for (  ;  samples < limit;  samples++)
                 {
                     /* There must be two, and only two, tones */
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
                     xamp = ((int32_t) dds_mod(&s->phase[0], -s->tone[0].phase_rate, s->tone[0].gain, 0)
                             *(32767 + (int32_t) dds_mod(&s->phase[1], s->tone[1].phase_rate, s->tone[1].gain, 0))) >> 15;
                     amp[samples] = xamp;
@@ -158,7 +159,7 @@ SPAN_DECLARE_NONSTD(int) tone_gen(tone_gen_state_t *s, int16_t amp[], int max_sa
             {
                 for (  ;  samples < limit;  samples++)
                 {
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
                     xamp = 0;
 #else
                     xamp = 0.0f;
@@ -167,7 +168,7 @@ SPAN_DECLARE_NONSTD(int) tone_gen(tone_gen_state_t *s, int16_t amp[], int max_sa
                     {
                         if (s->tone[i].phase_rate == 0)
                             break;
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
                         xamp += dds_mod(&s->phase[i], s->tone[i].phase_rate, s->tone[i].gain, 0);
 #else
                         xamp += dds_modf(&s->phase[i], s->tone[i].phase_rate, s->tone[i].gain, 0);
@@ -177,7 +178,7 @@ SPAN_DECLARE_NONSTD(int) tone_gen(tone_gen_state_t *s, int16_t amp[], int max_sa
                        However, we are normally generating well controlled tones,
                        that cannot clip. So, the overhead of doing saturation is
                        a waste of valuable time. */
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
                     amp[samples] = xamp;
 #else
                     amp[samples] = (int16_t) lfastrintf(xamp);
@@ -210,7 +211,7 @@ SPAN_DECLARE(tone_gen_state_t *) tone_gen_init(tone_gen_state_t *s, tone_gen_des
 
     if (s == NULL)
     {
-        if ((s = (tone_gen_state_t *) malloc(sizeof(*s))) == NULL)
+        if ((s = (tone_gen_state_t *) span_alloc(sizeof(*s))) == NULL)
         {
             return NULL;
         }
@@ -242,7 +243,7 @@ SPAN_DECLARE(int) tone_gen_release(tone_gen_state_t *s)
 SPAN_DECLARE(int) tone_gen_free(tone_gen_state_t *s)
 {
     if (s)
-        free(s);
+        span_free(s);
     return 0;
 }
 /*- End of function --------------------------------------------------------*/
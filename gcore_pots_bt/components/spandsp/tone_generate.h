@@ -45,7 +45,7 @@ conditions in which we will use it.
 typedef struct tone_gen_tone_descriptor_s
 {
     int32_t phase_rate;
-#if defined(SPANDSP_USE_FIXED_POINT)
+#if defined(SPANDSP_DDS_FIXED_POINT)
     int16_t gain;
 #else
     float gain;
@@ -0,0 +1,173 @@
+/*
+ * agc - utility module providing a block processed fixed-point automatic gain control for
+ * speech.
+ *
+ * Each block's mean square level is compared with a noise floor that follows the level
+ * during pauses.  Blocks well above it (and above a minimum level) are speech and update a
+ * speech level estimate.  The gain moves a step towards bringing that estimate within
+ * AGC_DEADBAND of the target after each speech block, faster down than up so loud talkers
+ * are caught quickly, and is ramped across the next block so there are no gain steps.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "agc.h"
+#include <math.h>
+
+
+
+//
+// Constants
+//
+
+// Speech is a block at least AGC_VAD_RATIO (about 9 dB) above the noise floor
+#define AGC_VAD_RATIO        8
+
+// Speech hangover (the noise floor isn't updated while it runs)
+#define AGC_HANGOVER_MSEC    200
+
+// Power ratio (about 3 dB) either side of the target the gain is left alone
+#define AGC_DEADBAND         2
+
+// Gain change rates: the gain drops by 1/AGC_DEC_PER_10MS and rises by 1/AGC_INC_PER_10MS of
+// itself each 10 mSec of speech (about 27 and 7 dB/sec)
+#define AGC_DEC_PER_10MS     32
+#define AGC_INC_PER_10MS     128
+
+// Noise floor averaging during pauses and (much slower, so a noisier line is learned) speech
+#define AGC_NOISE_SHIFT      3
+#define AGC_NOISE_SLOW_SHIFT 10
+
+// Speech level averaging
+#define AGC_SPEECH_SHIFT     2
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int32_t _agc_mean_square(const int16_t* buf, int len);
+static bool _agc_is_speech(agc_state_t* s, int32_t ms, int len);
+static void _agc_adapt(agc_state_t* s, int len);
+
+
+
+//
+// API
+//
+void agc_init(agc_state_t* s, int32_t target, int32_t min_speech, float min_gain_db, float max_gain_db, int rate)
+{
+	s->gain = AGC_UNITY;
+	s->min_gain = (int32_t) (powf(10.0f, min_gain_db / 20.0f) * AGC_UNITY);
+	s->max_gain = (int32_t) (powf(10.0f, max_gain_db / 20.0f) * AGC_UNITY);
+	s->target = target;
+	s->min_speech = min_speech;
+	s->noise = min_speech;
+	s->speech = target;
+	s->dec_div = AGC_DEC_PER_10MS * rate / 100;
+	s->inc_div = AGC_INC_PER_10MS * rate / 100;
+	s->hangover = 0;
+	s->hangover_len = AGC_HANGOVER_MSEC * rate / 1000;
+	s->speech_active = false;
+	s->speech_blocks = 0;
+}
+
+
+void agc_process(agc_state_t* s, int16_t* buf, int len, bool hold)
+{
+	int32_t g0 = s->gain;
+	int32_t g, step, v;
+	int i;
+	
+	if (len <= 0) return;
+	
+	if (_agc_is_speech(s, _agc_mean_square(buf, len), len) && !hold) {
+		_agc_adapt(s, len);
+	}
+	
+	// Ramp from the last gain to the new one across the block (gain kept in Q16 while ramping)
+	g = g0 << 16;
+	step = ((s->gain - g0) << 16) / len;
+	for (i=0; i<len; i++) {
+		g += step;
+		v = ((int32_t) buf[i] * (g >> 16)) >> AGC_GAIN_SHIFT;
+		if (v > INT16_MAX) v = INT16_MAX;
+		if (v < INT16_MIN) v = INT16_MIN;
+		buf[i] = (int16_t) v;
+	}
+}
+
+
+float agc_gain_db(const agc_state_t* s)
+{
+	return 20.0f * log10f((float) s->gain / AGC_UNITY);
+}
+
+
+
+//
+// Internal functions
+//
+static int32_t _agc_mean_square(const int16_t* buf, int len)
+{
+	int64_t sum = 0;
+	int i;
+	
+	for (i=0; i<len; i++) {
+		sum += (int32_t) buf[i] * buf[i];
+	}
+	
+	return (int32_t) (sum / len);
+}
+
+
+// Classify the block and update the noise floor and speech level
+static bool _agc_is_speech(agc_state_t* s, int32_t ms, int len)
+{
+	bool speech = (ms > s->min_speech) && ((int64_t) ms > (int64_t) AGC_VAD_RATIO * s->noise);
+	
+	if (speech) {
+		s->hangover = s->hangover_len;
+		s->speech += (ms - s->speech) >> AGC_SPEECH_SHIFT;
+		s->noise += (ms - s->noise) >> AGC_NOISE_SLOW_SHIFT;
+	} else if (s->hangover > 0) {
+		s->hangover -= len;
+	} else {
+		s->noise += (ms - s->noise) >> AGC_NOISE_SHIFT;
+	}
+	s->speech_active = speech || (s->hangover > 0);
+	
+	return speech;
+}
+
+
+// Step the gain towards putting the speech level within the deadband around the target
+static void _agc_adapt(agc_state_t* s, int len)
+{
+	int64_t out;
+	
+	s->speech_blocks++;
+	
+	// Speech level after the gain
+	out = ((((int64_t) s->speech * s->gain) >> AGC_GAIN_SHIFT) * s->gain) >> AGC_GAIN_SHIFT;
+	
+	if (out > (int64_t) AGC_DEADBAND * s->target) {
+		s->gain -= (int32_t) (((int64_t) s->gain * len) / s->dec_div) + 1;
+		if (s->gain < s->min_gain) s->gain = s->min_gain;
+	} else if ((out * AGC_DEADBAND) < s->target) {
+		s->gain += (int32_t) (((int64_t) s->gain * len) / s->inc_div) + 1;
+		if (s->gain > s->max_gain) s->gain = s->max_gain;
+	}
+}
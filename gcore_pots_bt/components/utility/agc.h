@@ -0,0 +1,69 @@
+/*
+ * agc - utility module providing a block processed fixed-point automatic gain control for
+ * speech.  A simple energy VAD (block power well above a tracked noise floor) decides when
+ * there is speech to measure and the gain is only adapted then so pauses, line noise and
+ * (when the caller holds adaption) residual echo don't pump it.  Levels are mean squared
+ * sample values (as returned by spandsp's power_meter_level_dbm0()).
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _AGC_H_
+#define _AGC_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Gain fractional bits (AGC_UNITY is a gain of 1)
+#define AGC_GAIN_SHIFT   12
+#define AGC_UNITY        (1 << AGC_GAIN_SHIFT)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int32_t gain;                         // Current gain (Q12)
+	int32_t min_gain;                     // Gain limits (Q12)
+	int32_t max_gain;
+	int32_t target;                       // Speech level the gain is adapted towards
+	int32_t min_speech;                   // Lowest level that can be speech
+	int32_t noise;                        // Noise floor estimate
+	int32_t speech;                       // Speech level estimate (before the gain)
+	int dec_div;                          // Samples to change the gain by its own value when
+	int inc_div;                          //   decreasing and increasing (the adaption rates)
+	int hangover;                         // Samples of speech hangover left
+	int hangover_len;
+	bool speech_active;                   // Last block was speech (or in hangover)
+	uint32_t speech_blocks;               // Blocks the gain was adapted in
+} agc_state_t;
+
+
+
+//
+// API
+//
+void agc_init(agc_state_t* s, int32_t target, int32_t min_speech, float min_gain_db, float max_gain_db, int rate);
+void agc_process(agc_state_t* s, int16_t* buf, int len, bool hold);  // In place, hold freezes adaption
+float agc_gain_db(const agc_state_t* s);
+
+#endif /* _AGC_H_ */
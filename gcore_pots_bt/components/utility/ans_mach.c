@@ -0,0 +1,952 @@
+/*
+ * ans_mach - utility module implementing an answering machine on the Micro-SD Card.
+ *
+ * A session (answering a call or playing a message) mounts the card in the worker task for
+ * its duration.  The worker reads the greeting or message ahead into a pair of play blocks
+ * and saves the recording from a pair of record blocks, each handed back and forth with an
+ * atomic state like the audio sample recorder, so the audio path never waits for the card.
+ * A record block the worker hasn't saved yet in time is dropped rather than stalling.
+ *
+ * Each message file is an am_hdr_t (rewritten with the length when the message ends)
+ * followed by IMA ADPCM at 8 kHz.  The headers are indexed at boot so the GUI can list the
+ * messages without touching the card.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "ans_mach.h"
+#if (CONFIG_ANS_MACH_ENABLE == true)
+#include <ctype.h>
+#include <dirent.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <sys/stat.h>
+#include <sys/unistd.h>
+#include "app_task.h"
+#include "boot_prof.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "evt_bus.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "ima_adpcm.h"
+#include "power_utilities.h"
+#include "sd_card.h"
+#include "sys_common.h"
+
+
+//
+// Constants
+//
+// Worker task
+#define AM_TASK_STACK      4096
+#define AM_TASK_PRIO       1
+#define AM_CMD_QUEUE_DEPTH 4
+
+// Worker polling interval while a session is running (a block is 512 mSec of audio)
+#define AM_POLL_MSEC       50
+
+// Samples in each play and record block
+#define AM_BLOCK_LEN       4096
+#define AM_NUM_BLOCKS      2
+
+// Time for an in-progress audio call to finish after a session is disabled
+#define AM_STOP_MSEC       20
+
+// Mount attempts (the call log writer may have the card mounted when a call ends)
+#define AM_MOUNT_TRIES     5
+#define AM_RETRY_MSEC      200
+
+// Wait for the boot-time users of the card before indexing the messages
+#define AM_BOOT_WAIT_MSEC  30000
+
+// Messages shorter than this (caller hung up at the beep) are discarded
+#define AM_MIN_MSG_MSEC    1000
+
+// Beep after the greeting (1 kHz)
+#define AM_BEEP_MSEC       400
+
+// Message file header
+#define AM_MSG_MAGIC       0x47534D41   /* "AMSG" */
+#define AM_HDR_LEN         52
+
+// Block states
+#define BLK_EMPTY          0
+#define BLK_FULL           1
+
+// Sessions
+#define AM_SESSION_IDLE    0
+#define AM_SESSION_ANSWER  1
+#define AM_SESSION_PLAY    2
+
+// Worker commands
+#define AM_CMD_ANSWER      1
+#define AM_CMD_PLAY        2
+#define AM_CMD_STOP        3
+#define AM_CMD_DELETE      4
+
+// Play sources, in order
+#define AM_SRC_WAV         0
+#define AM_SRC_MSG         1
+#define AM_SRC_BEEP        2
+#define AM_SRC_END         3
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int16_t* buf;                    // AM_BLOCK_LEN samples
+	int len;                         // Valid samples
+	atomic_int state;
+} am_block_t;
+
+typedef struct {
+	int id;                          // AM_CMD_*
+	uint32_t arg;                    // Message id
+	char number[ANS_MACH_NUMBER_LEN+1];
+} am_cmd_t;
+
+typedef struct {
+	uint32_t magic;
+	uint32_t start;
+	uint32_t samples;
+	uint32_t reserved;
+	char number[ANS_MACH_NUMBER_LEN+4];
+} am_hdr_t;
+
+_Static_assert(sizeof(am_hdr_t) == AM_HDR_LEN, "am_hdr_t length");
+
+
+
+//
+// Variables
+//
+static const char* TAG = "ans_mach";
+
+// Micro-SD Card
+static bool mounted = false;             // Holding an sd_card mount
+
+// Worker task
+static TaskHandle_t task_handle_ans_mach;
+static StackType_t ans_mach_task_stack[AM_TASK_STACK];
+static StaticTask_t ans_mach_task_tcb;
+static QueueHandle_t cmd_queue;
+static StaticQueue_t cmd_queue_buf;
+static uint8_t cmd_queue_storage[AM_CMD_QUEUE_DEPTH * sizeof(am_cmd_t)];
+static atomic_int session = AM_SESSION_IDLE;
+
+// Message index (oldest first)
+static ans_mach_msg_t msgs[ANS_MACH_MAX_MSGS];
+static int num_msgs = 0;
+static uint32_t next_id = 1;
+static atomic_uint list_seq = 0;
+static atomic_bool index_loaded = false;
+static SemaphoreHandle_t msgs_mutex;
+static StaticSemaphore_t msgs_mutex_buf;
+
+// Play stream - the worker fills blocks, the consumer empties them.  play_block and play_index
+// are only touched by the consumer while play_enable is set.
+static am_block_t play_blocks[AM_NUM_BLOCKS];
+static atomic_bool play_enable = false;
+static atomic_bool play_eof = false;           // Worker has filled its last block
+static atomic_bool play_done = false;          // Consumer has emptied it
+static int play_block;
+static int play_index;
+static int play_fill_block;                    // Worker
+static int play_src;                           // Worker, AM_SRC_*
+static int play_src_remain;                    // Samples left in the current source
+static FILE* play_file = NULL;
+static ima_state_t play_ima;
+
+// Record stream - audio_task fills blocks, the worker saves them.  The push variables are
+// only touched by audio_task while rec_enable is set.
+static am_block_t rec_blocks[AM_NUM_BLOCKS];
+static atomic_bool rec_enable = false;
+static atomic_bool rec_limit_hit = false;
+static atomic_int rec_drops = 0;
+static int rec_block;
+static int rec_total;
+static int rec_limit;
+static int rec_save_block;                     // Worker
+static int rec_saved;                          // Worker, samples written
+static bool rec_write_failed;
+static FILE* rec_file = NULL;
+static ima_state_t rec_ima;
+static am_hdr_t rec_hdr;
+static uint32_t rec_id;
+
+// Encoded audio for one block
+static uint8_t enc_buf[AM_BLOCK_LEN / 2] __attribute__((aligned(4)));
+
+// One cycle of 1 kHz at 8 kHz (about -10 dBm0)
+static const int16_t beep_table[8] = {0, 5657, 8000, 5657, 0, -5657, -8000, -5657};
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _am_task(void* args);
+static void _am_start_answer(const char* num);
+static void _am_start_play(uint32_t id);
+static void _am_end_session(bool notify);
+static void _am_reset_streams();
+static void _am_fill_play();
+static int _am_read_play(int16_t* buf, int len);
+static bool _am_open_greeting();
+static void _am_save_record(bool all);
+static void _am_write_rec_block(am_block_t* bP);
+static void _am_finish_record();
+static void _am_delete(uint32_t id);
+static void _am_scan();
+static void _am_add_msg(const ans_mach_msg_t* m);
+static int _am_find_msg(uint32_t id);
+static void _am_msg_filename(uint32_t id, char* fn);
+static bool _am_mount();
+static void _am_unmount();
+
+
+
+//
+// API
+//
+void ans_mach_init()
+{
+	for (int i=0; i<AM_NUM_BLOCKS; i++) {
+		play_blocks[i].buf = (int16_t*) heap_caps_aligned_alloc(32, AM_BLOCK_LEN*2, MALLOC_CAP_SPIRAM);
+		rec_blocks[i].buf = (int16_t*) heap_caps_aligned_alloc(32, AM_BLOCK_LEN*2, MALLOC_CAP_SPIRAM);
+		if ((play_blocks[i].buf == NULL) || (rec_blocks[i].buf == NULL)) {
+			ESP_LOGE(TAG, "malloc block %d failed", i);
+			return;
+		}
+	}
+	
+	msgs_mutex = xSemaphoreCreateMutexStatic(&msgs_mutex_buf);
+	cmd_queue = xQueueCreateStatic(AM_CMD_QUEUE_DEPTH, sizeof(am_cmd_t), cmd_queue_storage, &cmd_queue_buf);
+	if ((msgs_mutex == NULL) || (cmd_queue == NULL)) {
+		ESP_LOGE(TAG, "Could not create queue");
+		return;
+	}
+	
+	// Below all the other tasks so card access only uses idle time
+	task_handle_ans_mach = xTaskCreateStaticPinnedToCore(&_am_task, "ans_mach_task", AM_TASK_STACK, NULL, AM_TASK_PRIO, ans_mach_task_stack, &ans_mach_task_tcb, 0);
+}
+
+
+bool ans_mach_ready()
+{
+	return ((task_handle_ans_mach != NULL) && atomic_load(&index_loaded) && power_get_sdcard_present() &&
+	        (atomic_load(&session) == AM_SESSION_IDLE) && (ans_mach_get_msg_count() < ANS_MACH_MAX_MSGS));
+}
+
+
+bool ans_mach_start_answer(const char* num)
+{
+	am_cmd_t cmd;
+	int expected = AM_SESSION_IDLE;
+	
+	if (!ans_mach_ready() || !atomic_compare_exchange_strong(&session, &expected, AM_SESSION_ANSWER)) {
+		return false;
+	}
+	
+	cmd.id = AM_CMD_ANSWER;
+	cmd.arg = 0;
+	strncpy(cmd.number, num, ANS_MACH_NUMBER_LEN);
+	cmd.number[ANS_MACH_NUMBER_LEN] = 0;
+	if (xQueueSend(cmd_queue, &cmd, 0) != pdTRUE) {
+		atomic_store(&session, AM_SESSION_IDLE);
+		return false;
+	}
+	return true;
+}
+
+
+bool ans_mach_play_msg(uint32_t id)
+{
+	am_cmd_t cmd;
+	int expected = AM_SESSION_IDLE;
+	
+	if ((task_handle_ans_mach == NULL) || !atomic_compare_exchange_strong(&session, &expected, AM_SESSION_PLAY)) {
+		return false;
+	}
+	
+	cmd.id = AM_CMD_PLAY;
+	cmd.arg = id;
+	cmd.number[0] = 0;
+	if (xQueueSend(cmd_queue, &cmd, 0) != pdTRUE) {
+		atomic_store(&session, AM_SESSION_IDLE);
+		return false;
+	}
+	return true;
+}
+
+
+void ans_mach_stop()
+{
+	am_cmd_t cmd;
+	
+	if ((task_handle_ans_mach == NULL) || (atomic_load(&session) == AM_SESSION_IDLE)) return;
+	
+	cmd.id = AM_CMD_STOP;
+	cmd.arg = 0;
+	cmd.number[0] = 0;
+	(void) xQueueSend(cmd_queue, &cmd, portMAX_DELAY);
+}
+
+
+void ans_mach_delete_msg(uint32_t id)
+{
+	am_cmd_t cmd;
+	
+	if (task_handle_ans_mach == NULL) return;
+	
+	cmd.id = AM_CMD_DELETE;
+	cmd.arg = id;
+	cmd.number[0] = 0;
+	(void) xQueueSend(cmd_queue, &cmd, portMAX_DELAY);
+}
+
+
+int ans_mach_get_msg_count()
+{
+	int n;
+	
+	if (msgs_mutex == NULL) return 0;
+	
+	xSemaphoreTake(msgs_mutex, portMAX_DELAY);
+	n = num_msgs;
+	xSemaphoreGive(msgs_mutex);
+	
+	return n;
+}
+
+
+bool ans_mach_get_msg(int n, ans_mach_msg_t* msg)
+{
+	bool valid = false;
+	
+	if (msgs_mutex == NULL) return false;
+	
+	xSemaphoreTake(msgs_mutex, portMAX_DELAY);
+	if ((n >= 0) && (n < num_msgs)) {
+		*msg = msgs[num_msgs - 1 - n];
+		valid = true;
+	}
+	xSemaphoreGive(msgs_mutex);
+	
+	return valid;
+}
+
+
+uint32_t ans_mach_get_list_seq()
+{
+	return atomic_load(&list_seq);
+}
+
+
+int ans_mach_get_play(int16_t* buf, int len)
+{
+	am_block_t* bP;
+	bool eof;
+	int got = 0;
+	int n;
+	
+	while (atomic_load(&play_enable) && (got < len)) {
+		// Read eof before the block state so a block filled just before it was set isn't missed
+		eof = atomic_load(&play_eof);
+		bP = &play_blocks[play_block];
+		if (atomic_load(&bP->state) != BLK_FULL) {
+			if (eof) {
+				// Recording (if any) starts as soon as the beep has been sent
+				atomic_store(&play_done, true);
+			}
+			break;
+		}
+	
+		n = bP->len - play_index;
+		if (n > (len - got)) n = len - got;
+		memcpy(&buf[got], &bP->buf[play_index], n * sizeof(int16_t));
+		got += n;
+		play_index += n;
+	
+		if (play_index == bP->len) {
+			play_index = 0;
+			atomic_store(&bP->state, BLK_EMPTY);
+			play_block = (play_block + 1) % AM_NUM_BLOCKS;
+		}
+	}
+	
+	if (got < len) {
+		memset(&buf[got], 0, (len - got) * sizeof(int16_t));
+	}
+	
+	return got;
+}
+
+
+bool ans_mach_play_done()
+{
+	return atomic_load(&play_done);
+}
+
+
+void ans_mach_put_record(const int16_t* buf, int len)
+{
+	am_block_t* bP;
+	int n;
+	
+	if (!atomic_load(&play_done)) return;
+	
+	while (atomic_load(&rec_enable) && (len > 0)) {
+		bP = &rec_blocks[rec_block];
+	
+		n = AM_BLOCK_LEN - bP->len;
+		if (n > len) n = len;
+		if (n > (rec_limit - rec_total)) n = rec_limit - rec_total;
+		memcpy(&bP->buf[bP->len], buf, n * sizeof(int16_t));
+		bP->len += n;
+		rec_total += n;
+		buf += n;
+		len -= n;
+	
+		if (bP->len == AM_BLOCK_LEN) {
+			// Hand the block to the worker if the next one is free, otherwise drop it
+			if (atomic_load(&rec_blocks[(rec_block + 1) % AM_NUM_BLOCKS].state) == BLK_EMPTY) {
+				atomic_store(&bP->state, BLK_FULL);
+				rec_block = (rec_block + 1) % AM_NUM_BLOCKS;
+			} else {
+				bP->len = 0;
+				atomic_fetch_add(&rec_drops, 1);
+			}
+		}
+	
+		if (rec_total == rec_limit) {
+			atomic_store(&rec_enable, false);
+			atomic_store(&rec_limit_hit, true);
+		}
+	}
+}
+
+
+
+//
+// Internal functions
+//
+static void _am_task(void* args)
+{
+	am_cmd_t cmd;
+	
+	ESP_LOGI(TAG, "Start task");
+	
+	// Index the messages once the boot-time users of the card (firmware update, phonebook)
+	// have had a chance to finish with it
+	(void) boot_prof_wait_ready(BOOT_READY_ALL, pdMS_TO_TICKS(AM_BOOT_WAIT_MSEC));
+	if (power_get_sdcard_present() && _am_mount()) {
+		_am_scan();
+		_am_unmount();
+	}
+	
+	while (true) {
+		if (xQueueReceive(cmd_queue, &cmd, pdMS_TO_TICKS(AM_POLL_MSEC)) == pdTRUE) {
+			switch (cmd.id) {
+				case AM_CMD_ANSWER:
+					_am_start_answer(cmd.number);
+					break;
+	
+				case AM_CMD_PLAY:
+					_am_start_play(cmd.arg);
+					break;
+	
+				case AM_CMD_STOP:
+					_am_end_session(false);
+					break;
+	
+				case AM_CMD_DELETE:
+					_am_delete(cmd.arg);
+					break;
+			}
+		}
+	
+		if (mounted) {
+			_am_fill_play();
+			_am_save_record(false);
+	
+			if (atomic_load(&rec_limit_hit) || rec_write_failed) {
+				// Let app_task end the call
+				_am_end_session(true);
+			}
+		}
+	}
+}
+
+
+static void _am_start_answer(const char* num)
+{
+	char fn[32];
+	
+	if (!_am_mount()) {
+		ESP_LOGE(TAG, "Could not mount the card to answer");
+		_am_end_session(true);
+		return;
+	}
+	if (!atomic_load(&index_loaded)) {
+		_am_scan();
+	}
+	
+	_am_reset_streams();
+	
+	// Greeting followed by the beep
+	play_src = _am_open_greeting() ? AM_SRC_WAV : AM_SRC_BEEP;
+	if (play_src == AM_SRC_BEEP) {
+		play_src_remain = AM_BEEP_MSEC * 8;
+	}
+	
+	// Message file
+	(void) mkdir(ANS_MACH_MSG_DIR, 0777);
+	rec_id = next_id;
+	memset(&rec_hdr, 0, sizeof(am_hdr_t));
+	rec_hdr.magic = AM_MSG_MAGIC;
+	rec_hdr.start = (uint32_t) time(NULL);
+	strncpy(rec_hdr.number, num, ANS_MACH_NUMBER_LEN);
+	_am_msg_filename(rec_id, fn);
+	rec_file = fopen(fn, "w");
+	if (rec_file != NULL) {
+		setvbuf(rec_file, NULL, _IONBF, 0);
+		if (fwrite(&rec_hdr, sizeof(am_hdr_t), 1, rec_file) != 1) {
+			rec_write_failed = true;
+		}
+	} else {
+		ESP_LOGE(TAG, "Could not create %s", fn);
+		rec_write_failed = true;
+	}
+	
+	rec_limit = CONFIG_ANS_MACH_MAX_SECS * 8000;
+	atomic_store(&rec_enable, true);
+	
+	_am_fill_play();
+	atomic_store(&play_enable, true);
+	
+	ESP_LOGI(TAG, "Answering call from \"%s\"", num);
+}
+
+
+static void _am_start_play(uint32_t id)
+{
+	char fn[32];
+	am_hdr_t hdr;
+	
+	if (!_am_mount()) {
+		ESP_LOGE(TAG, "Could not mount the card to play");
+		_am_end_session(false);
+		return;
+	}
+	
+	_am_reset_streams();
+	play_src = AM_SRC_END;
+	
+	_am_msg_filename(id, fn);
+	play_file = fopen(fn, "r");
+	if (play_file != NULL) {
+		if ((fread(&hdr, sizeof(am_hdr_t), 1, play_file) == 1) && (hdr.magic == AM_MSG_MAGIC)) {
+			play_src = AM_SRC_MSG;
+			play_src_remain = (int) hdr.samples;
+			ESP_LOGI(TAG, "Playing message %u", id);
+		} else {
+			fclose(play_file);
+			play_file = NULL;
+		}
+	}
+	if (play_src == AM_SRC_END) {
+		ESP_LOGE(TAG, "Could not read %s", fn);
+	}
+	
+	_am_fill_play();
+	atomic_store(&play_enable, true);
+}
+
+
+// Ends the session, saving any message.  notify tells app_task the machine hung up.
+static void _am_end_session(bool notify)
+{
+	bool was_answer = (atomic_load(&session) == AM_SESSION_ANSWER);
+	
+	// Let any audio call that saw the session enabled complete before taking the blocks back
+	atomic_store(&play_enable, false);
+	atomic_store(&rec_enable, false);
+	vTaskDelay(pdMS_TO_TICKS(AM_STOP_MSEC));
+	
+	if (play_file != NULL) {
+		fclose(play_file);
+		play_file = NULL;
+	}
+	if (rec_file != NULL) {
+		_am_save_record(true);
+		_am_finish_record();
+	}
+	
+	if (mounted) {
+		_am_unmount();
+	}
+	atomic_store(&rec_limit_hit, false);
+	atomic_store(&session, AM_SESSION_IDLE);
+	
+	if (notify && was_answer) {
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_ANS_MACH_DONE);
+	}
+}
+
+
+// Called by the worker while both streams are disabled
+static void _am_reset_streams()
+{
+	for (int i=0; i<AM_NUM_BLOCKS; i++) {
+		play_blocks[i].len = 0;
+		atomic_store(&play_blocks[i].state, BLK_EMPTY);
+		rec_blocks[i].len = 0;
+		atomic_store(&rec_blocks[i].state, BLK_EMPTY);
+	}
+	play_block = 0;
+	play_index = 0;
+	play_fill_block = 0;
+	play_src_remain = 0;
+	ima_init(&play_ima);
+	atomic_store(&play_eof, false);
+	atomic_store(&play_done, false);
+	
+	rec_block = 0;
+	rec_total = 0;
+	rec_save_block = 0;
+	rec_saved = 0;
+	rec_write_failed = false;
+	ima_init(&rec_ima);
+	atomic_store(&rec_limit_hit, false);
+	atomic_store(&rec_drops, 0);
+}
+
+
+// Read ahead into the empty play blocks
+static void _am_fill_play()
+{
+	am_block_t* bP;
+	
+	while (!atomic_load(&play_eof)) {
+		bP = &play_blocks[play_fill_block];
+		if (atomic_load(&bP->state) != BLK_EMPTY) break;
+	
+		bP->len = _am_read_play(bP->buf, AM_BLOCK_LEN);
+		if (bP->len != 0) {
+			atomic_store(&bP->state, BLK_FULL);
+			play_fill_block = (play_fill_block + 1) % AM_NUM_BLOCKS;
+		}
+		if (bP->len < AM_BLOCK_LEN) {
+			atomic_store(&play_eof, true);
+		}
+	}
+}
+
+
+// Returns up to len samples from the play sources, less only at the end of the last one
+static int _am_read_play(int16_t* buf, int len)
+{
+	int got = 0;
+	int n;
+	
+	while ((got < len) && (play_src != AM_SRC_END)) {
+		n = len - got;
+		if (n > play_src_remain) n = play_src_remain;
+	
+		switch (play_src) {
+			case AM_SRC_WAV:
+				n = fread(&buf[got], sizeof(int16_t), n, play_file);
+				break;
+	
+			case AM_SRC_MSG:
+				n = fread(enc_buf, 1, (n + 1) / 2, play_file) * 2;
+				if (n > play_src_remain) n = play_src_remain;
+				ima_decode(&play_ima, enc_buf, &buf[got], n);
+				break;
+	
+			case AM_SRC_BEEP:
+				for (int i=0; i<n; i++) {
+					buf[got + i] = beep_table[(play_src_remain - i) & 7];
+				}
+				break;
+		}
+		got += n;
+		play_src_remain -= n;
+	
+		if ((n == 0) || (play_src_remain == 0)) {
+			// Move to the next source
+			if (play_file != NULL) {
+				fclose(play_file);
+				play_file = NULL;
+			}
+			if ((play_src == AM_SRC_WAV) && (atomic_load(&session) == AM_SESSION_ANSWER)) {
+				play_src = AM_SRC_BEEP;
+				play_src_remain = AM_BEEP_MSEC * 8;
+			} else {
+				play_src = AM_SRC_END;
+			}
+		}
+	}
+	
+	return got;
+}
+
+
+// Opens the greeting and positions it at its samples, returning false if it isn't usable
+static bool _am_open_greeting()
+{
+	uint8_t hdr[12];
+	uint32_t len;
+	bool fmt_ok = false;
+	
+	play_file = fopen(ANS_MACH_GREETING_FILE, "r");
+	if (play_file == NULL) {
+		ESP_LOGI(TAG, "No greeting");
+		return false;
+	}
+	
+	// Walk the RIFF chunks to the data, checking the format on the way
+	if ((fread(hdr, 1, 12, play_file) == 12) && (memcmp(hdr, "RIFF", 4) == 0) && (memcmp(&hdr[8], "WAVE", 4) == 0)) {
+		while (fread(hdr, 1, 8, play_file) == 8) {
+			len = hdr[4] | (hdr[5] << 8) | (hdr[6] << 16) | ((uint32_t) hdr[7] << 24);
+			if (memcmp(hdr, "data", 4) == 0) {
+				if (fmt_ok) {
+					play_src_remain = (int) (len / 2);
+					return true;
+				}
+				break;
+			} else if ((memcmp(hdr, "fmt ", 4) == 0) && (len >= 16)) {
+				// PCM, mono, 8000 Hz, 16 bits
+				if (fread(enc_buf, 1, 16, play_file) != 16) break;
+				fmt_ok = (enc_buf[0] == 1) && (enc_buf[1] == 0) && (enc_buf[2] == 1) && (enc_buf[3] == 0) &&
+				         ((enc_buf[4] | (enc_buf[5] << 8)) == 8000) && (enc_buf[6] == 0) && (enc_buf[7] == 0) &&
+				         (enc_buf[14] == 16);
+				len -= 16;
+			}
+			if (fseek(play_file, (len + 1) & ~1, SEEK_CUR) != 0) break;
+		}
+	}
+	
+	ESP_LOGW(TAG, "%s must be 8 kHz 16-bit mono PCM", ANS_MACH_GREETING_FILE);
+	fclose(play_file);
+	play_file = NULL;
+	return false;
+}
+
+
+// Save the full record blocks in order (and any partial block once recording is disabled)
+static void _am_save_record(bool all)
+{
+	while (atomic_load(&rec_blocks[rec_save_block].state) == BLK_FULL) {
+		_am_write_rec_block(&rec_blocks[rec_save_block]);
+		rec_save_block = (rec_save_block + 1) % AM_NUM_BLOCKS;
+	}
+	if (all && (rec_blocks[rec_save_block].len != 0)) {
+		_am_write_rec_block(&rec_blocks[rec_save_block]);
+	}
+}
+
+
+static void _am_write_rec_block(am_block_t* bP)
+{
+	size_t want;
+	
+	if (!rec_write_failed && (rec_file != NULL)) {
+		want = ima_encode(&rec_ima, bP->buf, enc_buf, bP->len);
+		if (fwrite(enc_buf, 1, want, rec_file) != want) {
+			// Probably a full card - keep what we have
+			ESP_LOGE(TAG, "Write failed - ending message");
+			rec_write_failed = true;
+		} else {
+			rec_saved += bP->len;
+		}
+	}
+	
+	bP->len = 0;
+	atomic_store(&bP->state, BLK_EMPTY);
+}
+
+
+// Close the message, keeping it if it's long enough
+static void _am_finish_record()
+{
+	ans_mach_msg_t m;
+	char fn[32];
+	bool keep = rec_saved >= (AM_MIN_MSG_MSEC * 8);
+	
+	if (keep) {
+		rec_hdr.samples = (uint32_t) rec_saved;
+		if ((fseek(rec_file, 0, SEEK_SET) != 0) || (fwrite(&rec_hdr, sizeof(am_hdr_t), 1, rec_file) != 1)) {
+			keep = false;
+		}
+	}
+	fclose(rec_file);
+	rec_file = NULL;
+	
+	if (keep) {
+		m.id = rec_id;
+		m.start = rec_hdr.start;
+		m.samples = rec_hdr.samples;
+		strncpy(m.number, rec_hdr.number, ANS_MACH_NUMBER_LEN);
+		m.number[ANS_MACH_NUMBER_LEN] = 0;
+		_am_add_msg(&m);
+		ESP_LOGI(TAG, "Saved message %u (%d samples, %d dropped blocks)", rec_id, rec_saved, atomic_load(&rec_drops));
+	} else {
+		_am_msg_filename(rec_id, fn);
+		(void) unlink(fn);
+	}
+}
+
+
+static void _am_delete(uint32_t id)
+{
+	char fn[32];
+	int i;
+	
+	if (atomic_load(&session) != AM_SESSION_IDLE) return;
+	
+	xSemaphoreTake(msgs_mutex, portMAX_DELAY);
+	i = _am_find_msg(id);
+	if (i >= 0) {
+		num_msgs -= 1;
+		memmove(&msgs[i], &msgs[i+1], (num_msgs - i) * sizeof(ans_mach_msg_t));
+	}
+	xSemaphoreGive(msgs_mutex);
+	atomic_fetch_add(&list_seq, 1);
+	
+	if ((i >= 0) && _am_mount()) {
+		_am_msg_filename(id, fn);
+		(void) unlink(fn);
+		_am_unmount();
+	}
+}
+
+
+// Index the message headers
+static void _am_scan()
+{
+	DIR* dir;
+	struct dirent* entry;
+	FILE* fp;
+	am_hdr_t hdr;
+	ans_mach_msg_t m;
+	char fn[32];
+	unsigned int id;
+	
+	dir = opendir(ANS_MACH_MSG_DIR);
+	if (dir != NULL) {
+		while ((entry = readdir(dir)) != NULL) {
+			if ((tolower((int) entry->d_name[0]) != 'm') || (sscanf(&entry->d_name[1], "%u", &id) != 1)) {
+				continue;
+			}
+	
+			_am_msg_filename(id, fn);
+			fp = fopen(fn, "r");
+			if (fp == NULL) continue;
+			if ((fread(&hdr, sizeof(am_hdr_t), 1, fp) == 1) && (hdr.magic == AM_MSG_MAGIC) && (hdr.samples != 0)) {
+				m.id = id;
+				m.start = hdr.start;
+				m.samples = hdr.samples;
+				strncpy(m.number, hdr.number, ANS_MACH_NUMBER_LEN);
+				m.number[ANS_MACH_NUMBER_LEN] = 0;
+				_am_add_msg(&m);
+			}
+			fclose(fp);
+	
+			if (id >= next_id) next_id = id + 1;
+		}
+		closedir(dir);
+	}
+	
+	atomic_store(&index_loaded, true);
+	ESP_LOGI(TAG, "%d messages", ans_mach_get_msg_count());
+}
+
+
+// Insert in id order (the oldest message is dropped from the index if it's full)
+static void _am_add_msg(const ans_mach_msg_t* m)
+{
+	int i;
+	
+	xSemaphoreTake(msgs_mutex, portMAX_DELAY);
+	if (num_msgs == ANS_MACH_MAX_MSGS) {
+		num_msgs -= 1;
+		memmove(&msgs[0], &msgs[1], num_msgs * sizeof(ans_mach_msg_t));
+	}
+	for (i=num_msgs; (i > 0) && (msgs[i-1].id > m->id); i--) {
+		msgs[i] = msgs[i-1];
+	}
+	msgs[i] = *m;
+	num_msgs += 1;
+	if (m->id >= next_id) next_id = m->id + 1;
+	xSemaphoreGive(msgs_mutex);
+	
+	atomic_fetch_add(&list_seq, 1);
+}
+
+
+// Called with msgs_mutex held
+static int _am_find_msg(uint32_t id)
+{
+	for (int i=0; i<num_msgs; i++) {
+		if (msgs[i].id == id) return i;
+	}
+	return -1;
+}
+
+
+static void _am_msg_filename(uint32_t id, char* fn)
+{
+	sprintf(fn, "%s/m%05u.ima", ANS_MACH_MSG_DIR, id % 100000);
+}
+
+
+static bool _am_mount()
+{
+	if (mounted) return true;
+	
+	for (int i=0; i<AM_MOUNT_TRIES; i++) {
+		if (sd_card_mount()) {
+			mounted = true;
+			break;
+		}
+		vTaskDelay(pdMS_TO_TICKS(AM_RETRY_MSEC));
+	}
+	if (!mounted) {
+		ESP_LOGE(TAG, "Failed to mount the card");
+	}
+	
+	return mounted;
+}
+
+
+static void _am_unmount()
+{
+	if (mounted) {
+		sd_card_unmount();
+		mounted = false;
+	}
+}
+
+#endif /* CONFIG_ANS_MACH_ENABLE */
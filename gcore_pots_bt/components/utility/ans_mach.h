@@ -0,0 +1,89 @@
+/*
+ * ans_mach - utility module implementing an answering machine on the Micro-SD Card.  A call
+ * that rings CONFIG_ANS_MACH_RINGS times unanswered is answered, the caller hears greeting.wav
+ * from the root of the card followed by a beep, and what they say is recorded as IMA ADPCM into
+ * the msgs directory.  Messages are listed by the GUI and played back to the phone's handset.
+ *
+ * All card access happens in a low priority worker task on core 0.  The audio passes through
+ * pairs of PSRAM blocks so audio_task (and pots_task for playback) only ever copy samples.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _ANS_MACH_H_
+#define _ANS_MACH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+//
+// Constants
+//
+
+// Greeting in the root of the Micro-SD Card (8 kHz, 16-bit mono WAV).  Without it the
+// caller only hears the beep.
+#define ANS_MACH_GREETING_FILE "/sdcard/greeting.wav"
+
+// Message directory (one mNNNNN.ima file per message)
+#define ANS_MACH_MSG_DIR       "/sdcard/msgs"
+
+// Messages kept (the machine doesn't answer once there are this many)
+#define ANS_MACH_MAX_MSGS      32
+
+// Longest caller number kept with a message
+#define ANS_MACH_NUMBER_LEN    32
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t id;                          // File number (increases with each message)
+	uint32_t start;                       // Time the message started (seconds since the epoch)
+	uint32_t samples;                     // Length at 8 kHz
+	char number[ANS_MACH_NUMBER_LEN+1];   // Empty if unknown
+} ans_mach_msg_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_ANS_MACH_ENABLE == true)
+void ans_mach_init();                          // Allocates the blocks and starts the worker task (it indexes the messages)
+bool ans_mach_ready();                         // True if a card is present, nothing is playing and there is room for a message
+bool ans_mach_start_answer(const char* num);   // app_task: greet the caller and record a message from them
+bool ans_mach_play_msg(uint32_t id);           // Play a message to the handset (through pots_task)
+void ans_mach_stop();                          // Ends the current answer or playback
+void ans_mach_delete_msg(uint32_t id);
+int ans_mach_get_msg_count();
+bool ans_mach_get_msg(int n, ans_mach_msg_t* msg);  // n = 0 is the newest message
+uint32_t ans_mach_get_list_seq();              // Changes each time the message list changes
+
+// Audio interface - 8 kHz samples, never blocks (see note)
+int ans_mach_get_play(int16_t* buf, int len);  // Returns valid samples, the rest of buf is zeroed
+bool ans_mach_play_done();                     // True once the greeting (and beep) or message has played out
+void ans_mach_put_record(const int16_t* buf, int len);
+#endif
+
+// Note: The greeting is taken by audio_task in place of the voice sent to the cellphone and
+// recording starts automatically once it (and the beep) has played.  A message is taken
+// by pots_task and mixed into the handset audio.  Only one consumer takes the play audio
+// at a time.  Audio that isn't ready (slow card) is replaced by silence.
+
+#endif /* _ANS_MACH_H_ */
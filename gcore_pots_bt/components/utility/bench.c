@@ -0,0 +1,784 @@
+/*
+ * bench - utility module timing the signal processing, memory, flash and I2C paths the
+ * firmware depends on.
+ *
+ * Each item is timed over enough iterations to take a few tens of mSec using the
+ * microsecond timer (which isn't affected by CPU frequency changes).  The signal
+ * processing items run on pseudo-random data with private state so they don't disturb
+ * the audio pipeline.
+ *
+ * The kernel check uses the CPU cycle counter instead since it compares a unit with the
+ * budgets recorded on another, and keeps the fastest block so the result doesn't depend on
+ * what else ran.  Every kernel starts from the same seed so its vectors never change.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "bench.h"
+#include <string.h>
+#include "es8388.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "soc/soc_memory_layout.h"
+#include "gcore.h"
+#include "pwr_mgmt.h"
+#include "resample.h"
+#include "ring.h"
+#include "spandsp.h"
+
+
+
+//
+// Constants
+//
+
+// Iterations
+#define BENCH_LEC_SAMPLES    4000
+#define BENCH_DTMF_BLOCKS    100
+#define BENCH_RS_BLOCKS      100
+#define BENCH_PSRAM_COPIES   8
+#define BENCH_I2C_READS      20
+
+// Signal processing buffer length (samples)
+#define BENCH_BUF_LEN        160
+
+// PSRAM copy length (larger than the cache)
+#define BENCH_PSRAM_LEN      (128*1024)
+
+// Flash read length and chunk size
+#define BENCH_FLASH_LEN      (64*1024)
+#define BENCH_FLASH_CHUNK    4096
+
+// Kernel check seed and blocks (generated signals run until they end, up to the maximum)
+#define BENCH_CHECK_SEED     0x2468ace1
+#define BENCH_CHECK_BLOCKS   50
+#define BENCH_CHECK_MAX_BLKS 250
+
+// Kernel check FIR length, DTMF digits sent (followed by silence so the last is reported)
+// and ring length
+#define BENCH_FIR_TAPS       64
+#define BENCH_DTMF_DIGITS    "0123456789*#ABCD"
+#define BENCH_DTMF_QUIET_BLKS 10
+#define BENCH_RING_LEN       256
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const char* name;
+	uint32_t budget;                      // Cycles per BENCH_CHECK_BLOCK samples
+	uint32_t crc;                         // Output CRC-32
+} bench_ref_t;
+
+RING_DEFINE(bench_ring, int16_t, BENCH_RING_LEN, RING_DROP_NEW)
+
+
+
+//
+// Variables
+//
+static const char* TAG = "bench";
+
+static int16_t bench_in[BENCH_BUF_LEN];
+static int16_t bench_out[2*BENCH_BUF_LEN];
+static int16_t bench_rx[BENCH_CHECK_BLOCK];
+static int16_t bench_ref[BENCH_CHECK_BLOCK];
+
+static uint32_t bench_seed;
+
+// Checked in budgets and output CRCs, indexed by BENCH_K_*.  A kernel whose budget is 0 is
+// reported as NEW along with the values to record here, and fails the check until they are.
+static const bench_ref_t bench_refs[BENCH_NUM_KERNELS] = {
+	{"lec",        0, 0x00000000},
+	{"lec_block",  0, 0x00000000},
+	{"fir16",      0, 0x00000000},
+	{"dtmf_rx",    0, 0x00000000},
+	{"adsi_tx",    0, 0x00000000},
+	{"super_tone", 0, 0x00000000},
+	{"down2",      0, 0x00000000},
+	{"up2",        0, 0x00000000},
+	{"ring",       0, 0x00000000}
+};
+
+static const char* bench_check_status_names[] = {"PASS", "NEW", "SLOW", "MISMATCH", "ERROR"};
+
+// Kernel check working state
+static int16_t bench_fir_coeffs[BENCH_FIR_TAPS];
+static int16_t bench_fir_hist[BENCH_FIR_TAPS];
+static char bench_digits[sizeof(BENCH_DTMF_DIGITS)];
+static int bench_digits_len;
+static uint8_t bench_adsi_msg[128];
+static bench_ring_t bench_ring;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _bench_fill(int16_t* buf, int len);
+static void _bench_digits_callback(void* user_data, const char* digits, int len);
+static bool _bench_lec(uint32_t* ns);
+static bool _bench_dtmf(uint32_t* ns);
+static void _bench_resample(uint32_t* down_ns, uint32_t* up_ns);
+static bool _bench_psram(uint32_t* kbps);
+static bool _bench_flash(uint32_t* kbps);
+static bool _bench_codec_i2c(uint32_t* us);
+static bool _bench_gcore_i2c(uint32_t* us);
+static uint32_t _bench_kbps(uint32_t bytes, int64_t usec);
+static bool _bench_k_lec(bench_kernel_t* k, bench_kernel_t* kb);
+static bool _bench_k_fir16(bench_kernel_t* k);
+static bool _bench_k_dtmf_rx(bench_kernel_t* k);
+static bool _bench_k_adsi_tx(bench_kernel_t* k);
+static bool _bench_k_super_tone(bench_kernel_t* k);
+static void _bench_k_resample(bench_kernel_t* kd, bench_kernel_t* ku);
+static void _bench_k_ring(bench_kernel_t* k);
+static void _bench_collect_digits(void* user_data, const char* digits, int len);
+static void _bench_judge(bench_kernel_t* k, const bench_ref_t* ref);
+
+
+
+//
+// API
+//
+void bench_run(bench_result_t* r)
+{
+	memset(r, 0, sizeof(bench_result_t));
+	bench_seed = 0x12345678;
+	
+	if (!_bench_lec(&r->lec_ns)) r->errors |= BENCH_ERR_LEC;
+	if (!_bench_dtmf(&r->dtmf_ns)) r->errors |= BENCH_ERR_DTMF;
+	_bench_resample(&r->down2_ns, &r->up2_ns);
+	if (!_bench_psram(&r->psram_kbps)) r->errors |= BENCH_ERR_PSRAM;
+	if (!_bench_flash(&r->flash_kbps)) r->errors |= BENCH_ERR_FLASH;
+	if (!_bench_codec_i2c(&r->codec_i2c_us)) r->errors |= BENCH_ERR_CODEC_I2C;
+	if (!_bench_gcore_i2c(&r->gcore_i2c_us)) r->errors |= BENCH_ERR_GCORE_I2C;
+}
+
+
+void bench_log(const bench_result_t* r)
+{
+	ESP_LOGI(TAG, "BENCH v=%d lec_ns=%u dtmf_ns=%u down2_ns=%u up2_ns=%u psram_kbps=%u flash_kbps=%u codec_i2c_us=%u gcore_i2c_us=%u lcd_us=%u err=0x%02x",
+	         BENCH_FORMAT_VERSION, r->lec_ns, r->dtmf_ns, r->down2_ns, r->up2_ns, r->psram_kbps,
+	         r->flash_kbps, r->codec_i2c_us, r->gcore_i2c_us, r->lcd_us, r->errors);
+}
+
+
+int bench_check(bench_kernel_t* k)
+{
+	int failures = 0;
+	int i;
+	
+	for (i=0; i<BENCH_NUM_KERNELS; i++) {
+		k[i].name = bench_refs[i].name;
+		k[i].cycles = 0;
+		k[i].budget = bench_refs[i].budget;
+		k[i].crc = 0;
+		k[i].status = BENCH_CHECK_PASS;
+	}
+	
+	// Budgets are cycles at the maximum CPU frequency (flash and PSRAM waits don't scale)
+	pwr_mgmt_hold(PWR_MGMT_HOLD_BENCH);
+	
+	// Kernels checked against a reference computed alongside set BENCH_CHECK_MISMATCH
+	// as they run
+	if (!_bench_k_lec(&k[BENCH_K_LEC], &k[BENCH_K_LEC_BLOCK])) {
+		k[BENCH_K_LEC].status = BENCH_CHECK_ERR;
+		k[BENCH_K_LEC_BLOCK].status = BENCH_CHECK_ERR;
+	}
+	if (!_bench_k_fir16(&k[BENCH_K_FIR16])) k[BENCH_K_FIR16].status = BENCH_CHECK_ERR;
+	if (!_bench_k_dtmf_rx(&k[BENCH_K_DTMF_RX])) k[BENCH_K_DTMF_RX].status = BENCH_CHECK_ERR;
+	if (!_bench_k_adsi_tx(&k[BENCH_K_ADSI_TX])) k[BENCH_K_ADSI_TX].status = BENCH_CHECK_ERR;
+	if (!_bench_k_super_tone(&k[BENCH_K_SUPER_TONE])) k[BENCH_K_SUPER_TONE].status = BENCH_CHECK_ERR;
+	_bench_k_resample(&k[BENCH_K_DOWN2], &k[BENCH_K_UP2]);
+	_bench_k_ring(&k[BENCH_K_RING]);
+	
+	pwr_mgmt_release(PWR_MGMT_HOLD_BENCH);
+	
+	for (i=0; i<BENCH_NUM_KERNELS; i++) {
+		if (k[i].status == BENCH_CHECK_PASS) {
+			_bench_judge(&k[i], &bench_refs[i]);
+		}
+		if (k[i].status != BENCH_CHECK_PASS) failures++;
+	}
+	
+	return failures;
+}
+
+
+void bench_check_log(const bench_kernel_t* k)
+{
+	int i;
+	
+	for (i=0; i<BENCH_NUM_KERNELS; i++) {
+		ESP_LOGI(TAG, "BENCH_CHECK v=%d k=%s cycles=%u budget=%u crc=0x%08x %s", BENCH_FORMAT_VERSION,
+		         k[i].name, k[i].cycles, k[i].budget, k[i].crc, bench_check_status_names[k[i].status]);
+	}
+}
+
+
+
+//
+// Internal functions
+//
+
+// Noise-like audio at about -18 dBFS
+static void _bench_fill(int16_t* buf, int len)
+{
+	while (len--) {
+		bench_seed = bench_seed * 1664525 + 1013904223;
+		*buf++ = (int16_t) ((int32_t) bench_seed >> 19);
+	}
+}
+
+
+static void _bench_digits_callback(void* user_data, const char* digits, int len)
+{
+	// Digits are not expected from noise and are ignored
+}
+
+
+static bool _bench_lec(uint32_t* ns)
+{
+	echo_can_state_t* ec;
+	int64_t t;
+	int i, j;
+	
+	ec = echo_can_create(BENCH_LEC_TAPS, ECHO_CAN_USE_ADAPTION | ECHO_CAN_USE_NLP | ECHO_CAN_USE_CLIP);
+	if (ec == NULL) {
+		ESP_LOGE(TAG, "Could not create echo canceller");
+		return false;
+	}
+	
+	// Received audio is an attenuated, delayed copy of the transmitted audio so the
+	// canceller adapts as it would during a call
+	t = esp_timer_get_time();
+	for (i=0; i<BENCH_LEC_SAMPLES; i+=BENCH_BUF_LEN) {
+		_bench_fill(bench_in, BENCH_BUF_LEN);
+		for (j=0; j<BENCH_BUF_LEN; j++) {
+			bench_out[j] = echo_can_update(ec, bench_in[j], (j < 8) ? 0 : bench_in[j-8] >> 2);
+		}
+	}
+	t = esp_timer_get_time() - t;
+	
+	echo_can_free(ec);
+	
+	*ns = (uint32_t) (t * 1000 / BENCH_LEC_SAMPLES);
+	return true;
+}
+
+
+static bool _bench_dtmf(uint32_t* ns)
+{
+	dtmf_rx_state_t* s;
+	int64_t t;
+	int i;
+	
+	s = dtmf_rx_init(NULL, _bench_digits_callback, NULL);
+	if (s == NULL) {
+		ESP_LOGE(TAG, "Could not create DTMF receiver");
+		return false;
+	}
+	
+	t = esp_timer_get_time();
+	for (i=0; i<BENCH_DTMF_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_DTMF_BLOCK);
+		(void) dtmf_rx(s, bench_in, BENCH_DTMF_BLOCK);
+	}
+	t = esp_timer_get_time() - t;
+	
+	(void) dtmf_rx_free(s);
+	
+	*ns = (uint32_t) (t * 1000 / BENCH_DTMF_BLOCKS);
+	return true;
+}
+
+
+// Times the highest quality filters (the time per sample scales with the filter length)
+static void _bench_resample(uint32_t* down_ns, uint32_t* up_ns)
+{
+	resample_state_t s;
+	int64_t t_down = 0;
+	int64_t t_up = 0;
+	int64_t t;
+	int i;
+	
+	resample_init_down2(&s, RESAMPLE_QUALITY_HIGH);
+	for (i=0; i<BENCH_RS_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_BUF_LEN);
+		t = esp_timer_get_time();
+		(void) resample_down2(&s, bench_in, BENCH_BUF_LEN, bench_out);
+		t_down += esp_timer_get_time() - t;
+	}
+	
+	resample_init_up2(&s, RESAMPLE_QUALITY_HIGH);
+	for (i=0; i<BENCH_RS_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_BUF_LEN);
+		t = esp_timer_get_time();
+		(void) resample_up2(&s, bench_in, BENCH_BUF_LEN, bench_out);
+		t_up += esp_timer_get_time() - t;
+	}
+	
+	*down_ns = (uint32_t) (t_down * 1000 / (BENCH_RS_BLOCKS * BENCH_BUF_LEN));
+	*up_ns = (uint32_t) (t_up * 1000 / (BENCH_RS_BLOCKS * BENCH_BUF_LEN));
+}
+
+
+static bool _bench_psram(uint32_t* kbps)
+{
+	uint8_t* src;
+	uint8_t* dst;
+	int64_t t;
+	int i;
+	
+	src = heap_caps_malloc(BENCH_PSRAM_LEN, MALLOC_CAP_SPIRAM);
+	dst = heap_caps_malloc(BENCH_PSRAM_LEN, MALLOC_CAP_SPIRAM);
+	if ((src == NULL) || (dst == NULL)) {
+		ESP_LOGE(TAG, "Could not allocate PSRAM buffers");
+		if (src != NULL) heap_caps_free(src);
+		if (dst != NULL) heap_caps_free(dst);
+		return false;
+	}
+	memset(src, 0x55, BENCH_PSRAM_LEN);
+	
+	t = esp_timer_get_time();
+	for (i=0; i<BENCH_PSRAM_COPIES; i++) {
+		memcpy(dst, src, BENCH_PSRAM_LEN);
+	}
+	t = esp_timer_get_time() - t;
+	
+	heap_caps_free(src);
+	heap_caps_free(dst);
+	
+	*kbps = _bench_kbps(BENCH_PSRAM_COPIES * BENCH_PSRAM_LEN, t);
+	return true;
+}
+
+
+// Reads the start of the running image (through the flash driver, not the cache)
+static bool _bench_flash(uint32_t* kbps)
+{
+	const esp_partition_t* part;
+	uint8_t* buf;
+	int64_t t;
+	int i;
+	
+	// The flash driver disables the cache, which a task with its stack in PSRAM can't survive
+	if (!esp_ptr_internal(&t)) {
+		ESP_LOGE(TAG, "Flash read needs an internal RAM stack");
+		return false;
+	}
+	
+	part = esp_ota_get_running_partition();
+	if ((part == NULL) || (part->size < BENCH_FLASH_LEN)) {
+		ESP_LOGE(TAG, "Could not find running partition");
+		return false;
+	}
+	
+	buf = heap_caps_malloc(BENCH_FLASH_CHUNK, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (buf == NULL) {
+		ESP_LOGE(TAG, "Could not allocate flash buffer");
+		return false;
+	}
+	
+	t = esp_timer_get_time();
+	for (i=0; i<BENCH_FLASH_LEN; i+=BENCH_FLASH_CHUNK) {
+		if (esp_partition_read(part, i, buf, BENCH_FLASH_CHUNK) != ESP_OK) {
+			ESP_LOGE(TAG, "Flash read failed at %d", i);
+			heap_caps_free(buf);
+			return false;
+		}
+	}
+	t = esp_timer_get_time() - t;
+	
+	heap_caps_free(buf);
+	
+	*kbps = _bench_kbps(BENCH_FLASH_LEN, t);
+	return true;
+}
+
+
+// Round-trips include waiting for the I2C service task so they are what a client sees
+static bool _bench_codec_i2c(uint32_t* us)
+{
+	int64_t t;
+	int i;
+	int vol;
+	
+	t = esp_timer_get_time();
+	for (i=0; i<BENCH_I2C_READS; i++) {
+		if (es8388_get_voice_volume(&vol) != ESP_OK) {
+			ESP_LOGE(TAG, "Codec read failed");
+			return false;
+		}
+	}
+	t = esp_timer_get_time() - t;
+	
+	*us = (uint32_t) (t / BENCH_I2C_READS);
+	return true;
+}
+
+
+static bool _bench_gcore_i2c(uint32_t* us)
+{
+	int64_t t;
+	int i;
+	uint8_t id;
+	
+	t = esp_timer_get_time();
+	for (i=0; i<BENCH_I2C_READS; i++) {
+		if (!gcore_get_reg8(GCORE_REG_ID, &id)) {
+			ESP_LOGE(TAG, "gCore read failed");
+			return false;
+		}
+	}
+	t = esp_timer_get_time() - t;
+	
+	*us = (uint32_t) (t / BENCH_I2C_READS);
+	return true;
+}
+
+
+static uint32_t _bench_kbps(uint32_t bytes, int64_t usec)
+{
+	if (usec <= 0) return 0;
+	
+	return (uint32_t) (((int64_t) bytes * 1000000 / 1024) / usec);
+}
+
+
+// Runs the per-sample and block echo cancellers side by side on the same audio (the block
+// version must match the per-sample one exactly when it isn't split)
+static bool _bench_k_lec(bench_kernel_t* k, bench_kernel_t* kb)
+{
+	echo_can_state_t* ec;
+	echo_can_state_t* ecb;
+	uint32_t best = UINT32_MAX;
+	uint32_t best_b = UINT32_MAX;
+	uint32_t c;
+	int i, j;
+	
+	ec = echo_can_create(BENCH_LEC_TAPS, ECHO_CAN_USE_ADAPTION | ECHO_CAN_USE_NLP | ECHO_CAN_USE_CLIP);
+	ecb = echo_can_create(BENCH_LEC_TAPS, ECHO_CAN_USE_ADAPTION | ECHO_CAN_USE_NLP | ECHO_CAN_USE_CLIP);
+	if ((ec == NULL) || (ecb == NULL)) {
+		ESP_LOGE(TAG, "Could not create echo cancellers");
+		if (ec != NULL) echo_can_free(ec);
+		if (ecb != NULL) echo_can_free(ecb);
+		return false;
+	}
+	
+	bench_seed = BENCH_CHECK_SEED;
+	for (i=0; i<BENCH_CHECK_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_CHECK_BLOCK);
+		for (j=0; j<BENCH_CHECK_BLOCK; j++) {
+			bench_rx[j] = (j < 8) ? 0 : bench_in[j-8] >> 2;
+		}
+		
+		c = esp_cpu_get_ccount();
+		for (j=0; j<BENCH_CHECK_BLOCK; j++) {
+			bench_out[j] = echo_can_update(ec, bench_in[j], bench_rx[j]);
+		}
+		c = esp_cpu_get_ccount() - c;
+		if (c < best) best = c;
+		
+		c = esp_cpu_get_ccount();
+		echo_can_update_block(ecb, bench_in, bench_rx, bench_ref, BENCH_CHECK_BLOCK);
+		c = esp_cpu_get_ccount() - c;
+		if (c < best_b) best_b = c;
+		
+		k->crc = esp_rom_crc32_le(k->crc, (uint8_t*) bench_out, BENCH_CHECK_BLOCK * sizeof(int16_t));
+		kb->crc = esp_rom_crc32_le(kb->crc, (uint8_t*) bench_ref, BENCH_CHECK_BLOCK * sizeof(int16_t));
+		if (memcmp(bench_out, bench_ref, BENCH_CHECK_BLOCK * sizeof(int16_t)) != 0) {
+			kb->status = BENCH_CHECK_MISMATCH;
+		}
+	}
+	
+	echo_can_free(ec);
+	echo_can_free(ecb);
+	
+	k->cycles = best;
+	kb->cycles = best_b;
+	return true;
+}
+
+
+// Checks fir16 against a plain dot product over its own history (newest sample first)
+static bool _bench_k_fir16(bench_kernel_t* k)
+{
+	fir16_state_t fir;
+	uint32_t best = UINT32_MAX;
+	uint32_t c;
+	int32_t y;
+	int i, j, n;
+	
+	// Coefficients small enough that the 32-bit sum can't overflow
+	bench_seed = BENCH_CHECK_SEED;
+	for (i=0; i<BENCH_FIR_TAPS; i++) {
+		bench_seed = bench_seed * 1664525 + 1013904223;
+		bench_fir_coeffs[i] = (int16_t) ((int32_t) bench_seed >> 22);
+	}
+	memset(bench_fir_hist, 0, sizeof(bench_fir_hist));
+	
+	if (fir16_create(&fir, bench_fir_coeffs, BENCH_FIR_TAPS) == NULL) {
+		ESP_LOGE(TAG, "Could not create FIR");
+		return false;
+	}
+	
+	for (i=0; i<BENCH_CHECK_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_CHECK_BLOCK);
+		
+		c = esp_cpu_get_ccount();
+		for (j=0; j<BENCH_CHECK_BLOCK; j++) {
+			bench_out[j] = fir16(&fir, bench_in[j]);
+		}
+		c = esp_cpu_get_ccount() - c;
+		if (c < best) best = c;
+		
+		for (j=0; j<BENCH_CHECK_BLOCK; j++) {
+			memmove(&bench_fir_hist[1], &bench_fir_hist[0], (BENCH_FIR_TAPS - 1) * sizeof(int16_t));
+			bench_fir_hist[0] = bench_in[j];
+			y = 0;
+			for (n=0; n<BENCH_FIR_TAPS; n++) {
+				y += (int32_t) bench_fir_coeffs[n] * bench_fir_hist[n];
+			}
+			bench_ref[j] = (int16_t) (y >> 15);
+		}
+		
+		k->crc = esp_rom_crc32_le(k->crc, (uint8_t*) bench_out, BENCH_CHECK_BLOCK * sizeof(int16_t));
+		if (memcmp(bench_out, bench_ref, BENCH_CHECK_BLOCK * sizeof(int16_t)) != 0) {
+			k->status = BENCH_CHECK_MISMATCH;
+		}
+	}
+	
+	fir16_free(&fir);
+	
+	k->cycles = best;
+	return true;
+}
+
+
+// Decodes every DTMF digit from the transmitter, in the pots_task block length
+static bool _bench_k_dtmf_rx(bench_kernel_t* k)
+{
+	dtmf_tx_state_t* tx;
+	dtmf_rx_state_t* rx;
+	uint32_t best = UINT32_MAX;
+	uint32_t c;
+	int i, n;
+	int quiet = 0;
+	
+	tx = dtmf_tx_init(NULL);
+	rx = dtmf_rx_init(NULL, _bench_collect_digits, NULL);
+	if ((tx == NULL) || (rx == NULL)) {
+		ESP_LOGE(TAG, "Could not create DTMF transmitter and receiver");
+		if (tx != NULL) (void) dtmf_tx_free(tx);
+		if (rx != NULL) (void) dtmf_rx_free(rx);
+		return false;
+	}
+	(void) dtmf_tx_put(tx, BENCH_DTMF_DIGITS, -1);
+	bench_digits_len = 0;
+	
+	for (i=0; (i<BENCH_CHECK_MAX_BLKS) && (quiet < BENCH_DTMF_QUIET_BLKS); i++) {
+		n = dtmf_tx(tx, bench_in, BENCH_CHECK_BLOCK);
+		if (n < BENCH_CHECK_BLOCK) {
+			memset(&bench_in[n], 0, (BENCH_CHECK_BLOCK - n) * sizeof(int16_t));
+			if (n == 0) quiet++;
+		}
+		
+		c = esp_cpu_get_ccount();
+		for (n=0; n<BENCH_CHECK_BLOCK; n+=BENCH_DTMF_BLOCK) {
+			(void) dtmf_rx(rx, &bench_in[n], BENCH_DTMF_BLOCK);
+		}
+		c = esp_cpu_get_ccount() - c;
+		if (c < best) best = c;
+	}
+	
+	(void) dtmf_tx_free(tx);
+	(void) dtmf_rx_free(rx);
+	
+	bench_digits[bench_digits_len] = 0;
+	k->crc = esp_rom_crc32_le(0, (uint8_t*) bench_digits, bench_digits_len);
+	if (strcmp(bench_digits, BENCH_DTMF_DIGITS) != 0) {
+		ESP_LOGE(TAG, "DTMF receiver decoded \"%s\"", bench_digits);
+		k->status = BENCH_CHECK_MISMATCH;
+	}
+	
+	k->cycles = best;
+	return true;
+}
+
+
+// Sends a Bellcore-style MDMF caller ID message (only complete blocks are timed)
+static bool _bench_k_adsi_tx(bench_kernel_t* k)
+{
+	adsi_tx_state_t* s;
+	uint32_t best = UINT32_MAX;
+	uint32_t c;
+	int i, n;
+	int len = -1;
+	
+	s = adsi_tx_init(NULL, ADSI_STANDARD_CLIP);
+	if (s == NULL) {
+		ESP_LOGE(TAG, "Could not create ADSI transmitter");
+		return false;
+	}
+	
+	len = adsi_add_field(s, bench_adsi_msg, len, CLIP_MDMF_CALLERID, NULL, 0);
+	len = adsi_add_field(s, bench_adsi_msg, len, CLIP_CALLTYPE, (uint8_t *) "\x81", 1);
+	len = adsi_add_field(s, bench_adsi_msg, len, CLIP_DATETIME, (uint8_t *) "01021234", 8);
+	len = adsi_add_field(s, bench_adsi_msg, len, CLIP_CALLER_NUMBER, (uint8_t *) "5551234567", 10);
+	(void) adsi_tx_put_message(s, bench_adsi_msg, len);
+	
+	for (i=0; i<BENCH_CHECK_MAX_BLKS; i++) {
+		c = esp_cpu_get_ccount();
+		n = adsi_tx(s, bench_out, BENCH_CHECK_BLOCK);
+		c = esp_cpu_get_ccount() - c;
+		if ((n == BENCH_CHECK_BLOCK) && (c < best)) best = c;
+		
+		k->crc = esp_rom_crc32_le(k->crc, (uint8_t*) bench_out, n * sizeof(int16_t));
+		if (n < BENCH_CHECK_BLOCK) break;
+	}
+	
+	(void) adsi_tx_free(s);
+	
+	k->cycles = (best == UINT32_MAX) ? 0 : best;
+	return true;
+}
+
+
+// Generates a continuous two frequency tone the way pots_task's tones are built
+static bool _bench_k_super_tone(bench_kernel_t* k)
+{
+	super_tone_tx_step_t* step;
+	super_tone_tx_state_t* s;
+	uint32_t best = UINT32_MAX;
+	uint32_t c;
+	int i, n;
+	
+	step = super_tone_tx_make_step_4(NULL, 440.0f, 480.0f, 0.0f, 0.0f, -16.0f, 0, 1);
+	if (step == NULL) {
+		ESP_LOGE(TAG, "Could not create tone");
+		return false;
+	}
+	s = super_tone_tx_init(NULL, step);
+	if (s == NULL) {
+		ESP_LOGE(TAG, "Could not create tone generator");
+		(void) super_tone_tx_free_tone(step);
+		return false;
+	}
+	
+	for (i=0; i<BENCH_CHECK_BLOCKS; i++) {
+		c = esp_cpu_get_ccount();
+		n = super_tone_tx(s, bench_out, BENCH_CHECK_BLOCK);
+		c = esp_cpu_get_ccount() - c;
+		if (c < best) best = c;
+		
+		k->crc = esp_rom_crc32_le(k->crc, (uint8_t*) bench_out, n * sizeof(int16_t));
+	}
+	
+	(void) super_tone_tx_free(s);
+	(void) super_tone_tx_free_tone(step);
+	
+	k->cycles = best;
+	return true;
+}
+
+
+static void _bench_k_resample(bench_kernel_t* kd, bench_kernel_t* ku)
+{
+	resample_state_t s;
+	uint32_t best = UINT32_MAX;
+	uint32_t c;
+	int i, n;
+	
+	bench_seed = BENCH_CHECK_SEED;
+	resample_init_down2(&s, RESAMPLE_QUALITY_HIGH);
+	for (i=0; i<BENCH_CHECK_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_CHECK_BLOCK);
+		c = esp_cpu_get_ccount();
+		n = resample_down2(&s, bench_in, BENCH_CHECK_BLOCK, bench_out);
+		c = esp_cpu_get_ccount() - c;
+		if (c < best) best = c;
+		kd->crc = esp_rom_crc32_le(kd->crc, (uint8_t*) bench_out, n * sizeof(int16_t));
+	}
+	kd->cycles = best;
+	
+	best = UINT32_MAX;
+	bench_seed = BENCH_CHECK_SEED;
+	resample_init_up2(&s, RESAMPLE_QUALITY_HIGH);
+	for (i=0; i<BENCH_CHECK_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_CHECK_BLOCK);
+		c = esp_cpu_get_ccount();
+		n = resample_up2(&s, bench_in, BENCH_CHECK_BLOCK, bench_out);
+		c = esp_cpu_get_ccount() - c;
+		if (c < best) best = c;
+		ku->crc = esp_rom_crc32_le(ku->crc, (uint8_t*) bench_out, n * sizeof(int16_t));
+	}
+	ku->cycles = best;
+}
+
+
+// Writes and reads a block through a ring that isn't a multiple of the block long so the
+// copies split around its end
+static void _bench_k_ring(bench_kernel_t* k)
+{
+	uint32_t best = UINT32_MAX;
+	uint32_t c;
+	int i, n;
+	
+	bench_ring_init(&bench_ring);
+	bench_seed = BENCH_CHECK_SEED;
+	for (i=0; i<BENCH_CHECK_BLOCKS; i++) {
+		_bench_fill(bench_in, BENCH_CHECK_BLOCK);
+		c = esp_cpu_get_ccount();
+		n = bench_ring_write(&bench_ring, bench_in, BENCH_CHECK_BLOCK);
+		n += bench_ring_read(&bench_ring, bench_out, BENCH_CHECK_BLOCK);
+		c = esp_cpu_get_ccount() - c;
+		if (c < best) best = c;
+		
+		k->crc = esp_rom_crc32_le(k->crc, (uint8_t*) bench_out, BENCH_CHECK_BLOCK * sizeof(int16_t));
+		if ((n != 2*BENCH_CHECK_BLOCK) || (memcmp(bench_in, bench_out, BENCH_CHECK_BLOCK * sizeof(int16_t)) != 0)) {
+			k->status = BENCH_CHECK_MISMATCH;
+		}
+	}
+	k->cycles = best;
+}
+
+
+static void _bench_collect_digits(void* user_data, const char* digits, int len)
+{
+	while ((len-- > 0) && (bench_digits_len < (int) (sizeof(bench_digits) - 1))) {
+		bench_digits[bench_digits_len++] = *digits++;
+	}
+}
+
+
+// Sets the status of a kernel that ran and matched any reference computed alongside
+static void _bench_judge(bench_kernel_t* k, const bench_ref_t* ref)
+{
+	if ((ref->budget == 0) || (ref->crc == 0)) {
+		k->status = BENCH_CHECK_NEW;
+	} else if (k->crc != ref->crc) {
+		k->status = BENCH_CHECK_MISMATCH;
+	} else if (k->cycles > (ref->budget + ref->budget * BENCH_CHECK_TOL_PCT / 100)) {
+		k->status = BENCH_CHECK_SLOW;
+	}
+}
@@ -0,0 +1,121 @@
+/*
+ * bench - utility module timing the signal processing, memory, flash and I2C paths the
+ * firmware depends on so units (and firmware builds) can be compared.  It runs in the
+ * caller's context and takes a few hundred mSec so it should only be run while audio is
+ * idle.  Results are logged as a single "BENCH" line of key=value pairs whose keys and
+ * units don't change (new keys are only appended) so logs can be parsed by scripts.
+ *
+ * bench_check is a regression check of the hot signal processing kernels.  Each is run on
+ * fixed pseudo-random (or generated) vectors and timed with the CPU cycle counter, taking
+ * the fastest of its blocks so interrupts and task switches don't count.  The cycles are
+ * compared with a budget and the output checked to be bit-exact, either against a reference
+ * computed alongside (the block echo canceller, FIR, DTMF receiver and ring) or against the
+ * output CRC-32 recorded with the budget.  Budgets and CRCs are checked in to bench.c and
+ * are recorded by copying the values a reference unit reports for a NEW kernel.  Results
+ * are logged as one "BENCH_CHECK" line per kernel.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Log format version (incremented if the meaning of an existing key changes)
+#define BENCH_FORMAT_VERSION 1
+
+// Echo canceller length timed (64 mSec at 8 kHz)
+#define BENCH_LEC_TAPS       512
+
+// DTMF receiver block length (10 mSec at 8 kHz, as used by pots_task)
+#define BENCH_DTMF_BLOCK     80
+
+// bench_result_t errors bits
+#define BENCH_ERR_LEC        0x01
+#define BENCH_ERR_DTMF       0x02
+#define BENCH_ERR_PSRAM      0x04
+#define BENCH_ERR_FLASH      0x08
+#define BENCH_ERR_CODEC_I2C  0x10
+#define BENCH_ERR_GCORE_I2C  0x20
+
+// Kernels checked by bench_check, each timed per BENCH_CHECK_BLOCK samples
+#define BENCH_K_LEC          0    /* echo_can_update */
+#define BENCH_K_LEC_BLOCK    1    /* echo_can_update_block */
+#define BENCH_K_FIR16        2
+#define BENCH_K_DTMF_RX      3
+#define BENCH_K_ADSI_TX      4
+#define BENCH_K_SUPER_TONE   5    /* super_tone_tx */
+#define BENCH_K_DOWN2        6    /* resample_down2 (high quality) */
+#define BENCH_K_UP2          7    /* resample_up2 (high quality) */
+#define BENCH_K_RING         8    /* ring write and read */
+#define BENCH_NUM_KERNELS    9
+
+#define BENCH_CHECK_BLOCK    160
+
+// Amount a kernel may exceed its budget
+#define BENCH_CHECK_TOL_PCT  10
+
+// bench_kernel_t status
+#define BENCH_CHECK_PASS     0
+#define BENCH_CHECK_NEW      1    /* No budget or CRC recorded yet (a failure) */
+#define BENCH_CHECK_SLOW     2    /* Over budget by more than the tolerance */
+#define BENCH_CHECK_MISMATCH 3    /* Output not bit-exact */
+#define BENCH_CHECK_ERR      4    /* Could not be run */
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t lec_ns;                      // echo_can_update per sample (nSec)
+	uint32_t dtmf_ns;                     // dtmf_rx per BENCH_DTMF_BLOCK sample block (nSec)
+	uint32_t down2_ns;                    // 16k -> 8k decimator per input sample (nSec)
+	uint32_t up2_ns;                      // 8k -> 16k interpolator per input sample (nSec)
+	uint32_t psram_kbps;                  // PSRAM to PSRAM memcpy (KB/sec)
+	uint32_t flash_kbps;                  // Running app partition read (KB/sec)
+	uint32_t codec_i2c_us;                // ES8388 register read round-trip (uSec)
+	uint32_t gcore_i2c_us;                // gCore register read round-trip (uSec)
+	uint32_t lcd_us;                      // Full screen redraw and flush (uSec, filled in by the GUI)
+	uint32_t errors;                      // BENCH_ERR_* bits for items that could not be run
+} bench_result_t;
+
+typedef struct {
+	const char* name;
+	uint32_t cycles;                      // Fastest BENCH_CHECK_BLOCK sample block
+	uint32_t budget;                      // Checked in (0 if not recorded)
+	uint32_t crc;                         // CRC-32 of the output
+	int status;                           // BENCH_CHECK_*
+} bench_kernel_t;
+
+
+
+//
+// API
+//
+void bench_run(bench_result_t* r);        // Everything except lcd_us, which is set to 0
+void bench_log(const bench_result_t* r);
+int bench_check(bench_kernel_t* k);       // Fills BENCH_NUM_KERNELS entries, returns the failures
+void bench_check_log(const bench_kernel_t* k);
+
+#endif /* _BENCH_H_ */
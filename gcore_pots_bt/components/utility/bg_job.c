@@ -0,0 +1,316 @@
+/*
+ * bg_job - utility module running deferrable work in otherwise idle time on core 0.
+ * See bg_job.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "bg_job.h"
+#include <string.h>
+#include "audio_task.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "pace.h"
+
+
+//
+// Constants
+//
+
+// Running average slice time weight (1/2^n of each new slice)
+#define BG_JOB_AVG_SHIFT     3
+
+// End of a job list
+#define BG_JOB_NONE          -1
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	char name[BG_JOB_MAX_NAME_LEN];
+	bg_job_fn_t fn;
+	void* arg;
+	int prio;
+	int next;                             // Next job in the same list
+} bg_job_entry_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "bg_job";
+
+static portMUX_TYPE bg_job_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static bg_job_entry_t bg_jobs[BG_JOB_MAX_JOBS];
+static int bg_job_head[BG_JOB_NUM_PRIO];          // FIFO of queued jobs at each priority
+static int bg_job_tail[BG_JOB_NUM_PRIO];
+static int bg_job_free;                           // Unused entries
+static int bg_job_count = 0;
+
+static bg_job_stats_t bg_job_stats;
+
+static TaskHandle_t task_handle_bg_job = NULL;
+static StackType_t bg_job_task_stack[BG_JOB_TASK_STACK];
+static StaticTask_t bg_job_task_tcb;
+
+// Worker task state
+static int64_t bg_job_slice_start_usec;
+static int64_t bg_job_busy_usec = 0;              // Last time the system was seen busy
+static uint32_t bg_job_prev_misses = 0;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _bgJobTask(void* args);
+static int _bgJobTake();
+static void _bgJobPut(int j);
+static bool _bgJobHeld();
+
+
+
+//
+// API
+//
+bool bg_job_init()
+{
+	int i;
+	
+	for (i=0; i<BG_JOB_NUM_PRIO; i++) {
+		bg_job_head[i] = BG_JOB_NONE;
+		bg_job_tail[i] = BG_JOB_NONE;
+	}
+	for (i=0; i<BG_JOB_MAX_JOBS; i++) {
+		bg_jobs[i].next = (i < (BG_JOB_MAX_JOBS - 1)) ? i + 1 : BG_JOB_NONE;
+	}
+	bg_job_free = 0;
+	
+	// Idle priority on core 0 so jobs only get the time nothing else wants
+	task_handle_bg_job = xTaskCreateStaticPinnedToCore(&_bgJobTask, "bg_job_task", BG_JOB_TASK_STACK, NULL, tskIDLE_PRIORITY,
+	                                                   bg_job_task_stack, &bg_job_task_tcb, 0);
+	if (task_handle_bg_job == NULL) {
+		ESP_LOGE(TAG, "Could not start task");
+		return false;
+	}
+	
+	return true;
+}
+
+
+bool bg_job_submit(const char* name, bg_job_fn_t fn, void* arg, int prio)
+{
+	int j;
+	
+	if ((fn == NULL) || (prio < 0) || (prio >= BG_JOB_NUM_PRIO)) return false;
+	
+	portENTER_CRITICAL(&bg_job_mux);
+	if ((j = bg_job_free) == BG_JOB_NONE) {
+		bg_job_stats.dropped += 1;
+		portEXIT_CRITICAL(&bg_job_mux);
+		ESP_LOGW(TAG, "Queue full, dropped %s", name);
+		return false;
+	}
+	bg_job_free = bg_jobs[j].next;
+	bg_job_count += 1;
+	bg_job_stats.submitted += 1;
+	if (bg_job_count > bg_job_stats.high_water) bg_job_stats.high_water = bg_job_count;
+	
+	strncpy(bg_jobs[j].name, name, BG_JOB_MAX_NAME_LEN - 1);
+	bg_jobs[j].name[BG_JOB_MAX_NAME_LEN - 1] = 0;
+	bg_jobs[j].fn = fn;
+	bg_jobs[j].arg = arg;
+	bg_jobs[j].prio = prio;
+	portEXIT_CRITICAL(&bg_job_mux);
+	
+	_bgJobPut(j);
+	
+	if (task_handle_bg_job != NULL) {
+		xTaskNotifyGive(task_handle_bg_job);
+	}
+	
+	return true;
+}
+
+
+bool bg_job_should_yield()
+{
+	audio_load_t load;
+	
+	if ((esp_timer_get_time() - bg_job_slice_start_usec) >= BG_JOB_SLICE_USEC) return true;
+	
+	audio_get_load(&load);
+	return load.enabled;
+}
+
+
+void bg_job_get_stats(bg_job_stats_t* stats)
+{
+	int i, j;
+	
+	portENTER_CRITICAL(&bg_job_mux);
+	memcpy(stats, &bg_job_stats, sizeof(bg_job_stats_t));
+	for (i=0; i<BG_JOB_NUM_PRIO; i++) {
+		stats->depth[i] = 0;
+		for (j=bg_job_head[i]; j!=BG_JOB_NONE; j=bg_jobs[j].next) {
+			stats->depth[i] += 1;
+		}
+	}
+	portEXIT_CRITICAL(&bg_job_mux);
+}
+
+
+void bg_job_print_stats()
+{
+	bg_job_stats_t s;
+	
+	bg_job_get_stats(&s);
+	ESP_LOGI(TAG, "Queued %d/%d/%d (hw %d)%s, submitted %u, completed %u, dropped %u, held off %u",
+	         s.depth[BG_JOB_PRIO_HIGH], s.depth[BG_JOB_PRIO_NORMAL], s.depth[BG_JOB_PRIO_LOW], s.high_water,
+	         s.held ? " held" : "", s.submitted, s.completed, s.dropped, s.holdoffs);
+	ESP_LOGI(TAG, "Slices %u (%u long), avg %u uS, max %u uS (%s)", s.slices, s.long_slices, s.avg_slice_usec,
+	         s.max_slice_usec, s.max_slice_name);
+}
+
+
+
+//
+// Internal functions
+//
+static void _bgJobTask(void* args)
+{
+	bool more;
+	int j;
+	uint32_t t;
+	
+	ESP_LOGI(TAG, "Start task");
+	
+	while (true) {
+		if (bg_job_count == 0) {
+			(void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+			continue;
+		}
+		
+		if (_bgJobHeld()) {
+			portENTER_CRITICAL(&bg_job_mux);
+			if (!bg_job_stats.held) bg_job_stats.holdoffs += 1;
+			bg_job_stats.held = true;
+			portEXIT_CRITICAL(&bg_job_mux);
+			vTaskDelay(pdMS_TO_TICKS(BG_JOB_HOLDOFF_MSEC));
+			continue;
+		}
+		portENTER_CRITICAL(&bg_job_mux);
+		bg_job_stats.held = false;
+		portEXIT_CRITICAL(&bg_job_mux);
+		
+		if ((j = _bgJobTake()) == BG_JOB_NONE) continue;
+		
+		bg_job_slice_start_usec = esp_timer_get_time();
+		more = bg_jobs[j].fn(bg_jobs[j].arg);
+		t = (uint32_t) (esp_timer_get_time() - bg_job_slice_start_usec);
+		
+		if (t > BG_JOB_SLICE_USEC) {
+			ESP_LOGW(TAG, "%s ran %u uS", bg_jobs[j].name, t);
+		}
+		
+		portENTER_CRITICAL(&bg_job_mux);
+		bg_job_stats.slices += 1;
+		if (t > BG_JOB_SLICE_USEC) bg_job_stats.long_slices += 1;
+		if (bg_job_stats.avg_slice_usec == 0) {
+			bg_job_stats.avg_slice_usec = t;
+		} else {
+			bg_job_stats.avg_slice_usec += ((int32_t) t - (int32_t) bg_job_stats.avg_slice_usec) >> BG_JOB_AVG_SHIFT;
+		}
+		if (t > bg_job_stats.max_slice_usec) {
+			bg_job_stats.max_slice_usec = t;
+			strcpy(bg_job_stats.max_slice_name, bg_jobs[j].name);
+		}
+		if (!more) {
+			bg_job_stats.completed += 1;
+			bg_job_count -= 1;
+			bg_jobs[j].next = bg_job_free;
+			bg_job_free = j;
+		}
+		portEXIT_CRITICAL(&bg_job_mux);
+		
+		if (more) {
+			_bgJobPut(j);
+		}
+		
+		// Let the idle task (same priority) have its turn between slices
+		taskYIELD();
+	}
+}
+
+
+// Removes and returns the oldest job of the highest priority queued
+static int _bgJobTake()
+{
+	int i;
+	int j = BG_JOB_NONE;
+	
+	portENTER_CRITICAL(&bg_job_mux);
+	for (i=0; i<BG_JOB_NUM_PRIO; i++) {
+		if ((j = bg_job_head[i]) != BG_JOB_NONE) {
+			bg_job_head[i] = bg_jobs[j].next;
+			if (bg_job_head[i] == BG_JOB_NONE) bg_job_tail[i] = BG_JOB_NONE;
+			break;
+		}
+	}
+	portEXIT_CRITICAL(&bg_job_mux);
+	
+	return j;
+}
+
+
+// Adds a job to the back of its priority's queue
+static void _bgJobPut(int j)
+{
+	int p = bg_jobs[j].prio;
+	
+	portENTER_CRITICAL(&bg_job_mux);
+	bg_jobs[j].next = BG_JOB_NONE;
+	if (bg_job_tail[p] == BG_JOB_NONE) {
+		bg_job_head[p] = j;
+	} else {
+		bg_jobs[bg_job_tail[p]].next = j;
+	}
+	bg_job_tail[p] = j;
+	portEXIT_CRITICAL(&bg_job_mux);
+}
+
+
+// True while audio is running, the echo canceller is short of time or a deadline was missed,
+// and until BG_JOB_QUIET_MSEC after
+static bool _bgJobHeld()
+{
+	audio_load_t load;
+	int64_t now = esp_timer_get_time();
+	
+	audio_get_load(&load);
+	if (load.enabled || (load.lec_budget_level != AUDIO_LEC_BUDGET_FULL) || (load.deadline_misses != bg_job_prev_misses) ||
+	    pace_stressed()) {
+		bg_job_busy_usec = now;
+		bg_job_prev_misses = load.deadline_misses;
+	}
+	
+	return ((bg_job_busy_usec != 0) && ((now - bg_job_busy_usec) < (BG_JOB_QUIET_MSEC * 1000)));
+}
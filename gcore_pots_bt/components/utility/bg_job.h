@@ -0,0 +1,101 @@
+/*
+ * bg_job - utility module running deferrable work (cache rendering, indexing, log formatting,
+ * persistent storage commits) in otherwise idle time on core 0 instead of inline in the tasks
+ * handling calls.
+ *
+ * A job is a function run in slices: each call does a bounded piece of work and returns true
+ * if there is more to do, in which case the job goes to the back of its priority's queue so
+ * jobs of the same priority take turns.  Long slices should check bg_job_should_yield and
+ * return early when it's set.  Higher priority jobs always run first.
+ *
+ * The worker task runs at the idle priority and holds every job off while audio is running,
+ * while the echo canceller is shedding work for lack of time and for BG_JOB_QUIET_MSEC after
+ * either or after a deadline miss.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _BG_JOB_H_
+#define _BG_JOB_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Job priorities
+#define BG_JOB_PRIO_HIGH     0
+#define BG_JOB_PRIO_NORMAL   1
+#define BG_JOB_PRIO_LOW      2
+#define BG_JOB_NUM_PRIO      3
+
+// Most jobs queued at once
+#define BG_JOB_MAX_JOBS      16
+
+// Longest name kept for the statistics
+#define BG_JOB_MAX_NAME_LEN  16
+
+// Run time after which bg_job_should_yield asks a slice to return
+#define BG_JOB_SLICE_USEC    5000
+
+// Time audio must have been idle and deadlines met before jobs run again
+#define BG_JOB_QUIET_MSEC    2000
+
+// Check interval while jobs are held off
+#define BG_JOB_HOLDOFF_MSEC  250
+
+// Worker task (the job functions run on its stack)
+#define BG_JOB_TASK_STACK    4096
+
+
+
+//
+// Typedefs
+//
+
+// Runs one slice of a job, returns true if there is more to do
+typedef bool (*bg_job_fn_t)(void* arg);
+
+typedef struct {
+	int depth[BG_JOB_NUM_PRIO];           // Jobs queued at each priority
+	int high_water;                       // Most jobs queued at once
+	bool held;                            // Jobs are currently held off
+	uint32_t submitted;
+	uint32_t completed;
+	uint32_t dropped;                     // Submissions refused because the queue was full
+	uint32_t slices;
+	uint32_t holdoffs;                    // Times the worker found the system busy with work queued
+	uint32_t long_slices;                 // Slices that ran past BG_JOB_SLICE_USEC
+	uint32_t avg_slice_usec;
+	uint32_t max_slice_usec;
+	char max_slice_name[BG_JOB_MAX_NAME_LEN];  // Job that ran the longest slice
+} bg_job_stats_t;
+
+
+
+//
+// API
+//
+bool bg_job_init();                                                      // Call from app_main before the tasks start
+bool bg_job_submit(const char* name, bg_job_fn_t fn, void* arg, int prio);  // Any task, false if the queue is full
+bool bg_job_should_yield();                                              // From a job: return now and continue next slice
+void bg_job_get_stats(bg_job_stats_t* stats);
+void bg_job_print_stats();                                               // Dump to the console log
+
+#endif /* _BG_JOB_H_ */
@@ -0,0 +1,128 @@
+/*
+ * biquad - utility module providing fixed-point second order IIR filters processed a block
+ * of samples at a time.
+ *
+ * Filters are direct form I.  The feedback terms use the output history with 8 extra
+ * fractional bits so the rounding error of each output doesn't recirculate as a DC offset
+ * or limit cycle.  Coefficients are limited to |c| < 8 by Q28.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "biquad.h"
+#include <math.h>
+
+
+
+//
+// Constants
+//
+
+// Coefficient and output history fractional bits
+#define BIQUAD_COEF_SHIFT 28
+#define BIQUAD_HIST_SHIFT 8
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int32_t _biquad_coef(double c);
+
+
+
+//
+// API
+//
+void biquad_init_hpf(biquad_state_t* s, int fc, int rate)
+{
+	double w0 = 2.0 * M_PI * (double) fc / (double) rate;
+	double alpha = sin(w0) / (2.0 * M_SQRT1_2);   // Q = 1/sqrt(2)
+	double cw = cos(w0);
+	double a0 = 1.0 + alpha;
+	
+	s->b0 = _biquad_coef(((1.0 + cw) / 2.0) / a0);
+	s->b1 = _biquad_coef(-(1.0 + cw) / a0);
+	s->b2 = s->b0;
+	s->a1 = _biquad_coef((-2.0 * cw) / a0);
+	s->a2 = _biquad_coef((1.0 - alpha) / a0);
+	
+	biquad_reset(s);
+}
+
+
+void biquad_init_coeffs(biquad_state_t* s, const int32_t* c)
+{
+	s->b0 = c[0];
+	s->b1 = c[1];
+	s->b2 = c[2];
+	s->a1 = c[3];
+	s->a2 = c[4];
+	
+	biquad_reset(s);
+}
+
+
+void biquad_reset(biquad_state_t* s)
+{
+	s->x1 = 0;
+	s->x2 = 0;
+	s->y1 = 0;
+	s->y2 = 0;
+}
+
+
+void biquad_process(biquad_state_t* s, int16_t* buf, int len)
+{
+	int64_t acc;
+	int32_t x0, y0, out;
+	int32_t x1 = s->x1;
+	int32_t x2 = s->x2;
+	int32_t y1 = s->y1;
+	int32_t y2 = s->y2;
+	int i;
+	
+	for (i=0; i<len; i++) {
+		x0 = buf[i];
+		acc = ((int64_t) s->b0 * x0 + (int64_t) s->b1 * x1 + (int64_t) s->b2 * x2) << BIQUAD_HIST_SHIFT;
+		acc -= (int64_t) s->a1 * y1 + (int64_t) s->a2 * y2;
+		y0 = (int32_t) (acc >> BIQUAD_COEF_SHIFT);
+		
+		x2 = x1;
+		x1 = x0;
+		y2 = y1;
+		y1 = y0;
+		
+		out = (y0 + (1 << (BIQUAD_HIST_SHIFT - 1))) >> BIQUAD_HIST_SHIFT;
+		if (out > INT16_MAX) out = INT16_MAX;
+		if (out < INT16_MIN) out = INT16_MIN;
+		buf[i] = (int16_t) out;
+	}
+	
+	s->x1 = x1;
+	s->x2 = x2;
+	s->y1 = y1;
+	s->y2 = y2;
+}
+
+
+
+//
+// Internal functions
+//
+static int32_t _biquad_coef(double c)
+{
+	return (int32_t) lround(c * (double) (1 << BIQUAD_COEF_SHIFT));
+}
@@ -0,0 +1,49 @@
+/*
+ * biquad - utility module providing fixed-point second order IIR filters processed a block
+ * of samples at a time.  Coefficients are designed in floating point when the filter is
+ * initialized and run in Q28 with the output history kept to 8 fractional bits so low
+ * corner frequencies (e.g. DC removal) settle all the way to zero.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _BIQUAD_H_
+#define _BIQUAD_H_
+
+#include <stdint.h>
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int32_t b0, b1, b2;                   // Q28 numerator coefficients
+	int32_t a1, a2;                       // Q28 denominator coefficients (a0 = 1)
+	int32_t x1, x2;                       // Input history
+	int32_t y1, y2;                       // Output history (Q8)
+} biquad_state_t;
+
+
+
+//
+// API
+//
+void biquad_init_hpf(biquad_state_t* s, int fc, int rate);  // Butterworth high-pass, fc Hz
+void biquad_init_coeffs(biquad_state_t* s, const int32_t* c);  // Precomputed Q28 b0, b1, b2, a1, a2
+void biquad_reset(biquad_state_t* s);
+void biquad_process(biquad_state_t* s, int16_t* buf, int len);  // In place
+
+#endif /* _BIQUAD_H_ */
@@ -0,0 +1,254 @@
+/*
+ * blackbox - utility module holding an incident record that survives a reset in RTC
+ * slow memory: a ring of the latest state transitions and events and a snapshot of the
+ * audio and heap health.  Anything found at boot is dumped to the console.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "blackbox.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_system.h"
+#include "soc/soc_memory_layout.h"
+
+
+//
+// Constants
+//
+
+// Marks a record written by this module (RTC slow memory holds noise after power-on)
+#define BLACKBOX_MAGIC       0x4242584F
+
+// Entry types
+#define BLACKBOX_TYPE_STATE  1
+#define BLACKBOX_TYPE_EVENT  2
+
+
+
+//
+// Typedefs
+//
+
+// Only 32-bit members so every store is a single word write
+typedef struct {
+	uint32_t seq;                         // Append count (from 1), 0 while being written
+	uint32_t msec;
+	uint32_t type_event;                  // Type in the upper 8 bits, event number below
+	const char* tag;
+	uint32_t a;                           // State: from name, Event: name
+	uint32_t b;                           // State: to name, Event: value
+} blackbox_entry_t;
+
+typedef struct {
+	uint32_t magic;
+	uint32_t boot_count;                  // Resets the record has survived
+	uint32_t app_id[2];                   // Start of the writing image's ELF SHA-256
+	uint32_t snap_seq;                    // Odd while the snapshot is being updated
+	blackbox_snapshot_t snap;
+	blackbox_entry_t ring[BLACKBOX_RING_LEN];
+	uint32_t magic_end;
+} blackbox_record_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "blackbox";
+
+static RTC_NOINIT_ATTR blackbox_record_t bb;
+
+// Next append (kept out of RTC memory so the atomic operations are supported)
+static atomic_uint bb_next = 0;
+
+// Set once the previous record has been dumped
+static atomic_bool bb_ready = false;
+
+static const char* reset_reason_name[] = {
+	"unknown", "power-on", "external", "software", "panic", "interrupt watchdog",
+	"task watchdog", "other watchdog", "deep sleep", "brownout", "SDIO"
+};
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _blackboxGetAppId(uint32_t* id);
+static void _blackboxAppend(uint32_t type, int event, const char* tag, uint32_t a, uint32_t b);
+static void _blackboxDump(bool same_app);
+static const char* _blackboxStr(uint32_t p, bool same_app, char* buf);
+
+
+
+//
+// API
+//
+void blackbox_init()
+{
+	esp_reset_reason_t reason = esp_reset_reason();
+	uint32_t app_id[2];
+	bool same_app;
+
+	_blackboxGetAppId(app_id);
+
+	ESP_LOGI(TAG, "Reset reason: %s",
+	         (reason < (sizeof(reset_reason_name) / sizeof(reset_reason_name[0]))) ? reset_reason_name[reason] : "?");
+
+	if ((bb.magic == BLACKBOX_MAGIC) && (bb.magic_end == BLACKBOX_MAGIC)) {
+		same_app = (bb.app_id[0] == app_id[0]) && (bb.app_id[1] == app_id[1]);
+		_blackboxDump(same_app);
+		bb.boot_count++;
+	} else {
+		bb.boot_count = 0;
+	}
+
+	// Start a new record
+	memset(&bb.snap, 0, sizeof(blackbox_snapshot_t));
+	memset(bb.ring, 0, sizeof(bb.ring));
+	bb.app_id[0] = app_id[0];
+	bb.app_id[1] = app_id[1];
+	bb.snap_seq = 0;
+	bb.magic = BLACKBOX_MAGIC;
+	bb.magic_end = BLACKBOX_MAGIC;
+	atomic_store(&bb_next, 0);
+	atomic_store(&bb_ready, true);
+}
+
+
+void blackbox_state(const char* tag, const char* from, const char* to)
+{
+	_blackboxAppend(BLACKBOX_TYPE_STATE, 0, tag, (uint32_t) from, (uint32_t) to);
+}
+
+
+void blackbox_event(const char* tag, const char* name, int event, uint32_t value)
+{
+	_blackboxAppend(BLACKBOX_TYPE_EVENT, event, tag, (uint32_t) name, value);
+}
+
+
+// Single writer (gcore_task)
+void blackbox_set_snapshot(const blackbox_snapshot_t* s)
+{
+	if (!atomic_load(&bb_ready)) return;
+
+	bb.snap_seq++;
+	atomic_thread_fence(memory_order_release);
+	memcpy(&bb.snap, s, sizeof(blackbox_snapshot_t));
+	atomic_thread_fence(memory_order_release);
+	bb.snap_seq++;
+}
+
+
+
+//
+// Internal functions
+//
+static void _blackboxGetAppId(uint32_t* id)
+{
+	const esp_app_desc_t* app_desc = esp_ota_get_app_description();
+
+	memcpy(id, app_desc->app_elf_sha256, 2*sizeof(uint32_t));
+}
+
+
+static void _blackboxAppend(uint32_t type, int event, const char* tag, uint32_t a, uint32_t b)
+{
+	unsigned int n;
+	blackbox_entry_t* e;
+
+	if (!atomic_load(&bb_ready)) return;
+
+	// Claim a slot and invalidate it until it is completely written
+	n = atomic_fetch_add(&bb_next, 1);
+	e = &bb.ring[n % BLACKBOX_RING_LEN];
+	e->seq = 0;
+	atomic_thread_fence(memory_order_release);
+	e->msec = esp_log_timestamp();
+	e->type_event = (type << 24) | ((uint32_t) event & 0x00FFFFFF);
+	e->tag = tag;
+	e->a = a;
+	e->b = b;
+	atomic_thread_fence(memory_order_release);
+	e->seq = n + 1;
+}
+
+
+static void _blackboxDump(bool same_app)
+{
+	int i;
+	uint32_t seq;
+	uint32_t max_seq = 0;
+	char buf[3][16];
+	blackbox_entry_t* e;
+	blackbox_snapshot_t* s = &bb.snap;
+
+	ESP_LOGW(TAG, "Record from the previous boot (%u earlier resets)%s", bb.boot_count,
+	         same_app ? "" : ", written by a different image so strings are shown as addresses");
+
+	if (s->uptime_msec != 0) {
+		ESP_LOGW(TAG, "Snapshot at %u mSec%s", s->uptime_msec, (bb.snap_seq & 1) ? " (partially updated)" : "");
+		ESP_LOGW(TAG, "  Heap: internal free %u, min free %u, largest %u, PSRAM free %u, min free %u",
+		         s->int_free, s->int_min_free, s->int_largest, s->spiram_free, s->spiram_min_free);
+		ESP_LOGW(TAG, "  Stack: %.*s has %u bytes free", BLACKBOX_TASK_NAME_LEN, s->low_stack_task, s->low_stack_free);
+		ESP_LOGW(TAG, "  Audio: deadlines missed %u, max RX gap %u cyc, I2S errors %u",
+		         s->deadline_misses, s->max_rx_gap_cycles, s->i2s_errors);
+		ESP_LOGW(TAG, "  Audio: RX overflows %u, underruns %u, TX overflows %u, underruns %u",
+		         s->rx_overflows, s->rx_underruns, s->tx_overflows, s->tx_underruns);
+		ESP_LOGW(TAG, "  Audio: PLC %u, concealments %u, LEC budget level %d, peak frame load %d%%",
+		         s->plc_events, s->jb_concealments, s->lec_budget_level, s->frame_load_peak_pct);
+	}
+
+	// Entries are printed oldest first by append count
+	for (i=0; i<BLACKBOX_RING_LEN; i++) {
+		if (bb.ring[i].seq > max_seq) max_seq = bb.ring[i].seq;
+	}
+	seq = (max_seq > BLACKBOX_RING_LEN) ? (max_seq - BLACKBOX_RING_LEN + 1) : 1;
+	for (; (max_seq != 0) && (seq <= max_seq); seq++) {
+		e = &bb.ring[(seq - 1) % BLACKBOX_RING_LEN];
+		if (e->seq != seq) continue;    // Being written when the reset happened
+
+		switch (e->type_event >> 24) {
+			case BLACKBOX_TYPE_STATE:
+				ESP_LOGW(TAG, "  [%u] %s: %s->%s", e->msec, _blackboxStr((uint32_t) e->tag, same_app, buf[0]),
+				         _blackboxStr(e->a, same_app, buf[1]), _blackboxStr(e->b, same_app, buf[2]));
+				break;
+
+			case BLACKBOX_TYPE_EVENT:
+				ESP_LOGW(TAG, "  [%u] %s: %s (%u) %u", e->msec, _blackboxStr((uint32_t) e->tag, same_app, buf[0]),
+				         (e->a == 0) ? "event" : _blackboxStr(e->a, same_app, buf[1]),
+				         e->type_event & 0x00FFFFFF, e->b);
+				break;
+		}
+	}
+}
+
+
+// Only strings in the flash of the image that wrote them are safe to print
+static const char* _blackboxStr(uint32_t p, bool same_app, char* buf)
+{
+	if (same_app && esp_ptr_in_drom((const void*) p)) {
+		return (const char*) p;
+	}
+
+	sprintf(buf, "@0x%08x", p);
+	return buf;
+}
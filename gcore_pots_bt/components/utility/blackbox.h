@@ -0,0 +1,79 @@
+/*
+ * blackbox - utility module holding an incident record that survives a reset in RTC
+ * slow memory: a ring of the latest state transitions and events and a snapshot of the
+ * audio and heap health.  Anything found at boot is dumped to the console.
+ *
+ * Appends are lock-free and safe from any task on either core.  Strings are stored by
+ * pointer so they must be literals or other constant data in flash.  They are only
+ * printed when the image that booted matches the one that wrote them.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _BLACKBOX_H_
+#define _BLACKBOX_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+//
+// Constants
+//
+
+// Entries in the ring (24 bytes each)
+#define BLACKBOX_RING_LEN    128
+
+// Lowest stack headroom task name length recorded in the snapshot
+#define BLACKBOX_TASK_NAME_LEN 16
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t uptime_msec;
+	uint32_t int_free;                    // Internal RAM heap (bytes)
+	uint32_t int_min_free;
+	uint32_t int_largest;
+	uint32_t spiram_free;                 // PSRAM heap (bytes)
+	uint32_t spiram_min_free;
+	char low_stack_task[BLACKBOX_TASK_NAME_LEN];  // Task with the least stack headroom
+	uint32_t low_stack_free;
+	uint32_t deadline_misses;             // From audio_stats_t
+	uint32_t max_rx_gap_cycles;
+	uint32_t rx_overflows;
+	uint32_t rx_underruns;
+	uint32_t tx_overflows;
+	uint32_t tx_underruns;
+	uint32_t i2s_errors;                  // RX overflows + TX underflows + DMA errors
+	uint32_t plc_events;
+	uint32_t jb_concealments;
+	int32_t lec_budget_level;
+	int32_t frame_load_peak_pct;
+} blackbox_snapshot_t;
+
+
+
+//
+// API
+//
+void blackbox_init();                  // Dumps the previous boot's record then starts a new one
+void blackbox_state(const char* tag, const char* from, const char* to);
+void blackbox_event(const char* tag, const char* name, int event, uint32_t value);  // name may be NULL
+void blackbox_set_snapshot(const blackbox_snapshot_t* s);
+
+#endif /* _BLACKBOX_H_ */
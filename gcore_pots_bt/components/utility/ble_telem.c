@@ -0,0 +1,586 @@
+/*
+ * ble_telem - utility module offering a BLE GATT service with the system statistics, call
+ * log and settings.  See ble_telem.h.
+ *
+ * The GATT and GAP callbacks run in the Bluedroid task.  Reads are answered there from a
+ * fresh copy of the value made when the first part is read (so a long read sees one
+ * consistent value) and a low priority task sends the notifications.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "ble_telem.h"
+#include <string.h>
+#include "bt_task.h"
+#include "esp_heap_caps.h"
+#include "esp_timer.h"
+#include "sdkconfig.h"
+#include "sys_status.h"
+#if (CONFIG_BLE_TELEM_ENABLE == true)
+#include <stdatomic.h>
+#include "call_log.h"
+#include "esp_bt_defs.h"
+#include "esp_gap_ble_api.h"
+#include "esp_gatt_common_api.h"
+#include "esp_gatts_api.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ps.h"
+
+#if !defined(CONFIG_BTDM_CTRL_MODE_BTDM) || !defined(CONFIG_BT_BLE_ENABLED) || !defined(CONFIG_BT_GATTS_ENABLE)
+#error "BLE_TELEM_ENABLE needs the dual mode controller with Bluedroid BLE and GATT server support"
+#endif
+
+
+
+//
+// Constants
+//
+
+// Notification task
+#define BLE_TELEM_TASK_STACK   3072
+#define BLE_TELEM_TASK_PRIO    1
+
+#define BLE_TELEM_APP_ID       0x57
+
+// Attribute table
+#define IDX_SVC                0
+#define IDX_STATS_CHAR         1
+#define IDX_STATS_VAL          2
+#define IDX_STATS_CCC          3
+#define IDX_SETTINGS_CHAR      4
+#define IDX_SETTINGS_VAL       5
+#define IDX_SETTINGS_CCC       6
+#define IDX_LOG_CHAR           7
+#define IDX_LOG_VAL            8
+#define IDX_LOG_CCC            9
+
+#define IDX_NUM                10
+
+// Notified values (ble_telem_notify bits)
+#define NOTIFY_STATS           0x01
+#define NOTIFY_SETTINGS        0x02
+#define NOTIFY_LOG             0x04
+
+// Largest value
+#define BLE_TELEM_MAX_VAL_LEN  96
+
+// Interval units
+#define CONN_INT(msec)         ((msec) * 4 / 5)          /* 1.25 mSec */
+#define ADV_INT(msec)          ((msec) * 8 / 5)          /* 0.625 mSec */
+
+
+
+//
+// Variables
+//
+static const char* TAG = "ble_telem";
+
+// UUIDs (little endian)
+#define BLE_TELEM_UUID128(n) { \
+	0x10, 0x9f, 0x3d, 0x7a, 0x2c, 0xeb, 0x57, 0x65, 0x65, 0x42, 0x6c, 0x6c, \
+	(n) & 0xFF, (n) >> 8, 0x45, 0x57 }
+
+static uint8_t svc_uuid[ESP_UUID_LEN_128] = BLE_TELEM_UUID128(BLE_TELEM_UUID_SERVICE);
+static const uint8_t stats_uuid[ESP_UUID_LEN_128] = BLE_TELEM_UUID128(BLE_TELEM_UUID_STATS);
+static const uint8_t settings_uuid[ESP_UUID_LEN_128] = BLE_TELEM_UUID128(BLE_TELEM_UUID_SETTINGS);
+static const uint8_t log_uuid[ESP_UUID_LEN_128] = BLE_TELEM_UUID128(BLE_TELEM_UUID_CALL_LOG);
+
+static const uint16_t primary_service_uuid = ESP_GATT_UUID_PRI_SERVICE;
+static const uint16_t char_decl_uuid = ESP_GATT_UUID_CHAR_DECLARE;
+static const uint16_t char_ccc_uuid = ESP_GATT_UUID_CHAR_CLIENT_CONFIG;
+static const uint8_t prop_read_notify = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+static const uint8_t prop_rw_notify = ESP_GATT_CHAR_PROP_BIT_READ | ESP_GATT_CHAR_PROP_BIT_WRITE |
+                                      ESP_GATT_CHAR_PROP_BIT_NOTIFY;
+static uint8_t ccc_stats[2];
+static uint8_t ccc_settings[2];
+static uint8_t ccc_log[2];
+
+// Values are read by the application (ESP_GATT_RSP_BY_APP), the client configuration
+// descriptors are handled by the stack
+static const esp_gatts_attr_db_t ble_telem_db[IDX_NUM] = {
+	[IDX_SVC] = {{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t*) &primary_service_uuid, ESP_GATT_PERM_READ,
+	             ESP_UUID_LEN_128, ESP_UUID_LEN_128, svc_uuid}},
+
+	[IDX_STATS_CHAR] = {{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t*) &char_decl_uuid, ESP_GATT_PERM_READ,
+	                    1, 1, (uint8_t*) &prop_read_notify}},
+	[IDX_STATS_VAL] = {{ESP_GATT_RSP_BY_APP}, {ESP_UUID_LEN_128, (uint8_t*) stats_uuid, ESP_GATT_PERM_READ,
+	                   sizeof(ble_telem_stats_t), 0, NULL}},
+	[IDX_STATS_CCC] = {{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t*) &char_ccc_uuid,
+	                   ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE, 2, 2, ccc_stats}},
+
+	[IDX_SETTINGS_CHAR] = {{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t*) &char_decl_uuid, ESP_GATT_PERM_READ,
+	                       1, 1, (uint8_t*) &prop_read_notify}},
+	[IDX_SETTINGS_VAL] = {{ESP_GATT_RSP_BY_APP}, {ESP_UUID_LEN_128, (uint8_t*) settings_uuid, ESP_GATT_PERM_READ,
+	                      sizeof(ble_telem_settings_t), 0, NULL}},
+	[IDX_SETTINGS_CCC] = {{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t*) &char_ccc_uuid,
+	                      ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE, 2, 2, ccc_settings}},
+
+	[IDX_LOG_CHAR] = {{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t*) &char_decl_uuid, ESP_GATT_PERM_READ,
+	                  1, 1, (uint8_t*) &prop_rw_notify}},
+	[IDX_LOG_VAL] = {{ESP_GATT_RSP_BY_APP}, {ESP_UUID_LEN_128, (uint8_t*) log_uuid, ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE,
+	                 sizeof(call_log_rec_t), 0, NULL}},
+	[IDX_LOG_CCC] = {{ESP_GATT_AUTO_RSP}, {ESP_UUID_LEN_16, (uint8_t*) &char_ccc_uuid,
+	                 ESP_GATT_PERM_READ | ESP_GATT_PERM_WRITE, 2, 2, ccc_log}}
+};
+
+static esp_ble_adv_data_t adv_data = {
+	.set_scan_rsp = false,
+	.include_name = false,
+	.include_txpower = false,
+	.service_uuid_len = ESP_UUID_LEN_128,
+	.p_service_uuid = svc_uuid,
+	.flag = ESP_BLE_ADV_FLAG_GEN_DISC
+};
+
+static esp_ble_adv_data_t scan_rsp_data = {
+	.set_scan_rsp = true,
+	.include_name = true,
+	.include_txpower = false
+};
+
+static esp_ble_adv_params_t adv_params = {
+	.adv_int_min = ADV_INT(BLE_TELEM_ADV_MIN_MSEC),
+	.adv_int_max = ADV_INT(BLE_TELEM_ADV_MAX_MSEC),
+	.adv_type = ADV_TYPE_IND,
+	.own_addr_type = BLE_ADDR_TYPE_PUBLIC,
+	.channel_map = ADV_CHNL_ALL,
+	.adv_filter_policy = ADV_FILTER_ALLOW_SCAN_ANY_CON_ANY
+};
+
+// Connection state (set in the Bluedroid task)
+static esp_gatt_if_t ble_telem_if = ESP_GATT_IF_NONE;
+static uint16_t ble_telem_handles[IDX_NUM];
+static uint16_t ble_telem_conn_id;
+static esp_bd_addr_t ble_telem_peer;
+static atomic_int ble_telem_mtu = ATOMIC_VAR_INIT(ESP_GATT_DEF_BLE_MTU_SIZE);
+static atomic_int ble_telem_notify = ATOMIC_VAR_INIT(0);
+static atomic_bool ble_telem_connected = ATOMIC_VAR_INIT(false);
+static atomic_bool ble_telem_quiet = ATOMIC_VAR_INIT(false);
+// Task storage
+static StackType_t ble_telem_task_stack[BLE_TELEM_TASK_STACK];
+static StaticTask_t ble_telem_task_tcb;
+
+static int ble_telem_adv_pending = 2;            // Advertising and scan response data being set
+static uint16_t ble_telem_log_index = 0;         // Call log record read (0 = newest)
+
+// Value being read (Bluedroid task)
+static uint8_t ble_telem_read_buf[BLE_TELEM_MAX_VAL_LEN] __attribute__((aligned(4)));
+static uint16_t ble_telem_read_len;
+
+_Static_assert(sizeof(ble_telem_stats_t) <= BLE_TELEM_MAX_VAL_LEN, "ble_telem_stats_t too long");
+_Static_assert(sizeof(ble_telem_settings_t) <= BLE_TELEM_MAX_VAL_LEN, "ble_telem_settings_t too long");
+_Static_assert(sizeof(call_log_rec_t) <= BLE_TELEM_MAX_VAL_LEN, "call_log_rec_t too long");
+_Static_assert(BLE_TELEM_MAX_VAL_LEN <= (BLE_TELEM_MTU - 3), "values must fit one notification");
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _ble_telem_task(void* args);
+static void _ble_telem_gap_cb(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+static void _ble_telem_gatts_cb(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t* param);
+static void _ble_telem_read(esp_gatt_if_t gatts_if, struct gatts_read_evt_param* p);
+static void _ble_telem_write(esp_gatt_if_t gatts_if, struct gatts_write_evt_param* p);
+static void _ble_telem_start_adv();
+static void _ble_telem_set_interval(bool call);
+static void _ble_telem_notify_val(int idx, const void* val, int len);
+static void _ble_telem_get_settings(ble_telem_settings_t* s);
+static bool _ble_telem_get_log(int n, call_log_rec_t* r);
+
+
+
+//
+// API
+//
+void ble_telem_init()
+{
+	esp_err_t ret;
+	
+	if ((ret = esp_ble_gap_register_callback(_ble_telem_gap_cb)) != ESP_OK) {
+		ESP_LOGE(TAG, "register GAP callback failed (%s)", esp_err_to_name(ret));
+		return;
+	}
+	if ((ret = esp_ble_gatts_register_callback(_ble_telem_gatts_cb)) != ESP_OK) {
+		ESP_LOGE(TAG, "register GATTS callback failed (%s)", esp_err_to_name(ret));
+		return;
+	}
+	if ((ret = esp_ble_gatt_set_local_mtu(BLE_TELEM_MTU)) != ESP_OK) {
+		ESP_LOGE(TAG, "set local MTU failed (%s)", esp_err_to_name(ret));
+	}
+	
+	// The service is created once the application is registered
+	if ((ret = esp_ble_gatts_app_register(BLE_TELEM_APP_ID)) != ESP_OK) {
+		ESP_LOGE(TAG, "register application failed (%s)", esp_err_to_name(ret));
+		return;
+	}
+	
+	xTaskCreateStaticPinnedToCore(&_ble_telem_task, "ble_telem_task", BLE_TELEM_TASK_STACK, NULL, BLE_TELEM_TASK_PRIO, ble_telem_task_stack, &ble_telem_task_tcb, 0);
+}
+
+
+void ble_telem_set_quiet(bool en)
+{
+	if (atomic_exchange(&ble_telem_quiet, en) == en) return;
+	
+	if (atomic_load(&ble_telem_connected)) {
+		_ble_telem_set_interval(en);
+	} else if (en) {
+		(void) esp_ble_gap_stop_advertising();
+	} else {
+		_ble_telem_start_adv();
+	}
+}
+
+
+
+//
+// Internal functions
+//
+static void _ble_telem_task(void* args)
+{
+	ble_telem_stats_t stats;
+	ble_telem_settings_t settings;
+	ble_telem_settings_t prev_settings;
+	call_log_rec_t rec;
+	uint32_t prev_seq = 0;
+	bool was_connected = false;
+	int notify;
+	
+	ESP_LOGI(TAG, "Start task");
+	
+	while (1) {
+		vTaskDelay(pdMS_TO_TICKS(BLE_TELEM_NOTIFY_MSEC));
+		
+		// A new client gets the current settings and newest call when it subscribes
+		if (!atomic_load(&ble_telem_connected)) {
+			was_connected = false;
+			continue;
+		}
+		if (!was_connected) {
+			memset(&prev_settings, 0, sizeof(prev_settings));
+			prev_seq = 0;
+			was_connected = true;
+		}
+		
+		// Nothing is sent while the voice link needs the air
+		notify = atomic_load(&ble_telem_notify);
+		if (atomic_load(&ble_telem_quiet) || (notify == 0)) continue;
+		
+		if ((notify & NOTIFY_STATS) != 0) {
+			ble_telem_get_stats(&stats);
+			_ble_telem_notify_val(IDX_STATS_VAL, &stats, sizeof(stats));
+		}
+		
+		if ((notify & NOTIFY_SETTINGS) != 0) {
+			_ble_telem_get_settings(&settings);
+			if (memcmp(&settings, &prev_settings, sizeof(settings)) != 0) {
+				_ble_telem_notify_val(IDX_SETTINGS_VAL, &settings, sizeof(settings));
+				prev_settings = settings;
+			}
+		}
+		
+		if ((notify & NOTIFY_LOG) != 0) {
+			if (_ble_telem_get_log(0, &rec) && (rec.seq != prev_seq)) {
+				_ble_telem_notify_val(IDX_LOG_VAL, &rec, sizeof(rec));
+				prev_seq = rec.seq;
+			}
+		}
+	}
+}
+
+
+static void _ble_telem_gap_cb(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param)
+{
+	switch (event) {
+		case ESP_GAP_BLE_ADV_DATA_SET_COMPLETE_EVT:
+		case ESP_GAP_BLE_SCAN_RSP_DATA_SET_COMPLETE_EVT:
+			if (--ble_telem_adv_pending == 0) {
+				if (!atomic_load(&ble_telem_quiet) && !atomic_load(&ble_telem_connected)) {
+					_ble_telem_start_adv();
+				}
+			}
+			break;
+		
+		case ESP_GAP_BLE_ADV_START_COMPLETE_EVT:
+			if (param->adv_start_cmpl.status != ESP_BT_STATUS_SUCCESS) {
+				ESP_LOGE(TAG, "Advertising start failed (%d)", param->adv_start_cmpl.status);
+			}
+			break;
+		
+		case ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT:
+			ESP_LOGI(TAG, "Connection interval %d mSec", param->update_conn_params.conn_int * 5 / 4);
+			break;
+		
+		default:
+			break;
+	}
+}
+
+
+static void _ble_telem_gatts_cb(esp_gatts_cb_event_t event, esp_gatt_if_t gatts_if, esp_ble_gatts_cb_param_t* param)
+{
+	switch (event) {
+		case ESP_GATTS_REG_EVT:
+			if (param->reg.status != ESP_GATT_OK) {
+				ESP_LOGE(TAG, "Application register failed (%d)", param->reg.status);
+				break;
+			}
+			ble_telem_if = gatts_if;
+			(void) esp_ble_gap_config_adv_data(&adv_data);
+			(void) esp_ble_gap_config_adv_data(&scan_rsp_data);
+			(void) esp_ble_gatts_create_attr_tab(ble_telem_db, gatts_if, IDX_NUM, 0);
+			break;
+		
+		case ESP_GATTS_CREAT_ATTR_TAB_EVT:
+			if ((param->add_attr_tab.status != ESP_GATT_OK) || (param->add_attr_tab.num_handle != IDX_NUM)) {
+				ESP_LOGE(TAG, "Create attribute table failed (%d)", param->add_attr_tab.status);
+				break;
+			}
+			memcpy(ble_telem_handles, param->add_attr_tab.handles, sizeof(ble_telem_handles));
+			(void) esp_ble_gatts_start_service(ble_telem_handles[IDX_SVC]);
+			break;
+		
+		case ESP_GATTS_CONNECT_EVT:
+			ESP_LOGI(TAG, "Client connected");
+			ble_telem_conn_id = param->connect.conn_id;
+			memcpy(ble_telem_peer, param->connect.remote_bda, sizeof(esp_bd_addr_t));
+			ble_telem_log_index = 0;
+			atomic_store(&ble_telem_notify, 0);
+			atomic_store(&ble_telem_mtu, ESP_GATT_DEF_BLE_MTU_SIZE);
+			atomic_store(&ble_telem_connected, true);
+			_ble_telem_set_interval(atomic_load(&ble_telem_quiet));
+			break;
+		
+		case ESP_GATTS_DISCONNECT_EVT:
+			ESP_LOGI(TAG, "Client disconnected (0x%x)", param->disconnect.reason);
+			atomic_store(&ble_telem_connected, false);
+			atomic_store(&ble_telem_notify, 0);
+			if (!atomic_load(&ble_telem_quiet)) {
+				_ble_telem_start_adv();
+			}
+			break;
+		
+		case ESP_GATTS_MTU_EVT:
+			atomic_store(&ble_telem_mtu, param->mtu.mtu);
+			break;
+		
+		case ESP_GATTS_READ_EVT:
+			_ble_telem_read(gatts_if, &param->read);
+			break;
+		
+		case ESP_GATTS_WRITE_EVT:
+			_ble_telem_write(gatts_if, &param->write);
+			break;
+		
+		default:
+			break;
+	}
+}
+
+
+static void _ble_telem_read(esp_gatt_if_t gatts_if, struct gatts_read_evt_param* p)
+{
+	static esp_gatt_rsp_t rsp;
+	int len;
+	
+	// Take a new copy of the value when the read starts
+	if (p->offset == 0) {
+		if (p->handle == ble_telem_handles[IDX_STATS_VAL]) {
+			ble_telem_get_stats((ble_telem_stats_t*) ble_telem_read_buf);
+			ble_telem_read_len = sizeof(ble_telem_stats_t);
+		} else if (p->handle == ble_telem_handles[IDX_SETTINGS_VAL]) {
+			_ble_telem_get_settings((ble_telem_settings_t*) ble_telem_read_buf);
+			ble_telem_read_len = sizeof(ble_telem_settings_t);
+		} else if (p->handle == ble_telem_handles[IDX_LOG_VAL]) {
+			if (_ble_telem_get_log(ble_telem_log_index, (call_log_rec_t*) ble_telem_read_buf)) {
+				ble_telem_read_len = sizeof(call_log_rec_t);
+			} else {
+				ble_telem_read_len = 0;
+			}
+		} else {
+			ble_telem_read_len = 0;
+		}
+	}
+	
+	if (!p->need_rsp) return;
+	
+	memset(&rsp, 0, sizeof(rsp));
+	rsp.attr_value.handle = p->handle;
+	rsp.attr_value.offset = p->offset;
+	if (p->offset < ble_telem_read_len) {
+		len = ble_telem_read_len - p->offset;
+		if (len > (atomic_load(&ble_telem_mtu) - 1)) len = atomic_load(&ble_telem_mtu) - 1;
+		memcpy(rsp.attr_value.value, &ble_telem_read_buf[p->offset], len);
+		rsp.attr_value.len = len;
+	}
+	(void) esp_ble_gatts_send_response(gatts_if, p->conn_id, p->trans_id, ESP_GATT_OK, &rsp);
+}
+
+
+static void _ble_telem_write(esp_gatt_if_t gatts_if, struct gatts_write_evt_param* p)
+{
+	esp_gatt_status_t status = ESP_GATT_OK;
+	int bit = 0;
+	
+	// Client configuration descriptors (the stack has already responded)
+	if (p->handle == ble_telem_handles[IDX_STATS_CCC]) {
+		bit = NOTIFY_STATS;
+	} else if (p->handle == ble_telem_handles[IDX_SETTINGS_CCC]) {
+		bit = NOTIFY_SETTINGS;
+	} else if (p->handle == ble_telem_handles[IDX_LOG_CCC]) {
+		bit = NOTIFY_LOG;
+	}
+	if (bit != 0) {
+		if ((p->len == 2) && ((p->value[0] & 0x01) != 0)) {
+			atomic_fetch_or(&ble_telem_notify, bit);
+		} else {
+			atomic_fetch_and(&ble_telem_notify, ~bit);
+		}
+		return;
+	}
+	
+	// Call log record selection
+	if (p->handle == ble_telem_handles[IDX_LOG_VAL]) {
+		if (p->is_prep || (p->offset != 0) || (p->len != 2)) {
+			status = ESP_GATT_INVALID_ATTR_LEN;
+		} else {
+			ble_telem_log_index = p->value[0] | (p->value[1] << 8);
+		}
+	} else {
+		status = ESP_GATT_WRITE_NOT_PERMIT;
+	}
+	
+	if (p->need_rsp) {
+		(void) esp_ble_gatts_send_response(gatts_if, p->conn_id, p->trans_id, status, NULL);
+	}
+}
+
+
+static void _ble_telem_start_adv()
+{
+	if (ble_telem_adv_pending == 0) {
+		(void) esp_ble_gap_start_advertising(&adv_params);
+	}
+}
+
+
+// Long intervals leave the controller's time to the hands-free link (the client may choose
+// something else within the range it supports)
+static void _ble_telem_set_interval(bool call)
+{
+	esp_ble_conn_update_params_t params;
+	
+	memcpy(params.bda, ble_telem_peer, sizeof(esp_bd_addr_t));
+	params.min_int = CONN_INT(call ? BLE_TELEM_CALL_MIN_MSEC : BLE_TELEM_CONN_MIN_MSEC);
+	params.max_int = CONN_INT(call ? BLE_TELEM_CALL_MAX_MSEC : BLE_TELEM_CONN_MAX_MSEC);
+	params.latency = 0;
+	params.timeout = BLE_TELEM_SUP_TIMEOUT_MSEC / 10;
+	(void) esp_ble_gap_update_conn_params(&params);
+}
+
+
+static void _ble_telem_notify_val(int idx, const void* val, int len)
+{
+	// Clients that didn't negotiate a large enough MTU can still read the value
+	if (len > (atomic_load(&ble_telem_mtu) - 3)) return;
+	
+	(void) esp_ble_gatts_send_indicate(ble_telem_if, ble_telem_conn_id, ble_telem_handles[idx],
+	                                   len, (uint8_t*) val, false);
+}
+
+
+static void _ble_telem_get_settings(ble_telem_settings_t* s)
+{
+	uint8_t br;
+	bool auto_dim;
+	
+	ps_get_brightness_info(&br, &auto_dim);
+	
+	memset(s, 0, sizeof(ble_telem_settings_t));
+	s->version = BLE_TELEM_FORMAT_VERSION;
+	s->country_code = ps_get_country_code();
+	s->mic_gain_db10 = (int16_t) (ps_get_gain(PS_GAIN_MIC) * 10.0f);
+	s->spk_gain_db10 = (int16_t) (ps_get_gain(PS_GAIN_SPK) * 10.0f);
+	s->brightness = br;
+	s->auto_dim = auto_dim ? 1 : 0;
+	s->lec_tail_msec = ps_get_lec_tail_msec();
+	s->lec_hpf = ps_get_lec_hpf();
+	s->ns_level = ps_get_ns_level();
+	s->eq_profile = ps_get_eq_profile();
+	s->codec_dsp = ps_get_codec_dsp();
+	s->paired = ps_get_bt_is_paired() ? 1 : 0;
+}
+
+
+static bool _ble_telem_get_log(int n, call_log_rec_t* r)
+{
+#if (CONFIG_CALL_LOG_ENABLE == true)
+	return call_log_get(n, r);
+#else
+	return false;
+#endif
+}
+
+#endif /* CONFIG_BLE_TELEM_ENABLE */
+
+
+
+//
+// Stats snapshot (also uploaded by wifi_up)
+//
+void ble_telem_get_stats(ble_telem_stats_t* s)
+{
+	bt_at_stats_t ats;
+	bt_reconnect_stats_t rs;
+	sys_status_power_t ps;
+	sys_status_link_t ls;             // Link and audio counters as of bt_task's last sample
+	int i;
+	
+	bt_get_at_stats(&ats);
+	bt_get_reconnect_stats(&rs);
+	sys_status_get_power(&ps);
+	sys_status_get_link(&ls);
+	
+	memset(s, 0, sizeof(ble_telem_stats_t));
+	s->version = BLE_TELEM_FORMAT_VERSION;
+	s->app_state = (uint8_t) sys_status_get_app_state();
+	s->batt_state = (uint8_t) ps.batt_state;
+	s->charge_state = (uint8_t) ps.charge_state;
+	s->uptime_sec = (uint32_t) (esp_timer_get_time() / 1000000);
+	s->bt_quality = (uint8_t) ls.quality;
+	s->bt_rssi_delta = (int8_t) ls.rssi_delta;
+	s->bt_audio = !ls.audio_connected ? 0 : (ls.msbc ? 2 : 1);
+	s->bt_profile = (uint8_t) ls.profile;
+	s->bt_missed_packets = ls.missed_packets;
+	s->bt_jitter_usec = ls.jitter_usec;
+	s->bt_disconnects = rs.disconnects;
+	s->bt_reconnects = rs.reconnects;
+	for (i=0; i<BT_AT_NUM_CMDS; i++) {
+		s->bt_at_sent += ats.cmd[i].sent;
+		s->bt_at_errors += ats.cmd[i].errors;
+		s->bt_at_timeouts += ats.cmd[i].timeouts;
+	}
+	s->deadline_misses = ls.deadline_misses;
+	s->rx_underruns = ls.rx_underruns;
+	s->tx_underruns = ls.tx_underruns;
+	s->plc_events = ls.plc_events;
+	s->jb_concealments = ls.jb_concealments;
+	s->int_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+	s->int_min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+	s->spiram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+}
@@ -0,0 +1,132 @@
+/*
+ * ble_telem - utility module offering a BLE GATT service next to the hands-free connection
+ * so a unit's health can be checked from a phone without plugging in USB.  The controller
+ * runs in dual mode and bt_task starts the service once Bluedroid is up.
+ *
+ * The service has three characteristics, each readable and with notifications:
+ *   stats     ble_telem_stats_t, notified every BLE_TELEM_NOTIFY_MSEC
+ *   settings  ble_telem_settings_t, notified when one changes
+ *   call log  call_log_rec_t selected by writing its 16-bit index (0 for the newest, the
+ *             default) and empty if there is no such record.  The newest is notified after
+ *             each call.
+ * Values are little endian.  The service is read-only since the LE link is not authenticated.
+ *
+ * To stay out of the way of the voice link the connection interval is long and the MTU is
+ * large enough that each value goes in one packet.  While a SCO connection is open the
+ * notifications stop, advertising stops and a connected client is asked for an even
+ * longer interval.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _BLE_TELEM_H_
+#define _BLE_TELEM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Value format version (first byte of the stats and settings values, incremented if the
+// meaning of an existing field changes)
+#define BLE_TELEM_FORMAT_VERSION     1
+
+// 128-bit UUIDs 5745xxxx-6c6c-4265-6557-eb2c7a3d9f10 with xxxx from below
+#define BLE_TELEM_UUID_SERVICE       0x0001
+#define BLE_TELEM_UUID_STATS         0x0002
+#define BLE_TELEM_UUID_SETTINGS      0x0003
+#define BLE_TELEM_UUID_CALL_LOG      0x0004
+
+// Local MTU offered (each value fits one notification)
+#define BLE_TELEM_MTU                128
+
+// Connection interval requested normally and while a SCO connection is open
+#define BLE_TELEM_CONN_MIN_MSEC      100
+#define BLE_TELEM_CONN_MAX_MSEC      150
+#define BLE_TELEM_CALL_MIN_MSEC      400
+#define BLE_TELEM_CALL_MAX_MSEC      500
+#define BLE_TELEM_SUP_TIMEOUT_MSEC   4000
+
+// Advertising interval
+#define BLE_TELEM_ADV_MIN_MSEC       1000
+#define BLE_TELEM_ADV_MAX_MSEC       1280
+
+// Stats notification interval
+#define BLE_TELEM_NOTIFY_MSEC        2000
+
+
+
+//
+// Typedefs
+//
+typedef struct __attribute__((packed)) {
+	uint8_t version;                      // BLE_TELEM_FORMAT_VERSION
+	uint8_t app_state;                    // app_state_t
+	uint8_t batt_state;                   // enum BATT_STATE_t
+	uint8_t charge_state;                 // enum CHARGE_STATE_t
+	uint32_t uptime_sec;
+	uint8_t bt_quality;                   // BT_LINK_QUALITY_*
+	int8_t bt_rssi_delta;
+	uint8_t bt_audio;                     // 0: none, 1: CVSD, 2: mSBC
+	uint8_t bt_profile;                   // BT_LINK_PROFILE_*
+	uint32_t bt_missed_packets;           // Current (or last) audio connection
+	uint32_t bt_jitter_usec;
+	uint32_t bt_disconnects;
+	uint32_t bt_reconnects;
+	uint32_t bt_at_sent;                  // All AT commands
+	uint32_t bt_at_errors;
+	uint32_t bt_at_timeouts;
+	uint32_t deadline_misses;             // audio_stats_t since boot
+	uint32_t rx_underruns;
+	uint32_t tx_underruns;
+	uint32_t plc_events;
+	uint32_t jb_concealments;
+	uint32_t int_free;                    // Internal RAM heap (bytes)
+	uint32_t int_min_free;
+	uint32_t spiram_free;
+} ble_telem_stats_t;
+
+typedef struct __attribute__((packed)) {
+	uint8_t version;                      // BLE_TELEM_FORMAT_VERSION
+	uint8_t country_code;
+	int16_t mic_gain_db10;                // Tenths of a dB
+	int16_t spk_gain_db10;
+	uint8_t brightness;
+	uint8_t auto_dim;
+	uint8_t lec_tail_msec;                // PS_LEC_TAIL_COUNTRY_DEFAULT or mSec
+	uint8_t lec_hpf;                      // PS_LEC_HPF_* bits
+	uint8_t ns_level;                     // PS_NS_LEVEL_*
+	uint8_t eq_profile;                   // PS_EQ_PROFILE_*
+	uint8_t codec_dsp;                    // PS_CODEC_DSP_*
+	uint8_t paired;
+} ble_telem_settings_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_BLE_TELEM_ENABLE == true)
+void ble_telem_init();                    // Call from bt_task after Bluedroid is enabled
+void ble_telem_set_quiet(bool en);        // True while a SCO connection is open
+#endif
+void ble_telem_get_stats(ble_telem_stats_t* s);  // Available without the service (wifi_up uploads it)
+
+#endif /* _BLE_TELEM_H_ */
@@ -0,0 +1,131 @@
+/*
+ * boot_prof - utility module timestamping the boot phases of each task and tracking
+ * the readiness of each subsystem so tasks can wait on just what they depend on.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "boot_prof.h"
+#include <stdatomic.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const char* phase;
+	const char* task;
+	int64_t usec;                         // Since boot
+} boot_prof_mark_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "boot_prof";
+
+static EventGroupHandle_t ready_group = NULL;
+static StaticEventGroup_t ready_group_buf;
+
+static boot_prof_mark_t marks[BOOT_PROF_MAX_MARKS];
+static atomic_int num_marks = 0;
+static atomic_bool reported = false;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _bootProfPrint();
+
+
+
+//
+// API
+//
+bool boot_prof_init()
+{
+	ready_group = xEventGroupCreateStatic(&ready_group_buf);
+	boot_prof_mark("app_main");
+
+	return (ready_group != NULL);
+}
+
+
+void boot_prof_mark(const char* phase)
+{
+	int n = atomic_fetch_add(&num_marks, 1);
+
+	if (n < BOOT_PROF_MAX_MARKS) {
+		marks[n].usec = esp_timer_get_time();
+		marks[n].phase = phase;
+		atomic_thread_fence(memory_order_release);
+		marks[n].task = pcTaskGetName(NULL);
+	}
+}
+
+
+void boot_prof_set_ready(uint32_t bits, const char* phase)
+{
+	EventBits_t all;
+
+	boot_prof_mark(phase);
+	if (ready_group == NULL) return;
+
+	// The task completing the set logs the timeline
+	all = xEventGroupSetBits(ready_group, (EventBits_t) bits);
+	if (((all & BOOT_READY_ALL) == BOOT_READY_ALL) && !atomic_exchange(&reported, true)) {
+		_bootProfPrint();
+	}
+}
+
+
+bool boot_prof_wait_ready(uint32_t bits, TickType_t wait_ticks)
+{
+	EventBits_t b;
+
+	if (ready_group == NULL) return false;
+
+	b = xEventGroupWaitBits(ready_group, (EventBits_t) bits, pdFALSE, pdTRUE, wait_ticks);
+	return ((b & bits) == bits);
+}
+
+
+
+//
+// Internal functions
+//
+static void _bootProfPrint()
+{
+	int i;
+	int n = atomic_load(&num_marks);
+	int64_t t = esp_timer_get_time();
+
+	ESP_LOGI(TAG, "Ready at %d mSec", (int) (t / 1000));
+	if (n > BOOT_PROF_MAX_MARKS) {
+		ESP_LOGW(TAG, "%d phases not recorded", n - BOOT_PROF_MAX_MARKS);
+		n = BOOT_PROF_MAX_MARKS;
+	}
+	for (i=0; i<n; i++) {
+		if (marks[i].task == NULL) continue;  // Still being recorded
+		ESP_LOGI(TAG, "  %5d.%01d mSec  %-12s %s", (int) (marks[i].usec / 1000), (int) ((marks[i].usec / 100) % 10),
+		         marks[i].task, marks[i].phase);
+	}
+}
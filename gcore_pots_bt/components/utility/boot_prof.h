@@ -0,0 +1,55 @@
+/*
+ * boot_prof - utility module timestamping the boot phases of each task and tracking
+ * the readiness of each subsystem so tasks can wait on just what they depend on.  The
+ * phase timeline is logged once everything is ready.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _BOOT_PROF_H_
+#define _BOOT_PROF_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+
+//
+// Constants
+//
+
+// Maximum recorded phases
+#define BOOT_PROF_MAX_MARKS  24
+
+// Readiness bits
+#define BOOT_READY_PS        0x01     // Persistent storage loaded
+#define BOOT_READY_AUDIO     0x02     // Codec, I2S and the echo canceller initialized
+#define BOOT_READY_BT        0x04     // Bluetooth stack running
+#define BOOT_READY_GUI       0x08     // Main screen displayed
+#define BOOT_READY_POTS      0x10     // Line interface, tones and caller ID initialized
+#define BOOT_READY_POWER     0x20     // Power monitoring running
+#define BOOT_READY_ALL       0x3F
+
+
+
+//
+// API
+//
+bool boot_prof_init();
+void boot_prof_mark(const char* phase);                   // phase must be a constant string
+void boot_prof_set_ready(uint32_t bits, const char* phase);  // Marks phase too
+bool boot_prof_wait_ready(uint32_t bits, TickType_t wait_ticks);  // True if all bits are set
+
+#endif /* _BOOT_PROF_H_ */
@@ -0,0 +1,324 @@
+/*
+ * call_log - utility module keeping a history of calls on the Micro-SD Card for customer
+ * support and for tracking audio performance over time.
+ *
+ * The file is a header followed by CALL_LOG_MAX_RECORDS fixed-size slots.  A record's slot
+ * is its sequence number modulo the number of slots so appending never rewrites the header
+ * or moves other records, and the newest record is found at boot as the one with the highest
+ * sequence number.  Each record carries a CRC so one torn by a reset is ignored.
+ *
+ * The log is mirrored in PSRAM.  Appends update the mirror and wake a low priority writer
+ * task that mounts the card just long enough to write the new records (like the phonebook
+ * loader it leaves the card free for audio sampling).  If there is no card at boot the log
+ * is only kept in PSRAM until the next reset.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "call_log.h"
+#if (CONFIG_CALL_LOG_ENABLE == true)
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "sd_card.h"
+#include "spandsp.h"
+
+
+//
+// Constants
+//
+// Writer task
+#define CALL_LOG_TASK_STACK    3072
+#define CALL_LOG_TASK_PRIO     1
+
+// Mount attempts at boot (the card may still be powering up)
+#define CALL_LOG_MOUNT_TRIES   5
+#define CALL_LOG_RETRY_MSEC    2000
+
+// File header
+#define CALL_LOG_MAGIC         0x474F4C43   /* "CLOG" */
+#define CALL_LOG_VERSION       1
+#define CALL_LOG_HDR_LEN       16
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t rec_len;
+	uint32_t max_records;
+	uint32_t reserved;
+} call_log_hdr_t;
+
+_Static_assert(sizeof(call_log_rec_t) == 64, "call_log_rec_t must stay 64 bytes");
+_Static_assert(sizeof(call_log_hdr_t) == CALL_LOG_HDR_LEN, "call_log_hdr_t length");
+
+
+
+//
+// Variables
+//
+static const char* TAG = "call_log";
+
+static call_log_rec_t* recs = NULL;          // PSRAM mirror, indexed by slot
+static SemaphoreHandle_t recs_mutex;
+static StaticSemaphore_t recs_mutex_buf;
+static uint32_t next_seq = 1;                // Sequence number of the next append
+static uint32_t written_seq = 0;             // Newest record on the card
+static bool card_ok = false;                 // The file was loaded (or created) at boot
+static TaskHandle_t call_log_task_handle;
+static StackType_t call_log_task_stack[CALL_LOG_TASK_STACK];
+static StaticTask_t call_log_task_tcb;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _call_log_task(void* args);
+static bool _call_log_load();
+static bool _call_log_create(FILE* fp);
+static void _call_log_write_pending();
+static uint16_t _call_log_crc(const call_log_rec_t* r);
+
+
+
+//
+// API
+//
+void call_log_init()
+{
+	recs = (call_log_rec_t*) heap_caps_calloc(CALL_LOG_MAX_RECORDS, sizeof(call_log_rec_t), MALLOC_CAP_SPIRAM);
+	recs_mutex = xSemaphoreCreateMutexStatic(&recs_mutex_buf);
+	if ((recs == NULL) || (recs_mutex == NULL)) {
+		ESP_LOGE(TAG, "Could not allocate call log");
+		recs = NULL;
+		return;
+	}
+	
+	call_log_task_handle = xTaskCreateStaticPinnedToCore(&_call_log_task, "call_log_task", CALL_LOG_TASK_STACK, NULL, CALL_LOG_TASK_PRIO, call_log_task_stack, &call_log_task_tcb, 0);
+}
+
+
+void call_log_append(call_log_rec_t* r)
+{
+	if (recs == NULL) return;
+	
+	xSemaphoreTake(recs_mutex, portMAX_DELAY);
+	r->seq = next_seq++;
+	r->number[CALL_LOG_NUMBER_LEN] = 0;
+	r->reserved = 0;
+	r->crc = _call_log_crc(r);
+	recs[r->seq % CALL_LOG_MAX_RECORDS] = *r;
+	xSemaphoreGive(recs_mutex);
+	
+	xTaskNotifyGive(call_log_task_handle);
+}
+
+
+int call_log_count()
+{
+	int n;
+	
+	if (recs == NULL) return 0;
+	
+	xSemaphoreTake(recs_mutex, portMAX_DELAY);
+	n = (int) (next_seq - 1);
+	xSemaphoreGive(recs_mutex);
+	
+	return (n > CALL_LOG_MAX_RECORDS) ? CALL_LOG_MAX_RECORDS : n;
+}
+
+
+bool call_log_get(int n, call_log_rec_t* r)
+{
+	uint32_t seq;
+	bool valid;
+	
+	if ((n < 0) || (n >= call_log_count())) return false;
+	
+	xSemaphoreTake(recs_mutex, portMAX_DELAY);
+	seq = next_seq - 1 - n;
+	*r = recs[seq % CALL_LOG_MAX_RECORDS];
+	xSemaphoreGive(recs_mutex);
+	
+	// A slot whose record was lost (torn write) holds an older call
+	valid = (r->seq == seq);
+	if (!valid) memset(r, 0, sizeof(call_log_rec_t));
+	return valid;
+}
+
+
+
+//
+// Internal functions
+//
+static void _call_log_task(void* args)
+{
+	int i;
+	
+	for (i=0; i<CALL_LOG_MOUNT_TRIES; i++) {
+		if (sd_card_mount()) {
+			card_ok = _call_log_load();
+			sd_card_unmount();
+			break;
+		}
+		vTaskDelay(pdMS_TO_TICKS(CALL_LOG_RETRY_MSEC));
+	}
+	if (!card_ok) {
+		ESP_LOGI(TAG, "No Micro-SD Card for the call log - calls are only logged until reset");
+	}
+	
+	while (true) {
+		(void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		if (card_ok && sd_card_mount()) {
+			_call_log_write_pending();
+			sd_card_unmount();
+		}
+	}
+}
+
+
+// Reads every slot into the mirror (creating the file if necessary) and finds the newest record
+static bool _call_log_load()
+{
+	call_log_hdr_t hdr;
+	call_log_rec_t r;
+	uint32_t max_seq = 0;
+	int i, valid = 0;
+	FILE* fp;
+	
+	fp = fopen(CALL_LOG_FILE, "r+b");
+	if (fp == NULL) {
+		fp = fopen(CALL_LOG_FILE, "w+b");
+		if (fp == NULL) {
+			ESP_LOGE(TAG, "Could not create %s", CALL_LOG_FILE);
+			return false;
+		}
+		return _call_log_create(fp);
+	}
+	
+	if ((fread(&hdr, sizeof(hdr), 1, fp) != 1) || (hdr.magic != CALL_LOG_MAGIC) ||
+	    (hdr.version != CALL_LOG_VERSION) || (hdr.rec_len != sizeof(call_log_rec_t)) ||
+	    (hdr.max_records != CALL_LOG_MAX_RECORDS)) {
+		
+		ESP_LOGW(TAG, "Starting a new call log");
+		return _call_log_create(fp);
+	}
+	
+	xSemaphoreTake(recs_mutex, portMAX_DELAY);
+	for (i=0; i<CALL_LOG_MAX_RECORDS; i++) {
+		if (fread(&r, sizeof(r), 1, fp) != 1) break;
+		if ((r.seq == 0) || ((r.seq % CALL_LOG_MAX_RECORDS) != i) || (r.crc != _call_log_crc(&r))) continue;
+		recs[i] = r;
+		valid++;
+		if (r.seq > max_seq) max_seq = r.seq;
+	}
+	next_seq = max_seq + 1;
+	written_seq = max_seq;
+	xSemaphoreGive(recs_mutex);
+	fclose(fp);
+	
+	ESP_LOGI(TAG, "Loaded %d calls", valid);
+	return true;
+}
+
+
+// Writes the header and empty slots to fp and closes it
+static bool _call_log_create(FILE* fp)
+{
+	call_log_hdr_t hdr;
+	call_log_rec_t r;
+	bool success = true;
+	int i;
+	
+	memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = CALL_LOG_MAGIC;
+	hdr.version = CALL_LOG_VERSION;
+	hdr.rec_len = sizeof(call_log_rec_t);
+	hdr.max_records = CALL_LOG_MAX_RECORDS;
+	memset(&r, 0, sizeof(r));
+	
+	rewind(fp);
+	if (fwrite(&hdr, sizeof(hdr), 1, fp) != 1) success = false;
+	for (i=0; i<CALL_LOG_MAX_RECORDS; i++) {
+		if (fwrite(&r, sizeof(r), 1, fp) != 1) success = false;
+	}
+	fclose(fp);
+	
+	if (!success) {
+		ESP_LOGE(TAG, "Could not initialize %s", CALL_LOG_FILE);
+	}
+	return success;
+}
+
+
+// Writes the records appended since the last write (the oldest are skipped if more than
+// a whole log's worth were appended while the card was busy)
+static void _call_log_write_pending()
+{
+	call_log_rec_t r;
+	uint32_t seq, last;
+	FILE* fp;
+	
+	fp = fopen(CALL_LOG_FILE, "r+b");
+	if (fp == NULL) {
+		ESP_LOGE(TAG, "Could not open %s", CALL_LOG_FILE);
+		return;
+	}
+	
+	xSemaphoreTake(recs_mutex, portMAX_DELAY);
+	last = next_seq - 1;
+	xSemaphoreGive(recs_mutex);
+	
+	seq = written_seq + 1;
+	if ((last - written_seq) > CALL_LOG_MAX_RECORDS) {
+		seq = last - CALL_LOG_MAX_RECORDS + 1;
+	}
+	for (; seq <= last; seq++) {
+		xSemaphoreTake(recs_mutex, portMAX_DELAY);
+		r = recs[seq % CALL_LOG_MAX_RECORDS];
+		xSemaphoreGive(recs_mutex);
+		
+		if ((fseek(fp, CALL_LOG_HDR_LEN + (seq % CALL_LOG_MAX_RECORDS) * sizeof(call_log_rec_t), SEEK_SET) != 0) ||
+		    (fwrite(&r, sizeof(r), 1, fp) != 1)) {
+			
+			ESP_LOGE(TAG, "Write of call %u failed", seq);
+			break;
+		}
+		written_seq = seq;
+	}
+	fclose(fp);
+}
+
+
+static uint16_t _call_log_crc(const call_log_rec_t* r)
+{
+	call_log_rec_t c = *r;
+	
+	c.crc = 0;
+	return crc_itu16_calc((const uint8_t*) &c, sizeof(c), 0xFFFF);
+}
+
+#endif /* CONFIG_CALL_LOG_ENABLE */
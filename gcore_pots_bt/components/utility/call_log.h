@@ -0,0 +1,91 @@
+/*
+ * call_log - utility module keeping a history of calls on the Micro-SD Card for customer
+ * support and for tracking audio performance over time.  Each call is a fixed-size record
+ * in a circular file so an append is one record write.  The whole log is mirrored in PSRAM
+ * so the GUI can page through it by index without touching the card.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _CALL_LOG_H_
+#define _CALL_LOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+//
+// Constants
+//
+
+// Log file in the root of the Micro-SD Card
+#define CALL_LOG_FILE          "/sdcard/calllog.bin"
+
+// Records kept (the oldest is overwritten once the log is full)
+#define CALL_LOG_MAX_RECORDS   256
+
+// Longest number kept
+#define CALL_LOG_NUMBER_LEN    23
+
+// call_log_rec_t dir
+#define CALL_LOG_DIR_INCOMING  0
+#define CALL_LOG_DIR_OUTGOING  1
+#define CALL_LOG_DIR_MISSED    2
+
+// call_log_rec_t codec
+#define CALL_LOG_CODEC_NONE    0   // Audio never routed to us
+#define CALL_LOG_CODEC_CVSD    1
+#define CALL_LOG_CODEC_MSBC    2
+
+
+
+//
+// Typedefs
+//
+
+// One call (64 bytes on the card)
+typedef struct {
+	uint32_t seq;                         // Set by call_log_append (increments for each call)
+	uint32_t start;                       // Start time (seconds since the epoch)
+	uint32_t duration_sec;                // Connected time (0 for a missed or unanswered call)
+	uint8_t dir;                          // CALL_LOG_DIR_*
+	uint8_t codec;                        // CALL_LOG_CODEC_*
+	int16_t erle_db10;                    // Echo canceller ERLE (tenths of a dB, 0 if not measured)
+	char number[CALL_LOG_NUMBER_LEN+1];   // Empty if unknown
+	uint32_t rx_underruns;                // audio_stats_t counts during the call
+	uint32_t tx_underruns;
+	uint32_t plc_events;
+	uint32_t jb_concealments;
+	uint16_t deadline_misses;
+	uint16_t crc;                         // Set by call_log_append
+	uint16_t mos_x100;                    // Estimated MOS * 100 (0 if there was no voice)
+	uint8_t nlp_pct;                      // Percentage of echo canceller output the NLP suppressed
+	uint8_t reserved;
+} call_log_rec_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_CALL_LOG_ENABLE == true)
+void call_log_init();                                  // Starts loading the log in the background
+void call_log_append(call_log_rec_t* r);               // Sets seq and crc; written to the card in the background
+int call_log_count();                                  // Records available
+bool call_log_get(int n, call_log_rec_t* r);           // n = 0 for the newest; false if n >= call_log_count()
+#endif
+
+#endif /* _CALL_LOG_H_ */
@@ -0,0 +1,190 @@
+/*
+ * call_progress - utility module recognising call progress tones (busy, reorder and
+ * special information tones) in the far end audio using the spandsp supervisory tone
+ * detector.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "call_progress.h"
+#include "esp_log.h"
+#include "spandsp.h"
+
+
+
+//
+// Constants
+//
+
+// Maximum elements in a pattern
+#define CP_MAX_ELEMENTS   3
+
+// Patterns monitored (see cp_patterns)
+#define CP_NUM_PATTERNS   (sizeof(cp_patterns) / sizeof(cp_pattern_t))
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int f1;
+	int f2;
+	int min_msec;
+	int max_msec;
+} cp_element_t;
+
+typedef struct {
+	int tone;                             // CALL_PROGRESS_* reported
+	int num_elements;
+	cp_element_t element[CP_MAX_ELEMENTS];
+} cp_pattern_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "call_progress";
+
+// Element durations are in mSec.  The detector measures in 16 mSec blocks and needs two
+// blocks to accept a change so the limits are wide.  UK busy (400 Hz) is close enough to
+// 425 Hz to be seen by that filter; a separate 400 Hz filter would make every CEPT tone
+// look like a pair.
+static const cp_pattern_t cp_patterns[] = {
+	// North American busy (480 + 620 Hz, 0.5 s on, 0.5 s off)
+	{CALL_PROGRESS_BUSY,    2, {{480, 620, 420, 600}, {0, 0, 420, 600}}},
+	// North American reorder (480 + 620 Hz, 0.25 s on, 0.25 s off)
+	{CALL_PROGRESS_REORDER, 2, {{480, 620, 180, 330}, {0, 0, 180, 330}}},
+	// CEPT busy (425 Hz, 0.5 s on, 0.5 s off)
+	{CALL_PROGRESS_BUSY,    2, {{425, 0, 420, 600}, {0, 0, 420, 600}}},
+	// CEPT congestion (425 Hz, 0.25 s on, 0.25 s off)
+	{CALL_PROGRESS_REORDER, 2, {{425, 0, 180, 300}, {0, 0, 180, 300}}},
+	// UK busy (400 Hz, 0.375 s on, 0.375 s off)
+	{CALL_PROGRESS_BUSY,    2, {{425, 0, 310, 415}, {0, 0, 310, 415}}},
+	// Special information tone (950, 1400, 1777 Hz rising, 274 or 380 mSec each)
+	{CALL_PROGRESS_SIT,     3, {{950, 0, 250, 420}, {1400, 0, 250, 420}, {1777, 0, 250, 420}}}
+};
+
+static const char* cp_names[] = {"none", "busy", "reorder", "SIT"};
+
+static super_tone_rx_descriptor_t* cp_desc = NULL;
+static super_tone_rx_state_t* cp_state = NULL;
+static call_progress_cb_t cp_cb = NULL;
+
+static int cp_cur_tone = CALL_PROGRESS_NONE;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _call_progress_tone_cb(void* user_data, int code, int level, int delay);
+
+
+
+//
+// API
+//
+bool call_progress_init(call_progress_cb_t cb)
+{
+	int i, j;
+	int t;
+	const cp_element_t* e;
+	
+	cp_cb = cb;
+	
+	if (cp_desc == NULL) {
+		cp_desc = super_tone_rx_make_descriptor(NULL);
+		if (cp_desc == NULL) {
+			ESP_LOGE(TAG, "Could not allocate detector descriptor");
+			return false;
+		}
+		
+		// Tone codes from the detector are the index into cp_patterns
+		for (i=0; i<CP_NUM_PATTERNS; i++) {
+			t = super_tone_rx_add_tone(cp_desc);
+			for (j=0; j<cp_patterns[i].num_elements; j++) {
+				e = &cp_patterns[i].element[j];
+				super_tone_rx_add_element(cp_desc, t, e->f1, e->f2, e->min_msec, e->max_msec);
+			}
+		}
+	}
+	
+	cp_state = super_tone_rx_init(cp_state, cp_desc, _call_progress_tone_cb, NULL);
+	if (cp_state == NULL) {
+		ESP_LOGE(TAG, "Could not allocate detector");
+		return false;
+	}
+	cp_cur_tone = CALL_PROGRESS_NONE;
+	
+	return true;
+}
+
+
+void call_progress_reset()
+{
+	if (cp_state != NULL) {
+		(void) super_tone_rx_init(cp_state, cp_desc, _call_progress_tone_cb, NULL);
+		cp_cur_tone = CALL_PROGRESS_NONE;
+	}
+}
+
+
+void call_progress_process(const int16_t* buf, int len)
+{
+	if (cp_state != NULL) {
+		super_tone_rx(cp_state, buf, len);
+	}
+}
+
+
+void call_progress_skip(int len)
+{
+	if (cp_state != NULL) {
+		super_tone_rx_fillin(cp_state, len);
+	}
+}
+
+
+const char* call_progress_get_name(int tone)
+{
+	if ((tone < CALL_PROGRESS_NONE) || (tone > CALL_PROGRESS_SIT)) {
+		tone = CALL_PROGRESS_NONE;
+	}
+	
+	return cp_names[tone];
+}
+
+
+
+//
+// Internal functions
+//
+static void _call_progress_tone_cb(void* user_data, int code, int level, int delay)
+{
+	int tone;
+	
+	tone = ((code >= 0) && (code < CP_NUM_PATTERNS)) ? cp_patterns[code].tone : CALL_PROGRESS_NONE;
+	
+	// The detector reports the end of a pattern when its cadence breaks, only pass on
+	// changes in what is heard
+	if (tone != cp_cur_tone) {
+		cp_cur_tone = tone;
+		if (cp_cb != NULL) {
+			(*cp_cb)(tone);
+		}
+	}
+}
@@ -0,0 +1,63 @@
+/*
+ * call_progress - utility module recognising call progress tones (busy, reorder and
+ * special information tones) in the far end audio using the spandsp supervisory tone
+ * detector.  The common North American, CEPT and UK cadences are monitored so a call
+ * ended by the remote network can be reported regardless of the country it is in.
+ *
+ * Audio is 8 kHz.  Blocks known to be silent may be skipped with call_progress_skip()
+ * which keeps the cadence timing without running the detector filters.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _CALL_PROGRESS_H_
+#define _CALL_PROGRESS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Tones reported
+#define CALL_PROGRESS_NONE    0
+#define CALL_PROGRESS_BUSY    1
+#define CALL_PROGRESS_REORDER 2
+#define CALL_PROGRESS_SIT     3
+
+
+
+//
+// Typedefs
+//
+
+// Called with the tone recognised or CALL_PROGRESS_NONE when it stops
+typedef void (*call_progress_cb_t)(int tone);
+
+
+
+//
+// API
+//
+bool call_progress_init(call_progress_cb_t cb);
+void call_progress_reset();
+void call_progress_process(const int16_t* buf, int len);
+void call_progress_skip(int len);
+const char* call_progress_get_name(int tone);
+
+#endif /* _CALL_PROGRESS_H_ */
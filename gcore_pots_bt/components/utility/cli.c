@@ -0,0 +1,789 @@
+/*
+ * cli - utility module running an interactive command line on the console UART.  See cli.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "cli.h"
+#if (CONFIG_CLI_ENABLE == true)
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "audio_task.h"
+#include "bench.h"
+#include "bg_job.h"
+#include "bt_task.h"
+#include "call_log.h"
+#include "dtmf_qual.h"
+#include "esp_console.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "evt_bus.h"
+#include "hci_snoop.h"
+#include "heap_acct.h"
+#include "hsm.h"
+#include "pace.h"
+#include "preroll.h"
+#include "ps.h"
+#include "ps_journal.h"
+#include "render_prof.h"
+#include "sys_common.h"
+#include "sys_mon.h"
+#include "sys_status.h"
+#include "systrace.h"
+#include "touch_lat.h"
+#include "wifi_up.h"
+
+
+
+//
+// Variables
+//
+static const char* TAG = "cli";
+
+static const char* lec_budget_names[] = {"full", "no background", "short", "no NLP"};
+
+// Large results are kept off the console task's stack
+static sys_mon_snapshot_t cli_snapshot;
+#if (CONFIG_HEAP_ACCT_ENABLE == true)
+static heap_acct_stats_t cli_heap;
+#endif
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+static render_prof_stats_t cli_render;
+#endif
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+static touch_lat_stats_t cli_touch;
+#endif
+static bench_result_t cli_bench;
+static bench_kernel_t cli_check[BENCH_NUM_KERNELS];
+static dtmf_qual_stats_t cli_dtmf;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _cli_stats(int argc, char** argv);
+static int _cli_tasks(int argc, char** argv);
+static int _cli_rings(int argc, char** argv);
+static int _cli_jobs(int argc, char** argv);
+static int _cli_pace(int argc, char** argv);
+static int _cli_lec(int argc, char** argv);
+static int _cli_bench(int argc, char** argv);
+static int _cli_latency(int argc, char** argv);
+static int _cli_dtmf(int argc, char** argv);
+static int _cli_states(int argc, char** argv);
+#if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
+static int _cli_capture(int argc, char** argv);
+#endif
+#if (CONFIG_CALL_LOG_ENABLE == true)
+static int _cli_calllog(int argc, char** argv);
+#endif
+#if (CONFIG_SYSTRACE_ENABLE == true)
+static int _cli_trace(int argc, char** argv);
+#endif
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+static int _cli_snoop(int argc, char** argv);
+#endif
+#if (CONFIG_HEAP_ACCT_ENABLE == true)
+static int _cli_heap(int argc, char** argv);
+#endif
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+static int _cli_upload(int argc, char** argv);
+#endif
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+static int _cli_render(int argc, char** argv);
+#endif
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+static int _cli_touch(int argc, char** argv);
+#endif
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+static int _cli_ps(int argc, char** argv);
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+static int _cli_preroll(int argc, char** argv);
+#endif
+
+
+
+//
+// Commands
+//
+static const esp_console_cmd_t cli_cmds[] = {
+	{.command = "stats", .help = "Audio, Bluetooth and heap statistics (\"stats reset\" clears them)",
+	 .hint = "[reset]", .func = &_cli_stats},
+	{.command = "tasks", .help = "Task CPU use and stack headroom from the last system monitor sample",
+	 .hint = NULL, .func = &_cli_tasks},
+	{.command = "rings", .help = "Audio ring, jitter buffer and event queue depths",
+	 .hint = NULL, .func = &_cli_rings},
+	{.command = "jobs", .help = "Background job queue depths and slice run times",
+	 .hint = NULL, .func = &_cli_jobs},
+	{.command = "pace", .help = "Task pacing lateness histograms (\"pace reset\" clears them)",
+	 .hint = "[reset]", .func = &_cli_pace},
+	{.command = "lec", .help = "Echo canceller state, or set the tail (0 = country default) or HPF bits for the next call",
+	 .hint = "[tail <msec> | hpf <0-3>]", .func = &_cli_lec},
+	{.command = "bench", .help = "Run the self-benchmark, or check the DSP kernels against their cycle budgets and outputs (only while audio is idle)",
+	 .hint = "[check]", .func = &_cli_bench},
+	{.command = "latency", .help = "Start the echo path latency measurement (needs tone audio, result is logged)",
+	 .hint = NULL, .func = &_cli_latency},
+	{.command = "dtmf", .help = "Signal quality of the last DTMF digits received (\"dtmf reset\" clears them)",
+	 .hint = "[reset]", .func = &_cli_dtmf},
+	{.command = "states", .help = "Task state machines with their recent transitions",
+	 .hint = NULL, .func = &_cli_states},
+#if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
+	{.command = "capture", .help = "Start an audio capture to the Micro-SD Card, or end the one running",
+	 .hint = NULL, .func = &_cli_capture},
+#endif
+#if (CONFIG_CALL_LOG_ENABLE == true)
+	{.command = "calllog", .help = "List the newest calls (default 10)",
+	 .hint = "[count]", .func = &_cli_calllog},
+#endif
+#if (CONFIG_SYSTRACE_ENABLE == true)
+	{.command = "trace", .help = "Save the task switch trace to the Micro-SD Card as SystemView files",
+	 .hint = NULL, .func = &_cli_trace},
+#endif
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+	{.command = "snoop", .help = "HCI recording state (\"snoop save\" saves it to the Micro-SD Card as a btsnoop file)",
+	 .hint = "[save]", .func = &_cli_snoop},
+#endif
+#if (CONFIG_HEAP_ACCT_ENABLE == true)
+	{.command = "heap", .help = "Heap use by task and allocations during calls (\"heap reset\" clears the call counts)",
+	 .hint = "[reset]", .func = &_cli_heap},
+#endif
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+	{.command = "upload", .help = "Telemetry upload state (\"upload now\" sends at the next idle time)",
+	 .hint = "[now]", .func = &_cli_upload},
+#endif
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+	{.command = "render", .help = "Display redraw times by area, object type, blend and flush (\"render reset\" clears them)",
+	 .hint = "[reset]", .func = &_cli_render},
+#endif
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+	{.command = "touch", .help = "Touch-to-photon latency percentiles by stage (\"touch reset\" clears them)",
+	 .hint = "[reset]", .func = &_cli_touch},
+#endif
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+	{.command = "ps", .help = "Settings journal state (\"ps compact\" rewrites it to a fresh flash sector)",
+	 .hint = "[compact]", .func = &_cli_ps},
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+	{.command = "preroll", .help = "Pre-roll audio recording state (\"preroll save\" saves the ring to the Micro-SD Card after the call)",
+	 .hint = "[save]", .func = &_cli_preroll},
+#endif
+};
+
+
+
+//
+// API
+//
+bool cli_init()
+{
+	esp_console_repl_t* repl = NULL;
+	esp_console_repl_config_t repl_config = ESP_CONSOLE_REPL_CONFIG_DEFAULT();
+	esp_console_dev_uart_config_t uart_config = ESP_CONSOLE_DEV_UART_CONFIG_DEFAULT();
+	esp_err_t ret;
+	int i;
+	
+	repl_config.prompt = "weeBell>";
+	repl_config.max_cmdline_length = CLI_MAX_CMDLINE;
+	repl_config.task_stack_size = CLI_TASK_STACK;
+	repl_config.task_priority = CLI_TASK_PRIO;
+	if ((ret = esp_console_new_repl_uart(&uart_config, &repl_config, &repl)) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not create console (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	
+	(void) esp_console_register_help_command();
+	for (i=0; i<(sizeof(cli_cmds) / sizeof(cli_cmds[0])); i++) {
+		if ((ret = esp_console_cmd_register(&cli_cmds[i])) != ESP_OK) {
+			ESP_LOGE(TAG, "Could not register %s (%s)", cli_cmds[i].command, esp_err_to_name(ret));
+		}
+	}
+	
+	if ((ret = esp_console_start_repl(repl)) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not start console (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	
+	return true;
+}
+
+
+
+//
+// Internal functions
+//
+static int _cli_stats(int argc, char** argv)
+{
+	bt_at_stats_t as;
+	bt_link_stats_t ls;
+	bt_reconnect_stats_t rs;
+	sys_status_power_t ps;
+	uint32_t at_sent = 0, at_err = 0, at_to = 0;
+	int i;
+	
+	if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+		audio_reset_stats();
+		evt_bus_reset_stats();
+		printf("Statistics reset\n");
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: stats [reset]\n");
+		return 1;
+	}
+	
+	// The audio statistics are long so they go through the log
+	audio_print_stats();
+	
+	bt_get_link_stats(&ls);
+	bt_get_reconnect_stats(&rs);
+	bt_get_at_stats(&as);
+	for (i=0; i<BT_AT_NUM_CMDS; i++) {
+		at_sent += as.cmd[i].sent;
+		at_err += as.cmd[i].errors;
+		at_to += as.cmd[i].timeouts;
+	}
+	printf("BT link: %s, %s, quality %d, rssi %d, missed %u, late %u, jitter %u uS\n",
+	       ls.audio_connected ? "audio" : "no audio", ls.msbc ? "mSBC" : "CVSD", ls.quality, ls.rssi_delta,
+	       ls.missed_packets, ls.late_packets, ls.jitter_usec);
+	printf("BT connection: %u disconnects, %u link losses, %u reconnects (max %u mS)\n",
+	       rs.disconnects, rs.link_losses, rs.reconnects, rs.max_msec);
+	printf("BT AT: %u sent, %u errors, %u timeouts, %u queue overflows\n", at_sent, at_err, at_to, as.overflows);
+	printf("Heap: internal %u (min %u), PSRAM %u\n", heap_caps_get_free_size(MALLOC_CAP_INTERNAL),
+	       heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL), heap_caps_get_free_size(MALLOC_CAP_SPIRAM));
+	sys_status_get_power(&ps);
+	printf("Status v%u: app state %d, battery %d, charge %d\n", sys_status_get_version(),
+	       (int) sys_status_get_app_state(), ps.batt_state, ps.charge_state);
+	
+	return 0;
+}
+
+
+static int _cli_tasks(int argc, char** argv)
+{
+	// gcore_task takes the samples (see CONFIG_SYS_MON_LOG_SECS)
+	sys_mon_get_snapshot(&cli_snapshot);
+	sys_mon_print(&cli_snapshot);
+	
+	return 0;
+}
+
+
+static int _cli_rings(int argc, char** argv)
+{
+	audio_stats_t s;
+	evt_bus_stats_t es;
+	int q;
+	
+	audio_get_stats(&s);
+	printf("RX ring  %d  hw %d  ovf %u  unr %u\n", audioGetRxCount(), s.rx_high_water, s.rx_overflows, s.rx_underruns);
+	printf("TX ring  %d  hw %d  ovf %u  unr %u\n", audioGetTxCount(), s.tx_high_water, s.tx_overflows, s.tx_underruns);
+	printf("TX align hw %d\n", s.tx_align_high_water);
+	printf("JB  tx %d/%u  rx %d/%u  conceal %u\n", s.tx_jb_target, s.tx_jb_adjusts, s.rx_jb_target, s.rx_jb_adjusts,
+	       s.jb_concealments);
+	for (q=0; q<EVT_BUS_MAX_QUEUES; q++) {
+		if (evt_bus_get_stats(q, &es)) {
+			printf("Queue %-5s hw %d/%d  sent %u  drop %u  lat %u/%u uS\n", es.name, es.high_water, es.depth,
+			       es.sent, es.dropped, es.avg_latency_usec, es.max_latency_usec);
+		}
+	}
+	
+	return 0;
+}
+
+
+static int _cli_jobs(int argc, char** argv)
+{
+	bg_job_stats_t s;
+	
+	bg_job_get_stats(&s);
+	printf("Queued high %d  normal %d  low %d  hw %d/%d%s\n", s.depth[BG_JOB_PRIO_HIGH], s.depth[BG_JOB_PRIO_NORMAL],
+	       s.depth[BG_JOB_PRIO_LOW], s.high_water, BG_JOB_MAX_JOBS, s.held ? "  (held off)" : "");
+	printf("Submitted %u  completed %u  dropped %u  held off %u\n", s.submitted, s.completed, s.dropped, s.holdoffs);
+	printf("Slices %u  long %u  avg %u uS  max %u uS (%s)\n", s.slices, s.long_slices, s.avg_slice_usec,
+	       s.max_slice_usec, s.max_slice_name);
+	
+	return 0;
+}
+
+
+static int _cli_pace(int argc, char** argv)
+{
+	static const uint32_t bin_msec[PACE_NUM_BINS - 1] = PACE_BIN_MSEC;
+	pace_stats_t s;
+	int i, id;
+	
+	if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+		pace_reset_stats();
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: pace [reset]\n");
+		return 1;
+	}
+	
+	printf("%-6s %6s", "Task", "period");
+	for (i=0; i<(PACE_NUM_BINS - 1); i++) {
+		printf(" %6s%u", "<=", bin_msec[i]);
+	}
+	printf(" %7s %8s %5s %5s\n", ">", "max uS", "warn", "over");
+	for (id=0; id<PACE_MAX_IDS; id++) {
+		if (!pace_get_stats(id, &s)) continue;
+		printf("%-6s %6u", s.name, s.period_usec / 1000);
+		for (i=0; i<PACE_NUM_BINS; i++) {
+			printf(" %7u", s.hist[i]);
+		}
+		printf(" %8u %5u %5u\n", s.max_late_usec, s.warnings, s.overruns);
+	}
+	printf("Lateness in mSec past each task's period (or response budget)%s\n", pace_stressed() ? ", stressed" : "");
+	
+	return 0;
+}
+
+
+static int _cli_lec(int argc, char** argv)
+{
+	audio_stats_t s;
+	int v;
+	
+	if (argc == 3) {
+		v = atoi(argv[2]);
+		if ((strcmp(argv[1], "tail") == 0) && (v >= 0) && (v <= 255)) {
+			ps_set_lec_tail_msec((uint8_t) v);
+		} else if ((strcmp(argv[1], "hpf") == 0) && (v >= 0) && (v <= (PS_LEC_HPF_RX | PS_LEC_HPF_TX))) {
+			ps_set_lec_hpf((uint8_t) v);
+		} else {
+			printf("Usage: lec [tail <msec> | hpf <0-3>]\n");
+			return 1;
+		}
+		ps_update_backing_store();
+	} else if (argc != 1) {
+		printf("Usage: lec [tail <msec> | hpf <0-3>]\n");
+		return 1;
+	}
+	
+	audio_get_stats(&s);
+	printf("Engine %s  taps %d  bulk delay %d\n", (s.lec_engine == AUDIO_LEC_ENGINE_FDAF) ? "FDAF" : "OSLEC",
+	       s.lec_taps, s.lec_bulk_delay);
+	if (ps_get_lec_tail_msec() == PS_LEC_TAIL_COUNTRY_DEFAULT) {
+		printf("Tail country default\n");
+	} else {
+		printf("Tail %d mS\n", ps_get_lec_tail_msec());
+	}
+	printf("HPF  this call %d  next call %d  (1 = RX, 2 = TX)\n", s.lec_hpf, ps_get_lec_hpf());
+	printf("NLP  %s  suppressed %d%%\n", (s.lec_budget_level >= AUDIO_LEC_BUDGET_NO_NLP) ? "bypassed" : "on",
+	       s.quality.nlp_pct);
+	printf("ERLE %.1f dB (recent %.1f dB)  converged %d mS\n", s.quality.erle_db10 / 10.0f,
+	       s.quality.erle_recent_db10 / 10.0f, s.lec_converge_msec);
+	printf("Budget %s (max %s)\n", lec_budget_names[s.lec_budget_level], lec_budget_names[s.lec_budget_max_level]);
+	
+	return 0;
+}
+
+
+static int _cli_bench(int argc, char** argv)
+{
+	audio_load_t load;
+	int failures;
+	
+	if ((argc > 2) || ((argc == 2) && (strcmp(argv[1], "check") != 0))) {
+		printf("Usage: bench [check]\n");
+		return 1;
+	}
+	
+	// Like the diagnostics screen, never while a call or tone is running
+	audio_get_load(&load);
+	if (load.enabled) {
+		printf("Audio is running, try again when idle\n");
+		return 1;
+	}
+	
+	if (argc == 2) {
+		failures = bench_check(cli_check);
+		bench_check_log(cli_check);
+		printf("%d kernel%s failed\n", failures, (failures == 1) ? "" : "s");
+		return (failures == 0) ? 0 : 1;
+	}
+	
+	// The display redraw time is only measured from the diagnostics screen
+	bench_run(&cli_bench);
+	bench_log(&cli_bench);
+	
+	return 0;
+}
+
+
+static int _cli_latency(int argc, char** argv)
+{
+	if (!audioStartLatencyTest()) {
+		printf("Could not start (tone audio must be running)\n");
+		return 1;
+	}
+	printf("Started\n");
+	
+	return 0;
+}
+
+
+static int _cli_dtmf(int argc, char** argv)
+{
+	dtmf_qual_stats_t* s = &cli_dtmf;
+	dtmf_rx_quality_t* q;
+	int i;
+	
+	if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+		dtmf_qual_reset_stats();
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: dtmf [reset]\n");
+		return 1;
+	}
+	
+	dtmf_qual_get_stats(s);
+	printf("Digits %u, more than one at once %u\n", s->digits, s->multi);
+	if (s->digits == 0) {
+		return 0;
+	}
+	printf("Worst: level margin %.1f dB, SNR margin %.1f dB, twist %.1f dB, shortest %d mS\n",
+	       s->min_level_margin / 10.0f, s->min_snr_margin / 10.0f, s->max_twist / 10.0f, s->min_duration / 8);
+	printf("%-5s %5s %6s %9s %9s %7s %7s %7s\n", "Digit", "mS", "hits", "row dBm0", "col dBm0", "twist", "level", "SNR");
+	for (i=0; i<s->recent; i++) {
+		q = &s->q[i];
+		printf("%-5c %5d %3d/%-2d %9.1f %9.1f %7.1f %7.1f %7.1f\n", q->digit, q->duration / 8, q->hit_blocks,
+		       q->blocks, q->row_level / 10.0f, q->col_level / 10.0f, q->twist / 10.0f,
+		       q->level_margin / 10.0f, q->snr_margin / 10.0f);
+	}
+	
+	return 0;
+}
+
+
+static int _cli_states(int argc, char** argv)
+{
+	const hsm_t* m;
+	hsm_trace_t trace[HSM_TRACE_LEN];
+	int i, j, n;
+	int64_t now = esp_timer_get_time();
+	char evt[8];
+	
+	for (i=0; (m = hsm_get(i)) != NULL; i++) {
+		printf("%s: %s for %d mS, %u transitions\n", m->def->tag, hsm_state_name(m, hsm_state(m)),
+		       (int) ((now - m->state_usec) / 1000), m->transitions);
+		n = hsm_get_trace(m, trace, HSM_TRACE_LEN);
+		for (j=0; j<n; j++) {
+			if (trace[j].event == HSM_EVT_TIMEOUT) {
+				strcpy(evt, "timeout");
+			} else if (trace[j].event == HSM_EVT_NONE) {
+				strcpy(evt, "-");
+			} else {
+				sprintf(evt, "%u", trace[j].event);
+			}
+			printf("  %6d.%03d %-7s %s -> %s\n", (int) (trace[j].usec / 1000000), (int) ((trace[j].usec / 1000) % 1000),
+			       evt, hsm_state_name(m, trace[j].from), (trace[j].to == HSM_NONE) ? "(internal)" : hsm_state_name(m, trace[j].to));
+		}
+	}
+	
+	return 0;
+}
+
+
+#if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
+static int _cli_capture(int argc, char** argv)
+{
+	// app_task starts the capture, or ends the one in progress, as for the settings screen button
+	if (!evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_START_AUDIO_SMPL)) {
+		printf("Busy, try again\n");
+		return 1;
+	}
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_CALL_LOG_ENABLE == true)
+static int _cli_calllog(int argc, char** argv)
+{
+	static const char* dir_names[] = {"in", "out", "missed"};
+	static const char* codec_names[] = {"-", "CVSD", "mSBC"};
+	call_log_rec_t r;
+	struct tm tm;
+	time_t t;
+	char tbuf[20];
+	int i, n;
+	
+	n = (argc > 1) ? atoi(argv[1]) : 10;
+	if (n > call_log_count()) n = call_log_count();
+	
+	for (i=0; i<n; i++) {
+		if (!call_log_get(i, &r)) break;
+		t = (time_t) r.start;
+		localtime_r(&t, &tm);
+		strftime(tbuf, sizeof(tbuf), "%Y-%m-%d %H:%M", &tm);
+		printf("%4u %s %-6s %-23s %5u s %-4s MOS %d.%02d ERLE %.1f dB NLP %u%% unr %u/%u plc %u\n",
+		       r.seq, tbuf, dir_names[r.dir % 3], (r.number[0] == 0) ? "-" : r.number, r.duration_sec,
+		       codec_names[r.codec % 3], r.mos_x100 / 100, r.mos_x100 % 100, r.erle_db10 / 10.0f, r.nlp_pct,
+		       r.rx_underruns, r.tx_underruns, r.plc_events);
+	}
+	if (i == 0) {
+		printf("No calls\n");
+	}
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_SYSTRACE_ENABLE == true)
+static int _cli_trace(int argc, char** argv)
+{
+	// Saved by the trace task (the result is logged)
+	systrace_save();
+	printf("Saving\n");
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+static int _cli_snoop(int argc, char** argv)
+{
+	hci_snoop_stats_t s;
+	
+	if ((argc == 2) && (strcmp(argv[1], "save") == 0)) {
+		// Saved by a background job (the result is logged)
+		hci_snoop_save();
+		printf("Saving\n");
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: snoop [save]\n");
+		return 1;
+	}
+	
+	hci_snoop_get_stats(&s);
+	printf("%s: %u packets in %u bytes, %u overwritten, %u missed\n", s.recording ? "Recording" : "Waiting to save",
+	       s.packets, s.ring_bytes, s.overwritten, s.missed);
+	printf("Triggers %u, saved %u (last btsnoop%d.log), %u failed\n", s.triggers, s.saves, s.last_file, s.save_failures);
+	printf("Tap %u cycles average, %u max\n", s.avg_tap_cycles, s.max_tap_cycles);
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_HEAP_ACCT_ENABLE == true)
+static int _cli_heap(int argc, char** argv)
+{
+	int i;
+	
+	if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+		heap_acct_reset_guard();
+	} else if (argc != 1) {
+		printf("Usage: heap [reset]\n");
+		return 1;
+	}
+	
+	heap_acct_get_stats(&cli_heap);
+	printf("%-16s %8s %8s %8s %8s %6s\n", "Task", "allocs", "frees", "live", "peak", "call");
+	for (i=0; i<cli_heap.num_tags; i++) {
+		printf("%-16s %8u %8u %8d %8d %6u\n", cli_heap.tag[i].name, cli_heap.tag[i].allocs, cli_heap.tag[i].frees,
+		       cli_heap.tag[i].live_bytes, cli_heap.tag[i].peak_bytes, cli_heap.tag[i].guard_allocs);
+	}
+	printf("Allocations during calls %u%s\n", cli_heap.guard_allocs, cli_heap.guard ? " (call running)" : "");
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+static int _cli_upload(int argc, char** argv)
+{
+	wifi_up_stats_t s;
+	
+	if ((argc == 2) && (strcmp(argv[1], "now") == 0)) {
+		wifi_up_now();
+	} else if (argc != 1) {
+		printf("Usage: upload [now]\n");
+		return 1;
+	}
+	
+	wifi_up_get_stats(&s);
+	printf("Pending %d/%d (dropped %u), uploaded %u%s\n", s.pending, WIFI_UP_RING_LEN, s.dropped, s.uploaded,
+	       s.radio_on ? ", Wi-Fi on" : "");
+	printf("Uploads %u: %u failed, %u aborted for calls, last status %d, backoff %u sec\n", s.attempts, s.failures,
+	       s.aborts, s.last_status, s.backoff_sec);
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+static int _cli_render(int argc, char** argv)
+{
+	static const uint32_t bin_usec[RENDER_PROF_NUM_BINS - 1] = RENDER_PROF_BIN_USEC;
+	static const uint32_t bin_px[RENDER_PROF_NUM_BINS - 1] = RENDER_PROF_BIN_PX;
+	render_prof_stats_t* s = &cli_render;
+	render_prof_type_t* t;
+	uint32_t n;
+	int i;
+	
+	if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+		render_prof_reset_stats();
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: render [reset]\n");
+		return 1;
+	}
+	
+	render_prof_get_stats(s);
+	n = (s->areas == 0) ? 1 : s->areas;
+	printf("Areas %u, avg %u px %u uS, slowest %u uS at %d,%d-%d,%d\n", s->areas, (uint32_t) (s->area_px / n),
+	       (uint32_t) (s->area_usec / n), s->max_area_usec, s->max_area[0], s->max_area[1], s->max_area[2],
+	       s->max_area[3]);
+	printf("%-9s", "");
+	for (i=0; i<(RENDER_PROF_NUM_BINS - 1); i++) {
+		printf(" %2s%-6u", "<=", bin_usec[i]);
+	}
+	printf(" %8s\n", ">");
+	printf("%-9s", "Area uS");
+	for (i=0; i<RENDER_PROF_NUM_BINS; i++) {
+		printf(" %8u", s->area_usec_hist[i]);
+	}
+	printf("\n%-9s", "SPI uS");
+	for (i=0; i<RENDER_PROF_NUM_BINS; i++) {
+		printf(" %8u", s->spi_usec_hist[i]);
+	}
+	printf("\n%-9s", "");
+	for (i=0; i<(RENDER_PROF_NUM_BINS - 1); i++) {
+		printf(" %2s%-6u", "<=", bin_px[i]);
+	}
+	printf(" %8s\n", ">");
+	printf("%-9s", "Area px");
+	for (i=0; i<RENDER_PROF_NUM_BINS; i++) {
+		printf(" %8u", s->area_px_hist[i]);
+	}
+	printf("\n");
+	
+	printf("%-16s %8s %10s %8s %8s\n", "Type", "draws", "total uS", "avg uS", "max uS");
+	for (i=0; i<s->num_types; i++) {
+		t = &s->type[i];
+		printf("%-16s %8u %10llu %8u %8u\n", (t->name != NULL) ? t->name : "?", t->draws, t->total_usec,
+		       (t->draws == 0) ? 0 : (uint32_t) (t->total_usec / t->draws), t->max_usec);
+	}
+	if (s->untracked_draws != 0) {
+		printf("Untracked draws %u\n", s->untracked_draws);
+	}
+	printf("Blend fill %u, %llu px, %llu uS; map %u, %llu px, %llu uS\n",
+	       s->blends[RENDER_PROF_BLEND_FILL], s->blend_px[RENDER_PROF_BLEND_FILL], s->blend_usec[RENDER_PROF_BLEND_FILL],
+	       s->blends[RENDER_PROF_BLEND_MAP], s->blend_px[RENDER_PROF_BLEND_MAP], s->blend_usec[RENDER_PROF_BLEND_MAP]);
+	n = (s->flushes == 0) ? 1 : s->flushes;
+	printf("Flushes %u (%u unchanged), callback avg %u uS, SPI avg %u max %u uS, waiting for SPI %llu uS\n",
+	       s->flushes, s->skipped_flushes, (uint32_t) (s->flush_cpu_usec / n),
+	       (uint32_t) (s->spi_usec / ((s->flushes > s->skipped_flushes) ? (s->flushes - s->skipped_flushes) : 1)),
+	       s->max_spi_usec, s->wait_usec);
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+static int _cli_touch(int argc, char** argv)
+{
+	static const char* stage_names[] = {"Dispatch", "Invalidate", "Flush", "Total"};
+	touch_lat_stats_t* s = &cli_touch;
+	int i;
+	
+	if ((argc == 2) && (strcmp(argv[1], "reset") == 0)) {
+		touch_lat_reset_stats();
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: touch [reset]\n");
+		return 1;
+	}
+	
+	touch_lat_get_stats(s);
+	printf("Presses %u, measured %u, abandoned %u (percentiles of the last %d)\n", s->presses, s->measured,
+	       s->abandoned, s->recent);
+	printf("%-10s %8s %8s %8s %8s\n", "uS", "p50", "p90", "p99", "max");
+	for (i=0; i<TOUCH_LAT_NUM_STAGES; i++) {
+		printf("%-10s %8u %8u %8u %8u\n", stage_names[i], s->pct_usec[i][TOUCH_LAT_P50], s->pct_usec[i][TOUCH_LAT_P90],
+		       s->pct_usec[i][TOUCH_LAT_P99], s->max_usec[i]);
+	}
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_PS_JOURNAL_ENABLE == true)
+static int _cli_ps(int argc, char** argv)
+{
+	ps_journal_stats_t s;
+	
+	if ((argc == 2) && (strcmp(argv[1], "compact") == 0)) {
+		(void) ps_commit();
+		printf("%s\n", ps_journal_snapshot() ? "Compacted" : "Compaction failed");
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: ps [compact]\n");
+		return 1;
+	}
+	
+	ps_journal_get_stats(&s);
+	printf("Sector %d (sequence %u): %u of %u bytes used, %s at boot\n", s.sector, s.seq, s.used, s.sector_len,
+	       s.loaded ? "loaded" : "empty");
+	printf("Records %u, compactions %u, failures %u\n", s.records, s.compactions, s.failures);
+	
+	return 0;
+}
+#endif
+
+
+#if (CONFIG_PREROLL_ENABLE == true)
+static int _cli_preroll(int argc, char** argv)
+{
+	preroll_stats_t s;
+	int i;
+	
+	if ((argc == 2) && (strcmp(argv[1], "save") == 0)) {
+		// Saved by a background job once audio is idle (the result is logged)
+		preroll_save();
+		printf("Saving\n");
+		return 0;
+	} else if (argc != 1) {
+		printf("Usage: preroll [save]\n");
+		return 1;
+	}
+	
+	preroll_get_stats(&s);
+	printf("%s: %u of %u blocks at %d Hz\n", s.recording ? "Recording" : "Waiting to save", s.blocks, s.ring_blocks, s.rate);
+	printf("Triggers");
+	for (i=0; i<PREROLL_NUM_TRIG; i++) {
+		printf(" %s %u", preroll_trigger_name(i), s.triggers[i]);
+	}
+	printf("\nSaved %u (last pre_in%d.txt), %u failed\n", s.saves, s.last_file, s.save_failures);
+	printf("Record %u cycles average, %u max\n", s.avg_rec_cycles, s.max_rec_cycles);
+	
+	return 0;
+}
+#endif
+
+#endif /* CONFIG_CLI_ENABLE */
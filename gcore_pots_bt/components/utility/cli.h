@@ -0,0 +1,54 @@
+/*
+ * cli - utility module running an interactive command line on the console UART for
+ * looking at the system while it runs: the audio, Bluetooth and task statistics, the ring
+ * and queue depths, the echo canceller settings, and starting captures, the benchmark and
+ * the echo path latency measurement.  Type "help" for the commands.
+ *
+ * The commands run in the console's own task below all the tasks handling calls so they
+ * can be used during a live call (the benchmark refuses to run while audio is active).
+ * Log output shares the UART and may interleave with command output.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _CLI_H_
+#define _CLI_H_
+
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Console task
+#define CLI_TASK_STACK       4096
+#define CLI_TASK_PRIO        1
+
+// Longest command line
+#define CLI_MAX_CMDLINE      128
+
+
+
+//
+// API
+//
+#if (CONFIG_CLI_ENABLE == true)
+bool cli_init();                          // Call from app_main once the tasks are running
+#endif
+
+#endif /* _CLI_H_ */
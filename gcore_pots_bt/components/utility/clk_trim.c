@@ -0,0 +1,252 @@
+/*
+ * clk_trim - utility module trimming the codec's I2S clock to track the Bluetooth SCO clock.
+ * See clk_trim.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "clk_trim.h"
+#if (CONFIG_AUDIO_CLK_TRIM == true)
+#include <math.h>
+#include <string.h>
+#include "esp_efuse.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "soc/i2s_struct.h"
+#include "soc/rtc.h"
+
+
+//
+// Constants
+//
+
+// APLL VCO range (its output is divided by 2 * (o_div + 2) for the I2S clock)
+#define CLK_TRIM_VCO_MIN_HZ      350000000
+#define CLK_TRIM_VCO_MAX_HZ      500000000
+#define CLK_TRIM_MAX_ODIV        31
+
+// Loop gains on the frequency and phase errors (both in ppm over a period)
+#define CLK_TRIM_KP              0.5f
+#define CLK_TRIM_KI              0.1f
+
+// A gap in the calls to clk_trim_eval longer than this (no voice) restarts the period
+#define CLK_TRIM_GAP_MSEC        100
+
+
+
+//
+// Variables
+//
+static const char* TAG = "clk_trim";
+
+static bool clk_trim_active = false;
+
+// APLL setup for the current sample rate
+static uint32_t clk_trim_apll_hz;
+static uint32_t clk_trim_xtal_hz;
+static int clk_trim_odiv;
+
+static float clk_trim_ppm = 0;                    // Kept between calls and sample rates
+
+// Current period (all in circular buffer samples)
+static int64_t clk_trim_start_usec;
+static int64_t clk_trim_last_usec;
+static uint32_t clk_trim_frames;
+static uint32_t clk_trim_samples;                 // Consumed
+static int32_t clk_trim_adj;                      // Dropped (positive) or inserted (negative)
+static int64_t clk_trim_depth_sum;
+static int64_t clk_trim_target_sum;
+
+// Average depth during the previous period
+static bool clk_trim_have_prev = false;
+static float clk_trim_prev_depth;
+
+static clk_trim_stats_t clk_trim_stats;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _clkTrimApply();
+static void _clkTrimUpdate();
+static void _clkTrimClearPeriod();
+
+
+
+//
+// API
+//
+bool clk_trim_start(uint32_t sample_rate, uint32_t mclk_multiple)
+{
+	uint32_t mclk = sample_rate * mclk_multiple;
+	uint32_t n;
+	uint64_t vco;
+	int odiv;
+	
+	clk_trim_active = false;
+	clk_trim_stats.active = false;
+	clk_trim_have_prev = false;
+	_clkTrimClearPeriod();
+	
+	if (esp_efuse_get_chip_ver() == 0) {
+		ESP_LOGW(TAG, "APLL fractional divider not available on revision 0");
+		return false;
+	}
+	
+	// Run the APLL at the lowest integer multiple of MCLK in its range
+	n = (CLK_TRIM_APLL_MIN_HZ + mclk - 1) / mclk;
+	if (n < 2) n = 2;
+	clk_trim_apll_hz = n * mclk;
+	for (odiv=0; odiv<=CLK_TRIM_MAX_ODIV; odiv++) {
+		vco = (uint64_t) clk_trim_apll_hz * 2 * (odiv + 2);
+		if ((vco >= CLK_TRIM_VCO_MIN_HZ) && (vco <= CLK_TRIM_VCO_MAX_HZ)) break;
+	}
+	if (odiv > CLK_TRIM_MAX_ODIV) {
+		ESP_LOGE(TAG, "No APLL setting for MCLK %u Hz", mclk);
+		return false;
+	}
+	clk_trim_odiv = odiv;
+	clk_trim_xtal_hz = (uint32_t) rtc_clk_xtal_freq_get() * 1000000;
+	_clkTrimApply();
+	
+	// Divide MCLK from the APLL by the integer alone
+	I2S0.clkm_conf.clkm_div_a = 1;
+	I2S0.clkm_conf.clkm_div_b = 0;
+	I2S0.clkm_conf.clkm_div_num = n;
+	I2S0.clkm_conf.clka_en = 1;
+	
+	clk_trim_active = true;
+	clk_trim_stats.active = true;
+	ESP_LOGI(TAG, "I2S clock from APLL %u Hz / %u (o_div %d), trim %.1f ppm", clk_trim_apll_hz, n, odiv, clk_trim_ppm);
+	return true;
+}
+
+
+void clk_trim_reset()
+{
+	if (clk_trim_frames != 0) {
+		clk_trim_stats.discarded += 1;
+	}
+	clk_trim_have_prev = false;
+	_clkTrimClearPeriod();
+}
+
+
+void clk_trim_eval(int len, int adj, int depth, int target)
+{
+	int64_t now;
+	
+	if (!clk_trim_active) return;
+	
+	now = esp_timer_get_time();
+	if ((clk_trim_frames != 0) && ((now - clk_trim_last_usec) > (CLK_TRIM_GAP_MSEC * 1000))) {
+		// Voice stopped for a while, the depths on either side aren't comparable
+		clk_trim_have_prev = false;
+		_clkTrimClearPeriod();
+	}
+	if (clk_trim_frames == 0) {
+		clk_trim_start_usec = now;
+	}
+	clk_trim_last_usec = now;
+	
+	clk_trim_frames += 1;
+	clk_trim_samples += len + adj;
+	clk_trim_adj += adj;
+	clk_trim_depth_sum += depth;
+	clk_trim_target_sum += target;
+	
+	if ((now - clk_trim_start_usec) >= (CLK_TRIM_PERIOD_MSEC * 1000)) {
+		_clkTrimUpdate();
+	}
+}
+
+
+void clk_trim_get_stats(clk_trim_stats_t* stats)
+{
+	memcpy(stats, &clk_trim_stats, sizeof(clk_trim_stats_t));
+}
+
+
+
+//
+// Internal functions
+//
+
+// Program the APLL for the current rate and trim.  fout = xtal * (4 + sdm2 + sdm1/2^8 + sdm0/2^16)
+// and the APLL output is fout / (2 * (o_div + 2)).
+static void _clkTrimApply()
+{
+	double vco;
+	uint32_t m;
+	
+	vco = (double) clk_trim_apll_hz * 2 * (clk_trim_odiv + 2) * (1.0 + (double) clk_trim_ppm * 1e-6);
+	m = (uint32_t) (vco * 65536.0 / clk_trim_xtal_hz + 0.5);
+	rtc_clk_apll_enable(true, m & 0xFF, (m >> 8) & 0xFF, (m >> 16) - 4, clk_trim_odiv);
+}
+
+
+static void _clkTrimUpdate()
+{
+	float depth, drift_ppm, phase_ppm, step;
+	bool limited = false;
+	
+	depth = (float) clk_trim_depth_sum / clk_trim_frames;
+	
+	if (clk_trim_have_prev && (clk_trim_samples != 0)) {
+		// More audio arrived than was played if the jitter buffer dropped samples or got deeper
+		drift_ppm = ((float) clk_trim_adj + depth - clk_trim_prev_depth) * 1e6f / clk_trim_samples;
+		phase_ppm = (depth - (float) clk_trim_target_sum / clk_trim_frames) * 1e6f / clk_trim_samples;
+		
+		step = CLK_TRIM_KP * drift_ppm + CLK_TRIM_KI * phase_ppm;
+		if (step > CLK_TRIM_STEP_PPM) {
+			step = CLK_TRIM_STEP_PPM;
+			limited = true;
+		} else if (step < -CLK_TRIM_STEP_PPM) {
+			step = -CLK_TRIM_STEP_PPM;
+			limited = true;
+		}
+		clk_trim_ppm += step;
+		if (clk_trim_ppm > CLK_TRIM_MAX_PPM) {
+			clk_trim_ppm = CLK_TRIM_MAX_PPM;
+			limited = true;
+		} else if (clk_trim_ppm < -CLK_TRIM_MAX_PPM) {
+			clk_trim_ppm = -CLK_TRIM_MAX_PPM;
+			limited = true;
+		}
+		_clkTrimApply();
+		
+		clk_trim_stats.trim_ppm10 = (int) lroundf(clk_trim_ppm * 10.0f);
+		clk_trim_stats.drift_ppm10 = (int) lroundf(drift_ppm * 10.0f);
+		clk_trim_stats.updates += 1;
+		if (limited) clk_trim_stats.limited += 1;
+	}
+	
+	clk_trim_prev_depth = depth;
+	clk_trim_have_prev = true;
+	_clkTrimClearPeriod();
+}
+
+
+static void _clkTrimClearPeriod()
+{
+	clk_trim_frames = 0;
+	clk_trim_samples = 0;
+	clk_trim_adj = 0;
+	clk_trim_depth_sum = 0;
+	clk_trim_target_sum = 0;
+}
+
+#endif /* CONFIG_AUDIO_CLK_TRIM */
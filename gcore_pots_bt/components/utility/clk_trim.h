@@ -0,0 +1,90 @@
+/*
+ * clk_trim - utility module trimming the codec's I2S clock to track the Bluetooth SCO clock
+ * during calls.  The two clocks come from different crystals so, left alone, the voice
+ * circular buffer from the phone slowly fills or empties and the jitter buffer has to drop
+ * or insert a sample every so often to hold its depth.  Instead the module runs the I2S
+ * clock from the ESP32's audio PLL (APLL) and nudges the PLL's fractional divider so the
+ * codec consumes audio at the rate the phone sends it.
+ *
+ * clk_trim_start takes over the I2S0 clock after the I2S driver has set it up for a sample
+ * rate: the APLL is run at an integer multiple of MCLK and the I2S clock divider is set to
+ * that integer so only the APLL decides the rate.  Its fractional divider has a resolution
+ * of about 1.5 ppm at the frequencies used.
+ *
+ * The loop is fed once per I2S buffer with the samples consumed, the samples the jitter
+ * buffer dropped (or inserted) and the buffer depth.  Every CLK_TRIM_PERIOD_MSEC it works
+ * out how many more samples arrived than were played (the frequency error) and how far the
+ * average depth is from the jitter buffer's target (the phase error) and moves the trim by a
+ * proportional-integral step limited to CLK_TRIM_STEP_PPM, within CLK_TRIM_MAX_PPM.  The
+ * trim is kept between calls (it's most likely the same phone next time).  Periods with a
+ * jitter buffer re-center (priming, a flush or an underrun) are thrown away.
+ *
+ * The APLL's fractional part doesn't work on revision 0 ESP32 chips so the trim is disabled
+ * there and the I2S driver's clock left alone.  The module is compiled out unless
+ * CONFIG_AUDIO_CLK_TRIM is set.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _CLK_TRIM_H_
+#define _CLK_TRIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Loop evaluation period
+#define CLK_TRIM_PERIOD_MSEC     4000
+
+// Largest change per period and largest trim
+#define CLK_TRIM_STEP_PPM        10
+#define CLK_TRIM_MAX_PPM         200
+
+// Lowest APLL (I2S clock) frequency, MCLK is divided from a multiple of it at least this high
+#define CLK_TRIM_APLL_MIN_HZ     16000000
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	bool active;                          // The APLL is trimmable and drives I2S0
+	int trim_ppm10;                       // Current trim (tenths of a ppm, positive is faster)
+	int drift_ppm10;                      // Frequency error measured in the last period
+	uint32_t updates;                     // Periods evaluated
+	uint32_t limited;                     // Periods the step or trim was limited
+	uint32_t discarded;                   // Periods thrown away after a re-center
+} clk_trim_stats_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_AUDIO_CLK_TRIM == true)
+bool clk_trim_start(uint32_t sample_rate, uint32_t mclk_multiple);  // After each i2s_set_clk
+void clk_trim_reset();                            // Discard the current period (re-center)
+void clk_trim_eval(int len, int adj, int depth, int target);
+void clk_trim_get_stats(clk_trim_stats_t* stats);
+#endif
+
+#endif /* _CLK_TRIM_H_ */
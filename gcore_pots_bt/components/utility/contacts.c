@@ -0,0 +1,364 @@
+/*
+ * contacts - utility module holding a phonebook in PSRAM so Caller ID can include the
+ * caller's name.  The phonebook is loaded in the background at boot from a vCard file
+ * (as exported by the phone's contacts app) on the Micro-SD Card and indexed by the last
+ * digits of each number so a lookup is a binary search.
+ *
+ * Each number is reduced to a key holding its last CONTACTS_KEY_DIGITS digits in reverse
+ * order, one per nibble (digit + 1 so 0 marks a missing digit), with the last digit in the
+ * most significant nibble.  Sorting by key groups numbers by their trailing digits so the
+ * entries that could match a caller are a contiguous range.
+ *
+ * A contact may also carry a distinctive ring id, kept with each of its numbers so pots_task
+ * can pick the ring cadence with the same search between Caller ID and the first ring.
+ *
+ * The card is mounted just long enough to read the file so it is free again for audio
+ * sampling once the phonebook is loaded.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "contacts.h"
+#if (CONFIG_CONTACTS_VCARD_ENABLE == true)
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "international.h"
+#include "sd_card.h"
+
+
+//
+// Constants
+//
+// Loader task
+#define CONTACTS_TASK_STACK 4096
+#define CONTACTS_TASK_PRIO  1
+
+// Longest vCard line handled (longer lines are truncated)
+#define CONTACTS_LINE_LEN   256
+
+// Numbers kept for one vCard while reading it
+#define CONTACTS_MAX_CARD_NUMS 8
+
+// Nibbles of a key compared to select the candidate range
+#define CONTACTS_RANGE_SHIFT (4 * (CONTACTS_KEY_DIGITS - CONTACTS_MIN_DIGITS))
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint64_t key;
+	char name[CONTACTS_NAME_LEN+1];
+	uint8_t ring;                            // Distinctive ring id (0 for the normal ring)
+} contacts_entry_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "contacts";
+
+static contacts_entry_t* entries = NULL;     // PSRAM, sorted by key once loaded
+static int num_entries = 0;
+
+static StackType_t contacts_task_stack[CONTACTS_TASK_STACK];
+static StaticTask_t contacts_task_tcb;
+static atomic_bool loaded = false;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _contacts_task(void* args);
+static void _contacts_read_file(FILE* fp);
+static int _contacts_find(const char* number);
+static void _contacts_add(uint64_t key, const char* name, int ring);
+static void _contacts_set_name(char* dst, const char* src);
+static uint64_t _contacts_key(const char* number, int* num_digits);
+static int _contacts_key_cmp(const void* a, const void* b);
+
+
+
+//
+// API
+//
+void contacts_init()
+{
+	entries = (contacts_entry_t*) heap_caps_malloc(CONTACTS_MAX_ENTRIES * sizeof(contacts_entry_t), MALLOC_CAP_SPIRAM);
+	if (entries == NULL) {
+		ESP_LOGE(TAG, "Could not allocate phonebook");
+		return;
+	}
+	
+	// The load runs below all the other tasks so it never delays boot or a call
+	xTaskCreateStaticPinnedToCore(&_contacts_task, "contacts_task", CONTACTS_TASK_STACK, NULL, CONTACTS_TASK_PRIO, contacts_task_stack, &contacts_task_tcb, 0);
+}
+
+
+bool contacts_lookup(const char* number, char* name)
+{
+	int i = _contacts_find(number);
+	
+	if (i < 0) return false;
+	
+	strcpy(name, entries[i].name);
+	return true;
+}
+
+
+int contacts_lookup_ring(const char* number)
+{
+	int i = _contacts_find(number);
+	
+	return (i < 0) ? 0 : entries[i].ring;
+}
+
+
+
+//
+// Internal functions
+//
+static void _contacts_task(void* args)
+{
+	FILE* fp;
+	int64_t t;
+	
+	if (!sd_card_mount()) {
+		ESP_LOGI(TAG, "No Micro-SD Card for the phonebook");
+		vTaskDelete(NULL);
+	}
+	
+	t = esp_timer_get_time();
+	fp = fopen(CONTACTS_FILE, "r");
+	if (fp == NULL) {
+		ESP_LOGI(TAG, "No %s", CONTACTS_FILE);
+	} else {
+		_contacts_read_file(fp);
+		fclose(fp);
+	}
+	
+	sd_card_unmount();
+	
+	if (num_entries > 0) {
+		qsort(entries, num_entries, sizeof(contacts_entry_t), _contacts_key_cmp);
+		atomic_store(&loaded, true);
+		ESP_LOGI(TAG, "Loaded %d numbers in %d mSec", num_entries, (int) ((esp_timer_get_time() - t) / 1000));
+	}
+	
+	vTaskDelete(NULL);
+}
+
+
+static void _contacts_read_file(FILE* fp)
+{
+	char line[CONTACTS_LINE_LEN];
+	char name[CONTACTS_NAME_LEN+1];
+	char full_name[CONTACTS_LINE_LEN];
+	uint64_t keys[CONTACTS_MAX_CARD_NUMS];
+	int num_keys = 0;
+	int ring = 0;
+	int n, i;
+	bool have_fn = false;
+	char* valP;
+	char* propP;
+	char* cP;
+	
+	name[0] = 0;
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		// Trim the line ending
+		line[strcspn(line, "\r\n")] = 0;
+		
+		// Continuation lines are skipped (names and numbers fit on one line)
+		if ((line[0] == ' ') || (line[0] == '\t')) continue;
+		
+		valP = strchr(line, ':');
+		if (valP == NULL) continue;
+		*valP++ = 0;
+		
+		// The property name, without any parameters or group prefix ("item1.TEL")
+		cP = strchr(line, ';');
+		if (cP != NULL) *cP = 0;
+		propP = strrchr(line, '.');
+		propP = (propP == NULL) ? line : propP + 1;
+		
+		if (strcasecmp(propP, "BEGIN") == 0) {
+			name[0] = 0;
+			have_fn = false;
+			num_keys = 0;
+			ring = 0;
+		} else if (strcasecmp(propP, "FN") == 0) {
+			_contacts_set_name(name, valP);
+			have_fn = true;
+		} else if ((strcasecmp(propP, "N") == 0) && !have_fn) {
+			// "Family;Given;..." used when there is no formatted name
+			cP = strchr(valP, ';');
+			if (cP != NULL) {
+				*cP++ = 0;
+				cP[strcspn(cP, ";")] = 0;
+				snprintf(full_name, sizeof(full_name), "%s %s", cP, valP);
+				_contacts_set_name(name, full_name);
+			} else {
+				_contacts_set_name(name, valP);
+			}
+		} else if (strcasecmp(propP, "TEL") == 0) {
+			if (num_keys < CONTACTS_MAX_CARD_NUMS) {
+				// Parameters after the number (e.g. ";ext=12") aren't part of it
+				cP = strchr(valP, ';');
+				if (cP != NULL) *cP = 0;
+				keys[num_keys] = _contacts_key(valP, &n);
+				if (n >= CONTACTS_MIN_DIGITS) num_keys++;
+			}
+		} else if (strcasecmp(propP, "X-DISTINCTIVE-RING") == 0) {
+			ring = atoi(valP);
+			if ((ring < 0) || (ring > INT_NUM_DIST_RINGS)) ring = 0;
+		} else if (strcasecmp(propP, "END") == 0) {
+			if (name[0] != 0) {
+				for (i=0; i<num_keys; i++) {
+					_contacts_add(keys[i], name, ring);
+				}
+			}
+			num_keys = 0;
+		}
+		
+		if (num_entries == CONTACTS_MAX_ENTRIES) {
+			ESP_LOGW(TAG, "Phonebook full at %d numbers", num_entries);
+			break;
+		}
+	}
+}
+
+
+// Index of the entry best matching number or -1
+static int _contacts_find(const char* number)
+{
+	uint64_t key;
+	uint64_t k;
+	int n;
+	int lo, hi, mid;
+	int i, d;
+	int best = -1;
+	int best_len = 0;
+	int a = 0;
+	int b = 0;
+	
+	if (!atomic_load(&loaded)) return -1;
+	
+	key = _contacts_key(number, &n);
+	if (n < CONTACTS_MIN_DIGITS) return -1;
+	
+	// First entry sharing the caller's last CONTACTS_MIN_DIGITS digits
+	k = key >> CONTACTS_RANGE_SHIFT;
+	lo = 0;
+	hi = num_entries;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if ((entries[mid].key >> CONTACTS_RANGE_SHIFT) < k) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+	
+	// Pick the entry agreeing on the most digits (both numbers must agree on every digit
+	// they both have)
+	for (i=lo; (i<num_entries) && ((entries[i].key >> CONTACTS_RANGE_SHIFT) == k); i++) {
+		for (d=CONTACTS_MIN_DIGITS; d<CONTACTS_KEY_DIGITS; d++) {
+			a = (int) ((key >> (4 * (CONTACTS_KEY_DIGITS - 1 - d))) & 0xF);
+			b = (int) ((entries[i].key >> (4 * (CONTACTS_KEY_DIGITS - 1 - d))) & 0xF);
+			if ((a == 0) || (b == 0) || (a != b)) break;
+		}
+		if ((d == CONTACTS_KEY_DIGITS) || (a == 0) || (b == 0)) {
+			if (d > best_len) {
+				best = i;
+				best_len = d;
+			}
+		}
+	}
+	
+	return best;
+}
+
+
+static void _contacts_add(uint64_t key, const char* name, int ring)
+{
+	if (num_entries < CONTACTS_MAX_ENTRIES) {
+		entries[num_entries].key = key;
+		strcpy(entries[num_entries].name, name);
+		entries[num_entries].ring = (uint8_t) ring;
+		num_entries++;
+	}
+}
+
+
+// Keeps the printable ASCII characters Caller ID displays can show
+static void _contacts_set_name(char* dst, const char* src)
+{
+	int n = 0;
+	
+	while ((*src != 0) && (n < CONTACTS_NAME_LEN)) {
+		if ((*src >= ' ') && (*src <= '~') && (*src != '\\')) {
+			if ((*src != ' ') || ((n > 0) && (dst[n-1] != ' '))) {
+				dst[n++] = *src;
+			}
+		}
+		src++;
+	}
+	while ((n > 0) && (dst[n-1] == ' ')) n--;
+	dst[n] = 0;
+}
+
+
+static uint64_t _contacts_key(const char* number, int* num_digits)
+{
+	uint64_t key = 0;
+	int n = 0;
+	int i;
+	
+	// Digits go in from the end of the number
+	for (i=strlen(number)-1; i>=0; i--) {
+		if ((number[i] >= '0') && (number[i] <= '9')) {
+			if (n < CONTACTS_KEY_DIGITS) {
+				key |= (uint64_t) (number[i] - '0' + 1) << (4 * (CONTACTS_KEY_DIGITS - 1 - n));
+			}
+			n++;
+		}
+	}
+	
+	*num_digits = n;
+	return key;
+}
+
+
+static int _contacts_key_cmp(const void* a, const void* b)
+{
+	uint64_t ka = ((const contacts_entry_t*) a)->key;
+	uint64_t kb = ((const contacts_entry_t*) b)->key;
+	
+	return (ka < kb) ? -1 : ((ka > kb) ? 1 : 0);
+}
+
+#endif /* CONFIG_CONTACTS_VCARD_ENABLE */
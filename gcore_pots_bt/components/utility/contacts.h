@@ -0,0 +1,62 @@
+/*
+ * contacts - utility module holding a phonebook in PSRAM so Caller ID can include the
+ * caller's name.  The phonebook is loaded in the background at boot from a vCard file
+ * (as exported by the phone's contacts app) on the Micro-SD Card and indexed by the last
+ * digits of each number so a lookup is a binary search.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _CONTACTS_H_
+#define _CONTACTS_H_
+
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+//
+// Constants
+//
+
+// vCard file in the root of the Micro-SD Card
+#define CONTACTS_FILE          "/sdcard/contacts.vcf"
+
+// Phone numbers held (a contact with several numbers uses one entry for each)
+#define CONTACTS_MAX_ENTRIES   2048
+
+// Longest name kept (the Bellcore MDMF / ETSI display limit most phones show)
+#define CONTACTS_NAME_LEN      15
+
+// Numbers match on their last CONTACTS_KEY_DIGITS digits or, when one of them is shorter,
+// on all its digits as long as there are at least CONTACTS_MIN_DIGITS (so a caller sent as
+// "+16175551212" finds a contact stored as "617-555-1212")
+#define CONTACTS_KEY_DIGITS    10
+#define CONTACTS_MIN_DIGITS    7
+
+
+
+//
+// API
+//
+#if (CONFIG_CONTACTS_VCARD_ENABLE == true)
+void contacts_init();                                  // Starts the background load
+bool contacts_lookup(const char* number, char* name);  // name must be CONTACTS_NAME_LEN+1 long; false if not found
+int contacts_lookup_ring(const char* number);          // Distinctive ring (see note); 0 if none or not found
+#endif
+
+// Note: A contact gets a distinctive ring from an "X-DISTINCTIVE-RING:<n>" property in its
+// vCard, where n selects one of the cadences from int_get_dist_ring_info().
+
+#endif /* _CONTACTS_H_ */
@@ -0,0 +1,268 @@
+/*
+ * dial_plan - utility module deciding, digit by digit, when a number dialed on the POTS
+ * phone is complete so it can be dialed without waiting for the post-dial timeout.  Each
+ * country lists the patterns of the numbers that can be dialed (international.c) and these
+ * are compiled into a table of the keys accepted at each position.
+ *
+ * A number is tracked against all the patterns at once with one bit per pattern still
+ * matching, so each digit costs one mask test per live pattern.  The speed dial codes are
+ * compiled after the country's patterns and only start live when their entry is in use.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "dial_plan.h"
+#include "international.h"
+#include "esp_log.h"
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Key mask bits (digits are bits 0-9)
+#define KEY_STAR   (1 << 10)
+#define KEY_POUND  (1 << 11)
+#define KEY_DIGITS 0x03FF
+
+// Speed dial patterns: redial, entries 1-9 and the store code (entry from its last digit)
+#define SPEED_REDIAL_PATTERN "!##"
+#define SPEED_STORE_PATTERN  "!*0Z"
+#define NUM_SPEED_PATTERNS   (DIAL_PLAN_SPEED_ENTRIES + 1)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint16_t keys[DIAL_PLAN_MAX_LEN];      // Keys accepted at each position
+	uint8_t len;
+	bool open;                             // Trailing '.'
+	bool immediate;                        // Leading '!'
+} dial_plan_pattern_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "dial_plan";
+
+// Compiled dial plan for the current country
+static int cur_country = -1;
+static int num_patterns = 0;
+static int speed_base = 0;                 // Index of the first speed dial pattern
+static dial_plan_pattern_t patterns[DIAL_PLAN_MAX_PATTERNS];
+
+// Speed dial entries in use
+static uint16_t speed_mask = 0;
+
+// Number being dialed
+static uint32_t live_mask;                 // Patterns still matching
+static int num_digits;
+static int speed_entry = -1;               // Entry matched by the last digit
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _dialPlanCompile(int country);
+static void _dialPlanCompileSpeed();
+static bool _dialPlanCompilePattern(const char* s, dial_plan_pattern_t* p);
+static uint16_t _dialPlanKey(char c);
+
+
+
+//
+// API
+//
+void dial_plan_start(int country)
+{
+	if (country != cur_country) {
+		_dialPlanCompile(country);
+		cur_country = country;
+	}
+	
+	// Country patterns plus the speed dial codes in use (storing needs a redial number)
+	live_mask = (1UL << speed_base) - 1;
+	live_mask |= (uint32_t) (speed_mask & ((1 << DIAL_PLAN_SPEED_ENTRIES) - 1)) << speed_base;
+	if ((speed_mask & 0x0001) != 0) {
+		live_mask |= 1UL << (speed_base + DIAL_PLAN_SPEED_ENTRIES);
+	}
+	num_digits = 0;
+	speed_entry = -1;
+}
+
+
+int dial_plan_push_digit(char c)
+{
+	uint16_t key = _dialPlanKey(c);
+	bool complete = false;
+	bool more = false;
+	int i;
+	int pos = num_digits++;
+	
+	speed_entry = -1;
+	for (i=0; i<num_patterns; i++) {
+		if ((live_mask & (1UL << i)) == 0) continue;
+		
+		if (pos < patterns[i].len) {
+			if ((patterns[i].keys[pos] & key) == 0) {
+				live_mask &= ~(1UL << i);
+				continue;
+			}
+		} else if (!patterns[i].open || ((key & KEY_DIGITS) == 0)) {
+			live_mask &= ~(1UL << i);
+			continue;
+		}
+		
+		if ((num_digits == patterns[i].len) && !patterns[i].open) {
+			if (patterns[i].immediate) {
+				if (i < speed_base) return DIAL_PLAN_COMPLETE;
+				if (i == (speed_base + DIAL_PLAN_SPEED_ENTRIES)) {
+					speed_entry = c - '0';
+					return DIAL_PLAN_SPEED_STORE;
+				}
+				speed_entry = i - speed_base;
+				return DIAL_PLAN_SPEED_DIAL;
+			}
+			complete = true;
+		} else {
+			more = true;
+		}
+	}
+	
+	if (more) return DIAL_PLAN_PARTIAL;
+	if (complete) return DIAL_PLAN_COMPLETE;
+	return DIAL_PLAN_NO_MATCH;
+}
+
+
+void dial_plan_set_speed_mask(uint16_t mask)
+{
+	speed_mask = mask;
+}
+
+
+int dial_plan_get_speed_entry()
+{
+	return speed_entry;
+}
+
+
+
+//
+// Internal functions
+//
+static void _dialPlanCompile(int country)
+{
+	const country_info_t* infoP = int_get_country_info(country);
+	const char* const* sP;
+	
+	num_patterns = 0;
+	if ((infoP != NULL) && (infoP->dial_plan != NULL)) {
+		for (sP = infoP->dial_plan; *sP != NULL; sP++) {
+			if (num_patterns == (DIAL_PLAN_MAX_PATTERNS - NUM_SPEED_PATTERNS)) {
+				ESP_LOGW(TAG, "%s: too many patterns", infoP->name);
+				break;
+			}
+			if (_dialPlanCompilePattern(*sP, &patterns[num_patterns])) {
+				num_patterns++;
+			} else {
+				ESP_LOGE(TAG, "%s: bad pattern %s", infoP->name, *sP);
+			}
+		}
+	}
+	
+	_dialPlanCompileSpeed();
+}
+
+
+// Speed dial patterns follow the country's in entry order with the store code last
+static void _dialPlanCompileSpeed()
+{
+	char s[4] = "!*N";
+	int i;
+	
+	speed_base = num_patterns;
+	(void) _dialPlanCompilePattern(SPEED_REDIAL_PATTERN, &patterns[num_patterns++]);
+	for (i=1; i<DIAL_PLAN_SPEED_ENTRIES; i++) {
+		s[2] = '0' + i;
+		(void) _dialPlanCompilePattern(s, &patterns[num_patterns++]);
+	}
+	(void) _dialPlanCompilePattern(SPEED_STORE_PATTERN, &patterns[num_patterns++]);
+}
+
+
+static bool _dialPlanCompilePattern(const char* s, dial_plan_pattern_t* p)
+{
+	uint16_t m;
+	char lo;
+	
+	p->len = 0;
+	p->open = false;
+	p->immediate = (*s == '!');
+	if (p->immediate) s++;
+	
+	while (*s != 0) {
+		if (*s == '.') {
+			// Must be last and follow at least one position
+			if ((*(s+1) != 0) || (p->len == 0)) return false;
+			p->open = true;
+			break;
+		}
+		
+		if (p->len == DIAL_PLAN_MAX_LEN) return false;
+		
+		switch (*s) {
+			case 'X': m = KEY_DIGITS; break;
+			case 'N': m = KEY_DIGITS & ~0x0003; break;
+			case 'Z': m = KEY_DIGITS & ~0x0001; break;
+			case '[':
+				m = 0;
+				while (*++s != ']') {
+					if ((*s < '0') || (*s > '9')) return false;
+					if ((*(s+1) == '-') && (*(s+2) >= *s) && (*(s+2) <= '9')) {
+						for (lo = *s; lo <= *(s+2); lo++) m |= _dialPlanKey(lo);
+						s += 2;
+					} else {
+						m |= _dialPlanKey(*s);
+					}
+				}
+				break;
+			default:
+				m = _dialPlanKey(*s);
+		}
+		if (m == 0) return false;
+		
+		p->keys[p->len++] = m;
+		s++;
+	}
+	
+	return (p->len != 0);
+}
+
+
+static uint16_t _dialPlanKey(char c)
+{
+	if ((c >= '0') && (c <= '9')) return (1 << (c - '0'));
+	if (c == '*') return KEY_STAR;
+	if (c == '#') return KEY_POUND;
+	return 0;
+}
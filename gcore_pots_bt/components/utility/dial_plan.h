@@ -0,0 +1,73 @@
+/*
+ * dial_plan - utility module deciding, digit by digit, when a number dialed on the POTS
+ * phone is complete so it can be dialed without waiting for the post-dial timeout.  Each
+ * country lists the patterns of the numbers that can be dialed (international.c) and these
+ * are compiled into a table of the keys accepted at each position.
+ *
+ * Pattern syntax
+ *   0-9 * #  : That key
+ *   X        : Any digit 0-9
+ *   N        : Any digit 2-9
+ *   Z        : Any digit 1-9
+ *   [...]    : Any of the digits listed, ranges allowed (e.g. [3-79])
+ *   .        : (Last character only) One or more further digits - never complete
+ *   !        : (First character only) Complete as soon as matched even if a longer
+ *              pattern could also match (emergency and short codes)
+ *
+ * Speed dial codes are matched alongside the country's patterns when their entry is in use
+ *   ##       : Redial (entry 0)
+ *   *1 - *9  : Speed dial entries 1-9
+ *   *01-*09  : Store the redial number in entry 1-9
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _DIAL_PLAN_H_
+#define _DIAL_PLAN_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Limits of a country's dial plan (patterns beyond these are ignored)
+#define DIAL_PLAN_MAX_PATTERNS 32
+#define DIAL_PLAN_MAX_LEN      16
+
+// dial_plan_push_digit results
+#define DIAL_PLAN_NO_MATCH     0        // Not a number the dial plan knows (wait for the timeout)
+#define DIAL_PLAN_PARTIAL      1        // More digits may follow (wait for the timeout)
+#define DIAL_PLAN_COMPLETE     2        // Dial now
+#define DIAL_PLAN_SPEED_DIAL   3        // Dial speed dial entry dial_plan_get_speed_entry() now
+#define DIAL_PLAN_SPEED_STORE  4        // Store the redial number in entry dial_plan_get_speed_entry()
+
+// Speed dial entries (entry 0 is redial)
+#define DIAL_PLAN_SPEED_ENTRIES 10
+
+
+
+//
+// API
+//
+void dial_plan_start(int country);       // Country index as used by int_get_country_info; call before the first digit
+int dial_plan_push_digit(char c);        // Returns the state of the number dialed so far
+void dial_plan_set_speed_mask(uint16_t mask);  // Bit n set for each speed dial entry in use; call before dial_plan_start
+int dial_plan_get_speed_entry();         // Entry for the last DIAL_PLAN_SPEED_DIAL or DIAL_PLAN_SPEED_STORE result
+
+#endif /* _DIAL_PLAN_H_ */
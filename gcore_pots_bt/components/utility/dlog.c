@@ -0,0 +1,369 @@
+/*
+ * dlog - utility module implementing deferred logging through a lock-free ring of
+ * unformatted records emptied by a lowest priority task.
+ *
+ * The ring is a bounded multi-producer queue: each record has a sequence count that tells
+ * a producer it is free for the position it reserved (by advancing the head with a
+ * compare-and-swap) and tells the log task it has been filled.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "dlog.h"
+#include <stdarg.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+
+
+//
+// Constants
+//
+
+#define DLOG_RING_MASK      (DLOG_RING_LEN - 1)
+
+// Log task
+#define DLOG_TASK_STACK     3072
+#define DLOG_TASK_PRIORITY  1
+
+// Longest formatted message
+#define DLOG_LINE_LEN       192
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	atomic_uint seq;                      // Position this record is free for, or filled at + 1
+	uint32_t msec;                        // esp_log_timestamp() when written
+	const char* fmt;
+	const char* tag;
+	uint8_t level;
+	uint8_t num_args;                     // 0xFF if the format couldn't be captured
+	uint8_t str_mask;                     // Bit set for each argument that is an offset into str
+	uint8_t str_len;
+	uint32_t args[DLOG_MAX_ARGS];
+	char str[DLOG_STR_LEN];
+} dlog_rec_t;
+
+typedef struct {
+	const char* name;
+	esp_log_level_t level;
+} dlog_tag_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "dlog";
+
+static const char dlog_level_char[] = {'N', 'E', 'W', 'I', 'D', 'V'};
+
+static dlog_rec_t* dlog_ring = NULL;
+static atomic_uint dlog_head = 0;         // Next position a producer reserves
+static unsigned int dlog_tail = 0;        // Next position the log task reads
+static atomic_uint dlog_dropped = 0;
+
+static TaskHandle_t dlog_task_handle = NULL;
+static StackType_t dlog_task_stack[DLOG_TASK_STACK];
+static StaticTask_t dlog_task_tcb;
+
+static portMUX_TYPE dlog_tag_mux = portMUX_INITIALIZER_UNLOCKED;
+static dlog_tag_t dlog_tags[DLOG_MAX_TAGS];
+static int dlog_num_tags = 0;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _dlogTask(void* args);
+static esp_log_level_t _dlogGetLevel(const char* tag);
+static void _dlogCapture(dlog_rec_t* r, const char* fmt, va_list ap);
+static void _dlogOutput(const dlog_rec_t* r);
+
+
+
+//
+// API
+//
+bool dlog_init()
+{
+	int i;
+	
+	// The records don't need internal RAM (only the head is compare-and-swapped)
+	dlog_ring = heap_caps_malloc(DLOG_RING_LEN * sizeof(dlog_rec_t), MALLOC_CAP_SPIRAM);
+	if (dlog_ring == NULL) {
+		dlog_ring = heap_caps_malloc(DLOG_RING_LEN * sizeof(dlog_rec_t), MALLOC_CAP_INTERNAL);
+	}
+	if (dlog_ring == NULL) {
+		ESP_LOGE(TAG, "Could not allocate ring");
+		return false;
+	}
+	for (i=0; i<DLOG_RING_LEN; i++) {
+		atomic_store(&dlog_ring[i].seq, (unsigned int) i);
+	}
+	
+	dlog_task_handle = xTaskCreateStaticPinnedToCore(&_dlogTask, "dlog_task", DLOG_TASK_STACK, NULL, DLOG_TASK_PRIORITY, dlog_task_stack, &dlog_task_tcb, 0);
+	if (dlog_task_handle == NULL) {
+		ESP_LOGE(TAG, "Could not create task");
+		heap_caps_free(dlog_ring);
+		dlog_ring = NULL;
+		return false;
+	}
+	
+	return true;
+}
+
+
+void dlog_write(esp_log_level_t level, const char* tag, const char* fmt, ...)
+{
+	va_list ap;
+	unsigned int pos;
+	unsigned int seq;
+	int dif;
+	dlog_rec_t* r;
+	
+	if (level > _dlogGetLevel(tag)) return;
+	
+	va_start(ap, fmt);
+	if (dlog_ring == NULL) {
+		// Not running yet so log directly
+		esp_log_write(level, tag, "%c (%u) %s: ", dlog_level_char[level], esp_log_timestamp(), tag);
+		esp_log_writev(level, tag, fmt, ap);
+		esp_log_write(level, tag, "\n");
+		va_end(ap);
+		return;
+	}
+	
+	// Reserve a record
+	pos = atomic_load(&dlog_head);
+	for (;;) {
+		r = &dlog_ring[pos & DLOG_RING_MASK];
+		seq = atomic_load_explicit(&r->seq, memory_order_acquire);
+		dif = (int) (seq - pos);
+		if (dif == 0) {
+			if (atomic_compare_exchange_weak(&dlog_head, &pos, pos + 1)) break;
+		} else if (dif < 0) {
+			// Full
+			atomic_fetch_add(&dlog_dropped, 1);
+			va_end(ap);
+			return;
+		} else {
+			// Another producer got this one
+			pos = atomic_load(&dlog_head);
+		}
+	}
+	
+	r->msec = esp_log_timestamp();
+	r->tag = tag;
+	r->level = (uint8_t) level;
+	_dlogCapture(r, fmt, ap);
+	va_end(ap);
+	
+	atomic_store_explicit(&r->seq, pos + 1, memory_order_release);
+	xTaskNotifyGive(dlog_task_handle);
+}
+
+
+void dlog_set_level(const char* tag, esp_log_level_t level)
+{
+	int i;
+	
+	portENTER_CRITICAL(&dlog_tag_mux);
+	for (i=0; i<dlog_num_tags; i++) {
+		if (strcmp(dlog_tags[i].name, tag) == 0) break;
+	}
+	if (i < DLOG_MAX_TAGS) {
+		dlog_tags[i].level = level;
+		if (i == dlog_num_tags) {
+			dlog_tags[i].name = tag;
+			dlog_num_tags++;
+		}
+	}
+	portEXIT_CRITICAL(&dlog_tag_mux);
+	
+	// Also let the text output through
+	esp_log_level_set(tag, level);
+	
+	if (i == DLOG_MAX_TAGS) {
+		ESP_LOGE(TAG, "Too many tags for %s", tag);
+	}
+}
+
+
+uint32_t dlog_get_dropped()
+{
+	return atomic_load(&dlog_dropped);
+}
+
+
+
+//
+// Internal functions
+//
+static void _dlogTask(void* args)
+{
+	static dlog_rec_t rec;   // Copy so the record is released before the slow output
+	dlog_rec_t* r;
+	uint32_t reported_dropped = 0;
+	uint32_t dropped;
+	
+	while (true) {
+		(void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		
+		for (;;) {
+			r = &dlog_ring[dlog_tail & DLOG_RING_MASK];
+			if (atomic_load_explicit(&r->seq, memory_order_acquire) != (dlog_tail + 1)) break;
+			
+			memcpy(((uint8_t*) &rec) + sizeof(atomic_uint), ((uint8_t*) r) + sizeof(atomic_uint),
+			       sizeof(dlog_rec_t) - sizeof(atomic_uint));
+			atomic_store_explicit(&r->seq, dlog_tail + DLOG_RING_LEN, memory_order_release);
+			dlog_tail++;
+			
+			_dlogOutput(&rec);
+		}
+		
+		dropped = atomic_load(&dlog_dropped);
+		if (dropped != reported_dropped) {
+			ESP_LOGW(TAG, "%u records dropped", dropped - reported_dropped);
+			reported_dropped = dropped;
+		}
+	}
+}
+
+
+static esp_log_level_t _dlogGetLevel(const char* tag)
+{
+	int i;
+	int n = dlog_num_tags;
+	
+	// Entries are complete before dlog_num_tags counts them
+	for (i=0; i<n; i++) {
+		if ((dlog_tags[i].name == tag) || (strcmp(dlog_tags[i].name, tag) == 0)) {
+			return dlog_tags[i].level;
+		}
+	}
+	return (esp_log_level_t) CONFIG_LOG_DEFAULT_LEVEL;
+}
+
+
+// Copy the arguments the format's conversions take
+static void _dlogCapture(dlog_rec_t* r, const char* fmt, va_list ap)
+{
+	const char* cP = fmt;
+	const char* s;
+	int n = 0;
+	int len;
+	int room;
+	
+	r->fmt = fmt;
+	r->str_mask = 0;
+	r->str_len = 0;
+	
+	while (*cP != 0) {
+		if (*cP++ != '%') continue;
+		if (*cP == '%') {
+			cP++;
+			continue;
+		}
+		
+		// Flags, width, precision and length (a '*' takes an argument)
+		while ((*cP != 0) && (strchr("-+ #0123456789.*lhzjt", *cP) != NULL)) {
+			if (*cP == '*') {
+				if (n == DLOG_MAX_ARGS) goto uncaptured;
+				r->args[n++] = va_arg(ap, uint32_t);
+			}
+			cP++;
+		}
+		if ((*cP == 0) || (n == DLOG_MAX_ARGS) || (strchr("fFeEgGaAn", *cP) != NULL)) goto uncaptured;
+		
+		if (*cP == 's') {
+			s = va_arg(ap, const char*);
+			if (s == NULL) s = "(null)";
+			
+			// Strings are packed into str, truncated if they don't all fit
+			room = DLOG_STR_LEN - r->str_len;
+			if (room == 0) {
+				// Empty (point at the last terminator)
+				r->args[n] = DLOG_STR_LEN - 1;
+			} else {
+				len = strlen(s);
+				if (len > (room - 1)) len = room - 1;
+				r->args[n] = r->str_len;
+				memcpy(&r->str[r->str_len], s, len);
+				r->str[r->str_len + len] = 0;
+				r->str_len += len + 1;
+			}
+			r->str_mask |= 1 << n;
+			n++;
+		} else {
+			r->args[n++] = va_arg(ap, uint32_t);
+		}
+		cP++;
+	}
+	
+	r->num_args = n;
+	return;
+	
+uncaptured:
+	// Output the format itself
+	r->num_args = 0xFF;
+}
+
+
+static void _dlogOutput(const dlog_rec_t* r)
+{
+	static char line[DLOG_LINE_LEN];
+	int i;
+#if (CONFIG_DLOG_BINARY_OUTPUT == true)
+	char* cP = line;
+	
+	// Record with the format and tag as addresses for the host decoder
+	cP += sprintf(cP, "#DL %08x%08x%08x%02x%02x%02x%02x", r->msec, (uint32_t) (uintptr_t) r->fmt,
+	              (uint32_t) (uintptr_t) r->tag, r->level, r->num_args, r->str_mask, r->str_len);
+	for (i=0; (r->num_args != 0xFF) && (i<r->num_args); i++) {
+		cP += sprintf(cP, "%08x", r->args[i]);
+	}
+	for (i=0; (r->num_args != 0xFF) && (i<r->str_len) && (i<DLOG_STR_LEN); i++) {
+		cP += sprintf(cP, "%02x", (uint8_t) r->str[i]);
+	}
+	esp_log_write(r->level, r->tag, "%s\n", line);
+#else
+	uintptr_t a[DLOG_MAX_ARGS];
+	char c = (r->level < sizeof(dlog_level_char)) ? dlog_level_char[r->level] : '?';
+	
+	if (r->num_args == 0xFF) {
+		esp_log_write(r->level, r->tag, "%c (%u) %s: %s\n", c, r->msec, r->tag, r->fmt);
+		return;
+	}
+	
+	for (i=0; i<DLOG_MAX_ARGS; i++) {
+		if ((i < r->num_args) && ((r->str_mask & (1 << i)) != 0)) {
+			a[i] = (uintptr_t) &r->str[r->args[i]];
+		} else {
+			a[i] = (i < r->num_args) ? r->args[i] : 0;
+		}
+	}
+	snprintf(line, sizeof(line), r->fmt, a[0], a[1], a[2], a[3], a[4], a[5]);
+	esp_log_write(r->level, r->tag, "%c (%u) %s: %s\n", c, r->msec, r->tag, line);
+#endif
+}
@@ -0,0 +1,73 @@
+/*
+ * dlog - utility module implementing deferred logging.  DLOGx calls copy their format
+ * pointer, integer arguments and any string arguments into a fixed-size record in a
+ * lock-free ring without formatting anything, and a lowest priority task formats the
+ * records and writes them to the console (as text, or with CONFIG_DLOG_BINARY_OUTPUT as
+ * hex encoded records decoded on the host by tools/dlog_decode.py using the ELF file).
+ * Logging from Bluetooth callbacks and the state machines then never waits on the UART.
+ *
+ * Arguments must be 32-bit (int, char, pointers, %ld but not %lld) or strings.  Floating
+ * point isn't supported.  String arguments are copied (together up to DLOG_STR_LEN
+ * bytes) so they may be temporary.  Tags must be strings that live forever (a file's TAG).
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _DLOG_H_
+#define _DLOG_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "esp_log.h"
+
+
+
+//
+// Constants
+//
+
+// Records in the ring (must be a power of 2)
+#define DLOG_RING_LEN       128
+
+// Most integer arguments in one record
+#define DLOG_MAX_ARGS       8
+
+// Storage for the string arguments of one record (including their terminators)
+#define DLOG_STR_LEN        48
+
+// Most tags with their own level
+#define DLOG_MAX_TAGS       16
+
+
+
+//
+// Logging macros
+//
+#define DLOGE(tag, fmt, ...) dlog_write(ESP_LOG_ERROR, tag, fmt, ##__VA_ARGS__)
+#define DLOGW(tag, fmt, ...) dlog_write(ESP_LOG_WARN, tag, fmt, ##__VA_ARGS__)
+#define DLOGI(tag, fmt, ...) dlog_write(ESP_LOG_INFO, tag, fmt, ##__VA_ARGS__)
+#define DLOGD(tag, fmt, ...) dlog_write(ESP_LOG_DEBUG, tag, fmt, ##__VA_ARGS__)
+
+
+
+//
+// API
+//
+bool dlog_init();                                       // Call from app_main before the tasks start
+void dlog_write(esp_log_level_t level, const char* tag, const char* fmt, ...) __attribute__ ((format (printf, 3, 4)));
+void dlog_set_level(const char* tag, esp_log_level_t level);  // Tags default to CONFIG_LOG_DEFAULT_LEVEL
+uint32_t dlog_get_dropped();                            // Records lost because the ring was full
+
+#endif /* _DLOG_H_ */
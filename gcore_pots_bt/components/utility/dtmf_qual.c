@@ -0,0 +1,88 @@
+/*
+ * dtmf_qual - utility module keeping the signal quality of the DTMF digits pots_task
+ * receives.  See dtmf_qual.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "dtmf_qual.h"
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+
+
+//
+// Variables
+//
+static portMUX_TYPE dtmf_qual_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static dtmf_rx_quality_t dtmf_qual_ring[DTMF_QUAL_RING_LEN];
+static int dtmf_qual_ring_index = 0;
+
+static dtmf_qual_stats_t dtmf_qual_stats;
+
+
+
+//
+// API
+//
+void dtmf_qual_add(const dtmf_rx_quality_t* q)
+{
+	dtmf_qual_stats_t* s = &dtmf_qual_stats;
+	
+	portENTER_CRITICAL(&dtmf_qual_mux);
+	dtmf_qual_ring[dtmf_qual_ring_index] = *q;
+	if (++dtmf_qual_ring_index == DTMF_QUAL_RING_LEN) dtmf_qual_ring_index = 0;
+	if (s->recent < DTMF_QUAL_RING_LEN) s->recent += 1;
+	
+	if ((s->digits == 0) || (q->level_margin < s->min_level_margin)) s->min_level_margin = q->level_margin;
+	if ((s->digits == 0) || (q->snr_margin < s->min_snr_margin)) s->min_snr_margin = q->snr_margin;
+	if ((s->digits == 0) || (abs(q->twist) > abs(s->max_twist))) s->max_twist = q->twist;
+	if ((s->digits == 0) || (q->duration < s->min_duration)) s->min_duration = q->duration;
+	s->digits += 1;
+	portEXIT_CRITICAL(&dtmf_qual_mux);
+}
+
+
+void dtmf_qual_note_multi()
+{
+	portENTER_CRITICAL(&dtmf_qual_mux);
+	dtmf_qual_stats.multi += 1;
+	portEXIT_CRITICAL(&dtmf_qual_mux);
+}
+
+
+void dtmf_qual_get_stats(dtmf_qual_stats_t* stats)
+{
+	int i, n;
+	
+	portENTER_CRITICAL(&dtmf_qual_mux);
+	memcpy(stats, &dtmf_qual_stats, sizeof(dtmf_qual_stats_t));
+	n = stats->recent;
+	for (i=0; i<n; i++) {
+		// Oldest first
+		stats->q[i] = dtmf_qual_ring[(dtmf_qual_ring_index - n + i + DTMF_QUAL_RING_LEN) % DTMF_QUAL_RING_LEN];
+	}
+	portEXIT_CRITICAL(&dtmf_qual_mux);
+}
+
+
+void dtmf_qual_reset_stats()
+{
+	portENTER_CRITICAL(&dtmf_qual_mux);
+	memset(&dtmf_qual_stats, 0, sizeof(dtmf_qual_stats_t));
+	dtmf_qual_ring_index = 0;
+	portEXIT_CRITICAL(&dtmf_qual_mux);
+}
@@ -0,0 +1,68 @@
+/*
+ * dtmf_qual - utility module keeping the signal quality of the DTMF digits pots_task
+ * receives so weak or badly balanced keypads can be diagnosed without test equipment.  The
+ * spandsp DTMF receiver reports each digit as it ends (dtmf_rx_quality_t) from values it
+ * already computes: the row and column tone levels and twist of the digit's weakest block,
+ * the weaker tone's margin over the detection threshold, the margin over the fraction of
+ * total energy (SNR) test and how long the tones lasted.  The last DTMF_QUAL_RING_LEN digits
+ * are kept along with the worst of each since reset and the times more than one digit arrived
+ * in one block of audio.  The "dtmf" console command shows them.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _DTMF_QUAL_H_
+#define _DTMF_QUAL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "spandsp.h"
+
+
+
+//
+// Constants
+//
+
+// Digits kept
+#define DTMF_QUAL_RING_LEN       16
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t digits;                      // Digits reported
+	uint32_t multi;                       // Times more than one digit was received at once
+	int recent;                           // Digits in q[], oldest first
+	dtmf_rx_quality_t q[DTMF_QUAL_RING_LEN];
+	int min_level_margin;                 // Worst since reset (dB x10, valid when digits != 0)
+	int min_snr_margin;
+	int max_twist;                        // Largest in either direction
+	int min_duration;                     // Samples
+} dtmf_qual_stats_t;
+
+
+
+//
+// API
+//
+void dtmf_qual_add(const dtmf_rx_quality_t* q);   // dtmf_rx quality callback data
+void dtmf_qual_note_multi();                      // dtmf_rx delivered more than one digit at once
+void dtmf_qual_get_stats(dtmf_qual_stats_t* stats);
+void dtmf_qual_reset_stats();
+
+#endif /* _DTMF_QUAL_H_ */
@@ -0,0 +1,70 @@
+/*
+ * eq - utility module providing the handset equalizers.
+ *
+ * Profiles are indexed by PS_EQ_PROFILE_* and have coefficients for 8 kHz and 16 kHz.  An
+ * unknown profile or rate leaves the audio unfiltered.  Each section saturates at full
+ * scale so the profiles only boost a few dB.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "eq.h"
+#include "eq_profiles.h"
+
+#if (EQ_PROFILE_STAGES != EQ_MAX_STAGES)
+#error "eq_profiles.h doesn't match EQ_MAX_STAGES"
+#endif
+
+
+
+//
+// API
+//
+void eq_init(eq_state_t* s, int profile, int path, int rate)
+{
+	int i;
+	int r;
+	
+	s->stages = 0;
+	if ((profile < 0) || (profile >= EQ_PROFILE_NUM)) return;
+	if (rate == 8000) {
+		r = 0;
+	} else if (rate == 16000) {
+		r = 1;
+	} else {
+		return;
+	}
+	
+	s->stages = eq_profile_stages[profile][path];
+	for (i=0; i<s->stages; i++) {
+		biquad_init_coeffs(&s->bq[i], eq_profile_coeffs[profile][path][r][i]);
+	}
+}
+
+
+bool eq_active(const eq_state_t* s)
+{
+	return (s->stages != 0);
+}
+
+
+void eq_process(eq_state_t* s, int16_t* buf, int len)
+{
+	int i;
+	
+	for (i=0; i<s->stages; i++) {
+		biquad_process(&s->bq[i], buf, len);
+	}
+}
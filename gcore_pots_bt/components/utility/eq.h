@@ -0,0 +1,61 @@
+/*
+ * eq - utility module providing the handset equalizers.  Each profile is a cascade of up to
+ * EQ_MAX_STAGES fixed-point biquads for each direction, designed ahead of time by
+ * tools/eq_design.py (components/audio_assets/eq_profiles.h), and processed a block of
+ * samples at a time.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _EQ_H_
+#define _EQ_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "biquad.h"
+
+
+
+//
+// Constants
+//
+
+// Most biquads in a cascade (must match tools/eq_design.py)
+#define EQ_MAX_STAGES 3
+
+// Directions
+#define EQ_PATH_MIC   0       // Line audio from the phone, sent to the cellphone
+#define EQ_PATH_SPK   1       // Cellphone audio played to the phone
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int stages;                           // 0 when the profile leaves this direction flat
+	biquad_state_t bq[EQ_MAX_STAGES];
+} eq_state_t;
+
+
+
+//
+// API
+//
+void eq_init(eq_state_t* s, int profile, int path, int rate);   // profile is PS_EQ_PROFILE_*
+bool eq_active(const eq_state_t* s);
+void eq_process(eq_state_t* s, int16_t* buf, int len);          // In place
+
+#endif /* _EQ_H_ */
@@ -0,0 +1,191 @@
+/*
+ * evt_bus - utility module implementing a small inter-task event bus of per-task queues
+ * of fixed-size typed messages.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "evt_bus.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/queue.h"
+
+
+//
+// Constants
+//
+
+// Running average latency weight (1/2^n of each new message)
+#define EVT_BUS_AVG_SHIFT    3
+
+
+
+//
+// Variables
+//
+static const char* TAG = "evt_bus";
+
+static portMUX_TYPE evt_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static QueueHandle_t evt_queue[EVT_BUS_MAX_QUEUES];
+static StaticQueue_t evt_queue_buf[EVT_BUS_MAX_QUEUES];
+static uint8_t evt_queue_storage[EVT_BUS_MAX_QUEUES][EVT_BUS_MAX_DEPTH * sizeof(evt_msg_t)];
+static evt_bus_stats_t evt_stats[EVT_BUS_MAX_QUEUES];
+
+
+
+//
+// API
+//
+bool evt_bus_create(int q, const char* name, int depth)
+{
+	if ((q < 0) || (q >= EVT_BUS_MAX_QUEUES) || (evt_queue[q] != NULL)) return false;
+	if ((depth < 1) || (depth > EVT_BUS_MAX_DEPTH)) {
+		ESP_LOGE(TAG, "%s queue depth %d over %d", name, depth, EVT_BUS_MAX_DEPTH);
+		return false;
+	}
+	
+	evt_queue[q] = xQueueCreateStatic(depth, sizeof(evt_msg_t), evt_queue_storage[q], &evt_queue_buf[q]);
+	if (evt_queue[q] == NULL) {
+		ESP_LOGE(TAG, "Could not create %s queue", name);
+		return false;
+	}
+	
+	memset(&evt_stats[q], 0, sizeof(evt_bus_stats_t));
+	evt_stats[q].name = name;
+	evt_stats[q].depth = depth;
+	return true;
+}
+
+
+bool evt_bus_send(int q, evt_msg_t* msg)
+{
+	bool sent;
+	int waiting;
+	
+	if ((q < 0) || (q >= EVT_BUS_MAX_QUEUES) || (evt_queue[q] == NULL)) return false;
+	
+	msg->sent_usec = (uint32_t) esp_timer_get_time();
+	sent = (xQueueSend(evt_queue[q], msg, 0) == pdTRUE);
+	waiting = (int) uxQueueMessagesWaiting(evt_queue[q]);
+	
+	portENTER_CRITICAL(&evt_mux);
+	if (sent) {
+		evt_stats[q].sent++;
+	} else {
+		evt_stats[q].dropped++;
+	}
+	if (waiting > evt_stats[q].high_water) evt_stats[q].high_water = waiting;
+	portEXIT_CRITICAL(&evt_mux);
+	
+	if (!sent) {
+		ESP_LOGW(TAG, "%s queue full - dropped event %d", evt_stats[q].name, msg->id);
+	}
+	return sent;
+}
+
+
+bool evt_bus_send_id(int q, uint16_t id)
+{
+	evt_msg_t msg;
+	
+	msg.id = id;
+	return evt_bus_send(q, &msg);
+}
+
+
+bool evt_bus_send_digit(int q, uint16_t id, char d)
+{
+	evt_msg_t msg;
+	
+	msg.id = id;
+	msg.u.digit = d;
+	return evt_bus_send(q, &msg);
+}
+
+
+bool evt_bus_send_gain(int q, uint16_t id, float g)
+{
+	evt_msg_t msg;
+	
+	msg.id = id;
+	msg.u.gain = g;
+	return evt_bus_send(q, &msg);
+}
+
+
+bool evt_bus_send_str(int q, uint16_t id, const char* s)
+{
+	evt_msg_t msg;
+	
+	msg.id = id;
+	if (s == NULL) {
+		msg.u.str[0] = 0;
+	} else {
+		strncpy(msg.u.str, s, EVT_BUS_STR_LEN);
+		msg.u.str[EVT_BUS_STR_LEN] = 0;
+	}
+	return evt_bus_send(q, &msg);
+}
+
+
+bool evt_bus_receive(int q, evt_msg_t* msg, TickType_t wait)
+{
+	uint32_t latency;
+	
+	if ((q < 0) || (q >= EVT_BUS_MAX_QUEUES) || (evt_queue[q] == NULL)) return false;
+	if (xQueueReceive(evt_queue[q], msg, wait) != pdTRUE) return false;
+	
+	latency = (uint32_t) esp_timer_get_time() - msg->sent_usec;
+	portENTER_CRITICAL(&evt_mux);
+	if (evt_stats[q].avg_latency_usec == 0) {
+		evt_stats[q].avg_latency_usec = latency;
+	} else {
+		evt_stats[q].avg_latency_usec += ((int32_t) latency - (int32_t) evt_stats[q].avg_latency_usec) >> EVT_BUS_AVG_SHIFT;
+	}
+	if (latency > evt_stats[q].max_latency_usec) evt_stats[q].max_latency_usec = latency;
+	portEXIT_CRITICAL(&evt_mux);
+	
+	return true;
+}
+
+
+bool evt_bus_get_stats(int q, evt_bus_stats_t* stats)
+{
+	if ((q < 0) || (q >= EVT_BUS_MAX_QUEUES) || (evt_queue[q] == NULL)) return false;
+	
+	portENTER_CRITICAL(&evt_mux);
+	*stats = evt_stats[q];
+	portEXIT_CRITICAL(&evt_mux);
+	
+	return true;
+}
+
+
+void evt_bus_reset_stats()
+{
+	int q;
+	
+	portENTER_CRITICAL(&evt_mux);
+	for (q=0; q<EVT_BUS_MAX_QUEUES; q++) {
+		evt_stats[q].high_water = 0;
+		evt_stats[q].sent = 0;
+		evt_stats[q].dropped = 0;
+		evt_stats[q].avg_latency_usec = 0;
+		evt_stats[q].max_latency_usec = 0;
+	}
+	portEXIT_CRITICAL(&evt_mux);
+}
@@ -0,0 +1,85 @@
+/*
+ * evt_bus - utility module implementing a small inter-task event bus.  Each receiving
+ * task owns a FreeRTOS queue of fixed-size typed messages that carry their payload with
+ * them so repeated events are delivered in order instead of coalescing like notification
+ * bits, and no side-channel global has to be set before an event is sent.  Per-queue
+ * depth and send to receive latency statistics are kept.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _EVT_BUS_H_
+#define _EVT_BUS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+
+
+//
+// Constants
+//
+
+// Maximum number of queues (queue numbers are 0 to EVT_BUS_MAX_QUEUES-1)
+#define EVT_BUS_MAX_QUEUES   4
+
+// Deepest queue (the storage for each is reserved at build time)
+#define EVT_BUS_MAX_DEPTH    16
+
+// Longest string payload (a Bluetooth caller ID number, ESP_BT_HF_NUMBER_LEN)
+#define EVT_BUS_STR_LEN      32
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint16_t id;                          // Event (defined by the receiving task)
+	uint32_t sent_usec;                   // Set by evt_bus_send for the latency statistics
+	union {
+		char digit;
+		float gain;
+		char str[EVT_BUS_STR_LEN+1];
+	} u;
+} evt_msg_t;
+
+typedef struct {
+	const char* name;
+	int depth;
+	int high_water;                       // Most messages waiting at once
+	uint32_t sent;
+	uint32_t dropped;                     // Messages lost because the queue was full
+	uint32_t avg_latency_usec;            // Send to receive (running average)
+	uint32_t max_latency_usec;
+} evt_bus_stats_t;
+
+
+
+//
+// API
+//
+bool evt_bus_create(int q, const char* name, int depth);   // Call from app_main before the tasks start
+bool evt_bus_send(int q, evt_msg_t* msg);                   // Never blocks (may be called from BT callbacks)
+bool evt_bus_send_id(int q, uint16_t id);
+bool evt_bus_send_digit(int q, uint16_t id, char d);
+bool evt_bus_send_gain(int q, uint16_t id, float g);
+bool evt_bus_send_str(int q, uint16_t id, const char* s);  // NULL sends an empty string
+bool evt_bus_receive(int q, evt_msg_t* msg, TickType_t wait);
+bool evt_bus_get_stats(int q, evt_bus_stats_t* stats);     // False for a queue that doesn't exist
+void evt_bus_reset_stats();
+
+#endif /* _EVT_BUS_H_ */
@@ -0,0 +1,345 @@
+/*
+ * fdaf - utility module implementing a partitioned block frequency-domain adaptive
+ * filter (PBFDAF) line echo canceller.  It is an alternative to the spandsp OSLEC
+ * time-domain canceller for long tails and uses the same adaption mode bits.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "fdaf.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include "spandsp.h"
+
+
+//
+// Constants
+//
+
+// Normalized step size (split across the partitions)
+#define FDAF_MU             1.0f
+
+// Per-bin TX power smoothing and regularization (power of a level 32 signal)
+#define FDAF_POWER_ALPHA    0.25f
+#define FDAF_POWER_MIN      ((float) FDAF_FFT_LEN * 32.0f * 32.0f)
+
+// Double-talk detection and NLP thresholds (same as OSLEC scaled for full scale samples)
+#define MIN_RX_POWER_FOR_ADAPTION   128
+#define MIN_TX_POWER_FOR_ADAPTION   128
+#define DTD_HANGOVER                600
+#define BGN_MAX_LEVEL               80
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _fdaf_process_block(fdaf_state_t* s);
+static void _fdaf_expand(fdaf_state_t* s, const fdaf_cplx_t* bins);
+static void _fdaf_to_bins(fdaf_state_t* s, fdaf_cplx_t* bins);
+static __inline__ int16_t _fdaf_sat(float f);
+
+
+
+//
+// API
+//
+fdaf_state_t* fdaf_create(int taps, int adaption_mode)
+{
+	fdaf_state_t* s;
+
+	if (taps <= 0) return NULL;
+
+	s = (fdaf_state_t*) malloc(sizeof(fdaf_state_t));
+	if (s == NULL) return NULL;
+
+	s->taps = taps;
+	s->num_parts = (taps + FDAF_BLOCK - 1) / FDAF_BLOCK;
+	s->adaption_mode = adaption_mode;
+	s->X = (fdaf_cplx_t*) malloc(s->num_parts * FDAF_BINS * sizeof(fdaf_cplx_t));
+	s->W = (fdaf_cplx_t*) malloc(s->num_parts * FDAF_BINS * sizeof(fdaf_cplx_t));
+	if ((s->X == NULL) || (s->W == NULL)) {
+		fdaf_free(s);
+		return NULL;
+	}
+
+	fft_init();
+	fdaf_flush(s);
+
+	return s;
+}
+
+
+void fdaf_free(fdaf_state_t* s)
+{
+	if (s != NULL) {
+		free(s->X);
+		free(s->W);
+		free(s);
+	}
+}
+
+
+void fdaf_flush(fdaf_state_t* s)
+{
+	int i;
+
+	s->fill = 0;
+	s->head = 0;
+	s->constrain_part = 0;
+	s->dwell = 0;
+	s->Ltxacc = s->Lrxacc = s->Lcleanacc = 0;
+	s->Ltx = s->Lrx = s->Lclean = 0;
+	s->Lbgn = s->Lbgn_acc = 0;
+	s->nlp_samples = 0;
+	memset(s->in_tx, 0, sizeof(s->in_tx));
+	memset(s->in_rx, 0, sizeof(s->in_rx));
+	memset(s->out, 0, sizeof(s->out));
+	memset(s->x_prev, 0, sizeof(s->x_prev));
+	for (i=0; i<FDAF_BINS; i++) {
+		s->power[i] = FDAF_POWER_MIN;
+	}
+	memset(s->X, 0, s->num_parts * FDAF_BINS * sizeof(fdaf_cplx_t));
+	memset(s->W, 0, s->num_parts * FDAF_BINS * sizeof(fdaf_cplx_t));
+}
+
+
+void fdaf_adaption_mode(fdaf_state_t* s, int adaption_mode)
+{
+	s->adaption_mode = adaption_mode;
+}
+
+
+// Cancel the echo of tx in rx.  out is delayed FDAF_BLOCK samples from rx.
+void fdaf_update_block(fdaf_state_t* s, const int16_t* tx, const int16_t* rx, int16_t* out, int len)
+{
+	int i;
+
+	for (i=0; i<len; i++) {
+		s->in_tx[s->fill] = tx[i];
+		s->in_rx[s->fill] = rx[i];
+		out[i] = s->out[s->fill];
+		if (++s->fill == FDAF_BLOCK) {
+			_fdaf_process_block(s);
+			s->fill = 0;
+		}
+	}
+}
+
+
+void fdaf_get_coeffs(fdaf_state_t* s, int16_t* coeffs)
+{
+	int i, n, p;
+
+	for (p=0; p<s->num_parts; p++) {
+		_fdaf_expand(s, &s->W[p * FDAF_BINS]);
+		fft_run(s->work, true);
+		n = s->taps - p*FDAF_BLOCK;
+		if (n > FDAF_BLOCK) n = FDAF_BLOCK;
+		for (i=0; i<n; i++) {
+			*coeffs++ = _fdaf_sat(s->work[i].re * 32768.0f);
+		}
+	}
+}
+
+
+void fdaf_set_coeffs(fdaf_state_t* s, const int16_t* coeffs)
+{
+	int i, n, p;
+
+	for (p=0; p<s->num_parts; p++) {
+		n = s->taps - p*FDAF_BLOCK;
+		if (n > FDAF_BLOCK) n = FDAF_BLOCK;
+		for (i=0; i<FDAF_FFT_LEN; i++) {
+			s->work[i].re = (i < n) ? (float) *coeffs++ / 32768.0f : 0;
+			s->work[i].im = 0;
+		}
+		fft_run(s->work, false);
+		_fdaf_to_bins(s, &s->W[p * FDAF_BINS]);
+	}
+}
+
+
+
+//
+// Internal functions
+//
+
+// Filter and adapt one block of FDAF_BLOCK samples
+static void _fdaf_process_block(fdaf_state_t* s)
+{
+	bool adapt;
+	int i, k, p, q;
+	int clean;
+	float e[FDAF_BLOCK];
+	float e_pwr = 0;
+	float rx_pwr = 0;
+	float g;
+	fdaf_cplx_t* xP;
+	fdaf_cplx_t* wP;
+
+	// Transform the TX window (previous and current block) into the newest X slot
+	for (i=0; i<FDAF_BLOCK; i++) {
+		s->work[i].re = s->x_prev[i];
+		s->work[i].im = 0;
+		s->work[FDAF_BLOCK + i].re = s->x_prev[i] = (float) s->in_tx[i];
+		s->work[FDAF_BLOCK + i].im = 0;
+	}
+	fft_run(s->work, false);
+	if (--s->head < 0) s->head = s->num_parts - 1;
+	xP = &s->X[s->head * FDAF_BINS];
+	_fdaf_to_bins(s, xP);
+	for (k=0; k<FDAF_BINS; k++) {
+		g = xP[k].re * xP[k].re + xP[k].im * xP[k].im;
+		s->power[k] += FDAF_POWER_ALPHA * (g - s->power[k]);
+	}
+
+	// Echo estimate is the sum of each partition filtering its (older) TX spectrum
+	for (k=0; k<FDAF_BINS; k++) {
+		s->work[k].re = 0;
+		s->work[k].im = 0;
+	}
+	for (p=0; p<s->num_parts; p++) {
+		q = s->head + p;
+		if (q >= s->num_parts) q -= s->num_parts;
+		xP = &s->X[q * FDAF_BINS];
+		wP = &s->W[p * FDAF_BINS];
+		for (k=0; k<FDAF_BINS; k++) {
+			s->work[k].re += wP[k].re * xP[k].re - wP[k].im * xP[k].im;
+			s->work[k].im += wP[k].re * xP[k].im + wP[k].im * xP[k].re;
+		}
+	}
+	_fdaf_expand(s, s->work);
+	fft_run(s->work, true);
+
+	// Error with the overlap-save (valid) half of the estimate, levels, DTD and NLP
+	adapt = ((s->adaption_mode & ECHO_CAN_USE_ADAPTION) != 0);
+	for (i=0; i<FDAF_BLOCK; i++) {
+		e[i] = (float) s->in_rx[i] - s->work[FDAF_BLOCK + i].re;
+		e_pwr += e[i] * e[i];
+		rx_pwr += (float) s->in_rx[i] * (float) s->in_rx[i];
+
+		s->Ltxacc += abs(s->in_tx[i]) - s->Ltx;
+		s->Ltx = (s->Ltxacc + (1<<4)) >> 5;
+		s->Lrxacc += abs(s->in_rx[i]) - s->Lrx;
+		s->Lrx = (s->Lrxacc + (1<<4)) >> 5;
+
+		// Very simple DTD so we don't adapt with strong near end speech
+		if ((s->Lrx > MIN_RX_POWER_FOR_ADAPTION) && (s->Lrx > s->Ltx)) {
+			s->dwell = DTD_HANGOVER;
+		}
+		if (s->dwell) {
+			s->dwell--;
+			adapt = false;
+		}
+	}
+	if (s->Ltx < MIN_TX_POWER_FOR_ADAPTION) adapt = false;
+
+	for (i=0; i<FDAF_BLOCK; i++) {
+		// Don't pass a diverged estimate that adds energy
+		clean = (e_pwr > rx_pwr) ? s->in_rx[i] : _fdaf_sat(e[i]);
+		s->Lcleanacc += abs(clean) - s->Lclean;
+		s->Lclean = (s->Lcleanacc + (1<<4)) >> 5;
+
+		if (s->adaption_mode & ECHO_CAN_USE_NLP) {
+			if (16*s->Lclean < s->Ltx) {
+				// Echo has been improved by at least 24 dB so remove the residual
+				s->nlp_samples++;
+				if (s->adaption_mode & ECHO_CAN_USE_CLIP) {
+					if (clean > s->Lbgn) clean = s->Lbgn;
+					if (clean < -s->Lbgn) clean = -s->Lbgn;
+				} else {
+					clean = 0;
+				}
+			} else if (s->Lclean < BGN_MAX_LEVEL) {
+				s->Lbgn_acc += abs(clean) - s->Lbgn;
+				s->Lbgn = (s->Lbgn_acc + (1<<11)) >> 12;
+			}
+		}
+
+		s->out[i] = (s->adaption_mode & ECHO_CAN_DISABLE) ? s->in_rx[i] : (int16_t) clean;
+	}
+
+	if (!adapt) return;
+
+	// Normalized gradient from the zero-padded error spectrum
+	for (i=0; i<FDAF_BLOCK; i++) {
+		s->work[i].re = 0;
+		s->work[i].im = 0;
+		s->work[FDAF_BLOCK + i].re = e[i];
+		s->work[FDAF_BLOCK + i].im = 0;
+	}
+	fft_run(s->work, false);
+	for (k=0; k<FDAF_BINS; k++) {
+		g = (FDAF_MU / s->num_parts) / (s->power[k] + FDAF_POWER_MIN);
+		s->work[k].re *= g;
+		s->work[k].im *= g;
+	}
+	for (p=0; p<s->num_parts; p++) {
+		q = s->head + p;
+		if (q >= s->num_parts) q -= s->num_parts;
+		xP = &s->X[q * FDAF_BINS];
+		wP = &s->W[p * FDAF_BINS];
+		for (k=0; k<FDAF_BINS; k++) {
+			wP[k].re += xP[k].re * s->work[k].re + xP[k].im * s->work[k].im;
+			wP[k].im += xP[k].re * s->work[k].im - xP[k].im * s->work[k].re;
+		}
+	}
+
+	// Constrain one partition per block (round robin) to a causal FDAF_BLOCK tap filter
+	wP = &s->W[s->constrain_part * FDAF_BINS];
+	_fdaf_expand(s, wP);
+	fft_run(s->work, true);
+	for (i=FDAF_BLOCK; i<FDAF_FFT_LEN; i++) {
+		s->work[i].re = 0;
+	}
+	for (i=0; i<FDAF_FFT_LEN; i++) {
+		s->work[i].im = 0;
+	}
+	fft_run(s->work, false);
+	_fdaf_to_bins(s, wP);
+	if (++s->constrain_part == s->num_parts) s->constrain_part = 0;
+}
+
+
+// Load the work buffer with the full (conjugate symmetric) spectrum of a real signal
+static void _fdaf_expand(fdaf_state_t* s, const fdaf_cplx_t* bins)
+{
+	int k;
+
+	if (bins != s->work) {
+		memcpy(s->work, bins, FDAF_BINS * sizeof(fdaf_cplx_t));
+	}
+	for (k=1; k<FDAF_BLOCK; k++) {
+		s->work[FDAF_FFT_LEN - k].re = s->work[k].re;
+		s->work[FDAF_FFT_LEN - k].im = -s->work[k].im;
+	}
+}
+
+
+// Store the non-redundant bins of the work buffer
+static void _fdaf_to_bins(fdaf_state_t* s, fdaf_cplx_t* bins)
+{
+	memcpy(bins, s->work, FDAF_BINS * sizeof(fdaf_cplx_t));
+}
+
+
+static __inline__ int16_t _fdaf_sat(float f)
+{
+	if (f > 32767.0f) return 32767;
+	if (f < -32768.0f) return -32768;
+	return (int16_t) f;
+}
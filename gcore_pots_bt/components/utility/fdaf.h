@@ -0,0 +1,87 @@
+/*
+ * fdaf - utility module implementing a partitioned block frequency-domain adaptive
+ * filter (PBFDAF) line echo canceller.  It is an alternative to the spandsp OSLEC
+ * time-domain canceller for long tails and uses the same adaption mode bits.
+ *
+ * The tail is split into FDAF_BLOCK sample partitions, each filtered and adapted with
+ * 2*FDAF_BLOCK point FFTs (overlap-save), so the cost per sample grows with the number of
+ * partitions rather than the number of taps.  Samples are processed in FDAF_BLOCK sized
+ * blocks which adds FDAF_BLOCK samples of delay to the cancelled output.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _FDAF_H_
+#define _FDAF_H_
+
+#include <stdint.h>
+#include "fft.h"
+
+
+
+//
+// Constants
+//
+
+// Partition length (half the shared FFT so it is halved for short audio frames too)
+#define FDAF_FFT_LEN  FFT_LEN
+#define FDAF_BLOCK    (FDAF_FFT_LEN/2)
+#define FDAF_BINS     FFT_BINS
+
+
+
+//
+// Typedefs
+//
+typedef fft_cplx_t fdaf_cplx_t;
+
+typedef struct {
+	int taps;                             // Length of the canceller in samples
+	int num_parts;                        // Number of FDAF_BLOCK partitions covering taps
+	int adaption_mode;                    // ECHO_CAN_USE_* bits (see spandsp echo.h)
+	int fill;                             // Samples collected in the current block
+	int head;                             // Index of the newest TX spectrum in X
+	int constrain_part;                   // Partition whose gradient constraint is applied next
+	int dwell;                            // Double-talk hangover (samples)
+	int Ltxacc, Lrxacc, Lcleanacc;        // Short term level averaging filter states
+	int Ltx, Lrx, Lclean;
+	int Lbgn, Lbgn_acc;                   // Background noise level (for ECHO_CAN_USE_CLIP)
+	uint32_t nlp_samples;                 // Samples the NLP suppressed the residual echo of since the last flush
+	int16_t in_tx[FDAF_BLOCK];
+	int16_t in_rx[FDAF_BLOCK];
+	int16_t out[FDAF_BLOCK];              // Output for the previous block
+	float x_prev[FDAF_BLOCK];             // Previous TX block (first half of the FFT window)
+	float power[FDAF_BINS];               // Smoothed TX power per bin
+	fdaf_cplx_t* X;                       // num_parts TX spectra (ring, oldest follows head)
+	fdaf_cplx_t* W;                       // num_parts filter partition spectra
+	fdaf_cplx_t work[FDAF_FFT_LEN];
+} fdaf_state_t;
+
+
+
+//
+// API
+//
+fdaf_state_t* fdaf_create(int taps, int adaption_mode);
+void fdaf_free(fdaf_state_t* s);
+void fdaf_flush(fdaf_state_t* s);
+void fdaf_adaption_mode(fdaf_state_t* s, int adaption_mode);
+void fdaf_update_block(fdaf_state_t* s, const int16_t* tx, const int16_t* rx, int16_t* out, int len);
+
+// Coefficients are exchanged in the same Q15 format, and length, as echo_can_get_coeffs/set_coeffs
+void fdaf_get_coeffs(fdaf_state_t* s, int16_t* coeffs);
+void fdaf_set_coeffs(fdaf_state_t* s, const int16_t* coeffs);
+
+#endif /* _FDAF_H_ */
@@ -0,0 +1,100 @@
+/*
+ * fft - utility module implementing the in-place complex FFT shared by the frequency
+ * domain voice processing.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "fft.h"
+#include <math.h>
+#include <stdint.h>
+
+
+//
+// Variables
+//
+static bool fft_ready = false;
+static fft_cplx_t twiddle[FFT_LEN/2];
+static uint8_t bitrev[FFT_LEN];
+
+
+
+//
+// API
+//
+void fft_init()
+{
+	int i, j, b;
+	int log2n = 0;
+
+	if (fft_ready) return;
+
+	while ((1 << log2n) < FFT_LEN) log2n++;
+	for (i=0; i<FFT_LEN/2; i++) {
+		twiddle[i].re = cosf(2.0f * (float) M_PI * i / FFT_LEN);
+		twiddle[i].im = -sinf(2.0f * (float) M_PI * i / FFT_LEN);
+	}
+	for (i=0; i<FFT_LEN; i++) {
+		b = 0;
+		for (j=0; j<log2n; j++) {
+			if (i & (1 << j)) b |= 1 << (log2n - 1 - j);
+		}
+		bitrev[i] = (uint8_t) b;
+	}
+
+	fft_ready = true;
+}
+
+
+// In-place radix-2 FFT
+void fft_run(fft_cplx_t* buf, bool inverse)
+{
+	int i, j, k, half, step;
+	float wr, wi, tr, ti;
+	fft_cplx_t t;
+
+	for (i=0; i<FFT_LEN; i++) {
+		j = bitrev[i];
+		if (j > i) {
+			t = buf[i];
+			buf[i] = buf[j];
+			buf[j] = t;
+		}
+	}
+
+	for (half=1; half<FFT_LEN; half <<= 1) {
+		step = FFT_LEN / (2*half);
+		for (k=0; k<half; k++) {
+			wr = twiddle[k*step].re;
+			wi = inverse ? -twiddle[k*step].im : twiddle[k*step].im;
+			for (i=k; i<FFT_LEN; i += 2*half) {
+				j = i + half;
+				tr = wr * buf[j].re - wi * buf[j].im;
+				ti = wr * buf[j].im + wi * buf[j].re;
+				buf[j].re = buf[i].re - tr;
+				buf[j].im = buf[i].im - ti;
+				buf[i].re += tr;
+				buf[i].im += ti;
+			}
+		}
+	}
+
+	if (inverse) {
+		for (i=0; i<FFT_LEN; i++) {
+			buf[i].re *= (1.0f / FFT_LEN);
+			buf[i].im *= (1.0f / FFT_LEN);
+		}
+	}
+}
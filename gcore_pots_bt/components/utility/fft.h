@@ -0,0 +1,62 @@
+/*
+ * fft - utility module implementing the in-place complex FFT shared by the frequency
+ * domain voice processing (the FDAF echo canceller and the noise suppressor) so only one
+ * copy of the code and its tables is kept in IRAM and DRAM.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _FFT_H_
+#define _FFT_H_
+
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Transform length (must be a power of 2) - halved for short audio frames so the block
+// delay of its users stays within about two frames
+#if (CONFIG_AUDIO_FRAME_MSEC < 8)
+#define FFT_LEN  64
+#else
+#define FFT_LEN  128
+#endif
+
+// Non-redundant bins of the transform of a real signal
+#define FFT_BINS (FFT_LEN/2 + 1)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	float re;
+	float im;
+} fft_cplx_t;
+
+
+
+//
+// API
+//
+void fft_init();                                   // Builds the tables (only the first call does anything)
+void fft_run(fft_cplx_t* buf, bool inverse);       // FFT_LEN points, inverse is scaled by 1/FFT_LEN
+
+#endif /* _FFT_H_ */
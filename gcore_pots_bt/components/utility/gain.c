@@ -26,6 +26,29 @@
 #include <math.h>
 
 
+//
+// Constants
+//
+
+// Q14 linear gain for GAIN_DIGITAL_MIN_DB to GAIN_DIGITAL_MAX_DB in 0.5 dB steps
+static const uint16_t gain_digital_table[GAIN_DIGITAL_STEPS] = {
+	65, 69, 73, 78, 82, 87, 92, 98, 103, 110,
+	116, 123, 130, 138, 146, 155, 164, 174, 184, 195,
+	206, 218, 231, 245, 260, 275, 291, 309, 327, 346,
+	367, 389, 412, 436, 462, 489, 518, 549, 581, 616,
+	652, 691, 732, 775, 821, 870, 921, 976, 1034, 1095,
+	1160, 1229, 1301, 1379, 1460, 1547, 1638, 1735, 1838, 1947,
+	2063, 2185, 2314, 2451, 2597, 2751, 2914, 3086, 3269, 3463,
+	3668, 3885, 4115, 4359, 4618, 4891, 5181, 5488, 5813, 6158,
+	6523, 6909, 7318, 7752, 8211, 8698, 9213, 9759, 10338, 10950,
+	11599, 12286, 13014, 13785, 14602, 15467, 16384, 17355, 18383, 19472,
+	20626, 21848, 23143, 24514, 25967, 27506, 29135, 30862, 32690, 34627,
+	36679, 38853, 41155, 43593, 46176, 48913, 51811, 54881, 58133, 61577,
+	65226
+};
+
+
+
 //
 // Forward declarations for internal functions
 //
@@ -84,6 +107,27 @@ bool gainSetCodec(int gain_type, float g)
 
 
 
+int gainDB2Digital(int gain_type, float g)
+{
+	int i;
+	
+	if (gain_type == GAIN_TYPE_MIC) {
+		g -= GAIN_APP_MIC_NOM_DB;
+	} else {
+		g -= GAIN_APP_SPK_NOM_DB;
+	}
+	
+	i = round(2 * (g - GAIN_DIGITAL_MIN_DB));
+	if (i < 0) {
+		i = 0;
+	} else if (i >= GAIN_DIGITAL_STEPS) {
+		i = GAIN_DIGITAL_STEPS - 1;
+	}
+	
+	return (int) gain_digital_table[i];
+}
+
+
 //
 // Internal functions
 //
@@ -61,6 +61,12 @@
 #define GAIN_TYPE_MIC          0
 #define GAIN_TYPE_SPK          1
 
+// Digital gain range (Q14 linear gain lookup in 0.5 dB steps, relative to the nominal gains)
+#define GAIN_DIGITAL_MIN_DB    -48
+#define GAIN_DIGITAL_MAX_DB    12
+#define GAIN_DIGITAL_STEPS     (2 * (GAIN_DIGITAL_MAX_DB - GAIN_DIGITAL_MIN_DB) + 1)
+#define GAIN_DIGITAL_UNITY     16384
+
 
 
 //
@@ -69,5 +75,6 @@
 float gainBT2DB(int gain_type, int bt_val);
 int gainDB2BT(int gain_type, float g);
 bool gainSetCodec(int gain_type, float g);
+int gainDB2Digital(int gain_type, float g);   // Q14 gain to apply to samples for g with the codec at nominal
 
 #endif /* _GAIN_H_ */ 
\ No newline at end of file
@@ -0,0 +1,326 @@
+/*
+ * gui_mem - utility module providing the LVGL custom allocator.
+ *
+ * Two pools are reserved at boot.  The hot pool in internal RAM holds requests up to
+ * the largest size class.  Each block there has a small header recording its class and
+ * freed blocks go onto a per-class free list, exactly as mem_pool does for spandsp, so
+ * LVGL creating and deleting screens can't fragment it.  Larger requests come from a
+ * separate heap registered over a block of PSRAM so GUI churn is also kept out of the
+ * system heap and its fragmentation can be measured on its own.  PSRAM pool blocks
+ * carry no header of our own - the pool a block came from is found from its address.
+ * Requests neither pool can satisfy fall back to the system heap, preferring PSRAM.
+ *
+ * LVGL only calls the allocator from gui_task but the statistics are read elsewhere.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "gui_mem.h"
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "multi_heap.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+
+
+//
+// Constants
+//
+
+// Pool sizes
+#define HOT_POOL_LEN        (CONFIG_GUI_MEM_HOT_POOL_KB * 1024)
+#define PSRAM_POOL_LEN      (CONFIG_GUI_MEM_PSRAM_POOL_KB * 1024)
+
+// Hot block header length (LVGL only needs 4-byte alignment)
+#define HDR_LEN             4
+
+// Header magic value
+#define HDR_MAGIC_HOT       0x484F
+
+// Payload size of a class
+#define CLASS_LEN(c)        (((size_t) 1) << ((c) + GUI_MEM_HOT_MIN_SHIFT))
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint16_t magic;
+	uint16_t class;
+} gui_mem_hdr_t;
+
+typedef struct gui_mem_free_s {
+	struct gui_mem_free_s* next;
+} gui_mem_free_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "gui_mem";
+
+static portMUX_TYPE gui_mem_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Hot pool
+static uint8_t* hot_buf = NULL;
+static size_t hot_len = 0;
+static size_t hot_next = 0;
+static gui_mem_free_t* free_list[GUI_MEM_HOT_NUM_CLASSES];
+
+// PSRAM pool
+static uint8_t* psram_buf = NULL;
+static size_t psram_len = 0;
+static multi_heap_handle_t psram_heap = NULL;
+static portMUX_TYPE psram_heap_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static gui_mem_info_t mem_info;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _gui_mem_class(size_t len);
+static gui_mem_hdr_t* _gui_mem_get_hot_block(int class);
+static bool _gui_mem_in_hot(void* p);
+static bool _gui_mem_in_psram(void* p);
+
+
+
+//
+// API
+//
+bool gui_mem_init()
+{
+	int i;
+	bool success = true;
+	
+	for (i=0; i<GUI_MEM_HOT_NUM_CLASSES; i++) {
+		free_list[i] = NULL;
+	}
+	memset(&mem_info, 0, sizeof(gui_mem_info_t));
+	
+	hot_buf = (uint8_t*) heap_caps_malloc(HOT_POOL_LEN, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+	if (hot_buf == NULL) {
+		ESP_LOGE(TAG, "Could not allocate %d byte hot pool", HOT_POOL_LEN);
+		success = false;
+	} else {
+		hot_len = HOT_POOL_LEN;
+		hot_next = 0;
+		mem_info.hot_len = hot_len;
+	}
+	
+	psram_buf = (uint8_t*) heap_caps_malloc(PSRAM_POOL_LEN, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+	if (psram_buf != NULL) {
+		psram_heap = multi_heap_register(psram_buf, PSRAM_POOL_LEN);
+	}
+	if (psram_heap == NULL) {
+		ESP_LOGE(TAG, "Could not create %d byte PSRAM pool", PSRAM_POOL_LEN);
+		if (psram_buf != NULL) {
+			heap_caps_free(psram_buf);
+			psram_buf = NULL;
+		}
+		success = false;
+	} else {
+		multi_heap_set_lock(psram_heap, &psram_heap_mux);
+		psram_len = PSRAM_POOL_LEN;
+		mem_info.psram_len = psram_len;
+	}
+	
+	ESP_LOGI(TAG, "%d byte hot pool, %d byte PSRAM pool", (int) hot_len, (int) psram_len);
+	return success;
+}
+
+
+void* gui_mem_alloc(size_t len)
+{
+	int class;
+	gui_mem_hdr_t* hdrP = NULL;
+	void* p;
+	
+	class = _gui_mem_class(len + HDR_LEN);
+	if ((class >= 0) && (hot_len != 0)) {
+		portENTER_CRITICAL(&gui_mem_mux);
+		hdrP = _gui_mem_get_hot_block(class);
+		if (hdrP != NULL) {
+			mem_info.hot_allocs++;
+			mem_info.hot_used += CLASS_LEN(hdrP->class);
+			if (mem_info.hot_used > mem_info.hot_high_water) {
+				mem_info.hot_high_water = mem_info.hot_used;
+			}
+		} else {
+			mem_info.hot_fallbacks++;
+		}
+		portEXIT_CRITICAL(&gui_mem_mux);
+	
+		if (hdrP != NULL) {
+			return (void*) ((uint8_t*) hdrP + HDR_LEN);
+		}
+	}
+	
+	// Large or the hot pool is exhausted
+	if (psram_heap != NULL) {
+		p = multi_heap_malloc(psram_heap, len);
+		if (p != NULL) {
+			portENTER_CRITICAL(&gui_mem_mux);
+			mem_info.psram_allocs++;
+			portEXIT_CRITICAL(&gui_mem_mux);
+			return p;
+		}
+	}
+	
+	p = heap_caps_malloc_prefer(len, 2, MALLOC_CAP_SPIRAM, MALLOC_CAP_DEFAULT);
+	portENTER_CRITICAL(&gui_mem_mux);
+	if (p != NULL) {
+		mem_info.heap_allocs++;
+	} else {
+		mem_info.failures++;
+	}
+	portEXIT_CRITICAL(&gui_mem_mux);
+	return p;
+}
+
+
+void gui_mem_free(void* p)
+{
+	gui_mem_hdr_t* hdrP;
+	gui_mem_free_t* fP;
+	
+	if (p == NULL) {
+		return;
+	}
+	
+	if (_gui_mem_in_hot(p)) {
+		hdrP = (gui_mem_hdr_t*) ((uint8_t*) p - HDR_LEN);
+		if (hdrP->magic != HDR_MAGIC_HOT) {
+			ESP_LOGE(TAG, "Free of unknown block %p", p);
+			return;
+		}
+		fP = (gui_mem_free_t*) p;
+		portENTER_CRITICAL(&gui_mem_mux);
+		fP->next = free_list[hdrP->class];
+		free_list[hdrP->class] = fP;
+		mem_info.hot_allocs--;
+		mem_info.hot_used -= CLASS_LEN(hdrP->class);
+		portEXIT_CRITICAL(&gui_mem_mux);
+	} else if (_gui_mem_in_psram(p)) {
+		multi_heap_free(psram_heap, p);
+		portENTER_CRITICAL(&gui_mem_mux);
+		mem_info.psram_allocs--;
+		portEXIT_CRITICAL(&gui_mem_mux);
+	} else {
+		heap_caps_free(p);
+		portENTER_CRITICAL(&gui_mem_mux);
+		mem_info.heap_allocs--;
+		portEXIT_CRITICAL(&gui_mem_mux);
+	}
+}
+
+
+void gui_mem_get_info(gui_mem_info_t* info)
+{
+	multi_heap_info_t hi;
+	
+	if (psram_heap != NULL) {
+		multi_heap_get_info(psram_heap, &hi);
+	} else {
+		memset(&hi, 0, sizeof(multi_heap_info_t));
+	}
+	
+	portENTER_CRITICAL(&gui_mem_mux);
+	*info = mem_info;
+	portEXIT_CRITICAL(&gui_mem_mux);
+	
+	info->hot_carved = hot_next;
+	if (psram_heap != NULL) {
+		info->psram_used = hi.total_allocated_bytes;
+		info->psram_high_water = psram_len - hi.minimum_free_bytes;
+		info->psram_largest_free = hi.largest_free_block;
+		if (hi.total_free_bytes != 0) {
+			info->psram_frag_pct = 100 - (uint32_t) ((100ULL * hi.largest_free_block) / hi.total_free_bytes);
+		}
+	}
+}
+
+
+
+//
+// Internal functions
+//
+
+// Return the smallest class holding len bytes (including the header) or -1 if it is
+// too big for the hot pool
+static int _gui_mem_class(size_t len)
+{
+	int c;
+	
+	for (c=0; c<GUI_MEM_HOT_NUM_CLASSES; c++) {
+		if (len <= CLASS_LEN(c)) {
+			return c;
+		}
+	}
+	return -1;
+}
+
+
+// Return a block for class from its free list, uncarved hot pool memory or a free
+// block from a larger class.  Blocks are class-sized including their header.  Must be
+// called in the critical section.
+static gui_mem_hdr_t* _gui_mem_get_hot_block(int class)
+{
+	int c;
+	gui_mem_hdr_t* hdrP;
+	
+	if (free_list[class] != NULL) {
+		hdrP = (gui_mem_hdr_t*) ((uint8_t*) free_list[class] - HDR_LEN);
+		free_list[class] = free_list[class]->next;
+		return hdrP;
+	}
+	
+	if ((hot_next + CLASS_LEN(class)) <= hot_len) {
+		hdrP = (gui_mem_hdr_t*) &hot_buf[hot_next];
+		hot_next += CLASS_LEN(class);
+		hdrP->magic = HDR_MAGIC_HOT;
+		hdrP->class = class;
+		return hdrP;
+	}
+	
+	// The block keeps its original class so it returns to that class when freed
+	for (c=class+1; c<GUI_MEM_HOT_NUM_CLASSES; c++) {
+		if (free_list[c] != NULL) {
+			hdrP = (gui_mem_hdr_t*) ((uint8_t*) free_list[c] - HDR_LEN);
+			free_list[c] = free_list[c]->next;
+			return hdrP;
+		}
+	}
+	
+	return NULL;
+}
+
+
+static bool _gui_mem_in_hot(void* p)
+{
+	return ((uint8_t*) p >= hot_buf) && ((uint8_t*) p < (hot_buf + hot_len));
+}
+
+
+static bool _gui_mem_in_psram(void* p)
+{
+	return ((uint8_t*) p >= psram_buf) && ((uint8_t*) p < (psram_buf + psram_len));
+}
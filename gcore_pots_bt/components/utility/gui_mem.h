@@ -0,0 +1,73 @@
+/*
+ * gui_mem - utility module providing the LVGL custom allocator.  Small, frequently
+ * created objects (objects, styles, labels) come from a size-class pool in internal RAM
+ * and everything larger (dropdown lists, message boxes, image decoder and cache buffers)
+ * comes from a dedicated heap in PSRAM so the GUI doesn't consume the internal RAM that
+ * audio and Bluedroid need.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _GUI_MEM_H_
+#define _GUI_MEM_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Hot pool size classes - blocks of 16 bytes up to 16 << (GUI_MEM_HOT_NUM_CLASSES-1)
+// bytes including a 4 byte header.  Larger requests go to the PSRAM pool.
+#define GUI_MEM_HOT_MIN_SHIFT   4
+#define GUI_MEM_HOT_NUM_CLASSES 4
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	size_t hot_len;                       // Internal RAM hot pool bytes
+	size_t hot_carved;                    // Hot pool bytes carved into blocks so far
+	size_t hot_used;                      // Hot pool bytes currently allocated
+	size_t hot_high_water;
+	uint32_t hot_allocs;                  // Blocks currently allocated from the hot pool
+	uint32_t hot_fallbacks;               // Total small requests the hot pool could not satisfy
+	size_t psram_len;                     // PSRAM pool bytes (0 if it could not be created)
+	size_t psram_used;                    // PSRAM pool bytes currently allocated
+	size_t psram_high_water;
+	size_t psram_largest_free;            // Largest free PSRAM pool block
+	uint32_t psram_allocs;                // Blocks currently allocated from the PSRAM pool
+	uint32_t psram_frag_pct;              // 100 - largest free block as a percent of free bytes
+	uint32_t heap_allocs;                 // Blocks currently allocated from the system heap
+	uint32_t failures;                    // Total requests that could not be satisfied at all
+} gui_mem_info_t;
+
+
+
+//
+// API
+//
+bool gui_mem_init();                      // Call once from app_main before lv_init
+void* gui_mem_alloc(size_t len);
+void gui_mem_free(void* p);
+void gui_mem_get_info(gui_mem_info_t* info);
+
+#endif /* _GUI_MEM_H_ */
@@ -0,0 +1,500 @@
+/*
+ * hci_snoop - utility module recording HCI traffic into PSRAM and saving it as btsnoop files.
+ * See hci_snoop.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "hci_snoop.h"
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include "bg_job.h"
+#include "esp_bt.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sd_card.h"
+
+
+//
+// Constants
+//
+#define HCI_SNOOP_RING_LEN       (CONFIG_HCI_SNOOP_BUF_KB * 1024)
+
+// H4 packet types (the first byte of each VHCI packet)
+#define H4_TYPE_CMD              1
+#define H4_TYPE_ACL              2
+#define H4_TYPE_SCO              3
+#define H4_TYPE_EVT              4
+
+// Packet headers including the H4 type byte
+#define H4_ACL_HDR_LEN           5
+#define H4_SCO_HDR_LEN           4
+
+// Bytes kept of ACL and SCO packets
+#if (CONFIG_HCI_SNOOP_PAYLOADS == true)
+#define HCI_SNOOP_ACL_LEN        CONFIG_HCI_SNOOP_SNAP_LEN
+#define HCI_SNOOP_SCO_LEN        CONFIG_HCI_SNOOP_SNAP_LEN
+#else
+#define HCI_SNOOP_ACL_LEN        H4_ACL_HDR_LEN
+#define HCI_SNOOP_SCO_LEN        H4_SCO_HDR_LEN
+#endif
+
+// btsnoop file
+#define BTSNOOP_ID               "btsnoop"
+#define BTSNOOP_VERSION          1
+#define BTSNOOP_DATALINK_H4      1002
+#define BTSNOOP_FLAG_RECEIVED    0x01     // Controller to host
+#define BTSNOOP_FLAG_CMD_EVT     0x02     // Command or event (otherwise data)
+#define BTSNOOP_REC_HDR_LEN      24
+
+// Microseconds from midnight January 1, 0 AD (the btsnoop epoch) to the Unix epoch
+#define BTSNOOP_EPOCH_DELTA      0x00DCDDB30F2F8000ULL
+
+
+
+//
+// Typedefs
+//
+
+// Ring record, followed by incl_len packet bytes and padded to a multiple of 8 bytes
+typedef struct {
+	uint16_t size;                   // Record size in the ring (0 marks the end of the ring before a wrap)
+	uint8_t flags;                   // BTSNOOP_FLAG_*
+	uint8_t rsvd;
+	uint16_t orig_len;
+	uint16_t incl_len;
+	int64_t usec;                    // esp_timer time
+} hci_snoop_rec_t;
+
+#define HCI_SNOOP_REC_LEN        sizeof(hci_snoop_rec_t)
+
+
+
+//
+// Variables
+//
+static const char* TAG = "hci_snoop";
+
+// Ring - the head, tail and count are only touched with hci_snoop_mux held or while stopped
+static portMUX_TYPE hci_snoop_mux = portMUX_INITIALIZER_UNLOCKED;
+static uint8_t* snoop_buf;
+static uint32_t snoop_head;                       // Next record written
+static uint32_t snoop_tail;                       // Oldest record
+static uint32_t snoop_count;
+static bool snoop_recording = false;
+
+// Bluedroid's VHCI callbacks and the ones the controller is given instead
+static const esp_vhci_host_callback_t* snoop_host_cb;
+static esp_vhci_host_callback_t snoop_tap_cb;
+
+// Triggering
+static esp_timer_handle_t snoop_stop_timer;
+static atomic_bool save_pending = false;
+static TickType_t last_save_tick;
+
+// Save in progress
+static uint32_t save_rd;
+static uint32_t save_left;
+static bool save_first;
+static int64_t save_offset_usec;                  // esp_timer time to time of day
+static char save_filename[40];
+static int file_num = 1;
+
+static hci_snoop_stats_t hci_snoop_stats;
+static uint64_t tap_cycles_sum;
+static uint32_t tap_count;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _hciSnoopHostRecv(uint8_t* data, uint16_t len);
+static void _hciSnoopHostSendAvailable();
+static void _hciSnoopRecord(const uint8_t* data, uint16_t len, bool received);
+static hci_snoop_rec_t* _hciSnoopReserve(uint32_t size);
+static void _hciSnoopDropOldest();
+static void _hciSnoopStop(void* arg);
+static void _hciSnoopRestart();
+static bool _hciSnoopSaveJob(void* arg);
+static bool _hciSnoopWriteRec(FILE* fp);
+static uint8_t* _hciSnoopPutU32(uint8_t* p, uint32_t v);
+
+
+
+//
+// API
+//
+bool hci_snoop_init()
+{
+	const esp_timer_create_args_t timer_args = {
+		.callback = &_hciSnoopStop,
+		.name = "hci_snoop"
+	};
+	
+	snoop_tap_cb.notify_host_send_available = &_hciSnoopHostSendAvailable;
+	snoop_tap_cb.notify_host_recv = &_hciSnoopHostRecv;
+	
+	snoop_buf = (uint8_t*) heap_caps_malloc(HCI_SNOOP_RING_LEN, MALLOC_CAP_SPIRAM);
+	if (snoop_buf == NULL) {
+		ESP_LOGE(TAG, "Could not allocate the snoop ring");
+		return false;
+	}
+	
+	if (esp_timer_create(&timer_args, &snoop_stop_timer) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not create the trigger timer");
+		heap_caps_free(snoop_buf);
+		snoop_buf = NULL;
+		return false;
+	}
+	
+	_hciSnoopRestart();
+	last_save_tick = xTaskGetTickCount() - pdMS_TO_TICKS(HCI_SNOOP_HOLDOFF_MSEC);
+	ESP_LOGI(TAG, "Recording HCI into %d kB", CONFIG_HCI_SNOOP_BUF_KB);
+	
+	return true;
+}
+
+
+void hci_snoop_trigger()
+{
+	if (snoop_buf == NULL) return;
+	
+	if (!atomic_load(&save_pending) && ((xTaskGetTickCount() - last_save_tick) >= pdMS_TO_TICKS(HCI_SNOOP_HOLDOFF_MSEC))) {
+		atomic_store(&save_pending, true);
+		hci_snoop_stats.triggers++;
+		(void) esp_timer_start_once(snoop_stop_timer, HCI_SNOOP_POST_TRIG_MSEC * 1000);
+	}
+}
+
+
+void hci_snoop_save()
+{
+	if (snoop_buf == NULL) return;
+	
+	if (!atomic_load(&save_pending)) {
+		atomic_store(&save_pending, true);
+		_hciSnoopStop(NULL);
+	}
+}
+
+
+void hci_snoop_get_stats(hci_snoop_stats_t* stats)
+{
+	portENTER_CRITICAL(&hci_snoop_mux);
+	hci_snoop_stats.recording = snoop_recording;
+	hci_snoop_stats.packets = snoop_count;
+	if (snoop_count == 0) {
+		hci_snoop_stats.ring_bytes = 0;
+	} else if (snoop_head > snoop_tail) {
+		hci_snoop_stats.ring_bytes = snoop_head - snoop_tail;
+	} else {
+		hci_snoop_stats.ring_bytes = HCI_SNOOP_RING_LEN - snoop_tail + snoop_head;
+	}
+	hci_snoop_stats.avg_tap_cycles = (tap_count == 0) ? 0 : (uint32_t) (tap_cycles_sum / tap_count);
+	memcpy(stats, &hci_snoop_stats, sizeof(hci_snoop_stats_t));
+	portEXIT_CRITICAL(&hci_snoop_mux);
+}
+
+
+// Link time wrappers for the VHCI calls Bluedroid makes
+void __real_esp_vhci_host_send_packet(uint8_t* data, uint16_t len);
+esp_err_t __real_esp_vhci_host_register_callback(const esp_vhci_host_callback_t* callback);
+
+void __wrap_esp_vhci_host_send_packet(uint8_t* data, uint16_t len)
+{
+	_hciSnoopRecord(data, len, false);
+	__real_esp_vhci_host_send_packet(data, len);
+}
+
+
+esp_err_t __wrap_esp_vhci_host_register_callback(const esp_vhci_host_callback_t* callback)
+{
+	if (callback == NULL) {
+		return __real_esp_vhci_host_register_callback(callback);
+	}
+	
+	// Bluedroid's callbacks are called from ours
+	snoop_host_cb = callback;
+	return __real_esp_vhci_host_register_callback(&snoop_tap_cb);
+}
+
+
+
+//
+// Internal functions
+//
+static int _hciSnoopHostRecv(uint8_t* data, uint16_t len)
+{
+	_hciSnoopRecord(data, len, true);
+	return snoop_host_cb->notify_host_recv(data, len);
+}
+
+
+static void _hciSnoopHostSendAvailable()
+{
+	snoop_host_cb->notify_host_send_available();
+}
+
+
+static void _hciSnoopRecord(const uint8_t* data, uint16_t len, bool received)
+{
+	hci_snoop_rec_t* rec;
+	uint32_t start = esp_cpu_get_ccount();
+	uint32_t cycles;
+	uint16_t incl_len;
+	uint8_t flags;
+	
+	if ((snoop_buf == NULL) || (len == 0)) return;
+	
+	switch (data[0]) {
+		case H4_TYPE_CMD:
+		case H4_TYPE_EVT:
+			incl_len = len;
+			flags = BTSNOOP_FLAG_CMD_EVT;
+			break;
+		case H4_TYPE_ACL:
+			incl_len = (len > HCI_SNOOP_ACL_LEN) ? HCI_SNOOP_ACL_LEN : len;
+			flags = 0;
+			break;
+		case H4_TYPE_SCO:
+			incl_len = (len > HCI_SNOOP_SCO_LEN) ? HCI_SNOOP_SCO_LEN : len;
+			flags = 0;
+			break;
+		default:
+			return;
+	}
+	if (received) flags |= BTSNOOP_FLAG_RECEIVED;
+	
+	portENTER_CRITICAL(&hci_snoop_mux);
+	if (snoop_recording) {
+		rec = _hciSnoopReserve((HCI_SNOOP_REC_LEN + incl_len + 7) & ~7);
+		rec->flags = flags;
+		rec->orig_len = len;
+		rec->incl_len = incl_len;
+		rec->usec = esp_timer_get_time();
+		memcpy((uint8_t*) rec + HCI_SNOOP_REC_LEN, data, incl_len);
+		
+		cycles = esp_cpu_get_ccount() - start;
+		tap_cycles_sum += cycles;
+		tap_count++;
+		if (cycles > hci_snoop_stats.max_tap_cycles) hci_snoop_stats.max_tap_cycles = cycles;
+	} else {
+		hci_snoop_stats.missed++;
+	}
+	portEXIT_CRITICAL(&hci_snoop_mux);
+}
+
+
+// Make room for a record at the head, overwriting the oldest records as necessary - call with
+// hci_snoop_mux held
+static hci_snoop_rec_t* _hciSnoopReserve(uint32_t size)
+{
+	hci_snoop_rec_t* rec;
+	
+	if ((snoop_head + size) > HCI_SNOOP_RING_LEN) {
+		// Drop the records between the head and the end and start over at the beginning
+		while ((snoop_count > 0) && (snoop_tail >= snoop_head)) {
+			_hciSnoopDropOldest();
+		}
+		if ((HCI_SNOOP_RING_LEN - snoop_head) >= HCI_SNOOP_REC_LEN) {
+			((hci_snoop_rec_t*) &snoop_buf[snoop_head])->size = 0;
+		}
+		snoop_head = 0;
+	}
+	while ((snoop_count > 0) && (snoop_tail >= snoop_head) && (snoop_tail < (snoop_head + size))) {
+		_hciSnoopDropOldest();
+	}
+	
+	if (snoop_count == 0) {
+		snoop_tail = snoop_head;
+	}
+	rec = (hci_snoop_rec_t*) &snoop_buf[snoop_head];
+	rec->size = (uint16_t) size;
+	snoop_head += size;
+	snoop_count++;
+	
+	return rec;
+}
+
+
+static void _hciSnoopDropOldest()
+{
+	snoop_tail += ((hci_snoop_rec_t*) &snoop_buf[snoop_tail])->size;
+	snoop_count--;
+	hci_snoop_stats.overwritten++;
+	
+	// Skip the unused end of the ring
+	if (((snoop_tail + HCI_SNOOP_REC_LEN) > HCI_SNOOP_RING_LEN) || (((hci_snoop_rec_t*) &snoop_buf[snoop_tail])->size == 0)) {
+		snoop_tail = 0;
+	}
+}
+
+
+// Stop recording and queue the ring to be saved.  Runs from the esp_timer task after a
+// trigger or from the caller of hci_snoop_save.
+static void _hciSnoopStop(void* arg)
+{
+	struct timeval tv;
+	
+	portENTER_CRITICAL(&hci_snoop_mux);
+	snoop_recording = false;
+	save_rd = snoop_tail;
+	save_left = snoop_count;
+	portEXIT_CRITICAL(&hci_snoop_mux);
+	
+	(void) gettimeofday(&tv, NULL);
+	save_offset_usec = ((int64_t) tv.tv_sec * 1000000 + tv.tv_usec) - esp_timer_get_time();
+	save_first = true;
+	
+	if (!bg_job_submit("hci_snoop", &_hciSnoopSaveJob, NULL, BG_JOB_PRIO_LOW)) {
+		ESP_LOGE(TAG, "Could not queue the capture to be saved");
+		hci_snoop_stats.save_failures++;
+		_hciSnoopRestart();
+	}
+}
+
+
+static void _hciSnoopRestart()
+{
+	portENTER_CRITICAL(&hci_snoop_mux);
+	snoop_head = 0;
+	snoop_tail = 0;
+	snoop_count = 0;
+	hci_snoop_stats.overwritten = 0;
+	snoop_recording = true;
+	portEXIT_CRITICAL(&hci_snoop_mux);
+	
+	last_save_tick = xTaskGetTickCount();
+	atomic_store(&save_pending, false);
+}
+
+
+// Background job writing the stopped ring to the card, a batch of records per slice
+static bool _hciSnoopSaveJob(void* arg)
+{
+	uint8_t hdr[16];
+	uint8_t* p;
+	struct stat st;
+	FILE* fp;
+	int n = 0;
+	bool ok = true;
+	
+	if (!sd_card_mount()) {
+		ESP_LOGE(TAG, "Could not mount the card to save the capture");
+		hci_snoop_stats.save_failures++;
+		_hciSnoopRestart();
+		return false;
+	}
+	
+	if (save_first) {
+		// Don't overwrite captures from before a reset
+		do {
+			sprintf(save_filename, "%s/btsnoop%d.log", SD_CARD_MOUNT_POINT, file_num);
+		} while ((stat(save_filename, &st) == 0) && (++file_num < 10000));
+		
+		fp = fopen(save_filename, "wb");
+		if (fp != NULL) {
+			memcpy(hdr, BTSNOOP_ID, 8);
+			p = _hciSnoopPutU32(&hdr[8], BTSNOOP_VERSION);
+			(void) _hciSnoopPutU32(p, BTSNOOP_DATALINK_H4);
+			ok = fwrite(hdr, 1, 16, fp) == 16;
+		}
+		save_first = false;
+	} else {
+		fp = fopen(save_filename, "ab");
+	}
+	
+	if (fp == NULL) {
+		ESP_LOGE(TAG, "Could not open %s", save_filename);
+		ok = false;
+	} else {
+		while (ok && (save_left > 0) && ((n++ < HCI_SNOOP_SLICE_RECS) || !bg_job_should_yield())) {
+			ok = _hciSnoopWriteRec(fp);
+		}
+		fclose(fp);
+	}
+	
+	sd_card_unmount();
+	
+	if (!ok) {
+		ESP_LOGE(TAG, "Could not write %s", save_filename);
+		hci_snoop_stats.save_failures++;
+		file_num++;
+		_hciSnoopRestart();
+		return false;
+	}
+	
+	if (save_left == 0) {
+		ESP_LOGI(TAG, "Saved btsnoop%d.log", file_num);
+		hci_snoop_stats.saves++;
+		hci_snoop_stats.last_file = file_num;
+		file_num++;
+		_hciSnoopRestart();
+		return false;
+	}
+	
+	return true;
+}
+
+
+static bool _hciSnoopWriteRec(FILE* fp)
+{
+	hci_snoop_rec_t* rec = (hci_snoop_rec_t*) &snoop_buf[save_rd];
+	uint8_t hdr[BTSNOOP_REC_HDR_LEN];
+	uint8_t* p;
+	uint64_t ts;
+	
+	ts = BTSNOOP_EPOCH_DELTA + (uint64_t) (rec->usec + save_offset_usec);
+	p = _hciSnoopPutU32(hdr, rec->orig_len);
+	p = _hciSnoopPutU32(p, rec->incl_len);
+	p = _hciSnoopPutU32(p, rec->flags);
+	p = _hciSnoopPutU32(p, 0);                    // Cumulative drops
+	p = _hciSnoopPutU32(p, (uint32_t) (ts >> 32));
+	(void) _hciSnoopPutU32(p, (uint32_t) ts);
+	if (fwrite(hdr, 1, BTSNOOP_REC_HDR_LEN, fp) != BTSNOOP_REC_HDR_LEN) return false;
+	if (fwrite((uint8_t*) rec + HCI_SNOOP_REC_LEN, 1, rec->incl_len, fp) != rec->incl_len) return false;
+	
+	// Next record, skipping the unused end of the ring
+	save_rd += rec->size;
+	if (((save_rd + HCI_SNOOP_REC_LEN) > HCI_SNOOP_RING_LEN) || (((hci_snoop_rec_t*) &snoop_buf[save_rd])->size == 0)) {
+		save_rd = 0;
+	}
+	save_left--;
+	
+	return true;
+}
+
+
+// btsnoop files are big-endian
+static uint8_t* _hciSnoopPutU32(uint8_t* p, uint32_t v)
+{
+	*p++ = (uint8_t) (v >> 24);
+	*p++ = (uint8_t) (v >> 16);
+	*p++ = (uint8_t) (v >> 8);
+	*p++ = (uint8_t) v;
+	
+	return p;
+}
+
+#endif /* CONFIG_HCI_SNOOP_ENABLE */
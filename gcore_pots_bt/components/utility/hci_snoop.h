@@ -0,0 +1,92 @@
+/*
+ * hci_snoop - utility module recording the HCI traffic between Bluedroid and the Bluetooth
+ * controller so SCO timing and handsfree negotiation problems can be looked at on units in
+ * the field.  The VHCI calls Bluedroid makes are wrapped at link time (see CMakeLists.txt):
+ * every packet it sends to the controller and every packet the controller hands back to it
+ * is copied into a PSRAM ring on the way through.
+ *
+ * Commands and events are kept whole.  ACL and SCO packets are cut to their headers unless
+ * CONFIG_HCI_SNOOP_PAYLOADS is set, in which case the first CONFIG_HCI_SNOOP_SNAP_LEN bytes
+ * are kept (enough for the RFCOMM AT commands the handsfree negotiation is made of).  The cost
+ * on the Bluedroid and controller tasks is the copy of at most that many bytes (or a whole
+ * command or event) in a short critical section, measured and kept with the statistics.
+ *
+ * Recording starts at boot and runs continuously, overwriting the oldest packets.  A call to
+ * hci_snoop_trigger (audio_task on a deadline miss, a jitter buffer underrun or echo canceller
+ * divergence) stops it HCI_SNOOP_POST_TRIG_MSEC later so the ring holds the lead up to the
+ * problem and its aftermath.  The ring is then written to the Micro-SD Card as a btsnoop file
+ * (btsnoop<n>.log, the format Android's HCI snoop log uses, which Wireshark opens) by a
+ * background job so it is saved once the call is over, and recording starts over.  Timestamps
+ * are from esp_timer, offset to the time of day if it has been set.
+ *
+ * The module is compiled out unless CONFIG_HCI_SNOOP_ENABLE is set.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _HCI_SNOOP_H_
+#define _HCI_SNOOP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Time recorded after a trigger before recording stops
+#define HCI_SNOOP_POST_TRIG_MSEC 1000
+
+// Minimum time between triggered captures (measured from the end of the last save)
+#define HCI_SNOOP_HOLDOFF_MSEC   30000
+
+// Records written before a save slice checks if it should yield
+#define HCI_SNOOP_SLICE_RECS     64
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	bool recording;                       // False while a capture is waiting to be saved
+	uint32_t packets;                     // Packets in the ring
+	uint32_t ring_bytes;                  // Ring space they use
+	uint32_t overwritten;                 // Oldest packets overwritten since the last save
+	uint32_t missed;                      // Packets that passed while captures were waiting
+	uint32_t triggers;
+	uint32_t saves;
+	uint32_t save_failures;
+	int last_file;                        // Number of the last btsnoop<n>.log saved (0 for none)
+	uint32_t avg_tap_cycles;              // Cost of recording a packet
+	uint32_t max_tap_cycles;
+} hci_snoop_stats_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+bool hci_snoop_init();                    // Call from app_main before bt_task starts
+void hci_snoop_trigger();                 // Stop and save the ring HCI_SNOOP_POST_TRIG_MSEC from now
+void hci_snoop_save();                    // Stop and save it now (ignores the holdoff)
+void hci_snoop_get_stats(hci_snoop_stats_t* stats);
+#endif
+
+#endif /* _HCI_SNOOP_H_ */
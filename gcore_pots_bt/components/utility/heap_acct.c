@@ -0,0 +1,294 @@
+/*
+ * heap_acct - utility module counting heap use per task and catching allocations made
+ * during a call.  See heap_acct.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "heap_acct.h"
+#if (CONFIG_HEAP_ACCT_ENABLE == true)
+#include <stdlib.h>
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_debug_helpers.h"
+#include "esp_heap_caps.h"
+#include "esp_rom_sys.h"
+#include "freertos/task.h"
+
+
+//
+// Constants
+//
+
+// Fixed tags
+#define TAG_BOOT  0
+#define TAG_ISR   1
+#define TAG_OTHER (HEAP_ACCT_MAX_TAGS - 1)
+#define TAG_FIRST 2
+
+
+
+//
+// Variables
+//
+static portMUX_TYPE heap_acct_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static TaskHandle_t heap_acct_task[HEAP_ACCT_MAX_TAGS];
+static heap_acct_tag_t heap_acct_tags[HEAP_ACCT_MAX_TAGS] = {
+	[TAG_BOOT] = {.name = "boot"},
+	[TAG_ISR] = {.name = "isr"},
+	[TAG_OTHER] = {.name = "other"}
+};
+static int heap_acct_num_tags = TAG_FIRST;
+
+static volatile bool heap_acct_guard = false;
+static uint32_t heap_acct_guard_allocs = 0;
+static uint32_t heap_acct_guard_logs = 0;         // Violations logged this call
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _heapAcctTag();
+static void _heapAcctAlloc(void* p);
+static void _heapAcctFree(size_t len);
+
+
+
+//
+// Wrapped heap_caps entry points (linked with -Wl,--wrap=<name>)
+//
+void* __real_heap_caps_malloc(size_t size, uint32_t caps);
+void* __real_heap_caps_calloc(size_t n, size_t size, uint32_t caps);
+void* __real_heap_caps_realloc(void* ptr, size_t size, uint32_t caps);
+void __real_heap_caps_free(void* ptr);
+void* __real_heap_caps_malloc_default(size_t size);
+void* __real_heap_caps_realloc_default(void* ptr, size_t size);
+void* __real_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps);
+void* __real_heap_caps_aligned_calloc(size_t alignment, size_t n, size_t size, uint32_t caps);
+void __real_heap_caps_aligned_free(void* ptr);
+
+
+IRAM_ATTR void* __wrap_heap_caps_malloc(size_t size, uint32_t caps)
+{
+	void* p = __real_heap_caps_malloc(size, caps);
+	
+	_heapAcctAlloc(p);
+	return p;
+}
+
+
+IRAM_ATTR void* __wrap_heap_caps_calloc(size_t n, size_t size, uint32_t caps)
+{
+	void* p = __real_heap_caps_calloc(n, size, caps);
+	
+	_heapAcctAlloc(p);
+	return p;
+}
+
+
+IRAM_ATTR void* __wrap_heap_caps_realloc(void* ptr, size_t size, uint32_t caps)
+{
+	size_t old_len = (ptr != NULL) ? heap_caps_get_allocated_size(ptr) : 0;
+	void* p = __real_heap_caps_realloc(ptr, size, caps);
+	
+	// A failed realloc leaves the old block alone
+	if ((p != NULL) || (size == 0)) {
+		if (ptr != NULL) _heapAcctFree(old_len);
+		_heapAcctAlloc(p);
+	}
+	return p;
+}
+
+
+IRAM_ATTR void __wrap_heap_caps_free(void* ptr)
+{
+	if (ptr != NULL) {
+		_heapAcctFree(heap_caps_get_allocated_size(ptr));
+	}
+	__real_heap_caps_free(ptr);
+}
+
+
+IRAM_ATTR void* __wrap_heap_caps_malloc_default(size_t size)
+{
+	void* p = __real_heap_caps_malloc_default(size);
+	
+	_heapAcctAlloc(p);
+	return p;
+}
+
+
+IRAM_ATTR void* __wrap_heap_caps_realloc_default(void* ptr, size_t size)
+{
+	size_t old_len = (ptr != NULL) ? heap_caps_get_allocated_size(ptr) : 0;
+	void* p = __real_heap_caps_realloc_default(ptr, size);
+	
+	if ((p != NULL) || (size == 0)) {
+		if (ptr != NULL) _heapAcctFree(old_len);
+		_heapAcctAlloc(p);
+	}
+	return p;
+}
+
+
+IRAM_ATTR void* __wrap_heap_caps_aligned_alloc(size_t alignment, size_t size, uint32_t caps)
+{
+	void* p = __real_heap_caps_aligned_alloc(alignment, size, caps);
+	
+	_heapAcctAlloc(p);
+	return p;
+}
+
+
+IRAM_ATTR void* __wrap_heap_caps_aligned_calloc(size_t alignment, size_t n, size_t size, uint32_t caps)
+{
+	void* p = __real_heap_caps_aligned_calloc(alignment, n, size, caps);
+	
+	_heapAcctAlloc(p);
+	return p;
+}
+
+
+IRAM_ATTR void __wrap_heap_caps_aligned_free(void* ptr)
+{
+	if (ptr != NULL) {
+		_heapAcctFree(heap_caps_get_allocated_size(ptr));
+	}
+	__real_heap_caps_aligned_free(ptr);
+}
+
+
+
+//
+// API
+//
+void heap_acct_set_guard(bool en)
+{
+	if (en && !heap_acct_guard) {
+		// Each call gets its own set of logged violations
+		heap_acct_guard_logs = 0;
+	}
+	heap_acct_guard = en;
+}
+
+
+void heap_acct_get_stats(heap_acct_stats_t* stats)
+{
+	portENTER_CRITICAL(&heap_acct_mux);
+	stats->guard = heap_acct_guard;
+	stats->guard_allocs = heap_acct_guard_allocs;
+	stats->num_tags = heap_acct_num_tags;
+	memcpy(stats->tag, heap_acct_tags, sizeof(heap_acct_tags));
+	portEXIT_CRITICAL(&heap_acct_mux);
+	
+	// "other" is always last
+	if (stats->tag[TAG_OTHER].allocs != 0) {
+		stats->num_tags = HEAP_ACCT_MAX_TAGS;
+	}
+}
+
+
+void heap_acct_reset_guard()
+{
+	int i;
+	
+	portENTER_CRITICAL(&heap_acct_mux);
+	heap_acct_guard_allocs = 0;
+	heap_acct_guard_logs = 0;
+	for (i=0; i<HEAP_ACCT_MAX_TAGS; i++) {
+		heap_acct_tags[i].guard_allocs = 0;
+	}
+	portEXIT_CRITICAL(&heap_acct_mux);
+}
+
+
+
+//
+// Internal functions
+//
+
+// Returns the tag for the current context (call in the critical section)
+static IRAM_ATTR int _heapAcctTag()
+{
+	TaskHandle_t t;
+	int i;
+	
+	if (xPortInIsrContext()) return TAG_ISR;
+	if (xTaskGetSchedulerState() == taskSCHEDULER_NOT_STARTED) return TAG_BOOT;
+	
+	t = xTaskGetCurrentTaskHandle();
+	for (i=TAG_FIRST; i<heap_acct_num_tags; i++) {
+		if (heap_acct_task[i] == t) return i;
+	}
+	if (heap_acct_num_tags == TAG_OTHER) return TAG_OTHER;
+	
+	i = heap_acct_num_tags++;
+	heap_acct_task[i] = t;
+	strncpy(heap_acct_tags[i].name, pcTaskGetName(t), configMAX_TASK_NAME_LEN - 1);
+	return i;
+}
+
+
+static IRAM_ATTR void _heapAcctAlloc(void* p)
+{
+	heap_acct_tag_t* tag;
+	size_t len;
+	bool log = false;
+	
+	if (p == NULL) return;
+	len = heap_caps_get_allocated_size(p);
+	
+	portENTER_CRITICAL_SAFE(&heap_acct_mux);
+	tag = &heap_acct_tags[_heapAcctTag()];
+	tag->allocs += 1;
+	tag->live_bytes += (int32_t) len;
+	if (tag->live_bytes > tag->peak_bytes) tag->peak_bytes = tag->live_bytes;
+	if (heap_acct_guard) {
+		tag->guard_allocs += 1;
+		heap_acct_guard_allocs += 1;
+#if (CONFIG_HEAP_ACCT_GUARD_COUNT == false)
+		if (heap_acct_guard_logs < HEAP_ACCT_GUARD_MAX_LOGS) {
+			heap_acct_guard_logs += 1;
+			log = true;
+		}
+#endif
+	}
+	portEXIT_CRITICAL_SAFE(&heap_acct_mux);
+	
+	if (log) {
+		// Nothing here may allocate
+		esp_rom_printf("heap_acct: %u byte allocation by %s during a call\n", len, tag->name);
+		esp_backtrace_print(HEAP_ACCT_BT_DEPTH);
+#if (CONFIG_HEAP_ACCT_GUARD_ABORT == true)
+		abort();
+#endif
+	}
+}
+
+
+static IRAM_ATTR void _heapAcctFree(size_t len)
+{
+	heap_acct_tag_t* tag;
+	
+	portENTER_CRITICAL_SAFE(&heap_acct_mux);
+	tag = &heap_acct_tags[_heapAcctTag()];
+	tag->frees += 1;
+	tag->live_bytes -= (int32_t) len;
+	portEXIT_CRITICAL_SAFE(&heap_acct_mux);
+}
+
+#endif /* CONFIG_HEAP_ACCT_ENABLE */
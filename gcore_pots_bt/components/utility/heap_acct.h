@@ -0,0 +1,98 @@
+/*
+ * heap_acct - utility module counting heap use per task and catching allocations made
+ * during a call.  The ESP-IDF heap_caps entry points (which malloc, calloc, realloc and free
+ * go through) are wrapped at link time (see the utility CMakeLists) so every allocation and
+ * free is charged to the task making it: allocation and free counts and the bytes it has
+ * allocated less those it has freed.  Each task is one component here (the application tasks,
+ * the Bluedroid tasks, the utility workers), and ISR and pre-scheduler use have their own tags.
+ *
+ * audio_task sets the call guard while a voice stream is running.  Any allocation from any
+ * task while it's set is counted and, depending on the configured guard action, just counted,
+ * logged with a backtrace (the first HEAP_ACCT_GUARD_MAX_LOGS each call) or logged and followed
+ * by an abort so the hot path can be proven, and kept, allocation free.
+ *
+ * Sizes are the heap block sizes (heap_caps_get_allocated_size) so they can run slightly over
+ * the sizes asked for.  heap_caps_*_prefer calls aren't seen.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _HEAP_ACCT_H_
+#define _HEAP_ACCT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Most tags tracked (later tasks are charged to the last, "other")
+#define HEAP_ACCT_MAX_TAGS       24
+
+// Guard violations logged each call (all are counted)
+#define HEAP_ACCT_GUARD_MAX_LOGS 16
+
+// Backtrace depth logged for a guard violation
+#define HEAP_ACCT_BT_DEPTH       12
+
+
+
+//
+// Guard macro (compiled out when accounting is disabled)
+//
+#if (CONFIG_HEAP_ACCT_ENABLE == true)
+#define HEAP_ACCT_GUARD(en) heap_acct_set_guard(en)
+#else
+#define HEAP_ACCT_GUARD(en)
+#endif
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	char name[configMAX_TASK_NAME_LEN];
+	uint32_t allocs;
+	uint32_t frees;
+	int32_t live_bytes;                   // Allocated less freed by this tag (negative if it frees others' blocks)
+	int32_t peak_bytes;
+	uint32_t guard_allocs;                // Allocations while the call guard was set
+} heap_acct_tag_t;
+
+typedef struct {
+	bool guard;                           // Call guard currently set
+	uint32_t guard_allocs;                // All allocations while the guard was set
+	int num_tags;
+	heap_acct_tag_t tag[HEAP_ACCT_MAX_TAGS];
+} heap_acct_stats_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_HEAP_ACCT_ENABLE == true)
+void heap_acct_set_guard(bool en);              // audio_task only
+void heap_acct_get_stats(heap_acct_stats_t* stats);
+void heap_acct_reset_guard();                   // Clear the guard violation counts
+#endif
+
+#endif /* _HEAP_ACCT_H_ */
@@ -0,0 +1,285 @@
+/*
+ * hsm - utility module running the tasks' state machines from const tables.  See hsm.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "hsm.h"
+#include <string.h>
+#include "blackbox.h"
+#include "dlog.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "soft_timer.h"
+
+
+//
+// Variables
+//
+static const char* TAG = "hsm";
+
+// Protects the trace rings (read by the CLI from its own task) and the registry
+static portMUX_TYPE hsm_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static hsm_t* hsm_machines[HSM_MAX_MACHINES];
+static int hsm_num_machines = 0;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _hsmCommonParent(const hsm_t* m, int a, int b);
+static bool _hsmNested(const hsm_t* m, int s, int p);
+static void _hsmTransition(hsm_t* m, const hsm_trans_t* r, uint16_t evt);
+static void _hsmTrace(hsm_t* m, uint16_t evt, int from, int to);
+
+
+
+//
+// API
+//
+void hsm_init(hsm_t* m, const hsm_def_t* def, int initial, int timer, uint16_t timer_evt)
+{
+	int i;
+	bool found = false;
+	
+	memset(m, 0, sizeof(hsm_t));
+	m->def = def;
+	m->timer = timer;
+	m->timer_evt = timer_evt;
+	m->state = initial;
+	m->state_usec = esp_timer_get_time();
+	m->now_usec = m->state_usec;
+	
+	portENTER_CRITICAL(&hsm_mux);
+	for (i=0; i<hsm_num_machines; i++) {
+		if (hsm_machines[i] == m) found = true;
+	}
+	if (!found && (hsm_num_machines < HSM_MAX_MACHINES)) {
+		hsm_machines[hsm_num_machines++] = m;
+		found = true;
+	}
+	portEXIT_CRITICAL(&hsm_mux);
+	
+	if (!found) {
+		ESP_LOGW(TAG, "Too many machines to register %s", def->tag);
+	}
+}
+
+
+bool hsm_dispatch(hsm_t* m, uint16_t evt)
+{
+	return hsm_dispatch_at(m, evt, esp_timer_get_time());
+}
+
+
+bool hsm_dispatch_at(hsm_t* m, uint16_t evt, int64_t usec)
+{
+	const hsm_def_t* d = m->def;
+	const hsm_trans_t* r;
+	int i;
+	
+	m->now_usec = usec;
+	
+	// The timer event only means something if it isn't left over from an earlier state
+	if ((m->timer >= 0) && (evt == m->timer_evt)) {
+		evt = soft_timer_expired(m->timer) ? HSM_EVT_TIMEOUT : HSM_EVT_NONE;
+	}
+	
+	for (i=0; i<d->num_trans; i++) {
+		r = &d->trans[i];
+		if ((r->event != HSM_EVT_ANY) && (r->event != evt)) continue;
+		if (!_hsmNested(m, m->state, r->state)) continue;
+		if ((r->after_msec != 0) && ((usec - m->state_usec) < ((int64_t) r->after_msec * 1000))) continue;
+		if ((r->guard != NULL) && !r->guard()) continue;
+		
+		_hsmTransition(m, r, evt);
+		return true;
+	}
+	
+	return false;
+}
+
+
+void hsm_run(hsm_t* m, uint16_t evt, int max_steps)
+{
+	hsm_run_at(m, evt, esp_timer_get_time(), max_steps);
+}
+
+
+void hsm_run_at(hsm_t* m, uint16_t evt, int64_t usec, int max_steps)
+{
+	int prev_state;
+	int n = 0;
+	
+	do {
+		prev_state = m->state;
+		if (!hsm_dispatch_at(m, evt, usec)) break;
+		evt = HSM_EVT_NONE;
+	} while ((m->state != prev_state) && (++n < max_steps));
+}
+
+
+int hsm_state(const hsm_t* m)
+{
+	return m->state;
+}
+
+
+bool hsm_in(const hsm_t* m, int s)
+{
+	return _hsmNested(m, m->state, s);
+}
+
+
+int64_t hsm_time_in_state(const hsm_t* m)
+{
+	return m->now_usec - m->state_usec;
+}
+
+
+const char* hsm_state_name(const hsm_t* m, int s)
+{
+	if ((s < 0) || (s >= m->def->num_states)) return "-";
+	return m->def->states[s].name;
+}
+
+
+int hsm_get_trace(const hsm_t* m, hsm_trace_t* trace, int max)
+{
+	int i, n, first;
+	
+	portENTER_CRITICAL(&hsm_mux);
+	n = (m->transitions < HSM_TRACE_LEN) ? (int) m->transitions : HSM_TRACE_LEN;
+	if (n > max) n = max;
+	first = m->trace_next - n;
+	if (first < 0) first += HSM_TRACE_LEN;
+	for (i=0; i<n; i++) {
+		trace[i] = m->trace[(first + i) % HSM_TRACE_LEN];
+	}
+	portEXIT_CRITICAL(&hsm_mux);
+	
+	return n;
+}
+
+
+const hsm_t* hsm_get(int n)
+{
+	if ((n < 0) || (n >= hsm_num_machines)) return NULL;
+	return hsm_machines[n];
+}
+
+
+
+//
+// Internal functions
+//
+
+// Returns the innermost state both a and b are nested in (HSM_NONE if only the top level)
+static int _hsmCommonParent(const hsm_t* m, int a, int b)
+{
+	int n = 0;
+	
+	while ((a != HSM_NONE) && (n++ < HSM_MAX_DEPTH)) {
+		if (_hsmNested(m, b, a)) return a;
+		a = m->def->states[a].parent;
+	}
+	return HSM_NONE;
+}
+
+
+// True if s is p or nested in p
+static bool _hsmNested(const hsm_t* m, int s, int p)
+{
+	int n = 0;
+	
+	while ((s != HSM_NONE) && (n++ < HSM_MAX_DEPTH)) {
+		if (s == p) return true;
+		s = m->def->states[s].parent;
+	}
+	return false;
+}
+
+
+static void _hsmTransition(hsm_t* m, const hsm_trans_t* r, uint16_t evt)
+{
+	const hsm_def_t* d = m->def;
+	int from = m->state;
+	int to = r->next;
+	int path[HSM_MAX_DEPTH];
+	int common, s, n;
+	
+	if (to == HSM_NONE) {
+		// Internal transition
+		if (r->action != NULL) r->action();
+		_hsmTrace(m, evt, from, HSM_NONE);
+		return;
+	}
+	
+	if (d->pre_change != NULL) d->pre_change(from, to);
+	
+	// A self-transition leaves and re-enters the state (restarting its timeout)
+	common = (to == from) ? d->states[from].parent : _hsmCommonParent(m, from, to);
+	
+	for (s=from; s!=common; s=d->states[s].parent) {
+		if (d->states[s].exit != NULL) d->states[s].exit(to);
+	}
+	
+	if (r->action != NULL) r->action();
+	
+	n = 0;
+	for (s=to; (s!=common) && (n<HSM_MAX_DEPTH); s=d->states[s].parent) {
+		path[n++] = s;
+	}
+	while (n > 0) {
+		s = path[--n];
+		if (d->states[s].entry != NULL) d->states[s].entry(from);
+	}
+	
+	m->state = to;
+	m->state_usec = m->now_usec;
+	
+	if (m->timer >= 0) {
+		if (d->states[to].timeout_msec != 0) {
+			soft_timer_start(m->timer, d->states[to].timeout_msec);
+		} else {
+			soft_timer_stop(m->timer);
+		}
+	}
+	
+	_hsmTrace(m, evt, from, to);
+	
+	if ((from != to) && d->log) {
+		DLOGI(d->tag, "%s->%s", d->states[from].name, d->states[to].name);
+		blackbox_state(d->tag, d->states[from].name, d->states[to].name);
+	}
+	
+	if (d->post_change != NULL) d->post_change(from, to);
+}
+
+
+static void _hsmTrace(hsm_t* m, uint16_t evt, int from, int to)
+{
+	portENTER_CRITICAL(&hsm_mux);
+	m->trace[m->trace_next].usec = m->now_usec;
+	m->trace[m->trace_next].event = evt;
+	m->trace[m->trace_next].from = (int8_t) from;
+	m->trace[m->trace_next].to = (int8_t) to;
+	if (++m->trace_next >= HSM_TRACE_LEN) m->trace_next = 0;
+	m->transitions++;
+	portEXIT_CRITICAL(&hsm_mux);
+}
@@ -0,0 +1,143 @@
+/*
+ * hsm - utility module running the tasks' state machines from const tables so each state's
+ * behavior is data instead of a hand-written switch statement re-evaluated on every event or
+ * tick.  A machine is described by:
+ *
+ *   - a state table: each state's name, parent (states nest so rows common to a group of
+ *     states are written once on the parent), entry and exit actions and an optional timeout
+ *   - a transition table: rows of {state, event, guard, minimum time in state, next state,
+ *     action} scanned in order, the first row that applies to the current state or one of its
+ *     parents wins (so the table order is the priority order the old if/else chains had)
+ *
+ * Event ids are the task's own evt_bus ids (or any other 16-bit ids the task chooses) so
+ * hsm_dispatch is called with the event just received.  A row for HSM_EVT_ANY matches any
+ * event and is how conditions on the task's state variables (the guards) are written.
+ * hsm_run dispatches an event and then HSM_EVT_NONE (which only the HSM_EVT_ANY rows match)
+ * until the machine settles since one event can enable several transitions in a row.
+ *
+ * A state with a timeout starts the machine's soft_timer when it is entered (re-entered for a
+ * self-transition) and stops it when left.  The timer posts the task's timer event through
+ * the evt_bus as usual and the dispatch turns it into HSM_EVT_TIMEOUT if it hasn't gone stale.
+ * A row's after_msec guard instead compares the time in the state against the time passed to
+ * hsm_dispatch_at so tasks working from timestamped edges (the hook switch) needn't use timers.
+ *
+ * A transition runs the exits from the current state up to the common parent, the row's
+ * action and the entries down to the next state (a row with next set to HSM_NONE only runs
+ * its action).  The last HSM_TRACE_LEN transitions of each machine are kept with their
+ * timestamps and events, state changes are logged through dlog (if the machine's log flag is
+ * set) and the blackbox.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _HSM_H_
+#define _HSM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// State used as "no state": top level parent and internal transition next state
+#define HSM_NONE              -1
+
+// Reserved event ids (task event ids must be below these)
+#define HSM_EVT_NONE          0xFFFD      // Settling step, only matches HSM_EVT_ANY rows
+#define HSM_EVT_TIMEOUT       0xFFFE      // The current state's timeout expired
+#define HSM_EVT_ANY           0xFFFF      // Table only: row matches any event
+
+// Deepest state nesting
+#define HSM_MAX_DEPTH         4
+
+// Transitions kept for each machine
+#define HSM_TRACE_LEN         16
+
+// Machines registered for hsm_get
+#define HSM_MAX_MACHINES      8
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const char* name;
+	int parent;                           // HSM_NONE for a top level state
+	void (*entry)(int from);              // May be NULL
+	void (*exit)(int to);                 // May be NULL
+	uint32_t timeout_msec;                // Starts the machine's timer on entry (0 for none)
+} hsm_state_t;
+
+typedef struct {
+	int state;                            // Applies in this state and the states nested in it
+	uint16_t event;                       // Event id, HSM_EVT_TIMEOUT or HSM_EVT_ANY
+	bool (*guard)();                      // NULL for none
+	uint32_t after_msec;                  // Only once this long in the current state (0 for none)
+	int next;                             // HSM_NONE for an internal transition (action only)
+	void (*action)();                     // May be NULL
+} hsm_trans_t;
+
+typedef struct {
+	const char* tag;                      // Log tag (the task's)
+	const hsm_state_t* states;            // Indexed by state
+	int num_states;
+	const hsm_trans_t* trans;
+	int num_trans;
+	void (*pre_change)(int from, int to);   // Before the exits of any transition (may be NULL)
+	void (*post_change)(int from, int to);  // After the state is set (may be NULL)
+	bool log;                             // Log state changes through dlog
+} hsm_def_t;
+
+typedef struct {
+	int64_t usec;
+	uint16_t event;
+	int8_t from;
+	int8_t to;                            // HSM_NONE for an internal transition
+} hsm_trace_t;
+
+typedef struct {
+	const hsm_def_t* def;
+	int timer;                            // soft_timer for state timeouts (SOFT_TIMER_INVALID for none)
+	uint16_t timer_evt;                   // Event the timer posts
+	int state;
+	int64_t state_usec;                   // When the current state was entered
+	int64_t now_usec;                     // Time of the event being dispatched
+	uint32_t transitions;
+	int trace_next;
+	hsm_trace_t trace[HSM_TRACE_LEN];
+} hsm_t;
+
+
+
+//
+// API
+//
+void hsm_init(hsm_t* m, const hsm_def_t* def, int initial, int timer, uint16_t timer_evt);  // No entry action for initial
+bool hsm_dispatch(hsm_t* m, uint16_t evt);                // True if a row was taken
+bool hsm_dispatch_at(hsm_t* m, uint16_t evt, int64_t usec);   // usec is the esp_timer time of the event
+void hsm_run(hsm_t* m, uint16_t evt, int max_steps);      // Dispatch then settle, at most max_steps transitions
+void hsm_run_at(hsm_t* m, uint16_t evt, int64_t usec, int max_steps);
+int hsm_state(const hsm_t* m);
+bool hsm_in(const hsm_t* m, int s);                       // Current state is s or nested in s
+int64_t hsm_time_in_state(const hsm_t* m);                // usec, from guards and actions: at the event time
+const char* hsm_state_name(const hsm_t* m, int s);
+int hsm_get_trace(const hsm_t* m, hsm_trace_t* trace, int max);   // Oldest first, returns number copied
+const hsm_t* hsm_get(int n);                              // n-th initialized machine or NULL
+
+#endif /* _HSM_H_ */
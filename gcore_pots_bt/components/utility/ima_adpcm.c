@@ -0,0 +1,137 @@
+/*
+ * ima_adpcm - utility module implementing the IMA ADPCM codec used to store audio on the
+ * Micro-SD card.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "ima_adpcm.h"
+
+
+//
+// Variables
+//
+static const int16_t ima_step_table[89] = {
+	    7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+	   19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+	   50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+	  130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+	  337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+	  876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+	 2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+	 5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+	15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+static const int8_t ima_index_table[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+
+
+//
+// Forward declarations for internal functions
+//
+static __inline__ void _ima_update(ima_state_t* s, int code, int vpdiff);
+
+
+
+//
+// API
+//
+void ima_init(ima_state_t* s)
+{
+	s->predicted = 0;
+	s->step_index = 0;
+}
+
+
+int ima_encode(ima_state_t* s, const int16_t* in, uint8_t* out, int len)
+{
+	int code, diff, step, vpdiff;
+	
+	for (int i=0; i<len; i++) {
+		step = ima_step_table[s->step_index];
+		diff = in[i] - s->predicted;
+		if (diff < 0) {
+			code = 8;
+			diff = -diff;
+		} else {
+			code = 0;
+		}
+	
+		// Quantize the difference to 3 bits of step, tracking what the decoder will rebuild
+		vpdiff = step >> 3;
+		if (diff >= step) {
+			code |= 4;
+			diff -= step;
+			vpdiff += step;
+		}
+		step >>= 1;
+		if (diff >= step) {
+			code |= 2;
+			diff -= step;
+			vpdiff += step;
+		}
+		step >>= 1;
+		if (diff >= step) {
+			code |= 1;
+			vpdiff += step;
+		}
+	
+		_ima_update(s, code, vpdiff);
+	
+		if ((i & 1) == 0) {
+			out[i/2] = (uint8_t) code;
+		} else {
+			out[i/2] |= (uint8_t) (code << 4);
+		}
+	}
+	
+	return (len + 1) / 2;
+}
+
+
+void ima_decode(ima_state_t* s, const uint8_t* in, int16_t* out, int len)
+{
+	int code, step, vpdiff;
+	
+	for (int i=0; i<len; i++) {
+		code = (i & 1) ? (in[i/2] >> 4) : (in[i/2] & 0x0F);
+	
+		step = ima_step_table[s->step_index];
+		vpdiff = step >> 3;
+		if (code & 4) vpdiff += step;
+		if (code & 2) vpdiff += step >> 1;
+		if (code & 1) vpdiff += step >> 2;
+	
+		_ima_update(s, code, vpdiff);
+		out[i] = (int16_t) s->predicted;
+	}
+}
+
+
+
+//
+// Internal functions
+//
+static __inline__ void _ima_update(ima_state_t* s, int code, int vpdiff)
+{
+	s->predicted += (code & 8) ? -vpdiff : vpdiff;
+	if (s->predicted > INT16_MAX) s->predicted = INT16_MAX;
+	if (s->predicted < INT16_MIN) s->predicted = INT16_MIN;
+	
+	s->step_index += ima_index_table[code & 7];
+	if (s->step_index < 0) s->step_index = 0;
+	if (s->step_index > 88) s->step_index = 88;
+}
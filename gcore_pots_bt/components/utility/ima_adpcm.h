@@ -0,0 +1,46 @@
+/*
+ * ima_adpcm - utility module implementing the IMA ADPCM codec used to store audio on the
+ * Micro-SD card at 4 bits per sample (the debug sample recorder and the answering machine).
+ * Samples are packed two per byte, first sample in the low nibble.  The state runs
+ * continuously across calls so a stream may be coded in any sized pieces.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _IMA_ADPCM_H_
+#define _IMA_ADPCM_H_
+
+#include <stdint.h>
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int predicted;                   // Last reconstructed sample
+	int step_index;                  // Index into the step table
+} ima_state_t;
+
+
+
+//
+// API
+//
+void ima_init(ima_state_t* s);                                          // Predictor and step index of 0
+int ima_encode(ima_state_t* s, const int16_t* in, uint8_t* out, int len);  // Returns bytes, an odd final sample is padded with a zero code
+void ima_decode(ima_state_t* s, const uint8_t* in, int16_t* out, int len); // len samples from (len+1)/2 bytes
+
+#endif /* _IMA_ADPCM_H_ */
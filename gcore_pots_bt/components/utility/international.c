@@ -2,6 +2,11 @@
  * Internationalization - Provide access to a data structure describing
  * various attributes of how POTS phones work in different countries.
  *
+ * The countries come from the database in the "intl" data partition when it holds a
+ * valid one (built by tools/intl_db.py and written without rebuilding the app).  The
+ * partition stays memory mapped so country names, dial plan strings and tone samples
+ * are used in place from flash.  The compiled-in table below is used otherwise.
+ *
  * Copyright 2023 Dan Julio
  *
  * This is free software: you can redistribute it and/or modify
@@ -20,6 +25,12 @@
  */
 #include "international.h"
 #include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "sdkconfig.h"
 //
 // Included samples files
 //
@@ -35,6 +46,123 @@
 // NUM_COUNTRIES must match data structure below
 #define NUM_COUNTRIES 7
 
+// Country database partition (data partition subtype) and format (see tools/intl_db.py)
+#define INT_DB_PART_NAME    "intl"
+#define INT_DB_PART_SUBTYPE 0x40
+#define INT_DB_MAGIC        0x4C544E49   /* "INTL" */
+#define INT_DB_VERSION      2
+#define INT_DB_NAME_LEN     32
+
+
+
+//
+// Database layout - all little endian and naturally aligned.  Offsets are from the start
+// of the database.
+//
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t num_countries;
+	uint32_t length;                // Total database bytes including this header
+	uint32_t crc;                   // CRC32 of the bytes following this header
+} int_db_header_t;
+
+typedef struct {
+	uint32_t offset;                // int16_t samples (0 for none)
+	uint32_t length;                // Number of samples
+} int_db_sample_t;
+
+typedef struct {
+	float tone[4];
+	float level;
+	int32_t num_cadence_pairs;
+	int32_t cadence_pairs[INT_MAX_TONE_PAIRS*2];
+} int_db_tone_t;
+
+typedef struct {
+	char name[INT_DB_NAME_LEN];     // Null terminated
+	uint16_t cid_spec;
+	uint16_t reserved;
+	int32_t cid_pre_msec;
+	int32_t cid_post_msec;
+	int32_t cid_rp_as_msec;
+	int_db_sample_t sample_set[INT_NUM_TONE_SETS];
+	int_db_tone_t tone_set[INT_NUM_TONE_SETS];
+	int32_t ring_freq;
+	int32_t ring_num_cadence_pairs;
+	int32_t ring_cadence_pairs[4];
+	int32_t off_hook_timeout;
+	int32_t rotary_map[10];
+	int32_t lec_tail_msec;
+	uint32_t dial_plan_offset;      // dial_plan_count consecutive null terminated strings
+	uint32_t dial_plan_count;
+} int_db_country_t;
+
+_Static_assert(sizeof(int_db_header_t) == 16, "int_db_header_t layout");
+_Static_assert(sizeof(int_db_country_t) == 320, "int_db_country_t layout");
+
+
+
+//
+// Dial plans (see dial_plan.h)
+//
+static const char* const aus_dial_plan[] = {
+	"!000", "!112", "!106",                                     // Emergency
+	"0[2-478]XXXXXXXX",                                         // National and mobile
+	"[2-9]XXXXXXX",                                             // Local
+	"13XXXX", "1[38]00XXXXXX",                                  // Information and freephone
+	"0011.",                                                    // International
+	NULL
+};
+
+static const char* const eur_dial_plan[] = {
+	"!112",                                                     // Emergency
+	"00.",                                                      // International
+	NULL
+};
+
+static const char* const ger_dial_plan[] = {
+	"!110", "!112",                                             // Emergency
+	NULL
+};
+
+static const char* const ind_dial_plan[] = {
+	"!100", "!101", "!102", "!108", "!112",                     // Emergency
+	"[6-9]XXXXXXXXX",                                           // Mobile
+	"0XXXXXXXXXX",                                              // National
+	"00.",                                                      // International
+	NULL
+};
+
+static const char* const nz_dial_plan[] = {
+	"!111",                                                     // Emergency
+	"0[3679]XXXXXXX",                                           // National
+	"[2-9]XXXXXX",                                              // Local
+	"0[58]00XXXXXX",                                            // Freephone
+	"02.",                                                      // Mobile (variable length)
+	"00.",                                                      // International
+	NULL
+};
+
+static const char* const us_dial_plan[] = {
+	"!N11",                                                     // 911 and the other N11 services
+	"1NXXNXXXXXX",                                              // Long distance
+	"NXXNXXXXXX",                                               // 10-digit
+	"NXXXXXX",                                                  // 7-digit (waits as it may become 10-digit)
+	"011.",                                                     // International
+	NULL
+};
+
+static const char* const uk_dial_plan[] = {
+	"!999", "!112",                                             // Emergency
+	"!1[01]1", "!100", "118XXX",                                // Services
+	"0[1-9]XXXXXXXXX",                                          // National and mobile
+	"00.",                                                      // International
+	NULL
+};
+
+
+
 // Country list - alphabetize by name for the GUI
 static const country_info_t country_info[] = {
 	{"Australia",
@@ -48,15 +176,19 @@ static const country_info_t country_info[] = {
 	    {AUS_DIALTONE_SAMPLES, snd_aus_dialtone},               //   Dial tone
 	    {0, NULL},                                              //   Reorder tone
 	    {0, NULL},                                              //   Off-hook tone
+	    {0, NULL},                                              //   Ringback tone
 	 },
 	 {                                                          // DDS generated tones:
 		{{0, 0, 0, 0}, 0, 0, {0, 0, 0, 0}},                     //   Dial tone
 		{{400, 0, 0, 0}, -13, 1, {375, 375, 0, 0}},             //   Reorder tone
 		{{1500, 0, 0, 0}, -10, 1, {0, 0, 0, 0}},                //   Off-hook tone
+		{{400, 450, 0, 0}, -19, 2, {400, 200, 400, 2000}},      //   Ringback tone
 	 },
 	 {25, 2, {400, 200, 400, 2000}},                            // Ring
 	 60000,                                                     // Off-hook timeout (mSec)
-	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0}                             // Rotary map
+	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0},                            // Rotary map
+	 32,                                                        // LEC tail (mSec)
+	 aus_dial_plan                                              // Dial plan
 	},
 	
 	{"Europe",
@@ -72,15 +204,19 @@ static const country_info_t country_info[] = {
 	    {0, NULL},                                              //   Dial tone
 	    {0, NULL},                                              //   Reorder tone
 	    {0, NULL},                                              //   Off-hook tone
+	    {0, NULL},                                              //   Ringback tone
 	 },
 	 {                                                          // DDS generated tones:
 		{{425, 0, 0, 0}, -13, 0, {0, 0, 0, 0}},                 //   Dial tone
 		{{425, 0, 0, 0}, -13, 1, {240, 240, 0, 0}},             //   Reorder tone
 		{{425, 0, 0, 0}, -56, 0, {0, 0, 0, 0}},                 //   Off-hook tone (quiet)
+		{{425, 0, 0, 0}, -13, 1, {1000, 4000, 0, 0}},           //   Ringback tone
 	 },
 	 {25, 1, {1000, 200, 0, 0}},                                // Ring
 	 0,                                                         // Off-hook timeout (mSec)
-	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0}                             // Rotary map
+	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0},                            // Rotary map
+	 32,                                                        // LEC tail (mSec)
+	 eur_dial_plan                                              // Dial plan
 	},
 	
 	{"Germany pre-1979",
@@ -94,15 +230,19 @@ static const country_info_t country_info[] = {
 	    {0, NULL},                                              //   Dial tone
 	    {0, NULL},                                              //   Reorder tone
 	    {0, NULL},                                              //   Off-hook tone
+	    {0, NULL},                                              //   Ringback tone
 	 },
 	 {                                                          // DDS generated tones:
 		{{475, 0, 475, 0}, -13, 2, {200, 300, 700, 800}},       //   Dial tone
 		{{475, 0, 0, 0}, -13, 1, {240, 240, 0, 0}},             //   Reorder tone
 		{{475, 0, 0, 0}, -56, 0, {0, 0, 0, 0}},                 //   Off-hook tone (quiet)
+		{{475, 0, 0, 0}, -13, 1, {1000, 4000, 0, 0}},           //   Ringback tone
 	 },
 	 {25, 1, {1000, 200, 0, 0}},                                // Ring
 	 0,                                                         // Off-hook timeout (mSec)
-	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0}                             // Rotary map
+	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0},                            // Rotary map
+	 32,                                                        // LEC tail (mSec)
+	 ger_dial_plan                                              // Dial plan
 	},
 	
 	{"India",
@@ -118,15 +258,19 @@ static const country_info_t country_info[] = {
 	    {INDIA_DIALTONE_SAMPLES, snd_india_dialtone},           //   Dial tone
 	    {0, NULL},                                              //   Reorder tone
 	    {0, NULL},                                              //   Off-hook tone
+	    {0, NULL},                                              //   Ringback tone
 	 },
 	 {                                                          // DDS generated tones:
 		{{0, 0, 0, 0}, 0, 0, {0, 0, 0, 0}},                     //   Dial tone
 		{{400, 0, 0, 0}, -13, 1, {250, 250, 0, 0}},             //   Reorder tone
 		{{400, 0, 0, 0}, -56, 1, {0, 0, 0, 0}},                 //   Off-hook tone (quiet)
+		{{400, 0, 0, 0}, -13, 2, {400, 200, 400, 2000}},        //   Ringback tone
 	 },
 	 {25, 2, {400, 200, 400, 2000}},                            // Ring
 	 0,                                                         // Off-hook timeout (mSec)
-	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0}                             // Rotary map
+	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0},                            // Rotary map
+	 32,                                                        // LEC tail (mSec)
+	 ind_dial_plan                                              // Dial plan
 	},
 	
 	{"New Zealand Rev",
@@ -140,15 +284,19 @@ static const country_info_t country_info[] = {
 	    {0, NULL},                                              //   Dial tone
 	    {0, NULL},                                              //   Reorder tone
 	    {0, NULL},                                              //   Off-hook tone
+	    {0, NULL},                                              //   Ringback tone
 	 },
 	 {                                                          // DDS generated tones:
 		{{400, 0, 0, 0}, -13, 0, {0, 0, 0, 0}},                 //   Dial tone
 		{{400, 0, 0, 0}, -13, 1, {250, 250, 0, 0}},             //   Reorder tone
 		{{400, 0, 0, 0}, -56, 1, {0, 0, 0, 0}},                 //   Off-hook tone (quiet)
+		{{400, 450, 0, 0}, -19, 2, {400, 200, 400, 2000}},      //   Ringback tone
 	 },
 	 {25, 2, {400, 200, 400, 200}},                             // Ring
 	 0,                                                         // Off-hook timeout (mSec)
-	 {9, 8, 7, 6, 5, 4, 3, 2, 1, 0}                             // Rotary map
+	 {9, 8, 7, 6, 5, 4, 3, 2, 1, 0},                            // Rotary map
+	 32,                                                        // LEC tail (mSec)
+	 nz_dial_plan                                               // Dial plan
 	},
 	
 	{"United States",
@@ -162,15 +310,19 @@ static const country_info_t country_info[] = {
 	    {0, NULL},                                              //   Dial tone
 	    {0, NULL},                                              //   Reorder tone
 	    {0, NULL},                                              //   Off-hook tone
+	    {0, NULL},                                              //   Ringback tone
 	 },
 	 {                                                          // DDS generated tones:
 		{{350, 440, 0, 0}, -13, 0, {0, 0, 0, 0}},               //   Dial tone
 		{{480, 620, 0, 0}, -13, 1, {250, 250, 0, 0}},           //   Reorder tone
 		{{1400, 2060, 2450, 2600}, -10, 1, {100, 100, 0, 0}},   //   Off-hook tone
+		{{440, 480, 0, 0}, -19, 1, {2000, 4000, 0, 0}},         //   Ringback tone
 	 },
 	 {20, 1, {2000, 200, 0, 0}},                                // Ring
 	 60000,                                                     // Off-hook timeout (mSec)
-	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0}                             // Rotary map
+	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0},                            // Rotary map
+	 32,                                                        // LEC tail (mSec)
+	 us_dial_plan                                               // Dial plan
 	},
 	
 	{"United Kingdom",
@@ -187,33 +339,227 @@ static const country_info_t country_info[] = {
 	    {0, NULL},                                              //   Dial tone
 	    {0, NULL},                                              //   Reorder tone
 	    {UK_OFFHOOK_SAMPLES, snd_uk_offhook},                   //   Off-hook tone
+	    {0, NULL},                                              //   Ringback tone
 	 },
 	 {                                                          // DDS generated tones:
 		{{350, 450, 0, 0}, -13, 0, {0, 0, 0, 0}},               //   Dial tone
 		{{400, 0, 0, 0}, -13, 2, {400, 350, 225, 525}},         //   Reorder tone
 		{{0, 0, 0, 0}, 0, 0, {0, 0, 0, 0}},                     //   Off-hook tone
+		{{400, 450, 0, 0}, -19, 2, {400, 200, 400, 2000}},      //   Ringback tone
 	 },
 	 {25, 2, {400, 200, 400, 200}},                             // Ring
 	 60000,                                                     // Off-hook timeout (mSec)
-	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0}                             // Rotary map
+	 {1, 2, 3, 4, 5, 6, 7, 8, 9, 0},                            // Rotary map
+	 32,                                                        // LEC tail (mSec)
+	 uk_dial_plan                                               // Dial plan
 	},
 };
 
 
+// Distinctive rings
+static const dist_ring_info_t dist_ring_info[INT_NUM_DIST_RINGS] = {
+	{2, {800, 400, 800, 200, 0, 0}},                           // Long-long
+	{3, {400, 200, 400, 200, 800, 200}},                       // Short-short-long
+	{3, {300, 200, 1000, 200, 300, 200}},                      // Short-long-short
+};
+
+
+
+
+//
+// Variables
+//
+static const char* TAG = "international";
+
+// Countries in use - the compiled-in table unless the database was loaded
+static const country_info_t* cur_country_info = country_info;
+static int cur_num_countries = NUM_COUNTRIES;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static bool _int_db_validate(const uint8_t* db, uint32_t part_len);
+static bool _int_db_load(const uint8_t* db);
+
+
+
 //
 // API
 //
+void int_init()
+{
+#if (CONFIG_INTL_DB_ENABLE == true)
+	const esp_partition_t* part;
+	const void* db;
+	spi_flash_mmap_handle_t handle;
+	
+	part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, INT_DB_PART_SUBTYPE, INT_DB_PART_NAME);
+	if (part == NULL) {
+		ESP_LOGI(TAG, "No country database partition");
+		return;
+	}
+	
+	// The mapping is kept for good since the countries point into it
+	if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &db, &handle) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not map the country database");
+		return;
+	}
+	
+	if (_int_db_validate((const uint8_t*) db, part->size) && _int_db_load((const uint8_t*) db)) {
+		ESP_LOGI(TAG, "%d countries from the database (version %d)", cur_num_countries,
+		         ((const int_db_header_t*) db)->version);
+	} else {
+		spi_flash_munmap(handle);
+	}
+#endif
+}
+
+
 int int_get_num_countries()
 {
-	return NUM_COUNTRIES;
+	return cur_num_countries;
 }
 
 
 const country_info_t* int_get_country_info(int n)
 {
-	if ((n < 0) || (n >= NUM_COUNTRIES)) {
+	if ((n < 0) || (n >= cur_num_countries)) {
 		return NULL;
 	}
 	
-	return &(country_info[n]);
+	return &(cur_country_info[n]);
+}
+
+
+const dist_ring_info_t* int_get_dist_ring_info(int n)
+{
+	if ((n < 1) || (n > INT_NUM_DIST_RINGS)) {
+		return NULL;
+	}
+	
+	return &(dist_ring_info[n-1]);
+}
+
+
+
+//
+// Internal functions
+//
+
+// Check the database is complete and every offset it holds is inside it
+static bool _int_db_validate(const uint8_t* db, uint32_t part_len)
+{
+	const int_db_header_t* hdrP = (const int_db_header_t*) db;
+	const int_db_country_t* cP;
+	uint32_t end;
+	int i, j;
+	
+	if (hdrP->magic != INT_DB_MAGIC) {
+		ESP_LOGI(TAG, "Country database partition is empty");
+		return false;
+	}
+	if (hdrP->version != INT_DB_VERSION) {
+		ESP_LOGE(TAG, "Unsupported country database version %d", hdrP->version);
+		return false;
+	}
+	if ((hdrP->length > part_len) || (hdrP->num_countries == 0) ||
+	    ((sizeof(int_db_header_t) + hdrP->num_countries * sizeof(int_db_country_t)) > hdrP->length)) {
+		ESP_LOGE(TAG, "Bad country database length");
+		return false;
+	}
+	if (esp_rom_crc32_le(0, db + sizeof(int_db_header_t), hdrP->length - sizeof(int_db_header_t)) != hdrP->crc) {
+		ESP_LOGE(TAG, "Bad country database CRC");
+		return false;
+	}
+	
+	cP = (const int_db_country_t*) (db + sizeof(int_db_header_t));
+	for (i=0; i<hdrP->num_countries; i++, cP++) {
+		if (memchr(cP->name, 0, INT_DB_NAME_LEN) == NULL) return false;
+		for (j=0; j<INT_NUM_TONE_SETS; j++) {
+			if ((cP->sample_set[j].length != 0) &&
+			    (((cP->sample_set[j].offset & 0x1) != 0) ||
+			     ((cP->sample_set[j].offset + cP->sample_set[j].length * sizeof(int16_t)) > hdrP->length))) {
+				return false;
+			}
+			if ((cP->tone_set[j].num_cadence_pairs < 0) || (cP->tone_set[j].num_cadence_pairs > INT_MAX_TONE_PAIRS)) {
+				return false;
+			}
+		}
+		if ((cP->ring_num_cadence_pairs < 1) || (cP->ring_num_cadence_pairs > 2)) return false;
+		
+		// Each dial plan string must end inside the database
+		end = cP->dial_plan_offset;
+		for (j=0; j<cP->dial_plan_count; j++) {
+			if (end >= hdrP->length) return false;
+			while ((end < hdrP->length) && (db[end] != 0)) end++;
+			if (end++ >= hdrP->length) return false;
+		}
+	}
+	
+	return true;
+}
+
+
+// Build the country list pointing into the database
+static bool _int_db_load(const uint8_t* db)
+{
+	const int_db_header_t* hdrP = (const int_db_header_t*) db;
+	const int_db_country_t* cP;
+	country_info_t* infoP;
+	country_info_t* ciP;
+	const char** planP;
+	const char* strP;
+	int i, j;
+	
+	infoP = calloc(hdrP->num_countries, sizeof(country_info_t));
+	if (infoP == NULL) {
+		ESP_LOGE(TAG, "Could not allocate the country list");
+		return false;
+	}
+	
+	cP = (const int_db_country_t*) (db + sizeof(int_db_header_t));
+	for (i=0; i<hdrP->num_countries; i++, cP++) {
+		ciP = &infoP[i];
+		ciP->name = (char*) cP->name;
+		ciP->cid.cid_spec = cP->cid_spec;
+		ciP->cid.pre_msec = cP->cid_pre_msec;
+		ciP->cid.post_msec = cP->cid_post_msec;
+		ciP->cid.rp_as_msec = cP->cid_rp_as_msec;
+		for (j=0; j<INT_NUM_TONE_SETS; j++) {
+			ciP->sample_set[j].length = cP->sample_set[j].length;
+			ciP->sample_set[j].sampleP = (cP->sample_set[j].length == 0) ? NULL :
+			                             (const int16_t*) (db + cP->sample_set[j].offset);
+			memcpy(ciP->tone_set[j].tone, cP->tone_set[j].tone, sizeof(ciP->tone_set[j].tone));
+			ciP->tone_set[j].level = cP->tone_set[j].level;
+			ciP->tone_set[j].num_cadence_pairs = cP->tone_set[j].num_cadence_pairs;
+			memcpy(ciP->tone_set[j].cadence_pairs, cP->tone_set[j].cadence_pairs, sizeof(ciP->tone_set[j].cadence_pairs));
+		}
+		ciP->ring_info.freq = cP->ring_freq;
+		ciP->ring_info.num_cadence_pairs = cP->ring_num_cadence_pairs;
+		memcpy(ciP->ring_info.cadence_pairs, cP->ring_cadence_pairs, sizeof(ciP->ring_info.cadence_pairs));
+		ciP->off_hook_timeout = cP->off_hook_timeout;
+		memcpy(ciP->rotary_map, cP->rotary_map, sizeof(ciP->rotary_map));
+		ciP->lec_tail_msec = cP->lec_tail_msec;
+		
+		// NULL terminated list of pointers to the dial plan strings
+		planP = calloc(cP->dial_plan_count + 1, sizeof(const char*));
+		if (planP == NULL) {
+			ESP_LOGE(TAG, "Could not allocate dial plan");
+			for (j=0; j<i; j++) free((void*) infoP[j].dial_plan);
+			free(infoP);
+			return false;
+		}
+		strP = (const char*) (db + cP->dial_plan_offset);
+		for (j=0; j<cP->dial_plan_count; j++) {
+			planP[j] = strP;
+			strP += strlen(strP) + 1;
+		}
+		ciP->dial_plan = planP;
+	}
+	
+	cur_country_info = infoP;
+	cur_num_countries = hdrP->num_countries;
+	return true;
 }
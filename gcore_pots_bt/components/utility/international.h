@@ -33,13 +33,19 @@
 // Maximum number of cadence pairs for use generating a tone
 #define INT_MAX_TONE_PAIRS      2
 
-// Number of tone sets (dial, re-order, off-hook)
-#define INT_NUM_TONE_SETS       3
+// Number of tone sets (dial, re-order, off-hook, ringback)
+#define INT_NUM_TONE_SETS       4
+
+// Distinctive rings (1 - INT_NUM_DIST_RINGS, 0 is the country's normal ring) and the most
+// cadence pairs one may have
+#define INT_NUM_DIST_RINGS      3
+#define INT_MAX_DIST_RING_PAIRS 3
 
 // Tone set indicies
 #define INT_TONE_SET_DIAL_INDEX 0
 #define INT_TONE_SET_RO_INDEX   1
 #define INT_TONE_SET_OH_INDEX   2
+#define INT_TONE_SET_RB_INDEX   3
 
 // Caller ID Specification Value
 //    Bits 15:8 : Flags
@@ -92,6 +98,18 @@
 //   7. Disable off-hook tone generation by setting off_hook_timeout to 0.  When doing this
 //      set the off-hook tone_info_t entry to the same as the dial tone entry but with the
 //      level set to -56 (essentially tone off).
+//   8. lec_tail_msec sets the default echo tail covered by the line echo canceller.  It may be
+//      overridden per-install through persistent storage.  Longer tails cost proportionally
+//      more processing time.
+//   9. dial_plan is a NULL terminated list of patterns (syntax in dial_plan.h) of the numbers
+//      that can be dialed.  A number matching a pattern, with no longer pattern it could still
+//      become, is dialed immediately.  Otherwise the post-dial timeout applies, so only list
+//      numbers whose length is known.
+//  10. The ringback tone is played while the phone reports the called party is being alerted
+//      on an outgoing call until the phone connects the call's audio.
+//  11. Distinctive rings are the same for every country and use the country's ring frequency.
+//      Their cadences follow the Telcordia GR-506 distinctive alerting patterns, each with the
+//      short final Ring Off of note 5.
 
 
 
@@ -123,6 +141,11 @@ typedef struct {
 	int cadence_pairs[4];      // On/Off time pairs in mSec
 } ring_info_t;
 
+typedef struct {
+	int num_cadence_pairs;     // Number of cadence pairs : minimum 1, maximum INT_MAX_DIST_RING_PAIRS
+	int cadence_pairs[INT_MAX_DIST_RING_PAIRS*2];  // On/Off time pairs in mSec
+} dist_ring_info_t;
+
 typedef struct {
 	char* name;                                   // Country identifier
 	cid_info_t cid;                               // Caller ID specification
@@ -131,6 +154,8 @@ typedef struct {
 	ring_info_t ring_info;                        // Ring information
 	int off_hook_timeout;                         // Timeout (mSec) to generate off-hook tone.  Set to 0 to disable off-hook tone
 	int rotary_map[10];                           // Maps pulses to dialed digit (some phones had reverse order!!!)
+	int lec_tail_msec;                            // Default line echo canceller tail length (mSec)
+	const char* const* dial_plan;                 // Numbers that can be dialed (see note 9)
 } country_info_t;
 
 
@@ -138,7 +163,9 @@ typedef struct {
 //
 // API
 //
+void int_init();                                      // Call once from app_main before any task uses the countries
 int int_get_num_countries();
 const country_info_t* int_get_country_info(int n);    // n = 0 .. num_countries - 1
+const dist_ring_info_t* int_get_dist_ring_info(int n); // n = 1 .. INT_NUM_DIST_RINGS (see note 11)
 
 #endif /* _INTERNATIONAL_H_ */
\ No newline at end of file
@@ -0,0 +1,173 @@
+/*
+ * latency - utility module measuring the echo path delay and impulse response by
+ * playing a periodic maximum length sequence (MLS) and cross-correlating one period of
+ * the returned audio with it.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "latency.h"
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+
+//
+// Constants
+//
+
+// Feedback tap (x^10 + x^7 + 1) for the right shifting LFSR
+#define LATENCY_LFSR_TAP    3
+
+// A clear echo's largest tap must be this many times the average tap
+#define LATENCY_PEAK_RATIO  4
+
+
+
+//
+// API
+//
+void latency_init(latency_state_t* s, int amplitude)
+{
+	int i;
+	unsigned int lfsr = 1;
+	unsigned int fb;
+
+	memset(s, 0, sizeof(latency_state_t));
+	s->amplitude = amplitude;
+
+	for (i=0; i<LATENCY_MLS_LEN; i++) {
+		s->mls[i] = lfsr & 1;
+		fb = (lfsr ^ (lfsr >> LATENCY_LFSR_TAP)) & 1;
+		lfsr = (lfsr >> 1) | (fb << (LATENCY_MLS_ORDER - 1));
+	}
+}
+
+
+// Load len samples (duplicated across stride channels) of the sequence into buf until the
+// capture is complete
+bool latency_tx(latency_state_t* s, int16_t* buf, int len, int stride)
+{
+	int i, c;
+	int16_t t;
+
+	if (s->rx_index >= 2*LATENCY_MLS_LEN) return false;
+
+	for (i=0; i<len; i++) {
+		t = s->mls[s->tx_index] ? s->amplitude : -s->amplitude;
+		if (++s->tx_index == LATENCY_MLS_LEN) s->tx_index = 0;
+		for (c=0; c<stride; c++) {
+			*buf++ = t;
+		}
+	}
+
+	return true;
+}
+
+
+// Capture the second period of returned audio (samples spaced stride apart in buf)
+bool latency_rx(latency_state_t* s, const int16_t* buf, int len, int stride)
+{
+	int i;
+	int16_t t;
+
+	for (i=0; i<len; i++) {
+		if (s->rx_index >= 2*LATENCY_MLS_LEN) break;
+
+		if (s->rx_index >= LATENCY_MLS_LEN) {
+			t = buf[i*stride];
+			s->rx[s->rx_index - LATENCY_MLS_LEN] = t;
+			s->rx_power += (int32_t) t * t;
+		}
+		s->rx_index++;
+	}
+
+	return (s->rx_index >= 2*LATENCY_MLS_LEN);
+}
+
+
+// Circular cross-correlation for up to lags more lags (split up so it can run a piece
+// at a time between audio buffers)
+bool latency_eval(latency_state_t* s, int lags)
+{
+	int j, k, n;
+	int32_t acc;
+
+	while ((lags-- > 0) && (s->lag_index < LATENCY_MAX_LAGS)) {
+		k = s->lag_index;
+
+		// rx[n] is the echo of the chip played at n - k
+		j = (LATENCY_MLS_LEN - k) % LATENCY_MLS_LEN;
+		acc = 0;
+		for (n=0; n<LATENCY_MLS_LEN; n++) {
+			if (s->mls[j]) {
+				acc += s->rx[n];
+			} else {
+				acc -= s->rx[n];
+			}
+			if (++j == LATENCY_MLS_LEN) j = 0;
+		}
+		s->corr[k] = acc;
+		s->lag_index++;
+	}
+
+	return (s->lag_index >= LATENCY_MAX_LAGS);
+}
+
+
+bool latency_get_result(latency_state_t* s, latency_result_t* r)
+{
+	int i, k;
+	int32_t a;
+	int32_t best = 0;
+	int64_t sum = 0;
+	int64_t scale = (int64_t) LATENCY_MLS_LEN * s->amplitude;
+	int64_t g;
+	float rx_mean;
+
+	memset(r, 0, sizeof(latency_result_t));
+	if ((s->lag_index < LATENCY_MAX_LAGS) || (scale == 0)) return false;
+
+	for (i=0; i<LATENCY_MAX_LAGS; i++) {
+		a = abs(s->corr[i]);
+		sum += a;
+		if (a > best) {
+			best = a;
+			r->delay = i;
+		}
+	}
+	for (i=0; i<LATENCY_MAX_LAGS; i++) {
+		if ((abs(s->corr[i]) * 8) >= best) break;
+	}
+	r->onset = i;
+	r->peak_q15 = (int) (((int64_t) s->corr[r->delay] * 32768) / scale);
+
+	// Played level against the returned level
+	rx_mean = (float) s->rx_power / LATENCY_MLS_LEN;
+	if (rx_mean < 1.0f) rx_mean = 1.0f;
+	r->erl_db = (int) roundf(10.0f * log10f(((float) s->amplitude * s->amplitude) / rx_mean));
+
+	for (i=0; i<LATENCY_IR_LEN; i++) {
+		k = r->onset - LATENCY_IR_PRE + i;
+		if ((k >= 0) && (k < LATENCY_MAX_LAGS)) {
+			g = ((int64_t) s->corr[k] * 32768) / scale;
+			if (g > INT16_MAX) g = INT16_MAX;
+			if (g < INT16_MIN) g = INT16_MIN;
+			r->ir[i] = (int16_t) g;
+		}
+	}
+
+	return ((best != 0) && ((int64_t) best * LATENCY_MAX_LAGS >= LATENCY_PEAK_RATIO * sum));
+}
@@ -0,0 +1,83 @@
+/*
+ * latency - utility module measuring the echo path delay and impulse response by
+ * playing a periodic maximum length sequence (MLS) and cross-correlating one period of
+ * the returned audio with it.  The circular cross-correlation of a periodic MLS is an
+ * impulse so each lag directly gives the echo path gain at that delay.
+ *
+ * The sequence is LATENCY_MLS_LEN samples long.  One period is played to fill the echo
+ * path before the next is captured so the delay measured must be less than its length.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _LATENCY_H_
+#define _LATENCY_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// MLS order and length (2^order - 1 samples, 128 mSec at 8 kHz)
+#define LATENCY_MLS_ORDER   10
+#define LATENCY_MLS_LEN     ((1 << LATENCY_MLS_ORDER) - 1)
+
+// Lags searched (64 mSec at 8 kHz)
+#define LATENCY_MAX_LAGS    512
+
+// Impulse response taps reported starting a few samples before the echo onset
+#define LATENCY_IR_LEN      32
+#define LATENCY_IR_PRE      4
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int amplitude;                        // Level of the played sequence
+	int tx_index;                         // Samples played
+	int rx_index;                         // Samples captured (counting the settling period)
+	int lag_index;                        // Next lag to correlate
+	uint8_t mls[LATENCY_MLS_LEN];         // Sequence chips (0/1 for -/+)
+	int16_t rx[LATENCY_MLS_LEN];          // Captured period
+	int32_t corr[LATENCY_MAX_LAGS];       // Cross-correlation for each lag
+	int64_t rx_power;                     // Sum of squares of the captured period
+} latency_state_t;
+
+typedef struct {
+	int delay;                            // Lag of the largest echo tap (samples)
+	int onset;                            // First lag at least 1/8 of the largest tap
+	int peak_q15;                         // Echo path gain at delay (Q15)
+	int erl_db;                           // Echo return loss (played to captured level)
+	int16_t ir[LATENCY_IR_LEN];           // Echo path gain (Q15) from onset - LATENCY_IR_PRE
+} latency_result_t;
+
+
+
+//
+// API
+//
+void latency_init(latency_state_t* s, int amplitude);
+bool latency_tx(latency_state_t* s, int16_t* buf, int len, int stride);  // False once the capture is complete
+bool latency_rx(latency_state_t* s, const int16_t* buf, int len, int stride);  // True once the capture is complete
+bool latency_eval(latency_state_t* s, int lags);                         // Correlate up to lags more, true when done
+bool latency_get_result(latency_state_t* s, latency_result_t* r);       // False if there was no clear echo
+
+#endif /* _LATENCY_H_ */
@@ -0,0 +1,78 @@
+/*
+ * limiter - utility module providing a block based look-ahead peak limiter.
+ *
+ * The gain each block needs to stay under the threshold is computed from its peak when it
+ * arrives.  The block before it is then output with its gain ramped linearly to a value
+ * neither block exceeds (or a release step above the last gain if that is lower).  Since a
+ * ramp between two gains a block allows stays within it, no output sample exceeds the
+ * threshold and there are no gain steps.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "limiter.h"
+#include <string.h>
+
+
+
+//
+// API
+//
+void limiter_init(limiter_state_t* s, int thresh, int release_msec, int rate)
+{
+	s->thresh = thresh;
+	s->release_step = (int32_t) (((int64_t) LIMITER_UNITY * LIMITER_BLOCK * 1000) / ((int64_t) release_msec * rate));
+	if (s->release_step < 1) s->release_step = 1;
+	s->gain = LIMITER_UNITY;
+	s->delay_req = LIMITER_UNITY;
+	memset(s->delay, 0, sizeof(s->delay));
+}
+
+
+int32_t limiter_process(limiter_state_t* s, int16_t* buf, int len)
+{
+	int16_t in[LIMITER_BLOCK];
+	int32_t min_gain = LIMITER_UNITY;
+	int32_t peak, req, g, g_end, v;
+	int i, j;
+	
+	for (i=0; i<=(len - LIMITER_BLOCK); i+=LIMITER_BLOCK) {
+		// Gain the incoming block needs
+		peak = 0;
+		for (j=0; j<LIMITER_BLOCK; j++) {
+			in[j] = buf[i+j];
+			v = (in[j] < 0) ? -in[j] : in[j];
+			if (v > peak) peak = v;
+		}
+		req = (peak > s->thresh) ? (s->thresh << LIMITER_GAIN_SHIFT) / peak : LIMITER_UNITY;
+		
+		// Ramp across the delayed block to a gain both blocks allow
+		g_end = s->gain + s->release_step;
+		if (g_end > s->delay_req) g_end = s->delay_req;
+		if (g_end > req) g_end = req;
+		for (j=0; j<LIMITER_BLOCK; j++) {
+			g = s->gain + (((g_end - s->gain) * (j + 1)) >> LIMITER_BLOCK_SHIFT);
+			buf[i+j] = (int16_t) (((int32_t) s->delay[j] * g) >> LIMITER_GAIN_SHIFT);
+		}
+		if (g_end < min_gain) min_gain = g_end;
+		if (s->gain < min_gain) min_gain = s->gain;
+		
+		s->gain = g_end;
+		s->delay_req = req;
+		memcpy(s->delay, in, sizeof(in));
+	}
+	
+	return min_gain;
+}
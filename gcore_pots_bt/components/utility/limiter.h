@@ -0,0 +1,61 @@
+/*
+ * limiter - utility module providing a block based look-ahead peak limiter.  Audio is
+ * delayed by LIMITER_BLOCK samples so the gain can be ramped down across the block
+ * before a peak instead of clipping it, and ramped back up at a fixed release rate.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _LIMITER_H_
+#define _LIMITER_H_
+
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Look-ahead (and delay) in samples - buffers passed to limiter_process must be a multiple
+#define LIMITER_BLOCK_SHIFT  3
+#define LIMITER_BLOCK        (1 << LIMITER_BLOCK_SHIFT)
+
+// Gain fractional bits (LIMITER_UNITY is a gain of 1)
+#define LIMITER_GAIN_SHIFT   15
+#define LIMITER_UNITY        (1 << LIMITER_GAIN_SHIFT)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int32_t thresh;                       // Largest output amplitude
+	int32_t release_step;                 // Gain increase per block
+	int32_t gain;                         // Gain at the end of the last block output
+	int32_t delay_req;                    // Gain the delayed block needs
+	int16_t delay[LIMITER_BLOCK];         // Delayed block
+} limiter_state_t;
+
+
+
+//
+// API
+//
+void limiter_init(limiter_state_t* s, int thresh, int release_msec, int rate);
+int32_t limiter_process(limiter_state_t* s, int16_t* buf, int len);  // In place, returns the lowest gain applied
+
+#endif /* _LIMITER_H_ */
@@ -0,0 +1,274 @@
+/*
+ * mem_pool - utility module implementing a fixed-size memory pool, allocated once at
+ * boot, for long-lived DSP state that is repeatedly created and destroyed.
+ *
+ * The pool is carved from internal RAM so it is also the right place for the hot
+ * per-sample state (echo canceller history and coefficients).  Each block has a small
+ * header recording its size class.  Freed blocks go onto a per-class free list and
+ * uncarved pool memory is handed out sequentially so the pool's footprint is bounded
+ * by the peak use of each class, no matter how many create/destroy cycles occur.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "mem_pool.h"
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+
+//
+// Constants
+//
+
+// Block header length (keeps payloads aligned)
+#define HDR_LEN             8
+
+// Header magic values
+#define HDR_MAGIC_POOL      0x504C
+#define HDR_MAGIC_HEAP      0x4850
+
+// Payload size of a class
+#define CLASS_LEN(c)        (((size_t) 1) << ((c) + MEM_POOL_MIN_SHIFT))
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint16_t magic;
+	uint16_t class;
+	uint32_t reserved;
+} mem_pool_hdr_t;
+
+typedef struct mem_pool_free_s {
+	struct mem_pool_free_s* next;
+} mem_pool_free_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "mem_pool";
+
+static portMUX_TYPE pool_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static uint8_t* pool_buf = NULL;
+static size_t pool_len = 0;
+static size_t pool_next = 0;
+
+static mem_pool_free_t* free_list[MEM_POOL_NUM_CLASSES];
+
+static mem_pool_info_t pool_info;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _mem_pool_class(size_t len);
+static mem_pool_hdr_t* _mem_pool_get_block(int class);
+
+
+
+//
+// API
+//
+bool mem_pool_init(uint8_t* buf, size_t len)
+{
+	int i;
+	
+	for (i=0; i<MEM_POOL_NUM_CLASSES; i++) {
+		free_list[i] = NULL;
+	}
+	memset(&pool_info, 0, sizeof(mem_pool_info_t));
+	
+	if ((buf == NULL) || (((uint32_t) buf & (HDR_LEN - 1)) != 0)) {
+		ESP_LOGE(TAG, "Pool must be %d byte aligned", HDR_LEN);
+		pool_len = 0;
+		return false;
+	}
+	pool_buf = buf;
+	pool_len = len;
+	pool_next = 0;
+	pool_info.pool_len = len;
+	
+	ESP_LOGI(TAG, "%d byte pool in internal RAM", (int) len);
+	return true;
+}
+
+
+void* mem_pool_alloc(size_t len)
+{
+	int class;
+	mem_pool_hdr_t* hdrP = NULL;
+	
+	class = _mem_pool_class(len);
+	if (class >= 0) {
+		portENTER_CRITICAL(&pool_mux);
+		hdrP = _mem_pool_get_block(class);
+		if (hdrP != NULL) {
+			pool_info.cur_allocs++;
+		} else {
+			pool_info.heap_fallbacks++;
+		}
+		portEXIT_CRITICAL(&pool_mux);
+	}
+	
+	if (hdrP == NULL) {
+		// Too big or the pool is exhausted
+		hdrP = (mem_pool_hdr_t*) heap_caps_malloc(len + HDR_LEN, MALLOC_CAP_DEFAULT);
+		if (hdrP == NULL) {
+			portENTER_CRITICAL(&pool_mux);
+			pool_info.failures++;
+			portEXIT_CRITICAL(&pool_mux);
+			return NULL;
+		}
+		hdrP->magic = HDR_MAGIC_HEAP;
+		hdrP->class = 0;
+		portENTER_CRITICAL(&pool_mux);
+		pool_info.heap_allocs++;
+		portEXIT_CRITICAL(&pool_mux);
+	}
+	
+	return (void*) ((uint8_t*) hdrP + HDR_LEN);
+}
+
+
+void* mem_pool_realloc(void* p, size_t len)
+{
+	mem_pool_hdr_t* hdrP;
+	size_t cur_len;
+	void* newP;
+	
+	if (p == NULL) {
+		return mem_pool_alloc(len);
+	}
+	
+	hdrP = (mem_pool_hdr_t*) ((uint8_t*) p - HDR_LEN);
+	if (hdrP->magic == HDR_MAGIC_POOL) {
+		cur_len = CLASS_LEN(hdrP->class);
+		if (len <= cur_len) {
+			// Still fits in the existing block
+			return p;
+		}
+	} else {
+		// Heap blocks don't record their length so the heap has to do the copy
+		newP = heap_caps_realloc(hdrP, len + HDR_LEN, MALLOC_CAP_DEFAULT);
+		return (newP == NULL) ? NULL : (void*) ((uint8_t*) newP + HDR_LEN);
+	}
+	
+	newP = mem_pool_alloc(len);
+	if (newP != NULL) {
+		memcpy(newP, p, cur_len);
+		mem_pool_free(p);
+	}
+	return newP;
+}
+
+
+void mem_pool_free(void* p)
+{
+	mem_pool_hdr_t* hdrP;
+	mem_pool_free_t* fP;
+	
+	if (p == NULL) {
+		return;
+	}
+	
+	hdrP = (mem_pool_hdr_t*) ((uint8_t*) p - HDR_LEN);
+	if (hdrP->magic == HDR_MAGIC_POOL) {
+		fP = (mem_pool_free_t*) p;
+		portENTER_CRITICAL(&pool_mux);
+		fP->next = free_list[hdrP->class];
+		free_list[hdrP->class] = fP;
+		pool_info.cur_allocs--;
+		portEXIT_CRITICAL(&pool_mux);
+	} else if (hdrP->magic == HDR_MAGIC_HEAP) {
+		hdrP->magic = 0;
+		heap_caps_free(hdrP);
+		portENTER_CRITICAL(&pool_mux);
+		pool_info.heap_allocs--;
+		portEXIT_CRITICAL(&pool_mux);
+	} else {
+		ESP_LOGE(TAG, "Free of unknown block %p", p);
+	}
+}
+
+
+void mem_pool_get_info(mem_pool_info_t* info)
+{
+	portENTER_CRITICAL(&pool_mux);
+	*info = pool_info;
+	info->pool_used = pool_next;
+	portEXIT_CRITICAL(&pool_mux);
+}
+
+
+
+//
+// Internal functions
+//
+
+// Return the smallest class holding len bytes or -1 if it is too big for the pool
+static int _mem_pool_class(size_t len)
+{
+	int c;
+	
+	for (c=0; c<MEM_POOL_NUM_CLASSES; c++) {
+		if (len <= CLASS_LEN(c)) {
+			return c;
+		}
+	}
+	return -1;
+}
+
+
+// Return a block for class from its free list, uncarved pool memory or, as a last
+// resort, a free block from a larger class.  Must be called in the critical section.
+static mem_pool_hdr_t* _mem_pool_get_block(int class)
+{
+	int c;
+	mem_pool_hdr_t* hdrP;
+	
+	if (free_list[class] != NULL) {
+		hdrP = (mem_pool_hdr_t*) ((uint8_t*) free_list[class] - HDR_LEN);
+		free_list[class] = free_list[class]->next;
+		return hdrP;
+	}
+	
+	if ((pool_next + HDR_LEN + CLASS_LEN(class)) <= pool_len) {
+		hdrP = (mem_pool_hdr_t*) &pool_buf[pool_next];
+		pool_next += HDR_LEN + CLASS_LEN(class);
+		hdrP->magic = HDR_MAGIC_POOL;
+		hdrP->class = class;
+		return hdrP;
+	}
+	
+	// The block keeps its original class so it returns to that class when freed
+	for (c=class+1; c<MEM_POOL_NUM_CLASSES; c++) {
+		if (free_list[c] != NULL) {
+			hdrP = (mem_pool_hdr_t*) ((uint8_t*) free_list[c] - HDR_LEN);
+			free_list[c] = free_list[c]->next;
+			return hdrP;
+		}
+	}
+	
+	return NULL;
+}
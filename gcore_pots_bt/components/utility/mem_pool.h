@@ -0,0 +1,66 @@
+/*
+ * mem_pool - utility module implementing a fixed-size memory pool, reserved by the caller
+ * at build time, for long-lived DSP state that is repeatedly created and destroyed (for example
+ * the echo canceller on every change of sample rate or tail length).  Blocks are handed
+ * out by power-of-2 size class and freed blocks are only reused for the same class so
+ * repeated allocations can't fragment the system heap.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _MEM_POOL_H_
+#define _MEM_POOL_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Size classes - payloads of 16 bytes up to 16 << (MEM_POOL_NUM_CLASSES-1) bytes.  Larger
+// requests (and requests made once the pool is exhausted) are passed to the system heap.
+#define MEM_POOL_MIN_SHIFT      4
+#define MEM_POOL_NUM_CLASSES    10
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	size_t pool_len;                      // Bytes reserved at boot
+	size_t pool_used;                     // Bytes carved into blocks so far (high water)
+	uint32_t cur_allocs;                  // Blocks currently allocated from the pool
+	uint32_t heap_allocs;                 // Blocks currently allocated from the system heap
+	uint32_t heap_fallbacks;              // Total requests the pool could not satisfy
+	uint32_t failures;                    // Total requests that could not be satisfied at all
+} mem_pool_info_t;
+
+
+
+//
+// API
+//
+bool mem_pool_init(uint8_t* buf, size_t len);  // Call once from app_main before any allocation (buf 8-byte aligned)
+void* mem_pool_alloc(size_t len);
+void* mem_pool_realloc(void* p, size_t len);
+void mem_pool_free(void* p);
+void mem_pool_get_info(mem_pool_info_t* info);
+
+#endif /* _MEM_POOL_H_ */
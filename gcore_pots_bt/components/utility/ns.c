@@ -0,0 +1,191 @@
+/*
+ * ns - utility module implementing a single channel spectral noise suppressor for the
+ * voice sent to the cellphone.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "ns.h"
+#include <math.h>
+#include <string.h>
+
+
+//
+// Constants
+//
+
+// Per-bin power smoothing (reduces the variance the minimum follower and gains see)
+#define NS_PSD_ALPHA         0.5f
+
+// Bins with a power within NS_NOISE_RATIO of the noise estimate are averaged into it.
+// Higher power bins are treated as speech and only let the estimate rise slowly.
+#define NS_NOISE_RATIO       4.0f
+#define NS_NOISE_ALPHA       0.1f
+#define NS_NOISE_RISE_DB_SEC 5.0f
+
+// The estimate is over-subtracted by this much so bins where the noise peaks above its
+// average are suppressed too (less musical noise)
+#define NS_OVER_SUB          2.0f
+
+// Gain release per frame (rises are immediate so speech onsets aren't clipped)
+#define NS_RELEASE           0.5f
+
+// Regularization (power of a level 4 signal) so digital silence isn't divided by zero
+#define NS_PSD_MIN           ((float) FFT_LEN * 4.0f * 4.0f)
+
+
+
+//
+// Variables
+//
+
+// Square root periodic Hann window (used for analysis and synthesis so the overlapped
+// frames add back to unity gain)
+static float ns_window[NS_FRAME];
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _ns_process_block(ns_state_t* s, bool suppress);
+static void _ns_apply_gains(ns_state_t* s);
+static __inline__ int16_t _ns_sat(float f);
+
+
+
+//
+// API
+//
+void ns_init(ns_state_t* s, float atten_db, int sample_rate)
+{
+	int i;
+
+	fft_init();
+	for (i=0; i<NS_FRAME; i++) {
+		ns_window[i] = sqrtf(0.5f * (1.0f - cosf(2.0f * (float) M_PI * i / NS_FRAME)));
+	}
+
+	s->fill = 0;
+	s->primed = false;
+	s->min_gain = powf(10.0f, -atten_db / 20.0f);
+	s->noise_rise = powf(10.0f, NS_NOISE_RISE_DB_SEC * NS_BLOCK / sample_rate / 10.0f);
+	memset(s->in, 0, sizeof(s->in));
+	memset(s->out, 0, sizeof(s->out));
+	memset(s->x_prev, 0, sizeof(s->x_prev));
+	memset(s->ola, 0, sizeof(s->ola));
+	for (i=0; i<FFT_BINS; i++) {
+		s->psd[i] = NS_PSD_MIN;
+		s->noise[i] = NS_PSD_MIN;
+		s->gain[i] = 1.0f;
+	}
+}
+
+
+void ns_process(ns_state_t* s, int16_t* buf, int len, bool suppress)
+{
+	int i;
+
+	for (i=0; i<len; i++) {
+		s->in[s->fill] = buf[i];
+		buf[i] = s->out[s->fill];
+		if (++s->fill == NS_BLOCK) {
+			_ns_process_block(s, suppress);
+			s->fill = 0;
+		}
+	}
+}
+
+
+
+//
+// Internal functions
+//
+
+// Produce the output for the previous block from the frame made up of it and the new block.
+// Without suppression the frame is only windowed so the output is the delayed input.
+static void _ns_process_block(ns_state_t* s, bool suppress)
+{
+	int i;
+
+	for (i=0; i<NS_BLOCK; i++) {
+		s->work[i].re = s->x_prev[i] * ns_window[i];
+		s->work[i].im = 0;
+		s->x_prev[i] = (float) s->in[i];
+		s->work[NS_BLOCK + i].re = s->x_prev[i] * ns_window[NS_BLOCK + i];
+		s->work[NS_BLOCK + i].im = 0;
+	}
+	for (i=NS_FRAME; i<FFT_LEN; i++) {
+		s->work[i].re = 0;
+		s->work[i].im = 0;
+	}
+
+	if (suppress) {
+		fft_run(s->work, false);
+		_ns_apply_gains(s);
+		fft_run(s->work, true);
+	}
+
+	for (i=0; i<NS_BLOCK; i++) {
+		s->out[i] = _ns_sat(s->ola[i] + s->work[i].re * ns_window[i]);
+		s->ola[i] = s->work[NS_BLOCK + i].re * ns_window[NS_BLOCK + i];
+	}
+}
+
+
+// Update the noise estimate and scale each bin (and its mirror) by its gain
+static void _ns_apply_gains(ns_state_t* s)
+{
+	int k;
+	float p, g;
+
+	for (k=0; k<FFT_BINS; k++) {
+		p = s->work[k].re * s->work[k].re + s->work[k].im * s->work[k].im;
+		if (!s->primed) {
+			s->psd[k] = p + NS_PSD_MIN;
+			s->noise[k] = s->psd[k];
+		} else {
+			s->psd[k] += NS_PSD_ALPHA * (p + NS_PSD_MIN - s->psd[k]);
+			if (s->psd[k] < NS_NOISE_RATIO * s->noise[k]) {
+				s->noise[k] += NS_NOISE_ALPHA * (s->psd[k] - s->noise[k]);
+			} else {
+				s->noise[k] *= s->noise_rise;
+			}
+		}
+
+		g = 1.0f - NS_OVER_SUB * s->noise[k] / s->psd[k];
+		if (g < s->min_gain) g = s->min_gain;
+		if (g < s->gain[k]) {
+			g = s->gain[k] + NS_RELEASE * (g - s->gain[k]);
+		}
+		s->gain[k] = g;
+
+		s->work[k].re *= g;
+		s->work[k].im *= g;
+		if ((k != 0) && (k != FFT_LEN/2)) {
+			s->work[FFT_LEN - k].re *= g;
+			s->work[FFT_LEN - k].im *= g;
+		}
+	}
+	s->primed = true;
+}
+
+
+static __inline__ int16_t _ns_sat(float f)
+{
+	if (f > 32767.0f) return 32767;
+	if (f < -32768.0f) return -32768;
+	return (int16_t) f;
+}
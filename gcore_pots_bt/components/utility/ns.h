@@ -0,0 +1,71 @@
+/*
+ * ns - utility module implementing a single channel spectral noise suppressor for the
+ * voice sent to the cellphone.  Stationary line noise (hiss and hum from the loop and the
+ * hybrid) is tracked per frequency bin while there's no speech in it and removed with a Wiener
+ * gain limited to a configurable maximum attenuation so speech is never gated.
+ *
+ * Frames of NS_FRAME samples, 50% overlapped and square root Hann windowed, are zero
+ * padded to the length of the FFT shared with the FDAF echo canceller (so the gains don't
+ * alias in time) and processed every NS_BLOCK samples.  This adds NS_FRAME samples of delay.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _NS_H_
+#define _NS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "fft.h"
+
+
+
+//
+// Constants
+//
+
+// Frame length (half the FFT) and advance
+#define NS_FRAME      (FFT_LEN/2)
+#define NS_BLOCK      (NS_FRAME/2)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int fill;                             // Samples collected in the current block
+	bool primed;                          // Set once the noise estimate has been seeded
+	float min_gain;                       // Maximum attenuation as a gain
+	float noise_rise;                     // Per block noise estimate rise rate
+	int16_t in[NS_BLOCK];
+	int16_t out[NS_BLOCK];                // Output for the previous block
+	float x_prev[NS_BLOCK];               // Previous input block (first half of the frame)
+	float ola[NS_BLOCK];                  // Second half of the previous output frame
+	float psd[FFT_BINS];                  // Smoothed power per bin
+	float noise[FFT_BINS];                // Noise power per bin
+	float gain[FFT_BINS];                 // Gain applied to the last frame
+	fft_cplx_t work[FFT_LEN];
+} ns_state_t;
+
+
+
+//
+// API
+//
+void ns_init(ns_state_t* s, float atten_db, int sample_rate);   // atten_db is the most noise is reduced by
+void ns_process(ns_state_t* s, int16_t* buf, int len, bool suppress);  // In place, delayed NS_FRAME samples; suppress false only delays
+
+#endif /* _NS_H_ */
@@ -0,0 +1,437 @@
+/*
+ * ota_sd - utility module updating the firmware from an image on the Micro-SD Card.
+ *
+ * Once gcore_task reports a card at boot the image header is read and compared with the
+ * running firmware (and with any image the bootloader already rolled back) so an update
+ * only happens once.  The image is then streamed into the inactive OTA partition: a reader
+ * task fills one buffer from the card and hashes it while this task writes the other to
+ * flash (erased a sector at a time as it is written).  The SHA-256 of the data read must
+ * match the one appended to the image before the new partition is validated by
+ * esp_ota_end (which also checks the signature when signed images are enabled) and made
+ * the boot partition.  The device restarts into it once the phone is idle.
+ *
+ * A new image boots pending verification.  It is kept once every subsystem reports ready
+ * within OTA_SD_SELF_TEST_MSEC, otherwise it is marked invalid and the bootloader starts
+ * the previous image.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "ota_sd.h"
+#if (CONFIG_OTA_SD_ENABLE == true)
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "boot_prof.h"
+#include "esp_app_format.h"
+#include "esp_heap_caps.h"
+#include "esp_image_format.h"
+#include "esp_log.h"
+#include "esp_ota_ops.h"
+#include "esp_system.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "mbedtls/sha256.h"
+#include "power_utilities.h"
+#include "sd_card.h"
+#include "sys_status.h"
+
+
+//
+// Constants
+//
+// Tasks
+#define OTA_SD_TASK_STACK      4096
+#define OTA_SD_READ_STACK      3072
+#define OTA_SD_TASK_PRIO       1
+
+// Image chunk length (whole flash sectors) and number of chunk buffers
+#define OTA_SD_CHUNK           (16 * 1024)
+#define OTA_SD_NUM_BUFS        2
+
+// Longest wait for gcore_task to report the card status
+#define OTA_SD_POWER_WAIT_MSEC 10000
+
+// Polling period while waiting for the phone to be idle before restarting
+#define OTA_SD_IDLE_POLL_MSEC  1000
+
+// Image layout
+#define OTA_SD_HASH_LEN        32
+#define OTA_SD_DESC_OFFSET     (sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t))
+
+
+
+//
+// Typedefs
+//
+
+// A chunk passed from the reader to the writer (len 0 ends the image or acknowledges an
+// abort, -1 for a read error)
+typedef struct {
+	int buf;
+	int len;
+} ota_sd_chunk_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "ota_sd";
+
+// Image being streamed
+static FILE* img_fp;
+static uint32_t img_len;
+static uint8_t img_hash[OTA_SD_HASH_LEN];              // Computed over the data read
+static uint8_t img_appended_hash[OTA_SD_HASH_LEN];     // Last bytes of the image
+static atomic_bool img_abort;                          // Set by the writer to stop the reader
+
+// Double buffering
+static uint8_t* bufs[OTA_SD_NUM_BUFS];
+static QueueHandle_t free_q;                           // Buffer indices available to the reader
+static QueueHandle_t full_q;                           // Chunks read, in image order
+static StaticQueue_t free_q_buf;
+static StaticQueue_t full_q_buf;
+static uint8_t free_q_storage[OTA_SD_NUM_BUFS * sizeof(int)];
+static uint8_t full_q_storage[(OTA_SD_NUM_BUFS + 1) * sizeof(ota_sd_chunk_t)];
+
+static StackType_t ota_sd_task_stack[OTA_SD_TASK_STACK];
+static StaticTask_t ota_sd_task_tcb;
+static StackType_t ota_sd_read_stack[OTA_SD_READ_STACK];
+static StaticTask_t ota_sd_read_tcb;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _ota_sd_task(void* args);
+static void _ota_sd_read_task(void* args);
+static void _ota_sd_self_test();
+static bool _ota_sd_check();
+static bool _ota_sd_update();
+static bool _ota_sd_install(const esp_partition_t* part);
+static bool _ota_sd_stream(esp_ota_handle_t handle);
+static void _ota_sd_restart_when_idle();
+
+
+
+//
+// API
+//
+void ota_sd_init()
+{
+	// Runs below all the other tasks so it never delays boot or a call
+	xTaskCreateStaticPinnedToCore(&_ota_sd_task, "ota_sd_task", OTA_SD_TASK_STACK, NULL, OTA_SD_TASK_PRIO, ota_sd_task_stack, &ota_sd_task_tcb, 0);
+}
+
+
+
+//
+// Internal functions
+//
+static void _ota_sd_task(void* args)
+{
+	bool updated = false;
+	
+	_ota_sd_self_test();
+	
+	if (boot_prof_wait_ready(BOOT_READY_POWER, pdMS_TO_TICKS(OTA_SD_POWER_WAIT_MSEC)) && power_get_sdcard_present()) {
+		if (sd_card_mount()) {
+			if (_ota_sd_check()) {
+				updated = _ota_sd_update();
+			}
+			if (img_fp != NULL) {
+				fclose(img_fp);
+				img_fp = NULL;
+			}
+			sd_card_unmount();
+		}
+	}
+	
+	if (updated) {
+		_ota_sd_restart_when_idle();
+	}
+	
+	vTaskDelete(NULL);
+}
+
+
+// Reads the image into whichever buffer is free, hashing everything but the appended hash
+static void _ota_sd_read_task(void* args)
+{
+	mbedtls_sha256_context ctx;
+	ota_sd_chunk_t c = {0, 0};
+	uint32_t pos = 0;
+	uint32_t hash_len = img_len - OTA_SD_HASH_LEN;
+	uint32_t n;
+	uint32_t i;
+	
+	mbedtls_sha256_init(&ctx);
+	(void) mbedtls_sha256_starts_ret(&ctx, 0);
+	
+	while ((pos < img_len) && !atomic_load(&img_abort)) {
+		(void) xQueueReceive(free_q, &c.buf, portMAX_DELAY);
+		n = img_len - pos;
+		if (n > OTA_SD_CHUNK) n = OTA_SD_CHUNK;
+		if (fread(bufs[c.buf], 1, n, img_fp) != n) {
+			c.len = -1;
+			xQueueSend(full_q, &c, portMAX_DELAY);
+			break;
+		}
+	
+		// Pass the chunk on before hashing it so the flash write overlaps the hash too
+		c.len = (int) n;
+		xQueueSend(full_q, &c, portMAX_DELAY);
+	
+		if (pos < hash_len) {
+			(void) mbedtls_sha256_update_ret(&ctx, bufs[c.buf], (pos + n <= hash_len) ? n : hash_len - pos);
+		}
+		for (i=((pos < hash_len) ? hash_len - pos : 0); i<n; i++) {
+			img_appended_hash[pos + i - hash_len] = bufs[c.buf][i];
+		}
+		pos += n;
+	}
+	
+	(void) mbedtls_sha256_finish_ret(&ctx, img_hash);
+	mbedtls_sha256_free(&ctx);
+	
+	// The writer stops using the queues once it has seen the last chunk
+	if (c.len >= 0) {
+		c.buf = 0;
+		c.len = 0;
+		xQueueSend(full_q, &c, portMAX_DELAY);
+	}
+	
+	vTaskDelete(NULL);
+}
+
+
+// Keeps a newly updated image once every subsystem is running, otherwise rolls it back
+static void _ota_sd_self_test()
+{
+	const esp_partition_t* running = esp_ota_get_running_partition();
+	esp_ota_img_states_t state;
+	
+	if ((esp_ota_get_state_partition(running, &state) != ESP_OK) || (state != ESP_OTA_IMG_PENDING_VERIFY)) {
+		return;
+	}
+	
+	if (boot_prof_wait_ready(BOOT_READY_ALL, pdMS_TO_TICKS(OTA_SD_SELF_TEST_MSEC))) {
+		ESP_LOGI(TAG, "New firmware passed self-test");
+		(void) esp_ota_mark_app_valid_cancel_rollback();
+	} else {
+		ESP_LOGE(TAG, "New firmware failed self-test - rolling back");
+		(void) esp_ota_mark_app_invalid_rollback_and_reboot();
+	}
+}
+
+
+// Opens the image and returns true if it is a valid image we aren't already running
+static bool _ota_sd_check()
+{
+	const esp_partition_t* invalid;
+	const esp_app_desc_t* running_desc;
+	esp_app_desc_t invalid_desc;
+	esp_image_header_t hdr;
+	esp_app_desc_t desc;
+	struct stat st;
+	
+	if (stat(OTA_SD_FILE, &st) != 0) {
+		return false;
+	}
+	img_fp = fopen(OTA_SD_FILE, "rb");
+	if (img_fp == NULL) {
+		ESP_LOGE(TAG, "Could not open %s", OTA_SD_FILE);
+		return false;
+	}
+	img_len = (uint32_t) st.st_size;
+	
+	if ((fread(&hdr, sizeof(hdr), 1, img_fp) != 1) ||
+	    (fseek(img_fp, OTA_SD_DESC_OFFSET, SEEK_SET) != 0) ||
+	    (fread(&desc, sizeof(desc), 1, img_fp) != 1) ||
+	    (fseek(img_fp, 0, SEEK_SET) != 0)) {
+	
+		ESP_LOGE(TAG, "Could not read %s", OTA_SD_FILE);
+		return false;
+	}
+	if ((hdr.magic != ESP_IMAGE_HEADER_MAGIC) || (desc.magic_word != ESP_APP_DESC_MAGIC_WORD) ||
+	    (hdr.hash_appended != 1) || (img_len <= (OTA_SD_DESC_OFFSET + sizeof(desc) + OTA_SD_HASH_LEN))) {
+	
+		ESP_LOGE(TAG, "%s is not a firmware image", OTA_SD_FILE);
+		return false;
+	}
+	
+	running_desc = esp_ota_get_app_description();
+	if (memcmp(desc.app_elf_sha256, running_desc->app_elf_sha256, sizeof(desc.app_elf_sha256)) == 0) {
+		return false;
+	}
+	invalid = esp_ota_get_last_invalid_partition();
+	if ((invalid != NULL) && (esp_ota_get_partition_description(invalid, &invalid_desc) == ESP_OK) &&
+	    (memcmp(desc.app_elf_sha256, invalid_desc.app_elf_sha256, sizeof(desc.app_elf_sha256)) == 0)) {
+	
+		ESP_LOGW(TAG, "Firmware %s on the card was rolled back - ignoring it", desc.version);
+		return false;
+	}
+	
+	ESP_LOGI(TAG, "Updating firmware %s to %s", running_desc->version, desc.version);
+	return true;
+}
+
+
+static bool _ota_sd_update()
+{
+	const esp_partition_t* part;
+	bool success = false;
+	int i;
+	
+	part = esp_ota_get_next_update_partition(NULL);
+	if ((part == NULL) || (img_len > part->size)) {
+		ESP_LOGE(TAG, "No OTA partition for a %u byte image", img_len);
+		return false;
+	}
+	
+	for (i=0; i<OTA_SD_NUM_BUFS; i++) {
+		bufs[i] = heap_caps_malloc(OTA_SD_CHUNK, MALLOC_CAP_DMA);
+	}
+	free_q = xQueueCreateStatic(OTA_SD_NUM_BUFS, sizeof(int), free_q_storage, &free_q_buf);
+	full_q = xQueueCreateStatic(OTA_SD_NUM_BUFS + 1, sizeof(ota_sd_chunk_t), full_q_storage, &full_q_buf);
+	if ((bufs[0] == NULL) || (bufs[1] == NULL) || (free_q == NULL) || (full_q == NULL)) {
+		ESP_LOGE(TAG, "Could not allocate update buffers");
+	} else {
+		success = _ota_sd_install(part);
+	}
+	
+	for (i=0; i<OTA_SD_NUM_BUFS; i++) {
+		if (bufs[i] != NULL) {
+			heap_caps_free(bufs[i]);
+			bufs[i] = NULL;
+		}
+	}
+	if (free_q != NULL) {
+		vQueueDelete(free_q);
+		free_q = NULL;
+	}
+	if (full_q != NULL) {
+		vQueueDelete(full_q);
+		full_q = NULL;
+	}
+	
+	return success;
+}
+
+
+// Writes the image to part, validates it and makes it the boot partition
+static bool _ota_sd_install(const esp_partition_t* part)
+{
+	esp_ota_handle_t handle;
+	esp_err_t ret;
+	int64_t t;
+	
+	// Sectors are erased as they are written so the erase overlaps reading the card
+	ret = esp_ota_begin(part, OTA_WITH_SEQUENTIAL_WRITES, &handle);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "OTA begin failed (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	
+	t = esp_timer_get_time();
+	if (!_ota_sd_stream(handle)) {
+		(void) esp_ota_abort(handle);
+		return false;
+	}
+	
+	ret = esp_ota_end(handle);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Image validation failed (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	ret = esp_ota_set_boot_partition(part);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Could not set boot partition (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	t = esp_timer_get_time() - t;
+	
+	ESP_LOGI(TAG, "Wrote %u bytes to %s in %d mSec", img_len, part->label, (int) (t / 1000));
+	return true;
+}
+
+
+// Writes the chunks from the reader to flash and checks the hash of what was read
+static bool _ota_sd_stream(esp_ota_handle_t handle)
+{
+	ota_sd_chunk_t c;
+	esp_err_t ret;
+	bool success = true;
+	int i;
+	
+	atomic_store(&img_abort, false);
+	for (i=0; i<OTA_SD_NUM_BUFS; i++) {
+		xQueueSend(free_q, &i, 0);
+	}
+	xTaskCreateStaticPinnedToCore(&_ota_sd_read_task, "ota_sd_read", OTA_SD_READ_STACK, NULL, OTA_SD_TASK_PRIO, ota_sd_read_stack, &ota_sd_read_tcb, 1);
+	
+	// The reader always ends with a zero length or error chunk (after a write error the
+	// remaining chunks are only returned to it until it sees the abort)
+	while (true) {
+		(void) xQueueReceive(full_q, &c, portMAX_DELAY);
+		if (c.len == 0) break;
+		if (c.len < 0) {
+			ESP_LOGE(TAG, "Read of %s failed", OTA_SD_FILE);
+			return false;
+		}
+		if (success) {
+			ret = esp_ota_write(handle, bufs[c.buf], c.len);
+			if (ret != ESP_OK) {
+				ESP_LOGE(TAG, "Flash write failed (%s)", esp_err_to_name(ret));
+				atomic_store(&img_abort, true);
+				success = false;
+			}
+		}
+		xQueueSend(free_q, &c.buf, portMAX_DELAY);
+	}
+	if (!success) {
+		return false;
+	}
+	
+	if (memcmp(img_hash, img_appended_hash, OTA_SD_HASH_LEN) != 0) {
+		ESP_LOGE(TAG, "%s is corrupt (hash mismatch)", OTA_SD_FILE);
+		return false;
+	}
+	
+	return true;
+}
+
+
+static void _ota_sd_restart_when_idle()
+{
+	app_state_t st;
+	
+	while (true) {
+		st = sys_status_get_app_state();
+		if ((st == DISCONNECTED) || (st == CONNECTED_IDLE)) break;
+		vTaskDelay(pdMS_TO_TICKS(OTA_SD_IDLE_POLL_MSEC));
+	}
+	
+	ESP_LOGI(TAG, "Restarting into the new firmware");
+	esp_restart();
+}
+
+#endif /* CONFIG_OTA_SD_ENABLE */
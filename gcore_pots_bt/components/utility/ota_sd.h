@@ -0,0 +1,48 @@
+/*
+ * ota_sd - utility module updating the firmware from an image on the Micro-SD Card.  At
+ * boot a new image in the root of the card is streamed into the inactive OTA partition
+ * and the device restarts into it once no call is in progress.  A new image must bring up
+ * every subsystem to be kept, otherwise the bootloader goes back to the previous one.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _OTA_SD_H_
+#define _OTA_SD_H_
+
+#include <stdbool.h>
+#include "sdkconfig.h"
+
+//
+// Constants
+//
+
+// Firmware image in the root of the Micro-SD Card (the same file as precompiled/gcore_pots_bt.bin)
+#define OTA_SD_FILE            "/sdcard/gcore_pots_bt.bin"
+
+// Time a new image has to bring up every subsystem before it is rolled back
+#define OTA_SD_SELF_TEST_MSEC  30000
+
+
+
+//
+// API
+//
+#if (CONFIG_OTA_SD_ENABLE == true)
+void ota_sd_init();                                    // Starts the background check (and update)
+#endif
+
+#endif /* _OTA_SD_H_ */
@@ -0,0 +1,208 @@
+/*
+ * pace - utility module checking that each task keeps the pace it was designed for.
+ * See pace.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pace.h"
+#include <string.h>
+#include "blackbox.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+
+//
+// Typedefs
+//
+typedef struct {
+	pace_stats_t stats;
+	bool declared;
+	int64_t ref_usec;                     // Last check in (periodic) or start (response), 0 if none
+	int64_t log_usec;                     // Last warning logged
+} pace_entry_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "pace";
+
+static portMUX_TYPE pace_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static pace_entry_t pace_entries[PACE_MAX_IDS];
+
+static const uint32_t pace_bin_msec[PACE_NUM_BINS - 1] = PACE_BIN_MSEC;
+
+static int64_t pace_overrun_usec = 0;     // Last overrun of any task
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _paceBin(uint32_t late_usec);
+
+
+
+//
+// API
+//
+void pace_declare(int id, const char* name, int type, uint32_t period_usec)
+{
+	if ((id < 0) || (id >= PACE_MAX_IDS)) return;
+	
+	portENTER_CRITICAL(&pace_mux);
+	memset(&pace_entries[id], 0, sizeof(pace_entry_t));
+	pace_entries[id].stats.name = name;
+	pace_entries[id].stats.type = type;
+	pace_entries[id].stats.period_usec = period_usec;
+	pace_entries[id].declared = true;
+	portEXIT_CRITICAL(&pace_mux);
+}
+
+
+void pace_set_period(int id, uint32_t period_usec)
+{
+	if ((id < 0) || (id >= PACE_MAX_IDS)) return;
+	
+	portENTER_CRITICAL(&pace_mux);
+	pace_entries[id].stats.period_usec = period_usec;
+	pace_entries[id].ref_usec = 0;
+	portEXIT_CRITICAL(&pace_mux);
+}
+
+
+void pace_start(int id)
+{
+	if ((id < 0) || (id >= PACE_MAX_IDS)) return;
+	
+	pace_entries[id].ref_usec = esp_timer_get_time();
+}
+
+
+void pace_checkin(int id)
+{
+	pace_entry_t* e;
+	int64_t now = esp_timer_get_time();
+	int64_t elapsed;
+	uint32_t late = 0;
+	bool warn = false;
+	bool overrun = false;
+	bool log = false;
+	
+	if ((id < 0) || (id >= PACE_MAX_IDS) || !pace_entries[id].declared) return;
+	e = &pace_entries[id];
+	
+	portENTER_CRITICAL(&pace_mux);
+	if (e->ref_usec != 0) {
+		elapsed = now - e->ref_usec;
+		late = (elapsed > e->stats.period_usec) ? (uint32_t) (elapsed - e->stats.period_usec) : 0;
+		
+		e->stats.checkins += 1;
+		e->stats.hist[_paceBin(late)] += 1;
+		if (late > e->stats.max_late_usec) e->stats.max_late_usec = late;
+		if (late > (e->stats.period_usec * PACE_OVERRUN_PCT / 100)) {
+			e->stats.overruns += 1;
+			pace_overrun_usec = now;
+			overrun = true;
+		} else if (late > (e->stats.period_usec * PACE_WARN_PCT / 100)) {
+			e->stats.warnings += 1;
+			warn = true;
+		}
+		if ((warn || overrun) && ((now - e->log_usec) >= (PACE_LOG_MSEC * 1000))) {
+			e->log_usec = now;
+			log = true;
+		}
+	}
+	
+	// A response is timed from its next start
+	e->ref_usec = (e->stats.type == PACE_PERIODIC) ? now : 0;
+	portEXIT_CRITICAL(&pace_mux);
+	
+	if (overrun) {
+		blackbox_event(TAG, e->stats.name, id, late);
+	}
+	if (log) {
+		ESP_LOGW(TAG, "%s %u uS late (%u warnings, %u overruns)", e->stats.name, late, e->stats.warnings,
+		         e->stats.overruns);
+	}
+}
+
+
+void pace_pause(int id)
+{
+	if ((id < 0) || (id >= PACE_MAX_IDS)) return;
+	
+	pace_entries[id].ref_usec = 0;
+}
+
+
+bool pace_stressed()
+{
+	int64_t t = pace_overrun_usec;
+	
+	return ((t != 0) && ((esp_timer_get_time() - t) < (PACE_STRESS_HOLD_MSEC * 1000)));
+}
+
+
+bool pace_get_stats(int id, pace_stats_t* stats)
+{
+	bool declared;
+	
+	if ((id < 0) || (id >= PACE_MAX_IDS)) return false;
+	
+	portENTER_CRITICAL(&pace_mux);
+	declared = pace_entries[id].declared;
+	memcpy(stats, &pace_entries[id].stats, sizeof(pace_stats_t));
+	portEXIT_CRITICAL(&pace_mux);
+	
+	return declared;
+}
+
+
+void pace_reset_stats()
+{
+	pace_stats_t* s;
+	int i;
+	
+	portENTER_CRITICAL(&pace_mux);
+	for (i=0; i<PACE_MAX_IDS; i++) {
+		s = &pace_entries[i].stats;
+		s->checkins = 0;
+		memset(s->hist, 0, sizeof(s->hist));
+		s->max_late_usec = 0;
+		s->warnings = 0;
+		s->overruns = 0;
+	}
+	portEXIT_CRITICAL(&pace_mux);
+}
+
+
+
+//
+// Internal functions
+//
+static int _paceBin(uint32_t late_usec)
+{
+	int i;
+	
+	for (i=0; i<(PACE_NUM_BINS - 1); i++) {
+		if (late_usec <= (pace_bin_msec[i] * 1000)) return i;
+	}
+	return PACE_NUM_BINS - 1;
+}
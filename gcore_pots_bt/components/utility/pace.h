@@ -0,0 +1,109 @@
+/*
+ * pace - utility module checking that each task keeps the pace it was designed for.  Tasks
+ * declare their expected timing once and check in every cycle, and the lateness of each
+ * check in goes into a histogram so a new feature that delays a task shows up right away.
+ *
+ * Two kinds of pacing are checked:
+ *   PACE_PERIODIC : a task running at a fixed rate (audio_task's I2S buffers, pots_task's
+ *                   state machine) checks in every cycle and is late by however much the time
+ *                   since its last check in exceeds the period.  pace_pause stops the check
+ *                   while the task isn't running periodically (the next check in starts over).
+ *   PACE_RESPONSE : an event driven task calls pace_start when it wakes with work and checks in
+ *                   when done, and is late by however much that exceeds the period (its budget
+ *                   for handling an event).
+ *
+ * Lateness over PACE_WARN_PCT of the period counts a warning (logged at most once every
+ * PACE_LOG_MSEC per task) and over PACE_OVERRUN_PCT an overrun, which is also recorded in the
+ * blackbox and makes pace_stressed true for PACE_STRESS_HOLD_MSEC so optional work (display
+ * refresh, background jobs) backs off.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _PACE_H_
+#define _PACE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Task IDs
+#define PACE_ID_AUDIO          0
+#define PACE_ID_POTS           1
+#define PACE_ID_BT             2
+#define PACE_ID_APP            3
+#define PACE_ID_GCORE          4
+#define PACE_MAX_IDS           8
+
+// Pacing types
+#define PACE_PERIODIC          0
+#define PACE_RESPONSE          1
+
+// Declared periods and budgets (audio_task's follows its I2S buffer period)
+#define PACE_POTS_USEC         10000
+#define PACE_BT_USEC           20000
+#define PACE_APP_USEC          50000
+#define PACE_GCORE_USEC        50000
+
+// Lateness thresholds (percent of the period)
+#define PACE_WARN_PCT          50
+#define PACE_OVERRUN_PCT       100
+
+// Minimum time between warning logs for one task
+#define PACE_LOG_MSEC          5000
+
+// Time pace_stressed stays set after an overrun
+#define PACE_STRESS_HOLD_MSEC  2000
+
+// Lateness histogram bin upper limits (mSec), the last bin holds the rest
+#define PACE_NUM_BINS          8
+#define PACE_BIN_MSEC          {0, 1, 2, 5, 10, 20, 50}
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const char* name;
+	int type;
+	uint32_t period_usec;
+	uint32_t checkins;
+	uint32_t hist[PACE_NUM_BINS];         // Check ins by lateness
+	uint32_t max_late_usec;
+	uint32_t warnings;
+	uint32_t overruns;
+} pace_stats_t;
+
+
+
+//
+// API
+//
+void pace_declare(int id, const char* name, int type, uint32_t period_usec);  // Once, from the task
+void pace_set_period(int id, uint32_t period_usec);  // Also pauses a periodic check
+void pace_start(int id);                  // PACE_RESPONSE: work started
+void pace_checkin(int id);                // Cycle (or response) done
+void pace_pause(int id);                  // PACE_PERIODIC: stop checking until the next check in
+bool pace_stressed();                     // An overrun happened in the last PACE_STRESS_HOLD_MSEC
+bool pace_get_stats(int id, pace_stats_t* stats);  // False if the ID wasn't declared
+void pace_reset_stats();
+
+#endif /* _PACE_H_ */
@@ -0,0 +1,501 @@
+/*
+ * preroll - utility module keeping the last seconds of call audio in PSRAM and saving them to
+ * the Micro-SD Card when audio_task sees a problem.  See preroll.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "preroll.h"
+#if (CONFIG_PREROLL_ENABLE == true)
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <time.h>
+#include "bg_job.h"
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ima_adpcm.h"
+#include "sd_card.h"
+
+
+//
+// Constants
+//
+// Recording channels (one file each)
+#define PREROLL_CH_TX  0
+#define PREROLL_CH_RX  1
+#define PREROLL_CH_EC  2
+#define PREROLL_NUM_CH 3
+
+// Highest rate audio_task runs the echo canceller at (the ring is sized for it)
+#define PREROLL_MAX_RATE 16000
+
+// Blocks holding CONFIG_PREROLL_SECS and the post-trigger time at a rate
+#define PREROLL_BLOCKS(rate) \
+	((((CONFIG_PREROLL_SECS * 1000 + PREROLL_POST_TRIG_MSEC) * ((rate) / 1000)) + PREROLL_BLOCK_SAMPLES - 1) / PREROLL_BLOCK_SAMPLES)
+
+// Ring size including the block being filled
+#define PREROLL_RING_BLOCKS (PREROLL_BLOCKS(PREROLL_MAX_RATE) + 1)
+
+// Ring encoding
+#if (CONFIG_PREROLL_ADPCM == true)
+#define PREROLL_ENC_NAME    "ima_adpcm"
+#define PREROLL_BLOCK_BYTES (PREROLL_BLOCK_SAMPLES / 2)
+#else
+#define PREROLL_ENC_NAME    "pcm16"
+#define PREROLL_BLOCK_BYTES (PREROLL_BLOCK_SAMPLES * 2)
+#endif
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int64_t usec;                    // esp_timer time of the first sample
+	int len;                         // Samples per channel
+#if (CONFIG_PREROLL_ADPCM == true)
+	ima_state_t start[PREROLL_NUM_CH];   // Encoder state before the first sample
+#endif
+	uint8_t data[PREROLL_NUM_CH][PREROLL_BLOCK_BYTES];
+} preroll_block_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "preroll";
+
+static const char* trig_names[PREROLL_NUM_TRIG] = {"lec_diverge", "underrun", "deadline", "manual"};
+
+// Ring - only changed by audio_task (which starts it over once a capture has been saved)
+static preroll_block_t* pre_ring;
+static int pre_head;                              // Block being filled
+static int pre_count;                             // Full blocks before it
+static int pre_rate = PREROLL_MAX_RATE / 2;
+static atomic_bool pre_recording = false;
+#if (CONFIG_PREROLL_ADPCM == true)
+static ima_state_t pre_enc[PREROLL_NUM_CH];
+#endif
+
+// Triggering
+static esp_timer_handle_t pre_stop_timer;
+static atomic_bool save_pending = false;
+static TickType_t last_save_tick;
+static int trig_reason;
+static int64_t trig_usec;
+
+// Save in progress
+static int save_rd;
+static int save_left;
+static bool save_first;
+static int64_t save_first_usec;                   // esp_timer time of the first sample saved
+static int64_t save_offset_usec;                  // esp_timer time to time of day
+static uint32_t save_samples;
+static int16_t* save_pcm;                         // A decoded block
+static FILE* save_fp[PREROLL_NUM_CH];             // Open during a slice
+static const char* file_prefix[PREROLL_NUM_CH] = {"tx", "rx", "ec"};
+static int file_num = 1;
+
+static preroll_stats_t preroll_stats;
+static uint64_t rec_cycles_sum;
+static uint32_t rec_count;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _prerollReset(int rate);
+static void _prerollStop(void* arg);
+static void _prerollSaveDone(bool ok);
+static bool _prerollSaveJob(void* arg);
+static bool _prerollOpenFiles(bool create);
+static bool _prerollCloseFiles();
+static bool _prerollWriteBlock();
+static bool _prerollWriteInfo();
+
+
+
+//
+// API
+//
+bool preroll_init()
+{
+	const esp_timer_create_args_t timer_args = {
+		.callback = &_prerollStop,
+		.name = "preroll"
+	};
+	
+	pre_ring = (preroll_block_t*) heap_caps_malloc(PREROLL_RING_BLOCKS * sizeof(preroll_block_t), MALLOC_CAP_SPIRAM);
+	save_pcm = (int16_t*) heap_caps_malloc(PREROLL_BLOCK_SAMPLES * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+	if ((pre_ring == NULL) || (save_pcm == NULL)) {
+		ESP_LOGE(TAG, "Could not allocate the pre-roll ring");
+		heap_caps_free(pre_ring);
+		heap_caps_free(save_pcm);
+		pre_ring = NULL;
+		return false;
+	}
+	
+	if (esp_timer_create(&timer_args, &pre_stop_timer) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not create the trigger timer");
+		heap_caps_free(pre_ring);
+		heap_caps_free(save_pcm);
+		pre_ring = NULL;
+		return false;
+	}
+	
+	preroll_stats.ring_blocks = PREROLL_RING_BLOCKS;
+	last_save_tick = xTaskGetTickCount() - pdMS_TO_TICKS(PREROLL_HOLDOFF_MSEC);
+	ESP_LOGI(TAG, "Recording %d seconds of call audio into %d kB", CONFIG_PREROLL_SECS,
+	         (int) (PREROLL_RING_BLOCKS * sizeof(preroll_block_t) / 1024));
+	
+	return true;
+}
+
+
+void preroll_start(int rate)
+{
+	if (pre_ring == NULL) return;
+	
+	if (atomic_load(&save_pending)) {
+		// Don't mix this call's audio into the last one's capture
+		atomic_store(&pre_recording, false);
+		return;
+	}
+	
+	_prerollReset(rate);
+}
+
+
+void preroll_record(const int16_t* tx, const int16_t* rx, const int16_t* ec, int len)
+{
+	const int16_t* src[PREROLL_NUM_CH] = {tx, rx, ec};
+	preroll_block_t* b;
+	uint32_t start = esp_cpu_get_ccount();
+	uint32_t cycles;
+	int c, n;
+	int pos = 0;
+	
+	if (pre_ring == NULL) return;
+	
+	if (!atomic_load(&pre_recording)) {
+		// Start over once the last capture has been saved
+		if (atomic_load(&save_pending)) return;
+		_prerollReset(pre_rate);
+	}
+	
+	while (pos < len) {
+		b = &pre_ring[pre_head];
+		if (b->len == 0) {
+			b->usec = esp_timer_get_time() - ((int64_t) (len - pos) * 1000000 / pre_rate);
+#if (CONFIG_PREROLL_ADPCM == true)
+			memcpy(b->start, pre_enc, sizeof(pre_enc));
+#endif
+		}
+		
+		n = PREROLL_BLOCK_SAMPLES - b->len;
+		if (n > (len - pos)) n = len - pos;
+		for (c=0; c<PREROLL_NUM_CH; c++) {
+#if (CONFIG_PREROLL_ADPCM == true)
+			(void) ima_encode(&pre_enc[c], src[c] + pos, &b->data[c][b->len / 2], n);
+#else
+			memcpy((int16_t*) b->data[c] + b->len, src[c] + pos, n * sizeof(int16_t));
+#endif
+		}
+		b->len += n;
+		pos += n;
+		
+		if (b->len == PREROLL_BLOCK_SAMPLES) {
+			// Next block, overwriting the oldest
+			if (++pre_head >= PREROLL_RING_BLOCKS) pre_head = 0;
+			if (pre_count < (PREROLL_RING_BLOCKS - 1)) pre_count++;
+			pre_ring[pre_head].len = 0;
+		}
+	}
+	
+	cycles = esp_cpu_get_ccount() - start;
+	rec_cycles_sum += cycles;
+	rec_count++;
+	if (cycles > preroll_stats.max_rec_cycles) preroll_stats.max_rec_cycles = cycles;
+}
+
+
+void preroll_trigger(int reason)
+{
+	if ((pre_ring == NULL) || (reason < 0) || (reason >= PREROLL_NUM_TRIG)) return;
+	
+	if (atomic_load(&pre_recording) && !atomic_load(&save_pending) &&
+	    ((xTaskGetTickCount() - last_save_tick) >= pdMS_TO_TICKS(PREROLL_HOLDOFF_MSEC))) {
+		atomic_store(&save_pending, true);
+		trig_reason = reason;
+		trig_usec = esp_timer_get_time();
+		preroll_stats.triggers[reason]++;
+		(void) esp_timer_start_once(pre_stop_timer, PREROLL_POST_TRIG_MSEC * 1000);
+	}
+}
+
+
+void preroll_save()
+{
+	if (pre_ring == NULL) return;
+	
+	if (atomic_load(&pre_recording) && !atomic_load(&save_pending)) {
+		atomic_store(&save_pending, true);
+		trig_reason = PREROLL_TRIG_MANUAL;
+		trig_usec = esp_timer_get_time();
+		preroll_stats.triggers[PREROLL_TRIG_MANUAL]++;
+		_prerollStop(NULL);
+	}
+}
+
+
+void preroll_get_stats(preroll_stats_t* stats)
+{
+	preroll_stats.recording = !atomic_load(&save_pending);
+	preroll_stats.rate = pre_rate;
+	preroll_stats.blocks = pre_count;
+	preroll_stats.avg_rec_cycles = (rec_count == 0) ? 0 : (uint32_t) (rec_cycles_sum / rec_count);
+	memcpy(stats, &preroll_stats, sizeof(preroll_stats_t));
+}
+
+
+const char* preroll_trigger_name(int reason)
+{
+	if ((reason < 0) || (reason >= PREROLL_NUM_TRIG)) return "?";
+	return trig_names[reason];
+}
+
+
+
+//
+// Internal functions
+//
+
+// Empty the ring - only from audio_task
+static void _prerollReset(int rate)
+{
+	pre_head = 0;
+	pre_count = 0;
+	pre_ring[0].len = 0;
+	pre_rate = rate;
+#if (CONFIG_PREROLL_ADPCM == true)
+	for (int c=0; c<PREROLL_NUM_CH; c++) {
+		ima_init(&pre_enc[c]);
+	}
+#endif
+	atomic_store(&pre_recording, true);
+}
+
+
+// Stop recording and queue the ring to be saved.  Runs from the esp_timer task after a
+// trigger or from the caller of preroll_save.
+static void _prerollStop(void* arg)
+{
+	struct timeval tv;
+	
+	atomic_store(&pre_recording, false);
+	
+	(void) gettimeofday(&tv, NULL);
+	save_offset_usec = ((int64_t) tv.tv_sec * 1000000 + tv.tv_usec) - esp_timer_get_time();
+	save_first = true;
+	
+	// Ahead of the low priority hci_snoop save so the capture around a fault is written first
+	if (!bg_job_submit("preroll", &_prerollSaveJob, NULL, BG_JOB_PRIO_NORMAL)) {
+		ESP_LOGE(TAG, "Could not queue the capture to be saved");
+		_prerollSaveDone(false);
+	}
+}
+
+
+// Let audio_task start the ring over
+static void _prerollSaveDone(bool ok)
+{
+	if (ok) {
+		ESP_LOGI(TAG, "Saved capture %d (%s)", file_num, trig_names[trig_reason]);
+		preroll_stats.saves++;
+		preroll_stats.last_file = file_num;
+	} else {
+		preroll_stats.save_failures++;
+	}
+	file_num++;
+	last_save_tick = xTaskGetTickCount();
+	atomic_store(&save_pending, false);
+}
+
+
+// Background job decoding the stopped ring into the files on the card, a few blocks per
+// slice.  Each slice mounts the card and reopens the files so a call arriving between
+// slices finds the card free.  Jobs don't run during calls so audio_task isn't recording
+// into the ring.
+static bool _prerollSaveJob(void* arg)
+{
+	int n = 0;
+	bool create = save_first;
+	bool ok;
+	
+	if (save_first) {
+		// The newest blocks holding CONFIG_PREROLL_SECS and the post-trigger time
+		save_left = pre_count;
+		if (save_left > PREROLL_BLOCKS(pre_rate)) save_left = PREROLL_BLOCKS(pre_rate);
+		save_rd = pre_head - save_left;
+		if (save_rd < 0) save_rd += PREROLL_RING_BLOCKS;
+		if (pre_ring[pre_head].len != 0) save_left++;
+		save_first_usec = pre_ring[save_rd].usec;
+		save_samples = 0;
+		save_first = false;
+		
+		if (save_left == 0) {
+			// Nothing recorded yet
+			last_save_tick = xTaskGetTickCount();
+			atomic_store(&save_pending, false);
+			return false;
+		}
+	}
+	
+	if (!sd_card_mount()) {
+		ESP_LOGE(TAG, "Could not mount the card to save the capture");
+		_prerollSaveDone(false);
+		return false;
+	}
+	
+	ok = _prerollOpenFiles(create);
+	while (ok && (save_left > 0) && ((n++ < PREROLL_SLICE_BLOCKS) || !bg_job_should_yield())) {
+		ok = _prerollWriteBlock();
+	}
+	if (!_prerollCloseFiles()) ok = false;
+	
+	// The info file is opened after the sample files are closed to stay in the card's file budget
+	if (ok && (save_left == 0)) {
+		ok = _prerollWriteInfo();
+	}
+	sd_card_unmount();
+	
+	if (ok && (save_left != 0)) {
+		return true;
+	}
+	
+	if (!ok) {
+		ESP_LOGE(TAG, "Could not write capture %d", file_num);
+	}
+	_prerollSaveDone(ok);
+	return false;
+}
+
+
+// Create the capture's sample files on the first slice or reopen them to append
+static bool _prerollOpenFiles(bool create)
+{
+	char filename[40];
+	struct stat st;
+	int c;
+	
+	if (create) {
+		// Don't overwrite captures from before a reset
+		do {
+			sprintf(filename, "%s/pre_in%d.txt", SD_CARD_MOUNT_POINT, file_num);
+		} while ((stat(filename, &st) == 0) && (++file_num < 10000));
+	}
+	
+	for (c=0; c<PREROLL_NUM_CH; c++) {
+		sprintf(filename, "%s/pre_%s%d.raw", SD_CARD_MOUNT_POINT, file_prefix[c], file_num);
+		save_fp[c] = fopen(filename, create ? "wb" : "ab");
+		if (save_fp[c] == NULL) {
+			ESP_LOGE(TAG, "Could not open %s", filename);
+			(void) _prerollCloseFiles();
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+
+// Close the sample files (flushing what they buffered), false if any couldn't be written
+static bool _prerollCloseFiles()
+{
+	bool ok = true;
+	int c;
+	
+	for (c=0; c<PREROLL_NUM_CH; c++) {
+		if (save_fp[c] != NULL) {
+			if (fclose(save_fp[c]) != 0) ok = false;
+			save_fp[c] = NULL;
+		}
+	}
+	
+	return ok;
+}
+
+
+static bool _prerollWriteBlock()
+{
+	preroll_block_t* b = &pre_ring[save_rd];
+	int c;
+#if (CONFIG_PREROLL_ADPCM == true)
+	ima_state_t s;
+#endif
+	
+	for (c=0; c<PREROLL_NUM_CH; c++) {
+#if (CONFIG_PREROLL_ADPCM == true)
+		s = b->start[c];
+		ima_decode(&s, b->data[c], save_pcm, b->len);
+#else
+		memcpy(save_pcm, b->data[c], b->len * sizeof(int16_t));
+#endif
+		if (fwrite(save_pcm, sizeof(int16_t), b->len, save_fp[c]) != (size_t) b->len) return false;
+	}
+	
+	save_samples += b->len;
+	if (++save_rd >= PREROLL_RING_BLOCKS) save_rd = 0;
+	save_left--;
+	
+	return true;
+}
+
+
+static bool _prerollWriteInfo()
+{
+	char filename[40];
+	char time_str[32];
+	FILE* fp;
+	time_t t;
+	struct tm te;
+	int64_t trig_sample;
+	
+	sprintf(filename, "%s/pre_in%d.txt", SD_CARD_MOUNT_POINT, file_num);
+	fp = fopen(filename, "w");
+	if (fp == NULL) return false;
+	
+	t = (time_t) ((save_first_usec + save_offset_usec) / 1000000);
+	localtime_r(&t, &te);
+	strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S", &te);
+	trig_sample = (trig_usec - save_first_usec) * pre_rate / 1000000;
+	
+	fprintf(fp, "rate=%d\nring_encoding=%s\nsamples=%u\nstart=%s\ntrigger=%s\ntrigger_sample=%lld\n",
+	        pre_rate, PREROLL_ENC_NAME, save_samples, time_str, trig_names[trig_reason], trig_sample);
+	fclose(fp);
+	
+	return true;
+}
+
+#endif /* CONFIG_PREROLL_ENABLE */
@@ -0,0 +1,102 @@
+/*
+ * preroll - utility module keeping the last CONFIG_PREROLL_SECS of call audio (the TX
+ * reference, the RX line signal and the echo canceller output, the same three channels a
+ * sample recording holds) in a PSRAM ring so the audio around an echo or dropout problem in
+ * the field is saved without anyone having started a recording.
+ *
+ * audio_task hands each echo canceller block to preroll_record which encodes it into the ring
+ * as IMA ADPCM (or copies it when CONFIG_PREROLL_ADPCM isn't set), overwriting the oldest
+ * audio.  The ring is made of blocks of PREROLL_BLOCK_SAMPLES samples per channel, each
+ * starting with the encoder state so any block can be decoded on its own.  The ring starts
+ * over at the start of each call.
+ *
+ * A call to preroll_trigger (audio_task on echo canceller divergence, a jitter buffer underrun
+ * or a deadline miss) stops recording PREROLL_POST_TRIG_MSEC later.  The ring is then written
+ * to the Micro-SD Card by a background job, so once the call is over, as 16-bit PCM files
+ * (pre_tx<n>.raw, pre_rx<n>.raw and pre_ec<n>.raw) with an info file (pre_in<n>.txt) holding
+ * the sample rate, trigger reason and where in the files the trigger happened.  Recording then
+ * starts over.
+ *
+ * The module is compiled out unless CONFIG_PREROLL_ENABLE is set.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _PREROLL_H_
+#define _PREROLL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Samples per channel in each ring block
+#define PREROLL_BLOCK_SAMPLES   1024
+
+// Time recorded after a trigger before recording stops
+#define PREROLL_POST_TRIG_MSEC  2000
+
+// Minimum time between triggered captures (measured from the end of the last save)
+#define PREROLL_HOLDOFF_MSEC    60000
+
+// Blocks written before a save slice checks if it should yield
+#define PREROLL_SLICE_BLOCKS    4
+
+// Trigger reasons
+#define PREROLL_TRIG_LEC_DIVERGE 0
+#define PREROLL_TRIG_UNDERRUN    1
+#define PREROLL_TRIG_DEADLINE    2
+#define PREROLL_TRIG_MANUAL      3
+#define PREROLL_NUM_TRIG         4
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	bool recording;                       // False while a capture is waiting to be saved
+	int rate;                             // Sample rate of the audio in the ring
+	uint32_t blocks;                      // Full blocks in the ring
+	uint32_t ring_blocks;                 // Ring size
+	uint32_t triggers[PREROLL_NUM_TRIG];
+	uint32_t saves;
+	uint32_t save_failures;
+	int last_file;                        // Number of the last capture saved (0 for none)
+	uint32_t avg_rec_cycles;              // Cost of recording a block of audio
+	uint32_t max_rec_cycles;
+} preroll_stats_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_PREROLL_ENABLE == true)
+bool preroll_init();                      // Call from app_main before audio_task starts
+void preroll_start(int rate);             // audio_task at the start of a call
+void preroll_record(const int16_t* tx, const int16_t* rx, const int16_t* ec, int len);  // audio_task, len even
+void preroll_trigger(int reason);         // Stop and save the ring PREROLL_POST_TRIG_MSEC from now
+void preroll_save();                      // Stop and save it now (ignores the holdoff)
+void preroll_get_stats(preroll_stats_t* stats);
+const char* preroll_trigger_name(int reason);
+#endif
+
+#endif /* _PREROLL_H_ */
@@ -0,0 +1,439 @@
+/*
+ * prompt - utility module playing recorded voice prompts to the phone through the TX mixer.
+ *
+ * The database partition stays memory mapped so prompts are decoded in place from flash.  A
+ * database from the Micro-SD Card is read into PSRAM once at boot (after the boot-time users
+ * of the card) and used the same way.  The worker task decodes PROMPT_BLOCK_LEN samples at
+ * a time into a staging buffer and moves them into the mixer's single-producer ring as it
+ * drains so audio_task only ever mixes samples.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include "prompt.h"
+
+#if (CONFIG_PROMPT_ENABLE == true)
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "audio_task.h"
+#include "boot_prof.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include "esp_rom_crc.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/queue.h"
+#include "freertos/task.h"
+#include "ima_adpcm.h"
+#include "power_utilities.h"
+#include "sd_card.h"
+
+
+//
+// Constants
+//
+
+// Prompt database partition (data partition subtype) and format (see tools/prompt_db.py)
+#define PROMPT_PART_NAME    "prompts"
+#define PROMPT_PART_SUBTYPE 0x41
+#define PROMPT_DB_MAGIC     0x544D5250   /* "PRMT" */
+#define PROMPT_DB_VERSION   1
+
+// Database on the Micro-SD Card (read into PSRAM, so limited to the partition size)
+#define PROMPT_SD_FILE      SD_CARD_MOUNT_POINT "/prompts.bin"
+#define PROMPT_SD_MAX_LEN   (256 * 1024)
+#define PROMPT_SD_READ_LEN  4096
+#define PROMPT_MOUNT_TRIES  5
+#define PROMPT_RETRY_MSEC   200
+
+// Wait for the boot-time users of the card before reading it
+#define PROMPT_BOOT_WAIT_MSEC 30000
+
+// Worker task - above pots_task and app_task (the usual requesters) so a new prompt is
+// decoded as soon as it is asked for
+#define PROMPT_TASK_STACK   3072
+#define PROMPT_TASK_PRIO    4
+
+// Samples decoded at a time (must be even so each block starts on a byte)
+#define PROMPT_BLOCK_LEN    1024
+
+// The mixer's ring (128 mSec) is kept filled to PROMPT_MIX_LEN samples, checked every
+// PROMPT_EVAL_MSEC while a prompt is playing
+#define PROMPT_MIX_LEN      896
+#define PROMPT_EVAL_MSEC    40
+
+// A prompt requested as audio is being started waits this long for the stream before it is
+// dropped
+#define PROMPT_READY_MSEC   400
+
+
+
+//
+// Database layout - all little endian and naturally aligned.  Offsets are from the start
+// of the database.  Each prompt is 8 kHz IMA ADPCM starting from a zero predictor and step
+// index, two samples per byte with the first in the low nibble.
+//
+typedef struct {
+	uint32_t magic;
+	uint16_t version;
+	uint16_t num_prompts;
+	uint32_t length;                // Total database bytes including this header
+	uint32_t crc;                   // CRC32 of the bytes following this header
+} prompt_db_header_t;
+
+typedef struct {
+	uint32_t offset;                // ADPCM data (0 if the prompt wasn't recorded)
+	uint32_t samples;
+} prompt_db_entry_t;
+
+_Static_assert(sizeof(prompt_db_header_t) == 16, "prompt_db_header_t layout");
+_Static_assert(sizeof(prompt_db_entry_t) == 8, "prompt_db_entry_t layout");
+
+
+
+//
+// Variables
+//
+static const char* TAG = "prompt";
+
+static TaskHandle_t task_handle_prompt = NULL;
+static StackType_t prompt_task_stack[PROMPT_TASK_STACK];
+static StaticTask_t prompt_task_tcb;
+static QueueHandle_t prompt_queue;
+static StaticQueue_t prompt_queue_buf;
+static uint8_t prompt_queue_storage[PROMPT_QUEUE_LEN * sizeof(int8_t)];
+
+// Database (mapped flash or PSRAM)
+static const uint8_t* prompt_db = NULL;
+static int prompt_db_num;
+static const prompt_db_entry_t* prompt_db_entry;
+
+// Requests from other tasks
+static atomic_bool stop_req = false;
+static atomic_bool playing = false;
+static int not_ready_count = 0;
+
+// Current prompt
+static const uint8_t* cur_src;          // Next ADPCM byte
+static int cur_remaining = 0;           // Samples left to decode
+static ima_state_t cur_ima;
+
+// Decoded block waiting for room in the mixer
+static int16_t stage_buf[PROMPT_BLOCK_LEN];
+static int stage_len = 0;
+static int stage_pos = 0;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _prompt_task(void* args);
+static void _prompt_fill();
+static bool _prompt_decode_block();
+static void _prompt_flush();
+static bool _prompt_db_validate(const uint8_t* db, uint32_t max_len);
+static void _prompt_db_use(const uint8_t* db);
+static void _prompt_load_sd();
+
+
+
+//
+// API
+//
+void prompt_init()
+{
+	const esp_partition_t* part;
+	const void* db;
+	spi_flash_mmap_handle_t handle;
+	
+	prompt_queue = xQueueCreateStatic(PROMPT_QUEUE_LEN, sizeof(int8_t), prompt_queue_storage, &prompt_queue_buf);
+	if (prompt_queue == NULL) {
+		ESP_LOGE(TAG, "Could not create queue");
+		return;
+	}
+	
+	// The mapping is kept for good since prompts are decoded in place
+	part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, PROMPT_PART_SUBTYPE, PROMPT_PART_NAME);
+	if (part == NULL) {
+		ESP_LOGI(TAG, "No prompt partition");
+	} else if (esp_partition_mmap(part, 0, part->size, SPI_FLASH_MMAP_DATA, &db, &handle) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not map the prompt partition");
+	} else if (_prompt_db_validate((const uint8_t*) db, part->size)) {
+		_prompt_db_use((const uint8_t*) db);
+	} else {
+		spi_flash_munmap(handle);
+	}
+	
+	task_handle_prompt = xTaskCreateStaticPinnedToCore(&_prompt_task, "prompt_task", PROMPT_TASK_STACK, NULL, PROMPT_TASK_PRIO, prompt_task_stack, &prompt_task_tcb, 0);
+}
+
+
+bool prompt_available(int id)
+{
+	const uint8_t* db = prompt_db;
+	
+	return ((db != NULL) && (id >= 0) && (id < prompt_db_num) && (prompt_db_entry[id].samples != 0));
+}
+
+
+bool prompt_play(int id)
+{
+	int8_t v = (int8_t) id;
+	
+	if ((task_handle_prompt == NULL) || !prompt_available(id)) {
+		return false;
+	}
+	
+	if (xQueueSend(prompt_queue, &v, 0) != pdTRUE) {
+		ESP_LOGW(TAG, "Prompt queue full");
+		return false;
+	}
+	atomic_store(&playing, true);
+	xTaskNotifyGive(task_handle_prompt);
+	
+	return true;
+}
+
+
+bool prompt_play_digits(const char* s)
+{
+	bool success = true;
+	int id;
+	
+	while (*s != 0) {
+		if ((*s >= '0') && (*s <= '9')) {
+			id = PROMPT_DIGIT_0 + (*s - '0');
+		} else if (*s == '*') {
+			id = PROMPT_STAR;
+		} else if (*s == '#') {
+			id = PROMPT_POUND;
+		} else {
+			id = -1;
+		}
+		if (id >= 0) {
+			success &= prompt_play(id);
+		}
+		s++;
+	}
+	
+	return success;
+}
+
+
+void prompt_stop()
+{
+	if (task_handle_prompt != NULL) {
+		atomic_store(&stop_req, true);
+		xTaskNotifyGive(task_handle_prompt);
+	}
+}
+
+
+bool prompt_busy()
+{
+	return (atomic_load(&playing) || (audioGetMixTxCount(AUDIO_MIX_PROMPT) != 0));
+}
+
+
+
+//
+// Internal functions
+//
+static void _prompt_task(void* args)
+{
+	ESP_LOGI(TAG, "Start task");
+	
+	if ((prompt_db == NULL) && power_get_sdcard_present()) {
+		(void) boot_prof_wait_ready(BOOT_READY_ALL, pdMS_TO_TICKS(PROMPT_BOOT_WAIT_MSEC));
+		_prompt_load_sd();
+	}
+	
+	while (true) {
+		// Sleep until a prompt is requested then keep the mixer topped off while it plays
+		(void) ulTaskNotifyTake(pdTRUE, atomic_load(&playing) ? pdMS_TO_TICKS(PROMPT_EVAL_MSEC) : portMAX_DELAY);
+		
+		if (atomic_exchange(&stop_req, false)) {
+			_prompt_flush();
+		}
+		_prompt_fill();
+	}
+}
+
+
+// Move decoded audio into the mixer up to PROMPT_MIX_LEN samples, decoding the next block
+// (of the current or next queued prompt) when the staged one is used up
+static void _prompt_fill()
+{
+	int n;
+	int space = PROMPT_MIX_LEN - audioGetMixTxCount(AUDIO_MIX_PROMPT);
+	
+	if (!audioMixTxReady()) {
+		if (++not_ready_count > (PROMPT_READY_MSEC / PROMPT_EVAL_MSEC)) {
+			_prompt_flush();
+		}
+		space = 0;
+	} else {
+		not_ready_count = 0;
+	}
+	
+	while (space > 0) {
+		if ((stage_pos == stage_len) && !_prompt_decode_block()) break;
+		
+		n = stage_len - stage_pos;
+		if (n > space) n = space;
+		audioPutMixTx(AUDIO_MIX_PROMPT, &stage_buf[stage_pos], n);
+		stage_pos += n;
+		space -= n;
+	}
+	
+	atomic_store(&playing, (stage_pos < stage_len) || (cur_remaining != 0) || (uxQueueMessagesWaiting(prompt_queue) != 0));
+}
+
+
+static bool _prompt_decode_block()
+{
+	int8_t id;
+	int n;
+	
+	if (cur_remaining == 0) {
+		if (xQueueReceive(prompt_queue, &id, 0) != pdTRUE) return false;
+		
+		cur_src = prompt_db + prompt_db_entry[id].offset;
+		cur_remaining = (int) prompt_db_entry[id].samples;
+		ima_init(&cur_ima);
+	}
+	
+	n = (cur_remaining > PROMPT_BLOCK_LEN) ? PROMPT_BLOCK_LEN : cur_remaining;
+	ima_decode(&cur_ima, cur_src, stage_buf, n);
+	cur_src += n / 2;
+	cur_remaining -= n;
+	stage_len = n;
+	stage_pos = 0;
+	
+	return true;
+}
+
+
+// Drop the current and queued prompts along with what's already in the mixer
+static void _prompt_flush()
+{
+	xQueueReset(prompt_queue);
+	not_ready_count = 0;
+	cur_remaining = 0;
+	stage_len = 0;
+	stage_pos = 0;
+	audioFlushMixTx(AUDIO_MIX_PROMPT);
+}
+
+
+// Check the database is complete and every prompt is inside it
+static bool _prompt_db_validate(const uint8_t* db, uint32_t max_len)
+{
+	const prompt_db_header_t* hdrP = (const prompt_db_header_t*) db;
+	const prompt_db_entry_t* eP;
+	int i;
+	
+	if (hdrP->magic != PROMPT_DB_MAGIC) {
+		ESP_LOGI(TAG, "Prompt database is empty");
+		return false;
+	}
+	if (hdrP->version != PROMPT_DB_VERSION) {
+		ESP_LOGE(TAG, "Unsupported prompt database version %d", hdrP->version);
+		return false;
+	}
+	if ((hdrP->length > max_len) ||
+	    ((sizeof(prompt_db_header_t) + hdrP->num_prompts * sizeof(prompt_db_entry_t)) > hdrP->length)) {
+		ESP_LOGE(TAG, "Bad prompt database length");
+		return false;
+	}
+	if (esp_rom_crc32_le(0, db + sizeof(prompt_db_header_t), hdrP->length - sizeof(prompt_db_header_t)) != hdrP->crc) {
+		ESP_LOGE(TAG, "Bad prompt database CRC");
+		return false;
+	}
+	
+	eP = (const prompt_db_entry_t*) (db + sizeof(prompt_db_header_t));
+	for (i=0; i<hdrP->num_prompts; i++, eP++) {
+		if ((eP->samples != 0) && ((eP->offset + (eP->samples + 1) / 2) > hdrP->length)) {
+			ESP_LOGE(TAG, "Prompt %d outside the database", i);
+			return false;
+		}
+	}
+	
+	return true;
+}
+
+
+static void _prompt_db_use(const uint8_t* db)
+{
+	const prompt_db_header_t* hdrP = (const prompt_db_header_t*) db;
+	
+	prompt_db_num = (hdrP->num_prompts < PROMPT_NUM) ? hdrP->num_prompts : PROMPT_NUM;
+	prompt_db_entry = (const prompt_db_entry_t*) (db + sizeof(prompt_db_header_t));
+	prompt_db = db;
+	
+	ESP_LOGI(TAG, "%d prompts (%u bytes)", hdrP->num_prompts, hdrP->length);
+}
+
+
+// Read prompts.bin into PSRAM (the card is only mounted while it is read)
+static void _prompt_load_sd()
+{
+	bool mounted = false;
+	FILE* fp;
+	uint8_t* buf;
+	int len = 0;
+	int n;
+	
+	// The card may still be powering up
+	for (int i=0; i<PROMPT_MOUNT_TRIES; i++) {
+		mounted = sd_card_mount();
+		if (mounted) break;
+		vTaskDelay(pdMS_TO_TICKS(PROMPT_RETRY_MSEC));
+	}
+	if (!mounted) {
+		ESP_LOGE(TAG, "Failed to mount the card");
+		return;
+	}
+	
+	fp = fopen(PROMPT_SD_FILE, "rb");
+	if (fp == NULL) {
+		ESP_LOGI(TAG, "No %s", PROMPT_SD_FILE);
+	} else {
+		buf = (uint8_t*) heap_caps_malloc(PROMPT_SD_MAX_LEN, MALLOC_CAP_SPIRAM);
+		if (buf == NULL) {
+			ESP_LOGE(TAG, "malloc prompt buffer failed");
+		} else {
+			while ((len < PROMPT_SD_MAX_LEN) &&
+			       ((n = fread(buf + len, 1, PROMPT_SD_MAX_LEN - len < PROMPT_SD_READ_LEN ? PROMPT_SD_MAX_LEN - len : PROMPT_SD_READ_LEN, fp)) > 0)) {
+				len += n;
+			}
+			
+			if ((len >= sizeof(prompt_db_header_t)) && _prompt_db_validate(buf, len)) {
+				_prompt_db_use(buf);
+			} else {
+				free(buf);
+			}
+		}
+		fclose(fp);
+	}
+	
+	sd_card_unmount();
+}
+
+#endif /* CONFIG_PROMPT_ENABLE */
@@ -0,0 +1,68 @@
+/*
+ * prompt - utility module playing recorded voice prompts ("phone not connected", "battery
+ * low", digits read back) to the phone through the AUDIO_MIX_PROMPT source of the TX mixer.
+ *
+ * The prompts are IMA ADPCM recordings in a database built by tools/prompt_db.py.  It is
+ * read from the "prompts" data partition or, when that doesn't hold one, from prompts.bin
+ * in the root of the Micro-SD Card.  A worker task decodes the queued prompts in large
+ * blocks ahead of audio_task and keeps the mixer topped off.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _PROMPT_H_
+#define _PROMPT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+//
+// Constants
+//
+
+// Prompts in the database (tools/prompt_db.py stores them in this order)
+#define PROMPT_DIGIT_0         0    // Digits 0 - 9 are PROMPT_DIGIT_0 + n
+#define PROMPT_STAR            10
+#define PROMPT_POUND           11
+#define PROMPT_NOT_CONNECTED   12   // "Phone not connected"
+#define PROMPT_BATTERY_LOW     13   // "Battery low"
+
+#define PROMPT_NUM             14
+
+// Prompts that may be waiting to play
+#define PROMPT_QUEUE_LEN       32
+
+
+
+//
+// API
+//
+#if (CONFIG_PROMPT_ENABLE == true)
+void prompt_init();                       // Maps the database partition and starts the worker task
+bool prompt_available(int id);            // True if the database holds prompt id
+bool prompt_play(int id);                 // Queue a prompt after any already playing (see note)
+bool prompt_play_digits(const char* s);   // Queue the prompts for each digit, '*' and '#' in s
+void prompt_stop();                       // End the current prompt and drop any queued
+bool prompt_busy();                       // True while a prompt is queued or still being played
+#endif
+
+// Note: Prompts only play while audio_task is running tone, voice or standby audio.  One
+// requested just as the stream is being started waits briefly for it and is dropped if it
+// doesn't start.  The worker task runs above the tasks requesting prompts so the first block
+// is in the mixer in time for the next audio frame.
+
+#endif /* _PROMPT_H_ */
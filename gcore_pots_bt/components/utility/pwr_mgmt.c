@@ -0,0 +1,235 @@
+/*
+ * pwr_mgmt - utility module running the CPU at its lowest frequency unless a task holds
+ * it at the maximum.  Each hold reason has its own ESP_PM_CPU_FREQ_MAX lock so the task
+ * owning it can take and give it without coordinating with the others.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pwr_mgmt.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_pm.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#if (CONFIG_PM_ENABLE == true)
+#include "esp32/pm.h"
+#endif
+#include "sdkconfig.h"
+
+
+//
+// Variables
+//
+static const char* TAG = "pwr_mgmt";
+
+static const char* pwr_mgmt_lock_names[PWR_MGMT_NUM_HOLDS] = {"audio", "gui", "bt_pair", "bench"};
+
+#if (CONFIG_PM_ENABLE == true)
+static esp_pm_lock_handle_t pwr_mgmt_locks[PWR_MGMT_NUM_HOLDS];
+#endif
+
+static portMUX_TYPE pwr_mgmt_mux = portMUX_INITIALIZER_UNLOCKED;
+static pwr_mgmt_stats_t pwr_mgmt_stats;
+static int64_t pwr_mgmt_change_usec;             // Last time lock_mask went to or from 0
+
+// Held reasons that are allowed to raise the frequency (their locks are acquired)
+static uint32_t pwr_mgmt_lock_mask = 0;
+
+// Load current accumulators for each state
+static uint32_t pwr_mgmt_max_load_sum;
+static uint32_t pwr_mgmt_max_load_count;
+static uint32_t pwr_mgmt_low_load_sum;
+static uint32_t pwr_mgmt_low_load_count;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _pwrMgmtEvalLocks(int64_t now, uint32_t* acquire, uint32_t* release);
+static void _pwrMgmtApplyLocks(uint32_t acquire, uint32_t release);
+static void _pwrMgmtAccumulate(int64_t now);
+
+
+
+//
+// API
+//
+bool pwr_mgmt_init()
+{
+	memset(&pwr_mgmt_stats, 0, sizeof(pwr_mgmt_stats_t));
+	pwr_mgmt_stats.max_freq_mhz = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
+	pwr_mgmt_stats.min_freq_mhz = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
+	pwr_mgmt_stats.allowed_mask = PWR_MGMT_HOLD_ALL;
+	pwr_mgmt_change_usec = esp_timer_get_time();
+	
+#if (CONFIG_PM_ENABLE == true)
+	esp_err_t ret;
+	esp_pm_config_esp32_t pm_config = {
+		.max_freq_mhz = CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ,
+		.min_freq_mhz = CONFIG_PWR_MGMT_MIN_FREQ_MHZ,
+#if (CONFIG_PWR_MGMT_LIGHT_SLEEP == true)
+		.light_sleep_enable = true
+#else
+		.light_sleep_enable = false
+#endif
+	};
+	
+	// Create the locks first so nothing runs slowly before a task can take its lock
+	for (int i=0; i<PWR_MGMT_NUM_HOLDS; i++) {
+		ret = esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, pwr_mgmt_lock_names[i], &pwr_mgmt_locks[i]);
+		if (ret != ESP_OK) {
+			ESP_LOGE(TAG, "Create %s lock failed - %d", pwr_mgmt_lock_names[i], ret);
+			return false;
+		}
+	}
+	
+	ret = esp_pm_configure(&pm_config);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Configure failed - %d", ret);
+		return false;
+	}
+	
+	pwr_mgmt_stats.enabled = true;
+	pwr_mgmt_stats.light_sleep = pm_config.light_sleep_enable;
+	pwr_mgmt_stats.min_freq_mhz = pm_config.min_freq_mhz;
+	ESP_LOGI(TAG, "CPU %d-%d MHz%s", pm_config.min_freq_mhz, pm_config.max_freq_mhz,
+	         pm_config.light_sleep_enable ? ", light sleep" : "");
+#else
+	ESP_LOGI(TAG, "Power management not enabled (CONFIG_PM_ENABLE)");
+#endif
+	
+	return true;
+}
+
+
+void pwr_mgmt_hold(uint32_t reason)
+{
+	uint32_t acquire, release;
+	int64_t now = esp_timer_get_time();
+	
+	portENTER_CRITICAL(&pwr_mgmt_mux);
+	pwr_mgmt_stats.hold_mask |= reason;
+	_pwrMgmtEvalLocks(now, &acquire, &release);
+	portEXIT_CRITICAL(&pwr_mgmt_mux);
+	
+	_pwrMgmtApplyLocks(acquire, release);
+}
+
+
+void pwr_mgmt_release(uint32_t reason)
+{
+	uint32_t acquire, release;
+	int64_t now = esp_timer_get_time();
+	
+	portENTER_CRITICAL(&pwr_mgmt_mux);
+	pwr_mgmt_stats.hold_mask &= ~reason;
+	_pwrMgmtEvalLocks(now, &acquire, &release);
+	portEXIT_CRITICAL(&pwr_mgmt_mux);
+	
+	_pwrMgmtApplyLocks(acquire, release);
+}
+
+
+void pwr_mgmt_set_allowed(uint32_t mask)
+{
+	uint32_t acquire, release;
+	int64_t now = esp_timer_get_time();
+	
+	portENTER_CRITICAL(&pwr_mgmt_mux);
+	pwr_mgmt_stats.allowed_mask = mask & PWR_MGMT_HOLD_ALL;
+	_pwrMgmtEvalLocks(now, &acquire, &release);
+	portEXIT_CRITICAL(&pwr_mgmt_mux);
+	
+	_pwrMgmtApplyLocks(acquire, release);
+}
+
+
+void pwr_mgmt_record_load(uint16_t load_ma)
+{
+	portENTER_CRITICAL(&pwr_mgmt_mux);
+	if (pwr_mgmt_lock_mask != 0) {
+		pwr_mgmt_max_load_sum += load_ma;
+		pwr_mgmt_max_load_count++;
+	} else {
+		pwr_mgmt_low_load_sum += load_ma;
+		pwr_mgmt_low_load_count++;
+	}
+	portEXIT_CRITICAL(&pwr_mgmt_mux);
+}
+
+
+void pwr_mgmt_get_stats(pwr_mgmt_stats_t* stats)
+{
+	int64_t now = esp_timer_get_time();
+	
+	portENTER_CRITICAL(&pwr_mgmt_mux);
+	_pwrMgmtAccumulate(now);
+	memcpy(stats, &pwr_mgmt_stats, sizeof(pwr_mgmt_stats_t));
+	stats->max_load_ma = (pwr_mgmt_max_load_count == 0) ? 0 : (uint16_t) (pwr_mgmt_max_load_sum / pwr_mgmt_max_load_count);
+	stats->low_load_ma = (pwr_mgmt_low_load_count == 0) ? 0 : (uint16_t) (pwr_mgmt_low_load_sum / pwr_mgmt_low_load_count);
+	portEXIT_CRITICAL(&pwr_mgmt_mux);
+}
+
+
+
+//
+// Internal functions
+//
+
+// Charge the time since the last change to the current state - call with pwr_mgmt_mux held
+static void _pwrMgmtAccumulate(int64_t now)
+{
+	if (pwr_mgmt_lock_mask != 0) {
+		pwr_mgmt_stats.max_usec += now - pwr_mgmt_change_usec;
+	} else {
+		pwr_mgmt_stats.low_usec += now - pwr_mgmt_change_usec;
+	}
+	pwr_mgmt_change_usec = now;
+}
+
+
+// Work out the locks to acquire and release for the current hold and allowed masks - call
+// with pwr_mgmt_mux held (the locks are counted so they can be applied after it is released)
+static void _pwrMgmtEvalLocks(int64_t now, uint32_t* acquire, uint32_t* release)
+{
+	uint32_t want = pwr_mgmt_stats.hold_mask & pwr_mgmt_stats.allowed_mask;
+	
+	if ((want != 0) != (pwr_mgmt_lock_mask != 0)) {
+		_pwrMgmtAccumulate(now);
+		if (want != 0) pwr_mgmt_stats.holds++;
+	}
+	*acquire = want & ~pwr_mgmt_lock_mask;
+	*release = pwr_mgmt_lock_mask & ~want;
+	pwr_mgmt_lock_mask = want;
+}
+
+
+static void _pwrMgmtApplyLocks(uint32_t acquire, uint32_t release)
+{
+#if (CONFIG_PM_ENABLE == true)
+	if (pwr_mgmt_stats.enabled) {
+		for (int i=0; i<PWR_MGMT_NUM_HOLDS; i++) {
+			if (acquire & (1 << i)) {
+				(void) esp_pm_lock_acquire(pwr_mgmt_locks[i]);
+			}
+			if (release & (1 << i)) {
+				(void) esp_pm_lock_release(pwr_mgmt_locks[i]);
+			}
+		}
+	}
+#endif
+}
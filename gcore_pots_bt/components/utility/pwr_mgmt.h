@@ -0,0 +1,73 @@
+/*
+ * pwr_mgmt - utility module running the CPU at its lowest frequency (with automatic light
+ * sleep when configured) unless a task holds it at the maximum frequency for one of a set
+ * of reasons.  Also tracks how long it is held and the gCore load current measured in each
+ * state so the savings can be seen.  A performance profile (pwr_profile) may stop some of the
+ * reasons from raising the frequency while they are still held.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _PWR_MGMT_H_
+#define _PWR_MGMT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+//
+// Constants
+//
+
+// Reasons to hold the maximum CPU frequency (each is only held and released by one task)
+#define PWR_MGMT_HOLD_AUDIO    0x01     // audio_task stream enabled
+#define PWR_MGMT_HOLD_GUI      0x02     // gui_task active (backlight not dimmed)
+#define PWR_MGMT_HOLD_BT_PAIR  0x04     // bt_task discoverable for pairing
+#define PWR_MGMT_HOLD_BENCH    0x08     // bench kernel check timing cycles
+#define PWR_MGMT_NUM_HOLDS     4
+#define PWR_MGMT_HOLD_ALL      ((1 << PWR_MGMT_NUM_HOLDS) - 1)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	bool enabled;                       // Frequency scaling configured
+	bool light_sleep;
+	int max_freq_mhz;
+	int min_freq_mhz;
+	uint32_t hold_mask;                 // PWR_MGMT_HOLD_x currently held
+	uint32_t allowed_mask;              // PWR_MGMT_HOLD_x allowed to raise the frequency
+	uint32_t holds;                     // Times the maximum frequency was entered
+	uint64_t max_usec;                  // Time spent at the maximum frequency
+	uint64_t low_usec;                  // Time spent released
+	uint16_t max_load_ma;               // Average load current at the maximum frequency (0 if unmeasured)
+	uint16_t low_load_ma;               // Average load current released
+} pwr_mgmt_stats_t;
+
+
+
+//
+// API
+//
+bool pwr_mgmt_init();                               // Call before the tasks start
+void pwr_mgmt_hold(uint32_t reason);
+void pwr_mgmt_release(uint32_t reason);
+void pwr_mgmt_set_allowed(uint32_t mask);           // Reasons that raise the frequency when held
+void pwr_mgmt_record_load(uint16_t load_ma);        // From the battery monitor
+void pwr_mgmt_get_stats(pwr_mgmt_stats_t* stats);
+
+#endif /* _PWR_MGMT_H_ */
@@ -0,0 +1,180 @@
+/*
+ * pwr_profile - utility module selecting a performance profile from the power state.  See
+ * pwr_profile.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "pwr_profile.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "power_utilities.h"
+#include "pwr_mgmt.h"
+#include "sdkconfig.h"
+
+
+//
+// Variables
+//
+static const char* TAG = "pwr_profile";
+
+static const pwr_profile_t pwr_profiles[PWR_PROFILE_NUM] = {
+	// name       tail  wb     ns     agc    eq     gui  CPU holds
+	{"full",      0,    true,  true,  true,  true,  0,   PWR_MGMT_HOLD_AUDIO | PWR_MGMT_HOLD_GUI | PWR_MGMT_HOLD_BT_PAIR | PWR_MGMT_HOLD_BENCH},
+	{"balanced",  0,    true,  true,  true,  true,  50,  PWR_MGMT_HOLD_AUDIO | PWR_MGMT_HOLD_BT_PAIR | PWR_MGMT_HOLD_BENCH},
+	{"saver",     32,   false, false, true,  false, 100, PWR_MGMT_HOLD_AUDIO | PWR_MGMT_HOLD_BENCH}
+};
+
+static portMUX_TYPE pwr_profile_mux = portMUX_INITIALIZER_UNLOCKED;
+static pwr_profile_stats_t pwr_profile_stats;
+static int64_t pwr_profile_change_usec;          // Last time the profile changed
+
+// Accumulators for each profile
+static uint32_t pwr_profile_load_sum[PWR_PROFILE_NUM];
+static uint32_t pwr_profile_load_count[PWR_PROFILE_NUM];
+static uint64_t pwr_profile_dsp_cycles[PWR_PROFILE_NUM];
+static uint64_t pwr_profile_dsp_period_cycles[PWR_PROFILE_NUM];
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _pwrProfileSelect(bool usb, int batt_state);
+static void _pwrProfileAccumulate(int64_t now);
+
+
+
+//
+// API
+//
+void pwr_profile_init()
+{
+	memset(&pwr_profile_stats, 0, sizeof(pwr_profile_stats_t));
+	pwr_profile_stats.profile = PWR_PROFILE_FULL;
+	pwr_profile_stats.usb = true;
+	pwr_profile_stats.batt_state = BATT_100;
+	pwr_profile_change_usec = esp_timer_get_time();
+	pwr_mgmt_set_allowed(pwr_profiles[PWR_PROFILE_FULL].cpu_holds);
+}
+
+
+void pwr_profile_set_power(bool usb, int batt_state)
+{
+	int prev, profile;
+	int64_t now = esp_timer_get_time();
+	
+	profile = _pwrProfileSelect(usb, batt_state);
+	
+	portENTER_CRITICAL(&pwr_profile_mux);
+	prev = pwr_profile_stats.profile;
+	pwr_profile_stats.usb = usb;
+	pwr_profile_stats.batt_state = batt_state;
+	if (profile != prev) {
+		_pwrProfileAccumulate(now);
+		pwr_profile_stats.profile = profile;
+		pwr_profile_stats.changes++;
+	}
+	portEXIT_CRITICAL(&pwr_profile_mux);
+	
+	if (profile != prev) {
+		pwr_mgmt_set_allowed(pwr_profiles[profile].cpu_holds);
+		ESP_LOGI(TAG, "%s profile (%s)", pwr_profiles[profile].name, usb ? "USB power" : "battery");
+	}
+}
+
+
+int pwr_profile_get(pwr_profile_t* prof)
+{
+	int profile = pwr_profile_stats.profile;
+	
+	if (prof != NULL) {
+		*prof = pwr_profiles[profile];
+	}
+	return profile;
+}
+
+
+const char* pwr_profile_name(int profile)
+{
+	if ((profile < 0) || (profile >= PWR_PROFILE_NUM)) return "?";
+	return pwr_profiles[profile].name;
+}
+
+
+void pwr_profile_record_load(uint16_t load_ma)
+{
+	portENTER_CRITICAL(&pwr_profile_mux);
+	pwr_profile_load_sum[pwr_profile_stats.profile] += load_ma;
+	pwr_profile_load_count[pwr_profile_stats.profile]++;
+	portEXIT_CRITICAL(&pwr_profile_mux);
+}
+
+
+void pwr_profile_record_dsp(int profile, uint32_t cycles, uint32_t period_cycles)
+{
+	if ((profile < 0) || (profile >= PWR_PROFILE_NUM)) return;
+	
+	portENTER_CRITICAL(&pwr_profile_mux);
+	pwr_profile_dsp_cycles[profile] += cycles;
+	pwr_profile_dsp_period_cycles[profile] += period_cycles;
+	pwr_profile_stats.use[profile].dsp_frames++;
+	portEXIT_CRITICAL(&pwr_profile_mux);
+}
+
+
+void pwr_profile_get_stats(pwr_profile_stats_t* stats)
+{
+	int i;
+	int64_t now = esp_timer_get_time();
+	
+	portENTER_CRITICAL(&pwr_profile_mux);
+	_pwrProfileAccumulate(now);
+	memcpy(stats, &pwr_profile_stats, sizeof(pwr_profile_stats_t));
+	for (i=0; i<PWR_PROFILE_NUM; i++) {
+		stats->use[i].load_ma = (pwr_profile_load_count[i] == 0) ? 0 : (uint16_t) (pwr_profile_load_sum[i] / pwr_profile_load_count[i]);
+		stats->use[i].dsp_load_pct10 = (pwr_profile_dsp_period_cycles[i] == 0) ? 0 :
+		                               (int) (pwr_profile_dsp_cycles[i] * 1000 / pwr_profile_dsp_period_cycles[i]);
+	}
+	portEXIT_CRITICAL(&pwr_profile_mux);
+}
+
+
+
+//
+// Internal functions
+//
+static int _pwrProfileSelect(bool usb, int batt_state)
+{
+#if (CONFIG_PWR_PROFILE_AUTO == true)
+	if (usb) return PWR_PROFILE_FULL;
+	if ((batt_state == BATT_100) || (batt_state == BATT_75) || (batt_state == BATT_50)) {
+		return PWR_PROFILE_BALANCED;
+	}
+	return PWR_PROFILE_SAVER;
+#else
+	return PWR_PROFILE_FULL;
+#endif
+}
+
+
+// Charge the time since the last change to the current profile - call with pwr_profile_mux held
+static void _pwrProfileAccumulate(int64_t now)
+{
+	pwr_profile_stats.use[pwr_profile_stats.profile].usec += now - pwr_profile_change_usec;
+	pwr_profile_change_usec = now;
+}
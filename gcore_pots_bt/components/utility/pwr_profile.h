@@ -0,0 +1,101 @@
+/*
+ * pwr_profile - utility module selecting a performance profile from the power state so
+ * weeBell uses less power running from its battery.  Each profile sets:
+ *
+ *   - the longest echo canceller tail (the configured or country tail is cut to it)
+ *   - whether wideband (mSBC) calls are processed natively at 16 kHz or converted to and
+ *     from 8 kHz (halving the echo canceller and codec load at the expense of wideband audio)
+ *   - which of the noise suppressor, mic AGC and handset equalizer run
+ *   - the shortest display refresh period
+ *   - the pwr_mgmt reasons allowed to raise the CPU to its maximum frequency (the others
+ *     leave it at the idle frequency)
+ *
+ * gcore_task reports the power state after each battery reading: the FULL profile is used
+ * on USB power, BALANCED on battery and SAVER once the battery is down to 25%.  audio_task
+ * reads the audio settings when it starts a stream so a change during a call takes effect
+ * with the next one and the processing chain never changes under a call.  The display and
+ * CPU settings take effect immediately since they don't touch the audio (audio_task's own
+ * hold on the maximum frequency is allowed in every profile).
+ *
+ * The time spent in each profile, the average load current measured by the battery monitor
+ * while in it and the average cost of the voice frames processed with its audio settings
+ * (as a percentage of the frame period) are kept so the profiles can be compared.  The
+ * FULL profile is kept unless CONFIG_PWR_PROFILE_AUTO is set.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _PWR_PROFILE_H_
+#define _PWR_PROFILE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+
+//
+// Constants
+//
+
+// Profiles
+#define PWR_PROFILE_FULL         0        // USB power
+#define PWR_PROFILE_BALANCED     1        // Battery
+#define PWR_PROFILE_SAVER        2        // Battery at 25% or less
+#define PWR_PROFILE_NUM          3
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const char* name;
+	int lec_max_msec;                     // Longest echo canceller tail (0 for no limit)
+	bool wideband;                        // Process mSBC calls at 16 kHz
+	bool ns;                              // Noise suppressor allowed (at the configured level)
+	bool agc;                             // Mic AGC allowed
+	bool eq;                              // Handset equalizer allowed (at the configured profile)
+	int gui_frame_msec;                   // Shortest display refresh period (0 for no limit)
+	uint32_t cpu_holds;                   // PWR_MGMT_HOLD_x allowed to raise the CPU frequency
+} pwr_profile_t;
+
+typedef struct {
+	uint64_t usec;                        // Time in the profile
+	uint16_t load_ma;                     // Average load current (0 if unmeasured)
+	uint32_t dsp_frames;                  // Voice frames processed with its audio settings
+	int dsp_load_pct10;                   // Their average cost (tenths of a percent of the frame period)
+} pwr_profile_use_t;
+
+typedef struct {
+	int profile;                          // PWR_PROFILE_* in use
+	bool usb;                             // Power state last reported
+	int batt_state;                       // enum BATT_STATE_t
+	uint32_t changes;
+	pwr_profile_use_t use[PWR_PROFILE_NUM];
+} pwr_profile_stats_t;
+
+
+
+//
+// API
+//
+void pwr_profile_init();                            // After pwr_mgmt_init
+void pwr_profile_set_power(bool usb, int batt_state);   // From the battery monitor
+int pwr_profile_get(pwr_profile_t* prof);           // Returns PWR_PROFILE_*, prof may be NULL
+const char* pwr_profile_name(int profile);
+void pwr_profile_record_load(uint16_t load_ma);     // From the battery monitor
+void pwr_profile_record_dsp(int profile, uint32_t cycles, uint32_t period_cycles);  // From audio_task per voice frame
+void pwr_profile_get_stats(pwr_profile_stats_t* stats);
+
+#endif /* _PWR_PROFILE_H_ */
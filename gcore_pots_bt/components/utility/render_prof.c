@@ -0,0 +1,289 @@
+/*
+ * render_prof - utility module showing where LVGL spends its time redrawing the display.
+ * See render_prof.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "render_prof.h"
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+
+//
+// Variables
+//
+static portMUX_TYPE render_prof_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static render_prof_stats_t render_prof_stats;
+
+static const void* render_prof_keys[RENDER_PROF_MAX_TYPES];
+
+// Bin limits are read by the SPI ISR so they must not be in flash
+static DRAM_ATTR const uint32_t render_prof_bin_usec[RENDER_PROF_NUM_BINS - 1] = RENDER_PROF_BIN_USEC;
+static const uint32_t render_prof_bin_px[RENDER_PROF_NUM_BINS - 1] = RENDER_PROF_BIN_PX;
+
+// Start times of the stages in progress (all but the flush only used by gui_task)
+static int64_t render_prof_area_usec;
+static int16_t render_prof_area[4];
+static int64_t render_prof_obj_usec;
+static int64_t render_prof_blend_usec;
+static int64_t render_prof_wait_usec;
+static int64_t render_prof_flush_usec;
+static bool render_prof_spi_pending = false;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int IRAM_ATTR _renderProfBin(uint32_t v, const uint32_t* limits);
+
+
+
+//
+// API
+//
+void render_prof_area_start(int x1, int y1, int x2, int y2)
+{
+	render_prof_area[0] = x1;
+	render_prof_area[1] = y1;
+	render_prof_area[2] = x2;
+	render_prof_area[3] = y2;
+	render_prof_area_usec = esp_timer_get_time();
+}
+
+
+void render_prof_area_end()
+{
+	render_prof_stats_t* s = &render_prof_stats;
+	uint32_t t = (uint32_t) (esp_timer_get_time() - render_prof_area_usec);
+	uint32_t px = (render_prof_area[2] - render_prof_area[0] + 1) * (render_prof_area[3] - render_prof_area[1] + 1);
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	s->areas += 1;
+	s->area_px += px;
+	s->area_usec += t;
+	s->area_px_hist[_renderProfBin(px, render_prof_bin_px)] += 1;
+	s->area_usec_hist[_renderProfBin(t, render_prof_bin_usec)] += 1;
+	if (t > s->max_area_usec) {
+		s->max_area_usec = t;
+		memcpy(s->max_area, render_prof_area, sizeof(s->max_area));
+	}
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void render_prof_obj_start()
+{
+	render_prof_obj_usec = esp_timer_get_time();
+}
+
+
+bool render_prof_obj_end(const void* key)
+{
+	static int last = 0;              // Consecutive draws are often of the same type
+	render_prof_stats_t* s = &render_prof_stats;
+	render_prof_type_t* e;
+	uint32_t t = (uint32_t) (esp_timer_get_time() - render_prof_obj_usec);
+	bool unnamed;
+	int i;
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	if ((last >= s->num_types) || (render_prof_keys[last] != key)) {
+		for (i=0; i<s->num_types; i++) {
+			if (render_prof_keys[i] == key) break;
+		}
+		if (i == s->num_types) {
+			if (i == RENDER_PROF_MAX_TYPES) {
+				s->untracked_draws += 1;
+				portEXIT_CRITICAL(&render_prof_mux);
+				return false;
+			}
+			render_prof_keys[i] = key;
+			s->type[i].name = NULL;
+			s->num_types += 1;
+		}
+		last = i;
+	}
+	
+	e = &s->type[last];
+	e->draws += 1;
+	e->total_usec += t;
+	if (t > e->max_usec) e->max_usec = t;
+	unnamed = (e->name == NULL);
+	portEXIT_CRITICAL(&render_prof_mux);
+	
+	return unnamed;
+}
+
+
+void render_prof_obj_name(const void* key, const char* name)
+{
+	int i;
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	for (i=0; i<render_prof_stats.num_types; i++) {
+		if (render_prof_keys[i] == key) {
+			render_prof_stats.type[i].name = name;
+			break;
+		}
+	}
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void render_prof_blend_start()
+{
+	render_prof_blend_usec = esp_timer_get_time();
+}
+
+
+void render_prof_blend_end(int kind, uint32_t px)
+{
+	uint32_t t = (uint32_t) (esp_timer_get_time() - render_prof_blend_usec);
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	render_prof_stats.blends[kind] += 1;
+	render_prof_stats.blend_usec[kind] += t;
+	render_prof_stats.blend_px[kind] += px;
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void render_prof_wait_start()
+{
+	render_prof_wait_usec = esp_timer_get_time();
+}
+
+
+void render_prof_wait_end()
+{
+	uint32_t t = (uint32_t) (esp_timer_get_time() - render_prof_wait_usec);
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	render_prof_stats.wait_usec += t;
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void render_prof_flush_start()
+{
+	int64_t now = esp_timer_get_time();
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	render_prof_flush_usec = now;
+	render_prof_spi_pending = true;
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void render_prof_flush_end()
+{
+	uint32_t t;
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	t = (uint32_t) (esp_timer_get_time() - render_prof_flush_usec);
+	render_prof_stats.flushes += 1;
+	render_prof_stats.flush_cpu_usec += t;
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void render_prof_flush_skipped()
+{
+	portENTER_CRITICAL(&render_prof_mux);
+	render_prof_stats.skipped_flushes += 1;
+	render_prof_spi_pending = false;
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void IRAM_ATTR render_prof_spi_done()
+{
+	render_prof_stats_t* s = &render_prof_stats;
+	uint32_t t;
+	
+	portENTER_CRITICAL_ISR(&render_prof_mux);
+	if (render_prof_spi_pending) {
+		render_prof_spi_pending = false;
+		t = (uint32_t) (esp_timer_get_time() - render_prof_flush_usec);
+		s->spi_usec += t;
+		s->spi_usec_hist[_renderProfBin(t, render_prof_bin_usec)] += 1;
+		if (t > s->max_spi_usec) s->max_spi_usec = t;
+	}
+	portEXIT_CRITICAL_ISR(&render_prof_mux);
+}
+
+
+void render_prof_get_stats(render_prof_stats_t* stats)
+{
+	portENTER_CRITICAL(&render_prof_mux);
+	memcpy(stats, &render_prof_stats, sizeof(render_prof_stats_t));
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+void render_prof_reset_stats()
+{
+	render_prof_stats_t* s = &render_prof_stats;
+	int i;
+	
+	portENTER_CRITICAL(&render_prof_mux);
+	s->areas = 0;
+	s->area_px = 0;
+	s->area_usec = 0;
+	memset(s->area_px_hist, 0, sizeof(s->area_px_hist));
+	memset(s->area_usec_hist, 0, sizeof(s->area_usec_hist));
+	s->max_area_usec = 0;
+	memset(s->max_area, 0, sizeof(s->max_area));
+	for (i=0; i<s->num_types; i++) {
+		s->type[i].draws = 0;
+		s->type[i].total_usec = 0;
+		s->type[i].max_usec = 0;
+	}
+	s->untracked_draws = 0;
+	memset(s->blends, 0, sizeof(s->blends));
+	memset(s->blend_usec, 0, sizeof(s->blend_usec));
+	memset(s->blend_px, 0, sizeof(s->blend_px));
+	s->flushes = 0;
+	s->skipped_flushes = 0;
+	s->flush_cpu_usec = 0;
+	s->spi_usec = 0;
+	memset(s->spi_usec_hist, 0, sizeof(s->spi_usec_hist));
+	s->max_spi_usec = 0;
+	s->wait_usec = 0;
+	portEXIT_CRITICAL(&render_prof_mux);
+}
+
+
+
+//
+// Internal functions
+//
+static int IRAM_ATTR _renderProfBin(uint32_t v, const uint32_t* limits)
+{
+	int i;
+	
+	for (i=0; i<(RENDER_PROF_NUM_BINS - 1); i++) {
+		if (v <= limits[i]) return i;
+	}
+	return RENDER_PROF_NUM_BINS - 1;
+}
+
+#endif /* CONFIG_RENDER_PROF_ENABLE */
@@ -0,0 +1,151 @@
+/*
+ * render_prof - utility module showing where LVGL spends its time redrawing the display so
+ * it is clear which widget or stage to optimize.  Hooks in LVGL's refresh (lv_refr.c), its
+ * blender (lv_draw_blend.c), gui_task's flush callback and the display SPI driver record:
+ *
+ *   - each invalidated area LVGL redraws: its size and the time from starting to draw it
+ *     until its last part is handed to the flush (including any wait for the previous flush)
+ *   - the time spent in the design (draw) callback of each type of object, not counting its
+ *     children.  Types are told apart by their design callback and named after the first
+ *     object seen using it.
+ *   - the time and pixels blended into the draw buffer by fills and image/text maps
+ *   - for each flush (area part): the time in the flush callback (diff and queueing), the
+ *     SPI transfer time from the flush starting until the last pixel is sent, flushes the
+ *     display diff found nothing to send for, and time LVGL sat waiting for a flush to end
+ *
+ * Area and transfer times are also kept as histograms.  The "render" console command shows
+ * them.  The hooks are compiled out unless CONFIG_RENDER_PROF_ENABLE is set.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _RENDER_PROF_H_
+#define _RENDER_PROF_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Object types tracked (draws of further types are counted as untracked)
+#define RENDER_PROF_MAX_TYPES    16
+
+// Histogram bin upper limits, the last bin holds the rest
+#define RENDER_PROF_NUM_BINS     8
+#define RENDER_PROF_BIN_USEC     {250, 500, 1000, 2000, 5000, 10000, 20000}
+#define RENDER_PROF_BIN_PX       {256, 1024, 4096, 8192, 16384, 38400, 76800}
+
+// Blend kinds
+#define RENDER_PROF_BLEND_FILL   0
+#define RENDER_PROF_BLEND_MAP    1
+#define RENDER_PROF_NUM_BLENDS   2
+
+
+
+//
+// Hook macros (compiled out when the profiler is disabled)
+//
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+#define RENDER_PROF_AREA_START(x1, y1, x2, y2) render_prof_area_start(x1, y1, x2, y2)
+#define RENDER_PROF_AREA_END()                 render_prof_area_end()
+#define RENDER_PROF_OBJ_START()                render_prof_obj_start()
+#define RENDER_PROF_BLEND_START()              render_prof_blend_start()
+#define RENDER_PROF_BLEND_END(kind, px)        render_prof_blend_end(kind, px)
+#define RENDER_PROF_WAIT_START()               render_prof_wait_start()
+#define RENDER_PROF_WAIT_END()                 render_prof_wait_end()
+#define RENDER_PROF_FLUSH_START()              render_prof_flush_start()
+#define RENDER_PROF_FLUSH_END()                render_prof_flush_end()
+#define RENDER_PROF_FLUSH_SKIPPED()            render_prof_flush_skipped()
+#define RENDER_PROF_SPI_DONE()                 render_prof_spi_done()
+#else
+#define RENDER_PROF_AREA_START(x1, y1, x2, y2)
+#define RENDER_PROF_AREA_END()
+#define RENDER_PROF_OBJ_START()
+#define RENDER_PROF_BLEND_START()
+#define RENDER_PROF_BLEND_END(kind, px)
+#define RENDER_PROF_WAIT_START()
+#define RENDER_PROF_WAIT_END()
+#define RENDER_PROF_FLUSH_START()
+#define RENDER_PROF_FLUSH_END()
+#define RENDER_PROF_FLUSH_SKIPPED()
+#define RENDER_PROF_SPI_DONE()
+#endif
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const char* name;                     // NULL until named
+	uint32_t draws;                       // Design callback calls
+	uint64_t total_usec;                  // Not counting children
+	uint32_t max_usec;
+} render_prof_type_t;
+
+typedef struct {
+	uint32_t areas;
+	uint64_t area_px;
+	uint64_t area_usec;
+	uint32_t area_px_hist[RENDER_PROF_NUM_BINS];
+	uint32_t area_usec_hist[RENDER_PROF_NUM_BINS];
+	uint32_t max_area_usec;
+	int16_t max_area[4];                  // x1, y1, x2, y2 of the slowest area
+	int num_types;
+	render_prof_type_t type[RENDER_PROF_MAX_TYPES];
+	uint32_t untracked_draws;
+	uint32_t blends[RENDER_PROF_NUM_BLENDS];
+	uint64_t blend_usec[RENDER_PROF_NUM_BLENDS];
+	uint64_t blend_px[RENDER_PROF_NUM_BLENDS];
+	uint32_t flushes;
+	uint32_t skipped_flushes;             // Nothing differed so nothing was sent
+	uint64_t flush_cpu_usec;              // In the flush callback
+	uint64_t spi_usec;
+	uint32_t spi_usec_hist[RENDER_PROF_NUM_BINS];
+	uint32_t max_spi_usec;
+	uint64_t wait_usec;                   // LVGL waiting for the previous flush to end
+} render_prof_stats_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_RENDER_PROF_ENABLE == true)
+// Hooks (use the macros above)
+void render_prof_area_start(int x1, int y1, int x2, int y2);
+void render_prof_area_end();
+void render_prof_obj_start();
+bool render_prof_obj_end(const void* key);        // True if the type is unnamed
+void render_prof_obj_name(const void* key, const char* name);
+void render_prof_blend_start();
+void render_prof_blend_end(int kind, uint32_t px);
+void render_prof_wait_start();
+void render_prof_wait_end();
+void render_prof_flush_start();
+void render_prof_flush_end();
+void render_prof_flush_skipped();
+void render_prof_spi_done();                      // From the SPI ISR (in IRAM)
+
+void render_prof_get_stats(render_prof_stats_t* stats);
+void render_prof_reset_stats();                   // Keeps the types seen
+#endif
+
+#endif /* _RENDER_PROF_H_ */
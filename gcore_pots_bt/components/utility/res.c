@@ -0,0 +1,238 @@
+/*
+ * res - utility module implementing a residual echo suppressor and comfort noise generator
+ * run on the echo canceller output in place of its non-linear processor.
+ *
+ * All level tracking and gain computation happens once per block.  Per sample there is
+ * only the band split of the far end and residual, their power sums and the gain and
+ * comfort noise multiply-accumulates (ramped across the block so there's no zipper noise).
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "res.h"
+#include <math.h>
+#include <string.h>
+
+
+//
+// Constants
+//
+
+// Band split frequency
+#define RES_SPLIT_HZ       1000.0f
+
+// Comfort noise table RMS level (so the noise peaks fit int16_t) and the shift that scales
+// a table entry times a Q4 level back to samples.  Level (RMS) is limited so the products
+// fit in 32 bits.
+#define RES_NOISE_RMS      8192.0f
+#define RES_CN_SHIFT       17
+#define RES_MAX_CN         1800.0f
+
+// Echo tail the far end envelope is held over
+#define RES_TAIL_MSEC      64.0f
+
+// Rise rates for the minimum tracking noise and coupling estimates
+#define RES_NOISE_RISE_DB_SEC     3.0f
+#define RES_COUPLING_RISE_DB_SEC  1.5f
+
+// The estimate is over-subtracted by this much, and the gain is never below RES_MIN_GAIN
+#define RES_OVER_SUB       2.0f
+#define RES_MIN_GAIN       0.03f     // About -30 dB
+
+// Gain release (attack is immediate)
+#define RES_RELEASE        0.3f
+
+// Far end power below this (about -55 dBm0) isn't enough to echo
+#define RES_TX_MIN_POWER   10.0f
+
+// Initial coupling (-30 dB, a typical echo canceller residual) and noise estimates
+#define RES_INIT_COUPLING  0.001f
+#define RES_INIT_NOISE     4.0f
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _res_set_rates(res_state_t* s, int len);
+static void _res_update_band(res_state_t* s, int b, float p_tx, float p_e);
+
+
+
+//
+// API
+//
+void res_init(res_state_t* s, int sample_rate)
+{
+	int b, i;
+	int32_t x;
+	int32_t lp = 0;
+	float sum[RES_BANDS] = {0};
+	float scale;
+
+	memset(s, 0, sizeof(res_state_t));
+	s->sample_rate = sample_rate;
+	s->lp_coef = (int32_t) (32768.0f * (1.0f - expf(-2.0f * (float) M_PI * RES_SPLIT_HZ / sample_rate)));
+	for (b=0; b<RES_BANDS; b++) {
+		s->coupling[b] = RES_INIT_COUPLING;
+		s->noise[b] = RES_INIT_NOISE;
+		s->gain[b] = 1.0f;
+		s->g_q15[b] = 32767;
+	}
+
+	// White noise split into the same bands as the residual, each scaled to RES_NOISE_RMS
+	// so the comfort noise spectrum follows the measured background in each band
+	s->rnd = 0x1234567;
+	for (i=0; i<RES_NOISE_LEN; i++) {
+		s->rnd = 1664525U * s->rnd + 1013904223U;
+		x = ((int32_t) (s->rnd >> 16) & 0xFFFF) - 32768;
+		lp += ((x * 256 - lp) >> 8) * s->lp_coef >> 7;
+		s->noise_tbl[0][i] = (int16_t) (lp >> 8);
+		s->noise_tbl[1][i] = (int16_t) ((x - (lp >> 8)) / 2);
+		sum[0] += (float) s->noise_tbl[0][i] * s->noise_tbl[0][i];
+		sum[1] += (float) s->noise_tbl[1][i] * s->noise_tbl[1][i];
+	}
+	for (b=0; b<RES_BANDS; b++) {
+		scale = (sum[b] > 0.0f) ? RES_NOISE_RMS / sqrtf(sum[b] / RES_NOISE_LEN) : 0.0f;
+		for (i=0; i<RES_NOISE_LEN; i++) {
+			x = (int32_t) (s->noise_tbl[b][i] * scale);
+			if (x > INT16_MAX) x = INT16_MAX;
+			if (x < INT16_MIN) x = INT16_MIN;
+			s->noise_tbl[b][i] = (int16_t) x;
+		}
+	}
+}
+
+
+void res_process(res_state_t* s, const int16_t* tx, int16_t* out, int len)
+{
+	int b, i, n;
+	int32_t t, e, t_lo, t_hi, e_lo, e_hi, y;
+	int32_t g[RES_BANDS], dg[RES_BANDS], cn[RES_BANDS], dcn[RES_BANDS];
+	float p_tx[RES_BANDS] = {0};
+	float p_e[RES_BANDS] = {0};
+
+	if (len <= 0) return;
+	if (len != s->block_len) _res_set_rates(s, len);
+
+	// Ramp from where the last block ended to the values computed at its end
+	for (b=0; b<RES_BANDS; b++) {
+		g[b] = s->g_q15[b];
+		dg[b] = ((int32_t) (s->gain[b] * 32767.0f) - g[b]) / len;
+		cn[b] = s->cn_q4[b];
+		dcn[b] = (s->cn_target_q4[b] - cn[b]) / len;
+	}
+
+	// Random start into the noise tables
+	s->rnd = 1664525U * s->rnd + 1013904223U;
+	n = (s->rnd >> 16) & (RES_NOISE_LEN - 1);
+
+	for (i=0; i<len; i++) {
+		// Band split
+		t = tx[i];
+		e = out[i];
+		s->tx_lp += ((t * 256 - s->tx_lp) >> 8) * s->lp_coef >> 7;
+		s->e_lp += ((e * 256 - s->e_lp) >> 8) * s->lp_coef >> 7;
+		t_lo = s->tx_lp >> 8;
+		t_hi = t - t_lo;
+		e_lo = s->e_lp >> 8;
+		e_hi = e - e_lo;
+		p_tx[0] += (float) (t_lo * t_lo);
+		p_tx[1] += (float) (t_hi * t_hi);
+		p_e[0] += (float) (e_lo * e_lo);
+		p_e[1] += (float) (e_hi * e_hi);
+
+		// Suppressed residual plus comfort noise
+		y = ((e_lo * g[0]) >> 15) + ((e_hi * g[1]) >> 15);
+		y += (s->noise_tbl[0][n] * cn[0] + s->noise_tbl[1][n] * cn[1]) >> RES_CN_SHIFT;
+		n = (n + 1) & (RES_NOISE_LEN - 1);
+		if (y > INT16_MAX) y = INT16_MAX;
+		if (y < INT16_MIN) y = INT16_MIN;
+		out[i] = (int16_t) y;
+
+		g[0] += dg[0];
+		g[1] += dg[1];
+		cn[0] += dcn[0];
+		cn[1] += dcn[1];
+	}
+
+	// Gains for the next block
+	for (b=0; b<RES_BANDS; b++) {
+		s->g_q15[b] = (int32_t) (s->gain[b] * 32767.0f);
+		s->cn_q4[b] = s->cn_target_q4[b];
+		_res_update_band(s, b, p_tx[b] / len, p_e[b] / len);
+	}
+}
+
+
+
+//
+// Internal functions
+//
+static void _res_set_rates(res_state_t* s, int len)
+{
+	float blocks_per_sec = (float) s->sample_rate / len;
+
+	s->block_len = len;
+	s->env_decay = expf(-1000.0f / (RES_TAIL_MSEC * blocks_per_sec));
+	s->noise_rise = powf(10.0f, RES_NOISE_RISE_DB_SEC / (10.0f * blocks_per_sec));
+	s->coupling_rise = powf(10.0f, RES_COUPLING_RISE_DB_SEC / (10.0f * blocks_per_sec));
+}
+
+
+static void _res_update_band(res_state_t* s, int b, float p_tx, float p_e)
+{
+	float a, echo, g, ratio;
+
+	// Far end envelope held over the echo tail
+	s->tx_env[b] *= s->env_decay;
+	if (p_tx > s->tx_env[b]) s->tx_env[b] = p_tx;
+
+	// The residual echo coupling is the smallest residual to far end ratio seen while the
+	// far end is active (near end speech only makes it bigger so it rises slowly)
+	if (s->tx_env[b] > RES_TX_MIN_POWER) {
+		ratio = p_e / s->tx_env[b];
+		if (ratio < s->coupling[b]) {
+			s->coupling[b] = 0.5f * (s->coupling[b] + ratio);
+		} else {
+			s->coupling[b] *= s->coupling_rise;
+			if (s->coupling[b] > 1.0f) s->coupling[b] = 1.0f;
+		}
+	}
+
+	// Background noise by minimum tracking
+	if (p_e < s->noise[b]) {
+		s->noise[b] = 0.7f * s->noise[b] + 0.3f * p_e;
+	} else {
+		s->noise[b] *= s->noise_rise;
+	}
+	if (s->noise[b] < 1.0f) s->noise[b] = 1.0f;
+
+	// Suppression gain (immediate attack, smoothed release)
+	echo = RES_OVER_SUB * s->coupling[b] * s->tx_env[b];
+	g = 1.0f - echo / (p_e + 1.0f);
+	if (g < RES_MIN_GAIN) g = RES_MIN_GAIN;
+	if (g < s->gain[b]) {
+		s->gain[b] = g;
+	} else {
+		s->gain[b] += RES_RELEASE * (g - s->gain[b]);
+	}
+
+	// Comfort noise fills in the background removed with the residual
+	g = s->gain[b];
+	a = sqrtf(s->noise[b] * (1.0f - g * g));
+	if (a > RES_MAX_CN) a = RES_MAX_CN;
+	s->cn_target_q4[b] = (int32_t) (a * 16.0f);
+}
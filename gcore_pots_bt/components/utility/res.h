@@ -0,0 +1,74 @@
+/*
+ * res - utility module implementing a residual echo suppressor and comfort noise generator
+ * run on the echo canceller output in place of its non-linear processor.  The residual is
+ * split into a low and high band, each attenuated by a gain computed once per block from the
+ * estimated residual echo and filled with band-limited comfort noise from a precomputed
+ * table at the measured background level instead of being hard gated.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _RES_H_
+#define _RES_H_
+
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Bands (low and high split by a one-pole filter at about 1 kHz)
+#define RES_BANDS     2
+
+// Comfort noise table length for each band (must be a power of 2).  A random start each
+// block hides the repetition.
+#define RES_NOISE_LEN 512
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int sample_rate;
+	int block_len;                        // Block length the per block rates were computed for
+	int32_t lp_coef;                      // Band split one-pole coefficient (Q15)
+	int32_t tx_lp;                        // Band split filter states (Q8)
+	int32_t e_lp;
+	float tx_env[RES_BANDS];              // Far end power envelope (decays over the echo tail)
+	float coupling[RES_BANDS];            // Residual echo to far end power ratio
+	float noise[RES_BANDS];               // Background noise power of the residual
+	float gain[RES_BANDS];                // Suppression gain for the next block
+	float env_decay;                      // Per block tx_env decay
+	float noise_rise;                     // Per block noise and coupling rise rates
+	float coupling_rise;
+	int32_t g_q15[RES_BANDS];             // Gain and comfort noise level (Q4) reached at the
+	int32_t cn_q4[RES_BANDS];             //   end of the last block
+	int32_t cn_target_q4[RES_BANDS];      // Comfort noise level for the next block
+	uint32_t rnd;
+	int16_t noise_tbl[RES_BANDS][RES_NOISE_LEN];  // Band-limited noise at a fixed RMS level
+} res_state_t;
+
+
+
+//
+// API
+//
+void res_init(res_state_t* s, int sample_rate);
+void res_process(res_state_t* s, const int16_t* tx, int16_t* out, int len);  // out is the echo canceller output, modified in place
+
+#endif /* _RES_H_ */
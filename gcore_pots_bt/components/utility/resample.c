@@ -0,0 +1,190 @@
+/*
+ * resample - utility module implementing block-based 2:1 decimation and 1:2
+ * interpolation between the 8 kHz codec rate and the 16 kHz mSBC rate using
+ * polyphase half-band FIR filters.
+ *
+ * A half-band filter has every even tap (other than the center) equal to zero
+ * and a center tap of 1/2.  The decimator therefore only evaluates the odd taps
+ * plus the center tap for every second input sample, and the interpolator passes
+ * the original samples through unchanged and only computes the odd-phase output.
+ * Filter history is kept in a doubled buffer (each sample written twice) so the
+ * filter window is always contiguous and no per-sample shifting is required.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "resample.h"
+#include <string.h>
+
+
+//
+// Constants
+//
+
+// Half-band odd-tap coefficients in Q14.  Each set sums to 8192 (0.5) so the
+// interpolator odd phase has unity DC gain.  The medium and high sets are Kaiser
+// windowed sinc designs (beta 5 and 7).  The low set matches the coefficients
+// of the original 6-tap upsample filter.
+static const int16_t coef_low[3] = {
+	9600, -1600, 192
+};
+
+static const int16_t coef_med[6] = {
+	10283, -3022, 1395, -653, 268, -79
+};
+
+static const int16_t coef_high[12] = {
+	10373, -3305, 1810, -1125, 724, -463, 288, -171, 94, -47, 20, -6
+};
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _resample_set_quality(resample_state_t* s, int quality);
+static __inline__ const int16_t* _resample_push(resample_state_t* s, int16_t x);
+static __inline__ int16_t _resample_sat(int32_t t);
+
+
+
+//
+// API
+//
+
+// Configure a state for 2:1 decimation (16 kHz -> 8 kHz)
+void resample_init_down2(resample_state_t* s, int quality)
+{
+	_resample_set_quality(s, quality);
+	s->hist_len = 4*s->num_coef - 1;
+	resample_reset(s);
+}
+
+
+// Configure a state for 1:2 interpolation (8 kHz -> 16 kHz)
+void resample_init_up2(resample_state_t* s, int quality)
+{
+	_resample_set_quality(s, quality);
+	s->hist_len = 2*s->num_coef;
+	resample_reset(s);
+}
+
+
+// Clear filter history (e.g. at the start of a new audio stream)
+void resample_reset(resample_state_t* s)
+{
+	memset(s->hist, 0, sizeof(s->hist));
+	s->pos = 0;
+	s->phase = 0;
+}
+
+
+// Decimate len input samples, returning the number of output samples written to out.
+// out may be the same buffer as in.  An odd len is handled by carrying the phase
+// into the next call.
+int resample_down2(resample_state_t* s, const int16_t* in, int len, int16_t* out)
+{
+	const int16_t* w;
+	const int16_t* c = s->coef;
+	int center = 2*s->num_coef - 1;
+	int i, k;
+	int n = 0;
+	int32_t t;
+	
+	for (i=0; i<len; i++) {
+		w = _resample_push(s, in[i]);
+		
+		s->phase ^= 1;
+		if (s->phase == 0) {
+			// Center tap is 0.5 (16384 in Q15), odd taps are the Q14 coefficients (half
+			// in Q15) so the result is scaled by 2^15
+			t = 16384 * (int32_t) w[center];
+			for (k=0; k<s->num_coef; k++) {
+				t += c[k] * ((int32_t) w[center - 2*k - 1] + (int32_t) w[center + 2*k + 1]);
+			}
+			out[n++] = _resample_sat((t + 16384) >> 15);
+		}
+	}
+	
+	return n;
+}
+
+
+// Interpolate len input samples, writing 2*len output samples to out (in and out must not overlap)
+int resample_up2(resample_state_t* s, const int16_t* in, int len, int16_t* out)
+{
+	const int16_t* w;
+	const int16_t* c = s->coef;
+	int mid = s->num_coef - 1;
+	int i, k;
+	int32_t t;
+	
+	for (i=0; i<len; i++) {
+		w = _resample_push(s, in[i]);
+		
+		// Even phase is the (delayed) original sample
+		*out++ = w[mid];
+		
+		// Odd phase is interpolated from the surrounding original samples
+		t = 0;
+		for (k=0; k<s->num_coef; k++) {
+			t += c[k] * ((int32_t) w[mid - k] + (int32_t) w[mid + k + 1]);
+		}
+		*out++ = _resample_sat((t + 8192) >> 14);
+	}
+	
+	return 2*len;
+}
+
+
+
+//
+// Internal functions
+//
+static void _resample_set_quality(resample_state_t* s, int quality)
+{
+	switch (quality) {
+		case RESAMPLE_QUALITY_LOW:
+			s->coef = coef_low;
+			s->num_coef = sizeof(coef_low) / sizeof(coef_low[0]);
+			break;
+		case RESAMPLE_QUALITY_HIGH:
+			s->coef = coef_high;
+			s->num_coef = sizeof(coef_high) / sizeof(coef_high[0]);
+			break;
+		default:
+			s->coef = coef_med;
+			s->num_coef = sizeof(coef_med) / sizeof(coef_med[0]);
+	}
+}
+
+
+// Add a sample to the history, returning a pointer to the contiguous window (oldest first)
+static __inline__ const int16_t* _resample_push(resample_state_t* s, int16_t x)
+{
+	s->hist[s->pos] = x;
+	s->hist[s->pos + s->hist_len] = x;
+	if (++s->pos == s->hist_len) s->pos = 0;
+	
+	return &s->hist[s->pos];
+}
+
+
+static __inline__ int16_t _resample_sat(int32_t t)
+{
+	if (t > 32767) return 32767;
+	if (t < -32768) return -32768;
+	return (int16_t) t;
+}
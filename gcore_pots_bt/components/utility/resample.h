@@ -0,0 +1,71 @@
+/*
+ * resample - utility module implementing block-based 2:1 decimation and 1:2
+ * interpolation between the 8 kHz codec rate and the 16 kHz mSBC rate using
+ * polyphase half-band FIR filters.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _RESAMPLE_H_
+#define _RESAMPLE_H_
+
+#include <stdint.h>
+
+
+
+//
+// Constants
+//
+
+// Quality levels (trade filter length for CPU load)
+//   LOW    - 3 coefficient (11-tap) filter, same response as the original upsample filter
+//   MEDIUM - 6 coefficient (23-tap) filter, ~60 dB stopband above 4.8 kHz
+//   HIGH   - 12 coefficient (47-tap) filter, ~70 dB stopband above 4.6 kHz, flat to 3.5 kHz
+#define RESAMPLE_QUALITY_LOW    0
+#define RESAMPLE_QUALITY_MEDIUM 1
+#define RESAMPLE_QUALITY_HIGH   2
+
+// Maximum number of coefficients on one side of the half-band filter
+#define RESAMPLE_MAX_COEF       12
+
+// Maximum history length (decimator needs the full 4*N-1 tap window)
+#define RESAMPLE_MAX_HIST       (4*RESAMPLE_MAX_COEF - 1)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const int16_t* coef;                  // Odd-tap coefficients (Q14), one side of the symmetric filter
+	int num_coef;                         // Number of coefficients in coef
+	int hist_len;                         // Length of the filter window in input samples
+	int pos;                              // Oldest sample index in the doubled history buffer
+	int phase;                            // Decimator: 1 when an output is due after the next input
+	int16_t hist[2*RESAMPLE_MAX_HIST];    // Doubled history so the window is always contiguous
+} resample_state_t;
+
+
+
+//
+// API
+//
+void resample_init_down2(resample_state_t* s, int quality);
+void resample_init_up2(resample_state_t* s, int quality);
+void resample_reset(resample_state_t* s);
+int resample_down2(resample_state_t* s, const int16_t* in, int len, int16_t* out);
+int resample_up2(resample_state_t* s, const int16_t* in, int len, int16_t* out);
+
+#endif /* _RESAMPLE_H_ */
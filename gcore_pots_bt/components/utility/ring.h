@@ -0,0 +1,311 @@
+/*
+ * ring - header-only single-producer/single-consumer lock-free ring buffer specialized
+ * at compile time for an element type and power-of-two length.
+ *
+ *   RING_DEFINE(name, type, size, policy)
+ *
+ * declares name_t and a set of static inline name_* functions.  The head is only written
+ * by the producer and the tail only by the consumer.  Both indices are free-running and
+ * masked on access (count = head - tail) so all of the buffer is usable.  Bulk copies are
+ * done with at most two memcpy calls around the end of the buffer and the span functions
+ * give direct access to the contiguous free or used region for callers that fill or
+ * process elements in place.
+ *
+ * The policy sets what a write does when the ring is full.  RING_DROP_NEW stores what fits
+ * and drops the rest.  RING_OVERWRITE discards the oldest elements to make room, which moves
+ * the tail, so it may only be used when the producer and consumer are the same task.  Both
+ * count the dropped elements in overruns.  A side that doesn't own the tail can ask the
+ * consumer to discard everything with name_request_flush.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _RING_H_
+#define _RING_H_
+
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+
+
+//
+// Constants
+//
+
+// Full ring policies
+#define RING_DROP_NEW    0
+#define RING_OVERWRITE   1
+
+
+
+//
+// API
+//
+//   Any side:
+//     void name_init(name_t* r)                            Empty (only before either side uses it)
+//     int name_count(name_t* r)                            Elements stored (0 while a flush is pending)
+//     void name_request_flush(name_t* r)                   Ask the consumer to discard everything
+//     unsigned int name_high_water(name_t* r)              Most elements stored after a write
+//     void name_reset_high_water(name_t* r)
+//
+//   Producer:
+//     int name_space(name_t* r)                            Free elements
+//     int name_write(name_t* r, const type* src, int len)  Returns the number stored
+//     int name_fill(name_t* r, type v, int len)            Store len copies of v
+//     int name_write_span(name_t* r, type** p)             Contiguous free elements at *p
+//     void name_commit(name_t* r, int len)                 Publish len elements written at the span
+//     unsigned int name_position(name_t* r)                Position after the last element written
+//
+//   Consumer:
+//     int name_read(name_t* r, type* dst, int len)         Returns the number read
+//     int name_peek(name_t* r, type* dst, int offset, int len)  Copy without consuming
+//     int name_read_span(name_t* r, type** p)              Contiguous stored elements at *p
+//     void name_skip(name_t* r, int len)                   Consume len elements (at most count)
+//     void name_discard(name_t* r)                         Consume everything
+//     void name_skip_to(name_t* r, unsigned int pos)       Consume the elements before a position from
+//                                                          name_position (none if already consumed)
+//
+//   Producer and consumer in the same task only:
+//     void name_unread(name_t* r, int len)                 Deliver the last len consumed elements
+//                                                          again (they must not have been overwritten)
+//
+#define RING_DEFINE(name, type, size, policy) \
+	\
+_Static_assert((((size) & ((size) - 1)) == 0) && ((size) > 0), #name " length must be a power of two"); \
+	\
+typedef struct { \
+	type buf[size]; \
+	atomic_uint head; \
+	atomic_uint tail; \
+	atomic_bool flush_req; \
+	unsigned int high_water; \
+	uint32_t overruns; \
+} name##_t; \
+	\
+static inline void name##_init(name##_t* r) \
+{ \
+	atomic_store_explicit(&r->head, 0, memory_order_relaxed); \
+	atomic_store_explicit(&r->tail, 0, memory_order_relaxed); \
+	atomic_store_explicit(&r->flush_req, false, memory_order_release); \
+	r->high_water = 0; \
+	r->overruns = 0; \
+} \
+	\
+static inline int name##_count(name##_t* r) \
+{ \
+	unsigned int tail; \
+	\
+	if (atomic_load_explicit(&r->flush_req, memory_order_relaxed)) { \
+		return 0; \
+	} \
+	tail = atomic_load_explicit(&r->tail, memory_order_acquire); \
+	return (int) (atomic_load_explicit(&r->head, memory_order_acquire) - tail); \
+} \
+	\
+static inline void name##_request_flush(name##_t* r) \
+{ \
+	atomic_store_explicit(&r->flush_req, true, memory_order_release); \
+} \
+	\
+static inline unsigned int name##_high_water(name##_t* r) \
+{ \
+	return r->high_water; \
+} \
+	\
+static inline void name##_reset_high_water(name##_t* r) \
+{ \
+	r->high_water = 0; \
+} \
+	\
+static inline void name##_discard(name##_t* r) \
+{ \
+	atomic_store_explicit(&r->flush_req, false, memory_order_relaxed); \
+	atomic_store_explicit(&r->tail, atomic_load_explicit(&r->head, memory_order_acquire), memory_order_release); \
+} \
+	\
+static inline int name##_space(name##_t* r) \
+{ \
+	unsigned int head = atomic_load_explicit(&r->head, memory_order_relaxed); \
+	\
+	return (int) ((size) - (head - atomic_load_explicit(&r->tail, memory_order_acquire))); \
+} \
+	\
+/* Limit a write of len elements by the policy, returning the number to store */ \
+static inline int name##_reserve(name##_t* r, int len) \
+{ \
+	unsigned int tail; \
+	int free_len = name##_space(r); \
+	\
+	if (len <= free_len) return len; \
+	if ((policy) == RING_OVERWRITE) { \
+		if (len > (size)) { \
+			r->overruns += len - (size); \
+			len = (size); \
+		} \
+		tail = atomic_load_explicit(&r->tail, memory_order_relaxed); \
+		atomic_store_explicit(&r->tail, tail + (len - free_len), memory_order_relaxed); \
+		r->overruns += len - free_len; \
+		return len; \
+	} \
+	r->overruns += len - free_len; \
+	return free_len; \
+} \
+	\
+static inline void name##_commit(name##_t* r, int len) \
+{ \
+	unsigned int head = atomic_load_explicit(&r->head, memory_order_relaxed); \
+	unsigned int n; \
+	\
+	atomic_store_explicit(&r->head, head + len, memory_order_release); \
+	n = head + len - atomic_load_explicit(&r->tail, memory_order_relaxed); \
+	if (n > r->high_water) r->high_water = n; \
+} \
+	\
+static inline int name##_write(name##_t* r, const type* src, int len) \
+{ \
+	unsigned int idx; \
+	int skip = 0; \
+	int n1; \
+	\
+	if (((policy) == RING_OVERWRITE) && (len > (size))) { \
+		/* Only the newest elements can be kept */ \
+		skip = len - (size); \
+	} \
+	len = name##_reserve(r, len); \
+	if (len <= 0) return 0; \
+	src += skip; \
+	\
+	idx = atomic_load_explicit(&r->head, memory_order_relaxed) & ((size) - 1); \
+	n1 = (size) - idx; \
+	if (n1 > len) n1 = len; \
+	memcpy(&r->buf[idx], src, n1 * sizeof(type)); \
+	if (len > n1) { \
+		memcpy(&r->buf[0], src + n1, (len - n1) * sizeof(type)); \
+	} \
+	name##_commit(r, len); \
+	\
+	return len; \
+} \
+	\
+static inline int name##_fill(name##_t* r, type v, int len) \
+{ \
+	unsigned int head; \
+	int i; \
+	\
+	len = name##_reserve(r, len); \
+	if (len <= 0) return 0; \
+	\
+	head = atomic_load_explicit(&r->head, memory_order_relaxed); \
+	for (i=0; i<len; i++) { \
+		r->buf[(head + i) & ((size) - 1)] = v; \
+	} \
+	name##_commit(r, len); \
+	\
+	return len; \
+} \
+	\
+static inline unsigned int name##_position(name##_t* r) \
+{ \
+	return atomic_load_explicit(&r->head, memory_order_relaxed); \
+} \
+	\
+static inline int name##_write_span(name##_t* r, type** p) \
+{ \
+	unsigned int idx = atomic_load_explicit(&r->head, memory_order_relaxed) & ((size) - 1); \
+	int len = name##_space(r); \
+	\
+	if (len > (int) ((size) - idx)) len = (size) - idx; \
+	*p = &r->buf[idx]; \
+	return len; \
+} \
+	\
+/* Starts each consumer access by honoring a flush request */ \
+static inline unsigned int name##_used(name##_t* r, unsigned int* tail) \
+{ \
+	if (atomic_load_explicit(&r->flush_req, memory_order_relaxed)) { \
+		name##_discard(r); \
+	} \
+	*tail = atomic_load_explicit(&r->tail, memory_order_relaxed); \
+	return atomic_load_explicit(&r->head, memory_order_acquire) - *tail; \
+} \
+	\
+static inline int name##_peek(name##_t* r, type* dst, int offset, int len) \
+{ \
+	unsigned int tail, idx; \
+	int used = (int) name##_used(r, &tail); \
+	int n1; \
+	\
+	if (len > (used - offset)) len = used - offset; \
+	if (len <= 0) return 0; \
+	\
+	idx = (tail + offset) & ((size) - 1); \
+	n1 = (size) - idx; \
+	if (n1 > len) n1 = len; \
+	memcpy(dst, &r->buf[idx], n1 * sizeof(type)); \
+	if (len > n1) { \
+		memcpy(dst + n1, &r->buf[0], (len - n1) * sizeof(type)); \
+	} \
+	\
+	return len; \
+} \
+	\
+static inline void name##_skip(name##_t* r, int len) \
+{ \
+	unsigned int tail; \
+	int used = (int) name##_used(r, &tail); \
+	\
+	if (len > used) len = used; \
+	if (len <= 0) return; \
+	atomic_store_explicit(&r->tail, tail + len, memory_order_release); \
+} \
+	\
+static inline void name##_skip_to(name##_t* r, unsigned int pos) \
+{ \
+	unsigned int tail = atomic_load_explicit(&r->tail, memory_order_relaxed); \
+	\
+	if ((int) (pos - tail) > 0) { \
+		atomic_store_explicit(&r->tail, pos, memory_order_release); \
+	} \
+} \
+	\
+static inline int name##_read(name##_t* r, type* dst, int len) \
+{ \
+	len = name##_peek(r, dst, 0, len); \
+	if (len > 0) name##_skip(r, len); \
+	\
+	return len; \
+} \
+	\
+static inline int name##_read_span(name##_t* r, type** p) \
+{ \
+	unsigned int tail, idx; \
+	int len = (int) name##_used(r, &tail); \
+	\
+	idx = tail & ((size) - 1); \
+	if (len > (int) ((size) - idx)) len = (size) - idx; \
+	*p = &r->buf[idx]; \
+	return len; \
+} \
+	\
+static inline void name##_unread(name##_t* r, int len) \
+{ \
+	unsigned int tail = atomic_load_explicit(&r->tail, memory_order_relaxed); \
+	\
+	atomic_store_explicit(&r->tail, tail - len, memory_order_relaxed); \
+}
+
+#endif /* _RING_H_ */
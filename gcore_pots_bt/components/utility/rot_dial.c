@@ -0,0 +1,226 @@
+/*
+ * rot_dial - utility module measuring the rotary dial on the POTS phone and tuning the
+ * thresholds pots_task decodes its pulses with.  See rot_dial.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "rot_dial.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t break_usec;                  // Average
+	uint32_t make_usec;
+	uint32_t max_break_usec;
+	uint32_t max_make_usec;
+} rot_dial_digit_t;
+
+
+
+//
+// Variables
+//
+static portMUX_TYPE rot_dial_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Digit in progress (only used by pots_task)
+static uint32_t rot_dial_sum_break_usec;
+static uint32_t rot_dial_sum_make_usec;
+static uint32_t rot_dial_max_break_usec;
+static uint32_t rot_dial_max_make_usec;
+static int rot_dial_num_breaks;
+static int rot_dial_num_makes;
+static bool rot_dial_discarded;
+
+// Digits tuned over
+static rot_dial_digit_t rot_dial_hist[ROT_DIAL_HIST_LEN];
+static int rot_dial_hist_index = 0;
+static int rot_dial_hist_count = 0;
+
+// Thresholds in use
+static uint32_t rot_dial_break_usec = ROT_DIAL_DEF_BREAK_MSEC * 1000;
+static uint32_t rot_dial_make_usec = ROT_DIAL_DEF_MAKE_MSEC * 1000;
+
+static rot_dial_stats_t rot_dial_stats;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _rotDialTune();
+#if (CONFIG_POTS_ROT_AUTOTUNE == true)
+static uint32_t _rotDialClamp(uint32_t v, uint32_t min_msec, uint32_t max_msec);
+#endif
+
+
+
+//
+// API
+//
+void rot_dial_start()
+{
+	rot_dial_sum_break_usec = 0;
+	rot_dial_sum_make_usec = 0;
+	rot_dial_max_break_usec = 0;
+	rot_dial_max_make_usec = 0;
+	rot_dial_num_breaks = 0;
+	rot_dial_num_makes = 0;
+	rot_dial_discarded = false;
+}
+
+
+void rot_dial_break(uint32_t usec)
+{
+	rot_dial_sum_break_usec += usec;
+	if (usec > rot_dial_max_break_usec) rot_dial_max_break_usec = usec;
+	rot_dial_num_breaks += 1;
+}
+
+
+void rot_dial_make(uint32_t usec)
+{
+	rot_dial_sum_make_usec += usec;
+	if (usec > rot_dial_max_make_usec) rot_dial_max_make_usec = usec;
+	rot_dial_num_makes += 1;
+}
+
+
+void rot_dial_discard()
+{
+	rot_dial_discarded = true;
+}
+
+
+void rot_dial_digit(int pulses)
+{
+	rot_dial_digit_t d;
+	uint32_t period;
+	int pps10;
+	
+	portENTER_CRITICAL(&rot_dial_mux);
+	rot_dial_stats.digits += 1;
+	
+	// A pulse rate needs a make between two pulses
+	if (!rot_dial_discarded && (pulses >= 2) && (rot_dial_num_breaks == pulses) &&
+	    (rot_dial_num_makes == (pulses - 1))) {
+		d.break_usec = rot_dial_sum_break_usec / rot_dial_num_breaks;
+		d.make_usec = rot_dial_sum_make_usec / rot_dial_num_makes;
+		d.max_break_usec = rot_dial_max_break_usec;
+		d.max_make_usec = rot_dial_max_make_usec;
+		period = d.break_usec + d.make_usec;
+		pps10 = (int) (10000000 / period);
+		
+		rot_dial_stats.measured += 1;
+		rot_dial_stats.last_pps10 = pps10;
+		rot_dial_stats.last_break_pct = (int) ((100 * d.break_usec + period / 2) / period);
+		
+		if ((pps10 >= ROT_DIAL_MIN_PPS10) && (pps10 <= ROT_DIAL_MAX_PPS10)) {
+			rot_dial_hist[rot_dial_hist_index] = d;
+			if (++rot_dial_hist_index == ROT_DIAL_HIST_LEN) rot_dial_hist_index = 0;
+			if (rot_dial_hist_count < ROT_DIAL_HIST_LEN) rot_dial_hist_count += 1;
+			_rotDialTune();
+		} else {
+			rot_dial_stats.rejected += 1;
+		}
+	}
+	portEXIT_CRITICAL(&rot_dial_mux);
+	
+	rot_dial_start();
+}
+
+
+uint32_t rot_dial_get_break_usec()
+{
+	return rot_dial_break_usec;
+}
+
+
+uint32_t rot_dial_get_make_usec()
+{
+	return rot_dial_make_usec;
+}
+
+
+void rot_dial_get_stats(rot_dial_stats_t* stats)
+{
+	portENTER_CRITICAL(&rot_dial_mux);
+	memcpy(stats, &rot_dial_stats, sizeof(rot_dial_stats_t));
+	stats->break_msec = rot_dial_break_usec / 1000;
+	stats->make_msec = rot_dial_make_usec / 1000;
+	portEXIT_CRITICAL(&rot_dial_mux);
+}
+
+
+void rot_dial_reset()
+{
+	portENTER_CRITICAL(&rot_dial_mux);
+	memset(&rot_dial_stats, 0, sizeof(rot_dial_stats_t));
+	rot_dial_hist_index = 0;
+	rot_dial_hist_count = 0;
+	rot_dial_break_usec = ROT_DIAL_DEF_BREAK_MSEC * 1000;
+	rot_dial_make_usec = ROT_DIAL_DEF_MAKE_MSEC * 1000;
+	portEXIT_CRITICAL(&rot_dial_mux);
+}
+
+
+
+//
+// Internal functions
+//
+static void _rotDialTune()
+{
+	uint32_t sum_break = 0;
+	uint32_t sum_make = 0;
+	uint32_t max_break = 0;
+	uint32_t max_make = 0;
+	uint32_t period;
+	int i;
+	
+	for (i=0; i<rot_dial_hist_count; i++) {
+		sum_break += rot_dial_hist[i].break_usec;
+		sum_make += rot_dial_hist[i].make_usec;
+		if (rot_dial_hist[i].max_break_usec > max_break) max_break = rot_dial_hist[i].max_break_usec;
+		if (rot_dial_hist[i].max_make_usec > max_make) max_make = rot_dial_hist[i].max_make_usec;
+	}
+	period = (sum_break + sum_make) / rot_dial_hist_count;
+	
+	rot_dial_stats.avg_pps10 = (int) (10000000 / period);
+	rot_dial_stats.avg_break_pct = (int) ((100 * (sum_break / rot_dial_hist_count) + period / 2) / period);
+	rot_dial_stats.max_break_msec = (int) ((max_break + 500) / 1000);
+	rot_dial_stats.max_make_msec = (int) ((max_make + 500) / 1000);
+	
+#if (CONFIG_POTS_ROT_AUTOTUNE == true)
+	if (rot_dial_hist_count >= ROT_DIAL_LEARN_DIGITS) {
+		rot_dial_break_usec = _rotDialClamp(max_break * 3 / 2, ROT_DIAL_BREAK_MIN_MSEC, ROT_DIAL_BREAK_MAX_MSEC);
+		rot_dial_make_usec = _rotDialClamp(max_make * 2, ROT_DIAL_MAKE_MIN_MSEC, ROT_DIAL_MAKE_MAX_MSEC);
+		rot_dial_stats.tuned = true;
+	}
+#endif
+}
+
+
+#if (CONFIG_POTS_ROT_AUTOTUNE == true)
+static uint32_t _rotDialClamp(uint32_t v, uint32_t min_msec, uint32_t max_msec)
+{
+	if (v < (min_msec * 1000)) return min_msec * 1000;
+	if (v > (max_msec * 1000)) return max_msec * 1000;
+	return v;
+}
+#endif
@@ -0,0 +1,102 @@
+/*
+ * rot_dial - utility module measuring the rotary dial on the POTS phone and tuning the
+ * thresholds pots_task decodes its pulses with.  pots_task reports the length of each break
+ * (on-hook) and make (off-hook) between the pulses of a digit, taken from the hook edge
+ * timestamps captured in its ISR, and the end of each digit.  For every digit with at least
+ * two pulses the module finds the pulse rate and break ratio (dials range from 8 to 12
+ * pulses/sec with breaks of 50-70% of each pulse).
+ *
+ * Once ROT_DIAL_LEARN_DIGITS digits at a believable rate have been measured the thresholds
+ * are set from the longest break and make seen in the last ROT_DIAL_HIST_LEN digits:
+ *   - break: the longest on-hook period that is still a pulse (longest break x 3/2)
+ *   - make: the off-hook period that ends a digit (longest make x 2), so a fast dial's digits
+ *     are decoded sooner and a slow dial's long makes aren't mistaken for the end of a digit
+ * Both are clamped to a range that leaves room for a hook flash and the pause a dial makes
+ * between digits.  Until then (or when CONFIG_POTS_ROT_AUTOTUNE is not set) the fixed
+ * defaults are used.  Measurements follow whichever phone is dialing since only recent digits
+ * count.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _ROT_DIAL_H_
+#define _ROT_DIAL_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Default thresholds
+#define ROT_DIAL_DEF_BREAK_MSEC  100
+#define ROT_DIAL_DEF_MAKE_MSEC   100
+
+// Tuned threshold limits
+#define ROT_DIAL_BREAK_MIN_MSEC  70
+#define ROT_DIAL_BREAK_MAX_MSEC  120
+#define ROT_DIAL_MAKE_MIN_MSEC   50
+#define ROT_DIAL_MAKE_MAX_MSEC   150
+
+// Digits the thresholds are tuned over
+#define ROT_DIAL_HIST_LEN        8
+
+// Digits measured before the thresholds are tuned
+#define ROT_DIAL_LEARN_DIGITS    2
+
+// Pulse rates (x10) believable for a rotary dial, digits outside are not used for tuning
+#define ROT_DIAL_MIN_PPS10       70
+#define ROT_DIAL_MAX_PPS10       140
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t digits;                      // Digits decoded
+	uint32_t measured;                    // Digits with a pulse rate (two or more pulses)
+	uint32_t rejected;                    // Measured digits not used for tuning
+	int last_pps10;                       // Last measured digit (0 if none)
+	int last_break_pct;
+	int avg_pps10;                        // Average of the digits tuned over (0 if none)
+	int avg_break_pct;
+	int max_break_msec;                   // Longest break and make of the digits tuned over
+	int max_make_msec;
+	int break_msec;                       // Thresholds in use
+	int make_msec;
+	bool tuned;                           // Thresholds set from the dial
+} rot_dial_stats_t;
+
+
+
+//
+// API
+//
+void rot_dial_start();                            // First break of a digit started
+void rot_dial_break(uint32_t usec);               // Break of a pulse
+void rot_dial_make(uint32_t usec);                // Make between two pulses of a digit
+void rot_dial_discard();                          // Don't measure the digit in progress
+void rot_dial_digit(int pulses);                  // Digit decoded
+uint32_t rot_dial_get_break_usec();               // Longest break that is a pulse
+uint32_t rot_dial_get_make_usec();                // Make that ends a digit
+void rot_dial_get_stats(rot_dial_stats_t* stats);
+void rot_dial_reset();                            // Back to the default thresholds
+
+#endif /* _ROT_DIAL_H_ */
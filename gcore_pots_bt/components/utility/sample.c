@@ -1,8 +1,20 @@
 /*
  * Audio sample recording - provides a mechanism to debug the I2S communication
  * RX/TX synchronization and line echo cancellation by recording audio samples
- * and then writing to files on a Micro-SD card.  This code is designed to be
- * conditionally compiled in (for debugging purposes).
+ * to files on a Micro-SD card.  This code is designed to be conditionally compiled
+ * in (for debugging purposes).
+ *
+ * Samples are streamed to the card while they are recorded.  audio_task fills one
+ * of a pair of PSRAM blocks while a low priority writer task saves the other so
+ * the recording length is only limited by the card.  If the writer falls behind
+ * (slow card) a full block is dropped and counted rather than stalling audio_task.
+ * The writer can optionally encode the blocks as u-law or IMA ADPCM to reduce the
+ * card bandwidth and space (CONFIG_AUDIO_SAMPLE_ENCODING).
+ *
+ * Timestamped Bluetooth events (and optionally the incoming SCO audio) may be recorded
+ * into a separate event file by any task (CONFIG_BT_TRACE_ENABLE).  They use their own
+ * pair of blocks, saved by the same writer task, and are read back by bt_task to replay
+ * a call without a phone.
  *
  * Copyright 2023 Dan Julio
  *
@@ -22,21 +34,75 @@
  */
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
 #include "sample.h"
+#include "ima_adpcm.h"
+#include <stdatomic.h>
 #include <string.h>
 #include <sys/unistd.h>
 #include <sys/stat.h>
 #include "esp_system.h"
 #include "esp_heap_caps.h"
 #include "esp_log.h"
-#include "esp_vfs_fat.h"
-#include "sdmmc_cmd.h"
-#include "driver/sdmmc_host.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sd_card.h"
 
 
 //
 // Constants
 //
-#define MOUNT_POINT "/sdcard"
+// Writer task
+#define SAMPLE_TASK_STACK 3072
+#define SAMPLE_TASK_PRIO  1
+
+// Time for an in-progress sample_record to finish after recording is disabled
+#define SAMPLE_STOP_MSEC  20
+
+// Recording channels (one file each)
+#define SAMPLE_CH_TX 0
+#define SAMPLE_CH_RX 1
+#define SAMPLE_CH_EC 2
+#define SAMPLE_NUM_CH 3
+
+// Block states
+#define BLK_FILLING 0
+#define BLK_FULL    1
+
+// File encoding
+#if (CONFIG_AUDIO_SAMPLE_ENC_ULAW == true)
+#define SAMPLE_ENC_NAME  "ulaw"
+#define SAMPLE_FILE_EXT  "ul"
+#define SAMPLE_ENC_BYTES (SAMPLE_BLOCK_LEN)
+#elif (CONFIG_AUDIO_SAMPLE_ENC_IMA_ADPCM == true)
+#define SAMPLE_ENC_NAME  "ima_adpcm"
+#define SAMPLE_FILE_EXT  "ima"
+#define SAMPLE_ENC_BYTES (SAMPLE_BLOCK_LEN / 2)
+#else
+#define SAMPLE_ENC_NAME  "pcm16"
+#define SAMPLE_FILE_EXT  "raw"
+#endif
+
+// u-law encoder
+#define ULAW_BIAS 0x84
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int16_t* buf[SAMPLE_NUM_CH];     // SAMPLE_BLOCK_LEN samples per channel
+	int len;                         // Valid samples per channel
+	atomic_int state;
+} sample_block_t;
+
+#if (CONFIG_BT_TRACE_ENABLE == true)
+typedef struct {
+	uint8_t* buf;                    // SAMPLE_EVT_BLOCK_LEN bytes of records
+	int len;                         // Valid bytes
+	atomic_int state;
+} sample_evt_block_t;
+#endif
 
 
 
@@ -45,30 +111,75 @@
 //
 static const char *TAG = "sample";
 
-// Micro-SD Card
-static const char mount_point[] = MOUNT_POINT;
-static esp_vfs_fat_sdmmc_mount_config_t mount_config = {
-    .format_if_mount_failed = true,
-    .max_files = 3,
-    .allocation_unit_size = 16 * 1024
-};
-static sdmmc_host_t host = SDMMC_HOST_DEFAULT();
-static sdmmc_slot_config_t slot_config = SDMMC_SLOT_CONFIG_DEFAULT();
-static sdmmc_card_t *card;
+// Writer task
+static TaskHandle_t task_handle_sample;
+static StackType_t sample_task_stack[SAMPLE_TASK_STACK];
+static StaticTask_t sample_task_tcb;
+
+// Recording blocks and files
+static sample_block_t blocks[SAMPLE_NUM_BLOCKS];
+static FILE* files[SAMPLE_NUM_CH];
+static const char* file_prefix[SAMPLE_NUM_CH] = {"tx", "rx", "ec"};
+static int file_num = 1;
+
+// Recording state - push_enable and drop_count are shared between audio_task, the writer
+// task and the manager.  The remaining push variables are only touched by audio_task.
+static atomic_bool push_enable = false;
+static atomic_bool save_in_progress = false;
+static atomic_int drop_count = 0;
+static int push_block;
+static int push_total;
+static int push_limit;               // Samples to record, 0 = until sample_stop
+static bool write_failed;
+static int saved_samples;
+
+#if (CONFIG_BT_TRACE_ENABLE == true)
+// Event recording - records are pushed by any task under evt_mux
+static sample_evt_block_t evt_blocks[SAMPLE_NUM_BLOCKS];
+static portMUX_TYPE evt_mux = portMUX_INITIALIZER_UNLOCKED;
+static FILE* evt_file;
+static int evt_push_block;
+static int64_t evt_start_usec;
+static atomic_int evt_drop_count = 0;
+static int saved_evt_bytes;
 
-// Audio recording buffers
-int16_t* txbuf;
-int16_t* rxbuf;
-int16_t* ecbuf;
-int push_index;
-int push_enable = 0;
+// Event file being replayed
+static FILE* trace_file = NULL;
+#endif
+
+// Encoder output (written instead of the block when encoding)
+#ifdef SAMPLE_ENC_BYTES
+static uint8_t enc_buf[SAMPLE_ENC_BYTES] __attribute__((aligned(4)));
+#endif
+
+#if (CONFIG_AUDIO_SAMPLE_ENC_IMA_ADPCM == true)
+// IMA ADPCM encoder state for each file, carried across blocks
+static ima_state_t ima_state[SAMPLE_NUM_CH];
+#endif
+
+// Echo canceller configuration for the recording (saved with it so the raw files can be
+// replayed through the same canceller off-target)
+static int sample_rate = 8000;
+static int sample_taps = 0;
+static int sample_adaption_mode = 0;
 
 
 
 //
 // Forward declarations
 //
-void _sample_write_data(int16_t* buf, const char* fn);
+static void _sample_task(void* args);
+static void _sample_write_block(sample_block_t* bP);
+#if (CONFIG_BT_TRACE_ENABLE == true)
+static void _sample_write_evt_block(sample_evt_block_t* bP);
+#endif
+#if (CONFIG_AUDIO_SAMPLE_ENC_ULAW == true)
+static int _sample_encode_ulaw(const int16_t* buf, int len);
+#endif
+static void _sample_finish();
+static bool _sample_mount();
+static FILE* _sample_open(const char* fn);
+static void _sample_write_info(const char* fn);
 
 
 
@@ -77,132 +188,521 @@ void _sample_write_data(int16_t* buf, const char* fn);
 //
 void sample_mem_init()
 {
-	// Allocate buffers in external SPIRAM
-	txbuf = (int16_t*) heap_caps_malloc(SAMPLE_NUM*2, MALLOC_CAP_SPIRAM);
-	if (txbuf == NULL) {
-		ESP_LOGE(TAG, "malloc txbuf failed");
-	}
-	
-	rxbuf = (int16_t*) heap_caps_malloc(SAMPLE_NUM*2, MALLOC_CAP_SPIRAM);
-	if (rxbuf == NULL) {
-		ESP_LOGE(TAG, "malloc rxbuf failed");
-	}
-	
-	ecbuf = (int16_t*) heap_caps_malloc(SAMPLE_NUM*2, MALLOC_CAP_SPIRAM);
-	if (ecbuf == NULL) {
-		ESP_LOGE(TAG, "malloc ecbuf failed");
+	// Allocate blocks in external SPIRAM, aligned for the SDMMC driver
+	for (int i=0; i<SAMPLE_NUM_BLOCKS; i++) {
+		for (int c=0; c<SAMPLE_NUM_CH; c++) {
+			blocks[i].buf[c] = (int16_t*) heap_caps_aligned_alloc(32, SAMPLE_BLOCK_LEN*2, MALLOC_CAP_SPIRAM);
+			if (blocks[i].buf[c] == NULL) {
+				ESP_LOGE(TAG, "malloc block %d:%d failed", i, c);
+			}
+		}
+#if (CONFIG_BT_TRACE_ENABLE == true)
+		evt_blocks[i].buf = (uint8_t*) heap_caps_aligned_alloc(32, SAMPLE_EVT_BLOCK_LEN, MALLOC_CAP_SPIRAM);
+		if (evt_blocks[i].buf == NULL) {
+			ESP_LOGE(TAG, "malloc event block %d failed", i);
+		}
+#endif
 	}
 	
-	// Configure card for faster 4-bit operation since gCore supports that
-	slot_config.width = 4;
-    slot_config.flags |= SDMMC_SLOT_FLAG_INTERNAL_PULLUP;
+    // Start the writer below all the other tasks so it only uses idle time
+    task_handle_sample = xTaskCreateStaticPinnedToCore(&_sample_task, "sample_task", SAMPLE_TASK_STACK, NULL, SAMPLE_TASK_PRIO, sample_task_stack, &sample_task_tcb, 0);
 }
 
 
 bool sample_start()
 {
-	esp_err_t ret;
+	char filename[32];
+	
+	if (atomic_load(&save_in_progress)) {
+		return false;
+	}
+#if (CONFIG_BT_TRACE_ENABLE == true)
+	if (trace_file != NULL) {
+		// Card is in use by a replay
+		return false;
+	}
+#endif
 	
 	// Attempt to mount Micro-SD Card
-    ESP_LOGI(TAG, "Mounting filesystem");
-    ret = esp_vfs_fat_sdmmc_mount(mount_point, &host, &slot_config, &mount_config, &card);
-    if (ret != ESP_OK) {
-        if (ret == ESP_FAIL) {
-            ESP_LOGE(TAG, "Failed to mount filesystem. ");
-        } else {
-            ESP_LOGE(TAG, "Failed to initialize the card (%s). ", esp_err_to_name(ret));
-        }
-        return false;
+	if (!_sample_mount()) {
+		return false;
+	}
+    
+    // Create the files for this recording
+    for (int c=0; c<SAMPLE_NUM_CH; c++) {
+    	sprintf(filename, "/sdcard/test_%s%d.%s", file_prefix[c], file_num, SAMPLE_FILE_EXT);
+    	files[c] = _sample_open(filename);
+    	if (files[c] == NULL) {
+    		ESP_LOGE(TAG, "Could not create %s", filename);
+    		while (--c >= 0) {
+    			fclose(files[c]);
+    		}
+    		sample_end();
+    		return false;
+    	}
+    	
+    	// Unbuffered so each block goes to FATFS as one large write instead of
+    	// being copied through the small stdio buffer
+    	setvbuf(files[c], NULL, _IONBF, 0);
     }
-    sdmmc_card_print_info(stdout, card);
     
-	// Setup buffers
-	push_index = 0;
-	push_enable = 1;
-	for (int i=0; i<SAMPLE_NUM; i++) {
-		txbuf[i] = 0;
-		rxbuf[i] = 0;
-		ecbuf[i] = 0;
+#if (CONFIG_BT_TRACE_ENABLE == true)
+	sprintf(filename, "/sdcard/test_bt%d.evt", file_num);
+	evt_file = _sample_open(filename);
+	if (evt_file == NULL) {
+		ESP_LOGE(TAG, "Could not create %s", filename);
+		for (int c=0; c<SAMPLE_NUM_CH; c++) {
+			fclose(files[c]);
+		}
+		sample_end();
+		return false;
+	}
+	setvbuf(evt_file, NULL, _IONBF, 0);
+	
+	for (int i=0; i<SAMPLE_NUM_BLOCKS; i++) {
+		evt_blocks[i].len = 0;
+		atomic_store(&evt_blocks[i].state, BLK_FILLING);
+	}
+	evt_push_block = 0;
+	evt_start_usec = esp_timer_get_time();
+	saved_evt_bytes = 0;
+	atomic_store(&evt_drop_count, 0);
+#endif
+	
+	// Setup blocks
+	for (int i=0; i<SAMPLE_NUM_BLOCKS; i++) {
+		blocks[i].len = 0;
+		atomic_store(&blocks[i].state, BLK_FILLING);
+	}
+	push_block = 0;
+	push_total = 0;
+	push_limit = CONFIG_AUDIO_SAMPLE_SECS * sample_rate;
+	saved_samples = 0;
+	write_failed = false;
+#if (CONFIG_AUDIO_SAMPLE_ENC_IMA_ADPCM == true)
+	for (int c=0; c<SAMPLE_NUM_CH; c++) {
+		ima_init(&ima_state[c]);
 	}
+#endif
+	atomic_store(&drop_count, 0);
+	atomic_store(&save_in_progress, true);
+	atomic_store(&push_enable, true);
+	
+	ESP_LOGI(TAG, "Start recording %d", file_num);
 	
 	return true;
 }
 
 
+void sample_stop()
+{
+	if (atomic_exchange(&push_enable, false)) {
+		xTaskNotifyGive(task_handle_sample);
+	}
+}
+
+
 // Call only after successfully starting recording
 bool sample_in_progress()
 {
-	return (push_enable == 1);
+	return atomic_load(&save_in_progress);
 }
 
 
 void sample_end()
 {
-	esp_err_t ret;
+	// Release the card for user removal
+	sd_card_unmount();
+}
+
+
+int sample_get_drops()
+{
+	return atomic_load(&drop_count);
+}
+
+
+void sample_record(const int16_t* tx, const int16_t* rx, const int16_t* ec, int len)
+{
+	sample_block_t* bP;
+	int n;
 	
-	// Unmount card for user removal
-	ret = esp_vfs_fat_sdcard_unmount(mount_point, card);
-	if (ret != ESP_OK) {
-		ESP_LOGE(TAG, "Failed to unmount the card (%s). ", esp_err_to_name(ret));
+	while (atomic_load(&push_enable) && (len > 0)) {
+		bP = &blocks[push_block];
+		
+		n = SAMPLE_BLOCK_LEN - bP->len;
+		if (n > len) n = len;
+		if ((push_limit != 0) && (n > (push_limit - push_total))) n = push_limit - push_total;
+		memcpy(&bP->buf[SAMPLE_CH_TX][bP->len], tx, n * sizeof(int16_t));
+		memcpy(&bP->buf[SAMPLE_CH_RX][bP->len], rx, n * sizeof(int16_t));
+		memcpy(&bP->buf[SAMPLE_CH_EC][bP->len], ec, n * sizeof(int16_t));
+		bP->len += n;
+		push_total += n;
+		tx += n;
+		rx += n;
+		ec += n;
+		len -= n;
+		
+		if (bP->len == SAMPLE_BLOCK_LEN) {
+			// Hand the block to the writer if the next one is free, otherwise the writer
+			// is behind and we have to discard this block to keep going
+			if (atomic_load(&blocks[(push_block + 1) % SAMPLE_NUM_BLOCKS].state) == BLK_FILLING) {
+				atomic_store(&bP->state, BLK_FULL);
+				xTaskNotifyGive(task_handle_sample);
+				push_block = (push_block + 1) % SAMPLE_NUM_BLOCKS;
+			} else {
+				bP->len = 0;
+				atomic_fetch_add(&drop_count, 1);
+			}
+		}
+		
+		if (push_total == push_limit) {
+			ESP_LOGI(TAG, "Done recording");
+			sample_stop();
+		}
 	}
 }
 
 
-void sample_record(int16_t tx, int16_t rx, int16_t ec)
+void sample_set_config(int rate, int taps, int adaption_mode)
+{
+	sample_rate = rate;
+	sample_taps = taps;
+	sample_adaption_mode = adaption_mode;
+}
+
+
+#if (CONFIG_BT_TRACE_ENABLE == true)
+void sample_record_event(int type, int id, const void* data, int len)
 {
-	if (push_enable == 1) {
-		if (push_index < SAMPLE_NUM) {
-			txbuf[push_index] = tx;
-			rxbuf[push_index] = rx;
-			ecbuf[push_index] = ec;
-			push_index += 1;
+	sample_evt_block_t* bP;
+	sample_evt_hdr_t hdr;
+	bool wake = false;
+	int n;
+	int next;
+	
+	n = sizeof(sample_evt_hdr_t) + ((len + 3) & ~3);
+	if (!atomic_load(&push_enable) || (n > SAMPLE_EVT_BLOCK_LEN)) {
+		return;
+	}
+	
+	hdr.usec = (uint32_t) (esp_timer_get_time() - evt_start_usec);
+	hdr.type = (uint16_t) type;
+	hdr.id = (uint16_t) id;
+	hdr.len = (uint32_t) len;
+	
+	portENTER_CRITICAL(&evt_mux);
+	bP = &evt_blocks[evt_push_block];
+	if ((bP->len + n) > SAMPLE_EVT_BLOCK_LEN) {
+		// Records don't span blocks.  Hand this one to the writer if the next is free,
+		// otherwise drop the record.
+		next = (evt_push_block + 1) % SAMPLE_NUM_BLOCKS;
+		if (atomic_load(&evt_blocks[next].state) == BLK_FILLING) {
+			atomic_store(&bP->state, BLK_FULL);
+			evt_push_block = next;
+			bP = &evt_blocks[next];
+			wake = true;
 		} else {
-			push_enable = 0;
-			ESP_LOGI(TAG, "Done recording");
+			bP = NULL;
 		}
 	}
+	if (bP != NULL) {
+		memcpy(&bP->buf[bP->len], &hdr, sizeof(sample_evt_hdr_t));
+		memcpy(&bP->buf[bP->len + sizeof(sample_evt_hdr_t)], data, len);
+		memset(&bP->buf[bP->len + sizeof(sample_evt_hdr_t) + len], 0, n - sizeof(sample_evt_hdr_t) - len);
+		bP->len += n;
+	}
+	portEXIT_CRITICAL(&evt_mux);
+	
+	if (bP == NULL) {
+		atomic_fetch_add(&evt_drop_count, 1);
+	}
+	if (wake) {
+		xTaskNotifyGive(task_handle_sample);
+	}
 }
 
 
-void sample_save()
+bool sample_trace_open(int num)
 {
 	char filename[32];
-	static int file_num = 1;
 	
-	sprintf(filename, "/sdcard/test_tx%d.raw", file_num);
-	_sample_write_data(txbuf, filename);
+	if (atomic_load(&save_in_progress) || (trace_file != NULL)) {
+		return false;
+	}
 	
-	sprintf(filename, "/sdcard/test_rx%d.raw", file_num);
-    _sample_write_data(rxbuf, filename);
-    
-    sprintf(filename, "/sdcard/test_ec%d.raw", file_num);
-    _sample_write_data(ecbuf, filename);
-    
-    file_num += 1;
-    
-    ESP_LOGI(TAG, "Files saved");
+	if (!_sample_mount()) {
+		return false;
+	}
+	
+	sprintf(filename, "/sdcard/test_bt%d.evt", num);
+	trace_file = fopen(filename, "r");
+	if (trace_file == NULL) {
+		ESP_LOGE(TAG, "Could not open %s", filename);
+		sample_end();
+		return false;
+	}
+	
+	ESP_LOGI(TAG, "Replaying %s", filename);
+	return true;
+}
+
+
+int sample_trace_read(sample_evt_hdr_t* hdr, void* data, int max)
+{
+	int pad;
+	
+	if (trace_file == NULL) {
+		return -1;
+	}
+	
+	if (fread(hdr, sizeof(sample_evt_hdr_t), 1, trace_file) != 1) {
+		return -1;
+	}
+	
+	// Skip data that doesn't fit
+	pad = ((hdr->len + 3) & ~3) - hdr->len;
+	if (hdr->len > (uint32_t) max) {
+		ESP_LOGW(TAG, "Skipping %u byte event", hdr->len);
+		pad += hdr->len;
+		hdr->len = 0;
+	} else if (fread(data, 1, hdr->len, trace_file) != hdr->len) {
+		return -1;
+	}
+	if (pad != 0) {
+		(void) fseek(trace_file, pad, SEEK_CUR);
+	}
+	
+	return (int) hdr->len;
 }
 
 
+void sample_trace_close()
+{
+	if (trace_file != NULL) {
+		fclose(trace_file);
+		trace_file = NULL;
+		sample_end();
+	}
+}
+#endif
+
+
 
 //
 // Internal functions
 //
-void _sample_write_data(int16_t* buf, const char* fn)
+static void _sample_task(void* args)
+{
+	int next_block = 0;
+#if (CONFIG_BT_TRACE_ENABLE == true)
+	int next_evt_block = 0;
+#endif
+	
+	ESP_LOGI(TAG, "Start task");
+	
+	while (1) {
+		(void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		
+		if (!atomic_load(&save_in_progress)) {
+			continue;
+		}
+		
+		// Save full blocks in the order audio_task filled them
+		while (atomic_load(&blocks[next_block].state) == BLK_FULL) {
+			_sample_write_block(&blocks[next_block]);
+			next_block = (next_block + 1) % SAMPLE_NUM_BLOCKS;
+		}
+#if (CONFIG_BT_TRACE_ENABLE == true)
+		while (atomic_load(&evt_blocks[next_evt_block].state) == BLK_FULL) {
+			_sample_write_evt_block(&evt_blocks[next_evt_block]);
+			next_evt_block = (next_evt_block + 1) % SAMPLE_NUM_BLOCKS;
+		}
+#endif
+		
+		if (!atomic_load(&push_enable)) {
+			// Let any sample_record call that saw push_enable set complete before
+			// taking the partially filled block from audio_task
+			vTaskDelay(pdMS_TO_TICKS(SAMPLE_STOP_MSEC));
+			while (atomic_load(&blocks[next_block].state) == BLK_FULL) {
+				_sample_write_block(&blocks[next_block]);
+				next_block = (next_block + 1) % SAMPLE_NUM_BLOCKS;
+			}
+			if (blocks[next_block].len != 0) {
+				_sample_write_block(&blocks[next_block]);
+			}
+#if (CONFIG_BT_TRACE_ENABLE == true)
+			while (atomic_load(&evt_blocks[next_evt_block].state) == BLK_FULL) {
+				_sample_write_evt_block(&evt_blocks[next_evt_block]);
+				next_evt_block = (next_evt_block + 1) % SAMPLE_NUM_BLOCKS;
+			}
+			if (evt_blocks[next_evt_block].len != 0) {
+				_sample_write_evt_block(&evt_blocks[next_evt_block]);
+			}
+			next_evt_block = 0;
+#endif
+			_sample_finish();
+			next_block = 0;
+		}
+	}
+}
+
+
+static void _sample_write_block(sample_block_t* bP)
+{
+	size_t len, want;
+	
+	if (!write_failed) {
+		for (int c=0; c<SAMPLE_NUM_CH; c++) {
+#if (CONFIG_AUDIO_SAMPLE_ENC_ULAW == true)
+			want = _sample_encode_ulaw(bP->buf[c], bP->len);
+			len = fwrite(enc_buf, 1, want, files[c]);
+#elif (CONFIG_AUDIO_SAMPLE_ENC_IMA_ADPCM == true)
+			want = ima_encode(&ima_state[c], bP->buf[c], enc_buf, bP->len);
+			len = fwrite(enc_buf, 1, want, files[c]);
+#else
+			want = bP->len;
+			len = fwrite(bP->buf[c], sizeof(int16_t), want, files[c]);
+#endif
+			if (len != want) {
+				// Probably a full card - end the recording with what we have
+				ESP_LOGE(TAG, "Write failed - stopping recording");
+				write_failed = true;
+				sample_stop();
+				break;
+			}
+		}
+		if (!write_failed) {
+			saved_samples += bP->len;
+		}
+	}
+	
+	bP->len = 0;
+	atomic_store(&bP->state, BLK_FILLING);
+}
+
+
+#if (CONFIG_BT_TRACE_ENABLE == true)
+static void _sample_write_evt_block(sample_evt_block_t* bP)
+{
+	if (!write_failed) {
+		if (fwrite(bP->buf, 1, bP->len, evt_file) != bP->len) {
+			ESP_LOGE(TAG, "Event write failed - stopping recording");
+			write_failed = true;
+			sample_stop();
+		} else {
+			saved_evt_bytes += bP->len;
+		}
+	}
+	
+	bP->len = 0;
+	atomic_store(&bP->state, BLK_FILLING);
+}
+#endif
+
+
+#if (CONFIG_AUDIO_SAMPLE_ENC_ULAW == true)
+// G.711 u-law encode buf into enc_buf, returning the number of bytes
+static int _sample_encode_ulaw(const int16_t* buf, int len)
+{
+	int linear, mask, seg, t;
+	
+	for (int i=0; i<len; i++) {
+		if (buf[i] < 0) {
+			linear = ULAW_BIAS - buf[i] - 1;
+			mask = 0x7F;
+		} else {
+			linear = ULAW_BIAS + buf[i];
+			mask = 0xFF;
+		}
+		
+		// Segment is the position of the top bit above bit 7
+		seg = 0;
+		for (t = linear >> 8; t != 0; t >>= 1) seg++;
+		
+		if (seg >= 8) {
+			enc_buf[i] = (uint8_t) (0x7F ^ mask);
+		} else {
+			enc_buf[i] = (uint8_t) (((seg << 4) | ((linear >> (seg + 3)) & 0x0F)) ^ mask);
+		}
+	}
+	
+	return len;
+}
+
+#endif
+
+
+static void _sample_finish()
+{
+	char filename[32];
+	
+	for (int c=0; c<SAMPLE_NUM_CH; c++) {
+		fclose(files[c]);
+	}
+#if (CONFIG_BT_TRACE_ENABLE == true)
+	fclose(evt_file);
+#endif
+	
+	sprintf(filename, "/sdcard/test_inf%d.txt", file_num);
+    _sample_write_info(filename);
+    
+    ESP_LOGI(TAG, "Files %d saved (%d samples, %d dropped blocks)", file_num, saved_samples,
+             atomic_load(&drop_count));
+    
+    file_num += 1;
+    atomic_store(&save_in_progress, false);
+}
+
+
+static bool _sample_mount()
+{
+    ESP_LOGI(TAG, "Mounting filesystem");
+    if (!sd_card_mount()) {
+        ESP_LOGE(TAG, "Failed to mount filesystem. ");
+        return false;
+    }
+    
+    return true;
+}
+
+
+static FILE* _sample_open(const char* fn)
 {
 	struct stat st;
-	FILE *fp;
 	
 	if (stat(fn, &st) == 0) {
         // Delete it if it exists
         unlink(fn);
     }
     
-    fp = fopen(fn, "w");
-    
-    fwrite(buf, sizeof(int16_t), push_index, fp);
-    
-    fclose(fp);
+    return fopen(fn, "w");
+}
+
+
+// Describes the sample files: mono samples at the sample rate in the encoding (pcm16 is 16-bit
+// little-endian, ima_adpcm starts with a predictor and step index of 0 and runs continuously
+// across blocks).  Each dropped block is a gap of block_samples samples somewhere in the files.
+// Dropped events are simply missing from the event file.
+static void _sample_write_info(const char* fn)
+{
+	FILE *fp;
+	
+	fp = _sample_open(fn);
+	if (fp == NULL) {
+		ESP_LOGE(TAG, "Could not create %s", fn);
+		return;
+	}
+	
+	fprintf(fp, "rate=%d\nencoding=%s\nsamples=%d\ntaps=%d\nadaption_mode=0x%02x\nblock_samples=%d\ndropped_blocks=%d\n",
+	        sample_rate, SAMPLE_ENC_NAME, saved_samples, sample_taps, sample_adaption_mode, SAMPLE_BLOCK_LEN,
+	        atomic_load(&drop_count));
+	
+#if (CONFIG_BT_TRACE_ENABLE == true)
+	fprintf(fp, "event_bytes=%d\ndropped_events=%d\n", saved_evt_bytes, atomic_load(&evt_drop_count));
+#endif
+	
+	fclose(fp);
 }
 
-#endif /* (CONFIG_AUDIO_SAMPLE_ENABLE == true) */
\ No newline at end of file
+#endif /* (CONFIG_AUDIO_SAMPLE_ENABLE == true) */
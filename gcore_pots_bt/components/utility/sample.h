@@ -1,8 +1,9 @@
 /*
  * Audio sample recording - provides a mechanism to debug the I2S communication
  * RX/TX synchronization and line echo cancellation by recording audio samples
- * and then writing to files on a Micro-SD card.  This code is designed to be
- * conditionally compiled in (for debugging purposes).
+ * and then writing to files on a Micro-SD card.  Bluetooth events can be recorded
+ * alongside the audio and read back to replay them (CONFIG_BT_TRACE_ENABLE).  This code
+ * is designed to be conditionally compiled in (for debugging purposes).
  *
  * Copyright 2023 Dan Julio
  *
@@ -29,8 +30,35 @@
 //
 // Constants
 //
-#define SAMPLE_SECS 5
-#define SAMPLE_NUM (SAMPLE_SECS*8000)
+
+// Samples per channel in each recording block.  Each block is written as one
+// SAMPLE_BLOCK_LEN*2 byte write per file (matches the FAT allocation unit size).
+#define SAMPLE_BLOCK_LEN 8192
+
+// Number of recording blocks (audio_task fills one while the writer task saves the other)
+#define SAMPLE_NUM_BLOCKS 2
+
+// Bytes in each event recording block (events are written to their own file)
+#define SAMPLE_EVT_BLOCK_LEN 16384
+
+// Event record types
+#define SAMPLE_EVT_BT_GAP    1        // id: esp_bt_gap_cb_event_t, data: esp_bt_gap_cb_param_t
+#define SAMPLE_EVT_BT_HF     2        // id: esp_hf_client_cb_event_t, data: esp_hf_client_cb_param_t + string
+#define SAMPLE_EVT_BT_SCO_IN 3        // id: 0, data: incoming SCO audio packet
+
+
+
+//
+// Typedefs
+//
+
+// Event record header, followed by len bytes of data padded to a multiple of 4 bytes
+typedef struct {
+	uint32_t usec;                   // Time since the recording started
+	uint16_t type;                   // SAMPLE_EVT_*
+	uint16_t id;
+	uint32_t len;
+} sample_evt_hdr_t;
 
 
 
@@ -38,12 +66,23 @@
 // API
 //
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
-void sample_mem_init();
-bool sample_start();          // Returns false if no Micro-SD Card or card can't be initialized
-bool sample_in_progress();    // Designed to be called by manager
+void sample_mem_init();       // Allocates the recording blocks and starts the writer task
+bool sample_start();          // Returns false if no Micro-SD Card or card/files can't be initialized
+void sample_stop();           // Ends a recording early (the only way to end CONFIG_AUDIO_SAMPLE_SECS = 0 recordings)
+bool sample_in_progress();    // Designed to be called by manager - true until all files are saved
 void sample_end();            // Called after sampling finished to unmount card
-void sample_record(int16_t tx, int16_t rx, int16_t ec);   // Designed to be called by audio_task
-void sample_save();
+int sample_get_drops();       // Number of blocks dropped by the last recording
+void sample_record(const int16_t* tx, const int16_t* rx, const int16_t* ec, int len);   // Designed to be called by audio_task
+void sample_set_config(int rate, int taps, int adaption_mode);  // Called by audio_task when the LEC is configured
+#if (CONFIG_BT_TRACE_ENABLE == true)
+void sample_record_event(int type, int id, const void* data, int len);  // Any task, see note
+bool sample_trace_open(int num);  // Mounts the card and opens recording num's event file for reading
+int sample_trace_read(sample_evt_hdr_t* hdr, void* data, int max);  // Returns data length, -1 at the end of the file
+void sample_trace_close();        // Closes the event file and unmounts the card
 #endif
+#endif
+
+// Note: Events are only recorded while a recording is in progress.  An event is dropped
+// (and counted in the info file) if the writer is behind or its data is longer than a block.
 
-#endif
\ No newline at end of file
+#endif
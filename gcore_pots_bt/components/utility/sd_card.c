@@ -0,0 +1,129 @@
+/*
+ * sd_card - utility module owning the Micro-SD Card mount for every module that uses the
+ * card.  See sd_card.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sd_card.h"
+#include "driver/sdmmc_host.h"
+#include "esp_log.h"
+#include "esp_vfs_fat.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "sdmmc_cmd.h"
+
+
+//
+// Variables
+//
+static const char* TAG = "sd_card";
+
+static SemaphoreHandle_t sd_card_mutex = NULL;
+static StaticSemaphore_t sd_card_mutex_buf;
+
+static esp_vfs_fat_sdmmc_mount_config_t mount_config = {
+	.format_if_mount_failed = false,
+	.max_files = SD_CARD_MAX_FILES,
+	.allocation_unit_size = 16 * 1024
+};
+static sdmmc_host_t host = SDMMC_HOST_DEFAULT();
+static sdmmc_slot_config_t slot_config = SDMMC_SLOT_CONFIG_DEFAULT();
+static sdmmc_card_t* card;
+
+// Mounts not yet released (the card is mounted while non-zero)
+static int sd_card_users = 0;
+
+
+
+//
+// API
+//
+bool sd_card_init()
+{
+	// gCore supports the faster 4-bit mode
+	slot_config.width = 4;
+	slot_config.flags |= SDMMC_SLOT_FLAG_INTERNAL_PULLUP;
+	
+	sd_card_mutex = xSemaphoreCreateMutexStatic(&sd_card_mutex_buf);
+	if (sd_card_mutex == NULL) {
+		ESP_LOGE(TAG, "Could not create mutex");
+		return false;
+	}
+	
+	return true;
+}
+
+
+bool sd_card_mount()
+{
+	esp_err_t ret = ESP_OK;
+	
+	if (sd_card_mutex == NULL) return false;
+	
+	xSemaphoreTake(sd_card_mutex, portMAX_DELAY);
+	if (sd_card_users == 0) {
+		ret = esp_vfs_fat_sdmmc_mount(SD_CARD_MOUNT_POINT, &host, &slot_config, &mount_config, &card);
+		if (ret != ESP_OK) {
+			ESP_LOGE(TAG, "Could not mount the card (%s)", esp_err_to_name(ret));
+		}
+	}
+	if (ret == ESP_OK) {
+		sd_card_users++;
+	}
+	xSemaphoreGive(sd_card_mutex);
+	
+	return (ret == ESP_OK);
+}
+
+
+void sd_card_unmount()
+{
+	esp_err_t ret;
+	
+	if (sd_card_mutex == NULL) return;
+	
+	xSemaphoreTake(sd_card_mutex, portMAX_DELAY);
+	if (sd_card_users == 0) {
+		ESP_LOGE(TAG, "Unmount without a mount");
+	} else if (--sd_card_users == 0) {
+		// Card may be removed now
+		ret = esp_vfs_fat_sdcard_unmount(SD_CARD_MOUNT_POINT, card);
+		if (ret != ESP_OK) {
+			ESP_LOGE(TAG, "Could not unmount the card (%s)", esp_err_to_name(ret));
+		}
+	}
+	xSemaphoreGive(sd_card_mutex);
+}
+
+
+bool sd_card_is_mounted()
+{
+	return (sd_card_get_users() != 0);
+}
+
+
+int sd_card_get_users()
+{
+	int n;
+	
+	if (sd_card_mutex == NULL) return 0;
+	
+	xSemaphoreTake(sd_card_mutex, portMAX_DELAY);
+	n = sd_card_users;
+	xSemaphoreGive(sd_card_mutex);
+	
+	return n;
+}
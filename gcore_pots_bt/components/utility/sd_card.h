@@ -0,0 +1,55 @@
+/*
+ * sd_card - utility module owning the Micro-SD Card mount at SD_CARD_MOUNT_POINT for every
+ * module that uses the card.
+ *
+ * Mounts are counted: the first sd_card_mount mounts the card and the sd_card_unmount
+ * matching the last one unmounts it, so modules using the card at the same time (e.g. the
+ * answering machine recording a message while the call log is appended) share one mount.
+ * The mount allows SD_CARD_MAX_FILES files open at once across all of its users.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _SD_CARD_H_
+#define _SD_CARD_H_
+
+#include <stdbool.h>
+
+
+
+//
+// Constants
+//
+
+#define SD_CARD_MOUNT_POINT "/sdcard"
+
+// Files open at once across all users (fopen fails with ENFILE past this).  A call can have
+// an audio sample capture (4), an answering machine message and its index (2), a call log
+// append (1) and an HCI capture (1) open together; a pre-roll save (3) or stress card load (1)
+// takes the sample capture's place.  Each costs a FATFS file object while mounted.
+#define SD_CARD_MAX_FILES   8
+
+
+
+//
+// API
+//
+bool sd_card_init();                      // Call from app_main before the tasks start
+bool sd_card_mount();                     // Any task: false if the card couldn't be mounted
+void sd_card_unmount();                   // Once for each successful sd_card_mount
+bool sd_card_is_mounted();
+int sd_card_get_users();                  // Mounts not yet released
+
+#endif /* _SD_CARD_H_ */
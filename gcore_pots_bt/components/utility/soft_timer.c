@@ -0,0 +1,288 @@
+/*
+ * soft_timer - utility module providing the millisecond timers used by the tasks from one
+ * shared service driven by a single esp_timer.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "soft_timer.h"
+#include <string.h>
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "evt_bus.h"
+#include "freertos/semphr.h"
+
+
+//
+// Typedefs
+//
+typedef struct {
+	const char* name;
+	bool in_use;
+	bool running;
+	bool fired;                           // Expired since last started (cleared by soft_timer_expired)
+	TaskHandle_t* task;                   // Notification target (read when posting so it may be set
+	                                      // after the timer is created), NULL for an evt_bus target
+	uint32_t mask;
+	int q;
+	uint16_t id;
+	int64_t deadline_usec;
+	int64_t period_usec;                  // 0 for a one-shot
+} soft_timer_entry_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "soft_timer";
+
+static SemaphoreHandle_t soft_timer_mutex;
+static StaticSemaphore_t soft_timer_mutex_buf;
+static esp_timer_handle_t soft_timer_hw_timer;
+static int64_t soft_timer_armed_usec = 0;  // Deadline the esp_timer is running for, 0 when stopped
+
+static soft_timer_entry_t soft_timers[SOFT_TIMER_MAX_TIMERS];
+
+
+
+//
+// Forward declarations for internal functions
+//
+static int _softTimerCreate(const char* name);
+static void _softTimerStart(int t, uint32_t msec, bool periodic);
+static void _softTimerPost(soft_timer_entry_t* e);
+static void _softTimerArm();
+static void _softTimerCallback(void* arg);
+
+
+
+//
+// API
+//
+bool soft_timer_init()
+{
+	const esp_timer_create_args_t timer_args = {
+		.callback = &_softTimerCallback,
+		.name = "soft_timer"
+	};
+	
+	memset(soft_timers, 0, sizeof(soft_timers));
+	
+	soft_timer_mutex = xSemaphoreCreateMutexStatic(&soft_timer_mutex_buf);
+	if (soft_timer_mutex == NULL) {
+		ESP_LOGE(TAG, "Could not create mutex");
+		return false;
+	}
+	
+	if (esp_timer_create(&timer_args, &soft_timer_hw_timer) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not create esp_timer");
+		return false;
+	}
+	
+	return true;
+}
+
+
+int soft_timer_create_evt(const char* name, int q, uint16_t id)
+{
+	int t = _softTimerCreate(name);
+	
+	if (t != SOFT_TIMER_INVALID) {
+		soft_timers[t].q = q;
+		soft_timers[t].id = id;
+	}
+	return t;
+}
+
+
+int soft_timer_create_notify(const char* name, TaskHandle_t* task, uint32_t mask)
+{
+	int t = _softTimerCreate(name);
+	
+	if (t != SOFT_TIMER_INVALID) {
+		soft_timers[t].task = task;
+		soft_timers[t].mask = mask;
+	}
+	return t;
+}
+
+
+void soft_timer_start(int t, uint32_t msec)
+{
+	_softTimerStart(t, msec, false);
+}
+
+
+void soft_timer_start_periodic(int t, uint32_t msec)
+{
+	_softTimerStart(t, msec, true);
+}
+
+
+void soft_timer_stop(int t)
+{
+	if ((t < 0) || (t >= SOFT_TIMER_MAX_TIMERS)) return;
+	
+	xSemaphoreTake(soft_timer_mutex, portMAX_DELAY);
+	soft_timers[t].running = false;
+	soft_timers[t].fired = false;
+	_softTimerArm();
+	xSemaphoreGive(soft_timer_mutex);
+}
+
+
+bool soft_timer_running(int t)
+{
+	if ((t < 0) || (t >= SOFT_TIMER_MAX_TIMERS)) return false;
+	
+	// Access should be atomic so no mutex necessary
+	return soft_timers[t].running;
+}
+
+
+bool soft_timer_expired(int t)
+{
+	bool fired;
+	
+	if ((t < 0) || (t >= SOFT_TIMER_MAX_TIMERS)) return false;
+	
+	xSemaphoreTake(soft_timer_mutex, portMAX_DELAY);
+	fired = soft_timers[t].fired;
+	soft_timers[t].fired = false;
+	xSemaphoreGive(soft_timer_mutex);
+	
+	return fired;
+}
+
+
+
+//
+// Internal functions
+//
+static int _softTimerCreate(const char* name)
+{
+	int t;
+	
+	xSemaphoreTake(soft_timer_mutex, portMAX_DELAY);
+	for (t=0; t<SOFT_TIMER_MAX_TIMERS; t++) {
+		if (!soft_timers[t].in_use) {
+			memset(&soft_timers[t], 0, sizeof(soft_timer_entry_t));
+			soft_timers[t].name = name;
+			soft_timers[t].in_use = true;
+			break;
+		}
+	}
+	xSemaphoreGive(soft_timer_mutex);
+	
+	if (t == SOFT_TIMER_MAX_TIMERS) {
+		ESP_LOGE(TAG, "Could not create %s timer", name);
+		return SOFT_TIMER_INVALID;
+	}
+	return t;
+}
+
+
+static void _softTimerStart(int t, uint32_t msec, bool periodic)
+{
+	soft_timer_entry_t* e;
+	
+	if ((t < 0) || (t >= SOFT_TIMER_MAX_TIMERS) || !soft_timers[t].in_use) return;
+	if (periodic && (msec == 0)) return;
+	e = &soft_timers[t];
+	
+	xSemaphoreTake(soft_timer_mutex, portMAX_DELAY);
+	e->fired = false;
+	e->period_usec = periodic ? (int64_t) msec * 1000 : 0;
+	if (!periodic && (msec == 0)) {
+		// Expire now
+		e->running = false;
+		e->fired = true;
+		_softTimerPost(e);
+	} else {
+		e->running = true;
+		e->deadline_usec = esp_timer_get_time() + (int64_t) msec * 1000;
+	}
+	_softTimerArm();
+	xSemaphoreGive(soft_timer_mutex);
+}
+
+
+static void _softTimerPost(soft_timer_entry_t* e)
+{
+	if (e->task != NULL) {
+		if (*e->task != NULL) xTaskNotify(*e->task, e->mask, eSetBits);
+	} else {
+		evt_bus_send_id(e->q, e->id);
+	}
+}
+
+
+// Run the esp_timer for the earliest deadline (call with the mutex held)
+static void _softTimerArm()
+{
+	int t;
+	int64_t next_usec = 0;
+	int64_t now_usec;
+	
+	for (t=0; t<SOFT_TIMER_MAX_TIMERS; t++) {
+		if (soft_timers[t].running) {
+			if ((next_usec == 0) || (soft_timers[t].deadline_usec < next_usec)) {
+				next_usec = soft_timers[t].deadline_usec;
+			}
+		}
+	}
+	
+	if (next_usec == soft_timer_armed_usec) return;
+	
+	(void) esp_timer_stop(soft_timer_hw_timer);
+	soft_timer_armed_usec = next_usec;
+	if (next_usec != 0) {
+		now_usec = esp_timer_get_time();
+		if (esp_timer_start_once(soft_timer_hw_timer, (next_usec > now_usec) ? (uint64_t) (next_usec - now_usec) : 0) != ESP_OK) {
+			ESP_LOGE(TAG, "Start esp_timer failed");
+			soft_timer_armed_usec = 0;
+		}
+	}
+}
+
+
+static void _softTimerCallback(void* arg)
+{
+	int t;
+	int64_t now_usec;
+	soft_timer_entry_t* e;
+	
+	xSemaphoreTake(soft_timer_mutex, portMAX_DELAY);
+	now_usec = esp_timer_get_time();
+	for (t=0; t<SOFT_TIMER_MAX_TIMERS; t++) {
+		e = &soft_timers[t];
+		if (e->running && (e->deadline_usec <= now_usec)) {
+			e->fired = true;
+			_softTimerPost(e);
+			
+			if (e->period_usec != 0) {
+				// Stay on the original period unless we fell a whole period behind
+				e->deadline_usec += e->period_usec;
+				if (e->deadline_usec <= now_usec) e->deadline_usec = now_usec + e->period_usec;
+			} else {
+				e->running = false;
+			}
+		}
+	}
+	soft_timer_armed_usec = 0;
+	_softTimerArm();
+	xSemaphoreGive(soft_timer_mutex);
+}
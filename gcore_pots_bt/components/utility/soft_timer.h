@@ -0,0 +1,60 @@
+/*
+ * soft_timer - utility module providing the millisecond timers used by the tasks from one
+ * shared service.  A timer posts an event to an evt_bus queue or sets notification bits
+ * for a task when it expires so tasks can block until something happens instead of
+ * counting evaluation periods.  All timers are driven by a single esp_timer one-shot
+ * armed for the earliest deadline so nothing wakes up between deadlines.
+ *
+ * There are only a handful of timers so the earliest deadline is found by scanning them
+ * (cheaper here than maintaining a timer wheel).
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _SOFT_TIMER_H_
+#define _SOFT_TIMER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+
+
+//
+// Constants
+//
+
+// Maximum number of timers
+#define SOFT_TIMER_MAX_TIMERS   16
+
+// Returned by the create functions on failure (and safe to pass to the others)
+#define SOFT_TIMER_INVALID      -1
+
+
+
+//
+// API
+//
+bool soft_timer_init();                                                  // Call from app_main before the tasks start
+int soft_timer_create_evt(const char* name, int q, uint16_t id);          // Expiration sends evt_bus event id to queue q
+int soft_timer_create_notify(const char* name, TaskHandle_t* task, uint32_t mask);  // Expiration sets mask bits for *task
+void soft_timer_start(int t, uint32_t msec);                             // One-shot (re)start, 0 expires immediately
+void soft_timer_start_periodic(int t, uint32_t msec);
+void soft_timer_stop(int t);
+bool soft_timer_running(int t);
+bool soft_timer_expired(int t);  // True once for an expiration since the last start (ignores stale events)
+
+#endif /* _SOFT_TIMER_H_ */
@@ -0,0 +1,325 @@
+/*
+ * stress - utility module loading the whole system at once to hunt for audio deadline
+ * misses before a firmware is released.  See stress.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "stress.h"
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/unistd.h>
+#include "audio_task.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "gcore.h"
+#include "power_utilities.h"
+#include "sd_card.h"
+
+
+
+//
+// Constants
+//
+// Load tasks run on core 0 with the application tasks, below the ones handling calls
+#define STRESS_TASK_STACK      3072
+#define STRESS_I2C_TASK_PRIO   2
+#define STRESS_SD_TASK_PRIO    1
+#define STRESS_REPORT_PRIO     1
+
+// gCore I2C load - a register and an NVRAM block read every period (the snapshot isn't
+// used since reading STATUS would take button presses from gcore_task)
+#define STRESS_I2C_MSEC        5
+#define STRESS_I2C_NV_LEN      32
+
+// Micro-SD Card load - a burst of synced blocks rewriting the same file every period,
+// mounting the card for each burst like the call log and answering machine
+#define STRESS_SD_MSEC         1000
+#define STRESS_SD_BLOCK_LEN    4096
+#define STRESS_SD_BLOCKS       16
+
+// Time for the streams to start before the baseline statistics are taken
+#define STRESS_SETTLE_MSEC     2000
+
+
+
+//
+// Variables
+//
+static const char* TAG = "stress";
+
+static atomic_bool stress_active = false;
+
+static StackType_t stress_i2c_stack[STRESS_TASK_STACK];
+static StaticTask_t stress_i2c_tcb;
+static StackType_t stress_sd_stack[STRESS_TASK_STACK];
+static StaticTask_t stress_sd_tcb;
+static StackType_t stress_report_stack[STRESS_TASK_STACK];
+static StaticTask_t stress_report_tcb;
+
+// Worst-case latencies this report interval and for the whole test (uSec)
+static uint32_t lat_interval[STRESS_NUM_LAT];
+static uint32_t lat_max[STRESS_NUM_LAT];
+static uint32_t lat_count[STRESS_NUM_LAT];
+static portMUX_TYPE lat_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Failed load operations
+static uint32_t i2c_errors = 0;
+static uint32_t sd_errors = 0;
+
+static const char* lat_names[STRESS_NUM_LAT] = {"sco", "i2c", "sd", "gui"};
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _stress_i2c_task(void* args);
+static void _stress_sd_task(void* args);
+static bool _stress_sd_burst(uint8_t* buf);
+static void _stress_report_task(void* args);
+static void _stress_take_lat(uint32_t* interval, uint32_t* max, uint32_t* count, bool restart);
+
+
+
+//
+// API
+//
+void stress_init()
+{
+	atomic_store(&stress_active, true);
+	
+	xTaskCreateStaticPinnedToCore(&_stress_i2c_task, "stress_i2c", STRESS_TASK_STACK, NULL, STRESS_I2C_TASK_PRIO, stress_i2c_stack, &stress_i2c_tcb, 0);
+	xTaskCreateStaticPinnedToCore(&_stress_sd_task, "stress_sd", STRESS_TASK_STACK, NULL, STRESS_SD_TASK_PRIO, stress_sd_stack, &stress_sd_tcb, 0);
+	xTaskCreateStaticPinnedToCore(&_stress_report_task, "stress_report", STRESS_TASK_STACK, NULL, STRESS_REPORT_PRIO, stress_report_stack, &stress_report_tcb, 0);
+	
+	ESP_LOGW(TAG, "Stress test started (%d sec)", CONFIG_STRESS_TEST_SECS);
+}
+
+
+bool stress_running()
+{
+	return atomic_load(&stress_active);
+}
+
+
+void stress_record(int src, uint32_t usec)
+{
+	if ((src < 0) || (src >= STRESS_NUM_LAT)) return;
+	
+	portENTER_CRITICAL(&lat_mux);
+	if (usec > lat_interval[src]) lat_interval[src] = usec;
+	if (usec > lat_max[src]) lat_max[src] = usec;
+	lat_count[src]++;
+	portEXIT_CRITICAL(&lat_mux);
+}
+
+
+
+//
+// Internal functions
+//
+static void _stress_i2c_task(void* args)
+{
+	uint8_t nv[STRESS_I2C_NV_LEN];
+	uint16_t vb;
+	int64_t t;
+	
+	while (stress_running()) {
+		t = esp_timer_get_time();
+		if (gcore_get_reg16(GCORE_REG_VB, &vb) && gcore_get_nvram_bytes(0, nv, sizeof(nv))) {
+			stress_record(STRESS_LAT_I2C, (uint32_t) (esp_timer_get_time() - t));
+		} else {
+			i2c_errors++;
+		}
+		
+		vTaskDelay(pdMS_TO_TICKS(STRESS_I2C_MSEC));
+	}
+	
+	vTaskDelete(NULL);
+}
+
+
+static void _stress_sd_task(void* args)
+{
+	int i;
+	uint8_t* buf;
+	
+	// Card bursts come from PSRAM like the sample and answering machine writers
+	buf = (uint8_t*) heap_caps_malloc(STRESS_SD_BLOCK_LEN, MALLOC_CAP_SPIRAM);
+	if (buf == NULL) {
+		ESP_LOGE(TAG, "Could not allocate the card buffer - no card load");
+		vTaskDelete(NULL);
+	}
+	for (i=0; i<STRESS_SD_BLOCK_LEN; i++) {
+		buf[i] = (uint8_t) i;
+	}
+	
+	if (!power_get_sdcard_present()) {
+		ESP_LOGW(TAG, "No Micro-SD Card - no card load");
+	} else {
+		while (stress_running()) {
+			if (!_stress_sd_burst(buf)) {
+				sd_errors++;
+			}
+			vTaskDelay(pdMS_TO_TICKS(STRESS_SD_MSEC));
+		}
+	}
+	
+	heap_caps_free(buf);
+	vTaskDelete(NULL);
+}
+
+
+static bool _stress_sd_burst(uint8_t* buf)
+{
+	bool success = true;
+	int i;
+	int64_t t;
+	FILE* fp;
+	
+	if (!sd_card_mount()) {
+		return false;
+	}
+	
+	fp = fopen(SD_CARD_MOUNT_POINT "/stress.bin", "w");
+	if (fp == NULL) {
+		success = false;
+	} else {
+		for (i=0; i<STRESS_SD_BLOCKS; i++) {
+			t = esp_timer_get_time();
+			if ((fwrite(buf, 1, STRESS_SD_BLOCK_LEN, fp) != STRESS_SD_BLOCK_LEN) || (fflush(fp) != 0) ||
+			    (fsync(fileno(fp)) != 0)) {
+				success = false;
+				break;
+			}
+			stress_record(STRESS_LAT_SD, (uint32_t) (esp_timer_get_time() - t));
+		}
+		fclose(fp);
+	}
+	
+	sd_card_unmount();
+	
+	return success;
+}
+
+
+// Log the deadline misses and ring underruns during each interval (after the streams have
+// settled) with the worst-case latencies, and the verdict when the test ends
+static void _stress_report_task(void* args)
+{
+	audio_stats_t* s;
+	uint32_t base_misses;
+	uint32_t base_rx_underruns;
+	uint32_t base_tx_underruns;
+	uint32_t prev_misses;
+	uint32_t prev_rx_underruns;
+	uint32_t prev_tx_underruns;
+	uint32_t interval[STRESS_NUM_LAT];
+	uint32_t max[STRESS_NUM_LAT];
+	uint32_t count[STRESS_NUM_LAT];
+	uint32_t misses;
+	uint32_t rx_underruns;
+	uint32_t tx_underruns;
+	uint32_t secs = 0;
+	bool pass;
+	int i;
+	
+	// audio_stats_t is too big for the stack
+	s = (audio_stats_t*) heap_caps_malloc(sizeof(audio_stats_t), MALLOC_CAP_SPIRAM);
+	if (s == NULL) {
+		ESP_LOGE(TAG, "Could not allocate statistics - no reports");
+		vTaskDelete(NULL);
+	}
+	
+	vTaskDelay(pdMS_TO_TICKS(STRESS_SETTLE_MSEC));
+	audio_get_stats(s);
+	base_misses = prev_misses = s->deadline_misses;
+	base_rx_underruns = prev_rx_underruns = s->rx_underruns;
+	base_tx_underruns = prev_tx_underruns = s->tx_underruns;
+	_stress_take_lat(interval, max, count, true);
+	
+	while (true) {
+		vTaskDelay(pdMS_TO_TICKS(CONFIG_STRESS_TEST_REPORT_SECS * 1000));
+		secs += CONFIG_STRESS_TEST_REPORT_SECS;
+		
+		audio_get_stats(s);
+		misses = s->deadline_misses;
+		rx_underruns = s->rx_underruns;
+		tx_underruns = s->tx_underruns;
+		_stress_take_lat(interval, max, count, false);
+		
+		ESP_LOGI(TAG, "STRESS v=%d t=%u miss=%u rx_ur=%u tx_ur=%u rx_gap_us=%u load_pk=%d lec_lvl=%d sco_us=%u i2c_us=%u sd_us=%u gui_us=%u gui_n=%u err=%u/%u",
+		         STRESS_FORMAT_VERSION, secs, misses - prev_misses, rx_underruns - prev_rx_underruns,
+		         tx_underruns - prev_tx_underruns, s->max_rx_gap_cycles / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ,
+		         s->frame_load_peak_pct, s->lec_budget_level,
+		         interval[STRESS_LAT_SCO], interval[STRESS_LAT_I2C], interval[STRESS_LAT_SD], interval[STRESS_LAT_GUI],
+		         count[STRESS_LAT_GUI], i2c_errors, sd_errors);
+		prev_misses = misses;
+		prev_rx_underruns = rx_underruns;
+		prev_tx_underruns = tx_underruns;
+		
+		if ((CONFIG_STRESS_TEST_SECS != 0) && (secs >= CONFIG_STRESS_TEST_SECS)) break;
+	}
+	
+	// Stop the loads (bt_task stops the call and gui_task the screen changes)
+	atomic_store(&stress_active, false);
+	
+	misses -= base_misses;
+	rx_underruns -= base_rx_underruns;
+	tx_underruns -= base_tx_underruns;
+	pass = (misses == 0) && (rx_underruns == 0) && (tx_underruns == 0);
+	ESP_LOGI(TAG, "STRESS done v=%d t=%u miss=%u rx_ur=%u tx_ur=%u rx_gap_us=%u load_pk=%d lec_max_lvl=%d sco_us=%u i2c_us=%u sd_us=%u gui_us=%u %s",
+	         STRESS_FORMAT_VERSION, secs, misses, rx_underruns, tx_underruns,
+	         s->max_rx_gap_cycles / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ, s->frame_load_peak_pct, s->lec_budget_max_level,
+	         max[STRESS_LAT_SCO], max[STRESS_LAT_I2C], max[STRESS_LAT_SD], max[STRESS_LAT_GUI],
+	         pass ? "PASS" : "FAIL");
+	for (i=0; i<STRESS_NUM_LAT; i++) {
+		if (count[i] == 0) {
+			ESP_LOGW(TAG, "No %s load ran", lat_names[i]);
+		}
+	}
+	
+	heap_caps_free(s);
+	vTaskDelete(NULL);
+}
+
+
+// Copies the interval and test maximums and the cumulative counts, starting a new interval
+// (and the test when restart is set)
+static void _stress_take_lat(uint32_t* interval, uint32_t* max, uint32_t* count, bool restart)
+{
+	int i;
+	
+	portENTER_CRITICAL(&lat_mux);
+	for (i=0; i<STRESS_NUM_LAT; i++) {
+		interval[i] = lat_interval[i];
+		max[i] = lat_max[i];
+		count[i] = lat_count[i];
+		lat_interval[i] = 0;
+		if (restart) {
+			lat_max[i] = 0;
+			lat_count[i] = 0;
+		}
+	}
+	portEXIT_CRITICAL(&lat_mux);
+}
+
+#endif /* CONFIG_STRESS_TEST_ENABLE */
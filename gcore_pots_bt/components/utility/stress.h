@@ -0,0 +1,69 @@
+/*
+ * stress - utility module loading the whole system at once to hunt for audio deadline
+ * misses before a firmware is released.  bt_task stands in for the Bluetooth stack and runs
+ * a synthetic voice call through audio_task (with the echo canceller active), gui_task cycles
+ * through the screens and this module hammers gCore over I2C and writes to the Micro-SD Card.
+ *
+ * A "STRESS" line of key=value pairs is logged every CONFIG_STRESS_TEST_REPORT_SECS with the
+ * deadline misses and ring underruns during the interval and the worst-case latencies seen
+ * by each load.  A "STRESS done" line with the totals and a PASS/FAIL verdict ends the test
+ * after CONFIG_STRESS_TEST_SECS (0 to run until reset).
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _STRESS_H_
+#define _STRESS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Log format version (incremented if the meaning of an existing key changes)
+#define STRESS_FORMAT_VERSION 1
+
+// Latency sources (stress_record)
+#define STRESS_LAT_SCO        0   // Synthetic SCO packet delivered after it was due
+#define STRESS_LAT_I2C        1   // gCore register snapshot read
+#define STRESS_LAT_SD         2   // Micro-SD Card block write
+#define STRESS_LAT_GUI        3   // Screen change and full redraw
+
+#define STRESS_NUM_LAT        4
+
+// Synthetic SCO packet (CVSD, 60 samples every 7.5 mSec like a phone's eSCO link)
+#define STRESS_SCO_SAMPLES    60
+#define STRESS_SCO_USEC       7500
+
+// Screen change interval
+#define STRESS_GUI_MSEC       1000
+
+
+
+//
+// API
+//
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+void stress_init();                       // Starts the I2C, Micro-SD Card and report tasks
+bool stress_running();                    // False once the test has ended
+void stress_record(int src, uint32_t usec);  // Callable from any task
+#endif
+
+#endif /* _STRESS_H_ */
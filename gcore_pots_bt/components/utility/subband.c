@@ -0,0 +1,149 @@
+/*
+ * subband - utility module splitting a 16 kHz signal into two 8 kHz bands and merging
+ * them again, with a high band echo suppressor.  See subband.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "subband.h"
+#include <math.h>
+#include <stdlib.h>
+
+
+//
+// API
+//
+void subband_init_split(subband_split_t* s, int quality)
+{
+	resample_init_down2(&s->lo, quality);
+	resample_init_down2(&s->hi, quality);
+	s->sign = 1;
+}
+
+
+int subband_split(subband_split_t* s, const int16_t* in, int len, int16_t* lo, int16_t* hi)
+{
+	int16_t shifted[SUBBAND_CHUNK];
+	int i, n;
+	int out_len = 0;
+	
+	while (len > 0) {
+		n = (len > SUBBAND_CHUNK) ? SUBBAND_CHUNK : len;
+		
+		// Shift the high band down to 0-4 kHz (INT16_MIN can't be negated)
+		for (i=0; i<n; i++) {
+			shifted[i] = ((s->sign < 0) && (in[i] == INT16_MIN)) ? INT16_MAX : in[i] * s->sign;
+			s->sign = -s->sign;
+		}
+		(void) resample_down2(&s->lo, in, n, &lo[out_len]);
+		out_len += resample_down2(&s->hi, shifted, n, &hi[out_len]);
+		
+		in += n;
+		len -= n;
+	}
+	
+	return out_len;
+}
+
+
+void subband_init_merge(subband_merge_t* s, int quality)
+{
+	resample_init_up2(&s->lo, quality);
+	resample_init_up2(&s->hi, quality);
+	s->sign = 1;
+}
+
+
+int subband_merge(subband_merge_t* s, const int16_t* lo, const int16_t* hi, int len, int16_t* out)
+{
+	int16_t lo_up[SUBBAND_CHUNK];
+	int16_t hi_up[SUBBAND_CHUNK];
+	int32_t t;
+	int i, n;
+	int out_len = 0;
+	
+	while (len > 0) {
+		n = (len > (SUBBAND_CHUNK / 2)) ? (SUBBAND_CHUNK / 2) : len;
+		(void) resample_up2(&s->lo, lo, n, lo_up);
+		(void) resample_up2(&s->hi, hi, n, hi_up);
+		
+		// Shift the high band back up and add the bands
+		for (i=0; i<2*n; i++) {
+			t = (int32_t) lo_up[i] + s->sign * (int32_t) hi_up[i];
+			s->sign = -s->sign;
+			out[out_len++] = (t > 32767) ? 32767 : ((t < -32768) ? -32768 : (int16_t) t);
+		}
+		
+		lo += n;
+		hi += n;
+		len -= n;
+	}
+	
+	return out_len;
+}
+
+
+void subband_init_sup(subband_sup_t* s, int tail_msec, int sample_rate)
+{
+	int tail = tail_msec * sample_rate / 1000;
+	
+	// The far end peak decays by about 1/e over the tail
+	s->decay_shift = 0;
+	while ((1 << (s->decay_shift + 1)) <= tail) s->decay_shift++;
+	s->tx_env = 0;
+	s->rx_env = 0;
+	s->hang_len = SUBBAND_SUP_HANG_MSEC * sample_rate / 1000;
+	s->hang = 0;
+	s->gain_q15 = 32767;
+	s->atten_q15 = (int32_t) (32767.0f * powf(10.0f, -SUBBAND_SUP_ATTEN_DB / 20.0f));
+	s->erl_q15 = (int32_t) (32767.0f * powf(10.0f, -SUBBAND_SUP_ERL_DB / 20.0f));
+	s->suppressed = 0;
+}
+
+
+void subband_sup_process(subband_sup_t* s, const int16_t* tx, int16_t* rx, int len)
+{
+	int32_t a, target, g, step;
+	int i;
+	
+	if (len <= 0) return;
+	
+	for (i=0; i<len; i++) {
+		a = abs(tx[i]);
+		s->tx_env = (a > s->tx_env) ? a : (s->tx_env - (s->tx_env >> s->decay_shift));
+		a = abs(rx[i]);
+		s->rx_env = (a > s->rx_env) ? a : (s->rx_env - (s->rx_env >> 4));
+		
+		// Geigel test - the line is louder than the echo of the far end could be
+		if (s->rx_env > ((s->tx_env * s->erl_q15) >> 15)) {
+			s->hang = s->hang_len;
+		} else if (s->hang > 0) {
+			s->hang--;
+		}
+	}
+	
+	// Ramp to this block's gain across the block so the changes don't click
+	target = ((s->hang == 0) && (s->tx_env >= SUBBAND_SUP_TX_MIN)) ? s->atten_q15 : 32767;
+	if ((target == 32767) && (s->gain_q15 == 32767)) return;
+	
+	g = s->gain_q15;
+	step = (target - g) / len;
+	for (i=0; i<len; i++) {
+		g += step;
+		rx[i] = (int16_t) ((rx[i] * g) >> 15);
+	}
+	s->gain_q15 = target;
+	if (target != 32767) s->suppressed += len;
+}
@@ -0,0 +1,97 @@
+/*
+ * subband - utility module splitting a 16 kHz signal into 0-4 kHz and 4-8 kHz bands, each
+ * at 8 kHz, and merging the two bands back again.  It is a QMF pair built from the resample
+ * module's half-band filters: the low band is the decimated signal and the high band is the
+ * signal shifted down by 8 kHz (every other sample negated) and then decimated, so it is
+ * spectrally inverted.  Merging interpolates both bands and shifts the high band back up.
+ * Outside the filters' transition band around 4 kHz the pair is flat and alias free.
+ *
+ * A cheap suppressor for the high band of a subband echo canceller is included.  It
+ * follows the far end (reference) and line peaks in the band and, while the line is no
+ * louder than the echo of the far end could be, ramps the band down by SUBBAND_SUP_ATTEN_DB.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _SUBBAND_H_
+#define _SUBBAND_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "resample.h"
+
+
+
+//
+// Constants
+//
+
+// Samples split or merged at a time (internal buffer length, any length may be passed)
+#define SUBBAND_CHUNK            64
+
+// High band suppressor
+//   Attenuation of the band while only echo is heard
+//   Echo is assumed no louder than the far end less SUBBAND_SUP_ERL_DB (the line is near end
+//   speech once it is louder)
+//   Near end speech keeps the band open for SUBBAND_SUP_HANG_MSEC
+//   Far end peaks below SUBBAND_SUP_TX_MIN can't echo audibly
+#define SUBBAND_SUP_ATTEN_DB     24
+#define SUBBAND_SUP_ERL_DB       6
+#define SUBBAND_SUP_HANG_MSEC    40
+#define SUBBAND_SUP_TX_MIN       64
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	resample_state_t lo;                  // Decimators
+	resample_state_t hi;
+	int16_t sign;                         // Shift (+/-1) of the next input sample
+} subband_split_t;
+
+typedef struct {
+	resample_state_t lo;                  // Interpolators
+	resample_state_t hi;
+	int16_t sign;                         // Shift (+/-1) of the next output sample
+} subband_merge_t;
+
+typedef struct {
+	int32_t tx_env;                       // Far end and line peak followers
+	int32_t rx_env;
+	int decay_shift;                      // Peak follower decay per sample (>> shift)
+	int hang;                             // Samples left before the band may be suppressed
+	int hang_len;
+	int32_t gain_q15;                     // Gain reached at the end of the last block
+	int32_t atten_q15;
+	int32_t erl_q15;
+	uint32_t suppressed;                  // Samples suppressed
+} subband_sup_t;
+
+
+
+//
+// API
+//
+void subband_init_split(subband_split_t* s, int quality);
+int subband_split(subband_split_t* s, const int16_t* in, int len, int16_t* lo, int16_t* hi);  // Returns band samples
+void subband_init_merge(subband_merge_t* s, int quality);
+int subband_merge(subband_merge_t* s, const int16_t* lo, const int16_t* hi, int len, int16_t* out);  // Returns 2*len
+
+void subband_init_sup(subband_sup_t* s, int tail_msec, int sample_rate);
+void subband_sup_process(subband_sup_t* s, const int16_t* tx, int16_t* rx, int len);  // rx is modified in place
+
+#endif /* _SUBBAND_H_ */
@@ -0,0 +1,205 @@
+/*
+ * sys_mon - utility module sampling the per-task CPU use and stack headroom and the
+ * heap levels for a lock-free snapshot.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sys_mon.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/task.h"
+
+
+//
+// Variables
+//
+static const char* TAG = "sys_mon";
+
+// Published snapshot is snap[snap_seq & 1]
+static sys_mon_snapshot_t snap[2];
+static atomic_uint snap_seq = 0;
+
+#if (configUSE_TRACE_FACILITY == 1)
+static TaskStatus_t task_status[SYS_MON_MAX_TASKS];
+
+// Run time counters from the previous sample
+static int prev_num_tasks = 0;
+static UBaseType_t prev_task_number[SYS_MON_MAX_TASKS];
+static uint32_t prev_task_run_time[SYS_MON_MAX_TASKS];
+static uint32_t prev_total_run_time = 0;
+#endif
+
+
+
+//
+// Forward declarations for internal functions
+//
+#if (configUSE_TRACE_FACILITY == 1)
+static void _sysMonSampleTasks(sys_mon_snapshot_t* s);
+#endif
+static const char* _sysMonPctStr(char* buf, int16_t pct_x10);
+
+
+
+//
+// API
+//
+void sys_mon_sample(bool log)
+{
+	unsigned int seq = atomic_load(&snap_seq);
+	sys_mon_snapshot_t* s = &snap[(seq + 1) & 1];
+	int i;
+	
+	s->uptime_sec = (uint32_t) (esp_timer_get_time() / 1000000);
+	
+	s->int_free = heap_caps_get_free_size(MALLOC_CAP_INTERNAL);
+	s->int_min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_INTERNAL);
+	s->int_largest = heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL);
+	s->spiram_free = heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+	s->spiram_min_free = heap_caps_get_minimum_free_size(MALLOC_CAP_SPIRAM);
+	s->spiram_largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+	
+	for (i=0; i<portNUM_PROCESSORS; i++) {
+		s->idle_pct_x10[i] = -1;
+	}
+	s->num_tasks = 0;
+#if (configUSE_TRACE_FACILITY == 1)
+	_sysMonSampleTasks(s);
+#endif
+	
+	// Publish (readers copying the other buffer see the count change and retry)
+	atomic_store(&snap_seq, seq + 1);
+	
+	if (log) {
+		sys_mon_print(s);
+	}
+}
+
+
+void sys_mon_get_snapshot(sys_mon_snapshot_t* s)
+{
+	unsigned int seq;
+	
+	// The sampler only writes the buffer we're copying after publishing the other one
+	do {
+		seq = atomic_load(&snap_seq);
+		memcpy(s, &snap[seq & 1], sizeof(sys_mon_snapshot_t));
+	} while (atomic_load(&snap_seq) != seq);
+}
+
+
+void sys_mon_print(const sys_mon_snapshot_t* s)
+{
+	int i;
+	char pct_buf[8];
+	char pct_buf2[8];
+	
+	ESP_LOGI(TAG, "Up %u sec  idle %s%% / %s%%", s->uptime_sec, _sysMonPctStr(pct_buf, s->idle_pct_x10[0]),
+	         _sysMonPctStr(pct_buf2, s->idle_pct_x10[portNUM_PROCESSORS-1]));
+	ESP_LOGI(TAG, "  INT heap    free %u  min %u  largest %u", s->int_free, s->int_min_free, s->int_largest);
+	ESP_LOGI(TAG, "  PSRAM heap  free %u  min %u  largest %u", s->spiram_free, s->spiram_min_free, s->spiram_largest);
+	for (i=0; i<s->num_tasks; i++) {
+		ESP_LOGI(TAG, "  %-16s core %2d  pri %2u  cpu %5s%%  stack free %u", s->task[i].name, s->task[i].core,
+		         s->task[i].priority, _sysMonPctStr(pct_buf, s->task[i].cpu_pct_x10), s->task[i].stack_free);
+	}
+}
+
+
+
+//
+// Internal functions
+//
+#if (configUSE_TRACE_FACILITY == 1)
+static void _sysMonSampleTasks(sys_mon_snapshot_t* s)
+{
+	int i, j, n;
+	uint32_t total_run_time = 0;
+	uint32_t dt;
+	uint32_t dtask;
+	int16_t pct;
+	BaseType_t core;
+	sys_mon_task_t t;
+	
+	n = (int) uxTaskGetSystemState(task_status, SYS_MON_MAX_TASKS, &total_run_time);
+	if (n == 0) {
+		ESP_LOGW(TAG, "More than %d tasks", SYS_MON_MAX_TASKS);
+		return;
+	}
+	dt = total_run_time - prev_total_run_time;
+	
+	for (i=0; i<n; i++) {
+		strncpy(s->task[i].name, task_status[i].pcTaskName, configMAX_TASK_NAME_LEN);
+		s->task[i].name[configMAX_TASK_NAME_LEN-1] = 0;
+		core = xTaskGetAffinity(task_status[i].xHandle);
+		s->task[i].core = (core == tskNO_AFFINITY) ? -1 : (int8_t) core;
+		s->task[i].priority = (uint8_t) task_status[i].uxCurrentPriority;
+		s->task[i].stack_free = (uint32_t) task_status[i].usStackHighWaterMark;
+		
+		// Run time since the last sample for tasks that existed then
+		pct = -1;
+#if (configGENERATE_RUN_TIME_STATS == 1)
+		for (j=0; j<prev_num_tasks; j++) {
+			if (prev_task_number[j] == task_status[i].xTaskNumber) {
+				dtask = task_status[i].ulRunTimeCounter - prev_task_run_time[j];
+				if (dt != 0) pct = (int16_t) (((uint64_t) dtask * 1000) / dt);
+				break;
+			}
+		}
+#endif
+		s->task[i].cpu_pct_x10 = pct;
+		
+		for (j=0; j<portNUM_PROCESSORS; j++) {
+			if (task_status[i].xHandle == xTaskGetIdleTaskHandleForCPU(j)) {
+				s->idle_pct_x10[j] = pct;
+			}
+		}
+	}
+	
+	for (i=0; i<n; i++) {
+		prev_task_number[i] = task_status[i].xTaskNumber;
+		prev_task_run_time[i] = task_status[i].ulRunTimeCounter;
+	}
+	prev_num_tasks = n;
+	prev_total_run_time = total_run_time;
+	s->num_tasks = n;
+	
+	// Order by stack headroom so the tightest stacks come first
+	for (i=1; i<n; i++) {
+		t = s->task[i];
+		for (j=i; (j > 0) && (s->task[j-1].stack_free > t.stack_free); j--) {
+			s->task[j] = s->task[j-1];
+		}
+		s->task[j] = t;
+	}
+}
+#endif
+
+
+static const char* _sysMonPctStr(char* buf, int16_t pct_x10)
+{
+	if (pct_x10 < 0) {
+		strcpy(buf, "-");
+	} else if (pct_x10 >= 1000) {
+		strcpy(buf, "100");
+	} else {
+		sprintf(buf, "%d.%d", pct_x10 / 10, pct_x10 % 10);
+	}
+	return buf;
+}
@@ -0,0 +1,77 @@
+/*
+ * sys_mon - utility module sampling the per-task CPU use and stack headroom and the
+ * internal RAM and PSRAM heap levels.  One task calls sys_mon_sample periodically and
+ * any task can get a copy of the last sample without taking a lock (the sampler fills
+ * one of two buffers and publishes it with a sequence count readers check).
+ *
+ * CPU use comes from the FreeRTOS run time statistics (CONFIG_FREERTOS_GENERATE_RUN_TIME_STATS)
+ * which charge interrupt time to the interrupted task so there is no separate ISR figure.
+ * Nothing but the heap levels is available without CONFIG_FREERTOS_USE_TRACE_FACILITY.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _SYS_MON_H_
+#define _SYS_MON_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+
+
+
+//
+// Constants
+//
+
+// Most tasks reported (more than are running so uxTaskGetSystemState doesn't fail)
+#define SYS_MON_MAX_TASKS   32
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	char name[configMAX_TASK_NAME_LEN];
+	int8_t core;                          // -1 when not pinned
+	uint8_t priority;
+	int16_t cpu_pct_x10;                  // Of one core since the previous sample, -1 if unknown
+	uint32_t stack_free;                  // Least free stack ever seen (bytes)
+} sys_mon_task_t;
+
+typedef struct {
+	uint32_t uptime_sec;
+	int16_t idle_pct_x10[portNUM_PROCESSORS];  // -1 if unknown
+	uint32_t int_free;                    // Internal RAM heap (bytes)
+	uint32_t int_min_free;
+	uint32_t int_largest;
+	uint32_t spiram_free;                 // PSRAM heap (bytes)
+	uint32_t spiram_min_free;
+	uint32_t spiram_largest;
+	int num_tasks;
+	sys_mon_task_t task[SYS_MON_MAX_TASKS];  // Least stack headroom first
+} sys_mon_snapshot_t;
+
+
+
+//
+// API
+//
+void sys_mon_sample(bool log);                    // Call from one task only, log prints the new sample
+void sys_mon_get_snapshot(sys_mon_snapshot_t* s); // Lock-free, callable from any task
+void sys_mon_print(const sys_mon_snapshot_t* s);
+
+#endif /* _SYS_MON_H_ */
@@ -0,0 +1,184 @@
+/*
+ * sys_status - utility module holding one versioned snapshot of the system status.  See
+ * sys_status.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "sys_status.h"
+#include <stdatomic.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+
+
+
+//
+// Variables
+//
+
+// Serializes writers, readers don't use it
+static portMUX_TYPE sys_status_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Odd while a writer is changing the snapshot
+static atomic_uint_least32_t sys_status_seq = 0;
+
+static sys_status_t sys_status;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _sysStatusWriteBegin();
+static void _sysStatusWriteEnd();
+static uint32_t _sysStatusReadBegin();
+static bool _sysStatusReadEnd(uint32_t seq);
+static uint32_t _sysStatusRead(void* dst, const void* src, size_t len);
+
+
+
+//
+// API
+//
+void sys_status_publish_app(const sys_status_app_t* app)
+{
+	_sysStatusWriteBegin();
+	memcpy(&sys_status.app, app, sizeof(sys_status_app_t));
+	_sysStatusWriteEnd();
+}
+
+
+void sys_status_publish_power(const sys_status_power_t* power)
+{
+	_sysStatusWriteBegin();
+	sys_status.power = *power;
+	_sysStatusWriteEnd();
+}
+
+
+void sys_status_publish_link(const sys_status_link_t* link)
+{
+	_sysStatusWriteBegin();
+	sys_status.link = *link;
+	_sysStatusWriteEnd();
+}
+
+
+void sys_status_get(sys_status_t* status)
+{
+	status->version = _sysStatusRead(status, &sys_status, sizeof(sys_status_t));
+}
+
+
+app_state_t sys_status_get_app_state()
+{
+	app_state_t st;
+	
+	(void) _sysStatusRead(&st, &sys_status.app.state, sizeof(app_state_t));
+	return st;
+}
+
+
+int sys_status_get_dial_num(char* pn)
+{
+	int n;
+	uint32_t seq;
+	
+	do {
+		seq = _sysStatusReadBegin();
+		n = sys_status.app.dial_len;
+		if ((n < 0) || (n > APP_MAX_DIALED_DIGITS)) n = 0;  // Torn, the read is retried
+		memcpy(pn, sys_status.app.dial_num, n);
+	} while (!_sysStatusReadEnd(seq));
+	pn[n] = 0;
+	
+	return n;
+}
+
+
+int sys_status_get_cid_num(char* pn, bool cw)
+{
+	(void) _sysStatusRead(pn, cw ? sys_status.app.cw_num : sys_status.app.cid_num, SYS_STATUS_NUM_LEN+1);
+	return strlen(pn);
+}
+
+
+void sys_status_get_power(sys_status_power_t* power)
+{
+	(void) _sysStatusRead(power, &sys_status.power, sizeof(sys_status_power_t));
+}
+
+
+void sys_status_get_link(sys_status_link_t* link)
+{
+	(void) _sysStatusRead(link, &sys_status.link, sizeof(sys_status_link_t));
+}
+
+
+uint32_t sys_status_get_version()
+{
+	return atomic_load(&sys_status_seq) >> 1;
+}
+
+
+
+//
+// Internal functions
+//
+static void _sysStatusWriteBegin()
+{
+	portENTER_CRITICAL(&sys_status_mux);
+	atomic_store_explicit(&sys_status_seq, atomic_load_explicit(&sys_status_seq, memory_order_relaxed) + 1, memory_order_relaxed);
+	atomic_thread_fence(memory_order_release);
+}
+
+
+static void _sysStatusWriteEnd()
+{
+	atomic_store_explicit(&sys_status_seq, atomic_load_explicit(&sys_status_seq, memory_order_relaxed) + 1, memory_order_release);
+	portEXIT_CRITICAL(&sys_status_mux);
+}
+
+
+static uint32_t _sysStatusReadBegin()
+{
+	uint32_t seq;
+	
+	// A writer can't be preempted so any wait here is only as long as its copy
+	while ((seq = atomic_load_explicit(&sys_status_seq, memory_order_acquire)) & 1) {}
+	return seq;
+}
+
+
+// Returns false if a writer changed the snapshot during the read
+static bool _sysStatusReadEnd(uint32_t seq)
+{
+	atomic_thread_fence(memory_order_acquire);
+	return (atomic_load_explicit(&sys_status_seq, memory_order_relaxed) == seq);
+}
+
+
+// Copy part of the snapshot, returning its version
+static uint32_t _sysStatusRead(void* dst, const void* src, size_t len)
+{
+	uint32_t seq;
+	
+	do {
+		seq = _sysStatusReadBegin();
+		memcpy(dst, src, len);
+	} while (!_sysStatusReadEnd(seq));
+	
+	return seq >> 1;
+}
@@ -0,0 +1,110 @@
+/*
+ * sys_status - utility module holding one versioned snapshot of the system status other
+ * tasks display or report: app_task's state and phone numbers, the battery and charge state
+ * from gcore_task and the Bluetooth link and audio counters bt_task samples each
+ * BT_LINK_MON_MSEC.  Each task publishes its own part when it changes and readers (the GUI,
+ * telemetry, the console) copy what they need from it.
+ *
+ * The snapshot is protected by a sequence lock.  A publish runs in a short critical section
+ * (so a writer can't be preempted mid-update and writers on both cores are serialized) and
+ * makes the sequence count odd while it changes the snapshot.  Readers never take a lock:
+ * they copy the snapshot and try again if the count was odd or changed during the copy, so
+ * they neither block a writer nor see a torn update.  The whole snapshot is large for the
+ * task stacks so most readers copy just the item or part they need.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _SYS_STATUS_H_
+#define _SYS_STATUS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "app_task.h"
+
+
+
+//
+// Constants
+//
+
+// Longest Caller ID or waiting caller number (ESP_BT_HF_NUMBER_LEN)
+#define SYS_STATUS_NUM_LEN       32
+
+
+
+//
+// Typedefs
+//
+
+// Published by app_task
+typedef struct {
+	app_state_t state;
+	bool bt_in_service;
+	int dial_len;
+	char dial_num[APP_MAX_DIALED_DIGITS+1];
+	char cid_num[SYS_STATUS_NUM_LEN+1];   // Empty when unknown
+	char cw_num[SYS_STATUS_NUM_LEN+1];    // Waiting caller
+} sys_status_app_t;
+
+// Published by gcore_task
+typedef struct {
+	int batt_state;                       // enum BATT_STATE_t
+	int charge_state;                     // enum CHARGE_STATE_t
+} sys_status_power_t;
+
+// Published by bt_task
+typedef struct {
+	int profile;                          // BT_LINK_PROFILE_*
+	bool audio_connected;
+	bool msbc;
+	int quality;                          // BT_LINK_QUALITY_*
+	int rssi_delta;
+	uint32_t missed_packets;
+	uint32_t jitter_usec;
+	uint32_t deadline_misses;             // Audio counters (audio_stats_t)
+	uint32_t rx_underruns;
+	uint32_t tx_underruns;
+	uint32_t plc_events;
+	uint32_t jb_concealments;
+} sys_status_link_t;
+
+typedef struct {
+	uint32_t version;                     // Counts publishes, unchanged means nothing has changed
+	sys_status_app_t app;
+	sys_status_power_t power;
+	sys_status_link_t link;
+} sys_status_t;
+
+
+
+//
+// API
+//
+// Writers
+void sys_status_publish_app(const sys_status_app_t* app);
+void sys_status_publish_power(const sys_status_power_t* power);
+void sys_status_publish_link(const sys_status_link_t* link);
+
+// Readers (each copy is consistent, parts read with separate calls may be from different versions)
+void sys_status_get(sys_status_t* status);
+app_state_t sys_status_get_app_state();
+int sys_status_get_dial_num(char* pn);            // pn must have APP_MAX_DIALED_DIGITS + 1 characters
+int sys_status_get_cid_num(char* pn, bool cw);    // pn must have SYS_STATUS_NUM_LEN + 1 characters
+void sys_status_get_power(sys_status_power_t* power);
+void sys_status_get_link(sys_status_link_t* link);
+uint32_t sys_status_get_version();
+
+#endif /* _SYS_STATUS_H_ */
@@ -0,0 +1,473 @@
+/*
+ * systrace - utility module recording task switches and work markers on both cores into
+ * PSRAM and saving them as SystemView files.  See systrace.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "systrace.h"
+#if (CONFIG_SYSTRACE_ENABLE == true)
+#include "systrace_hooks.h"
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "esp_attr.h"
+#include "esp_heap_caps.h"
+#include "esp_log.h"
+#include "esp_spi_flash.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sd_card.h"
+
+
+//
+// Constants
+//
+// Records per core
+#define SYSTRACE_RING_LEN  ((CONFIG_SYSTRACE_BUF_KB * 1024) / (portNUM_PROCESSORS * sizeof(systrace_rec_t)))
+
+// Time for an append in progress on the other core to finish after recording is disabled
+#define SYSTRACE_STOP_MSEC 10
+
+// Task notifications
+#define SYSTRACE_NOTIFY_TRIGGER  0x01
+#define SYSTRACE_NOTIFY_SAVE     0x02
+
+// Record types (top byte of a record's event word)
+#define REC_EXEC           1    // Task switched in (task ID)
+#define REC_READY          2    // Task made ready (task ID)
+#define REC_USER_START     3    // Marker start (marker ID)
+#define REC_USER_STOP      4    // Marker stop (marker ID)
+
+// Task IDs are TCB addresses compressed the way SystemView expects (TCBs are in internal
+// RAM or PSRAM so this fits the 24 bits of a record)
+#define SYSTRACE_RAM_BASE  0x3F800000
+#define SYSTRACE_ID_SHIFT  2
+
+// Most tasks named in a recording
+#define SYSTRACE_MAX_TASKS 32
+
+// SystemView event IDs (IDs from SV_EVTID_FIRST_LONG up carry a payload length)
+#define SV_EVTID_TASK_START_EXEC   4
+#define SV_EVTID_TASK_START_READY  6
+#define SV_EVTID_TASK_INFO         9
+#define SV_EVTID_TRACE_START       10
+#define SV_EVTID_TRACE_STOP        11
+#define SV_EVTID_SYSTIME_US        13
+#define SV_EVTID_SYSDESC           14
+#define SV_EVTID_USER_START        15
+#define SV_EVTID_USER_STOP         16
+#define SV_EVTID_IDLE              17
+#define SV_EVTID_FIRST_LONG        24
+#define SV_EVTID_INIT              24
+#define SV_EVTID_NUMMODULES        27
+
+// SystemView file
+#define SV_SYNC_LEN                10
+#define SV_MAX_STR                 128
+#define SV_MAX_PACKET              (SV_MAX_STR + 32)
+#define SV_OUT_BUF_LEN             2048
+#define SV_FILE_HEADER             ";\n; Version     SEGGER SystemViewer V2.42\n; Author      weeBell\n;\n"
+#define SV_SYS_DESC                "N=weeBell,D=ESP32,C=Xtensa,O=FreeRTOS"
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t usec;                   // esp_timer time (low 32 bits)
+	uint32_t evt;                    // REC_* << 24 | ID
+} systrace_rec_t;
+
+typedef struct {
+	systrace_rec_t* buf;             // SYSTRACE_RING_LEN records in PSRAM
+	uint32_t idx;                    // Next record written
+	bool wrapped;
+} systrace_ring_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "systrace";
+
+// Rings - each is only appended to by its own core with interrupts masked
+static systrace_ring_t rings[portNUM_PROCESSORS];
+static atomic_bool rec_enable = false;
+
+// Saving task
+static TaskHandle_t task_handle_systrace;
+static StackType_t systrace_task_stack[SYSTRACE_TASK_STACK];
+static StaticTask_t systrace_task_tcb;
+static atomic_bool save_pending = false;
+static TickType_t last_save_tick;
+static int file_num = 1;
+
+// Task names and idle tasks for the files
+#if (configUSE_TRACE_FACILITY == 1)
+static TaskStatus_t task_status[SYSTRACE_MAX_TASKS];
+#endif
+static int num_tasks;
+static uint32_t idle_id[portNUM_PROCESSORS];
+
+// File output
+static FILE* out_fp;
+static uint8_t out_buf[SV_OUT_BUF_LEN];
+static int out_len;
+static uint32_t out_last_usec;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _systrace_append(uint32_t evt);
+static uint32_t _systrace_task_id(void* tcb);
+static void _systrace_task(void* args);
+static void _systrace_reset();
+static void _systrace_save_files();
+static void _systrace_get_tasks();
+static void _systrace_write_core(int core);
+static void _systrace_packet(int evt_id, const uint8_t* payload, int len, uint32_t usec);
+static void _systrace_flush();
+static uint8_t* _systrace_put_u32(uint8_t* p, uint32_t v);
+static uint8_t* _systrace_put_str(uint8_t* p, const char* s);
+
+
+
+//
+// API
+//
+bool systrace_init()
+{
+	for (int i=0; i<portNUM_PROCESSORS; i++) {
+		rings[i].buf = (systrace_rec_t*) heap_caps_malloc(SYSTRACE_RING_LEN * sizeof(systrace_rec_t), MALLOC_CAP_SPIRAM);
+		if (rings[i].buf == NULL) {
+			ESP_LOGE(TAG, "Could not allocate the trace ring");
+			return false;
+		}
+	}
+	
+	task_handle_systrace = xTaskCreateStaticPinnedToCore(&_systrace_task, "systrace_task", SYSTRACE_TASK_STACK, NULL, SYSTRACE_TASK_PRIO, systrace_task_stack, &systrace_task_tcb, 0);
+	if (task_handle_systrace == NULL) {
+		ESP_LOGE(TAG, "Could not start the trace task");
+		return false;
+	}
+	
+	_systrace_reset();
+	atomic_store(&rec_enable, true);
+	ESP_LOGI(TAG, "Recording %u events per core", SYSTRACE_RING_LEN);
+	
+	return true;
+}
+
+
+void IRAM_ATTR systrace_mark(int id, bool start)
+{
+	_systrace_append(((start ? REC_USER_START : REC_USER_STOP) << 24) | (uint32_t) id);
+}
+
+
+void systrace_trigger()
+{
+	if (task_handle_systrace == NULL) return;
+	
+	if (!atomic_load(&save_pending) && ((xTaskGetTickCount() - last_save_tick) >= pdMS_TO_TICKS(SYSTRACE_HOLDOFF_MSEC))) {
+		atomic_store(&save_pending, true);
+		xTaskNotify(task_handle_systrace, SYSTRACE_NOTIFY_TRIGGER, eSetBits);
+	}
+}
+
+
+void systrace_save()
+{
+	if (task_handle_systrace == NULL) return;
+	
+	if (!atomic_load(&save_pending)) {
+		atomic_store(&save_pending, true);
+		xTaskNotify(task_handle_systrace, SYSTRACE_NOTIFY_SAVE, eSetBits);
+	}
+}
+
+
+void IRAM_ATTR systrace_hook_switched_in(void* tcb)
+{
+	_systrace_append((REC_EXEC << 24) | _systrace_task_id(tcb));
+}
+
+
+void IRAM_ATTR systrace_hook_ready(void* tcb)
+{
+	_systrace_append((REC_READY << 24) | _systrace_task_id(tcb));
+}
+
+
+
+//
+// Internal functions
+//
+static void IRAM_ATTR _systrace_append(uint32_t evt)
+{
+	systrace_ring_t* r;
+	UBaseType_t state;
+	
+	// The ring is in PSRAM which can't be touched while the cache is disabled for a flash write
+	if (!atomic_load(&rec_enable) || !spi_flash_cache_enabled()) return;
+	
+	state = portSET_INTERRUPT_MASK_FROM_ISR();
+	r = &rings[xPortGetCoreID()];
+	r->buf[r->idx].usec = (uint32_t) esp_timer_get_time();
+	r->buf[r->idx].evt = evt;
+	if (++r->idx == SYSTRACE_RING_LEN) {
+		r->idx = 0;
+		r->wrapped = true;
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR(state);
+}
+
+
+static uint32_t IRAM_ATTR _systrace_task_id(void* tcb)
+{
+	return (((uint32_t) tcb - SYSTRACE_RAM_BASE) >> SYSTRACE_ID_SHIFT) & 0x00FFFFFF;
+}
+
+
+static void _systrace_task(void* args)
+{
+	uint32_t notify;
+	
+	while (true) {
+		(void) xTaskNotifyWait(0x00, 0xFFFFFFFF, &notify, portMAX_DELAY);
+		
+		// Let the aftermath of a trigger be recorded too
+		if ((notify & SYSTRACE_NOTIFY_TRIGGER) != 0) {
+			vTaskDelay(pdMS_TO_TICKS(SYSTRACE_POST_TRIG_MSEC));
+		}
+		
+		atomic_store(&rec_enable, false);
+		vTaskDelay(pdMS_TO_TICKS(SYSTRACE_STOP_MSEC));
+		
+		_systrace_save_files();
+		
+		_systrace_reset();
+		last_save_tick = xTaskGetTickCount();
+		atomic_store(&save_pending, false);
+		atomic_store(&rec_enable, true);
+	}
+}
+
+
+static void _systrace_reset()
+{
+	for (int i=0; i<portNUM_PROCESSORS; i++) {
+		rings[i].idx = 0;
+		rings[i].wrapped = false;
+	}
+}
+
+
+static void _systrace_save_files()
+{
+	char filename[40];
+	struct stat st;
+	int core;
+	
+	if (!sd_card_mount()) {
+		ESP_LOGE(TAG, "Could not mount the card to save the trace");
+		return;
+	}
+	
+	// Don't overwrite recordings from before a reset
+	do {
+		sprintf(filename, "%s/trace%d_0.svdat", SD_CARD_MOUNT_POINT, file_num);
+	} while ((stat(filename, &st) == 0) && (++file_num < 10000));
+	
+	_systrace_get_tasks();
+	
+	for (core=0; core<portNUM_PROCESSORS; core++) {
+		sprintf(filename, "%s/trace%d_%d.svdat", SD_CARD_MOUNT_POINT, file_num, core);
+		out_fp = fopen(filename, "wb");
+		if (out_fp == NULL) {
+			ESP_LOGE(TAG, "Could not create %s", filename);
+			break;
+		}
+		_systrace_write_core(core);
+		fclose(out_fp);
+	}
+	
+	sd_card_unmount();
+	
+	if (core == portNUM_PROCESSORS) {
+		ESP_LOGI(TAG, "Saved trace %d", file_num);
+	}
+	file_num++;
+}
+
+
+static void _systrace_get_tasks()
+{
+#if (configUSE_TRACE_FACILITY == 1)
+	num_tasks = (int) uxTaskGetSystemState(task_status, SYSTRACE_MAX_TASKS, NULL);
+#else
+	num_tasks = 0;
+#endif
+	
+	for (int i=0; i<portNUM_PROCESSORS; i++) {
+		idle_id[i] = _systrace_task_id((void*) xTaskGetIdleTaskHandleForCPU(i));
+	}
+}
+
+
+static void _systrace_write_core(int core)
+{
+	systrace_ring_t* r = &rings[core];
+	uint8_t payload[SV_MAX_PACKET];
+	uint8_t* p;
+	uint32_t i, n, start_usec, id;
+	int type;
+	
+	n = r->wrapped ? SYSTRACE_RING_LEN : r->idx;
+	i = r->wrapped ? r->idx : 0;
+	start_usec = (n == 0) ? 0 : r->buf[i].usec;
+	
+	// Header and the start sequence SystemView sends when a recording begins
+	(void) fputs(SV_FILE_HEADER, out_fp);
+	memset(out_buf, 0, SV_SYNC_LEN);
+	out_len = SV_SYNC_LEN;
+	out_last_usec = start_usec;
+	
+	_systrace_packet(SV_EVTID_TRACE_START, NULL, 0, start_usec);
+	
+	p = _systrace_put_u32(payload, 1000000);
+	p = _systrace_put_u32(p, CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ * 1000000);
+	p = _systrace_put_u32(p, SYSTRACE_RAM_BASE);
+	p = _systrace_put_u32(p, SYSTRACE_ID_SHIFT);
+	_systrace_packet(SV_EVTID_INIT, payload, p - payload, start_usec);
+	
+	p = _systrace_put_str(payload, SV_SYS_DESC);
+	_systrace_packet(SV_EVTID_SYSDESC, payload, p - payload, start_usec);
+	
+	p = _systrace_put_u32(payload, start_usec);
+	_systrace_packet(SV_EVTID_SYSTIME_US, payload, p - payload, start_usec);
+	
+#if (configUSE_TRACE_FACILITY == 1)
+	for (int t=0; t<num_tasks; t++) {
+		p = _systrace_put_u32(payload, _systrace_task_id((void*) task_status[t].xHandle));
+		p = _systrace_put_u32(p, task_status[t].uxCurrentPriority);
+		p = _systrace_put_str(p, task_status[t].pcTaskName);
+		_systrace_packet(SV_EVTID_TASK_INFO, payload, p - payload, start_usec);
+	}
+#endif
+	
+	p = _systrace_put_u32(payload, 0);
+	_systrace_packet(SV_EVTID_NUMMODULES, payload, p - payload, start_usec);
+	
+	// Events oldest first
+	while (n-- > 0) {
+		type = r->buf[i].evt >> 24;
+		id = r->buf[i].evt & 0x00FFFFFF;
+		p = _systrace_put_u32(payload, id);
+		switch (type) {
+			case REC_EXEC:
+				if (id == idle_id[core]) {
+					_systrace_packet(SV_EVTID_IDLE, NULL, 0, r->buf[i].usec);
+				} else {
+					_systrace_packet(SV_EVTID_TASK_START_EXEC, payload, p - payload, r->buf[i].usec);
+				}
+				break;
+			case REC_READY:
+				_systrace_packet(SV_EVTID_TASK_START_READY, payload, p - payload, r->buf[i].usec);
+				break;
+			case REC_USER_START:
+				_systrace_packet(SV_EVTID_USER_START, payload, p - payload, r->buf[i].usec);
+				break;
+			case REC_USER_STOP:
+				_systrace_packet(SV_EVTID_USER_STOP, payload, p - payload, r->buf[i].usec);
+				break;
+		}
+		if (++i == SYSTRACE_RING_LEN) i = 0;
+	}
+	
+	_systrace_packet(SV_EVTID_TRACE_STOP, NULL, 0, out_last_usec);
+	_systrace_flush();
+}
+
+
+// SystemView packet: the event ID (followed by the payload length for the long events),
+// the payload and the time since the previous packet
+static void _systrace_packet(int evt_id, const uint8_t* payload, int len, uint32_t usec)
+{
+	uint8_t* p;
+	
+	if (out_len > (SV_OUT_BUF_LEN - SV_MAX_PACKET)) {
+		_systrace_flush();
+	}
+	
+	p = &out_buf[out_len];
+	if (evt_id < SV_EVTID_FIRST_LONG) {
+		*p++ = (uint8_t) evt_id;
+	} else {
+		p = _systrace_put_u32(p, evt_id);
+		p = _systrace_put_u32(p, len);
+	}
+	if (len != 0) {
+		memcpy(p, payload, len);
+		p += len;
+	}
+	p = _systrace_put_u32(p, usec - out_last_usec);
+	out_last_usec = usec;
+	
+	out_len = p - out_buf;
+}
+
+
+static void _systrace_flush()
+{
+	if (out_len != 0) {
+		(void) fwrite(out_buf, 1, out_len, out_fp);
+		out_len = 0;
+	}
+}
+
+
+// SystemView variable length encoding, 7 bits per byte, least significant first
+static uint8_t* _systrace_put_u32(uint8_t* p, uint32_t v)
+{
+	while (v > 0x7F) {
+		*p++ = (uint8_t) (v | 0x80);
+		v >>= 7;
+	}
+	*p++ = (uint8_t) v;
+	
+	return p;
+}
+
+
+static uint8_t* _systrace_put_str(uint8_t* p, const char* s)
+{
+	int n = strlen(s);
+	
+	if (n > SV_MAX_STR) n = SV_MAX_STR;
+	*p++ = (uint8_t) n;
+	memcpy(p, s, n);
+	
+	return p + n;
+}
+
+#endif /* CONFIG_SYSTRACE_ENABLE */
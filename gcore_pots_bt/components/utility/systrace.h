@@ -0,0 +1,94 @@
+/*
+ * systrace - utility module recording what both cores are doing so the preemption chain
+ * behind an audio deadline miss can be seen: every task switch and every task made ready
+ * (from FreeRTOS trace hooks, see systrace_hooks.h) along with start and stop markers around
+ * the I2S events, echo canceller frames, Bluetooth callbacks, display flushes and I2C
+ * transactions.  Each core records into its own PSRAM ring with interrupts masked for the
+ * few instructions of an append so no locks are needed.
+ *
+ * A recording is saved to the Micro-SD Card as one SEGGER SystemView file per core
+ * (trace<n>_<core>.svdat, the format ESP-IDF's app_trace produces over JTAG) that SystemView
+ * or ESP-IDF's sysviewtrace_proc.py can open.  Markers are SystemView user events numbered
+ * by their SYSTRACE_ID_* value below.  Timestamps are microseconds from esp_timer so the
+ * two cores' files line up and frequency scaling or light sleep doesn't distort them.
+ * Interrupt time is charged to the interrupted task.
+ *
+ * Recording starts at boot and runs continuously, overwriting the oldest events.  A call
+ * to systrace_trigger (audio_task on a deadline miss) saves the ring shortly afterwards so
+ * it holds the lead up to the miss and its aftermath, then recording starts over.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _SYSTRACE_H_
+#define _SYSTRACE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Marker IDs (SystemView user event numbers)
+#define SYSTRACE_ID_I2S_TX       0    // audio_task servicing an I2S TX event
+#define SYSTRACE_ID_I2S_RX       1    // audio_task servicing an I2S RX event
+#define SYSTRACE_ID_LEC          2    // Echo canceller frame
+#define SYSTRACE_ID_BT_EVT       3    // Bluedroid GAP or handsfree callback
+#define SYSTRACE_ID_BT_DATA_IN   4    // Bluedroid incoming audio callback
+#define SYSTRACE_ID_BT_DATA_OUT  5    // Bluedroid outgoing audio callback
+#define SYSTRACE_ID_GUI_FLUSH    6    // LVGL flush callback (starting the SPI transfer)
+#define SYSTRACE_ID_I2C          7    // I2C transaction
+#define SYSTRACE_ID_MISS         8    // Deadline miss (zero length)
+
+// Time recorded after a trigger before the ring is saved
+#define SYSTRACE_POST_TRIG_MSEC  100
+
+// Minimum time between triggered saves (a burst of misses is one recording)
+#define SYSTRACE_HOLDOFF_MSEC    10000
+
+// Saving task
+#define SYSTRACE_TASK_STACK      3072
+#define SYSTRACE_TASK_PRIO       1
+
+
+
+//
+// Marker macros (compiled out when the trace is disabled)
+//
+#if (CONFIG_SYSTRACE_ENABLE == true)
+#define SYSTRACE_START(id) systrace_mark(id, true)
+#define SYSTRACE_STOP(id)  systrace_mark(id, false)
+#else
+#define SYSTRACE_START(id)
+#define SYSTRACE_STOP(id)
+#endif
+
+
+
+//
+// API
+//
+#if (CONFIG_SYSTRACE_ENABLE == true)
+bool systrace_init();                     // Call first thing in app_main
+void systrace_mark(int id, bool start);   // Callable from any task or ISR (in IRAM)
+void systrace_trigger();                  // Save the ring SYSTRACE_POST_TRIG_MSEC from now
+void systrace_save();                     // Save the ring now (ignores the holdoff)
+#endif
+
+#endif /* _SYSTRACE_H_ */
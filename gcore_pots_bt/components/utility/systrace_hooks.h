@@ -0,0 +1,42 @@
+/*
+ * systrace_hooks - FreeRTOS trace hook macros for systrace.  The utility component's
+ * CMakeLists force-includes this file into the FreeRTOS sources when CONFIG_SYSTRACE_ENABLE
+ * is set so the kernel calls into systrace on each task switch and each task made ready.
+ * It must not include anything (it is seen before FreeRTOS's own headers).
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _SYSTRACE_HOOKS_H_
+#define _SYSTRACE_HOOKS_H_
+
+#ifndef __ASSEMBLER__
+
+//
+// Hooks (in IRAM, called by the kernel with interrupts masked)
+//
+void systrace_hook_switched_in(void* tcb);
+void systrace_hook_ready(void* tcb);
+
+
+//
+// FreeRTOS trace macros (expanded in tasks.c where pxCurrentTCB is visible)
+//
+#define traceTASK_SWITCHED_IN()               systrace_hook_switched_in((void*) pxCurrentTCB[xPortGetCoreID()])
+#define traceMOVED_TASK_TO_READY_STATE(tcb)   systrace_hook_ready((void*) (tcb))
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* _SYSTRACE_HOOKS_H_ */
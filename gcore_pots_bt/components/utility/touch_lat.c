@@ -0,0 +1,227 @@
+/*
+ * touch_lat - utility module measuring touch-to-photon latency.  See touch_lat.h.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "touch_lat.h"
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+#include <string.h>
+#include "esp_attr.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+
+
+//
+// Constants
+//
+
+// Press states, each waiting for the next hook
+#define TOUCH_LAT_ST_IDLE        0
+#define TOUCH_LAT_ST_TOUCHED     1
+#define TOUCH_LAT_ST_DISPATCHED  2
+#define TOUCH_LAT_ST_INVALIDATED 3
+#define TOUCH_LAT_ST_DRAWING     4
+#define TOUCH_LAT_ST_FLUSHING    5
+
+
+
+//
+// Variables
+//
+static portMUX_TYPE touch_lat_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Press being followed (only the flush ready ISR runs outside of gui_task)
+static volatile int touch_lat_state = TOUCH_LAT_ST_IDLE;
+static const void* touch_lat_obj;
+static int64_t touch_lat_usec[TOUCH_LAT_NUM_STAGES];  // Time each stage started
+
+// Stages of the last presses measured
+static uint32_t touch_lat_ring[TOUCH_LAT_RING_LEN][TOUCH_LAT_NUM_STAGES];
+static int touch_lat_ring_index = 0;
+
+static touch_lat_stats_t touch_lat_stats;
+
+static const uint32_t touch_lat_pcts[TOUCH_LAT_NUM_PCTS] = TOUCH_LAT_PCTS;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static bool _touchLatTimedOut(int64_t now, int stage);
+static void _touchLatSort(uint32_t* v, int n);
+
+
+
+//
+// API
+//
+void touch_lat_touch(int64_t usec)
+{
+	portENTER_CRITICAL(&touch_lat_mux);
+	touch_lat_stats.presses += 1;
+	if (touch_lat_state >= TOUCH_LAT_ST_DISPATCHED) {
+		touch_lat_stats.abandoned += 1;
+	}
+	touch_lat_usec[TOUCH_LAT_DISPATCH] = usec;
+	touch_lat_state = TOUCH_LAT_ST_TOUCHED;
+	portEXIT_CRITICAL(&touch_lat_mux);
+}
+
+
+void touch_lat_dispatch(const void* obj)
+{
+	int64_t now;
+	
+	if (touch_lat_state != TOUCH_LAT_ST_TOUCHED) return;
+	
+	now = esp_timer_get_time();
+	portENTER_CRITICAL(&touch_lat_mux);
+	if (_touchLatTimedOut(now, TOUCH_LAT_DISPATCH)) {
+		// The press was held (or the touch seen) long before LVGL read it
+		touch_lat_state = TOUCH_LAT_ST_IDLE;
+	} else {
+		touch_lat_obj = obj;
+		touch_lat_usec[TOUCH_LAT_INVALIDATE] = now;
+		touch_lat_state = TOUCH_LAT_ST_DISPATCHED;
+	}
+	portEXIT_CRITICAL(&touch_lat_mux);
+}
+
+
+void touch_lat_invalidate(const void* obj)
+{
+	int64_t now;
+	
+	// Called for every invalidation so reject the rest quickly
+	if ((touch_lat_state != TOUCH_LAT_ST_DISPATCHED) || (obj != touch_lat_obj)) return;
+	
+	now = esp_timer_get_time();
+	portENTER_CRITICAL(&touch_lat_mux);
+	if (_touchLatTimedOut(now, TOUCH_LAT_INVALIDATE)) {
+		touch_lat_stats.abandoned += 1;
+		touch_lat_state = TOUCH_LAT_ST_IDLE;
+	} else {
+		touch_lat_usec[TOUCH_LAT_FLUSH] = now;
+		touch_lat_state = TOUCH_LAT_ST_INVALIDATED;
+	}
+	portEXIT_CRITICAL(&touch_lat_mux);
+}
+
+
+void touch_lat_refr_start()
+{
+	if (touch_lat_state == TOUCH_LAT_ST_INVALIDATED) {
+		touch_lat_state = TOUCH_LAT_ST_DRAWING;
+	}
+}
+
+
+void touch_lat_flush_start(bool last)
+{
+	// The flush of the refresh's last part ends after every earlier one
+	if (last && (touch_lat_state == TOUCH_LAT_ST_DRAWING)) {
+		touch_lat_state = TOUCH_LAT_ST_FLUSHING;
+	}
+}
+
+
+void IRAM_ATTR touch_lat_flush_ready()
+{
+	uint32_t* r;
+	int64_t now;
+	int i;
+	
+	if (touch_lat_state != TOUCH_LAT_ST_FLUSHING) return;
+	
+	now = esp_timer_get_time();
+	portENTER_CRITICAL_SAFE(&touch_lat_mux);
+	r = touch_lat_ring[touch_lat_ring_index];
+	r[TOUCH_LAT_DISPATCH] = (uint32_t) (touch_lat_usec[TOUCH_LAT_INVALIDATE] - touch_lat_usec[TOUCH_LAT_DISPATCH]);
+	r[TOUCH_LAT_INVALIDATE] = (uint32_t) (touch_lat_usec[TOUCH_LAT_FLUSH] - touch_lat_usec[TOUCH_LAT_INVALIDATE]);
+	r[TOUCH_LAT_FLUSH] = (uint32_t) (now - touch_lat_usec[TOUCH_LAT_FLUSH]);
+	r[TOUCH_LAT_TOTAL] = (uint32_t) (now - touch_lat_usec[TOUCH_LAT_DISPATCH]);
+	for (i=0; i<TOUCH_LAT_NUM_STAGES; i++) {
+		if (r[i] > touch_lat_stats.max_usec[i]) touch_lat_stats.max_usec[i] = r[i];
+	}
+	if (++touch_lat_ring_index == TOUCH_LAT_RING_LEN) touch_lat_ring_index = 0;
+	if (touch_lat_stats.recent < TOUCH_LAT_RING_LEN) touch_lat_stats.recent += 1;
+	touch_lat_stats.measured += 1;
+	touch_lat_state = TOUCH_LAT_ST_IDLE;
+	portEXIT_CRITICAL_SAFE(&touch_lat_mux);
+}
+
+
+void touch_lat_get_stats(touch_lat_stats_t* stats)
+{
+	uint32_t v[TOUCH_LAT_RING_LEN];
+	int i, j, n;
+	
+	for (i=0; i<TOUCH_LAT_NUM_STAGES; i++) {
+		// Sort a copy of the stage outside the critical section
+		portENTER_CRITICAL(&touch_lat_mux);
+		if (i == 0) {
+			memcpy(stats, &touch_lat_stats, sizeof(touch_lat_stats_t));
+		}
+		n = stats->recent;
+		for (j=0; j<n; j++) {
+			v[j] = touch_lat_ring[j][i];
+		}
+		portEXIT_CRITICAL(&touch_lat_mux);
+		
+		_touchLatSort(v, n);
+		for (j=0; j<TOUCH_LAT_NUM_PCTS; j++) {
+			// Nearest rank
+			stats->pct_usec[i][j] = (n == 0) ? 0 : v[(touch_lat_pcts[j] * n + 99) / 100 - 1];
+		}
+	}
+}
+
+
+void touch_lat_reset_stats()
+{
+	portENTER_CRITICAL(&touch_lat_mux);
+	memset(&touch_lat_stats, 0, sizeof(touch_lat_stats_t));
+	touch_lat_ring_index = 0;
+	portEXIT_CRITICAL(&touch_lat_mux);
+}
+
+
+
+//
+// Internal functions
+//
+static bool _touchLatTimedOut(int64_t now, int stage)
+{
+	return ((now - touch_lat_usec[stage]) > (TOUCH_LAT_TIMEOUT_MSEC * 1000));
+}
+
+
+static void _touchLatSort(uint32_t* v, int n)
+{
+	uint32_t t;
+	int i, j;
+	
+	for (i=1; i<n; i++) {
+		t = v[i];
+		for (j=i; (j > 0) && (v[j-1] > t); j--) {
+			v[j] = v[j-1];
+		}
+		v[j] = t;
+	}
+}
+
+#endif /* CONFIG_TOUCH_LAT_ENABLE */
@@ -0,0 +1,119 @@
+/*
+ * touch_lat - utility module measuring touch-to-photon latency: the time from a finger
+ * touching the display until the object it pressed has been redrawn in its pressed state and
+ * the pixels sent to the display.  Each press is followed through four hooks:
+ *
+ *   - touch: the FT6x36 driver reads a new touch (timed from the INT falling edge when the
+ *     controller's INT line is connected, otherwise from the read)
+ *   - dispatch: LVGL's pointer input sends the press to the object under the finger
+ *   - invalidate: the pressed object (for example the keypad button matrix) invalidates
+ *     itself to be redrawn in its pressed state
+ *   - photon: the flush of the last part of the first refresh after the invalidation is
+ *     finished (lv_disp_flush_ready)
+ *
+ * A press is abandoned if the next one arrives first or a stage doesn't follow the previous
+ * within TOUCH_LAT_TIMEOUT_MSEC (pressing something without a pressed style for instance).
+ * The stages of the last TOUCH_LAT_RING_LEN presses measured are kept so their percentiles
+ * can be reported.  The "touch" console command shows them.  The hooks are compiled out
+ * unless CONFIG_TOUCH_LAT_ENABLE is set.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _TOUCH_LAT_H_
+#define _TOUCH_LAT_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Presses the percentiles are computed over
+#define TOUCH_LAT_RING_LEN       64
+
+// Longest a stage may take before the press is abandoned
+#define TOUCH_LAT_TIMEOUT_MSEC   1000
+
+// Stages (each from the end of the previous one), the last is the whole latency
+#define TOUCH_LAT_DISPATCH       0
+#define TOUCH_LAT_INVALIDATE     1
+#define TOUCH_LAT_FLUSH          2
+#define TOUCH_LAT_TOTAL          3
+#define TOUCH_LAT_NUM_STAGES     4
+
+// Percentiles reported
+#define TOUCH_LAT_P50            0
+#define TOUCH_LAT_P90            1
+#define TOUCH_LAT_P99            2
+#define TOUCH_LAT_NUM_PCTS       3
+#define TOUCH_LAT_PCTS           {50, 90, 99}
+
+
+
+//
+// Hook macros (compiled out when the probe is disabled)
+//
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+#define TOUCH_LAT_DISPATCH_OBJ(obj)      touch_lat_dispatch(obj)
+#define TOUCH_LAT_INVALIDATE_OBJ(obj)    touch_lat_invalidate(obj)
+#define TOUCH_LAT_REFR_START()           touch_lat_refr_start()
+#define TOUCH_LAT_FLUSH_START(last)      touch_lat_flush_start(last)
+#define TOUCH_LAT_FLUSH_READY()          touch_lat_flush_ready()
+#else
+#define TOUCH_LAT_DISPATCH_OBJ(obj)
+#define TOUCH_LAT_INVALIDATE_OBJ(obj)
+#define TOUCH_LAT_REFR_START()
+#define TOUCH_LAT_FLUSH_START(last)
+#define TOUCH_LAT_FLUSH_READY()
+#endif
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t presses;                     // Touches seen
+	uint32_t measured;                    // Presses followed through to the display
+	uint32_t abandoned;                   // Presses dispatched but not measured
+	int recent;                           // Presses the percentiles are over
+	uint32_t pct_usec[TOUCH_LAT_NUM_STAGES][TOUCH_LAT_NUM_PCTS];
+	uint32_t max_usec[TOUCH_LAT_NUM_STAGES];  // Since reset
+} touch_lat_stats_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_TOUCH_LAT_ENABLE == true)
+// Hooks (use the macros above in LVGL)
+void touch_lat_touch(int64_t usec);               // esp_timer time of the touch
+void touch_lat_dispatch(const void* obj);
+void touch_lat_invalidate(const void* obj);
+void touch_lat_refr_start();
+void touch_lat_flush_start(bool last);            // Last part of the refresh
+void touch_lat_flush_ready();                     // From the SPI ISR (in IRAM)
+
+void touch_lat_get_stats(touch_lat_stats_t* stats);
+void touch_lat_reset_stats();
+#endif
+
+#endif /* _TOUCH_LAT_H_ */
@@ -0,0 +1,569 @@
+/*
+ * wifi_up - utility module uploading telemetry to a fleet server over Wi-Fi while the phone
+ * is idle.  See wifi_up.h.
+ *
+ * The worker task starts and stops Wi-Fi holding wifi_up_radio_mutex and wifi_up_abort takes
+ * it to stop the radio, so an abort either sees the radio running and stops it or is seen by
+ * the worker before it starts the radio.  The HTTP request in progress when the radio is
+ * stopped fails on its own (its result is counted as an abort).
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#include "wifi_up.h"
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+#include <stdatomic.h>
+#include <string.h>
+#include <time.h>
+#include "app_task.h"
+#include "audio_task.h"
+#include "ble_telem.h"
+#include "esp_coexist.h"
+#include "esp_crt_bundle.h"
+#include "esp_event.h"
+#include "esp_http_client.h"
+#include "esp_log.h"
+#include "esp_mac.h"
+#include "esp_netif.h"
+#include "esp_timer.h"
+#include "esp_wifi.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "sys_common.h"
+#include "sys_status.h"
+
+#if !defined(CONFIG_ESP32_WIFI_SW_COEXIST_ENABLE)
+#error "WIFI_UPLOAD_ENABLE needs Wi-Fi and Bluetooth software coexistence (ESP32_WIFI_SW_COEXIST_ENABLE)"
+#endif
+
+
+
+//
+// Constants
+//
+
+// Worker task (TLS needs a large stack, kept in internal RAM since Wi-Fi init reads flash)
+#define WIFI_UP_TASK_STACK    8192
+#define WIFI_UP_TASK_PRIO     1
+
+// Worker evaluation interval
+#define WIFI_UP_POLL_MSEC     1000
+
+// Snapshot and upload interval
+#define WIFI_UP_INTERVAL_USEC ((int64_t) CONFIG_WIFI_UPLOAD_INTERVAL_MIN * 60 * 1000000)
+
+// Clock considered set once past this (2023-01-01)
+#define WIFI_UP_TIME_SET      1672531200
+
+// Largest record
+#define WIFI_UP_MAX_REC_LEN   96
+
+// Largest payload
+#define WIFI_UP_PAYLOAD_LEN   (sizeof(wifi_up_hdr_t) + WIFI_UP_BATCH_RECS * (sizeof(wifi_up_rec_hdr_t) + WIFI_UP_MAX_REC_LEN))
+
+// wifi_up_events bits
+#define WIFI_UP_EVT_CONNECTED 0x01
+#define WIFI_UP_EVT_FAILED    0x02
+#define WIFI_UP_EVT_ABORTED   0x04
+#define WIFI_UP_EVT_ALL       (WIFI_UP_EVT_CONNECTED | WIFI_UP_EVT_FAILED | WIFI_UP_EVT_ABORTED)
+
+// Upload results
+#define WIFI_UP_OK            0
+#define WIFI_UP_FAIL          1
+#define WIFI_UP_ABORT         2
+
+// Ring indices count records ever added so the ring length must divide 2^32
+_Static_assert((WIFI_UP_RING_LEN & (WIFI_UP_RING_LEN - 1)) == 0, "WIFI_UP_RING_LEN must be a power of 2");
+_Static_assert(sizeof(ble_telem_stats_t) <= WIFI_UP_MAX_REC_LEN, "ble_telem_stats_t too long");
+_Static_assert(sizeof(call_log_rec_t) <= WIFI_UP_MAX_REC_LEN, "call_log_rec_t too long");
+_Static_assert(WIFI_UP_BATCH_RECS <= 255, "count is one byte");
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint8_t type;                         // WIFI_UP_REC_*
+	uint8_t len;
+	uint8_t data[WIFI_UP_MAX_REC_LEN];
+} wifi_up_entry_t;
+
+
+
+//
+// Variables
+//
+static const char* TAG = "wifi_up";
+
+static portMUX_TYPE wifi_up_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Pending records (from wifi_up_tail up to wifi_up_head)
+static COLD_ATTR wifi_up_entry_t wifi_up_ring[WIFI_UP_RING_LEN];
+static uint32_t wifi_up_head = 0;                 // Records ever added
+static uint32_t wifi_up_tail = 0;                 // Oldest pending record
+
+static COLD_ATTR uint8_t wifi_up_payload[WIFI_UP_PAYLOAD_LEN];
+static uint8_t wifi_up_mac[6];
+
+static wifi_up_stats_t wifi_up_stats;
+static int64_t wifi_up_busy_usec = 0;             // Last time a call, audio or abort was seen
+static int64_t wifi_up_next_usec = 0;             // Earliest next upload
+
+// Radio control
+static atomic_bool wifi_up_abort_req = ATOMIC_VAR_INIT(false);
+static SemaphoreHandle_t wifi_up_radio_mutex;
+static StaticSemaphore_t wifi_up_radio_mutex_buf;
+static EventGroupHandle_t wifi_up_events;
+static StaticEventGroup_t wifi_up_events_buf;
+
+static TaskHandle_t task_handle_wifi_up = NULL;
+static StackType_t wifi_up_task_stack[WIFI_UP_TASK_STACK];
+static StaticTask_t wifi_up_task_tcb;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _wifiUpTask(void* args);
+static void _wifiUpEventHandler(void* arg, esp_event_base_t base, int32_t id, void* data);
+static int _wifiUpUpload();
+static bool _wifiUpStart();
+static void _wifiUpStop();
+static int _wifiUpBuild(uint32_t* first, int* len);
+static void _wifiUpRelease(uint32_t first, int n);
+static void _wifiUpAdd(int type, const void* data, int len);
+static int _wifiUpPending();
+static bool _wifiUpIdle(int64_t now);
+
+
+
+//
+// API
+//
+bool wifi_up_init()
+{
+	esp_err_t ret;
+	
+	if (strncmp(CONFIG_WIFI_UPLOAD_URL, "https://", 8) != 0) {
+		ESP_LOGE(TAG, "Upload URL must be https");
+		return false;
+	}
+	
+	wifi_up_radio_mutex = xSemaphoreCreateMutexStatic(&wifi_up_radio_mutex_buf);
+	wifi_up_events = xEventGroupCreateStatic(&wifi_up_events_buf);
+	(void) esp_efuse_mac_get_default(wifi_up_mac);
+	
+	// The network interface and event loop stay, Wi-Fi itself is only initialized for an upload
+	if ((ret = esp_netif_init()) != ESP_OK) {
+		ESP_LOGE(TAG, "esp_netif_init failed (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	ret = esp_event_loop_create_default();
+	if ((ret != ESP_OK) && (ret != ESP_ERR_INVALID_STATE)) {
+		ESP_LOGE(TAG, "Create event loop failed (%s)", esp_err_to_name(ret));
+		return false;
+	}
+	(void) esp_netif_create_default_wifi_sta();
+	if ((esp_event_handler_instance_register(WIFI_EVENT, ESP_EVENT_ANY_ID, &_wifiUpEventHandler, NULL, NULL) != ESP_OK) ||
+	    (esp_event_handler_instance_register(IP_EVENT, IP_EVENT_STA_GOT_IP, &_wifiUpEventHandler, NULL, NULL) != ESP_OK)) {
+		ESP_LOGE(TAG, "Register event handlers failed");
+		return false;
+	}
+	
+	task_handle_wifi_up = xTaskCreateStaticPinnedToCore(&_wifiUpTask, "wifi_up_task", WIFI_UP_TASK_STACK, NULL, WIFI_UP_TASK_PRIO,
+	                                                    wifi_up_task_stack, &wifi_up_task_tcb, 0);
+	if (task_handle_wifi_up == NULL) {
+		ESP_LOGE(TAG, "Could not start task");
+		return false;
+	}
+	
+	return true;
+}
+
+
+void wifi_up_add_call(const call_log_rec_t* r)
+{
+	_wifiUpAdd(WIFI_UP_REC_CALL, r, sizeof(call_log_rec_t));
+}
+
+
+void wifi_up_abort()
+{
+	// Hold off the next upload and stop one before or after it starts the radio
+	portENTER_CRITICAL(&wifi_up_mux);
+	wifi_up_busy_usec = esp_timer_get_time();
+	portEXIT_CRITICAL(&wifi_up_mux);
+	atomic_store(&wifi_up_abort_req, true);
+	
+	if (task_handle_wifi_up == NULL) return;
+	xEventGroupSetBits(wifi_up_events, WIFI_UP_EVT_ABORTED);
+	
+	xSemaphoreTake(wifi_up_radio_mutex, portMAX_DELAY);
+	if (wifi_up_stats.radio_on) {
+		(void) esp_wifi_stop();
+		ESP_LOGI(TAG, "Upload aborted for a call");
+	}
+	xSemaphoreGive(wifi_up_radio_mutex);
+}
+
+
+void wifi_up_now()
+{
+	portENTER_CRITICAL(&wifi_up_mux);
+	wifi_up_next_usec = 0;
+	portEXIT_CRITICAL(&wifi_up_mux);
+	
+	if (task_handle_wifi_up != NULL) {
+		xTaskNotifyGive(task_handle_wifi_up);
+	}
+}
+
+
+void wifi_up_get_stats(wifi_up_stats_t* stats)
+{
+	portENTER_CRITICAL(&wifi_up_mux);
+	memcpy(stats, &wifi_up_stats, sizeof(wifi_up_stats_t));
+	stats->pending = (int) (wifi_up_head - wifi_up_tail);
+	portEXIT_CRITICAL(&wifi_up_mux);
+}
+
+
+
+//
+// Internal functions
+//
+static void _wifiUpTask(void* args)
+{
+	ble_telem_stats_t snapshot;
+	int64_t now;
+	int64_t next;
+	int64_t next_snapshot_usec;
+	uint32_t backoff;
+	
+	ESP_LOGI(TAG, "Start task");
+	
+	next_snapshot_usec = esp_timer_get_time() + WIFI_UP_INTERVAL_USEC;
+	
+	while (1) {
+		(void) ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(WIFI_UP_POLL_MSEC));
+		now = esp_timer_get_time();
+		
+		if (now >= next_snapshot_usec) {
+			ble_telem_get_stats(&snapshot);
+			_wifiUpAdd(WIFI_UP_REC_STATS, &snapshot, sizeof(snapshot));
+			next_snapshot_usec += WIFI_UP_INTERVAL_USEC;
+		}
+		
+		// Cleared before the idle check so an abort from here on is either seen as busy or
+		// by _wifiUpStart
+		atomic_store(&wifi_up_abort_req, false);
+		
+		portENTER_CRITICAL(&wifi_up_mux);
+		next = wifi_up_next_usec;
+		portEXIT_CRITICAL(&wifi_up_mux);
+		if ((now < next) || (_wifiUpPending() == 0) || !_wifiUpIdle(now)) continue;
+		
+		switch (_wifiUpUpload()) {
+			case WIFI_UP_OK:
+				backoff = 0;
+				next = esp_timer_get_time() + WIFI_UP_INTERVAL_USEC;
+				break;
+			
+			case WIFI_UP_FAIL:
+				backoff = wifi_up_stats.backoff_sec * 2;
+				if (backoff < WIFI_UP_BACKOFF_MIN_SEC) backoff = WIFI_UP_BACKOFF_MIN_SEC;
+				if (backoff > WIFI_UP_BACKOFF_MAX_SEC) backoff = WIFI_UP_BACKOFF_MAX_SEC;
+				next = esp_timer_get_time() + (int64_t) backoff * 1000000;
+				ESP_LOGW(TAG, "Upload failed, retry in %u sec", backoff);
+				break;
+			
+			default:
+				// Tried again once the phone is idle again
+				backoff = wifi_up_stats.backoff_sec;
+				break;
+		}
+		
+		portENTER_CRITICAL(&wifi_up_mux);
+		wifi_up_stats.backoff_sec = backoff;
+		wifi_up_next_usec = next;
+		portEXIT_CRITICAL(&wifi_up_mux);
+	}
+}
+
+
+static void _wifiUpEventHandler(void* arg, esp_event_base_t base, int32_t id, void* data)
+{
+	if (base == WIFI_EVENT) {
+		if (id == WIFI_EVENT_STA_START) {
+			if (!atomic_load(&wifi_up_abort_req)) {
+				(void) esp_wifi_connect();
+			}
+		} else if (id == WIFI_EVENT_STA_DISCONNECTED) {
+			xEventGroupSetBits(wifi_up_events, WIFI_UP_EVT_FAILED);
+		}
+	} else if ((base == IP_EVENT) && (id == IP_EVENT_STA_GOT_IP)) {
+		xEventGroupSetBits(wifi_up_events, WIFI_UP_EVT_CONNECTED);
+	}
+}
+
+
+// Starts Wi-Fi and sends the pending records in batches, returns WIFI_UP_*
+static int _wifiUpUpload()
+{
+	esp_http_client_config_t cfg = {
+		.url = CONFIG_WIFI_UPLOAD_URL,
+		.method = HTTP_METHOD_POST,
+		.timeout_ms = WIFI_UP_HTTP_MSEC,
+		.crt_bundle_attach = esp_crt_bundle_attach
+	};
+	esp_http_client_handle_t client = NULL;
+	EventBits_t bits;
+	esp_err_t err;
+	uint32_t first;
+	int len, n;
+	int sent = 0;
+	int status = 0;
+	int ret = WIFI_UP_FAIL;
+	
+	portENTER_CRITICAL(&wifi_up_mux);
+	wifi_up_stats.attempts += 1;
+	portEXIT_CRITICAL(&wifi_up_mux);
+	
+	if (!_wifiUpStart()) {
+		ret = atomic_load(&wifi_up_abort_req) ? WIFI_UP_ABORT : WIFI_UP_FAIL;
+	} else {
+		bits = xEventGroupWaitBits(wifi_up_events, WIFI_UP_EVT_ALL, pdFALSE, pdFALSE, pdMS_TO_TICKS(WIFI_UP_CONNECT_MSEC));
+		if ((bits & WIFI_UP_EVT_CONNECTED) != 0) {
+			if ((client = esp_http_client_init(&cfg)) != NULL) {
+				(void) esp_http_client_set_header(client, "Content-Type", "application/octet-stream");
+			}
+		} else {
+			ESP_LOGW(TAG, "Could not join %s", CONFIG_WIFI_UPLOAD_SSID);
+		}
+		
+		while ((client != NULL) && !atomic_load(&wifi_up_abort_req)) {
+			if ((n = _wifiUpBuild(&first, &len)) == 0) {
+				ret = WIFI_UP_OK;
+				break;
+			}
+			
+			(void) esp_http_client_set_post_field(client, (const char*) wifi_up_payload, len);
+			err = esp_http_client_perform(client);
+			status = (err == ESP_OK) ? esp_http_client_get_status_code(client) : 0;
+			if ((status < 200) || (status > 299)) {
+				if (!atomic_load(&wifi_up_abort_req)) {
+					ESP_LOGW(TAG, "POST failed (%s, status %d)", esp_err_to_name(err), status);
+				}
+				break;
+			}
+			
+			// Only records the server has accepted leave the ring
+			_wifiUpRelease(first, n);
+			sent += n;
+		}
+		
+		if (client != NULL) {
+			(void) esp_http_client_cleanup(client);
+		}
+		_wifiUpStop();
+		
+		if ((ret != WIFI_UP_OK) && atomic_load(&wifi_up_abort_req)) {
+			ret = WIFI_UP_ABORT;
+		}
+	}
+	
+	portENTER_CRITICAL(&wifi_up_mux);
+	wifi_up_stats.last_status = status;
+	if (ret == WIFI_UP_FAIL) wifi_up_stats.failures += 1;
+	if (ret == WIFI_UP_ABORT) wifi_up_stats.aborts += 1;
+	portEXIT_CRITICAL(&wifi_up_mux);
+	
+	if (sent != 0) {
+		ESP_LOGI(TAG, "Uploaded %d records", sent);
+	}
+	
+	return ret;
+}
+
+
+// Starts Wi-Fi unless an abort came first
+static bool _wifiUpStart()
+{
+	wifi_init_config_t init_cfg = WIFI_INIT_CONFIG_DEFAULT();
+	wifi_config_t cfg;
+	esp_err_t ret;
+	
+	memset(&cfg, 0, sizeof(cfg));
+	strncpy((char*) cfg.sta.ssid, CONFIG_WIFI_UPLOAD_SSID, sizeof(cfg.sta.ssid));
+	strncpy((char*) cfg.sta.password, CONFIG_WIFI_UPLOAD_PASSWORD, sizeof(cfg.sta.password));
+	
+	xEventGroupClearBits(wifi_up_events, WIFI_UP_EVT_ALL);
+	
+	xSemaphoreTake(wifi_up_radio_mutex, portMAX_DELAY);
+	if (atomic_load(&wifi_up_abort_req)) {
+		xSemaphoreGive(wifi_up_radio_mutex);
+		return false;
+	}
+	if ((ret = esp_wifi_init(&init_cfg)) == ESP_OK) {
+		(void) esp_wifi_set_storage(WIFI_STORAGE_RAM);
+		(void) esp_wifi_set_mode(WIFI_MODE_STA);
+		(void) esp_wifi_set_config(WIFI_IF_STA, &cfg);
+		
+		// Give the voice link the air whenever both want it
+		(void) esp_coex_preference_set(ESP_COEX_PREFER_BT);
+		
+		if ((ret = esp_wifi_start()) != ESP_OK) {
+			(void) esp_wifi_deinit();
+		}
+	}
+	if (ret == ESP_OK) {
+		portENTER_CRITICAL(&wifi_up_mux);
+		wifi_up_stats.radio_on = true;
+		portEXIT_CRITICAL(&wifi_up_mux);
+	}
+	xSemaphoreGive(wifi_up_radio_mutex);
+	
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Wi-Fi start failed (%s)", esp_err_to_name(ret));
+	}
+	return (ret == ESP_OK);
+}
+
+
+// Stops Wi-Fi (if an abort hasn't already) and releases its memory
+static void _wifiUpStop()
+{
+	xSemaphoreTake(wifi_up_radio_mutex, portMAX_DELAY);
+	if (wifi_up_stats.radio_on) {
+		(void) esp_wifi_stop();
+		(void) esp_wifi_deinit();
+		portENTER_CRITICAL(&wifi_up_mux);
+		wifi_up_stats.radio_on = false;
+		portEXIT_CRITICAL(&wifi_up_mux);
+	}
+	xSemaphoreGive(wifi_up_radio_mutex);
+}
+
+
+// Fills wifi_up_payload with up to WIFI_UP_BATCH_RECS of the oldest pending records and
+// returns how many, with the index of the first and the payload length
+static int _wifiUpBuild(uint32_t* first, int* len)
+{
+	wifi_up_hdr_t hdr;
+	wifi_up_rec_hdr_t rec_hdr;
+	wifi_up_entry_t* e;
+	uint8_t* p = wifi_up_payload + sizeof(wifi_up_hdr_t);
+	time_t t = time(NULL);
+	uint32_t i;
+	bool valid;
+	int n;
+	
+	// One record at a time keeps the critical sections short
+	for (n=0; n<WIFI_UP_BATCH_RECS; n++) {
+		portENTER_CRITICAL(&wifi_up_mux);
+		if (n == 0) *first = wifi_up_tail;
+		i = *first + n;
+		valid = (i - wifi_up_tail) < (wifi_up_head - wifi_up_tail);
+		if (valid) {
+			e = &wifi_up_ring[i % WIFI_UP_RING_LEN];
+			rec_hdr.type = e->type;
+			rec_hdr.len = e->len;
+			memcpy(p, &rec_hdr, sizeof(rec_hdr));
+			memcpy(p + sizeof(rec_hdr), e->data, e->len);
+			p += sizeof(rec_hdr) + e->len;
+		}
+		portEXIT_CRITICAL(&wifi_up_mux);
+		if (!valid) break;
+	}
+	
+	hdr.magic = WIFI_UP_MAGIC;
+	hdr.version = WIFI_UP_FORMAT_VERSION;
+	hdr.count = (uint8_t) n;
+	memcpy(hdr.mac, wifi_up_mac, sizeof(hdr.mac));
+	hdr.time = (t > WIFI_UP_TIME_SET) ? (uint32_t) t : 0;
+	hdr.uptime_sec = (uint32_t) (esp_timer_get_time() / 1000000);
+	memcpy(wifi_up_payload, &hdr, sizeof(hdr));
+	
+	*len = (int) (p - wifi_up_payload);
+	return n;
+}
+
+
+// Removes records sent successfully (unless the ring has already dropped them)
+static void _wifiUpRelease(uint32_t first, int n)
+{
+	portENTER_CRITICAL(&wifi_up_mux);
+	if ((int32_t) (first + n - wifi_up_tail) > 0) {
+		wifi_up_tail = first + n;
+	}
+	wifi_up_stats.uploaded += n;
+	portEXIT_CRITICAL(&wifi_up_mux);
+}
+
+
+static void _wifiUpAdd(int type, const void* data, int len)
+{
+	wifi_up_entry_t* e;
+	
+	portENTER_CRITICAL(&wifi_up_mux);
+	if ((wifi_up_head - wifi_up_tail) == WIFI_UP_RING_LEN) {
+		wifi_up_tail += 1;
+		wifi_up_stats.dropped += 1;
+	}
+	e = &wifi_up_ring[wifi_up_head % WIFI_UP_RING_LEN];
+	e->type = (uint8_t) type;
+	e->len = (uint8_t) len;
+	memcpy(e->data, data, len);
+	wifi_up_head += 1;
+	portEXIT_CRITICAL(&wifi_up_mux);
+}
+
+
+static int _wifiUpPending()
+{
+	int n;
+	
+	portENTER_CRITICAL(&wifi_up_mux);
+	n = (int) (wifi_up_head - wifi_up_tail);
+	portEXIT_CRITICAL(&wifi_up_mux);
+	
+	return n;
+}
+
+
+// True once there has been no call, audio or abort for WIFI_UP_IDLE_SEC
+static bool _wifiUpIdle(int64_t now)
+{
+	audio_load_t load;
+	app_state_t st = sys_status_get_app_state();
+	bool idle;
+	
+	audio_get_load(&load);
+	
+	portENTER_CRITICAL(&wifi_up_mux);
+	if (((st != DISCONNECTED) && (st != CONNECTED_IDLE)) || load.enabled) {
+		wifi_up_busy_usec = now;
+	}
+	idle = (now - wifi_up_busy_usec) >= ((int64_t) WIFI_UP_IDLE_SEC * 1000000);
+	portEXIT_CRITICAL(&wifi_up_mux);
+	
+	return idle;
+}
+
+#endif /* CONFIG_WIFI_UPLOAD_ENABLE */
@@ -0,0 +1,120 @@
+/*
+ * wifi_up - utility module uploading telemetry to a fleet server over Wi-Fi while the phone
+ * is idle.  A stats snapshot (ble_telem_stats_t) is taken every CONFIG_WIFI_UPLOAD_INTERVAL_MIN
+ * and app_task adds each call's call_log_rec_t as it is logged.  Records wait in a bounded
+ * ring (the oldest is dropped once WIFI_UP_RING_LEN are pending) until they can be sent.
+ *
+ * Wi-Fi is completely off (not even initialized) except during an upload, which only starts
+ * when there is no call, no audio and nothing has happened for WIFI_UP_IDLE_SEC.  Coexistence
+ * is set to prefer Bluetooth while it runs, and app_task and bt_task call wifi_up_abort the
+ * moment a call starts ringing, is dialed or opens audio so the radio is stopped before the
+ * SCO link needs the air.  An aborted upload is tried again at the next idle time.
+ *
+ * Pending records are sent in batches of up to WIFI_UP_BATCH_RECS as one HTTPS POST
+ * (application/octet-stream, the server certificate checked against the ESP-IDF bundle) and
+ * only leave the ring once the server answers 2xx.  A failed upload is retried after a backoff
+ * starting at WIFI_UP_BACKOFF_MIN_SEC and doubling up to WIFI_UP_BACKOFF_MAX_SEC.
+ *
+ * Payload (little endian):
+ *   wifi_up_hdr_t
+ *   count records, each a wifi_up_rec_hdr_t followed by len bytes of the record
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ */
+#ifndef _WIFI_UP_H_
+#define _WIFI_UP_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "call_log.h"
+#include "sdkconfig.h"
+
+
+
+//
+// Constants
+//
+
+// Payload format
+#define WIFI_UP_MAGIC            0x55544257      /* "WBTU" */
+#define WIFI_UP_FORMAT_VERSION   1
+
+// Record types
+#define WIFI_UP_REC_STATS        1               /* ble_telem_stats_t */
+#define WIFI_UP_REC_CALL         2               /* call_log_rec_t */
+
+// Pending records kept
+#define WIFI_UP_RING_LEN         64
+
+// Most records in one POST
+#define WIFI_UP_BATCH_RECS       16
+
+// Quiet time after a call (or an abort) before Wi-Fi may start
+#define WIFI_UP_IDLE_SEC         30
+
+// Retry backoff after a failed upload
+#define WIFI_UP_BACKOFF_MIN_SEC  60
+#define WIFI_UP_BACKOFF_MAX_SEC  3600
+
+// Limits on joining the network and on each request
+#define WIFI_UP_CONNECT_MSEC     15000
+#define WIFI_UP_HTTP_MSEC        10000
+
+
+
+//
+// Typedefs
+//
+typedef struct __attribute__((packed)) {
+	uint32_t magic;                       // WIFI_UP_MAGIC
+	uint8_t version;                      // WIFI_UP_FORMAT_VERSION
+	uint8_t count;                        // Records following
+	uint8_t mac[6];                       // Unit's base MAC address
+	uint32_t time;                        // Seconds since the epoch when sent (0 if not set)
+	uint32_t uptime_sec;
+} wifi_up_hdr_t;
+
+typedef struct __attribute__((packed)) {
+	uint8_t type;                         // WIFI_UP_REC_*
+	uint8_t len;
+} wifi_up_rec_hdr_t;
+
+typedef struct {
+	int pending;                          // Records in the ring
+	uint32_t dropped;                     // Records lost to a full ring
+	uint32_t uploaded;                    // Records the server accepted
+	uint32_t attempts;                    // Uploads started
+	uint32_t failures;
+	uint32_t aborts;                      // Uploads stopped by a call
+	uint32_t backoff_sec;                 // Current retry backoff (0 after a success)
+	int last_status;                      // HTTP status of the last request (0 if none or no connection)
+	bool radio_on;
+} wifi_up_stats_t;
+
+
+
+//
+// API
+//
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+bool wifi_up_init();
+void wifi_up_add_call(const call_log_rec_t* r);   // Queue a logged call
+void wifi_up_abort();                             // A call is starting: stop the radio now
+void wifi_up_now();                               // Upload at the next idle time without waiting
+void wifi_up_get_stats(wifi_up_stats_t* stats);
+#endif
+
+#endif /* _WIFI_UP_H_ */
@@ -0,0 +1,467 @@
+/*
+ * dsp_replay - host tool that runs an audio sample capture back through the line echo
+ * canceller and the 2:1 resamplers to measure changes to them against field recordings.
+ *
+ * A capture (CONFIG_AUDIO_SAMPLE_ENABLE) is the test_tx<n>, test_rx<n> and test_ec<n>
+ * sample files and their test_inf<n>.txt description.  The audio sent to the line (tx)
+ * and the echo-bearing audio from it (rx) are fed to a new canceller with the capture's
+ * taps and adaption mode, one 10 mSec frame per echo_can_update_block call as audio_task
+ * makes them.  One key=value line reports
+ *   - ERLE of the replay and of the recorded canceller output, over frames with tx audio
+ *   - nSec per sample for the canceller and the high quality resamplers on this host
+ *   - whether the replay is bit-exact with the recorded output (only expected when the
+ *     recording started with the canceller reset) and with a previous replay (-r)
+ *
+ * Usage: dsp_replay [-t taps] [-o out.raw] [-r ref.raw] <capture dir> <num>
+ *
+ * Exits with 0 when the replay ran, 1 for errors and 2 when it doesn't match -r.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <inttypes.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "ima_adpcm.h"
+#include "resample.h"
+#include "spandsp.h"
+
+
+
+//
+// Constants
+//
+
+// Capture channels (one file each, as written by sample.c)
+#define REPLAY_CH_TX     0
+#define REPLAY_CH_RX     1
+#define REPLAY_CH_EC     2
+#define REPLAY_NUM_CH    3
+
+// Samples per canceller call (audio_task frame)
+#define REPLAY_FRAME_MSEC 10
+
+// tx RMS level above which a frame counts towards ERLE (about -40 dBFS)
+#define REPLAY_ACTIVE_RMS 328
+
+// Exit codes
+#define REPLAY_EXIT_OK       0
+#define REPLAY_EXIT_ERR      1
+#define REPLAY_EXIT_MISMATCH 2
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	int rate;
+	char encoding[16];                    // pcm16, ulaw or ima_adpcm
+	int samples;
+	int taps;
+	int adaption_mode;
+	int dropped_blocks;
+} replay_info_t;
+
+
+
+//
+// Variables
+//
+static const char* file_prefix[REPLAY_NUM_CH] = {"tx", "rx", "ec"};
+
+static replay_info_t info;
+static int16_t* chan[REPLAY_NUM_CH];
+static int16_t* replay_out;
+static int replay_len;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static bool _replayReadInfo(const char* dir, int num);
+static int _replayReadChannel(const char* dir, int num, int c);
+static int16_t _replayUlawDecode(uint8_t u);
+static void _replayLec(int frame, double* ns);
+static void _replayResample(int frame, double* down_ns, double* up_ns);
+static double _replayErle(const int16_t* out, int frame);
+static bool _replayWrite(const char* fn, const int16_t* buf, int len);
+static int _replayCompare(const char* fn, const int16_t* buf, int len);
+static double _replayNsec();
+static void _replayUsage();
+
+
+
+//
+// Main
+//
+int main(int argc, char** argv)
+{
+	const char* out_fn = NULL;
+	const char* ref_fn = NULL;
+	double lec_ns, down_ns, up_ns;
+	int taps = 0;
+	int frame;
+	int num;
+	int opt;
+	int ref_match;
+	int n, c;
+	
+	while ((opt = getopt(argc, argv, "t:o:r:")) != -1) {
+		switch (opt) {
+			case 't':
+				taps = atoi(optarg);
+				break;
+			case 'o':
+				out_fn = optarg;
+				break;
+			case 'r':
+				ref_fn = optarg;
+				break;
+			default:
+				_replayUsage();
+				return REPLAY_EXIT_ERR;
+		}
+	}
+	if ((argc - optind) != 2) {
+		_replayUsage();
+		return REPLAY_EXIT_ERR;
+	}
+	num = atoi(argv[optind + 1]);
+	
+	if (!_replayReadInfo(argv[optind], num)) return REPLAY_EXIT_ERR;
+	if (taps != 0) info.taps = taps;
+	if ((info.rate <= 0) || (info.taps <= 0)) {
+		fprintf(stderr, "Capture %d has no canceller configuration (rate=%d taps=%d)\n", num, info.rate, info.taps);
+		return REPLAY_EXIT_ERR;
+	}
+	if (info.dropped_blocks != 0) {
+		fprintf(stderr, "Capture %d dropped %d blocks, tx and rx may be misaligned after the first\n", num, info.dropped_blocks);
+	}
+	
+	// Replay the samples all three files hold
+	replay_len = info.samples;
+	for (c=0; c<REPLAY_NUM_CH; c++) {
+		n = _replayReadChannel(argv[optind], num, c);
+		if (n < 0) return REPLAY_EXIT_ERR;
+		if (n < replay_len) replay_len = n;
+	}
+	frame = info.rate * REPLAY_FRAME_MSEC / 1000;
+	replay_len -= replay_len % frame;
+	if (replay_len == 0) {
+		fprintf(stderr, "Capture %d has no complete frames\n", num);
+		return REPLAY_EXIT_ERR;
+	}
+	
+	replay_out = malloc(replay_len * sizeof(int16_t));
+	if (replay_out == NULL) {
+		fprintf(stderr, "Could not allocate the output\n");
+		return REPLAY_EXIT_ERR;
+	}
+	
+	_replayLec(frame, &lec_ns);
+	if (replay_out == NULL) return REPLAY_EXIT_ERR;
+	_replayResample(frame, &down_ns, &up_ns);
+	
+	if ((out_fn != NULL) && !_replayWrite(out_fn, replay_out, replay_len)) return REPLAY_EXIT_ERR;
+	ref_match = (ref_fn != NULL) ? _replayCompare(ref_fn, replay_out, replay_len) : -1;
+	if (ref_match == -2) return REPLAY_EXIT_ERR;
+	
+	printf("REPLAY num=%d rate=%d samples=%d taps=%d mode=0x%02x erle_db=%.1f rec_erle_db=%.1f lec_ns=%.1f down2_ns=%.1f up2_ns=%.1f rec_exact=%d",
+	       num, info.rate, replay_len, info.taps, info.adaption_mode, _replayErle(replay_out, frame),
+	       _replayErle(chan[REPLAY_CH_EC], frame), lec_ns, down_ns, up_ns,
+	       (memcmp(replay_out, chan[REPLAY_CH_EC], replay_len * sizeof(int16_t)) == 0) ? 1 : 0);
+	if (ref_match >= 0) printf(" ref_exact=%d", ref_match);
+	printf("\n");
+	
+	return (ref_match == 0) ? REPLAY_EXIT_MISMATCH : REPLAY_EXIT_OK;
+}
+
+
+
+//
+// Internal functions
+//
+
+// Reads the test_inf<num>.txt key=value lines (unknown keys are ignored)
+static bool _replayReadInfo(const char* dir, int num)
+{
+	char filename[256];
+	char line[80];
+	FILE* fp;
+	
+	snprintf(filename, sizeof(filename), "%s/test_inf%d.txt", dir, num);
+	fp = fopen(filename, "r");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open %s\n", filename);
+		return false;
+	}
+	
+	strcpy(info.encoding, "pcm16");
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		(void) (sscanf(line, "rate=%d", &info.rate) ||
+		        sscanf(line, "encoding=%15s", info.encoding) ||
+		        sscanf(line, "samples=%d", &info.samples) ||
+		        sscanf(line, "taps=%d", &info.taps) ||
+		        sscanf(line, "adaption_mode=%x", &info.adaption_mode) ||
+		        sscanf(line, "dropped_blocks=%d", &info.dropped_blocks));
+	}
+	fclose(fp);
+	
+	return true;
+}
+
+
+// Loads and decodes one channel's file into chan[c], returning its samples or -1
+static int _replayReadChannel(const char* dir, int num, int c)
+{
+	char filename[256];
+	const char* ext;
+	uint8_t* raw;
+	FILE* fp;
+	long bytes;
+	int n, i;
+	
+	if (strcmp(info.encoding, "ulaw") == 0) {
+		ext = "ul";
+	} else if (strcmp(info.encoding, "ima_adpcm") == 0) {
+		ext = "ima";
+	} else {
+		ext = "raw";
+	}
+	snprintf(filename, sizeof(filename), "%s/test_%s%d.%s", dir, file_prefix[c], num, ext);
+	
+	fp = fopen(filename, "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open %s\n", filename);
+		return -1;
+	}
+	fseek(fp, 0, SEEK_END);
+	bytes = ftell(fp);
+	fseek(fp, 0, SEEK_SET);
+	
+	raw = malloc((bytes > 0) ? bytes : 1);
+	if ((raw == NULL) || (fread(raw, 1, bytes, fp) != (size_t) bytes)) {
+		fprintf(stderr, "Could not read %s\n", filename);
+		fclose(fp);
+		free(raw);
+		return -1;
+	}
+	fclose(fp);
+	
+	// Samples are 16-bit little-endian, one byte or one nibble
+	if (strcmp(ext, "ul") == 0) {
+		n = (int) bytes;
+	} else if (strcmp(ext, "ima") == 0) {
+		n = (int) bytes * 2;
+	} else {
+		n = (int) bytes / 2;
+	}
+	
+	chan[c] = malloc(((n > 0) ? n : 1) * sizeof(int16_t));
+	if (chan[c] == NULL) {
+		fprintf(stderr, "Could not allocate %s\n", filename);
+		free(raw);
+		return -1;
+	}
+	
+	if (strcmp(ext, "ul") == 0) {
+		for (i=0; i<n; i++) chan[c][i] = _replayUlawDecode(raw[i]);
+	} else if (strcmp(ext, "ima") == 0) {
+		ima_state_t s;
+		
+		ima_init(&s);
+		ima_decode(&s, raw, chan[c], n);
+	} else {
+		for (i=0; i<n; i++) chan[c][i] = (int16_t) (raw[2*i] | (raw[2*i + 1] << 8));
+	}
+	
+	free(raw);
+	return n;
+}
+
+
+// G.711 u-law decode (the inverse of sample.c's encoder)
+static int16_t _replayUlawDecode(uint8_t u)
+{
+	int t;
+	
+	u = ~u;
+	t = (((u & 0x0F) << 3) + 0x84) << ((u & 0x70) >> 4);
+	
+	return (int16_t) ((u & 0x80) ? (0x84 - t) : (t - 0x84));
+}
+
+
+// Runs tx and rx through a new canceller into replay_out (freed and NULL on failure)
+static void _replayLec(int frame, double* ns)
+{
+	echo_can_state_t* ec;
+	double t;
+	int i;
+	
+	ec = echo_can_create(info.taps, info.adaption_mode);
+	if (ec == NULL) {
+		fprintf(stderr, "Could not create a %d tap canceller\n", info.taps);
+		free(replay_out);
+		replay_out = NULL;
+		return;
+	}
+	
+	t = _replayNsec();
+	for (i=0; i<replay_len; i+=frame) {
+		echo_can_update_block(ec, &chan[REPLAY_CH_TX][i], &chan[REPLAY_CH_RX][i], &replay_out[i], frame);
+	}
+	*ns = (_replayNsec() - t) / replay_len;
+	
+	echo_can_free(ec);
+}
+
+
+// Times the high quality decimator on rx and interpolator on tx, per input sample
+static void _replayResample(int frame, double* down_ns, double* up_ns)
+{
+	static resample_state_t rs;
+	int16_t* buf;
+	double t;
+	int i;
+	
+	buf = malloc(2 * frame * sizeof(int16_t));
+	if (buf == NULL) {
+		*down_ns = 0;
+		*up_ns = 0;
+		return;
+	}
+	
+	resample_init_down2(&rs, RESAMPLE_QUALITY_HIGH);
+	t = _replayNsec();
+	for (i=0; i<replay_len; i+=frame) {
+		(void) resample_down2(&rs, &chan[REPLAY_CH_RX][i], frame, buf);
+	}
+	*down_ns = (_replayNsec() - t) / replay_len;
+	
+	resample_init_up2(&rs, RESAMPLE_QUALITY_HIGH);
+	t = _replayNsec();
+	for (i=0; i<replay_len; i+=frame) {
+		(void) resample_up2(&rs, &chan[REPLAY_CH_TX][i], frame, buf);
+	}
+	*up_ns = (_replayNsec() - t) / replay_len;
+	
+	free(buf);
+}
+
+
+// rx to out power ratio in dB over the frames with tx audio (NAN if there weren't any)
+static double _replayErle(const int16_t* out, int frame)
+{
+	double rx_pwr = 0;
+	double out_pwr = 0;
+	double tx_pwr;
+	int i, j;
+	
+	for (i=0; i<replay_len; i+=frame) {
+		tx_pwr = 0;
+		for (j=i; j<(i + frame); j++) {
+			tx_pwr += (double) chan[REPLAY_CH_TX][j] * chan[REPLAY_CH_TX][j];
+		}
+		if (tx_pwr < ((double) REPLAY_ACTIVE_RMS * REPLAY_ACTIVE_RMS * frame)) continue;
+		
+		for (j=i; j<(i + frame); j++) {
+			rx_pwr += (double) chan[REPLAY_CH_RX][j] * chan[REPLAY_CH_RX][j];
+			out_pwr += (double) out[j] * out[j];
+		}
+	}
+	
+	if (rx_pwr == 0) return NAN;
+	if (out_pwr == 0) out_pwr = 1;
+	return 10 * log10(rx_pwr / out_pwr);
+}
+
+
+static bool _replayWrite(const char* fn, const int16_t* buf, int len)
+{
+	FILE* fp;
+	bool ok;
+	
+	fp = fopen(fn, "wb");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not create %s\n", fn);
+		return false;
+	}
+	ok = (fwrite(buf, sizeof(int16_t), len, fp) == (size_t) len);
+	fclose(fp);
+	
+	if (!ok) fprintf(stderr, "Could not write %s\n", fn);
+	return ok;
+}
+
+
+// Returns 1 if fn holds exactly buf, 0 if not (reporting the first difference) and -2
+// if it can't be read
+static int _replayCompare(const char* fn, const int16_t* buf, int len)
+{
+	int16_t s;
+	FILE* fp;
+	int i;
+	
+	fp = fopen(fn, "rb");
+	if (fp == NULL) {
+		fprintf(stderr, "Could not open %s\n", fn);
+		return -2;
+	}
+	
+	for (i=0; i<len; i++) {
+		if (fread(&s, sizeof(int16_t), 1, fp) != 1) {
+			fprintf(stderr, "%s ends at sample %d of %d\n", fn, i, len);
+			fclose(fp);
+			return 0;
+		}
+		if (s != buf[i]) {
+			fprintf(stderr, "First difference from %s at sample %d (%d, was %d)\n", fn, i, buf[i], s);
+			fclose(fp);
+			return 0;
+		}
+	}
+	if (fread(&s, sizeof(int16_t), 1, fp) == 1) {
+		fprintf(stderr, "%s is longer than the replay\n", fn);
+		fclose(fp);
+		return 0;
+	}
+	fclose(fp);
+	
+	return 1;
+}
+
+
+static double _replayNsec()
+{
+	struct timespec ts;
+	
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double) ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+
+static void _replayUsage()
+{
+	fprintf(stderr, "Usage: dsp_replay [-t taps] [-o out.raw] [-r ref.raw] <capture dir> <num>\n");
+}
@@ -0,0 +1,42 @@
+/*
+ * Host simulation stand-in for the IDF driver/gpio.h - pin levels live in the simulation
+ * and an input's ISR handler runs when the simulation changes its level
+ */
+#ifndef _GPIO_H_
+#define _GPIO_H_
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#define SIM_GPIO_NUM 40
+
+typedef int gpio_num_t;
+typedef void (*gpio_isr_t)(void* arg);
+
+typedef enum {
+	GPIO_MODE_DISABLE,
+	GPIO_MODE_INPUT,
+	GPIO_MODE_OUTPUT,
+	GPIO_MODE_INPUT_OUTPUT
+} gpio_mode_t;
+
+typedef enum {
+	GPIO_INTR_DISABLE,
+	GPIO_INTR_POSEDGE,
+	GPIO_INTR_NEGEDGE,
+	GPIO_INTR_ANYEDGE,
+	GPIO_INTR_LOW_LEVEL,
+	GPIO_INTR_HIGH_LEVEL
+} gpio_int_type_t;
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num);
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode);
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level);
+int gpio_get_level(gpio_num_t gpio_num);
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type);
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num);
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num);
+esp_err_t gpio_install_isr_service(int intr_alloc_flags);
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void* args);
+
+#endif /* _GPIO_H_ */
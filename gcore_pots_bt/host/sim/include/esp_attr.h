@@ -0,0 +1,14 @@
+/*
+ * Host simulation stand-in for the IDF esp_attr.h (placement attributes are ignored)
+ */
+#ifndef _ESP_ATTR_H_
+#define _ESP_ATTR_H_
+
+#define IRAM_ATTR
+#define DRAM_ATTR
+#define EXT_RAM_ATTR
+#define RTC_DATA_ATTR
+#define RTC_NOINIT_ATTR
+#define NOINIT_ATTR
+
+#endif /* _ESP_ATTR_H_ */
@@ -0,0 +1,11 @@
+/*
+ * Host simulation stand-in for the IDF esp_cpu.h
+ */
+#ifndef _ESP_CPU_H_
+#define _ESP_CPU_H_
+
+#include <stdint.h>
+
+uint32_t esp_cpu_get_ccount();
+
+#endif /* _ESP_CPU_H_ */
@@ -0,0 +1,19 @@
+/*
+ * Host simulation stand-in for the IDF esp_err.h
+ */
+#ifndef _ESP_ERR_H_
+#define _ESP_ERR_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef int esp_err_t;
+
+#define ESP_OK                0
+#define ESP_FAIL              -1
+#define ESP_ERR_NO_MEM        0x101
+#define ESP_ERR_INVALID_ARG   0x102
+#define ESP_ERR_INVALID_STATE 0x103
+#define ESP_ERR_NOT_FOUND     0x105
+
+#endif /* _ESP_ERR_H_ */
@@ -0,0 +1,15 @@
+/*
+ * Host simulation stand-in for the Bluedroid esp_gap_bt_api.h
+ */
+#ifndef _ESP_GAP_BT_API_H_
+#define _ESP_GAP_BT_API_H_
+
+#include <stdint.h>
+
+#define ESP_BT_GAP_MAX_BDNAME_LEN 248
+#define ESP_BD_ADDR_LEN           6
+
+typedef uint8_t esp_bt_pin_code_t[16];
+typedef uint8_t esp_bd_addr_t[ESP_BD_ADDR_LEN];
+
+#endif /* _ESP_GAP_BT_API_H_ */
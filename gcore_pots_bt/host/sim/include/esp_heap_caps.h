@@ -0,0 +1,21 @@
+/*
+ * Host simulation stand-in for the IDF esp_heap_caps.h (every capability is the host heap)
+ */
+#ifndef _ESP_HEAP_CAPS_H_
+#define _ESP_HEAP_CAPS_H_
+
+#include <stdlib.h>
+
+#define MALLOC_CAP_8BIT     0x04
+#define MALLOC_CAP_32BIT    0x02
+#define MALLOC_CAP_DMA      0x08
+#define MALLOC_CAP_SPIRAM   0x400
+#define MALLOC_CAP_INTERNAL 0x800
+#define MALLOC_CAP_DEFAULT  0x1000
+
+#define heap_caps_malloc(size, caps) malloc(size)
+#define heap_caps_calloc(n, size, caps) calloc(n, size)
+#define heap_caps_realloc(p, size, caps) realloc(p, size)
+#define heap_caps_free(p) free(p)
+
+#endif /* _ESP_HEAP_CAPS_H_ */
@@ -0,0 +1,36 @@
+/*
+ * Host simulation stand-in for the IDF esp_partition.h (there are no partitions)
+ */
+#ifndef _ESP_PARTITION_H_
+#define _ESP_PARTITION_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include "esp_err.h"
+
+typedef enum {
+	ESP_PARTITION_TYPE_APP = 0x00,
+	ESP_PARTITION_TYPE_DATA = 0x01
+} esp_partition_type_t;
+
+typedef int esp_partition_subtype_t;
+typedef uint32_t spi_flash_mmap_handle_t;
+
+typedef enum {
+	SPI_FLASH_MMAP_DATA,
+	SPI_FLASH_MMAP_INST
+} spi_flash_mmap_memory_t;
+
+typedef struct {
+	esp_partition_type_t type;
+	esp_partition_subtype_t subtype;
+	uint32_t address;
+	uint32_t size;
+	char label[17];
+} esp_partition_t;
+
+#define esp_partition_find_first(type, subtype, label) ((const esp_partition_t*) NULL)
+#define esp_partition_mmap(part, offset, size, memory, out_ptr, out_handle) ((void) (out_ptr), (void) (out_handle), ESP_FAIL)
+#define spi_flash_munmap(handle) ((void) (handle))
+
+#endif /* _ESP_PARTITION_H_ */
@@ -0,0 +1,11 @@
+/*
+ * Host simulation stand-in for the IDF esp_rom_crc.h
+ */
+#ifndef _ESP_ROM_CRC_H_
+#define _ESP_ROM_CRC_H_
+
+#include <stdint.h>
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len);
+
+#endif /* _ESP_ROM_CRC_H_ */
@@ -0,0 +1,9 @@
+/*
+ * Host simulation stand-in for the IDF esp_system.h
+ */
+#ifndef _ESP_SYSTEM_H_
+#define _ESP_SYSTEM_H_
+
+#include "esp_err.h"
+
+#endif /* _ESP_SYSTEM_H_ */
@@ -0,0 +1,38 @@
+/*
+ * Host simulation stand-in for FreeRTOS.h - ticks at CONFIG_FREERTOS_HZ of virtual time and
+ * no preemption, so critical sections are empty
+ */
+#ifndef _FREERTOS_H_
+#define _FREERTOS_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sdkconfig.h"
+
+typedef uint32_t TickType_t;
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint8_t StackType_t;
+
+typedef struct {
+	int count;
+} portMUX_TYPE;
+
+#define configTICK_RATE_HZ          CONFIG_FREERTOS_HZ
+#define portTICK_PERIOD_MS          (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)           ((TickType_t) (((uint64_t) (ms) * configTICK_RATE_HZ) / 1000))
+
+#define pdFALSE                     0
+#define pdTRUE                      1
+#define pdFAIL                      0
+#define pdPASS                      1
+#define portMAX_DELAY               ((TickType_t) 0xFFFFFFFF)
+
+#define portMUX_INITIALIZER_UNLOCKED {0}
+#define portENTER_CRITICAL(mux)     ((void) (mux))
+#define portEXIT_CRITICAL(mux)      ((void) (mux))
+#define portENTER_CRITICAL_ISR(mux) ((void) (mux))
+#define portEXIT_CRITICAL_ISR(mux)  ((void) (mux))
+#define portYIELD_FROM_ISR()
+
+#endif /* _FREERTOS_H_ */
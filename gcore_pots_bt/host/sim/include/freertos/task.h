@@ -0,0 +1,26 @@
+/*
+ * Host simulation stand-in for FreeRTOS task.h - notifications to the simulated task are
+ * held until it waits for them, the rest are recorded
+ */
+#ifndef _TASK_H_
+#define _TASK_H_
+
+#include "freertos/FreeRTOS.h"
+
+typedef struct sim_task* TaskHandle_t;
+
+typedef enum {
+	eNoAction = 0,
+	eSetBits,
+	eIncrement,
+	eSetValueWithOverwrite,
+	eSetValueWithoutOverwrite
+} eNotifyAction;
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action);
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t* woken);
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t* value, TickType_t wait);
+TickType_t xTaskGetTickCount();
+void vTaskDelay(TickType_t ticks);
+
+#endif /* _TASK_H_ */
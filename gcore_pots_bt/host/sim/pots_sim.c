@@ -0,0 +1,90 @@
+/*
+ * pots_task running in the host simulation - the task's own initialization, notification
+ * servicing and POTS_EVAL_MSEC evaluations stepped against the virtual clock in 1 mSec
+ * increments, as pots_task's loop runs them on the target.
+ *
+ * pots_task.c is built into this file so its internal functions can be called.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <stdio.h>
+#include "pots_task.c"
+#include "pots_sim.h"
+
+
+#if (POTS_SIM_EVAL_MSEC != POTS_EVAL_MSEC)
+#error "POTS_SIM_EVAL_MSEC must match pots_task.c POTS_EVAL_MSEC"
+#endif
+
+
+
+//
+// Variables
+//
+
+// mSec since the last evaluation
+static int pots_sim_eval_msec = 0;
+
+
+
+//
+// API
+//
+void pots_sim_start(int country)
+{
+	ps_set_country_code((uint8_t) country);
+	_potsInit();
+	pots_sim_eval_msec = 0;
+}
+
+
+void pots_sim_set_country(int country)
+{
+	ps_set_country_code((uint8_t) country);
+	pots_sim_notify(POTS_NOTIFY_NEW_COUNTRY_MASK);
+	pots_sim_run_msec(POTS_EVAL_MSEC);
+}
+
+
+void pots_sim_notify(uint32_t mask)
+{
+	xTaskNotify(task_handle_pots, mask, eSetBits);
+}
+
+
+void pots_sim_run_msec(int msec)
+{
+	while (msec-- > 0) {
+		sim_advance_usec(1000);
+		
+		// Notifications wake the task right away
+		if (sim_notify_pending(task_handle_pots)) {
+			_potsService(_potsHandleNotifications(0));
+		}
+		
+		if (++pots_sim_eval_msec >= POTS_EVAL_MSEC) {
+			pots_sim_eval_msec = 0;
+			_potsEval();
+		}
+	}
+}
+
+
+void pots_sim_set_off_hook(bool en)
+{
+	sim_set_input(PIN_SHK, en ? 1 : 0);
+}
@@ -0,0 +1,49 @@
+/*
+ * pots_task running in the host simulation - the task's own initialization, notification
+ * servicing and POTS_EVAL_MSEC evaluations stepped against the virtual clock in 1 mSec
+ * increments, as pots_task's loop runs them on the target.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _POTS_SIM_H_
+#define _POTS_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "sim.h"
+
+
+
+//
+// Constants
+//
+
+// Evaluation period of the task's state machines (POTS_EVAL_MSEC)
+#define POTS_SIM_EVAL_MSEC 10
+
+
+
+//
+// API
+//
+void pots_sim_start(int country);         // Once, before the rest
+void pots_sim_set_country(int country);   // As the GUI changes it (takes one evaluation)
+void pots_sim_notify(uint32_t mask);      // POTS_NOTIFY_* from another task
+void pots_sim_run_msec(int msec);
+void pots_sim_set_off_hook(bool en);      // Switch hook level (edges go to the task's ISR)
+
+#endif /* _POTS_SIM_H_ */
@@ -0,0 +1,866 @@
+/*
+ * Host simulation of the hardware and firmware around a task - a virtual clock driving
+ * esp_timers, GPIO levels and interrupts, LEDC channels, task notifications, the event bus
+ * and audio_task's tone buffers, plus do-nothing stand-ins for the rest of the firmware
+ * pots_task calls.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sim.h"
+#include "esp_cpu.h"
+#include "esp_log.h"
+#include "esp_rom_crc.h"
+#include "esp_timer.h"
+#include "driver/gpio.h"
+#include "driver/ledc.h"
+#include "app_task.h"
+#include "audio_task.h"
+#include "gcore_task.h"
+#include "pots_task.h"
+#include "blackbox.h"
+#include "boot_prof.h"
+#include "dlog.h"
+#include "evt_bus.h"
+#include "pace.h"
+#include "prompt.h"
+#include "ps.h"
+#include "soft_timer.h"
+#include "sys_common.h"
+#include "time_utilities.h"
+
+
+
+//
+// Constants
+//
+
+// esp_timers that can exist at once
+#define SIM_MAX_TIMERS     16
+
+// Tone audio played out by audio_task (samples/mSec)
+#define SIM_TX_SAMPLES_PER_MSEC 8
+
+// Simulated CPU clock for esp_cpu_get_ccount (cycles/uSec)
+#define SIM_CPU_MHZ        240
+
+
+
+//
+// Typedefs
+//
+struct sim_timer {
+	bool in_use;
+	bool running;
+	esp_timer_cb_t callback;
+	void* arg;
+	int64_t due_usec;
+	uint64_t period_usec;                 // 0 for one-shot
+};
+
+struct sim_task {
+	uint32_t bits;
+};
+
+
+
+//
+// Variables
+//
+
+// Virtual clock
+static int64_t sim_usec = SIM_START_USEC;
+
+static struct sim_timer sim_timers[SIM_MAX_TIMERS];
+
+// GPIO
+static int sim_gpio_level[SIM_GPIO_NUM];
+static gpio_int_type_t sim_gpio_intr[SIM_GPIO_NUM];
+static gpio_isr_t sim_gpio_isr[SIM_GPIO_NUM];
+static void* sim_gpio_isr_arg[SIM_GPIO_NUM];
+static bool sim_gpio_isr_service = false;
+
+// LEDC
+static int sim_ledc_gpio[SIM_LEDC_NUM_CH];
+static uint32_t sim_ledc_duty[SIM_LEDC_NUM_CH];
+static bool sim_ledc_on[SIM_LEDC_NUM_CH];
+static uint32_t sim_ledc_freq[4];
+
+// Tasks
+static struct sim_task sim_tasks[6];
+TaskHandle_t task_handle_app = &sim_tasks[0];
+TaskHandle_t task_handle_audio = &sim_tasks[1];
+TaskHandle_t task_handle_bt = &sim_tasks[2];
+TaskHandle_t task_handle_gcore = &sim_tasks[3];
+TaskHandle_t task_handle_gui = &sim_tasks[4];
+TaskHandle_t task_handle_pots = &sim_tasks[5];
+
+// Event bus
+static sim_evt_t sim_app_evts[SIM_MAX_APP_EVTS];
+static int sim_num_app_evts = 0;
+static evt_msg_t sim_pots_evts[SIM_POTS_EVT_DEPTH];
+static int sim_num_pots_evts = 0;
+
+// audio_task
+static int sim_tone_tx_count = 0;
+static int sim_tone_tx_low = 0;
+static int sim_tone_rx_high = 0;
+static int sim_mix_tx_count[AUDIO_MIX_NUM];
+static int16_t sim_tone_capture[SIM_TONE_CAPTURE_LEN];
+static int sim_tone_capture_len = 0;
+static int64_t sim_tone_capture_usec = 0;
+static int16_t sim_tone_rx_src[SIM_TONE_RX_LEN];  // Still to arrive
+static int sim_tone_rx_src_len = 0;
+static int16_t sim_tone_rx[SIM_TONE_RX_LEN];      // In the RX ring
+static int sim_tone_rx_count = 0;
+
+// Persistent storage and app_task
+static uint8_t sim_country_code = 0;
+static char sim_cid_number[33];
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _simLogv(esp_log_level_t level, const char* tag, const char* fmt, va_list args);
+static struct sim_timer* _simNextTimer(int64_t until_usec);
+static void _simPlayTx(int64_t from_usec, int64_t to_usec);
+static void _simCaptureTx(const int16_t* buf, int len);
+
+
+
+//
+// Simulation API
+//
+int64_t sim_get_usec()
+{
+	return sim_usec;
+}
+
+
+void sim_advance_usec(int64_t usec)
+{
+	int64_t end_usec = sim_usec + usec;
+	struct sim_timer* t;
+	
+	while ((t = _simNextTimer(end_usec)) != NULL) {
+		_simPlayTx(sim_usec, t->due_usec);
+		sim_usec = t->due_usec;
+		if (t->period_usec != 0) {
+			t->due_usec += t->period_usec;
+		} else {
+			t->running = false;
+		}
+		t->callback(t->arg);
+	}
+	
+	_simPlayTx(sim_usec, end_usec);
+	sim_usec = end_usec;
+}
+
+
+void sim_set_input(int pin, int level)
+{
+	gpio_int_type_t intr = sim_gpio_intr[pin];
+	bool fire;
+	
+	if (level == sim_gpio_level[pin]) return;
+	sim_gpio_level[pin] = level;
+	
+	fire = (intr == GPIO_INTR_ANYEDGE) ||
+	       ((intr == GPIO_INTR_POSEDGE) && (level == 1)) ||
+	       ((intr == GPIO_INTR_NEGEDGE) && (level == 0));
+	if (fire && sim_gpio_isr_service && (sim_gpio_isr[pin] != NULL)) {
+		sim_gpio_isr[pin](sim_gpio_isr_arg[pin]);
+	}
+}
+
+
+int sim_get_level(int pin)
+{
+	return sim_gpio_level[pin];
+}
+
+
+bool sim_ledc_running(int ch)
+{
+	return sim_ledc_on[ch];
+}
+
+
+uint32_t sim_ledc_get_freq(int timer)
+{
+	return sim_ledc_freq[timer];
+}
+
+
+bool sim_notify_pending(TaskHandle_t task)
+{
+	return (task->bits != 0);
+}
+
+
+uint32_t sim_take_notify(TaskHandle_t task)
+{
+	uint32_t bits = task->bits;
+	
+	task->bits = 0;
+	return bits;
+}
+
+
+int sim_get_num_app_evts()
+{
+	return sim_num_app_evts;
+}
+
+
+const sim_evt_t* sim_get_app_evt(int n)
+{
+	if ((n < 0) || (n >= sim_num_app_evts)) return NULL;
+	
+	return &sim_app_evts[n];
+}
+
+
+void sim_clear_app_evts()
+{
+	sim_num_app_evts = 0;
+}
+
+
+void sim_start_tone_capture()
+{
+	sim_tone_capture_len = 0;
+	sim_tone_capture_usec = 0;
+}
+
+
+int sim_get_tone_capture(const int16_t** buf)
+{
+	*buf = sim_tone_capture;
+	return sim_tone_capture_len;
+}
+
+
+int64_t sim_get_tone_capture_usec()
+{
+	return sim_tone_capture_usec;
+}
+
+
+void sim_put_tone_rx(const int16_t* buf, int len)
+{
+	if (len > (SIM_TONE_RX_LEN - sim_tone_rx_src_len)) len = SIM_TONE_RX_LEN - sim_tone_rx_src_len;
+	memcpy(&sim_tone_rx_src[sim_tone_rx_src_len], buf, len * sizeof(int16_t));
+	sim_tone_rx_src_len += len;
+}
+
+
+bool sim_send_pots_digit(uint16_t id, char d)
+{
+	return evt_bus_send_digit(EVT_QUEUE_POTS, id, d);
+}
+
+
+void sim_set_cid_number(const char* s)
+{
+	if (s == NULL) {
+		sim_cid_number[0] = 0;
+	} else {
+		strncpy(sim_cid_number, s, sizeof(sim_cid_number) - 1);
+	}
+}
+
+
+
+//
+// IDF
+//
+void sim_log(esp_log_level_t level, const char* tag, const char* fmt, ...)
+{
+	va_list args;
+	
+	va_start(args, fmt);
+	_simLogv(level, tag, fmt, args);
+	va_end(args);
+}
+
+
+uint32_t esp_cpu_get_ccount()
+{
+	return (uint32_t) (sim_usec * SIM_CPU_MHZ);
+}
+
+
+uint32_t esp_rom_crc32_le(uint32_t crc, const uint8_t* buf, uint32_t len)
+{
+	int i;
+	
+	crc = ~crc;
+	while (len--) {
+		crc ^= *buf++;
+		for (i=0; i<8; i++) {
+			crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320 : 0);
+		}
+	}
+	
+	return ~crc;
+}
+
+
+int64_t esp_timer_get_time()
+{
+	return sim_usec;
+}
+
+
+esp_err_t esp_timer_create(const esp_timer_create_args_t* create_args, esp_timer_handle_t* out_handle)
+{
+	int i;
+	
+	for (i=0; i<SIM_MAX_TIMERS; i++) {
+		if (!sim_timers[i].in_use) {
+			memset(&sim_timers[i], 0, sizeof(struct sim_timer));
+			sim_timers[i].in_use = true;
+			sim_timers[i].callback = create_args->callback;
+			sim_timers[i].arg = create_args->arg;
+			*out_handle = &sim_timers[i];
+			return ESP_OK;
+		}
+	}
+	
+	return ESP_ERR_NO_MEM;
+}
+
+
+esp_err_t esp_timer_start_once(esp_timer_handle_t timer, uint64_t timeout_us)
+{
+	if (timer->running) return ESP_ERR_INVALID_STATE;
+	
+	timer->running = true;
+	timer->due_usec = sim_usec + timeout_us;
+	timer->period_usec = 0;
+	return ESP_OK;
+}
+
+
+esp_err_t esp_timer_start_periodic(esp_timer_handle_t timer, uint64_t period)
+{
+	if (timer->running) return ESP_ERR_INVALID_STATE;
+	
+	timer->running = true;
+	timer->due_usec = sim_usec + period;
+	timer->period_usec = period;
+	return ESP_OK;
+}
+
+
+esp_err_t esp_timer_stop(esp_timer_handle_t timer)
+{
+	if (!timer->running) return ESP_ERR_INVALID_STATE;
+	
+	timer->running = false;
+	return ESP_OK;
+}
+
+
+esp_err_t esp_timer_delete(esp_timer_handle_t timer)
+{
+	if (timer->running) return ESP_ERR_INVALID_STATE;
+	
+	timer->in_use = false;
+	return ESP_OK;
+}
+
+
+BaseType_t xTaskNotify(TaskHandle_t task, uint32_t value, eNotifyAction action)
+{
+	if (action == eSetBits) {
+		task->bits |= value;
+	} else if (action == eSetValueWithOverwrite) {
+		task->bits = value;
+	}
+	
+	return pdPASS;
+}
+
+
+BaseType_t xTaskNotifyFromISR(TaskHandle_t task, uint32_t value, eNotifyAction action, BaseType_t* woken)
+{
+	if (woken != NULL) *woken = pdFALSE;
+	
+	return xTaskNotify(task, value, action);
+}
+
+
+// Only the simulated task waits, and never blocks (the simulation owns time)
+BaseType_t xTaskNotifyWait(uint32_t clear_on_entry, uint32_t clear_on_exit, uint32_t* value, TickType_t wait)
+{
+	struct sim_task* task = task_handle_pots;
+	
+	task->bits &= ~clear_on_entry;
+	if (task->bits == 0) return pdFALSE;
+	
+	*value = task->bits;
+	task->bits &= ~clear_on_exit;
+	return pdTRUE;
+}
+
+
+TickType_t xTaskGetTickCount()
+{
+	return (TickType_t) ((sim_usec * configTICK_RATE_HZ) / 1000000);
+}
+
+
+void vTaskDelay(TickType_t ticks)
+{
+	sim_advance_usec(((int64_t) ticks * 1000000) / configTICK_RATE_HZ);
+}
+
+
+esp_err_t gpio_reset_pin(gpio_num_t gpio_num)
+{
+	sim_gpio_intr[gpio_num] = GPIO_INTR_DISABLE;
+	return ESP_OK;
+}
+
+
+esp_err_t gpio_set_direction(gpio_num_t gpio_num, gpio_mode_t mode)
+{
+	return ESP_OK;
+}
+
+
+esp_err_t gpio_set_level(gpio_num_t gpio_num, uint32_t level)
+{
+	sim_gpio_level[gpio_num] = (level != 0) ? 1 : 0;
+	return ESP_OK;
+}
+
+
+int gpio_get_level(gpio_num_t gpio_num)
+{
+	return sim_gpio_level[gpio_num];
+}
+
+
+esp_err_t gpio_set_intr_type(gpio_num_t gpio_num, gpio_int_type_t intr_type)
+{
+	sim_gpio_intr[gpio_num] = intr_type;
+	return ESP_OK;
+}
+
+
+esp_err_t gpio_intr_enable(gpio_num_t gpio_num)
+{
+	return ESP_OK;
+}
+
+
+esp_err_t gpio_intr_disable(gpio_num_t gpio_num)
+{
+	return ESP_OK;
+}
+
+
+esp_err_t gpio_install_isr_service(int intr_alloc_flags)
+{
+	if (sim_gpio_isr_service) return ESP_ERR_INVALID_STATE;
+	
+	sim_gpio_isr_service = true;
+	return ESP_OK;
+}
+
+
+esp_err_t gpio_isr_handler_add(gpio_num_t gpio_num, gpio_isr_t isr_handler, void* args)
+{
+	if (!sim_gpio_isr_service) return ESP_ERR_INVALID_STATE;
+	
+	sim_gpio_isr[gpio_num] = isr_handler;
+	sim_gpio_isr_arg[gpio_num] = args;
+	return ESP_OK;
+}
+
+
+esp_err_t ledc_timer_config(const ledc_timer_config_t* timer_conf)
+{
+	sim_ledc_freq[timer_conf->timer_num] = timer_conf->freq_hz;
+	return ESP_OK;
+}
+
+
+esp_err_t ledc_channel_config(const ledc_channel_config_t* ledc_conf)
+{
+	sim_ledc_gpio[ledc_conf->channel] = ledc_conf->gpio_num;
+	sim_ledc_duty[ledc_conf->channel] = ledc_conf->duty;
+	sim_ledc_on[ledc_conf->channel] = (ledc_conf->duty != 0);
+	return ESP_OK;
+}
+
+
+esp_err_t ledc_set_freq(ledc_mode_t speed_mode, ledc_timer_t timer_num, uint32_t freq_hz)
+{
+	if (freq_hz == 0) return ESP_ERR_INVALID_ARG;
+	
+	sim_ledc_freq[timer_num] = freq_hz;
+	return ESP_OK;
+}
+
+
+esp_err_t ledc_timer_rst(ledc_mode_t speed_mode, ledc_timer_t timer_sel)
+{
+	return ESP_OK;
+}
+
+
+esp_err_t ledc_set_duty(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t duty)
+{
+	sim_ledc_duty[channel] = duty;
+	return ESP_OK;
+}
+
+
+esp_err_t ledc_update_duty(ledc_mode_t speed_mode, ledc_channel_t channel)
+{
+	sim_ledc_on[channel] = (sim_ledc_duty[channel] != 0);
+	return ESP_OK;
+}
+
+
+// The pin is left at idle_level until the duty is next updated
+esp_err_t ledc_stop(ledc_mode_t speed_mode, ledc_channel_t channel, uint32_t idle_level)
+{
+	sim_ledc_on[channel] = false;
+	sim_gpio_level[sim_ledc_gpio[channel]] = (idle_level != 0) ? 1 : 0;
+	return ESP_OK;
+}
+
+
+
+//
+// Firmware
+//
+void audioSetToneWatermarks(int tx_low, int rx_high)
+{
+	sim_tone_tx_low = tx_low;
+	sim_tone_rx_high = rx_high;
+}
+
+
+void audioMarkOffHook()
+{
+}
+
+
+int audioGetTxCount()
+{
+	return sim_tone_tx_count;
+}
+
+
+int audioGetRxCount()
+{
+	return sim_tone_rx_count;
+}
+
+
+int audioGetToneRx(int16_t* buf, int len)
+{
+	if (len > sim_tone_rx_count) len = sim_tone_rx_count;
+	memcpy(buf, sim_tone_rx, len * sizeof(int16_t));
+	sim_tone_rx_count -= len;
+	memmove(sim_tone_rx, &sim_tone_rx[len], sim_tone_rx_count * sizeof(int16_t));
+	
+	return len;
+}
+
+
+void audioPutToneTx(int16_t* buf, int len)
+{
+	sim_tone_tx_count += len;
+	_simCaptureTx(buf, len);
+}
+
+
+void audioPutToneTxBuffer(const int16_t* buf, int len)
+{
+	sim_tone_tx_count = (buf == NULL) ? 0 : len;
+	if (buf != NULL) _simCaptureTx(buf, len);
+}
+
+
+void audioFlushToneTx()
+{
+	sim_tone_tx_count = 0;
+}
+
+
+bool audioToneTxReady()
+{
+	return true;
+}
+
+
+void audioPutMixTx(int source, const int16_t* buf, int len)
+{
+	sim_mix_tx_count[source] += len;
+}
+
+
+int audioGetMixTxCount(int source)
+{
+	return sim_mix_tx_count[source];
+}
+
+
+void audioFlushMixTx(int source)
+{
+	sim_mix_tx_count[source] = 0;
+}
+
+
+void audioSetMixGain(int source, float g)
+{
+}
+
+
+void audioSetDtmfAck(bool en)
+{
+}
+
+
+int app_get_cid_number(char* pn)
+{
+	strcpy(pn, sim_cid_number);
+	return strlen(pn);
+}
+
+
+int app_get_cw_number(char* pn)
+{
+	return app_get_cid_number(pn);
+}
+
+
+void gcore_get_power_state(enum BATT_STATE_t* bs, enum CHARGE_STATE_t* cs)
+{
+	*bs = BATT_100;
+	*cs = CHARGE_OFF;
+}
+
+
+void blackbox_state(const char* tag, const char* from, const char* to)
+{
+}
+
+
+void boot_prof_set_ready(uint32_t bits, const char* phase)
+{
+}
+
+
+void dlog_write(esp_log_level_t level, const char* tag, const char* fmt, ...)
+{
+	va_list args;
+	
+	va_start(args, fmt);
+	_simLogv(level, tag, fmt, args);
+	va_end(args);
+}
+
+
+bool evt_bus_send_id(int q, uint16_t id)
+{
+	return evt_bus_send_digit(q, id, 0);
+}
+
+
+bool evt_bus_send_digit(int q, uint16_t id, char d)
+{
+	if (q == EVT_QUEUE_APP) {
+		if (sim_num_app_evts == SIM_MAX_APP_EVTS) return false;
+		sim_app_evts[sim_num_app_evts].id = id;
+		sim_app_evts[sim_num_app_evts].digit = d;
+		sim_app_evts[sim_num_app_evts].usec = sim_usec;
+		sim_num_app_evts++;
+	} else if (q == EVT_QUEUE_POTS) {
+		if (sim_num_pots_evts == SIM_POTS_EVT_DEPTH) return false;
+		memset(&sim_pots_evts[sim_num_pots_evts], 0, sizeof(evt_msg_t));
+		sim_pots_evts[sim_num_pots_evts].id = id;
+		sim_pots_evts[sim_num_pots_evts].sent_usec = (uint32_t) sim_usec;
+		sim_pots_evts[sim_num_pots_evts].u.digit = d;
+		sim_num_pots_evts++;
+	}
+	
+	return true;
+}
+
+
+bool evt_bus_receive(int q, evt_msg_t* msg, TickType_t wait)
+{
+	if ((q != EVT_QUEUE_POTS) || (sim_num_pots_evts == 0)) return false;
+	
+	*msg = sim_pots_evts[0];
+	memmove(&sim_pots_evts[0], &sim_pots_evts[1], (sim_num_pots_evts - 1) * sizeof(evt_msg_t));
+	sim_num_pots_evts--;
+	return true;
+}
+
+
+void pace_declare(int id, const char* name, int type, uint32_t period_usec)
+{
+}
+
+
+void pace_checkin(int id)
+{
+}
+
+
+bool prompt_play(int id)
+{
+	return false;
+}
+
+
+void prompt_stop()
+{
+}
+
+
+uint8_t ps_get_country_code()
+{
+	return sim_country_code;
+}
+
+
+void ps_set_country_code(uint8_t code)
+{
+	sim_country_code = code;
+}
+
+
+void soft_timer_start(int t, uint32_t msec)
+{
+}
+
+
+void soft_timer_stop(int t)
+{
+}
+
+
+bool soft_timer_expired(int t)
+{
+	return false;
+}
+
+
+void time_get(tmElements_t* te)
+{
+	memset(te, 0, sizeof(tmElements_t));
+	te->Day = 1;
+	te->Month = 1;
+}
+
+
+void time_get_cid_string(tmElements_t te, char* buf)
+{
+	sprintf(buf, "%02d%02d%02d%02d", te.Month, te.Day, te.Hour, te.Minute);
+}
+
+
+
+//
+// Internal functions
+//
+static void _simLogv(esp_log_level_t level, const char* tag, const char* fmt, va_list args)
+{
+	static const char level_char[] = {'N', 'E', 'W', 'I', 'D', 'V'};
+	
+	if ((level > ESP_LOG_WARN) && (getenv("SIM_VERBOSE") == NULL)) return;
+	
+	fprintf(stderr, "%c (%lld) %s: ", level_char[level], (long long) (sim_usec / 1000), tag);
+	vfprintf(stderr, fmt, args);
+	fprintf(stderr, "\n");
+}
+
+
+// Running timer due first at or before until_usec
+static struct sim_timer* _simNextTimer(int64_t until_usec)
+{
+	struct sim_timer* t = NULL;
+	int i;
+	
+	for (i=0; i<SIM_MAX_TIMERS; i++) {
+		if (sim_timers[i].in_use && sim_timers[i].running && (sim_timers[i].due_usec <= until_usec)) {
+			if ((t == NULL) || (sim_timers[i].due_usec < t->due_usec)) {
+				t = &sim_timers[i];
+			}
+		}
+	}
+	
+	return t;
+}
+
+
+// audio_task plays tone audio out at 8 kHz and says when it is running low
+static void _simPlayTx(int64_t from_usec, int64_t to_usec)
+{
+	int n;
+	int i;
+	bool was_high = (sim_tone_tx_count >= sim_tone_tx_low);
+	
+	n = (int) ((to_usec * SIM_TX_SAMPLES_PER_MSEC) / 1000 - (from_usec * SIM_TX_SAMPLES_PER_MSEC) / 1000);
+	
+	sim_tone_tx_count = (sim_tone_tx_count > n) ? sim_tone_tx_count - n : 0;
+	for (i=0; i<AUDIO_MIX_NUM; i++) {
+		sim_mix_tx_count[i] = (sim_mix_tx_count[i] > n) ? sim_mix_tx_count[i] - n : 0;
+	}
+	
+	if (was_high && (sim_tone_tx_count < sim_tone_tx_low)) {
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_AUDIO_TX_LOW_MASK, eSetBits);
+	}
+	
+	// Phone audio arrives at the same rate (the RX ring drops it when full)
+	if (n > sim_tone_rx_src_len) n = sim_tone_rx_src_len;
+	if (n > 0) {
+		i = (n < (SIM_TONE_RX_LEN - sim_tone_rx_count)) ? n : SIM_TONE_RX_LEN - sim_tone_rx_count;
+		memcpy(&sim_tone_rx[sim_tone_rx_count], sim_tone_rx_src, i * sizeof(int16_t));
+		sim_tone_rx_count += i;
+		sim_tone_rx_src_len -= n;
+		memmove(sim_tone_rx_src, &sim_tone_rx_src[n], sim_tone_rx_src_len * sizeof(int16_t));
+	}
+	if ((sim_tone_rx_high != 0) && (sim_tone_rx_count >= sim_tone_rx_high)) {
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_AUDIO_RX_READY_MASK, eSetBits);
+	}
+}
+
+
+static void _simCaptureTx(const int16_t* buf, int len)
+{
+	if ((sim_tone_capture_len == 0) && (len > 0)) sim_tone_capture_usec = sim_usec;
+	if (len > (SIM_TONE_CAPTURE_LEN - sim_tone_capture_len)) len = SIM_TONE_CAPTURE_LEN - sim_tone_capture_len;
+	memcpy(&sim_tone_capture[sim_tone_capture_len], buf, len * sizeof(int16_t));
+	sim_tone_capture_len += len;
+}
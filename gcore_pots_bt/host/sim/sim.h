@@ -0,0 +1,98 @@
+/*
+ * Host simulation of the hardware and firmware around a task - a virtual clock driving
+ * esp_timers, GPIO levels and interrupts, LEDC channels, task notifications, the event bus
+ * and audio_task's tone buffers.  The shim headers in sim/include declare the IDF API it
+ * implements.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _SIM_H_
+#define _SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+
+
+//
+// Constants
+//
+
+// Virtual clock at start (esp_timer_get_time() is never 0 on the target)
+#define SIM_START_USEC     1000000
+
+// Events recorded from EVT_QUEUE_APP
+#define SIM_MAX_APP_EVTS   256
+
+// Events waiting in EVT_QUEUE_POTS
+#define SIM_POTS_EVT_DEPTH 8
+
+// Tone audio recorded as it's queued to audio_task (samples)
+#define SIM_TONE_CAPTURE_LEN (8000 * 10)
+
+// Line audio from the phone waiting to reach audio_task's RX ring (samples)
+#define SIM_TONE_RX_LEN      (8000 * 10)
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint16_t id;
+	char digit;                           // For events with a digit payload
+	int64_t usec;                         // Virtual time it was sent
+} sim_evt_t;
+
+
+
+//
+// API
+//
+
+// Virtual clock
+int64_t sim_get_usec();
+void sim_advance_usec(int64_t usec);      // Fires due esp_timers in order and plays out audio
+
+// GPIO and LEDC
+void sim_set_input(int pin, int level);   // Runs the pin's ISR on a change
+int sim_get_level(int pin);
+bool sim_ledc_running(int ch);            // Driving its pin with a non-zero duty
+uint32_t sim_ledc_get_freq(int timer);
+
+// Task notifications
+bool sim_notify_pending(TaskHandle_t task);
+uint32_t sim_take_notify(TaskHandle_t task);  // Returns and clears the task's bits
+
+// Tone audio
+void sim_start_tone_capture();            // Discards what was recorded
+int sim_get_tone_capture(const int16_t** buf);  // Returns the samples recorded
+int64_t sim_get_tone_capture_usec();      // Virtual time the first was queued, 0 if none yet
+void sim_put_tone_rx(const int16_t* buf, int len);  // Arrives from the phone at 8 samples/mSec
+
+// Event bus
+int sim_get_num_app_evts();
+const sim_evt_t* sim_get_app_evt(int n);  // n = 0 .. sim_get_num_app_evts() - 1
+void sim_clear_app_evts();
+bool sim_send_pots_digit(uint16_t id, char d);
+
+// Firmware state
+void sim_set_cid_number(const char* s);   // NULL for no caller ID number
+
+#endif /* _SIM_H_ */
@@ -0,0 +1,42 @@
+/*
+ * Minimal checks for the host scenario tests - a failed check is reported with its location
+ * and the test carries on, exiting non-zero at the end if any failed.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef _CHECK_H_
+#define _CHECK_H_
+
+#include <stdio.h>
+
+static int check_failures = 0;
+
+#define CHECK(cond, fmt, ...) \
+	do { \
+		if (!(cond)) { \
+			fprintf(stderr, "%s:%d: %s - " fmt "\n", __FILE__, __LINE__, #cond, ##__VA_ARGS__); \
+			check_failures++; \
+		} \
+	} while (0)
+
+#define CHECK_EXIT() \
+	do { \
+		printf("%s\n", (check_failures == 0) ? "PASS" : "FAIL"); \
+		return (check_failures == 0) ? 0 : 1; \
+	} while (0)
+
+#endif /* _CHECK_H_ */
@@ -0,0 +1,225 @@
+/*
+ * pots_task Caller ID scenarios - every country's Caller ID message decoded from the tone
+ * audio queued for the first ring of a call, holding the caller's number, and sent while the
+ * ringer is quiet before or after the first ring as the country's standard requires.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+#include "check.h"
+#include "pots_sim.h"
+#include "app_task.h"
+#include "pots_task.h"
+#include "international.h"
+#include "spandsp.h"
+
+
+
+//
+// Constants
+//
+#define CID_NUMBER       "5551234567"
+
+// Chunks decoded at a time, as audio_task plays them (one pots_task evaluation)
+#define CID_CHUNK_LEN    (8000 * POTS_SIM_EVAL_MSEC / 1000)
+
+// Time allowed for the first ring of a call with its Caller ID sequence (mSec)
+#define FIRST_RING_MSEC  12000
+
+// Most RM edges recorded
+#define MAX_EDGES        16
+
+
+
+//
+// Variables
+//
+
+// RM edges during _runRing
+static int64_t edge_usec[MAX_EDGES];
+static int num_edges;
+
+// Set by the receiver when a message holding CID_NUMBER is decoded
+static bool msg_decoded;
+static bool msg_match;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _runRing(int msec);
+static void _checkCid(const country_info_t* infoP);
+static int _cidStandard(int cid_spec);
+static void _cidCallback(void* user_data, const uint8_t* msg, int len);
+
+
+
+//
+// Main
+//
+int main(int argc, char** argv)
+{
+	const country_info_t* infoP;
+	const int16_t* buf;
+	int c;
+	
+	pots_sim_start(0);
+	pots_sim_run_msec(1000);
+	
+	for (c=0; c<int_get_num_countries(); c++) {
+		infoP = int_get_country_info(c);
+		printf("%s\n", infoP->name);
+		pots_sim_set_country(c);
+		sim_set_cid_number(CID_NUMBER);
+		
+		sim_start_tone_capture();
+		pots_sim_notify(POTS_NOTIFY_RING_MASK);
+		_runRing(FIRST_RING_MSEC);
+		_checkCid(infoP);
+		
+		// The rest of the call's rings don't repeat it
+		sim_start_tone_capture();
+		pots_sim_notify(POTS_NOTIFY_RING_MASK);
+		_runRing(FIRST_RING_MSEC);
+		CHECK(sim_get_tone_capture(&buf) == 0, "%s sent Caller ID on the second ring", infoP->name);
+		
+		pots_sim_notify(POTS_NOTIFY_DONE_RINGING_MASK);
+		pots_sim_run_msec(1000);
+	}
+	
+	CHECK_EXIT();
+}
+
+
+
+//
+// Internal functions
+//
+
+// Runs pots_task recording RM edges
+static void _runRing(int msec)
+{
+	int rm = sim_get_level(PIN_RM);
+	
+	num_edges = 0;
+	while (msec-- > 0) {
+		pots_sim_run_msec(1);
+		if (sim_get_level(PIN_RM) != rm) {
+			rm = sim_get_level(PIN_RM);
+			if (num_edges < MAX_EDGES) {
+				edge_usec[num_edges++] = sim_get_usec();
+			}
+		}
+	}
+}
+
+
+static void _checkCid(const country_info_t* infoP)
+{
+	adsi_rx_state_t* rx_stateP;
+	const int16_t* buf;
+	int64_t start_usec;
+	int64_t end_usec;
+	int after_ring;
+	int i, n, len;
+	int std;
+	
+	len = sim_get_tone_capture(&buf);
+	start_usec = sim_get_tone_capture_usec();
+	end_usec = start_usec + (int64_t) len * 125;
+	
+	std = _cidStandard(infoP->cid.cid_spec);
+	if (std == ADSI_STANDARD_NONE) {
+		CHECK(len == 0, "%s sent %d samples without supported Caller ID", infoP->name, len);
+		return;
+	}
+	CHECK(len > 0, "%s sent no Caller ID", infoP->name);
+	if (len == 0) return;
+	
+	// Decode in the chunks audio_task would play
+	msg_decoded = false;
+	msg_match = false;
+	rx_stateP = adsi_rx_init(NULL, std, _cidCallback, NULL);
+	for (i=0; i<len; i+=n) {
+		n = ((len - i) > CID_CHUNK_LEN) ? CID_CHUNK_LEN : len - i;
+		(void) adsi_rx(rx_stateP, &buf[i], n);
+	}
+	adsi_rx_free(rx_stateP);
+	CHECK(msg_decoded, "%s Caller ID (%s) didn't decode from %d mSec", infoP->name,
+	      adsi_standard_to_str(std), len / 8);
+	CHECK(!msg_decoded || msg_match, "%s Caller ID doesn't hold %s", infoP->name, CID_NUMBER);
+	
+	// The ringer is quiet while the message plays, which comes after the first ring or
+	// ring alert unless the standard sends it first
+	after_ring = 0;
+	for (i=0; i<num_edges; i++) {
+		CHECK((edge_usec[i] <= start_usec) || (edge_usec[i] >= end_usec),
+		      "%s rang %d mSec into Caller ID", infoP->name, (int) ((edge_usec[i] - start_usec) / 1000));
+		if (edge_usec[i] <= start_usec) after_ring++;
+	}
+	if (((infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING) == 0) || ((infoP->cid.cid_spec & INT_CID_FLAG_EN_RP_AS) != 0)) {
+		CHECK(after_ring >= 2, "%s Caller ID sent before the ring", infoP->name);
+	} else {
+		CHECK(after_ring == 0, "%s Caller ID sent after the ring", infoP->name);
+	}
+}
+
+
+// Receiver for the country's Caller ID type (as pots_task renders it)
+static int _cidStandard(int cid_spec)
+{
+	switch (cid_spec & INT_CID_TYPE_MASK) {
+		case INT_CID_TYPE_BELLCORE_FSK:
+			return ADSI_STANDARD_CLASS;
+		
+		case INT_CID_TYPE_ETSI_FSK:
+		case INT_CID_TYPE_SIN227:
+			return ADSI_STANDARD_CLIP;
+		
+		case INT_CID_TYPE_DTMF1:
+		case INT_CID_TYPE_DTMF2:
+		case INT_CID_TYPE_DTMF3:
+		case INT_CID_TYPE_DTMF4:
+			return ADSI_STANDARD_CLIP_DTMF;
+		
+		case INT_CID_TYPE_JCLIP:
+		case INT_CID_TYPE_ACLIP:
+			return ADSI_STANDARD_JCLIP;
+		
+		default:
+			return ADSI_STANDARD_NONE;
+	}
+}
+
+
+// Called from adsi_rx with a complete message (FSK checksum already verified)
+static void _cidCallback(void* user_data, const uint8_t* msg, int len)
+{
+	int i;
+	int n = strlen(CID_NUMBER);
+	
+	msg_decoded = true;
+	for (i=0; i<=(len - n); i++) {
+		if (memcmp(&msg[i], CID_NUMBER, n) == 0) {
+			msg_match = true;
+			break;
+		}
+	}
+}
@@ -0,0 +1,209 @@
+/*
+ * pots_task dial scenarios - digits dialed for the phone by app_task played to it as DTMF
+ * the receiver decodes, and DTMF dialed on the phone detected and reported to app_task in
+ * order, ending dial tone.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "check.h"
+#include "pots_sim.h"
+#include "app_task.h"
+#include "pots_task.h"
+#include "spandsp.h"
+
+
+
+//
+// Constants
+//
+#define DIGITS           "1234567890*#"
+
+// Time each digit is given to be played or detected (mSec)
+#define DIGIT_MSEC       500
+
+// Time the phone is left off-hook with dial tone before dialing (mSec)
+#define DIAL_TONE_MSEC   500
+
+// Samples in a period of dial tone checked for level
+#define LEVEL_LEN        800
+
+// Phone's DTMF level (dBm0 per tone) and timing (mSec)
+#define PHONE_LEVEL      -10
+#define PHONE_ON_MSEC    80
+#define PHONE_OFF_MSEC   80
+
+
+
+//
+// Variables
+//
+
+// First event of the current scenario
+static int first_evt;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _startScenario(const char* name);
+static void _pickUp();
+static void _hangUp();
+static int _getDialed(char* digits, int max);
+static int _decodeCapture(char* digits, int max);
+static int32_t _captureLevel();
+
+
+
+//
+// Main
+//
+int main(int argc, char** argv)
+{
+	dtmf_tx_state_t* tx_stateP;
+	int16_t buf[PHONE_ON_MSEC * 8];
+	char digits[32];
+	int i, n;
+	
+	pots_sim_start(0);
+	pots_sim_notify(POTS_NOTIFY_IN_SERVICE_MASK);
+	pots_sim_run_msec(1000);
+	
+	_startScenario("dialed by app_task");
+	_pickUp();
+	for (i=0; i<(int) strlen(DIGITS); i++) {
+		sim_start_tone_capture();
+		CHECK(sim_send_pots_digit(POTS_EVT_EXT_DIAL_DIGIT, DIGITS[i]), "could not send %c", DIGITS[i]);
+		pots_sim_run_msec(DIGIT_MSEC);
+		n = _decodeCapture(digits, sizeof(digits));
+		CHECK((n == 1) && (digits[0] == DIGITS[i]), "sent %c, phone heard \"%s\"", DIGITS[i], digits);
+	}
+	CHECK(_getDialed(digits, sizeof(digits)) == 0, "app_task's digits reported as dialed: \"%s\"", digits);
+	_hangUp();
+	
+	_startScenario("dialed on the phone");
+	_pickUp();
+	sim_start_tone_capture();
+	pots_sim_run_msec(DIAL_TONE_MSEC);
+	CHECK(_captureLevel() > 0, "no dial tone");
+	
+	tx_stateP = dtmf_tx_init(NULL);
+	dtmf_tx_set_level(tx_stateP, PHONE_LEVEL, 0);
+	dtmf_tx_set_timing(tx_stateP, PHONE_ON_MSEC, PHONE_OFF_MSEC);
+	for (i=0; i<(int) strlen(DIGITS); i++) {
+		(void) dtmf_tx_put(tx_stateP, &DIGITS[i], 1);
+		while ((n = dtmf_tx(tx_stateP, buf, sizeof(buf) / sizeof(int16_t))) > 0) {
+			sim_put_tone_rx(buf, n);
+		}
+		pots_sim_run_msec(DIGIT_MSEC);
+		
+		// The first digit ends dial tone
+		if (i == 0) {
+			sim_start_tone_capture();
+			pots_sim_run_msec(DIAL_TONE_MSEC);
+			CHECK(_captureLevel() == 0, "dial tone after the first digit");
+		}
+	}
+	dtmf_tx_free(tx_stateP);
+	(void) _getDialed(digits, sizeof(digits));
+	CHECK(strcmp(digits, DIGITS) == 0, "dialed \"%s\", detected \"%s\"", DIGITS, digits);
+	_hangUp();
+	
+	CHECK_EXIT();
+}
+
+
+
+//
+// Internal functions
+//
+static void _startScenario(const char* name)
+{
+	printf("%s\n", name);
+	first_evt = sim_get_num_app_evts();
+}
+
+
+static void _pickUp()
+{
+	pots_sim_set_off_hook(true);
+	pots_sim_run_msec(DIAL_TONE_MSEC);
+}
+
+
+static void _hangUp()
+{
+	pots_sim_set_off_hook(false);
+	pots_sim_run_msec(1000);
+}
+
+
+// Digits reported to app_task in the current scenario
+static int _getDialed(char* digits, int max)
+{
+	int i;
+	int n = 0;
+	
+	for (i=first_evt; (i<sim_get_num_app_evts()) && (n < (max - 1)); i++) {
+		if (sim_get_app_evt(i)->id == APP_EVT_POTS_DIGIT_DIALED) {
+			digits[n++] = sim_get_app_evt(i)->digit;
+		}
+	}
+	digits[n] = 0;
+	
+	return n;
+}
+
+
+// Digits in the tone audio recorded since the capture started
+static int _decodeCapture(char* digits, int max)
+{
+	dtmf_rx_state_t* rx_stateP;
+	const int16_t* buf;
+	int len;
+	int n;
+	
+	len = sim_get_tone_capture(&buf);
+	rx_stateP = dtmf_rx_init(NULL, NULL, NULL);
+	(void) dtmf_rx(rx_stateP, buf, len);
+	n = (int) dtmf_rx_get(rx_stateP, digits, max - 1);
+	digits[n] = 0;
+	dtmf_rx_free(rx_stateP);
+	
+	return n;
+}
+
+
+// Largest sample magnitude in the last LEVEL_LEN samples recorded
+static int32_t _captureLevel()
+{
+	const int16_t* buf;
+	int32_t level = 0;
+	int len;
+	int i;
+	
+	len = sim_get_tone_capture(&buf);
+	for (i=(len > LEVEL_LEN) ? len - LEVEL_LEN : 0; i<len; i++) {
+		if (abs(buf[i]) > level) level = abs(buf[i]);
+	}
+	
+	return level;
+}
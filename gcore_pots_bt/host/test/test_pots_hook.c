@@ -0,0 +1,195 @@
+/*
+ * pots_task hook switch scenarios - going off-hook through contact bounce, glitches
+ * shorter than the debounce period, rotary dialed digits, a hook flash and hanging up,
+ * checked against the events sent to app_task and when they were sent.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include "check.h"
+#include "pots_sim.h"
+#include "app_task.h"
+#include "pots_task.h"
+#include "international.h"
+
+
+
+//
+// Constants
+//
+
+// pots_task.c timing (mSec)
+#define HOOK_DEBOUNCE_MSEC  8
+#define ON_HOOK_DETECT_MSEC 500
+
+// A 10 pulse/sec dial with a 60% break
+#define DIAL_BREAK_MSEC     60
+#define DIAL_MAKE_MSEC      40
+#define DIAL_GAP_MSEC       700
+
+#define FLASH_MSEC          300
+
+
+
+//
+// Variables
+//
+
+// First event of the current scenario
+static int first_evt;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _startScenario(const char* name);
+static int _countEvts(uint16_t id);
+static const sim_evt_t* _findEvt(uint16_t id);
+static void _dialPulses(int pulses);
+
+
+
+//
+// Main
+//
+int main(int argc, char** argv)
+{
+	const country_info_t* infoP;
+	const sim_evt_t* e;
+	int64_t t0;
+	int pulses;
+	
+	pots_sim_start(0);
+	infoP = int_get_country_info(0);
+	pots_sim_run_msec(1000);
+	CHECK(sim_get_num_app_evts() == 0, "%d events while on-hook", sim_get_num_app_evts());
+	
+	_startScenario("off-hook with contact bounce");
+	t0 = sim_get_usec();
+	pots_sim_set_off_hook(true);
+	pots_sim_run_msec(2);
+	pots_sim_set_off_hook(false);
+	pots_sim_run_msec(1);
+	pots_sim_set_off_hook(true);
+	pots_sim_run_msec(100);
+	CHECK(_countEvts(APP_EVT_POTS_OFF_HOOK) == 1, "%d off-hook events", _countEvts(APP_EVT_POTS_OFF_HOOK));
+	CHECK(_countEvts(APP_EVT_POTS_ON_HOOK) == 0, "bounce reported as on-hook");
+	e = _findEvt(APP_EVT_POTS_OFF_HOOK);
+	if (e != NULL) {
+		CHECK((e->usec - t0) <= (3 + HOOK_DEBOUNCE_MSEC + POTS_SIM_EVAL_MSEC) * 1000,
+		      "off-hook reported after %d mSec", (int) ((e->usec - t0) / 1000));
+	}
+	
+	_startScenario("glitch shorter than the debounce period");
+	pots_sim_set_off_hook(false);
+	pots_sim_run_msec(HOOK_DEBOUNCE_MSEC / 2);
+	pots_sim_set_off_hook(true);
+	pots_sim_run_msec(1000);
+	CHECK(sim_get_num_app_evts() == first_evt, "%d events for a glitch", sim_get_num_app_evts() - first_evt);
+	
+	for (pulses=1; pulses<=10; pulses++) {
+		_startScenario("rotary digit");
+		_dialPulses(pulses);
+		CHECK(_countEvts(APP_EVT_POTS_DIGIT_DIALED) == 1, "%d digits for %d pulses",
+		      _countEvts(APP_EVT_POTS_DIGIT_DIALED), pulses);
+		e = _findEvt(APP_EVT_POTS_DIGIT_DIALED);
+		if (e != NULL) {
+			CHECK(e->digit == ('0' + infoP->rotary_map[pulses-1]), "dialed %c for %d pulses", e->digit, pulses);
+		}
+		CHECK((_countEvts(APP_EVT_POTS_ON_HOOK) + _countEvts(APP_EVT_POTS_OFF_HOOK) +
+		       _countEvts(APP_EVT_POTS_HOOK_FLASH)) == 0, "hook events dialing %d pulses", pulses);
+	}
+	
+	_startScenario("hook flash");
+	pots_sim_set_off_hook(false);
+	pots_sim_run_msec(FLASH_MSEC);
+	pots_sim_set_off_hook(true);
+	pots_sim_run_msec(DIAL_GAP_MSEC);
+	CHECK(_countEvts(APP_EVT_POTS_HOOK_FLASH) == 1, "%d hook flash events", _countEvts(APP_EVT_POTS_HOOK_FLASH));
+	CHECK(_countEvts(APP_EVT_POTS_DIGIT_DIALED) == 0, "hook flash dialed a digit");
+	CHECK(_countEvts(APP_EVT_POTS_ON_HOOK) == 0, "hook flash reported as on-hook");
+	
+	_startScenario("on-hook");
+	t0 = sim_get_usec();
+	pots_sim_set_off_hook(false);
+	pots_sim_run_msec(ON_HOOK_DETECT_MSEC - POTS_SIM_EVAL_MSEC);
+	CHECK(_countEvts(APP_EVT_POTS_ON_HOOK) == 0, "on-hook reported early");
+	pots_sim_run_msec(1000);
+	CHECK(_countEvts(APP_EVT_POTS_ON_HOOK) == 1, "%d on-hook events", _countEvts(APP_EVT_POTS_ON_HOOK));
+	CHECK(_countEvts(APP_EVT_POTS_DIGIT_DIALED) == 0, "on-hook dialed a digit");
+	e = _findEvt(APP_EVT_POTS_ON_HOOK);
+	if (e != NULL) {
+		CHECK((e->usec - t0) <= (ON_HOOK_DETECT_MSEC + POTS_SIM_EVAL_MSEC) * 1000,
+		      "on-hook reported after %d mSec", (int) ((e->usec - t0) / 1000));
+	}
+	
+	CHECK_EXIT();
+}
+
+
+
+//
+// Internal functions
+//
+static void _startScenario(const char* name)
+{
+	printf("%s\n", name);
+	first_evt = sim_get_num_app_evts();
+}
+
+
+static int _countEvts(uint16_t id)
+{
+	int i;
+	int n = 0;
+	
+	for (i=first_evt; i<sim_get_num_app_evts(); i++) {
+		if (sim_get_app_evt(i)->id == id) n++;
+	}
+	
+	return n;
+}
+
+
+static const sim_evt_t* _findEvt(uint16_t id)
+{
+	int i;
+	
+	for (i=first_evt; i<sim_get_num_app_evts(); i++) {
+		if (sim_get_app_evt(i)->id == id) return sim_get_app_evt(i);
+	}
+	
+	return NULL;
+}
+
+
+// Dial one digit then wait out the gap before the next
+static void _dialPulses(int pulses)
+{
+	bool off_hook = (sim_get_level(PIN_SHK) == 1);
+	
+	while (pulses-- > 0) {
+		pots_sim_set_off_hook(false);
+		pots_sim_run_msec(DIAL_BREAK_MSEC);
+		pots_sim_set_off_hook(true);
+		pots_sim_run_msec(DIAL_MAKE_MSEC);
+	}
+	pots_sim_set_off_hook(off_hook);
+	pots_sim_run_msec(DIAL_GAP_MSEC);
+}
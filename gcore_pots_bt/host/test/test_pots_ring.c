@@ -0,0 +1,233 @@
+/*
+ * pots_task ring scenarios - every country's ring cadence timed from the ring mode (RM)
+ * output after any Caller ID sequence has run, the ring frequency generated only while RM
+ * is high, and ring trip ending the ring as soon as the phone is picked up.
+ *
+ * Copyright 2023 Dan Julio
+ *
+ * This is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * It is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this software.  If not, see <https://www.gnu.org/licenses/>.
+ *
+ */
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include "check.h"
+#include "pots_sim.h"
+#include "app_task.h"
+#include "pots_task.h"
+#include "international.h"
+
+
+
+//
+// Constants
+//
+
+// pots_task.c ring generator
+#define RING_LEDC_CH          0
+#define RING_LEDC_TIMER       0
+#define RING_TRIP_POLL_MSEC   2
+
+// Time allowed for the first ring of a call, with any Caller ID sequence around it, beyond
+// its cadence (mSec)
+#define FIRST_RING_EXTRA_MSEC 8000
+
+// Time the ring is left to run before it's answered (mSec)
+#define ANSWER_MSEC           200
+
+// Most RM edges recorded
+#define MAX_EDGES             16
+
+
+
+//
+// Variables
+//
+
+// RM edges during _runRing
+static int64_t edge_usec[MAX_EDGES];
+static int num_edges;
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _runRing(int msec);
+static int _cadenceMsec(const ring_info_t* r);
+static void _checkCadence(const country_info_t* infoP, int64_t ring_usec);
+static void _checkRingTrip(const country_info_t* infoP);
+
+
+
+//
+// Main
+//
+int main(int argc, char** argv)
+{
+	const country_info_t* infoP;
+	int64_t ring_usec;
+	int c;
+	
+	pots_sim_start(0);
+	sim_set_cid_number("5551234567");
+	pots_sim_run_msec(1000);
+	
+	for (c=0; c<int_get_num_countries(); c++) {
+		infoP = int_get_country_info(c);
+		printf("%s\n", infoP->name);
+		pots_sim_set_country(c);
+		
+		// The first ring of a call may start or be followed by the Caller ID sequence
+		pots_sim_notify(POTS_NOTIFY_RING_MASK);
+		_runRing(_cadenceMsec(&infoP->ring_info) + FIRST_RING_EXTRA_MSEC);
+		CHECK(num_edges >= 2, "%s first ring has %d RM edges", infoP->name, num_edges);
+		CHECK(sim_get_level(PIN_RM) == 0, "%s still ringing", infoP->name);
+		
+		// The next is just the ring
+		ring_usec = sim_get_usec();
+		pots_sim_notify(POTS_NOTIFY_RING_MASK);
+		_runRing(_cadenceMsec(&infoP->ring_info) + 1000);
+		_checkCadence(infoP, ring_usec);
+		CHECK(sim_ledc_get_freq(RING_LEDC_TIMER) == (uint32_t) infoP->ring_info.freq,
+		      "%s ring at %u Hz", infoP->name, sim_ledc_get_freq(RING_LEDC_TIMER));
+		
+		pots_sim_notify(POTS_NOTIFY_DONE_RINGING_MASK);
+		pots_sim_run_msec(100);
+	}
+	
+	for (c=0; c<int_get_num_countries(); c++) {
+		infoP = int_get_country_info(c);
+		pots_sim_set_country(c);
+		_checkRingTrip(infoP);
+	}
+	
+	CHECK_EXIT();
+}
+
+
+
+//
+// Internal functions
+//
+
+// Runs pots_task recording RM edges and checking the ring frequency is only generated
+// while RM is high
+static void _runRing(int msec)
+{
+	int rm = sim_get_level(PIN_RM);
+	bool ledc_checked = true;
+	
+	num_edges = 0;
+	while (msec-- > 0) {
+		pots_sim_run_msec(1);
+		if (sim_get_level(PIN_RM) != rm) {
+			rm = sim_get_level(PIN_RM);
+			if (num_edges < MAX_EDGES) {
+				edge_usec[num_edges++] = sim_get_usec();
+			}
+		}
+		if (ledc_checked && sim_ledc_running(RING_LEDC_CH) && (rm == 0)) {
+			CHECK(false, "ring frequency with RM low at %d mSec", (int) (sim_get_usec() / 1000));
+			ledc_checked = false;   // Once per ring
+		}
+	}
+}
+
+
+static int _cadenceMsec(const ring_info_t* r)
+{
+	int i;
+	int msec = 0;
+	
+	for (i=0; i<(r->num_cadence_pairs * 2); i++) {
+		msec += r->cadence_pairs[i];
+	}
+	
+	return msec;
+}
+
+
+// RM high for each ring-on and low for each ring-off of the cadence, starting at the first
+// evaluation after the ring notification
+static void _checkCadence(const country_info_t* infoP, int64_t ring_usec)
+{
+	const ring_info_t* r = &infoP->ring_info;
+	int i;
+	int msec;
+	
+	CHECK(num_edges == (r->num_cadence_pairs * 2), "%s ring has %d RM edges", infoP->name, num_edges);
+	if (num_edges == 0) return;
+	
+	msec = (int) ((edge_usec[0] - ring_usec) / 1000);
+	CHECK(msec <= POTS_SIM_EVAL_MSEC, "%s ring started after %d mSec", infoP->name, msec);
+	
+	// The final ring-off isn't seen on RM
+	for (i=1; (i<num_edges) && (i<(r->num_cadence_pairs * 2)); i++) {
+		msec = (int) ((edge_usec[i] - edge_usec[i-1]) / 1000);
+		CHECK(abs(msec - r->cadence_pairs[i-1]) <= POTS_SIM_EVAL_MSEC, "%s cadence step %d is %d mSec (%d)",
+		      infoP->name, i - 1, msec, r->cadence_pairs[i-1]);
+	}
+}
+
+
+// Picked up during the first ring-on of a ring that doesn't start a Caller ID sequence
+static void _checkRingTrip(const country_info_t* infoP)
+{
+	const sim_evt_t* e;
+	int64_t t0;
+	int hold_msec = 500 / infoP->ring_info.freq;
+	int msec;
+	int first_evt;
+	int i;
+	
+	// Skip the first ring of the call (and any Caller ID around it)
+	pots_sim_notify(POTS_NOTIFY_RING_MASK);
+	_runRing(_cadenceMsec(&infoP->ring_info) + FIRST_RING_EXTRA_MSEC);
+	
+	pots_sim_notify(POTS_NOTIFY_RING_MASK);
+	pots_sim_run_msec(ANSWER_MSEC);
+	CHECK(sim_get_level(PIN_RM) == 1, "%s not ringing to answer", infoP->name);
+	
+	first_evt = sim_get_num_app_evts();
+	t0 = sim_get_usec();
+	pots_sim_set_off_hook(true);
+	msec = 0;
+	while ((sim_get_level(PIN_RM) == 1) && (msec < 1000)) {
+		pots_sim_run_msec(1);
+		msec++;
+	}
+	CHECK(msec <= (hold_msec + RING_TRIP_POLL_MSEC + 1), "%s ring tripped after %d mSec", infoP->name, msec);
+	CHECK(!sim_ledc_running(RING_LEDC_CH), "%s ring frequency after ring trip", infoP->name);
+	
+	_runRing(_cadenceMsec(&infoP->ring_info));
+	CHECK(num_edges == 0, "%s rang after it was answered", infoP->name);
+	
+	e = NULL;
+	for (i=first_evt; i<sim_get_num_app_evts(); i++) {
+		if (sim_get_app_evt(i)->id == APP_EVT_POTS_OFF_HOOK) {
+			e = sim_get_app_evt(i);
+			break;
+		}
+	}
+	CHECK(e != NULL, "%s no off-hook event answering", infoP->name);
+	if (e != NULL) {
+		msec = (int) ((e->usec - t0) / 1000);
+		CHECK(msec <= (hold_msec + RING_TRIP_POLL_MSEC + 1), "%s off-hook reported after %d mSec", infoP->name, msec);
+	}
+	
+	pots_sim_set_off_hook(false);
+	pots_sim_notify(POTS_NOTIFY_DONE_RINGING_MASK);
+	pots_sim_run_msec(1000);
+}
@@ -27,18 +27,32 @@
 #include "esp_hf_client_api.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/semphr.h"
 #include "app_task.h"
+#include "audio_task.h"
 #include "bt_task.h"
 #include "gcore_task.h"
 #include "gui_task.h"
 #include "pots_task.h"
+#include "ans_mach.h"
+#include "blackbox.h"
+#include "call_log.h"
+#include "call_progress.h"
+#include "dial_plan.h"
+#include "dlog.h"
+#include "evt_bus.h"
 #include "gain.h"
+#include "hsm.h"
+#include "prompt.h"
+#include "pace.h"
 #include "ps.h"
 #include "sample.h"
+#include "soft_timer.h"
 #include "sys_common.h"
+#include "sys_status.h"
+#include "wifi_up.h"
 #include "gui_utilities.h"
 #include <string.h>
+#include <time.h>
 
 
 
@@ -49,11 +63,22 @@
 // Uncomment to debug state transitions
 #define APP_ST_DEBUG
 
-// Count to determine a ringing but unanswered call is finished
-#define APP_LAST_RING_DETECT_COUNT    (APP_LAST_RING_DETECT_MSEC/APP_EVAL_MSEC)
+// Maximum back-to-back state transitions evaluated for one event (the state machine takes
+// one step per evaluation and some events enable several in a row)
+#define APP_MAX_EVAL_STEPS            4
 
-// Count to initiate dialing after POTS dialed digit
-#define APP_LAST_DIGIT_2_DIAL_COUNT   (APP_LAST_DIGIT_2_DIAL_MSEC/APP_EVAL_MSEC)
+// Parent of every state but DISCONNECTED in the state machine (never the current state so
+// not part of app_state_t)
+#define APP_ST_IN_SERVICE             (CALL_ANS_MACH + 1)
+
+// Volume changes from the phone are applied (codec, GUI and persistent storage) at most this
+// often.  The first of a burst (the volume rocker held down) is applied immediately and the
+// latest value when each period ends.
+#define APP_BT_GAIN_HOLDOFF_MSEC      100
+
+// A 3 dialed within this period after a hook flash swapped calls joins the held and active
+// calls into a conference (the phone mixes them) instead of being sent as DTMF
+#define APP_FLASH_DIGIT_MSEC          3000
 
 
 
@@ -63,55 +88,248 @@
 
 static const char* TAG = "app_task";
 
-static const char* app_state_name[] = {"DISCONNECTED", "CONNECTED_IDLE", "CALL_RECEIVED", "CALL_WAIT_ACTIVE", "DIALING",
-                                       "CALL_INITIATED", "CALL_ACTIVE", "CALL_ACTIVE_VOICE", "CALL_WAIT_END", "CALL_WAIT_ONHOOK"};
-
-// State
+// State (app_state follows app_hsm for the other tasks)
+static hsm_t app_hsm;
 static app_state_t app_state = DISCONNECTED;
 static bool bt_in_service = false;                  // BT has SLC (service level connection)
 static bool bt_in_call = false;                     // BT sees call has been established (successfully initiated or answered)
 static bool bt_audio_connected = false;             // BT sending us audio
+static bool bt_call_waiting = false;                // BT says a second call is waiting
+static bool bt_call_held = false;                   // BT says the phone has a call on hold
+static bool flash_digit_pending = false;            // Calls were swapped by a hook flash at flash_tick
+static TickType_t flash_tick;
 static bool pots_off_hook = false;
 static bool cid_valid = false;                      // Set true when we get Caller ID info from bluetooth
-static int call_received_timer = 0;                 // Timer to detect ringing has ended for incoming/unanswered calls
 static int ring_count = 0;                          // Number of rings
-static float new_mic_gain;                          // New gain set by bt_task from remote device
-static float new_spk_gain;
 
-// Notification flags - set by a notification and consumed/cleared by state evaluation
-static bool notify_dial_btn_pressed = false;
-static bool notify_bt_ring_indication = false;
+// Software timers - the one-shots post an event, the activity timer notifies gcore_task
+static int ring_timer;                              // app_hsm state timeouts (no ring for APP_LAST_RING_DETECT_MSEC)
+static int dial_timer;
+static int activity_timer;
+static int bt_gain_timer;
+
+// Volume changes from the phone waiting for the end of the holdoff period, indexed by GAIN_TYPE_*
+static bool bt_gain_pending[2] = {false, false};
+static float bt_gain_pending_db[2];
 
 // Phone dialing
 static bool last_dial_digit_from_pots;
-static char new_gui_digit;
-static char new_pots_digit;
-static char dialing_num[APP_MAX_DIALED_DIGITS+1];   // Statically allocated phone number dialing buffer
+static COLD_ATTR char dialing_num[APP_MAX_DIALED_DIGITS+1];   // Statically allocated phone number dialing buffer
 static int dialing_num_valid = 0;                   // Number of valid entries - also points to next location to load
-static int dialing_pots_digit_timer = 0;            // Counts up evaluation cycles after each POTs digit dialed to initiate a call
-static SemaphoreHandle_t dialing_num_mutex;
+static int dial_plan_state = DIAL_PLAN_NO_MATCH;    // DIAL_PLAN_COMPLETE dials without waiting for the timeout
 
 // Caller ID
-static char cid_num[ESP_BT_HF_NUMBER_LEN+1];
-static SemaphoreHandle_t cid_num_mutex;
+static COLD_ATTR char cid_num[ESP_BT_HF_NUMBER_LEN+1];
+static COLD_ATTR char cw_num[ESP_BT_HF_NUMBER_LEN+1];    // Waiting caller's number
+
+// Our part of the system status other tasks read (built here to keep it off the stack)
+static COLD_ATTR sys_status_app_t app_status;
 
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
 // Support for audio sample recording
 static bool audio_sampling_in_progress = false;
 #endif
 
+#if (CONFIG_ANS_MACH_ENABLE == true)
+// Set once the cellphone reports the call the answering machine picked up is connected
+static bool am_call_seen;
+#endif
+
+#if (CONFIG_CALL_LOG_ENABLE == true)
+// Call log record for the current call (the audio counters hold their values at the start
+// of the call until it ends)
+static bool call_log_in_progress = false;
+static bool call_log_connected = false;
+static time_t call_log_connect_time;
+static call_log_rec_t call_log_rec;
+static audio_stats_t call_log_audio_stats;
+static bt_link_stats_t call_log_link_stats;
+#endif
+
 
 
 //
 // App Task internal function forward declarations
 //
-static void _appHandleNotifications();
+static void _appInitTimers();
+static uint16_t _appHandleEvent(const evt_msg_t* evt);
 static void _appPushNewDialedDigit(char c);
-static void _appEvalState();
-static void _appSetState(app_state_t st);
+static void _appRestartDialPlan();
+static void _appSpeedDial(int entry);
+static void _appSpeedStore(int entry);
+static bool _appOutOfService();
+static bool _appInService();
+static bool _appOffHook();
+static bool _appOnHook();
+static bool _appInCall();
+static bool _appCallEnded();
+static bool _appCallEndedOffHook();
+static bool _appAudioConnected();
+static bool _appAudioLost();
+static bool _appAudioLostCallEnded();
+static bool _appHaveVoice();
+static bool _appVoiceCall();
+static bool _appHaveDialNum();
+static bool _appPotsDialNum();
+static bool _appPotsDialComplete();
+#if (CONFIG_ANS_MACH_ENABLE == true)
+static bool _appAnsMachAnswers();
+static bool _appAnsMachCallOver();
+#endif
+static void _appDisconnectedEntry(int from);
+static void _appIdleEntry(int from);
+static void _appCallReceivedEntry(int from);
+static void _appWaitActiveEntry(int from);
+static void _appDialingEntry(int from);
+static void _appCallInitiatedEntry(int from);
+static void _appWaitEndEntry(int from);
+static void _appAnsMachEntry(int from);
+static void _appAnsMachExit(int to);
+static void _appRingingDone();
+static void _appPreStateChange(int from, int to);
+static void _appPostStateChange(int from, int to);
 static bool _appCanInitiateAssistantCall();
 static void _appInvalidateDialingNum();
 static void _appInvalidateCID();
+static void _appPublishStatus();
+static void _appSetActivityTimer(bool en);
+static void _appHookFlash();
+static bool _appFlashDigit(char c);
+static void _appSetCallWaiting(bool waiting);
+static void _appBtGainChanged(int gain_type, float g);
+static void _appBtGainApply();
+#if (CONFIG_CALL_LOG_ENABLE == true)
+static void _appCallLogEval(app_state_t st);
+static void _appCallLogStart(uint8_t dir, const char* num);
+static void _appCallLogEnd();
+#endif
+
+
+
+//
+// State machine
+//
+static const hsm_state_t app_states[] = {
+	// name                parent             entry                    exit             timeout
+	{"DISCONNECTED",       HSM_NONE,          _appDisconnectedEntry,   NULL,            0},
+	{"CONNECTED_IDLE",     APP_ST_IN_SERVICE, _appIdleEntry,           NULL,            0},
+	{"CALL_RECEIVED",      APP_ST_IN_SERVICE, _appCallReceivedEntry,   NULL,            APP_LAST_RING_DETECT_MSEC},
+	{"CALL_WAIT_ACTIVE",   APP_ST_IN_SERVICE, _appWaitActiveEntry,     NULL,            0},
+	{"DIALING",            APP_ST_IN_SERVICE, _appDialingEntry,        NULL,            0},
+	{"CALL_INITIATED",     APP_ST_IN_SERVICE, _appCallInitiatedEntry,  NULL,            0},
+	{"CALL_ACTIVE",        APP_ST_IN_SERVICE, NULL,                    NULL,            0},
+	{"CALL_ACTIVE_VOICE",  APP_ST_IN_SERVICE, NULL,                    NULL,            0},
+	{"CALL_WAIT_END",      APP_ST_IN_SERVICE, _appWaitEndEntry,        NULL,            0},
+	{"CALL_WAIT_ONHOOK",   APP_ST_IN_SERVICE, NULL,                    NULL,            0},
+	{"CALL_ANS_MACH",      APP_ST_IN_SERVICE, _appAnsMachEntry,        _appAnsMachExit, APP_LAST_RING_DETECT_MSEC},
+	{"IN_SERVICE",         HSM_NONE,          NULL,                    NULL,            0}
+};
+
+// Rows for each state are in priority order
+static const hsm_trans_t app_trans[] = {
+	// state               event                          guard                   after  next               action
+	{APP_ST_IN_SERVICE,    HSM_EVT_ANY,                   _appOutOfService,       0,     DISCONNECTED,      NULL},
+	
+	// No bluetooth connection
+	{DISCONNECTED,         HSM_EVT_ANY,                   _appInService,          0,     CONNECTED_IDLE,    NULL},
+	
+	// Have bluetooth SLC (picking up when the cellphone has routed audio to us takes priority
+	// over dialing)
+	{CONNECTED_IDLE,       APP_EVT_BT_RING,               NULL,                   0,     CALL_RECEIVED,     NULL},
+	{CONNECTED_IDLE,       HSM_EVT_ANY,                   _appHaveVoice,          0,     CALL_ACTIVE_VOICE, NULL},
+	{CONNECTED_IDLE,       HSM_EVT_ANY,                   _appOffHook,            0,     DIALING,           NULL},
+	
+	// Bluetooth received call: the user rejects it from the GUI, the cellphone connects it
+	// (probably shouldn't happen but we handle it), the user picks up, the answering machine
+	// takes it or each ring restarts the timeout that ends a call nobody answered
+	{CALL_RECEIVED,        APP_EVT_GUI_DIAL_BTN_PRESSED,  NULL,                   0,     CALL_WAIT_END,     NULL},
+	{CALL_RECEIVED,        HSM_EVT_ANY,                   _appVoiceCall,          0,     CALL_ACTIVE_VOICE, NULL},
+	{CALL_RECEIVED,        HSM_EVT_ANY,                   _appInCall,             0,     CALL_ACTIVE,       NULL},
+	{CALL_RECEIVED,        HSM_EVT_ANY,                   _appOffHook,            0,     CALL_WAIT_ACTIVE,  NULL},
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	{CALL_RECEIVED,        APP_EVT_BT_RING,               _appAnsMachAnswers,     0,     CALL_ANS_MACH,     NULL},
+#endif
+	{CALL_RECEIVED,        APP_EVT_BT_RING,               NULL,                   0,     CALL_RECEIVED,     NULL},
+	{CALL_RECEIVED,        HSM_EVT_TIMEOUT,               NULL,                   0,     CONNECTED_IDLE,    _appRingingDone},
+	
+	// Waiting for bluetooth to tell us the call is connected (or the user ends it)
+	{CALL_WAIT_ACTIVE,     APP_EVT_GUI_DIAL_BTN_PRESSED,  NULL,                   0,     CALL_WAIT_END,     NULL},
+	{CALL_WAIT_ACTIVE,     HSM_EVT_ANY,                   _appOnHook,             0,     CALL_WAIT_END,     NULL},
+	{CALL_WAIT_ACTIVE,     HSM_EVT_ANY,                   _appVoiceCall,          0,     CALL_ACTIVE_VOICE, NULL},
+	{CALL_WAIT_ACTIVE,     HSM_EVT_ANY,                   _appInCall,             0,     CALL_ACTIVE,       NULL},
+	
+	// User went off-hook to dial: someone calling takes precedence, then audio the cellphone
+	// routed to us, then a complete number (numbers dialed on the phone go as soon as the
+	// dial plan knows they are complete)
+	{DIALING,              HSM_EVT_ANY,                   _appOnHook,             0,     CONNECTED_IDLE,    NULL},
+	{DIALING,              APP_EVT_BT_RING,               NULL,                   0,     CALL_RECEIVED,     NULL},
+	{DIALING,              HSM_EVT_ANY,                   _appAudioConnected,     0,     CALL_ACTIVE_VOICE, NULL},
+	{DIALING,              APP_EVT_GUI_DIAL_BTN_PRESSED,  _appHaveDialNum,        0,     CALL_INITIATED,    NULL},
+	{DIALING,              APP_EVT_DIAL_TIMER,            _appPotsDialNum,        0,     CALL_INITIATED,    NULL},
+	{DIALING,              HSM_EVT_ANY,                   _appPotsDialComplete,   0,     CALL_INITIATED,    NULL},
+	
+	// Requested bluetooth initiate a phone call: the far end is busy or unreachable, the call
+	// is connected or the user ended it from the GUI or by hanging up
+#if (CONFIG_CALL_PROGRESS_HANGUP == true)
+	{CALL_INITIATED,       APP_EVT_FAR_TONE_START,        NULL,                   0,     CALL_WAIT_END,     NULL},
+#endif
+	{CALL_INITIATED,       HSM_EVT_ANY,                   _appVoiceCall,          0,     CALL_ACTIVE_VOICE, NULL},
+	{CALL_INITIATED,       HSM_EVT_ANY,                   _appInCall,             0,     CALL_ACTIVE,       NULL},
+	{CALL_INITIATED,       APP_EVT_GUI_DIAL_BTN_PRESSED,  NULL,                   0,     CALL_WAIT_END,     NULL},
+	{CALL_INITIATED,       HSM_EVT_ANY,                   _appOnHook,             0,     CALL_WAIT_END,     NULL},
+	
+	// Call in progress, bluetooth audio is not routed to us: the user ends the call from the
+	// GUI, the cellphone ends it (wait for the phone to hang up) or routes the audio to us
+	{CALL_ACTIVE,          APP_EVT_GUI_DIAL_BTN_PRESSED,  NULL,                   0,     CALL_WAIT_END,     NULL},
+	{CALL_ACTIVE,          HSM_EVT_ANY,                   _appCallEndedOffHook,   0,     CALL_WAIT_ONHOOK,  NULL},
+	{CALL_ACTIVE,          HSM_EVT_ANY,                   _appCallEnded,          0,     CONNECTED_IDLE,    NULL},
+	{CALL_ACTIVE,          HSM_EVT_ANY,                   _appHaveVoice,          0,     CALL_ACTIVE_VOICE, NULL},
+	
+	// Call in progress, bluetooth audio is routed to us: the user ends the call from the GUI
+	// or by hanging up, the far end sends a busy, reorder or SIT tone, the cellphone ends the
+	// call or changes the audio destination
+	{CALL_ACTIVE_VOICE,    APP_EVT_GUI_DIAL_BTN_PRESSED,  NULL,                   0,     CALL_WAIT_END,     NULL},
+	{CALL_ACTIVE_VOICE,    HSM_EVT_ANY,                   _appOnHook,             0,     CALL_WAIT_END,     NULL},
+#if (CONFIG_CALL_PROGRESS_HANGUP == true)
+	{CALL_ACTIVE_VOICE,    APP_EVT_FAR_TONE_START,        NULL,                   0,     CALL_WAIT_END,     NULL},
+#endif
+	{CALL_ACTIVE_VOICE,    HSM_EVT_ANY,                   _appAudioLostCallEnded, 0,     CALL_WAIT_ONHOOK,  NULL},
+	{CALL_ACTIVE_VOICE,    HSM_EVT_ANY,                   _appAudioLost,          0,     CALL_ACTIVE,       NULL},
+	
+	// Waiting for bluetooth to indicate call has ended (or back to having some sort of a call)
+	{CALL_WAIT_END,        HSM_EVT_ANY,                   _appHaveVoice,          0,     CALL_ACTIVE_VOICE, NULL},
+	{CALL_WAIT_END,        HSM_EVT_ANY,                   _appCallEndedOffHook,   0,     CALL_WAIT_ONHOOK,  NULL},
+	{CALL_WAIT_END,        HSM_EVT_ANY,                   _appCallEnded,          0,     CONNECTED_IDLE,    NULL},
+	
+	// Call ended, waiting for user to hang up phone
+	{CALL_WAIT_ONHOOK,     HSM_EVT_ANY,                   _appOnHook,             0,     CONNECTED_IDLE,    NULL},
+	
+	// Answering machine has the call: the user picks up while screening the message and takes
+	// over the call, the caller hangs up (or the phone never connected the call) or the message
+	// is over (or the user ended it from the GUI) so end the call
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	{CALL_ANS_MACH,        HSM_EVT_ANY,                   _appHaveVoice,          0,     CALL_ACTIVE_VOICE, NULL},
+	{CALL_ANS_MACH,        HSM_EVT_ANY,                   _appOffHook,            0,     CALL_ACTIVE,       NULL},
+	{CALL_ANS_MACH,        HSM_EVT_ANY,                   _appAnsMachCallOver,    0,     CONNECTED_IDLE,    NULL},
+	{CALL_ANS_MACH,        HSM_EVT_TIMEOUT,               _appCallEnded,          0,     CONNECTED_IDLE,    NULL},
+	{CALL_ANS_MACH,        APP_EVT_GUI_DIAL_BTN_PRESSED,  NULL,                   0,     CALL_WAIT_END,     NULL},
+	{CALL_ANS_MACH,        APP_EVT_ANS_MACH_DONE,         NULL,                   0,     CALL_WAIT_END,     NULL},
+#endif
+};
+
+static const hsm_def_t app_hsm_def = {
+	.tag = "app_task",
+	.states = app_states,
+	.num_states = sizeof(app_states) / sizeof(hsm_state_t),
+	.trans = app_trans,
+	.num_trans = sizeof(app_trans) / sizeof(hsm_trans_t),
+	.pre_change = _appPreStateChange,
+	.post_change = _appPostStateChange,
+#ifdef APP_ST_DEBUG
+	.log = true
+#endif
+};
+
 
 
 //
@@ -119,35 +337,33 @@ static void _appInvalidateCID();
 //
 void app_task()
 {
-	int activity_counter = 0;
+	evt_msg_t evt;
+	TickType_t wait;
 	
 	ESP_LOGI(TAG, "Start task");
 	
-	// Phone number access semaphores
-	dialing_num_mutex = xSemaphoreCreateMutex();
-	cid_num_mutex = xSemaphoreCreateMutex();
-	
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
 	sample_mem_init();
 #endif
 	
+	_appInitTimers();
+	hsm_init(&app_hsm, &app_hsm_def, DISCONNECTED, ring_timer, APP_EVT_RING_TIMER);
+	pace_declare(PACE_ID_APP, "app", PACE_RESPONSE, PACE_APP_USEC);
+	
 	while (1) {
-		// Get any new notifications
-		_appHandleNotifications();
-		
-		// Evaluate state updates
-		_appEvalState();
-		
-		// Notify gcore_task of activity twice/sec while we're busy with a call
-		if ((app_state == DISCONNECTED) || (app_state == CONNECTED_IDLE)) {
-			// Hold counter in reset
-			activity_counter = 0;
-		} else {
-			// Look for timeout for activity notification
-			if (++activity_counter > (500 / APP_EVAL_MSEC)) {
-				activity_counter = 0;
-				xTaskNotify(task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK, eSetBits);
-			}
+		// Block until there is an event (the dial and ring timeouts are events from our own
+		// timers), only waking periodically while an audio sample recording is being written
+		wait = portMAX_DELAY;
+#if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
+		if (audio_sampling_in_progress) wait = pdMS_TO_TICKS(APP_EVAL_MSEC);
+#endif
+		if (evt_bus_receive(EVT_QUEUE_APP, &evt, wait)) {
+			pace_start(PACE_ID_APP);
+			
+			// Evaluate state updates (an event, for example going off-hook just as service
+			// is established, may allow more than one transition)
+			hsm_run(&app_hsm, _appHandleEvent(&evt), APP_MAX_EVAL_STEPS);
+			pace_checkin(PACE_ID_APP);
 		}
 		
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
@@ -155,120 +371,103 @@ void app_task()
 		if (!sample_in_progress()) {
 			audio_sampling_in_progress = false;
 			
-			// Save audio samples and then notify user
-			sample_save();
+			// Audio samples have been saved by the sample writer so notify user
 			sample_end();
 			
-			gui_preset_message_box_string("Audio samples saved.  Safe to remove card.", false, GUI_MSGBOX_SMPL_DONE);
+			if (sample_get_drops() == 0) {
+				gui_preset_message_box_string("Audio samples saved.  Safe to remove card.", false, GUI_MSGBOX_SMPL_DONE);
+			} else {
+				gui_preset_message_box_string("Audio samples saved with gaps.  Safe to remove card.", false, GUI_MSGBOX_SMPL_DONE);
+			}
 			xTaskNotify(task_handle_gui, GUI_NOTIFY_MESSAGEBOX_MASK, eSetBits);
 		}
 	}
 #endif
-		
-		vTaskDelay(pdMS_TO_TICKS(APP_EVAL_MSEC));
 	}
 }
 
 
-void app_set_gui_digit(char c)
-{
-	new_gui_digit = c;
-}
-
-
-void app_set_pots_digit(char c)
-{
-	new_pots_digit = c;
-}
-
-
-void app_set_cid_number(const char* pn)
+// The getters read the published system status (sys_status) so they never wait on app_task
+//
+// pn must have ESP_BT_HF_NUMBER_LEN + 1 characters
+int app_get_cid_number(char* pn)
 {
-	xSemaphoreTake(cid_num_mutex, portMAX_DELAY);
-	strncpy(cid_num, pn, ESP_BT_HF_NUMBER_LEN);
-	cid_num[ESP_BT_HF_NUMBER_LEN] = 0;
-	xSemaphoreGive(cid_num_mutex);
-	
-	cid_valid = true;
+	return sys_status_get_cid_num(pn, false);
 }
 
 
 // pn must have ESP_BT_HF_NUMBER_LEN + 1 characters
-int app_get_cid_number(char* pn)
+int app_get_cw_number(char* pn)
 {
-	xSemaphoreTake(cid_num_mutex, portMAX_DELAY);
-	strncpy(pn, cid_num, ESP_BT_HF_NUMBER_LEN+1);
-	pn[ESP_BT_HF_NUMBER_LEN] = 0;
-	xSemaphoreGive(cid_num_mutex);
-	return strlen(pn);
+	return sys_status_get_cid_num(pn, true);
 }
 
 
 int app_get_dial_number(char* pn)
 {
-	int n;
-	
-	xSemaphoreTake(dialing_num_mutex, portMAX_DELAY);
-	n = dialing_num_valid;
-	for (int i=0; i<=n; i++) {
-		// Copy characters including the final null terminator
-		*(pn+i) = dialing_num[i];
-	}
-	xSemaphoreGive(dialing_num_mutex);
-	
-	return n;
+	return sys_status_get_dial_num(pn);
 }
 
 
 app_state_t app_get_state()
 {
-	// Access should be atomic so no mutex necessary
+	// Access is atomic so the snapshot isn't necessary for this alone
 	return app_state;
 }
 
 
-void app_set_new_mic_gain(float g)
-{
-	new_mic_gain = g;
-}
-
-
-void app_set_new_spk_gain(float g)
-{
-	new_spk_gain = g;
-}
-
-
 //
 // App Task Internal functions
 //
-static void _appHandleNotifications()
+static void _appInitTimers()
+{
+	ring_timer = soft_timer_create_evt("app_ring", EVT_QUEUE_APP, APP_EVT_RING_TIMER);
+	dial_timer = soft_timer_create_evt("app_dial", EVT_QUEUE_APP, APP_EVT_DIAL_TIMER);
+	activity_timer = soft_timer_create_notify("app_activity", &task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK);
+	bt_gain_timer = soft_timer_create_evt("app_bt_gain", EVT_QUEUE_APP, APP_EVT_BT_GAIN_TIMER);
+	
+	if ((ring_timer == SOFT_TIMER_INVALID) || (dial_timer == SOFT_TIMER_INVALID) ||
+	    (activity_timer == SOFT_TIMER_INVALID) || (bt_gain_timer == SOFT_TIMER_INVALID)) {
+		
+		ESP_LOGE(TAG, "Create timers failed");
+	}}
+
+
+// Returns the event for the state machine
+static uint16_t _appHandleEvent(const evt_msg_t* evt)
 {
-	uint32_t notification_value = 0;
+	float g;
 	
-	// Handle notifications (clear them upon reading)
-	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, 0)) {
+	switch (evt->id) {
 		//
 		// Hook state
 		//
-		if (Notification(notification_value, APP_NOTIFY_POTS_ON_HOOK_MASK)) {
+		case APP_EVT_POTS_ON_HOOK:
 			pots_off_hook = false;
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_POTS_OFF_HOOK_MASK)) {
+		case APP_EVT_POTS_OFF_HOOK:
 			pots_off_hook = true;
-		}
+			if (app_state == CONNECTED_IDLE) {
+				// Have the link ready for the number about to be dialed
+				evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_LINK_WAKE);
+			}
+			break;
+		
+		case APP_EVT_POTS_HOOK_FLASH:
+			_appHookFlash();
+			break;
 		
 		//
 		// Dialing info
 		//
-		if (Notification(notification_value, APP_NOTIFY_POTS_DIGIT_DIALED_MASK)) {
-			_appPushNewDialedDigit(new_pots_digit);
+		case APP_EVT_POTS_DIGIT_DIALED:
+			_appPushNewDialedDigit(evt->u.digit);
 			last_dial_digit_from_pots = true;
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_GUI_DIGIT_DIALED_MASK)) {
-			_appPushNewDialedDigit(new_gui_digit);
+		case APP_EVT_GUI_DIGIT_DIALED:
+			_appPushNewDialedDigit(evt->u.digit);
 			last_dial_digit_from_pots = false;
 			
 			// Let pots_task know the user dialed from the GUI so it can disable dial tone if necessary
@@ -276,441 +475,787 @@ static void _appHandleNotifications()
 			// tell the cellphone about the digit in _appPushNewDialedDigit and it should generate a
 			// DTMF tone in the audio stream for the user)
 			if (app_state == DIALING) {
-				pots_set_app_dialed_digit(new_gui_digit);
-				xTaskNotify(task_handle_pots, POTS_NOTIFY_EXT_DIAL_DIGIT_MASK, eSetBits);
+				evt_bus_send_digit(EVT_QUEUE_POTS, POTS_EVT_EXT_DIAL_DIGIT, evt->u.digit);
 			}
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_GUI_DIGIT_DELETED_MASK)) {
+		case APP_EVT_GUI_DIGIT_DELETED:
 			if (app_state == DIALING) {
 				if (dialing_num_valid > 0) {
-					xSemaphoreTake(dialing_num_mutex, portMAX_DELAY);
 					dialing_num_valid -= 1;
 					dialing_num[dialing_num_valid] = 0;  // Replace deleted character with null terminator
-					xSemaphoreGive(dialing_num_mutex);
+					_appPublishStatus();
 					
 					last_dial_digit_from_pots = false;   // Always assume if user deleted from GUI, they're entering too
+					_appRestartDialPlan();
 					xTaskNotify(task_handle_gui, GUI_NOTIFY_PH_NUM_UPDATE_MASK, eSetBits);
 				}
 			}
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_GUI_DIAL_BTN_PRESSED_MASK)) {
-			notify_dial_btn_pressed = true;
-		}
+		case APP_EVT_GUI_DIAL_BTN_PRESSED:
+			// State machine event
+			break;
 		
 		//
 		// Bluetooth info
 		//
-		if (Notification(notification_value, APP_NOTIFY_BT_IN_SERVICE_MASK)) {
+		case APP_EVT_BT_IN_SERVICE:
 			bt_in_service = true;
-		}
+			_appPublishStatus();
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_BT_OUT_OF_SERVICE_MASK)) {
+		case APP_EVT_BT_OUT_OF_SERVICE:
 			bt_in_service = false;
-		}
+			_appPublishStatus();
+			xTaskNotify(task_handle_pots, POTS_NOTIFY_RINGBACK_END_MASK, eSetBits);
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_BT_RING_MASK)) {
-			notify_bt_ring_indication = true;
+		case APP_EVT_BT_RING:
 			ring_count += 1;
-		}
+			
+			// Handle the special case where by the 2nd ring we didn't get any Caller ID
+			// info probably indicating the number was blocked.  Let the GUI know here since
+			// it won't have been updated by received CID info so it will see an empty
+			// caller ID string and display something appropriate.
+			if ((app_state == CALL_RECEIVED) && !cid_valid && (ring_count == 2)) {
+				xTaskNotify(task_handle_gui, GUI_NOTIFY_CID_NUM_UPDATE_MASK, eSetBits);
+			}
+			break;
+		
+		case APP_EVT_RING_TIMER:
+			// The state timeout (app_hsm checks it is current)
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_BT_CALL_STARTED_MASK)) {
+		case APP_EVT_DIAL_TIMER:
+			if (!soft_timer_expired(dial_timer)) {
+				return HSM_EVT_NONE;
+			}
+			break;
+		
+		case APP_EVT_BT_GAIN_TIMER:
+			if (soft_timer_expired(bt_gain_timer)) {
+				_appBtGainApply();
+			}
+			break;
+		
+		case APP_EVT_BT_CALL_STARTED:
 			bt_in_call = true;
-		}
+#if (CONFIG_ANS_MACH_ENABLE == true)
+			am_call_seen = true;
+#endif
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_BT_CALL_ENDED_MASK)) {
+		case APP_EVT_BT_CALL_ENDED:
 			bt_in_call = false;
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_BT_CID_AVAILABLE_MASK)) {
+		case APP_EVT_BT_CID_AVAILABLE:
+			strncpy(cid_num, evt->u.str, ESP_BT_HF_NUMBER_LEN);
+			cid_num[ESP_BT_HF_NUMBER_LEN] = 0;
+			_appPublishStatus();
+			cid_valid = true;
+			
+			// Let pots_task render the Caller ID audio now, before it's needed
+			xTaskNotify(task_handle_pots, POTS_NOTIFY_NEW_CID_MASK, eSetBits);
 			xTaskNotify(task_handle_gui, GUI_NOTIFY_CID_NUM_UPDATE_MASK, eSetBits);
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_BT_AUDIO_START_MASK)) {
+		case APP_EVT_BT_CALL_WAITING:
+			ESP_LOGI(TAG, "Call waiting from %s", evt->u.str);
+			strncpy(cw_num, evt->u.str, ESP_BT_HF_NUMBER_LEN);
+			cw_num[ESP_BT_HF_NUMBER_LEN] = 0;
+			_appPublishStatus();
+			_appSetCallWaiting(true);
+			break;
+		
+		case APP_EVT_BT_CALL_WAIT_END:
+			_appSetCallWaiting(false);
+			break;
+		
+		case APP_EVT_BT_CALL_ALERTING:
+			// Let pots_task play ringback until the phone connects the call audio
+			xTaskNotify(task_handle_pots, POTS_NOTIFY_RINGBACK_MASK, eSetBits);
+			break;
+		
+		case APP_EVT_BT_CALL_ALERT_END:
+			xTaskNotify(task_handle_pots, POTS_NOTIFY_RINGBACK_END_MASK, eSetBits);
+			break;
+		
+		case APP_EVT_BT_CALL_HELD:
+			bt_call_held = (evt->u.digit != ESP_HF_CALL_HELD_STATUS_NONE);
+			break;
+		
+		case APP_EVT_BT_AUDIO_START:
 			bt_audio_connected = true;
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_BT_AUDIO_ENDED_MASK)) {
+		case APP_EVT_BT_AUDIO_ENDED:
 			bt_audio_connected = false;
-		}
+			break;
+		
+		case APP_EVT_FAR_TONE_START:
+			ESP_LOGI(TAG, "Far end %s tone", call_progress_get_name(evt->u.digit));
+#if (CONFIG_CALL_PROGRESS_HANGUP == true)
+			// The network has given up on the call so the state machine ends it
+#else
+			// Let pots_task play our own version of it
+			xTaskNotify(task_handle_pots, POTS_NOTIFY_FAR_TONE_MASK, eSetBits);
+#endif
+			break;
+		
+		case APP_EVT_FAR_TONE_END:
+#if (CONFIG_CALL_PROGRESS_HANGUP != true)
+			xTaskNotify(task_handle_pots, POTS_NOTIFY_FAR_TONE_END_MASK, eSetBits);
+#endif
+			break;
 		
 		//
 		// Audio gain updates
 		//
-		if (Notification(notification_value, APP_NOTIFY_NEW_GUI_MIC_GAIN_MASK)) {
+		case APP_EVT_NEW_GUI_MIC_GAIN:
 			// Get updated gain from PS
-			new_mic_gain = ps_get_gain(PS_GAIN_MIC);
+			g = ps_get_gain(PS_GAIN_MIC);
 			
-			// Update the codec value
-			if (!gainSetCodec(GAIN_TYPE_MIC, new_mic_gain)) {
-				ESP_LOGE(TAG, "Update codec mic gain failed");
+			// Update the audio gain
+			if (!audioSetGain(GAIN_TYPE_MIC, g)) {
+				ESP_LOGE(TAG, "Update mic gain failed");
 			}
 			
 			// Inform BT so it can update the remote device (it will get the value from PS)
-			xTaskNotify(task_handle_bt, BT_NOTIFY_NEW_MIC_GAIN_MASK, eSetBits);
-		}
+			evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_NEW_MIC_GAIN);
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_NEW_GUI_SPK_GAIN_MASK)) {
+		case APP_EVT_NEW_GUI_SPK_GAIN:
 			// Get updated gain from PS
-			new_spk_gain = ps_get_gain(PS_GAIN_SPK);
+			g = ps_get_gain(PS_GAIN_SPK);
 			
-			// Update the codec value
-			if (!gainSetCodec(GAIN_TYPE_SPK, new_spk_gain)) {
-				ESP_LOGE(TAG, "Update codec speaker gain failed");
+			// Update the audio gain
+			if (!audioSetGain(GAIN_TYPE_SPK, g)) {
+				ESP_LOGE(TAG, "Update speaker gain failed");
 			}
 			
 			// Inform BT so it can update the remote device (it will get the value from PS)
-			xTaskNotify(task_handle_bt, BT_NOTIFY_NEW_SPK_GAIN_MASK, eSetBits);
-		}
+			evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_NEW_SPK_GAIN);
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_NEW_BT_MIC_GAIN_MASK)) {
-			// Update the codec value
-			if (!gainSetCodec(GAIN_TYPE_MIC, new_mic_gain)) {
-				ESP_LOGE(TAG, "Update codec mic gain failed");
-			}
-			
-			// Inform the GUI so it can update the control and PS
-			gui_set_new_mic_gain(new_mic_gain);
-			xTaskNotify(task_handle_gui, GUI_NOTIFY_UPDATE_MIC_GAIN_MASK, eSetBits);
-		}
+		case APP_EVT_NEW_BT_MIC_GAIN:
+			_appBtGainChanged(GAIN_TYPE_MIC, evt->u.gain);
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_NEW_BT_SPK_GAIN_MASK)) {
-			// Update the codec value
-			if (!gainSetCodec(GAIN_TYPE_SPK, new_spk_gain)) {
-				ESP_LOGE(TAG, "Update codec speaker gain failed");
-			}
-			
-			// Inform the GUI so it can update the control and PS
-			gui_set_new_spk_gain(new_spk_gain);
-			xTaskNotify(task_handle_gui, GUI_NOTIFY_UPDATE_SPK_GAIN_MASK, eSetBits);
-		}
+		case APP_EVT_NEW_BT_SPK_GAIN:
+			_appBtGainChanged(GAIN_TYPE_SPK, evt->u.gain);
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_POTS_MAX_SPK_GAIN_MASK)) {
+		case APP_EVT_POTS_MAX_SPK_GAIN:
 			// Set the maximum value
-			if (!gainSetCodec(GAIN_TYPE_SPK, GAIN_APP_SPK_MAX_DB)) {
-				ESP_LOGE(TAG, "Set max codec speaker gain failed");
+			if (!audioSetGain(GAIN_TYPE_SPK, GAIN_APP_SPK_MAX_DB)) {
+				ESP_LOGE(TAG, "Set max speaker gain failed");
 			}
-		}
+			break;
 		
-		if (Notification(notification_value, APP_NOTIFY_POTS_NORM_SPK_GAIN_MASK)) {
+		case APP_EVT_POTS_NORM_SPK_GAIN:
 			// Get operating gain from PS
-			new_spk_gain = ps_get_gain(PS_GAIN_SPK);
+			g = ps_get_gain(PS_GAIN_SPK);
 			
-			// Update the codec value
-			if (!gainSetCodec(GAIN_TYPE_SPK, new_spk_gain)) {
-				ESP_LOGE(TAG, "Restore codec speaker gain failed");
+			// Update the audio gain
+			if (!audioSetGain(GAIN_TYPE_SPK, g)) {
+				ESP_LOGE(TAG, "Restore speaker gain failed");
 			}
-		}
+			break;
 		
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
-		if (Notification(notification_value, APP_NOTIFY_START_AUDIO_SMPL_MASK)) {
-			if (sample_start()) {
+		case APP_EVT_START_AUDIO_SMPL:
+			if (audio_sampling_in_progress) {
+				// Second press ends the recording
+				sample_stop();
+			} else if (sample_start()) {
 				audio_sampling_in_progress = true;
 			} else {
 				gui_preset_message_box_string("Could not mount Micro-SD Card", false, GUI_MSGBOX_SMPL_FAIL);
 				xTaskNotify(task_handle_gui, GUI_NOTIFY_MESSAGEBOX_MASK, eSetBits);
 			}
-		}
+			break;
 #endif
+		
+		case APP_EVT_ANS_MACH_DONE:
+			// State machine event
+			break;
+		
+		default:
+			ESP_LOGW(TAG, "Unknown event %d", evt->id);
 	}
+	
+	return evt->id;
 }
 
 
 static void _appPushNewDialedDigit(char c)
 {
+	if (_appFlashDigit(c)) {
+		return;
+	}
+	
 	if ((app_state == DIALING) || (app_state == CALL_ACTIVE) || (app_state == CALL_ACTIVE_VOICE)) {
 		if (dialing_num_valid < APP_MAX_DIALED_DIGITS) {
 			// Add digit to phone number
-			xSemaphoreTake(dialing_num_mutex, portMAX_DELAY);
 			dialing_num[dialing_num_valid] = c;
 			dialing_num_valid += 1;
 			dialing_num[dialing_num_valid] = 0; // Make sure string is terminated
-			xSemaphoreGive(dialing_num_mutex);
+			
+			if (app_state == DIALING) {
+				dial_plan_state = dial_plan_push_digit(c);
+				if (dial_plan_state == DIAL_PLAN_SPEED_DIAL) {
+					_appSpeedDial(dial_plan_get_speed_entry());
+				} else if (dial_plan_state == DIAL_PLAN_SPEED_STORE) {
+					_appSpeedStore(dial_plan_get_speed_entry());
+				}
+			}
+			_appPublishStatus();
 			
 			// Update GUI
 			xTaskNotify(task_handle_gui, GUI_NOTIFY_PH_NUM_UPDATE_MASK, eSetBits);
 			
-			// Reset dial timer
-			dialing_pots_digit_timer = 0;
+			// Restart dial timer
+			soft_timer_start(dial_timer, APP_LAST_DIGIT_2_DIAL_MSEC);
 		}
 	}
 	
 	if ((app_state == CALL_ACTIVE) || (app_state == CALL_ACTIVE_VOICE)) {
 		// Tell bluetooth to send digits entered during a call as DTMF tones
-		bt_set_dtmf_digit(c);
-		xTaskNotify(task_handle_bt, BT_NOTIFY_DIAL_DTMF_MASK, eSetBits);
+		evt_bus_send_digit(EVT_QUEUE_BT, BT_EVT_DIAL_DTMF, c);
 	}
 }
 
 
-static void _appEvalState()
+// Matches the number dialed so far against the current country's dial plan from the start
+static void _appRestartDialPlan()
 {
-		switch (app_state) {
-		case DISCONNECTED:  // No bluetooth connection
-			if (bt_in_service) {
-				_appSetState(CONNECTED_IDLE);
-			}
-			break;
+	uint16_t speed_mask = 0;
+	
+	for (int i=0; i<PS_SPEED_DIAL_ENTRIES; i++) {
+		if (ps_get_speed_dial(i, NULL)) speed_mask |= 1 << i;
+	}
+	dial_plan_set_speed_mask(speed_mask);
+	dial_plan_start(ps_get_country_code());
+	dial_plan_state = DIAL_PLAN_NO_MATCH;
+	for (int i=0; i<dialing_num_valid; i++) {
+		dial_plan_state = dial_plan_push_digit(dialing_num[i]);
+	}
+}
+
+
+// Replaces a speed dial code with its number which is then complete
+static void _appSpeedDial(int entry)
+{
+	char num[PS_SPEED_DIAL_LEN+1];
+	
+	if (!ps_get_speed_dial(entry, num)) {
+		dial_plan_state = DIAL_PLAN_NO_MATCH;
+		return;
+	}
+	ESP_LOGI(TAG, "Speed dial %d: %s", entry, num);
+	
+	strcpy(dialing_num, num);
+	dialing_num_valid = strlen(num);
+	
+	dial_plan_state = DIAL_PLAN_COMPLETE;
+}
+
+
+// Stores the redial number in a speed dial entry and clears the code so the user can dial
+static void _appSpeedStore(int entry)
+{
+	char num[PS_SPEED_DIAL_LEN+1];
+	
+	if (ps_get_speed_dial(PS_SPEED_DIAL_REDIAL, num)) {
+		ESP_LOGI(TAG, "Store speed dial %d: %s", entry, num);
+		(void) ps_set_speed_dial(entry, num);
+		ps_update_backing_store();
+#if (CONFIG_PROMPT_ENABLE == true)
 		
-		case CONNECTED_IDLE: // Have bluetooth SLC
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (notify_bt_ring_indication) {
-				_appSetState(CALL_RECEIVED);
-			} else if (pots_off_hook) {
-				if (bt_audio_connected) {
-					// Picking up when cellphone has routed audio to us takes priority over dialing
-					_appSetState(CALL_ACTIVE_VOICE);
-				} else {
-					_appSetState(DIALING);
-				}
-			}
-			break;
+		// Read the stored number back to the phone
+		(void) prompt_play_digits(num);
+#endif
+	}
+	
+	_appInvalidateDialingNum();
+	dialing_num[0] = 0;
+	
+	_appRestartDialPlan();
+}
+
+
+// app_hsm guards
+static bool _appOutOfService()
+{
+	return !bt_in_service;
+}
+
+
+static bool _appInService()
+{
+	return bt_in_service;
+}
+
+
+static bool _appOffHook()
+{
+	return pots_off_hook;
+}
+
+
+static bool _appOnHook()
+{
+	return !pots_off_hook;
+}
+
+
+static bool _appInCall()
+{
+	return bt_in_call;
+}
+
+
+static bool _appCallEnded()
+{
+	return !bt_in_call;
+}
+
+
+static bool _appCallEndedOffHook()
+{
+	return !bt_in_call && pots_off_hook;
+}
+
+
+static bool _appAudioConnected()
+{
+	return bt_audio_connected;
+}
+
+
+static bool _appAudioLost()
+{
+	return !bt_audio_connected;
+}
+
+
+static bool _appAudioLostCallEnded()
+{
+	return !bt_audio_connected && !bt_in_call;
+}
+
+
+// Picking up with the cellphone's audio routed to us
+static bool _appHaveVoice()
+{
+	return bt_audio_connected && pots_off_hook;
+}
+
+
+static bool _appVoiceCall()
+{
+	return bt_in_call && bt_audio_connected && pots_off_hook;
+}
+
+
+static bool _appHaveDialNum()
+{
+	return (dialing_num_valid > 0);
+}
+
+
+static bool _appPotsDialNum()
+{
+	return (dialing_num_valid > 0) && last_dial_digit_from_pots;
+}
+
+
+static bool _appPotsDialComplete()
+{
+	return _appPotsDialNum() && (dial_plan_state == DIAL_PLAN_COMPLETE);
+}
+
+
+#if (CONFIG_ANS_MACH_ENABLE == true)
+// Nobody picked up so let the answering machine take a message
+static bool _appAnsMachAnswers()
+{
+	return (ring_count >= CONFIG_ANS_MACH_RINGS) && ans_mach_ready();
+}
+
+
+static bool _appAnsMachCallOver()
+{
+	return !bt_in_call && am_call_seen;
+}
+#endif
+
+
+static void _appDisconnectedEntry(int from)
+{
+	xTaskNotify(task_handle_pots, POTS_NOTIFY_OUT_OF_SERVICE_MASK, eSetBits);
+	_appSetCallWaiting(false);
+	bt_call_held = false;
+}
+
+
+static void _appIdleEntry(int from)
+{
+	xTaskNotify(task_handle_pots, POTS_NOTIFY_IN_SERVICE_MASK, eSetBits);
+	
+	// Reset state
+	_appSetCallWaiting(false);
+	bt_call_held = false;
+	_appInvalidateCID();
+	cid_valid = false;
+	ring_count = 0;
+	
+	// Reset number indication on GUI
+	_appInvalidateDialingNum();
+	xTaskNotify(task_handle_gui, GUI_NOTIFY_PH_NUM_UPDATE_MASK, eSetBits);
+}
+
+
+// Also re-entered for each ring (restarting the unanswered call detection timeout)
+static void _appCallReceivedEntry(int from)
+{
+	xTaskNotify(task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK, eSetBits);
+}
+
+
+static void _appWaitActiveEntry(int from)
+{
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_ANSWER_CALL);
+}
+
+
+static void _appDialingEntry(int from)
+{
+	// Setup to start dialing (the dial timer starts with the first digit)
+	soft_timer_stop(dial_timer);
+	_appRestartDialPlan();
+}
+
+
+static void _appCallInitiatedEntry(int from)
+{
+	if (_appCanInitiateAssistantCall()) {
+		evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_DIAL_OPER);
+	} else {
+		// Remember the number for redial
+		if (ps_set_speed_dial(PS_SPEED_DIAL_REDIAL, dialing_num)) {
+			ps_update_backing_store();
+		}
 		
-		case CALL_RECEIVED:  // Bluetooth received call
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (notify_dial_btn_pressed) {
-				// User is rejecting the call from the GUI so tell cellphone to end call
-				_appSetState(CALL_WAIT_END);
-			} else if (bt_in_call) {
-				// bluetooth connected call (probably shouldn't happen but we handle it)
-				if (bt_audio_connected && pots_off_hook) {
-					_appSetState(CALL_ACTIVE_VOICE);
-				} else {
-					_appSetState(CALL_ACTIVE);
-				}
-			} else if (pots_off_hook) {
-				// User picked up so tell cellphone to accept call
-				_appSetState(CALL_WAIT_ACTIVE);
-			} else if (notify_bt_ring_indication) {
-				// Reset ring timeout counter every time we get a ring
-				_appSetState(CALL_RECEIVED);
-			} else if (++call_received_timer >= APP_LAST_RING_DETECT_COUNT) {
-				// call ended with no action; we detect this when we haven't received
-				// any rings in a while
-				_appSetState(CONNECTED_IDLE);
-				
-				// Special notification to pots_task that all rings associated with a call are done
-				xTaskNotify(task_handle_pots, POTS_NOTIFY_DONE_RINGING_MASK, eSetBits);
-			}
-			
-			// Handle the special case where by the 2nd ring we didn't get any Caller ID
-			// info probably indicating the number was blocked.  Let the GUI know here since
-			// it won't have been updated by received CID info so it will see an empty
-			// caller ID string and display something appropriate.
-			if (!cid_valid && (ring_count == 2)) {
-				xTaskNotify(task_handle_gui, GUI_NOTIFY_CID_NUM_UPDATE_MASK, eSetBits);
-			}
-			break;
-			
-		case CALL_WAIT_ACTIVE:  // Waiting for bluetooth to tell us the call is connected
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (!pots_off_hook || notify_dial_btn_pressed) {
-				// User ended call so tell cellphone to end call
-				_appSetState(CALL_WAIT_END);
-			} else if (bt_in_call) {
-				if (bt_audio_connected && pots_off_hook) {
-					_appSetState(CALL_ACTIVE_VOICE);
-				} else {
-					_appSetState(CALL_ACTIVE);
-				}
-			}
-			break;
+		// bt_task gets the number with app_get_dial_number
+		evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_DIAL_NUM);
+	}
+}
+
+
+static void _appWaitEndEntry(int from)
+{
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_HANGUP_CALL);
+}
+
+
+// The state timeout catches a call that ends without being connected
+static void _appAnsMachEntry(int from)
+{
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	// Answer the call and have pots_task hand the voice stream to the answering machine
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_ANSWER_CALL);
+	if (!ans_mach_start_answer(cid_valid ? cid_num : "")) {
+		// Lost the card since the last ring so hang up again
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_ANS_MACH_DONE);
+	}
+	xTaskNotify(task_handle_pots, POTS_NOTIFY_ANS_MACH_MASK, eSetBits);
+	am_call_seen = bt_in_call;
+#endif
+}
+
+
+static void _appAnsMachExit(int to)
+{
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	// Give the line back to pots_task
+	ans_mach_stop();
+	xTaskNotify(task_handle_pots, POTS_NOTIFY_ANS_MACH_END_MASK, eSetBits);
+#endif
+}
+
+
+// Call ended with no action (no rings in a while)
+static void _appRingingDone()
+{
+	// Special notification to pots_task that all rings associated with a call are done
+	xTaskNotify(task_handle_pots, POTS_NOTIFY_DONE_RINGING_MASK, eSetBits);
+}
+
+
+static void _appPreStateChange(int from, int to)
+{
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+	if ((to != DISCONNECTED) && (to != CONNECTED_IDLE)) {
+		// Wi-Fi must be off before the call needs the air
+		wifi_up_abort();
+	}
+#endif
+#if (CONFIG_CALL_LOG_ENABLE == true)
+	// Before the CONNECTED_IDLE entry clears the Caller ID
+	_appCallLogEval((app_state_t) to);
+#endif
+}
+
+
+static void _appPostStateChange(int from, int to)
+{
+	app_state = (app_state_t) to;
+	_appPublishStatus();
+	
+	// Notify gcore_task of activity while we're busy with a call
+	_appSetActivityTimer((to != DISCONNECTED) && (to != CONNECTED_IDLE));
+	
+	// Let the GUI know about our state change
+	xTaskNotify(task_handle_gui, GUI_NOTIFY_STATUS_UPDATE_MASK, eSetBits);
+}
+
+
+static bool _appCanInitiateAssistantCall()
+{
+	return ((dialing_num_valid == 1) && (dialing_num[0] == '0'));
+}
+
+
+static void _appInvalidateDialingNum()
+{
+	dialing_num_valid = 0;
+	_appPublishStatus();
+}
+
+
+static void _appInvalidateCID()
+{
+	// Create empty string
+	cid_num[0] = 0;
+	_appPublishStatus();
+}
+
+
+// Publish our part of the system status, called whenever any of it changes
+static void _appPublishStatus()
+{
+	app_status.state = app_state;
+	app_status.bt_in_service = bt_in_service;
+	app_status.dial_len = dialing_num_valid;
+	memcpy(app_status.dial_num, dialing_num, dialing_num_valid);
+	app_status.dial_num[dialing_num_valid] = 0;
+	strcpy(app_status.cid_num, cid_num);
+	strcpy(app_status.cw_num, cw_num);
+	sys_status_publish_app(&app_status);
+}
+
+
+static void _appSetActivityTimer(bool en)
+{
+	if (en && !soft_timer_running(activity_timer)) {
+		soft_timer_start_periodic(activity_timer, APP_ACTIVITY_MSEC);
+	} else if (!en) {
+		soft_timer_stop(activity_timer);
+	}
+}
+
+
+// A hook flash during a call swaps to the waiting or held call (otherwise it is ignored)
+static void _appHookFlash()
+{
+	if (((app_state == CALL_ACTIVE) || (app_state == CALL_ACTIVE_VOICE)) && (bt_call_waiting || bt_call_held)) {
+		evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_CALL_SWAP);
 		
-		case DIALING:  // User went off-hook to dial
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (!pots_off_hook) {
-				_appSetState(CONNECTED_IDLE);
-			} else if (notify_bt_ring_indication) {
-				// Someone calling us while we're dialing takes precedence
-				_appSetState(CALL_RECEIVED);
-			} else if (bt_audio_connected) {
-				// Cellphone routed audio to us
-				_appSetState(CALL_ACTIVE_VOICE);
-			} else if (dialing_num_valid > 0) {
-				// Increment the dial timer
-				dialing_pots_digit_timer += 1;
-				
-				// Look to see if can tell bluetooth to dial a number
-				if ((notify_dial_btn_pressed) || 
-				    (last_dial_digit_from_pots && (dialing_pots_digit_timer >= APP_LAST_DIGIT_2_DIAL_COUNT))) {
-					
-					_appSetState(CALL_INITIATED);
-				}
-			}
-			break;
+		// The waiting call is being answered
+		_appSetCallWaiting(false);
 		
-		case CALL_INITIATED: // Requested bluetooth initiate a phone call
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (bt_in_call) {
-				if (bt_audio_connected && pots_off_hook) {
-					_appSetState(CALL_ACTIVE_VOICE);
-				} else {
-					_appSetState(CALL_ACTIVE);
-				}
-			} else if (notify_dial_btn_pressed || !pots_off_hook) {
-				// Either the user ended the call from the GUI or our phone hung up the call
-				// so tell cellphone to end call
-				_appSetState(CALL_WAIT_END);
-			}
-			break;
+		// The next digit may ask for a conference
+		flash_digit_pending = true;
+		flash_tick = xTaskGetTickCount();
+	} else {
+		ESP_LOGI(TAG, "Hook flash ignored");
+	}
+}
+
+
+// Handles a digit dialed soon after a hook flash swapped calls, returning true if it was used
+// (a 3 joins the held and active calls, the AG mixes them into the one audio connection)
+static bool _appFlashDigit(char c)
+{
+	if (!flash_digit_pending) {
+		return false;
+	}
+	flash_digit_pending = false;
+	
+	if (((xTaskGetTickCount() - flash_tick) > pdMS_TO_TICKS(APP_FLASH_DIGIT_MSEC)) ||
+	    ((app_state != CALL_ACTIVE) && (app_state != CALL_ACTIVE_VOICE)) ||
+	    !bt_call_held || (c != '3')) {
+		return false;
+	}
+	
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_CALL_MERGE);
+	return true;
+}
+
+
+// Starts or stops the call waiting tone
+static void _appSetCallWaiting(bool waiting)
+{
+	if (waiting != bt_call_waiting) {
+		bt_call_waiting = waiting;
+		xTaskNotify(task_handle_pots, waiting ? POTS_NOTIFY_CALL_WAITING_MASK : POTS_NOTIFY_CALL_WAIT_END_MASK, eSetBits);
+	}
+}
+
+
+// Holds a volume change from the phone for the end of the holdoff period, applying it now
+// if the period isn't running
+static void _appBtGainChanged(int gain_type, float g)
+{
+	bt_gain_pending[gain_type] = true;
+	bt_gain_pending_db[gain_type] = g;
+	
+	if (!soft_timer_running(bt_gain_timer)) {
+		_appBtGainApply();
+	}
+}
+
+
+// Applies the latest held volume changes and starts a new holdoff period (none is started
+// if there were no changes so the next one is applied immediately)
+static void _appBtGainApply()
+{
+	bool applied = false;
+	
+	if (bt_gain_pending[GAIN_TYPE_MIC]) {
+		bt_gain_pending[GAIN_TYPE_MIC] = false;
+		applied = true;
 		
-		case CALL_ACTIVE:  // Call in progress, bluetooth audio is not routed to us
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (notify_dial_btn_pressed) {
-				// User ended the call from the GUI so we tell cellphone to end call
-				_appSetState(CALL_WAIT_END);
-			} if (!bt_in_call) {
-				// Cellphone ended the call
-				if (pots_off_hook) {
-					// Wait for phone to hang up
-					_appSetState(CALL_WAIT_ONHOOK);
-				} else {
-					_appSetState(CONNECTED_IDLE);
-				}
-			} else if (bt_audio_connected && pots_off_hook) {
-				// We now have bluetooth audio
-				_appSetState(CALL_ACTIVE_VOICE);
-			}
-			break;
+		// Update the audio gain
+		if (!audioSetGain(GAIN_TYPE_MIC, bt_gain_pending_db[GAIN_TYPE_MIC])) {
+			ESP_LOGE(TAG, "Update mic gain failed");
+		}
 		
-		case CALL_ACTIVE_VOICE:  // Call in progress, bluetooth audio is routed to us
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (notify_dial_btn_pressed || !pots_off_hook) {
-				// Either the user ended the call from the GUI or our phone hung up the call
-				// so tell cellphone to end call
-				_appSetState(CALL_WAIT_END);
-			} else if (!bt_audio_connected) {
-				if (!bt_in_call) {
-					// Cellphone ended the call so wait for phone to hang up
-					_appSetState(CALL_WAIT_ONHOOK);
-				} else {
-					// We no longer have bluetooth audio (the cellphone changed the audio destination)
-					_appSetState(CALL_ACTIVE);
-				}
-			}
-			break;
+		// Inform the GUI so it can update the control and PS
+		gui_set_new_mic_gain(bt_gain_pending_db[GAIN_TYPE_MIC]);
+		xTaskNotify(task_handle_gui, GUI_NOTIFY_UPDATE_MIC_GAIN_MASK, eSetBits);
+	}
+	
+	if (bt_gain_pending[GAIN_TYPE_SPK]) {
+		bt_gain_pending[GAIN_TYPE_SPK] = false;
+		applied = true;
 		
-		case CALL_WAIT_END:  // Waiting for bluetooth to indicate call has ended
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (bt_audio_connected && pots_off_hook) {
-					// Back to having some sort of a call
-					_appSetState(CALL_ACTIVE_VOICE);
-			} else if (!bt_in_call) {
-				if (pots_off_hook) {
-					_appSetState(CALL_WAIT_ONHOOK);
-				} else {
-					_appSetState(CONNECTED_IDLE);
-				}
-			}
-			break;
+		if (!audioSetGain(GAIN_TYPE_SPK, bt_gain_pending_db[GAIN_TYPE_SPK])) {
+			ESP_LOGE(TAG, "Update speaker gain failed");
+		}
 		
-		case CALL_WAIT_ONHOOK:  // Call ended, waiting for user to hang up phone
-			if (!bt_in_service) {
-				_appSetState(DISCONNECTED);
-			} else if (!pots_off_hook) {
-				_appSetState(CONNECTED_IDLE);
-			}
-			break;
+		gui_set_new_spk_gain(bt_gain_pending_db[GAIN_TYPE_SPK]);
+		xTaskNotify(task_handle_gui, GUI_NOTIFY_UPDATE_SPK_GAIN_MASK, eSetBits);
 	}
 	
-	// Clear notifiers
-	notify_dial_btn_pressed = false;
-	notify_bt_ring_indication = false;
+	if (applied) {
+		soft_timer_start(bt_gain_timer, APP_BT_GAIN_HOLDOFF_MSEC);
+	}
 }
 
 
-static void _appSetState(app_state_t st)
-{	
+#if (CONFIG_CALL_LOG_ENABLE == true)
+// Follows a call through the state machine, logging it when it ends
+static void _appCallLogEval(app_state_t st)
+{
 	switch (st) {
-		case DISCONNECTED:
-			xTaskNotify(task_handle_pots, POTS_NOTIFY_OUT_OF_SERVICE_MASK, eSetBits);
-			break;
-		
-		case CONNECTED_IDLE:
-			xTaskNotify(task_handle_pots, POTS_NOTIFY_IN_SERVICE_MASK, eSetBits);
-			
-			// Reset state
-			_appInvalidateCID();
-			cid_valid = false;
-			ring_count = 0;
-			
-			// Reset number indication on GUI
-			_appInvalidateDialingNum();
-			xTaskNotify(task_handle_gui, GUI_NOTIFY_PH_NUM_UPDATE_MASK, eSetBits);
-			break;
-		
 		case CALL_RECEIVED:
-			xTaskNotify(task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK, eSetBits);
-			
-			// Setup unanswered call detection timer
-			call_received_timer = 0;
-			break;
-		
-		case CALL_WAIT_ACTIVE:
-			xTaskNotify(task_handle_bt, BT_NOTIFY_ANSWER_CALL_MASK, eSetBits);
-			break;
-			
-		case DIALING:
-			// Setup to start dialing
-			dialing_pots_digit_timer = 0;
+			if (!call_log_in_progress) _appCallLogStart(CALL_LOG_DIR_INCOMING, "");
 			break;
 		
 		case CALL_INITIATED:
-			if (_appCanInitiateAssistantCall()) {
-				xTaskNotify(task_handle_bt, BT_NOTIFY_DIAL_OPER_MASK, eSetBits);
-			} else {
-				bt_set_outgoing_number(dialing_num);
-				xTaskNotify(task_handle_bt, BT_NOTIFY_DIAL_NUM_MASK, eSetBits);
-			}
+			if (!call_log_in_progress) _appCallLogStart(CALL_LOG_DIR_OUTGOING, dialing_num);
 			break;
 		
 		case CALL_ACTIVE:
-			break;
-			
 		case CALL_ACTIVE_VOICE:
+			// A call placed from the phone itself shows up already active
+			if (!call_log_in_progress) _appCallLogStart(CALL_LOG_DIR_OUTGOING, "");
+			if (!call_log_connected) {
+				call_log_connected = true;
+				call_log_connect_time = time(NULL);
+			}
+			if (st == CALL_ACTIVE_VOICE) {
+				bt_get_link_stats(&call_log_link_stats);
+				call_log_rec.codec = call_log_link_stats.msbc ? CALL_LOG_CODEC_MSBC : CALL_LOG_CODEC_CVSD;
+			}
 			break;
 		
-		case CALL_WAIT_END:
-			xTaskNotify(task_handle_bt, BT_NOTIFY_HANGUP_CALL_MASK, eSetBits);
+		case DISCONNECTED:
+		case CONNECTED_IDLE:
+		case CALL_WAIT_ONHOOK:
+			if (call_log_in_progress) _appCallLogEnd();
 			break;
 		
-		case CALL_WAIT_ONHOOK:
+		default:
 			break;
 	}
-	
-#ifdef APP_ST_DEBUG
-	STATE_CHANGE_PRINT(app_state, st, app_state_name);
-#endif
-	app_state = st;
-	
-	// Let the GUI know about our state change
-	xTaskNotify(task_handle_gui, GUI_NOTIFY_STATUS_UPDATE_MASK, eSetBits);
 }
 
 
-static bool _appCanInitiateAssistantCall()
+static void _appCallLogStart(uint8_t dir, const char* num)
 {
-	return ((dialing_num_valid == 1) && (dialing_num[0] == '0'));
-}
-
-
-static void _appInvalidateDialingNum()
-{
-	dialing_num_valid = 0;
+	memset(&call_log_rec, 0, sizeof(call_log_rec_t));
+	call_log_rec.start = (uint32_t) time(NULL);
+	call_log_rec.dir = dir;
+	call_log_rec.codec = CALL_LOG_CODEC_NONE;
+	strncpy(call_log_rec.number, num, CALL_LOG_NUMBER_LEN);
+	
+	audio_get_stats(&call_log_audio_stats);
+	call_log_rec.rx_underruns = call_log_audio_stats.rx_underruns;
+	call_log_rec.tx_underruns = call_log_audio_stats.tx_underruns;
+	call_log_rec.plc_events = call_log_audio_stats.plc_events;
+	call_log_rec.jb_concealments = call_log_audio_stats.jb_concealments;
+	call_log_rec.deadline_misses = (uint16_t) call_log_audio_stats.deadline_misses;
+	
+	call_log_in_progress = true;
+	call_log_connected = false;
 }
 
 
-static void _appInvalidateCID()
+static void _appCallLogEnd()
 {
-	// Create empty string
-	cid_num[0] = 0;
+	audio_get_stats(&call_log_audio_stats);
+	call_log_rec.rx_underruns = call_log_audio_stats.rx_underruns - call_log_rec.rx_underruns;
+	call_log_rec.tx_underruns = call_log_audio_stats.tx_underruns - call_log_rec.tx_underruns;
+	call_log_rec.plc_events = call_log_audio_stats.plc_events - call_log_rec.plc_events;
+	call_log_rec.jb_concealments = call_log_audio_stats.jb_concealments - call_log_rec.jb_concealments;
+	call_log_rec.deadline_misses = (uint16_t) call_log_audio_stats.deadline_misses - call_log_rec.deadline_misses;
+	
+	if (call_log_connected) {
+		call_log_rec.duration_sec = (uint32_t) (time(NULL) - call_log_connect_time);
+		if (call_log_rec.codec != CALL_LOG_CODEC_NONE) {
+			call_log_rec.erle_db10 = (int16_t) call_log_audio_stats.quality.erle_db10;
+			call_log_rec.mos_x100 = (uint16_t) call_log_audio_stats.quality.mos_x100;
+			call_log_rec.nlp_pct = (uint8_t) call_log_audio_stats.quality.nlp_pct;
+		}
+	} else if (call_log_rec.dir == CALL_LOG_DIR_INCOMING) {
+		call_log_rec.dir = CALL_LOG_DIR_MISSED;
+	}
+	
+	if ((call_log_rec.dir != CALL_LOG_DIR_OUTGOING) && cid_valid) {
+		strncpy(call_log_rec.number, cid_num, CALL_LOG_NUMBER_LEN);
+	}
+	
+	call_log_append(&call_log_rec);
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+	wifi_up_add_call(&call_log_rec);
+#endif
+	call_log_in_progress = false;
+	
+	ESP_LOGI(TAG, "Logged call to/from \"%s\" (%u sec)", call_log_rec.number, call_log_rec.duration_sec);
 }
+#endif
@@ -32,48 +32,69 @@
 // App task constants
 //
 
-// Task evaluation period (mSec)
+// Period to check for the end of an audio sample recording (mSec).  Otherwise app_task only
+// runs when it has an event.
 #define APP_EVAL_MSEC                        50
 
+// Period of the activity notification to gcore_task while we're busy with a call
+#define APP_ACTIVITY_MSEC                    500
+
 // Period to wait after each ring notification to determine unanswered incoming call is over
 // (should be longer than longest period between two ring notifications from BT)
 #define APP_LAST_RING_DETECT_MSEC            7000
 
-// Period to wait after digit dialed on phone (but not GUI) before initiating a call
+// Period to wait after digit dialed on phone (but not GUI) before initiating a call when the
+// dial plan can't tell the number is complete
 #define APP_LAST_DIGIT_2_DIAL_MSEC           4000
 
 // Maximum number of dialed digits
 //   Includes phone number and any subsequent keypresses (e.g. entering info)
 #define APP_MAX_DIALED_DIGITS                256
 
-// Notifications
-#define APP_NOTIFY_POTS_ON_HOOK_MASK         0x00000001
-#define APP_NOTIFY_POTS_OFF_HOOK_MASK        0x00000002
-#define APP_NOTIFY_POTS_DIGIT_DIALED_MASK    0x00000010
-#define APP_NOTIFY_GUI_DIGIT_DIALED_MASK     0x00000020
-#define APP_NOTIFY_GUI_DIGIT_DELETED_MASK    0x00000040
-#define APP_NOTIFY_GUI_DIAL_BTN_PRESSED_MASK 0x00000100
-
-#define APP_NOTIFY_BT_IN_SERVICE_MASK        0x00001000
-#define APP_NOTIFY_BT_OUT_OF_SERVICE_MASK    0x00002000
-#define APP_NOTIFY_BT_RING_MASK              0x00010000
-#define APP_NOTIFY_BT_CALL_STARTED_MASK      0x00020000
-#define APP_NOTIFY_BT_CALL_ENDED_MASK        0x00040000
-#define APP_NOTIFY_BT_CID_AVAILABLE_MASK     0x00080000
-#define APP_NOTIFY_BT_AUDIO_START_MASK       0x00100000
-#define APP_NOTIFY_BT_AUDIO_ENDED_MASK       0x00200000
-
-#define APP_NOTIFY_NEW_GUI_MIC_GAIN_MASK     0x01000000
-#define APP_NOTIFY_NEW_GUI_SPK_GAIN_MASK     0x02000000
-#define APP_NOTIFY_NEW_BT_MIC_GAIN_MASK      0x04000000
-#define APP_NOTIFY_NEW_BT_SPK_GAIN_MASK      0x08000000
-#define APP_NOTIFY_POTS_MAX_SPK_GAIN_MASK    0x10000000
-#define APP_NOTIFY_POTS_NORM_SPK_GAIN_MASK   0x20000000
-#define APP_NOTIFY_START_AUDIO_SMPL_MASK     0x80000000
+// Depth of our event queue (EVT_QUEUE_APP)
+#define APP_EVT_QUEUE_DEPTH                  16
+
+// Events sent to EVT_QUEUE_APP (payload in brackets)
+#define APP_EVT_POTS_ON_HOOK                 1
+#define APP_EVT_POTS_OFF_HOOK                2
+#define APP_EVT_POTS_DIGIT_DIALED            3   // [digit]
+#define APP_EVT_GUI_DIGIT_DIALED             4   // [digit]
+#define APP_EVT_GUI_DIGIT_DELETED            5
+#define APP_EVT_GUI_DIAL_BTN_PRESSED         6
+#define APP_EVT_POTS_HOOK_FLASH              7
+
+#define APP_EVT_BT_IN_SERVICE                10
+#define APP_EVT_BT_OUT_OF_SERVICE            11
+#define APP_EVT_BT_RING                      12
+#define APP_EVT_BT_CALL_STARTED              13
+#define APP_EVT_BT_CALL_ENDED                14
+#define APP_EVT_BT_CID_AVAILABLE             15  // [str - caller ID number]
+#define APP_EVT_BT_AUDIO_START               16
+#define APP_EVT_BT_AUDIO_ENDED               17
+#define APP_EVT_FAR_TONE_START               18  // [digit - CALL_PROGRESS_* tone heard from the far end]
+#define APP_EVT_FAR_TONE_END                 19
+#define APP_EVT_BT_CALL_WAITING              27  // [str - waiting caller's number]
+#define APP_EVT_BT_CALL_WAIT_END             28
+#define APP_EVT_BT_CALL_HELD                 29  // [digit - esp_hf_call_held_status_t]
+#define APP_EVT_BT_CALL_ALERTING             32  // Outgoing call is ringing at the far end
+#define APP_EVT_BT_CALL_ALERT_END            33  // Call setup over (answered or failed)
+
+#define APP_EVT_NEW_GUI_MIC_GAIN             20  // New gain is in PS
+#define APP_EVT_NEW_GUI_SPK_GAIN             21
+#define APP_EVT_NEW_BT_MIC_GAIN              22  // [gain - dB]
+#define APP_EVT_NEW_BT_SPK_GAIN              23  // [gain - dB]
+#define APP_EVT_POTS_MAX_SPK_GAIN            24
+#define APP_EVT_POTS_NORM_SPK_GAIN           25
+#define APP_EVT_START_AUDIO_SMPL             26
+#define APP_EVT_ANS_MACH_DONE                34  // Answering machine finished taking a message
+
+#define APP_EVT_RING_TIMER                   30  // Our own software timers
+#define APP_EVT_DIAL_TIMER                   31
+#define APP_EVT_BT_GAIN_TIMER                35
 
 // App state
 typedef enum {DISCONNECTED, CONNECTED_IDLE, CALL_RECEIVED, CALL_WAIT_ACTIVE, DIALING, CALL_INITIATED, 
-			  CALL_ACTIVE, CALL_ACTIVE_VOICE, CALL_WAIT_END, CALL_WAIT_ONHOOK} app_state_t;
+			  CALL_ACTIVE, CALL_ACTIVE_VOICE, CALL_WAIT_END, CALL_WAIT_ONHOOK, CALL_ANS_MACH} app_state_t;
 
 
 
@@ -81,13 +102,9 @@ typedef enum {DISCONNECTED, CONNECTED_IDLE, CALL_RECEIVED, CALL_WAIT_ACTIVE, DIA
 // App Task API
 //
 void app_task();
-void app_set_gui_digit(char c);                      // Set by gui_task before sending notification
-void app_set_pots_digit(char c);                     // Set by pots_task before sending notification
-void app_set_cid_number(const char* pn);             // Set by bt_task before sending notification
 int app_get_cid_number(char* pn);                    // Called to get the current caller ID phone number
-int app_get_dial_number(char* pn);                   // Called to get the current dialed phone number
+int app_get_cw_number(char* pn);                     // Called to get the waiting caller's phone number
+int app_get_dial_number(char* pn);                   // Called to get the current dialed phone number (pn must have APP_MAX_DIALED_DIGITS + 1 characters)
 app_state_t app_get_state();
-void app_set_new_mic_gain(float g);                  // Called before sending BT_MIC_NEW_GAIN
-void app_set_new_spk_gain(float g);                  // Called before sending BT_SPK_NEW_GAIN
 
 #endif /* APP_TASK_H */
\ No newline at end of file
@@ -2,10 +2,12 @@
  * I2S Interface
  *   - Initializes HW Codec
  *   - Manages 8 KHz I2S stream to codec
- *   - Provides Line Echo Cancellation (LEC) functionality
+ *   - Provides Line Echo Cancellation (LEC) functionality using OSLEC or a frequency-domain
+ *     canceller, warm started from the last call
  *   - Provides 8 KHz <-> 16 KHz upsample/downsample as necessary
- *   - Provides RX/TX circular buffers plus semaphore protected access routines for tone
- *     generation and voice
+ *   - Provides RX/TX lock-free single-producer/single-consumer circular buffers and access
+ *     routines for tone generation and voice
+ *   - Provides always-on cycle count based profiling of the audio pipeline stages
  *
  * Copyright (c) 2023 Dan Julio
  *
@@ -25,63 +27,558 @@
  * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  *
  */
+#include <limits.h>
+#include <math.h>
+#include <stdatomic.h>
+#include <stdio.h>
 #include <string.h>
+#include "agc.h"
+#include "ans_mach.h"
+#include "app_task.h"
 #include "audio_hal.h"
 #include "audio_task.h"
+#include "biquad.h"
+#include "blackbox.h"
+#include "boot_prof.h"
+#include "bt_task.h"
+#include "call_progress.h"
+#include "clk_trim.h"
+#include "eq.h"
+#include "evt_bus.h"
+#include "fdaf.h"
 #include "gui_task.h"
+#include "hci_snoop.h"
+#include "heap_acct.h"
+#include "esp_cpu.h"
 #include "esp_system.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/semphr.h"
 #include "freertos/queue.h"
 #include "driver/i2s.h"
 #include "gain.h"
+#include "international.h"
+#include "latency.h"
+#include "limiter.h"
+#include "ns.h"
+#include "pace.h"
+#include "pots_task.h"
+#include "preroll.h"
+#include "pwr_mgmt.h"
+#include "pwr_profile.h"
 #include "ps.h"
+#include "res.h"
+#include "resample.h"
+#include "ring.h"
 #include "sample.h"
 #include "spandsp.h"
+#include "subband.h"
 #include "sys_common.h"
+#include "systrace.h"
 
 
 //
 // Local constants
 //
 
-// Uncomment for buffer analysis 
+// Uncomment to log I2S multi-buffer reads and dump the pipeline statistics at the end
+// of each stream
 //#define AUDIO_PRINT_BUF_INFO
 
-// Uncomment for OSLEC evaluation time debug
-//#define AUDIO_PRINT_OSLEC_TIME
-
 
 // SAMPLE RATE
 #define AUDIO_SAMPLE_RATE 8000
 
-// Uncomment to enable TX path high-pass filter (remove low frequency components that 
-// cause the hybrid to operate in a non-linear fashion from http://www.rowetel.com/?p=33)
-//#define ENABLE_ECHO_TX_HPF
+// Wideband (mSBC) sample rate
+#define AUDIO_SAMPLE_RATE_16K 16000
+
+// Uncomment to convert 16 kHz mSBC data to/from the 8 kHz codec rate instead of running
+// the codec, I2S and LEC natively at 16 kHz for wideband calls (halves LEC CPU load at the
+// expense of the wideband audio).  The performance profile can also select this per stream.
+//#define ENABLE_RESAMPLED_16K
+
+// High-pass filters on the line signal before the LEC (RX, removes hybrid DC offset and hum)
+// and on the voice played to the line (TX, removes low frequency components that cause the
+// hybrid to operate in a non-linear fashion from http://www.rowetel.com/?p=33) are selected
+// per-install through ps (PS_LEC_HPF_*) and take effect at the start of the next call.
+
+// Uncomment to run the I2S interface in stereo (L+R interleaved) mode instead of mono.  Only
+// channel 1 is used on RX and TX is played on both codec outputs so mono halves DMA memory,
+// interrupt payload and loop iterations.
+//#define ENABLE_I2S_STEREO
+
+// The LEC reference is read from the codec's left ADC, which samples a tap of the codec output
+// driving the AG1171, when CONFIG_AUDIO_HW_ECHO_REF is set.  It is then aligned with the line
+// audio by the codec itself instead of by the TX alignment buffer (which assumes the TX and RX
+// DMA run in lockstep) and includes the codec's delay and nonlinearity.  It needs stereo I2S.
+#if (CONFIG_AUDIO_HW_ECHO_REF == true)
+#define ENABLE_HW_ECHO_REF
+#ifndef ENABLE_I2S_STEREO
+#define ENABLE_I2S_STEREO
+#endif
+#endif
+
+// Comment out to disable detection of DTMF digits dialed by the phone during a call.  Digits
+// are detected on the echo cancelled signal and sent to the cellphone out-of-band (HFP AT+VTS).
+// The in-band tone is squelched while it is detected so the far end doesn't see it twice.
+#define ENABLE_VOICE_DTMF
+
+// Minimum in-call DTMF level (dBm0) - well above the detector default of -42 dBm0 so residual
+// far-end echo doesn't trigger it (the phone's own tones arrive at a much higher level)
+#define VOICE_DTMF_THRESHOLD -30
+
+// Comment out to disable the voice jitter buffers.  The Bluetooth SCO packet clock and the
+// codec I2S clock are independent so, during calls, the depth of each circular buffer is
+// held at an adaptive target by inserting or dropping single samples instead of letting it
+// drift until it under- or overflows.
+#define ENABLE_JITTER_BUFFER
+
+// Trimming the I2S clock to the Bluetooth SCO clock is enabled by CONFIG_AUDIO_CLK_TRIM and
+// needs the jitter buffer, whose drops, inserts and depth measure the drift.  The APLL the
+// I2S clock comes from is nudged so the jitter buffer rarely has to correct it.
+#if defined(ENABLE_JITTER_BUFFER) && (CONFIG_AUDIO_CLK_TRIM == true)
+#define ENABLE_CLK_TRIM
+#endif
+
+// Comment out to disable packet loss concealment of voice audio missing from the TX circular
+// buffer (e.g. lost SCO packets).  Gaps are filled by repeating the last pitch period with a
+// 50 mSec fade instead of zeros (which click) and echo canceller adaption is frozen while
+// the concealed audio is echoed back.
+#define ENABLE_TX_PLC
+
+// Comment out to start every call with a cold echo canceller instead of seeding it with the
+// coefficients it converged to during the previous call (the hybrid and phone wiring at an
+// install rarely change so they are usually still good and there's no echo while it adapts)
+#define ENABLE_LEC_WARM_START
+
+// Comment out to disable bulk delay estimation.  The pure delay through the codec, AG1171 and
+// I2S DMA pipeline beyond the fixed TX alignment offset shows up as leading near-zero LEC taps.
+// At the start of each call it is estimated and removed by delaying the TX alignment buffer
+// and shortening the canceller so its taps only cover the dispersive part of the echo.
+#define ENABLE_LEC_BULK_DELAY
+
+// Comment out to disable voice activity gating of the LEC.  Most of a call is one-sided
+// speech or silence.  While there is no far end (TX) speech, or nothing on the line (RX),
+// there is no echo to adapt to so the OSLEC background filter is neither run nor adapted
+// (the FDAF engine skips its gradient update).
+#define ENABLE_LEC_VAD_GATE
+
+// Comment out to disable the Geigel double talk detector.  Otherwise the LEC is gated the same
+// way as for silence while the line (RX) is louder than the echo of the far end (TX) could be
+// so near end speech doesn't pull the background filter off the echo path and get swapped
+// into the foreground filter (heard as bursts of echo when the phone user interrupts).
+#define ENABLE_LEC_DTD
+
+// Comment out to disable the echo canceller deadline budget controller.  When the cost of
+// servicing a voice frame gets close to the frame period it sheds LEC work in steps (stop
+// the background adaption, shorten the canceller, bypass the NLP) rather than let the I2S
+// DMA underflow and restores each step once there is headroom again.  Loses a little ERLE
+// instead of dropping audio.
+#define ENABLE_LEC_BUDGET
+
+// Comment out to run the whole OSLEC canceller on core 1.  Otherwise its background filter,
+// background adaption and transfer decision run one block behind in lec_bg_task on core 0
+// (which has idle time during calls) leaving only the foreground filter and NLP on core 1.
+// Recorded blocks and transferred coefficients are handed between the cores through double
+// buffers without a lock.
+#define ENABLE_LEC_SPLIT
+
+// Comment out to step every OSLEC tap the same (NLMS).  Otherwise proportionate adaption
+// (ECHO_CAN_USE_PNLMS) steps the blocks of taps holding the sparse hybrid echo faster and
+// only updates those blocks (plus one other per sample) so it converges faster at a fraction
+// of the background filter update cost.  The FDAF engine ignores it.
+#define ENABLE_LEC_PNLMS
+
+// Comment out to run the canceller on the full 16 kHz signal in native wideband calls (twice
+// the taps at twice the rate, about four times the work).  Otherwise the line and far end
+// reference are split into 0-4 kHz and 4-8 kHz bands (subband, using the resampler's half-band
+// filters).  The canceller runs on the low band at 8 kHz with the narrowband tap count.  A
+// suppressor handles the high band, where the hybrid's echo is weak and speech has little
+// energy.  The bands are merged again before the residual echo suppressor.  Either engine
+// may be used.
+#define ENABLE_LEC_SUBBAND
+
+// 16 kHz subband filter quality (see resample.h)
+#define LEC_SUBBAND_QUALITY RESAMPLE_QUALITY_HIGH
+
+// Comment out to use the OSLEC non-linear processor and clipper on the canceller output.
+// Otherwise a two band residual echo suppressor (res) removes what's left of the echo in
+// proportion to the far end level seen over the tail and fills in the background it takes
+// out with comfort noise from precomputed tables.  Its gains are computed once per block
+// so it costs little more than the NLP and doesn't chop the near end during double talk.
+#define ENABLE_LEC_RES
+
+// Comment out to always run OSLEC with its inputs halved (its original fixed headroom for
+// clipping inputs).  Otherwise they are only halved while either the far end reference or
+// the line has recently peaked above half scale so quieter calls keep their full resolution.
+// The FDAF engine ignores it.
+#define ENABLE_LEC_ADAPTIVE_SCALE
+
+// Comment out to disable the LEC divergence watchdog.  Long double talk or a change in the
+// hybrid (e.g. a second extension going off-hook) can make either engine diverge so that it
+// adds echo until it re-converges seconds later.  The watchdog keeps a copy of the taps each
+// time the ERLE has been good for a while and, when the canceller output gets louder than its
+// input during far end speech, puts them back (or clears the taps if there is no good copy).
+#define ENABLE_LEC_WATCHDOG
+
+// Comment out to remove the noise suppressor from the voice sent to the cellphone.  Otherwise
+// line hiss and hum left after the LEC (and the residual echo suppressor) are reduced by a
+// spectral suppressor sharing the FDAF FFT when ps_get_ns_level() selects an attenuation for
+// the call.  It adds NS_FRAME samples of delay, is bypassed (but still delays) along with the
+// NLP by the budget controller and its cost is profiled as AUDIO_STAGE_NS.
+#define ENABLE_NOISE_SUPPRESS
+
+// Comment out to disable automatic gain control of the voice sent to the cellphone.  Handsets
+// vary by more than 10 dB in transmit level so, after the LEC and the (static) mic gain, the
+// level of near end speech is brought towards MIC_AGC_TARGET_DBM0.  It only adapts on speech
+// and holds while there is far end speech so residual echo doesn't raise the gain.
+#define ENABLE_MIC_AGC
+
+// Comment out to disable the soft limiter on the voice sent to the cellphone.  Otherwise a
+// look-ahead limiter after the LEC and mic gain holds loud talkers (e.g. carbon microphone
+// phones) under MIC_LIMIT_LEVEL with a gain ramp instead of letting them clip.
+#define ENABLE_MIC_LIMITER
+
+// Comment out to remove the handset equalizers.  Otherwise the biquad cascades of the
+// ps_get_eq_profile() profile for the call correct the frequency response of the handset in
+// both directions.  The line audio is equalized after the LEC and noise suppressor and the
+// cellphone audio before the TX alignment buffer, so the canceller's reference is the audio
+// actually played to the line and a profile change can't disturb the echo path.
+#define ENABLE_HANDSET_EQ
+
+// The codec's own ADC processing replaces software stages on the line signal as selected per
+// install by ps_get_codec_dsp() at the start of each voice stream (tone audio always runs with
+// just the DC filter).  PS_CODEC_DSP_HPF leaves DC removal to the ES8388 ADC high-pass filter
+// and bypasses the RX HPF.  PS_CODEC_DSP_ALC also bypasses the mic AGC for the codec ALC and
+// noise gate.  The ALC acts ahead of the LEC so the canceller sees its gain changes as changes
+// in the echo path.  Its slow decay keeps those small, but it suits installs with a short,
+// stable hybrid echo better than ones relying on a long tail.
+
+// Comment out to set mic and speaker gain with codec register writes.  Otherwise the codec
+// runs at the nominal gains and gain is applied digitally with a short ramp, so changes are
+// click-free, need no I2C traffic and (since the speaker gain is applied before the TX
+// alignment buffer and the mic gain after the LEC) don't disturb the echo path.
+#define ENABLE_DIGITAL_GAIN
+
+// Comment out to disable the TX mixer.  Otherwise audio from the tone and prompt sources is
+// mixed, each with its own gain, into whatever the main stream (voice or tone) is playing so
+// signalling can be heard during a call without a mode switch.
+#define ENABLE_TX_MIXER
 
-// Number of samples to read/write to the I2S subsystem at a time (bytes = 4x)
-//   Multiple is in mSec.  This should be the FreeRTOS scheduler period
-#define I2S_SAMPLES (10 * AUDIO_SAMPLE_RATE / 1000)
+// Digital sidetone is enabled by CONFIG_AUDIO_SIDETONE and needs the TX mixer.  The line signal
+// from the phone is tapped during voice calls after the RX high-pass filter (the voice path's
+// DC removal) and before the LEC, and added at the AUDIO_MIX_SIDETONE gain to the next TX frame
+// once that frame has been loaded into the TX alignment buffer.  So it adds no delay beyond the
+// I2S buffers, doesn't depend on the hybrid's leakage (line length) and isn't part of the echo
+// reference the LEC adapts to.  A reference read from the codec would include it so there is
+// no sidetone with ENABLE_HW_ECHO_REF.
+#if defined(ENABLE_TX_MIXER) && (CONFIG_AUDIO_SIDETONE == true) && !defined(ENABLE_HW_ECHO_REF)
+#define ENABLE_SIDETONE
+#endif
+
+// Detection of busy, reorder and SIT tones sent by the far end during a call is enabled by
+// CONFIG_CALL_PROGRESS_DETECT.  The far end audio is examined before anything is mixed into
+// it, decimated to 8 kHz and only when it isn't near silent, and not at all while the LEC
+// budget controller is shedding work (the frames count as silence), so it is charged to the
+// frame the budget controller watches and never competes with the canceller.
+#if (CONFIG_CALL_PROGRESS_DETECT == true)
+#define ENABLE_CALL_PROGRESS
+#endif
+
+// Far end frames with a lower peak are skipped by the call progress detector (about -45 dBm0,
+// below its -42 dBm0 detection threshold)
+#define CALL_PROGRESS_MIN_PEAK 128
+
+// Comment out to always read everything the I2S driver holds (up to MAX_READ_NUM_SAMPLES) for
+// each RX event.  Otherwise exactly one buffer is read per event in the steady state so the
+// LEC and TX alignment buffer see evenly spaced frames and only when audio_task finds itself
+// behind (a long gap since the last service or RX events piling up in the queue) does it
+// batch reads until it has caught up.
+#define ENABLE_I2S_ADAPTIVE_READ
+
+// Comment out to disable the echo path latency measurement (audioStartLatencyTest)
+#define ENABLE_LATENCY_TEST
+
+// Comment out to stop I2S and the codec and restart the stream each time it switches between
+// tone and voice audio.  Otherwise, when the I2S sample rate doesn't change, the mux, resampler
+// and LEC are reconfigured at a TX frame boundary while I2S keeps running.  The last TX frame
+// before the switch fades out and the first one after fades in so there's no click.
+#define ENABLE_LIVE_MODE_SWITCH
+
+// Comment out to ignore AUDIO_NOTIFY_STANDBY_MASK and keep audio disabled while the phone rings.
+// Otherwise the codec and I2S run in the last call's voice mode with the LEC already seeded,
+// playing silence and discarding the mic audio, so answering only connects the voice API.
+#define ENABLE_AUDIO_STANDBY
+
+// I2S data layout
+#ifdef ENABLE_I2S_STEREO
+#define I2S_CHANNELS    2
+#define I2S_CHAN_FMT    I2S_CHANNEL_FMT_RIGHT_LEFT
+#define I2S_CHAN_TYPE   I2S_CHANNEL_STEREO
+#else
+#define I2S_CHANNELS    1
+// 16-bit ESP32 I2S stores the right slot first in each frame so this is the slot that was
+// channel 1 in the stereo layout
+#define I2S_CHAN_FMT    I2S_CHANNEL_FMT_ONLY_RIGHT
+#define I2S_CHAN_TYPE   I2S_CHANNEL_MONO
+#endif
+#define I2S_FRAME_BYTES (2 * I2S_CHANNELS)
+
+#ifdef ENABLE_HW_ECHO_REF
+// Slot holding the echo reference (the left slot is second in each 16-bit frame)
+#define I2S_ECHO_REF_SLOT 1
+#endif
+
+// MCLK is this multiple of the sample rate
+#define I2S_MCLK_MULTIPLE 256
+
+// 8k <-> 16k resampler filter quality (see resample.h)
+#define AUDIO_RESAMPLE_QUALITY RESAMPLE_QUALITY_MEDIUM
+
+// Number of samples to read/write to the I2S subsystem at a time (bytes = I2S_FRAME_BYTES x)
+//   Multiple is CONFIG_AUDIO_FRAME_MSEC.  The count is fixed so buffer sizes don't change
+//   when running at 16 kHz (half the frame length per buffer).
+#define I2S_SAMPLES (CONFIG_AUDIO_FRAME_MSEC * AUDIO_SAMPLE_RATE / 1000)
+
+// Number of I2S DMA buffers per direction - at least three, and enough to cover
+// I2S_DMA_MIN_MSEC so short frames still ride out audio_task being held off briefly
+#define I2S_DMA_MIN_MSEC   12
+#define I2S_DMA_BUF_COUNT  (((I2S_DMA_MIN_MSEC + CONFIG_AUDIO_FRAME_MSEC - 1) / CONFIG_AUDIO_FRAME_MSEC) < 3 ? 3 : \
+                            ((I2S_DMA_MIN_MSEC + CONFIG_AUDIO_FRAME_MSEC - 1) / CONFIG_AUDIO_FRAME_MSEC))
+
+// Longest audio_task blocks waiting for an I2S event while streaming before it checks for
+// notifications anyway (events normally arrive every frame so this only matters if the
+// DMA stalls)
+#define I2S_EVENT_WAIT_MSEC (4 * CONFIG_AUDIO_FRAME_MSEC)
 
 // Number of samples in our circular buffers
-//   Optimized to be a set of samples or two larger than the most entries used during operation
-//   as measured with AUDIO_PRINT_BUF_INFO defined
-#define BUF_SAMPLES (8 * I2S_SAMPLES)
+//   Must be a power of 2 and larger than the most entries used during operation (about
+//   8 * I2S_SAMPLES as measured with AUDIO_PRINT_BUF_INFO defined for 10 mSec frames).  Not
+//   reduced for shorter frames because the depth actually used is set by the Bluetooth SCO
+//   packet timing and the jitter buffer.
+#define BUF_SAMPLES 1024
+
+// Stream modes selected by notifications
+#define AUDIO_MODE_NONE     -1
+#define AUDIO_MODE_TONE     0
+#define AUDIO_MODE_VOICE_8  1
+#define AUDIO_MODE_VOICE_16 2
+
+// Echo canceller mode
+#ifdef ENABLE_LEC_RES
+#define LEC_NLP_MODE      0
+#else
+#define LEC_NLP_MODE      (ECHO_CAN_USE_NLP | ECHO_CAN_USE_CLIP)
+#endif
+#ifdef ENABLE_LEC_PNLMS
+#define LEC_PNLMS_MODE    ECHO_CAN_USE_PNLMS
+#else
+#define LEC_PNLMS_MODE    0
+#endif
+#define LEC_ADAPTION_MODE (ECHO_CAN_USE_ADAPTION | LEC_NLP_MODE | LEC_PNLMS_MODE)
+
+// Range of LEC tail lengths (mSec) configured per country or per-install through ps.  The
+// tail should be big enough to hold both the line/I2S subsystem delay and a full I2S_SAMPLE
+// delay but not so big as to make OSLEC execution time too long (cost scales with length
+// and doubles for native 16 kHz wideband calls).
+#define LEC_MIN_MSEC 16
+#define LEC_MAX_MSEC 64
+
+// Number of samples for the LEC for a tail length in mSec at a sample rate
+#define LEC_SAMPLES(msec, rate) ((msec) * (rate) / 1000)
+
+// Maximum LEC length (samples)
+#define LEC_MAX_TAPS LEC_SAMPLES(LEC_MAX_MSEC, AUDIO_SAMPLE_RATE_16K)
+
+// Minimum amount of voice (mSec) run through the LEC before its coefficients are considered
+// converged enough to seed the next call with
+#define LEC_SAVE_MIN_MSEC 5000
+
+// Voice path high-pass filter corner frequencies (Hz)
+#define LEC_RX_HPF_HZ          120
+#define LEC_TX_HPF_HZ          160
+
+// LEC convergence: a cold canceller is considered converged once the ratio of its input (RX)
+// to output power has been at least LEC_CONV_ERLE_RATIO (about 15 dB) for LEC_CONV_HOLD_MSEC
+// of far end (TX) speech.  The time reported is from the start of the call to the start of
+// the hold.  The same meters measure the ERLE during far end speech for the call quality.
+#define LEC_CONV_SHIFT         6
+#define LEC_CONV_TX_DBM0       -45.0f
+#define LEC_CONV_ERLE_RATIO    32
+#define LEC_CONV_HOLD_MSEC     250
+
+// Call quality: the recent ERLE decays over 2^QUAL_ERLE_RECENT_SHIFT samples of far end speech
+// (about 4 seconds at 8 kHz).  The E-model uses the delay through this device plus typical
+// delays in the phone (eSCO and codec framing) and the cellular network, the G.107 equipment
+// impairment (Ie) and packet loss robustness (Bpl) for each codec (mSBC is rated on the
+// narrowband scale) and the talker echo loudness of the residual echo through the hybrid.
+#define QUAL_ERLE_RECENT_SHIFT 15
+#define QUAL_BT_DELAY_MSEC     15
+#define QUAL_NET_DELAY_MSEC    100
+#define QUAL_CVSD_IE           10.0f
+#define QUAL_CVSD_BPL          10.0f
+#define QUAL_MSBC_IE           0.0f
+#define QUAL_MSBC_BPL          25.0f
+#define QUAL_RO                93.2f
+#define QUAL_ROE               94.77f   // G.107 default noise floor and receive loudness
+#define QUAL_SLR_RLR_DB        10.0f    // G.107 default send and receive loudness ratings
+#define QUAL_ERL_DB            6.0f     // Hybrid echo return loss if it hasn't been measured
+
+// LEC input scaling: OSLEC runs at full resolution once neither input has peaked at or above
+// LEC_SCALE_PEAK for LEC_SCALE_HOLD_MSEC and goes back to halving them as soon as one does
+#define LEC_SCALE_PEAK         16384
+#define LEC_SCALE_HOLD_MSEC    2000
+
+// LEC divergence watchdog: the canceller has diverged when its output power is more than
+// LEC_WD_DIVERGE_RATIO (3 dB) above its input for LEC_WD_DIVERGE_MSEC of far end speech.
+// The taps are copied when the ERLE has been at the convergence target for LEC_WD_GOOD_MSEC,
+// at most every LEC_WD_SNAP_MSEC, and it doesn't look again for LEC_WD_HOLDOFF_MSEC after
+// putting them back.
+#define LEC_WD_DIVERGE_RATIO   2
+#define LEC_WD_DIVERGE_MSEC    20
+#define LEC_WD_GOOD_MSEC       500
+#define LEC_WD_SNAP_MSEC       1000
+#define LEC_WD_HOLDOFF_MSEC    250
+
+// Mic AGC target speech level, lowest level that can be speech and gain range
+#define MIC_AGC_TARGET_DBM0    -20.0f
+#define MIC_AGC_MIN_DBM0       -50.0f
+#define MIC_AGC_MIN_GAIN_DB    -6.0f
+#define MIC_AGC_MAX_GAIN_DB    12.0f
+
+// Mic limiter output level (-3 dBFS) and release time
+#define MIC_LIMIT_LEVEL        23197
+#define MIC_LIMIT_RELEASE_MSEC 50
 
-// Number of samples for the LEC
-//   Multiple is in mSec.  This should be big enough to hold both the line/I2S subsystem
-//   delay and a full I2S_SAMPLE delay but not so big as to make OSLEC execution time too long
-#define LEC_SAMPLES (32 * AUDIO_SAMPLE_RATE / 1000)
+// Noise suppressor maximum attenuation for each PS_NS_LEVEL_* (dB)
+#define NS_LOW_ATTEN_DB        6.0f
+#define NS_MED_ATTEN_DB        12.0f
+#define NS_HIGH_ATTEN_DB       18.0f
 
-// Number of TX sample buffers to store to align TX/RX for LEC_SAMPLES
-//   Must be larger than the latency between TX and RX
-#define TX_ALIGN_SAMPLES (4 * I2S_SAMPLES)
+// TX mixer overlay sources (AUDIO_MIX_TONE to MIX_LAST_OVERLAY) have circular buffers
+#define MIX_LAST_OVERLAY       AUDIO_MIX_PROMPT
+
+// Loudest sidetone - its echo through the hybrid comes back into the sidetone tap so the
+// loop gain has to stay well below unity
+#define SIDETONE_MAX_DB        -6.0f
+
+// Sidetone tap buffer and the most samples it may hold when a TX frame is mixed (more are left
+// after a batched RX read and the oldest are dropped to keep the delay to about one frame)
+#define SIDETONE_RING_SAMPLES  512
+#define SIDETONE_MAX_SAMPLES   (2 * I2S_SAMPLES)
+
+// Codec input and I2S output samples at or beyond this magnitude are counted as clipped
+#define AUDIO_CLIP_LEVEL       32767
+
+// Digital gain ramp length and fractional bits kept while ramping
+#define GAIN_RAMP_MSEC         20
+#define GAIN_RAMP_SHIFT        8
+
+// LEC voice activity detection: TX (far end reference) and RX power meters with thresholds.
+// Adaption continues LEC_VAD_HANGOVER_MSEC after TX speech ends so the echo tail is covered.
+#define LEC_VAD_SHIFT          5
+#define LEC_VAD_TX_DBM0        -45.0f
+#define LEC_VAD_RX_DBM0        -55.0f
+#define LEC_VAD_HANGOVER_MSEC  (LEC_MAX_MSEC + 36)
+
+// LEC double talk detection: every millisecond the RX peak is compared against the largest
+// TX peak over the canceller's tail.  Near end speech is declared when the RX peak is above
+// LEC_DTD_RX_MIN and more than LEC_DTD_GEIGEL (Q15, 0.5 assumes at least 6 dB of hybrid echo
+// return loss) times the TX peak and lasts LEC_DTD_HANGOVER_MSEC after the last detection.
+#define LEC_DTD_GEIGEL         16384
+#define LEC_DTD_RX_MIN         64
+#define LEC_DTD_HANGOVER_MSEC  30
+#define LEC_DTD_HIST_LEN       (LEC_MAX_MSEC + 1)
+
+// Bulk delay estimator: TX and RX are decimated by BULK_DECIMATE and cross-correlated over
+// the configured LEC tail for BULK_EST_MSEC of active TX (mean level above BULK_TX_MIN_LEVEL).
+// A correlation peak of at least BULK_PEAK_RATIO times the average sets the delay removed,
+// less BULK_MARGIN_MSEC for the start of the echo response, up to BULK_MAX_MSEC.
+#define BULK_DECIMATE      4
+#define BULK_EST_MSEC      2000
+#define BULK_TX_MIN_LEVEL  200
+#define BULK_PEAK_RATIO    4
+#define BULK_MARGIN_MSEC   2
+#define BULK_MAX_MSEC      16
+#define BULK_MAX_LAGS      (LEC_MAX_TAPS / BULK_DECIMATE)
+
+// LEC budget controller: a frame costing LEC_BUDGET_HIGH_PCT of its period sheds the next
+// level (no faster than every LEC_BUDGET_HOLD_MSEC so the last change can take effect).  A
+// level is restored after LEC_BUDGET_RESTORE_WINDOWS windows with every frame under
+// LEC_BUDGET_LOW_PCT.  The canceller is shortened by LEC_BUDGET_CUT_DIV of its length in
+// multiples of FDAF_BLOCK (the FDAF partition size, also a multiple of the 4 taps OSLEC
+// processes at a time).
+#define LEC_BUDGET_HIGH_PCT          85
+#define LEC_BUDGET_LOW_PCT           60
+#define LEC_BUDGET_HOLD_MSEC         100
+#define LEC_BUDGET_WINDOW_MSEC       1000
+#define LEC_BUDGET_RESTORE_WINDOWS   3
+#define LEC_BUDGET_CUT_DIV           4
+
+// Core 0 task running the OSLEC background filter (above the other core 0 application tasks)
+#define LEC_BG_TASK_PRIORITY         4
+#define LEC_BG_TASK_STACK_SIZE       2048
+
+// Cycles available per sample at a sample rate
+#define LEC_BUDGET_CYCLES_PER_SAMPLE(rate) (CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ * 1000000 / (rate))
+
+// Number of TX samples to store to align TX/RX for LEC_SAMPLES
+//   Must be larger than the latency between TX and RX plus the largest bulk delay and a
+//   power of 2 for the ring buffer
+#define TX_ALIGN_MIN_SAMPLES ((I2S_DMA_BUF_COUNT + 1) * I2S_SAMPLES + LEC_SAMPLES(BULK_MAX_MSEC, AUDIO_SAMPLE_RATE_16K))
+#define TX_ALIGN_SAMPLES     1024
+
+// Samples the TX alignment buffer is preset with
+#define TX_ALIGN_PRESET      (I2S_DMA_BUF_COUNT * I2S_SAMPLES)
 
 // Maximum amount of data to read from the I2S driver to prevent it from overflowing
-// by reading more than one full I2S_SAMPLES if available.
-#define MAX_READ_NUM_SAMPLES 3 
+// by reading more than one full I2S_SAMPLES if available (up to all its DMA buffers).
+#define MAX_READ_NUM_SAMPLES I2S_DMA_BUF_COUNT
+
+// Cycles in one I2S buffer period at a sample rate
+#define I2S_PERIOD_CYCLES(rate) (I2S_SAMPLES * LEC_BUDGET_CYCLES_PER_SAMPLE(rate))
+
+// Statistics histogram bin 0 holds stage times less than 2^AUDIO_STATS_HIST_SHIFT cycles,
+// each subsequent bin doubles the range and the last bin holds everything larger
+#define AUDIO_STATS_HIST_SHIFT 11
+
+// Minimum interval between deadline watchdog warnings on the console
+#define DEADLINE_WARN_MSEC 1000
+
+// Echo path latency measurement sequence level and correlation lags computed per TX buffer
+// once the capture is complete
+#define LAT_AMPLITUDE         4000
+#define LAT_LAGS_PER_FRAME    32
+
+// Jitter buffer depth (headroom remaining after audio_task services a buffer) limits in
+// mSec.  The target starts at JB_INIT_MSEC, is raised by JB_STEP_MSEC each time the buffer
+// runs dry and lowered by JB_STEP_MSEC each JB_WINDOW_MSEC of I2S buffers if the headroom
+// never fell below JB_STEP_MSEC.  Clock drift is corrected one sample per I2S buffer when
+// the averaged depth leaves the JB_HYST_MSEC band around the target and a buffer more
+// than JB_FLUSH_MSEC deep (e.g. after a Bluetooth stall) is cut back to target at once.
+// The robust Bluetooth link profile keeps enough depth to ride out a few eSCO
+// retransmission windows.
+//   JB_FLUSH_MSEC at 16 kHz must be less than BUF_SAMPLES
+#if (CONFIG_BT_LINK_PROFILE_ROBUST == true)
+#define JB_MIN_MSEC      15
+#define JB_INIT_MSEC     30
+#else
+#define JB_MIN_MSEC      5
+#define JB_INIT_MSEC     20
+#endif
+#define JB_MAX_MSEC      40
+#define JB_STEP_MSEC     5
+#define JB_HYST_MSEC     2
+#define JB_FLUSH_MSEC    50
+#define JB_WINDOW_MSEC   1000
+#define JB_WINDOW_BLOCKS (JB_WINDOW_MSEC / CONFIG_AUDIO_FRAME_MSEC)
+
+// Jitter buffer depth averaging (1/2^JB_AVG_SHIFT exponential average per I2S buffer)
+#define JB_AVG_SHIFT     4
+
+// Number of samples for a jitter buffer depth in mSec at a sample rate
+#define JB_SAMPLES(msec, rate) ((msec) * (rate) / 1000)
 
 
 
@@ -96,54 +593,391 @@ static bool audio_enabled = false;
 static bool audio_restart = false;       // Set when re-enabling audio while it's already going
 static bool audio_mux_to_tone = false;   // True to enable tone API, false to enable Voice API
 static bool audio_mute_mic = false;
+#ifdef ENABLE_LIVE_MODE_SWITCH
+static int audio_switch_mode = AUDIO_MODE_NONE;  // Mode to switch to at the end of the next TX frame
+static bool audio_fade_in = false;               // Set to fade in the first TX frame after a switch
+#endif
+#ifdef ENABLE_AUDIO_STANDBY
+static bool audio_standby = false;               // Set while a voice stream runs disconnected from the voice API
+static int audio_standby_mode = AUDIO_MODE_VOICE_8;  // Voice mode of the last call
+#ifdef ENABLE_LIVE_MODE_SWITCH
+static bool audio_standby_switch = false;        // Set while a live switch from tone audio into standby is pending
+#endif
+#endif
 
-// Incoming audio circular buffer
-static int16_t rx_buf[BUF_SAMPLES];
-static int rx_buf_put;
-static int rx_buf_pop;
-static int rx_buf_count;
-static SemaphoreHandle_t rx_buf_mutex;
-
-// Outgoing audio circular buffer
-static int16_t tx_buf[BUF_SAMPLES];
-static int tx_buf_put;
-static int tx_buf_pop;
-static int tx_buf_count;
-static SemaphoreHandle_t tx_buf_mutex;
-
-// I2S buffers (2 entries per sample for both L+R channels)
-static int16_t i2s_rx_buf[MAX_READ_NUM_SAMPLES*2*I2S_SAMPLES];
-static int16_t i2s_tx_buf[2*I2S_SAMPLES];
-
-// TX alignment circular queue (for echo cancellation)
-static int16_t i2s_tx_align_buf[TX_ALIGN_SAMPLES];
-static int i2s_tx_buf_push;
-static int i2s_tx_buf_pop;
-static int i2s_tx_buf_count;
+// Codec power management - the average time the codec goes unused between streams selects
+// whether it is idled or stopped
+static bool codec_released = false;           // Set when the codec was released by a disabled stream
+static int64_t codec_stop_usec;
+static int codec_gap_msec = AUDIO_HAL_IDLE_MAX_MSEC;
 
-#ifdef AUDIO_PRINT_BUF_INFO
-// Maximum counts
-static int rx_buf_max_count;
-static int tx_buf_max_count;
-static int i2s_tx_buf_max_count;
+// Answer time measurement - audioMarkOffHook stores the time (mSec) and sets the request which
+// audio_task clears when the first far end audio is played
+static atomic_uint answer_mark_msec;
+static atomic_bool answer_req = false;
+static bool answer_standby = false;              // Set when the voice stream was connected from standby
+
+// Performance profile (pwr_profile) audio settings, read when a stream is started so they
+// never change during one
+static pwr_profile_t audio_prof;
+static int audio_prof_id = PWR_PROFILE_FULL;
+
+static const char* audio_mode_names[] = {"Tone stream (8k)", "Voice stream (8k)", "Voice stream (16k)"};
+
+// Outgoing SCO frame signalling - the frame length is the size of the last audioGetVoiceRx
+// request (set by Bluedroid) and pending is set when the stack wasn't signalled to pull a
+// frame because one wasn't available yet (counts the frames the stack is owed)
+static atomic_int voice_rx_frame_len;
+static atomic_int voice_rx_ready_pending;
+
+// pots_task notification thresholds for tone audio (0 = disabled)
+static int tone_tx_low_water = 0;
+static int tone_rx_high_water = 0;
+
+// Single-producer/single-consumer lock-free audio circular buffers (excess samples are
+// dropped when full)
+RING_DEFINE(audio_ring, int16_t, BUF_SAMPLES, RING_DROP_NEW)
+
+// Incoming audio circular buffer (produced by audio_task, consumed by pots_task or Bluedroid)
+static audio_ring_t rx_ring;
+
+// Outgoing audio circular buffer (produced by pots_task or Bluedroid, consumed by audio_task)
+static audio_ring_t tx_ring;
+
+#ifdef ENABLE_TX_MIXER
+// TX mixer overlay circular buffers (8 kHz, one per source after AUDIO_MIX_MAIN, each produced
+// by one task and consumed by audio_task)
+static audio_ring_t mix_ring[MIX_LAST_OVERLAY];
+static atomic_int mix_gain[AUDIO_MIX_NUM];    // Q14 per-source gains
+static bool mix_up_active = false;            // Set while mix_up_state holds overlay history
+static resample_state_t mix_up_state;         // 8k -> 16k interpolator for summed overlays
+static int16_t mix_buf[I2S_SAMPLES];          // Summed 8 kHz overlay audio
+static int16_t mix_up_buf[I2S_SAMPLES];       // at the I2S sample rate
+#endif
+
+#ifdef ENABLE_SIDETONE
+// Line signal at the I2S sample rate waiting to be mixed into TX (only used by audio_task)
+RING_DEFINE(sidetone_ring, int16_t, SIDETONE_RING_SAMPLES, RING_OVERWRITE)
+
+static sidetone_ring_t sidetone_ring;
+static int16_t sidetone_buf[I2S_SAMPLES];
+#endif
+
+#ifdef ENABLE_LATENCY_TEST
+// Echo path latency measurement
+#if (AUDIO_LAT_IR_LEN != LATENCY_IR_LEN)
+#error "AUDIO_LAT_IR_LEN must match LATENCY_IR_LEN"
+#endif
+static atomic_bool lat_req = false;           // Set by audioStartLatencyTest
+static bool lat_play = false;                 // Sequence replacing tone TX and RX being captured
+static bool lat_eval = false;                 // Correlating the capture
+static int lat_onset = -1;                    // Last measured echo onset (8 kHz samples) for the LEC
+static latency_state_t lat_state;
+#endif
+
+// Caller-owned tone buffer played after tx_ring drains (see audioPutToneTxBuffer)
+//   - tone_tx_bufP and tone_tx_buf_len are set before tone_tx_buf_remain is published
+//   - audio_task only advances tone_tx_buf_remain if pots_task hasn't replaced or cancelled it
+static const int16_t* tone_tx_bufP;
+static int tone_tx_buf_len;
+static atomic_int tone_tx_buf_remain;
+
+// Tone queued before an audioFlushToneTx (tx_ring up to tone_tx_flush_pos) is dropped at the
+// next TX frame, which fades out
+static atomic_uint tone_tx_flush_pos;
+static atomic_bool tone_tx_flush_req = false;
+
+#ifdef ENABLE_DIGITAL_GAIN
+// Digital gain (Q14 gains, see gainDB2Digital)
+typedef struct {
+	atomic_int target;       // Requested gain, set by audioSetGain
+	int end;                 // Gain the current ramp ends at
+	int32_t cur;             // Current gain << GAIN_RAMP_SHIFT
+	int32_t step;            // Per-frame ramp increment
+	int ramp;                // Frames left in the ramp
+} audio_gain_t;
+
+static audio_gain_t mic_gain;   // Applied to audio from the phone
+static audio_gain_t spk_gain;   // Applied to audio to the phone
+#endif
+
+#ifdef ENABLE_JITTER_BUFFER
+// Voice jitter buffer control (all values in circular buffer samples)
+typedef struct {
+	int target;              // Current target headroom
+	int min;                 // Limits
+	int max;
+	int step;
+	int hyst;
+	int flush;
+	int avg;                 // Averaged headroom << JB_AVG_SHIFT
+	int min_headroom;        // Lowest headroom seen in the current window
+	int window;              // I2S buffers remaining in the current window
+	bool primed;             // TX only: cleared to play silence until target is reached
+} audio_jb_t;
+
+static audio_jb_t tx_jb;
+static audio_jb_t rx_jb;
+static uint32_t rx_jb_underruns;  // audio_stats.rx_underruns last seen (written by the consumer)
+#endif
+
+// I2S buffers (I2S_CHANNELS entries per sample)
+static int16_t i2s_rx_buf[MAX_READ_NUM_SAMPLES*I2S_CHANNELS*I2S_SAMPLES];
+static int16_t i2s_tx_buf[I2S_CHANNELS*I2S_SAMPLES];
+
+// TX alignment circular queue (for echo cancellation, produced and consumed by audio_task)
+_Static_assert(TX_ALIGN_SAMPLES >= TX_ALIGN_MIN_SAMPLES, "TX_ALIGN_SAMPLES too small");
+RING_DEFINE(tx_align_ring, int16_t, TX_ALIGN_SAMPLES, RING_OVERWRITE)
+static tx_align_ring_t tx_align_ring;
+#if (I2S_CHANNELS != 1)
+static int16_t i2s_tx_align_mono[I2S_SAMPLES];  // Single channel copy of an outgoing I2S buffer
+#endif
+#ifdef ENABLE_TX_PLC
+RING_DEFINE(tx_plc_ring, bool, TX_ALIGN_SAMPLES, RING_OVERWRITE)
+static tx_plc_ring_t tx_plc_ring;               // Set for samples from a concealed I2S buffer
+static bool i2s_tx_buf_concealed = false;       // Set by _audioGetTx when it concealed data
+#endif
+
+// Echo canceller frame buffers (single channel)
+static int16_t ec_tx_buf[MAX_READ_NUM_SAMPLES*I2S_SAMPLES];
+static int16_t ec_rx_buf[MAX_READ_NUM_SAMPLES*I2S_SAMPLES];
+static int16_t ec_out_buf[MAX_READ_NUM_SAMPLES*I2S_SAMPLES];
+
+// Pipeline statistics - each field has a single writer so no locking is used (a reader
+// may see a slightly inconsistent snapshot which is fine for diagnostics)
+static audio_stats_t audio_stats;
+
+// Stage names for audio_print_stats (must match AUDIO_STAGE_* order)
+static const char* audio_stage_names[AUDIO_NUM_STAGES] = {
+	"I2S read",
+	"DC restore",
+	"LEC",
+	"Resample",
+	"RX put",
+	"TX get",
+	"BT cb",
+	"DTMF",
+	"Call progress",
+	"Frame",
+	"Noise supp"
+};
+
+#ifdef ENABLE_VOICE_DTMF
+// In-call DTMF detection (the detector always runs at 8 kHz)
+static dtmf_rx_state_t voice_dtmf_state;
+static goertzel_bank_t voice_tone_bank;         // Filter bank shared by the mic path tone detectors
+static resample_state_t voice_dtmf_down_state;  // 16k -> 8k decimator for native wideband calls
+static int16_t voice_dtmf_buf[MAX_READ_NUM_SAMPLES*I2S_SAMPLES];
+static bool voice_dtmf_squelch = false;         // Set while a digit is being detected
+static atomic_bool voice_dtmf_ack = false;      // Set while pots_task waits for a Type II CID ACK
+#endif
+
+#ifdef ENABLE_CALL_PROGRESS
+// Far end call progress tone detection (the detector always runs at 8 kHz)
+static bool cpd_ready = false;                  // Set when the detector was allocated
+static resample_state_t cpd_down_state;         // 16k -> 8k decimator for native wideband calls
+static int16_t cpd_in_buf[I2S_SAMPLES];         // Channel 1 of the TX frame
+static int16_t cpd_buf[I2S_SAMPLES];
+#endif
+
+#ifdef ENABLE_TX_PLC
+// TX packet loss concealment (operates on circular buffer samples)
+static plc_state_t tx_plc_state;
+#endif
+
+// Deadline watchdog - each I2S RX buffer must be serviced within one buffer period of
+// finishing (10 mSec at 8 kHz, 5 mSec at 16 kHz)
+static bool deadline_armed = false;           // Cleared at stream start (no previous service time)
+static uint32_t deadline_last_rx_cycles;      // esp_cpu_get_ccount() at the previous RX service
+static TickType_t deadline_warn_tick = 0;
+
+#ifdef ENABLE_I2S_ADAPTIVE_READ
+// Set while batching I2S reads to catch up
+static bool i2s_rx_recover = false;
 #endif
 
 // DC restore state
 static dc_restore_state_t dc_restore_state;
 
-// Echo cancel state
-static echo_can_state_t *echo_can_state;
+// Echo cancel state (only one of echo_can_state or fdaf_state exists, selected by lec_engine)
+static echo_can_state_t *echo_can_state = NULL;
+static fdaf_state_t *fdaf_state = NULL;
+static int lec_engine = AUDIO_LEC_ENGINE_OSLEC;
+#if (CONFIG_LEC_ENGINE_FDAF == true)
+static atomic_int lec_engine_req = AUDIO_LEC_ENGINE_FDAF;    // Engine to use when the next voice call starts
+#else
+static atomic_int lec_engine_req = AUDIO_LEC_ENGINE_OSLEC;
+#endif
+static int echo_can_taps = 0;                 // Current length (configured length less bulk_delay)
+static int echo_can_rate = AUDIO_SAMPLE_RATE;  // Sample rate echo_can_taps was computed for
+static int lec_mode = LEC_ADAPTION_MODE;      // Current adaption mode (NLP may be bypassed)
+static int lec_tap_div = 1;                   // echo_can_rate samples per tap (2 for a subband canceller)
+#ifdef ENABLE_LEC_SUBBAND
+static bool lec_subband = false;              // Set when the canceller runs on the low band of a 16 kHz call
+static subband_split_t lec_sb_tx_split;
+static subband_split_t lec_sb_rx_split;
+static subband_merge_t lec_sb_merge;
+static subband_sup_t lec_sb_sup;              // High band echo suppressor
+static int16_t lec_sb_tx_lo[MAX_READ_NUM_SAMPLES*I2S_SAMPLES/2 + 1];
+static int16_t lec_sb_tx_hi[MAX_READ_NUM_SAMPLES*I2S_SAMPLES/2 + 1];
+static int16_t lec_sb_rx_lo[MAX_READ_NUM_SAMPLES*I2S_SAMPLES/2 + 1];
+static int16_t lec_sb_rx_hi[MAX_READ_NUM_SAMPLES*I2S_SAMPLES/2 + 1];
+static int16_t lec_sb_out_lo[MAX_READ_NUM_SAMPLES*I2S_SAMPLES/2 + 1];
+#endif
+#ifdef ENABLE_LEC_RES
+static res_state_t res_state;
+static bool res_bypass = false;               // Set by the budget controller along with the NLP
+#endif
+static int lec_cfg_taps = 0;                  // Configured length
+static int bulk_delay = 0;                    // Samples of pure delay moved into the TX alignment buffer
+
+#ifdef ENABLE_LEC_BULK_DELAY
+// Bulk delay estimator state
+static bool bulk_est_active = false;
+static int bulk_lags;                         // Decimated lags searched (configured tail)
+static int bulk_est_samples;                  // Active TX samples correlated so far
+static int bulk_dec_count;
+static int32_t bulk_tx_acc;
+static int32_t bulk_rx_acc;
+static int bulk_hist_idx;                     // Newest entry in bulk_tx_hist
+static float bulk_tx_hist[BULK_MAX_LAGS];     // Decimated TX history
+static float bulk_corr[BULK_MAX_LAGS];        // Cross-correlation for each decimated lag
+static int16_t bulk_coeffs[LEC_MAX_TAPS];     // Coefficients while moving the canceller
+#endif
+
+#ifdef ENABLE_LEC_VAD_GATE
+// LEC voice activity detection state
+static power_meter_t lec_vad_tx_meter;
+static power_meter_t lec_vad_rx_meter;
+static int32_t lec_vad_tx_thresh;
+static int32_t lec_vad_rx_thresh;
+static int lec_vad_hangover;                  // Samples left before TX is considered silent
+#endif
+
+#ifdef ENABLE_LEC_DTD
+// LEC double talk detection state
+static int16_t lec_dtd_tx_hist[LEC_DTD_HIST_LEN];  // TX peak of each recent millisecond
+static int lec_dtd_hist_pos;
+static int lec_dtd_sub_count;                 // Samples in the current millisecond
+static int16_t lec_dtd_tx_peak;               // Peaks in the current millisecond
+static int16_t lec_dtd_rx_peak;
+static int lec_dtd_hangover;                  // Samples left before near end speech is considered over
+#endif
+
+#ifdef ENABLE_LEC_SPLIT
+// OSLEC background filter task state.  lec_bg_ec is only set while the canceller may be
+// run by lec_bg_task and lec_bg_busy is set while it is running.
+static TaskHandle_t lec_bg_task_handle = NULL;
+static StackType_t lec_bg_task_stack[LEC_BG_TASK_STACK_SIZE];
+static StaticTask_t lec_bg_task_tcb;
+static _Atomic(echo_can_state_t*) lec_bg_ec = NULL;
+static atomic_bool lec_bg_busy = false;
+#endif
+
+#ifdef ENABLE_LEC_BUDGET
+// LEC budget controller state
+static int lec_budget_level;                  // AUDIO_LEC_BUDGET_*
+static int lec_budget_cut;                    // Taps removed at AUDIO_LEC_BUDGET_SHORT
+static int lec_budget_hold;                   // Samples before another level may be shed
+static int lec_budget_window;                 // Samples left in the current restore window
+static int lec_budget_good_windows;           // Consecutive windows under LEC_BUDGET_LOW_PCT
+static bool lec_budget_window_good;
+static int16_t lec_budget_coeffs[LEC_MAX_TAPS];  // Coefficients while resizing the canceller
+#endif
+
+#ifdef ENABLE_LEC_WARM_START
+// Coefficients saved from the last call long enough to converge
+static int16_t lec_coeff_slot[LEC_MAX_TAPS];
+static int lec_coeff_taps = 0;                // 0 when the slot is empty
+static int lec_coeff_rate;
+static int lec_voice_samples = 0;             // Samples run through the LEC since it was initialized
+#if (CONFIG_LEC_COEFF_NVRAM == true)
+static bool lec_coeff_dirty = false;          // Set when the slot should be written to NVRAM
+#endif
+#endif
+
+// Voice path high-pass filters (PS_LEC_HPF_* bits in lec_hpf for the current call)
+static uint8_t lec_hpf = 0;
+
+// Codec DSP offload profile (PS_CODEC_DSP_*) for the current stream
+static uint8_t codec_dsp = PS_CODEC_DSP_OFF;
+static biquad_state_t lec_rx_hpf;
+static biquad_state_t lec_tx_hpf;
+
+// LEC convergence tracking state
+static bool lec_conv_active = false;          // Set while a cold canceller is converging
+static power_meter_t lec_conv_tx_meter;
+static power_meter_t lec_conv_rx_meter;
+static power_meter_t lec_conv_out_meter;
+static int32_t lec_conv_tx_thresh;
+static int lec_conv_samples;                  // Samples since the canceller was initialized
+static int lec_conv_start;                    // Sample count at the start of the hold
+static int lec_conv_hold;                     // Consecutive TX speech samples at the ERLE target
+
+// Call quality state
+static uint64_t lec_erle_rx_sum;              // Canceller input and output power during TX speech this call
+static uint64_t lec_erle_out_sum;
+static uint64_t lec_erle_recent_rx;           // Decaying sums of the same
+static uint64_t lec_erle_recent_out;
+static audio_call_quality_t qual_base;        // Cumulative counts at the start of the call
+
+#ifdef ENABLE_LEC_ADAPTIVE_SCALE
+// OSLEC input scaling state
+static int lec_in_shift = 1;                  // Current echo_can_input_shift
+static int lec_scale_hold;                    // Samples left before the inputs may be full scale
+#endif
+
+#ifdef ENABLE_LEC_WATCHDOG
+// LEC divergence watchdog state
+static int16_t lec_wd_taps[LEC_MAX_TAPS];      // Last good coefficients
+static int lec_wd_num_taps = 0;               // Canceller length they were taken at (0 for none)
+static int lec_wd_rate;
+static int lec_wd_diverge;                    // Consecutive TX speech samples with output above input
+static int lec_wd_snap_wait;                  // Samples before the taps may be copied again
+static int lec_wd_holdoff;                    // Samples before divergence is checked again
+#endif
+
+#ifdef ENABLE_NOISE_SUPPRESS
+static ns_state_t ns_state;
+static bool ns_active = false;                // Set when the suppressor runs this call
+static bool ns_bypass = false;                // Set by the budget controller along with the NLP
+#endif
+
+#ifdef ENABLE_MIC_AGC
+static agc_state_t mic_agc;
+static bool mic_agc_on = true;                // Cleared when the performance profile turns it off this call
+#endif
+
+#ifdef ENABLE_MIC_LIMITER
+static limiter_state_t mic_limiter;
+#endif
+
+#ifdef ENABLE_HANDSET_EQ
+static eq_state_t mic_eq;                     // Line audio from the phone
+static eq_state_t spk_eq;                     // Cellphone audio to the phone
+#endif
 
 // I2S event queue
 static QueueHandle_t i2s_event_queue;
 
 // Sampling rate conversion
 static bool ext_sr_16k = false;               // Sampling rate of data in the audio circular buffers
-static uint16_t resample_buf[MAX_READ_NUM_SAMPLES*2*I2S_SAMPLES];  // Used by _audioGetTx/_audioPutRx when resampling data to minimize time lock held
-static int16_t us_taps[6];                    // FIFO of samples used in upscaling filter
-static const int32_t coef_a = 38400;
-static const int32_t coef_b = -6400;
-static const int32_t coef_c = 768;
+static bool resample_en = false;              // Set when ext_sr_16k data must be converted to/from i2s_sample_rate
+static int audio_sample_rate = AUDIO_SAMPLE_RATE;  // Requested codec/I2S/LEC sampling rate
+static int i2s_sample_rate = AUDIO_SAMPLE_RATE;    // Sampling rate the I2S peripheral is currently using
+static int16_t resample_buf[MAX_READ_NUM_SAMPLES*2*I2S_SAMPLES + 1];  // Used by _audioGetTx/_audioPutRx when resampling data (+1 for jitter buffer)
+static int16_t resample_mono_buf[MAX_READ_NUM_SAMPLES*I2S_SAMPLES + 1];  // Single channel RX data for upsampling
+static resample_state_t resample_down_state;  // 16k -> 8k TX decimator
+static resample_state_t resample_up_state;    // 8k -> 16k RX interpolator
+
+#if (CONFIG_ANS_MACH_ENABLE == true)
+// Answering machine - while set the cellphone is sent the greeting instead of the line and
+// the call audio is recorded instead of being played to the line
+static bool audio_ans_mach = false;
+static int16_t am_buf[MAX_READ_NUM_SAMPLES*I2S_SAMPLES];
+static resample_state_t am_up_state;          // 8k -> 16k greeting interpolator
+static resample_state_t am_down_state;        // 16k -> 8k recording decimator
+#endif
 
 
 
@@ -154,41 +988,167 @@ static void _audioInitI2S();
 static bool _audioInitCodec();
 static void _audioInitBuffers();
 static void _audioInitTxAlign();
-static void _audioHandleNotifications();
+static void _audioInitLec();
+static bool _audioLecCreate(int taps);
+static void _audioLecFree();
+static void _audioLecUpdate(int len, bool adapt_en, bool bg_en);
+#ifdef ENABLE_NOISE_SUPPRESS
+static void _audioInitNoiseSuppress();
+#endif
+#ifdef ENABLE_LEC_ADAPTIVE_SCALE
+static void _audioEvalLecScale(int len);
+#endif
+static void _audioInitLecConverge(bool cold);
+static void _audioEvalLecConverge(int len);
+#ifdef ENABLE_LEC_WATCHDOG
+static void _audioInitLecWatchdog();
+static void _audioEvalLecWatchdog(int len);
+#endif
+static void _audioInitQuality();
+static void _audioEvalQuality(audio_stats_t* s);
+#ifdef ENABLE_LEC_VAD_GATE
+static void _audioInitLecVad();
+static bool _audioEvalLecVad(int len);
+#endif
+#ifdef ENABLE_LEC_DTD
+static void _audioInitLecDtd();
+static bool _audioEvalLecDtd(int len, bool bg_en);
+#endif
+#if defined(ENABLE_LEC_WARM_START) || defined(ENABLE_LEC_BULK_DELAY) || defined(ENABLE_LEC_BUDGET) || defined(ENABLE_LEC_WATCHDOG)
+static void _audioLecGetCoeffs(int16_t* coeffs);
+static void _audioLecSetCoeffs(const int16_t* coeffs);
+#endif
+#ifdef ENABLE_LEC_SPLIT
+static void _audioLecBgTask(void* args);
+static void _audioLecBgAttach();
+static void _audioLecBgDetach();
+#endif
+#ifdef ENABLE_LEC_BUDGET
+static void _audioInitLecBudget();
+static void _audioEvalLecBudget(uint32_t cycles, int len);
+static void _audioSetLecBudgetLevel(int level);
+static bool _audioLecResize(int taps);
+#endif
+#ifdef ENABLE_LEC_WARM_START
+static void _audioSaveLecCoeffs();
+#endif
+#ifdef ENABLE_LEC_BULK_DELAY
+static void _audioInitBulkDelay();
+static void _audioEvalBulkDelay(int len);
+#ifdef ENABLE_LEC_WARM_START
+static int _audioBulkDelayFromCoeffs(const int16_t* coeffs, int len);
+#endif
+static void _audioApplyBulkDelay(int d);
+#endif
+static void _audioSetSampleRate();
+static void _audioCodecStart();
+static void _audioCodecRelease(bool restart);
+static TickType_t _audioCodecIdleWait();
+static void _audioHandleNotifications(TickType_t wait_ticks);
+static int _audioCurMode();
+static bool _audioVoiceActive();
+static int _audioModeSampleRate(int mode);
+static void _audioRequestMode(int mode);
+static void _audioSetMode(int mode);
+static void _audioEvalAnswer();
+static void _audioInitStream();
+#ifdef ENABLE_LIVE_MODE_SWITCH
+static void _audioSwitchMode();
+#endif
+static void _audioFade(int16_t* buf, int len, bool fade_in);
 static int _audioGetRx(int16_t* buf, int len);
 static void _audioPutTx(int16_t* buf, int len);
+static void _audioServiceTx();
 static void _audioGetTx(int len, int16_t* i2s_txP);
-static void _audioPutRx(int len, int16_t* i2s_rxP);
+static void _audioPutRx(int len, const int16_t* srcP, int stride);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+static void _audioAnsMachRx(int len);
+static void _audioAnsMachTx();
+#endif
 static void _audioPushTxAlign(int len, int16_t* txP);
-static int16_t _audioGetTxAlign();
-static __inline__ int16_t _audioDsFilter(int16_t s1, int16_t s2);
-static __inline__ int16_t _audioUsFilter(int16_t i3, int16_t* i);
-#ifdef AUDIO_PRINT_BUF_INFO
-static void _audioPrintBufInfo();
+#ifdef ENABLE_HW_ECHO_REF
+static void _audioPushEchoRef(int len);
+#endif
+static bool _audioGetTxAlignBlock(int len, int16_t* txP);
+#ifdef ENABLE_VOICE_DTMF
+static void _audioInitVoiceDtmf();
+static void _audioEvalVoiceDtmf(int len);
+static void _audioVoiceDtmfCallback(void* user_data, const char* digits, int len);
+#endif
+#ifdef ENABLE_CALL_PROGRESS
+static void _audioInitCallProgress();
+static void _audioEvalCallProgress(const int16_t* i2s_txP, int len);
+static void _audioCallProgressCallback(int tone);
 #endif
+static void _audioEvalDeadline(int len, uint32_t now_cycles);
+#ifdef ENABLE_I2S_ADAPTIVE_READ
+static int _audioI2sReadLen(uint32_t now_cycles);
+#endif
+#ifdef ENABLE_TX_PLC
+static void _audioPlcTx(int16_t* buf, int read_len, int len);
+#endif
+#ifdef ENABLE_JITTER_BUFFER
+static void _audioInitJitter();
+static void _audioJbInit(audio_jb_t* jbP, int rate);
+static int _audioJbEval(audio_jb_t* jbP, int headroom);
+static void _audioJbRaise(audio_jb_t* jbP);
+static int _audioJbTxLen(int len);
+static void _audioJbTxDone(int read_len, int len);
+static int _audioJbRxEval(int len);
+static int _audioJbDrop(int16_t* buf, int len);
+static int _audioJbInsert(int16_t* buf, int len);
+#endif
+#ifdef ENABLE_DIGITAL_GAIN
+static void _audioInitGain(audio_gain_t* gP, int gain);
+static void _audioApplyGain(audio_gain_t* gP, int16_t* buf, int len, int channels);
+#endif
+#ifdef ENABLE_TX_MIXER
+static void _audioInitMixer();
+static void _audioMixTx(int len, int16_t* i2s_txP);
+#endif
+#ifdef ENABLE_SIDETONE
+static void _audioMixSidetone(int len, int16_t* i2s_txP);
+#endif
+#ifdef ENABLE_LATENCY_TEST
+static void _audioLatencyTx(int16_t* buf, int len);
+static void _audioLatencyRx(int16_t* buf, int len);
+static void _audioLatencyAbort();
+#endif
+static void _audioEvalToneWatermarks();
+static void _audioEvalToneFlush();
+static int _audioTxCount();
+static int _audioGetToneTxBuffer(int16_t* dst, int len);
+static void _audioEvalVoiceRxReady();
+static int _audioRingPutStrided(audio_ring_t* r, const int16_t* src, int stride, int len);
+static int _audioRingGetFrames(audio_ring_t* r, int16_t* dst, int len);
+static void _audioStatsRecord(int stage, uint32_t start_cycles);
+static uint32_t _audioCountClips(const int16_t* buf, int len, int stride);
 
 //
 // API
 //
 void audio_task(void* args)
 {
-	int i;
-	int16_t tx, rx;
+	int i, n;
+	bool concealed;
+	bool vad_active = true;
 	size_t bytes_written;
 	size_t bytes_read;
 	i2s_event_t i2s_evt;
-#ifdef AUDIO_PRINT_OSLEC_TIME
-	int64_t oslec_start_usec;
-	int64_t oslec_exec_usec;
-	int64_t oslec_max_exec_usec = 0;
+	uint32_t stage_start;
+	uint32_t event_start;
+	uint32_t frame_cycles = 0;
+#ifdef ENABLE_NOISE_SUPPRESS
+	uint32_t ns_start;
 #endif
 	
 	
 	ESP_LOGI(TAG, "Start task");
 	
-	// Create circular buffer access mutex
-	rx_buf_mutex = xSemaphoreCreateMutex();
-	tx_buf_mutex = xSemaphoreCreateMutex();
+	// Performance profile settings until the first stream reads them
+	audio_prof_id = pwr_profile_get(&audio_prof);
+	
+	// Initialize circular buffers
 	_audioInitBuffers();
 	
 	// configure i2s
@@ -197,6 +1157,7 @@ void audio_task(void* args)
     // configure codec
     if (_audioInitCodec()) {
     	ESP_LOGI(TAG, "Codec initialized");
+    	boot_prof_mark("codec");
     } else {
     	ESP_LOGE(TAG, "Codec init failed");
     	gui_set_fatal_error("Codec init failed");
@@ -205,95 +1166,322 @@ void audio_task(void* args)
     (void) i2s_stop(I2S_NUM_0);
     
     // Line Echo Cancellation
-    echo_can_state = echo_can_create(LEC_SAMPLES, ECHO_CAN_USE_ADAPTION | ECHO_CAN_USE_NLP | ECHO_CAN_USE_CLIP /*| ECHO_CAN_USE_RX_HPF*/);
+#if defined(ENABLE_LEC_WARM_START) && (CONFIG_LEC_COEFF_NVRAM == true)
+    if (ps_get_lec_coeffs(lec_coeff_slot, LEC_MAX_TAPS, &lec_coeff_taps, &lec_coeff_rate)) {
+    	ESP_LOGI(TAG, "Read %d echo canceller coefficients", lec_coeff_taps);
+    }
+#endif
+#ifdef ENABLE_LEC_SPLIT
+    lec_bg_task_handle = xTaskCreateStaticPinnedToCore(&_audioLecBgTask, "lec_bg_task", LEC_BG_TASK_STACK_SIZE, NULL, LEC_BG_TASK_PRIORITY, lec_bg_task_stack, &lec_bg_task_tcb, 0);
+#endif
+    _audioInitLec();
+    
+    // 8k <-> 16k resampling filters
+    resample_init_down2(&resample_down_state, AUDIO_RESAMPLE_QUALITY);
+    resample_init_up2(&resample_up_state, AUDIO_RESAMPLE_QUALITY);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+    resample_init_up2(&am_up_state, AUDIO_RESAMPLE_QUALITY);
+    resample_init_down2(&am_down_state, AUDIO_RESAMPLE_QUALITY);
+#endif
+    
+#ifdef ENABLE_TX_MIXER
+    // TX mixer (all sources at unity gain)
+    for (i=0; i<AUDIO_MIX_NUM; i++) {
+    	atomic_store(&mix_gain[i], 1 << 14);
+    }
+#ifdef ENABLE_SIDETONE
+    sidetone_ring_init(&sidetone_ring);
+    audioSetMixGain(AUDIO_MIX_SIDETONE, (float) -CONFIG_AUDIO_SIDETONE_ATTEN_DB);
+#endif
+    resample_init_up2(&mix_up_state, AUDIO_RESAMPLE_QUALITY);
+    _audioInitMixer();
+#endif
+#ifdef ENABLE_CALL_PROGRESS
+    cpd_ready = call_progress_init(_audioCallProgressCallback);
+#endif
+    pace_declare(PACE_ID_AUDIO, "audio", PACE_PERIODIC, (uint32_t) I2S_SAMPLES * 1000000 / AUDIO_SAMPLE_RATE);
+    boot_prof_set_ready(BOOT_READY_AUDIO, "audio ready");
     
     while (true) {
     	if (!audio_enabled) {
-    		// Do nothing but wait to be enabled
-    		_audioHandleNotifications();
-    		vTaskDelay(pdMS_TO_TICKS(10));
+    		// Do nothing but block until a notification enables us
+#if defined(ENABLE_LEC_WARM_START) && (CONFIG_LEC_COEFF_NVRAM == true)
+    		if (lec_coeff_dirty) {
+    			// Store converged coefficients from the last call now that nothing is time critical
+    			lec_coeff_dirty = false;
+    			(void) ps_set_lec_coeffs(lec_coeff_slot, lec_coeff_taps, lec_coeff_rate);
+    		}
+#endif
+    		_audioHandleNotifications(_audioCodecIdleWait());
     	} else {    	
-    		// Start the codec
-    		(void) audio_hal_ctrl_codec(AUDIO_HAL_CODEC_MODE_BOTH, AUDIO_HAL_CTRL_START);
+    		// Switch sample rate if necessary and start (or resume) the codec
+    		_audioSetSampleRate();
+    		_audioCodecStart();
     		
 			// Prime TX
-			_audioGetTx(I2S_SAMPLES, i2s_tx_buf);
+			_audioInitStream();
+			_audioServiceTx();
+#ifdef ENABLE_TX_MIXER
+			_audioMixTx(I2S_SAMPLES, i2s_tx_buf);
+#endif
+#ifdef ENABLE_DIGITAL_GAIN
+			_audioApplyGain(&spk_gain, i2s_tx_buf, I2S_SAMPLES, I2S_CHANNELS);
+#endif
 			(void) i2s_start(I2S_NUM_0);
-			(void) i2s_write(I2S_NUM_0, (void*) i2s_tx_buf, I2S_SAMPLES * 4, &bytes_written, portMAX_DELAY);
+			(void) i2s_write(I2S_NUM_0, (void*) i2s_tx_buf, I2S_SAMPLES * I2S_FRAME_BYTES, &bytes_written, portMAX_DELAY);
 			_audioPushTxAlign(I2S_SAMPLES, i2s_tx_buf);
     	
 		   	while (audio_enabled && !audio_restart) {
-		   		while (xQueueReceive(i2s_event_queue, &i2s_evt, 0) && audio_enabled && !audio_restart) {
+		   		// Block until the I2S driver has something for us
+		   		while (xQueueReceive(i2s_event_queue, &i2s_evt, pdMS_TO_TICKS(I2S_EVENT_WAIT_MSEC)) && audio_enabled && !audio_restart) {
+		   			event_start = esp_cpu_get_ccount();
+		   			HEAP_ACCT_GUARD(_audioVoiceActive());
 					if (i2s_evt.type == I2S_EVENT_TX_DONE) {
-				    	_audioGetTx(I2S_SAMPLES, i2s_tx_buf);
-				    	(void) i2s_write(I2S_NUM_0, (void*) i2s_tx_buf, I2S_SAMPLES * 4, &bytes_written, portMAX_DELAY);
-			    		_audioPushTxAlign(I2S_SAMPLES, i2s_tx_buf);
+						SYSTRACE_START(SYSTRACE_ID_I2S_TX);
+				    	_audioServiceTx();
+				    	_audioEvalToneFlush();
+#ifdef ENABLE_CALL_PROGRESS
+				    	if (_audioVoiceActive() && cpd_ready) {
+				    		stage_start = esp_cpu_get_ccount();
+				    		_audioEvalCallProgress(i2s_tx_buf, I2S_SAMPLES);
+				    		_audioStatsRecord(AUDIO_STAGE_CPD, stage_start);
+				    	}
+#endif
+#ifdef ENABLE_TX_MIXER
+				    	_audioMixTx(I2S_SAMPLES, i2s_tx_buf);
+#endif
+#ifdef ENABLE_DIGITAL_GAIN
+				    	_audioApplyGain(&spk_gain, i2s_tx_buf, I2S_SAMPLES, I2S_CHANNELS);
+#endif
+#ifdef ENABLE_LIVE_MODE_SWITCH
+				    	if (audio_switch_mode != AUDIO_MODE_NONE) {
+				    		_audioFade(i2s_tx_buf, I2S_SAMPLES, false);
+				    	} else if (audio_fade_in) {
+				    		_audioFade(i2s_tx_buf, I2S_SAMPLES, true);
+				    		audio_fade_in = false;
+				    	}
+#endif
+#ifdef ENABLE_LATENCY_TEST
+				    	_audioLatencyTx(i2s_tx_buf, I2S_SAMPLES);
+#endif
+				    	_audioPushTxAlign(I2S_SAMPLES, i2s_tx_buf);
+#ifdef ENABLE_SIDETONE
+				    	// After the echo reference was taken
+				    	_audioMixSidetone(I2S_SAMPLES, i2s_tx_buf);
+#endif
+				    	audio_stats.tx_clips += _audioCountClips(i2s_tx_buf, I2S_SAMPLES, I2S_CHANNELS);
+				    	(void) i2s_write(I2S_NUM_0, (void*) i2s_tx_buf, I2S_SAMPLES * I2S_FRAME_BYTES, &bytes_written, portMAX_DELAY);
+#ifdef ENABLE_LIVE_MODE_SWITCH
+			    		if (audio_switch_mode != AUDIO_MODE_NONE) {
+			    			// The faded out frame was the last one of the old mode
+			    			_audioSwitchMode();
+			    		}
+#endif
+			    		_audioEvalToneWatermarks();
+			    		frame_cycles += esp_cpu_get_ccount() - event_start;
+			    		SYSTRACE_STOP(SYSTRACE_ID_I2S_TX);
 			    	} else if (i2s_evt.type == I2S_EVENT_RX_DONE) {
 						// Set timeout to 0 to get whatever is available without blocking.
 						// Read up to MAX_READ_NUM_SAMPLES complete sets of samples to try to prevent driver overflows.
-				    	(void) i2s_read(I2S_NUM_0, (void*) i2s_rx_buf, MAX_READ_NUM_SAMPLES * I2S_SAMPLES * 4, &bytes_read, 0);
+						SYSTRACE_START(SYSTRACE_ID_I2S_RX);
+						stage_start = esp_cpu_get_ccount();
+#ifdef ENABLE_I2S_ADAPTIVE_READ
+				    	(void) i2s_read(I2S_NUM_0, (void*) i2s_rx_buf, _audioI2sReadLen(stage_start) * I2S_FRAME_BYTES, &bytes_read, 0);
+				    	i2s_rx_recover = (bytes_read == (MAX_READ_NUM_SAMPLES * I2S_SAMPLES * I2S_FRAME_BYTES));
+#else
+				    	(void) i2s_read(I2S_NUM_0, (void*) i2s_rx_buf, MAX_READ_NUM_SAMPLES * I2S_SAMPLES * I2S_FRAME_BYTES, &bytes_read, 0);
+#endif
+				    	_audioStatsRecord(AUDIO_STAGE_I2S_READ, stage_start);
+				    	_audioEvalDeadline(bytes_read/I2S_FRAME_BYTES, stage_start);
+				    	audio_stats.rx_clips += _audioCountClips(i2s_rx_buf, bytes_read/I2S_FRAME_BYTES, I2S_CHANNELS);
 #ifdef AUDIO_PRINT_BUF_INFO
-						if (bytes_read/4 > I2S_SAMPLES) {
-							ESP_LOGW(TAG, "RX %d samples", bytes_read/4);
+						n = bytes_read/I2S_FRAME_BYTES;
+						if (n > I2S_SAMPLES) {
+							ESP_LOGW(TAG, "RX %d samples", n);
 						}
 #endif
 				
 						// Process audio - only worry about channel 1
 						if (audio_mux_to_tone) {
 							// DC restoration to remove any DC offsets because they may interfere with DTMF detection
-							for (i=0; i<(bytes_read/2); i+=2) {
+							stage_start = esp_cpu_get_ccount();
+							for (i=0; i<(bytes_read/2); i+=I2S_CHANNELS) {
 								i2s_rx_buf[i] = dc_restore(&dc_restore_state, i2s_rx_buf[i]);
 							}
-						} else {
+#ifdef ENABLE_LATENCY_TEST
+							if (lat_play) _audioLatencyRx(i2s_rx_buf, bytes_read/I2S_FRAME_BYTES);
+#endif
+#ifdef ENABLE_DIGITAL_GAIN
+							_audioApplyGain(&mic_gain, i2s_rx_buf, bytes_read/I2S_FRAME_BYTES, I2S_CHANNELS);
+#endif
+							_audioStatsRecord(AUDIO_STAGE_DC_RESTORE, stage_start);
+						} else if (_audioVoiceActive()) {
 							// Echo cancellation for voice
-#ifdef AUDIO_PRINT_OSLEC_TIME
-							oslec_start_usec = esp_timer_get_time();
+							stage_start = esp_cpu_get_ccount();
+							n = bytes_read/I2S_FRAME_BYTES;
+							audio_stats.quality.voice_samples += n;
+#ifdef ENABLE_HW_ECHO_REF
+							_audioPushEchoRef(n);
+#endif
+							concealed = _audioGetTxAlignBlock(n, ec_tx_buf);
+					    	for (i=0; i<n; i++) {
+					    		ec_rx_buf[i] = i2s_rx_buf[I2S_CHANNELS*i] * -1;  // AG1171 echoed output is inverted so we invert it again
+					    	}
+					    	if (lec_hpf & PS_LEC_HPF_RX) {
+					    		biquad_process(&lec_rx_hpf, ec_rx_buf, n);
+					    	}
+#ifdef ENABLE_SIDETONE
+					    	(void) sidetone_ring_write(&sidetone_ring, ec_rx_buf, n);
+#endif
+					    	if (echo_can_taps != 0) {
+#ifdef ENABLE_LEC_VAD_GATE
+					    		vad_active = _audioEvalLecVad(n);
+#endif
+#ifdef ENABLE_LEC_BUDGET
+					    		if (lec_budget_level >= AUDIO_LEC_BUDGET_NO_BG) vad_active = false;
+#endif
+#ifdef ENABLE_LEC_DTD
+					    		vad_active = _audioEvalLecDtd(n, vad_active);
 #endif
-					    	for (i=0; i<(bytes_read/2); i+=2) {
-					    		rx = i2s_rx_buf[i] * -1;  // AG1171 echoed output is inverted so we invert it again
-					    		tx = _audioGetTxAlign();
-					    		i2s_rx_buf[i] = echo_can_update(echo_can_state, tx, rx);
+#ifdef ENABLE_LEC_ADAPTIVE_SCALE
+					    		if (lec_engine == AUDIO_LEC_ENGINE_OSLEC) _audioEvalLecScale(n);
+#endif
+					    		// Don't let the canceller adapt to the echo of synthesized audio
+					    		SYSTRACE_START(SYSTRACE_ID_LEC);
+					    		_audioLecUpdate(n, !concealed, vad_active);
+					    		SYSTRACE_STOP(SYSTRACE_ID_LEC);
+					    		_audioEvalLecConverge(n);
+#ifdef ENABLE_LEC_WATCHDOG
+					    		_audioEvalLecWatchdog(n);
+#endif
+#ifdef ENABLE_LEC_WARM_START
+					    		lec_voice_samples += n;
+#endif
+#ifdef ENABLE_LEC_BULK_DELAY
+					    		if (bulk_est_active) _audioEvalBulkDelay(n);
+#endif
+					    	} else {
+					    		memcpy(ec_out_buf, ec_rx_buf, n * sizeof(int16_t));
+					    	}
 #if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
-					    		sample_record(tx, rx, i2s_rx_buf[i]);
+					    	sample_record(ec_tx_buf, ec_rx_buf, ec_out_buf, n);
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+					    	preroll_record(ec_tx_buf, ec_rx_buf, ec_out_buf, n);
+#endif
+#ifdef ENABLE_LEC_RES
+					    	if ((echo_can_taps != 0) && !res_bypass) {
+					    		res_process(&res_state, ec_tx_buf, ec_out_buf, n);
+					    	}
 #endif
+#ifdef ENABLE_NOISE_SUPPRESS
+					    	if (ns_active) {
+					    		// Charged to its own stage instead of the LEC
+					    		ns_start = esp_cpu_get_ccount();
+					    		ns_process(&ns_state, ec_out_buf, n, !ns_bypass);
+					    		_audioStatsRecord(AUDIO_STAGE_NS, ns_start);
+					    		stage_start += esp_cpu_get_ccount() - ns_start;
 					    	}
-#ifdef AUDIO_PRINT_OSLEC_TIME
-							oslec_exec_usec = esp_timer_get_time() - oslec_start_usec;
-							if (oslec_exec_usec > oslec_max_exec_usec) oslec_max_exec_usec = oslec_exec_usec;
+#endif
+#ifdef ENABLE_HANDSET_EQ
+					    	eq_process(&mic_eq, ec_out_buf, n);
+#endif
+#ifdef ENABLE_DIGITAL_GAIN
+					    	_audioApplyGain(&mic_gain, ec_out_buf, n, 1);
+#endif
+#ifdef ENABLE_MIC_AGC
+					    	if (mic_agc_on && (codec_dsp != PS_CODEC_DSP_ALC)) {
+#ifdef ENABLE_LEC_VAD_GATE
+					    		agc_process(&mic_agc, ec_out_buf, n, lec_vad_hangover != 0);
+#else
+					    		agc_process(&mic_agc, ec_out_buf, n, false);
+#endif
+					    	}
+#endif
+#ifdef ENABLE_MIC_LIMITER
+					    	if (limiter_process(&mic_limiter, ec_out_buf, n) < LIMITER_UNITY) {
+					    		audio_stats.lim_frames++;
+					    	}
+#endif
+					    	_audioStatsRecord(AUDIO_STAGE_LEC, stage_start);
+#ifdef ENABLE_VOICE_DTMF
+					    	
+					    	// Look for digits dialed by the phone
+					    	stage_start = esp_cpu_get_ccount();
+					    	_audioEvalVoiceDtmf(n);
+					    	_audioStatsRecord(AUDIO_STAGE_DTMF, stage_start);
 #endif
 				    	}
 				    	
-				    	// Store rx data (number of samples = 1/4 bytes read)
-				    	_audioPutRx(bytes_read/4, i2s_rx_buf);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+				    	if (audio_ans_mach && _audioVoiceActive()) {
+				    		_audioAnsMachRx(bytes_read/I2S_FRAME_BYTES);
+				    	}
+#endif
+				    	
+				    	// Store rx data directly from the echo canceller output or channel 1 of
+				    	// the I2S buffer (nothing is stored in standby)
+				    	if (audio_mux_to_tone) {
+				    		_audioPutRx(bytes_read/I2S_FRAME_BYTES, i2s_rx_buf, I2S_CHANNELS);
+				    	} else if (_audioVoiceActive()) {
+				    		_audioPutRx(bytes_read/I2S_FRAME_BYTES, ec_out_buf, 1);
+				    		_audioEvalVoiceRxReady();
+				    	}
+				    	_audioEvalToneWatermarks();
+				    	
+				    	// Per-frame cost is the TX service plus this RX service
+				    	frame_cycles += esp_cpu_get_ccount() - event_start;
+				    	_audioStatsRecord(AUDIO_STAGE_FRAME, esp_cpu_get_ccount() - frame_cycles);
+				    	if (_audioVoiceActive()) {
+				    		pwr_profile_record_dsp(audio_prof_id, frame_cycles,
+				    		                       (uint32_t) (bytes_read/I2S_FRAME_BYTES) * LEC_BUDGET_CYCLES_PER_SAMPLE(i2s_sample_rate));
+				    	}
+#ifdef ENABLE_LEC_BUDGET
+				    	if (_audioVoiceActive() && (echo_can_taps != 0)) {
+				    		_audioEvalLecBudget(frame_cycles, bytes_read/I2S_FRAME_BYTES);
+				    	}
+#endif
+				    	frame_cycles = 0;
+				    	SYSTRACE_STOP(SYSTRACE_ID_I2S_RX);
 			    	} else if (i2s_evt.type == I2S_EVENT_TX_Q_OVF) {
+			    		audio_stats.i2s_tx_underflows++;
 			    		ESP_LOGE(TAG, "I2S TX UNFL");
 			    	} else if (i2s_evt.type == I2S_EVENT_RX_Q_OVF) {
+			    		audio_stats.i2s_rx_overflows++;
 			    		ESP_LOGE(TAG, "I2S RX OVFL");
 			    	} else if (i2s_evt.type == I2S_EVENT_DMA_ERROR) {
+			    		audio_stats.i2s_dma_errors++;
 			    		ESP_LOGE(TAG, "I2S DMA ERROR");
 			    	}
 			    	
-			    	_audioHandleNotifications();
+			    	_audioHandleNotifications(0);
 		   		}
+		   		
+		   		// Still see notifications if the events stopped
+		   		_audioHandleNotifications(0);
 			}
 			
+			HEAP_ACCT_GUARD(false);
+			pace_pause(PACE_ID_AUDIO);
 			(void) i2s_stop(I2S_NUM_0);
-			(void) audio_hal_ctrl_codec(AUDIO_HAL_CODEC_MODE_BOTH, AUDIO_HAL_CTRL_STOP);
+			_audioCodecRelease(audio_restart);
 			
 			audio_restart = false; // In case it's the reason we are here
 			
-#ifdef AUDIO_PRINT_OSLEC_TIME
-			if (!audio_mux_to_tone) {
-				ESP_LOGI(TAG, "OSLEC max = %d mSec", (int32_t) (oslec_max_exec_usec/1000));
-				oslec_max_exec_usec = 0;
-			}
+#ifdef ENABLE_LEC_WARM_START
+			// Keep the converged coefficients from a voice call for the next one
+			_audioSaveLecCoeffs();
 #endif
+			
 #ifdef AUDIO_PRINT_BUF_INFO
-			_audioPrintBufInfo();
+			audio_print_stats();
 #endif
 				
 			// Reset the buffers
 			_audioInitBuffers();
+#ifdef ENABLE_TX_MIXER
+			_audioInitMixer();
+#endif
 		}
 	}
 }
@@ -301,25 +1489,13 @@ void audio_task(void* args)
 
 int audioGetTxCount()
 {
-	int n;
-	
-	xSemaphoreTake(tx_buf_mutex, portMAX_DELAY);
-	n = tx_buf_count;
-	xSemaphoreGive(tx_buf_mutex);
-	
-	return n;
+	return _audioTxCount();
 }
 
 
 int audioGetRxCount()
 {
-	int n;
-	
-	xSemaphoreTake(rx_buf_mutex, portMAX_DELAY);
-	n = rx_buf_count;
-	xSemaphoreGive(rx_buf_mutex);
-	
-	return n;
+	return audio_ring_count(&rx_ring);
 }
 
 
@@ -342,21 +1518,293 @@ void audioPutToneTx(int16_t* buf, int len)
 }
 
 
-int audioGetVoiceRx(int16_t* buf, int len)
+void audioPutToneTxBuffer(const int16_t* buf, int len)
 {
-	if (audio_enabled && !audio_mux_to_tone) {
-		return _audioGetRx(buf, len);
-	} else {
-		for (int i=0; i<len; i++) buf[i] = 0;
-		return len;
+	if (len <= 0) {
+		atomic_store_explicit(&tone_tx_buf_remain, 0, memory_order_release);
+	} else if (audio_enabled && audio_mux_to_tone) {
+		tone_tx_bufP = buf;
+		tone_tx_buf_len = len;
+		atomic_store_explicit(&tone_tx_buf_remain, len, memory_order_release);
 	}
 }
 
 
-void audioPutVoiceTx(int16_t* buf, int len)
+void audioFlushToneTx()
 {
-	if (audio_enabled && !audio_mux_to_tone) {
-		_audioPutTx(buf, len);
+	if (audio_enabled && audio_mux_to_tone) {
+		// Later puts (made by the caller after this returns) are kept
+		atomic_store_explicit(&tone_tx_buf_remain, 0, memory_order_release);
+		atomic_store_explicit(&tone_tx_flush_pos, audio_ring_position(&tx_ring), memory_order_relaxed);
+		atomic_store_explicit(&tone_tx_flush_req, true, memory_order_release);
+	}
+}
+
+
+bool audioToneTxReady()
+{
+	return audio_enabled && audio_mux_to_tone && !audio_restart;
+}
+
+
+void audioSetToneWatermarks(int tx_low, int rx_high)
+{
+	tone_tx_low_water = tx_low;
+	tone_rx_high_water = rx_high;
+}
+
+
+void audioMarkOffHook()
+{
+	atomic_store(&answer_mark_msec, (unsigned int) (esp_timer_get_time() / 1000));
+	atomic_store(&answer_req, true);
+}
+
+
+int audioGetVoiceRx(int16_t* buf, int len)
+{
+	atomic_store_explicit(&voice_rx_frame_len, len, memory_order_relaxed);
+	
+	if (_audioVoiceActive()) {
+		return _audioGetRx(buf, len);
+	} else {
+		for (int i=0; i<len; i++) buf[i] = 0;
+		return len;
+	}
+}
+
+
+void audioPutVoiceTx(int16_t* buf, int len)
+{
+	if (_audioVoiceActive()) {
+		_audioPutTx(buf, len);
+	}
+}
+
+
+bool audioVoiceRxFrameReady()
+{
+	int len = atomic_load_explicit(&voice_rx_frame_len, memory_order_relaxed);
+	
+	if (!_audioVoiceActive() || (audio_ring_count(&rx_ring) >= len)) {
+		// Also let the stack pull (zero) frames when there's no voice stream
+		return true;
+	}
+	
+	atomic_fetch_add_explicit(&voice_rx_ready_pending, 1, memory_order_release);
+	return false;
+}
+
+
+bool audioSetGain(int gain_type, float g)
+{
+#ifdef ENABLE_DIGITAL_GAIN
+	atomic_store(&((gain_type == GAIN_TYPE_MIC) ? &mic_gain : &spk_gain)->target, gainDB2Digital(gain_type, g));
+	return true;
+#else
+	return gainSetCodec(gain_type, g);
+#endif
+}
+
+
+void audioPutMixTx(int source, const int16_t* buf, int len)
+{
+#ifdef ENABLE_TX_MIXER
+	if ((source > AUDIO_MIX_MAIN) && (source <= MIX_LAST_OVERLAY) && audio_enabled) {
+		(void) audio_ring_write(&mix_ring[source - 1], buf, len);
+	}
+#endif
+}
+
+
+int audioGetMixTxCount(int source)
+{
+#ifdef ENABLE_TX_MIXER
+	if ((source > AUDIO_MIX_MAIN) && (source <= MIX_LAST_OVERLAY)) {
+		return audio_ring_count(&mix_ring[source - 1]);
+	}
+#endif
+	return 0;
+}
+
+
+bool audioMixTxReady()
+{
+	return audio_enabled && !audio_restart;
+}
+
+
+void audioFlushMixTx(int source)
+{
+#ifdef ENABLE_TX_MIXER
+	if ((source > AUDIO_MIX_MAIN) && (source <= MIX_LAST_OVERLAY)) {
+		audio_ring_request_flush(&mix_ring[source - 1]);
+	}
+#endif
+}
+
+
+void audioSetMixGain(int source, float g)
+{
+#ifdef ENABLE_TX_MIXER
+	if ((source >= AUDIO_MIX_MAIN) && (source < AUDIO_MIX_NUM)) {
+		if ((source == AUDIO_MIX_SIDETONE) && (g > SIDETONE_MAX_DB)) g = SIDETONE_MAX_DB;
+		atomic_store(&mix_gain[source], (int) roundf(16384.0f * powf(10.0f, g / 20.0f)));
+	}
+#endif
+}
+
+
+bool audioStartLatencyTest()
+{
+#ifdef ENABLE_LATENCY_TEST
+	if (audio_enabled && audio_mux_to_tone && !audio_restart) {
+		atomic_store(&lat_req, true);
+		return true;
+	}
+#endif
+	return false;
+}
+
+
+void audioSetDtmfAck(bool en)
+{
+#ifdef ENABLE_VOICE_DTMF
+	atomic_store(&voice_dtmf_ack, en);
+#endif
+}
+
+
+void audioSetLecEngine(int engine)
+{
+	atomic_store(&lec_engine_req, (engine == AUDIO_LEC_ENGINE_FDAF) ? AUDIO_LEC_ENGINE_FDAF : AUDIO_LEC_ENGINE_OSLEC);
+}
+
+
+void audio_get_stats(audio_stats_t* stats)
+{
+#ifdef ENABLE_CLK_TRIM
+	clk_trim_stats_t ct;
+	
+#endif
+	memcpy(stats, &audio_stats, sizeof(audio_stats_t));
+	stats->frame_msec = CONFIG_AUDIO_FRAME_MSEC;
+	stats->dma_buf_count = I2S_DMA_BUF_COUNT;
+	stats->dma_bufs_needed = (audio_stats.rx_max_backlog == 0) ? 0 : audio_stats.rx_max_backlog + 1;
+#ifdef ENABLE_MIC_AGC
+	stats->agc_gain_db10 = (int) roundf(agc_gain_db(&mic_agc) * 10.0f);
+	stats->agc_speech = mic_agc.speech_active;
+	stats->agc_speech_blocks = mic_agc.speech_blocks;
+#endif
+#ifdef ENABLE_CLK_TRIM
+	clk_trim_get_stats(&ct);
+	stats->clk_trim_active = ct.active;
+	stats->clk_trim_ppm10 = ct.trim_ppm10;
+	stats->clk_drift_ppm10 = ct.drift_ppm10;
+#endif
+	_audioEvalQuality(stats);
+}
+
+
+void audio_get_load(audio_load_t* load)
+{
+	load->enabled = audio_enabled;
+	load->deadline_misses = audio_stats.deadline_misses;
+	load->lec_budget_level = audio_stats.lec_budget_level;
+}
+
+
+void audio_reset_stats()
+{
+	memset(&audio_stats, 0, sizeof(audio_stats_t));
+	memset(&qual_base, 0, sizeof(audio_call_quality_t));
+}
+
+
+void audio_stats_record_bt_cb(uint32_t start_cycles)
+{
+	_audioStatsRecord(AUDIO_STAGE_BT_CB, start_cycles);
+}
+
+
+void audio_print_stats()
+{
+	int i, j;
+	audio_stats_t s;
+	audio_hal_power_stats_t ps;
+	char buf[AUDIO_LAT_IR_LEN*7 + 1];       // Also big enough for a histogram
+	
+	audio_get_stats(&s);
+	
+	for (i=0; i<AUDIO_NUM_STAGES; i++) {
+		buf[0] = 0;
+		for (j=0; j<AUDIO_STATS_HIST_BINS; j++) {
+			sprintf(&buf[strlen(buf)], " %u", s.stage[i].hist[j]);
+		}
+		ESP_LOGI(TAG, "%-10s n=%u avg=%u max=%u cyc, hist:%s", audio_stage_names[i],
+		         s.stage[i].count,
+		         (s.stage[i].count == 0) ? 0 : (uint32_t) (s.stage[i].total_cycles / s.stage[i].count),
+		         s.stage[i].max_cycles, buf);
+	}
+	ESP_LOGI(TAG, "RX ring: high water %d, overflows %u, underruns %u, deferred frames %u", s.rx_high_water, s.rx_overflows, s.rx_underruns, s.rx_deferred_frames);
+	ESP_LOGI(TAG, "TX ring: high water %d, overflows %u, underruns %u", s.tx_high_water, s.tx_overflows, s.tx_underruns);
+	ESP_LOGI(TAG, "TX align: high water %d", s.tx_align_high_water);
+	ESP_LOGI(TAG, "Frame: %d mSec, %d DMA buffers (%d needed for the largest backlog, %d bytes each)",
+	         s.frame_msec, s.dma_buf_count, s.dma_bufs_needed, I2S_SAMPLES * I2S_FRAME_BYTES);
+	ESP_LOGI(TAG, "I2S reads: max backlog %d buffers, %u batched reads", s.rx_max_backlog, s.rx_batch_reads);
+	ESP_LOGI(TAG, "I2S: RX overflows %u, TX underflows %u, DMA errors %u", s.i2s_rx_overflows, s.i2s_tx_underflows, s.i2s_dma_errors);
+	ESP_LOGI(TAG, "Deadlines: missed %u, max RX gap %u cyc", s.deadline_misses, s.max_rx_gap_cycles);
+	ESP_LOGI(TAG, "LEC: %s, %d taps, bulk delay %d", (s.lec_engine == AUDIO_LEC_ENGINE_FDAF) ? "FDAF" : "OSLEC", s.lec_taps, s.lec_bulk_delay);
+	ESP_LOGI(TAG, "LEC: adaption gated for %u of %u samples this call", s.lec_gated_samples, s.lec_samples);
+	ESP_LOGI(TAG, "LEC DTD: %s, %u double talk periods freezing adaption for %u samples this call",
+	         s.lec_dtd ? "double talk" : "clear", s.lec_dtd_events, s.lec_dtd_samples);
+	ESP_LOGI(TAG, "LEC HPF: RX %s, TX %s, converged %d mSec this call",
+	         (s.lec_hpf & PS_LEC_HPF_RX) ? "on" : "off", (s.lec_hpf & PS_LEC_HPF_TX) ? "on" : "off", s.lec_converge_msec);
+	for (i=0; i<AUDIO_LEC_HPF_CONFIGS; i++) {
+		if (s.lec_converge_calls[i] != 0) {
+			ESP_LOGI(TAG, "LEC HPF RX %s TX %s: %u cold calls, average convergence %u mSec",
+			         (i & PS_LEC_HPF_RX) ? "on" : "off", (i & PS_LEC_HPF_TX) ? "on" : "off",
+			         s.lec_converge_calls[i], s.lec_converge_total_msec[i] / s.lec_converge_calls[i]);
+		}
+	}
+	ESP_LOGI(TAG, "LEC split: %s, background overruns %u, max %u cyc", s.lec_split ? "on" : "off", s.lec_bg_overruns, s.lec_bg_max_cycles);
+	ESP_LOGI(TAG, "LEC subband: %s, 4-8 kHz band suppressed for %u samples this call", s.lec_subband ? "on" : "off",
+	         s.lec_hi_suppressed);
+	ESP_LOGI(TAG, "LEC watchdog: %u good copies, %u rollbacks, %u resets", s.lec_wd_snapshots, s.lec_wd_rollbacks, s.lec_wd_resets);
+	ESP_LOGI(TAG, "LEC budget: level %d (max %d), degrades %u, restores %u, peak frame load %d%%",
+	         s.lec_budget_level, s.lec_budget_max_level, s.lec_budget_degrades, s.lec_budget_restores, s.frame_load_peak_pct);
+	ESP_LOGI(TAG, "PLC: %u gaps, %u samples concealed", s.plc_events, s.plc_samples);
+	ESP_LOGI(TAG, "Call quality: MOS %d.%02d (R %d), delay %d mSec, ERLE %0.1f dB (recent %0.1f dB), NLP %d%%",
+	         s.quality.mos_x100 / 100, s.quality.mos_x100 % 100, s.quality.r_factor, s.quality.delay_msec,
+	         s.quality.erle_db10 / 10.0f, s.quality.erle_recent_db10 / 10.0f, s.quality.nlp_pct);
+	ESP_LOGI(TAG, "Call quality: %u of %u samples concealed in %u gaps, underruns RX %u TX %u",
+	         s.quality.plc_samples, s.quality.voice_samples, s.quality.plc_events, s.quality.rx_underruns, s.quality.tx_underruns);
+	ESP_LOGI(TAG, "Clipping: codec input %u, I2S output %u samples, limited frames %u",
+	         s.rx_clips, s.tx_clips, s.lim_frames);
+	ESP_LOGI(TAG, "LEC input shift: %d, %u changes", s.lec_in_shift, s.lec_scale_changes);
+	ESP_LOGI(TAG, "Noise suppressor: level %d this call", s.ns_level);
+	ESP_LOGI(TAG, "Handset equalizer: profile %d this call", s.eq_profile);
+	ESP_LOGI(TAG, "Codec DSP: %s this stream", (s.codec_dsp == PS_CODEC_DSP_ALC) ? "HPF, ALC and noise gate" :
+	         ((s.codec_dsp == PS_CODEC_DSP_HPF) ? "HPF" : "off (software HPF and AGC)"));
+	ESP_LOGI(TAG, "Mic AGC: gain %.1f dB, speech %s, adapted over %u blocks this call",
+	         s.agc_gain_db10 / 10.0f, s.agc_speech ? "yes" : "no", s.agc_speech_blocks);
+	audio_hal_get_power_stats(&ps);
+	ESP_LOGI(TAG, "Codec: %u starts (max %u uSec, settle %d mSec), %u resumes (max %u uSec, settle %d mSec), %u idles, %u stops",
+	         ps.starts, ps.max_start_usec, ps.start_settle_msec, ps.resumes, ps.max_resume_usec, ps.resume_settle_msec,
+	         ps.idles, ps.stops);
+	ESP_LOGI(TAG, "Answer: %d mSec (%s)", s.answer_msec, s.answer_standby ? "standby" : "stream start");
+	ESP_LOGI(TAG, "Performance profile: %s", pwr_profile_name(s.pwr_profile));
+	ESP_LOGI(TAG, "Jitter: TX target %d, adjusts %u, RX target %d, adjusts %u, concealments %u",
+	         s.tx_jb_target, s.tx_jb_adjusts, s.rx_jb_target, s.rx_jb_adjusts, s.jb_concealments);
+	if (s.clk_trim_active) {
+		ESP_LOGI(TAG, "Clock trim: %+.1f ppm, drift %+.1f ppm", s.clk_trim_ppm10 / 10.0f, s.clk_drift_ppm10 / 10.0f);
+	}
+	if (s.lat_status == AUDIO_LAT_DONE) {
+		buf[0] = 0;
+		for (j=0; j<AUDIO_LAT_IR_LEN; j++) {
+			sprintf(&buf[strlen(buf)], " %d", s.lat_ir[j]);
+		}
+		ESP_LOGI(TAG, "Echo path: delay %d uSec, onset %d, ERL %d dB, IR:%s", s.lat_delay_usec, s.lat_onset, s.lat_erl_db, buf);
 	}
 }
 
@@ -373,12 +1821,12 @@ static void _audioInitI2S()
         .bits_per_sample = I2S_BITS_PER_SAMPLE_16BIT,
         .communication_format = I2S_COMM_FORMAT_STAND_I2S,
         .intr_alloc_flags = ESP_INTR_FLAG_LEVEL2 | ESP_INTR_FLAG_IRAM,
-		.channel_format = I2S_CHANNEL_FMT_RIGHT_LEFT,
-        .dma_buf_count = 3,  // Three buffers to help prevent driver underflow/overflow conditions
+		.channel_format = I2S_CHAN_FMT,
+        .dma_buf_count = I2S_DMA_BUF_COUNT,  // Multiple buffers to help prevent driver underflow/overflow conditions
         .dma_buf_len = I2S_SAMPLES,
         .use_apll = 1,
         .tx_desc_auto_clear = 1,
-        .mclk_multiple = 256
+        .mclk_multiple = I2S_MCLK_MULTIPLE
 	};
 	i2s_pin_config_t i2s_pin_config = {
 		.bck_io_num = GPIO_NUM_25,
@@ -390,20 +1838,39 @@ static void _audioInitI2S()
     // install i2s driver
     i2s_driver_install(I2S_NUM_0, &i2s_config, 8, &i2s_event_queue);
     i2s_set_pin(I2S_NUM_0, &i2s_pin_config);
+#ifdef ENABLE_CLK_TRIM
+	(void) clk_trim_start(AUDIO_SAMPLE_RATE, I2S_MCLK_MULTIPLE);
+#endif
 }
 
 
 static bool _audioInitCodec()
 {
+#ifndef ENABLE_DIGITAL_GAIN
 	float g;
+#endif
 	
 	audio_hal_codec_config_t codec_config = AUDIO_HAL_ES8388_DEFAULT();
 	
+	// Let the codec play mono I2S data on both outputs
+	codec_config.dac_mono = (I2S_CHANNELS == 1);
+#ifdef ENABLE_HW_ECHO_REF
+	codec_config.adc_input = AUDIO_HAL_ADC_INPUT_LINE1_REF2;
+#endif
+	
 	if (!audio_hal_init(&codec_config, AUDIO_CODEC_ES8388)) {
 		return false;
 	}
 	
 	// Set initial volume
+#ifdef ENABLE_DIGITAL_GAIN
+	// Codec is fixed at the nominal gains
+	if (!gainSetCodec(GAIN_TYPE_MIC, GAIN_APP_MIC_NOM_DB) || !gainSetCodec(GAIN_TYPE_SPK, GAIN_APP_SPK_NOM_DB)) {
+		return false;
+	}
+	_audioInitGain(&mic_gain, gainDB2Digital(GAIN_TYPE_MIC, ps_get_gain(PS_GAIN_MIC)));
+	_audioInitGain(&spk_gain, gainDB2Digital(GAIN_TYPE_SPK, ps_get_gain(PS_GAIN_SPK)));
+#else
 	g = ps_get_gain(PS_GAIN_MIC);
 	if (!gainSetCodec(GAIN_TYPE_MIC, g)) {
 		return false;
@@ -413,6 +1880,7 @@ static bool _audioInitCodec()
 	if (!gainSetCodec(GAIN_TYPE_SPK, g)) {
 		return false;
 	}
+#endif
 	
 	return true;
 }
@@ -420,383 +1888,2546 @@ static bool _audioInitCodec()
 
 static void _audioInitBuffers()
 {
-	xSemaphoreTake(rx_buf_mutex, portMAX_DELAY);
-	rx_buf_put = 0;
-	rx_buf_pop = 0;
-	rx_buf_count = 0;
-	xSemaphoreGive(rx_buf_mutex);
+	// We are the RX producer so ask the consumer to flush on its next access
+	audio_ring_request_flush(&rx_ring);
 	
-	xSemaphoreTake(tx_buf_mutex, portMAX_DELAY);
-	tx_buf_put = 0;
-	tx_buf_pop = 0;
-	tx_buf_count = 0;
-	xSemaphoreGive(tx_buf_mutex);
+	// We are the TX consumer so we can flush directly
+	audio_ring_discard(&tx_ring);
+	atomic_store(&tone_tx_buf_remain, 0);
+	atomic_store(&tone_tx_flush_req, false);
 	
-#ifdef AUDIO_PRINT_BUF_INFO
-	rx_buf_max_count = 0;
-	tx_buf_max_count = 0;
-#endif
+	// Drop any deferred outgoing frame signal
+	atomic_store(&voice_rx_ready_pending, 0);
 }
 
 
 static void _audioInitTxAlign()
 {
-	for (int i=0; i<TX_ALIGN_SAMPLES; i++) {
-		i2s_tx_align_buf[i] = 0;
-	}
-	
 	// There is latency between loading a TX sample into the I2S driver and the echoed version
 	// returning through the RX path which OSLEC must deal with.  We try to reduce it some by
-	// presetting the alignment buffer push index slightly ahead.  This must never be so much
-	// that the TX data through the alignment buffer arrives after the echoed RX data.
-	// Must be less than buffer size.
-	i2s_tx_buf_push = 3 * I2S_SAMPLES;
-	i2s_tx_buf_pop = 0;
-	i2s_tx_buf_count = 0;
-	
-#ifdef AUDIO_PRINT_BUF_INFO
-	i2s_tx_buf_max_count = 0;
+	// presetting the alignment buffer with silence.  This must never be so much that the TX
+	// data through the alignment buffer arrives after the echoed RX data.  A reference read
+	// from the codec is already aligned so the buffer only holds the bulk delay.
+	tx_align_ring_init(&tx_align_ring);
+#ifndef ENABLE_HW_ECHO_REF
+	(void) tx_align_ring_fill(&tx_align_ring, 0, TX_ALIGN_PRESET);
+#endif
+#ifdef ENABLE_TX_PLC
+	// The concealment flags still follow the TX audio through the DMA pipeline
+	tx_plc_ring_init(&tx_plc_ring);
+	(void) tx_plc_ring_fill(&tx_plc_ring, false, TX_ALIGN_PRESET);
 #endif
 }
 
 
-static void _audioHandleNotifications()
+// Create the echo canceller for the currently configured tail length or flush it if the
+// length hasn't changed.  Only called while the voice path isn't running (or by audio_task
+// itself when switching modes).
+static void _audioInitLec()
 {
-	uint32_t notification_value = 0;
+	int msec;
+	int taps;
+#ifdef ENABLE_HANDSET_EQ
+	int eq_profile;
+#endif
+	bool seeded = false;
 	
-	// Handle notifications (clear them upon reading)
-	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, 0)) {
-		if (Notification(notification_value, AUDIO_NOTIFY_DISABLE_MASK)) {
-			if (audio_enabled != false) {
-				ESP_LOGI(TAG, "Disable stream");
-				audio_enabled = false;
-			}
-		}
-		
-		if (Notification(notification_value, AUDIO_NOTIFY_EN_TONE_MASK)) {
-			if (!((audio_enabled == true) && (audio_mux_to_tone == true) && (ext_sr_16k == false))) {
-				ESP_LOGI(TAG, "Enable Tone stream (8k)");
-				if (audio_enabled) {
-					audio_restart = true;
-				}
-				audio_enabled = true;
-				audio_mux_to_tone = true;
-				ext_sr_16k = false;           // Tones always 8k
-				
-				// Initialize zero DC restoration machine
-				dc_restore_init(&dc_restore_state);
-			}
-		}
-		
-		if (Notification(notification_value, AUDIO_NOTIFY_EN_VOICE_8_MASK)) {
-			if (!((audio_enabled == true) && (audio_mux_to_tone == false) && (ext_sr_16k == false))) {
-				ESP_LOGI(TAG, "Enable Voice stream (8k)");
-				if (audio_enabled) {
-					audio_restart = true;
-				}
-				audio_enabled = true;
-				audio_mux_to_tone = false;
-				ext_sr_16k = false;
-				
-				// Reset the echo canceller
-				_audioInitTxAlign();
-	    		echo_can_flush(echo_can_state);
-	    	}
-		}
-		
-		if (Notification(notification_value, AUDIO_NOTIFY_EN_VOICE_16_MASK)) {
-			if (!((audio_enabled == true) && (audio_mux_to_tone == false) && (ext_sr_16k == true))) {
-				ESP_LOGI(TAG, "Enable Voice stream (16k)");
-				if (audio_enabled) {
-					audio_restart = true;
-				}
-				audio_enabled = true;
-				audio_mux_to_tone = false;
-				ext_sr_16k = true;;
-				
-				// Reset the echo canceller
-				_audioInitTxAlign();
-	    		echo_can_flush(echo_can_state);
-				
-				// Reset the 2X upsample filter
-				for (int i=0; i<6; i++) us_taps[i] = 0;
-			}
-		}
-		
-		if (Notification(notification_value, AUDIO_NOTIFY_MUTE_MIC_MASK)) {
-			audio_mute_mic = true;
-		}
-		
-		if (Notification(notification_value, AUDIO_NOTIFY_UNMUTE_MIC_MASK)) {
-			audio_mute_mic = false;
-		}
+	msec = (int) ps_get_lec_tail_msec();
+	if (msec == PS_LEC_TAIL_COUNTRY_DEFAULT) {
+		msec = int_get_country_info((int) ps_get_country_code())->lec_tail_msec;
 	}
-}
-
-
-static int _audioGetRx(int16_t* buf, int len)
-{
-	int i;
-	int read_len;
+	if ((audio_prof.lec_max_msec != 0) && (msec > audio_prof.lec_max_msec)) msec = audio_prof.lec_max_msec;
+	if (msec < LEC_MIN_MSEC) msec = LEC_MIN_MSEC;
+	if (msec > LEC_MAX_MSEC) msec = LEC_MAX_MSEC;
 	
-	xSemaphoreTake(rx_buf_mutex, portMAX_DELAY);
-	read_len = (len > rx_buf_count) ? rx_buf_count : len;
+#ifdef ENABLE_LEC_WARM_START
+	// Save the current coefficients if a voice stream is being restarted
+	_audioSaveLecCoeffs();
+#endif
 	
-	for (i=0; i<read_len; i++) {
-		*(buf+i) = rx_buf[rx_buf_pop++];
-		if (rx_buf_pop >= BUF_SAMPLES) rx_buf_pop = 0;
+#ifdef ENABLE_LEC_SUBBAND
+	// A wideband call's canceller runs on the low band at the narrowband rate
+	lec_subband = (audio_sample_rate == AUDIO_SAMPLE_RATE_16K);
+	if (lec_subband) {
+		subband_init_split(&lec_sb_tx_split, LEC_SUBBAND_QUALITY);
+		subband_init_split(&lec_sb_rx_split, LEC_SUBBAND_QUALITY);
+		subband_init_merge(&lec_sb_merge, LEC_SUBBAND_QUALITY);
+		subband_init_sup(&lec_sb_sup, msec, AUDIO_SAMPLE_RATE);
 	}
+	lec_tap_div = lec_subband ? 2 : 1;
+	audio_stats.lec_subband = lec_subband;
+	audio_stats.lec_hi_suppressed = 0;
+#endif
+	taps = LEC_SAMPLES(msec, audio_sample_rate) / lec_tap_div;
 	
-	rx_buf_count -= read_len;
-	xSemaphoreGive(rx_buf_mutex);
+	// Start with the full configured length (the TX alignment buffer has been reset too)
+	lec_cfg_taps = taps;
+	bulk_delay = 0;
+#ifdef ENABLE_LEC_RES
+	res_init(&res_state, audio_sample_rate);
+	res_bypass = false;
+#endif
+#ifdef ENABLE_LEC_BUDGET
+	_audioInitLecBudget();
+#endif
 	
-	// Fill remaining with zero if necessary
-	if (len > read_len) {
-		for (i=read_len; i<len; i++) {
-			*(buf+i) = 0;
+	// High-pass filters for this call (the codec removes DC when it's handling the RX side)
+	lec_hpf = ps_get_lec_hpf();
+	if (codec_dsp != PS_CODEC_DSP_OFF) {
+		lec_hpf &= ~PS_LEC_HPF_RX;
+	}
+	biquad_init_hpf(&lec_rx_hpf, LEC_RX_HPF_HZ, audio_sample_rate);
+	biquad_init_hpf(&lec_tx_hpf, LEC_TX_HPF_HZ, audio_sample_rate);
+	audio_stats.lec_hpf = lec_hpf;
+#ifdef ENABLE_NOISE_SUPPRESS
+	_audioInitNoiseSuppress();
+#endif
+#ifdef ENABLE_HANDSET_EQ
+	eq_profile = audio_prof.eq ? ps_get_eq_profile() : PS_EQ_PROFILE_FLAT;
+	eq_init(&mic_eq, eq_profile, EQ_PATH_MIC, audio_sample_rate);
+	eq_init(&spk_eq, eq_profile, EQ_PATH_SPK, audio_sample_rate);
+	audio_stats.eq_profile = eq_profile;
+#endif
+#ifdef ENABLE_MIC_AGC
+	mic_agc_on = audio_prof.agc;
+	agc_init(&mic_agc, power_meter_level_dbm0(MIC_AGC_TARGET_DBM0), power_meter_level_dbm0(MIC_AGC_MIN_DBM0),
+	         MIC_AGC_MIN_GAIN_DB, MIC_AGC_MAX_GAIN_DB, audio_sample_rate);
+#endif
+#ifdef ENABLE_MIC_LIMITER
+	limiter_init(&mic_limiter, MIC_LIMIT_LEVEL, MIC_LIMIT_RELEASE_MSEC, audio_sample_rate);
+#endif
+#ifdef ENABLE_LEC_ADAPTIVE_SCALE
+	// Start each call with headroom
+	lec_in_shift = 1;
+	lec_scale_hold = LEC_SAMPLES(LEC_SCALE_HOLD_MSEC, audio_sample_rate);
+	audio_stats.lec_in_shift = lec_in_shift;
+#endif
+	
+	if ((echo_can_taps == taps) && (lec_engine == atomic_load(&lec_engine_req))) {
+		if (lec_engine == AUDIO_LEC_ENGINE_FDAF) {
+			fdaf_flush(fdaf_state);
+		} else {
+#ifdef ENABLE_LEC_SPLIT
+			_audioLecBgDetach();
+			echo_can_flush(echo_can_state);
+			_audioLecBgAttach();
+#else
+			echo_can_flush(echo_can_state);
+#endif
+#ifdef ENABLE_LEC_ADAPTIVE_SCALE
+			echo_can_input_shift(echo_can_state, lec_in_shift);
+#endif
+		}
+	} else {
+		_audioLecFree();
+		lec_engine = atomic_load(&lec_engine_req);
+		if (!_audioLecCreate(taps)) {
+			ESP_LOGE(TAG, "Could not create %d mSec echo canceller", msec);
+		} else {
+			ESP_LOGI(TAG, "%s echo canceller tail = %d mSec (%d taps%s)",
+				(lec_engine == AUDIO_LEC_ENGINE_FDAF) ? "FDAF" : "OSLEC", msec, taps,
+				(lec_tap_div == 1) ? "" : " on the 0-4 kHz band");
 		}
 	}
+	echo_can_rate = audio_sample_rate;
+	audio_stats.lec_engine = lec_engine;
+#ifdef ENABLE_LEC_VAD_GATE
+	_audioInitLecVad();
+#endif
+#ifdef ENABLE_LEC_DTD
+	_audioInitLecDtd();
+#endif
 	
-	return read_len;
+#ifdef ENABLE_LEC_WARM_START
+	// Seed the canceller if we have coefficients for the same configuration
+	if ((echo_can_taps != 0) && (lec_coeff_taps == echo_can_taps) && (lec_coeff_rate == echo_can_rate)) {
+		_audioLecSetCoeffs(lec_coeff_slot);
+		seeded = true;
+		ESP_LOGI(TAG, "Echo canceller seeded from previous call");
+#ifdef ENABLE_LEC_BULK_DELAY
+		// The seeded coefficients already show the bulk delay
+		bulk_est_active = false;
+		_audioApplyBulkDelay(_audioBulkDelayFromCoeffs(lec_coeff_slot, lec_coeff_taps));
+	} else {
+		_audioInitBulkDelay();
+#endif
+	}
+#elif defined(ENABLE_LEC_BULK_DELAY)
+	_audioInitBulkDelay();
+#endif
+	_audioInitLecConverge((echo_can_taps != 0) && !seeded);
+#ifdef ENABLE_LEC_WATCHDOG
+	_audioInitLecWatchdog();
+#endif
+	_audioInitQuality();
+	audio_stats.lec_taps = echo_can_taps;
+	audio_stats.lec_bulk_delay = bulk_delay;
+#if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
+	sample_set_config(audio_sample_rate, echo_can_taps, LEC_ADAPTION_MODE);
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+	preroll_start(echo_can_rate);
+#endif
 }
 
 
-static void _audioPutTx(int16_t* buf, int len)
+#ifdef ENABLE_NOISE_SUPPRESS
+// Start the noise suppressor at the level configured for this call
+static void _audioInitNoiseSuppress()
 {
-	xSemaphoreTake(tx_buf_mutex, portMAX_DELAY);
-	for (int i=0; i<len; i++) {
-		tx_buf[tx_buf_put++] = *(buf+i);
-		if (tx_buf_put >= BUF_SAMPLES) tx_buf_put = 0;
+	float atten_db;
+	
+	switch (audio_prof.ns ? ps_get_ns_level() : PS_NS_LEVEL_OFF) {
+		case PS_NS_LEVEL_LOW:
+			atten_db = NS_LOW_ATTEN_DB;
+			break;
+		case PS_NS_LEVEL_MED:
+			atten_db = NS_MED_ATTEN_DB;
+			break;
+		case PS_NS_LEVEL_HIGH:
+			atten_db = NS_HIGH_ATTEN_DB;
+			break;
+		default:
+			atten_db = 0;
 	}
 	
-	tx_buf_count += len;
-	if (tx_buf_count > BUF_SAMPLES) {
-		tx_buf_count = tx_buf_count % BUF_SAMPLES;
-#ifdef AUDIO_PRINT_BUF_INFO
-		ESP_LOGE(TAG, "TX FIFO overflow");
-#endif
+	ns_active = (atten_db != 0);
+	ns_bypass = false;
+	if (ns_active) {
+		ns_init(&ns_state, atten_db, audio_sample_rate);
 	}
-#ifdef AUDIO_PRINT_BUF_INFO
-	if (tx_buf_count > tx_buf_max_count) tx_buf_max_count = tx_buf_count;
-#endif
-	xSemaphoreGive(tx_buf_mutex);
+	audio_stats.ns_level = ns_active ? (int) ps_get_ns_level() : PS_NS_LEVEL_OFF;
 }
+#endif
 
 
-// Returns 2x sample data (L/R for 2-channel codec stream), handles 16k -> 8k conversion
-// and TX HPF filtering if necessary
-static void _audioGetTx(int len, int16_t* i2s_txP)
+// Create a canceller of the current lec_engine type.  Sets echo_can_taps to 0 on failure.
+static bool _audioLecCreate(int taps)
 {
-	int i;
-	int read_len;
-	int16_t t1, t2;
-	
-	// Quickly get the data out of the circular buffer.  We want to minimize time access
-	// to it is blocked because the other end may be incredibly constrained in time to
-	// load it (e.g. I saw nasty crashes if the Bluedroid task was held up for any time).
-	xSemaphoreTake(tx_buf_mutex, portMAX_DELAY);
-	if (ext_sr_16k) {
-		read_len = (2*len > tx_buf_count) ? tx_buf_count : 2*len;
+	if (lec_engine == AUDIO_LEC_ENGINE_FDAF) {
+		fdaf_state = fdaf_create(taps, lec_mode);
+		echo_can_taps = (fdaf_state == NULL) ? 0 : taps;
 	} else {
-		read_len = (len > tx_buf_count) ? tx_buf_count : len;
+		echo_can_state = echo_can_create(taps, lec_mode);
+		echo_can_taps = (echo_can_state == NULL) ? 0 : taps;
+#ifdef ENABLE_LEC_ADAPTIVE_SCALE
+		if (echo_can_state != NULL) echo_can_input_shift(echo_can_state, lec_in_shift);
+#endif
+#ifdef ENABLE_LEC_SPLIT
+		if (echo_can_state != NULL) {
+			if (echo_can_split(echo_can_state, MAX_READ_NUM_SAMPLES*I2S_SAMPLES) == 0) {
+				_audioLecBgAttach();
+			} else {
+				ESP_LOGW(TAG, "Could not split echo canceller - running it on one core");
+			}
+		}
+#endif
 	}
+#ifdef ENABLE_LEC_SPLIT
+	audio_stats.lec_split = (echo_can_state != NULL) && (echo_can_state->bg_frames != NULL);
+#endif
 	
-	for (i=0; i<read_len; i++) {
-		resample_buf[i] = tx_buf[tx_buf_pop++];
-		if (tx_buf_pop >= BUF_SAMPLES) tx_buf_pop = 0;
+	return (echo_can_taps != 0);
+}
+
+
+static void _audioLecFree()
+{
+	if (echo_can_state != NULL) {
+#ifdef ENABLE_LEC_SPLIT
+		_audioLecBgDetach();
+#endif
+		echo_can_free(echo_can_state);
+		echo_can_state = NULL;
+	}
+	if (fdaf_state != NULL) {
+		fdaf_free(fdaf_state);
+		fdaf_state = NULL;
 	}
+	echo_can_taps = 0;
+}
+
+
+// Cancel the echo in ec_rx_buf of ec_tx_buf into ec_out_buf, adapting only if adapt_en is set
+// and running the OSLEC background filter only if bg_en is set.  A subband canceller gets
+// the low band (reads are whole I2S buffers so len is even and the bands stay in step).
+static void _audioLecUpdate(int len, bool adapt_en, bool bg_en)
+{
+	int mode = adapt_en ? lec_mode : (lec_mode & ~ECHO_CAN_USE_ADAPTION);
+	int16_t* txP = ec_tx_buf;
+	int16_t* rxP = ec_rx_buf;
+	int16_t* outP = ec_out_buf;
 	
-	tx_buf_count -= read_len;
-	xSemaphoreGive(tx_buf_mutex);
+#ifdef ENABLE_LEC_SUBBAND
+	if (lec_subband) {
+		(void) subband_split(&lec_sb_tx_split, ec_tx_buf, len, lec_sb_tx_lo, lec_sb_tx_hi);
+		len = subband_split(&lec_sb_rx_split, ec_rx_buf, len, lec_sb_rx_lo, lec_sb_rx_hi);
+		txP = lec_sb_tx_lo;
+		rxP = lec_sb_rx_lo;
+		outP = lec_sb_out_lo;
+	}
+#endif
 	
-	// Process the data
-	if (ext_sr_16k) {
-		// 2X Downsample:
-		//   1. Apply a slight (but fast) low-pass filter
-		//   2. Take every other sample
-		//
-		// Bytes 0 1    2 3     4 5     6 7     8 9    10 11    12 13   14 15     [16 bytes -> 8 samples]
-		// Filt       0      1       2      3       4        5        6     
-		// Sav        0              1              2                 3           [4 samples]
-		for (i=0; i<read_len; i+=2) {
-			t1 = resample_buf[i];
-			t2 = resample_buf[i+1];
-			t1 = _audioDsFilter(t1, t2);
-#ifdef ENABLE_ECHO_TX_HPF
-			t1 = echo_can_hpf_tx(echo_can_state, t1);
-#endif
-			*i2s_txP++ = t1;    // Channel 1
-			*i2s_txP++ = t1;    // Channel 2
-		}
-		
-		// Fill remaining with zero if necessary
-		for (i=read_len/2; i<len; i++) {
-			*i2s_txP++ = 0;
-			*i2s_txP++ = 0;
-		}
+	if (lec_engine == AUDIO_LEC_ENGINE_FDAF) {
+		fdaf_adaption_mode(fdaf_state, bg_en ? mode : (lec_mode & ~ECHO_CAN_USE_ADAPTION));
+		fdaf_update_block(fdaf_state, txP, rxP, outP, len);
+		audio_stats.quality.nlp_samples = fdaf_state->nlp_samples;
 	} else {
-		for (i=0; i<read_len; i++) {
-			t1 = resample_buf[i];
-#ifdef ENABLE_ECHO_TX_HPF
-			t1 = echo_can_hpf_tx(echo_can_state, t1);
-#endif
-			*i2s_txP++ = t1;    // Channel 1
-			*i2s_txP++ = t1;    // Channel 2
-		}
-		
-		// Fill remaining with zero if necessary
-		for (i=read_len; i<len; i++) {
-			*i2s_txP++ = 0;
-			*i2s_txP++ = 0;
+		echo_can_bg_gate(echo_can_state, !bg_en);
+		if (!adapt_en) echo_can_adaption_mode(echo_can_state, mode);
+		echo_can_update_block(echo_can_state, txP, rxP, outP, len);
+		if (!adapt_en) echo_can_adaption_mode(echo_can_state, lec_mode);
+		audio_stats.quality.nlp_samples = echo_can_state->nlp_samples;
+#ifdef ENABLE_LEC_SPLIT
+		if (echo_can_state->bg_frames != NULL) {
+			// Run the background filter over this block on core 0
+			audio_stats.lec_bg_overruns = echo_can_state->bg_overruns;
+			xTaskNotifyGive(lec_bg_task_handle);
 		}
+#endif
+	}
+	
+#ifdef ENABLE_LEC_SUBBAND
+	if (lec_subband) {
+		subband_sup_process(&lec_sb_sup, lec_sb_tx_hi, lec_sb_rx_hi, len);
+		(void) subband_merge(&lec_sb_merge, lec_sb_out_lo, lec_sb_rx_hi, len, ec_out_buf);
+		audio_stats.lec_hi_suppressed = lec_sb_sup.suppressed;
 	}
+#endif
 }
 
 
-static void _audioPutRx(int len, int16_t* i2s_rxP)
+#ifdef ENABLE_LEC_SPLIT
+// Runs the OSLEC background filter over each block recorded by _audioLecUpdate
+static void _audioLecBgTask(void* args)
 {
-    bool mute = !audio_mux_to_tone && audio_mute_mic;
-	int i;
-	int actual_len;
-	int16_t x;             // Original [previous] sample from filter tap
-	int16_t f;             // Filter generated 2x sample (replacing the stuffed 0)
+	uint32_t start_cycles;
+	uint32_t d;
+	echo_can_state_t* ec;
 	
-	// Process the data
-	if (ext_sr_16k) {
-		// 2X Upsample using zero-stuffing:
-		//   - Insert 0's between original samples
-		//   - Low pass filter the 0's using surrounding samples using a half-band filter algorithm
-		//     (this function is always 3 samples behind called value - x contains the historical sample)
-		actual_len = 2 * len;
-		if (mute) {
-			for (i=0; i<actual_len; i += 2) {
-				resample_buf[i] = 0;
-				resample_buf[i+1] = 0;
-			}
-		} else {
-			for (i=0; i<actual_len; i += 2) {
-				f = _audioUsFilter(*i2s_rxP, &x);
-				i2s_rxP += 2;                   // Skip other channel
-				resample_buf[i] = x;
-				resample_buf[i+1] = f;
+	ESP_LOGI(TAG, "Start lec_bg_task");
+	
+	while (true) {
+		(void) ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+		
+		atomic_store(&lec_bg_busy, true);
+		ec = atomic_load(&lec_bg_ec);
+		if (ec != NULL) {
+			start_cycles = esp_cpu_get_ccount();
+			if (echo_can_bg_update(ec) != 0) {
+				d = esp_cpu_get_ccount() - start_cycles;
+				if (d > audio_stats.lec_bg_max_cycles) audio_stats.lec_bg_max_cycles = d;
 			}
 		}
+		atomic_store(&lec_bg_busy, false);
+	}
+}
+
+
+// Let lec_bg_task run a split canceller
+static void _audioLecBgAttach()
+{
+	if ((echo_can_state != NULL) && (echo_can_state->bg_frames != NULL)) {
+		atomic_store(&lec_bg_ec, echo_can_state);
+	}
+}
+
+
+// Stop lec_bg_task from running the canceller so it can be flushed, seeded or freed.  This
+// only waits (at most one block of background filtering) if it is running right now.
+static void _audioLecBgDetach()
+{
+	atomic_store(&lec_bg_ec, NULL);
+	while (atomic_load(&lec_bg_busy)) {};
+}
+#endif
+
+
+#ifdef ENABLE_LEC_BUDGET
+// Each call starts with everything running
+static void _audioInitLecBudget()
+{
+	lec_budget_level = AUDIO_LEC_BUDGET_FULL;
+	lec_budget_cut = 0;
+	lec_budget_hold = 0;
+	lec_budget_window = LEC_SAMPLES(LEC_BUDGET_WINDOW_MSEC, audio_sample_rate);
+	lec_budget_good_windows = 0;
+	lec_budget_window_good = true;
+	lec_mode = LEC_ADAPTION_MODE;
+	if ((lec_engine == AUDIO_LEC_ENGINE_OSLEC) && (echo_can_state != NULL)) {
+		// May be reused for this call
+		echo_can_adaption_mode(echo_can_state, lec_mode);
+	}
+	audio_stats.lec_budget_level = lec_budget_level;
+}
+
+
+// Compare the cost of servicing len voice samples with the time they represent
+static void _audioEvalLecBudget(uint32_t cycles, int len)
+{
+	int pct;
+	
+	if (len <= 0) return;
+	pct = (int) (((uint64_t) cycles * 100) / ((uint32_t) len * LEC_BUDGET_CYCLES_PER_SAMPLE(echo_can_rate)));
+	if (pct > audio_stats.frame_load_peak_pct) audio_stats.frame_load_peak_pct = pct;
+	if (pct >= LEC_BUDGET_LOW_PCT) lec_budget_window_good = false;
+	
+	if (lec_budget_hold > 0) {
+		lec_budget_hold -= len;
+	} else if ((pct >= LEC_BUDGET_HIGH_PCT) && (lec_budget_level < AUDIO_LEC_BUDGET_NO_NLP)) {
+		ESP_LOGW(TAG, "Frame load %d%%, shedding LEC work", pct);
+		_audioSetLecBudgetLevel(lec_budget_level + 1);
+		audio_stats.lec_budget_degrades++;
+		return;
+	}
+	
+	lec_budget_window -= len;
+	if (lec_budget_window <= 0) {
+		lec_budget_window = LEC_SAMPLES(LEC_BUDGET_WINDOW_MSEC, echo_can_rate);
+		lec_budget_good_windows = lec_budget_window_good ? lec_budget_good_windows + 1 : 0;
+		lec_budget_window_good = true;
 		
+		if ((lec_budget_good_windows >= LEC_BUDGET_RESTORE_WINDOWS) && (lec_budget_level > AUDIO_LEC_BUDGET_FULL)) {
+			ESP_LOGI(TAG, "Frame load headroom, restoring LEC work");
+			_audioSetLecBudgetLevel(lec_budget_level - 1);
+			audio_stats.lec_budget_restores++;
+		}
+	}
+}
+
+
+// Move one level up or down
+static void _audioSetLecBudgetLevel(int level)
+{
+	int cut;
+	
+	if ((level == AUDIO_LEC_BUDGET_SHORT) && (lec_budget_level < level)) {
+		// Remove the tail end of the canceller (where the echo has decayed the most)
+		cut = (echo_can_taps / LEC_BUDGET_CUT_DIV) & ~(FDAF_BLOCK - 1);
+		if ((echo_can_taps - cut) < (LEC_SAMPLES(LEC_MIN_MSEC, echo_can_rate) / lec_tap_div)) {
+			cut = (echo_can_taps - LEC_SAMPLES(LEC_MIN_MSEC, echo_can_rate) / lec_tap_div) & ~(FDAF_BLOCK - 1);
+		}
+		if ((cut > 0) && _audioLecResize(echo_can_taps - cut)) {
+			lec_budget_cut = cut;
+		}
+	} else if ((level == AUDIO_LEC_BUDGET_NO_BG) && (lec_budget_cut != 0)) {
+		if (_audioLecResize(echo_can_taps + lec_budget_cut)) {
+			lec_budget_cut = 0;
+		}
+	}
+	
+	lec_mode = (level >= AUDIO_LEC_BUDGET_NO_NLP) ? (LEC_ADAPTION_MODE & ~ECHO_CAN_USE_NLP) : LEC_ADAPTION_MODE;
+#ifdef ENABLE_LEC_RES
+	res_bypass = (level >= AUDIO_LEC_BUDGET_NO_NLP);
+#endif
+#ifdef ENABLE_NOISE_SUPPRESS
+	ns_bypass = (level >= AUDIO_LEC_BUDGET_NO_NLP);
+#endif
+	if ((lec_engine == AUDIO_LEC_ENGINE_OSLEC) && (echo_can_state != NULL)) {
+		echo_can_adaption_mode(echo_can_state, lec_mode);
+	}
+	
+	lec_budget_level = level;
+	lec_budget_hold = LEC_SAMPLES(LEC_BUDGET_HOLD_MSEC, echo_can_rate);
+	lec_budget_good_windows = 0;
+	lec_budget_window_good = true;
+	audio_stats.lec_budget_level = level;
+	if (level > audio_stats.lec_budget_max_level) audio_stats.lec_budget_max_level = level;
+	audio_stats.lec_taps = echo_can_taps;
+	ESP_LOGI(TAG, "LEC budget level %d, %d taps%s", level, echo_can_taps,
+		(level >= AUDIO_LEC_BUDGET_NO_NLP) ? ", NLP bypassed" : "");
+}
+
+
+// Recreate the canceller with a new length keeping the coefficients it has in common
+// with the old one (any new taps start at zero)
+static bool _audioLecResize(int taps)
+{
+	int old_taps = echo_can_taps;
+	
+	_audioLecGetCoeffs(lec_budget_coeffs);
+	if (taps > old_taps) {
+		memset(&lec_budget_coeffs[old_taps], 0, (taps - old_taps) * sizeof(int16_t));
+	}
+	
+	// Free the old canceller first so both don't have to fit in memory
+	_audioLecFree();
+	if (!_audioLecCreate(taps)) {
+		ESP_LOGE(TAG, "Could not create %d tap echo canceller", taps);
+		taps = old_taps;
+		if (!_audioLecCreate(taps)) return false;
+		_audioLecSetCoeffs(lec_budget_coeffs);
+		return false;
+	}
+	_audioLecSetCoeffs(lec_budget_coeffs);
+#if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
+	sample_set_config(echo_can_rate, echo_can_taps, LEC_ADAPTION_MODE);
+#endif
+	return true;
+}
+#endif
+
+
+#if defined(ENABLE_LEC_WARM_START) || defined(ENABLE_LEC_BULK_DELAY) || defined(ENABLE_LEC_BUDGET) || defined(ENABLE_LEC_WATCHDOG)
+// Coefficients are in the same format for both engines
+static void _audioLecGetCoeffs(int16_t* coeffs)
+{
+	if (lec_engine == AUDIO_LEC_ENGINE_FDAF) {
+		fdaf_get_coeffs(fdaf_state, coeffs);
 	} else {
-		actual_len = len;
-		if (mute) {
-			for (i=0; i<actual_len; i++) {
-				resample_buf[i] = 0;
-			}
+		echo_can_get_coeffs(echo_can_state, coeffs);
+	}
+}
+
+
+static void _audioLecSetCoeffs(const int16_t* coeffs)
+{
+	if (lec_engine == AUDIO_LEC_ENGINE_FDAF) {
+		fdaf_set_coeffs(fdaf_state, coeffs);
+	} else {
+#ifdef ENABLE_LEC_SPLIT
+		_audioLecBgDetach();
+		echo_can_set_coeffs(echo_can_state, coeffs);
+		_audioLecBgAttach();
+#else
+		echo_can_set_coeffs(echo_can_state, coeffs);
+#endif
+	}
+}
+#endif
+
+
+#ifdef ENABLE_LEC_WARM_START
+// Save the echo canceller coefficients if it has processed enough voice to have converged
+static void _audioSaveLecCoeffs()
+{
+	int i;
+	int16_t any = 0;
+	
+	if ((echo_can_taps != 0) && (lec_voice_samples >= LEC_SAMPLES(LEC_SAVE_MIN_MSEC, echo_can_rate))) {
+		// Save as the full configured length with the bulk delay as leading zero taps
+		memset(lec_coeff_slot, 0, (bulk_delay / lec_tap_div) * sizeof(int16_t));
+		_audioLecGetCoeffs(&lec_coeff_slot[bulk_delay / lec_tap_div]);
+		for (i=0; i<lec_cfg_taps; i++) {
+			any |= lec_coeff_slot[i];
+		}
+		
+		// Ignore a canceller that never adapted (e.g. no echo path)
+		if (any != 0) {
+			lec_coeff_taps = lec_cfg_taps;
+			lec_coeff_rate = echo_can_rate;
+#if (CONFIG_LEC_COEFF_NVRAM == true)
+			lec_coeff_dirty = true;
+#endif
 		} else {
-			for (i=0; i<actual_len; i++) {
-				resample_buf[i] = *i2s_rxP;
-				i2s_rxP += 2;                   // Skip other channel
+			lec_coeff_taps = 0;
+		}
+	}
+	lec_voice_samples = 0;
+}
+#endif
+
+
+#ifdef ENABLE_LEC_ADAPTIVE_SCALE
+// Halve the OSLEC inputs before a block in which either of them peaks at or above
+// LEC_SCALE_PEAK and run at full scale again once they have stayed under it for
+// LEC_SCALE_HOLD_MSEC
+static void _audioEvalLecScale(int len)
+{
+	int i;
+	int shift;
+	int peak = 0;
+	
+	for (i=0; i<len; i++) {
+		if (ec_tx_buf[i] > peak) peak = ec_tx_buf[i];
+		if (-ec_tx_buf[i] > peak) peak = -ec_tx_buf[i];
+		if (ec_rx_buf[i] > peak) peak = ec_rx_buf[i];
+		if (-ec_rx_buf[i] > peak) peak = -ec_rx_buf[i];
+	}
+	
+	if (peak >= LEC_SCALE_PEAK) {
+		lec_scale_hold = LEC_SAMPLES(LEC_SCALE_HOLD_MSEC, echo_can_rate);
+	} else if (lec_scale_hold > len) {
+		lec_scale_hold -= len;
+	} else {
+		lec_scale_hold = 0;
+	}
+	
+	shift = (lec_scale_hold == 0) ? 0 : 1;
+	if (shift != lec_in_shift) {
+		lec_in_shift = shift;
+		echo_can_input_shift(echo_can_state, shift);
+		audio_stats.lec_in_shift = shift;
+		audio_stats.lec_scale_changes++;
+	}
+}
+#endif
+
+
+// Start measuring how long a cold canceller takes to converge (seeded ones are already
+// converged and aren't counted)
+static void _audioInitLecConverge(bool cold)
+{
+	power_meter_init(&lec_conv_tx_meter, LEC_CONV_SHIFT);
+	power_meter_init(&lec_conv_rx_meter, LEC_CONV_SHIFT);
+	power_meter_init(&lec_conv_out_meter, LEC_CONV_SHIFT);
+	lec_conv_tx_thresh = power_meter_level_dbm0(LEC_CONV_TX_DBM0);
+	lec_conv_samples = 0;
+	lec_conv_start = 0;
+	lec_conv_hold = 0;
+	lec_conv_active = cold;
+	
+	audio_stats.lec_converge_msec = -1;
+}
+
+
+// Look for len samples of ec_rx_buf/ec_out_buf that show the canceller has converged and
+// update the ERLE for the call quality
+static void _audioEvalLecConverge(int len)
+{
+	int i;
+	int32_t rx, out;
+	int hpf_idx;
+	
+	for (i=0; i<len; i++) {
+		rx = power_meter_update(&lec_conv_rx_meter, ec_rx_buf[i]);
+		out = power_meter_update(&lec_conv_out_meter, ec_out_buf[i]);
+		if (power_meter_update(&lec_conv_tx_meter, ec_tx_buf[i]) > lec_conv_tx_thresh) {
+			lec_erle_rx_sum += rx;
+			lec_erle_out_sum += out;
+			lec_erle_recent_rx += rx - (lec_erle_recent_rx >> QUAL_ERLE_RECENT_SHIFT);
+			lec_erle_recent_out += out - (lec_erle_recent_out >> QUAL_ERLE_RECENT_SHIFT);
+			if ((int64_t) rx >= (int64_t) LEC_CONV_ERLE_RATIO * out) {
+				if (lec_conv_hold++ == 0) lec_conv_start = lec_conv_samples + i;
+			} else {
+				lec_conv_hold = 0;
+			}
+#ifdef ENABLE_LEC_WATCHDOG
+			if ((int64_t) out > (int64_t) LEC_WD_DIVERGE_RATIO * rx) {
+				lec_wd_diverge++;
+			} else {
+				lec_wd_diverge = 0;
 			}
+#endif
 		}
 	}
+	lec_conv_samples += len;
 	
-	// Finally, quickly load the processed data
-	xSemaphoreTake(rx_buf_mutex, portMAX_DELAY);
-	for (i=0; i<actual_len; i++) {
-		rx_buf[rx_buf_put++] = resample_buf[i];
-		if (rx_buf_put >= BUF_SAMPLES) rx_buf_put = 0;
+	if ((lec_erle_rx_sum != 0) && (lec_erle_out_sum != 0)) {
+		audio_stats.quality.erle_db10 = (int) (100.0f * log10f((float) lec_erle_rx_sum / (float) lec_erle_out_sum));
+	}
+	if ((lec_erle_recent_rx != 0) && (lec_erle_recent_out != 0)) {
+		audio_stats.quality.erle_recent_db10 = (int) (100.0f * log10f((float) lec_erle_recent_rx / (float) lec_erle_recent_out));
 	}
 	
-	rx_buf_count += actual_len;
-	if (rx_buf_count > BUF_SAMPLES) {
-		rx_buf_count = rx_buf_count % BUF_SAMPLES;
-#ifdef AUDIO_PRINT_BUF_INFO
-		ESP_LOGE(TAG, "RX FIFO overflow");
+	if (lec_conv_active && (lec_conv_hold >= LEC_SAMPLES(LEC_CONV_HOLD_MSEC, echo_can_rate))) {
+		lec_conv_active = false;
+		hpf_idx = lec_hpf & (PS_LEC_HPF_RX | PS_LEC_HPF_TX);
+		audio_stats.lec_converge_msec = lec_conv_start * 1000 / echo_can_rate;
+		audio_stats.lec_converge_calls[hpf_idx]++;
+		audio_stats.lec_converge_total_msec[hpf_idx] += audio_stats.lec_converge_msec;
+	}
+}
+
+
+#ifdef ENABLE_LEC_WATCHDOG
+// Each call starts without good coefficients (seeded ones are copied once they prove good)
+static void _audioInitLecWatchdog()
+{
+	lec_wd_num_taps = 0;
+	lec_wd_diverge = 0;
+	lec_wd_snap_wait = 0;
+	lec_wd_holdoff = 0;
+}
+
+
+// Called after _audioEvalLecConverge has measured len samples.  Puts back the last good
+// coefficients when the canceller has diverged, otherwise copies them while the ERLE is good.
+static void _audioEvalLecWatchdog(int len)
+{
+	bool have_taps = (lec_wd_num_taps == echo_can_taps) && (lec_wd_rate == echo_can_rate);
+	
+	if (lec_wd_snap_wait > 0) lec_wd_snap_wait -= len;
+	if (lec_wd_holdoff > 0) {
+		lec_wd_holdoff -= len;
+		lec_wd_diverge = 0;
+		return;
+	}
+	
+	if (lec_wd_diverge >= LEC_SAMPLES(LEC_WD_DIVERGE_MSEC, echo_can_rate)) {
+		if (have_taps) {
+			_audioLecSetCoeffs(lec_wd_taps);
+			audio_stats.lec_wd_rollbacks++;
+			ESP_LOGW(TAG, "LEC diverged - restored good coefficients");
+		} else {
+			memset(lec_wd_taps, 0, echo_can_taps * sizeof(int16_t));
+			_audioLecSetCoeffs(lec_wd_taps);
+			audio_stats.lec_wd_resets++;
+			ESP_LOGW(TAG, "LEC diverged - cleared coefficients");
+		}
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+		hci_snoop_trigger();
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+		preroll_trigger(PREROLL_TRIG_LEC_DIVERGE);
 #endif
+		lec_wd_diverge = 0;
+		lec_conv_hold = 0;
+		lec_wd_holdoff = LEC_SAMPLES(LEC_WD_HOLDOFF_MSEC, echo_can_rate);
+	} else if ((lec_conv_hold >= LEC_SAMPLES(LEC_WD_GOOD_MSEC, echo_can_rate)) && (lec_wd_snap_wait <= 0)) {
+		_audioLecGetCoeffs(lec_wd_taps);
+		lec_wd_num_taps = echo_can_taps;
+		lec_wd_rate = echo_can_rate;
+		lec_wd_snap_wait = LEC_SAMPLES(LEC_WD_SNAP_MSEC, echo_can_rate);
+		audio_stats.lec_wd_snapshots++;
 	}
-#ifdef AUDIO_PRINT_BUF_INFO
-	if (rx_buf_count > rx_buf_max_count) rx_buf_max_count = rx_buf_count;
+}
+#endif
+
+
+// Start the quality measurements for a new call
+static void _audioInitQuality()
+{
+	lec_erle_rx_sum = 0;
+	lec_erle_out_sum = 0;
+	lec_erle_recent_rx = 0;
+	lec_erle_recent_out = 0;
+	
+	memset(&audio_stats.quality, 0, sizeof(audio_call_quality_t));
+	qual_base.plc_events = audio_stats.plc_events;
+	qual_base.plc_samples = audio_stats.plc_samples;
+	qual_base.rx_underruns = audio_stats.rx_underruns;
+	qual_base.tx_underruns = audio_stats.tx_underruns;
+}
+
+
+// Fill in the derived quality of the call in a copy of the statistics (so the E-model
+// arithmetic is done by the caller and not in audio_task)
+static void _audioEvalQuality(audio_stats_t* s)
+{
+	audio_call_quality_t* q = &s->quality;
+	float ie, bpl, ppl, r, t, x, telr, terv, roe_re;
+	
+	q->plc_events = s->plc_events - qual_base.plc_events;
+	q->plc_samples = s->plc_samples - qual_base.plc_samples;
+	q->rx_underruns = s->rx_underruns - qual_base.rx_underruns;
+	q->tx_underruns = s->tx_underruns - qual_base.tx_underruns;
+	q->nlp_pct = (s->lec_samples == 0) ? 0 : (int) ((uint64_t) q->nlp_samples * 100 / s->lec_samples);
+	q->converge_msec = s->lec_converge_msec;
+	
+	// I2S DMA buffers in both directions, the jitter buffers, the FDAF block and the noise
+	// suppressor frame
+	q->delay_msec = (2 * I2S_DMA_BUF_COUNT * I2S_SAMPLES + s->tx_jb_target + s->rx_jb_target) * 1000 / audio_sample_rate;
+	if (s->lec_engine == AUDIO_LEC_ENGINE_FDAF) q->delay_msec += FDAF_BLOCK * 1000 / audio_sample_rate;
+	if (s->ns_level != PS_NS_LEVEL_OFF) q->delay_msec += NS_FRAME * 1000 / audio_sample_rate;
+	q->delay_msec += QUAL_BT_DELAY_MSEC + QUAL_NET_DELAY_MSEC;
+	
+	if (q->voice_samples == 0) {
+		q->r_factor = 0;
+		q->mos_x100 = 0;
+		return;
+	}
+	
+	// Effective equipment impairment (Ie-eff) with the concealed audio as random packet loss
+	ie = ext_sr_16k ? QUAL_MSBC_IE : QUAL_CVSD_IE;
+	bpl = ext_sr_16k ? QUAL_MSBC_BPL : QUAL_CVSD_BPL;
+	ppl = 100.0f * (float) q->plc_samples / (float) q->voice_samples;
+	if (ppl > 100.0f) ppl = 100.0f;
+	r = QUAL_RO - (ie + (95.0f - ie) * ppl / (ppl + bpl));
+	
+	// Delay impairment (Idd) above 100 mSec
+	t = (float) q->delay_msec;
+	if (t > 100.0f) {
+		x = log10f(t / 100.0f) / log10f(2.0f);
+		r -= 25.0f * (powf(1.0f + powf(x, 6.0f), 1.0f/6.0f) - 3.0f * powf(1.0f + powf(x / 3.0f, 6.0f), 1.0f/6.0f) + 2.0f);
+	}
+	
+	// Talker echo impairment (Idte) from the echo the far end hears once the ERLE is known
+	if (q->erle_db10 != 0) {
+		telr = QUAL_SLR_RLR_DB + ((s->lat_status == AUDIO_LAT_DONE) ? (float) s->lat_erl_db : QUAL_ERL_DB) + q->erle_db10 / 10.0f;
+		terv = telr - 40.0f * log10f((1.0f + t / 10.0f) / (1.0f + t / 150.0f)) + 6.0f * expf(-0.3f * t * t);
+		roe_re = QUAL_ROE - (80.0f + 2.5f * (terv - 14.0f));
+		r -= (roe_re / 2.0f + sqrtf(roe_re * roe_re / 4.0f + 100.0f) - 1.0f) * (1.0f - expf(-t));
+	}
+	
+	if (r < 0.0f) r = 0.0f;
+	if (r > 100.0f) r = 100.0f;
+	q->r_factor = (int) roundf(r);
+	q->mos_x100 = (int) roundf(100.0f * (1.0f + 0.035f * r + r * (r - 60.0f) * (100.0f - r) * 7.0e-6f));
+}
+
+
+#ifdef ENABLE_LEC_VAD_GATE
+static void _audioInitLecVad()
+{
+	power_meter_init(&lec_vad_tx_meter, LEC_VAD_SHIFT);
+	power_meter_init(&lec_vad_rx_meter, LEC_VAD_SHIFT);
+	lec_vad_tx_thresh = power_meter_level_dbm0(LEC_VAD_TX_DBM0);
+	lec_vad_rx_thresh = power_meter_level_dbm0(LEC_VAD_RX_DBM0);
+	lec_vad_hangover = 0;
+	
+	// Counts are per call
+	audio_stats.lec_samples = 0;
+	audio_stats.lec_gated_samples = 0;
+}
+
+
+// Return true if len samples of ec_tx_buf/ec_rx_buf may contain echo to adapt to
+static bool _audioEvalLecVad(int len)
+{
+	bool active;
+	bool rx_active = false;
+	int i;
+	
+	for (i=0; i<len; i++) {
+		if (power_meter_update(&lec_vad_tx_meter, ec_tx_buf[i]) > lec_vad_tx_thresh) {
+			lec_vad_hangover = LEC_SAMPLES(LEC_VAD_HANGOVER_MSEC, echo_can_rate);
+		} else if (lec_vad_hangover != 0) {
+			lec_vad_hangover--;
+		}
+		if (power_meter_update(&lec_vad_rx_meter, ec_rx_buf[i]) > lec_vad_rx_thresh) {
+			rx_active = true;
+		}
+	}
+	active = (lec_vad_hangover != 0) && rx_active;
+	
+	audio_stats.lec_samples += len;
+	if (!active) audio_stats.lec_gated_samples += len;
+	
+	return active;
+}
 #endif
-	xSemaphoreGive(rx_buf_mutex);
+
+
+#ifdef ENABLE_LEC_DTD
+static void _audioInitLecDtd()
+{
+	memset(lec_dtd_tx_hist, 0, sizeof(lec_dtd_tx_hist));
+	lec_dtd_hist_pos = 0;
+	lec_dtd_sub_count = 0;
+	lec_dtd_tx_peak = 0;
+	lec_dtd_rx_peak = 0;
+	lec_dtd_hangover = 0;
+	
+	// Counts are per call
+	audio_stats.lec_dtd = 0;
+	audio_stats.lec_dtd_events = 0;
+	audio_stats.lec_dtd_samples = 0;
 }
 
 
-static void _audioPushTxAlign(int len, int16_t* txP)
+// Geigel double talk detection over len samples of ec_tx_buf/ec_rx_buf.  Returns bg_en
+// unless there is near end speech, when the background filter must be gated.
+static bool _audioEvalLecDtd(int len, bool bg_en)
 {
-	// Only load TX Alignment buffer for voice
-	if (audio_mux_to_tone) return;
+	int i, j, k;
+	int sub_len = echo_can_rate / 1000;
+	int tail = echo_can_taps * lec_tap_div * 1000 / echo_can_rate + 1;
+	int16_t v, tx_max;
+	bool dt = (lec_dtd_hangover != 0);
 	
-	// Update count
-	i2s_tx_buf_count += len;
-	if (i2s_tx_buf_count > TX_ALIGN_SAMPLES) {
-		ESP_LOGE(TAG, "Tx Alignment buffer overflow");
+	if (tail > LEC_DTD_HIST_LEN) tail = LEC_DTD_HIST_LEN;
+	
+	for (i=0; i<len; i++) {
+		v = (ec_tx_buf[i] < 0) ? ((ec_tx_buf[i] == INT16_MIN) ? INT16_MAX : -ec_tx_buf[i]) : ec_tx_buf[i];
+		if (v > lec_dtd_tx_peak) lec_dtd_tx_peak = v;
+		v = (ec_rx_buf[i] < 0) ? ((ec_rx_buf[i] == INT16_MIN) ? INT16_MAX : -ec_rx_buf[i]) : ec_rx_buf[i];
+		if (v > lec_dtd_rx_peak) lec_dtd_rx_peak = v;
+		if (lec_dtd_hangover != 0) lec_dtd_hangover--;
+		
+		if (++lec_dtd_sub_count == sub_len) {
+			lec_dtd_tx_hist[lec_dtd_hist_pos] = lec_dtd_tx_peak;
+			if (++lec_dtd_hist_pos == LEC_DTD_HIST_LEN) lec_dtd_hist_pos = 0;
+			
+			// Largest far end peak that could still be echoing
+			tx_max = 0;
+			k = lec_dtd_hist_pos;
+			for (j=0; j<tail; j++) {
+				if (--k < 0) k = LEC_DTD_HIST_LEN - 1;
+				if (lec_dtd_tx_hist[k] > tx_max) tx_max = lec_dtd_tx_hist[k];
+			}
+			
+			if ((lec_dtd_rx_peak > LEC_DTD_RX_MIN) &&
+			    ((int32_t) lec_dtd_rx_peak * 32768 > (int32_t) LEC_DTD_GEIGEL * tx_max)) {
+				if (lec_dtd_hangover == 0) audio_stats.lec_dtd_events++;
+				lec_dtd_hangover = LEC_SAMPLES(LEC_DTD_HANGOVER_MSEC, echo_can_rate);
+				dt = true;
+			}
+			
+			lec_dtd_sub_count = 0;
+			lec_dtd_tx_peak = 0;
+			lec_dtd_rx_peak = 0;
+		}
 	}
-#ifdef AUDIO_PRINT_BUF_INFO
-	if (i2s_tx_buf_count > i2s_tx_buf_max_count) i2s_tx_buf_max_count = i2s_tx_buf_count;
+	
+	audio_stats.lec_dtd = (lec_dtd_hangover != 0);
+	if (dt && bg_en) {
+		audio_stats.lec_dtd_samples += len;
+		return false;
+	}
+	
+	return bg_en;
+}
 #endif
+
+
+#ifdef ENABLE_LEC_BULK_DELAY
+// Start estimating the bulk delay for a cold canceller
+static void _audioInitBulkDelay()
+{
+	int i;
 	
-	// Push data
-	while (len--) {
-		i2s_tx_align_buf[i2s_tx_buf_push++] = *txP;
-		txP += 2;
-		if (i2s_tx_buf_push == TX_ALIGN_SAMPLES) i2s_tx_buf_push = 0;
+	bulk_est_active = (echo_can_taps != 0);
+	bulk_lags = lec_cfg_taps * lec_tap_div / BULK_DECIMATE;
+	bulk_est_samples = 0;
+	bulk_dec_count = 0;
+	bulk_tx_acc = 0;
+	bulk_rx_acc = 0;
+	bulk_hist_idx = 0;
+	for (i=0; i<BULK_MAX_LAGS; i++) {
+		bulk_tx_hist[i] = 0;
+		bulk_corr[i] = 0;
 	}
+	
+#ifdef ENABLE_LATENCY_TEST
+	if (bulk_est_active && (lat_onset >= 0) && (echo_can_rate == AUDIO_SAMPLE_RATE)) {
+		// Use the measured echo path instead of estimating it during the call (only valid
+		// for an 8 kHz stream since the DMA part of the delay doesn't scale with the rate)
+		bulk_est_active = false;
+		_audioApplyBulkDelay(lat_onset - I2S_DMA_BUF_COUNT * I2S_SAMPLES - LEC_SAMPLES(BULK_MARGIN_MSEC, echo_can_rate));
+	}
+#endif
 }
 
 
-static int16_t _audioGetTxAlign()
+// Correlate len samples of decimated RX against the TX history and remove the bulk delay
+// once enough active TX has been seen
+static void _audioEvalBulkDelay(int len)
 {
-	int16_t t;
+	bool active;
+	int i, j, k;
+	int32_t level = 0;
+	float a, rx_d, sum, best;
+	
+	for (i=0; i<len; i++) {
+		level += abs(ec_tx_buf[i]);
+	}
+	active = (level / len) >= BULK_TX_MIN_LEVEL;
 	
-	t = i2s_tx_align_buf[i2s_tx_buf_pop++];
-	if (i2s_tx_buf_pop == TX_ALIGN_SAMPLES) i2s_tx_buf_pop = 0;
-	i2s_tx_buf_count -= 1;
+	for (i=0; i<len; i++) {
+		bulk_tx_acc += ec_tx_buf[i];
+		bulk_rx_acc += ec_rx_buf[i];
+		if (++bulk_dec_count == BULK_DECIMATE) {
+			// History is kept even while TX is inactive so lags stay aligned
+			if (++bulk_hist_idx == bulk_lags) bulk_hist_idx = 0;
+			bulk_tx_hist[bulk_hist_idx] = (float) bulk_tx_acc;
+			
+			if (active) {
+				rx_d = (float) bulk_rx_acc;
+				k = bulk_hist_idx;
+				for (j=0; j<bulk_lags; j++) {
+					bulk_corr[j] += rx_d * bulk_tx_hist[k];
+					if (--k < 0) k = bulk_lags - 1;
+				}
+				bulk_est_samples += BULK_DECIMATE;
+			}
+			
+			bulk_dec_count = 0;
+			bulk_tx_acc = 0;
+			bulk_rx_acc = 0;
+		}
+	}
 	
-	return t;
+	if (bulk_est_samples >= LEC_SAMPLES(BULK_EST_MSEC, echo_can_rate)) {
+		bulk_est_active = false;
+		
+		// Only use a clear peak
+		k = 0;
+		best = 0;
+		sum = 0;
+		for (j=0; j<bulk_lags; j++) {
+			a = fabsf(bulk_corr[j]);
+			sum += a;
+			if (a > best) {
+				best = a;
+				k = j;
+			}
+		}
+		if (best >= (BULK_PEAK_RATIO * sum / bulk_lags)) {
+			_audioApplyBulkDelay(k * BULK_DECIMATE - LEC_SAMPLES(BULK_MARGIN_MSEC, echo_can_rate));
+		} else {
+			ESP_LOGI(TAG, "No clear echo path for bulk delay estimate");
+		}
+	}
 }
 
 
-// Implement a very simple averaging filter
-//   From https://dobrian.github.io/cmp/topics/filters/lowpassfilter.html
-static __inline__ int16_t _audioDsFilter(int16_t s1, int16_t s2)
+#ifdef ENABLE_LEC_WARM_START
+// Return the bulk delay shown by leading taps below 1/8 of the largest coefficient
+static int _audioBulkDelayFromCoeffs(const int16_t* coeffs, int len)
 {
-	int32_t t = s1 + s2;
-	return (t/2);
+	int i;
+	int a;
+	int peak = 0;
+	
+	for (i=0; i<len; i++) {
+		a = abs(coeffs[i]);
+		if (a > peak) peak = a;
+	}
+	for (i=0; i<len; i++) {
+		if ((abs(coeffs[i]) * 8) >= peak) break;
+	}
+	
+	return i * lec_tap_div - LEC_SAMPLES(BULK_MARGIN_MSEC, echo_can_rate);
 }
+#endif
 
 
-// Implement a half-band weighted averaging filter for a zero-stuffing 2x upsampling algorithm
-//   From https://hydrogenaud.io/index.php?topic=48889.0 & https://hydrogenaud.io/index.php?topic=46157.0
-//
-// for each of the 0 entries, f(index) = 
-//   a * (X[index-0] + X[index+1]) +
-//   b * (x[index-1] + X[index+2]) +
-//   c * (X[index-2] + X[index+3])
-//
-// Input s sample is actually the [index+3] sample
-// Returns filtered value for [index] sample's subsequent 0, *i set to [index] sample
-static __inline__ int16_t _audioUsFilter(int16_t i3, int16_t* i)
+// Move d samples of pure delay out of the canceller and into the TX alignment buffer,
+// keeping the adapted part of the filter (h'[k] = h[k + d]).  A subband canceller's taps are
+// two samples apart so d is kept even and shifts its filter by d/2.
+static void _audioApplyBulkDelay(int d)
 {
-	int32_t t;
+	int taps = echo_can_taps;
+	int min_taps = LEC_SAMPLES(LEC_MIN_MSEC, echo_can_rate) / lec_tap_div;
 	
-	us_taps[5] = i3;   // Push sample at the end of the tap list
-	*i = us_taps[2];   // Value at index
+	if (d > LEC_SAMPLES(BULK_MAX_MSEC, echo_can_rate)) d = LEC_SAMPLES(BULK_MAX_MSEC, echo_can_rate);
+	if ((taps - d / lec_tap_div) < min_taps) d = (taps - min_taps) * lec_tap_div;
+	d -= d % lec_tap_div;
+	if ((taps == 0) || (d < BULK_DECIMATE)) return;
 	
-	t = coef_a * (us_taps[2] + us_taps[3]);
-	t += coef_b * (us_taps[1] + us_taps[4]);
-	t += coef_c * (us_taps[0] + us_taps[5]);
+	// Free the old canceller first so both don't have to fit in memory
+	_audioLecGetCoeffs(bulk_coeffs);
+	_audioLecFree();
+	if (!_audioLecCreate(taps - d / lec_tap_div)) {
+		ESP_LOGE(TAG, "Could not create %d tap echo canceller", taps - d / lec_tap_div);
+		d = 0;
+		if (!_audioLecCreate(taps)) return;
+	}
+	_audioLecSetCoeffs(&bulk_coeffs[d / lec_tap_div]);
+	if (d == 0) return;
+	bulk_delay += d;
 	
-	us_taps[0] = us_taps[1];
-	us_taps[1] = us_taps[2];
-	us_taps[2] = us_taps[3];
-	us_taps[3] = us_taps[4];
-	us_taps[4] = us_taps[5];
+	// Re-deliver the last d TX samples to delay the reference
+	tx_align_ring_unread(&tx_align_ring, d);
+#ifdef ENABLE_TX_PLC
+	tx_plc_ring_unread(&tx_plc_ring, d);
+#endif
 	
-	return ((t + 32768) / 65536);
+	audio_stats.lec_taps = echo_can_taps;
+	audio_stats.lec_bulk_delay = bulk_delay;
+	ESP_LOGI(TAG, "Bulk delay %d samples, echo canceller now %d taps", bulk_delay, echo_can_taps);
+#if (CONFIG_AUDIO_SAMPLE_ENABLE == true)
+	sample_set_config(echo_can_rate, echo_can_taps, LEC_ADAPTION_MODE);
+#endif
 }
+#endif
 
 
-#ifdef AUDIO_PRINT_BUF_INFO
-static void _audioPrintBufInfo()
+// Reconfigure the I2S peripheral if the requested sample rate has changed.  The codec is
+// an I2S slave clocked with a fixed MCLK multiple so it follows automatically.  Only called
+// while I2S is stopped.
+// Start the codec, resuming it if it was idled
+static void _audioCodecStart()
+{
+	int gap_msec;
+	
+	if (codec_released) {
+		// Track how long the codec is unused between streams
+		codec_released = false;
+		gap_msec = (int) ((esp_timer_get_time() - codec_stop_usec) / 1000);
+		if (gap_msec > 2*AUDIO_HAL_IDLE_MAX_MSEC) gap_msec = 2*AUDIO_HAL_IDLE_MAX_MSEC;
+		codec_gap_msec += (gap_msec - codec_gap_msec) / 4;
+	}
+	(void) audio_hal_set_power(AUDIO_HAL_POWER_ON);
+}
+
+
+// Idle or stop the codec depending on how soon it's expected to be needed again
+static void _audioCodecRelease(bool restart)
+{
+	codec_stop_usec = esp_timer_get_time();
+	if (restart) {
+		// Starting again right away with a new sample rate
+		(void) audio_hal_set_power(AUDIO_HAL_POWER_IDLE);
+	} else {
+		codec_released = true;
+		(void) audio_hal_set_power(audio_hal_select_power(codec_gap_msec));
+	}
+}
+
+
+// Returns how long the disabled task may block for notifications, stopping an idle codec
+// once it has been unused for AUDIO_HAL_IDLE_MAX_MSEC
+static TickType_t _audioCodecIdleWait()
+{
+	int idle_msec;
+	
+	if (audio_hal_get_power() != AUDIO_HAL_POWER_IDLE) {
+		return portMAX_DELAY;
+	}
+	
+	idle_msec = (int) ((esp_timer_get_time() - codec_stop_usec) / 1000);
+	if (idle_msec >= AUDIO_HAL_IDLE_MAX_MSEC) {
+		(void) audio_hal_set_power(AUDIO_HAL_POWER_OFF);
+		return portMAX_DELAY;
+	}
+	return pdMS_TO_TICKS(AUDIO_HAL_IDLE_MAX_MSEC - idle_msec) + 1;
+}
+
+
+static void _audioSetSampleRate()
 {
-	ESP_LOGI(TAG, "Maximum RX FIFO count = %d", rx_buf_max_count);
-	ESP_LOGI(TAG, "Maximum TX FIFO count = %d", tx_buf_max_count);
-	ESP_LOGI(TAG, "Maximum Alignment buffer count = %d", i2s_tx_buf_max_count);
+	if (audio_sample_rate != i2s_sample_rate) {
+		if (i2s_set_clk(I2S_NUM_0, audio_sample_rate, I2S_BITS_PER_SAMPLE_16BIT, I2S_CHAN_TYPE) == ESP_OK) {
+			ESP_LOGI(TAG, "I2S sample rate = %d", audio_sample_rate);
+			i2s_sample_rate = audio_sample_rate;
+#ifdef ENABLE_CLK_TRIM
+			(void) clk_trim_start(audio_sample_rate, I2S_MCLK_MULTIPLE);
+#endif
+		} else {
+			ESP_LOGE(TAG, "Could not set I2S sample rate to %d", audio_sample_rate);
+		}
+		(void) i2s_stop(I2S_NUM_0);
+	}
 }
+
+
+static void _audioHandleNotifications(TickType_t wait_ticks)
+{
+	uint32_t notification_value = 0;
+	
+	// Handle notifications (clear them upon reading), blocking up to wait_ticks for one
+	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, wait_ticks)) {
+		if (Notification(notification_value, AUDIO_NOTIFY_DISABLE_MASK)) {
+			if (audio_enabled != false) {
+				ESP_LOGI(TAG, "Disable stream");
+				audio_enabled = false;
+				pwr_mgmt_release(PWR_MGMT_HOLD_AUDIO);
+			}
+#ifdef ENABLE_LIVE_MODE_SWITCH
+			audio_switch_mode = AUDIO_MODE_NONE;
+#endif
+#ifdef ENABLE_AUDIO_STANDBY
+			audio_standby = false;
+#ifdef ENABLE_LIVE_MODE_SWITCH
+			audio_standby_switch = false;
+#endif
 #endif
+			// The call wasn't connected
+			atomic_store(&answer_req, false);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+			audio_ans_mach = false;
+#endif
+		}
+		
+#ifdef ENABLE_AUDIO_STANDBY
+		if (Notification(notification_value, AUDIO_NOTIFY_STANDBY_MASK)) {
+			// Only start standby from idle (it is repeated for each ring) or tone audio (an
+			// outgoing call is ringing and its audio is expected)
+			if (!audio_enabled || (audio_mux_to_tone && !audio_standby)) {
+				ESP_LOGI(TAG, "Standby");
+				_audioRequestMode(audio_standby_mode);
+				audio_standby = true;
+#ifdef ENABLE_LIVE_MODE_SWITCH
+				audio_standby_switch = (audio_switch_mode != AUDIO_MODE_NONE);
+#endif
+			}
+		}
+#endif
+		
+		if (Notification(notification_value, AUDIO_NOTIFY_EN_TONE_MASK)) {
+			_audioRequestMode(AUDIO_MODE_TONE);
+		}
+		
+		if (Notification(notification_value, AUDIO_NOTIFY_EN_VOICE_8_MASK)) {
+			_audioRequestMode(AUDIO_MODE_VOICE_8);
+		}
+		
+		if (Notification(notification_value, AUDIO_NOTIFY_EN_VOICE_16_MASK)) {
+			_audioRequestMode(AUDIO_MODE_VOICE_16);
+		}
+		
+		if (Notification(notification_value, AUDIO_NOTIFY_MUTE_MIC_MASK)) {
+			audio_mute_mic = true;
+		}
+		
+		if (Notification(notification_value, AUDIO_NOTIFY_UNMUTE_MIC_MASK)) {
+			audio_mute_mic = false;
+		}
+		
+#if (CONFIG_ANS_MACH_ENABLE == true)
+		if (Notification(notification_value, AUDIO_NOTIFY_ANS_MACH_MASK)) {
+			ESP_LOGI(TAG, "Answering machine");
+			audio_ans_mach = true;
+			resample_reset(&am_up_state);
+			resample_reset(&am_down_state);
+		}
+		
+		if (Notification(notification_value, AUDIO_NOTIFY_ANS_MACH_END_MASK)) {
+			audio_ans_mach = false;
+		}
+#endif
+	}
+}
+
+
+static int _audioCurMode()
+{
+	if (audio_mux_to_tone) {
+		return AUDIO_MODE_TONE;
+	} else {
+		return ext_sr_16k ? AUDIO_MODE_VOICE_16 : AUDIO_MODE_VOICE_8;
+	}
+}
+
+
+// True while the voice API is connected to a running voice stream
+static bool _audioVoiceActive()
+{
+#ifdef ENABLE_AUDIO_STANDBY
+	return audio_enabled && !audio_mux_to_tone && !audio_standby;
+#else
+	return audio_enabled && !audio_mux_to_tone;
+#endif
+}
+
+
+static int _audioModeSampleRate(int mode)
+{
+#ifndef ENABLE_RESAMPLED_16K
+	if ((mode == AUDIO_MODE_VOICE_16) && audio_prof.wideband) {
+		return AUDIO_SAMPLE_RATE_16K;
+	}
+#endif
+	return AUDIO_SAMPLE_RATE;   // Tones always 8k
+}
+
+
+// Start, restart or (if possible) schedule a live switch of the stream for a new mode
+static void _audioRequestMode(int mode)
+{
+#ifdef ENABLE_AUDIO_STANDBY
+	if (mode != AUDIO_MODE_TONE) {
+		audio_standby_mode = mode;
+	}
+#ifdef ENABLE_LIVE_MODE_SWITCH
+	if (audio_standby_switch) {
+		// Connected before the switch into standby happened, or standby was abandoned: the
+		// pending switch (if it's still wanted) arrives without standby
+		audio_standby_switch = false;
+		audio_standby = false;
+		if (mode == audio_switch_mode) {
+			ESP_LOGI(TAG, "Connect %s", audio_mode_names[mode]);
+			return;
+		}
+	}
+#endif
+	if (audio_standby && (mode == _audioCurMode())) {
+		// Answering: the stream and seeded LEC are already running so just connect the
+		// voice API, starting with empty buffers
+		ESP_LOGI(TAG, "Connect %s", audio_mode_names[mode]);
+		audio_standby = false;
+		answer_standby = true;
+#ifdef ENABLE_LIVE_MODE_SWITCH
+		audio_switch_mode = AUDIO_MODE_NONE;
+#endif
+		_audioInitBuffers();
+		_audioInitStream();
+		return;
+	}
+#endif
+	
+#ifdef ENABLE_LIVE_MODE_SWITCH
+	if (audio_enabled && (mode == _audioCurMode())) {
+		// Cancel any switch away from the current mode that hasn't happened yet
+		audio_switch_mode = AUDIO_MODE_NONE;
+		return;
+	}
+	if (audio_enabled && (mode == audio_switch_mode)) return;
+#else
+	if (audio_enabled && (mode == _audioCurMode())) return;
+#endif
+	
+	audio_prof_id = pwr_profile_get(&audio_prof);
+	audio_stats.pwr_profile = audio_prof_id;
+	ESP_LOGI(TAG, "Enable %s", audio_mode_names[mode]);
+#ifdef ENABLE_LIVE_MODE_SWITCH
+	if (audio_enabled && !audio_restart && (_audioModeSampleRate(mode) == i2s_sample_rate)) {
+		// Reconfigure at the end of the next TX frame without stopping I2S
+		audio_switch_mode = mode;
+		return;
+	}
+	audio_switch_mode = AUDIO_MODE_NONE;
+#endif
+	if (audio_enabled) {
+		audio_restart = true;
+	}
+	pwr_mgmt_hold(PWR_MGMT_HOLD_AUDIO);
+	audio_enabled = true;
+	_audioSetMode(mode);
+}
+
+
+// Configure the processing chain for a mode
+static void _audioSetMode(int mode)
+{
+#ifdef ENABLE_AUDIO_STANDBY
+	audio_standby = false;
+#endif
+	answer_standby = false;
+	if (mode == AUDIO_MODE_TONE) {
+		// Not answering a call
+		atomic_store(&answer_req, false);
+	}
+	
+	audio_mux_to_tone = (mode == AUDIO_MODE_TONE);
+	ext_sr_16k = (mode == AUDIO_MODE_VOICE_16);
+	audio_sample_rate = _audioModeSampleRate(mode);
+	resample_en = ext_sr_16k && (audio_sample_rate == AUDIO_SAMPLE_RATE);
+	
+	// Codec DSP blocks for this stream
+	codec_dsp = audio_mux_to_tone ? PS_CODEC_DSP_OFF : ps_get_codec_dsp();
+	(void) audio_hal_set_adc_dsp((codec_dsp == PS_CODEC_DSP_ALC) ? AUDIO_HAL_ADC_DSP_ALC : AUDIO_HAL_ADC_DSP_HPF);
+	audio_stats.codec_dsp = codec_dsp;
+	
+	if (audio_mux_to_tone) {
+		// Initialize zero DC restoration machine
+		dc_restore_init(&dc_restore_state);
+	} else {
+		// Reset the echo canceller
+		_audioInitTxAlign();
+		_audioInitLec();
+#ifdef ENABLE_VOICE_DTMF
+		_audioInitVoiceDtmf();
+#endif
+#ifdef ENABLE_CALL_PROGRESS
+		_audioInitCallProgress();
+#endif
+		
+		if (ext_sr_16k) {
+			// Reset the 2X resample filters
+			resample_reset(&resample_down_state);
+			resample_reset(&resample_up_state);
+		}
+	}
+}
+
+
+// Record the time from audioMarkOffHook to the first far end audio being played
+static void _audioEvalAnswer()
+{
+	int msec;
+	
+	if (audio_mux_to_tone || (_audioTxCount() == 0)) return;
+	
+	msec = (int) ((unsigned int) (esp_timer_get_time() / 1000) - atomic_load(&answer_mark_msec));
+	atomic_store(&answer_req, false);
+	audio_stats.answer_msec = msec;
+	audio_stats.answer_standby = answer_standby;
+	ESP_LOGI(TAG, "Answer to voice %d mSec (%s)", msec, answer_standby ? "standby" : "stream start");
+}
+
+
+// Reset the per-stream TX state before the first frame of a mode
+static void _audioInitStream()
+{
+#ifdef ENABLE_LATENCY_TEST
+	_audioLatencyAbort();
+#endif
+	deadline_armed = false;
+	pace_set_period(PACE_ID_AUDIO, (uint32_t) I2S_SAMPLES * 1000000 / i2s_sample_rate);
+#ifdef ENABLE_I2S_ADAPTIVE_READ
+	i2s_rx_recover = false;
+#endif
+#ifdef ENABLE_JITTER_BUFFER
+	_audioInitJitter();
+#endif
+#ifdef ENABLE_TX_PLC
+	(void) plc_init(&tx_plc_state);
+#endif
+}
+
+
+#ifdef ENABLE_LIVE_MODE_SWITCH
+// Switch to audio_switch_mode between TX frames while I2S and the codec keep running
+static void _audioSwitchMode()
+{
+	int mode = audio_switch_mode;
+	
+	audio_switch_mode = AUDIO_MODE_NONE;
+	
+	// Change the mux before dropping the old mode's data so its producers stop first
+	_audioSetMode(mode);
+#ifdef ENABLE_AUDIO_STANDBY
+	if (audio_standby_switch) {
+		// Switched from tone audio into standby
+		audio_standby = true;
+		audio_standby_switch = false;
+	}
+#endif
+	_audioInitBuffers();
+	_audioInitStream();
+	audio_fade_in = true;
+}
+#endif
+
+
+// Linear fade across one I2S buffer
+static void _audioFade(int16_t* buf, int len, bool fade_in)
+{
+	int i, c;
+	int g;
+	
+	for (i=0; i<len; i++) {
+		g = fade_in ? (i + 1) : (len - i);
+		for (c=0; c<I2S_CHANNELS; c++) {
+			*buf = (int16_t) (((int32_t) *buf * g) / len);
+			buf++;
+		}
+	}
+}
+
+
+static int _audioGetRx(int16_t* buf, int len)
+{
+	int i;
+	int read_len;
+	
+	read_len = audio_ring_read(&rx_ring, buf, len);
+	
+	// Fill remaining with zero if necessary
+	if (len > read_len) {
+		audio_stats.rx_underruns++;
+		for (i=read_len; i<len; i++) {
+			*(buf+i) = 0;
+		}
+	}
+	
+	return read_len;
+}
+
+
+static void _audioPutTx(int16_t* buf, int len)
+{
+	int n;
+	
+	if (audio_ring_write(&tx_ring, buf, len) != len) {
+		audio_stats.tx_overflows++;
+	}
+	n = audio_ring_count(&tx_ring);
+	if (n > audio_stats.tx_high_water) audio_stats.tx_high_water = n;
+}
+
+
+// Load i2s_tx_buf with the next frame to play
+static void _audioServiceTx()
+{
+#ifdef ENABLE_AUDIO_STANDBY
+	if (audio_standby) {
+		// Silence until the voice API is connected
+		memset(i2s_tx_buf, 0, sizeof(i2s_tx_buf));
+		return;
+	}
+#endif
+	if (atomic_load(&answer_req)) {
+		_audioEvalAnswer();
+	}
+	_audioGetTx(I2S_SAMPLES, i2s_tx_buf);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	if (audio_ans_mach && _audioVoiceActive()) {
+		_audioAnsMachTx();
+	}
+#endif
+}
+
+
+// Returns I2S_CHANNELS x sample data (L/R for 2-channel codec stream), handles 16k -> 8k conversion
+// and voice TX HPF and equalizer filtering if necessary
+static void _audioGetTx(int len, int16_t* i2s_txP)
+{
+	int i;
+	int read_len;
+	int ext_len = resample_en ? 2*len : len;   // Circular buffer samples for len I2S samples
+	int want = ext_len;                        // Circular buffer samples to consume
+	bool tx_hpf = !audio_mux_to_tone && (lec_hpf & PS_LEC_HPF_TX);
+#ifdef ENABLE_HANDSET_EQ
+	bool tx_eq = !audio_mux_to_tone && eq_active(&spk_eq);
+#else
+	bool tx_eq = false;
+#endif
+	int16_t t1;
+	uint32_t stage_start;
+	
+#ifdef ENABLE_JITTER_BUFFER
+	if (!audio_mux_to_tone) {
+		want = _audioJbTxLen(ext_len);
+		if (want == 0) {
+			// Priming
+#ifdef ENABLE_TX_PLC
+			_audioPlcTx(resample_buf, 0, ext_len);
+			if (resample_en) {
+				(void) resample_down2(&resample_down_state, resample_buf, ext_len, resample_buf);
+			}
+			for (i=0; i<len; i++) {
+				*i2s_txP++ = resample_buf[i];    // Channel 1
+#if (I2S_CHANNELS == 2)
+				*i2s_txP++ = resample_buf[i];    // Channel 2
+#endif
+			}
+#else
+			memset(i2s_txP, 0, len * I2S_FRAME_BYTES);
+#endif
+			return;
+		}
+	}
+#endif
+#ifdef ENABLE_TX_PLC
+	i2s_tx_buf_concealed = false;
+#endif
+	
+	// Get the data out of the circular buffer.  This never blocks the other end which may be
+	// incredibly constrained in time to load it (e.g. I saw nasty crashes if the Bluedroid
+	// task was held up for any time).
+#if !defined(ENABLE_TX_PLC) || (I2S_CHANNELS == 1)
+	if (!resample_en && !tx_hpf && !tx_eq && (want == len) && (atomic_load_explicit(&tone_tx_buf_remain, memory_order_relaxed) == 0)) {
+		// Nothing to process so copy directly into the I2S buffer
+		stage_start = esp_cpu_get_ccount();
+		read_len = _audioRingGetFrames(&tx_ring, i2s_txP, len);
+		_audioStatsRecord(AUDIO_STAGE_TX_GET, stage_start);
+		if (read_len < len) {
+			audio_stats.tx_underruns++;
+			memset(&i2s_txP[I2S_CHANNELS*read_len], 0, (len - read_len) * I2S_FRAME_BYTES);
+		}
+#ifdef ENABLE_JITTER_BUFFER
+		if (!audio_mux_to_tone) _audioJbTxDone(read_len, len);
+#endif
+#ifdef ENABLE_TX_PLC
+		// Mono I2S data is contiguous so it can be concealed in place
+		if (!audio_mux_to_tone) _audioPlcTx(i2s_txP, read_len, len);
+#endif
+		return;
+	}
+#endif
+	
+	stage_start = esp_cpu_get_ccount();
+	read_len = audio_ring_read(&tx_ring, resample_buf, want);
+	if ((read_len < want) && audio_mux_to_tone) {
+		read_len += _audioGetToneTxBuffer(&resample_buf[read_len], want - read_len);
+	}
+	_audioStatsRecord(AUDIO_STAGE_TX_GET, stage_start);
+	if (read_len < want) {
+		audio_stats.tx_underruns++;
+	}
+	
+	// Process the data
+	stage_start = esp_cpu_get_ccount();
+#ifdef ENABLE_JITTER_BUFFER
+	if (read_len > ext_len) {
+		read_len = _audioJbDrop(resample_buf, read_len);
+	} else if ((want < ext_len) && (read_len == want)) {
+		read_len = _audioJbInsert(resample_buf, read_len);
+	}
+	if (!audio_mux_to_tone) _audioJbTxDone(read_len, ext_len);
+#endif
+#ifdef ENABLE_TX_PLC
+	if (!audio_mux_to_tone) {
+		_audioPlcTx(resample_buf, read_len, ext_len);
+		read_len = ext_len;
+	}
+#endif
+	if (resample_en) {
+		// 2X Downsample using the half-band decimator (in-place)
+		read_len = resample_down2(&resample_down_state, resample_buf, read_len, resample_buf);
+	}
+	if (tx_hpf) {
+		biquad_process(&lec_tx_hpf, resample_buf, read_len);
+	}
+#ifdef ENABLE_HANDSET_EQ
+	if (tx_eq) {
+		eq_process(&spk_eq, resample_buf, read_len);
+	}
+#endif
+	for (i=0; i<read_len; i++) {
+		t1 = resample_buf[i];
+		*i2s_txP++ = t1;    // Channel 1
+#if (I2S_CHANNELS == 2)
+		*i2s_txP++ = t1;    // Channel 2
+#endif
+	}
+	
+	// Fill remaining with zero if necessary
+	if (read_len < len) {
+		memset(i2s_txP, 0, (len - read_len) * I2S_FRAME_BYTES);
+	}
+	_audioStatsRecord(AUDIO_STAGE_RESAMPLE, stage_start);
+}
+
+
+#if (CONFIG_ANS_MACH_ENABLE == true)
+// Replace the len samples of line audio about to be sent to the cellphone with the greeting
+static void _audioAnsMachRx(int len)
+{
+	int n = (i2s_sample_rate == AUDIO_SAMPLE_RATE) ? len : len/2;
+	
+	if (n == len) {
+		(void) ans_mach_get_play(ec_out_buf, n);
+	} else {
+		(void) ans_mach_get_play(am_buf, n);
+		(void) resample_up2(&am_up_state, am_buf, n, ec_out_buf);
+	}
+}
+
+
+// Record the caller from the frame about to be played and keep it off the (on-hook) line
+static void _audioAnsMachTx()
+{
+	int i;
+	int n = I2S_SAMPLES;
+	
+	for (i=0; i<n; i++) {
+		am_buf[i] = i2s_tx_buf[I2S_CHANNELS*i];
+	}
+	if (i2s_sample_rate != AUDIO_SAMPLE_RATE) {
+		n = resample_down2(&am_down_state, am_buf, n, am_buf);
+	}
+	ans_mach_put_record(am_buf, n);
+	memset(i2s_tx_buf, 0, sizeof(i2s_tx_buf));
+}
+#endif
+
+
+// Store len samples spaced stride apart from srcP into the RX circular buffer, handling
+// 8k -> 16k conversion and mic mute
+static void _audioPutRx(int len, const int16_t* srcP, int stride)
+{
+#ifdef ENABLE_VOICE_DTMF
+	bool mute = !audio_mux_to_tone && (audio_mute_mic || voice_dtmf_squelch);
+#else
+	bool mute = !audio_mux_to_tone && audio_mute_mic;
+#endif
+	int i;
+#ifdef ENABLE_JITTER_BUFFER
+	int adj = 0;
+#endif
+	int actual_len;
+	uint32_t stage_start;
+	
+#ifdef ENABLE_JITTER_BUFFER
+	if (!audio_mux_to_tone) {
+		adj = _audioJbRxEval(resample_en ? 2*len : len);
+		if (adj == INT_MAX) {
+			// Consumer has fallen too far behind so discard this buffer
+			return;
+		}
+	}
+#endif
+	
+	if (resample_en) {
+		// 2X Upsample using the half-band interpolator (needs contiguous single channel input)
+		stage_start = esp_cpu_get_ccount();
+		if (mute) {
+			memset(resample_mono_buf, 0, len * sizeof(int16_t));
+			srcP = resample_mono_buf;
+		} else if (stride != 1) {
+			for (i=0; i<len; i++) {
+				resample_mono_buf[i] = *srcP;
+				srcP += stride;
+			}
+			srcP = resample_mono_buf;
+		}
+		actual_len = resample_up2(&resample_up_state, srcP, len, resample_buf);
+#ifdef ENABLE_JITTER_BUFFER
+		if (adj > 0) {
+			actual_len = _audioJbDrop(resample_buf, actual_len);
+		} else if (adj < 0) {
+			actual_len = _audioJbInsert(resample_buf, actual_len);
+		}
+#endif
+		_audioStatsRecord(AUDIO_STAGE_RESAMPLE, stage_start);
+		
+		stage_start = esp_cpu_get_ccount();
+		i = audio_ring_write(&rx_ring, resample_buf, actual_len);
+#ifdef ENABLE_JITTER_BUFFER
+	} else if (adj != 0) {
+		// Gather single channel data to add or remove a sample
+		stage_start = esp_cpu_get_ccount();
+		for (i=0; i<len; i++) {
+			resample_mono_buf[i] = mute ? 0 : *srcP;
+			srcP += stride;
+		}
+		actual_len = (adj > 0) ? _audioJbDrop(resample_mono_buf, len) : _audioJbInsert(resample_mono_buf, len);
+		i = audio_ring_write(&rx_ring, resample_mono_buf, actual_len);
+#endif
+	} else {
+		// Load directly into the circular buffer in one pass
+		actual_len = len;
+		stage_start = esp_cpu_get_ccount();
+		i = _audioRingPutStrided(&rx_ring, mute ? NULL : srcP, stride, actual_len);
+	}
+	if (i != actual_len) {
+		audio_stats.rx_overflows++;
+	}
+	_audioStatsRecord(AUDIO_STAGE_RX_PUT, stage_start);
+	
+	i = audio_ring_count(&rx_ring);
+	if (i > audio_stats.rx_high_water) audio_stats.rx_high_water = i;
+}
+
+
+static void _audioPushTxAlign(int len, int16_t* txP)
+{
+#ifndef ENABLE_HW_ECHO_REF
+	uint32_t overruns;
+	int n;
+#endif
+	
+	// Only load TX Alignment buffer for voice
+	if (audio_mux_to_tone) return;
+	
+#ifdef ENABLE_TX_PLC
+	(void) tx_plc_ring_fill(&tx_plc_ring, i2s_tx_buf_concealed, len);
+#endif
+	
+#ifndef ENABLE_HW_ECHO_REF
+	// Push data (the oldest samples are overwritten if the buffer is full)
+	overruns = tx_align_ring.overruns;
+#if (I2S_CHANNELS == 1)
+	(void) tx_align_ring_write(&tx_align_ring, txP, len);
+#else
+	for (n=0; n<len; n++) {
+		i2s_tx_align_mono[n] = *txP;
+		txP += I2S_CHANNELS;
+	}
+	(void) tx_align_ring_write(&tx_align_ring, i2s_tx_align_mono, len);
+#endif
+	if (tx_align_ring.overruns != overruns) {
+		ESP_LOGE(TAG, "Tx Alignment buffer overflow");
+	}
+	
+	// High water excludes the preset
+	n = tx_align_ring_count(&tx_align_ring) - TX_ALIGN_PRESET;
+	if (n > audio_stats.tx_align_high_water) audio_stats.tx_align_high_water = n;
+#endif
+}
+
+
+#ifdef ENABLE_HW_ECHO_REF
+// Load the reference for len samples of i2s_rx_buf into the TX alignment buffer, where it is
+// read back right away unless a bulk delay has been moved into it
+static void _audioPushEchoRef(int len)
+{
+	const int16_t* srcP = &i2s_rx_buf[I2S_ECHO_REF_SLOT];
+	int i, n;
+	
+	while (len > 0) {
+		n = (len > I2S_SAMPLES) ? I2S_SAMPLES : len;
+		for (i=0; i<n; i++) {
+			i2s_tx_align_mono[i] = *srcP;
+			srcP += I2S_CHANNELS;
+		}
+		(void) tx_align_ring_write(&tx_align_ring, i2s_tx_align_mono, n);
+		len -= n;
+	}
+}
+#endif
+
+
+// Returns true if any of the samples were concealed
+static bool _audioGetTxAlignBlock(int len, int16_t* txP)
+{
+	bool concealed = false;
+#ifdef ENABLE_TX_PLC
+	bool* plcP;
+	int i, n, remain;
+#endif
+	int got;
+	
+	// Any shortfall (which shouldn't happen) is filled with silence
+	got = tx_align_ring_read(&tx_align_ring, txP, len);
+	if (got < len) {
+		memset(&txP[got], 0, (len - got) * sizeof(int16_t));
+	}
+	
+#ifdef ENABLE_TX_PLC
+	remain = got;
+	while (remain > 0) {
+		n = tx_plc_ring_read_span(&tx_plc_ring, &plcP);
+		if (n == 0) break;
+		if (n > remain) n = remain;
+		for (i=0; i<n; i++) {
+			concealed |= plcP[i];
+		}
+		tx_plc_ring_skip(&tx_plc_ring, n);
+		remain -= n;
+	}
+#endif
+	
+	return concealed;
+}
+
+
+#ifdef ENABLE_VOICE_DTMF
+// Reset the in-call DTMF detector at the start of a voice stream
+static void _audioInitVoiceDtmf()
+{
+	(void) dtmf_rx_init(&voice_dtmf_state, _audioVoiceDtmfCallback, NULL);
+	dtmf_rx_parms(&voice_dtmf_state, -1, -1, -1, VOICE_DTMF_THRESHOLD);
+	goertzel_bank_init(&voice_tone_bank, DTMF_RX_BANK_BLOCK_LEN, DTMF_RX_BANK_AMP_SHIFT);
+	(void) dtmf_rx_attach_bank(&voice_dtmf_state, &voice_tone_bank);
+	resample_init_down2(&voice_dtmf_down_state, RESAMPLE_QUALITY_LOW);
+	voice_dtmf_squelch = false;
+}
+
+
+// Run len samples of echo canceller output through the in-call DTMF detector
+static void _audioEvalVoiceDtmf(int len)
+{
+	const int16_t* srcP = ec_out_buf;
+	
+	if (audio_sample_rate == AUDIO_SAMPLE_RATE_16K) {
+		// Decimate native wideband audio (the low quality filter is sufficient for the
+		// <= 1633 Hz DTMF tones)
+		len = resample_down2(&voice_dtmf_down_state, ec_out_buf, len, voice_dtmf_buf);
+		srcP = voice_dtmf_buf;
+	}
+	(void) goertzel_bank_rx(&voice_tone_bank, srcP, len);
+	
+	// Squelch the in-band tone while a digit (or possible digit) is present
+	voice_dtmf_squelch = (dtmf_rx_status(&voice_dtmf_state) != 0);
+}
+
+
+// Called from goertzel_bank_rx (in audio_task context) with newly detected digits
+static void _audioVoiceDtmfCallback(void* user_data, const char* digits, int len)
+{
+	if (len == 0) {
+		return;
+	}
+	
+	// A Type II Caller ID acknowledgement is for pots_task, not the far end
+	if (atomic_load(&voice_dtmf_ack) && ((digits[len-1] == 'A') || (digits[len-1] == 'D'))) {
+		atomic_store(&voice_dtmf_ack, false);
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_CW_ACK_MASK, eSetBits);
+		return;
+	}
+	
+	// Digits are at least 90 mSec apart so there will only be one at a time
+	evt_bus_send_digit(EVT_QUEUE_BT, BT_EVT_DIAL_DTMF, digits[len-1]);
+}
+#endif
+
+
+#ifdef ENABLE_CALL_PROGRESS
+// Reset the far end tone detector at the start of a voice stream
+static void _audioInitCallProgress()
+{
+	call_progress_reset();
+	resample_init_down2(&cpd_down_state, RESAMPLE_QUALITY_LOW);
+}
+
+
+// Look for call progress tones in len samples of far end audio (before the mixer)
+static void _audioEvalCallProgress(const int16_t* i2s_txP, int len)
+{
+	const int16_t* srcP = cpd_in_buf;
+	int i;
+	int peak = 0;
+	int out_len = (audio_sample_rate == AUDIO_SAMPLE_RATE_16K) ? len / 2 : len;
+	
+#ifdef ENABLE_LEC_BUDGET
+	if (lec_budget_level != AUDIO_LEC_BUDGET_FULL) {
+		call_progress_skip(out_len);
+		return;
+	}
+#endif
+	
+	for (i=0; i<len; i++) {
+		cpd_in_buf[i] = i2s_txP[I2S_CHANNELS*i];
+		if (abs(cpd_in_buf[i]) > peak) peak = abs(cpd_in_buf[i]);
+	}
+	if (peak < CALL_PROGRESS_MIN_PEAK) {
+		// Too quiet to hold a tone, just keep the cadence timing
+		call_progress_skip(out_len);
+		return;
+	}
+	
+	if (audio_sample_rate == AUDIO_SAMPLE_RATE_16K) {
+		// Decimate native wideband audio (the low quality filter is sufficient for the
+		// <= 1777 Hz tones)
+		len = resample_down2(&cpd_down_state, cpd_in_buf, len, cpd_buf);
+		srcP = cpd_buf;
+	}
+	call_progress_process(srcP, len);
+}
+
+
+// Called from call_progress (in audio_task context) when a far end tone starts or stops
+static void _audioCallProgressCallback(int tone)
+{
+	if (tone != CALL_PROGRESS_NONE) {
+		evt_bus_send_digit(EVT_QUEUE_APP, APP_EVT_FAR_TONE_START, (char) tone);
+	} else {
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_FAR_TONE_END);
+	}
+}
+#endif
+
+
+// Deadline watchdog: every extra I2S buffer found waiting when RX is serviced is a period
+// in which audio_task didn't get to run in time.  Buffers found waiting are those read at
+// once or, when only one is read per event, the whole periods since the last service.
+static void _audioEvalDeadline(int len, uint32_t now_cycles)
+{
+	uint32_t gap;
+	int backlog = len / I2S_SAMPLES;
+	
+	if (deadline_armed) {
+		gap = now_cycles - deadline_last_rx_cycles;
+		if (gap > audio_stats.max_rx_gap_cycles) audio_stats.max_rx_gap_cycles = gap;
+#ifdef ENABLE_I2S_ADAPTIVE_READ
+		if ((len > 0) && ((int) (gap / I2S_PERIOD_CYCLES(i2s_sample_rate)) > backlog)) {
+			backlog = (int) (gap / I2S_PERIOD_CYCLES(i2s_sample_rate));
+		}
+#endif
+	}
+	if (len > 0) {
+		deadline_armed = true;
+		deadline_last_rx_cycles = now_cycles;
+		pace_checkin(PACE_ID_AUDIO);
+	}
+	if (len > I2S_SAMPLES) audio_stats.rx_batch_reads++;
+	if (backlog > audio_stats.rx_max_backlog) audio_stats.rx_max_backlog = backlog;
+	
+	if (backlog > 1) {
+		audio_stats.deadline_misses += backlog - 1;
+		blackbox_event(TAG, "deadline miss", backlog, audio_stats.deadline_misses);
+#if (CONFIG_SYSTRACE_ENABLE == true)
+		// Save what led up to it
+		systrace_mark(SYSTRACE_ID_MISS, true);
+		systrace_mark(SYSTRACE_ID_MISS, false);
+		systrace_trigger();
+#endif
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+		hci_snoop_trigger();
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+		preroll_trigger(PREROLL_TRIG_DEADLINE);
+#endif
+		if ((xTaskGetTickCount() - deadline_warn_tick) >= pdMS_TO_TICKS(DEADLINE_WARN_MSEC)) {
+			deadline_warn_tick = xTaskGetTickCount();
+			ESP_LOGW(TAG, "Missed I2S deadline (%u total)", audio_stats.deadline_misses);
+		}
+	}
+}
+
+
+#ifdef ENABLE_I2S_ADAPTIVE_READ
+// Number of samples to read for an RX event: one buffer unless audio_task is behind (it was
+// late for this service, more than one RX event is already queued behind this one or the
+// last read didn't empty the driver) in which case everything up to MAX_READ_NUM_SAMPLES
+static int _audioI2sReadLen(uint32_t now_cycles)
+{
+	bool behind = i2s_rx_recover;
+	
+	if (!behind && deadline_armed) {
+		behind = (now_cycles - deadline_last_rx_cycles) >= (2 * I2S_PERIOD_CYCLES(i2s_sample_rate));
+	}
+	if (!behind) {
+		// RX and TX events alternate so more than two queued means RX buffers are waiting
+		behind = uxQueueMessagesWaiting(i2s_event_queue) > 2;
+	}
+	
+	return behind ? (MAX_READ_NUM_SAMPLES * I2S_SAMPLES) : I2S_SAMPLES;
+}
+#endif
+
+
+#ifdef ENABLE_JITTER_BUFFER
+// Reset the jitter buffers at the start of a stream
+static void _audioInitJitter()
+{
+	int rate = ext_sr_16k ? AUDIO_SAMPLE_RATE_16K : AUDIO_SAMPLE_RATE;
+	
+	_audioJbInit(&tx_jb, rate);
+	_audioJbInit(&rx_jb, rate);
+	rx_jb_underruns = audio_stats.rx_underruns;
+	audio_stats.tx_jb_target = tx_jb.target;
+	audio_stats.rx_jb_target = rx_jb.target;
+#ifdef ENABLE_CLK_TRIM
+	clk_trim_reset();
+#endif
+}
+
+
+static void _audioJbInit(audio_jb_t* jbP, int rate)
+{
+	jbP->min = JB_SAMPLES(JB_MIN_MSEC, rate);
+	jbP->max = JB_SAMPLES(JB_MAX_MSEC, rate);
+	jbP->step = JB_SAMPLES(JB_STEP_MSEC, rate);
+	jbP->hyst = JB_SAMPLES(JB_HYST_MSEC, rate);
+	jbP->flush = JB_SAMPLES(JB_FLUSH_MSEC, rate);
+	jbP->target = JB_SAMPLES(JB_INIT_MSEC, rate);
+	jbP->avg = jbP->target << JB_AVG_SHIFT;
+	jbP->min_headroom = INT_MAX;
+	jbP->window = JB_WINDOW_BLOCKS;
+	jbP->primed = false;
+}
+
+
+// Track the headroom left after servicing a buffer, adapt the target to the observed jitter
+// and return 1 to remove a sample (too deep), -1 to add a sample (too shallow) or 0
+static int _audioJbEval(audio_jb_t* jbP, int headroom)
+{
+	int avg;
+	
+	if (headroom < jbP->min_headroom) jbP->min_headroom = headroom;
+	jbP->avg += headroom - (jbP->avg >> JB_AVG_SHIFT);
+	
+	// Lower the target if there was always a step of unused headroom in the last window
+	if (--jbP->window == 0) {
+		if ((jbP->min_headroom > jbP->step) && (jbP->target > jbP->min)) {
+			jbP->target -= jbP->step;
+			if (jbP->target < jbP->min) jbP->target = jbP->min;
+		}
+		jbP->min_headroom = INT_MAX;
+		jbP->window = JB_WINDOW_BLOCKS;
+	}
+	
+	avg = jbP->avg >> JB_AVG_SHIFT;
+	if (avg > (jbP->target + jbP->hyst)) return 1;
+	if (avg < (jbP->target - jbP->hyst)) return -1;
+	return 0;
+}
+
+
+// Raise the target after the buffer ran dry
+static void _audioJbRaise(audio_jb_t* jbP)
+{
+	jbP->target += jbP->step;
+	if (jbP->target > jbP->max) jbP->target = jbP->max;
+	jbP->avg = jbP->target << JB_AVG_SHIFT;
+	jbP->min_headroom = INT_MAX;
+	jbP->window = JB_WINDOW_BLOCKS;
+	audio_stats.jb_concealments++;
+}
+
+
+// Return the number of TX circular buffer samples to consume for len output samples
+// (len + 1 or len - 1 to correct drift) or 0 to play silence while priming
+static int _audioJbTxLen(int len)
+{
+	int adj;
+	int depth = audio_ring_count(&tx_ring);
+	
+	if (!tx_jb.primed) {
+		if (depth < (tx_jb.target + len)) return 0;
+		tx_jb.primed = true;
+	}
+	
+	if ((depth - len) > tx_jb.flush) {
+		// Cut back to the target after a burst
+		audio_ring_skip(&tx_ring, depth - len - tx_jb.target);
+		audio_stats.jb_concealments++;
+		depth = tx_jb.target + len;
+		tx_jb.avg = tx_jb.target << JB_AVG_SHIFT;
+#ifdef ENABLE_CLK_TRIM
+		clk_trim_reset();
+#endif
+	}
+	
+	adj = _audioJbEval(&tx_jb, depth - len);
+	if (adj != 0) audio_stats.tx_jb_adjusts++;
+	audio_stats.tx_jb_target = tx_jb.target;
+#ifdef ENABLE_CLK_TRIM
+	clk_trim_eval(len, adj, depth - len, tx_jb.target);
+#endif
+	return len + adj;
+}
+
+
+// Re-prime the TX jitter buffer with a higher target if it ran dry
+static void _audioJbTxDone(int read_len, int len)
+{
+	if (read_len < len) {
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+		// Keep the SCO traffic around an underrun in a running stream
+		if (tx_jb.primed) hci_snoop_trigger();
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+		if (tx_jb.primed) preroll_trigger(PREROLL_TRIG_UNDERRUN);
+#endif
+		_audioJbRaise(&tx_jb);
+		tx_jb.primed = false;
+		audio_stats.tx_jb_target = tx_jb.target;
+#ifdef ENABLE_CLK_TRIM
+		clk_trim_reset();
+#endif
+	}
+}
+
+
+// Return 1 to remove or -1 to add a sample to the next len RX circular buffer samples, 0
+// to store them unchanged or INT_MAX to discard them
+static int _audioJbRxEval(int len)
+{
+	int adj;
+	int depth = audio_ring_count(&rx_ring);
+	uint32_t underruns = audio_stats.rx_underruns;
+	
+	if (underruns != rx_jb_underruns) {
+		// The consumer ran dry so raise the target and pad with silence to reach it
+		rx_jb_underruns = underruns;
+		_audioJbRaise(&rx_jb);
+		if (depth < rx_jb.target) {
+			depth += _audioRingPutStrided(&rx_ring, NULL, 1, rx_jb.target - depth);
+		}
+	}
+	audio_stats.rx_jb_target = rx_jb.target;
+	
+	if (depth > rx_jb.flush) {
+		audio_stats.jb_concealments++;
+		return INT_MAX;
+	}
+	
+	adj = _audioJbEval(&rx_jb, depth);
+	if (adj != 0) audio_stats.rx_jb_adjusts++;
+	return adj;
+}
+
+
+// Remove one sample from the middle of buf, replacing its neighbour with their average
+static int _audioJbDrop(int16_t* buf, int len)
+{
+	int m = len / 2;
+	
+	if (len < 4) return len;
+	
+	buf[m] = (int16_t) (((int32_t) buf[m] + (int32_t) buf[m+1]) / 2);
+	memmove(&buf[m+1], &buf[m+2], (len - m - 2) * sizeof(int16_t));
+	return len - 1;
+}
+
+
+// Add one interpolated sample in the middle of buf (which must have room for len + 1)
+static int _audioJbInsert(int16_t* buf, int len)
+{
+	int m = len / 2;
+	
+	if (len < 4) return len;
+	
+	memmove(&buf[m+1], &buf[m], (len - m) * sizeof(int16_t));
+	buf[m] = (int16_t) (((int32_t) buf[m-1] + (int32_t) buf[m+1]) / 2);
+	return len + 1;
+}
+#endif
+
+
+#ifdef ENABLE_TX_PLC
+// Conceal the len - read_len samples missing from the end of buf (which has room for len)
+static void _audioPlcTx(int16_t* buf, int read_len, int len)
+{
+	if (read_len > 0) {
+		(void) plc_rx(&tx_plc_state, buf, read_len);
+	}
+	if (read_len < len) {
+		if (tx_plc_state.missing_samples == 0) audio_stats.plc_events++;
+		(void) plc_fillin(&tx_plc_state, buf + read_len, len - read_len);
+		audio_stats.plc_samples += len - read_len;
+		i2s_tx_buf_concealed = true;
+	}
+}
+#endif
+
+
+// Signal Bluedroid to pull an outgoing frame it was held off from by audioVoiceRxFrameReady
+// now that one is available
+static void _audioEvalVoiceRxReady()
+{
+	int len, n;
+	
+	n = atomic_load_explicit(&voice_rx_ready_pending, memory_order_acquire);
+	if (n == 0) return;
+	
+	// Signal as many of the owed frames as are available
+	len = atomic_load_explicit(&voice_rx_frame_len, memory_order_relaxed);
+	if (len > 0) {
+		if (n > (audio_ring_count(&rx_ring) / len)) n = audio_ring_count(&rx_ring) / len;
+	}
+	if (n == 0) return;
+	
+	(void) atomic_fetch_sub_explicit(&voice_rx_ready_pending, n, memory_order_relaxed);
+	audio_stats.rx_deferred_frames += n;
+	while (n--) {
+		bt_signal_voice_rx_ready();
+	}
+}
+
+
+#ifdef ENABLE_DIGITAL_GAIN
+static void _audioInitGain(audio_gain_t* gP, int gain)
+{
+	atomic_store(&gP->target, gain);
+	gP->end = gain;
+	gP->cur = gain << GAIN_RAMP_SHIFT;
+	gP->ramp = 0;
+}
+
+
+// Apply a gain to len frames of channels samples, ramping to a new target over GAIN_RAMP_MSEC
+static void _audioApplyGain(audio_gain_t* gP, int16_t* buf, int len, int channels)
+{
+	int i, j;
+	int g;
+	int32_t t;
+	int target = atomic_load(&gP->target);
+	
+	if (target != gP->end) {
+		gP->end = target;
+		gP->ramp = LEC_SAMPLES(GAIN_RAMP_MSEC, i2s_sample_rate);
+		gP->step = ((target << GAIN_RAMP_SHIFT) - gP->cur) / gP->ramp;
+	}
+	
+	if ((gP->ramp == 0) && (gP->end == GAIN_DIGITAL_UNITY)) return;
+	
+	g = gP->cur >> GAIN_RAMP_SHIFT;
+	for (i=0; i<len; i++) {
+		if (gP->ramp != 0) {
+			if (--gP->ramp == 0) {
+				gP->cur = gP->end << GAIN_RAMP_SHIFT;
+			} else {
+				gP->cur += gP->step;
+			}
+			g = gP->cur >> GAIN_RAMP_SHIFT;
+		}
+		for (j=0; j<channels; j++) {
+			t = ((int32_t) *buf * g) >> 14;
+			if (t > INT16_MAX) t = INT16_MAX;
+			if (t < INT16_MIN) t = INT16_MIN;
+			*buf++ = (int16_t) t;
+		}
+	}
+}
+#endif
+
+
+#ifdef ENABLE_TX_MIXER
+// Drop any overlay audio left when the stream stops (audio_task is the consumer)
+static void _audioInitMixer()
+{
+	for (int i=0; i<MIX_LAST_OVERLAY; i++) {
+		audio_ring_discard(&mix_ring[i]);
+	}
+#ifdef ENABLE_SIDETONE
+	sidetone_ring_discard(&sidetone_ring);
+#endif
+	resample_reset(&mix_up_state);
+	mix_up_active = false;
+}
+
+
+// Mix the overlay sources into len I2S samples from _audioGetTx with saturation
+static void _audioMixTx(int len, int16_t* i2s_txP)
+{
+	int i, c, n, s;
+	int g;
+	int g_main = atomic_load_explicit(&mix_gain[AUDIO_MIX_MAIN], memory_order_relaxed);
+	int in_len = (i2s_sample_rate == AUDIO_SAMPLE_RATE) ? len : len/2;
+	int32_t t;
+	int32_t acc[I2S_SAMPLES];
+	bool have_overlay = false;
+	int16_t* mixP;
+	
+	// Sum the overlays at 8 kHz
+	for (s=1; s<=MIX_LAST_OVERLAY; s++) {
+		n = audio_ring_read(&mix_ring[s - 1], mix_buf, in_len);
+		if (n == 0) continue;
+		
+		if (!have_overlay) {
+			memset(acc, 0, in_len * sizeof(int32_t));
+			have_overlay = true;
+		}
+		g = atomic_load_explicit(&mix_gain[s], memory_order_relaxed);
+		for (i=0; i<n; i++) {
+			acc[i] += ((int32_t) mix_buf[i] * g) >> 14;
+		}
+	}
+	
+	if (!have_overlay) {
+		if (mix_up_active) {
+			resample_reset(&mix_up_state);
+			mix_up_active = false;
+		}
+		if (g_main == (1 << 14)) return;
+		mixP = NULL;
+	} else {
+		for (i=0; i<in_len; i++) {
+			t = acc[i];
+			if (t > INT16_MAX) t = INT16_MAX;
+			if (t < INT16_MIN) t = INT16_MIN;
+			mix_buf[i] = (int16_t) t;
+		}
+		if (in_len != len) {
+			// 16 kHz stream
+			(void) resample_up2(&mix_up_state, mix_buf, in_len, mix_up_buf);
+			mix_up_active = true;
+			mixP = mix_up_buf;
+		} else {
+			mixP = mix_buf;
+		}
+	}
+	
+	// Add to the main stream
+	for (i=0; i<len; i++) {
+		t = ((int32_t) i2s_txP[I2S_CHANNELS*i] * g_main) >> 14;
+		if (mixP != NULL) t += mixP[i];
+		if (t > INT16_MAX) t = INT16_MAX;
+		if (t < INT16_MIN) t = INT16_MIN;
+		for (c=0; c<I2S_CHANNELS; c++) {
+			i2s_txP[I2S_CHANNELS*i + c] = (int16_t) t;
+		}
+	}
+}
+#endif
+
+
+#ifdef ENABLE_SIDETONE
+// Add the line signal tapped before the LEC to len I2S samples (already in the TX alignment
+// buffer) with saturation
+static void _audioMixSidetone(int len, int16_t* i2s_txP)
+{
+	int i, c, n;
+	int g = atomic_load_explicit(&mix_gain[AUDIO_MIX_SIDETONE], memory_order_relaxed);
+	int32_t t;
+	
+	if (audio_mux_to_tone || !_audioVoiceActive()) {
+		sidetone_ring_discard(&sidetone_ring);
+		return;
+	}
+	
+	// Keep the delay short after a batched RX read
+	n = sidetone_ring_count(&sidetone_ring) - SIDETONE_MAX_SAMPLES;
+	if (n > 0) sidetone_ring_skip(&sidetone_ring, n);
+	
+	n = sidetone_ring_read(&sidetone_ring, sidetone_buf, len);
+	for (i=0; i<n; i++) {
+		t = (int32_t) i2s_txP[I2S_CHANNELS*i] + (((int32_t) sidetone_buf[i] * g) >> 14);
+		if (t > INT16_MAX) t = INT16_MAX;
+		if (t < INT16_MIN) t = INT16_MIN;
+		for (c=0; c<I2S_CHANNELS; c++) {
+			i2s_txP[I2S_CHANNELS*i + c] = (int16_t) t;
+		}
+	}
+}
+#endif
+
+
+#ifdef ENABLE_LATENCY_TEST
+// Start a requested measurement just before buf is written, replace the tone audio while
+// it runs and then correlate the capture a piece at a time
+static void _audioLatencyTx(int16_t* buf, int len)
+{
+	latency_result_t r;
+	
+	if (atomic_exchange(&lat_req, false)) {
+		if (audio_mux_to_tone && (i2s_sample_rate == AUDIO_SAMPLE_RATE) && !lat_play && !lat_eval) {
+			latency_init(&lat_state, LAT_AMPLITUDE);
+			lat_play = true;
+			audio_stats.lat_status = AUDIO_LAT_RUNNING;
+			ESP_LOGI(TAG, "Start echo path measurement");
+		}
+	}
+	
+	if (lat_play) {
+		(void) latency_tx(&lat_state, buf, len, I2S_CHANNELS);
+	} else if (lat_eval) {
+		if (latency_eval(&lat_state, LAT_LAGS_PER_FRAME)) {
+			lat_eval = false;
+			if (latency_get_result(&lat_state, &r)) {
+				audio_stats.lat_status = AUDIO_LAT_DONE;
+				audio_stats.lat_delay_usec = r.delay * (1000000 / AUDIO_SAMPLE_RATE);
+				audio_stats.lat_onset = r.onset;
+				audio_stats.lat_erl_db = r.erl_db;
+				memcpy(audio_stats.lat_ir, r.ir, sizeof(audio_stats.lat_ir));
+				lat_onset = r.onset;
+				ESP_LOGI(TAG, "Echo path delay %d samples (onset %d), ERL %d dB", r.delay, r.onset, r.erl_db);
+			} else {
+				audio_stats.lat_status = AUDIO_LAT_NO_ECHO;
+				ESP_LOGI(TAG, "No clear echo path for measurement");
+			}
+		}
+	}
+}
+
+
+// Capture the returned sequence from the DC restored RX (and keep it from pots_task)
+static void _audioLatencyRx(int16_t* buf, int len)
+{
+	if (latency_rx(&lat_state, buf, len, I2S_CHANNELS)) {
+		lat_play = false;
+		lat_eval = true;
+	}
+	memset(buf, 0, len * I2S_FRAME_BYTES);
+}
+
+
+static void _audioLatencyAbort()
+{
+	if (lat_play || lat_eval) {
+		lat_play = false;
+		lat_eval = false;
+		audio_stats.lat_status = AUDIO_LAT_ABORTED;
+		ESP_LOGI(TAG, "Echo path measurement aborted");
+	}
+}
+#endif
+
+
+// Let pots_task know when tone audio needs servicing instead of having it poll
+static void _audioEvalToneWatermarks()
+{
+	if (!audio_mux_to_tone) return;
+	
+	if ((tone_tx_low_water != 0) && (_audioTxCount() < tone_tx_low_water)) {
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_AUDIO_TX_LOW_MASK, eSetBits);
+	}
+	if ((tone_rx_high_water != 0) && (audio_ring_count(&rx_ring) >= tone_rx_high_water)) {
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_AUDIO_RX_READY_MASK, eSetBits);
+	}
+}
+
+
+// Honors an audioFlushToneTx request once the next frame has been loaded: that frame (tone
+// pots_task put before the request) fades out and the rest queued before it is dropped
+static void _audioEvalToneFlush()
+{
+	if (!atomic_load_explicit(&tone_tx_flush_req, memory_order_acquire)) return;
+	atomic_store_explicit(&tone_tx_flush_req, false, memory_order_relaxed);
+	
+	if (audio_mux_to_tone) {
+		audio_ring_skip_to(&tx_ring, atomic_load_explicit(&tone_tx_flush_pos, memory_order_relaxed));
+		_audioFade(i2s_tx_buf, I2S_SAMPLES, false);
+	}
+}
+
+
+// Discard all data in the buffer - must only be called by the consumer
+// TX samples waiting to be played - may be called from either side
+static int _audioTxCount()
+{
+	return audio_ring_count(&tx_ring) + atomic_load_explicit(&tone_tx_buf_remain, memory_order_acquire);
+}
+
+
+// Copy up to len samples from the caller-owned tone buffer, returning the number copied
+static int _audioGetToneTxBuffer(int16_t* dst, int len)
+{
+	int remain = atomic_load_explicit(&tone_tx_buf_remain, memory_order_acquire);
+	
+	if (remain <= 0) return 0;
+	if (len > remain) len = remain;
+	memcpy(dst, &tone_tx_bufP[tone_tx_buf_len - remain], len * sizeof(int16_t));
+	
+	// A failed exchange means pots_task cancelled or replaced the buffer while we were reading
+	(void) atomic_compare_exchange_strong(&tone_tx_buf_remain, &remain, remain - len);
+	
+	return len;
+}
+
+
+// Add up to len samples spaced stride apart from src (or zeros if src is NULL), returning the
+// number actually added - must only be called by the producer
+static int _audioRingPutStrided(audio_ring_t* r, const int16_t* src, int stride, int len)
+{
+	int16_t* dst;
+	int i, n;
+	int total = 0;
+	
+	if (src == NULL) {
+		return audio_ring_fill(r, 0, len);
+	}
+	if (stride == 1) {
+		return audio_ring_write(r, src, len);
+	}
+	
+	// Fill up to two spans around the end of the buffer in place
+	while (len > 0) {
+		n = audio_ring_write_span(r, &dst);
+		if (n == 0) break;
+		if (n > len) n = len;
+		for (i=0; i<n; i++) {
+			*dst++ = *src;
+			src += stride;
+		}
+		audio_ring_commit(r, n);
+		total += n;
+		len -= n;
+	}
+	
+	return total;
+}
+
+
+// Read up to len samples into an I2S buffer (duplicated into both channels for stereo),
+// returning the number actually read - must only be called by the consumer
+static int _audioRingGetFrames(audio_ring_t* r, int16_t* dst, int len)
+{
+#if (I2S_CHANNELS == 1)
+	return audio_ring_read(r, dst, len);
+#else
+	int16_t* src;
+	int i, n;
+	int total = 0;
+	
+	while (len > 0) {
+		n = audio_ring_read_span(r, &src);
+		if (n == 0) break;
+		if (n > len) n = len;
+		for (i=0; i<n; i++) {
+			*dst++ = src[i];    // Channel 1
+			*dst++ = src[i];    // Channel 2
+		}
+		audio_ring_skip(r, n);
+		total += n;
+		len -= n;
+	}
+	
+	return total;
+#endif
+}
+
+
+// Add a stage execution time to the statistics
+// Returns the number of len samples spaced stride apart in buf that are at full scale
+static uint32_t _audioCountClips(const int16_t* buf, int len, int stride)
+{
+	int i;
+	uint32_t clips = 0;
+	
+	for (i=0; i<len*stride; i+=stride) {
+		if ((buf[i] >= AUDIO_CLIP_LEVEL) || (buf[i] <= -AUDIO_CLIP_LEVEL)) clips++;
+	}
+	
+	return clips;
+}
+
+
+static void _audioStatsRecord(int stage, uint32_t start_cycles)
+{
+	uint32_t d;
+	int bin = 0;
+	audio_stage_stats_t* stP = &audio_stats.stage[stage];
+	
+	d = esp_cpu_get_ccount() - start_cycles;
+	
+	stP->count++;
+	stP->total_cycles += d;
+	if (d > stP->max_cycles) stP->max_cycles = d;
+	
+	d = d >> AUDIO_STATS_HIST_SHIFT;
+	while ((d != 0) && (bin < (AUDIO_STATS_HIST_BINS-1))) {
+		d = d >> 1;
+		bin++;
+	}
+	stP->hist[bin]++;
+}
@@ -4,8 +4,8 @@
  *   - Manages 8 KHz I2S stream to codec
  *   - Provides Line Echo Cancellation (LEC) functionality
  *   - Provides 8 KHz <-> 16 KHz upsample/downsample as necessary
- *   - Provides RX/TX circular buffers plus semaphore protected access routines for tone
- *     generation and voice
+ *   - Provides RX/TX lock-free single-producer/single-consumer circular buffers and access
+ *     routines for tone generation and voice
  *
  * Copyright (c) 2023 Dan Julio
  *
@@ -42,6 +42,185 @@
 #define AUDIO_NOTIFY_EN_VOICE_16_MASK   0x00000008
 #define AUDIO_NOTIFY_MUTE_MIC_MASK      0x00000010
 #define AUDIO_NOTIFY_UNMUTE_MIC_MASK    0x00000020
+#define AUDIO_NOTIFY_STANDBY_MASK       0x00000040
+#define AUDIO_NOTIFY_ANS_MACH_MASK      0x00000080
+#define AUDIO_NOTIFY_ANS_MACH_END_MASK  0x00000100
+
+// AUDIO_NOTIFY_STANDBY_MASK starts a muted voice stream in the last call's mode while the phone
+// rings (or an outgoing call is ringing at the far end) so answering only has to connect it to
+// the voice API (with AUDIO_NOTIFY_EN_VOICE_*).  The TX mixer still plays during standby.  Any
+// other mode notification ends standby as usual.
+//
+// AUDIO_NOTIFY_ANS_MACH_MASK (sent with AUDIO_NOTIFY_EN_VOICE_*) hands the voice stream to the
+// answering machine: the greeting from ans_mach replaces the voice sent to the cellphone and
+// the caller is recorded instead of being played to the line.  It lasts until
+// AUDIO_NOTIFY_ANS_MACH_END_MASK or the audio is disabled.
+
+// Pipeline stages profiled by audio_get_stats()
+#define AUDIO_STAGE_I2S_READ            0
+#define AUDIO_STAGE_DC_RESTORE          1
+#define AUDIO_STAGE_LEC                 2
+#define AUDIO_STAGE_RESAMPLE            3
+#define AUDIO_STAGE_RX_PUT              4
+#define AUDIO_STAGE_TX_GET              5
+#define AUDIO_STAGE_BT_CB               6
+#define AUDIO_STAGE_DTMF                7
+#define AUDIO_STAGE_CPD                 8   // Far end call progress tone detection
+#define AUDIO_STAGE_FRAME               9   // All I2S TX and RX servicing for one frame
+#define AUDIO_STAGE_NS                  10  // Noise suppressor (only counted while it's enabled)
+
+#define AUDIO_NUM_STAGES                11
+
+// TX mixer sources (audioPutMixTx, audioSetMixGain)
+#define AUDIO_MIX_MAIN                  0   // Voice or tone stream selected by the current mode
+#define AUDIO_MIX_TONE                  1   // Signalling tones played over the main stream
+#define AUDIO_MIX_PROMPT                2   // Prompts and warnings played over the main stream
+#define AUDIO_MIX_SIDETONE              3   // Voice from the phone played back to it (see note 6)
+
+#define AUDIO_MIX_NUM                   4
+
+// Echo canceller engines (audioSetLecEngine)
+#define AUDIO_LEC_ENGINE_OSLEC          0
+#define AUDIO_LEC_ENGINE_FDAF           1
+
+// Number of voice path high-pass filter configurations (PS_LEC_HPF_* bit combinations)
+#define AUDIO_LEC_HPF_CONFIGS           4
+
+// Echo canceller load shedding levels (audio_stats_t lec_budget_level), each includes
+// the ones before it
+#define AUDIO_LEC_BUDGET_FULL           0   // Everything running
+#define AUDIO_LEC_BUDGET_NO_BG          1   // Adaption (OSLEC background filter) stopped
+#define AUDIO_LEC_BUDGET_SHORT          2   // Tail end of the canceller removed
+#define AUDIO_LEC_BUDGET_NO_NLP         3   // Non-linear processor bypassed
+
+// Echo path latency measurement status (audio_stats_t lat_status)
+#define AUDIO_LAT_NONE                  0   // Not run since the statistics were reset
+#define AUDIO_LAT_RUNNING               1
+#define AUDIO_LAT_DONE                  2
+#define AUDIO_LAT_NO_ECHO               3   // Ran but no clear echo came back
+#define AUDIO_LAT_ABORTED               4   // Tone audio stopped or wasn't running
+
+// Echo path impulse response taps reported (starting 4 samples before the echo onset)
+#define AUDIO_LAT_IR_LEN                32
+
+// Number of log2 execution time histogram bins per stage (bin 0 < 2048 cycles, each
+// subsequent bin doubles, the last bin holds everything longer)
+#define AUDIO_STATS_HIST_BINS           8
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t count;                         // Number of times the stage executed
+	uint32_t max_cycles;                    // Longest execution time
+	uint64_t total_cycles;                  // Sum of execution times (for average)
+	uint32_t hist[AUDIO_STATS_HIST_BINS];   // Execution time histogram
+} audio_stage_stats_t;
+
+// Quality of the current (or last) voice call.  The rating is a simplified ITU-T G.107
+// E-model on the narrowband scale using the delay through this device plus a typical
+// cellular network delay, the codec, the concealed (lost) audio and the residual echo.
+typedef struct {
+	uint32_t voice_samples;                 // Samples through the voice path
+	uint32_t plc_events;                    // TX gaps filled by packet loss concealment
+	uint32_t plc_samples;                   // TX samples synthesized
+	uint32_t rx_underruns;
+	uint32_t tx_underruns;
+	uint32_t nlp_samples;                   // Canceller output samples the NLP suppressed
+	int nlp_pct;                            // Percentage of canceller output samples the NLP suppressed
+	int erle_db10;                          // Average ERLE during far end speech (tenths of a dB, 0 until measured)
+	int erle_recent_db10;                   // ERLE over the last few seconds of far end speech
+	int converge_msec;                      // Cold canceller convergence time (-1 until converged or seeded)
+	int delay_msec;                         // Estimated mouth-to-ear delay
+	int r_factor;                           // E-model transmission rating (0 - 93)
+	int mos_x100;                           // Estimated conversational MOS * 100 (0 until there is voice)
+} audio_call_quality_t;
+
+typedef struct {
+	audio_stage_stats_t stage[AUDIO_NUM_STAGES];
+	int frame_msec;                         // I2S buffer length at 8 kHz (CONFIG_AUDIO_FRAME_MSEC)
+	int dma_buf_count;                      // I2S DMA buffers per direction
+	int dma_bufs_needed;                    // DMA buffers that would have held the largest backlog seen (0 = none seen)
+	int rx_max_backlog;                     // Most I2S RX buffers found waiting at one service
+	uint32_t rx_batch_reads;                // RX services that read more than one buffer to catch up
+	int rx_high_water;                      // Maximum samples seen in RX circular buffer
+	int tx_high_water;                      // Maximum samples seen in TX circular buffer
+	int tx_align_high_water;                // Maximum samples seen in TX alignment buffer
+	uint32_t rx_overflows;                  // RX put dropped samples (consumer too slow)
+	uint32_t rx_underruns;                  // RX get returned fewer samples than requested
+	uint32_t rx_deferred_frames;            // Outgoing SCO frames signalled by audio_task once available
+	uint32_t tx_overflows;                  // TX put dropped samples (audio_task too slow)
+	uint32_t tx_underruns;                  // TX get found fewer samples than needed
+	uint32_t i2s_rx_overflows;              // I2S driver events
+	uint32_t i2s_tx_underflows;
+	uint32_t i2s_dma_errors;
+	uint32_t deadline_misses;               // I2S buffer periods audio_task was late servicing RX
+	uint32_t max_rx_gap_cycles;             // Longest time between RX services
+	int tx_jb_target;                       // Current voice jitter buffer target depths (samples)
+	int rx_jb_target;
+	uint32_t tx_jb_adjusts;                 // Single samples added or removed to correct clock drift
+	uint32_t rx_jb_adjusts;
+	uint32_t jb_concealments;               // Silence substituted or audio discarded to re-center
+	int clk_trim_active;                    // Set while the I2S clock is trimmed to the Bluetooth clock (CONFIG_AUDIO_CLK_TRIM)
+	int clk_trim_ppm10;                     // Its offset (tenths of a ppm, positive is faster)
+	int clk_drift_ppm10;                    // Remaining drift measured in the last trim period
+	uint32_t plc_events;                    // TX gaps filled by packet loss concealment
+	uint32_t plc_samples;                   // Total TX samples synthesized
+	uint32_t rx_clips;                      // Full scale samples from the codec (line or phone)
+	uint32_t tx_clips;                      // Full scale samples written to the codec
+	uint32_t lim_frames;                    // Voice frames the mic limiter reduced the gain of
+	int lec_in_shift;                       // Current OSLEC input scaling (1 = halved for headroom)
+	uint32_t lec_scale_changes;             // Input scaling switches
+	int agc_gain_db10;                      // Mic AGC gain (tenths of a dB)
+	int agc_speech;                         // Set while the mic AGC sees near end speech
+	int ns_level;                           // Noise suppressor PS_NS_LEVEL_* this call (cost is AUDIO_STAGE_NS)
+	int eq_profile;                         // Handset equalizer PS_EQ_PROFILE_* this call
+	int codec_dsp;                          // Codec DSP offload PS_CODEC_DSP_* this stream
+	int pwr_profile;                        // Performance profile PWR_PROFILE_* this stream
+	uint32_t agc_speech_blocks;             // Blocks the mic AGC adapted in this call
+	int answer_msec;                        // Off-hook to far end audio for the last answered call (0 until measured)
+	int answer_standby;                     // Set if that call was answered from audio standby
+	int lec_engine;                         // AUDIO_LEC_ENGINE_*
+	int lec_taps;                           // Current echo canceller length
+	int lec_bulk_delay;                     // Pure delay removed from the echo canceller (samples)
+	uint32_t lec_samples;                   // Samples through the echo canceller this call
+	uint32_t lec_gated_samples;             // Samples adaption was skipped for lack of speech this call
+	int lec_dtd;                            // Set while the double talk detector sees near end speech
+	uint32_t lec_dtd_events;                // Double talk periods this call
+	uint32_t lec_dtd_samples;               // Samples adaption was frozen for double talk this call
+	int lec_hpf;                            // PS_LEC_HPF_* bits for this call
+	int lec_converge_msec;                  // Cold canceller convergence time this call (-1 until converged or seeded)
+	uint32_t lec_converge_calls[AUDIO_LEC_HPF_CONFIGS];       // Cold calls converged, indexed by PS_LEC_HPF_* bits
+	uint32_t lec_converge_total_msec[AUDIO_LEC_HPF_CONFIGS];  // Sum of their convergence times
+	audio_call_quality_t quality;           // Current (or last) voice call
+	int lec_budget_level;                   // Current AUDIO_LEC_BUDGET_* level
+	int lec_budget_max_level;               // Highest level reached
+	uint32_t lec_budget_degrades;           // Steps to a higher level because the frame budget was at risk
+	uint32_t lec_budget_restores;           // Steps back down once there was headroom again
+	int frame_load_peak_pct;                // Largest voice frame cost as a percentage of the frame period
+	int lec_split;                          // Set when the OSLEC background filter runs on core 0
+	int lec_subband;                        // Set when a 16 kHz call's canceller runs on the 0-4 kHz band
+	uint32_t lec_hi_suppressed;             // 4-8 kHz band samples its suppressor attenuated this call
+	uint32_t lec_bg_overruns;               // Blocks the core 0 background filter fell behind on
+	uint32_t lec_bg_max_cycles;             // Longest core 0 background filter run
+	uint32_t lec_wd_snapshots;              // Good LEC coefficients copied by the divergence watchdog
+	uint32_t lec_wd_rollbacks;              // Divergences fixed by putting back the good coefficients
+	uint32_t lec_wd_resets;                 // Divergences with no good copy that cleared the coefficients
+	int lat_status;                         // AUDIO_LAT_* for the last audioStartLatencyTest
+	int lat_delay_usec;                     // I2S TX write to the largest echo tap on I2S RX read
+	int lat_onset;                          // Samples (8 kHz) from TX write to the start of the echo
+	int lat_erl_db;                         // Echo return loss through the hybrid
+	int16_t lat_ir[AUDIO_LAT_IR_LEN];       // Echo path impulse response (Q15 gain per 8 kHz sample)
+} audio_stats_t;
+
+// Subset of the statistics cheap enough for other tasks to poll
+typedef struct {
+	bool enabled;                           // Audio (tone or voice) is running
+	uint32_t deadline_misses;               // As audio_stats_t
+	int lec_budget_level;                   // Current AUDIO_LEC_BUDGET_* level (shedding work above FULL)
+} audio_load_t;
 
 
 
@@ -56,13 +235,81 @@ int audioGetRxCount();   // Return the number of valid samples in the RX buffer
 // Interface for pots_task and tone generation/detection
 int audioGetToneRx(int16_t* buf, int len); /* See note */
 void audioPutToneTx(int16_t* buf, int len);
+void audioPutToneTxBuffer(const int16_t* buf, int len);  /* See note 4 */
+void audioFlushToneTx();   /* See note 7 */
+bool audioToneTxReady();   // True when tone audio is running and audioPutToneTx data will be played
+void audioSetToneWatermarks(int tx_low, int rx_high);  /* See note 2 */
+void audioMarkOffHook();   // Phone picked up to answer a call (starts the answer time measurement)
 
 
 // Interface for voice audio task
 int audioGetVoiceRx(int16_t* buf, int len);  /* See note */
 void audioPutVoiceTx(int16_t* buf, int len);
+bool audioVoiceRxFrameReady();               /* See note 3 */
 
 // Note: Get routines returns number of valid entries but fill in zeros for data not
 // present in buffer
+//
+// Note 2: While tone audio is enabled pots_task is notified with POTS_NOTIFY_AUDIO_TX_LOW_MASK
+// each time audio_task consumes TX data and leaves fewer than tx_low samples, and with
+// POTS_NOTIFY_AUDIO_RX_READY_MASK each time it stores RX data and at least rx_high samples
+// are available.  Set a value to 0 to disable its notification.
+//
+// Note 3: Returns true if at least one outgoing SCO frame (the length of the last
+// audioGetVoiceRx request) is available.  If not it returns false and audio_task calls
+// bt_signal_voice_rx_ready once the frame has been stored.
+//
+// Note 4: Queues a caller-owned buffer that audio_task plays directly, following any data already
+// in the TX buffer, without further puts.  The buffer must remain valid until audioGetTxCount()
+// returns 0 (it is dropped when audio is reconfigured).  Call with len 0 to cancel it.
+
+// TX mixer - 8 kHz audio for the AUDIO_MIX_TONE and AUDIO_MIX_PROMPT sources is mixed
+// into the main stream in either mode (see note 5).  Gain is in dB (0 = unity) and applies to
+// the source before the speaker gain.
+void audioPutMixTx(int source, const int16_t* buf, int len);
+int audioGetMixTxCount(int source);
+void audioFlushMixTx(int source);
+bool audioMixTxReady();
+void audioSetMixGain(int source, float g);
+
+// Note 5: Each overlay source must only be written by one task.  Data is dropped while audio
+// is disabled or when the source's buffer (128 mSec) is full, and any left when the stream
+// stops is discarded.  audioFlushMixTx lets the source's writer drop what it has already
+// buffered (for example to cut a prompt short) and audioMixTxReady is true once the stream is
+// running so a writer started alongside it knows when data will be kept.
+//
+// Note 6: AUDIO_MIX_SIDETONE has no audioPutMixTx data.  When CONFIG_AUDIO_SIDETONE is set
+// audio_task feeds the line signal back during voice calls at this gain (starting at
+// -CONFIG_AUDIO_SIDETONE_ATTEN_DB and limited to -6 dB), after the speaker gain.
+//
+// Note 7: Drops the tone audio put so far (including a queued audioPutToneTxBuffer) so a new
+// tone starts within one frame.  The frame playing next fades out.  Tone puts made after it
+// returns are kept.
+
+// Mic (GAIN_TYPE_MIC) and speaker gain in dB (applied digitally with a short ramp, the codec
+// gain is not changed)
+bool audioSetGain(int gain_type, float g);
+
+// Measure the echo path by playing a maximum length sequence in place of the tone audio
+// (about 400 mSec of noise) and correlating what comes back through the hybrid.  Returns
+// false if tone audio isn't running (the phone must be off-hook without a call).  Results
+// are in the statistics and a cold canceller starts with the measured bulk delay.
+bool audioStartLatencyTest();
+
+// While en is set, DTMF A and D digits the phone dials during a call are reported to pots_task
+// (POTS_NOTIFY_CW_ACK_MASK) as a Type II Caller ID acknowledgement instead of being sent to the
+// cellphone.  It clears itself after the first one.
+void audioSetDtmfAck(bool en);
+
+// Echo canceller engine used starting with the next voice call (default set by
+// CONFIG_LEC_ENGINE_FDAF)
+void audioSetLecEngine(int engine);
+
+// Pipeline statistics (always enabled, cumulative until reset)
+void audio_get_stats(audio_stats_t* stats);
+void audio_get_load(audio_load_t* load);
+void audio_reset_stats();
+void audio_print_stats();                          // Dump to the console log
+void audio_stats_record_bt_cb(uint32_t start_cycles);  // Called by Bluedroid data callbacks with esp_cpu_get_ccount() at entry
 
 #endif /* AUDIO_TASK_H */
\ No newline at end of file
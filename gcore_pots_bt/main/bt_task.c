@@ -26,22 +26,38 @@
 #include "app_task.h"
 #include "audio_task.h"
 #include "bt_task.h"
+#include "gcore_task.h"
 #include "gui_task.h"
 #include "pots_task.h"
+#include "pwr_mgmt.h"
+#include "blackbox.h"
+#include "ble_telem.h"
+#include "boot_prof.h"
+#include "evt_bus.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "esp_log.h"
 #include "esp_bt.h"
 #include "esp_bt_main.h"
 #include "esp_bt_device.h"
+#include "esp_cpu.h"
 #include "esp_gap_bt_api.h"
 #include "esp_hf_client_api.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "gain.h"
+#include "hsm.h"
 #include "nvs.h"
 #include "nvs_flash.h"
+#include "pace.h"
 #include "ps.h"
+#include "sample.h"
+#include "soft_timer.h"
+#include "stress.h"
 #include "sys_common.h"
+#include "sys_status.h"
+#include "systrace.h"
+#include "wifi_up.h"
 #include <string.h>
 
 //
@@ -51,12 +67,83 @@
 // Uncomment for state debug
 #define BT_STATE_DEBUG
 
+// Delay after a pairing succeeds before we try to connect ourselves (a connection should
+// already be under way as part of the pairing)
+#define BT_PAIR_CONNECT_MSEC 3000
+
+// Longest wait for the audio path and line interface before the first connection attempt
+#define BT_BOOT_WAIT_MSEC    5000
+
+// Maximum back-to-back state transitions evaluated for one event
+#define BT_MAX_EVAL_STEPS    4
+
+// HCI disconnect reasons that mean the link was lost rather than closed by either side
+#define BT_HCI_ERR_CONN_TIMEOUT      0x08
+#define BT_HCI_ERR_LMP_RSP_TIMEOUT   0x22
+
+// Link quality monitor
+//   Packet inter-arrival jitter is smoothed by 1/2^BT_LINK_JITTER_SHIFT per packet (RFC 3550)
+//   A period is good with less than BT_LINK_GOOD_LOSS_PCT of the packets missing and no TX ring
+//   underruns, fair below BT_LINK_FAIR_LOSS_PCT.  The RSSI delta (dB outside the controller's
+//   golden range) limits the level too: below 0 is at most fair, below BT_LINK_POOR_RSSI poor.
+#define BT_LINK_JITTER_SHIFT  4
+#define BT_LINK_GOOD_LOSS_PCT 1
+#define BT_LINK_FAIR_LOSS_PCT 5
+#define BT_LINK_POOR_RSSI     -10
+
+// Stack callback events waiting for bt_task to handle them
+#define BT_STACK_EVT_RING_LEN 16
+
+// Controller mode (dual mode for the BLE telemetry service)
+#if (CONFIG_BLE_TELEM_ENABLE == true)
+#define BT_CONTROLLER_MODE    ESP_BT_MODE_BTDM
+#else
+#define BT_CONTROLLER_MODE    ESP_BT_MODE_CLASSIC_BT
+#endif
+
 // Uncomment for full GAP event logging (including unused events)
 #define BT_GAP_EVENT_DEBUG
 
 // Uncomment for full HF event logging (including unused events
 #define BT_HF_EVENT_DEBUG
 
+// Bluetooth address in the stack callbacks' log messages
+#define BT_BDA_FMT "%02x:%02x:%02x:%02x:%02x:%02x"
+#define BT_BDA_ARGS(a) (a)[0], (a)[1], (a)[2], (a)[3], (a)[4], (a)[5]
+
+// SCO audio must use the HCI data path.  The ES8388 is wired to I2S0 and audio_task's line
+// echo canceller, resampler, jitter buffers and DTMF detection all need the voice samples, none
+// of which can see SCO audio routed by the controller over its PCM interface (which also only
+// carries CVSD, not mSBC, on the ESP32).
+#if (CONFIG_BT_HFP_AUDIO_DATA_PATH_PCM == true) || (CONFIG_BTDM_CTRL_BR_EDR_SCO_DATA_PATH_PCM == true)
+#error "CONFIG_BT_HFP_AUDIO_DATA_PATH_HCI is required"
+#endif
+
+// Trace replay task (runs at the Bluedroid BTC task priority since it stands in for it)
+#define BT_REPLAY_TASK_STACK 3072
+#define BT_REPLAY_TASK_PRIO  19
+
+// Largest recorded event replayed (the HF parameters with their string or a SCO packet)
+#define BT_REPLAY_MAX_DATA   512
+
+// Replay task notifications
+#define BT_REPLAY_NOTIFY_TIMER 0x00000001
+#define BT_REPLAY_NOTIFY_PULL  0x00000002
+
+// Stress test call task (like the replay task it stands in for the Bluedroid task)
+#define BT_STRESS_TASK_STACK 3072
+#define BT_STRESS_TASK_PRIO  19
+
+// Stress test far end - noise talk spurts (about -23 dBFS) with pauses so the echo
+// canceller both adapts and sees silence
+#define BT_STRESS_TALK_SAMPLES  12000
+#define BT_STRESS_PAUSE_SAMPLES 8000
+#define BT_STRESS_NOISE_SHIFT   19
+
+// Stress test task notifications
+#define BT_STRESS_NOTIFY_TIMER 0x00000001
+#define BT_STRESS_NOTIFY_PULL  0x00000002
+
 
 
 //
@@ -68,34 +155,136 @@ static const char* GAP_TAG = "bt_gap";  // Bluetooth stack gap callback
 static const char* HF_TAG = "bt_hf";    // Bluetooth stack handsfree callback
 
 // State
-static int bt_reconnect_count = 0;               // Counts evaluation periods up while disconnected before attempting to reconnect
 static bool bt_in_service = false;               // Set when a HF Bluetooth SLC connection exists, clear when nothing connected
 static bool bt_in_call = false;                  // Set when call active, clear when call inactive (CALL_SETUP_IND_EVT)
 static bool bt_audio_connected = false;          // Set when audio is connected, clear when there is no audio connection
+static bool bt_call_waiting = false;             // Set by a call waiting indication (CCWA) until call setup goes idle
+static uint32_t bt_chld_feat = 0;                // Phone's three-way calling (AT+CHLD) features
 static float bt_cur_mic_gain;
 static float bt_cur_spk_gain;
 
 // Pin for traditional pairing (non SSP)
 const esp_bt_pin_code_t bt_trad_pin = BLUETOOTH_PIN_ARRAY;
 
-// Notification flags - set by a notification and consumed/cleared by state evaluation
-static bool notify_bt_dial_num = false;
-static bool notify_bt_dial_oper = false;
-static bool notify_bt_answer = false;
-static bool notify_bt_hangup = false;
+// Reconnect timer - a one-shot posting an event
+static int bt_reconnect_timer;
+
+// Link quality monitor timer - periodic while connected
+static int bt_link_mon_timer;
+
+// AT command timer - waits for the response to the command in flight and then any DTMF gap
+static int bt_at_timer;
+
+// Reconnect scheduling
+static uint32_t bt_reconnect_delay_msec = BT_RECONNECT_MIN_MSEC;   // Next backoff step
+static bool bt_local_disconnect = false;         // We ended the current/last connection
+static bool bt_discoverable = false;             // Pairing is enabled
+static int64_t bt_disconnect_usec = 0;           // When the connection was lost (0 if not timing)
+
+static portMUX_TYPE bt_stats_mux = portMUX_INITIALIZER_UNLOCKED;
+static bt_reconnect_stats_t bt_reconnect_stats;
+
+// Voice link statistics - packet timing is kept in CPU cycles by the incoming audio callback
+static bt_link_stats_t bt_link_stats;
+static uint32_t bt_link_last_cycles;
+static uint32_t bt_link_min_cycles;
+static uint32_t bt_link_max_cycles;
+static uint64_t bt_link_total_cycles;
+static uint32_t bt_link_jitter_cycles;             // << BT_LINK_JITTER_SHIFT
+
+// Link quality monitor samples (bt_task) - a ring holding the latest BT_LINK_MON_SAMPLES
+static bt_link_sample_t bt_link_samples[BT_LINK_MON_SAMPLES];
+static int bt_link_sample_next = 0;
+static int bt_link_sample_count = 0;
+static uint32_t bt_link_prev_packets;
+static uint32_t bt_link_prev_tx_underruns;
+static int64_t bt_link_prev_usec;
+static audio_stats_t bt_link_audio_stats;
+
+// AT commands waiting to be sent (bt_task only)
+typedef struct {
+	int cmd;                                     // BT_AT_CMD_*
+	int arg;                                     // DTMF digit, volume (0-15) or AT+CHLD type
+} bt_at_req_t;
+
+static const char* bt_at_cmd_names[BT_AT_NUM_CMDS] = {
+	"ATA", "AT+CHUP", "ATD", "AT+BVRA=1", "AT+BVRA=0", "AT+CHLD", "AT+VTS", "AT+VGM", "AT+VGS",
+	"AT+NREC", "AT+CLCC"
+};
+
+static bt_at_req_t bt_at_queue[BT_AT_QUEUE_LEN];
+static int bt_at_head = 0;                       // Next command to send
+static int bt_at_count = 0;
+static int bt_at_in_flight = -1;                 // BT_AT_CMD_* sent, response not yet seen (-1 for none)
+static int64_t bt_at_sent_usec;
+static bt_at_stats_t bt_at_stats;
+
+// Bluetooth stack callback events.  The callbacks run in the Bluedroid task, which also runs
+// the audio data path, so they only copy the event into this ring for bt_task to handle.  The
+// string an HF event parameter points to is only valid during the callback so it is copied
+// into str and the parameter pointed there when the event is handled.
+typedef struct {
+	bool is_hf;
+	int event;
+	union {
+		esp_bt_gap_cb_param_t gap;
+		esp_hf_client_cb_param_t hf;
+	} param;
+	char str[ESP_BT_HF_NUMBER_LEN + 1];
+} bt_stack_evt_t;
+
+static bt_stack_evt_t bt_stack_evt_ring[BT_STACK_EVT_RING_LEN];
+static int bt_stack_evt_head = 0;                // Next event to handle
+static int bt_stack_evt_count = 0;
+static uint32_t bt_stack_evt_dropped = 0;        // Ring was full
+static portMUX_TYPE bt_stack_evt_mux = portMUX_INITIALIZER_UNLOCKED;
+
+#if (CONFIG_BT_TRACE_REPLAY == true)
+// Trace replay - the replay task stands in for the Bluedroid task, pushing the recorded stack
+// events and incoming audio and pulling outgoing audio when audio_task signals it's ready
+static TaskHandle_t bt_replay_task_handle;
+static StackType_t bt_replay_task_stack[BT_REPLAY_TASK_STACK];
+static StaticTask_t bt_replay_task_tcb;
+static esp_timer_handle_t bt_replay_timer;
+static uint8_t bt_replay_buf[BT_REPLAY_MAX_DATA];
+static uint8_t bt_replay_out_buf[BT_REPLAY_MAX_DATA];
+static uint32_t bt_replay_sco_len = 0;           // Length of the last incoming packet
+#endif
+
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+// Stress test - a synthetic narrowband call pushing far end audio at the eSCO rate and pulling
+// outgoing audio when audio_task signals it's ready
+static TaskHandle_t bt_stress_task_handle;
+static StackType_t bt_stress_task_stack[BT_STRESS_TASK_STACK];
+static StaticTask_t bt_stress_task_tcb;
+static esp_timer_handle_t bt_stress_timer;
+static int16_t bt_stress_buf[STRESS_SCO_SAMPLES];
+static int16_t bt_stress_out_buf[STRESS_SCO_SAMPLES];
+static uint32_t bt_stress_noise = 1;
+static int bt_stress_phase = 0;                  // Sample in the talk spurt and pause cycle
+#endif
+
+// Link power mode (bt_task only except for the statistics)
+static bt_power_stats_t bt_power_stats;
+static bool bt_pm_connected = false;             // SLC up, time is being charged to a mode
+static int64_t bt_pm_mode_usec;                  // When the current mode was entered
+static int64_t bt_pm_answer_usec = 0;            // When the answer was sent (0 when not timing)
+static bool bt_pm_answer_sniff;                  // Link was in sniff mode when answering
+static bool bt_sco_connecting = false;            // Phone or we are bringing up audio
+static int64_t bt_sco_req_usec = 0;              // When we requested audio (0 when not pending)
 
 // Phone numbers
-static char outgoing_phone_num[APP_MAX_DIALED_DIGITS+1];   // Statically allocated phone number buffer
-static char outgoing_dtmf_digit;
+static COLD_ATTR char outgoing_phone_num[APP_MAX_DIALED_DIGITS+1];   // Statically allocated phone number buffer
 
-// Bluetooth state
-static const char* bt_state_name[] = {"DISCONNECTED", "CONNECTED-IDLE", "INITIATED", "ACTIVE", "WAIT_END"};
-typedef enum {BT_DISCONNECTED, BT_CONNECTED_IDLE, BT_CALL_INITIATED, BT_CALL_ACTIVE, BT_WAIT_END} bt_stateT;
+// Bluetooth state (bt_state follows bt_hsm, BT_IN_SERVICE is the parent of the connected
+// states and never the current state)
+typedef enum {BT_DISCONNECTED, BT_CONNECTED_IDLE, BT_CALL_INITIATED, BT_CALL_ACTIVE, BT_WAIT_END, BT_IN_SERVICE} bt_stateT;
+static hsm_t bt_hsm;
 static bt_stateT bt_state = BT_DISCONNECTED;
 
 // Remote device
 static esp_bd_addr_t peer_addr;
-static char peer_bdname[ESP_BT_GAP_MAX_BDNAME_LEN + 1];
+static COLD_ATTR char peer_bdname[ESP_BT_GAP_MAX_BDNAME_LEN + 1];
 static uint8_t peer_bdname_len;
 
 #if (CONFIG_BT_SSP_ENABLED == true)
@@ -103,7 +292,22 @@ static esp_bd_addr_t ssp_pairing_addr;
 #endif
 
 static const char device_name[] = "weeBell";
-static char peer_device_name[ESP_BT_GAP_MAX_BDNAME_LEN + 1];
+static COLD_ATTR char peer_device_name[ESP_BT_GAP_MAX_BDNAME_LEN + 1];
+
+// Pairing state cache of the remembered phones.  Only reloaded after the pairings or the
+// stack's bond list may have changed.  peer_addr and peer_device_name hold the phone being
+// connected to or that is connected.
+typedef struct {
+	bool paired;
+	bool bonded;                                 // The stack has bond information for the pairing
+	esp_bd_addr_t addr;
+	char name[ESP_BT_GAP_MAX_BDNAME_LEN + 1];
+} bt_pair_t;
+
+static bt_pair_t bt_pairs[PS_BT_MAX_PAIRS];
+static bool bt_pair_cache_valid = false;
+static bool bt_pair_prune = false;               // Remove bonds of phones no longer remembered
+static int bt_pair_next = 0;                     // Pairing the next connect attempt is to
 
 
 
@@ -111,12 +315,31 @@ static char peer_device_name[ESP_BT_GAP_MAX_BDNAME_LEN + 1];
 // Forward declarations for Espressif bluetooth stack callbacks and related functions
 //
 static void _bt_gap_cb(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param);
-static bool _get_name_from_eir(uint8_t *eir, char *bdname, uint8_t *bdname_len);
 static void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param);
+static void _bt_stack_evt_push(bool is_hf, int event, const void* param, size_t len, const char* str);
+static const char** _bt_hf_evt_str(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param);
+static void _btStackEvtHandle();
+static void _btGapEvt(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param);
+static bool _get_name_from_eir(uint8_t *eir, char *bdname, uint8_t *bdname_len);
+static void _btHfEvt(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param);
 static void _bt_hf_client_audio_open(bool is_msbc);
 static void _bt_hf_client_audio_close(void);
+static void _bt_link_record_packet(uint32_t cycles, uint32_t sz);
 static uint32_t _bt_hf_client_outgoing_cb(uint8_t *p_buf, uint32_t sz);
 static void _bt_hf_client_incoming_cb(const uint8_t *buf, uint32_t sz);
+#if (CONFIG_BT_TRACE_ENABLE == true)
+static void _bt_trace_hf_evt(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param, const char* str);
+#endif
+#if (CONFIG_BT_TRACE_REPLAY == true)
+static void _bt_replay_task(void* args);
+static void _bt_replay_timer_cb(void* arg);
+static void _bt_replay_event(const sample_evt_hdr_t* hdr, int len);
+#endif
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+static void _bt_stress_task(void* args);
+static void _bt_stress_timer_cb(void* arg);
+static void _bt_stress_far_end(int16_t* buf, int len);
+#endif
 
 
 
@@ -125,11 +348,99 @@ static void _bt_hf_client_incoming_cb(const uint8_t *buf, uint32_t sz);
 //
 static bool _btStartBluetooth();
 static void _bt_cleanup_bond_info();
-static bool _bt_validate_bond_info();
+static void _btRefreshPairCache();
 static bool _bt_addr_match(uint8_t a1[], uint8_t a2[]);
-static void _btEval();
-static void _btSetState(bt_stateT s);
-static void _btHandleNotifications();
+static void _btAttemptReconnect();
+static uint32_t _btNextReconnectDelay();
+static void _btAtQueue(int cmd, int arg);
+static void _btAtSendNext();
+static void _btAtResponse(int code);
+static void _btAtFlush(bool dtmf_only);
+static void _btLinkMonStart();
+static void _btLinkMonStop();
+static void _btLinkMonSample();
+static int _btLinkQuality(int rssi_delta, uint32_t expected, uint32_t missed, uint32_t tx_underruns);
+static void _btLinkPublishStatus();
+static void _btPmStart();
+static void _btPmStop();
+static void _btPmModeChange(bool sniff);
+static void _btPmWake();
+static void _btPmAnswerStart();
+static void _btPmAnswerDone();
+static void _btScoRequest();
+static void _btScoDone(bool connected);
+static bool _btOutOfService();
+static bool _btInService();
+static bool _btInCall();
+static bool _btCallEnded();
+static void _btDisconnectedEntry(int from);
+static void _btIdleEntry(int from);
+static void _btCallInitiatedEntry(int from);
+static void _btCallActiveEntry(int from);
+static void _btCallActiveExit(int to);
+static void _btWaitEndEntry(int from);
+static void _btAnswer();
+static void _btReject();
+static void _btDialNum();
+static void _btDialOper();
+static void _btPostStateChange(int from, int to);
+static uint16_t _btHandleEvent(const evt_msg_t* evt);
+
+
+
+//
+// State machine
+//
+static const hsm_state_t bt_states[] = {
+	// name               parent          entry                   exit               timeout
+	{"DISCONNECTED",      HSM_NONE,       _btDisconnectedEntry,   NULL,              0},
+	{"CONNECTED-IDLE",    BT_IN_SERVICE,  _btIdleEntry,           NULL,              0},
+	{"INITIATED",         BT_IN_SERVICE,  _btCallInitiatedEntry,  NULL,              0},
+	{"ACTIVE",            BT_IN_SERVICE,  _btCallActiveEntry,     _btCallActiveExit, 0},
+	{"WAIT_END",          BT_IN_SERVICE,  _btWaitEndEntry,        NULL,              0},
+	{"IN_SERVICE",        HSM_NONE,       NULL,                   NULL,              0}
+};
+
+// Rows for each state are in priority order
+static const hsm_trans_t bt_trans[] = {
+	// state              event                   guard             after  next               action
+	{BT_IN_SERVICE,       HSM_EVT_ANY,            _btOutOfService,  0,     BT_DISCONNECTED,   NULL},
+	
+	// No bluetooth connection (look to see if we can try to connect to something)
+	{BT_DISCONNECTED,     HSM_EVT_ANY,            _btInService,     0,     BT_CONNECTED_IDLE, NULL},
+	{BT_DISCONNECTED,     BT_EVT_RECONNECT_TIMER, NULL,             0,     HSM_NONE,          _btAttemptReconnect},
+	
+	// Bluetooth connected, no activity (hanging up rejects an incoming, ringing, call)
+	{BT_CONNECTED_IDLE,   BT_EVT_ANSWER_CALL,     NULL,             0,     HSM_NONE,          _btAnswer},
+	{BT_CONNECTED_IDLE,   HSM_EVT_ANY,            _btInCall,        0,     BT_CALL_ACTIVE,    NULL},
+	{BT_CONNECTED_IDLE,   BT_EVT_DIAL_NUM,        NULL,             0,     BT_CALL_INITIATED, _btDialNum},
+	{BT_CONNECTED_IDLE,   BT_EVT_DIAL_OPER,       NULL,             0,     BT_CALL_INITIATED, _btDialOper},
+	{BT_CONNECTED_IDLE,   BT_EVT_HANGUP_CALL,     NULL,             0,     HSM_NONE,          _btReject},
+	
+	// Command sent to cellphone to dial a number but it hasn't yet acknowledged call in progress
+	{BT_CALL_INITIATED,   HSM_EVT_ANY,            _btInCall,        0,     BT_CALL_ACTIVE,    NULL},
+	{BT_CALL_INITIATED,   BT_EVT_HANGUP_CALL,     NULL,             0,     BT_CONNECTED_IDLE, NULL},
+	
+	// Call in progress
+	{BT_CALL_ACTIVE,      HSM_EVT_ANY,            _btCallEnded,     0,     BT_CONNECTED_IDLE, NULL},
+	{BT_CALL_ACTIVE,      BT_EVT_HANGUP_CALL,     NULL,             0,     BT_WAIT_END,       NULL},
+	
+	// Told cellphone to disconnect call, waiting for cellphone to acknowledge call is over
+	{BT_WAIT_END,         HSM_EVT_ANY,            _btCallEnded,     0,     BT_CONNECTED_IDLE, NULL}
+};
+
+static const hsm_def_t bt_hsm_def = {
+	.tag = "bt_task",
+	.states = bt_states,
+	.num_states = sizeof(bt_states) / sizeof(hsm_state_t),
+	.trans = bt_trans,
+	.num_trans = sizeof(bt_trans) / sizeof(hsm_trans_t),
+	.pre_change = NULL,
+	.post_change = _btPostStateChange,
+#ifdef BT_STATE_DEBUG
+	.log = true
+#endif
+};
 
 
 
@@ -138,48 +449,166 @@ static void _btHandleNotifications();
 //
 void bt_task(void* args)
 {
+	evt_msg_t evt;
+	
 	ESP_LOGI(TAG, "Start task");
 	
-	// Get gain values from persistent storage
-	bt_cur_mic_gain = ps_get_gain(PS_GAIN_MIC);
-	bt_cur_spk_gain = ps_get_gain(PS_GAIN_SPK);
+	bt_reconnect_timer = soft_timer_create_evt("bt_reconnect", EVT_QUEUE_BT, BT_EVT_RECONNECT_TIMER);
+	bt_link_mon_timer = soft_timer_create_evt("bt_link_mon", EVT_QUEUE_BT, BT_EVT_LINK_MON_TIMER);
+	bt_at_timer = soft_timer_create_evt("bt_at", EVT_QUEUE_BT, BT_EVT_AT_TIMER);
+	if ((bt_reconnect_timer == SOFT_TIMER_INVALID) || (bt_link_mon_timer == SOFT_TIMER_INVALID) ||
+	    (bt_at_timer == SOFT_TIMER_INVALID)) {
+		ESP_LOGE(TAG, "Create timers failed");
+	}
+	hsm_init(&bt_hsm, &bt_hsm_def, BT_DISCONNECTED, SOFT_TIMER_INVALID, 0);
 	
-	// Attempt to start the bluetooth stack
+#if (CONFIG_BT_TRACE_REPLAY == true)
+	// Recorded stack events are replayed instead of starting the bluetooth stack
+	ESP_LOGW(TAG, "Bluetooth trace replay - stack not started");
+#elif (CONFIG_STRESS_TEST_ENABLE == true)
+	// The stress test's synthetic call stands in for a phone
+	ESP_LOGW(TAG, "Stress test - stack not started");
+#else
+	// Attempt to start the bluetooth stack (app_main loads persistent storage meanwhile)
 	if (!_btStartBluetooth()) {
 		ESP_LOGE(TAG, "Bluetooth stack init failed");
 		gui_set_fatal_error("Bluetooth stack init failed");
 		vTaskDelete(NULL);
 	}
+	boot_prof_mark("bt stack");
+#endif
+	
+	// Get gain values from persistent storage
+	(void) boot_prof_wait_ready(BOOT_READY_PS, portMAX_DELAY);
+	bt_cur_mic_gain = ps_get_gain(PS_GAIN_MIC);
+	bt_cur_spk_gain = ps_get_gain(PS_GAIN_SPK);
 	
 	// Currently we only support one paired connection at a time.  The Espressif bluetooth
 	// stack stores bond information in ESP32 NVS.  To prevent any possible funny business
 	// with it thinking it can connect and us not thinking we're paired, we delete all
 	// bonds if we don't think we are paired.
+#if (CONFIG_BT_TRACE_REPLAY != true) && (CONFIG_STRESS_TEST_ENABLE != true)
 	if (!ps_get_bt_is_paired()) {
 		_bt_cleanup_bond_info();
 	}
+#endif
+	boot_prof_set_ready(BOOT_READY_BT, "bt ready");
+	
+	// A connection may immediately open the audio path or ring the phone
+	if (!boot_prof_wait_ready(BOOT_READY_AUDIO | BOOT_READY_POTS, pdMS_TO_TICKS(BT_BOOT_WAIT_MSEC))) {
+		ESP_LOGW(TAG, "Connecting before audio and the line interface are ready");
+	}
 	
-	// Preset our reconnect timer so we'll immediately try to connect if we're paired
-	bt_reconnect_count = (BT_RECONNECT_MSEC / BT_EVAL_MSEC);
+#if (CONFIG_BT_TRACE_REPLAY == true)
+	// The replay delivers the connection
+	bt_replay_task_handle = xTaskCreateStaticPinnedToCore(&_bt_replay_task, "bt_replay", BT_REPLAY_TASK_STACK, NULL, BT_REPLAY_TASK_PRIO, bt_replay_task_stack, &bt_replay_task_tcb, 0);
+#elif (CONFIG_STRESS_TEST_ENABLE == true)
+	// Start the loads and the synthetic call
+	stress_init();
+	bt_stress_task_handle = xTaskCreateStaticPinnedToCore(&_bt_stress_task, "bt_stress", BT_STRESS_TASK_STACK, NULL, BT_STRESS_TASK_PRIO, bt_stress_task_stack, &bt_stress_task_tcb, 0);
+#else
+	// Immediately try to connect if we're paired
+	soft_timer_start(bt_reconnect_timer, 0);
+#endif
 	
+	// Everything we do is in response to an event from the Bluetooth stack callbacks, another
+	// task or our reconnect timer
+	pace_declare(PACE_ID_BT, "bt", PACE_RESPONSE, PACE_BT_USEC);
 	while (true) {
-		_btHandleNotifications();
-		_btEval();
-		
-		vTaskDelay(pdMS_TO_TICKS(BT_EVAL_MSEC));
+		if (evt_bus_receive(EVT_QUEUE_BT, &evt, portMAX_DELAY)) {
+			pace_start(PACE_ID_BT);
+			
+			// Stack events are handled first (also covers a lost BT_EVT_STACK)
+			_btStackEvtHandle();
+			
+			// Then the state machine is run until it settles since an event may allow more
+			// than one transition
+			hsm_run(&bt_hsm, _btHandleEvent(&evt), BT_MAX_EVAL_STEPS);
+			
+			pace_checkin(PACE_ID_BT);
+		}
+	}
+}
+
+void bt_signal_voice_rx_ready()
+{
+#if (CONFIG_BT_TRACE_REPLAY == true)
+	xTaskNotify(bt_replay_task_handle, BT_REPLAY_NOTIFY_PULL, eSetBits);
+#elif (CONFIG_STRESS_TEST_ENABLE == true)
+	xTaskNotify(bt_stress_task_handle, BT_STRESS_NOTIFY_PULL, eSetBits);
+#else
+	esp_hf_client_outgoing_data_ready();
+#endif
+}
+
+
+void bt_get_reconnect_stats(bt_reconnect_stats_t* stats)
+{
+	portENTER_CRITICAL(&bt_stats_mux);
+	*stats = bt_reconnect_stats;
+	portEXIT_CRITICAL(&bt_stats_mux);
+}
+
+
+void bt_get_link_stats(bt_link_stats_t* stats)
+{
+	uint32_t max_cycles;
+	uint32_t jitter_cycles;
+	uint64_t total_cycles;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	*stats = bt_link_stats;
+	max_cycles = bt_link_max_cycles;
+	jitter_cycles = bt_link_jitter_cycles;
+	total_cycles = bt_link_total_cycles;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+#if (CONFIG_BT_LINK_PROFILE_ROBUST == true)
+	stats->profile = BT_LINK_PROFILE_ROBUST;
+#else
+	stats->profile = BT_LINK_PROFILE_LOW_LATENCY;
+#endif
+	if (stats->packets > 1) {
+		stats->avg_interval_usec = (uint32_t) (total_cycles / (stats->packets - 1)) / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
+	} else {
+		stats->avg_interval_usec = 0;
 	}
+	stats->max_interval_usec = max_cycles / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
+	stats->jitter_usec = (jitter_cycles >> BT_LINK_JITTER_SHIFT) / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ;
+}
+
+
+void bt_get_at_stats(bt_at_stats_t* stats)
+{
+	portENTER_CRITICAL(&bt_stats_mux);
+	*stats = bt_at_stats;
+	portEXIT_CRITICAL(&bt_stats_mux);
 }
 
-void bt_set_outgoing_number(const char* buf)
+
+void bt_get_power_stats(bt_power_stats_t* stats)
 {
-	strncpy(outgoing_phone_num, buf, APP_MAX_DIALED_DIGITS);
-	outgoing_phone_num[APP_MAX_DIALED_DIGITS] = 0;
+	portENTER_CRITICAL(&bt_stats_mux);
+	*stats = bt_power_stats;
+	portEXIT_CRITICAL(&bt_stats_mux);
 }
 
 
-void bt_set_dtmf_digit(const char d)
+int bt_get_link_samples(bt_link_sample_t* samples, int max)
 {
-	outgoing_dtmf_digit = d;
+	int i, n;
+	int first;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	n = (bt_link_sample_count < max) ? bt_link_sample_count : max;
+	first = bt_link_sample_next - n;
+	if (first < 0) first += BT_LINK_MON_SAMPLES;
+	for (i=0; i<n; i++) {
+		samples[i] = bt_link_samples[(first + i) % BT_LINK_MON_SAMPLES];
+	}
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+	return n;
 }
 
 
@@ -331,18 +760,132 @@ const char *c_inband_ring_state_str[] = {
 
 void _bt_gap_cb(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param)
 {
+	SYSTRACE_START(SYSTRACE_ID_BT_EVT);
+#if (CONFIG_BT_TRACE_ENABLE == true)
+	sample_record_event(SAMPLE_EVT_BT_GAP, event, param, sizeof(esp_bt_gap_cb_param_t));
+#endif
+	_bt_stack_evt_push(false, event, param, sizeof(esp_bt_gap_cb_param_t), NULL);
+	SYSTRACE_STOP(SYSTRACE_ID_BT_EVT);
+}
+
+
+void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param)
+{
+	const char** str;
+	
+	SYSTRACE_START(SYSTRACE_ID_BT_EVT);
+	str = _bt_hf_evt_str(event, param);
+#if (CONFIG_BT_TRACE_ENABLE == true)
+	_bt_trace_hf_evt(event, param, (str == NULL) ? NULL : *str);
+#endif
+	_bt_stack_evt_push(true, event, param, sizeof(esp_hf_client_cb_param_t), (str == NULL) ? NULL : *str);
+	SYSTRACE_STOP(SYSTRACE_ID_BT_EVT);
+}
+
+
+// Called in the Bluedroid task - copy the event and wake bt_task if the ring was empty (bt_task
+// handles everything in the ring each time it runs so it will see events added meanwhile)
+static void _bt_stack_evt_push(bool is_hf, int event, const void* param, size_t len, const char* str)
+{
+	bool wake = false;
+	bt_stack_evt_t* e;
+	
+	portENTER_CRITICAL(&bt_stack_evt_mux);
+	if (bt_stack_evt_count < BT_STACK_EVT_RING_LEN) {
+		e = &bt_stack_evt_ring[(bt_stack_evt_head + bt_stack_evt_count) % BT_STACK_EVT_RING_LEN];
+		e->is_hf = is_hf;
+		e->event = event;
+		memcpy(&e->param, param, len);
+		if (str != NULL) {
+			strlcpy(e->str, str, sizeof(e->str));
+		}
+		if (!is_hf && (event == ESP_BT_GAP_DISC_RES_EVT)) {
+			// The properties point into stack memory (we don't run discovery)
+			e->param.gap.disc_res.num_prop = 0;
+		}
+		wake = (bt_stack_evt_count++ == 0);
+	} else {
+		bt_stack_evt_dropped++;
+	}
+	portEXIT_CRITICAL(&bt_stack_evt_mux);
+	
+	if (wake) {
+		evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_STACK);
+	}
+}
+
+
+// Returns the string field of the HF events that have one
+static const char** _bt_hf_evt_str(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param)
+{
+	switch (event) {
+		case ESP_HF_CLIENT_CLIP_EVT:
+			return &param->clip.number;
+		case ESP_HF_CLIENT_CCWA_EVT:
+			return &param->ccwa.number;
+		case ESP_HF_CLIENT_CLCC_EVT:
+			return &param->clcc.number;
+		case ESP_HF_CLIENT_CNUM_EVT:
+			return &param->cnum.number;
+		case ESP_HF_CLIENT_BINP_EVT:
+			return &param->binp.number;
+		case ESP_HF_CLIENT_COPS_CURRENT_OPERATOR_EVT:
+			return &param->cops.name;
+		default:
+			return NULL;
+	}
+}
+
+
+// Handle all events in the ring.  Each is handled in place, the callbacks only reuse its slot
+// after it is released.
+static void _btStackEvtHandle()
+{
+	bt_stack_evt_t* e;
+	const char** str;
+	uint32_t dropped;
+	
+	while (true) {
+		portENTER_CRITICAL(&bt_stack_evt_mux);
+		e = (bt_stack_evt_count == 0) ? NULL : &bt_stack_evt_ring[bt_stack_evt_head];
+		dropped = bt_stack_evt_dropped;
+		bt_stack_evt_dropped = 0;
+		portEXIT_CRITICAL(&bt_stack_evt_mux);
+		
+		if (dropped != 0) {
+			ESP_LOGE(TAG, "Dropped %u stack events", dropped);
+		}
+		if (e == NULL) break;
+		
+		if (e->is_hf) {
+			str = _bt_hf_evt_str(e->event, &e->param.hf);
+			if ((str != NULL) && (*str != NULL)) {
+				*str = e->str;
+			}
+			_btHfEvt(e->event, &e->param.hf);
+		} else {
+			_btGapEvt(e->event, &e->param.gap);
+		}
+		
+		portENTER_CRITICAL(&bt_stack_evt_mux);
+		bt_stack_evt_head = (bt_stack_evt_head + 1) % BT_STACK_EVT_RING_LEN;
+		bt_stack_evt_count--;
+		portEXIT_CRITICAL(&bt_stack_evt_mux);
+	}
+}
+
+
+static void _btGapEvt(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param)
+{
+	blackbox_event(GAP_TAG, NULL, event, 0);
+	
     switch (event) {
 		case ESP_BT_GAP_AUTH_CMPL_EVT: {
 	        if (param->auth_cmpl.stat == ESP_BT_STATUS_SUCCESS) {
-	            ESP_LOGI(GAP_TAG, "authentication success: %s", param->auth_cmpl.device_name);
-	            esp_log_buffer_hex(GAP_TAG, param->auth_cmpl.bda, ESP_BD_ADDR_LEN);
+	            ESP_LOGI(GAP_TAG, "authentication success: %s " BT_BDA_FMT, param->auth_cmpl.device_name, BT_BDA_ARGS(param->auth_cmpl.bda));
 	            gui_set_new_pair_info(param->auth_cmpl.bda, (char*) param->auth_cmpl.device_name);
 	            xTaskNotify(task_handle_gui, GUI_NOTIFY_NEW_PAIR_INFO_MASK, eSetBits);
-	            
-	            // Don't immediately try to force a connection as a connection should
-	            // be under way as part of the pairing success and we don't want a race condition
-	            // that causes a failed connect
-	            bt_reconnect_count = ((BT_RECONNECT_MSEC - 3000) / BT_EVAL_MSEC);
+	            evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_AUTH_DONE);
 	        } else {
 	            ESP_LOGE(GAP_TAG, "authentication failed, status:%d", param->auth_cmpl.stat);
 	            xTaskNotify(task_handle_gui, GUI_NOTIFY_BT_AUTH_FAIL_MASK, eSetBits);
@@ -363,6 +906,24 @@ void _bt_gap_cb(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param)
  	       break;
 #endif
 
+	    case ESP_BT_GAP_ACL_DISCONN_CMPL_STAT_EVT:
+	    	ESP_LOGI(GAP_TAG, "ACL disconnect reason 0x%x " BT_BDA_FMT, param->acl_disconn_cmpl_stat.reason,
+	    	      BT_BDA_ARGS(param->acl_disconn_cmpl_stat.bda));
+	    	if ((param->acl_disconn_cmpl_stat.reason == BT_HCI_ERR_CONN_TIMEOUT) ||
+	    	    (param->acl_disconn_cmpl_stat.reason == BT_HCI_ERR_LMP_RSP_TIMEOUT)) {
+	    		evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_ACL_LINK_LOST);
+	    	}
+	    	break;
+	    
+	    case ESP_BT_GAP_READ_RSSI_DELTA_EVT:
+	    	// Picked up by the next link monitor sample
+	    	if (param->read_rssi_delta.stat == ESP_BT_STATUS_SUCCESS) {
+	    		portENTER_CRITICAL(&bt_stats_mux);
+	    		bt_link_stats.rssi_delta = param->read_rssi_delta.rssi_delta;
+	    		portEXIT_CRITICAL(&bt_stats_mux);
+	    	}
+	    	break;
+	    
 	    case ESP_BT_GAP_PIN_REQ_EVT: {
 	        ESP_LOGI(GAP_TAG, "ESP_BT_GAP_PIN_REQ_EVT min_16_digit:%d", param->pin_req.min_16_digit);
 	        if (param->pin_req.min_16_digit) {
@@ -382,8 +943,7 @@ void _bt_gap_cb(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param)
 	            if (param->disc_res.prop[i].type == ESP_BT_GAP_DEV_PROP_EIR
 	                && _get_name_from_eir(param->disc_res.prop[i].val, peer_bdname, &peer_bdname_len)){
 	                
-	                ESP_LOGI(GAP_TAG, "Discovery found target device (%s) address: ", peer_bdname);
-	                esp_log_buffer_hex(GAP_TAG, param->disc_res.bda, ESP_BD_ADDR_LEN);
+	                ESP_LOGI(GAP_TAG, "Discovery found target device (%s) address: " BT_BDA_FMT, peer_bdname, BT_BDA_ARGS(param->disc_res.bda));
 	                
 	                if (_bt_addr_match(param->disc_res.bda, peer_addr) && (strcmp(peer_bdname, peer_device_name) == 0)) {
 	                    ESP_LOGI(GAP_TAG, "Found our paired device...connecting");
@@ -413,16 +973,17 @@ void _bt_gap_cb(esp_bt_gap_cb_event_t event, esp_bt_gap_cb_param_t *param)
 	        break;
 #endif
 	
+#endif /* BT_GAP_EVENT_DEBUG */
+	    
 	    case ESP_BT_GAP_MODE_CHG_EVT:
 	        ESP_LOGI(GAP_TAG, "ESP_BT_GAP_MODE_CHG_EVT mode:%d", param->mode_chg.mode);
+	        _btPmModeChange(param->mode_chg.mode == ESP_BT_PM_MD_SNIFF);
 	        break;
 	    
 	    case ESP_BT_GAP_REMOVE_BOND_DEV_COMPLETE_EVT:
-	    	ESP_LOGI(GAP_TAG, "ESP_BT_GAP_REMOVE_BOND_DEV_COMPLETE_EVT status:%d", param->remove_bond_dev_cmpl.status);
-	    	esp_log_buffer_hex(GAP_TAG, param->remove_bond_dev_cmpl.bda, ESP_BD_ADDR_LEN);
-	    	
+	    	ESP_LOGI(GAP_TAG, "ESP_BT_GAP_REMOVE_BOND_DEV_COMPLETE_EVT status:%d " BT_BDA_FMT, param->remove_bond_dev_cmpl.status, BT_BDA_ARGS(param->remove_bond_dev_cmpl.bda));
+	    	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_BOND_REMOVED);
 	    	break;
-#endif /* BT_GAP_EVENT_DEBUG */
 
 	    default: {
 #ifdef BT_GAP_EVENT_DEBUG
@@ -467,19 +1028,24 @@ static bool _get_name_from_eir(uint8_t *eir, char *bdname, uint8_t *bdname_len)
 }
 
 
-void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param)
+static void _btHfEvt(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param)
 {
     if (event <= ESP_HF_CLIENT_RING_IND_EVT) {
         ESP_LOGI(HF_TAG, "APP HFP event: %s", c_hf_evt_str[event]);
+        blackbox_event(HF_TAG, c_hf_evt_str[event], event, 0);
     } else {
         ESP_LOGE(HF_TAG, "APP HFP invalid event %d", event);
+        blackbox_event(HF_TAG, NULL, event, 0);
     }
 
     switch (event) {
     	case ESP_HF_CLIENT_RING_IND_EVT:
     	{
-    		xTaskNotify(task_handle_app, APP_NOTIFY_BT_RING_MASK, eSetBits);
+    		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_RING);
     		xTaskNotify(task_handle_pots, POTS_NOTIFY_RING_MASK, eSetBits);
+    		
+    		// Make sure the caller ID time is right
+    		xTaskNotify(task_handle_gcore, GCORE_NOTIFY_TIME_CHECK_REQ_MASK, eSetBits);
     		break;
     	}
     	
@@ -491,9 +1057,15 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
                     param->conn_stat.chld_feat);
             
             if (param->conn_stat.state == ESP_HF_CLIENT_CONNECTION_STATE_SLC_CONNECTED) {
-            	xTaskNotify(task_handle_bt, BT_NOTIFY_SLC_CON_MASK, eSetBits);
+            	bt_chld_feat = param->conn_stat.chld_feat;
+            	
+            	// Pass the phone's address along
+            	evt_msg_t msg;
+            	msg.id = BT_EVT_SLC_CON;
+            	memcpy(msg.u.str, param->conn_stat.remote_bda, ESP_BD_ADDR_LEN);
+            	evt_bus_send(EVT_QUEUE_BT, &msg);
             } else if (param->conn_stat.state == ESP_HF_CLIENT_CONNECTION_STATE_DISCONNECTED) {
-            	xTaskNotify(task_handle_bt, BT_NOTIFY_SLC_DIS_MASK, eSetBits);
+            	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_SLC_DIS);
             }
             break;
         }
@@ -502,16 +1074,15 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
         {
             ESP_LOGI(HF_TAG, "--audio state %s",
                     c_audio_state_str[param->audio_stat.state]);
+            bt_sco_connecting = (param->audio_stat.state == ESP_HF_CLIENT_AUDIO_STATE_CONNECTING);
 #if CONFIG_BT_HFP_AUDIO_DATA_PATH_HCI
             if (param->audio_stat.state == ESP_HF_CLIENT_AUDIO_STATE_CONNECTED ||
                 param->audio_stat.state == ESP_HF_CLIENT_AUDIO_STATE_CONNECTED_MSBC) {
-                esp_hf_client_register_data_callback(_bt_hf_client_incoming_cb,
-                                                    _bt_hf_client_outgoing_cb);
                 _bt_hf_client_audio_open(param->audio_stat.state == ESP_HF_CLIENT_AUDIO_STATE_CONNECTED_MSBC);
                 
                 // Inform the cellphone of our current volume settings
-                esp_hf_client_volume_update(ESP_HF_VOLUME_CONTROL_TARGET_MIC, gainDB2BT(GAIN_TYPE_MIC, bt_cur_mic_gain));
-                esp_hf_client_volume_update(ESP_HF_VOLUME_CONTROL_TARGET_SPK, gainDB2BT(GAIN_TYPE_SPK, bt_cur_spk_gain));
+                _btAtQueue(BT_AT_CMD_VGM, gainDB2BT(GAIN_TYPE_MIC, bt_cur_mic_gain));
+                _btAtQueue(BT_AT_CMD_VGS, gainDB2BT(GAIN_TYPE_SPK, bt_cur_spk_gain));
             } else if (param->audio_stat.state == ESP_HF_CLIENT_AUDIO_STATE_DISCONNECTED) {
                 _bt_hf_client_audio_close();
             }
@@ -524,19 +1095,45 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
             ESP_LOGI(HF_TAG, "--Call setup indicator %s",
                     c_call_setup_str[param->call_setup.status]);
             if (param->call_setup.status == ESP_HF_CALL_SETUP_STATUS_IDLE) {
-            	xTaskNotify(task_handle_bt, BT_NOTIFY_CALL_INACT_MASK, eSetBits);
+            	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_CALL_INACT);
+            	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_CALL_ALERT_END);
+            	if (bt_call_waiting) {
+            		// The waiting call was answered, rejected or gave up
+            		bt_call_waiting = false;
+            		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_CALL_WAIT_END);
+            	}
             } else {
-            	xTaskNotify(task_handle_bt, BT_NOTIFY_CALL_ACT_MASK, eSetBits);
+            	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_CALL_ACT);
+            	if (param->call_setup.status == ESP_HF_CALL_SETUP_STATUS_OUTGOING_ALERTING) {
+            		// The called party is being rung
+            		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_CALL_ALERTING);
+            	}
             }
             break;
         }
 
+        case ESP_HF_CLIENT_CCWA_EVT:
+        {
+            ESP_LOGI(HF_TAG, "--call_waiting %s",
+                    (param->ccwa.number == NULL) ? "NULL" : (param->ccwa.number));
+            bt_call_waiting = true;
+            evt_bus_send_str(EVT_QUEUE_APP, APP_EVT_BT_CALL_WAITING, param->ccwa.number);
+            break;
+        }
+
+        case ESP_HF_CLIENT_CIND_CALL_HELD_EVT:
+        {
+            ESP_LOGI(HF_TAG, "--Call held indicator %s",
+                    c_call_held_str[param->call_held.status]);
+            evt_bus_send_digit(EVT_QUEUE_APP, APP_EVT_BT_CALL_HELD, (char) param->call_held.status);
+            break;
+        }
+
         case ESP_HF_CLIENT_CLIP_EVT:
         {
             ESP_LOGI(HF_TAG, "--clip number %s",
                     (param->clip.number == NULL) ? "NULL" : (param->clip.number));
-            app_set_cid_number(param->clip.number);
-            xTaskNotify(task_handle_app, APP_NOTIFY_BT_CID_AVAILABLE_MASK, eSetBits);
+            evt_bus_send_str(EVT_QUEUE_APP, APP_EVT_BT_CID_AVAILABLE, param->clip.number);
             break;
         }
 
@@ -550,11 +1147,9 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
             // settings to override those the phone might tell us (from its own settings)
             // before it opens an audio connection to us.
             if ((param->volume_control.type == ESP_HF_VOLUME_CONTROL_TARGET_MIC) && bt_audio_connected) {
-            	app_set_new_mic_gain(gainBT2DB(GAIN_TYPE_MIC, param->volume_control.volume));
-            	xTaskNotify(task_handle_app, APP_NOTIFY_NEW_BT_MIC_GAIN_MASK, eSetBits);
+            	evt_bus_send_gain(EVT_QUEUE_APP, APP_EVT_NEW_BT_MIC_GAIN, gainBT2DB(GAIN_TYPE_MIC, param->volume_control.volume));
             } else if ((param->volume_control.type == ESP_HF_VOLUME_CONTROL_TARGET_SPK) && bt_audio_connected) {
-            	app_set_new_spk_gain(gainBT2DB(GAIN_TYPE_SPK, param->volume_control.volume));
-            	xTaskNotify(task_handle_app, APP_NOTIFY_NEW_BT_SPK_GAIN_MASK, eSetBits);
+            	evt_bus_send_gain(EVT_QUEUE_APP, APP_EVT_NEW_BT_SPK_GAIN, gainBT2DB(GAIN_TYPE_SPK, param->volume_control.volume));
             }
             break;
         }
@@ -612,13 +1207,6 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
             break;
         }
 
-        case ESP_HF_CLIENT_CIND_CALL_HELD_EVT:
-        {
-            ESP_LOGI(HF_TAG, "--Call held indicator %s",
-                    c_call_held_str[param->call_held.status]);
-            break;
-        }
-
         case ESP_HF_CLIENT_BTRH_EVT:
         {
             ESP_LOGI(HF_TAG, "--response and hold %s",
@@ -626,13 +1214,6 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
             break;
         }
 
-        case ESP_HF_CLIENT_CCWA_EVT:
-        {
-            ESP_LOGI(HF_TAG, "--call_waiting %s",
-                    (param->ccwa.number == NULL) ? "NULL" : (param->ccwa.number));
-            break;
-        }
-
         case ESP_HF_CLIENT_CLCC_EVT:
         {
             ESP_LOGI(HF_TAG, "--Current call: idx %d, dir %s, state %s, mpty %s, number %s",
@@ -648,6 +1229,7 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
         {
             ESP_LOGI(HF_TAG, "--AT response event, code %d, cme %d",
                     param->at_response.code, param->at_response.cme);
+            evt_bus_send_digit(EVT_QUEUE_BT, BT_EVT_AT_RESPONSE, (char) param->at_response.code);
             break;
         }
 
@@ -685,8 +1267,31 @@ void _bt_hf_client_cb(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *
 
 static void _bt_hf_client_audio_open(bool is_msbc)
 {
-	xTaskNotify(task_handle_bt, BT_NOTIFY_AUDIO_CON_MASK, eSetBits);
-	xTaskNotify(task_handle_app, APP_NOTIFY_BT_AUDIO_START_MASK, eSetBits);
+	// Start the link statistics for this connection
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_link_stats.audio_connected = true;
+	bt_link_stats.msbc = is_msbc;
+	bt_link_stats.audio_connections++;
+	if (is_msbc) bt_link_stats.msbc_connections++;
+	bt_link_stats.packets = 0;
+	bt_link_stats.packet_bytes = 0;
+	bt_link_stats.late_packets = 0;
+	bt_link_stats.missed_packets = 0;
+	bt_link_min_cycles = UINT32_MAX;
+	bt_link_jitter_cycles = 0;
+	bt_link_max_cycles = 0;
+	bt_link_total_cycles = 0;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+#if (CONFIG_BLE_TELEM_ENABLE == true)
+	ble_telem_set_quiet(true);
+#endif
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+	wifi_up_abort();
+#endif
+	
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_AUDIO_CON);
+	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_AUDIO_START);
 	xTaskNotify(task_handle_pots, (is_msbc) ? POTS_NOTIFY_AUDIO_16K_MASK : POTS_NOTIFY_AUDIO_8K_MASK, eSetBits);
 	
 	ESP_LOGI(HF_TAG, "Using %d kHz sampling", is_msbc ? 16 : 8);
@@ -695,108 +1300,361 @@ static void _bt_hf_client_audio_open(bool is_msbc)
 
 static void _bt_hf_client_audio_close(void)
 {
-	xTaskNotify(task_handle_app, APP_NOTIFY_BT_AUDIO_ENDED_MASK, eSetBits);
-	xTaskNotify(task_handle_bt, BT_NOTIFY_AUDIO_DIS_MASK, eSetBits);
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_link_stats.audio_connected = false;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+#if (CONFIG_BLE_TELEM_ENABLE == true)
+	ble_telem_set_quiet(false);
+#endif
+	
+	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_AUDIO_ENDED);
+	evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_AUDIO_DIS);
 	xTaskNotify(task_handle_pots, POTS_NOTIFY_AUDIO_DIS_MASK, eSetBits);
 }
 
 
 static uint32_t _bt_hf_client_outgoing_cb(uint8_t *p_buf, uint32_t sz)
 {
+	uint32_t start = esp_cpu_get_ccount();
+	
+	SYSTRACE_START(SYSTRACE_ID_BT_DATA_OUT);
 	audioGetVoiceRx((int16_t*) p_buf, sz/2);
+	audio_stats_record_bt_cb(start);
+	SYSTRACE_STOP(SYSTRACE_ID_BT_DATA_OUT);
 	return sz;
 }
 
 
 static void _bt_hf_client_incoming_cb(const uint8_t *buf, uint32_t sz)
 {
+	uint32_t start = esp_cpu_get_ccount();
+	
+	SYSTRACE_START(SYSTRACE_ID_BT_DATA_IN);
+#if (CONFIG_BT_TRACE_SCO == true)
+	sample_record_event(SAMPLE_EVT_BT_SCO_IN, 0, buf, sz);
+#endif
+	_bt_link_record_packet(start, sz);
 	audioPutVoiceTx((int16_t*) buf, sz/2);
-    esp_hf_client_outgoing_data_ready();
+	
+	// Only have the stack pull outgoing audio when a full frame is available (otherwise
+	// audio_task will signal it once the frame has been stored)
+	if (audioVoiceRxFrameReady()) {
+    	bt_signal_voice_rx_ready();
+    }
+    audio_stats_record_bt_cb(start);
+    SYSTRACE_STOP(SYSTRACE_ID_BT_DATA_IN);
 }
 
 
-//
-// Internal functions for bt_task
-//
-static bool _btStartBluetooth()
+#if (CONFIG_BT_TRACE_ENABLE == true)
+// Record an HF event followed by its string (including the terminator) if it has one
+static void _bt_trace_hf_evt(esp_hf_client_cb_event_t event, esp_hf_client_cb_param_t *param, const char* str)
 {
-	esp_err_t ret;
-	esp_bt_controller_config_t bt_cfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
+	uint8_t rec[sizeof(esp_hf_client_cb_param_t) + ESP_BT_HF_NUMBER_LEN + 1];
+	int len = sizeof(esp_hf_client_cb_param_t);
 	
-	// Initialize NVS used to store PHY calibration data
-	ret = nvs_flash_init();
-    if (ret == ESP_ERR_NVS_NO_FREE_PAGES) {
-    	if ((ret = nvs_flash_erase()) != ESP_OK) {
-    		ESP_LOGE(TAG, "nvs_flash_erase failed: (%s)", esp_err_to_name(ret));
-    		return false;
-    	}
-        
-        ret = nvs_flash_init();
-    }
-    if (ret != ESP_OK) {
-    	ESP_LOGE(TAG, "nvs_flash_init failed: (%s)", esp_err_to_name(ret));
-    	return false;
-    }
-
-	// Not using BLE
-	if ((ret = esp_bt_controller_mem_release(ESP_BT_MODE_BLE)) != ESP_OK) {
-		ESP_LOGE(TAG, "release BLE controller memory failed (%s)", esp_err_to_name(ret));
-		return false;
+	memcpy(rec, param, len);
+	if (str != NULL) {
+		len += strlcpy((char*) &rec[len], str, ESP_BT_HF_NUMBER_LEN + 1) + 1;
+		if (len > sizeof(rec)) len = sizeof(rec);
 	}
+	sample_record_event(SAMPLE_EVT_BT_HF, event, rec, len);
+}
+#endif
 
-	// Startup Bluetooth controller
-    if ((ret = esp_bt_controller_init(&bt_cfg)) != ESP_OK) {
-        ESP_LOGE(TAG, "initialize controller failed (%s)", esp_err_to_name(ret));
-        return false;
-    }
-
-    if ((ret = esp_bt_controller_enable(ESP_BT_MODE_CLASSIC_BT)) != ESP_OK) {
-        ESP_LOGE(TAG, "enable controller failed (%s)", esp_err_to_name(ret));
-        return false;
-    }
-
-	// Startup bluedroid
-    if ((ret = esp_bluedroid_init()) != ESP_OK) {
-        ESP_LOGE(TAG, "initialize bluedroid failed (%s)", esp_err_to_name(ret));
-        return false;
-    }
 
-    if ((ret = esp_bluedroid_enable()) != ESP_OK) {
-        ESP_LOGE(TAG, "enable bluedroid failed (%s)", esp_err_to_name(ret));
-        return false;
-    }
-    
-    // Setup class of device
-    esp_bt_cod_t cod;
-    cod.reserved_2 = 0;
-	cod.minor = 0x02;     // binary 000010 (Handsfree device)
-	cod.major = 0x04;     // binary 00100 (Audio/Video)
-	cod.reserved_8 = 0;
-	cod.service = 0x300;  // binary 01100000000 (Audio + Telephony)
-    if ((ret = esp_bt_gap_set_cod(cod, ESP_BT_INIT_COD)) != ESP_OK) {
-    	ESP_LOGE(TAG, "configure COD failed (%s)", esp_err_to_name(ret));
-        return false;
-    }
-    
-    // Set up device name
-    esp_bt_dev_set_device_name(device_name);
-    
-    // Register GAP callback function
-	esp_bt_gap_register_callback(_bt_gap_cb);
+#if (CONFIG_BT_TRACE_REPLAY == true)
+// Deliver the events in recording CONFIG_BT_TRACE_REPLAY_NUM at their recorded times through
+// the same paths as the stack callbacks
+static void _bt_replay_task(void* args)
+{
+	const esp_timer_create_args_t timer_args = {
+		.callback = &_bt_replay_timer_cb,
+		.name = "bt_replay"
+	};
+	sample_evt_hdr_t hdr;
+	int64_t start_usec;
+	int64_t wait_usec;
+	uint32_t notify_value;
+	int count = 0;
+	int len;
 	
-	// Register HF callback function and startup HF client
-	esp_hf_client_register_callback(_bt_hf_client_cb);
-	esp_hf_client_init();
+	if (esp_timer_create(&timer_args, &bt_replay_timer) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not create replay timer");
+		vTaskDelete(NULL);
+	}
 	
-#if (CONFIG_BT_SSP_ENABLED == true)
-    /* Set default parameters for Secure Simple Pairing */
-    esp_bt_sp_param_t param_type = ESP_BT_SP_IOCAP_MODE;
-    esp_bt_io_cap_t iocap = ESP_BT_IO_CAP_IO;
-    esp_bt_gap_set_security_param(param_type, &iocap, sizeof(uint8_t));
-#endif
+	if (!sample_trace_open(CONFIG_BT_TRACE_REPLAY_NUM)) {
+		ESP_LOGE(TAG, "Could not open Bluetooth trace %d", CONFIG_BT_TRACE_REPLAY_NUM);
+		esp_timer_delete(bt_replay_timer);
+		vTaskDelete(NULL);
+	}
 	
-	esp_bt_pin_type_t pin_type = ESP_BT_PIN_TYPE_VARIABLE;
-	esp_bt_pin_code_t pin_code;
+	start_usec = esp_timer_get_time();
+	while ((len = sample_trace_read(&hdr, bt_replay_buf, sizeof(bt_replay_buf))) >= 0) {
+		// Wait until the event is due, pulling outgoing audio as it becomes available
+		while ((wait_usec = start_usec + hdr.usec - esp_timer_get_time()) > 0) {
+			esp_timer_start_once(bt_replay_timer, wait_usec);
+			xTaskNotifyWait(0x00, 0xFFFFFFFF, &notify_value, portMAX_DELAY);
+			esp_timer_stop(bt_replay_timer);
+			
+			if (Notification(notify_value, BT_REPLAY_NOTIFY_PULL) && (bt_replay_sco_len != 0)) {
+				(void) _bt_hf_client_outgoing_cb(bt_replay_out_buf, bt_replay_sco_len);
+			}
+		}
+		
+		_bt_replay_event(&hdr, len);
+		count++;
+	}
+	
+	sample_trace_close();
+	esp_timer_delete(bt_replay_timer);
+	ESP_LOGI(TAG, "Bluetooth trace replay done (%d events)", count);
+	vTaskDelete(NULL);
+}
+
+
+static void _bt_replay_timer_cb(void* arg)
+{
+	xTaskNotify(bt_replay_task_handle, BT_REPLAY_NOTIFY_TIMER, eSetBits);
+}
+
+
+static void _bt_replay_event(const sample_evt_hdr_t* hdr, int len)
+{
+	switch (hdr->type) {
+		case SAMPLE_EVT_BT_GAP:
+			if (len == sizeof(esp_bt_gap_cb_param_t)) {
+				_bt_stack_evt_push(false, hdr->id, bt_replay_buf, len, NULL);
+			}
+			break;
+		
+		case SAMPLE_EVT_BT_HF:
+			if (len >= sizeof(esp_hf_client_cb_param_t)) {
+				bt_replay_buf[sizeof(bt_replay_buf) - 1] = 0;
+				_bt_stack_evt_push(true, hdr->id, bt_replay_buf, sizeof(esp_hf_client_cb_param_t),
+				                   (len > sizeof(esp_hf_client_cb_param_t)) ? (char*) &bt_replay_buf[sizeof(esp_hf_client_cb_param_t)] : NULL);
+			}
+			break;
+		
+		case SAMPLE_EVT_BT_SCO_IN:
+			bt_replay_sco_len = len;
+			_bt_hf_client_incoming_cb(bt_replay_buf, len);
+			break;
+		
+		default:
+			ESP_LOGW(TAG, "Unknown trace event type %d", hdr->type);
+	}
+}
+#endif
+
+
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+// Run a narrowband call with a synthetic far end through the same paths as the stack callbacks
+// until the stress test ends, recording how late each packet was delivered
+static void _bt_stress_task(void* args)
+{
+	const esp_timer_create_args_t timer_args = {
+		.callback = &_bt_stress_timer_cb,
+		.name = "bt_stress"
+	};
+	int64_t due_usec;
+	int64_t late_usec;
+	uint32_t notify_value;
+	
+	if (esp_timer_create(&timer_args, &bt_stress_timer) != ESP_OK) {
+		ESP_LOGE(TAG, "Could not create stress test timer");
+		vTaskDelete(NULL);
+	}
+	
+	// audio_task runs the full voice path (with the echo canceller) as for a CVSD call
+	xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_VOICE_8_MASK, eSetBits);
+	
+	due_usec = esp_timer_get_time() + STRESS_SCO_USEC;
+	esp_timer_start_periodic(bt_stress_timer, STRESS_SCO_USEC);
+	while (stress_running()) {
+		xTaskNotifyWait(0x00, 0xFFFFFFFF, &notify_value, portMAX_DELAY);
+		
+		if (Notification(notify_value, BT_STRESS_NOTIFY_PULL)) {
+			(void) _bt_hf_client_outgoing_cb((uint8_t*) bt_stress_out_buf, sizeof(bt_stress_out_buf));
+		}
+		
+		if (Notification(notify_value, BT_STRESS_NOTIFY_TIMER)) {
+			// Packets whose period passed while this one was late are lost, as over the air
+			late_usec = esp_timer_get_time() - due_usec;
+			if (late_usec < 0) late_usec = 0;
+			stress_record(STRESS_LAT_SCO, (uint32_t) late_usec);
+			due_usec += STRESS_SCO_USEC * (1 + late_usec / STRESS_SCO_USEC);
+			
+			_bt_stress_far_end(bt_stress_buf, STRESS_SCO_SAMPLES);
+			_bt_hf_client_incoming_cb((uint8_t*) bt_stress_buf, sizeof(bt_stress_buf));
+		}
+	}
+	
+	esp_timer_stop(bt_stress_timer);
+	esp_timer_delete(bt_stress_timer);
+	xTaskNotify(task_handle_audio, AUDIO_NOTIFY_DISABLE_MASK, eSetBits);
+	ESP_LOGI(TAG, "Stress test call ended");
+	vTaskDelete(NULL);
+}
+
+
+static void _bt_stress_timer_cb(void* arg)
+{
+	xTaskNotify(bt_stress_task_handle, BT_STRESS_NOTIFY_TIMER, eSetBits);
+}
+
+
+// Far end "speech" - uniform noise talk spurts separated by silence
+static void _bt_stress_far_end(int16_t* buf, int len)
+{
+	int i;
+	
+	for (i=0; i<len; i++) {
+		bt_stress_noise = bt_stress_noise * 1664525 + 1013904223;
+		if (bt_stress_phase < BT_STRESS_TALK_SAMPLES) {
+			buf[i] = (int16_t) (((int32_t) bt_stress_noise) >> BT_STRESS_NOISE_SHIFT);
+		} else {
+			buf[i] = 0;
+		}
+		if (++bt_stress_phase >= (BT_STRESS_TALK_SAMPLES + BT_STRESS_PAUSE_SAMPLES)) {
+			bt_stress_phase = 0;
+		}
+	}
+}
+#endif
+
+
+// Called from the incoming audio callback with the arrival time of each packet
+static void _bt_link_record_packet(uint32_t cycles, uint32_t sz)
+{
+	uint32_t delta;
+	uint32_t d;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	if (bt_link_stats.packets != 0) {
+		delta = cycles - bt_link_last_cycles;
+		bt_link_total_cycles += delta;
+		if (delta > bt_link_max_cycles) bt_link_max_cycles = delta;
+		
+		// The shortest interval seen is the eSCO interval
+		if (delta < bt_link_min_cycles) {
+			bt_link_min_cycles = delta;
+		} else if (delta > (bt_link_min_cycles + bt_link_min_cycles/2)) {
+			bt_link_stats.late_packets++;
+		}
+		
+		// Jitter is the smoothed deviation from the eSCO interval
+		d = delta - bt_link_min_cycles;
+		bt_link_jitter_cycles += d - (bt_link_jitter_cycles >> BT_LINK_JITTER_SHIFT);
+	}
+	bt_link_last_cycles = cycles;
+	bt_link_stats.packets++;
+	bt_link_stats.packet_bytes = sz;
+	portEXIT_CRITICAL(&bt_stats_mux);
+}
+
+
+//
+// Internal functions for bt_task
+//
+static bool _btStartBluetooth()
+{
+	esp_err_t ret;
+	esp_bt_controller_config_t bt_cfg = BT_CONTROLLER_INIT_CONFIG_DEFAULT();
+	
+	// Initialize NVS used to store PHY calibration data
+	ret = nvs_flash_init();
+    if (ret == ESP_ERR_NVS_NO_FREE_PAGES) {
+    	if ((ret = nvs_flash_erase()) != ESP_OK) {
+    		ESP_LOGE(TAG, "nvs_flash_erase failed: (%s)", esp_err_to_name(ret));
+    		return false;
+    	}
+        
+        ret = nvs_flash_init();
+    }
+    if (ret != ESP_OK) {
+    	ESP_LOGE(TAG, "nvs_flash_init failed: (%s)", esp_err_to_name(ret));
+    	return false;
+    }
+
+#if (CONFIG_BLE_TELEM_ENABLE != true)
+	// Not using BLE
+	if ((ret = esp_bt_controller_mem_release(ESP_BT_MODE_BLE)) != ESP_OK) {
+		ESP_LOGE(TAG, "release BLE controller memory failed (%s)", esp_err_to_name(ret));
+		return false;
+	}
+#endif
+
+	// Startup Bluetooth controller
+    if ((ret = esp_bt_controller_init(&bt_cfg)) != ESP_OK) {
+        ESP_LOGE(TAG, "initialize controller failed (%s)", esp_err_to_name(ret));
+        return false;
+    }
+
+    if ((ret = esp_bt_controller_enable(BT_CONTROLLER_MODE)) != ESP_OK) {
+        ESP_LOGE(TAG, "enable controller failed (%s)", esp_err_to_name(ret));
+        return false;
+    }
+
+#if (CONFIG_BT_LINK_PROFILE_ROBUST == true)
+	// Let the controller's power control use its full BR/EDR transmit power range
+	if ((ret = esp_bredr_tx_power_set(ESP_PWR_LVL_N0, ESP_PWR_LVL_P9)) != ESP_OK) {
+		ESP_LOGE(TAG, "set BR/EDR TX power failed (%s)", esp_err_to_name(ret));
+	}
+#endif
+
+	// Startup bluedroid
+    if ((ret = esp_bluedroid_init()) != ESP_OK) {
+        ESP_LOGE(TAG, "initialize bluedroid failed (%s)", esp_err_to_name(ret));
+        return false;
+    }
+
+    if ((ret = esp_bluedroid_enable()) != ESP_OK) {
+        ESP_LOGE(TAG, "enable bluedroid failed (%s)", esp_err_to_name(ret));
+        return false;
+    }
+    
+    // Setup class of device
+    esp_bt_cod_t cod;
+    cod.reserved_2 = 0;
+	cod.minor = 0x02;     // binary 000010 (Handsfree device)
+	cod.major = 0x04;     // binary 00100 (Audio/Video)
+	cod.reserved_8 = 0;
+	cod.service = 0x300;  // binary 01100000000 (Audio + Telephony)
+    if ((ret = esp_bt_gap_set_cod(cod, ESP_BT_INIT_COD)) != ESP_OK) {
+    	ESP_LOGE(TAG, "configure COD failed (%s)", esp_err_to_name(ret));
+        return false;
+    }
+    
+    // Set up device name
+    esp_bt_dev_set_device_name(device_name);
+    
+    // Register GAP callback function
+	esp_bt_gap_register_callback(_bt_gap_cb);
+	
+	// Register HF callback function and startup HF client
+	esp_hf_client_register_callback(_bt_hf_client_cb);
+	esp_hf_client_init();
+	
+	// Audio data is passed to audio_task while an audio connection is open
+	esp_hf_client_register_data_callback(_bt_hf_client_incoming_cb, _bt_hf_client_outgoing_cb);
+	
+#if (CONFIG_BLE_TELEM_ENABLE == true)
+	// Telemetry service for field checks over BLE
+	ble_telem_init();
+#endif
+	
+#if (CONFIG_BT_SSP_ENABLED == true)
+    /* Set default parameters for Secure Simple Pairing */
+    esp_bt_sp_param_t param_type = ESP_BT_SP_IOCAP_MODE;
+    esp_bt_io_cap_t iocap = ESP_BT_IO_CAP_IO;
+    esp_bt_gap_set_security_param(param_type, &iocap, sizeof(uint8_t));
+#endif
+	
+	esp_bt_pin_type_t pin_type = ESP_BT_PIN_TYPE_VARIABLE;
+	esp_bt_pin_code_t pin_code;
 	esp_bt_gap_set_pin(pin_type, 0, pin_code);
 	
 	ESP_LOGI(TAG, "Own Address:");
@@ -830,34 +1688,48 @@ static void _bt_cleanup_bond_info()
 }
 
 
-// peer_addr must be valid on entry
-static bool _bt_validate_bond_info()
+// Loads the pairings from persistent storage and checks the stack has bonds for them
+static void _btRefreshPairCache()
 {
 	esp_err_t ret;
+	int i, j;
 	int paired_devs;
 	uint8_t paired_devs_macs[10][6];
+	bool remembered;
+	
+	for (i=0; i<PS_BT_MAX_PAIRS; i++) {
+		bt_pairs[i].paired = ps_get_bt_pair(i, (uint8_t*) bt_pairs[i].addr, bt_pairs[i].name);
+		bt_pairs[i].bonded = false;
+	}
+	bt_pair_cache_valid = true;
 	
 	paired_devs = esp_bt_gap_get_bond_device_num();
+	if (paired_devs == 0) return;
 	
-	if (paired_devs == 0) {
-		return false;
-	} else {
-		ESP_LOGI(TAG, "Found %d bonded device(s)", paired_devs);
-		if (paired_devs > 10) paired_devs = 10;
-		ret = esp_bt_gap_get_bond_device_list(&paired_devs, paired_devs_macs);
-		if (ret != ESP_OK) {
-			ESP_LOGE(TAG, "esp_bt_gap_get_bond_device_list returned %d", ret);
-			return false;
-		} else {
-			for (int i = 0; i < paired_devs; i++) {
-				if (_bt_addr_match(paired_devs_macs[i], peer_addr)) {
-					return true;
-				}
+	ESP_LOGI(TAG, "Found %d bonded device(s)", paired_devs);
+	if (paired_devs > 10) paired_devs = 10;
+	ret = esp_bt_gap_get_bond_device_list(&paired_devs, paired_devs_macs);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "esp_bt_gap_get_bond_device_list returned %d", ret);
+		return;
+	}
+	
+	for (i=0; i<paired_devs; i++) {
+		remembered = false;
+		for (j=0; j<PS_BT_MAX_PAIRS; j++) {
+			if (bt_pairs[j].paired && _bt_addr_match(paired_devs_macs[i], bt_pairs[j].addr)) {
+				bt_pairs[j].bonded = true;
+				remembered = true;
 			}
-			
-			return false;
+		}
+		
+		// A phone pushed out by a newer pairing
+		if (!remembered && bt_pair_prune) {
+			ESP_LOGI(TAG, "Removing bond for forgotten device " BT_BDA_FMT, BT_BDA_ARGS(paired_devs_macs[i]));
+			(void) esp_bt_gap_remove_bond_device(paired_devs_macs[i]);
 		}
 	}
+	bt_pair_prune = false;
 }
 
 
@@ -873,268 +1745,926 @@ static bool _bt_addr_match(uint8_t a1[], uint8_t a2[])
 }
 
 
-static void _btEval()
+// bt_hsm guards
+static bool _btOutOfService()
 {
-	switch (bt_state) {
-		// No bluetooth connection
-		case BT_DISCONNECTED:
-			if (bt_in_service) {
-				_btSetState(BT_CONNECTED_IDLE);
-			} else {
-				// Look to see if we can try to connect to something
-				if (ps_get_bt_is_paired()) {
-					if (++bt_reconnect_count >= (BT_RECONNECT_MSEC / BT_EVAL_MSEC)) {
-						bt_reconnect_count = 0;
-						ps_get_bt_pair_addr((uint8_t*) peer_addr);
-						ps_get_bt_pair_name(peer_device_name);
-						if (!_bt_validate_bond_info()) {
-							ESP_LOGE(TAG, "Could not find bond information for %s - forgetting pairing...", peer_device_name);
-							xTaskNotify(task_handle_gui, GUI_NOTIFY_FORGET_PAIRING_MASK, eSetBits);
-						} else {
-							ESP_LOGI(TAG, "Attempting to connect to %s:", peer_device_name);
-							esp_log_buffer_hex(TAG, peer_addr, ESP_BD_ADDR_LEN);
-							esp_hf_client_connect(peer_addr);
-						}
-					}
-				}
-			}
-			break;
+	return !bt_in_service;
+}
+
+
+static bool _btInService()
+{
+	return bt_in_service;
+}
+
+
+static bool _btInCall()
+{
+	return bt_in_call;
+}
+
+
+static bool _btCallEnded()
+{
+	return !bt_in_call;
+}
+
+
+static void _btAttemptReconnect()
+{
+	int i, n;
+	
+	// Keep trying (paired or not, since we may be paired in the meantime), leaving gaps
+	// for the phone to page us since we can't answer its pages while paging it
+	soft_timer_start(bt_reconnect_timer, _btNextReconnectDelay());
+	
+	if (!bt_pair_cache_valid) {
+		_btRefreshPairCache();
+	}
+	
+	// Take turns trying each remembered phone (the stack only supports one connection)
+	for (i=0; i<PS_BT_MAX_PAIRS; i++) {
+		n = (bt_pair_next + i) % PS_BT_MAX_PAIRS;
+		if (bt_pairs[n].paired) break;
+	}
+	
+	if (i < PS_BT_MAX_PAIRS) {
+		bt_pair_next = (n + 1) % PS_BT_MAX_PAIRS;
+		memcpy(peer_addr, bt_pairs[n].addr, ESP_BD_ADDR_LEN);
+		strcpy(peer_device_name, bt_pairs[n].name);
 		
-		// Bluetooth connected, no activity
-		case BT_CONNECTED_IDLE:
-			if (!bt_in_service) {
-				_btSetState(BT_DISCONNECTED);
-			} else if (notify_bt_answer) {
-		 		esp_hf_client_answer_call();
-			} else if (bt_in_call) {
-		 		_btSetState(BT_CALL_ACTIVE);
-			} else if (notify_bt_dial_num || notify_bt_dial_oper) {
-				_btSetState(BT_CALL_INITIATED);
-			} else if (notify_bt_hangup) {
-				// Used to tell cellphone to reject incoming (ringing) call
-				esp_hf_client_reject_call();
+		if (!bt_pairs[n].bonded) {
+			if (n == 0) {
+				ESP_LOGE(TAG, "Could not find bond information for %s - forgetting pairing...", peer_device_name);
+				xTaskNotify(task_handle_gui, GUI_NOTIFY_FORGET_PAIRING_MASK, eSetBits);
+				bt_pair_cache_valid = false;
+			} else {
+				ESP_LOGW(TAG, "Could not find bond information for %s - skipping", peer_device_name);
 			}
-			break;
-		
-		// Command sent to cellphone to dial a number but it hasn't yet acknowledged call in progress
-		case BT_CALL_INITIATED:
-			if (!bt_in_service) {
-		 		_btSetState(BT_DISCONNECTED);
-		 	} else if (bt_in_call) {
-		 		_btSetState(BT_CALL_ACTIVE);
-		 	} else if (notify_bt_hangup) {
-		 		_btSetState(BT_CONNECTED_IDLE);
-		 	}
-			break;
-				
-		// Call in progress
-		case BT_CALL_ACTIVE:
-			if (!bt_in_service) {
-		 		_btSetState(BT_DISCONNECTED);
-		 	} else if (!bt_in_call) {
-		 		_btSetState(BT_CONNECTED_IDLE);
-		 	} else if (notify_bt_hangup) {
-		 		_btSetState(BT_WAIT_END);
-		 	}
-			break;
-		
-		// Told cellphone to disconnect call, waiting for cellphone to acknowledge call is over
-		case BT_WAIT_END:
-			if (!bt_in_service) {
-		 		_btSetState(BT_DISCONNECTED);
-		 	} else if (!bt_in_call) {
-		 		_btSetState(BT_CONNECTED_IDLE);
-		 	}
-			break;
+		} else {
+			ESP_LOGI(TAG, "Attempting to connect to %s:", peer_device_name);
+			esp_log_buffer_hex(TAG, peer_addr, ESP_BD_ADDR_LEN);
+			esp_hf_client_connect(peer_addr);
+			
+			portENTER_CRITICAL(&bt_stats_mux);
+			bt_reconnect_stats.attempts++;
+			portEXIT_CRITICAL(&bt_stats_mux);
+		}
 	}
+}
+
+
+static uint32_t _btNextReconnectDelay()
+{
+	uint32_t d = bt_reconnect_delay_msec;
+	uint32_t jitter = d * BT_RECONNECT_JITTER_PCT / 100;
 	
-	// Clear notifiers
-	notify_bt_dial_num = false;
-	notify_bt_dial_oper = false;
-	notify_bt_answer = false;
-	notify_bt_hangup = false;
+	// Jitter keeps several units (or a unit and the phone) from retrying in lockstep
+	d = d - jitter + (esp_random() % (2 * jitter + 1));
+	
+	bt_reconnect_delay_msec *= 2;
+	if (bt_reconnect_delay_msec > BT_RECONNECT_MAX_MSEC) {
+		bt_reconnect_delay_msec = BT_RECONNECT_MAX_MSEC;
+	}
+	
+	return d;
 }
 
 
-static void _btSetState(bt_stateT s)
+// Queue an AT command for the phone.  Call control goes ahead of waiting DTMF digits and volume
+// updates (but stays in order with other call control) and a volume update replaces one still
+// waiting since the phone only needs the latest.
+static void _btAtQueue(int cmd, int arg)
 {
-	switch (s) {
-		case BT_DISCONNECTED:
-			bt_reconnect_count = (BT_RECONNECT_MSEC / BT_EVAL_MSEC) - 1;  // Attempt to reconnect immediately
-			xTaskNotify(task_handle_app, APP_NOTIFY_BT_OUT_OF_SERVICE_MASK, eSetBits);
-			
-			// Clear any dangling state if BT connection suddenly disappears
-			if (bt_in_call) {
-				bt_in_call = false;
-				xTaskNotify(task_handle_app, APP_NOTIFY_BT_CALL_ENDED_MASK, eSetBits);
-			}
-			if (bt_audio_connected) {
-				bt_audio_connected = false;
-				xTaskNotify(task_handle_app, APP_NOTIFY_BT_AUDIO_ENDED_MASK, eSetBits);
-				xTaskNotify(task_handle_pots, POTS_NOTIFY_AUDIO_DIS_MASK, eSetBits);
+	int i, n;
+	bt_at_req_t* rP;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	if ((cmd == BT_AT_CMD_VGM) || (cmd == BT_AT_CMD_VGS)) {
+		for (i=0; i<bt_at_count; i++) {
+			rP = &bt_at_queue[(bt_at_head + i) % BT_AT_QUEUE_LEN];
+			if (rP->cmd == cmd) {
+				rP->arg = arg;
+				bt_at_stats.coalesced++;
+				portEXIT_CRITICAL(&bt_stats_mux);
+				return;
 			}
-			break;
+		}
+	}
+	
+	if (bt_at_count == BT_AT_QUEUE_LEN) {
+		bt_at_stats.overflows++;
+		portEXIT_CRITICAL(&bt_stats_mux);
+		ESP_LOGE(TAG, "AT queue full, %s dropped", bt_at_cmd_names[cmd]);
+		return;
+	}
+	
+	// Find where this command goes and make room for it
+	n = bt_at_count;
+	if (cmd < BT_AT_CMD_DTMF) {
+		for (n=0; n<bt_at_count; n++) {
+			if (bt_at_queue[(bt_at_head + n) % BT_AT_QUEUE_LEN].cmd >= BT_AT_CMD_DTMF) break;
+		}
+		for (i=bt_at_count; i>n; i--) {
+			bt_at_queue[(bt_at_head + i) % BT_AT_QUEUE_LEN] = bt_at_queue[(bt_at_head + i - 1) % BT_AT_QUEUE_LEN];
+		}
+	}
+	rP = &bt_at_queue[(bt_at_head + n) % BT_AT_QUEUE_LEN];
+	rP->cmd = cmd;
+	rP->arg = arg;
+	bt_at_count++;
+	bt_at_stats.queued++;
+	if (bt_at_count > bt_at_stats.max_depth) {
+		bt_at_stats.max_depth = bt_at_count;
+	}
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+	_btAtSendNext();
+}
+
+
+// Sends the next command unless one is in flight or the DTMF gap is running.  A command the
+// stack refuses is counted as an error and skipped.
+static void _btAtSendNext()
+{
+	bt_at_req_t r;
+	esp_err_t ret;
+	
+	while ((bt_at_in_flight < 0) && !soft_timer_running(bt_at_timer) && (bt_at_count != 0)) {
+		r = bt_at_queue[bt_at_head];
+		bt_at_head = (bt_at_head + 1) % BT_AT_QUEUE_LEN;
+		bt_at_count--;
 		
-		case BT_CONNECTED_IDLE:
-			xTaskNotify(task_handle_app, APP_NOTIFY_BT_IN_SERVICE_MASK, eSetBits);
-			xTaskNotify(task_handle_app, APP_NOTIFY_BT_CALL_ENDED_MASK, eSetBits);
-			if (bt_state == BT_DISCONNECTED) {
-				// Tell the cellphone we'll handle echo cancellation when we first get a SLC
-				if (esp_hf_client_send_nrec() != ESP_OK) {
-					ESP_LOGE(TAG, "esp_hf_client_send_nrec failed");
-				}
-			}
-			if (bt_state == BT_CALL_INITIATED) {
-				// Hang up any initiated or incoming call
-				esp_hf_client_reject_call();
-				esp_hf_client_stop_voice_recognition();
-			}
-			
-			// Reset our reconnect timer so we'll immediately try to reconnect if become disconnected
-			bt_reconnect_count = (BT_RECONNECT_MSEC / BT_EVAL_MSEC);
-			break;
+		switch (r.cmd) {
+			case BT_AT_CMD_ANSWER:
+				ret = esp_hf_client_answer_call();
+				break;
+			case BT_AT_CMD_HANGUP:
+				ret = esp_hf_client_reject_call();
+				break;
+			case BT_AT_CMD_DIAL:
+				ret = esp_hf_client_dial(outgoing_phone_num);
+				break;
+			case BT_AT_CMD_VR_START:
+				ret = esp_hf_client_start_voice_recognition();
+				break;
+			case BT_AT_CMD_VR_STOP:
+				ret = esp_hf_client_stop_voice_recognition();
+				break;
+			case BT_AT_CMD_CHLD:
+				ret = esp_hf_client_send_chld_cmd((esp_hf_chld_type_t) r.arg, 0);
+				break;
+			case BT_AT_CMD_DTMF:
+				ret = esp_hf_client_send_dtmf((char) r.arg);
+				break;
+			case BT_AT_CMD_VGM:
+				ret = esp_hf_client_volume_update(ESP_HF_VOLUME_CONTROL_TARGET_MIC, r.arg);
+				break;
+			case BT_AT_CMD_VGS:
+				ret = esp_hf_client_volume_update(ESP_HF_VOLUME_CONTROL_TARGET_SPK, r.arg);
+				break;
+			case BT_AT_CMD_NREC:
+				ret = esp_hf_client_send_nrec();
+				break;
+			default:
+				ret = esp_hf_client_query_current_calls();
+		}
 		
-		case BT_CALL_INITIATED:
-			if (notify_bt_dial_num) {
-				esp_hf_client_dial(outgoing_phone_num);
-				ESP_LOGI(TAG, "Dial %s", outgoing_phone_num);
-			} else if (notify_bt_dial_oper) {
-				esp_hf_client_start_voice_recognition();
-				ESP_LOGI(TAG, "Voice Dial");
-			}
-			break;
-				
-		case BT_CALL_ACTIVE:
-			xTaskNotify(task_handle_app, APP_NOTIFY_BT_CALL_STARTED_MASK, eSetBits);
-			break;
+		portENTER_CRITICAL(&bt_stats_mux);
+		if (ret == ESP_OK) {
+			bt_at_stats.cmd[r.cmd].sent++;
+		} else {
+			bt_at_stats.cmd[r.cmd].errors++;
+		}
+		portEXIT_CRITICAL(&bt_stats_mux);
 		
-		case BT_WAIT_END:
-			// Hang up any ongoing call
-			esp_hf_client_reject_call();
-			esp_hf_client_stop_voice_recognition();
-			break;
+		if (ret == ESP_OK) {
+			bt_at_in_flight = r.cmd;
+			bt_at_sent_usec = esp_timer_get_time();
+			soft_timer_start(bt_at_timer, BT_AT_RSP_TIMEOUT_MSEC);
+		} else {
+			ESP_LOGE(TAG, "%s failed", bt_at_cmd_names[r.cmd]);
+		}
+	}
+}
+
+
+// The stack only reports the final OK or ERROR for the command it sent last so the response
+// belongs to the one in flight.  A late response after a timeout is ignored.
+static void _btAtResponse(int code)
+{
+	bt_at_cmd_stats_t* sP;
+	int bin;
+	uint32_t msec;
+	
+	if (bt_at_in_flight < 0) return;
+	
+	msec = (uint32_t) ((esp_timer_get_time() - bt_at_sent_usec) / 1000);
+	for (bin=0; bin<(BT_AT_HIST_BINS-1); bin++) {
+		if (msec < (32U << bin)) break;
 	}
 	
-#ifdef BT_STATE_DEBUG
-	STATE_CHANGE_PRINT(bt_state, s, bt_state_name);
+	portENTER_CRITICAL(&bt_stats_mux);
+	sP = &bt_at_stats.cmd[bt_at_in_flight];
+	if (code != ESP_HF_AT_RESPONSE_CODE_OK) {
+		sP->errors++;
+	}
+	if (msec > sP->max_msec) sP->max_msec = msec;
+	sP->total_msec += msec;
+	sP->hist[bin]++;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+	if (code != ESP_HF_AT_RESPONSE_CODE_OK) {
+		ESP_LOGW(TAG, "%s returned %d", bt_at_cmd_names[bt_at_in_flight], code);
+	}
+	
+	// The next digit follows the gap, anything else goes immediately
+	if (bt_at_in_flight == BT_AT_CMD_DTMF) {
+		soft_timer_start(bt_at_timer, BT_DTMF_GAP_MSEC);
+	} else {
+		soft_timer_stop(bt_at_timer);
+	}
+	bt_at_in_flight = -1;
+	
+	_btAtSendNext();
+}
+
+
+// Discard waiting commands - just the DTMF digits when a call ends, everything (including the
+// command in flight) when the connection is lost
+static void _btAtFlush(bool dtmf_only)
+{
+	int i, n;
+	bt_at_req_t r;
+	
+	n = 0;
+	portENTER_CRITICAL(&bt_stats_mux);
+	for (i=0; i<bt_at_count; i++) {
+		r = bt_at_queue[(bt_at_head + i) % BT_AT_QUEUE_LEN];
+		if (dtmf_only && (r.cmd != BT_AT_CMD_DTMF)) {
+			bt_at_queue[(bt_at_head + n++) % BT_AT_QUEUE_LEN] = r;
+		}
+	}
+	bt_at_stats.flushed += bt_at_count - n;
+	bt_at_count = n;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+	if (!dtmf_only) {
+		soft_timer_stop(bt_at_timer);
+		bt_at_in_flight = -1;
+		bt_at_head = 0;
+	}
+}
+
+
+static void _btLinkMonStart()
+{
+	bt_link_prev_usec = esp_timer_get_time();
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_link_prev_packets = bt_link_stats.packets;
+	bt_link_stats.rssi_delta = 0;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	audio_get_stats(&bt_link_audio_stats);
+	bt_link_prev_tx_underruns = bt_link_audio_stats.tx_underruns;
+	
+	(void) esp_bt_gap_read_rssi_delta(peer_addr);
+	soft_timer_start_periodic(bt_link_mon_timer, BT_LINK_MON_MSEC);
+}
+
+
+static void _btLinkMonStop()
+{
+	soft_timer_stop(bt_link_mon_timer);
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_link_stats.quality = BT_LINK_QUALITY_NONE;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	_btLinkPublishStatus();
+	xTaskNotify(task_handle_gui, GUI_NOTIFY_LINK_QUALITY_MASK, eSetBits);
+}
+
+
+// Takes a sample covering the time since the last and requests the RSSI for the next (the
+// reading arrives in the GAP callback)
+static void _btLinkMonSample()
+{
+	bt_link_sample_t smpl;
+	int64_t t = esp_timer_get_time();
+	uint32_t packets;
+	uint32_t min_cycles;
+	uint32_t jitter_cycles;
+	uint32_t expected = 0;
+	uint32_t missed = 0;
+	uint32_t underruns;
+	int rssi_delta;
+	int prev_quality;
+	bool audio;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	packets = bt_link_stats.packets;
+	audio = bt_link_stats.audio_connected;
+	rssi_delta = bt_link_stats.rssi_delta;
+	min_cycles = bt_link_min_cycles;
+	jitter_cycles = bt_link_jitter_cycles;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+	// Audio connections restart the packet count
+	if (packets < bt_link_prev_packets) bt_link_prev_packets = 0;
+	smpl.rx_packets = (uint16_t) (packets - bt_link_prev_packets);
+	
+	// Packets expected at the eSCO interval
+	if (audio && (bt_link_prev_packets != 0) && (min_cycles != 0) && (min_cycles != UINT32_MAX)) {
+		expected = (uint32_t) ((t - bt_link_prev_usec) * CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ / min_cycles);
+		if (expected > smpl.rx_packets) missed = expected - smpl.rx_packets;
+	}
+	
+	audio_get_stats(&bt_link_audio_stats);
+	underruns = bt_link_audio_stats.tx_underruns - bt_link_prev_tx_underruns;
+	bt_link_prev_tx_underruns = bt_link_audio_stats.tx_underruns;
+	
+	smpl.t_sec = (uint32_t) (t / 1000000);
+	smpl.rssi_delta = (int8_t) rssi_delta;
+	smpl.quality = (uint8_t) _btLinkQuality(rssi_delta, expected, missed, underruns);
+	smpl.missed_packets = (uint16_t) missed;
+	smpl.jitter_usec = (uint16_t) ((jitter_cycles >> BT_LINK_JITTER_SHIFT) / CONFIG_ESP32_DEFAULT_CPU_FREQ_MHZ);
+	smpl.tx_underruns = (uint16_t) underruns;
+	
+	bt_link_prev_packets = packets;
+	bt_link_prev_usec = t;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_link_samples[bt_link_sample_next] = smpl;
+	if (++bt_link_sample_next == BT_LINK_MON_SAMPLES) bt_link_sample_next = 0;
+	if (bt_link_sample_count < BT_LINK_MON_SAMPLES) bt_link_sample_count++;
+	bt_link_stats.missed_packets += missed;
+	prev_quality = bt_link_stats.quality;
+	bt_link_stats.quality = smpl.quality;
+	portEXIT_CRITICAL(&bt_stats_mux);
+	_btLinkPublishStatus();
+	
+	if (smpl.quality != prev_quality) {
+		ESP_LOGI(TAG, "Link quality %d: rssi %d, rx %u, missed %u, jitter %u uS, underruns %u", smpl.quality,
+		         rssi_delta, smpl.rx_packets, missed, smpl.jitter_usec, underruns);
+		xTaskNotify(task_handle_gui, GUI_NOTIFY_LINK_QUALITY_MASK, eSetBits);
+	}
+	
+	(void) esp_bt_gap_read_rssi_delta(peer_addr);
+}
+
+
+static int _btLinkQuality(int rssi_delta, uint32_t expected, uint32_t missed, uint32_t tx_underruns)
+{
+	int q = BT_LINK_QUALITY_GOOD;
+	
+	if (rssi_delta < BT_LINK_POOR_RSSI) {
+		q = BT_LINK_QUALITY_POOR;
+	} else if (rssi_delta < 0) {
+		q = BT_LINK_QUALITY_FAIR;
+	}
+	
+	if (expected != 0) {
+		if ((missed * 100) >= (expected * BT_LINK_FAIR_LOSS_PCT)) {
+			q = BT_LINK_QUALITY_POOR;
+		} else if ((((missed * 100) >= (expected * BT_LINK_GOOD_LOSS_PCT)) || (tx_underruns != 0)) &&
+		           (q == BT_LINK_QUALITY_GOOD)) {
+			q = BT_LINK_QUALITY_FAIR;
+		}
+	}
+	
+	return q;
+}
+
+
+// Publish the link and audio counters to the system status (the audio statistics are from the
+// last sample)
+static void _btLinkPublishStatus()
+{
+	bt_link_stats_t ls;
+	sys_status_link_t st;
+	
+	bt_get_link_stats(&ls);
+	st.profile = ls.profile;
+	st.audio_connected = ls.audio_connected;
+	st.msbc = ls.msbc;
+	st.quality = ls.quality;
+	st.rssi_delta = ls.rssi_delta;
+	st.missed_packets = ls.missed_packets;
+	st.jitter_usec = ls.jitter_usec;
+	st.deadline_misses = bt_link_audio_stats.deadline_misses;
+	st.rx_underruns = bt_link_audio_stats.rx_underruns;
+	st.tx_underruns = bt_link_audio_stats.tx_underruns;
+	st.plc_events = bt_link_audio_stats.plc_events;
+	st.jb_concealments = bt_link_audio_stats.jb_concealments;
+	sys_status_publish_link(&st);
+}
+
+
+static void _btPmStart()
+{
+	bt_pm_connected = true;
+	bt_pm_mode_usec = esp_timer_get_time();
+	bt_pm_answer_usec = 0;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_power_stats.sniff = false;
+	portEXIT_CRITICAL(&bt_stats_mux);
+}
+
+
+static void _btPmStop()
+{
+	_btPmModeChange(false);
+	bt_pm_connected = false;
+	bt_pm_answer_usec = 0;
+}
+
+
+// Charge the time since the last change to the mode being left
+static void _btPmModeChange(bool sniff)
+{
+	int64_t now = esp_timer_get_time();
+	uint32_t msec;
+	
+	if (!bt_pm_connected || (sniff == bt_power_stats.sniff)) return;
+	
+	msec = (uint32_t) ((now - bt_pm_mode_usec) / 1000);
+	bt_pm_mode_usec = now;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	if (bt_power_stats.sniff) {
+		bt_power_stats.sniff_msec += msec;
+	} else {
+		bt_power_stats.active_msec += msec;
+	}
+	bt_power_stats.sniff = sniff;
+	if (sniff) bt_power_stats.sniff_entries++;
+	portEXIT_CRITICAL(&bt_stats_mux);
+}
+
+
+// Any AT command is traffic that makes the stack's power manager return the link to active
+// mode so the phone answers the dial request that follows without waiting for a sniff anchor
+static void _btPmWake()
+{
+#if (CONFIG_BT_LINK_SNIFF_WAKE == true)
+	if ((bt_state == BT_CONNECTED_IDLE) && bt_power_stats.sniff) {
+		ESP_LOGI(TAG, "Wake link from sniff");
+		_btAtQueue(BT_AT_CMD_CLCC, 0);
+		
+		portENTER_CRITICAL(&bt_stats_mux);
+		bt_power_stats.wakes++;
+		portEXIT_CRITICAL(&bt_stats_mux);
+	}
 #endif
-	bt_state = s;
 }
 
 
-static void _btHandleNotifications()
+static void _btPmAnswerStart()
 {
-	uint32_t notification_value = 0;
+	bt_pm_answer_usec = esp_timer_get_time();
+	bt_pm_answer_sniff = bt_power_stats.sniff;
+}
+
+
+static void _btPmAnswerDone()
+{
+	uint32_t msec;
+	
+	if (bt_pm_answer_usec == 0) return;
+	
+	msec = (uint32_t) ((esp_timer_get_time() - bt_pm_answer_usec) / 1000);
+	bt_pm_answer_usec = 0;
+	ESP_LOGI(TAG, "Answered in %u mSec (from %s mode)", msec, bt_pm_answer_sniff ? "sniff" : "active");
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_power_stats.answers++;
+	bt_power_stats.answer_msec = msec;
+	if (bt_pm_answer_sniff) {
+		if (msec > bt_power_stats.max_sniff_answer_msec) bt_power_stats.max_sniff_answer_msec = msec;
+	} else {
+		if (msec > bt_power_stats.max_answer_msec) bt_power_stats.max_answer_msec = msec;
+	}
+	portEXIT_CRITICAL(&bt_stats_mux);
+}
+
+
+// Ask for the audio connection when a call is dialed or answered instead of waiting for the
+// phone's own policy to open it.  Skipped if the phone is already opening it.
+static void _btScoRequest()
+{
+#if (CONFIG_BT_HF_SCO_EARLY == true)
+	if (bt_audio_connected || (bt_sco_req_usec != 0)) return;
+	
+	if (bt_sco_connecting) {
+		portENTER_CRITICAL(&bt_stats_mux);
+		bt_power_stats.sco_races++;
+		portEXIT_CRITICAL(&bt_stats_mux);
+		return;
+	}
+	
+	if (esp_hf_client_connect_audio(peer_addr) != ESP_OK) {
+		ESP_LOGE(TAG, "esp_hf_client_connect_audio failed");
+		return;
+	}
+	bt_sco_req_usec = esp_timer_get_time();
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	bt_power_stats.sco_requests++;
+	portEXIT_CRITICAL(&bt_stats_mux);
+#endif
+}
+
+
+// Complete a requested audio connection.  It fails if the phone was opening its own at the
+// same time (the phone's then usually succeeds without our request being retried).
+static void _btScoDone(bool connected)
+{
+	uint32_t msec;
+	
+	if (bt_sco_req_usec == 0) return;
+	
+	msec = (uint32_t) ((esp_timer_get_time() - bt_sco_req_usec) / 1000);
+	bt_sco_req_usec = 0;
+	
+	portENTER_CRITICAL(&bt_stats_mux);
+	if (connected) {
+		bt_power_stats.sco_setup_msec = msec;
+		if (msec > bt_power_stats.max_sco_setup_msec) bt_power_stats.max_sco_setup_msec = msec;
+	} else {
+		bt_power_stats.sco_races++;
+	}
+	portEXIT_CRITICAL(&bt_stats_mux);
+	
+	if (connected) {
+		ESP_LOGI(TAG, "Audio connected %u mSec after request", msec);
+	} else {
+		ESP_LOGW(TAG, "Requested audio connection failed");
+	}
+}
+
+
+static void _btDisconnectedEntry(int from)
+{
+	bt_reconnect_delay_msec = BT_RECONNECT_MIN_MSEC;
+	if (bt_local_disconnect) {
+		// We ended the connection (power down, pairing or forgetting) so don't fight it
+		soft_timer_start(bt_reconnect_timer, _btNextReconnectDelay());
+	} else {
+		// Attempt to reconnect immediately and time how long it takes
+		soft_timer_start(bt_reconnect_timer, 0);
+		bt_disconnect_usec = esp_timer_get_time();
+		portENTER_CRITICAL(&bt_stats_mux);
+		bt_reconnect_stats.disconnects++;
+		portEXIT_CRITICAL(&bt_stats_mux);
+	}
+	
+	// Nothing queued for the old connection is sent on the next
+	_btAtFlush(false);
+	
+	// Make sure the phone can page us
+	esp_bt_gap_set_scan_mode(ESP_BT_CONNECTABLE, bt_discoverable ? ESP_BT_GENERAL_DISCOVERABLE : ESP_BT_NON_DISCOVERABLE);
+	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_OUT_OF_SERVICE);
 	
-	// Handle notifications (clear them upon reading)
-	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, 0)) {
+	// Clear any dangling state if BT connection suddenly disappears
+	if (bt_in_call) {
+		bt_in_call = false;
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_CALL_ENDED);
+	}
+	if (bt_audio_connected) {
+		bt_audio_connected = false;
+		evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_AUDIO_ENDED);
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_AUDIO_DIS_MASK, eSetBits);
+	}
+}
+
+
+static void _btIdleEntry(int from)
+{
+	uint32_t msec;
+	
+	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_IN_SERVICE);
+	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_CALL_ENDED);
+	if (from == BT_DISCONNECTED) {
+		// Tell the cellphone we'll handle echo cancellation when we first get a SLC
+		_btAtQueue(BT_AT_CMD_NREC, 0);
+	}
+	if (from == BT_CALL_INITIATED) {
+		// Hang up any initiated or incoming call
+		_btAtQueue(BT_AT_CMD_HANGUP, 0);
+		_btAtQueue(BT_AT_CMD_VR_STOP, 0);
+	}
+	
+	// No reconnect attempts while connected (we'll immediately try to reconnect if we
+	// become disconnected)
+	soft_timer_stop(bt_reconnect_timer);
+	if ((from == BT_DISCONNECTED) && (bt_disconnect_usec != 0)) {
+		msec = (uint32_t) ((esp_timer_get_time() - bt_disconnect_usec) / 1000);
+		ESP_LOGI(TAG, "Reconnected after %u mSec", msec);
+		portENTER_CRITICAL(&bt_stats_mux);
+		bt_reconnect_stats.reconnects++;
+		bt_reconnect_stats.last_msec = msec;
+		if (msec > bt_reconnect_stats.max_msec) bt_reconnect_stats.max_msec = msec;
+		bt_reconnect_stats.total_msec += msec;
+		portEXIT_CRITICAL(&bt_stats_mux);
+	}
+	bt_disconnect_usec = 0;
+	bt_local_disconnect = false;
+	
+	// A request for audio outstanding when the call ended won't complete
+	bt_sco_req_usec = 0;
+}
+
+
+// The dial (or voice dial) command was queued by the transition's action
+static void _btCallInitiatedEntry(int from)
+{
+	_btScoRequest();
+}
+
+
+static void _btCallActiveEntry(int from)
+{
+	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_BT_CALL_STARTED);
+}
+
+
+static void _btCallActiveExit(int to)
+{
+	// Digits left over from a call are not sent into the next one
+	_btAtFlush(true);
+}
+
+
+static void _btWaitEndEntry(int from)
+{
+	// Hang up any ongoing call
+	_btAtQueue(BT_AT_CMD_HANGUP, 0);
+	_btAtQueue(BT_AT_CMD_VR_STOP, 0);
+}
+
+
+static void _btAnswer()
+{
+	_btPmAnswerStart();
+	_btAtQueue(BT_AT_CMD_ANSWER, 0);
+	_btScoRequest();
+}
+
+
+// Tell the cellphone to reject an incoming (ringing) call
+static void _btReject()
+{
+	_btAtQueue(BT_AT_CMD_HANGUP, 0);
+}
+
+
+static void _btDialNum()
+{
+	_btAtQueue(BT_AT_CMD_DIAL, 0);
+	ESP_LOGI(TAG, "Dial %s", outgoing_phone_num);
+}
+
+
+static void _btDialOper()
+{
+	_btAtQueue(BT_AT_CMD_VR_START, 0);
+	ESP_LOGI(TAG, "Voice Dial");
+}
+
+
+static void _btPostStateChange(int from, int to)
+{
+	bt_state = (bt_stateT) to;
+}
+
+
+// Returns the event for the state machine
+static uint16_t _btHandleEvent(const evt_msg_t* evt)
+{
+	switch (evt->id) {
 		//
-		// Bluetooth stack notifications
+		// Bluetooth stack events
 		//
-		if (Notification(notification_value, BT_NOTIFY_SLC_CON_MASK)) {
+		case BT_EVT_SLC_CON:
+			// Whichever phone connected (we may have been paging another)
+			memcpy(peer_addr, evt->u.str, ESP_BD_ADDR_LEN);
+			for (int i=0; i<PS_BT_MAX_PAIRS; i++) {
+				if (bt_pairs[i].paired && _bt_addr_match(bt_pairs[i].addr, peer_addr)) {
+					strcpy(peer_device_name, bt_pairs[i].name);
+					ESP_LOGI(TAG, "Connected to %s", peer_device_name);
+				}
+			}
 			bt_in_service = true;
-		}
-		if (Notification(notification_value, BT_NOTIFY_SLC_DIS_MASK)) {
+			_btLinkMonStart();
+			_btPmStart();
+			xTaskNotify(task_handle_gcore, GCORE_NOTIFY_TIME_CHECK_REQ_MASK, eSetBits);
+			break;
+		case BT_EVT_SLC_DIS:
 			bt_in_service = false;
-		}
+			bt_call_waiting = false;
+			bt_sco_connecting = false;
+			bt_sco_req_usec = 0;
+			_btLinkMonStop();
+			_btPmStop();
+			break;
 		
-		if (Notification(notification_value, BT_NOTIFY_CALL_ACT_MASK)) {
+		case BT_EVT_CALL_ACT:
 			bt_in_call = true;
-		}
-		if (Notification(notification_value, BT_NOTIFY_CALL_INACT_MASK)) {
+			break;
+		case BT_EVT_CALL_INACT:
 			bt_in_call = false;
-		}
+			break;
 		
-		if (Notification(notification_value, BT_NOTIFY_AUDIO_CON_MASK)) {
+		case BT_EVT_AUDIO_CON:
 			bt_audio_connected = true;
-		}
-		if (Notification(notification_value, BT_NOTIFY_AUDIO_DIS_MASK)) {
+			_btPmAnswerDone();
+			_btScoDone(true);
+			break;
+		case BT_EVT_AUDIO_DIS:
 			bt_audio_connected = false;
-		}
+			_btScoDone(false);
+			break;
+		
+		case BT_EVT_ACL_LINK_LOST:
+			portENTER_CRITICAL(&bt_stats_mux);
+			bt_reconnect_stats.link_losses++;
+			portEXIT_CRITICAL(&bt_stats_mux);
+			
+			// Start over with a fast retry (the phone may be coming back into range)
+			if (!bt_in_service && !bt_local_disconnect) {
+				bt_reconnect_delay_msec = BT_RECONNECT_MIN_MSEC;
+				soft_timer_start(bt_reconnect_timer, 0);
+			}
+			break;
+		
+		case BT_EVT_AUTH_DONE:
+			// Don't immediately try to force a connection as a connection should
+			// be under way as part of the pairing success and we don't want a race condition
+			// that causes a failed connect
+			soft_timer_start(bt_reconnect_timer, BT_PAIR_CONNECT_MSEC);
+			bt_pair_cache_valid = false;
+			break;
+		
+		case BT_EVT_BOND_REMOVED:
+			bt_pair_cache_valid = false;
+			break;
+		
+		case BT_EVT_RECONNECT_TIMER:
+			if (!soft_timer_expired(bt_reconnect_timer)) {
+				return HSM_EVT_NONE;
+			}
+			break;
+		
+		case BT_EVT_AT_RESPONSE:
+			_btAtResponse((int) evt->u.digit);
+			break;
+		
+		case BT_EVT_STACK:
+			// The ring was already emptied by _btStackEvtHandle
+			break;
+		
+		case BT_EVT_AT_TIMER:
+			if (soft_timer_expired(bt_at_timer)) {
+				if (bt_at_in_flight >= 0) {
+					// No response so carry on with the next command
+					ESP_LOGW(TAG, "No response to %s", bt_at_cmd_names[bt_at_in_flight]);
+					portENTER_CRITICAL(&bt_stats_mux);
+					bt_at_stats.cmd[bt_at_in_flight].timeouts++;
+					portEXIT_CRITICAL(&bt_stats_mux);
+					bt_at_in_flight = -1;
+				}
+				_btAtSendNext();
+			}
+			break;
+		
+		case BT_EVT_LINK_MON_TIMER:
+			if (bt_in_service) {
+				_btLinkMonSample();
+			}
+			break;
 		
 		//
-		// gcore_task notifications
-		if (Notification(notification_value, BT_NOFITY_DISCONNECT_MASK)) {
+		// gcore_task events
+		//
+		case BT_EVT_DISCONNECT:
 			// Disconnect if we are powering down 
 			if (bt_in_service) {
+				bt_local_disconnect = true;
 				esp_hf_client_disconnect(peer_addr);
 			}
-		}
+			break;
 		
 		//
-		// app_task notifications
+		// app_task events
 		//
-		if (Notification(notification_value, BT_NOTIFY_ANSWER_CALL_MASK)) {
-			notify_bt_answer = true;
-		}
-		if (Notification(notification_value, BT_NOTIFY_HANGUP_CALL_MASK)) {
-			notify_bt_hangup = true;
-		}
+		case BT_EVT_ANSWER_CALL:
+		case BT_EVT_HANGUP_CALL:
+			// State machine events
+			break;
+		case BT_EVT_LINK_WAKE:
+			_btPmWake();
+			break;
+		case BT_EVT_CALL_SWAP:
+			// Put the active call on hold and take the waiting or held call (AT+CHLD=2)
+			if (!bt_in_service) break;
+			if ((bt_chld_feat & ESP_HF_CHLD_FEAT_HOLD_ACC) == 0) {
+				ESP_LOGW(TAG, "Phone does not support call hold");
+			} else {
+				_btAtQueue(BT_AT_CMD_CHLD, ESP_HF_CHLD_TYPE_HOLD_ACC);
+				ESP_LOGI(TAG, "Swap calls");
+			}
+			break;
+		case BT_EVT_CALL_MERGE:
+			// Three-way conference (AT+CHLD=3), the phone sends both parties in our one audio
+			// connection and our audio to both
+			if (!bt_in_service) break;
+			if ((bt_chld_feat & ESP_HF_CHLD_FEAT_MERGE) == 0) {
+				ESP_LOGW(TAG, "Phone does not support conference calls");
+			} else {
+				_btAtQueue(BT_AT_CMD_CHLD, ESP_HF_CHLD_TYPE_MERGE);
+				ESP_LOGI(TAG, "Conference calls");
+			}
+			break;
 		
-		if (Notification(notification_value, BT_NOTIFY_DIAL_NUM_MASK)) {
-			notify_bt_dial_num = true;
-		}
-		if (Notification(notification_value, BT_NOTIFY_DIAL_OPER_MASK)) {
-			notify_bt_dial_oper = true;
-		}
-		if (Notification(notification_value, BT_NOTIFY_DIAL_DTMF_MASK)) {
+		case BT_EVT_DIAL_NUM:
+			(void) app_get_dial_number(outgoing_phone_num);
+			break;
+		case BT_EVT_DIAL_OPER:
+			break;
+		case BT_EVT_DIAL_DTMF:
+			// Also from audio_task for digits dialed in-band by the phone
 			if (bt_state == BT_CALL_ACTIVE) {
-				esp_hf_client_send_dtmf(outgoing_dtmf_digit);
+				_btAtQueue(BT_AT_CMD_DTMF, evt->u.digit);
 			}
-		}
-		if (Notification(notification_value, BT_NOTIFY_NEW_MIC_GAIN_MASK)) {
+			break;
+		
+		case BT_EVT_NEW_MIC_GAIN:
 			// Get the new mic gain value
 			bt_cur_mic_gain = ps_get_gain(PS_GAIN_MIC);
 			
 			// Update the cellphone immediately if we are in a call
 			if (bt_state == BT_CALL_ACTIVE) {
-				esp_hf_client_volume_update(ESP_HF_VOLUME_CONTROL_TARGET_MIC, gainDB2BT(GAIN_TYPE_MIC, bt_cur_mic_gain));
+				_btAtQueue(BT_AT_CMD_VGM, gainDB2BT(GAIN_TYPE_MIC, bt_cur_mic_gain));
 			}
-		}
-		if (Notification(notification_value, BT_NOTIFY_NEW_SPK_GAIN_MASK)) {
+			break;
+		case BT_EVT_NEW_SPK_GAIN:
 			// Get the new speaker gain value
 			bt_cur_spk_gain = ps_get_gain(PS_GAIN_SPK);
 			
 			// Update the cellphone immediately if we are in a call
 			if (bt_state == BT_CALL_ACTIVE) {
-				esp_hf_client_volume_update(ESP_HF_VOLUME_CONTROL_TARGET_SPK, gainDB2BT(GAIN_TYPE_SPK, bt_cur_spk_gain));
+				_btAtQueue(BT_AT_CMD_VGS, gainDB2BT(GAIN_TYPE_SPK, bt_cur_spk_gain));
 			}
-		}
+			break;
 		
 		//
-		// gui_task notifications
+		// gui_task events
 		//
-		if (Notification(notification_value, BT_NOTIFY_ENABLE_PAIR_MASK)) {
+		case BT_EVT_ENABLE_PAIR:
 			if (bt_in_service) {
 				ESP_LOGI(TAG, "Disconnect client");
+				bt_local_disconnect = true;
 				esp_hf_client_disconnect(peer_addr);
 			}
 			ESP_LOGI(TAG, "Make discoverable");
+			bt_discoverable = true;
+			pwr_mgmt_hold(PWR_MGMT_HOLD_BT_PAIR);
 			esp_bt_gap_set_scan_mode(ESP_BT_CONNECTABLE, ESP_BT_GENERAL_DISCOVERABLE);
-		}
-		if (Notification(notification_value, BT_NOTIFY_DISABLE_PAIR_MASK)) {
+			break;
+		case BT_EVT_DISABLE_PAIR:
 			ESP_LOGI(TAG, "Make not discoverable");
+			bt_discoverable = false;
+			pwr_mgmt_release(PWR_MGMT_HOLD_BT_PAIR);
+			bt_pair_cache_valid = false;          // The GUI has stored any new pairing by now
+			bt_pair_prune = true;
 			esp_bt_gap_set_scan_mode(ESP_BT_CONNECTABLE, ESP_BT_NON_DISCOVERABLE);
-		}
-		if (Notification(notification_value, BT_NOTIFY_FORGET_PAIR_MASK)) {
+			break;
+		case BT_EVT_FORGET_PAIR:
 			if (bt_in_service) {
 				ESP_LOGI(TAG, "Disconnect client");
+				bt_local_disconnect = true;
 				esp_hf_client_disconnect(peer_addr);
 			}
-			(void) esp_bt_gap_remove_bond_device(peer_addr);
-		}
+			_bt_cleanup_bond_info();              // Forgets all the phones
+			bt_pair_cache_valid = false;
+			break;
 		
-		if (Notification(notification_value, BT_NOTIFY_CONFIRM_PIN_MASK)) {
+		case BT_EVT_CONFIRM_PIN:
 			ESP_LOGI(TAG, "Confirm SSP pin");
 #if (CONFIG_BT_SSP_ENABLED == true)
 			esp_bt_gap_ssp_confirm_reply(ssp_pairing_addr, true);
 #endif
-		}
-		if (Notification(notification_value, BT_NOTIFY_DENY_PIN_MASK)) {
+			break;
+		case BT_EVT_DENY_PIN:
 			ESP_LOGI(TAG, "Deny SSP pin");
 #if (CONFIG_BT_SSP_ENABLED == true)
 			esp_bt_gap_ssp_confirm_reply(ssp_pairing_addr, false);
 #endif
-		}
+			break;
+		
+		default:
+			ESP_LOGW(TAG, "Unknown event %d", evt->id);
 	}
+	
+	return evt->id;
 }
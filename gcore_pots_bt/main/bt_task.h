@@ -26,39 +26,186 @@
 #ifndef BT_TASK_H
 #define BT_TASK_H
 
+#include <stdbool.h>
+#include <stdint.h>
+
 //
 // Constants
 //
 
-// Evaluation interval
-#define BT_EVAL_MSEC 20
+// Reconnect attempts to the paired device while bluetooth is disconnected.  The first is
+// immediate when a connection drops and later ones back off exponentially (with random
+// jitter of +/- BT_RECONNECT_JITTER_PCT) from BT_RECONNECT_MIN_MSEC to BT_RECONNECT_MAX_MSEC.
+#define BT_RECONNECT_MIN_MSEC        2000
+#define BT_RECONNECT_MAX_MSEC        60000
+#define BT_RECONNECT_JITTER_PCT      25
+
+// Link power mode.  Bluedroid's device manager puts the idle HF link into sniff mode with
+// its own (fixed) intervals and returns it to active mode for any traffic so we track the
+// mode it reports, wake the link early when the phone goes off-hook and measure how long
+// answering a call takes from each mode.  The audio connection is also requested as soon as
+// a call is dialed or answered (rather than waiting for the phone to open it) and timed.
+typedef struct {
+	bool sniff;                           // Link currently in sniff mode
+	uint32_t sniff_entries;
+	uint32_t sniff_msec;                  // Total time in sniff mode (completed periods)
+	uint32_t active_msec;                 // Total connected time in active mode (completed periods)
+	uint32_t wakes;                       // Off-hook wake requests sent while in sniff mode
+	uint32_t answers;                     // Calls answered (answer to audio connected)
+	uint32_t answer_msec;                 //   latest
+	uint32_t max_answer_msec;             //   longest answered from active mode
+	uint32_t max_sniff_answer_msec;       //   longest answered from sniff mode
+	uint32_t sco_requests;                // Audio connections requested on dial or answer
+	uint32_t sco_races;                   //   not needed or failed as the phone was opening it
+	uint32_t sco_setup_msec;              // Request to audio connected, latest
+	uint32_t max_sco_setup_msec;          //   longest
+} bt_power_stats_t;
+
+// Link quality monitor sample period while connected and the number of samples kept
+#define BT_LINK_MON_MSEC             1000
+#define BT_LINK_MON_SAMPLES          60
+
+// Link quality levels (bt_link_stats_t quality)
+#define BT_LINK_QUALITY_NONE         0   // Not connected
+#define BT_LINK_QUALITY_POOR         1
+#define BT_LINK_QUALITY_FAIR         2
+#define BT_LINK_QUALITY_GOOD         3
+
+// AT commands to the phone are queued and sent one at a time, each after the response to the
+// last (or BT_AT_RSP_TIMEOUT_MSEC).  Call control commands go ahead of queued DTMF digits and
+// volume updates, and a volume update replaces one still waiting.  A DTMF digit (AT+VTS) is
+// followed by BT_DTMF_GAP_MSEC so the phone generates a distinct tone for each.
+#define BT_AT_QUEUE_LEN              32
+#define BT_AT_RSP_TIMEOUT_MSEC       1000
+#define BT_DTMF_GAP_MSEC             70
+
+// AT commands (bt_at_stats_t cmd index)
+#define BT_AT_CMD_ANSWER             0   // ATA
+#define BT_AT_CMD_HANGUP             1   // AT+CHUP (reject or end)
+#define BT_AT_CMD_DIAL               2   // ATD
+#define BT_AT_CMD_VR_START           3   // AT+BVRA=1
+#define BT_AT_CMD_VR_STOP            4   // AT+BVRA=0
+#define BT_AT_CMD_CHLD               5   // AT+CHLD
+#define BT_AT_CMD_DTMF               6   // AT+VTS
+#define BT_AT_CMD_VGM                7   // AT+VGM
+#define BT_AT_CMD_VGS                8   // AT+VGS
+#define BT_AT_CMD_NREC               9   // AT+NREC=0
+#define BT_AT_CMD_CLCC               10  // AT+CLCC
+
+#define BT_AT_NUM_CMDS               11
+
+// Response time histogram bins per command (bin 0 < 32 mSec, each subsequent bin doubles,
+// the last bin holds everything longer)
+#define BT_AT_HIST_BINS              6
+
+// Depth of our event queue (EVT_QUEUE_BT)
+#define BT_EVT_QUEUE_DEPTH           16
+
+// Events sent to EVT_QUEUE_BT (payload in brackets)
+#define BT_EVT_SLC_CON               1   // From the Bluetooth stack event handlers
+#define BT_EVT_SLC_DIS               2
+#define BT_EVT_CALL_ACT              3
+#define BT_EVT_CALL_INACT            4
+#define BT_EVT_AUDIO_CON             5
+#define BT_EVT_AUDIO_DIS             6
+#define BT_EVT_AUTH_DONE             7
+#define BT_EVT_ACL_LINK_LOST         8   // The link to the peer timed out (e.g. out of range)
+#define BT_EVT_BOND_REMOVED          9
+#define BT_EVT_AT_RESPONSE           11  // [esp_hf_at_response_code_t]
+#define BT_EVT_STACK                 12  // From the Bluetooth stack callbacks: the stack event ring has events
 
-// Interval to attempt to reconnect to the specified pairing when bluetooth is disconnected
-#define BT_RECONNECT_MSEC 60000
+#define BT_EVT_DISCONNECT            10  // From gcore_task
+
+#define BT_EVT_ANSWER_CALL           20  // From app_task
+#define BT_EVT_HANGUP_CALL           21
+#define BT_EVT_DIAL_NUM              22  // Number from app_get_dial_number
+#define BT_EVT_DIAL_OPER             23
+#define BT_EVT_DIAL_DTMF             24  // [digit - 0-9, *, #, A-D] (also from audio_task)
+#define BT_EVT_NEW_MIC_GAIN          25  // New gain is in PS
+#define BT_EVT_NEW_SPK_GAIN          26
+#define BT_EVT_LINK_WAKE             27  // Phone off-hook while idle, bring the link out of sniff mode
+#define BT_EVT_CALL_SWAP             28  // Hook flash, hold the active call and take the waiting or held call
+#define BT_EVT_CALL_MERGE            29  // Hook flash then 3, join the held and active calls
+
+#define BT_EVT_ENABLE_PAIR           30  // From gui_task
+#define BT_EVT_DISABLE_PAIR          31
+#define BT_EVT_FORGET_PAIR           32
+#define BT_EVT_CONFIRM_PIN           33
+#define BT_EVT_DENY_PIN              34
+
+#define BT_EVT_RECONNECT_TIMER       40  // Our own software timers
+#define BT_EVT_LINK_MON_TIMER        41
+#define BT_EVT_AT_TIMER              42
+
+// Voice link profiles (bt_link_stats_t profile)
+#define BT_LINK_PROFILE_LOW_LATENCY  0
+#define BT_LINK_PROFILE_ROBUST       1
+
+
+
+//
+// Typedefs
+//
+typedef struct {
+	uint32_t disconnects;                 // Connections lost that we didn't ask to end
+	uint32_t link_losses;                 // Links that timed out
+	uint32_t attempts;                    // Connect attempts made
+	uint32_t reconnects;                  // Connections regained after a disconnect
+	uint32_t last_msec;                   // Disconnect to reconnect time of the latest reconnect
+	uint32_t max_msec;
+	uint32_t total_msec;                  // Sum over all reconnects (average = total / reconnects)
+} bt_reconnect_stats_t;
 
-// Notifications
-#define BT_NOTIFY_SLC_CON_MASK       0x00000001
-#define BT_NOTIFY_SLC_DIS_MASK       0x00000002
-#define BT_NOTIFY_CALL_ACT_MASK      0x00000010
-#define BT_NOTIFY_CALL_INACT_MASK    0x00000020
-#define BT_NOTIFY_AUDIO_CON_MASK     0x00000100
-#define BT_NOTIFY_AUDIO_DIS_MASK     0x00000200
+// Voice link statistics for the current (or last) audio connection.  Bluedroid doesn't
+// report the negotiated eSCO parameters so the packet interval and length are measured
+// from the incoming audio: with no losses the interval is the eSCO interval and gaps longer
+// than it are packets that took retransmissions or were lost.
+typedef struct {
+	int profile;                          // BT_LINK_PROFILE_*
+	bool audio_connected;
+	bool msbc;                            // Negotiated codec (CVSD when clear)
+	uint32_t audio_connections;           // Audio connections since boot
+	uint32_t msbc_connections;            //   of which were mSBC
+	uint32_t packets;                     // Incoming voice packets
+	uint32_t packet_bytes;                // Decoded PCM bytes in the last packet
+	uint32_t avg_interval_usec;           // Average time between packets
+	uint32_t max_interval_usec;           // Longest time between packets
+	uint32_t late_packets;                // Packets arriving more than 1.5 minimum intervals after the last
+	uint32_t missed_packets;              // Packets expected at the minimum interval that never arrived
+	uint32_t jitter_usec;                 // Smoothed packet inter-arrival jitter
+	int rssi_delta;                       // dB outside the controller's golden receive power range (0 within it)
+	int quality;                          // BT_LINK_QUALITY_*
+} bt_link_stats_t;
 
-#define BT_NOFITY_DISCONNECT_MASK    0x00001000
-#define BT_NOTIFY_ANSWER_CALL_MASK   0x00002000
-#define BT_NOTIFY_HANGUP_CALL_MASK   0x00004000
-#define BT_NOTIFY_DIAL_NUM_MASK      0x00010000
-#define BT_NOTIFY_DIAL_OPER_MASK     0x00020000
-#define BT_NOTIFY_DIAL_DTMF_MASK     0x00040000
+// AT commands sent to the phone
+typedef struct {
+	uint32_t sent;                        // Commands issued
+	uint32_t errors;                      // Commands the stack refused or the phone answered with an error
+	uint32_t timeouts;                    // Commands that got no response
+	uint32_t max_msec;                    // Longest response time
+	uint32_t total_msec;                  // Sum of response times (average = total / (sent - timeouts))
+	uint32_t hist[BT_AT_HIST_BINS];       // Response time histogram
+} bt_at_cmd_stats_t;
 
-#define BT_NOTIFY_NEW_MIC_GAIN_MASK  0x00100000
-#define BT_NOTIFY_NEW_SPK_GAIN_MASK  0x00200000
+typedef struct {
+	bt_at_cmd_stats_t cmd[BT_AT_NUM_CMDS];
+	uint32_t queued;                      // Commands accepted
+	uint32_t coalesced;                   // Volume updates that replaced a waiting one
+	uint32_t overflows;                   // Commands dropped with the queue full
+	uint32_t flushed;                     // Commands discarded unsent when the call or connection ended
+	int max_depth;                        // Most commands waiting at once
+} bt_at_stats_t;
 
-#define BT_NOTIFY_ENABLE_PAIR_MASK   0x01000000
-#define BT_NOTIFY_DISABLE_PAIR_MASK  0x02000000
-#define BT_NOTIFY_FORGET_PAIR_MASK   0x04000000
-#define BT_NOTIFY_CONFIRM_PIN_MASK   0x10000000
-#define BT_NOTIFY_DENY_PIN_MASK      0x20000000
+// Link quality monitor sample (one per BT_LINK_MON_MSEC while connected)
+typedef struct {
+	uint32_t t_sec;                       // Uptime
+	int8_t rssi_delta;
+	uint8_t quality;
+	uint16_t rx_packets;                  // Incoming voice packets in the period
+	uint16_t missed_packets;
+	uint16_t jitter_usec;
+	uint16_t tx_underruns;                // audio_task TX ring underruns in the period
+} bt_link_sample_t;
 
 
 
@@ -66,7 +213,11 @@
 // API
 //
 void bt_task(void* args);
-void bt_set_outgoing_number(const char* buf);     // Should be legal phone number
-void bt_set_dtmf_digit(const char d);             // Should be 0-9, *, #, A-D
+void bt_signal_voice_rx_ready();                  // Called by audio_task when a deferred outgoing SCO frame is available
+void bt_get_reconnect_stats(bt_reconnect_stats_t* stats);
+void bt_get_link_stats(bt_link_stats_t* stats);
+void bt_get_at_stats(bt_at_stats_t* stats);
+void bt_get_power_stats(bt_power_stats_t* stats);
+int bt_get_link_samples(bt_link_sample_t* samples, int max);  // Copies up to max samples, oldest first, returns the number
 
 #endif /* BT_TASK_H */
\ No newline at end of file
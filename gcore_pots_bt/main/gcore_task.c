@@ -23,29 +23,34 @@
  */
 #include "esp_log.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "freertos/semphr.h"
+#include "audio_task.h"
+#include "blackbox.h"
+#include "boot_prof.h"
 #include "bt_task.h"
+#include "evt_bus.h"
 #include "gcore_task.h"
 #include "gui_task.h"
 #include "gcore.h"
+#include "pace.h"
 #include "ps.h"
+#include "pwr_mgmt.h"
+#include "pwr_profile.h"
+#include "soft_timer.h"
+#include "sys_mon.h"
+#include "sys_status.h"
 #include "sys_common.h"
 #include "time_utilities.h"
+#include <string.h>
 
 //
 // Constants
 //
 
-// Battery monitoring count
-#define GCORE_BATT_MON_STEPS (GCORE_BATT_MON_MSEC / GCORE_EVAL_MSEC)
-
-// Power state update count
-#define GCORE_UPD_STEPS (GCORE_PWR_UPDATE_MSEC / GCORE_EVAL_MSEC)
-
-// Time check count
-#define GCORE_TIME_CHECK_STEPS (GCORE_TIME_CHECK_MSEC / GCORE_EVAL_MSEC)
+// System monitor samples between console logs (0 to never log)
+#define GCORE_SYS_MON_LOG_STEPS ((CONFIG_SYS_MON_LOG_SECS * 1000) / GCORE_SYS_MON_MSEC)
 
 // Dim steps
 #define GCORE_DIM_STEPS (GUI_DIM_MSEC / GCORE_EVAL_MSEC)
@@ -56,9 +61,10 @@
 #define GCORE_BL_DIMUP  1
 #define GCORE_BL_DIMDN  2
 #define GCORE_BL_DIM    3
+#define GCORE_BL_OFF    4
 
-// Voltage/Current level logging steps
-#define GCORE_LOG_IV_INFO_STEPS (GCORE_LOG_IV_INFO_MSEC / GCORE_EVAL_MSEC)
+// Retry interval of a deferred flash settings write held off by audio
+#define GCORE_PS_AUDIO_RETRY_MSEC 5000
 
 
 
@@ -70,32 +76,61 @@
 static const char* TAG = "gcore_task";
 
 // Power state
-static int batt_mon_count = 0;
-static int gui_update_count = 0;
-static int iv_log_update_count = 0;
-static enum BATT_STATE_t upd_batt_state = BATT_0;
-static enum CHARGE_STATE_t upd_charge_state = CHARGE_OFF;
-static SemaphoreHandle_t power_state_mutex;
+static sys_status_power_t upd_power_state = {BATT_0, CHARGE_OFF};
+
+// Last ESP32 time check against the RTC
+static int64_t time_check_usec = 0;
+
+// Battery monitor sampling
+static uint32_t batt_mon_msec = GCORE_BATT_MON_FAST_MSEC;
+static int batt_stable_count = 0;                   // Samples since the power state changed
+static bool batt_reported = false;                  // GUI has been given the initial state
 
 // Backlight state
 static bool saw_activity = false;
 static bool en_auto_dim;
 static uint8_t backlight_percent;
 
-// Time check state
-static int time_check_count = 0;
+// Software timers - each sets one of our notification bits when it expires
+static int batt_mon_timer;
+static int event_poll_timer;
+static int log_iv_timer;
+static int time_check_timer;
+static int dim_timer;                               // Inactivity before the backlight dims
+static int animate_timer;                           // Runs while the backlight is changing
+static int sys_mon_timer;
+static int ps_commit_timer;
+
+// System monitor state
+static int sys_mon_log_count = 0;
+
+// Sources of the black box snapshot (too big for our stack)
+static sys_mon_snapshot_t bb_sys_snap;
+static audio_stats_t bb_audio_stats;
 
 // Notification flags - set by a notification and consumed/cleared by state evaluation
 static bool notify_poweroff = false;
+static bool notify_batt_mon = false;
+static bool notify_event_poll = false;
+static bool notify_log_iv = false;
+static bool notify_time_check = false;
+static bool notify_dim_timeout = false;
+static bool notify_animate = false;
+static bool notify_sys_mon = false;
+static bool notify_ps_commit = false;
 
 
 
 //
 // Forward declarations for internal functions
 //
+static void _gcoreInitTimers();
 static void _gcoreSanitizeTime();
-static void _gcoreHandleNotifications();
+static void _gcoreHandleNotifications(TickType_t wait_ticks);
 static void _gcoreEvalBacklight();
+static void _gcoreEvalBattRate(const batt_status_t* bs, bool changed);
+static void _gcoreUpdateBlackbox();
+static bool _gcoreAudioRunning();
 
 
 
@@ -105,11 +140,12 @@ static void _gcoreEvalBacklight();
 void gcore_task()
 {
 	batt_status_t cur_batt_status;
+	bool pwr_changed = false;
 	
 	ESP_LOGI(TAG, "Start task");
 	
-	// Power state semaphore
-	power_state_mutex = xSemaphoreCreateMutex();
+	// Until the first battery reading
+	sys_status_publish_power(&upd_power_state);
 	
 	if (!power_init()) {
 		ESP_LOGE(TAG, "Power monitoring init failed");
@@ -117,7 +153,7 @@ void gcore_task()
 		
 		// We need to process notifications to detect attempt to power off
 		while (true) {
-			_gcoreHandleNotifications();
+			_gcoreHandleNotifications(portMAX_DELAY);
 			
 			if (notify_poweroff) {
 				// Try to disable auto-wakeup
@@ -126,8 +162,6 @@ void gcore_task()
 				// Try to power off
 				power_off();
 			}
-			
-			vTaskDelay(pdMS_TO_TICKS(GCORE_EVAL_MSEC));
 		}
 	}
 	
@@ -141,19 +175,28 @@ void gcore_task()
 	time_init();
 	_gcoreSanitizeTime();
 	
+	_gcoreInitTimers();
+	boot_prof_set_ready(BOOT_READY_POWER, "power ready");
+	pace_declare(PACE_ID_GCORE, "gcore", PACE_RESPONSE, PACE_GCORE_USEC);
+	
 	while (true) {
-		// Get any new notifications
-		_gcoreHandleNotifications();
+		// Block until a notification from another task or one of our timers
+		_gcoreHandleNotifications(portMAX_DELAY);
+		pace_start(PACE_ID_GCORE);
 		
 		// Backlight intensity update
 		_gcoreEvalBacklight();
 		
+		// Check for a power event, it gets the full read immediately
+		if (notify_event_poll && !notify_batt_mon && power_event_update()) {
+			notify_batt_mon = true;
+		}
+		
 		// Look for time to get info from gCore
-		if (++batt_mon_count >= GCORE_BATT_MON_STEPS) {
-			batt_mon_count = 0;
+		if (notify_batt_mon || notify_poweroff) {
 			
 			// Update battery values
-			power_batt_update();
+			pwr_changed = power_batt_update() || !batt_reported;
 				
 			// Look for power-off button press
 			if (power_button_pressed() || notify_poweroff) {
@@ -171,7 +214,7 @@ void gcore_task()
 				xTaskNotify(task_handle_gui, GUI_NOTIFY_SCREENDUMP_MASK, eSetBits);
 #else		
 				// Notify bluetooth to disconnect as a courtesy to the remote devcie
-				xTaskNotify(task_handle_bt, BT_NOFITY_DISCONNECT_MASK, eSetBits);
+				evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_DISCONNECT);
 				
 				// Disable auto-wakeup
 				(void) gcore_set_reg8(GCORE_REG_WK_CTRL, 0);
@@ -184,12 +227,16 @@ void gcore_task()
 			
 			// Look for critical battery shutdown
 			power_get_batt(&cur_batt_status);
+			pwr_mgmt_record_load(cur_batt_status.load_ma);
+			pwr_profile_set_power(cur_batt_status.usb_voltage >= POWER_USB_PRESENT_THRESHOLD, cur_batt_status.batt_state);
+			pwr_profile_record_load(cur_batt_status.load_ma);
+			_gcoreEvalBattRate(&cur_batt_status, pwr_changed);
 					
 			if (cur_batt_status.batt_state == BATT_CRIT) {
 				ESP_LOGI(TAG, "Critical battery voltage detected");
 				
 				// Notify bluetooth to disconnect as a courtesy to the remote devcie
-				xTaskNotify(task_handle_bt, BT_NOFITY_DISCONNECT_MASK, eSetBits);
+				evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_DISCONNECT);
 				
 				// Enable auto-wakeup on charge
 				(void) gcore_set_reg8(GCORE_REG_WK_CTRL, GCORE_WK_CHRG_START_MASK);
@@ -200,21 +247,20 @@ void gcore_task()
 			}
 		}
 		
-		// Look for timeout to notify GUI
-		if (++gui_update_count >= GCORE_UPD_STEPS) {
-			gui_update_count = 0;
-					
-			xSemaphoreTake(power_state_mutex, portMAX_DELAY);
-			upd_batt_state = cur_batt_status.batt_state;
-			upd_charge_state = cur_batt_status.charge_state;
-			xSemaphoreGive(power_state_mutex);
+		// Only notify the GUI when the battery level or charge state changes
+		if (pwr_changed) {
+			pwr_changed = false;
+			batt_reported = true;
+			
+			upd_power_state.batt_state = cur_batt_status.batt_state;
+			upd_power_state.charge_state = cur_batt_status.charge_state;
+			sys_status_publish_power(&upd_power_state);
 			
 			xTaskNotify(task_handle_gui, GUI_NOTIFY_POWER_UPDATE_MASK, eSetBits);
 		}
 		
 		// Occasionally log power info
-		if (++iv_log_update_count >= GCORE_LOG_IV_INFO_STEPS) {
-			iv_log_update_count = 0;
+		if (notify_log_iv) {
 			ESP_LOGI(TAG, "Vusb: %1.2fv, Iusb: %dmA, Vbatt: %1.2fv, Iload: %dmA, Chg: %d",
 					 cur_batt_status.usb_voltage, cur_batt_status.usb_ma,
 					 cur_batt_status.batt_voltage, cur_batt_status.load_ma, 
@@ -225,26 +271,49 @@ void gcore_task()
 		// this because it seems at least with IDF v4.4.4, the ESP32 software clock may
 		// lose time with Bluetooth running but on the edge of connectivity with the phone.
 		// So we trust the RTC to be the accurate source.
-		if (++time_check_count >= GCORE_TIME_CHECK_STEPS) {
-			time_check_count = 0;
+		if (notify_time_check) {
 			int dt = time_delta();
+			time_check_usec = esp_timer_get_time();
 			if (abs(dt) >= GCORE_TIME_CHECK_THRESH_SEC) {
 				ESP_LOGE(TAG, "Correcting ESP32 time (delta = %d)", dt);
 				time_init();
 			}
 		}
 		
-		vTaskDelay(pdMS_TO_TICKS(GCORE_EVAL_MSEC));
+		// Task and heap telemetry for the System screen and console
+		if (notify_sys_mon) {
+			if ((GCORE_SYS_MON_LOG_STEPS != 0) && (++sys_mon_log_count >= GCORE_SYS_MON_LOG_STEPS)) {
+				sys_mon_log_count = 0;
+				sys_mon_sample(true);
+			} else {
+				sys_mon_sample(false);
+			}
+			_gcoreUpdateBlackbox();
+		}
+		
+		// Deferred persistent storage write.  Flash writes wait for audio to stop since each
+		// program or erase stalls the flash cache under audio_task.
+		if (notify_ps_commit) {
+			if (ps_commit_to_flash() && _gcoreAudioRunning()) {
+				soft_timer_start(ps_commit_timer, GCORE_PS_AUDIO_RETRY_MSEC);
+			} else {
+				(void) ps_commit();
+			}
+		}
+		
+		pace_checkin(PACE_ID_GCORE);
 	}
 }
 
 
+// Reads the published system status (sys_status) so it never waits on gcore_task
 void gcore_get_power_state(enum BATT_STATE_t* bs, enum CHARGE_STATE_t* cs)
 {
-	xSemaphoreTake(power_state_mutex, portMAX_DELAY);
-	*bs = upd_batt_state;
-	*cs = upd_charge_state;
-	xSemaphoreGive(power_state_mutex);
+	sys_status_power_t ps;
+	
+	sys_status_get_power(&ps);
+	*bs = (enum BATT_STATE_t) ps.batt_state;
+	*cs = (enum CHARGE_STATE_t) ps.charge_state;
 }
 
 
@@ -252,6 +321,61 @@ void gcore_get_power_state(enum BATT_STATE_t* bs, enum CHARGE_STATE_t* cs)
 //
 // Internal functions
 //
+static void _gcoreInitTimers()
+{
+	batt_mon_timer = soft_timer_create_notify("gcore_batt", &task_handle_gcore, GCORE_NOTIFY_BATT_MON_MASK);
+	event_poll_timer = soft_timer_create_notify("gcore_event", &task_handle_gcore, GCORE_NOTIFY_EVENT_POLL_MASK);
+	log_iv_timer = soft_timer_create_notify("gcore_log", &task_handle_gcore, GCORE_NOTIFY_LOG_IV_MASK);
+	time_check_timer = soft_timer_create_notify("gcore_time", &task_handle_gcore, GCORE_NOTIFY_TIME_CHECK_MASK);
+	dim_timer = soft_timer_create_notify("gcore_dim", &task_handle_gcore, GCORE_NOTIFY_DIM_TIMER_MASK);
+	animate_timer = soft_timer_create_notify("gcore_animate", &task_handle_gcore, GCORE_NOTIFY_ANIMATE_MASK);
+	sys_mon_timer = soft_timer_create_notify("gcore_sys_mon", &task_handle_gcore, GCORE_NOTIFY_SYS_MON_MASK);
+	ps_commit_timer = soft_timer_create_notify("gcore_ps", &task_handle_gcore, GCORE_NOTIFY_PS_COMMIT_MASK);
+	
+	if ((batt_mon_timer == SOFT_TIMER_INVALID) || (event_poll_timer == SOFT_TIMER_INVALID) ||
+	    (log_iv_timer == SOFT_TIMER_INVALID) || (time_check_timer == SOFT_TIMER_INVALID) ||
+	    (dim_timer == SOFT_TIMER_INVALID) || (animate_timer == SOFT_TIMER_INVALID) ||
+	    (sys_mon_timer == SOFT_TIMER_INVALID) || (ps_commit_timer == SOFT_TIMER_INVALID)) {
+	    
+		ESP_LOGE(TAG, "Create timers failed");
+	}
+	
+	// Settings updates are written to gCore RAM from this task after they settle
+	ps_set_commit_timer(ps_commit_timer);
+	
+	soft_timer_start_periodic(batt_mon_timer, batt_mon_msec);
+	soft_timer_start_periodic(event_poll_timer, GCORE_EVENT_POLL_MSEC);
+	soft_timer_start_periodic(log_iv_timer, GCORE_LOG_IV_INFO_MSEC);
+	soft_timer_start_periodic(time_check_timer, GCORE_TIME_CHECK_MSEC);
+	soft_timer_start_periodic(sys_mon_timer, GCORE_SYS_MON_MSEC);
+	if (en_auto_dim) soft_timer_start(dim_timer, GUI_INACTIVITY_TO_MSEC);
+}
+
+
+// Sample slowly only on external power once nothing has changed for a while
+static void _gcoreEvalBattRate(const batt_status_t* bs, bool changed)
+{
+	uint32_t msec;
+	
+	if (changed) {
+		batt_stable_count = 0;
+	} else if (batt_stable_count < GCORE_BATT_STABLE_SAMPLES) {
+		batt_stable_count++;
+	}
+	
+	if ((bs->usb_voltage >= POWER_USB_PRESENT_THRESHOLD) && (batt_stable_count >= GCORE_BATT_STABLE_SAMPLES)) {
+		msec = GCORE_BATT_MON_SLOW_MSEC;
+	} else {
+		msec = GCORE_BATT_MON_FAST_MSEC;
+	}
+	
+	if (msec != batt_mon_msec) {
+		batt_mon_msec = msec;
+		soft_timer_start_periodic(batt_mon_timer, msec);
+	}
+}
+
+
 static void _gcoreSanitizeTime()
 {
 	tmElements_t tm;
@@ -274,15 +398,23 @@ static void _gcoreSanitizeTime()
 }
 
 
-static void _gcoreHandleNotifications()
+static void _gcoreHandleNotifications(TickType_t wait_ticks)
 {
 	uint32_t notification_value = 0;
 	
 	// Clear notification flags
 	notify_poweroff = false;
+	notify_batt_mon = false;
+	notify_event_poll = false;
+	notify_log_iv = false;
+	notify_time_check = false;
+	notify_dim_timeout = false;
+	notify_animate = false;
+	notify_sys_mon = false;
+	notify_ps_commit = false;
 	
-	// Handle notifications (clear them upon reading)
-	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, 0)) {
+	// Handle notifications (clear them upon reading), blocking up to wait_ticks for one
+	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, wait_ticks)) {
 		if (Notification(notification_value, GCORE_NOTIFY_SHUTOFF_MASK)) {
 			notify_poweroff = true;
 		}
@@ -293,6 +425,49 @@ static void _gcoreHandleNotifications()
 		
 		if (Notification(notification_value, GCORE_NOTIFY_BRGHT_UPD_MASK)) {
 			ps_get_brightness_info(&backlight_percent, &en_auto_dim);
+			
+			// Changed from the GUI so also counts as activity (restarting the dim timer)
+			saw_activity = true;
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_BATT_MON_MASK)) {
+			notify_batt_mon = true;
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_EVENT_POLL_MASK)) {
+			notify_event_poll = true;
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_LOG_IV_MASK)) {
+			notify_log_iv = true;
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_TIME_CHECK_MASK)) {
+			notify_time_check = true;
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_TIME_CHECK_REQ_MASK)) {
+			if ((time_check_usec == 0) ||
+			    ((esp_timer_get_time() - time_check_usec) >= ((int64_t) GCORE_TIME_CHECK_MIN_MSEC * 1000))) {
+				notify_time_check = true;
+			}
+		}
+		
+		// Ignore an expiration from before the timer was last restarted
+		if (Notification(notification_value, GCORE_NOTIFY_DIM_TIMER_MASK)) {
+			notify_dim_timeout = soft_timer_expired(dim_timer);
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_ANIMATE_MASK)) {
+			notify_animate = true;
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_SYS_MON_MASK)) {
+			notify_sys_mon = true;
+		}
+		
+		if (Notification(notification_value, GCORE_NOTIFY_PS_COMMIT_MASK)) {
+			notify_ps_commit = soft_timer_expired(ps_commit_timer);
 		}
 	}
 }
@@ -301,7 +476,6 @@ static void _gcoreHandleNotifications()
 static void _gcoreEvalBacklight()
 {
 	static int bl_state = GCORE_BL_NORMAL;
-	static int auto_dim_timer = 0;
 	static float animate_val;
 	static float animate_delta;
 	static uint8_t cur_bl_val = 0;
@@ -315,51 +489,70 @@ static void _gcoreEvalBacklight()
 			}
 			
 			// Evaluate transition to dim if enabled
-			if (en_auto_dim) {
-				if (saw_activity) {
-					// Hold timer in reset
-					saw_activity = false;
-					auto_dim_timer = 0;
-				} else {
-					auto_dim_timer += GCORE_EVAL_MSEC;
-					if (auto_dim_timer >= GUI_INACTIVITY_TO_MSEC) {
-						// Setup to dim
-						bl_state = GCORE_BL_DIMDN;
-						animate_val = (float) backlight_percent;
-						animate_delta = (float) ((GUI_BL_DIM_PERCENT - backlight_percent) / GCORE_DIM_STEPS);
-					}
-				}
+			if (!en_auto_dim) {
+				soft_timer_stop(dim_timer);
+			} else if (saw_activity) {
+				// Restart the inactivity timer
+				saw_activity = false;
+				soft_timer_start(dim_timer, GUI_INACTIVITY_TO_MSEC);
+			} else if (notify_dim_timeout) {
+				// Setup to dim
+				bl_state = GCORE_BL_DIMDN;
+				animate_val = (float) backlight_percent;
+				animate_delta = (float) ((GUI_BL_DIM_PERCENT - backlight_percent) / GCORE_DIM_STEPS);
+				soft_timer_start_periodic(animate_timer, GCORE_EVAL_MSEC);
 			}
 			break;
 		
 		case GCORE_BL_DIMUP:
+			if (!notify_animate) break;
 			animate_val += animate_delta;
 			cur_bl_val = (uint8_t) animate_val;
 			if (cur_bl_val >= backlight_percent) {
 				bl_state = GCORE_BL_NORMAL;
-				auto_dim_timer = 0;
+				soft_timer_stop(animate_timer);
+				soft_timer_start(dim_timer, GUI_INACTIVITY_TO_MSEC);
 				if (cur_bl_val != backlight_percent) cur_bl_val = backlight_percent;
 			}
 			power_set_brightness(cur_bl_val);
 			break;
 		
 		case GCORE_BL_DIMDN:
+			if (!notify_animate) break;
 			animate_val += animate_delta;
 			cur_bl_val = (uint8_t) animate_val;
 			if (cur_bl_val <= GUI_BL_DIM_PERCENT) {
 				bl_state = GCORE_BL_DIM;
+				soft_timer_stop(animate_timer);
 				if (cur_bl_val < GUI_BL_DIM_PERCENT) cur_bl_val = GUI_BL_DIM_PERCENT;
+				
+				// Let gui_task slow down while nobody is looking
+				xTaskNotify(task_handle_gui, GUI_NOTIFY_DISP_IDLE_MASK, eSetBits);
+				
+				if (CONFIG_GUI_DISP_OFF_SECS > 0) {
+					soft_timer_start(dim_timer, CONFIG_GUI_DISP_OFF_SECS * 1000);
+				}
 			}
 			power_set_brightness(cur_bl_val);
 			break;
 		
 		case GCORE_BL_DIM:
+		case GCORE_BL_OFF:
 			if (saw_activity) {
 				// Setup to brighten
 				saw_activity = false;
+				soft_timer_stop(dim_timer);
 				bl_state = GCORE_BL_DIMUP;
-				animate_val = GUI_BL_DIM_PERCENT;
-				animate_delta = (float) ((backlight_percent - GUI_BL_DIM_PERCENT) / GCORE_BRT_STEPS);
+				xTaskNotify(task_handle_gui, GUI_NOTIFY_DISP_WAKE_MASK, eSetBits);
+				animate_val = (float) cur_bl_val;
+				animate_delta = (float) ((backlight_percent - cur_bl_val) / GCORE_BRT_STEPS);
+				soft_timer_start_periodic(animate_timer, GCORE_EVAL_MSEC);
+			} else if ((bl_state == GCORE_BL_DIM) && notify_dim_timeout) {
+				// Turn the backlight off and have gui_task put the display to sleep
+				bl_state = GCORE_BL_OFF;
+				cur_bl_val = 0;
+				power_set_brightness(cur_bl_val);
+				xTaskNotify(task_handle_gui, GUI_NOTIFY_DISP_OFF_MASK, eSetBits);
 			}
 			break;
 		
@@ -368,3 +561,46 @@ static void _gcoreEvalBacklight()
 			power_set_brightness(backlight_percent);
 	}
 }
+
+
+static void _gcoreUpdateBlackbox()
+{
+	blackbox_snapshot_t s;
+	
+	sys_mon_get_snapshot(&bb_sys_snap);
+	audio_get_stats(&bb_audio_stats);
+	
+	memset(&s, 0, sizeof(blackbox_snapshot_t));
+	s.uptime_msec = esp_log_timestamp();
+	s.int_free = bb_sys_snap.int_free;
+	s.int_min_free = bb_sys_snap.int_min_free;
+	s.int_largest = bb_sys_snap.int_largest;
+	s.spiram_free = bb_sys_snap.spiram_free;
+	s.spiram_min_free = bb_sys_snap.spiram_min_free;
+	if (bb_sys_snap.num_tasks > 0) {
+		strncpy(s.low_stack_task, bb_sys_snap.task[0].name, BLACKBOX_TASK_NAME_LEN);
+		s.low_stack_free = bb_sys_snap.task[0].stack_free;
+	}
+	s.deadline_misses = bb_audio_stats.deadline_misses;
+	s.max_rx_gap_cycles = bb_audio_stats.max_rx_gap_cycles;
+	s.rx_overflows = bb_audio_stats.rx_overflows;
+	s.rx_underruns = bb_audio_stats.rx_underruns;
+	s.tx_overflows = bb_audio_stats.tx_overflows;
+	s.tx_underruns = bb_audio_stats.tx_underruns;
+	s.i2s_errors = bb_audio_stats.i2s_rx_overflows + bb_audio_stats.i2s_tx_underflows + bb_audio_stats.i2s_dma_errors;
+	s.plc_events = bb_audio_stats.plc_events;
+	s.jb_concealments = bb_audio_stats.jb_concealments;
+	s.lec_budget_level = bb_audio_stats.lec_budget_level;
+	s.frame_load_peak_pct = bb_audio_stats.frame_load_peak_pct;
+	
+	blackbox_set_snapshot(&s);
+}
+
+
+static bool _gcoreAudioRunning()
+{
+	audio_load_t load;
+	
+	audio_get_load(&load);
+	return load.enabled;
+}
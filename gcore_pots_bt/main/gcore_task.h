@@ -32,23 +32,36 @@
 // Constants
 //
 
-// Task evaluation period (mSec)
+// Backlight dimming animation step period (mSec)
 #define GCORE_EVAL_MSEC                 50
 
-// Battery monitoring interval
-#define GCORE_BATT_MON_MSEC             250
+// Power event poll interval.  gCore has no interrupt output to the ESP32 (its wakeup bits only
+// power the board back on) so a power button press (latched by gCore until STATUS is read) or
+// a charge or SD card change is found by reading just the STATUS and GPIO registers.  The full
+// battery register block is only read when one of them changes and by the monitoring below.
+#define GCORE_EVENT_POLL_MSEC           250
+
+// Battery monitoring interval - fast while running from the battery or while the power
+// state is changing, slow on external power once it has been stable for
+// GCORE_BATT_STABLE_SAMPLES samples.
+#define GCORE_BATT_MON_FAST_MSEC        1000
+#define GCORE_BATT_MON_SLOW_MSEC        5000
+#define GCORE_BATT_STABLE_SAMPLES       20
 
 // Button power-off press detection threshold (mSec)
 #define GCORE_BTN_THRESH_MSEC           200
 
-// GUI Power status update rate (mSec)
-#define GCORE_PWR_UPDATE_MSEC           (1 * 1000)
-
 // Voltage/Current level logging rate (mSec)
 #define GCORE_LOG_IV_INFO_MSEC          (60 * 1000)
 
-// Time check from RTC rate (mSec)
-#define GCORE_TIME_CHECK_MSEC           (3600 * 1000)
+// Time check from RTC rate (mSec).  The ESP32 time is mostly checked when other tasks request
+// it (a phone connecting or calling) so the periodic check is only a backstop.  Requests are
+// ignored within GCORE_TIME_CHECK_MIN_MSEC of the last check (a ring arrives every few seconds).
+#define GCORE_TIME_CHECK_MSEC           (24 * 3600 * 1000)
+#define GCORE_TIME_CHECK_MIN_MSEC       (60 * 1000)
+
+// System monitor sample rate (mSec)
+#define GCORE_SYS_MON_MSEC              (2 * 1000)
 
 // Time check error threshold (sec)
 #define GCORE_TIME_CHECK_THRESH_SEC     10
@@ -57,6 +70,17 @@
 #define GCORE_NOTIFY_SHUTOFF_MASK       0x00000002
 #define GCORE_NOTIFY_ACTIVITY_MASK      0x00000001
 #define GCORE_NOTIFY_BRGHT_UPD_MASK     0x00000004
+#define GCORE_NOTIFY_TIME_CHECK_REQ_MASK 0x00000008
+
+// Notifications from our own timers
+#define GCORE_NOTIFY_BATT_MON_MASK      0x00000100
+#define GCORE_NOTIFY_EVENT_POLL_MASK    0x00000200
+#define GCORE_NOTIFY_LOG_IV_MASK        0x00000400
+#define GCORE_NOTIFY_TIME_CHECK_MASK    0x00000800
+#define GCORE_NOTIFY_DIM_TIMER_MASK     0x00001000
+#define GCORE_NOTIFY_ANIMATE_MASK       0x00002000
+#define GCORE_NOTIFY_SYS_MON_MASK       0x00004000
+#define GCORE_NOTIFY_PS_COMMIT_MASK     0x00008000
 
 
 
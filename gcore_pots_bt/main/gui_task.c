@@ -22,15 +22,22 @@
  *
  */
 #include "app_task.h"
+#include "audio_task.h"
+#include "boot_prof.h"
 #include "bt_task.h"
+#include "evt_bus.h"
 #include "gcore_task.h"
 #include "gui_task.h"
+#include "pace.h"
+#include "pwr_mgmt.h"
+#include "pwr_profile.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "esp_heap_caps.h"
 #include "esp_system.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "esp_gap_bt_api.h"
-#include "esp_freertos_hooks.h"
 #include "sys_common.h"
 #include "disp_spi.h"
 #include "disp_driver.h"
@@ -38,9 +45,16 @@
 #include "gui_screen_main.h"
 #include "gui_screen_settings.h"
 #include "gui_screen_time.h"
+#include "gui_screen_diag.h"
+#include "gui_screen_sys.h"
+#include "gui_screen_msgs.h"
+#include "gui_img_rle.h"
 #include "gui_utilities.h"
+#include "stress.h"
+#include "systrace.h"
 #if (CONFIG_SCREENDUMP_ENABLE == true)
 #include "mem_fb.h"
+#include "esp_rom_crc.h"
 #endif
 
 
@@ -49,6 +63,54 @@
 // GUI Task internal constants
 //
 
+// Screendump framing - run-length encoded pixel bytes (tools/screendump.py) are base64 encoded
+// in console lines of GUI_DUMP_LINE_BYTES each, yielding every GUI_DUMP_YIELD_LINES lines so
+// the idle task still runs while the console blocks
+#define GUI_DUMP_LINE_BYTES      96
+#define GUI_DUMP_YIELD_LINES     16
+#define GUI_DUMP_MAX_RUN         128
+
+// Secondary screens are deleted after being hidden this long (0 to keep them once created)
+#define GUI_SCREEN_TEARDOWN_MSEC (CONFIG_GUI_SCREEN_TEARDOWN_SECS * 1000)
+
+// Screen teardown check interval
+#define GUI_TEARDOWN_EVAL_MSEC   1000
+
+// Screen snapshots - the image each screen last had on the display is kept in PSRAM (for up to
+// CONFIG_GUI_SCREEN_SNAPSHOTS screens) and sent to the display in one burst when it is shown
+// again.  LVGL's full redraw of the screen then only sends the tiles that have changed since.
+#if (CONFIG_GUI_DISP_DIFF_FLUSH == true) && (CONFIG_GUI_SCREEN_SNAPSHOTS > 0)
+#define GUI_SNAPSHOTS            CONFIG_GUI_SCREEN_SNAPSHOTS
+#else
+#define GUI_SNAPSHOTS            0
+#endif
+#define GUI_SNAPSHOT_BYTES       (LV_HOR_RES_MAX * LV_VER_RES_MAX * sizeof(lv_color_t))
+
+// Longest gui_task blocks between LVGL runs while the display is in use (LVGL's own tasks
+// normally wake it sooner) and the event handler sub-task's backstop period (it is made
+// ready when a notification arrives)
+#define GUI_MAX_WAIT_MSEC        1000
+#define GUI_EVENT_BACKSTOP_MSEC  1000
+
+// Touch activity is reported to gcore_task at most this often while the display is touched
+#define GUI_ACTIVITY_MSEC        500
+
+// While the backlight is dimmed LVGL only runs at the redraw interval and the
+// touchscreen is polled directly at the poll interval
+#define GUI_IDLE_REDRAW_MSEC     1000
+#define GUI_IDLE_POLL_MSEC       100
+
+// Refresh governor evaluation interval, how recently the display must have been touched
+// to count as in use and how long redraws stay deferred after audio was last stressed
+#define GUI_GOV_EVAL_MSEC        250
+#define GUI_GOV_TOUCH_MSEC       2000
+#define GUI_GOV_DEFER_HOLD_MSEC  2000
+
+// Notifications that end the idle state immediately (they need the user's attention)
+#define GUI_IDLE_WAKE_MASK       (GUI_NOTIFY_DISP_WAKE_MASK | GUI_NOTIFY_NEW_SSP_PIN_MASK | \
+                                  GUI_NOTIFY_BT_AUTH_FAIL_MASK | GUI_NOTIFY_MESSAGEBOX_MASK | \
+                                  GUI_NOTIFY_SCREENDUMP_MASK)
+
 
 //
 // GUI Task variables
@@ -67,27 +129,75 @@ static lv_disp_drv_t lvgl_disp_drv;
 // Touchscreen driver
 static lv_indev_drv_t lvgl_indev_drv;
 
-// Screen object array and current screen index
-static lv_obj_t* gui_screens[GUI_NUM_SCREENS];
+// Screen object array (NULL for screens not yet created) and current screen index
+static COLD_ATTR lv_obj_t* gui_screens[GUI_NUM_SCREENS];
 static int gui_cur_screen_index = -1;
 
+// Screen functions indexed by GUI_SCREEN_* (destroy is NULL for screens kept for good)
+typedef struct {
+	lv_obj_t* (*create)();
+	void (*set_active)(bool en);
+	bool (*destroy)();
+} gui_screen_ops_t;
+
+static const gui_screen_ops_t gui_screen_ops[GUI_NUM_SCREENS] = {
+	{gui_screen_main_create,     gui_screen_main_set_active,     NULL},
+	{gui_screen_settings_create, gui_screen_settings_set_active, gui_screen_settings_destroy},
+	{gui_screen_time_create,     gui_screen_time_set_active,     gui_screen_time_destroy},
+	{gui_screen_diag_create,     gui_screen_diag_set_active,     gui_screen_diag_destroy},
+	{gui_screen_sys_create,      gui_screen_sys_set_active,      gui_screen_sys_destroy},
+	{gui_screen_msgs_create,     gui_screen_msgs_set_active,     gui_screen_msgs_destroy}
+};
+
+// LVGL tick when each screen was last hidden
+static uint32_t gui_screen_hidden_tick[GUI_NUM_SCREENS];
+
+#if (GUI_SNAPSHOTS > 0)
+// Snapshot buffers (NULL for screens without one) and whether each holds the screen's image
+static lv_color_t* gui_snapshot_buf[GUI_NUM_SCREENS];
+static bool gui_snapshot_valid[GUI_NUM_SCREENS];
+static int gui_snapshot_count = 0;
+#endif
+
 // Event handling sub-task
 static lv_task_t* gui_event_subtask;
 static lv_task_t* gui_activity_subtask;
 static lv_task_t* gui_messagebox_subtask;
+static lv_task_t* gui_teardown_subtask;
+static lv_task_t* gui_governor_subtask;
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+static lv_task_t* gui_stress_subtask;
+static bool gui_stress_started = false;          // bt_task starts the test once Bluetooth would be up
+#endif
+
+// Refresh governor state
+static uint32_t gui_gov_prev_misses = 0;
+static uint32_t gui_gov_stress_tick = 0;
+static bool gui_gov_stressed = false;
+
+// Render statistics (only accessed in gui_task)
+static gui_render_stats_t gui_render_stats;
+static uint64_t gui_render_total_msec = 0;
 
 // Request to display message box
 static bool req_message_box = false;
 
+// Set while gcore_task has the backlight dimmed (or off)
+static bool gui_disp_idle = false;
+static bool gui_disp_off = false;
+
+// Notifications received while idle, held for the next redraw
+static uint32_t gui_held_notifications = 0;
+
 // Values updated asynchronously by another task
 static float gui_new_mic_gain;
 static float gui_new_spk_gain;
 static uint32_t gui_new_ssp_pin;
 static uint8_t gui_new_peer_addr[6];
-static char gui_new_peer_name[ESP_BT_GAP_MAX_BDNAME_LEN+1];
+static COLD_ATTR char gui_new_peer_name[ESP_BT_GAP_MAX_BDNAME_LEN+1];
 
 // Buffer for composing message box strings
-static char msgbox_buf[64];
+static COLD_ATTR char msgbox_buf[64];
 
 
 
@@ -97,12 +207,32 @@ static char msgbox_buf[64];
 static void _gui_lvgl_init();
 static void _gui_screen_init();
 static void _gui_add_subtasks();
+static void _gui_active_eval();
+static void _gui_idle_eval();
+static void _gui_eval_disp_power();
+static bool _gui_touch_read(lv_indev_drv_t* drv, lv_indev_data_t* data);
+static void _gui_req_message_box();
 static void _gui_event_handler_task(lv_task_t* task);
 static void _gui_activity_handler_task(lv_task_t* task);
 static void _gui_task_messagebox_handler_task(lv_task_t * task);
-static void IRAM_ATTR _lv_tick_callback();
+static void _gui_teardown_handler_task(lv_task_t* task);
+#if (GUI_SNAPSHOTS > 0)
+static void _gui_snapshot_save(int n, int next);
+static bool _gui_snapshot_show(int n);
+#endif
+static void _gui_governor_task(lv_task_t* task);
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+static void _gui_stress_task(lv_task_t* task);
+#endif
+static void _gui_set_frame_msec(int msec);
+static void _gui_monitor_cb(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px);
+#if (CONFIG_SYSTRACE_ENABLE == true)
+static void _gui_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_map);
+#endif
 #if (CONFIG_SCREENDUMP_ENABLE == true)
 static void _gui_do_screendump();
+static void _gui_dump_put(const uint8_t* buf, int len);
+static void _gui_dump_flush(bool all);
 #endif
 
 
@@ -117,28 +247,63 @@ void gui_task()
 
 	// Initialize
 	_gui_lvgl_init();
+	boot_prof_mark("lvgl");
 	_gui_screen_init();
 	_gui_add_subtasks();
 	
-	// Set the initially displayed screen
+	// Set the initially displayed screen and draw it
 	gui_set_screen(GUI_SCREEN_MAIN);
+	lv_task_handler();
+	boot_prof_set_ready(BOOT_READY_GUI, "gui ready");
 	
 	while (1) {
-		vTaskDelay(pdMS_TO_TICKS(GUI_TASK_EVAL_MSEC));
-		lv_task_handler();
+		// Animations and touch response need the full CPU speed while the display is in use
+		if (gui_disp_idle) {
+			pwr_mgmt_release(PWR_MGMT_HOLD_GUI);
+		} else {
+			pwr_mgmt_hold(PWR_MGMT_HOLD_GUI);
+		}
+		
+		_gui_eval_disp_power();
+		if (gui_disp_idle) {
+			_gui_idle_eval();
+		} else {
+			_gui_active_eval();
+		}
 	}
 }
 
 
 void gui_set_screen(int n)
 {
+	int i;
+	
 	if ((n < GUI_NUM_SCREENS) && (n != gui_cur_screen_index)) {
+		// Secondary screens are built the first time they are displayed
+		if (gui_screens[n] == NULL) {
+			gui_screens[n] = gui_screen_ops[n].create();
+		}
+		
+		if (gui_cur_screen_index >= 0) {
+			gui_screen_hidden_tick[gui_cur_screen_index] = lv_tick_get();
+#if (GUI_SNAPSHOTS > 0)
+			_gui_snapshot_save(gui_cur_screen_index, n);
+#endif
+		}
 		gui_cur_screen_index = n;
 		
-		gui_screen_main_set_active(n == GUI_SCREEN_MAIN);
-		gui_screen_settings_set_active(n == GUI_SCREEN_SETTINGS);
-		gui_screen_time_set_active(n == GUI_SCREEN_TIME);
+		for (i=0; i<GUI_NUM_SCREENS; i++) {
+			if (gui_screens[i] != NULL) {
+				gui_screen_ops[i].set_active(i == n);
+			}
+		}
 		
+#if (GUI_SNAPSHOTS > 0)
+		// Put the screen's last image up immediately, its redraw only updates what changed
+		if (_gui_snapshot_show(n)) {
+			gui_render_stats.snapshot_shows++;
+		}
+#endif
 		lv_scr_load(gui_screens[n]);
 	}
 }
@@ -155,9 +320,9 @@ void gui_set_msgbox_btn(int id, uint16_t btn)
 		
 		case GUI_MSGBOX_BT_SSP:
 			if (btn == GUI_MSG_BOX_BTN_AFFIRM) {
-				xTaskNotify(task_handle_bt, BT_NOTIFY_CONFIRM_PIN_MASK, eSetBits);
+				evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_CONFIRM_PIN);
 			} else if (btn == GUI_MSG_BOX_BTN_DISMSS) {
-				xTaskNotify(task_handle_bt, BT_NOTIFY_DENY_PIN_MASK, eSetBits);
+				evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_DENY_PIN);
 			}
 			break;
 		
@@ -168,7 +333,7 @@ void gui_set_msgbox_btn(int id, uint16_t btn)
 		case GUI_MSGBOX_CLR_PAIRING:
 			if (btn == GUI_MSG_BOX_BTN_AFFIRM) {
 				gui_screen_settings_forget_peer_info();
-				xTaskNotify(task_handle_bt, BT_NOTIFY_FORGET_PAIR_MASK, eSetBits);
+				evt_bus_send_id(EVT_QUEUE_BT, BT_EVT_FORGET_PAIR);
 			}
 			break;
 			
@@ -181,6 +346,12 @@ void gui_set_msgbox_btn(int id, uint16_t btn)
 			// Nothing to do when user dimisses message box
 			break;
 #endif
+			
+#if (CONFIG_ANS_MACH_ENABLE == true)
+		case GUI_MSGBOX_MSG_PLAY:
+			// Nothing to do when user dimisses message box
+			break;
+#endif
 	}
 }
 
@@ -225,11 +396,23 @@ void gui_set_fatal_error(const char* msg)
 		gui_preset_message_box_string(full_msg, false, GUI_MSGBOX_INT_ERR);
 		req_message_box = true;
 		
+		// gui_task displays it once running (and picks up a request made before it started)
+		if (task_handle_gui != NULL) {
+			xTaskNotify(task_handle_gui, GUI_NOTIFY_MESSAGEBOX_MASK, eSetBits);
+		}
+		
 		free(full_msg);
 	}
 }
 
 
+void gui_get_render_stats(gui_render_stats_t* stats)
+{
+	*stats = gui_render_stats;
+	stats->avg_msec = (gui_render_stats.frames == 0) ? 0 : (uint32_t) (gui_render_total_msec / gui_render_stats.frames);
+}
+
+
 
 //
 // GUI Task Internal functions
@@ -239,6 +422,7 @@ static void _gui_lvgl_init()
 {
 	// Initialize lvgl
 	lv_init();
+	(void) gui_img_rle_init();
 	
 	// Interface and driver initialization
 	disp_driver_init(true);
@@ -247,50 +431,206 @@ static void _gui_lvgl_init()
 	// Install the display driver
 	lv_disp_buf_init(&lvgl_disp_buf, lvgl_disp_buf1, lvgl_disp_buf2, DISP_BUF_SIZE);
 	lv_disp_drv_init(&lvgl_disp_drv);
+#if (CONFIG_SYSTRACE_ENABLE == true)
+	lvgl_disp_drv.flush_cb = _gui_flush_cb;
+#else
 	lvgl_disp_drv.flush_cb = disp_driver_flush;
+#endif
+	lvgl_disp_drv.monitor_cb = _gui_monitor_cb;
 	lvgl_disp_drv.buffer = &lvgl_disp_buf;
 	lv_disp_drv_register(&lvgl_disp_drv);
 	
 	// Install the touchscreen driver
     lv_indev_drv_init(&lvgl_indev_drv);
-    lvgl_indev_drv.read_cb = touch_driver_read;
+    lvgl_indev_drv.read_cb = _gui_touch_read;
     lvgl_indev_drv.type = LV_INDEV_TYPE_POINTER;
     lv_indev_drv_register(&lvgl_indev_drv);
 	
-    // Hook LVGL's timebase to the CPU system tick so it can keep track of time
-    esp_register_freertos_tick_hook(_lv_tick_callback);
+    // LVGL's timebase is esp_timer (LV_TICK_CUSTOM) so there is no tick to hook
 }
 
 
 static void _gui_screen_init()
 {
-	// Create the various screens
+	int i;
+	
+	// Only the main screen is created now, the rest when first displayed
+	for (i=0; i<GUI_NUM_SCREENS; i++) {
+		gui_screens[i] = NULL;
+	}
 	gui_screens[GUI_SCREEN_MAIN] = gui_screen_main_create();
-	gui_screens[GUI_SCREEN_SETTINGS] = gui_screen_settings_create();
-	gui_screens[GUI_SCREEN_TIME] = gui_screen_time_create();
 }
 
 
 static void _gui_add_subtasks()
 {
-	// Event handler sub-task runs every GUI_TASK_EVAL_MSEC mSec
-	gui_event_subtask = lv_task_create(_gui_event_handler_task, GUI_TASK_EVAL_MSEC, LV_TASK_PRIO_MID, NULL);
+	// Event handler sub-task runs when gui_task is notified
+	gui_event_subtask = lv_task_create(_gui_event_handler_task, GUI_EVENT_BACKSTOP_MSEC, LV_TASK_PRIO_MID, NULL);
 	
-	// Touch activity detection runs twice per second
-	gui_activity_subtask = lv_task_create(_gui_activity_handler_task, 500, LV_TASK_PRIO_LOW, NULL);
+	// Touch activity reporting is started by a touch and stops when the touches do
+	gui_activity_subtask = lv_task_create(_gui_activity_handler_task, GUI_ACTIVITY_MSEC, LV_TASK_PRIO_OFF, NULL);
 	
-	// Message box display sub-task runs every GUI_EVAL_MSEC mSec
+	// Message box display sub-task only runs while a message box is waiting to be displayed
 	gui_messagebox_subtask = lv_task_create(_gui_task_messagebox_handler_task, GUI_TASK_EVAL_MSEC,
-		LV_TASK_PRIO_LOW, NULL);
+		LV_TASK_PRIO_OFF, NULL);
+	if (req_message_box) {
+		_gui_req_message_box();
+	}
+	
+	// Secondary screen teardown
+	if (GUI_SCREEN_TEARDOWN_MSEC != 0) {
+		gui_teardown_subtask = lv_task_create(_gui_teardown_handler_task, GUI_TEARDOWN_EVAL_MSEC, LV_TASK_PRIO_LOWEST, NULL);
+	}
+	
+	// Refresh governor runs ahead of the display refresh
+	gui_governor_subtask = lv_task_create(_gui_governor_task, GUI_GOV_EVAL_MSEC, LV_TASK_PRIO_HIGH, NULL);
+	_gui_set_frame_msec(GUI_FRAME_MSEC_ACTIVE);
+	
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+	// Stress test screen changes
+	gui_stress_subtask = lv_task_create(_gui_stress_task, STRESS_GUI_MSEC, LV_TASK_PRIO_LOW, NULL);
+#endif
+}
+
+
+// Block until the next LVGL task is due or another task notifies us, then run LVGL.  A
+// notification makes the event handler sub-task ready so it runs in this pass.
+static void _gui_active_eval()
+{
+	uint32_t notification_value;
+	static uint32_t wait_msec = 0;
+	
+	// Round up so a task due in less than a tick doesn't spin
+	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value,
+	                    (wait_msec + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS)) {
+		gui_held_notifications |= notification_value;
+	}
+	if (gui_held_notifications != 0) {
+		lv_task_ready(gui_event_subtask);
+	}
+	
+	wait_msec = lv_task_handler();
+	if (wait_msec > GUI_MAX_WAIT_MSEC) wait_msec = GUI_MAX_WAIT_MSEC;
+}
+
+
+// Block until something needs LVGL while the display is idle.  Notifications are held
+// so all the updates made while idle are drawn together at the next redraw.
+static void _gui_idle_eval()
+{
+	uint32_t notification_value;
+	lv_indev_data_t touch_data;
+	static uint32_t prev_redraw_tick = 0;
+	
+	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, pdMS_TO_TICKS(GUI_IDLE_POLL_MSEC))) {
+		gui_held_notifications |= notification_value;
+	}
+	
+	// Poll the touchscreen ourselves since LVGL's input device isn't being read
+	touch_data.state = LV_INDEV_STATE_REL;
+	(void) touch_driver_read(&lvgl_indev_drv, &touch_data);
+	if (touch_data.state == LV_INDEV_STATE_PR) {
+		// Have gcore_task restore the backlight
+		xTaskNotify(task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK, eSetBits);
+		gui_disp_idle = false;
+		gui_disp_off = false;
+	} else if ((gui_held_notifications & GUI_IDLE_WAKE_MASK) != 0) {
+		if (gui_disp_off) {
+			// Nothing can be seen with the backlight off
+			xTaskNotify(task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK, eSetBits);
+		}
+		gui_disp_idle = false;
+		gui_disp_off = false;
+	}
+	
+	// Nothing is drawn while the display is off
+	if (!gui_disp_idle || (!gui_disp_off && (lv_tick_elaps(prev_redraw_tick) >= GUI_IDLE_REDRAW_MSEC))) {
+		prev_redraw_tick = lv_tick_get();
+		if (gui_held_notifications != 0) {
+			lv_task_ready(gui_event_subtask);
+		}
+		_gui_eval_disp_power();
+		lv_task_handler();
+	}
+}
+
+
+// Keep the display's power state in step with the backlight: 8-color while it is dimmed,
+// showing (and sent) only the rows of the main screen's clock when that is up, and asleep
+// while it is off.  SPI traffic and panel power drop to almost nothing while idle.
+static void _gui_eval_disp_power()
+{
+	disp_power_t state = DISP_POWER_NORMAL;
+	lv_coord_t y1 = 0;
+	lv_coord_t y2 = 0;
+	
+	if (gui_disp_off) {
+		state = DISP_POWER_SLEEP;
+	} else if (gui_disp_idle) {
+		if ((gui_cur_screen_index == GUI_SCREEN_MAIN) && gui_screen_main_get_clock_rows(&y1, &y2)) {
+			state = DISP_POWER_PARTIAL;
+		} else {
+			state = DISP_POWER_IDLE;
+		}
+	}
+	
+	if (disp_driver_set_power(state, y1, y2)) {
+		// Draw what wasn't sent while only part of the display was on
+		lv_obj_invalidate(lv_scr_act());
+	}
+}
+
+
+// LVGL input device read that also starts the touch activity reporting on a touch
+static bool _gui_touch_read(lv_indev_drv_t* drv, lv_indev_data_t* data)
+{
+	bool more = touch_driver_read(drv, data);
+	
+	if ((data->state == LV_INDEV_STATE_PR) && (gui_activity_subtask->prio == LV_TASK_PRIO_OFF)) {
+		lv_task_set_prio(gui_activity_subtask, LV_TASK_PRIO_LOW);
+		lv_task_ready(gui_activity_subtask);
+	}
+	
+	return more;
+}
+
+
+// Starts the message box sub-task (from gui_task)
+static void _gui_req_message_box()
+{
+	req_message_box = true;
+	lv_task_set_prio(gui_messagebox_subtask, LV_TASK_PRIO_LOW);
+	lv_task_ready(gui_messagebox_subtask);
 }
 
 
 static void _gui_event_handler_task(lv_task_t * task)
 {
 	uint32_t notification_value;
+	uint32_t new_notifications;
 	
-	// Look for incoming notifications (clear them upon reading)
-	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, 0)) {
+	// Notifications collected by the main loop (or held while idle) along with any since
+	notification_value = gui_held_notifications;
+	gui_held_notifications = 0;
+	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &new_notifications, 0)) {
+		notification_value |= new_notifications;
+	}
+	
+	if (notification_value != 0) {
+		if (Notification(notification_value, GUI_NOTIFY_DISP_IDLE_MASK)) {
+			gui_disp_idle = true;
+		}
+		
+		if (Notification(notification_value, GUI_NOTIFY_DISP_OFF_MASK)) {
+			gui_disp_idle = true;
+			gui_disp_off = true;
+		}
+		
+		if (Notification(notification_value, GUI_NOTIFY_DISP_WAKE_MASK)) {
+			gui_disp_idle = false;
+			gui_disp_off = false;
+		}
+		
 		if (Notification(notification_value, GUI_NOTIFY_POWER_UPDATE_MASK)) {
 			gui_screen_main_update_power_state();
 		}
@@ -307,6 +647,10 @@ static void _gui_event_handler_task(lv_task_t * task)
 			gui_screen_main_update_cid_num();
 		}
 		
+		if (Notification(notification_value, GUI_NOTIFY_LINK_QUALITY_MASK)) {
+			gui_screen_main_update_link_quality();
+		}
+		
 		if (Notification(notification_value, GUI_NOTIFY_UPDATE_MIC_GAIN_MASK)) {
 			gui_screen_settings_update_mic_gain(gui_new_mic_gain);
 		}
@@ -318,7 +662,7 @@ static void _gui_event_handler_task(lv_task_t * task)
 		if (Notification(notification_value, GUI_NOTIFY_NEW_SSP_PIN_MASK)) {
 			sprintf(msgbox_buf, "Confirm %d is displayed on the cellphone", gui_new_ssp_pin);
 			gui_preset_message_box_string(msgbox_buf, true, GUI_MSGBOX_BT_SSP);
-			req_message_box = true;
+			_gui_req_message_box();
 		}
 		
 		if (Notification(notification_value, GUI_NOTIFY_NEW_PAIR_INFO_MASK)) {
@@ -332,12 +676,16 @@ static void _gui_event_handler_task(lv_task_t * task)
 		if (Notification(notification_value, GUI_NOTIFY_BT_AUTH_FAIL_MASK)) {
 			sprintf(msgbox_buf, "Bluetooth authentication failed");
 			gui_preset_message_box_string(msgbox_buf, false, GUI_MSGBOX_BT_AUTH_FAIL);
-			req_message_box = true;
+			_gui_req_message_box();
 		}
 		
 		if (Notification(notification_value, GUI_NOTIFY_MESSAGEBOX_MASK)) {
-			req_message_box = true;
+			_gui_req_message_box();
 		}
+		
+		// Main screen label changes from this pass are applied together, and only
+		// where they differ from what is displayed
+		gui_screen_main_commit();
 
 #if (CONFIG_SCREENDUMP_ENABLE == true)
 		if (Notification(notification_value, GUI_NOTIFY_SCREENDUMP_MASK)) {
@@ -350,9 +698,11 @@ static void _gui_event_handler_task(lv_task_t * task)
 
 static void _gui_activity_handler_task(lv_task_t* task)
 {
-	// Notify gcore_task if we've seen any touch recently
+	// Notify gcore_task if we've seen any touch recently, otherwise wait for the next one
 	if (touch_driver_saw_touch()) {
 		xTaskNotify(task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK, eSetBits);
+	} else {
+		lv_task_set_prio(task, LV_TASK_PRIO_OFF);
 	}
 }
 
@@ -366,23 +716,196 @@ static void _gui_activity_handler_task(lv_task_t* task)
  		req_message_box = false;
  		gui_preset_message_box(gui_screens[gui_cur_screen_index]);
  	}
+ 	if (!req_message_box) {
+ 		lv_task_set_prio(task, LV_TASK_PRIO_OFF);
+ 	}
  }
 
 
-static void IRAM_ATTR _lv_tick_callback()
+// LVGL sub-task to delete secondary screens that haven't been displayed for a while so
+// their objects are returned to the LVGL memory pool
+static void _gui_teardown_handler_task(lv_task_t* task)
+{
+	int i;
+	
+	for (i=0; i<GUI_NUM_SCREENS; i++) {
+		if ((i != gui_cur_screen_index) && (gui_screens[i] != NULL) && (gui_screen_ops[i].destroy != NULL) &&
+		    (lv_tick_elaps(gui_screen_hidden_tick[i]) >= GUI_SCREEN_TEARDOWN_MSEC)) {
+			
+			if (gui_screen_ops[i].destroy()) {
+				gui_screens[i] = NULL;
+			}
+		}
+	}
+}
+
+
+#if (GUI_SNAPSHOTS > 0)
+// Save the image of screen n, which is being replaced by screen next.  A screen without a
+// buffer gets a new one until there are GUI_SNAPSHOTS, after which it takes the one of the
+// screen hidden the longest.
+static void _gui_snapshot_save(int n, int next)
+{
+	int i;
+	int oldest = -1;
+	
+	if (gui_snapshot_buf[n] == NULL) {
+		if (gui_snapshot_count < GUI_SNAPSHOTS) {
+			gui_snapshot_buf[n] = (lv_color_t*) heap_caps_malloc(GUI_SNAPSHOT_BYTES, MALLOC_CAP_SPIRAM);
+			if (gui_snapshot_buf[n] != NULL) {
+				gui_snapshot_count++;
+			}
+		} else {
+			for (i=0; i<GUI_NUM_SCREENS; i++) {
+				if ((i != n) && (i != next) && (gui_snapshot_buf[i] != NULL) &&
+				    ((oldest < 0) || (lv_tick_elaps(gui_screen_hidden_tick[i]) > lv_tick_elaps(gui_screen_hidden_tick[oldest])))) {
+					
+					oldest = i;
+				}
+			}
+			if (oldest >= 0) {
+				gui_snapshot_buf[n] = gui_snapshot_buf[oldest];
+				gui_snapshot_buf[oldest] = NULL;
+				gui_snapshot_valid[oldest] = false;
+			}
+		}
+	}
+	
+	if (gui_snapshot_buf[n] != NULL) {
+		gui_snapshot_valid[n] = disp_driver_save_frame(gui_snapshot_buf[n]);
+	}
+}
+
+
+// Send screen n's snapshot to the display, returning false if it doesn't have one
+static bool _gui_snapshot_show(int n)
+{
+	if ((gui_snapshot_buf[n] == NULL) || !gui_snapshot_valid[n]) {
+		return false;
+	}
+	
+	disp_driver_show_frame(gui_snapshot_buf[n]);
+	return true;
+}
+#endif
+
+
+// Pick the display refresh period.  Audio deadlines are considered at risk while audio_task
+// is missing them or the echo canceller is shedding work, and for a while after.  Redraws
+// then wait unless the display is being touched, when they only run at the audio rate.  The
+// performance profile may slow the active rate down too.
+static void _gui_governor_task(lv_task_t* task)
+{
+	audio_load_t al;
+	pwr_profile_t prof;
+	bool touched;
+	int msec;
+	
+	audio_get_load(&al);
+	if ((al.enabled && ((al.deadline_misses != gui_gov_prev_misses) || (al.lec_budget_level > AUDIO_LEC_BUDGET_FULL))) ||
+	    pace_stressed()) {
+		gui_gov_stressed = true;
+		gui_gov_stress_tick = lv_tick_get();
+	} else if (gui_gov_stressed && (lv_tick_elaps(gui_gov_stress_tick) >= GUI_GOV_DEFER_HOLD_MSEC)) {
+		gui_gov_stressed = false;
+	}
+	gui_gov_prev_misses = al.deadline_misses;
+	
+	touched = (lv_disp_get_inactive_time(NULL) < GUI_GOV_TOUCH_MSEC);
+	if (gui_gov_stressed && !touched) {
+		msec = GUI_FRAME_MSEC_DEFER;
+		gui_render_stats.defer_evals++;
+	} else if (al.enabled) {
+		msec = GUI_FRAME_MSEC_AUDIO;
+	} else {
+		msec = GUI_FRAME_MSEC_ACTIVE;
+	}
+	(void) pwr_profile_get(&prof);
+	if (msec < prof.gui_frame_msec) msec = prof.gui_frame_msec;
+	_gui_set_frame_msec(msec);
+}
+
+
+#if (CONFIG_STRESS_TEST_ENABLE == true)
+// LVGL sub-task cycling through the screens (building the torn down ones again) and drawing
+// each immediately for the stress test, then returning to the main screen when it ends
+static void _gui_stress_task(lv_task_t* task)
 {
-	lv_tick_inc(portTICK_RATE_MS);
+	int64_t t;
+	
+	if (!stress_running()) {
+		if (gui_stress_started) {
+			gui_set_screen(GUI_SCREEN_MAIN);
+			lv_task_del(gui_stress_subtask);
+			gui_stress_subtask = NULL;
+		}
+		return;
+	}
+	gui_stress_started = true;
+	
+	// Keep the backlight on so the display is drawn at the active rate
+	xTaskNotify(task_handle_gcore, GCORE_NOTIFY_ACTIVITY_MASK, eSetBits);
+	
+	t = esp_timer_get_time();
+	gui_set_screen((gui_cur_screen_index + 1) % GUI_NUM_SCREENS);
+	lv_refr_now(NULL);
+	stress_record(STRESS_LAT_GUI, (uint32_t) (esp_timer_get_time() - t));
 }
+#endif
+
+
+static void _gui_set_frame_msec(int msec)
+{
+	lv_disp_t* disp = lv_disp_get_default();
+	
+	if ((msec != gui_render_stats.frame_msec) && (disp != NULL)) {
+		// Animations step once per refresh so each step computed is drawn (their values
+		// follow the millisecond tick so they still move at the right speed)
+		lv_task_set_period(_lv_disp_get_refr_task(disp), msec);
+		lv_task_set_period(_lv_anim_get_task(), msec);
+		gui_render_stats.frame_msec = msec;
+	}
+}
+
+
+// Called by LVGL after each refresh that drew something with the time it took to render
+// and flush
+static void _gui_monitor_cb(lv_disp_drv_t* disp_drv, uint32_t time, uint32_t px)
+{
+	gui_render_stats.frames++;
+	gui_render_stats.last_msec = time;
+	gui_render_stats.last_px = px;
+	if (time > gui_render_stats.max_msec) gui_render_stats.max_msec = time;
+	gui_render_total_msec += time;
+}
+
+
+#if (CONFIG_SYSTRACE_ENABLE == true)
+// Marks the flush work done in gui_task (the SPI transfer itself finishes in the background)
+static void _gui_flush_cb(lv_disp_drv_t* disp_drv, const lv_area_t* area, lv_color_t* color_map)
+{
+	SYSTRACE_START(SYSTRACE_ID_GUI_FLUSH);
+	disp_driver_flush(disp_drv, area, color_map);
+	SYSTRACE_STOP(SYSTRACE_ID_GUI_FLUSH);
+}
+#endif
 
 
 #if (CONFIG_SCREENDUMP_ENABLE == true)
-// This task blocks gui_task
+// Pending encoded bytes and state for the dump lines
+static COLD_ATTR uint8_t gui_dump_buf[GUI_DUMP_LINE_BYTES + 1 + 2 * GUI_DUMP_MAX_RUN];
+static int gui_dump_len;
+static int gui_dump_lines;
+static uint32_t gui_dump_crc;
+static uint32_t gui_dump_total;
+
+// This task blocks gui_task (for a few seconds at 115200 baud with a typical screen)
 void _gui_do_screendump()
 {
-	char line_buf[161];   // Large enough for 32 16-bit hex values with a space between them
-	int i, j, n;
+	int i, n;
 	int len = MEM_FB_W * MEM_FB_H;
 	uint16_t* fb;
+	uint8_t ctrl;
 	
 	// Configure the display driver to render to the screendump frame buffer
 	disp_driver_en_dump(true);
@@ -391,21 +914,85 @@ void _gui_do_screendump()
 	lv_obj_invalidate(lv_scr_act());
 	lv_refr_now(lv_disp_get_default());
 	
-	// Reconfigure the driver back to the LCD
+	// Reconfigure the driver back to the LCD and redraw it (resyncing the diff buffer)
 	disp_driver_en_dump(false);
+	lv_obj_invalidate(lv_scr_act());
+	
+	// Dump the fb encoded like gui_img_rle images: a control byte n followed by
+	//   n & 0x80 : one pixel repeated (n & 0x7F) + 1 times
+	//   else     : (n + 1) literal pixels
+	gui_dump_len = 0;
+	gui_dump_lines = 0;
+	gui_dump_crc = 0;
+	gui_dump_total = 0;
+	printf("%s: SD: BEGIN %d %d %d %d\n", TAG, MEM_FB_W, MEM_FB_H, MEM_FB_BPP, LV_COLOR_16_SWAP);
 	
-	// Dump the fb
 	fb = (uint16_t*) mem_fb_get_buffer();
 	i = 0;
 	while (i < len) {
-		n = 0;
-		for (j=0; j<32; j++) {
-			sprintf(line_buf + n, "%x ", *fb++);
-			n = strlen(line_buf);
-		}
-		i += j;
-		printf("%s: FB: %s\n", TAG, line_buf);
-		vTaskDelay(pdMS_TO_TICKS(20));
+		// Run of identical pixels
+		n = 1;
+		while (((i + n) < len) && (n < GUI_DUMP_MAX_RUN) && (fb[i + n] == fb[i])) n++;
+		if (n > 1) {
+			ctrl = 0x80 | (n - 1);
+			_gui_dump_put(&ctrl, 1);
+			_gui_dump_put((uint8_t*) &fb[i], 2);
+		} else {
+			// Literals up to the start of the next run
+			while (((i + n) < len) && (n < GUI_DUMP_MAX_RUN) &&
+			       (((i + n + 1) >= len) || (fb[i + n] != fb[i + n + 1]))) n++;
+			ctrl = n - 1;
+			_gui_dump_put(&ctrl, 1);
+			_gui_dump_put((uint8_t*) &fb[i], 2 * n);
+		}
+		i += n;
+		_gui_dump_flush(false);
+	}
+	_gui_dump_flush(true);
+	
+	printf("%s: SD: END %u %08x\n", TAG, gui_dump_total, gui_dump_crc);
+}
+
+
+static void _gui_dump_put(const uint8_t* buf, int len)
+{
+	memcpy(&gui_dump_buf[gui_dump_len], buf, len);
+	gui_dump_len += len;
+	gui_dump_crc = esp_rom_crc32_le(gui_dump_crc, buf, len);
+	gui_dump_total += len;
+}
+
+
+// Write complete lines (and the remainder if all is set) base64 encoded
+static void _gui_dump_flush(bool all)
+{
+	static const char b64[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	char line[(GUI_DUMP_LINE_BYTES / 3) * 4 + 1];
+	int i, n, o;
+	uint32_t v;
+	
+	while ((gui_dump_len >= GUI_DUMP_LINE_BYTES) || (all && (gui_dump_len > 0))) {
+		n = (gui_dump_len < GUI_DUMP_LINE_BYTES) ? gui_dump_len : GUI_DUMP_LINE_BYTES;
+		o = 0;
+		for (i=0; i<n; i+=3) {
+			v = gui_dump_buf[i] << 16;
+			if ((i + 1) < n) v |= gui_dump_buf[i + 1] << 8;
+			if ((i + 2) < n) v |= gui_dump_buf[i + 2];
+			line[o++] = b64[(v >> 18) & 0x3F];
+			line[o++] = b64[(v >> 12) & 0x3F];
+			line[o++] = ((i + 1) < n) ? b64[(v >> 6) & 0x3F] : '=';
+			line[o++] = ((i + 2) < n) ? b64[v & 0x3F] : '=';
+		}
+		line[o] = 0;
+		printf("%s: SD: %s\n", TAG, line);
+		
+		gui_dump_len -= n;
+		memmove(gui_dump_buf, &gui_dump_buf[n], gui_dump_len);
+		
+		if (++gui_dump_lines >= GUI_DUMP_YIELD_LINES) {
+			gui_dump_lines = 0;
+			vTaskDelay(1);
+		}
 	}
 }
 #endif
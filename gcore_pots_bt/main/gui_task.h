@@ -32,7 +32,8 @@
 // GUI Task Constants
 //
 
-// LVGL evaluation rate (mSec)
+// LVGL tick resolution (esp_timer based LV_TICK_CUSTOM) and the message box retry interval
+// while a previous one closes (mSec)
 #define GUI_LVGL_TICK_MSEC         1
 #define GUI_TASK_EVAL_MSEC         20
 
@@ -40,8 +41,11 @@
 #define GUI_SCREEN_MAIN            0
 #define GUI_SCREEN_SETTINGS        1
 #define GUI_SCREEN_TIME            2
+#define GUI_SCREEN_DIAG            3
+#define GUI_SCREEN_SYS             4
+#define GUI_SCREEN_MSGS            5
 
-#define GUI_NUM_SCREENS            3
+#define GUI_NUM_SCREENS            6
 
 // Screen brightness values (integer percent)
 //   MIN_PERCENT must be greater than DIM_PERCENT
@@ -71,6 +75,30 @@
 #define GUI_MSGBOX_CLR_PAIRING     4
 #define GUI_MSGBOX_SMPL_FAIL       5
 #define GUI_MSGBOX_SMPL_DONE       6
+#define GUI_MSGBOX_MSG_PLAY        7
+
+// Refresh governor display refresh periods (mSec) - while the display is being touched
+// without audio, while audio runs (calls and dial tone) and while audio is missing
+// deadlines or shedding echo canceller work (redraws not prompted by a touch wait)
+#define GUI_FRAME_MSEC_ACTIVE      33
+#define GUI_FRAME_MSEC_AUDIO       100
+#define GUI_FRAME_MSEC_DEFER       500
+
+
+
+//
+// GUI Task Typedefs
+//
+typedef struct {
+	int frame_msec;                 // Current refresh period set by the governor
+	uint32_t frames;                // Refreshes that drew something
+	uint32_t last_msec;             // Render and flush time of the last frame
+	uint32_t max_msec;
+	uint32_t avg_msec;
+	uint32_t last_px;               // Pixels redrawn by the last frame
+	uint32_t defer_evals;           // Governor evaluations that deferred redraws
+	uint32_t snapshot_shows;        // Screen switches shown from a snapshot
+} gui_render_stats_t;
 
 // Notifications
 #define GUI_NOTIFY_POWER_UPDATE_MASK         0x00000001
@@ -79,10 +107,14 @@
 #define GUI_NOTIFY_CID_NUM_UPDATE_MASK       0x00000008
 #define GUI_NOTIFY_UPDATE_MIC_GAIN_MASK      0x00000010
 #define GUI_NOTIFY_UPDATE_SPK_GAIN_MASK      0x00000020
+#define GUI_NOTIFY_LINK_QUALITY_MASK         0x00000040
 #define GUI_NOTIFY_NEW_SSP_PIN_MASK          0x00000100
 #define GUI_NOTIFY_NEW_PAIR_INFO_MASK        0x00000200
 #define GUI_NOTIFY_FORGET_PAIRING_MASK       0x00000400
 #define GUI_NOTIFY_BT_AUTH_FAIL_MASK         0x00001000
+#define GUI_NOTIFY_DISP_IDLE_MASK            0x00010000
+#define GUI_NOTIFY_DISP_WAKE_MASK            0x00020000
+#define GUI_NOTIFY_DISP_OFF_MASK             0x00040000
 #define GUI_NOTIFY_MESSAGEBOX_MASK           0x10000000
 #define GUI_NOTIFY_SCREENDUMP_MASK           0x80000000
 
@@ -102,5 +134,6 @@ void gui_set_new_pair_ssp_pin(uint32_t ssp_pin);        // Used by bt_task to in
 void gui_set_new_pair_info(uint8_t* addr, char* name);  // Used by bt_task to inform us of a new pairing
 void gui_set_fatal_error(const char* msg);              // Used by any code to log a fatal error that will display a pop-up
                                                         //   message and then shut down the device
+void gui_get_render_stats(gui_render_stats_t* stats);   // Used by the diagnostic screen
 
 #endif /* GUI_TASK_H */
\ No newline at end of file
@@ -30,15 +30,39 @@
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "esp_log.h"
+#include "esp_task.h"
 #include "app_task.h"
 #include "audio_task.h"
+#include "bg_job.h"
 #include "bt_task.h"
 #include "gcore_task.h"
 #include "gui_task.h"
 #include "pots_task.h"
+#include "ans_mach.h"
+#include "blackbox.h"
+#include "boot_prof.h"
+#include "call_log.h"
+#include "cli.h"
+#include "contacts.h"
+#include "dlog.h"
+#include "evt_bus.h"
+#include "gui_mem.h"
+#include "hci_snoop.h"
 #include "i2c.h"
+#include "international.h"
+#include "mem_pool.h"
+#include "ota_sd.h"
+#include "preroll.h"
+#include "prompt.h"
 #include "ps.h"
+#include "pwr_mgmt.h"
+#include "pwr_profile.h"
+#include "sd_card.h"
+#include "soft_timer.h"
+#include "spandsp.h"
 #include "sys_common.h"
+#include "systrace.h"
+#include "wifi_up.h"
 
 
 //
@@ -49,6 +73,19 @@ static const char* TAG = "main";
 // Uncomment to display initial heap usage
 //#define DISPLAY_INIT_HEAP
 
+// Size of the internal RAM pool holding all spandsp allocations.  Big enough for the
+// largest (64 mSec tail, 16 kHz) echo canceller and a narrowband one, the tone
+// generation steps and the caller ID transmitter.  Anything that doesn't fit comes
+// from the heap.
+#define SPANDSP_POOL_LEN (32 * 1024)
+
+// Task stacks (bytes)
+#define BT_TASK_STACK    3072
+#define APP_TASK_STACK   3072
+#define GCORE_TASK_STACK 3072
+#define GUI_TASK_STACK   3072
+#define POTS_TASK_STACK  3072
+
 
 
 //
@@ -63,6 +100,41 @@ TaskHandle_t task_handle_gcore;
 TaskHandle_t task_handle_gui;
 TaskHandle_t task_handle_pots;
 
+// Task stacks and control blocks, and the spandsp pool, are reserved at build time in
+// internal RAM (.bss) so none of them can fail or fragment the heap Bluedroid uses.  The
+// stack of app_task, which has no real-time work, may be placed in PSRAM instead (COLD_ATTR).
+// Nothing it calls reads, writes, erases or maps flash through the flash driver (settings
+// commits it would make are left to gcore_task), which a task with a PSRAM stack can't do.
+// gcore_task (settings journal commits) and gui_task (the benchmark's flash read) do.
+static StackType_t bt_task_stack[BT_TASK_STACK];
+static StackType_t audio_task_stack[CONFIG_AUDIO_TASK_STACK_SIZE];
+static COLD_ATTR StackType_t app_task_stack[APP_TASK_STACK];
+static StackType_t gcore_task_stack[GCORE_TASK_STACK];
+static StackType_t gui_task_stack[GUI_TASK_STACK];
+static StackType_t pots_task_stack[POTS_TASK_STACK];
+static StaticTask_t bt_task_tcb;
+static StaticTask_t audio_task_tcb;
+static StaticTask_t app_task_tcb;
+static StaticTask_t gcore_task_tcb;
+static StaticTask_t gui_task_tcb;
+static StaticTask_t pots_task_tcb;
+
+static uint8_t spandsp_pool[SPANDSP_POOL_LEN] __attribute__((aligned(8)));
+
+#if (CONFIG_COLD_DATA_IN_PSRAM == true)
+// Linker symbols bounding the PSRAM .bss (everything marked COLD_ATTR)
+extern uint8_t _ext_ram_bss_start;
+extern uint8_t _ext_ram_bss_end;
+#endif
+
+
+
+//
+// Forward declarations for internal functions
+//
+static void _main_start_task(TaskFunction_t fn, const char* name, uint32_t stack_len, StackType_t* stack,
+                             StaticTask_t* tcb, UBaseType_t prio, TaskHandle_t* handle, BaseType_t core);
+
 
 //
 // Application entry
@@ -71,29 +143,160 @@ void app_main(void)
 {
 	ESP_LOGI(TAG, "gcore_pots_bt startup");
 	
+	// Dump whatever the black box held when we were reset before anything is recorded
+	blackbox_init();
+	
+#if (CONFIG_SYSTRACE_ENABLE == true)
+	// Trace the boot too
+	if (!systrace_init()) {
+		ESP_LOGW(TAG, "Trace recording unavailable");
+	}
+#endif
+	
+	// Get the deferred logger running first so the task callbacks never format log
+	// messages themselves (it logs directly until then or if it can't start)
+	if (!dlog_init()) {
+		ESP_LOGW(TAG, "Deferred logging unavailable");
+	}
+	
+	// Frequency scaling starts before the tasks so each can hold the full CPU speed
+	if (!pwr_mgmt_init()) {
+		ESP_LOGW(TAG, "Power management unavailable");
+	}
+	pwr_profile_init();
+	
+	// Tasks wait on the readiness of just the subsystems they depend on
+	if (!boot_prof_init()) {
+		ESP_LOGE(TAG, "Boot readiness group creation failed");
+		gui_set_fatal_error("Boot readiness group creation failed");
+	}
+	
 	// Start by initializing the shared (between tasks) I2C interface so we
 	// can get device setup information from persistent storage
 	if (i2c_master_init() != ESP_OK) {
 		ESP_LOGE(TAG, "I2C initialization failed");
 		gui_set_fatal_error("I2C initialization failed");
 	}
+	
+	// Event queues must exist before any task can send to them
+	if (!evt_bus_create(EVT_QUEUE_APP, "app", APP_EVT_QUEUE_DEPTH) ||
+	    !evt_bus_create(EVT_QUEUE_BT, "bt", BT_EVT_QUEUE_DEPTH) ||
+	    !evt_bus_create(EVT_QUEUE_POTS, "pots", POTS_EVT_QUEUE_DEPTH)) {
+		ESP_LOGE(TAG, "Event queue creation failed");
+		gui_set_fatal_error("Event queue creation failed");
+	}
+	
+	// As must the timer service the tasks create their timers from
+	if (!soft_timer_init()) {
+		ESP_LOGE(TAG, "Timer service init failed");
+		gui_set_fatal_error("Timer service init failed");
+	}
+	
+	// Deferrable work from any task runs in idle time on core 0
+	if (!bg_job_init()) {
+		ESP_LOGE(TAG, "Background job init failed");
+	}
+	
+	// Every module using the Micro-SD Card shares its mount
+	if (!sd_card_init()) {
+		ESP_LOGE(TAG, "Micro-SD Card init failed");
+	}
+	
+#if (CONFIG_HCI_SNOOP_ENABLE == true)
+	// The HCI tap has to be ready before Bluedroid registers with the controller
+	if (!hci_snoop_init()) {
+		ESP_LOGW(TAG, "HCI recording unavailable");
+	}
+	
+#endif
+#if (CONFIG_PREROLL_ENABLE == true)
+	if (!preroll_init()) {
+		ESP_LOGW(TAG, "Pre-roll audio recording unavailable");
+	}
+	
+#endif
+	// Bringing up the Bluetooth controller and Bluedroid is the longest part of boot and
+	// doesn't need persistent storage so it starts first (bt_task waits for BOOT_READY_PS
+	// before reading its settings)
+	//   Core 0 : PRO
+    //   Core 1 : APP
+    //
+	_main_start_task(&bt_task, "bt_task", BT_TASK_STACK, bt_task_stack, &bt_task_tcb, 2, &task_handle_bt, 0);
+	
 	if (!ps_init()) {
 		// ps_init() prints its own error messages so we only need try to display
 		// an error message
 		ESP_LOGE(TAG, "Initialize Persistant Storage failed");
 		gui_set_fatal_error("Initialize Persistant Storage failed");
 	}
+	boot_prof_set_ready(BOOT_READY_PS, "ps");
 	
-	// Start the tasks that actually comprise the application
-	//   Core 0 : PRO
-    //   Core 1 : APP
-    //
-    xTaskCreatePinnedToCore(&app_task,  "app_task",  3072, NULL, 2,  &task_handle_app,  0);
-    xTaskCreatePinnedToCore(&audio_task, "audio_task", 3072, NULL, 3, &task_handle_audio, 1);
-    xTaskCreatePinnedToCore(&bt_task, "bt_task", 3072, NULL, 2, &task_handle_bt, 0);
-	xTaskCreatePinnedToCore(&gcore_task,  "gcore_task",  3072, NULL, 2,  &task_handle_gcore,  0);
-	xTaskCreatePinnedToCore(&gui_task,  "gui_task",  3072, NULL, 2,  &task_handle_gui,  0);
-	xTaskCreatePinnedToCore(&pots_task, "pots_task", 3072, NULL, 3, &task_handle_pots, 0);
+	// The country list must be settled before any task looks up the saved country
+	int_init();
+	
+	// Route all spandsp allocations through the build-time pool so that the echo
+	// canceller, tone and caller ID objects re-created during operation can't
+	// fragment the heap
+	if (!mem_pool_init(spandsp_pool, SPANDSP_POOL_LEN)) {
+		ESP_LOGW(TAG, "spandsp will allocate from the heap");
+	}
+	(void) span_mem_allocators(mem_pool_alloc, mem_pool_realloc, mem_pool_free);
+	
+	// LVGL allocates from its own pools, small objects in internal RAM and everything
+	// else in PSRAM, which must exist before gui_task calls lv_init
+	if (!gui_mem_init()) {
+		ESP_LOGW(TAG, "LVGL will allocate from the heap");
+	}
+	
+	// Start the rest of the tasks that comprise the application.  Their init (codec over
+	// I2C on core 1, LVGL and the screens, power monitoring, the line interface) overlaps
+	// the Bluetooth bring-up.
+	_main_start_task(&audio_task, "audio_task", CONFIG_AUDIO_TASK_STACK_SIZE, audio_task_stack, &audio_task_tcb, CONFIG_AUDIO_TASK_PRIORITY, &task_handle_audio, 1);
+	_main_start_task(&app_task, "app_task", APP_TASK_STACK, app_task_stack, &app_task_tcb, 2, &task_handle_app, 0);
+	_main_start_task(&gcore_task, "gcore_task", GCORE_TASK_STACK, gcore_task_stack, &gcore_task_tcb, 2, &task_handle_gcore, 0);
+	_main_start_task(&gui_task, "gui_task", GUI_TASK_STACK, gui_task_stack, &gui_task_tcb, 2, &task_handle_gui, 0);
+	_main_start_task(&pots_task, "pots_task", POTS_TASK_STACK, pots_task_stack, &pots_task_tcb, 3, &task_handle_pots, 0);
+	
+#if (CONFIG_CONTACTS_VCARD_ENABLE == true)
+	// Caller ID names come from a phonebook loaded in the background
+	contacts_init();
+#endif
+
+#if (CONFIG_CALL_LOG_ENABLE == true)
+	// Previous calls are loaded in the background
+	call_log_init();
+#endif
+
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	// Messages are indexed in the background
+	ans_mach_init();
+#endif
+	
+#if (CONFIG_PROMPT_ENABLE == true)
+	// Prompts are decoded by their own task
+	prompt_init();
+#endif
+	
+#if (CONFIG_OTA_SD_ENABLE == true)
+	// Confirm a new firmware once it is running and look for an update on the card
+	ota_sd_init();
+#endif
+	
+#if (CONFIG_WIFI_UPLOAD_ENABLE == true)
+	// Telemetry is uploaded while the phone is idle (Wi-Fi stays off until then)
+	if (!wifi_up_init()) {
+		ESP_LOGE(TAG, "Wi-Fi upload init failed");
+	}
+#endif
+	
+#if (CONFIG_CLI_ENABLE == true)
+	// Interactive commands on the console UART
+	(void) cli_init();
+#endif
+	
+#if (CONFIG_COLD_DATA_IN_PSRAM == true)
+	ESP_LOGI(TAG, "%d bytes of stacks and buffers placed in PSRAM", (int) (&_ext_ram_bss_end - &_ext_ram_bss_start));
+#endif
 	
 #ifdef DISPLAY_INIT_HEAP
 	// Let the tasks get started and display the memory state after boot
@@ -101,3 +304,19 @@ void app_main(void)
 	heap_caps_print_heap_info(MALLOC_CAP_INTERNAL);
 #endif
 }
+
+
+
+//
+// Internal functions
+//
+
+// The static create call returns the handle instead of storing it before the task can run
+// so app_main holds off the tasks on its core until the handle the others use is set
+static void _main_start_task(TaskFunction_t fn, const char* name, uint32_t stack_len, StackType_t* stack,
+                             StaticTask_t* tcb, UBaseType_t prio, TaskHandle_t* handle, BaseType_t core)
+{
+	vTaskPrioritySet(NULL, configMAX_PRIORITIES - 1);
+	*handle = xTaskCreateStaticPinnedToCore(fn, name, stack_len, NULL, prio, stack, tcb, core);
+	vTaskPrioritySet(NULL, ESP_TASK_MAIN_PRIO);
+}
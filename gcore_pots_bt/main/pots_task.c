@@ -24,15 +24,42 @@
  * Foundation, Inc., 675 Mass Ave, Cambridge, MA 02139, USA.
  *
  */
+#include <stdatomic.h>
 #include <stdlib.h>
+#include <string.h>
+#include "esp_cpu.h"
+#include "esp_heap_caps.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/gpio.h"
+#include "driver/ledc.h"
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true)
+#include "esp_sleep.h"
+#include "esp32/ulp.h"
+#include "driver/rtc_cntl.h"
+#include "driver/rtc_io.h"
+#include "soc/rtc_cntl_reg.h"
+#include "ulp_hook.h"
+#endif
 #include "app_task.h"
 #include "audio_task.h"
 #include "pots_task.h"
+#include "ans_mach.h"
+#include "blackbox.h"
+#include "boot_prof.h"
+#include "contacts.h"
+#include "dlog.h"
+#include "dtmf_qual.h"
+#include "evt_bus.h"
+#include "gcore_task.h"
+#include "hsm.h"
 #include "international.h"
+#include "prompt.h"
+#include "rot_dial.h"
+#include "soft_timer.h"
+#include "pace.h"
 #include "ps.h"
 #include "spandsp.h"
 #include "sys_common.h"
@@ -48,17 +75,68 @@
 //#define POTS_RING_DEBUG
 #define POTS_CID_DEBUG
 
+// Uncomment to generate the ring frequency with the LEDC peripheral driving PIN_FR.  The state
+// machine only starts and stops each ring of the cadence so the ring frequency is exact regardless
+// of core 0 load.  Comment out to toggle PIN_FR from the state machine (ring half-periods rounded
+// to POTS_EVAL_MSEC).
+#define ENABLE_HW_RINGER
+
+// Uncomment to timestamp PIN_SHK edges in a GPIO interrupt and decode the hook state, rotary
+// pulses and flashes from the exact edge times.  Comment out to sample PIN_SHK each evaluation
+// (transitions are then only known to within POTS_EVAL_MSEC and stretched by task delays).
+#define ENABLE_HOOK_EDGE_CAPTURE
+
+// Uncomment to detect ring trip (going off-hook while ring voltage is on the line) from the
+// PIN_SHK edges and stop the ring from a fast timer instead of waiting for the next evaluation
+// and the full debounce.  Requires ENABLE_HOOK_EDGE_CAPTURE.
+#define ENABLE_RING_TRIP
+
+#if defined(ENABLE_RING_TRIP) && !defined(ENABLE_HOOK_EDGE_CAPTURE)
+#error "ENABLE_RING_TRIP requires ENABLE_HOOK_EDGE_CAPTURE"
+#endif
+
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true) && !defined(ENABLE_HOOK_EDGE_CAPTURE)
+#error "CONFIG_POTS_ULP_HOOK_WATCH requires ENABLE_HOOK_EDGE_CAPTURE"
+#endif
+
 // State machine evaluation interval
 #define POTS_EVAL_MSEC           10
 
 // Make period required to move from off-hook back to on-hook (differentiate from rotary dialing pulses)
 #define POTS_ON_HOOK_DETECT_MSEC 500
 
-// Rotary dialing pulse detection
+// Rotary dialing pulse detection thresholds come from rot_dial (tuned to the dial)
 //   Break is maximum period to detect a pulse in a digit
 //   Make is minimum period between digits
-#define POTS_ROT_BREAK_MSEC      100
-#define POTS_ROT_MAKE_MSEC       100
+
+// In a call a break shorter than this is a hook switch glitch (knocking the handset) and not a
+// rotary pulse (nominally 60 mSec at 10 pulses/sec)
+#define POTS_ROT_BREAK_MIN_MSEC  30
+
+// Hook flash - an on-hook period too long to be a rotary pulse and too short to end the call
+// (at least POTS_FLASH_MARGIN_MSEC longer than the rotary break threshold and shorter than
+// POTS_ON_HOOK_DETECT_MSEC).  It is recognized at the timestamp of the edge going back off-hook.
+#define POTS_FLASH_MARGIN_MSEC   20
+
+// Hook edge capture
+//   Debounce is the time PIN_SHK must be stable before a transition is accepted
+//   Queue length must be a power of 2 and hold the edges (including contact bounce)
+//   arriving between evaluations
+#define POTS_HOOK_DEBOUNCE_MSEC  8
+#define POTS_EDGE_QUEUE_LEN      32
+
+// ULP hook switch watch (CONFIG_POTS_ULP_HOOK_WATCH) - once the phone has been on-hook with
+// nothing to do for POTS_ULP_IDLE_MSEC the ULP samples PIN_SHK every POTS_ULP_PERIOD_USEC in
+// place of the evaluations, waking us after 4 off-hook samples.  It logs up to
+// POTS_ULP_LOG_LEN edges (must match hook_watch.S) which are replayed into the edge queue.
+#define POTS_ULP_IDLE_MSEC       3000
+#define POTS_ULP_PERIOD_USEC     1000
+#define POTS_ULP_LOG_LEN         16
+
+// Ring trip - an off-hook level seen during ring-on must hold through half a ring cycle (so it
+// spans a reversal of the ring polarity, unlike the ringer load transients at each reversal).
+// It is checked every POTS_RING_TRIP_POLL_MSEC.
+#define POTS_RING_TRIP_POLL_MSEC 2
 
 // Post send DTMF tone wait period to allow audio buffers to drain of echoed back audio
 // (to prevent it from confusing the echo canceller if it gets switched in)
@@ -67,15 +145,101 @@
 // Post CID message wait period to allow audio buffers to drain of CID before switching to call
 #define POTS_CID_FLUSH_MSEC      50
 
+// Incoming call audio standby - an incoming call is over if no ring indication is seen for
+// POTS_INCOMING_MSEC (app_task may not signal the end if the call is answered elsewhere) and
+// after the phone is picked up we wait up to POTS_ANSWER_WAIT_MSEC in standby for the call
+// audio before giving dial tone
+#define POTS_INCOMING_MSEC       10000
+#define POTS_ANSWER_WAIT_MSEC    5000
+
+// Pre-rendered Caller ID audio buffer length - holds the longest message (a DTMF CID of a long
+// number or a FSK MDMF message with the long preamble and DT-AS)
+#define POTS_CID_BUF_LEN         (8000 * 3)
+
+// Caller ID self-test message (CONFIG_CID_SELF_TEST)
+#define POTS_CID_TEST_NUMBER     "5551234567"
+#define POTS_CID_TEST_NAME       "WEEBELL TEST"
+#define POTS_CID_TEST_TIME       "01021304"
+
+// Ring frequency generator (LEDC off the 1 MHz REF_TICK so it is unaffected by APB changes).
+// 10-bit resolution covers ring frequencies from 1 Hz to almost 1 kHz.
+#define POTS_RING_LEDC_MODE      LEDC_LOW_SPEED_MODE
+#define POTS_RING_LEDC_TIMER     LEDC_TIMER_0
+#define POTS_RING_LEDC_CH        LEDC_CHANNEL_0
+#define POTS_RING_LEDC_RES       LEDC_TIMER_10_BIT
+#define POTS_RING_LEDC_DUTY      (1 << (10 - 1))
+
 // Maximum number of tone steps
 #define POTS_MAX_TONE_STEPS      (INT_MAX_TONE_PAIRS * 2)
 
 // Tone generator buffer size
 #define POTS_TONE_BUF_LEN        (8000 * POTS_EVAL_MSEC / 1000)
 
+// Local tone played over the muted voice audio while a far end call progress tone is heard.
+// It goes through the TX mixer which is topped off to a few evaluations of audio each evaluation.
+#define POTS_FAR_TONE_MIX_LEN    (4 * POTS_TONE_BUF_LEN)
+#define POTS_FAR_TONE_MUTE_DB    -96.0f
+
+// Ringback played through the TX mixer over the voice audio standby stream while the phone
+// says the far end is ringing and the call audio isn't yet connected.  The last piece is faded
+// out over POTS_TONE_BUF_LEN samples so it blends into the call audio.
+#define POTS_RINGBACK_MIX_LEN    (4 * POTS_TONE_BUF_LEN)
+
+// Answering machine message playback through the TX mixer (kept topped off like the ringback)
+#define POTS_MSG_MIX_LEN         (4 * POTS_TONE_BUF_LEN)
+
+// Call waiting tone mixed over the voice audio while app_task says a call is waiting: a
+// 440 Hz burst repeating every POTS_CW_PERIOD_MSEC
+#define POTS_CW_FREQ             440
+#define POTS_CW_LEVEL_DBM0       -13
+#define POTS_CW_ON_MSEC          300
+#define POTS_CW_PERIOD_MSEC      10000
+
+// Type II (off-hook) Caller ID for a waiting call (CONFIG_CID_CALL_WAITING, Bellcore GR-575).
+// The far end is muted and the first call waiting tone burst (the SAS) is followed directly by
+// the CAS.  The phone's ACK must start within 160 mSec of the end of the CAS (the wait adds the
+// in-call DTMF detector's latency) and the FSK message starts 50 - 500 mSec after the end of the
+// ACK.  The alert and message are streamed into the mixer from cid_audio_buf, topped off well
+// ahead of each evaluation so they play without gaps and the timers can be set from the audio
+// still queued.
+#define POTS_CW_CAS_F1           2130
+#define POTS_CW_CAS_F2           2750
+#define POTS_CW_CAS_LEVEL_DBM0   -16
+#define POTS_CW_CAS_MSEC         80
+#define POTS_CW_ACK_WAIT_MSEC    200
+#define POTS_CW_FSK_DELAY_MSEC   120
+#define POTS_CW_CID_MIX_LEN      (8 * POTS_TONE_BUF_LEN)
+
 // DTMF decoder buffer size
 #define POTS_DTMF_BUF_LEN        (8000 * POTS_EVAL_MSEC / 1000)
 
+// DTMF decoder energy pre-gate - the Goertzel filters only run while the line holds enough
+// energy for a digit (the detector's own threshold is -42 dBm0 per tone).  The gate opens
+// when a block's mean (x*x >> 8) reaches POTS_DTMF_GATE_ON and closes after it has been
+// below POTS_DTMF_GATE_OFF for POTS_DTMF_GATE_HANG_MSEC so the detector sees enough quiet
+// to end the digit.
+#define POTS_DTMF_GATE_ON        10       // -50 dBm0
+#define POTS_DTMF_GATE_OFF       3        // -55 dBm0
+#define POTS_DTMF_GATE_HANG_MSEC 50
+
+// Tone cache - DDS generated tones are rendered, a chunk per evaluation, into one repeating
+// period in PSRAM after a country is selected so tone generation becomes a copy loop
+#define POTS_TONE_CACHE_CHUNK    800
+#define POTS_TONE_CACHE_MAX_LEN  (8000 * 4)
+
+// DTMF cache - the burst (tone and the following inter-digit silence) for each digit the app
+// can dial is rendered into PSRAM at startup so it is handed to audio_task in one put
+#define POTS_DTMF_CACHE_DIGITS   "0123456789*#ABCD"
+#define POTS_DTMF_CACHE_NUM      16
+
+// Hook and Caller ID state machine events
+#define POTS_HSM_EVT_OFF_HOOK    1        // Hook switch closed at the event time
+#define POTS_HSM_EVT_ON_HOOK     2        // Hook switch opened at the event time
+#define POTS_HSM_EVT_CID_LR      3        // Start Caller ID with a line reversal
+#define POTS_HSM_EVT_CID_RP_AS   4        // Start Caller ID with a short ring (RP-AS)
+#define POTS_HSM_EVT_CID_MSG     5        // Start Caller ID with the message
+#define POTS_HSM_EVT_CID_TIMER   6        // cid_timer expired
+
 
 
 //
@@ -93,14 +257,41 @@ static bool pots_in_service = false;       // Set if the phone can make a call,
 static bool pots_has_call_audio = false;   // Set when the external process has a connected phone call (used to suppress off-hook tone, enable audio)
 static bool pots_call_audio_16k;           // Set when connected phone call is using 16k samples/sec (false for 8k samples/sec)
 
-// Hook logic
+// Hook logic (pots_state follows pots_hook_hsm)
 typedef enum {ON_HOOK, OFF_HOOK, ON_HOOK_PROVISIONAL} pots_stateT;
-#ifdef POTS_STATE_DEBUG
-static const char* pots_state_name[] = {"ON_HOOK", "OFF_HOOK", "ON_HOOK_PROVISIONAL"};
-#endif
+static hsm_t pots_hook_hsm;
 static pots_stateT pots_state = ON_HOOK;
-static int pots_state_count;                     // Down counter for phone state change detection
 static bool pots_cur_off_hook = false;           // Debounced off-hook state
+#ifdef ENABLE_HOOK_EDGE_CAPTURE
+typedef struct {
+	int64_t usec;                                // esp_timer time of the edge
+	bool off_hook;                               // PIN_SHK level after the edge
+} pots_hook_edge_t;
+
+static pots_hook_edge_t pots_edge_queue[POTS_EDGE_QUEUE_LEN];  // Written by the ISR, read by pots_task
+static atomic_uint pots_edge_head = 0;
+static atomic_uint pots_edge_tail = 0;
+static atomic_bool pots_edge_overflow = false;
+static bool pots_raw_off_hook = false;           // Level after the latest edge
+static int64_t pots_raw_usec;                    // Time of the latest edge
+static int64_t pots_burst_usec;                  // Time of the first edge away from pots_cur_off_hook
+#endif
+#ifdef ENABLE_RING_TRIP
+static esp_timer_handle_t ring_trip_timer;       // Periodic ring trip check while ring voltage is applied
+static atomic_bool pots_ring_trip_armed = false; // Set while ring voltage is applied
+static atomic_bool pots_ring_trip_pending = false;  // Off-hook edge seen while armed
+static atomic_uint pots_ring_trip_edge_usec;     // Low 32 bits of the time of the off-hook edge
+static atomic_uint pots_ring_trip_stop_usec;     // Low 32 bits of the time the ring was stopped
+static unsigned int pots_ring_trip_hold_usec;    // Half a ring cycle
+#endif
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true)
+extern const uint8_t ulp_hook_bin_start[] asm("_binary_ulp_hook_bin_start");
+extern const uint8_t ulp_hook_bin_end[]   asm("_binary_ulp_hook_bin_end");
+static bool pots_ulp_ready = false;              // ULP program loaded
+static bool pots_ulp_watching = false;           // The ULP is watching PIN_SHK instead of the hook ISR
+static int pots_ulp_idle_count = 0;              // Counts idle evaluation cycles before a watch
+static portMUX_TYPE pots_ulp_mux = portMUX_INITIALIZER_UNLOCKED;
+#endif
 static bool pots_saw_hook_state_change = false;  // For API notification
 
 // Ring logic
@@ -114,9 +305,14 @@ static const char* pots_ring_state_name[] = {"RING_IDLE", "RING_PULSE_ON", "RING
 static pots_ring_stateT pots_ring_state = RING_IDLE;
 static int pots_num_ring_steps;          // Number of steps in a ring (at least 2 for a single ON/OFF)
 static int pots_ring_step;               // The current cadence step
+static const int* pots_ring_cadenceP;    // On/Off times (mSec) of the current ring's steps
 static int pots_ring_period_count;       // Counts down evaluation cycles for each ringing state
+#ifndef ENABLE_HW_RINGER
 static int pots_ring_pulse_count;        // Counts down pulses in one ring ON or OFF portion
+#endif
 static int pots_ring_num = 0;            // Number of rings starting with 0 (used by CID)
+static int pots_incoming_count = 0;      // Counts down evaluation cycles until an incoming call is over (0 when none)
+static int pots_answer_wait_count = 0;   // Counts down evaluation cycles waiting for the call audio after answering
 
 // Dialing logic
 typedef enum {DIAL_IDLE, DIAL_BREAK, DIAL_MAKE} pots_dial_stateT;
@@ -124,42 +320,75 @@ typedef enum {DIAL_IDLE, DIAL_BREAK, DIAL_MAKE} pots_dial_stateT;
 static const char* pots_dial_state_name[] = {"DIAL_IDLE", "DIAL_BREAK", "DIAL_MAKE"};
 #endif
 static pots_dial_stateT pots_dial_state = DIAL_IDLE;
-static int pots_dial_period_count;       // Counts up evaluation cycles for each dialing state
+static int64_t pots_dial_usec;           // Time of the transition into the current dialing state
 static int pots_dial_pulse_count;        // Counts pulses from the rotary dial for one digit
 static char pots_dial_cur_digit;         // 0 - 9, A - D, *, #
 static char pots_dial_last_dtmf_digit = ' ';
+static bool pots_dial_mic_muted = false;  // Mic muted while a digit is rotary dialed in a call
 
 // Tone generation logic
 typedef enum {TONE_IDLE, TONE_VOICE, TONE_VOICE_WAIT_HANGUP, TONE_DIAL, TONE_DIAL_QUIET,
-              TONE_DTMF, TONE_DTMF_FLUSH, TONE_NO_SERVICE, TONE_OFF_HOOK, TONE_CID, TONE_CID_FLUSH
+              TONE_DTMF, TONE_DTMF_FLUSH, TONE_NO_SERVICE, TONE_OFF_HOOK, TONE_CID, TONE_CID_FLUSH,
+              TONE_RINGBACK, TONE_ANS_MACH, TONE_MESSAGE
              } pots_tone_stateT;
 #ifdef POTS_STATE_DEBUG
 static const char* pots_tone_state_name[] = {"TONE_IDLE", "TONE_VOICE", "TONE_VOICE_WAIT_HANGUP",
                                              "TONE_DIAL", "TONE_DIAL_QUIET", "TONE_DTMF", 
                                              "TOND_DIAL_FLUSH", "TONE_NO_SERVICE", "TONE_OFF_HOOK",
-                                             "TONE_CID", "TONE_CID_FLUSH"
+                                             "TONE_CID", "TONE_CID_FLUSH", "TONE_RINGBACK",
+                                             "TONE_ANS_MACH", "TONE_MESSAGE"
                                             };
 #endif
 static pots_tone_stateT pots_tone_state = TONE_IDLE;
 static int pots_tone_timer_count = 0;             // Evaluation down count timer for tone logic
-static bool pots_notify_ext_digit_dialed = false; // Set by notification when another task dials a digit
+static bool pots_notify_ext_digit_dialed = false; // Set by an event when another task dials a digit
                                                   // (used to suppress dial tone and generate DTMF here)
+static bool pots_far_tone_req = false;            // Set by app_task while a far end call progress tone is heard
+static bool pots_far_tone_on = false;             // Set while the local reorder tone replaces the voice audio
+static bool pots_ringback_req = false;            // Set by app_task while an outgoing call is ringing
+static bool pots_cw_tone_req = false;             // Set by app_task while a second call is waiting
+static bool pots_cw_tone_on = false;              // Set while the call waiting tone is being mixed
+static tone_gen_state_t pots_cw_tone_state;
+static int16_t pots_cw_tone_buf[POTS_TONE_BUF_LEN];
+#if (CONFIG_ANS_MACH_ENABLE == true)
+static bool pots_am_req = false;                  // Set by app_task while the answering machine has a call
+static bool pots_msg_play_req = false;            // Set by the GUI to play a message to the handset
+#endif
 
 // Caller ID logic
 static bool pots_trigger_cid = false;
-typedef enum {CID_IDLE, CID_RP_AS, CID_PRE_MSG_WAIT, CID_MSG, CID_POST_MSG_WAIT} pots_cid_stateT;
-#ifdef POTS_CID_DEBUG
-static const char* pots_cid_state_name[] = {"CID_IDLE", "CID_RP_AS", "CID_PRE_MSG_WAIT", "CID_MSG", "CID_POST_MSG_WAIT"};
-#endif
+// (pots_cid_state follows pots_cid_hsm, CID_ACTIVE is the parent of the sequence states and
+// never the current state)
+typedef enum {CID_IDLE, CID_RP_AS, CID_PRE_MSG_WAIT, CID_MSG, CID_POST_MSG_WAIT, CID_ACTIVE} pots_cid_stateT;
+static hsm_t pots_cid_hsm;
 static pots_cid_stateT pots_cid_state = CID_IDLE;
-static int pots_cid_wait_count;           // Counts down evaluation cycles for each CID delay
+static esp_timer_handle_t cid_timer;      // One-shot timer for each CID delay
+static int16_t* cid_audio_buf;            // Complete CID audio rendered by _potsSetupCID
+static int cid_audio_len;
+static bool cid_audio_ready = false;      // cid_audio_buf holds audio rendered for the current CLIP
+static bool cid_audio_queued;             // cid_audio_buf has been handed to audio_task
 static adsi_tx_state_t* cid_tx_stateP;
-static uint8_t adsi_msg_buf[64];          // Buffer to hold complete CID message for spandsp
-                                          // must be larger that maximum message (date + caller phone #)
+static COLD_ATTR uint8_t adsi_msg_buf[96];          // Buffer to hold complete CID message for spandsp
+#if (CONFIG_CID_SELF_TEST == true)
+static int cid_test_pos;                  // End of the chunk of rendered audio being decoded
+static int cid_test_msg_pos;              // Sample position the message was delivered at, -1 if not yet
+static bool cid_test_match;               // Set if the delivered message holds the test number
+#endif
+#if (CONFIG_CID_CALL_WAITING == true)
+typedef enum {CW_CID_IDLE, CW_CID_ALERT, CW_CID_ACK_WAIT, CW_CID_PRE_MSG_WAIT, CW_CID_MSG, CW_CID_POST_MSG_WAIT} pots_cw_cid_stateT;
+#ifdef POTS_CID_DEBUG
+static const char* pots_cw_cid_state_name[] = {"CW_CID_IDLE", "CW_CID_ALERT", "CW_CID_ACK_WAIT", "CW_CID_PRE_MSG_WAIT",
+                                               "CW_CID_MSG", "CW_CID_POST_MSG_WAIT"};
+#endif
+static pots_cw_cid_stateT pots_cw_cid_state = CW_CID_IDLE;
+static const int16_t* cw_cid_playP;       // Next sample of the alert or message to mix
+static int cw_cid_play_len;               // Samples of it left to mix
+#endif
+                                          // must be larger that maximum message (date + caller phone # + name)
 
 // DDS Tone generator
 static int16_t tone_tx_buf[POTS_TONE_BUF_LEN];
-static super_tone_tx_step_t* tone_step[INT_NUM_TONE_SETS][POTS_MAX_TONE_STEPS];
+static super_tone_tx_step_t tone_step[INT_NUM_TONE_SETS][POTS_MAX_TONE_STEPS];   // Static so country changes don't allocate
 static super_tone_tx_state_t tone_state;
 
 // Sample-based Tone generator
@@ -172,42 +401,244 @@ static int sample_tone_tx_index;
 // Tone generation type flag
 static bool tone_tx_use_sample;
 
+// Rendered DDS tone cache (used as sample-based tones once complete)
+static int16_t* tone_cache_buf[INT_NUM_TONE_SETS];
+static int tone_cache_alloc_len[INT_NUM_TONE_SETS];      // Allocated size of each buffer (samples)
+static int tone_cache_len[INT_NUM_TONE_SETS];            // Samples in one period, 0 if not cached
+static super_tone_tx_state_t tone_cache_state;
+static int tone_cache_render_set;                        // Set currently being rendered, INT_NUM_TONE_SETS when done
+static int tone_cache_render_index;                      // Next sample to render in the current set
+
 // DTMF Decoder
 static int16_t dtmf_rx_buf[POTS_DTMF_BUF_LEN];
 static dtmf_rx_state_t dtmf_rx_state;
+static bool dtmf_gate_open;
+static int dtmf_gate_hang;                 // Quiet samples left before the gate closes
+static uint32_t dtmf_gate_blocks;          // Blocks seen and skipped since dialing started
+static uint32_t dtmf_gate_skipped;
 
 // DTMF Encoder
 static char dtmf_tx_digit_buf[2];          // DTMF character to generate a tone for + null
 static dtmf_tx_state_t dtmf_tx_state;
 
+// Rendered DTMF digit cache
+static int16_t* dtmf_cache_buf;            // All digits' bursts, NULL if not rendered
+static int dtmf_cache_index[POTS_DTMF_CACHE_NUM];   // Start of each digit's burst
+static int dtmf_cache_len[POTS_DTMF_CACHE_NUM];
+static const int16_t* dtmf_tx_cacheP;      // Burst for the current digit, NULL to generate it
+static int dtmf_tx_cache_len;
+static bool dtmf_tx_cache_queued;          // dtmf_tx_cacheP has been handed to audio_task
+static bool dtmf_tx_cache_wait;            // Let the previous digit's burst finish first
+
 
 //
 // Forward declarations
 //
 static void _potsInitGPIO();
-static void _potsInitTones(bool init);
+static void _potsInitTones();
+static void _potsInitToneCache();
+static void _potsEvalToneCache();
+static int _potsToneCycleLength(const tone_info_t* t);
+static void _potsStartToneCacheSet();
+static void _potsInitDtmfCache();
+static bool _potsEvalDtmfCache();
 static void _potsLineReverse(bool en);
 static void _potsLineRingMode(bool en);
-static void _potsHandleNotifications();
+#ifdef ENABLE_HW_RINGER
+static void _potsInitRinger();
+static void _potsRingerEnable(bool en);
+#endif
+static void _potsInit();
+static void _potsService(uint32_t notification_value);
+static void _potsEval();
+static int64_t _potsGetUsec();
+static uint32_t _potsHandleNotifications(TickType_t wait_ticks);
+static bool _potsGetExtDigit();
+#ifdef ENABLE_HOOK_EDGE_CAPTURE
+static void _potsHookIsr(void* arg);
+static void _potsHookEdgePush(int64_t t, bool off_hook);
+static bool _potsHookEdgePop(pots_hook_edge_t* e);
+static bool _potsHookDebounce(int64_t t);
+#else
+static bool _potsPollHook();
+#endif
 static bool _potsEvalHook();
-static void _potsEvalPhoneState(bool hookChange);
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true)
+static void _potsInitUlp();
+static bool _potsUlpCanWatch();
+static void _potsUlpWatchStart();
+static void _potsUlpWatchEnd();
+static void _potsUlpIsr(void* arg);
+#endif
+#ifdef ENABLE_RING_TRIP
+static void _potsInitRingTrip();
+static void _potsRingTripArm(bool en);
+static void _potsRingTripCallback(void* arg);
+static void _potsEvalRingTrip();
+#endif
+static bool _potsEvalHookAt(bool hookChange, int64_t t);
+static void _potsEvalPhoneState(bool hookChange, int64_t t);
+static bool _potsIsFlash();
+static void _potsHookFlash();
+static void _potsOnHookEntry(int from);
+static void _potsOffHookEntry(int from);
+static void _potsHookStateChange(int from, int to);
 static void _potsEvalRinger();
 static void _potsStartRing(bool is_rp_as);
+static void _potsSetRingCadence();
 static void _potsEndRing();
+static void _potsEndRingOn();
+static void _potsEndIncoming();
+#ifndef ENABLE_HW_RINGER
 static int _potsGetRingPulseCount(bool on_portion);
+#endif
+static void _potsInitCID();
 static void _potsEvalCID();
-static bool _potsSetupCID();
-static int _potsLocaleToCIDstandard();
-static bool _potsEvalDialer(bool hookChange);
+static void _potsEvalCIDTimer();
+static void _potsCIDTimerCallback(void* arg);
+static void _potsStartCIDTimer(int msec);
+static bool _potsCidOffHook();
+static bool _potsCidRingDone();
+static bool _potsCidMsgDone();
+static void _potsCidAbort();
+static void _potsCidLineReverse();
+static void _potsCidDone();
+static void _potsCidRpAsEntry(int from);
+static void _potsCidPreMsgEntry(int from);
+static void _potsCidMsgEntry(int from);
+static void _potsCidPostMsgEntry(int from);
+static void _potsCidActiveExit(int to);
+static void _potsCidStateChange(int from, int to);
+static bool _potsSetupCID(bool call_waiting);
+static bool _potsRenderCID(int cid_spec, const char* number, const char* name, const char* time_buf, bool off_hook);
+static bool _potsEvalCIDAudio();
+static int _potsCIDstandard(int cid_spec);
+#if (CONFIG_CID_SELF_TEST == true)
+static void _potsCIDSelfTest();
+static void _potsCIDSelfTestCallback(void* user_data, const uint8_t* msg, int len);
+#endif
+static bool _potsEvalDialer(bool hookChange, int64_t t);
+static void _potsDialMuteMic(bool en);
 static void _potsSetToneState(pots_tone_stateT ns);
 static void _potsEvalToneState(bool potsDigitDialed, bool appDigitDialed);
 static bool _potsEvalToneGen();
+static int _potsGetStatusTone(int16_t* buf, int len);
+static void _potsEvalFarTone();
+static void _potsStopFarTone();
+static void _potsEvalCallWaitingTone();
+#if (CONFIG_CID_CALL_WAITING == true)
+static void _potsStartCWCID();
+static void _potsEvalCWCID();
+static void _potsEvalCWCIDTimer();
+static void _potsEvalCWCIDAck();
+static void _potsEndCWCID();
+static bool _potsEvalCWCIDAudio();
+#endif
+static void _potsEvalRingback();
+static void _potsEndRingback();
+#if (CONFIG_ANS_MACH_ENABLE == true)
+static void _potsEvalMessage();
+#endif
+#if (CONFIG_PROMPT_ENABLE == true)
+static void _potsPromptBattery();
+#endif
+static void _potsEvalToneRefill();
 static bool _potsToneTimerExpired();
 static void _potsSendDialedDigit(char d);
 static void _potsSetAudioOutput(pots_tone_stateT s);
 static void _potsSetupAudioTone(int tone_index);
 static void _potsEvalDtmfDetect();
+static bool _potsDtmfGate(const int16_t* buf, int len);
 static void _potsDtmfCallback(void *data, const char *digits, int len);
+static void _potsDtmfQualityCallback(void *data, const dtmf_rx_quality_t *q);
+
+
+
+//
+// State machines
+//
+
+// Hook state: when we're on hook (otherwise we're either off hook or on hook only temporarily
+// as the rotary dial switches).  Events carry the time of the hook switch edge.
+static const hsm_state_t pots_hook_states[] = {
+	// name                 parent     entry               exit  timeout
+	{"ON_HOOK",             HSM_NONE,  _potsOnHookEntry,   NULL, 0},
+	{"OFF_HOOK",            HSM_NONE,  _potsOffHookEntry,  NULL, 0},
+	{"ON_HOOK_PROVISIONAL", HSM_NONE,  NULL,               NULL, 0}
+};
+
+static const hsm_trans_t pots_hook_trans[] = {
+	// state              event                  guard          after                     next                 action
+	{ON_HOOK,             POTS_HSM_EVT_OFF_HOOK, NULL,          0,                        OFF_HOOK,            NULL},
+	
+	// Back on-hook - it could be permanent or the start of a rotary dial
+	{OFF_HOOK,            POTS_HSM_EVT_ON_HOOK,  NULL,          0,                        ON_HOOK_PROVISIONAL, NULL},
+	
+	// Back off-hook (after too long for a rotary pulse app_task acts on the flash right away)
+	// or the call has ended
+	{ON_HOOK_PROVISIONAL, POTS_HSM_EVT_OFF_HOOK, _potsIsFlash,  0,                        OFF_HOOK,            _potsHookFlash},
+	{ON_HOOK_PROVISIONAL, POTS_HSM_EVT_OFF_HOOK, NULL,          0,                        OFF_HOOK,            NULL},
+	{ON_HOOK_PROVISIONAL, HSM_EVT_ANY,           NULL,          POTS_ON_HOOK_DETECT_MSEC, ON_HOOK,             NULL}
+};
+
+static const hsm_def_t pots_hook_hsm_def = {
+	.tag = "pots_task",
+	.states = pots_hook_states,
+	.num_states = sizeof(pots_hook_states) / sizeof(hsm_state_t),
+	.trans = pots_hook_trans,
+	.num_trans = sizeof(pots_hook_trans) / sizeof(hsm_trans_t),
+	.pre_change = NULL,
+	.post_change = _potsHookStateChange,
+#ifdef POTS_STATE_DEBUG
+	.log = true
+#endif
+};
+
+// Caller ID sequence, started by _potsEvalCID with the event for the country's way of
+// starting it, stepped by cid_timer and ended early if the phone goes off hook
+static const hsm_state_t pots_cid_states[] = {
+	// name                 parent      entry                 exit                timeout
+	{"CID_IDLE",            HSM_NONE,   NULL,                 NULL,               0},
+	{"CID_RP_AS",           CID_ACTIVE, _potsCidRpAsEntry,    NULL,               0},
+	{"CID_PRE_MSG_WAIT",    CID_ACTIVE, _potsCidPreMsgEntry,  NULL,               0},
+	{"CID_MSG",             CID_ACTIVE, _potsCidMsgEntry,     NULL,               0},
+	{"CID_POST_MSG_WAIT",   CID_ACTIVE, _potsCidPostMsgEntry, NULL,               0},
+	{"CID_ACTIVE",          HSM_NONE,   NULL,                 _potsCidActiveExit, 0}
+};
+
+static const hsm_trans_t pots_cid_trans[] = {
+	// state              event                   guard             after  next               action
+	{CID_ACTIVE,          HSM_EVT_ANY,            _potsCidOffHook,  0,     CID_IDLE,          _potsCidAbort},
+	
+	{CID_IDLE,            POTS_HSM_EVT_CID_LR,    NULL,             0,     CID_PRE_MSG_WAIT,  _potsCidLineReverse},
+	{CID_IDLE,            POTS_HSM_EVT_CID_RP_AS, NULL,             0,     CID_RP_AS,         NULL},
+	{CID_IDLE,            POTS_HSM_EVT_CID_MSG,   NULL,             0,     CID_MSG,           NULL},
+	
+	// Generating RP-AS (ring) alert, wait for the ring to complete
+	{CID_RP_AS,           HSM_EVT_ANY,            _potsCidRingDone, 0,     CID_PRE_MSG_WAIT,  NULL},
+	
+	// Waiting to start CID audio
+	{CID_PRE_MSG_WAIT,    POTS_HSM_EVT_CID_TIMER, NULL,             0,     CID_MSG,           NULL},
+	
+	// Generating Caller ID message audio, wait for message to complete
+	{CID_MSG,             HSM_EVT_ANY,            _potsCidMsgDone,  0,     CID_POST_MSG_WAIT, NULL},
+	
+	// Waiting after Caller ID before allowing or enabling ring
+	{CID_POST_MSG_WAIT,   POTS_HSM_EVT_CID_TIMER, NULL,             0,     CID_IDLE,          _potsCidDone}
+};
+
+static const hsm_def_t pots_cid_hsm_def = {
+	.tag = "pots_task",
+	.states = pots_cid_states,
+	.num_states = sizeof(pots_cid_states) / sizeof(hsm_state_t),
+	.trans = pots_cid_trans,
+	.num_trans = sizeof(pots_cid_trans) / sizeof(hsm_trans_t),
+	.pre_change = NULL,
+	.post_change = _potsCidStateChange,
+#ifdef POTS_CID_DEBUG
+	.log = true
+#endif
+};
 
 
 
@@ -216,12 +647,63 @@ static void _potsDtmfCallback(void *data, const char *digits, int len);
 //
 void pots_task(void* args)
 {
-	bool hook_changed;       // Debounced hook output changed
-	bool pots_digit_dialed;  // Set when a digit is detected having been dialed on the POTS phone
+	uint32_t notification_value;
+	TickType_t next_eval_tick;
+	TickType_t cur_tick;
   
 	
   	ESP_LOGI(TAG, "Start task");
   	
+	_potsInit();
+	
+	pace_declare(PACE_ID_POTS, "pots", PACE_PERIODIC, PACE_POTS_USEC);
+	next_eval_tick = xTaskGetTickCount();
+	while (true) {
+		// Block until there is a notification from another task (including audio_task
+		// watermarks) or it's time for the next state machine evaluation
+		cur_tick = xTaskGetTickCount();
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true)
+		if (pots_ulp_watching) {
+			// No evaluations while the ULP watches the hook switch, it or any other
+			// notification ends the watch
+			notification_value = _potsHandleNotifications(portMAX_DELAY);
+			_potsUlpWatchEnd();
+			next_eval_tick = xTaskGetTickCount();
+		} else {
+			notification_value = _potsHandleNotifications(((int32_t) (next_eval_tick - cur_tick) > 0) ? (next_eval_tick - cur_tick) : 0);
+		}
+#else
+		notification_value = _potsHandleNotifications(((int32_t) (next_eval_tick - cur_tick) > 0) ? (next_eval_tick - cur_tick) : 0);
+#endif
+		
+		_potsService(notification_value);
+		
+		// The state machine (hook, ring, dial and tone timing) still runs at a fixed rate
+		if ((int32_t) (xTaskGetTickCount() - next_eval_tick) < 0) {
+			continue;
+		}
+		next_eval_tick += pdMS_TO_TICKS(POTS_EVAL_MSEC);
+		pace_checkin(PACE_ID_POTS);
+		_potsEval();
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true)
+		
+		// Hand the hook switch to the ULP once there has been nothing to do for a while
+		if (_potsUlpCanWatch()) {
+			_potsUlpWatchStart();
+		}
+#endif
+	}
+}
+
+
+
+//
+// Internal functions
+//
+
+// Configures the hardware and state machines for the country in persistent storage
+static void _potsInit()
+{
 	// Country code configures what tones and patterns we generate
 	country_code = ps_get_country_code();
 	if (country_code >= int_get_num_countries()) {
@@ -230,71 +712,104 @@ void pots_task(void* args)
 	}
 	country_code_infoP = int_get_country_info(country_code);
 	ESP_LOGI(TAG, "Country: %s", country_code_infoP->name);
-		
+	
+	// We start on-hook with no Caller ID in progress
+	hsm_init(&pots_hook_hsm, &pots_hook_hsm_def, ON_HOOK, SOFT_TIMER_INVALID, 0);
+	hsm_init(&pots_cid_hsm, &pots_cid_hsm_def, CID_IDLE, SOFT_TIMER_INVALID, 0);
+	
 	// configure GPIO
 	_potsInitGPIO();
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true)
+	_potsInitUlp();
+#endif
 	
-	// Initialize our outgoing tone set (pre-allocate tone step info so we're
-	// not always needing to free and potentially fragment heap)
-	_potsInitTones(true);
+	// Initialize our outgoing tone set
+	_potsInitTones();
+	_potsInitDtmfCache();
 	
-	// Initialize our Caller ID data structure here so it will pre-allocate memory
+	// Initialize our Caller ID data structures here so it will pre-allocate memory
 	// at the beginning of time
-	cid_tx_stateP = adsi_tx_init(NULL, _potsLocaleToCIDstandard());
-		
-	while (true) {
-		// Look for notifications from other tasks
-		_potsHandleNotifications();
-				
-		// Evaluate hardware for changes
-		hook_changed = _potsEvalHook();
-		
-		// Evaluate hook state
-		_potsEvalPhoneState(hook_changed);
-		
-		// Evaluate DTMF tone detection
+	_potsInitCID();
+#if (CONFIG_CID_SELF_TEST == true)
+	_potsCIDSelfTest();
+#endif
+	
+	// Have audio_task tell us when tone audio needs servicing
+	audioSetToneWatermarks(POTS_TONE_BUF_LEN + 1, POTS_DTMF_BUF_LEN);
+	boot_prof_set_ready(BOOT_READY_POTS, "pots ready");
+}
+
+
+// Handles the notifications that need servicing before the next evaluation
+static void _potsService(uint32_t notification_value)
+{
+	// Service audio as soon as audio_task indicates it's ready
+	if (Notification(notification_value, POTS_NOTIFY_AUDIO_RX_READY_MASK)) {
 		_potsEvalDtmfDetect();
-		
-		// Evaluate our output state
-		_potsEvalRinger();
-		pots_digit_dialed = _potsEvalDialer(hook_changed);
-		_potsEvalCID();
-		_potsEvalToneState(pots_digit_dialed, pots_notify_ext_digit_dialed);
-		
-		if (pots_digit_dialed) {
-			_potsSendDialedDigit(pots_dial_cur_digit);
-#ifdef POTS_STATE_DEBUG
-			ESP_LOGI(TAG, "Dial %c", pots_dial_cur_digit);
+	}
+	if (Notification(notification_value, POTS_NOTIFY_AUDIO_TX_LOW_MASK)) {
+		_potsEvalToneRefill();
+	}
+	
+#ifdef ENABLE_RING_TRIP
+	// Answer as soon as ring trip is detected (the ring is already off)
+	if (Notification(notification_value, POTS_NOTIFY_RING_TRIP_MASK)) {
+		_potsEvalRingTrip();
+	}
 #endif
-		}
-		
-		// Clear notifications
-		pots_notify_ext_digit_dialed = false;
-		
-		vTaskDelay(pdMS_TO_TICKS(POTS_EVAL_MSEC));
+	
+	// Caller ID steps happen when their timer fires, not on the next evaluation
+	if (Notification(notification_value, POTS_NOTIFY_CID_TIMER_MASK)) {
+		_potsEvalCIDTimer();
+	}
+#if (CONFIG_CID_CALL_WAITING == true)
+	if (Notification(notification_value, POTS_NOTIFY_CW_ACK_MASK)) {
+		_potsEvalCWCIDAck();
 	}
+#endif
 }
 
 
-void pots_set_app_dialed_digit(char d)
+// One POTS_EVAL_MSEC evaluation of the hook, ring, dial and tone state machines.  All timing
+// comes from the number of evaluations and _potsGetUsec() so the state machines can be
+// stepped against any time base (host/sim drives _potsInit, _potsService and _potsEval
+// against a virtual clock).
+static void _potsEval()
 {
-	// Make a one-character string
-	dtmf_tx_digit_buf[0] = d;
-	dtmf_tx_digit_buf[1] = 0;
+	bool pots_digit_dialed;  // Set when a digit is detected having been dialed on the POTS phone
+	
+	// Evaluate hardware for changes, the hook state and dialing
+	pots_digit_dialed = _potsEvalHook();
+	pots_notify_ext_digit_dialed = _potsGetExtDigit();
+	
+	// Evaluate our output state
+	_potsEvalRinger();
+	_potsEvalCID();
+	_potsEvalToneState(pots_digit_dialed, pots_notify_ext_digit_dialed);
+	
+	// Incrementally render any DDS tones not yet in the cache
+	_potsEvalToneCache();
+	
+	// Clear notifications
+	pots_notify_ext_digit_dialed = false;
 }
 
 
+// Time base for hook switch timestamps and debounce (uSec)
+static int64_t _potsGetUsec()
+{
+	return esp_timer_get_time();
+}
 
-//
-// Internal functions
-//
 
-static void _potsHandleNotifications()
+// Wait up to wait_ticks for notifications and handle them, returning the notification value
+// so the caller can handle the audio watermark notifications
+static uint32_t _potsHandleNotifications(TickType_t wait_ticks)
 {
 	uint32_t notification_value = 0;
 	
 	// Handle notifications (clear them upon reading)
-	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, 0)) {
+	if (xTaskNotifyWait(0x00, 0xFFFFFFFF, &notification_value, wait_ticks)) {
 		//
 		// Service available
 		//
@@ -331,6 +846,12 @@ static void _potsHandleNotifications()
 		}
 		if (Notification(notification_value, POTS_NOTIFY_RING_MASK)) {
 			if (!pots_do_not_disturb) {
+				// Bring up audio in standby so answering is immediate
+				pots_incoming_count = POTS_INCOMING_MSEC / POTS_EVAL_MSEC;
+				if ((pots_tone_state == TONE_IDLE) && (pots_state == ON_HOOK)) {
+					xTaskNotify(task_handle_audio, AUDIO_NOTIFY_STANDBY_MASK, eSetBits);
+				}
+				
 				if ((pots_ring_num == 0) &&
 				    (country_code_infoP->cid.cid_spec & INT_CID_TYPE_MASK) &&
 				    (country_code_infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING)) {
@@ -339,7 +860,7 @@ static void _potsHandleNotifications()
 					// of a phone call and the country information requires CID before ring
 					pots_trigger_cid = true;
 #ifdef POTS_CID_DEBUG
-					ESP_LOGI(TAG, "Pre-ring CID trigger");
+					DLOGI(TAG, "Pre-ring CID trigger");
 #endif
 				} else {
 					// Start a ring
@@ -347,17 +868,55 @@ static void _potsHandleNotifications()
 				}
 			}
 		}
+		if (Notification(notification_value, POTS_NOTIFY_FAR_TONE_MASK)) {
+			pots_far_tone_req = true;
+		}
+		if (Notification(notification_value, POTS_NOTIFY_FAR_TONE_END_MASK)) {
+			pots_far_tone_req = false;
+		}
+		if (Notification(notification_value, POTS_NOTIFY_RINGBACK_MASK)) {
+			pots_ringback_req = true;
+		}
+		if (Notification(notification_value, POTS_NOTIFY_RINGBACK_END_MASK)) {
+			pots_ringback_req = false;
+		}
+#if (CONFIG_ANS_MACH_ENABLE == true)
+		if (Notification(notification_value, POTS_NOTIFY_ANS_MACH_MASK)) {
+			// Any ring still pending is for the call being answered
+			pots_am_req = true;
+			pots_trigger_pots_ring = false;
+		}
+		if (Notification(notification_value, POTS_NOTIFY_ANS_MACH_END_MASK)) {
+			pots_am_req = false;
+		}
+		if (Notification(notification_value, POTS_NOTIFY_MSG_PLAY_MASK)) {
+			pots_msg_play_req = true;
+		}
+		if (Notification(notification_value, POTS_NOTIFY_MSG_STOP_MASK)) {
+			pots_msg_play_req = false;
+		}
+#endif
+		if (Notification(notification_value, POTS_NOTIFY_CALL_WAITING_MASK)) {
+			pots_cw_tone_req = true;
+		}
+		if (Notification(notification_value, POTS_NOTIFY_CALL_WAIT_END_MASK)) {
+			pots_cw_tone_req = false;
+		}
 		if (Notification(notification_value, POTS_NOTIFY_DONE_RINGING_MASK)) {
 			// Reset the ring count when app_task determines a call we haven't picked
 			// up is over
 			pots_ring_num = 0;
+			cid_audio_ready = false;
+			_potsEndIncoming();
 		}
-		
-		//
-		// External dialing
-		//
-		if (Notification(notification_value, POTS_NOTIFY_EXT_DIAL_DIGIT_MASK)) {
-			pots_notify_ext_digit_dialed = true;   // Must be cleared during evaluation
+		if (Notification(notification_value, POTS_NOTIFY_NEW_CID_MASK)) {
+			// Render the Caller ID audio as soon as the number arrives so it is ready when the
+			// ring ends (unless a message is currently being sent from the buffer)
+			if ((pots_state == ON_HOOK) && (pots_cid_state == CID_IDLE) &&
+			    (country_code_infoP->cid.cid_spec & INT_CID_TYPE_MASK)) {
+				
+				cid_audio_ready = _potsSetupCID(false);
+			}
 		}
 		
 		//
@@ -369,7 +928,12 @@ static void _potsHandleNotifications()
 			ESP_LOGI(TAG, "New Country: %s", country_code_infoP->name);
 					
 			// Re-initialize tone set
-			_potsInitTones(false);
+			_potsInitTones();
+			
+			// Any pre-rendered Caller ID was for the old country
+			if (pots_cid_state == CID_IDLE) {
+				cid_audio_ready = false;
+			}
 			
 			// Re-initialize tone state if we're in the middle of generating a tone
 			if (pots_tone_state == TONE_DIAL){
@@ -378,9 +942,33 @@ static void _potsHandleNotifications()
 				_potsSetupAudioTone(INT_TONE_SET_RO_INDEX);
 			} else if (pots_tone_state == TONE_OFF_HOOK) {
 				_potsSetupAudioTone(INT_TONE_SET_OH_INDEX);
+			} else if (pots_tone_state == TONE_RINGBACK) {
+				_potsSetupAudioTone(INT_TONE_SET_RB_INDEX);
+			} else if (pots_far_tone_on) {
+				_potsSetupAudioTone(INT_TONE_SET_RO_INDEX);
 			}
 		}
 	}
+	
+	return notification_value;
+}
+
+
+// Take the next digit app_task dialed for us (one per evaluation so each gets its own tone)
+static bool _potsGetExtDigit()
+{
+	evt_msg_t evt;
+	
+	while (evt_bus_receive(EVT_QUEUE_POTS, &evt, 0)) {
+		if (evt.id == POTS_EVT_EXT_DIAL_DIGIT) {
+			// Make a one-character string
+			dtmf_tx_digit_buf[0] = evt.u.digit;
+			dtmf_tx_digit_buf[1] = 0;
+			return true;
+		}
+	}
+	
+	return false;
 }
 
 
@@ -395,21 +983,45 @@ static void _potsInitGPIO()
 	gpio_reset_pin(PIN_FR);
 	gpio_set_direction(PIN_FR, GPIO_MODE_OUTPUT);
 	gpio_set_level(PIN_FR, 1);
+#ifdef ENABLE_HW_RINGER
+	_potsInitRinger();
+#endif
 	
 	// Switch Hook (SHK) pin - input, high = off-hook
 	gpio_reset_pin(PIN_SHK);
 	gpio_set_direction(PIN_SHK, GPIO_MODE_INPUT);
+#ifdef ENABLE_HOOK_EDGE_CAPTURE
+	esp_err_t ret;
+	
+	// Start from the current level (e.g. phone already off-hook)
+	pots_raw_off_hook = (gpio_get_level(PIN_SHK) == 1);
+	pots_raw_usec = _potsGetUsec();
+	pots_burst_usec = pots_raw_usec;
+	
+	gpio_set_intr_type(PIN_SHK, GPIO_INTR_ANYEDGE);
+	ret = gpio_install_isr_service(0);
+	if ((ret != ESP_OK) && (ret != ESP_ERR_INVALID_STATE)) {
+		// ESP_ERR_INVALID_STATE means another module already installed it
+		ESP_LOGE(TAG, "Install GPIO ISR service failed - %d", ret);
+	}
+	ret = gpio_isr_handler_add(PIN_SHK, _potsHookIsr, NULL);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Add hook ISR failed - %d", ret);
+	}
+#endif
+#ifdef ENABLE_RING_TRIP
+	_potsInitRingTrip();
+#endif
 }
 
 
-static void _potsInitTones(bool init)
+static void _potsInitTones()
 {
 	int cycles;
 	int i, j;
 	int steps;
 	float t1, t2, t3, t4;
 	const tone_info_t* cur_tone_set;
-	super_tone_tx_step_t* prev_tone_step;
 	
 	// Always load all tone (both sample and DDS generated) from the current country
 	// data structure
@@ -432,87 +1044,459 @@ static void _potsInitTones(bool init)
 		} else {
 			steps = cur_tone_set->num_cadence_pairs * 2;
 		}
+		if (steps > POTS_MAX_TONE_STEPS) {
+			steps = POTS_MAX_TONE_STEPS;
+		}
 	
-		// Load each entry
-		prev_tone_step = NULL;
-		for (j=0; j<POTS_MAX_TONE_STEPS; j++) {  // j is step 0, 2.. Max-1
-			if (j < steps) {
-				// First tone step repeats forever, linked ones only execute once
-				cycles = (j == 0) ? 0 : 1;
-				
-				// Even tone steps have a tone, Odd tone steps are silent
-				if ((j & 0x1) == 0) {
-					t1 = cur_tone_set->tone[0];
-					t2 = cur_tone_set->tone[1];
-					t3 = cur_tone_set->tone[2];
-					t4 = cur_tone_set->tone[3];
-				} else {
-					t1 = 0;
-					t2 = 0;
-					t3 = 0;
-					t4 = 0;
-				}
-				
-				// Load valid tone info
-				if (init) {
-					// Initialize and perform the initial malloc of the actual data structure
-					tone_step[i][j] = super_tone_tx_make_step_4(NULL, 
-															    t1,
-															    t2,
-															    t3,
-															    t4,
-															    cur_tone_set->level,
-															    cur_tone_set->cadence_pairs[j],
-															    cycles);
-				} else {
-					// Initialize but reuse previous memory allocation
-					tone_step[i][j] = super_tone_tx_make_step_4(tone_step[i][j], 
-															    t1,
-															    t2,
-															    t3,
-															    t4,
-															    cur_tone_set->level,
-															    cur_tone_set->cadence_pairs[j],
-															    cycles);
-				}
-				
-				// Link to previous step
-				if (j > 0) {
-					prev_tone_step->nest = tone_step[i][j];
-				}
+		// Fill each valid step in place (steps past the last are never linked to)
+		for (j=0; j<steps; j++) {
+			// First tone step repeats forever, linked ones only execute once
+			cycles = (j == 0) ? 0 : 1;
+			
+			// Even tone steps have a tone, Odd tone steps are silent
+			if ((j & 0x1) == 0) {
+				t1 = cur_tone_set->tone[0];
+				t2 = cur_tone_set->tone[1];
+				t3 = cur_tone_set->tone[2];
+				t4 = cur_tone_set->tone[3];
 			} else {
-				// No valid tone for this entry - but allocate it if it does not exist (some future selected
-				// country code may use it)
-				if (init) {
-					tone_step[i][j] = super_tone_tx_make_step_4(NULL, 0, 0, 0, 0, 0, 0, 0);
-				}
-				
-				// Previous tone step has no link
-				if (j > 0) {
-					prev_tone_step->nest = NULL;
-				}
+				t1 = 0;
+				t2 = 0;
+				t3 = 0;
+				t4 = 0;
+			}
+			
+			(void) super_tone_tx_make_step_4(&tone_step[i][j],
+			                                 t1,
+			                                 t2,
+			                                 t3,
+			                                 t4,
+			                                 cur_tone_set->level,
+			                                 cur_tone_set->cadence_pairs[j],
+			                                 cycles);
+			
+			// Link to previous step (make_step_4 leaves this one's link NULL)
+			if (j > 0) {
+				tone_step[i][j-1].nest = &tone_step[i][j];
+			}
+		}
+	}
+	
+	// Start rendering the DDS tones into the cache
+	_potsInitToneCache();
+}
+
+
+// Setup the tone cache for the current country.  Sets with a sample from the country data
+// don't need rendering.  Existing buffers are reused when large enough.
+static void _potsInitToneCache()
+{
+	int i;
+	int len;
+	
+	for (i=0; i<INT_NUM_TONE_SETS; i++) {
+		tone_cache_len[i] = 0;
+		
+		len = (sample_tone_tx_length[i] == 0) ? _potsToneCycleLength(&(country_code_infoP->tone_set[i])) : 0;
+		if (len > tone_cache_alloc_len[i]) {
+			if (tone_cache_buf[i] != NULL) {
+				heap_caps_free(tone_cache_buf[i]);
+			}
+			tone_cache_buf[i] = (int16_t*) heap_caps_malloc(len * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+			if (tone_cache_buf[i] == NULL) {
+				ESP_LOGE(TAG, "Could not allocate tone cache %d", i);
+				tone_cache_alloc_len[i] = 0;
+				len = 0;
+			} else {
+				tone_cache_alloc_len[i] = len;
+			}
+		}
+		
+		// Temporarily hold the length to render
+		tone_cache_len[i] = len;
+	}
+	
+	tone_cache_render_set = 0;
+	_potsStartToneCacheSet();
+}
+
+
+// Render up to POTS_TONE_CACHE_CHUNK samples of the current set.  A completed set is
+// handed to the sample-based tone generator (and used the next time that tone starts).
+static void _potsEvalToneCache()
+{
+	int n;
+	
+	if (tone_cache_render_set >= INT_NUM_TONE_SETS) return;
+	
+	n = tone_cache_len[tone_cache_render_set] - tone_cache_render_index;
+	if (n > POTS_TONE_CACHE_CHUNK) n = POTS_TONE_CACHE_CHUNK;
+	n = super_tone_tx(&tone_cache_state, &tone_cache_buf[tone_cache_render_set][tone_cache_render_index], n);
+	tone_cache_render_index += n;
+	
+	if ((n == 0) || (tone_cache_render_index >= tone_cache_len[tone_cache_render_set])) {
+		if (tone_cache_render_index == tone_cache_len[tone_cache_render_set]) {
+			sample_tone_tx_bufP[tone_cache_render_set] = tone_cache_buf[tone_cache_render_set];
+			sample_tone_tx_length[tone_cache_render_set] = tone_cache_len[tone_cache_render_set];
+		} else {
+			// Generator ended early, leave this tone DDS generated
+			tone_cache_len[tone_cache_render_set] = 0;
+		}
+		
+		tone_cache_render_set++;
+		_potsStartToneCacheSet();
+	}
+}
+
+
+// Returns the number of samples in one repeating period of a DDS tone, 0 if it can't be cached
+static int _potsToneCycleLength(const tone_info_t* t)
+{
+	int a, b, i;
+	int len = 0;
+	
+	if (t->num_cadence_pairs == 0) {
+		// Continuous tone repeats at the greatest common divisor of its frequencies
+		a = 8000;
+		for (i=0; i<4; i++) {
+			b = (int) t->tone[i];
+			if ((float) b != t->tone[i]) {
+				// Non-integer frequency: fall back to a 1 second period
+				a = 1;
+				break;
+			}
+			while (b != 0) {
+				len = a % b;
+				a = b;
+				b = len;
 			}
-			prev_tone_step = tone_step[i][j];
 		}
+		len = 8000 / a;
+		if (len == 1) {
+			// No tone
+			len = 0;
+		}
+	} else {
+		for (i=0; i<(t->num_cadence_pairs * 2); i++) {
+			len += 8000 * t->cadence_pairs[i] / 1000;
+		}
+	}
+	
+	if (len > POTS_TONE_CACHE_MAX_LEN) len = 0;
+	
+	return len;
+}
+
+
+// Skip to the next set needing rendering and initialize its generator
+static void _potsStartToneCacheSet()
+{
+	while ((tone_cache_render_set < INT_NUM_TONE_SETS) && (tone_cache_len[tone_cache_render_set] == 0)) {
+		tone_cache_render_set++;
+	}
+	
+	if (tone_cache_render_set < INT_NUM_TONE_SETS) {
+		(void) super_tone_tx_init(&tone_cache_state, &tone_step[tone_cache_render_set][0]);
+		tone_cache_render_index = 0;
+	}
+}
+
+
+// Render each DTMF digit's burst into one PSRAM buffer.  DTMF is the same for all countries
+// so this is done once.  The first pass measures the bursts.  Digits are generated by
+// dtmf_tx as they are dialed if the buffer can't be allocated.
+static void _potsInitDtmfCache()
+{
+	char digit[2];
+	int i, n, len;
+	int total = 0;
+	
+	digit[1] = 0;
+	for (i=0; i<POTS_DTMF_CACHE_NUM; i++) {
+		digit[0] = POTS_DTMF_CACHE_DIGITS[i];
+		(void) dtmf_tx_init(&dtmf_tx_state);
+		dtmf_tx_put(&dtmf_tx_state, digit, -1);
+		len = 0;
+		while ((n = dtmf_tx(&dtmf_tx_state, tone_tx_buf, POTS_TONE_BUF_LEN)) != 0) {
+			len += n;
+		}
+		dtmf_cache_index[i] = total;
+		dtmf_cache_len[i] = len;
+		total += len;
+	}
+	
+	dtmf_cache_buf = (int16_t*) heap_caps_malloc(total * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+	if (dtmf_cache_buf == NULL) {
+		ESP_LOGE(TAG, "Could not allocate DTMF cache");
+		return;
 	}
+	
+	for (i=0; i<POTS_DTMF_CACHE_NUM; i++) {
+		digit[0] = POTS_DTMF_CACHE_DIGITS[i];
+		(void) dtmf_tx_init(&dtmf_tx_state);
+		dtmf_tx_put(&dtmf_tx_state, digit, -1);
+		(void) dtmf_tx(&dtmf_tx_state, &dtmf_cache_buf[dtmf_cache_index[i]], dtmf_cache_len[i]);
+	}
+	
+	// Leave the generator ready for uncached use
+	(void) dtmf_tx_init(&dtmf_tx_state);
 }
 
 
+#ifdef ENABLE_HW_RINGER
+// PIN_FR is connected to the LEDC and idles high (disabled) until the first ring
+static void _potsInitRinger()
+{
+	esp_err_t ret;
+	ledc_timer_config_t timer_config = {
+		.speed_mode = POTS_RING_LEDC_MODE,
+		.duty_resolution = POTS_RING_LEDC_RES,
+		.timer_num = POTS_RING_LEDC_TIMER,
+		.freq_hz = country_code_infoP->ring_info.freq,
+		.clk_cfg = LEDC_USE_REF_TICK
+	};
+	ledc_channel_config_t channel_config = {
+		.gpio_num = PIN_FR,
+		.speed_mode = POTS_RING_LEDC_MODE,
+		.channel = POTS_RING_LEDC_CH,
+		.intr_type = LEDC_INTR_DISABLE,
+		.timer_sel = POTS_RING_LEDC_TIMER,
+		.duty = 0,
+		.hpoint = 0
+	};
+	
+	ret = ledc_timer_config(&timer_config);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Ring timer config failed - %d", ret);
+	}
+	ret = ledc_channel_config(&channel_config);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "Ring channel config failed - %d", ret);
+	}
+	
+	_potsLineReverse(false);
+}
+
+
+// Start or stop the ring frequency square wave on PIN_FR (starting with a full half-period)
+static void _potsRingerEnable(bool en)
+{
+	if (en) {
+		ledc_set_freq(POTS_RING_LEDC_MODE, POTS_RING_LEDC_TIMER, country_code_infoP->ring_info.freq);
+		ledc_timer_rst(POTS_RING_LEDC_MODE, POTS_RING_LEDC_TIMER);
+		ledc_set_duty(POTS_RING_LEDC_MODE, POTS_RING_LEDC_CH, POTS_RING_LEDC_DUTY);
+		ledc_update_duty(POTS_RING_LEDC_MODE, POTS_RING_LEDC_CH);
+	} else {
+		_potsLineReverse(false);
+	}
+}
+#endif
+
+
 static void _potsLineReverse(bool en)
 {
+#ifdef ENABLE_HW_RINGER
+	// The LEDC owns PIN_FR so a static level is its idle level
+	ledc_stop(POTS_RING_LEDC_MODE, POTS_RING_LEDC_CH, en ? 0 : 1);
+#else
 	gpio_set_level(PIN_FR, en ? 0 : 1);
+#endif
 }
 
 
 static void _potsLineRingMode(bool en)
 {
 	gpio_set_level(PIN_RM, en ? 1 : 0);
+#ifdef ENABLE_RING_TRIP
+	_potsRingTripArm(en);
+#endif
+}
+
+
+// Evaluates hook switch transitions and the state machines that use them
+//   returns true if a digit was dialed
+static bool _potsEvalHook()
+{
+	bool digit_dialed = false;
+#ifdef ENABLE_HOOK_EDGE_CAPTURE
+	pots_hook_edge_t e;
+	int64_t now_usec;
+	
+	if (atomic_exchange(&pots_edge_overflow, false)) {
+		// Edges were lost so throw away the (incomplete) queue and resync to the pin
+		DLOGW(TAG, "Hook edge queue overflow");
+		while (_potsHookEdgePop(&e)) {};
+		pots_raw_off_hook = (gpio_get_level(PIN_SHK) == 1);
+		pots_raw_usec = _potsGetUsec();
+		pots_burst_usec = pots_raw_usec;
+	}
+	
+	// Decode queued edges in the order they occurred
+	while (_potsHookEdgePop(&e)) {
+		digit_dialed |= _potsHookDebounce(e.usec);
+		if (e.off_hook != pots_raw_off_hook) {
+			if (pots_raw_off_hook == pots_cur_off_hook) {
+				pots_burst_usec = e.usec;
+			}
+			pots_raw_off_hook = e.off_hook;
+		}
+		pots_raw_usec = e.usec;
+	}
+	
+	now_usec = _potsGetUsec();
+	digit_dialed |= _potsHookDebounce(now_usec);
+	
+	// Timeouts can only run up to the start of a transition that is still debouncing
+	if (pots_raw_off_hook != pots_cur_off_hook) {
+		now_usec = pots_burst_usec;
+	}
+	digit_dialed |= _potsEvalHookAt(false, now_usec);
+#else
+	digit_dialed = _potsEvalHookAt(_potsPollHook(), _potsGetUsec());
+#endif
+	
+	return digit_dialed;
+}
+
+
+#ifdef ENABLE_HOOK_EDGE_CAPTURE
+static void _potsHookIsr(void* arg)
+{
+	int64_t t = esp_timer_get_time();
+	bool off_hook = (gpio_get_level(PIN_SHK) == 1);
+	
+	_potsHookEdgePush(t, off_hook);
+#ifdef ENABLE_RING_TRIP
+	
+	// Time the first off-hook edge during ring-on for ring trip (an on-hook edge restarts it)
+	if (atomic_load(&pots_ring_trip_armed)) {
+		if (!off_hook) {
+			atomic_store(&pots_ring_trip_pending, false);
+		} else if (!atomic_load(&pots_ring_trip_pending)) {
+			atomic_store(&pots_ring_trip_edge_usec, (unsigned int) t);
+			atomic_store(&pots_ring_trip_pending, true);
+		}
+	}
+#endif
+}
+
+
+// Only one context may push at a time (the ISR, or pots_task while the ISR is disabled)
+static void _potsHookEdgePush(int64_t t, bool off_hook)
+{
+	unsigned int head = atomic_load(&pots_edge_head);
+	
+	if ((head - atomic_load(&pots_edge_tail)) < POTS_EDGE_QUEUE_LEN) {
+		pots_edge_queue[head % POTS_EDGE_QUEUE_LEN].usec = t;
+		pots_edge_queue[head % POTS_EDGE_QUEUE_LEN].off_hook = off_hook;
+		atomic_store(&pots_edge_head, head + 1);
+	} else {
+		atomic_store(&pots_edge_overflow, true);
+	}
+}
+
+
+static bool _potsHookEdgePop(pots_hook_edge_t* e)
+{
+	unsigned int tail = atomic_load(&pots_edge_tail);
+	
+	if (tail == atomic_load(&pots_edge_head)) {
+		return false;
+	}
+	*e = pots_edge_queue[tail % POTS_EDGE_QUEUE_LEN];
+	atomic_store(&pots_edge_tail, tail + 1);
+	return true;
+}
+
+
+// Accepts a transition, timestamped with the first edge of its burst, once the pin has been
+// stable for the debounce period at time t - returns true if a digit was dialed
+static bool _potsHookDebounce(int64_t t)
+{
+	if ((pots_raw_off_hook != pots_cur_off_hook) && ((t - pots_raw_usec) >= (POTS_HOOK_DEBOUNCE_MSEC * 1000))) {
+		pots_cur_off_hook = pots_raw_off_hook;
+		return _potsEvalHookAt(true, pots_burst_usec);
+	}
+	
+	return false;
+}
+
+#ifdef ENABLE_RING_TRIP
+static void _potsInitRingTrip()
+{
+	const esp_timer_create_args_t timer_args = {
+		.callback = &_potsRingTripCallback,
+		.name = "ring_trip"
+	};
+	
+	if (esp_timer_create(&timer_args, &ring_trip_timer) != ESP_OK) {
+		ESP_LOGE(TAG, "Create ring trip timer failed");
+	}
+}
+
+
+// Start checking for ring trip when ring voltage is applied and stop when it's removed
+static void _potsRingTripArm(bool en)
+{
+	if (en) {
+		pots_ring_trip_hold_usec = 500000 / country_code_infoP->ring_info.freq;
+		atomic_store(&pots_ring_trip_pending, false);
+		atomic_store(&pots_ring_trip_armed, true);
+		(void) esp_timer_stop(ring_trip_timer);
+		(void) esp_timer_start_periodic(ring_trip_timer, POTS_RING_TRIP_POLL_MSEC * 1000);
+	} else {
+		atomic_store(&pots_ring_trip_armed, false);
+		(void) esp_timer_stop(ring_trip_timer);
+	}
 }
 
 
+// Runs in the esp_timer task - stops the ring the moment an off-hook edge has held long enough
+// and lets pots_task take the phone off-hook
+static void _potsRingTripCallback(void* arg)
+{
+	unsigned int now = (unsigned int) esp_timer_get_time();
+	
+	if (!atomic_load(&pots_ring_trip_pending) || (gpio_get_level(PIN_SHK) == 0)) {
+		return;
+	}
+	if ((now - atomic_load(&pots_ring_trip_edge_usec)) < pots_ring_trip_hold_usec) {
+		return;
+	}
+	if (atomic_exchange(&pots_ring_trip_armed, false)) {
+		_potsLineReverse(false);
+		gpio_set_level(PIN_RM, 0);
+		atomic_store(&pots_ring_trip_stop_usec, now);
+		xTaskNotify(task_handle_pots, POTS_NOTIFY_RING_TRIP_MASK, eSetBits);
+	}
+}
+
+
+// Decode the hook edges now so the off-hook event goes out without waiting for the next
+// evaluation (the edge has held longer than the debounce period)
+static void _potsEvalRingTrip()
+{
+	unsigned int edge_usec = atomic_load(&pots_ring_trip_edge_usec);
+	
+	// No digit can be dialed going off-hook to answer
+	(void) _potsEvalHook();
+	if ((pots_state == OFF_HOOK) && (pots_ring_state != RING_IDLE)) {
+		_potsEndRing();
+	}
+	
+#ifdef POTS_STATE_DEBUG
+	DLOGI(TAG, "Ring trip - ring off %u mSec, off-hook %u mSec",
+		(atomic_load(&pots_ring_trip_stop_usec) - edge_usec) / 1000,
+		((unsigned int) _potsGetUsec() - edge_usec) / 1000);
+#endif
+}
+#endif
+
+#else
+
 // Updates current hook switch state
 //   returns true if the state changes, false otherwise
-static bool _potsEvalHook() {
+static bool _potsPollHook() {
 	bool cur_hw_off_hook;
 	bool changed_detected = false;
 	static bool pots_prev_off_hook = false;          // Previous state for off-hook debounce
@@ -534,63 +1518,233 @@ static bool _potsEvalHook() {
 	
 	return changed_detected;
 }
+#endif
+
+
+#if (CONFIG_POTS_ULP_HOOK_WATCH == true)
+static void _potsInitUlp()
+{
+	esp_err_t ret;
+	
+	ret = ulp_load_binary(0, ulp_hook_bin_start, (ulp_hook_bin_end - ulp_hook_bin_start) / sizeof(uint32_t));
+	if (ret == ESP_OK) {
+		ret = rtc_isr_register(_potsUlpIsr, NULL, RTC_CNTL_ULP_CP_INT_ENA_M);
+	}
+	if (ret == ESP_OK) {
+		// Let the ULP wake the cores from light sleep
+		ret = esp_sleep_enable_ulp_wakeup();
+	}
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "ULP hook watch init failed - %d", ret);
+		return;
+	}
+	
+	pots_ulp_ready = true;
+}
+
+
+// Returns true once the phone has been on-hook with no ring, Caller ID, tone or pending hook
+// edge for POTS_ULP_IDLE_MSEC
+static bool _potsUlpCanWatch()
+{
+	bool idle;
+	
+	idle = pots_ulp_ready &&
+	       (pots_state == ON_HOOK) && !pots_cur_off_hook && !pots_raw_off_hook &&
+	       (atomic_load(&pots_edge_head) == atomic_load(&pots_edge_tail)) &&
+	       (pots_dial_state == DIAL_IDLE) &&
+	       (pots_ring_state == RING_IDLE) && (pots_incoming_count == 0) &&
+	       !pots_trigger_pots_ring && !pots_trigger_cid_ring && !pots_trigger_cid &&
+	       (pots_cid_state == CID_IDLE) && (pots_tone_state == TONE_IDLE) &&
+	       (tone_cache_render_set >= INT_NUM_TONE_SETS);
+	
+	if (!idle) {
+		pots_ulp_idle_count = 0;
+		return false;
+	}
+	
+	return (++pots_ulp_idle_count >= (POTS_ULP_IDLE_MSEC / POTS_EVAL_MSEC));
+}
+
+
+static void _potsUlpWatchStart()
+{
+	esp_err_t ret;
+	
+	pots_ulp_idle_count = 0;
+	
+	// The ULP starts from on-hook with an empty log
+	ulp_run_count = 0;
+	ulp_hook_level = 0;
+	ulp_stable_runs = 0;
+	ulp_edge_count = 0;
+	
+	// Route PIN_SHK to the RTC IO mux for the ULP (the hook ISR can't see it there)
+	gpio_intr_disable(PIN_SHK);
+	rtc_gpio_init(PIN_SHK);
+	rtc_gpio_set_direction(PIN_SHK, RTC_GPIO_MODE_INPUT_ONLY);
+	
+	REG_WRITE(RTC_CNTL_INT_CLR_REG, RTC_CNTL_ULP_CP_INT_CLR_M);
+	REG_SET_BIT(RTC_CNTL_INT_ENA_REG, RTC_CNTL_ULP_CP_INT_ENA_M);
+	ulp_set_wakeup_period(0, POTS_ULP_PERIOD_USEC);
+	ret = ulp_run(&ulp_entry - RTC_SLOW_MEM);
+	if (ret != ESP_OK) {
+		ESP_LOGE(TAG, "ULP hook watch start failed - %d", ret);
+		REG_CLR_BIT(RTC_CNTL_INT_ENA_REG, RTC_CNTL_ULP_CP_INT_ENA_M);
+		rtc_gpio_deinit(PIN_SHK);
+		gpio_intr_enable(PIN_SHK);
+		pots_ulp_ready = false;
+		return;
+	}
+	
+	// The evaluations (and so the pace check ins) stop until the watch ends
+	pace_pause(PACE_ID_POTS);
+	pots_ulp_watching = true;
+}
+
+
+static void _potsUlpWatchEnd()
+{
+	bool off_hook = false;
+	int i, n;
+	int64_t now;
+	uint32_t run_now;
+	uint32_t runs_ago;
+	
+	// Stop the ULP (a run in progress finishes on its own)
+	CLEAR_PERI_REG_MASK(RTC_CNTL_STATE0_REG, RTC_CNTL_ULP_CP_SLP_TIMER_EN);
+	REG_CLR_BIT(RTC_CNTL_INT_ENA_REG, RTC_CNTL_ULP_CP_INT_ENA_M);
+	REG_WRITE(RTC_CNTL_INT_CLR_REG, RTC_CNTL_ULP_CP_INT_CLR_M);
+	
+	// Replay the logged edges with the times they were seen, the log only holds the edges
+	// since the switch was last stable on-hook so the 16-bit run counts can't wrap
+	now = _potsGetUsec();
+	run_now = ulp_run_count & 0xFFFF;
+	n = ulp_edge_count & 0xFFFF;
+	if (n > POTS_ULP_LOG_LEN) n = POTS_ULP_LOG_LEN;
+	for (i=0; i<n; i++) {
+		runs_ago = (run_now - ((&ulp_edge_run)[i] & 0xFFFF)) & 0xFFFF;
+		off_hook = (((&ulp_edge_level)[i] & 0xFFFF) != 0);
+		_potsHookEdgePush(now - ((int64_t) runs_ago * POTS_ULP_PERIOD_USEC), off_hook);
+	}
+	if (n != 0) {
+		DLOGI(TAG, "ULP woke with %d hook edges", n);
+	}
+	
+	// Hand PIN_SHK back to the hook ISR and add an edge if it changed after the log (an
+	// edge the ISR also sees is only a repeat of the level)
+	rtc_gpio_deinit(PIN_SHK);
+	portENTER_CRITICAL(&pots_ulp_mux);
+	gpio_intr_enable(PIN_SHK);
+	if ((gpio_get_level(PIN_SHK) == 1) != off_hook) {
+		_potsHookEdgePush(_potsGetUsec(), !off_hook);
+	}
+	portEXIT_CRITICAL(&pots_ulp_mux);
+	
+	pots_ulp_watching = false;
+}
+
+
+static void _potsUlpIsr(void* arg)
+{
+	BaseType_t higher_priority_task_woken = pdFALSE;
+	
+	xTaskNotifyFromISR(task_handle_pots, POTS_NOTIFY_ULP_WAKE_MASK, eSetBits, &higher_priority_task_woken);
+	if (higher_priority_task_woken == pdTRUE) {
+		portYIELD_FROM_ISR();
+	}
+}
+#endif /* CONFIG_POTS_ULP_HOOK_WATCH */
+
+
+// Runs the hook and dialing state machines at time t, with hookChange set if pots_cur_off_hook
+// changed at t - returns true if a digit was dialed
+static bool _potsEvalHookAt(bool hookChange, int64_t t)
+{
+	bool digit_dialed = false;
+	
+	// Let any timeouts that expired before the transition take effect first
+	if (hookChange) {
+		digit_dialed = _potsEvalHookAt(false, t);
+	}
+	
+	_potsEvalPhoneState(hookChange, t);
+	
+	if (_potsEvalDialer(hookChange, t)) {
+		digit_dialed = true;
+		_potsSendDialedDigit(pots_dial_cur_digit);
+#ifdef POTS_STATE_DEBUG
+		DLOGI(TAG, "Dial %c", pots_dial_cur_digit);
+#endif
+	}
+	
+	return digit_dialed;
+}
+
+
+// Runs the hook state machine (see pots_hook_trans) at time t
+static void _potsEvalPhoneState(bool hookChange, int64_t t)
+{
+	uint16_t evt = HSM_EVT_NONE;
+	
+	pots_saw_hook_state_change = false;
+	if (hookChange) {
+		evt = pots_cur_off_hook ? POTS_HSM_EVT_OFF_HOOK : POTS_HSM_EVT_ON_HOOK;
+	}
+	(void) hsm_dispatch_at(&pots_hook_hsm, evt, t);
+	
+	if (pots_saw_hook_state_change) {
+		if (pots_state == ON_HOOK) {
+			evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_POTS_ON_HOOK);
+		} else {
+			evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_POTS_OFF_HOOK);
+		}
+#ifdef POTS_STATE_DEBUG
+		DLOGI(TAG, "   Hook State Change");
+#endif
+	}
+}
 
 
-// This state machine determines when we're on hook (otherwise we're either off hook
-// or on hook only temporarily as the rotary dial switches)
-static void _potsEvalPhoneState(bool hookChange)
+// Back off-hook after a break too long for a rotary pulse
+static bool _potsIsFlash()
 {
+	return (hsm_time_in_state(&pots_hook_hsm) >= (rot_dial_get_break_usec() + POTS_FLASH_MARGIN_MSEC * 1000));
+}
+
+
+static void _potsHookFlash()
+{
+	evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_POTS_HOOK_FLASH);
 #ifdef POTS_STATE_DEBUG
-	static pots_stateT prev_pots_state = ON_HOOK;
+	DLOGI(TAG, "Hook flash %d mSec", (int) (hsm_time_in_state(&pots_hook_hsm) / 1000));
 #endif
-	pots_saw_hook_state_change = false;
-	
-	switch (pots_state) {
-		case ON_HOOK:
-			if (hookChange && pots_cur_off_hook) {
-				pots_state = OFF_HOOK;
-				pots_saw_hook_state_change = true;
-			}
-			break;
-		  
-		case OFF_HOOK:
-			if (hookChange && !pots_cur_off_hook) {
-				// Back on-hook - it could be permanent or the start of a rotary dial
-				pots_state = ON_HOOK_PROVISIONAL;
-				pots_state_count = 0; // Initialize end-of-call (back on-hook) timer
-			}
-			break;
-		  
-		case ON_HOOK_PROVISIONAL:
-			// Increment timer so we can decide where to go on next action
-			++pots_state_count;
-		
-			if (hookChange && pots_cur_off_hook) {
-				pots_state = OFF_HOOK;
-			} else {
-				if (pots_state_count >= (POTS_ON_HOOK_DETECT_MSEC / POTS_EVAL_MSEC)) {
-					// Call has ended
-					pots_state = ON_HOOK;
-					pots_saw_hook_state_change = true;
-				}
-			}
-			break;
-	}
-    
-    if (pots_saw_hook_state_change) {
-    	if (pots_state == ON_HOOK) {
-    		xTaskNotify(task_handle_app, APP_NOTIFY_POTS_ON_HOOK_MASK, eSetBits);
-    	} else {
-    		xTaskNotify(task_handle_app, APP_NOTIFY_POTS_OFF_HOOK_MASK, eSetBits);
-    	}
-    }
-#ifdef POTS_STATE_DEBUG
-	STATE_CHANGE_PRINT(prev_pots_state, pots_state, pots_state_name);
-	prev_pots_state = pots_state;
-	if (pots_saw_hook_state_change) {
-		ESP_LOGI(TAG, "   Hook State Change");
+}
+
+
+// Call has ended
+static void _potsOnHookEntry(int from)
+{
+	pots_saw_hook_state_change = true;
+}
+
+
+static void _potsOffHookEntry(int from)
+{
+	if (from == ON_HOOK) {
+		pots_saw_hook_state_change = true;
+		if (pots_incoming_count > 0) {
+			// Answering: wait for the call audio and time how long it takes
+			pots_answer_wait_count = POTS_ANSWER_WAIT_MSEC / POTS_EVAL_MSEC;
+			audioMarkOffHook();
+		}
 	}
-#endif
+}
+
+
+static void _potsHookStateChange(int from, int to)
+{
+	pots_state = (pots_stateT) to;
 }
 
 
@@ -600,6 +1754,11 @@ static void _potsEvalRinger()
 	static pots_dial_stateT prev_pots_ring_state = RING_IDLE;
 #endif
 
+	// End an incoming call we haven't seen a ring indication for in a while
+	if ((pots_incoming_count > 0) && (--pots_incoming_count == 0)) {
+		_potsEndIncoming();
+	}
+	
 	if (pots_state == OFF_HOOK) {		
 		// End ringing if necessary
 		if (pots_ring_state != RING_IDLE) {
@@ -628,6 +1787,18 @@ static void _potsEvalRinger()
 			break;
 		
 		case RING_PULSE_ON:
+#ifdef ENABLE_HW_RINGER
+			// The LEDC generates the pulses so just time the ring
+			if (--pots_ring_period_count <= 0) {
+				_potsRingerEnable(false);
+				_potsEndRingOn();
+			}
+			break;
+		
+		case RING_PULSE_OFF:
+			// Unused with the LEDC
+			break;
+#else
 			// Decrement ring-on timer
 			pots_ring_period_count--;
 			if (--pots_ring_pulse_count <= 0) {
@@ -645,16 +1816,7 @@ static void _potsEvalRinger()
 			// Either timer expiring ends this half of the pulse
 			if ((pots_ring_period_count <= 0) || (pots_ring_pulse_count <= 0)) {
 				if (pots_ring_period_count <= 0) {
-					// End of ring - check if there are more rings in this sequence
-					if (++pots_ring_step >= pots_num_ring_steps) {
-						_potsEndRing();
-					} else {
-						pots_ring_state = RING_STEP_WAIT;
-						pots_ring_period_count = country_code_infoP->ring_info.cadence_pairs[pots_ring_step] / POTS_EVAL_MSEC;
-						
-						// Switch off ring mode when not actually ringing
-						_potsLineRingMode(false);
-					}
+					_potsEndRingOn();
 				} else {
 					// Setup next ring pulse in this ring
 					pots_ring_state = RING_PULSE_ON;
@@ -663,6 +1825,7 @@ static void _potsEvalRinger()
 				}
 			}
 			break;
+#endif
 		
 		case RING_STEP_WAIT:
 			if (--pots_ring_period_count <= 0) {
@@ -673,11 +1836,15 @@ static void _potsEvalRinger()
 				} else {
 					// Next ring in sequence
 					pots_ring_state = RING_PULSE_ON;
-					pots_ring_period_count = country_code_infoP->ring_info.cadence_pairs[pots_ring_step] / POTS_EVAL_MSEC;
-					pots_ring_pulse_count = _potsGetRingPulseCount(true);
+					pots_ring_period_count = pots_ring_cadenceP[pots_ring_step] / POTS_EVAL_MSEC;
 					
 					// Switch ring mode back on
 					_potsLineRingMode(true);
+#ifdef ENABLE_HW_RINGER
+					_potsRingerEnable(true);
+#else
+					pots_ring_pulse_count = _potsGetRingPulseCount(true);
+#endif
 				}
 			}
 			break;
@@ -697,17 +1864,45 @@ static void _potsStartRing(bool is_rp_as)
 		pots_num_ring_steps = 1;
 		pots_ring_period_count = country_code_infoP->cid.rp_as_msec / POTS_EVAL_MSEC;
 	} else {
-		// Normal ring
-		pots_num_ring_steps = country_code_infoP->ring_info.num_cadence_pairs * 2;
-		pots_ring_period_count = country_code_infoP->ring_info.cadence_pairs[0] / POTS_EVAL_MSEC;
+		// Normal or distinctive ring
+		_potsSetRingCadence();
+		pots_ring_period_count = pots_ring_cadenceP[0] / POTS_EVAL_MSEC;
 	}
 	
-	pots_ring_pulse_count = _potsGetRingPulseCount(true);
 	pots_ring_step = 0;
 	pots_ring_state = RING_PULSE_ON;
 	pots_ring_num += 1;
 	_potsLineRingMode(true);   // Cause the line to enter ring mode
+#ifdef ENABLE_HW_RINGER
+	_potsRingerEnable(true);   // Start the ring frequency
+#else
+	pots_ring_pulse_count = _potsGetRingPulseCount(true);
 	_potsLineReverse(true);    // Toggle the line (reverse) to start this pulse of the ring
+#endif
+}
+
+
+// Use the caller's distinctive ring if the phonebook gives them one, otherwise the country's
+// ring.  The caller's number usually arrives with (or just after) the phone's first ring
+// indication so this is looked up again at the start of every ring.
+static void _potsSetRingCadence()
+{
+#if (CONFIG_CONTACTS_VCARD_ENABLE == true)
+	char cid_buf[33];
+	const dist_ring_info_t* drP = NULL;
+	
+	if (app_get_cid_number(cid_buf) != 0) {
+		drP = int_get_dist_ring_info(contacts_lookup_ring(cid_buf));
+	}
+	if (drP != NULL) {
+		pots_num_ring_steps = drP->num_cadence_pairs * 2;
+		pots_ring_cadenceP = drP->cadence_pairs;
+		return;
+	}
+#endif
+	
+	pots_num_ring_steps = country_code_infoP->ring_info.num_cadence_pairs * 2;
+	pots_ring_cadenceP = country_code_infoP->ring_info.cadence_pairs;
 }
 
 
@@ -724,12 +1919,39 @@ static void _potsEndRing()
 	    
 		pots_trigger_cid = true;
 #ifdef POTS_CID_DEBUG
-		ESP_LOGI(TAG, "Post-ring CID trigger");
+		DLOGI(TAG, "Post-ring CID trigger");
 #endif
 	}
 }
 
 
+// End of the ON portion of a ring - check if there are more rings in this sequence
+static void _potsEndRingOn()
+{
+	if (++pots_ring_step >= pots_num_ring_steps) {
+		_potsEndRing();
+	} else {
+		pots_ring_state = RING_STEP_WAIT;
+		pots_ring_period_count = pots_ring_cadenceP[pots_ring_step] / POTS_EVAL_MSEC;
+		
+		// Switch off ring mode when not actually ringing
+		_potsLineRingMode(false);
+	}
+}
+
+
+// An incoming call is over without being answered here so take audio out of standby
+static void _potsEndIncoming()
+{
+	pots_incoming_count = 0;
+	pots_answer_wait_count = 0;
+	if (pots_tone_state == TONE_IDLE) {
+		xTaskNotify(task_handle_audio, AUDIO_NOTIFY_DISABLE_MASK, eSetBits);
+	}
+}
+
+
+#ifndef ENABLE_HW_RINGER
 static int _potsGetRingPulseCount(bool on_portion)
 {
 	int ring_pulse_period_msec;
@@ -750,160 +1972,269 @@ static int _potsGetRingPulseCount(bool on_portion)
 		return (ring_pulse_period_msec / POTS_EVAL_MSEC);
 	}
 }
+#endif
 
 
+// Starts the Caller ID sequence (see pots_cid_trans) when triggered and steps it
 static void _potsEvalCID()
 {
-#ifdef POTS_CID_DEBUG
-	static pots_cid_stateT prev_pots_cid_state = CID_IDLE;
-#endif
-	// Stop caller ID if the phone goes off hook
+	uint16_t evt = HSM_EVT_NONE;
+	
 	if (pots_state != ON_HOOK) {
-		// Clean any pending caller ID
+		// Clean any pending caller ID (the state machine ends one in progress)
+		pots_trigger_cid = false;
+	} else if ((pots_cid_state == CID_IDLE) && pots_trigger_cid) {
 		pots_trigger_cid = false;
 		
-		// End CID if in progress
-		if (pots_cid_state != CID_IDLE) {
-			// Reset our state
-			pots_cid_state = CID_IDLE;		
-			_potsLineReverse(false);
+		// Use the audio rendered when the number arrived or setup the spandsp library caller
+		// ID audio generator now
+		if (!cid_audio_ready) {
+			cid_audio_ready = _potsSetupCID(false);
 		}
-	}
-
-	switch (pots_cid_state) {
-		case CID_IDLE:
-			if ((pots_state == ON_HOOK) && pots_trigger_cid) {
-				pots_trigger_cid = false;
-				
-				// Setup the spandsp library caller ID audio generator 
-				if (_potsSetupCID()) {					
-					// Determine how to start caller ID based on country information
-					if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING)) {
-						// Before first ring
-						if (country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_LR) {
-							// Reverse Line
-							_potsLineReverse(true);
-							
-							// Setup timer for wait before CID audio
-							pots_cid_wait_count = country_code_infoP->cid.pre_msec / POTS_EVAL_MSEC;
-							pots_cid_state = CID_PRE_MSG_WAIT;
-						} else if (country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_RP_AS) {
-							// Start short ring
-							pots_trigger_cid_ring = true;
-							pots_cid_state = CID_RP_AS;
-						} else {
-							// Start CID audio
-							_potsSetToneState(TONE_CID);
-							pots_cid_state = CID_MSG;
-						}
-					} else {
-						// Just start CID audio when after first ring
-						_potsSetToneState(TONE_CID);
-						pots_cid_state = CID_MSG;
-					}
+		if (cid_audio_ready) {
+			// Determine how to start caller ID based on country information
+			if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING)) {
+				// Before first ring: reverse line, start a short ring or just start CID audio
+				if (country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_LR) {
+					evt = POTS_HSM_EVT_CID_LR;
+				} else if (country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_RP_AS) {
+					evt = POTS_HSM_EVT_CID_RP_AS;
 				} else {
-					// No message to send (e.g. blocked number and the selected standard
-					// has no way to indicate that).  Trigger subsequent ring if necessary
-					if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING)) {
-						pots_trigger_pots_ring = true;
-					}
+					evt = POTS_HSM_EVT_CID_MSG;
 				}
+			} else {
+				// Just start CID audio when after first ring
+				evt = POTS_HSM_EVT_CID_MSG;
 			}
-			break;
-			
-		case CID_RP_AS: // Generating RP-AS (ring) alert
-			// Wait for ring to complete
-			if (pots_ring_state == RING_IDLE) {
-				// Setup delay before CID audio
-				pots_cid_wait_count = country_code_infoP->cid.pre_msec / POTS_EVAL_MSEC;
-				pots_cid_state = CID_PRE_MSG_WAIT;
-			}
-			break;
-			
-		case CID_PRE_MSG_WAIT:  // Waiting to start CID audio
-			if (--pots_cid_wait_count <= 0) {
-				// Start CID audio
-				_potsSetToneState(TONE_CID);
-				pots_cid_state = CID_MSG;
-			}
-			break;
-			
-		case CID_MSG:  // Generating Caller ID message audio
-			// Wait for message to complete
-			if (pots_tone_state != TONE_CID) {
-				// Setup the post CID timeout
-				pots_cid_wait_count = country_code_infoP->cid.post_msec / POTS_EVAL_MSEC;
-				pots_cid_state = CID_POST_MSG_WAIT;
-			}
-			break;
-			
-		case CID_POST_MSG_WAIT:  // Waiting after Caller ID before allowing or enabling ring
-			// Can't start any subsequent ring until out of this state
-			if (--pots_cid_wait_count <= 0) {
-				if (country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_LR) {
-					// Set normal line polarity (for the case we reversed it)
-					_potsLineReverse(false);
-				}
-				
-				if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING)) {
-					// Start the first ring if CID was sent before first ring
-					pots_trigger_pots_ring = true;
-				}
-				
-				pots_cid_state = CID_IDLE;
+		} else {
+			// No message to send (e.g. blocked number and the selected standard
+			// has no way to indicate that).  Trigger subsequent ring if necessary
+			if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING)) {
+				pots_trigger_pots_ring = true;
 			}
-			break;
+		}
 	}
+	
+	(void) hsm_dispatch(&pots_cid_hsm, evt);
+}
 
-#ifdef POTS_CID_DEBUG
-	STATE_CHANGE_PRINT(prev_pots_cid_state, pots_cid_state, pots_cid_state_name);
-	prev_pots_cid_state = pots_cid_state;
+
+// Ends the CID delay states as soon as cid_timer fires so the line reversal/alert to message and
+// message to ring spacing doesn't depend on when pots_task evaluation runs
+static void _potsEvalCIDTimer()
+{
+#if (CONFIG_CID_CALL_WAITING == true)
+	// The timer is shared with Type II Caller ID (which only runs off-hook)
+	if (pots_cw_cid_state != CW_CID_IDLE) {
+		_potsEvalCWCIDTimer();
+		return;
+	}
 #endif
+	
+	// Ignored if the timer is from a CID sequence that has been cancelled
+	(void) hsm_dispatch(&pots_cid_hsm, POTS_HSM_EVT_CID_TIMER);
+}
+
+
+// Stop caller ID if the phone goes off hook
+static bool _potsCidOffHook()
+{
+	return (pots_state != ON_HOOK);
+}
+
+
+static bool _potsCidRingDone()
+{
+	return (pots_ring_state == RING_IDLE);
+}
+
+
+static bool _potsCidMsgDone()
+{
+	return (pots_tone_state != TONE_CID);
+}
+
+
+static void _potsCidAbort()
+{
+	audioPutToneTxBuffer(NULL, 0);
+	cid_audio_ready = false;
+	_potsLineReverse(false);
+}
+
+
+static void _potsCidLineReverse()
+{
+	_potsLineReverse(true);
+}
+
+
+static void _potsCidDone()
+{
+	if (country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_LR) {
+		// Set normal line polarity (for the case we reversed it)
+		_potsLineReverse(false);
+	}
+	
+	if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_BEFORE_RING)) {
+		// Start the first ring if CID was sent before first ring
+		pots_trigger_pots_ring = true;
+	}
+}
+
+
+static void _potsCidRpAsEntry(int from)
+{
+	// Start short ring
+	pots_trigger_cid_ring = true;
+}
+
+
+static void _potsCidPreMsgEntry(int from)
+{
+	// Setup timer for wait before CID audio
+	_potsStartCIDTimer(country_code_infoP->cid.pre_msec);
+}
+
+
+static void _potsCidMsgEntry(int from)
+{
+	// Start CID audio (right away when the timer ends the wait before it)
+	_potsSetToneState(TONE_CID);
+	if (from == CID_PRE_MSG_WAIT) {
+		(void) _potsEvalToneGen();
+	}
+}
+
+
+static void _potsCidPostMsgEntry(int from)
+{
+	// Setup the post CID timeout from when the audio still queued in audio_task will
+	// have played
+	_potsStartCIDTimer(country_code_infoP->cid.post_msec + (audioGetTxCount() * 1000 / 8000));
+	cid_audio_ready = false;
+}
+
+
+static void _potsCidActiveExit(int to)
+{
+	(void) esp_timer_stop(cid_timer);
+}
+
+
+static void _potsCidStateChange(int from, int to)
+{
+	pots_cid_state = (pots_cid_stateT) to;
+}
+
+
+static void _potsCIDTimerCallback(void* arg)
+{
+	xTaskNotify(task_handle_pots, POTS_NOTIFY_CID_TIMER_MASK, eSetBits);
+}
+
+
+static void _potsStartCIDTimer(int msec)
+{
+	(void) esp_timer_stop(cid_timer);
+	if (esp_timer_start_once(cid_timer, (uint64_t) msec * 1000) != ESP_OK) {
+		// Don't stall the CID sequence
+		_potsCIDTimerCallback(NULL);
+	}
 }
 
 
-static bool _potsSetupCID()
+static void _potsInitCID()
+{
+	const esp_timer_create_args_t timer_args = {
+		.callback = &_potsCIDTimerCallback,
+		.name = "cid"
+	};
+	
+	cid_tx_stateP = adsi_tx_init(NULL, _potsCIDstandard(country_code_infoP->cid.cid_spec));
+	
+	cid_audio_buf = (int16_t*) heap_caps_malloc(POTS_CID_BUF_LEN * sizeof(int16_t), MALLOC_CAP_SPIRAM);
+	if (cid_audio_buf == NULL) {
+		ESP_LOGE(TAG, "malloc cid_audio_buf failed");
+	}
+	cid_audio_len = 0;
+	cid_audio_queued = false;
+	
+	if (esp_timer_create(&timer_args, &cid_timer) != ESP_OK) {
+		ESP_LOGE(TAG, "Create CID timer failed");
+	}
+}
+
+
+// Render the Caller ID audio for the incoming call or, if call_waiting is set, the Type II
+// message for the waiting call
+static bool _potsSetupCID(bool call_waiting)
 {
 	bool valid_cid = true;
 	char cid_buf[33];
 	char time_buf[9];
+	char name_buf[CONTACTS_NAME_LEN+1];
 	int cid_buf_len;
-	int len = -1;
+	int name_len = 0;
 	tmElements_t tm;
 	
-	// Setup the state based on current locale
-	(void) adsi_tx_init(cid_tx_stateP, _potsLocaleToCIDstandard());
+	// Get message strings
+	cid_buf_len = call_waiting ? app_get_cw_number(cid_buf) : app_get_cid_number(cid_buf);
+	if (cid_buf_len == 0) {
+		sprintf(cid_buf, UNKNOWN_CID_STRING);
+		valid_cid = false;
+	}
+	time_get(&tm);
+	time_get_cid_string(tm, time_buf);
+#if (CONFIG_CONTACTS_VCARD_ENABLE == true)
+	if (valid_cid && contacts_lookup(cid_buf, name_buf)) {
+		name_len = strlen(name_buf);
+	}
+#endif
+	ESP_LOGI(TAG, "CID Time: %s  Message: %s  Name: %s", time_buf, cid_buf, (name_len != 0) ? name_buf : "-");
+	
+	return _potsRenderCID(country_code_infoP->cid.cid_spec, valid_cid ? cid_buf : NULL,
+	                      (name_len != 0) ? name_buf : NULL, time_buf, call_waiting);
+}
+
+
+// Render the complete CID audio for cid_spec into cid_audio_buf.  number is NULL when the
+// caller's number isn't available and name is NULL when there is no name to send.  off_hook
+// renders a Type II message (no alert tone or channel seizure and the 80 bit mark preamble).
+static bool _potsRenderCID(int cid_spec, const char* number, const char* name, const char* time_buf, bool off_hook)
+{
+	bool valid_cid = (number != NULL);
+	const char* cid_buf = number;
+	const char* name_buf = name;
+	int cid_buf_len = valid_cid ? strlen(number) : 0;
+	int name_len = (name != NULL) ? strlen(name) : 0;
+	int len = -1;
+	
+	// Setup the state based on the CID type
+	(void) adsi_tx_init(cid_tx_stateP, _potsCIDstandard(cid_spec));
 	
 	// Configure DT-AS if necessary
-	if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_DT_AS)) {
+	if ((cid_spec & INT_CID_FLAG_EN_DT_AS) && !off_hook) {
 		adsi_tx_send_alert_tone(cid_tx_stateP);
 	}
 	
 	// Change the caller ID message pre-amble if necessary
 	
-	if ((country_code_infoP->cid.cid_spec & INT_CID_TYPE_MASK) == INT_CID_TYPE_BELLCORE_FSK) {
+	if (off_hook) {
+		// The CAS and ACK replace the channel seizure
+		adsi_tx_set_preamble(cid_tx_stateP, 0, 80, -1, -1);
+	} else if ((cid_spec & INT_CID_TYPE_MASK) == INT_CID_TYPE_BELLCORE_FSK) {
 		// BellCore spec wants 156 or 180 Mark bits (depending on what document you read)
 		// after preamble but adsi.c does 80 by default so we reset that here
 		adsi_tx_set_preamble(cid_tx_stateP, -1, 156, -1, -1);
-	} else if ((country_code_infoP->cid.cid_spec & INT_CID_FLAG_EN_SHORT_PRE) == 0) {
+	} else if ((cid_spec & INT_CID_FLAG_EN_SHORT_PRE) == 0) {
 		// ETSI EN 300 659-1 specifies normal pre-amble to be 180 Mark bits so once again
 		// we override the adsi.c default 80 (short pre-amble)
 		adsi_tx_set_preamble(cid_tx_stateP, -1, 180, -1, -1);
 	}
 	
-	// Get message strings
-	cid_buf_len = app_get_cid_number(cid_buf);
-	if (cid_buf_len == 0) {
-		sprintf(cid_buf, UNKNOWN_CID_STRING);
-		cid_buf_len = strlen(cid_buf);
-		valid_cid = false;
-	}
-	time_get(&tm);
-	time_get_cid_string(tm, time_buf);
-	ESP_LOGI(TAG, "CID Time: %s  Message: %s", time_buf, cid_buf);
-	
 	// Set the message
-	switch (country_code_infoP->cid.cid_spec & INT_CID_TYPE_MASK) {
+	switch (cid_spec & INT_CID_TYPE_MASK) {
 		case INT_CID_TYPE_ETSI_FSK:
 		case INT_CID_TYPE_SIN227:
 			// ETSI and SIN227 FSK MDMF format
@@ -912,6 +2243,9 @@ static bool _potsSetupCID()
             len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, CLIP_DATETIME, (uint8_t *) time_buf, 8);
             if (valid_cid) {
             	len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, CLIP_CALLER_NUMBER, (uint8_t *) cid_buf, cid_buf_len);
+            	if (name_len != 0) {
+            		len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, CLIP_CALLER_NAME, (uint8_t *) name_buf, name_len);
+            	}
             } else {
             	len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, CLIP_ABSENCE1, (uint8_t *) "O", 1);
             }
@@ -975,13 +2309,22 @@ static bool _potsSetupCID()
 			len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, ACLIP_DATETIME, (uint8_t *) time_buf, 8);
 			if (valid_cid) {
 				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, ACLIP_CALLER_NUMBER, (uint8_t *) cid_buf, cid_buf_len);
+				if (name_len != 0) {
+					len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, ACLIP_CALLER_NAME, (uint8_t *) name_buf, name_len);
+				}
 			} else {
 				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, ACLIP_NUMBER_ABSENCE, (uint8_t *) "O", 1);
 			}
 			break;
 		
 		default:
-			if (valid_cid) {
+			if (valid_cid && (name_len != 0)) {
+				// BellCore FSK MDMF Format to include the name from the phonebook
+				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, CLASS_MDMF_CALLERID, NULL, 0);
+				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, MCLASS_DATETIME, (uint8_t *) time_buf, 8);
+				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, MCLASS_CALLER_NUMBER, (uint8_t *) cid_buf, cid_buf_len);
+				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, MCLASS_CALLER_NAME, (uint8_t *) name_buf, name_len);
+			} else if (valid_cid) {
 				// BellCore FSK SDMF Format when we have the number
 				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, CLASS_SDMF_CALLERID, NULL, 0);
 				len = adsi_add_field(cid_tx_stateP, adsi_msg_buf, len, 0, (uint8_t *) time_buf, 8);
@@ -998,6 +2341,20 @@ static bool _potsSetupCID()
 		// Load the message
 		len = adsi_tx_put_message(cid_tx_stateP, adsi_msg_buf, len);
 		
+		// Render all the audio now so audio_task can play it directly from cid_audio_buf
+		cid_audio_len = 0;
+		cid_audio_queued = false;
+		if (cid_audio_buf != NULL) {
+			while (cid_audio_len < POTS_CID_BUF_LEN) {
+				len = POTS_CID_BUF_LEN - cid_audio_len;
+				if (len > POTS_TONE_BUF_LEN) len = POTS_TONE_BUF_LEN;
+				len = adsi_tx(cid_tx_stateP, &cid_audio_buf[cid_audio_len], len);
+				if (len == 0) break;
+				cid_audio_len += len;
+			}
+		}
+		DLOGI(TAG, "CID audio %d samples", cid_audio_len);
+		
 		return true;
 	} else {
 		// No message to send
@@ -1006,9 +2363,9 @@ static bool _potsSetupCID()
 }
 
 
-static int _potsLocaleToCIDstandard()
+static int _potsCIDstandard(int cid_spec)
 {
-	switch (country_code_infoP->cid.cid_spec & INT_CID_TYPE_MASK) {
+	switch (cid_spec & INT_CID_TYPE_MASK) {
 		case INT_CID_TYPE_BELLCORE_FSK:
 			return ADSI_STANDARD_CLASS;
 			break;
@@ -1039,9 +2396,89 @@ static int _potsLocaleToCIDstandard()
 }
 
 
+#if (CONFIG_CID_SELF_TEST == true)
+// Render a test message for every CID type and decode it with adsi_rx, logging whether it
+// was received intact, where in the audio it was delivered and the cost of each side
+static void _potsCIDSelfTest()
+{
+	adsi_rx_state_t* rx_stateP;
+	int cid_type;
+	int i, n;
+	uint32_t t0;
+	uint32_t tx_cycles;
+	uint32_t rx_cycles;
+	
+	if (cid_audio_buf == NULL) return;
+	rx_stateP = adsi_rx_init(NULL, ADSI_STANDARD_CLASS, _potsCIDSelfTestCallback, NULL);
+	if (rx_stateP == NULL) {
+		ESP_LOGE(TAG, "CID self-test could not allocate receiver");
+		return;
+	}
+	
+	for (cid_type=INT_CID_TYPE_BELLCORE_FSK; cid_type<=INT_CID_TYPE_ACLIP; cid_type++) {
+		t0 = esp_cpu_get_ccount();
+		if (!_potsRenderCID(cid_type, POTS_CID_TEST_NUMBER, POTS_CID_TEST_NAME, POTS_CID_TEST_TIME, false)) {
+			ESP_LOGW(TAG, "CID self-test type %d: no message", cid_type);
+			continue;
+		}
+		tx_cycles = esp_cpu_get_ccount() - t0;
+		
+		(void) adsi_rx_init(rx_stateP, _potsCIDstandard(cid_type), _potsCIDSelfTestCallback, NULL);
+		cid_test_pos = 0;
+		cid_test_msg_pos = -1;
+		cid_test_match = false;
+		rx_cycles = 0;
+		for (i=0; i<cid_audio_len; i+=n) {
+			// Decode in the chunks audio_task would deliver
+			n = cid_audio_len - i;
+			if (n > POTS_TONE_BUF_LEN) n = POTS_TONE_BUF_LEN;
+			cid_test_pos = i + n;
+			t0 = esp_cpu_get_ccount();
+			(void) adsi_rx(rx_stateP, &cid_audio_buf[i], n);
+			rx_cycles += esp_cpu_get_ccount() - t0;
+		}
+		
+		if (cid_test_msg_pos < 0) {
+			ESP_LOGE(TAG, "CID self-test type %d (%s): FAIL - nothing decoded from %d mSec",
+			         cid_type, adsi_standard_to_str(_potsCIDstandard(cid_type)), cid_audio_len / 8);
+		} else {
+			ESP_LOGI(TAG, "CID self-test type %d (%s): %s - delivered at %d of %d mSec, tx %u rx %u cycles",
+			         cid_type, adsi_standard_to_str(_potsCIDstandard(cid_type)),
+			         cid_test_match ? "PASS" : "FAIL - number not found",
+			         cid_test_msg_pos / 8, cid_audio_len / 8, tx_cycles, rx_cycles);
+		}
+	}
+	
+	adsi_rx_free(rx_stateP);
+	
+	// Nothing rendered is for a real call
+	cid_audio_len = 0;
+}
+
+
+// Called from adsi_rx with a complete message (FSK sumcheck/CRC already verified)
+static void _potsCIDSelfTestCallback(void* user_data, const uint8_t* msg, int len)
+{
+	int i;
+	int n = strlen(POTS_CID_TEST_NUMBER);
+	
+	if (cid_test_msg_pos >= 0) return;
+	
+	// Position is the end of the chunk the message completed in
+	cid_test_msg_pos = cid_test_pos;
+	for (i=0; i<=(len - n); i++) {
+		if (memcmp(&msg[i], POTS_CID_TEST_NUMBER, n) == 0) {
+			cid_test_match = true;
+			break;
+		}
+	}
+}
+#endif
+
+
 // Assumes that we'll only have one source (DTMF or rotary) dialing at a time
 // Returns true when a digit was detected dialed
-static bool _potsEvalDialer(bool hookChange)
+static bool _potsEvalDialer(bool hookChange, int64_t t)
 {
 #ifdef POTS_DIAL_DEBUG
 	static pots_dial_stateT prev_pots_dial_state = DIAL_IDLE;
@@ -1054,7 +2491,13 @@ static bool _potsEvalDialer(bool hookChange)
 				if (hookChange && !pots_cur_off_hook) {
 					pots_dial_state = DIAL_BREAK;
 					pots_dial_pulse_count = 0;
-					pots_dial_period_count = 0;  // Start timer to detect rotary dial break
+					pots_dial_usec = t;  // Start timer to detect rotary dial break
+					rot_dial_start();
+					
+					// Keep the pulse clicks out of the call (the digit is sent as DTMF)
+					if (pots_tone_state == TONE_VOICE) {
+						_potsDialMuteMic(true);
+					}
 				} else if (pots_dial_last_dtmf_digit != ' ') {
 					digit_dialed_detected = true;
 					pots_dial_cur_digit = pots_dial_last_dtmf_digit;
@@ -1064,37 +2507,48 @@ static bool _potsEvalDialer(bool hookChange)
 			break;
 		  
 		case DIAL_BREAK:
-			// Increment timer
-			++pots_dial_period_count;
-			
-			if (pots_dial_period_count > (POTS_ROT_BREAK_MSEC / POTS_EVAL_MSEC)) {
+			if ((t - pots_dial_usec) > rot_dial_get_break_usec()) {
 				// Too long for a rotary dialer so this must be the switch hook going back on-hook
 				pots_dial_state = DIAL_IDLE;
+				_potsDialMuteMic(false);
 			} else if (hookChange && pots_cur_off_hook) {
-				// Valid rotary pulse
-				if (pots_dial_pulse_count < 10) ++pots_dial_pulse_count;
-				pots_dial_state = DIAL_MAKE;
-				pots_dial_period_count = 0;  // Start timer to detect rotary dial make action (either end of digit or inner-pulse)
+				if ((pots_tone_state == TONE_VOICE) && ((t - pots_dial_usec) < (POTS_ROT_BREAK_MIN_MSEC * 1000))) {
+					// Hook switch glitch in a call - ignore it (and don't measure the dial from this digit)
+					rot_dial_discard();
+					if (pots_dial_pulse_count == 0) {
+						pots_dial_state = DIAL_IDLE;
+						_potsDialMuteMic(false);
+					} else {
+						pots_dial_state = DIAL_MAKE;
+						pots_dial_usec = t;
+					}
+				} else {
+					// Valid rotary pulse
+					rot_dial_break((uint32_t) (t - pots_dial_usec));
+					if (pots_dial_pulse_count < 10) ++pots_dial_pulse_count;
+					pots_dial_state = DIAL_MAKE;
+					pots_dial_usec = t;  // Start timer to detect rotary dial make action (either end of digit or inner-pulse)
+				}
 			}
 			break;
 		  
 		case DIAL_MAKE:
-			// Increment timer
-			++pots_dial_period_count;
-			
-			if (pots_dial_period_count > (POTS_ROT_MAKE_MSEC / POTS_EVAL_MSEC)) {
+			if ((t - pots_dial_usec) > rot_dial_get_make_usec()) {
 				// End of one rotary dial - note we have a digit
 				digit_dialed_detected = true;
 				
 				// Convert the pulse count (1-10) to an internationalized digit value
 				if (pots_dial_pulse_count > 10) pots_dial_pulse_count = 10;  // Should never occur
+				rot_dial_digit(pots_dial_pulse_count);
 				pots_dial_cur_digit = '0' + country_code_infoP->rotary_map[pots_dial_pulse_count-1];
 				
 				pots_dial_state = DIAL_IDLE;
+				_potsDialMuteMic(false);
 			} else if (hookChange && !pots_cur_off_hook) {
 				// Start of next rotary pulse in this dial
+				rot_dial_make((uint32_t) (t - pots_dial_usec));
 				pots_dial_state = DIAL_BREAK;
-				pots_dial_period_count = 0;  // Start timer to detect rotary dial break
+				pots_dial_usec = t;  // Start timer to detect rotary dial break
 			}
 			break;
 	}
@@ -1107,8 +2561,59 @@ static bool _potsEvalDialer(bool hookChange)
 	return digit_dialed_detected;
 }
 
+
+// Mute the mic for the duration of a rotary digit dialed in a call
+static void _potsDialMuteMic(bool en)
+{
+	if (en != pots_dial_mic_muted) {
+		pots_dial_mic_muted = en;
+		xTaskNotify(task_handle_audio, en ? AUDIO_NOTIFY_MUTE_MIC_MASK : AUDIO_NOTIFY_UNMUTE_MIC_MASK, eSetBits);
+	}
+}
+
+
 static void _potsSetToneState(pots_tone_stateT ns)
 {
+	if ((pots_tone_state == TONE_VOICE) && (ns != TONE_VOICE)) {
+		// Any far end or call waiting tone was for the call we're leaving
+		pots_far_tone_req = false;
+		_potsStopFarTone();
+#if (CONFIG_CID_CALL_WAITING == true)
+		_potsEndCWCID();
+#endif
+		pots_cw_tone_req = false;
+		pots_cw_tone_on = false;
+		_potsDialMuteMic(false);
+	}
+	if ((pots_tone_state == TONE_RINGBACK) && (ns != TONE_RINGBACK)) {
+		_potsEndRingback();
+	}
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	if ((pots_tone_state == TONE_ANS_MACH) && (ns != TONE_ANS_MACH)) {
+		// Take the voice stream back from the answering machine
+		xTaskNotify(task_handle_audio, AUDIO_NOTIFY_ANS_MACH_END_MASK, eSetBits);
+	}
+	if ((pots_tone_state == TONE_MESSAGE) && (ns != TONE_MESSAGE)) {
+		ans_mach_stop();
+	}
+#endif
+#if (CONFIG_PROMPT_ENABLE == true)
+	if ((pots_tone_state != TONE_IDLE) && (ns == TONE_IDLE)) {
+		// Anything still being said was for the phone that just hung up
+		prompt_stop();
+	}
+#endif
+	if ((dtmf_gate_blocks != 0) && (ns != TONE_DIAL) && (ns != TONE_DIAL_QUIET) &&
+	    (ns != TONE_DTMF) && (ns != TONE_DTMF_FLUSH)) {
+		ESP_LOGI(TAG, "DTMF detector skipped %u%% of %u blocks", dtmf_gate_skipped * 100 / dtmf_gate_blocks, dtmf_gate_blocks);
+		dtmf_gate_blocks = 0;
+	}
+	if ((ns != pots_tone_state) && ((pots_tone_state == TONE_DIAL) || (pots_tone_state == TONE_NO_SERVICE) ||
+	    (pots_tone_state == TONE_OFF_HOOK) || (ns == TONE_CID))) {
+		// Cut a continuous tone off (or whatever is queued ahead of Caller ID) within a frame
+		// instead of letting the queued audio play out
+		audioFlushToneTx();
+	}
 	_potsSetAudioOutput(ns);
 	pots_tone_state = ns;
 }
@@ -1120,12 +2625,31 @@ static void _potsEvalToneState(bool potsDigitDialed, bool appDigitDialed)
 	static pots_tone_stateT prev_pots_tone_state = TONE_IDLE;
 #endif
 
+#if (CONFIG_ANS_MACH_ENABLE == true)
+	if (pots_msg_play_req && (pots_tone_state != TONE_DIAL) && (pots_tone_state != TONE_DIAL_QUIET) &&
+	    (pots_tone_state != TONE_MESSAGE)) {
+		// The handset isn't waiting to dial so the message can't be played
+		pots_msg_play_req = false;
+		ans_mach_stop();
+	}
+#endif
+
 	switch (pots_tone_state) {
 		case TONE_IDLE:  // No audio
+#if (CONFIG_ANS_MACH_ENABLE == true)
+			if ((pots_state == ON_HOOK) && pots_am_req && pots_has_call_audio) {
+				// Answering machine took the call
+				_potsSetToneState(TONE_ANS_MACH);
+				break;
+			}
+#endif
 			if (pots_state == OFF_HOOK) {
 				if (pots_has_call_audio) {
 					// Answering call
 					_potsSetToneState(TONE_VOICE);
+				} else if (pots_answer_wait_count > 0) {
+					// Answering call: audio stays in standby until the call audio is connected
+					pots_answer_wait_count--;
 				} else if (pots_in_service) {
 					// Dialing: Give the user some dial tone
 					_potsSetToneState(TONE_DIAL);
@@ -1143,6 +2667,10 @@ static void _potsEvalToneState(bool potsDigitDialed, bool appDigitDialed)
 			} else if (pots_state == ON_HOOK) {
 				// User hung up so stop audio
 				_potsSetToneState(TONE_IDLE);
+			} else {
+				// Replace any far end busy, reorder or SIT tone with our own
+				_potsEvalFarTone();
+				_potsEvalCallWaitingTone();
 			}
 			break;
 		
@@ -1174,6 +2702,10 @@ static void _potsEvalToneState(bool potsDigitDialed, bool appDigitDialed)
 				// Not sure this is entirely correct but we'll switch over to voice if they
 				// get a call while preparing to dial
 				_potsSetToneState(TONE_VOICE);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+			} else if (pots_msg_play_req) {
+				_potsSetToneState(TONE_MESSAGE);
+#endif
 			} else if (_potsToneTimerExpired()) {
 				_potsSetToneState(TONE_OFF_HOOK);
 			} else {
@@ -1187,6 +2719,13 @@ static void _potsEvalToneState(bool potsDigitDialed, bool appDigitDialed)
 				_potsSetToneState(TONE_VOICE);
 			} else if (pots_state == ON_HOOK) {
 				_potsSetToneState(TONE_IDLE);
+			} else if (pots_ringback_req) {
+				// The number we dialed is ringing but the phone hasn't connected its audio
+				_potsSetToneState(TONE_RINGBACK);
+#if (CONFIG_ANS_MACH_ENABLE == true)
+			} else if (pots_msg_play_req) {
+				_potsSetToneState(TONE_MESSAGE);
+#endif
 			} else if ((pots_state == OFF_HOOK) && appDigitDialed) {
 				// Generate a DTMF tone for app generated digit
 				_potsSetToneState(TONE_DTMF);
@@ -1262,6 +2801,50 @@ static void _potsEvalToneState(bool potsDigitDialed, bool appDigitDialed)
 				_potsSetToneState(TONE_IDLE);
 			}
 			break;
+		
+		case TONE_RINGBACK: // Local ringback over the voice standby stream
+			if (pots_has_call_audio) {
+				// Connecting the standby stream doesn't restart I2S and the end of the
+				// ringback fades out over the start of the call audio
+				_potsSetToneState(TONE_VOICE);
+			} else if (pots_state == ON_HOOK) {
+				_potsSetToneState(TONE_IDLE);
+			} else if (!pots_ringback_req) {
+				// Call setup ended without audio (e.g. the call failed)
+				_potsSetToneState(TONE_DIAL_QUIET);
+			} else {
+				_potsEvalRingback();
+			}
+			break;
+		
+#if (CONFIG_ANS_MACH_ENABLE == true)
+		case TONE_ANS_MACH: // Answering machine has the call audio
+			if (pots_state == OFF_HOOK) {
+				// User picked up while the message was being left
+				_potsSetToneState(TONE_VOICE);
+			} else if (!pots_am_req || !pots_has_call_audio) {
+				_potsSetToneState(TONE_IDLE);
+			}
+			break;
+		
+		case TONE_MESSAGE: // Playing a message to the handset
+			if (pots_state == ON_HOOK) {
+				_potsSetToneState(TONE_IDLE);
+			} else if (pots_has_call_audio) {
+				_potsSetToneState(TONE_VOICE);
+			} else if (potsDigitDialed || !pots_msg_play_req || ans_mach_play_done()) {
+				// Dialing or the GUI stops the message
+				pots_msg_play_req = false;
+				_potsSetToneState(TONE_DIAL_QUIET);
+			} else {
+				_potsEvalMessage();
+			}
+			break;
+#else
+		case TONE_ANS_MACH:
+		case TONE_MESSAGE:
+			break;
+#endif
 	}
 	
 #ifdef POTS_STATE_DEBUG
@@ -1278,19 +2861,19 @@ static bool _potsEvalToneGen()
 	int cur_samples_in_tx;
 	int samples_in_buf = 0;
 	
+	if (pots_tone_state == TONE_CID) {
+		return _potsEvalCIDAudio();
+	}
+	if ((pots_tone_state == TONE_DTMF) && (dtmf_tx_cacheP != NULL)) {
+		return _potsEvalDtmfCache();
+	}
+	
 	// Samples already in the audio stream buffer
 	cur_samples_in_tx = audioGetTxCount();
 	
 	while ((cur_samples_in_tx <= POTS_TONE_BUF_LEN) && valid_data) {
 		// Get some audio
-		if (pots_tone_state == TONE_CID) {
-			// See if there is CID audio (CID audio is only generated for a period of time)
-			samples_in_buf = adsi_tx(cid_tx_stateP, tone_tx_buf, POTS_TONE_BUF_LEN);
-			if (samples_in_buf == 0) {
-				// No more CID audio to generate
-				valid_data = false;
-			}
-		} else if (pots_tone_state == TONE_DTMF) {
+		if (pots_tone_state == TONE_DTMF) {
 			// See if there is DTMF audio (a DTMF tone is only generated for a period of time)
 			samples_in_buf = dtmf_tx(&dtmf_tx_state, tone_tx_buf, POTS_TONE_BUF_LEN);
 			if (samples_in_buf == 0) {
@@ -1299,16 +2882,7 @@ static bool _potsEvalToneGen()
 			}
 		} else {
 			// Status tones never end (they are stopped when this routine isn't called)
-			if (tone_tx_use_sample) {
-				while (samples_in_buf < POTS_TONE_BUF_LEN) {
-					tone_tx_buf[samples_in_buf++] = sample_tone_tx_cur_buf[sample_tone_tx_index++];
-					if (sample_tone_tx_index >= sample_tone_tx_cur_len) {
-						sample_tone_tx_index = 0;
-					}
-				}
-			} else {
-				samples_in_buf = super_tone_tx(&tone_state, tone_tx_buf, POTS_TONE_BUF_LEN);
-			}
+			samples_in_buf = _potsGetStatusTone(tone_tx_buf, POTS_TONE_BUF_LEN);
 		}
 		
 		// send it to audio_task
@@ -1322,6 +2896,368 @@ static bool _potsEvalToneGen()
 }
 
 
+// Get len samples of the status tone set up by _potsSetupAudioTone
+static int _potsGetStatusTone(int16_t* buf, int len)
+{
+	int n = 0;
+	
+	if (tone_tx_use_sample) {
+		while (n < len) {
+			buf[n++] = sample_tone_tx_cur_buf[sample_tone_tx_index++];
+			if (sample_tone_tx_index >= sample_tone_tx_cur_len) {
+				sample_tone_tx_index = 0;
+			}
+		}
+	} else {
+		n = super_tone_tx(&tone_state, buf, len);
+	}
+	
+	return n;
+}
+
+
+// While app_task says the far end is playing a call progress tone, mute the voice audio and
+// mix in our country's reorder tone in its place so the user hears a familiar cadence
+static void _potsEvalFarTone()
+{
+	int cur_samples_in_tx;
+	int samples_in_buf;
+	
+	if (pots_far_tone_req && !pots_far_tone_on) {
+		_potsSetupAudioTone(INT_TONE_SET_RO_INDEX);
+		audioSetMixGain(AUDIO_MIX_MAIN, POTS_FAR_TONE_MUTE_DB);
+		pots_far_tone_on = true;
+	} else if (!pots_far_tone_req && pots_far_tone_on) {
+		_potsStopFarTone();
+	}
+	
+	if (pots_far_tone_on) {
+		cur_samples_in_tx = audioGetMixTxCount(AUDIO_MIX_TONE);
+		while (cur_samples_in_tx < POTS_FAR_TONE_MIX_LEN) {
+			samples_in_buf = _potsGetStatusTone(tone_tx_buf, POTS_TONE_BUF_LEN);
+			if (samples_in_buf == 0) break;
+			audioPutMixTx(AUDIO_MIX_TONE, tone_tx_buf, samples_in_buf);
+			cur_samples_in_tx += samples_in_buf;
+		}
+	}
+}
+
+
+// Restore the voice audio (what's left of the local tone in the mixer plays out)
+static void _potsStopFarTone()
+{
+	if (pots_far_tone_on) {
+		audioSetMixGain(AUDIO_MIX_MAIN, 0);
+		pots_far_tone_on = false;
+	}
+}
+
+
+// Keep the mixer topped off with ringback
+static void _potsEvalRingback()
+{
+	int cur_samples_in_tx;
+	int samples_in_buf;
+	
+	cur_samples_in_tx = audioGetMixTxCount(AUDIO_MIX_TONE);
+	while (cur_samples_in_tx < POTS_RINGBACK_MIX_LEN) {
+		samples_in_buf = _potsGetStatusTone(tone_tx_buf, POTS_TONE_BUF_LEN);
+		if (samples_in_buf == 0) break;
+		audioPutMixTx(AUDIO_MIX_TONE, tone_tx_buf, samples_in_buf);
+		cur_samples_in_tx += samples_in_buf;
+	}
+}
+
+
+#if (CONFIG_ANS_MACH_ENABLE == true)
+// Keep the mixer topped off with the message being played
+static void _potsEvalMessage()
+{
+	int cur_samples_in_tx;
+	int samples_in_buf;
+	
+	cur_samples_in_tx = audioGetMixTxCount(AUDIO_MIX_TONE);
+	while (cur_samples_in_tx < POTS_MSG_MIX_LEN) {
+		samples_in_buf = ans_mach_get_play(tone_tx_buf, POTS_TONE_BUF_LEN);
+		if (samples_in_buf == 0) break;
+		audioPutMixTx(AUDIO_MIX_TONE, tone_tx_buf, samples_in_buf);
+		cur_samples_in_tx += samples_in_buf;
+	}
+}
+#endif
+
+
+#if (CONFIG_PROMPT_ENABLE == true)
+// Play the battery low prompt when running from a battery that is nearly empty
+static void _potsPromptBattery()
+{
+	enum BATT_STATE_t batt_state;
+	enum CHARGE_STATE_t charge_state;
+	
+	gcore_get_power_state(&batt_state, &charge_state);
+	if (((batt_state == BATT_25) || (batt_state == BATT_0) || (batt_state == BATT_CRIT)) &&
+	    (charge_state == CHARGE_OFF)) {
+		(void) prompt_play(PROMPT_BATTERY_LOW);
+	}
+}
+#endif
+
+
+// Follow what's left of the ringback in the mixer with a faded out piece so it doesn't end
+// with a click
+static void _potsEndRingback()
+{
+	int i, n;
+	
+	n = _potsGetStatusTone(tone_tx_buf, POTS_TONE_BUF_LEN);
+	for (i=0; i<n; i++) {
+		tone_tx_buf[i] = (int16_t) (((int32_t) tone_tx_buf[i] * (n - i)) / n);
+	}
+	if (n != 0) {
+		audioPutMixTx(AUDIO_MIX_TONE, tone_tx_buf, n);
+	}
+}
+
+
+// While app_task says a second call is waiting, mix the call waiting tone over the voice audio
+// (the far end tone takes precedence since it shares the mixer source)
+static void _potsEvalCallWaitingTone()
+{
+	tone_gen_descriptor_t desc;
+	int cur_samples_in_tx;
+	int samples_in_buf;
+	
+	if (pots_cw_tone_req && !pots_cw_tone_on) {
+		tone_gen_descriptor_init(&desc, POTS_CW_FREQ, POTS_CW_LEVEL_DBM0, 0, 0,
+		                         POTS_CW_ON_MSEC, POTS_CW_PERIOD_MSEC - POTS_CW_ON_MSEC, 0, 0, true);
+		tone_gen_init(&pots_cw_tone_state, &desc);
+		pots_cw_tone_on = true;
+#if (CONFIG_CID_CALL_WAITING == true)
+		_potsStartCWCID();
+#endif
+	} else if (!pots_cw_tone_req) {
+		// What's left of the burst in the mixer plays out
+		pots_cw_tone_on = false;
+	}
+	
+#if (CONFIG_CID_CALL_WAITING == true)
+	// Type II Caller ID owns the mixer source until it is done
+	_potsEvalCWCID();
+	if (pots_cw_cid_state != CW_CID_IDLE) return;
+#endif
+	
+	if (pots_cw_tone_on && !pots_far_tone_on) {
+		cur_samples_in_tx = audioGetMixTxCount(AUDIO_MIX_TONE);
+		while (cur_samples_in_tx < POTS_FAR_TONE_MIX_LEN) {
+			samples_in_buf = tone_gen(&pots_cw_tone_state, pots_cw_tone_buf, POTS_TONE_BUF_LEN);
+			if (samples_in_buf == 0) break;
+			audioPutMixTx(AUDIO_MIX_TONE, pots_cw_tone_buf, samples_in_buf);
+			cur_samples_in_tx += samples_in_buf;
+		}
+	}
+}
+
+
+#if (CONFIG_CID_CALL_WAITING == true)
+// Start Type II Caller ID for the waiting call when the country uses Bellcore FSK.  The message
+// is rendered into cid_audio_buf (free while the phone is off-hook) followed by the alert: the
+// call waiting tone's first burst as the SAS and then the CAS.  The call waiting tone carries on
+// from the end of its first burst once the sequence is over.
+static void _potsStartCWCID()
+{
+	tone_gen_descriptor_t desc;
+	tone_gen_state_t cas_state;
+	int16_t* alertP;
+	int n;
+	
+	if (((country_code_infoP->cid.cid_spec & INT_CID_TYPE_MASK) != INT_CID_TYPE_BELLCORE_FSK) ||
+	    pots_far_tone_on || (cid_audio_buf == NULL)) {
+		
+		return;
+	}
+	
+	// Any on-hook message is overwritten
+	cid_audio_ready = false;
+	if (!_potsSetupCID(true) || ((cid_audio_len + 8 * (POTS_CW_ON_MSEC + POTS_CW_CAS_MSEC)) > POTS_CID_BUF_LEN)) {
+		return;
+	}
+	
+	alertP = &cid_audio_buf[cid_audio_len];
+	n = tone_gen(&pots_cw_tone_state, alertP, 8 * POTS_CW_ON_MSEC);
+	tone_gen_descriptor_init(&desc, POTS_CW_CAS_F1, POTS_CW_CAS_LEVEL_DBM0, POTS_CW_CAS_F2, POTS_CW_CAS_LEVEL_DBM0,
+	                         POTS_CW_CAS_MSEC, 0, 0, 0, false);
+	tone_gen_init(&cas_state, &desc);
+	n += tone_gen(&cas_state, &alertP[n], 8 * POTS_CW_CAS_MSEC);
+	
+	// Mute the far end and start the alert
+	audioFlushMixTx(AUDIO_MIX_TONE);
+	audioSetMixGain(AUDIO_MIX_MAIN, POTS_FAR_TONE_MUTE_DB);
+	cw_cid_playP = alertP;
+	cw_cid_play_len = n;
+	pots_cw_cid_state = CW_CID_ALERT;
+	(void) _potsEvalCWCIDAudio();
+}
+
+
+static void _potsEvalCWCID()
+{
+#ifdef POTS_CID_DEBUG
+	static pots_cw_cid_stateT prev_pots_cw_cid_state = CW_CID_IDLE;
+#endif
+	
+	// Stop if the waiting call goes away or the far end starts a call progress tone
+	if (!pots_cw_tone_req || pots_far_tone_on) {
+		_potsEndCWCID();
+	}
+	
+	switch (pots_cw_cid_state) {
+		case CW_CID_ALERT:
+			if (_potsEvalCWCIDAudio()) {
+				// Listen for the ACK, timing the window from when the queued CAS will have played
+				audioSetDtmfAck(true);
+				_potsStartCIDTimer((audioGetMixTxCount(AUDIO_MIX_TONE) * 1000 / 8000) + POTS_CW_ACK_WAIT_MSEC);
+				pots_cw_cid_state = CW_CID_ACK_WAIT;
+			}
+			break;
+		
+		case CW_CID_MSG:
+			if (_potsEvalCWCIDAudio()) {
+				// Restore the far end once the queued message has played
+				_potsStartCIDTimer((audioGetMixTxCount(AUDIO_MIX_TONE) * 1000 / 8000) + POTS_CID_FLUSH_MSEC);
+				pots_cw_cid_state = CW_CID_POST_MSG_WAIT;
+			}
+			break;
+		
+		default:
+			// Idle or waiting for the ACK or cid_timer
+			break;
+	}
+	
+#ifdef POTS_CID_DEBUG
+	STATE_CHANGE_PRINT(prev_pots_cw_cid_state, pots_cw_cid_state, pots_cw_cid_state_name);
+	prev_pots_cw_cid_state = pots_cw_cid_state;
+#endif
+}
+
+
+static void _potsEvalCWCIDTimer()
+{
+	switch (pots_cw_cid_state) {
+		case CW_CID_ACK_WAIT:
+			// The phone doesn't support Type II Caller ID
+			DLOGI(TAG, "No CAS ACK");
+			_potsEndCWCID();
+			break;
+		
+		case CW_CID_PRE_MSG_WAIT:
+			// Start the message
+			cw_cid_playP = cid_audio_buf;
+			cw_cid_play_len = cid_audio_len;
+			pots_cw_cid_state = CW_CID_MSG;
+			(void) _potsEvalCWCIDAudio();
+			break;
+		
+		case CW_CID_POST_MSG_WAIT:
+			_potsEndCWCID();
+			break;
+		
+		default:
+			break;
+	}
+}
+
+
+// The phone acknowledged the CAS (audio_task has stopped looking for it)
+static void _potsEvalCWCIDAck()
+{
+	if (pots_cw_cid_state == CW_CID_ACK_WAIT) {
+		_potsStartCIDTimer(POTS_CW_FSK_DELAY_MSEC);
+		pots_cw_cid_state = CW_CID_PRE_MSG_WAIT;
+	}
+}
+
+
+// End (or abandon) Type II Caller ID and restore the far end
+static void _potsEndCWCID()
+{
+	if (pots_cw_cid_state != CW_CID_IDLE) {
+		(void) esp_timer_stop(cid_timer);
+		audioSetDtmfAck(false);
+		if ((pots_cw_cid_state == CW_CID_ALERT) || (pots_cw_cid_state == CW_CID_MSG)) {
+			audioFlushMixTx(AUDIO_MIX_TONE);
+		}
+		if (!pots_far_tone_on) {
+			audioSetMixGain(AUDIO_MIX_MAIN, 0);
+		}
+		pots_cw_cid_state = CW_CID_IDLE;
+	}
+}
+
+
+// Keep the mixer topped off from cw_cid_playP.  Returns true once all of it has been queued.
+static bool _potsEvalCWCIDAudio()
+{
+	int n;
+	
+	n = POTS_CW_CID_MIX_LEN - audioGetMixTxCount(AUDIO_MIX_TONE);
+	if (n > cw_cid_play_len) n = cw_cid_play_len;
+	if (n > 0) {
+		audioPutMixTx(AUDIO_MIX_TONE, cw_cid_playP, n);
+		cw_cid_playP += n;
+		cw_cid_play_len -= n;
+	}
+	
+	return (cw_cid_play_len == 0);
+}
+#endif
+
+
+// Hands the complete pre-rendered CID message to audio_task in one put once it is running tone
+// audio (so the start isn't lost).  Returns false when the message has been played down to
+// the amount a tone generator would leave in the TX buffer at its end.
+static bool _potsEvalCIDAudio()
+{
+	if (!cid_audio_queued) {
+		if (!audioToneTxReady()) return true;
+		
+		if ((cid_audio_buf == NULL) || (cid_audio_len == 0)) return false;
+		audioPutToneTxBuffer(cid_audio_buf, cid_audio_len);
+		cid_audio_queued = true;
+	}
+	
+	return (audioGetTxCount() > POTS_TONE_BUF_LEN);
+}
+
+
+// Hands the current digit's pre-rendered burst to audio_task in one put once it is running
+// tone audio.  A burst queued while the previous digit's is still playing would replace it
+// and shorten the gap between them so that one is let finish first.  Returns false when the
+// burst has been played down to the amount a tone generator would leave in the TX buffer.
+static bool _potsEvalDtmfCache()
+{
+	if (!dtmf_tx_cache_queued) {
+		if (!audioToneTxReady()) return true;
+		if (dtmf_tx_cache_wait && (audioGetTxCount() != 0)) return true;
+		
+		audioPutToneTxBuffer(dtmf_tx_cacheP, dtmf_tx_cache_len);
+		dtmf_tx_cache_queued = true;
+	}
+	
+	return (audioGetTxCount() > POTS_TONE_BUF_LEN);
+}
+
+
+// Top off endless status tones and Caller ID between state machine evaluations when audio_task
+// says it is running low (the end of DTMF tones and CID is detected by the state machine)
+static void _potsEvalToneRefill()
+{
+	if ((pots_tone_state == TONE_DIAL) || (pots_tone_state == TONE_NO_SERVICE) || (pots_tone_state == TONE_OFF_HOOK) ||
+	    (pots_tone_state == TONE_CID)) {
+		(void) _potsEvalToneGen();
+	}
+}
+
+
 static bool _potsToneTimerExpired()
 {
 	if (pots_tone_timer_count != 0) {
@@ -1338,26 +3274,39 @@ static bool _potsToneTimerExpired()
 
 static void _potsSendDialedDigit(char d)
 {
-	app_set_pots_digit(d);
-	xTaskNotify(task_handle_app, APP_NOTIFY_POTS_DIGIT_DIALED_MASK, eSetBits);
+	evt_bus_send_digit(EVT_QUEUE_APP, APP_EVT_POTS_DIGIT_DIALED, d);
 }
 
 
 static void _potsSetAudioOutput(pots_tone_stateT s)
 {
+	const char* cp;
+	int i;
+	
 	switch (s) {
 		case TONE_IDLE:
-			// Notify audio_task to disable audio
-			xTaskNotify(task_handle_audio, AUDIO_NOTIFY_DISABLE_MASK, eSetBits);
+			if ((pots_incoming_count > 0) && (pots_state == ON_HOOK)) {
+				// Notify audio_task to (re)enter standby while the phone is still ringing (e.g.
+				// after Caller ID)
+				xTaskNotify(task_handle_audio, AUDIO_NOTIFY_STANDBY_MASK, eSetBits);
+			} else {
+				// Notify audio_task to disable audio
+				xTaskNotify(task_handle_audio, AUDIO_NOTIFY_DISABLE_MASK, eSetBits);
+			}
 			
 			// Notify app_task to restore audio levels if necessary
 			if (pots_tone_state == TONE_OFF_HOOK) {
-				xTaskNotify(task_handle_app, APP_NOTIFY_POTS_NORM_SPK_GAIN_MASK, eSetBits);
+				evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_POTS_NORM_SPK_GAIN);
 			}
 			break;
 		
 		case TONE_VOICE:
-			// Notify audio_task to start processing voice
+			// Any incoming call was answered
+			pots_incoming_count = 0;
+			pots_answer_wait_count = 0;
+			
+			// Notify audio_task to start processing voice (connecting the standby stream if
+			// possible)
 			if (pots_call_audio_16k) {
 				xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_VOICE_16_MASK, eSetBits);
 			} else {
@@ -1376,29 +3325,60 @@ static void _potsSetAudioOutput(pots_tone_stateT s)
 		case TONE_DIAL:
 			_potsSetupAudioTone(INT_TONE_SET_DIAL_INDEX);
 			
+			// Any ringback notification was for an earlier call
+			pots_ringback_req = false;
+			
 			// Notify audio_task to start processing tone
 			xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_TONE_MASK, eSetBits);
 			
 			// Setup DTMF receiver in preparation to hear dialed digits
 			(void) dtmf_rx_init(&dtmf_rx_state, _potsDtmfCallback, (void *) 0);
+			dtmf_rx_set_quality_callback(&dtmf_rx_state, _potsDtmfQualityCallback, (void *) 0);
 			pots_dial_last_dtmf_digit = ' ';
+			dtmf_gate_open = false;
+			dtmf_gate_hang = 0;
+			dtmf_gate_blocks = 0;
+			dtmf_gate_skipped = 0;
 			
 			// Setup DTMF transmitter in preparation to simulate dialed digit sounds that our
 			// controlling app tells us it is dialing on behalf of the phone
 			(void) dtmf_tx_init(&dtmf_tx_state);
 			
+#if (CONFIG_PROMPT_ENABLE == true)
+			// Warn over the dial tone when the battery is running down
+			if (pots_tone_state == TONE_IDLE) {
+				_potsPromptBattery();
+			}
+#endif
+			
 			// (Re)set off-hook too long detection timeout
 			pots_tone_timer_count = country_code_infoP->off_hook_timeout / POTS_EVAL_MSEC;;
 			break;
 		
 		case TONE_DIAL_QUIET:
+			if (pots_tone_state == TONE_RINGBACK) {
+				// Back to tone audio from the voice standby stream
+				xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_TONE_MASK, eSetBits);
+			}
+			
 			// (Re)set off-hook too long detection timeout
 			pots_tone_timer_count = country_code_infoP->off_hook_timeout / POTS_EVAL_MSEC;;
 			break;
 		
 		case TONE_DTMF:
-			// Add the digit provided by the app to our list of DTMF tones to generate
-			dtmf_tx_put(&dtmf_tx_state, dtmf_tx_digit_buf, -1);
+			// Play the digit provided by the app from the cache if it's there, otherwise add
+			// it to our list of DTMF tones to generate
+			dtmf_tx_cacheP = NULL;
+			cp = (dtmf_cache_buf == NULL) ? NULL : strchr(POTS_DTMF_CACHE_DIGITS, dtmf_tx_digit_buf[0]);
+			if ((cp != NULL) && (*cp != 0)) {
+				i = cp - POTS_DTMF_CACHE_DIGITS;
+				dtmf_tx_cacheP = &dtmf_cache_buf[dtmf_cache_index[i]];
+				dtmf_tx_cache_len = dtmf_cache_len[i];
+				dtmf_tx_cache_queued = false;
+				dtmf_tx_cache_wait = (pots_tone_state == TONE_DTMF_FLUSH);
+			} else {
+				dtmf_tx_put(&dtmf_tx_state, dtmf_tx_digit_buf, -1);
+			}
 			
 			// Notify audio_task to start processing tone
 			xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_TONE_MASK, eSetBits);
@@ -1417,13 +3397,18 @@ static void _potsSetAudioOutput(pots_tone_stateT s)
 			
 			// Notify audio_task to start processing tone
 			xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_TONE_MASK, eSetBits);
+			
+#if (CONFIG_PROMPT_ENABLE == true)
+			// Say why over the reorder tone
+			(void) prompt_play(PROMPT_NOT_CONNECTED);
+#endif
 			break;
 		
 		case TONE_OFF_HOOK:
 			_potsSetupAudioTone(INT_TONE_SET_OH_INDEX);
 			
 			// Notify app_task to set maximum gain for signaling (in case user has set a very low speaker volume)
-			xTaskNotify(task_handle_app, APP_NOTIFY_POTS_MAX_SPK_GAIN_MASK, eSetBits);
+			evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_POTS_MAX_SPK_GAIN);
 			
 			
 			// Notify audio_task to start processing tone
@@ -1432,7 +3417,7 @@ static void _potsSetAudioOutput(pots_tone_stateT s)
 		
 		case TONE_CID:
 			// Notify app_task to set maximum gain for signaling (in case user has set a very low speaker volume)
-			xTaskNotify(task_handle_app, APP_NOTIFY_POTS_MAX_SPK_GAIN_MASK, eSetBits);
+			evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_POTS_MAX_SPK_GAIN);
 			
 			// Notify audio_task to start processing message
 			xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_TONE_MASK, eSetBits);
@@ -1440,11 +3425,37 @@ static void _potsSetAudioOutput(pots_tone_stateT s)
 		
 		case TONE_CID_FLUSH:
 			// Notify app_task to restore audio levels
-			xTaskNotify(task_handle_app, APP_NOTIFY_POTS_NORM_SPK_GAIN_MASK, eSetBits);
+			evt_bus_send_id(EVT_QUEUE_APP, APP_EVT_POTS_NORM_SPK_GAIN);
 				
 			// Setup timer for flush period following a CID audio generation
 			pots_tone_timer_count = POTS_CID_FLUSH_MSEC / POTS_EVAL_MSEC;
 			break;
+		
+		case TONE_RINGBACK:
+			_potsSetupAudioTone(INT_TONE_SET_RB_INDEX);
+			
+			// Notify audio_task to move to the voice standby stream so the call audio connects
+			// without a stream restart (the ringback plays through the TX mixer)
+			xTaskNotify(task_handle_audio, AUDIO_NOTIFY_STANDBY_MASK, eSetBits);
+			break;
+		
+		case TONE_ANS_MACH:
+			// The call was answered
+			pots_incoming_count = 0;
+			
+			// Notify audio_task to connect the voice stream to the answering machine
+			if (pots_call_audio_16k) {
+				xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_VOICE_16_MASK | AUDIO_NOTIFY_ANS_MACH_MASK, eSetBits);
+			} else {
+				xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_VOICE_8_MASK | AUDIO_NOTIFY_ANS_MACH_MASK, eSetBits);
+			}
+			break;
+		
+		case TONE_MESSAGE:
+			// The message plays through the TX mixer over tone audio
+			xTaskNotify(task_handle_audio, AUDIO_NOTIFY_EN_TONE_MASK, eSetBits);
+			pots_tone_timer_count = 0;
+			break;
 	}
 }
 
@@ -1459,7 +3470,7 @@ static void _potsSetupAudioTone(int tone_index)
 		sample_tone_tx_index = 0;
 		tone_tx_use_sample = true;
 	} else {
-		(void) super_tone_tx_init(&tone_state, tone_step[tone_index][0]);
+		(void) super_tone_tx_init(&tone_state, &tone_step[tone_index][0]);
 		tone_tx_use_sample = false;
 	}
 }
@@ -1470,7 +3481,8 @@ static void _potsEvalDtmfDetect()
 	int cur_samples_in_rx;
 	int samples_to_analyze;
 	
-	if ((pots_tone_state == TONE_IDLE) || (pots_tone_state == TONE_VOICE) || (pots_tone_state == TONE_VOICE_WAIT_HANGUP)) {
+	if ((pots_tone_state == TONE_IDLE) || (pots_tone_state == TONE_VOICE) || (pots_tone_state == TONE_VOICE_WAIT_HANGUP) ||
+	    (pots_tone_state == TONE_RINGBACK) || (pots_tone_state == TONE_ANS_MACH)) {
 		// Don't do anything if audio_task isn't handling audio for us
 		return;
 	}
@@ -1481,14 +3493,51 @@ static void _potsEvalDtmfDetect()
 		samples_to_analyze = (cur_samples_in_rx >= POTS_DTMF_BUF_LEN) ? POTS_DTMF_BUF_LEN : cur_samples_in_rx;
 		audioGetToneRx(dtmf_rx_buf, samples_to_analyze);
 		if ((pots_tone_state == TONE_DIAL) || (pots_tone_state == TONE_DIAL_QUIET)) {
-			// Only look for DTMF tones when we expect user-generated tones
-			(void) dtmf_rx(&dtmf_rx_state, dtmf_rx_buf, samples_to_analyze);
+			// Only look for DTMF tones when we expect user-generated tones, and only run the
+			// full detector when there's something on the line
+			if (_potsDtmfGate(dtmf_rx_buf, samples_to_analyze)) {
+				(void) dtmf_rx(&dtmf_rx_state, dtmf_rx_buf, samples_to_analyze);
+			} else {
+				(void) dtmf_rx_fillin(&dtmf_rx_state, samples_to_analyze);
+			}
 		}
 		cur_samples_in_rx -= samples_to_analyze;
 	}
 }
 
 
+// Returns true if the block should go through the DTMF detector
+static bool _potsDtmfGate(const int16_t* buf, int len)
+{
+	int i;
+	uint32_t sum = 0;
+	uint32_t level;
+	
+	// (x*x >> 8) keeps a full scale block of POTS_DTMF_BUF_LEN samples within 32 bits
+	for (i=0; i<len; i++) {
+		sum += ((int32_t) buf[i] * buf[i]) >> 8;
+	}
+	level = sum / len;
+	
+	if (level >= POTS_DTMF_GATE_ON) {
+		dtmf_gate_open = true;
+		dtmf_gate_hang = 8 * POTS_DTMF_GATE_HANG_MSEC;
+	} else if (dtmf_gate_open && (level < POTS_DTMF_GATE_OFF)) {
+		dtmf_gate_hang -= len;
+		if (dtmf_gate_hang <= 0) {
+			dtmf_gate_open = false;
+		}
+	}
+	
+	dtmf_gate_blocks++;
+	if (!dtmf_gate_open) {
+		dtmf_gate_skipped++;
+	}
+	
+	return dtmf_gate_open;
+}
+
+
 static void _potsDtmfCallback(void *data, const char *digits, int len)
 {
 	// Will be set if necessary
@@ -1500,6 +3549,13 @@ static void _potsDtmfCallback(void *data, const char *digits, int len)
 	
 	if (len > 1) {
 		ESP_LOGE(TAG, "Saw too many DTMF keys - %d", len);
+		dtmf_qual_note_multi();
 	}
 	pots_dial_last_dtmf_digit = digits[0];
 }
+
+
+static void _potsDtmfQualityCallback(void *data, const dtmf_rx_quality_t *q)
+{
+	dtmf_qual_add(q);
+}
@@ -47,14 +47,35 @@
 #define POTS_NOTIFY_UNMUTE_RING_MASK     0x00000200
 #define POTS_NOTIFY_RING_MASK            0x00000400
 #define POTS_NOTIFY_DONE_RINGING_MASK    0x00000800
-#define POTS_NOTIFY_EXT_DIAL_DIGIT_MASK  0x00001000
+#define POTS_NOTIFY_FAR_TONE_MASK        0x00001000
+#define POTS_NOTIFY_FAR_TONE_END_MASK    0x00002000
+#define POTS_NOTIFY_CALL_WAITING_MASK    0x00004000
+#define POTS_NOTIFY_CALL_WAIT_END_MASK   0x00008000
 #define POTS_NOTIFY_NEW_COUNTRY_MASK     0x00010000
+#define POTS_NOTIFY_CID_TIMER_MASK       0x00020000
+#define POTS_NOTIFY_NEW_CID_MASK         0x00040000
+#define POTS_NOTIFY_AUDIO_TX_LOW_MASK    0x00100000
+#define POTS_NOTIFY_AUDIO_RX_READY_MASK  0x00200000
+#define POTS_NOTIFY_RINGBACK_MASK        0x00400000
+#define POTS_NOTIFY_RINGBACK_END_MASK    0x00800000
+#define POTS_NOTIFY_RING_TRIP_MASK       0x01000000
+#define POTS_NOTIFY_ANS_MACH_MASK        0x02000000
+#define POTS_NOTIFY_ANS_MACH_END_MASK    0x04000000
+#define POTS_NOTIFY_MSG_PLAY_MASK        0x08000000
+#define POTS_NOTIFY_MSG_STOP_MASK        0x10000000
+#define POTS_NOTIFY_CW_ACK_MASK          0x20000000
+#define POTS_NOTIFY_ULP_WAKE_MASK        0x40000000
+
+// Depth of our event queue (EVT_QUEUE_POTS)
+#define POTS_EVT_QUEUE_DEPTH             8
+
+// Events sent to EVT_QUEUE_POTS (payload in brackets)
+#define POTS_EVT_EXT_DIAL_DIGIT          1   // [digit - dialed on our behalf by app_task]
 
 
 //
 // API
 //
 void pots_task(void* args);
-void pots_set_app_dialed_digit(char d);  // Called before sending POTS_NOTIFY_EXT_DIAL_DIGIT_MASK
 
 #endif /* POTS_TASK_H */
\ No newline at end of file
@@ -22,6 +22,7 @@
 #ifndef _SYS_COMMON_
 #define _SYS_COMMON_
 
+#include "esp_attr.h"
 #include "esp_gap_bt_api.h"
 #include "freertos/task.h"
 
@@ -31,11 +32,19 @@
 //
 
 // State transition diagnostic macro
-#define STATE_CHANGE_PRINT(s1, s2, nameStr) {if ((int) s1 != (int) s2) {ESP_LOGI(TAG, "%s->%s", nameStr[s1], nameStr[s2]);}}
+#define STATE_CHANGE_PRINT(s1, s2, nameStr) {if ((int) s1 != (int) s2) {DLOGI(TAG, "%s->%s", nameStr[s1], nameStr[s2]); blackbox_state(TAG, nameStr[s1], nameStr[s2]);}}
 
 // Notification decode macro
 #define Notification(var, mask) ((var & mask) == mask)
 
+// Placement of stacks and buffers only non-real-time tasks touch (PSRAM when CONFIG_COLD_DATA_IN_PSRAM
+// is set).  Never for anything used by audio_task, an ISR, DMA or code running with the cache disabled.
+#if (CONFIG_COLD_DATA_IN_PSRAM == true)
+#define COLD_ATTR EXT_RAM_ATTR
+#else
+#define COLD_ATTR
+#endif
+
 // Traditional Bluetooth pairing pin (used when SSP is not enabled)
 // Note:
 //  1. The first 4 digits are used for both 4- and 16-character pins
@@ -47,6 +56,11 @@ extern const esp_bt_pin_code_t bt_trad_pin;   /* owned by bt_task */
 // Caller ID String to use for GUI and Caller ID transmission for no number
 #define UNKNOWN_CID_STRING "Unknown"
 
+// Event bus queues (created in app_main before the tasks start)
+#define EVT_QUEUE_APP   0
+#define EVT_QUEUE_BT    1
+#define EVT_QUEUE_POTS  2
+
 // Task handles used to send notifications between tasks (owned by app_task)
 extern TaskHandle_t task_handle_app;
 extern TaskHandle_t task_handle_audio;
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# dlog_decode - decode the "#DL" binary log records written by the dlog module when it is
+# built with CONFIG_DLOG_BINARY_OUTPUT.  Records carry the addresses of their format and
+# tag strings which are read from the ELF file the firmware was built from.
+#
+# Usage: dlog_decode.py build/gcore_pots_bt.elf [captured_log]   (reads stdin if no log)
+#
+# Other lines are passed through so a serial capture can be decoded as a whole.
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import re
+import struct
+import sys
+
+LEVEL_CHAR = "NEWIDV"
+
+# C conversion: flags, width, precision, length, conversion
+CONV_RE = re.compile(r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|z|j|t)?([diouxXcsp%])")
+
+RECORD_RE = re.compile(r"#DL ([0-9a-f]+)")
+
+
+class Elf32:
+    """Just enough of an ELF32 reader to find strings in the allocated sections"""
+    
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 1:
+            raise ValueError("%s is not a 32-bit ELF file" % path)
+        shoff, = struct.unpack_from("<I", self.data, 0x20)
+        shentsize, shnum = struct.unpack_from("<HH", self.data, 0x2E)
+        self.sections = []
+        for i in range(shnum):
+            (name, stype, flags, addr, offset, size) = struct.unpack_from("<IIIIII", self.data, shoff + i * shentsize)
+            # Allocated sections with contents in the file
+            if (flags & 0x2) and stype != 8 and size != 0:
+                self.sections.append((addr, offset, size))
+    
+    def string_at(self, addr):
+        for (s_addr, s_offset, s_size) in self.sections:
+            if s_addr <= addr < s_addr + s_size:
+                start = s_offset + addr - s_addr
+                end = self.data.index(b"\0", start)
+                return self.data[start:end].decode("utf-8", "replace")
+        return "<0x%08x?>" % addr
+
+
+def format_c(fmt, args, str_mask, strs):
+    """Apply a C format to the captured 32-bit arguments"""
+    out = []
+    pos = 0
+    n = 0
+    
+    def next_arg():
+        nonlocal n
+        if n >= len(args):
+            return (0, False)
+        a = (args[n], (str_mask >> n) & 1)
+        n += 1
+        return a
+    
+    for m in CONV_RE.finditer(fmt):
+        out.append(fmt[pos:m.start()])
+        pos = m.end()
+        flags, width, prec, _, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        if width == "*":
+            width = str(struct.unpack("<i", struct.pack("<I", next_arg()[0]))[0])
+        if prec == "*":
+            prec = str(next_arg()[0])
+        spec = "%" + flags + (width or "") + ("." + prec if prec is not None else "")
+        val, is_str = next_arg()
+        if conv == "s":
+            out.append((spec + "s") % (strs.get(val, "") if is_str else "?"))
+        elif conv in "di":
+            out.append((spec + "d") % struct.unpack("<i", struct.pack("<I", val))[0])
+        elif conv == "c":
+            out.append((spec + "c") % chr(val & 0xFF))
+        elif conv == "p":
+            out.append("0x%x" % val)
+        else:
+            out.append((spec + conv.replace("u", "d")) % val)
+    out.append(fmt[pos:])
+    return "".join(out)
+
+
+def decode(elf, hexstr):
+    raw = bytes.fromhex(hexstr)
+    msec, fmt_addr, tag_addr, level, num_args, str_mask, str_len = struct.unpack_from(">IIIBBBB", raw, 0)
+    tag = elf.string_at(tag_addr)
+    fmt = elf.string_at(fmt_addr)
+    c = LEVEL_CHAR[level] if level < len(LEVEL_CHAR) else "?"
+    if num_args == 0xFF:
+        return "%s (%u) %s: %s" % (c, msec, tag, fmt)
+    
+    args = list(struct.unpack_from(">%dI" % num_args, raw, 16))
+    packed = raw[16 + 4 * num_args:16 + 4 * num_args + str_len]
+    
+    # Strings by their offset in the packed buffer
+    strs = {}
+    offset = 0
+    for s in packed.split(b"\0"):
+        strs[offset] = s.decode("utf-8", "replace")
+        offset += len(s) + 1
+    strs.setdefault(len(packed) - 1 if packed else 0, "")
+    
+    return "%s (%u) %s: %s" % (c, msec, tag, format_c(fmt, args, str_mask, strs))
+
+
+def main():
+    if len(sys.argv) < 2:
+        print(__doc__ if __doc__ else "usage: dlog_decode.py <elf> [log]", file=sys.stderr)
+        sys.exit(1)
+    elf = Elf32(sys.argv[1])
+    src = open(sys.argv[2], "r", errors="replace") if len(sys.argv) > 2 else sys.stdin
+    for line in src:
+        m = RECORD_RE.search(line)
+        if m:
+            try:
+                print(decode(elf, m.group(1)))
+            except (ValueError, struct.error):
+                print(line, end="")
+        else:
+            print(line, end="")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,119 @@
+#!/usr/bin/env python3
+#
+# eq_design - design the handset equalizer biquad cascades and write them as Q28 coefficient
+# tables to components/audio_assets/eq_profiles.h so the firmware doesn't design filters at
+# run time.  Each profile has one cascade for the line audio from the phone (the mic path,
+# sent to the cellphone) and one for the cellphone audio played to the phone (the speaker
+# path), designed for both the 8 kHz (CVSD) and 16 kHz (mSBC) sample rates.
+#
+# Sections use the RBJ audio EQ cookbook forms.  Keep the boost of each cascade modest since
+# the filters saturate at full scale.  Profile order matches PS_EQ_PROFILE_* in ps.h.
+#
+# Usage: eq_design.py [eq_profiles.h]
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import math
+import os
+import sys
+
+RATES = [8000, 16000]
+MAX_STAGES = 3
+COEF_SHIFT = 28
+
+# (name, mic path sections, speaker path sections).  Sections are (type, fc Hz, gain dB, Q).
+PROFILES = [
+    ("Flat", [], []),
+    # Carbon transmitters peak strongly around 1.5 kHz with little low end and the matching
+    # electromagnetic receivers are thin and honky
+    ("Carbon",
+     [("lowshelf", 350, 4.0, 0.707), ("peak", 1600, -5.0, 1.0), ("peak", 3000, 3.0, 1.4)],
+     [("lowshelf", 500, 3.0, 0.707), ("peak", 1000, -3.0, 1.2)]),
+    # Electrets are flat but pick up handling noise and sound bright through the codecs
+    ("Electret",
+     [("lowshelf", 200, -3.0, 0.707), ("highshelf", 3000, -3.0, 0.707)],
+     [("peak", 2500, 2.0, 1.0)]),
+]
+
+
+def design(kind, fc, gain_db, q, rate):
+    a = 10.0 ** (gain_db / 40.0)
+    w0 = 2.0 * math.pi * fc / rate
+    cw = math.cos(w0)
+    alpha = math.sin(w0) / (2.0 * q)
+    if kind == "peak":
+        b = [1.0 + alpha * a, -2.0 * cw, 1.0 - alpha * a]
+        d = [1.0 + alpha / a, -2.0 * cw, 1.0 - alpha / a]
+    elif kind == "lowshelf":
+        sa = 2.0 * math.sqrt(a) * alpha
+        b = [a * ((a + 1) - (a - 1) * cw + sa), 2 * a * ((a - 1) - (a + 1) * cw), a * ((a + 1) - (a - 1) * cw - sa)]
+        d = [(a + 1) + (a - 1) * cw + sa, -2 * ((a - 1) + (a + 1) * cw), (a + 1) + (a - 1) * cw - sa]
+    elif kind == "highshelf":
+        sa = 2.0 * math.sqrt(a) * alpha
+        b = [a * ((a + 1) + (a - 1) * cw + sa), -2 * a * ((a - 1) + (a + 1) * cw), a * ((a + 1) + (a - 1) * cw - sa)]
+        d = [(a + 1) - (a - 1) * cw + sa, 2 * ((a - 1) - (a + 1) * cw), (a + 1) - (a - 1) * cw - sa]
+    else:
+        sys.exit("Unknown section type %s" % kind)
+    c = [b[0] / d[0], b[1] / d[0], b[2] / d[0], d[1] / d[0], d[2] / d[0]]
+    return [int(round(v * (1 << COEF_SHIFT))) for v in c]
+
+
+def cascade(sections, rate):
+    if len(sections) > MAX_STAGES:
+        sys.exit("At most %d sections per cascade" % MAX_STAGES)
+    out = [design(*s, rate) for s in sections]
+    while len(out) < MAX_STAGES:
+        out.append([0, 0, 0, 0, 0])
+    return out
+
+
+def main():
+    dst = sys.argv[1] if len(sys.argv) > 1 else os.path.join(os.path.dirname(__file__), "..",
+                                                            "components", "audio_assets", "eq_profiles.h")
+    lines = []
+    lines.append("/*")
+    lines.append(" * Handset equalizer biquad cascades generated by tools/eq_design.py - do not edit")
+    lines.append(" */")
+    lines.append("#include <stdint.h>")
+    lines.append("")
+    lines.append("#define EQ_PROFILE_NUM    %d" % len(PROFILES))
+    lines.append("#define EQ_PROFILE_STAGES %d" % MAX_STAGES)
+    lines.append("")
+    lines.append("// Sections in each cascade [profile][mic, speaker]")
+    lines.append("static const uint8_t eq_profile_stages[EQ_PROFILE_NUM][2] = {")
+    for name, mic, spk in PROFILES:
+        lines.append("\t{%d, %d},    // %s" % (len(mic), len(spk), name))
+    lines.append("};")
+    lines.append("")
+    lines.append("// Q28 b0, b1, b2, a1, a2 [profile][mic, speaker][8 kHz, 16 kHz][section]")
+    lines.append("static const int32_t eq_profile_coeffs[EQ_PROFILE_NUM][2][2][EQ_PROFILE_STAGES][5] = {")
+    for name, mic, spk in PROFILES:
+        lines.append("\t{   // %s" % name)
+        for path in (mic, spk):
+            lines.append("\t\t{")
+            for rate in RATES:
+                secs = ", ".join("{%s}" % ", ".join("%d" % v for v in c) for c in cascade(path, rate))
+                lines.append("\t\t\t{%s}," % secs)
+            lines.append("\t\t},")
+        lines.append("\t},")
+    lines.append("};")
+    with open(dst, "w") as f:
+        f.write("\n".join(lines) + "\n")
+    print("%s: %d profiles" % (dst, len(PROFILES)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,188 @@
+#!/usr/bin/env python3
+#
+# font_subset - generate the subset GUI fonts used when the firmware is built with
+# CONFIG_GUI_SUBSET_FONTS.  The GUI sources are scanned to find the text each font size
+# has to render (string literals, keypad maps and LV_SYMBOL icons set on objects using
+# that size) and lv_font_conv is run with just those glyphs.
+#
+# Usage: font_subset.py <Montserrat-Medium.ttf> <FontAwesome5-Solid+Brands+Regular.woff>
+#                       [--dump]   (print the glyph sets without running lv_font_conv)
+#
+# The fonts are the ones LVGL's built-in Montserrat fonts were made from.  Output goes to
+# components/gui_assets/gui_font_<size>.c.  Re-run after changing text in components/gui.
+#
+# Objects whose text is set at run time from a variable are given the printable ASCII
+# range unless their character set is listed in RUNTIME_CHARS.
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import glob
+import os
+import re
+import subprocess
+import sys
+
+ROOT = os.path.abspath(os.path.join(os.path.dirname(__file__), ".."))
+GUI_DIR = os.path.join(ROOT, "components", "gui")
+OUT_DIR = os.path.join(ROOT, "components", "gui_assets")
+SYMBOL_DEF = os.path.join(ROOT, "components", "lvgl", "src", "lv_font", "lv_symbol_def.h")
+
+# Sizes generated (must match the GUI_FONT_<size> definitions in gui_fonts.h)
+SIZES = [14, 20, 34, 38]
+
+PRINTABLE_ASCII = "".join(chr(c) for c in range(0x20, 0x7F))
+
+# Character sets of objects whose text is built at run time
+RUNTIME_CHARS = {
+    "lbl_time_set":  "0123456789:/ ",          # "HH:MM:SS MM/DD/YY" (recolor commands aren't drawn)
+}
+
+# Same options as the LVGL built-in fonts
+CONV_OPTS = ["--no-compress", "--no-prefilter", "--bpp", "4", "--format", "lvgl",
+             "--lv-include", "lvgl.h", "--force-fast-kern-format"]
+
+FONT_RE = re.compile(r"lv_obj_set_style_local_text_font\(\s*(\w+)\s*,[^;]*GUI_FONT_(\d+)\s*\)")
+CREATE_RE = re.compile(r"(\w+)\s*=\s*lv_\w+_create\(\s*(\w+)\s*,")
+TEXT_RE = re.compile(r"lv_label_set_(?:static_)?text(_fmt)?\(\s*(\w+)\s*,\s*([^;]*)\)\s*;")
+MAP_RE = re.compile(r"lv_btnmatrix_set_map\(\s*(\w+)\s*,\s*(\w+)\s*\)")
+ARRAY_RE = re.compile(r"(\w+)\s*\[\]\s*=\s*\{([^}]*)\}", re.S)
+LITERAL_RE = re.compile(r'"((?:[^"\\]|\\.)*)"')
+SYMBOL_RE = re.compile(r"\bLV_SYMBOL_\w+")
+SYMBOL_DEF_RE = re.compile(r'#define\s+(LV_SYMBOL_\w+)\s+"((?:\\x[0-9a-fA-F]{2})+)"')
+
+
+def load_symbols():
+    symbols = {}
+    with open(SYMBOL_DEF, "r") as f:
+        for m in SYMBOL_DEF_RE.finditer(f.read()):
+            raw = bytes(int(h, 16) for h in re.findall(r"\\x([0-9a-fA-F]{2})", m.group(2)))
+            symbols[m.group(1)] = raw.decode("utf-8")
+    return symbols
+
+
+def c_unescape(s):
+    return s.encode("latin-1", "backslashreplace").decode("unicode_escape").encode("latin-1").decode("utf-8")
+
+
+def expr_chars(expr, arrays, symbols):
+    """Characters an expression passed as text can produce, None if only known at run time"""
+    chars = set()
+    found = False
+    for m in LITERAL_RE.finditer(expr):
+        chars.update(c_unescape(m.group(1)))
+        found = True
+    for m in SYMBOL_RE.finditer(expr):
+        if m.group(0) in symbols:
+            chars.update(symbols[m.group(0)])
+            found = True
+    rest = SYMBOL_RE.sub("", LITERAL_RE.sub("", expr))
+    if re.search(r"[A-Za-z_]\w*", rest) and not found:
+        name = re.search(r"[A-Za-z_]\w*", rest).group(0)
+        if name in arrays:
+            return arrays[name]
+        return None
+    return chars
+
+
+def scan(symbols):
+    """Returns {size: set of characters}"""
+    glyphs = {s: set() for s in SIZES}
+    for path in sorted(glob.glob(os.path.join(GUI_DIR, "*.c"))):
+        with open(path, "r") as f:
+            src = f.read()
+
+        # Constant string arrays (keypad and button maps)
+        arrays = {}
+        for m in ARRAY_RE.finditer(src):
+            chars = expr_chars(m.group(2), {}, symbols)
+            if chars is not None:
+                arrays[m.group(1)] = chars - {"\n"}
+
+        parent = dict((m.group(1), m.group(2)) for m in CREATE_RE.finditer(src))
+        font = dict((m.group(1), int(m.group(2))) for m in FONT_RE.finditer(src))
+
+        def size_of(obj):
+            # Children inherit the font of the nearest styled ancestor
+            seen = set()
+            while obj is not None and obj not in seen:
+                if obj in font:
+                    return font[obj]
+                seen.add(obj)
+                obj = parent.get(obj)
+            return None
+
+        # Formatted text is only known at run time
+        texts = [(m.group(2), m.group(3), m.group(1) is not None) for m in TEXT_RE.finditer(src)]
+        texts += [(m.group(1), m.group(2), False) for m in MAP_RE.finditer(src)]
+        for (obj, expr, is_fmt) in texts:
+            size = size_of(obj)
+            if size not in glyphs:
+                continue
+            chars = None if is_fmt else expr_chars(expr, arrays, symbols)
+            if chars is None:
+                chars = set(RUNTIME_CHARS.get(obj, PRINTABLE_ASCII))
+            glyphs[size].update(chars)
+
+    for s in SIZES:
+        glyphs[s].update(" ?")              # Space and the replacement glyph
+    return glyphs
+
+
+def conv_args(size, chars, text_font, symbol_font, out_path):
+    text = sorted(c for c in chars if ord(c) < 0xF000)
+    icons = sorted(ord(c) for c in chars if ord(c) >= 0xF000)
+    args = ["lv_font_conv"] + CONV_OPTS + ["--size", str(size)]
+    args += ["--font", text_font, "--symbols", "".join(text)]
+    if icons:
+        args += ["--font", symbol_font, "-r", ",".join(str(c) for c in icons)]
+    args += ["-o", out_path]
+    return args
+
+
+def guard(path, size):
+    """Replaces lv_font_conv's self-enabling guard so the font is only built when selected"""
+    name = "GUI_FONT_%d" % size
+    with open(path, "r") as f:
+        src = f.read()
+    src = src.replace("#ifndef %s\n#define %s 1\n#endif\n\n#if %s" % (name, name, name),
+                      '#include "sdkconfig.h"\n\n#if (CONFIG_GUI_SUBSET_FONTS == true)')
+    with open(path, "w") as f:
+        f.write(src)
+
+
+def main():
+    args = [a for a in sys.argv[1:] if not a.startswith("--")]
+    dump = "--dump" in sys.argv[1:]
+    if len(args) != 2 and not dump:
+        print("usage: font_subset.py <Montserrat-Medium.ttf> <FontAwesome5-Solid+Brands+Regular.woff> [--dump]",
+              file=sys.stderr)
+        sys.exit(1)
+
+    glyphs = scan(load_symbols())
+    for size in SIZES:
+        chars = glyphs[size]
+        if dump:
+            print("%d px: %d glyphs: %s" % (size, len(chars),
+                  "".join(sorted(c if ord(c) < 0xF000 else "<%X>" % ord(c) for c in chars))))
+            continue
+        out_path = os.path.join(OUT_DIR, "gui_font_%d.c" % size)
+        subprocess.check_call(conv_args(size, chars, args[0], args[1], out_path))
+        guard(out_path, size)
+        print("%s: %d glyphs" % (os.path.relpath(out_path, ROOT), len(chars)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,132 @@
+#!/usr/bin/env python3
+#
+# img_rle - run-length encode an LVGL image converter C file (true color with alpha) for
+# the gui_img_rle decoder.  Each color depth section of the input is encoded separately
+# so the output builds for the same configurations.
+#
+# Usage: img_rle.py <image.c> [output.c]   (rewrites the input if no output is given)
+#
+# Encoding, per pixel of LV_IMG_PX_SIZE_ALPHA_BYTE bytes: a control byte n followed by
+#   n & 0x80 : one pixel repeated (n & 0x7F) + 1 times
+#   else     : (n + 1) literal pixels
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import re
+import sys
+
+MAX_COUNT = 128
+
+SECTION_RE = re.compile(r"^#if (LV_COLOR_DEPTH[^\n]*)\n(\s*/\*[^\n]*\*/\n)?(.*?)^#endif", re.S | re.M)
+NAME_RE = re.compile(r"uint8_t (\w+)_map\[\] = \{")
+DIM_RE = re.compile(r"\.header\.(w|h) = (\d+),")
+
+# Bytes per pixel for each section condition
+PX_SIZE = {
+    "LV_COLOR_DEPTH == 1 || LV_COLOR_DEPTH == 8": 2,
+    "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP == 0": 3,
+    "LV_COLOR_DEPTH == 16 && LV_COLOR_16_SWAP != 0": 3,
+    "LV_COLOR_DEPTH == 32": 4,
+}
+
+
+def encode(data, px):
+    pixels = [bytes(data[i:i + px]) for i in range(0, len(data), px)]
+    out = bytearray()
+    i = 0
+    while i < len(pixels):
+        # Run of identical pixels
+        n = 1
+        while i + n < len(pixels) and n < MAX_COUNT and pixels[i + n] == pixels[i]:
+            n += 1
+        if n > 1:
+            out.append(0x80 | (n - 1))
+            out += pixels[i]
+            i += n
+            continue
+
+        # Literals up to the next run of at least two
+        n = 1
+        while i + n < len(pixels) and n < MAX_COUNT:
+            if i + n + 1 < len(pixels) and pixels[i + n] == pixels[i + n + 1]:
+                break
+            n += 1
+        out.append(n - 1)
+        for p in pixels[i:i + n]:
+            out += p
+        i += n
+    return out
+
+
+def c_array(data):
+    lines = []
+    for i in range(0, len(data), 32):
+        lines.append("  " + "".join("0x%02x, " % b for b in data[i:i + 32]))
+    return "\n".join(lines) + "\n"
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("usage: img_rle.py <image.c> [output.c]", file=sys.stderr)
+        sys.exit(1)
+    in_path = sys.argv[1]
+    out_path = sys.argv[2] if len(sys.argv) > 2 else in_path
+    with open(in_path, "r") as f:
+        src = f.read()
+
+    if "LV_IMG_CF_TRUE_COLOR_ALPHA" not in src:
+        print("%s: not a true color with alpha image (already encoded?)" % in_path, file=sys.stderr)
+        sys.exit(1)
+    name = NAME_RE.search(src).group(1)
+    dims = dict(DIM_RE.findall(src))
+    num_px = int(dims["w"]) * int(dims["h"])
+
+    sections = []
+    for m in SECTION_RE.finditer(src):
+        cond = m.group(1).strip()
+        px = PX_SIZE[cond]
+        raw = bytes(int(b, 16) for b in re.findall(r"0x([0-9a-fA-F]{2})", m.group(3)))
+        if len(raw) != num_px * px:
+            print("%s: %s has %d bytes, expected %d" % (in_path, cond, len(raw), num_px * px), file=sys.stderr)
+            sys.exit(1)
+        enc = encode(raw, px)
+        sections.append((cond, m.group(2) or "", enc))
+        print("%s: %s %d -> %d bytes" % (name, cond, len(raw), len(enc)))
+
+    head = src[:src.index("const LV_ATTRIBUTE_MEM_ALIGN")]
+    attr = "LV_ATTRIBUTE_IMG_" + name.upper()
+    out = head
+    out += "/* Run-length encoded by tools/img_rle.py for the gui_img_rle decoder */\n"
+    out += "const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST %s uint8_t %s_map[] = {\n" % (attr, name)
+    for (cond, comment, enc) in sections:
+        out += "#if %s\n%s%s#endif\n" % (cond, comment, c_array(enc))
+    out += "};\n\n"
+    out += "const lv_img_dsc_t %s = {\n" % name
+    out += "  .header.cf = LV_IMG_CF_USER_ENCODED_0,\n"
+    out += "  .header.always_zero = 0,\n"
+    out += "  .header.reserved = 0,\n"
+    out += "  .header.w = %s,\n" % dims["w"]
+    out += "  .header.h = %s,\n" % dims["h"]
+    out += "  .data_size = sizeof(%s_map),\n" % name
+    out += "  .data = %s_map,\n" % name
+    out += "};\n"
+
+    with open(out_path, "w") as f:
+        f.write(out)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+#
+# intl_db - build the country database image for the "intl" data partition from a JSON
+# description (see intl_db.json).  Sampled tones name a header in components/audio_assets
+# holding a C int16_t array.  The order of the countries is the order shown in the GUI
+# and the index saved in persistent storage so only add new countries at the end.
+#
+# Usage: intl_db.py [intl_db.json] [intl.bin]
+#
+# Write the image without rebuilding the application with
+#   parttool.py --port <PORT> write_partition --partition-name intl --input intl.bin
+#
+# Layout (little endian, see international.c)
+#   header  : magic "INTL", u16 version, u16 num_countries, u32 length, u32 crc32 of the
+#             bytes following the header
+#   country : num_countries fixed size records
+#   data    : tone samples (int16_t, 4-byte aligned) and null terminated dial plan strings
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import json
+import os
+import re
+import struct
+import sys
+import zlib
+
+MAGIC = 0x4C544E49
+VERSION = 2
+PART_LEN = 256 * 1024
+
+NAME_LEN = 32
+MAX_TONE_PAIRS = 2
+TONE_SETS = ["dial", "reorder", "off_hook", "ringback"]
+
+HEADER_FMT = "<IHHII"
+COUNTRY_FMT = ("<%dsHHiii" % NAME_LEN) + "II" * len(TONE_SETS) + ("4ffi%di" % (MAX_TONE_PAIRS * 2)) * len(TONE_SETS) + \
+              "ii4i" + "i" + "10i" + "i" + "II"
+
+TOOLS_DIR = os.path.dirname(os.path.abspath(__file__))
+ASSET_DIR = os.path.join(TOOLS_DIR, "..", "components", "audio_assets")
+INT_H = os.path.join(TOOLS_DIR, "..", "components", "utility", "international.h")
+
+DEFINE_RE = re.compile(r"^#define\s+(INT_CID_\w+)\s+(0x[0-9A-Fa-f]+|\d+)", re.M)
+ARRAY_RE = re.compile(r"int16_t\s+\w+\[\]\s*=\s*\{(.*?)\};", re.S)
+
+
+def cid_constants():
+    with open(INT_H) as f:
+        return {m.group(1): int(m.group(2), 0) for m in DEFINE_RE.finditer(f.read())}
+
+
+def read_samples(name):
+    with open(os.path.join(ASSET_DIR, name)) as f:
+        m = ARRAY_RE.search(f.read())
+    if not m:
+        sys.exit("No int16_t array in %s" % name)
+    vals = [int(v, 0) for v in m.group(1).replace("\n", " ").split(",") if v.strip()]
+    # Header values are written as unsigned hex
+    return [v - 0x10000 if v >= 0x8000 else v for v in vals]
+
+
+def align4(buf):
+    buf.extend(b"\0" * (-len(buf) % 4))
+
+
+def build(desc):
+    cid = cid_constants()
+    countries = desc["countries"]
+    data_start = struct.calcsize(HEADER_FMT) + len(countries) * struct.calcsize(COUNTRY_FMT)
+    data = bytearray()
+    records = bytearray()
+
+    for c in countries:
+        name = c["name"].encode()
+        if len(name) >= NAME_LEN:
+            sys.exit("Name too long: %s" % c["name"])
+
+        spec = 0
+        for s in c["cid"]["spec"]:
+            spec |= cid[s]
+
+        samples = []
+        for t in TONE_SETS:
+            if t in c.get("samples", {}):
+                vals = read_samples(c["samples"][t])
+                align4(data)
+                samples += [data_start + len(data), len(vals)]
+                data += struct.pack("<%dh" % len(vals), *vals)
+            else:
+                samples += [0, 0]
+
+        tones = []
+        for t in TONE_SETS:
+            d = c["tones"][t]
+            tones += d["freq"] + [d["level"], d["num_cadence_pairs"]] + d["cadence"]
+
+        plan_offset = data_start + len(data)
+        for p in c["dial_plan"]:
+            data += p.encode() + b"\0"
+
+        r = c["ring"]
+        records += struct.pack(COUNTRY_FMT, name, spec, 0,
+                               c["cid"]["pre_msec"], c["cid"]["post_msec"], c["cid"]["rp_as_msec"],
+                               *samples, *tones,
+                               r["freq"], r["num_cadence_pairs"], *r["cadence"],
+                               c["off_hook_timeout"], *c["rotary_map"], c["lec_tail_msec"],
+                               plan_offset, len(c["dial_plan"]))
+
+    body = records + data
+    length = struct.calcsize(HEADER_FMT) + len(body)
+    if length > PART_LEN:
+        sys.exit("Database is %d bytes, partition holds %d" % (length, PART_LEN))
+    header = struct.pack(HEADER_FMT, MAGIC, VERSION, len(countries), length,
+                         zlib.crc32(body) & 0xFFFFFFFF)
+    return header + body
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(TOOLS_DIR, "intl_db.json")
+    dst = sys.argv[2] if len(sys.argv) > 2 else "intl.bin"
+    with open(src) as f:
+        desc = json.load(f)
+    if desc.get("version", VERSION) != VERSION:
+        sys.exit("Unsupported database version %d" % desc["version"])
+    img = build(desc)
+    with open(dst, "wb") as f:
+        f.write(img)
+    print("%s: %d countries, %d bytes" % (dst, len(desc["countries"]), len(img)))
+
+
+if __name__ == "__main__":
+    main()
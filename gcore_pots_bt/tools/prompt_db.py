@@ -0,0 +1,147 @@
+#!/usr/bin/env python3
+#
+# prompt_db - build the voice prompt database image for the "prompts" data partition (or
+# prompts.bin in the root of the Micro-SD Card) from a directory of 8 kHz, mono, 16-bit WAV
+# files.  Each prompt is read from <name>.wav where the names, in database order (see
+# prompt.h), are listed in PROMPTS.  Missing files leave that prompt empty.
+#
+# Usage: prompt_db.py <wav directory> [prompts.bin]
+#
+# Write the image without rebuilding the application with
+#   parttool.py --port <PORT> write_partition --partition-name prompts --input prompts.bin
+#
+# Layout (little endian, see prompt.c)
+#   header  : magic "PRMT", u16 version, u16 num_prompts, u32 length, u32 crc32 of the
+#             bytes following the header
+#   entry   : num_prompts records of u32 offset (from the start of the image, 0 if empty)
+#             and u32 samples
+#   data    : IMA ADPCM for each prompt starting from a zero predictor and step index, two
+#             samples per byte with the first in the low nibble
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import os
+import struct
+import sys
+import wave
+import zlib
+
+MAGIC = 0x544D5250
+VERSION = 1
+PART_LEN = 256 * 1024
+SAMPLE_RATE = 8000
+
+PROMPTS = ["0", "1", "2", "3", "4", "5", "6", "7", "8", "9",
+           "star", "pound", "not_connected", "battery_low"]
+
+HEADER_FMT = "<IHHII"
+ENTRY_FMT = "<II"
+
+STEP_TABLE = [
+        7,     8,     9,    10,    11,    12,    13,    14,    16,    17,
+       19,    21,    23,    25,    28,    31,    34,    37,    41,    45,
+       50,    55,    60,    66,    73,    80,    88,    97,   107,   118,
+      130,   143,   157,   173,   190,   209,   230,   253,   279,   307,
+      337,   371,   408,   449,   494,   544,   598,   658,   724,   796,
+      876,   963,  1060,  1166,  1282,  1411,  1552,  1707,  1878,  2066,
+     2272,  2499,  2749,  3024,  3327,  3660,  4026,  4428,  4871,  5358,
+     5894,  6484,  7132,  7845,  8630,  9493, 10442, 11487, 12635, 13899,
+    15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+INDEX_TABLE = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+
+def read_wav(path):
+    with wave.open(path, "rb") as w:
+        if w.getframerate() != SAMPLE_RATE or w.getnchannels() != 1 or w.getsampwidth() != 2:
+            sys.exit("%s must be %d Hz, mono, 16-bit" % (path, SAMPLE_RATE))
+        frames = w.readframes(w.getnframes())
+    return list(struct.unpack("<%dh" % (len(frames) // 2), frames))
+
+
+# Matches ima_encode() in ima_adpcm.c
+def ima_encode(samples):
+    predicted = 0
+    index = 0
+    out = bytearray((len(samples) + 1) // 2)
+    for i, v in enumerate(samples):
+        step = STEP_TABLE[index]
+        diff = v - predicted
+        code = 0
+        if diff < 0:
+            code = 8
+            diff = -diff
+        vpdiff = step >> 3
+        if diff >= step:
+            code |= 4
+            diff -= step
+            vpdiff += step
+        step >>= 1
+        if diff >= step:
+            code |= 2
+            diff -= step
+            vpdiff += step
+        step >>= 1
+        if diff >= step:
+            code |= 1
+            vpdiff += step
+
+        predicted += -vpdiff if code & 8 else vpdiff
+        predicted = max(-32768, min(32767, predicted))
+        index = max(0, min(88, index + INDEX_TABLE[code & 7]))
+
+        if i & 1:
+            out[i // 2] |= code << 4
+        else:
+            out[i // 2] = code
+    return out
+
+
+def build(wav_dir):
+    data_start = struct.calcsize(HEADER_FMT) + struct.calcsize(ENTRY_FMT) * len(PROMPTS)
+    entries = b""
+    data = bytearray()
+    for name in PROMPTS:
+        path = os.path.join(wav_dir, name + ".wav")
+        if not os.path.exists(path):
+            print("No %s, prompt left empty" % path)
+            entries += struct.pack(ENTRY_FMT, 0, 0)
+            continue
+        samples = read_wav(path)
+        entries += struct.pack(ENTRY_FMT, data_start + len(data), len(samples))
+        data += ima_encode(samples)
+
+    body = entries + data
+    length = struct.calcsize(HEADER_FMT) + len(body)
+    if length > PART_LEN:
+        sys.exit("Database is %d bytes, partition holds %d" % (length, PART_LEN))
+    header = struct.pack(HEADER_FMT, MAGIC, VERSION, len(PROMPTS), length,
+                         zlib.crc32(body) & 0xFFFFFFFF)
+    return header + body
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit("Usage: prompt_db.py <wav directory> [prompts.bin]")
+    dst = sys.argv[2] if len(sys.argv) > 2 else "prompts.bin"
+    img = build(sys.argv[1])
+    with open(dst, "wb") as f:
+        f.write(img)
+    print("%s: %d prompts, %d bytes" % (dst, len(PROMPTS), len(img)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+#
+# ram_budget - report the internal RAM each component claims at link time and compare it with
+# the budget in ram_budget.json.  Run after every build by the top level CMakeLists (it warns)
+# or by hand with --strict to fail when a component is over budget.
+#
+# Usage: ram_budget.py [--strict] [--budget <file>] <project.map>
+#
+# Sizes come from ESP-IDF's idf_size.py (per archive, so per component).  DRAM is the static
+# .data and .bss - all the task stacks, TCBs, queue storage and DSP pools reserved at build
+# time - and IRAM is the code placed in instruction RAM.  Heap use at run time isn't included.
+#
+# The budget file maps an archive name to its "dram" and/or "iram" limits in bytes.  Archives
+# not listed are reported but not checked.
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import argparse
+import json
+import os
+import subprocess
+import sys
+
+DRAM_SECTIONS = (".dram0.data", ".dram0.bss")
+IRAM_SECTIONS = (".iram0.text", ".iram0.vectors")
+
+
+def archive_sizes(map_file):
+    idf_size = os.path.join(os.environ["IDF_PATH"], "tools", "idf_size.py")
+    out = subprocess.check_output([sys.executable, idf_size, "--archives", "--json", map_file])
+    sizes = {}
+    for name, sections in json.loads(out).items():
+        dram = sum(sections.get(s, 0) for s in DRAM_SECTIONS)
+        iram = sum(sections.get(s, 0) for s in IRAM_SECTIONS)
+        if dram or iram:
+            sizes[name] = (dram, iram)
+    return sizes
+
+
+def main():
+    default_budget = os.path.join(os.path.dirname(os.path.abspath(__file__)), "ram_budget.json")
+    ap = argparse.ArgumentParser(description="Per-component internal RAM budget report")
+    ap.add_argument("--strict", action="store_true", help="exit non-zero when over budget")
+    ap.add_argument("--budget", default=default_budget, help="budget file (default %(default)s)")
+    ap.add_argument("map_file")
+    args = ap.parse_args()
+
+    with open(args.budget) as f:
+        budget = json.load(f)
+    sizes = archive_sizes(args.map_file)
+
+    over = []
+    print("%-32s %8s %8s %8s %8s" % ("Archive", "DRAM", "budget", "IRAM", "budget"))
+    for name in sorted(sizes, key=lambda n: -sizes[n][0]):
+        dram, iram = sizes[name]
+        b = budget.get(name, {})
+        bd = b.get("dram")
+        bi = b.get("iram")
+        flag = ""
+        if (bd is not None and dram > bd) or (bi is not None and iram > bi):
+            flag = "  OVER"
+            over.append(name)
+        print("%-32s %8d %8s %8d %8s%s" % (name, dram, "-" if bd is None else bd,
+                                          iram, "-" if bi is None else bi, flag))
+    print("%-32s %8d %8s %8d" % ("Total", sum(s[0] for s in sizes.values()), "",
+                                 sum(s[1] for s in sizes.values())))
+
+    if over:
+        print("RAM budget exceeded by: %s" % ", ".join(over), file=sys.stderr)
+        return 1 if args.strict else 0
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+#
+# screendump - extract the screendumps (CONFIG_SCREENDUMP_ENABLE) from a captured console log
+# and write each as a 24-bit BMP file.
+#
+# Usage: screendump.py <console.log> [output prefix]   (default prefix "screendump")
+#
+# gui_task frames a dump as "SD: BEGIN <w> <h> <bpp> <swap>", base64 lines of run-length
+# encoded pixel bytes and "SD: END <length> <crc32>".  The encoding matches img_rle.py, per
+# 16-bit pixel: a control byte n followed by
+#   n & 0x80 : one pixel repeated (n & 0x7F) + 1 times
+#   else     : (n + 1) literal pixels
+# Pixels are RGB565 in frame buffer byte order (high byte first when <swap> is 1).
+#
+# Copyright 2023 Dan Julio
+#
+# This is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# It is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this software.  If not, see <https://www.gnu.org/licenses/>.
+#
+import base64
+import re
+import struct
+import sys
+import zlib
+
+LINE_RE = re.compile(r"SD: (.*)$")
+
+
+def decode_rle(data, npixels):
+    px = bytearray()
+    i = 0
+    while i < len(data) and len(px) < 2 * npixels:
+        n = data[i]
+        i += 1
+        if n & 0x80:
+            px += data[i:i + 2] * ((n & 0x7F) + 1)
+            i += 2
+        else:
+            px += data[i:i + 2 * (n + 1)]
+            i += 2 * (n + 1)
+    return px
+
+
+def write_bmp(name, w, h, px, swap):
+    row_len = (w * 3 + 3) & ~3
+    rows = []
+    # BMP rows are bottom up, BGR
+    for y in range(h - 1, -1, -1):
+        row = bytearray()
+        for x in range(w):
+            o = 2 * (y * w + x)
+            v = (px[o] << 8) | px[o + 1] if swap else (px[o + 1] << 8) | px[o]
+            r = (v >> 11) & 0x1F
+            g = (v >> 5) & 0x3F
+            b = v & 0x1F
+            row += bytes(((b << 3) | (b >> 2), (g << 2) | (g >> 4), (r << 3) | (r >> 2)))
+        row += bytes(row_len - len(row))
+        rows.append(bytes(row))
+    image = b"".join(rows)
+    header = struct.pack("<2sIHHI", b"BM", 54 + len(image), 0, 0, 54)
+    info = struct.pack("<IiiHHIIiiII", 40, w, h, 1, 24, 0, len(image), 2835, 2835, 0, 0)
+    with open(name, "wb") as f:
+        f.write(header + info + image)
+
+
+def main():
+    if len(sys.argv) < 2:
+        print("Usage: screendump.py <console.log> [output prefix]")
+        return 1
+    prefix = sys.argv[2] if len(sys.argv) > 2 else "screendump"
+
+    count = 0
+    frame = None
+    with open(sys.argv[1], "r", errors="replace") as f:
+        for line in f:
+            m = LINE_RE.search(line.rstrip("\r\n"))
+            if not m:
+                continue
+            fields = m.group(1).split()
+            if fields and fields[0] == "BEGIN":
+                w, h, bpp, swap = (int(v) for v in fields[1:5])
+                if bpp != 16:
+                    print("Skipping dump with %d bits per pixel" % bpp)
+                    continue
+                frame = {"w": w, "h": h, "swap": swap, "data": bytearray()}
+            elif fields and fields[0] == "END" and frame is not None:
+                length, crc = int(fields[1]), int(fields[2], 16)
+                data = bytes(frame["data"])
+                if len(data) != length or zlib.crc32(data) != crc:
+                    print("Dump %d is damaged (%d of %d bytes, crc %08x expected %08x)" %
+                          (count, len(data), length, zlib.crc32(data), crc))
+                px = decode_rle(data, frame["w"] * frame["h"])
+                px += bytes(2 * frame["w"] * frame["h"] - len(px))
+                name = "%s_%d.bmp" % (prefix, count)
+                write_bmp(name, frame["w"], frame["h"], px, frame["swap"])
+                print("Wrote %s (%d x %d, %d encoded bytes)" % (name, frame["w"], frame["h"], length))
+                count += 1
+                frame = None
+            elif frame is not None:
+                frame["data"] += base64.b64decode(m.group(1))
+
+    if count == 0:
+        print("No screendumps found")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())